@@ -0,0 +1,135 @@
+# FiberFrameEQ.tcl
+# ------------------------------------------------------------------------------------------------------------
+#
+# 2d reinforced concrete moment frame, 10 stories and 5 bays, force based beam-column 
+# elements with fiber sections (Concrete01 & Steel02), subjected to the El Centro record.
+# Exercises the element state determination & the assembly of a banded system.
+#
+# units: kip, in, sec
+
+set numStory 10
+set numBay 5
+set storyHeight 144.0
+set bayWidth 240.0
+set numIP 5
+set numSteps 1500
+set dt 0.01
+
+proc buildModel {} {
+    global numStory numBay storyHeight bayWidth numIP
+
+    wipe
+    model basic -ndm 2 -ndf 3
+
+    # nodes, fixed at base; node tag = 100*floor + column line + 1
+    for {set j 0} {$j <= $numStory} {incr j} {
+	for {set i 0} {$i <= $numBay} {incr i} {
+	    set tag [expr 100*$j + $i + 1]
+	    node $tag [expr $i*$bayWidth] [expr $j*$storyHeight]
+	    if {$j == 0} {
+		fix $tag 1 1 1
+	    } else {
+		mass $tag 0.5 0.5 0.0
+	    }
+	}
+    }
+
+    # materials
+    uniaxialMaterial Concrete01 1 -6.0 -0.004 -5.0 -0.014
+    uniaxialMaterial Concrete01 2 -5.0 -0.002 0.0 -0.006
+    uniaxialMaterial Steel02    3 60.0 30000.0 0.01 18 0.925 0.15
+
+    # column section 24x24 & beam section 18x30
+    section Fiber 1 {
+	patch rect 1 10 1 -10.0 -10.0 10.0 10.0
+	patch rect 2 10 1 -12.0 -12.0 12.0 -10.0
+	patch rect 2 10 1 -12.0  10.0 12.0  12.0
+	patch rect 2  1 1 -12.0 -10.0 -10.0 10.0
+	patch rect 2  1 1  10.0 -10.0  12.0 10.0
+	layer straight 3 4 1.0 -10.0 -10.0 -10.0 10.0
+	layer straight 3 4 1.0  10.0 -10.0  10.0 10.0
+    }
+    section Fiber 2 {
+	patch rect 1 12 1 -13.0 -7.0 13.0 7.0
+	patch rect 2 12 1 -15.0 -9.0 15.0 -7.0
+	patch rect 2 12 1 -15.0  7.0 15.0  9.0
+	layer straight 3 3 1.0 -13.0 -7.0 -13.0 7.0
+	layer straight 3 3 1.0  13.0 -7.0  13.0 7.0
+    }
+
+    geomTransf PDelta 1
+    geomTransf Linear 2
+
+    # columns & beams
+    set eleTag 1
+    for {set j 0} {$j < $numStory} {incr j} {
+	for {set i 0} {$i <= $numBay} {incr i} {
+	    set iNode [expr 100*$j + $i + 1]
+	    set jNode [expr 100*($j+1) + $i + 1]
+	    element forceBeamColumn $eleTag $iNode $jNode $numIP 1 1 -iter 20 1.0e-10
+	    incr eleTag
+	}
+	for {set i 0} {$i < $numBay} {incr i} {
+	    set iNode [expr 100*($j+1) + $i + 1]
+	    set jNode [expr 100*($j+1) + $i + 2]
+	    element forceBeamColumn $eleTag $iNode $jNode $numIP 2 2 -iter 20 1.0e-10
+	    incr eleTag
+	}
+    }
+
+    # gravity
+    pattern Plain 1 Linear {
+	for {set j 1} {$j <= $numStory} {incr j} {
+	    for {set i 0} {$i <= $numBay} {incr i} {
+		load [expr 100*$j + $i + 1] 0.0 -100.0 0.0
+	    }
+	}
+    }
+
+    system BandGeneral
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+    analyze 10
+    loadConst -time 0.0
+    wipeAnalysis
+
+    # ground motion
+    source ../verification/ReadRecord.tcl
+    ReadRecord ../verification/elCentro.at2 elCentro.dat dtRecord nPts
+    timeSeries Path 2 -filePath elCentro.dat -dt $dtRecord -factor 386.4
+    pattern UniformExcitation 2 1 -accel 2
+    rayleigh 0.0 0.0 0.0 0.0025
+
+    system BandGeneral
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-6 50
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+# the results checked against the baseline: the peak roof drift ratio and the sum
+# of the peak horizontal reactions at the base, from envelope recorders
+proc recordResults {} {
+    global numStory numBay storyHeight
+    set roof [expr 100*$numStory + 1]
+    recorder EnvelopeNode -file FiberFrameEQ.roofDrift.env -node $roof -dof 1 disp
+    recorder EnvelopeNode -file FiberFrameEQ.baseShear.env -nodeRange 1 [expr $numBay + 1] -dof 1 reaction
+    return [list roofDrift [expr 1.0/($numStory*$storyHeight)] baseShear 1.0]
+}
+
+proc runAnalysis {} {
+    global numSteps dt
+    set ok [analyze $numSteps $dt]
+    file delete elCentro.dat
+    if {$ok != 0} {
+	puts "FiberFrameEQ: analysis failed at time [getTime]"
+	return [expr int([getTime]/$dt)]
+    }
+    return $numSteps
+}
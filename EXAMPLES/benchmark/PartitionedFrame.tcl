@@ -0,0 +1,146 @@
+# PartitionedFrame.tcl
+# ------------------------------------------------------------------------------------------------------------
+#
+# 3d steel moment frame, 12 stories and 4x4 bays, displacement based beam-column elements
+# with fiber sections, subjected to the El Centro record in both horizontal directions.
+# Intended to be run with OpenSeesSP, where the domain is partitioned among the processes
+# and the system is solved with Mumps, e.g.
+#
+#     mpirun -np 4 OpenSeesSP runBenchmark.tcl PartitionedFrame
+#
+# when run with a single process the same model is analysed sequentially with UmfPack.
+# NOTE: when partitioned, the profile is that of process 0 only.
+#
+# units: kip, in, sec
+
+set numStory 12
+set numBay 4
+set storyHeight 144.0
+set bayWidth 288.0
+set numIP 4
+set numSteps 500
+set dt 0.01
+
+proc buildModel {} {
+    global numStory numBay storyHeight bayWidth numIP
+
+    wipe
+    model basic -ndm 3 -ndf 6
+
+    # nodes, fixed at base; node tag = 1000*floor + 10*i + j + 1
+    for {set k 0} {$k <= $numStory} {incr k} {
+	for {set j 0} {$j <= $numBay} {incr j} {
+	    for {set i 0} {$i <= $numBay} {incr i} {
+		set tag [expr 1000*$k + 10*$i + $j + 1]
+		node $tag [expr $i*$bayWidth] [expr $j*$bayWidth] [expr $k*$storyHeight]
+		if {$k == 0} {
+		    fix $tag 1 1 1 1 1 1
+		} else {
+		    mass $tag 0.2 0.2 0.0 0.0 0.0 0.0
+		}
+	    }
+	}
+    }
+
+    # steel tube sections, column 16x16x1 & beam 12x20x0.75 (local y along depth)
+    uniaxialMaterial Steel01 1 50.0 29000.0 0.02
+    section Fiber 1 -GJ 1.0e7 {
+	patch rect 1 8 2 -8.0 -8.0 8.0 -7.0
+	patch rect 1 8 2 -8.0  7.0 8.0  8.0
+	patch rect 1 2 6 -8.0 -7.0 -7.0 7.0
+	patch rect 1 2 6  7.0 -7.0  8.0 7.0
+    }
+    section Fiber 2 -GJ 1.0e7 {
+	patch rect 1 8 2 -10.0 -6.0 10.0 -5.25
+	patch rect 1 8 2 -10.0  5.25 10.0  6.0
+	patch rect 1 2 6 -10.0 -5.25 -9.25 5.25
+	patch rect 1 2 6  9.25 -5.25 10.0 5.25
+    }
+
+    geomTransf PDelta 1 1.0 0.0 0.0
+    geomTransf Linear 2 0.0 0.0 1.0
+
+    # columns & beams in the x and y directions
+    set eleTag 1
+    for {set k 0} {$k < $numStory} {incr k} {
+	for {set j 0} {$j <= $numBay} {incr j} {
+	    for {set i 0} {$i <= $numBay} {incr i} {
+		set iNode [expr 1000*$k + 10*$i + $j + 1]
+		element dispBeamColumn $eleTag $iNode [expr $iNode + 1000] $numIP 1 1
+		incr eleTag
+		if {$i < $numBay} {
+		    element dispBeamColumn $eleTag [expr $iNode + 1000] [expr $iNode + 1010] $numIP 2 2
+		    incr eleTag
+		}
+		if {$j < $numBay} {
+		    element dispBeamColumn $eleTag [expr $iNode + 1000] [expr $iNode + 1001] $numIP 2 2
+		    incr eleTag
+		}
+	    }
+	}
+    }
+
+    if {[getNP] > 1} {
+	set systemType Mumps
+    } else {
+	set systemType UmfPack
+    }
+
+    # gravity
+    pattern Plain 1 Linear {
+	for {set k 1} {$k <= $numStory} {incr k} {
+	    for {set j 0} {$j <= $numBay} {incr j} {
+		for {set i 0} {$i <= $numBay} {incr i} {
+		    load [expr 1000*$k + 10*$i + $j + 1] 0.0 0.0 -40.0 0.0 0.0 0.0
+		}
+	    }
+	}
+    }
+
+    system $systemType
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-8 20
+    algorithm Newton
+    integrator LoadControl 0.1
+    analysis Static
+    analyze 10
+    loadConst -time 0.0
+    wipeAnalysis
+
+    # ground motion, full record in x, 0.7 of it in y
+    source ../verification/ReadRecord.tcl
+    ReadRecord ../verification/elCentro.at2 elCentro.dat dtRecord nPts
+    timeSeries Path 2 -filePath elCentro.dat -dt $dtRecord -factor 386.4
+    timeSeries Path 3 -filePath elCentro.dat -dt $dtRecord -factor [expr 0.7*386.4]
+    pattern UniformExcitation 2 1 -accel 2
+    pattern UniformExcitation 3 2 -accel 3
+    rayleigh 0.0 0.0 0.0 0.002
+
+    system $systemType
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-6 30
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+# the results checked against the baseline: the sum of the peak roof drift ratios in
+# the two horizontal directions, from an envelope recorder on a roof corner
+proc recordResults {} {
+    global numStory storyHeight
+    recorder EnvelopeNode -file PartitionedFrame.roofDrift.env -node [expr 1000*$numStory + 1] -dof 1 2 disp
+    return [list roofDrift [expr 1.0/($numStory*$storyHeight)]]
+}
+
+proc runAnalysis {} {
+    global numSteps dt
+    set ok [analyze $numSteps $dt]
+    file delete elCentro.dat
+    if {$ok != 0} {
+	puts "PartitionedFrame: analysis failed at time [getTime]"
+	return [expr int([getTime]/$dt)]
+    }
+    return $numSteps
+}
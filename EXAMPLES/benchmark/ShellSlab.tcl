@@ -0,0 +1,94 @@
+# ShellSlab.tcl
+# ------------------------------------------------------------------------------------------------------------
+#
+# 6m x 6m steel plate, clamped on all four edges, 16x16 ShellMITC4 elements with PlateFiber 
+# sections of a J2PlateFibre material, subjected to a harmonic uniform pressure large enough 
+# to yield the plate at the edges. Exercises the shell element state determination & the
+# solution of a large banded SPD pattern system.
+#
+# units: N, m, sec
+
+set numEle 16
+set length 6.0
+set thickness 0.1
+set pressure 6.0e5
+set numSteps 200
+set dt 0.005
+
+proc buildModel {} {
+    global numEle length thickness pressure
+
+    wipe
+    model basic -ndm 3 -ndf 6
+
+    # nodes, node tag = 1 + i + (numEle+1)*j, edges clamped
+    set h [expr $length/$numEle]
+    set nodalArea [expr $h*$h]
+    set nodalMass [expr 7850.0*$thickness*$nodalArea]
+    for {set j 0} {$j <= $numEle} {incr j} {
+	for {set i 0} {$i <= $numEle} {incr i} {
+	    set tag [expr 1 + $i + ($numEle+1)*$j]
+	    node $tag [expr $i*$h] [expr $j*$h] 0.0
+	    if {$i == 0 || $j == 0 || $i == $numEle || $j == $numEle} {
+		fix $tag 1 1 1 1 1 1
+	    } else {
+		mass $tag $nodalMass $nodalMass $nodalMass 0.0 0.0 0.0
+	    }
+	}
+    }
+
+    # steel, E = 200 GPa & nu = 0.3
+    nDMaterial J2PlateFibre 1 2.0e11 0.3 2.5e8 1.0e9 0.0
+    section PlateFiber 1 1 $thickness
+
+    set eleTag 1
+    for {set j 0} {$j < $numEle} {incr j} {
+	for {set i 0} {$i < $numEle} {incr i} {
+	    set n1 [expr 1 + $i + ($numEle+1)*$j]
+	    set n2 [expr $n1 + 1]
+	    set n3 [expr $n2 + $numEle + 1]
+	    set n4 [expr $n1 + $numEle + 1]
+	    element ShellMITC4 $eleTag $n1 $n2 $n3 $n4 1
+	    incr eleTag
+	}
+    }
+
+    # harmonic pressure, period 0.1 sec
+    timeSeries Trig 1 0.0 100.0 0.1
+    pattern Plain 1 1 {
+	set nodalLoad [expr -$pressure*$nodalArea]
+	for {set j 1} {$j < $numEle} {incr j} {
+	    for {set i 1} {$i < $numEle} {incr i} {
+		load [expr 1 + $i + ($numEle+1)*$j] 0.0 0.0 $nodalLoad 0.0 0.0 0.0
+	    }
+	}
+    }
+    rayleigh 0.0 0.0 0.0 0.0005
+
+    system BandSPD
+    constraints Plain
+    numberer RCM
+    test NormDispIncr 1.0e-8 30
+    algorithm Newton
+    integrator Newmark 0.5 0.25
+    analysis Transient
+}
+
+# the results checked against the baseline: the peak deflection at the center of
+# the plate, from an envelope recorder
+proc recordResults {} {
+    global numEle
+    set center [expr 1 + $numEle/2 + ($numEle+1)*($numEle/2)]
+    recorder EnvelopeNode -file ShellSlab.centerDisp.env -node $center -dof 3 disp
+    return [list centerDisp 1.0]
+}
+
+proc runAnalysis {} {
+    global numSteps dt
+    set ok [analyze $numSteps $dt]
+    if {$ok != 0} {
+	puts "ShellSlab: analysis failed at time [getTime]"
+	return [expr int([getTime]/$dt)]
+    }
+    return $numSteps
+}
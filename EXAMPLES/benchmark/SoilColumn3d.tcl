@@ -0,0 +1,108 @@
+# SoilColumn3d.tcl
+# ------------------------------------------------------------------------------------------------------------
+#
+# 3d soil column of SSPbrick elements with a PressureDependMultiYield02 material, the nodes
+# at each level tied horizontally (shear beam conditions). Gravity is applied with the material
+# in its elastic stage, the column is then shaken at the base with the El Centro record.
+# Exercises the nDMaterial state determination & the solution of a sparse system.
+#
+# units: kN, m, sec
+
+set numX 3
+set numY 3
+set numZ 20
+set eleSize 0.5
+set numSteps 600
+set dt 0.01
+
+proc buildModel {} {
+    global numX numY numZ eleSize
+
+    wipe
+    model basic -ndm 3 -ndf 3
+
+    # nodes, node tag = 1 + i + (numX+1)*(j + (numY+1)*k)
+    set nx [expr $numX+1]
+    set nxy [expr $nx*($numY+1)]
+    for {set k 0} {$k <= $numZ} {incr k} {
+	for {set j 0} {$j <= $numY} {incr j} {
+	    for {set i 0} {$i <= $numX} {incr i} {
+		set tag [expr 1 + $i + $nx*$j + $nxy*$k]
+		node $tag [expr $i*$eleSize] [expr $j*$eleSize] [expr $k*$eleSize]
+		if {$k == 0} {
+		    fix $tag 1 1 1
+		} elseif {$tag != [expr 1 + $nxy*$k]} {
+		    equalDOF [expr 1 + $nxy*$k] $tag 1 2
+		}
+	    }
+	}
+    }
+
+    # medium dense sand, mass density in ton/m^3
+    nDMaterial PressureDependMultiYield02 1 3 2.0 9.0e4 2.2e5 32 0.1 101.0 0.5 26 0.067 0.23 0.06 0.27
+
+    set eleTag 1
+    for {set k 0} {$k < $numZ} {incr k} {
+	for {set j 0} {$j < $numY} {incr j} {
+	    for {set i 0} {$i < $numX} {incr i} {
+		set n1 [expr 1 + $i + $nx*$j + $nxy*$k]
+		set n2 [expr $n1 + 1]
+		set n3 [expr $n2 + $nx]
+		set n4 [expr $n1 + $nx]
+		element SSPbrick $eleTag $n1 $n2 $n3 $n4 \
+		    [expr $n1+$nxy] [expr $n2+$nxy] [expr $n3+$nxy] [expr $n4+$nxy] 1 0.0 0.0 -9.81
+		incr eleTag
+	    }
+	}
+    }
+
+    # gravity, body forces are included in the element resisting force
+    updateMaterialStage -material 1 -stage 0
+    system UmfPack
+    constraints Transformation
+    numberer RCM
+    test NormDispIncr 1.0e-6 30
+    algorithm Newton
+    integrator LoadControl 1.0
+    analysis Static
+    analyze 5
+    updateMaterialStage -material 1 -stage 1
+    analyze 5
+    loadConst -time 0.0
+    wipeAnalysis
+
+    # ground motion, acceleration in g
+    source ../verification/ReadRecord.tcl
+    ReadRecord ../verification/elCentro.at2 elCentro.dat dtRecord nPts
+    timeSeries Path 2 -filePath elCentro.dat -dt $dtRecord -factor 9.81
+    pattern UniformExcitation 2 1 -accel 2
+    rayleigh 0.0 0.0 0.0 0.002
+
+    system UmfPack
+    constraints Transformation
+    numberer RCM
+    test NormDispIncr 1.0e-5 30
+    algorithm Newton
+    integrator Newmark 0.6 0.3025
+    analysis Transient
+}
+
+# the results checked against the baseline: the peak displacement of the surface
+# relative to the base, from an envelope recorder
+proc recordResults {} {
+    global numX numY numZ
+    set surface [expr 1 + ($numX+1)*($numY+1)*$numZ]
+    recorder EnvelopeNode -file SoilColumn3d.surfaceDisp.env -node $surface -dof 1 disp
+    return [list surfaceDisp 1.0]
+}
+
+proc runAnalysis {} {
+    global numSteps dt
+    set ok [analyze $numSteps $dt]
+    file delete elCentro.dat
+    if {$ok != 0} {
+	puts "SoilColumn3d: analysis failed at time [getTime]"
+	return [expr int([getTime]/$dt)]
+    }
+    return $numSteps
+}
@@ -0,0 +1,234 @@
+# checkBenchmarks.tcl
+# ------------------------------------------------------------------------------------------------------------
+#
+# the performance gate: runs the benchmark suite and compares it with a baseline, to be invoked as
+#
+#     OpenSees checkBenchmarks.tcl <-baseline fileName?> <-noRun> <-update>
+#
+# for each benchmark the steps/sec, the peak RSS, the wall time of each phase of the profile and
+# the values of the results (see runBenchmark.tcl) are compared with those in the baseline file,
+# baseline.txt by default. Each line of the baseline file is a list, either
+#
+#     tolerance rate|peakRSS|phase|result relativeTolerance
+#     phaseMinimum seconds
+#     benchmarkName rate|peakRSS value
+#     benchmarkName phase phaseName seconds
+#     benchmarkName result resultName value
+#
+# A benchmark regresses if its steps/sec drop, or its peak RSS or the time of one of its phases
+# grow, by more than the tolerance; phases taking less than the minimum in the baseline are not
+# checked. A result that differs from the baseline by more than its tolerance fails whether
+# the analysis got faster or not. Values with no baseline are reported and not checked.
+#
+# -noRun compares the benchmark.out, benchmark.profile and benchmark.results of an earlier run
+# of the suite; -update writes the values of the run to the baseline file, keeping its
+# tolerances. The script exits with 1 if any check failed, 0 otherwise.
+
+set baselineFile baseline.txt
+set runSuite 1
+set update 0
+for {set i 0} {$i < $argc} {incr i} {
+    set arg [lindex $argv $i]
+    if {$arg == "-baseline"} {
+	incr i
+	set baselineFile [lindex $argv $i]
+    } elseif {$arg == "-noRun"} {
+	set runSuite 0
+    } elseif {$arg == "-update"} {
+	set update 1
+    } else {
+	puts "want: OpenSees checkBenchmarks.tcl <-baseline fileName?> <-noRun> <-update>"
+	exit 1
+    }
+}
+
+# the phases of the profile report, see Profiler
+set phases {"element state determination" "form tangent" "form unbalance" "solve" \
+		"convergence test" "domain commit" "recorders"}
+
+# the defaults, replaced by those in the baseline file
+set tolerance(rate) 0.10
+set tolerance(peakRSS) 0.10
+set tolerance(phase) 0.20
+set tolerance(result) 1.0e-6
+set phaseMinimum 0.05
+
+if {$runSuite == 1} {
+    if {[catch {exec [info nameofexecutable] runBenchmarkSuite.tcl >@stdout 2>@stderr} msg]} {
+	puts "checkBenchmarks: the suite FAILED: $msg"
+	exit 1
+    }
+}
+
+# the values of the run: current(benchmark,kind,name)
+proc readCurrent {} {
+    global current phases
+
+    set input [open benchmark.out r]
+    gets $input line
+    while {[gets $input line] >= 0} {
+	if {[llength $line] == 7} {
+	    set current([lindex $line 0],rate,) [lindex $line 3]
+	    set current([lindex $line 0],peakRSS,) [lindex $line 6]
+	}
+    }
+    close $input
+
+    # the wall time of each phase, the second value after the name in the report
+    set input [open benchmark.profile r]
+    set benchName ""
+    while {[gets $input line] >= 0} {
+	if {[regexp {^(\S+):$} $line match name]} {
+	    set benchName $name
+	    continue
+	}
+	foreach phase $phases {
+	    if {$benchName != "" && [string first $phase $line] == 2} {
+		set values [string range $line 31 end]
+		set current($benchName,phase,$phase) [lindex $values 1]
+	    }
+	}
+    }
+    close $input
+
+    if {[file exists benchmark.results]} {
+	set input [open benchmark.results r]
+	while {[gets $input line] >= 0} {
+	    if {[llength $line] == 3} {
+		set current([lindex $line 0],result,[lindex $line 1]) [lindex $line 2]
+	    }
+	}
+	close $input
+    }
+}
+
+# the tolerances and values of the baseline: baseline(benchmark,kind,name)
+proc readBaseline {fileName} {
+    global baseline tolerance phaseMinimum
+
+    if {![file exists $fileName]} {
+	return
+    }
+    set input [open $fileName r]
+    while {[gets $input line] >= 0} {
+	set line [string trim $line]
+	if {$line == "" || [string index $line 0] == "#"} {
+	    continue
+	}
+	set first [lindex $line 0]
+	set kind [lindex $line 1]
+	if {$first == "tolerance"} {
+	    set tolerance($kind) [lindex $line 2]
+	} elseif {$first == "phaseMinimum"} {
+	    set phaseMinimum $kind
+	} elseif {$kind == "rate" || $kind == "peakRSS"} {
+	    set baseline($first,$kind,) [lindex $line 2]
+	} else {
+	    set baseline($first,$kind,[lindex $line 2]) [lindex $line 3]
+	}
+    }
+    close $input
+}
+
+proc writeBaseline {fileName} {
+    global current tolerance phaseMinimum
+
+    # the comments and tolerances of the old file are kept
+    set header {}
+    if {[file exists $fileName]} {
+	set input [open $fileName r]
+	while {[gets $input line] >= 0} {
+	    set trimmed [string trim $line]
+	    if {$trimmed == "" || [string index $trimmed 0] == "#" || \
+		    [lindex $trimmed 0] == "tolerance" || [lindex $trimmed 0] == "phaseMinimum"} {
+		lappend header $line
+	    }
+	}
+	close $input
+    } else {
+	foreach kind {rate peakRSS phase result} {
+	    lappend header [list tolerance $kind $tolerance($kind)]
+	}
+	lappend header [list phaseMinimum $phaseMinimum]
+    }
+
+    set output [open $fileName w]
+    foreach line $header {
+	puts $output $line
+    }
+    foreach key [lsort [array names current]] {
+	foreach {benchName kind name} [split $key ","] {}
+	if {$name == ""} {
+	    puts $output [list $benchName $kind $current($key)]
+	} else {
+	    puts $output [list $benchName $kind $name $current($key)]
+	}
+    }
+    close $output
+}
+
+readCurrent
+
+if {$update == 1} {
+    writeBaseline $baselineFile
+    puts "checkBenchmarks: baseline $baselineFile updated"
+    exit 0
+}
+
+readBaseline $baselineFile
+
+set numFailed 0
+set numChecked 0
+puts [format "%-20s %-8s %-28s %14s %14s %9s  %s" benchmark check name baseline current change status]
+foreach key [lsort [array names current]] {
+    foreach {benchName kind name} [split $key ","] {}
+    set value $current($key)
+    if {![info exists baseline($key)]} {
+	puts [format "%-20s %-8s %-28s %14s %14.6g %9s  %s" $benchName $kind $name "-" $value "" "no baseline"]
+	continue
+    }
+    set base $baseline($key)
+    if {$base != 0.0} {
+	set change [expr ($value - $base)/abs($base)]
+    } else {
+	set change [expr abs($value)]
+    }
+
+    set status ok
+    if {$kind == "rate"} {
+	if {$change < -$tolerance(rate)} {set status REGRESSION}
+    } elseif {$kind == "peakRSS"} {
+	if {$change > $tolerance(peakRSS)} {set status REGRESSION}
+    } elseif {$kind == "phase"} {
+	if {$base < $phaseMinimum} {
+	    set status "not checked"
+	} elseif {$change > $tolerance(phase)} {
+	    set status REGRESSION
+	}
+    } else {
+	if {abs($change) > $tolerance(result)} {set status "RESULT CHANGED"}
+    }
+
+    if {$status != "not checked"} {
+	incr numChecked
+    }
+    if {$status == "REGRESSION" || $status == "RESULT CHANGED"} {
+	incr numFailed
+    }
+    puts [format "%-20s %-8s %-28s %14.6g %14.6g %8.2f%%  %s" $benchName $kind $name $base $value [expr 100.0*$change] $status]
+}
+
+# a benchmark of the baseline that did not run at all fails too
+foreach key [lsort [array names baseline]] {
+    if {![info exists current($key)]} {
+	foreach {benchName kind name} [split $key ","] {}
+	puts [format "%-20s %-8s %-28s %14.6g %14s %9s  %s" $benchName $kind $name $baseline($key) "-" "" MISSING]
+	incr numFailed
+    }
+}
+
+puts "checkBenchmarks: $numChecked checked, $numFailed failed"
+if {$numFailed != 0} {
+    exit 1
+}
+exit 0
@@ -0,0 +1,126 @@
+# runBenchmark.tcl
+# ------------------------------------------------------------------------------------------------------------
+#
+# runs a single benchmark of the suite, to be invoked as
+#
+#     OpenSees runBenchmark.tcl benchmarkName
+#
+# where benchmarkName.tcl defines the procedures:
+#
+#     buildModel    - creates the model and any analysis not to be timed (e.g. gravity)
+#     runAnalysis   - performs the timed analysis, returns the number of steps taken
+#
+# and may define
+#
+#     recordResults - creates EnvelopeNode recorders, each to file benchmarkName.result.env,
+#                     and returns a list of result and factor pairs
+#
+# the benchmark is timed and profiled (see the profile command) and a one line result
+#     name steps wallTime(sec) steps/sec assembly(sec) solve(sec) peakRSS(kB)
+# is appended to benchmark.out, followed by the full profile report. Each benchmark 
+# is run in its own process so that the peak resident set size is that of the benchmark.
+# The value of each result, factor times the sum of the absolute maxima in its envelope 
+# file, is appended to benchmark.results as a line: name result value
+
+if {$argc < 1} {
+    puts "want: OpenSees runBenchmark.tcl benchmarkName"
+    exit
+}
+
+set benchName [lindex $argv 0]
+source $benchName.tcl
+
+# peak resident set size of the process in kB, -1 if not known (only read on linux)
+proc peakRSS {} {
+    if {[catch {open /proc/self/status r} statusFile]} {
+	return -1
+    }
+    set peak -1
+    while {[gets $statusFile line] >= 0} {
+	if {[lindex $line 0] == "VmHWM:"} {
+	    set peak [lindex $line 1]
+	}
+    }
+    close $statusFile
+    return $peak
+}
+
+# the sum of the times in the rows of the profile report for the given phases
+proc phaseTime {reportFile phases} {
+    set total 0.0
+    set input [open $reportFile r]
+    while {[gets $input line] >= 0} {
+	foreach phase $phases {
+	    if {[string first $phase $line] == 2} {
+		set values [string range $line 31 end]
+		set total [expr $total + [lindex $values 1]]
+	    }
+	}
+    }
+    close $input
+    return $total
+}
+
+# factor times the sum of the absolute maxima, the last line, of an envelope file
+proc envelopeResult {fileName factor} {
+    set input [open $fileName r]
+    set lines [split [string trim [read $input]] "\n"]
+    close $input
+    set total 0.0
+    foreach value [lindex $lines end] {
+	set total [expr $total + abs($value)]
+    }
+    return [expr $factor*$total]
+}
+
+buildModel
+
+set resultFactors {}
+if {[info procs recordResults] != ""} {
+    set resultFactors [recordResults]
+}
+
+profile reset
+profile start
+set startTime [clock milliseconds]
+
+set numSteps [runAnalysis]
+
+set wallTime [expr ([clock milliseconds] - $startTime)/1000.0]
+profile stop
+
+set reportFile $benchName.profile
+file delete $reportFile
+profile report $reportFile
+
+set assembly [phaseTime $reportFile {"element state determination" "form tangent" "form unbalance"}]
+set solve [phaseTime $reportFile {"solve"}]
+if {$wallTime > 0.0} {
+    set rate [expr $numSteps/$wallTime]
+} else {
+    set rate 0.0
+}
+
+set results [open benchmark.out a]
+puts $results [format "%-20s %8d %12.3f %12.3f %12.3f %12.3f %12d" $benchName $numSteps $wallTime $rate $assembly $solve [peakRSS]]
+close $results
+
+set results [open benchmark.profile a]
+puts $results "$benchName:"
+set input [open $reportFile r]
+puts -nonewline $results [read $input]
+close $input
+close $results
+file delete $reportFile
+
+# the envelope recorders write their files as they are removed
+remove recorders
+set output [open benchmark.results a]
+foreach {result factor} $resultFactors {
+    set envFile $benchName.$result.env
+    puts $output [format "%-20s %-16s %.10e" $benchName $result [envelopeResult $envFile $factor]]
+    file delete $envFile
+}
+close $output
+
+exit
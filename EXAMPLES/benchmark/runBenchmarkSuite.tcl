@@ -0,0 +1,28 @@
+# script to run all the benchmarks, each in its own OpenSees process
+# results in file benchmark.out, the profile of each in benchmark.profile and
+# the values of their results in benchmark.results
+
+set benchmarks {FiberFrameEQ SoilColumn3d ShellSlab PartitionedFrame}
+
+set results [open benchmark.out w]
+puts $results [format "%-20s %8s %12s %12s %12s %12s %12s" benchmark steps wall(sec) steps/sec assembly solve peakRSS(kB)]
+close $results
+set results [open benchmark.profile w]
+close $results
+set results [open benchmark.results w]
+close $results
+
+set openSees [info nameofexecutable]
+
+foreach benchmark $benchmarks {
+    puts "running $benchmark"
+    if {[catch {exec $openSees runBenchmark.tcl $benchmark >@stdout 2>@stderr} msg]} {
+	puts "$benchmark FAILED: $msg"
+    }
+}
+
+set results [open benchmark.out r]
+puts [read $results]
+close $results
+
+exit
@@ -38,10 +38,19 @@ class Element;
 
 #define MAX_FILENAMELENGTH 50
 
+// storage class for data that is private to each thread, as in OPS_Globals.h
+#ifndef OPS_THREAD_LOCAL
+#if defined(_WIN32) && !defined(__GNUC__)
+#define OPS_THREAD_LOCAL __declspec(thread)
+#else
+#define OPS_THREAD_LOCAL __thread
+#endif
+#endif
+
 //extern ErrorHandler *g3ErrorHandler;   // error handler for sending warning & fatal error messages
-extern double   ops_Dt;                // current delta T for current domain doing an update
+extern OPS_THREAD_LOCAL double   ops_Dt;                // current delta T for current domain doing an update
 // extern double  *ops_Gravity;        // gravity factors for current domain undergoing an update
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+extern OPS_THREAD_LOCAL Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern OPS_THREAD_LOCAL Element *ops_TheActiveElement;  // current element undergoing an update
 
 #endif
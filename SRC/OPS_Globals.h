@@ -61,14 +61,59 @@ class Element;
 
 #define MAX_FILENAMELENGTH 50
 
-extern double   ops_Dt;                // current delta T for current domain doing an update
+// storage class for data that is private to each thread; the tagged
+// object registries of the model builders (materials, sections, time
+// series, transformations, ...) use it so that independent models can be
+// built concurrently
+#ifndef OPS_THREAD_LOCAL
+#if defined(_WIN32) && !defined(__GNUC__)
+#define OPS_THREAD_LOCAL __declspec(thread)
+#else
+#define OPS_THREAD_LOCAL __thread
+#endif
+#endif
+
+// rvalue references, with which the Matrix and Vector operators reuse the
+// storage of temporaries
+#if __cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1600)
+#define OPS_RVALUE_REFS
+#endif
+
+// the globals below are private to each thread, so that independent
+// domains can be built and analyzed concurrently in one process
+extern OPS_THREAD_LOCAL double   ops_Dt;                // current delta T for current domain doing an update
 // extern double  *ops_Gravity;        // gravity factors for current domain undergoing an update
-extern Domain  *ops_TheActiveDomain;   // current domain undergoing an update
-extern Element *ops_TheActiveElement;  // current element undergoing an update
+extern OPS_THREAD_LOCAL Domain  *ops_TheActiveDomain;   // current domain undergoing an update
+extern OPS_THREAD_LOCAL Element *ops_TheActiveElement;  // current element undergoing an update
 
 // global variable for initial state analysis
 // added: Chris McGann, University of Washington
-extern bool  ops_InitialStateAnalysis;
+extern OPS_THREAD_LOCAL bool  ops_InitialStateAnalysis;
+
+// the tangent the current solution algorithm is forming, see SolutionAlgorithm.h
+extern OPS_THREAD_LOCAL int SOLUTION_ALGORITHM_tangentFlag;
+
+// OPS_ThreadGlobals holds the globals above as set in the thread that
+// creates it; set() sets them in the calling thread, e.g. in the threads
+// of an OpenMP loop updating the elements of the current domain
+struct OPS_ThreadGlobals {
+  OPS_ThreadGlobals()
+    :dt(ops_Dt), domain(ops_TheActiveDomain), element(ops_TheActiveElement),
+     initialState(ops_InitialStateAnalysis),
+     tangentFlag(SOLUTION_ALGORITHM_tangentFlag) {}
+  void set(void) const {
+    ops_Dt = dt;
+    ops_TheActiveDomain = domain;
+    ops_TheActiveElement = element;
+    ops_InitialStateAnalysis = initialState;
+    SOLUTION_ALGORITHM_tangentFlag = tangentFlag;
+  }
+  double dt;
+  Domain *domain;
+  Element *element;
+  bool initialState;
+  int tangentFlag;
+};
 
 #define OPS_DISPLAYMODE_MATERIAL_TAG 2
 #define OPS_DISPLAYMODE_ELEMENT_CLASS 3
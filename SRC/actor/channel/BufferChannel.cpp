@@ -0,0 +1,272 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/BufferChannel.cpp,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the implementation of BufferChannel.
+//
+// What: "@(#) BufferChannel.cpp, revA"
+
+#include <BufferChannel.h>
+#include <Message.h>
+#include <MovableObject.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <string.h>
+
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+// smallest contents worth compressing
+#define BUFFER_MIN_COMPRESS 4096
+
+BufferChannel::BufferChannel()
+  :length(0), loc(0)
+{
+
+}
+
+BufferChannel::~BufferChannel()
+{
+
+}
+
+char *
+BufferChannel::addToProgram(void)
+{
+  return 0;
+}
+
+int
+BufferChannel::setUpConnection(void)
+{
+  return 0;
+}
+
+int
+BufferChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  return 0;
+}
+
+int
+BufferChannel::sendObj(int commitTag,
+		       MovableObject &theObject, 
+		       ChannelAddress *theAddress) 
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+int
+BufferChannel::recvObj(int commitTag,
+		       MovableObject &theObject, 
+		       FEM_ObjectBroker &theBroker, 
+		       ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+int
+BufferChannel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddress *theAddress)
+{
+  Message &theMsg = (Message &)msg;
+  return this->append(theMsg.getData(), theMsg.getSize());
+}
+
+int
+BufferChannel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+{
+  return this->take((void *)msg.getData(), msg.getSize(), "Message");
+}
+
+int
+BufferChannel::recvMsgUnknownSize(int dbTag, int commitTag, Message &msg, ChannelAddress *theAddress)
+{
+  // the Message is set to point to its data in the buffer
+  int numBytes = 0;
+  if (loc + (int)sizeof(int) > length) {
+    opserr << "BufferChannel::recvMsgUnknownSize() - no more data in the buffer\n";
+    return -1;
+  }
+  memcpy(&numBytes, &theBuffer[loc], sizeof(int));
+  if (loc + (int)sizeof(int) + numBytes > length) {
+    opserr << "BufferChannel::recvMsgUnknownSize() - no more data in the buffer\n";
+    return -1;
+  }
+  msg.setData(&theBuffer[loc + sizeof(int)], numBytes);
+  loc += sizeof(int) + numBytes;
+  return 0;
+}
+
+int
+BufferChannel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  int numBytes = theMatrix.noRows()*theMatrix.noCols()*sizeof(double);
+  const void *data = (numBytes != 0) ? &(((Matrix &)theMatrix)(0,0)) : 0;
+  return this->append(data, numBytes);
+}
+
+int
+BufferChannel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+{
+  int numBytes = theMatrix.noRows()*theMatrix.noCols()*sizeof(double);
+  void *data = (numBytes != 0) ? &theMatrix(0,0) : 0;
+  return this->take(data, numBytes, "Matrix");
+}
+
+int
+BufferChannel::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+{
+  int numBytes = theVector.Size()*sizeof(double);
+  const void *data = (numBytes != 0) ? &(((Vector &)theVector)(0)) : 0;
+  return this->append(data, numBytes);
+}
+
+int
+BufferChannel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddress *theAddress)
+{
+  int numBytes = theVector.Size()*sizeof(double);
+  void *data = (numBytes != 0) ? &theVector(0) : 0;
+  return this->take(data, numBytes, "Vector");
+}
+
+int
+BufferChannel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+{
+  int numBytes = theID.Size()*sizeof(int);
+  const void *data = (numBytes != 0) ? &(((ID &)theID)(0)) : 0;
+  return this->append(data, numBytes);
+}
+
+int
+BufferChannel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress)
+{
+  int numBytes = theID.Size()*sizeof(int);
+  void *data = (numBytes != 0) ? &theID(0) : 0;
+  return this->take(data, numBytes, "ID");
+}
+
+void
+BufferChannel::clear(void)
+{
+  length = 0;
+  loc = 0;
+}
+
+int
+BufferChannel::getNumBytes(void) const
+{
+  return length;
+}
+
+const char *
+BufferChannel::getData(int &numBytes, bool compress)
+{
+  numBytes = length;
+  if (length == 0)
+    return 0;
+
+#ifdef _ZLIB
+  if (compress == true && length >= BUFFER_MIN_COMPRESS) {
+    uLongf sizeZ = compressBound(length);
+    zBuffer.resize(sizeZ);
+    if (compress2((Bytef *)&zBuffer[0], &sizeZ, (const Bytef *)&theBuffer[0], length,
+		  Z_BEST_SPEED) == Z_OK && sizeZ < (uLongf)length) {
+      numBytes = (int)sizeZ;
+      return &zBuffer[0];
+    }
+  }
+#endif
+
+  return &theBuffer[0];
+}
+
+int
+BufferChannel::setData(const char *data, int numBytes, int numBytesUncompressed)
+{
+  length = 0;
+  loc = 0;
+  if (numBytesUncompressed <= 0)
+    return 0;
+
+  theBuffer.resize(numBytesUncompressed);
+  if (numBytes == numBytesUncompressed) {
+    memcpy(&theBuffer[0], data, numBytes);
+  } else {
+#ifdef _ZLIB
+    uLongf size = numBytesUncompressed;
+    if (uncompress((Bytef *)&theBuffer[0], &size, (const Bytef *)data,
+		   numBytes) != Z_OK || size != (uLongf)numBytesUncompressed) {
+      opserr << "BufferChannel::setData() - could not uncompress the data\n";
+      return -1;
+    }
+#else
+    opserr << "BufferChannel::setData() - received compressed data, ";
+    opserr << "but zlib is not available\n";
+    return -1;
+#endif
+  }
+
+  length = numBytesUncompressed;
+  return 0;
+}
+
+int
+BufferChannel::append(const void *data, int numBytes)
+{
+  int size = length + sizeof(int) + numBytes;
+  if ((int)theBuffer.size() < size)
+    theBuffer.resize((size > 2*(int)theBuffer.size()) ? size : 2*theBuffer.size());
+
+  memcpy(&theBuffer[length], &numBytes, sizeof(int));
+  if (numBytes != 0)
+    memcpy(&theBuffer[length + sizeof(int)], data, numBytes);
+  length = size;
+
+  return 0;
+}
+
+int
+BufferChannel::take(void *data, int numBytes, const char *what)
+{
+  int numSent = 0;
+  if (loc + (int)sizeof(int) <= length)
+    memcpy(&numSent, &theBuffer[loc], sizeof(int));
+  else
+    numSent = -1;
+
+  if (numSent != numBytes || loc + (int)sizeof(int) + numBytes > length) {
+    opserr << "BufferChannel::recv" << what << "() - the size " << numBytes;
+    opserr << " does not match the data in the buffer\n";
+    return -1;
+  }
+
+  if (numBytes != 0)
+    memcpy(data, &theBuffer[loc + sizeof(int)], numBytes);
+  loc += sizeof(int) + numBytes;
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/BufferChannel.h,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the class definition for BufferChannel.
+// BufferChannel is a sub-class of channel that sends to and receives from
+// a buffer in memory, so that many objects can be serialized with their
+// sendSelf() into one contiguous buffer and shipped to another process as
+// a single message, where they are reconstructed with recvSelf() from a
+// BufferChannel holding the received bytes. Every Vector, Matrix, ID or
+// Message is appended as its size in bytes followed by the raw data, and
+// taken out in the same order; as the data is raw bytes all processes are
+// assumed to have the same data representation. If built with _ZLIB the
+// contents can be handed out, and set, zlib compressed.
+//
+// What: "@(#) BufferChannel.h, revA"
+
+#ifndef BufferChannel_h
+#define BufferChannel_h
+
+#include <Channel.h>
+#include <vector>
+
+class BufferChannel : public Channel
+{
+  public:
+    BufferChannel();
+    ~BufferChannel();
+
+    char *addToProgram(void);
+    virtual int setUpConnection(void);
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    virtual ChannelAddress *getLastSendersAddress(void) {return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+
+    // the buffer: clear() empties it for sending; getData() returns its
+    // contents, zlib compressed if asked and worth it, with numBytes set
+    // to their size; setData() replaces the contents with numBytes bytes
+    // of data, compressed if numBytes differs from the size uncompressed,
+    // and receiving starts again from the beginning
+    void clear(void);
+    int getNumBytes(void) const;
+    const char *getData(int &numBytes, bool compress = false);
+    int setData(const char *data, int numBytes, int numBytesUncompressed);
+
+  private:
+    int append(const void *data, int numBytes);
+    int take(void *data, int numBytes, const char *what);
+
+    std::vector<char> theBuffer;
+    std::vector<char> zBuffer;
+    int length;                    // bytes in the buffer
+    int loc;                       // next byte to receive
+};
+
+#endif
@@ -35,6 +35,9 @@
 
 #include <Channel.h>
 #include <Message.h>
+#include <Archive.h>
+#include <Vector.h>
+#include <ID.h>
 #include <MovableObject.h>
 #include <FEM_ObjectBroker.h>
 int Channel::numChannel = 0;
@@ -67,3 +70,64 @@ Channel::getTag(void)
 {
 		return tag;
 }
+
+
+int
+Channel::sendArchive(int dbTag, int commitTag, 
+		     const Archive &theArchive, 
+		     ChannelAddress *theAddress)
+{
+  int numInt = theArchive.getNumInt();
+  int numDouble = theArchive.getNumDouble();
+
+  ID intData(numInt);
+  Vector doubleData(numDouble);
+  double *doublePtr = (numDouble > 0) ? &doubleData(0) : 0;
+  int *intPtr = (numInt > 0) ? &intData(0) : 0;
+  theArchive.pack(doublePtr, intPtr);
+
+  if (numInt > 0)
+    if (this->sendID(dbTag, commitTag, intData, theAddress) < 0) {
+      opserr << "Channel::sendArchive() - failed to send the ID data\n";
+      return -1;
+    }
+
+  if (numDouble > 0)
+    if (this->sendVector(dbTag, commitTag, doubleData, theAddress) < 0) {
+      opserr << "Channel::sendArchive() - failed to send the Vector data\n";
+      return -2;
+    }
+
+  return 0;
+}
+
+
+int
+Channel::recvArchive(int dbTag, int commitTag, 
+		     Archive &theArchive, 
+		     ChannelAddress *theAddress)
+{
+  int numInt = theArchive.getNumInt();
+  int numDouble = theArchive.getNumDouble();
+
+  ID intData(numInt);
+  Vector doubleData(numDouble);
+
+  if (numInt > 0)
+    if (this->recvID(dbTag, commitTag, intData, theAddress) < 0) {
+      opserr << "Channel::recvArchive() - failed to receive the ID data\n";
+      return -1;
+    }
+
+  if (numDouble > 0)
+    if (this->recvVector(dbTag, commitTag, doubleData, theAddress) < 0) {
+      opserr << "Channel::recvArchive() - failed to receive the Vector data\n";
+      return -2;
+    }
+
+  double *doublePtr = (numDouble > 0) ? &doubleData(0) : 0;
+  int *intPtr = (numInt > 0) ? &intData(0) : 0;
+  theArchive.unpack(doublePtr, intPtr);
+
+  return 0;
+}
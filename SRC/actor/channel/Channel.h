@@ -41,6 +41,7 @@
 
 class ChannelAddress;
 class Message;
+class Archive;
 class MovableObject;
 class Matrix;
 class Vector;
@@ -109,6 +110,16 @@ class Channel
 		    ID &theID, 
 		    ChannelAddress *theAddress =0) =0;      
 
+    // send/recv all the spans registered in an Archive; the default
+    // packs the doubles into one Vector and the ints into one ID
+    virtual int sendArchive(int dbTag, int commitTag, 
+			    const Archive &theArchive, 
+			    ChannelAddress *theAddress =0);  
+
+    virtual int recvArchive(int dbTag, int commitTag, 
+			    Archive &theArchive, 
+			    ChannelAddress *theAddress =0);  
+
   protected:
     
   private:
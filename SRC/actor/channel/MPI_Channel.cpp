@@ -34,15 +34,21 @@
 #include <ID.h>
 #include <Vector.h>
 #include <Message.h>
+#include <Archive.h>
 #include <MPI_ChannelAddress.h>
 #include <MovableObject.h>
+#include <string.h>
+#include <Tracer.h>
 
 // MPI_Channel(unsigned int other_Port, char *other_InetAddr): 
 // 	constructor to open a socket with my inet_addr and with a port number 
 //	given by the OS. 
 
-MPI_Channel::MPI_Channel(int other)
- :otherTag(other), otherComm(MPI_COMM_WORLD)
+MPI_Channel::MPI_Channel(int other, MPI_Comm comm, bool aggr)
+ :otherTag(other), otherComm(comm), aggregate(aggr), objDepth(0),
+  sendPacket(0), sendPacketSize(0), sendPacketLength(0),
+  recvPacket(0), recvPacketSize(0), recvPacketLength(0), recvPacketLoc(0),
+  pendingPackets(0), pendingRequests(0), numPending(0), sizePending(0)
 {
   
 }    
@@ -52,7 +58,15 @@ MPI_Channel::MPI_Channel(int other)
 
 MPI_Channel::~MPI_Channel()
 {
-
+  if (aggregate == true) {
+    this->flushPacket();
+    this->completeSends(true);
+  }
+
+  if (sendPacket != 0) delete [] sendPacket;
+  if (recvPacket != 0) delete [] recvPacket;
+  if (pendingPackets != 0) delete [] pendingPackets;
+  if (pendingRequests != 0) delete [] pendingRequests;
 }
 
 
@@ -112,7 +126,20 @@ MPI_Channel::sendObj(int commitTag,
 	    return -1;	    
 	}		    
     }    
-    return theObject.sendSelf(commitTag, *this);
+
+    if (aggregate == false)
+      return theObject.sendSelf(commitTag, *this);
+
+    // the data of the object, and of any objects it sends, goes out
+    // as one packet when the outermost sendObj() is done
+    objDepth++;
+    int res = theObject.sendSelf(commitTag, *this);
+    objDepth--;
+    if (objDepth == 0)
+      if (this->flushPacket() < 0)
+	res = -1;
+
+    return res;
 }
 
 int 
@@ -167,10 +194,16 @@ MPI_Channel::recvMsg(int dbTag, int commitTag, Message &msg, ChannelAddress *the
     gMsg = msg.data;
     nleft = msg.length;
 
-    MPI_Status status;
-    MPI_Recv((void *)gMsg, nleft, MPI_CHAR, otherTag, 0, otherComm, &status);
     int count =0;
-    MPI_Get_count(&status, MPI_CHAR, &count);
+    if (aggregate == true) 
+      count = this->takeFromPacket((void *)gMsg, nleft);
+    else {
+      MPI_Status status;
+      Tracer::begin("MPI recv");
+      MPI_Recv((void *)gMsg, nleft, MPI_CHAR, otherTag, 0, otherComm, &status);
+      Tracer::end("MPI recv");
+      MPI_Get_count(&status, MPI_CHAR, &count);
+    }
     if (count != nleft) {
       opserr << "MPI_Channel::recvMesg() -";
       opserr << " incorrect size of Message received ";
@@ -219,7 +252,12 @@ MPI_Channel::sendMsg(int dbTag, int commitTag, const Message &msg, ChannelAddres
     gMsg = msg.data;
     nleft = msg.length;
 
+    if (aggregate == true)
+      return this->addToPacket((void *)gMsg, nleft);
+
+    Tracer::begin("MPI send");
     MPI_Send((void *)gMsg, nleft, MPI_CHAR, otherTag, 0, otherComm);
+    Tracer::end("MPI send");
     return 0;
 }
 
@@ -249,11 +287,17 @@ MPI_Channel::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddr
     char *gMsg = (char *)data;;
     nleft =  theMatrix.dataSize;
 
-    MPI_Status status;
-    MPI_Recv((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, 
-	     otherComm, &status);
     int count = 0;
-    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    if (aggregate == true) 
+      count = this->takeFromPacket((void *)gMsg, nleft*sizeof(double))/(int)sizeof(double);
+    else {
+      MPI_Status status;
+      Tracer::begin("MPI recv");
+      MPI_Recv((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, 
+	       otherComm, &status);
+      Tracer::end("MPI recv");
+      MPI_Get_count(&status, MPI_DOUBLE, &count);
+    }
     if (count != nleft) {
       opserr << "MPI_Channel::recvMatrix() -";
       opserr << " incorrect number of entries for Matrix received: " << count << "\n";
@@ -292,7 +336,12 @@ MPI_Channel::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, Chann
     char *gMsg = (char *)data;
     nleft =  theMatrix.dataSize;
 
+    if (aggregate == true)
+      return this->addToPacket((void *)gMsg, nleft*sizeof(double));
+
+    Tracer::begin("MPI send");
     MPI_Send((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm);
+    Tracer::end("MPI send");
 
     return 0;
 }
@@ -332,10 +381,16 @@ MPI_Channel::recvVector(int dbTag, int commitTag, Vector &theVector, ChannelAddr
     char *gMsg = (char *)data;;
     nleft =  theVector.sz;
 
-    MPI_Status status;
-    MPI_Recv((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm, &status);
     int count =0;
-    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    if (aggregate == true) 
+      count = this->takeFromPacket((void *)gMsg, nleft*sizeof(double))/(int)sizeof(double);
+    else {
+      MPI_Status status;
+      Tracer::begin("MPI recv");
+      MPI_Recv((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm, &status);
+      Tracer::end("MPI recv");
+      MPI_Get_count(&status, MPI_DOUBLE, &count);
+    }
     if (count != nleft) {
       opserr << "MPI_Channel::recvVector() -";
       opserr << " incorrect number of entries for Vector received: " << count << 
@@ -378,7 +433,12 @@ MPI_Channel::sendVector(int dbTag, int commitTag, const Vector &theVector, Chann
 
     //    opserr << "MPI:sendVector " << otherTag << " " << theVector.Size() << endln;
 
+    if (aggregate == true)
+      return this->addToPacket((void *)gMsg, nleft*sizeof(double));
+
+    Tracer::begin("MPI send");
     MPI_Send((void *)gMsg, nleft, MPI_DOUBLE, otherTag, 0, otherComm);
+    Tracer::end("MPI send");
     
     return 0;
 }
@@ -413,10 +473,16 @@ MPI_Channel::recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddr
 
     //    opserr << "MPI:recvID " << otherTag << " " << theID.Size() << endln;
 
-    MPI_Status status;
-    MPI_Recv((void *)gMsg, nleft, MPI_INT, otherTag, 0, otherComm, &status);
     int count =0;
-    MPI_Get_count(&status, MPI_INT, &count);
+    if (aggregate == true) 
+      count = this->takeFromPacket((void *)gMsg, nleft*sizeof(int))/(int)sizeof(int);
+    else {
+      MPI_Status status;
+      Tracer::begin("MPI recv");
+      MPI_Recv((void *)gMsg, nleft, MPI_INT, otherTag, 0, otherComm, &status);
+      Tracer::end("MPI recv");
+      MPI_Get_count(&status, MPI_INT, &count);
+    }
 
     //    int rank;
     //MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -462,7 +528,12 @@ MPI_Channel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *t
 
     //    opserr << "MPI:sendID " << otherTag << " " << theID.Size() << endln;
 
+    if (aggregate == true)
+      return this->addToPacket((void *)gMsg, nleft*sizeof(int));
+
+    Tracer::begin("MPI send");
     MPI_Send((void *)gMsg, nleft, MPI_INT, otherTag, 0, otherComm);
+    Tracer::end("MPI send");
 
     // int rank;
     // MPI_Comm_rank(MPI_COMM_WORLD, &rank);
@@ -472,6 +543,108 @@ MPI_Channel::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *t
 }
 
 
+
+int
+MPI_Channel::setArchiveType(const Archive &theArchive, MPI_Datatype &theType)
+{
+    // a struct type over the absolute addresses of the spans, used with
+    // MPI_BOTTOM so the data goes straight from/to the spans
+    int numSpans = theArchive.getNumSpans();
+    int *blockLengths = new int[numSpans];
+    MPI_Aint *displacements = new MPI_Aint[numSpans];
+    MPI_Datatype *types = new MPI_Datatype[numSpans];
+
+    for (int i=0; i<numSpans; i++) {
+      blockLengths[i] = theArchive.getSpanSize(i);
+      MPI_Get_address(theArchive.getSpan(i), &displacements[i]);
+      if (theArchive.isDouble(i) == true)
+	types[i] = MPI_DOUBLE;
+      else
+	types[i] = MPI_INT;
+    }
+
+    MPI_Type_create_struct(numSpans, blockLengths, displacements, types, &theType);
+    MPI_Type_commit(&theType);
+
+    delete [] blockLengths;
+    delete [] displacements;
+    delete [] types;
+
+    return 0;
+}
+
+
+int 
+MPI_Channel::sendArchive(int dbTag, int commitTag, const Archive &theArchive, ChannelAddress *theAddress)
+{	
+    // first check address is the only address a MPI_Channel can send to
+    MPI_ChannelAddress *theMPI_ChannelAddress = 0;
+    if (theAddress != 0) {
+      if (theAddress->getType() == MPI_TYPE) {
+	theMPI_ChannelAddress = (MPI_ChannelAddress *)theAddress;
+	otherTag = theMPI_ChannelAddress->otherTag;
+	otherComm= theMPI_ChannelAddress->otherComm;
+      } else {
+	opserr << "MPI_Channel::sendArchive() - a MPI_Channel ";
+	opserr << "can only communicate with a MPI_Channel";
+	opserr << " address given is not of type MPI_ChannelAddress\n"; 
+	return -1;	    
+      }		    
+    }
+
+    // in aggregate mode the data is copied into the packet anyway
+    if (aggregate == true)
+      return this->Channel::sendArchive(dbTag, commitTag, theArchive, theAddress);
+
+    if (theArchive.getNumSpans() == 0)
+      return 0;
+
+    MPI_Datatype theType;
+    this->setArchiveType(theArchive, theType);
+    Tracer::begin("MPI send");
+    MPI_Send(MPI_BOTTOM, 1, theType, otherTag, 0, otherComm);
+    Tracer::end("MPI send");
+    MPI_Type_free(&theType);
+
+    return 0;
+}
+
+
+int 
+MPI_Channel::recvArchive(int dbTag, int commitTag, Archive &theArchive, ChannelAddress *theAddress)
+{	
+    // first check address is the only address a MPI_Channel can send to
+    MPI_ChannelAddress *theMPI_ChannelAddress = 0;
+    if (theAddress != 0) {
+      if (theAddress->getType() == MPI_TYPE) {
+	theMPI_ChannelAddress = (MPI_ChannelAddress *)theAddress;
+	otherTag = theMPI_ChannelAddress->otherTag;
+	otherComm= theMPI_ChannelAddress->otherComm;
+      } else {
+	opserr << "MPI_Channel::recvArchive() - a MPI_Channel ";
+	opserr << "can only communicate with a MPI_Channel";
+	opserr << " address given is not of type MPI_ChannelAddress\n"; 
+	return -1;	    
+      }		    
+    }
+
+    if (aggregate == true)
+      return this->Channel::recvArchive(dbTag, commitTag, theArchive, theAddress);
+
+    if (theArchive.getNumSpans() == 0)
+      return 0;
+
+    MPI_Status status;
+    MPI_Datatype theType;
+    this->setArchiveType(theArchive, theType);
+    Tracer::begin("MPI recv");
+    MPI_Recv(MPI_BOTTOM, 1, theType, otherTag, 0, otherComm, &status);
+    Tracer::end("MPI recv");
+    MPI_Type_free(&theType);
+
+    return 0;
+}
+
 /*
 int 
 MPI_Channel::getPortNumber(void) const
@@ -493,3 +666,160 @@ MPI_Channel::addToProgram(void)
 }
 
 
+// int addToPacket(const void *, int):
+//	Method to append the data as a record [nbytes][data] to the packet
+//	for the other process. Outside a sendObj() the packet is sent at once.
+
+int
+MPI_Channel::addToPacket(const void *data, int nbytes)
+{
+    int newLength = sendPacketLength + sizeof(int) + nbytes;
+    if (newLength > sendPacketSize) {
+      int newSize = 2*sendPacketSize;
+      if (newSize < 8192)
+	newSize = 8192;
+      if (newSize < newLength)
+	newSize = newLength;
+      char *newPacket = new char[newSize];
+      if (sendPacketLength != 0)
+	memcpy(newPacket, sendPacket, sendPacketLength);
+      if (sendPacket != 0)
+	delete [] sendPacket;
+      sendPacket = newPacket;
+      sendPacketSize = newSize;
+    }
+
+    memcpy(&sendPacket[sendPacketLength], &nbytes, sizeof(int));
+    if (nbytes != 0)
+      memcpy(&sendPacket[sendPacketLength+sizeof(int)], data, nbytes);
+    sendPacketLength = newLength;
+
+    if (objDepth == 0)
+      return this->flushPacket();
+
+    return 0;
+}
+
+
+// int takeFromPacket(void *, int):
+//	Method to copy the next record of the received packet into data,
+//	receiving a new packet if the last one has been used up. Returns the
+//	size of the record in bytes, at most nbytes of which are copied.
+
+int
+MPI_Channel::takeFromPacket(void *data, int nbytes)
+{
+    // the other process may be waiting on what we hold before it sends
+    if (this->flushPacket() < 0)
+      return -1;
+
+    if (recvPacketLoc >= recvPacketLength) {
+      MPI_Status status;
+      Tracer::begin("MPI recv");
+      MPI_Probe(otherTag, 0, otherComm, &status);
+      Tracer::end("MPI recv");
+      int length = 0;
+      MPI_Get_count(&status, MPI_BYTE, &length);
+
+      if (length > recvPacketSize) {
+	if (recvPacket != 0)
+	  delete [] recvPacket;
+	recvPacket = new char[length];
+	recvPacketSize = length;
+      }
+
+      Tracer::begin("MPI recv");
+      MPI_Recv((void *)recvPacket, length, MPI_BYTE, otherTag, 0, otherComm, &status);
+      Tracer::end("MPI recv");
+      recvPacketLength = length;
+      recvPacketLoc = 0;
+    }
+
+    int size = 0;
+    memcpy(&size, &recvPacket[recvPacketLoc], sizeof(int));
+    recvPacketLoc += sizeof(int);
+    if (recvPacketLoc + size > recvPacketLength) {
+      opserr << "MPI_Channel::takeFromPacket() - corrupt packet received\n";
+      recvPacketLoc = recvPacketLength;
+      return -1;
+    }
+
+    memcpy(data, &recvPacket[recvPacketLoc], (size < nbytes) ? size : nbytes);
+    recvPacketLoc += size;
+
+    return size;
+}
+
+
+// int flushPacket(void):
+//	Method to send the packet with MPI_Isend; the packet is kept until
+//	the send is found complete.
+
+int
+MPI_Channel::flushPacket(void)
+{
+    if (sendPacketLength == 0)
+      return 0;
+
+    this->completeSends(false);
+
+    if (numPending == sizePending) {
+      int newSize = 2*sizePending + 4;
+      char **newPackets = new char *[newSize];
+      MPI_Request *newRequests = new MPI_Request[newSize];
+      for (int i=0; i<numPending; i++) {
+	newPackets[i] = pendingPackets[i];
+	newRequests[i] = pendingRequests[i];
+      }
+      if (pendingPackets != 0) delete [] pendingPackets;
+      if (pendingRequests != 0) delete [] pendingRequests;
+      pendingPackets = newPackets;
+      pendingRequests = newRequests;
+      sizePending = newSize;
+    }
+
+    if (MPI_Isend((void *)sendPacket, sendPacketLength, MPI_BYTE, otherTag, 0, 
+		  otherComm, &pendingRequests[numPending]) != MPI_SUCCESS) {
+      opserr << "MPI_Channel::flushPacket() - MPI_Isend failed\n";
+      sendPacketLength = 0;
+      return -1;
+    }
+
+    pendingPackets[numPending++] = sendPacket;
+    sendPacket = 0;
+    sendPacketSize = 0;
+    sendPacketLength = 0;
+
+    return 0;
+}
+
+
+// void completeSends(bool wait):
+//	Method to free the packets whose sends have completed, waiting for
+//	all of them if wait is true.
+
+void
+MPI_Channel::completeSends(bool wait)
+{
+    int numLeft = 0;
+    for (int i=0; i<numPending; i++) {
+      MPI_Status status;
+      int done = 0;
+      if (wait == true) {
+	Tracer::begin("MPI wait");
+	MPI_Wait(&pendingRequests[i], &status);
+	Tracer::end("MPI wait");
+	done = 1;
+      } else
+	MPI_Test(&pendingRequests[i], &done, &status);
+
+      if (done != 0)
+	delete [] pendingPackets[i];
+      else {
+	pendingPackets[numLeft] = pendingPackets[i];
+	pendingRequests[numLeft] = pendingRequests[i];
+	numLeft++;
+      }
+    }
+    numPending = numLeft;
+}
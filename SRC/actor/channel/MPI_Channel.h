@@ -30,6 +30,16 @@
 // MPI_Channel is a sub-class of channel. It is implemented with Berkeley
 // stream sockets using the TCP protocol. Messages delivery is garaunteed. 
 // Communication is full-duplex between a pair of connected sockets.
+//
+// If constructed with aggregate true the Matrix, Vector, ID and Message
+// data of a sendObj() is not sent piece by piece but appended to a packet,
+// which is sent with a single non-blocking MPI_Isend when the object has
+// been sent; the receiving channel takes the whole packet with one
+// MPI_Recv and hands the pieces out in order. The packet is raw bytes, so
+// this mode assumes all processes have the same data representation.
+//
+// An Archive is sent as one message described by an MPI struct datatype
+// over the addresses of its spans, so that no data is copied.
 
 #ifndef MPI_Channel_h
 #define MPI_Channel_h
@@ -40,7 +50,8 @@
 class MPI_Channel : public Channel
 {
   public:
-    MPI_Channel(int otherProcess);        
+    MPI_Channel(int otherProcess, MPI_Comm otherComm = MPI_COMM_WORLD,
+		bool aggregate = false);
     ~MPI_Channel();
 
     char *addToProgram(void);
@@ -73,13 +84,34 @@ class MPI_Channel : public Channel
     
     int sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress =0);
     int recvID(int dbTag, int commitTag, ID &theID, ChannelAddress *theAddress =0);    
+
+    int sendArchive(int dbTag, int commitTag, const Archive &theArchive, ChannelAddress *theAddress =0);
+    int recvArchive(int dbTag, int commitTag, Archive &theArchive, ChannelAddress *theAddress =0);
     
     
   protected:
 	
   private:
+    int setArchiveType(const Archive &theArchive, MPI_Datatype &theType);
+
+    int addToPacket(const void *data, int nbytes);
+    int takeFromPacket(void *data, int nbytes);
+    int flushPacket(void);
+    void completeSends(bool wait);
+
     int otherTag;
     MPI_Comm otherComm;    
+
+    // for aggregate mode
+    bool aggregate;
+    int objDepth;                          // nesting of sendObj() calls
+    char *sendPacket;
+    int sendPacketSize, sendPacketLength;
+    char *recvPacket;
+    int recvPacketSize, recvPacketLength, recvPacketLoc;
+    char **pendingPackets;                 // packets of MPI_Isend in flight
+    MPI_Request *pendingRequests;
+    int numPending, sizePending;
 };
 
 
@@ -0,0 +1,507 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/MultiplexedChannel.cpp,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the implementation of the methods needed
+// to define the MultiplexedChannel class interface, and of the
+// ChannelMultiplexer holding the shared connections.
+//
+// What: "@(#) MultiplexedChannel.C, revA"
+
+#include <MultiplexedChannel.h>
+#include <TCP_Socket.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <MovableObject.h>
+
+#include <string.h>
+#include <stdlib.h>
+#include <map>
+#include <deque>
+#include <vector>
+
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+// the kinds of data in a frame
+#define MUX_MSG        1
+#define MUX_MATRIX     2
+#define MUX_VECTOR     3
+#define MUX_ID         4
+#define MUX_COMPRESSED 0x100
+
+// smallest data worth compressing
+#define MUX_MIN_COMPRESS 4096
+
+struct MultiplexFrame {
+  int kind;
+  int numBytes;
+  char *data;
+};
+
+class ChannelMultiplexer
+{
+  public:
+    ChannelMultiplexer(unsigned int port, const char *inetAddr);
+    ~ChannelMultiplexer();
+
+    int setUpConnection(void);
+    int send(int streamID, int kind, const char *data, int numBytes, bool compress);
+    int recv(int streamID, int kind, char *data, int numBytes, bool exact);
+
+    unsigned int port;
+    char *inetAddr;
+    int refCount;
+
+  private:
+    int readFrame(void);
+
+    Channel *theSocket;
+    std::map<int, std::deque<MultiplexFrame> > pending;
+    std::vector<char> sendBuffer;
+    std::vector<char> zBuffer;
+};
+
+// the connections of this process
+static std::vector<ChannelMultiplexer *> theMultiplexers;
+
+static ChannelMultiplexer *
+getMultiplexer(unsigned int port, const char *inetAddr)
+{
+  for (unsigned int i=0; i<theMultiplexers.size(); i++) {
+    ChannelMultiplexer *theMux = theMultiplexers[i];
+    if (theMux->port != port)
+      continue;
+    if ((inetAddr == 0 && theMux->inetAddr == 0) ||
+	(inetAddr != 0 && theMux->inetAddr != 0 && strcmp(inetAddr, theMux->inetAddr) == 0)) {
+      theMux->refCount++;
+      return theMux;
+    }
+  }
+
+  ChannelMultiplexer *theMux = new ChannelMultiplexer(port, inetAddr);
+  theMux->refCount = 1;
+  theMultiplexers.push_back(theMux);
+  return theMux;
+}
+
+static void
+releaseMultiplexer(ChannelMultiplexer *theMux)
+{
+  if (--theMux->refCount > 0)
+    return;
+
+  for (unsigned int i=0; i<theMultiplexers.size(); i++)
+    if (theMultiplexers[i] == theMux) {
+      theMultiplexers.erase(theMultiplexers.begin()+i);
+      break;
+    }
+  delete theMux;
+}
+
+
+ChannelMultiplexer::ChannelMultiplexer(unsigned int p, const char *addr)
+  :port(p), inetAddr(0), refCount(0), theSocket(0)
+{
+  if (addr != 0) {
+    inetAddr = new char[strlen(addr)+1];
+    strcpy(inetAddr, addr);
+  }
+}
+
+
+ChannelMultiplexer::~ChannelMultiplexer()
+{
+  if (theSocket != 0)
+    delete theSocket;
+
+  std::map<int, std::deque<MultiplexFrame> >::iterator it;
+  for (it = pending.begin(); it != pending.end(); it++)
+    for (unsigned int i=0; i<it->second.size(); i++)
+      delete [] it->second[i].data;
+
+  if (inetAddr != 0)
+    delete [] inetAddr;
+}
+
+
+int
+ChannelMultiplexer::setUpConnection(void)
+{
+  // only the first channel opens the connection
+  if (theSocket != 0)
+    return 0;
+
+  // the frames are complete messages, so do not delay them
+  if (inetAddr == 0)
+    theSocket = new TCP_Socket(port, false, 1);
+  else
+    theSocket = new TCP_Socket(port, inetAddr, false, 1);
+
+  if (theSocket->setUpConnection() != 0) {
+    opserr << "ChannelMultiplexer::setUpConnection() - could not connect on port ";
+    opserr << (int)port << endln;
+    delete theSocket;
+    theSocket = 0;
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+ChannelMultiplexer::send(int streamID, int kind, const char *data, int numBytes,
+			 bool compress)
+{
+  if (theSocket == 0) {
+    opserr << "ChannelMultiplexer::send() - not connected\n";
+    return -1;
+  }
+
+  int header[4];
+  header[0] = streamID;
+  header[1] = kind;
+  header[2] = numBytes;
+  header[3] = numBytes;
+
+  const char *payload = data;
+
+#ifdef _ZLIB
+  if (compress == true && numBytes >= MUX_MIN_COMPRESS) {
+    uLongf sizeZ = compressBound(numBytes);
+    zBuffer.resize(sizeZ);
+    if (compress2((Bytef *)&zBuffer[0], &sizeZ, (const Bytef *)data, numBytes,
+		  Z_BEST_SPEED) == Z_OK && sizeZ < (uLongf)numBytes) {
+      header[1] |= MUX_COMPRESSED;
+      header[3] = (int)sizeZ;
+      payload = &zBuffer[0];
+    }
+  }
+#endif
+
+  // header and data go in one message
+  int size = sizeof(header) + header[3];
+  sendBuffer.resize(size);
+  memcpy(&sendBuffer[0], header, sizeof(header));
+  if (header[3] > 0)
+    memcpy(&sendBuffer[sizeof(header)], payload, header[3]);
+
+  Message theMessage(&sendBuffer[0], size);
+  return theSocket->sendMsg(0, 0, theMessage);
+}
+
+
+int
+ChannelMultiplexer::readFrame(void)
+{
+  int header[4];
+  Message headerMsg((char *)header, sizeof(header));
+  if (theSocket->recvMsg(0, 0, headerMsg) < 0) {
+    opserr << "ChannelMultiplexer::readFrame() - could not receive a frame\n";
+    return -1;
+  }
+
+  MultiplexFrame theFrame;
+  theFrame.kind = header[1] & ~MUX_COMPRESSED;
+  theFrame.numBytes = header[2];
+  theFrame.data = new char[header[2] > 0 ? header[2] : 1];
+
+  if ((header[1] & MUX_COMPRESSED) == 0) {
+    if (header[2] > 0) {
+      Message dataMsg(theFrame.data, header[2]);
+      if (theSocket->recvMsg(0, 0, dataMsg) < 0) {
+	delete [] theFrame.data;
+	return -2;
+      }
+    }
+  } else {
+#ifdef _ZLIB
+    zBuffer.resize(header[3]);
+    Message dataMsg(&zBuffer[0], header[3]);
+    uLongf size = header[2];
+    if (theSocket->recvMsg(0, 0, dataMsg) < 0 ||
+	uncompress((Bytef *)theFrame.data, &size, (const Bytef *)&zBuffer[0],
+		   header[3]) != Z_OK || size != (uLongf)header[2]) {
+      opserr << "ChannelMultiplexer::readFrame() - could not uncompress a frame\n";
+      delete [] theFrame.data;
+      return -3;
+    }
+#else
+    opserr << "ChannelMultiplexer::readFrame() - received compressed data, ";
+    opserr << "but zlib is not available\n";
+    delete [] theFrame.data;
+    return -3;
+#endif
+  }
+
+  pending[header[0]].push_back(theFrame);
+
+  return 0;
+}
+
+
+int
+ChannelMultiplexer::recv(int streamID, int kind, char *data, int numBytes, bool exact)
+{
+  if (theSocket == 0) {
+    opserr << "ChannelMultiplexer::recv() - not connected\n";
+    return -1;
+  }
+
+  // read frames until one for this stream is there
+  std::deque<MultiplexFrame> &theQueue = pending[streamID];
+  while (theQueue.empty())
+    if (this->readFrame() < 0)
+      return -1;
+
+  MultiplexFrame theFrame = theQueue.front();
+  theQueue.pop_front();
+
+  int res = 0;
+  if (theFrame.kind != kind) {
+    opserr << "ChannelMultiplexer::recv() - stream " << streamID << " expected data of kind ";
+    opserr << kind << " but received kind " << theFrame.kind << endln;
+    res = -2;
+  } else if (exact == true && theFrame.numBytes != numBytes) {
+    opserr << "ChannelMultiplexer::recv() - stream " << streamID << " expected ";
+    opserr << numBytes << " bytes but received " << theFrame.numBytes << endln;
+    res = -3;
+  } else {
+    res = (theFrame.numBytes < numBytes) ? theFrame.numBytes : numBytes;
+    memcpy(data, theFrame.data, res);
+  }
+
+  delete [] theFrame.data;
+
+  return res;
+}
+
+
+MultiplexedChannel::MultiplexedChannel(unsigned int p, int id, bool comp)
+  :theConnection(0), port(p), inetAddr(0), streamID(id), compress(comp)
+{
+
+}
+
+
+MultiplexedChannel::MultiplexedChannel(unsigned int p, const char *addr,
+				       int id, bool comp)
+  :theConnection(0), port(p), inetAddr(0), streamID(id), compress(comp)
+{
+  if (addr != 0) {
+    inetAddr = new char[strlen(addr)+1];
+    strcpy(inetAddr, addr);
+  }
+}
+
+
+MultiplexedChannel::~MultiplexedChannel()
+{
+  if (theConnection != 0)
+    releaseMultiplexer(theConnection);
+
+  if (inetAddr != 0)
+    delete [] inetAddr;
+}
+
+
+int
+MultiplexedChannel::setUpConnection(void)
+{
+  if (theConnection == 0)
+    theConnection = getMultiplexer(port, inetAddr);
+
+  return theConnection->setUpConnection();
+}
+
+
+int
+MultiplexedChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  opserr << "MultiplexedChannel::setNextAddress() - ";
+  opserr << "a MultiplexedChannel has only one other end\n";
+  return -1;
+}
+
+
+int
+MultiplexedChannel::sendObj(int commitTag,
+			    MovableObject &theObject, 
+			    ChannelAddress *theAddress)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+
+int
+MultiplexedChannel::recvObj(int commitTag,
+			    MovableObject &theObject, 
+			    FEM_ObjectBroker &theBroker,
+			    ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int
+MultiplexedChannel::sendMsg(int dbTag, int commitTag, 
+			    const Message &msg, 
+			    ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  return theConnection->send(streamID, MUX_MSG, msg.data, msg.length, compress);
+}
+
+
+int
+MultiplexedChannel::recvMsg(int dbTag, int commitTag, 
+			    Message &msg, 
+			    ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  int res = theConnection->recv(streamID, MUX_MSG, msg.data, msg.length, true);
+  return (res < 0) ? res : 0;
+}
+
+
+int
+MultiplexedChannel::recvMsgUnknownSize(int dbTag, int commitTag, 
+				       Message &msg, 
+				       ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  // the frame knows its size, take as much of it as fits
+  int res = theConnection->recv(streamID, MUX_MSG, msg.data, msg.length, false);
+  if (res < 0)
+    return res;
+  if (res < msg.length)
+    msg.data[res] = '\0';
+
+  return 0;
+}
+
+
+int
+MultiplexedChannel::sendMatrix(int dbTag, int commitTag, 
+			       const Matrix &theMatrix, 
+			       ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  return theConnection->send(streamID, MUX_MATRIX, (const char *)theMatrix.data,
+			     theMatrix.dataSize*sizeof(double), compress);
+}
+
+
+int
+MultiplexedChannel::recvMatrix(int dbTag, int commitTag, 
+			       Matrix &theMatrix, 
+			       ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  int res = theConnection->recv(streamID, MUX_MATRIX, (char *)theMatrix.data,
+				theMatrix.dataSize*sizeof(double), true);
+  return (res < 0) ? res : 0;
+}
+
+
+int
+MultiplexedChannel::sendVector(int dbTag, int commitTag, 
+			       const Vector &theVector,
+			       ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  return theConnection->send(streamID, MUX_VECTOR, (const char *)theVector.theData,
+			     theVector.sz*sizeof(double), compress);
+}
+
+
+int
+MultiplexedChannel::recvVector(int dbTag, int commitTag, 
+			       Vector &theVector, 
+			       ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  int res = theConnection->recv(streamID, MUX_VECTOR, (char *)theVector.theData,
+				theVector.sz*sizeof(double), true);
+  return (res < 0) ? res : 0;
+}
+
+
+int
+MultiplexedChannel::sendID(int dbTag, int commitTag, 
+			   const ID &theID, 
+			   ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  return theConnection->send(streamID, MUX_ID, (const char *)theID.data,
+			     theID.sz*sizeof(int), compress);
+}
+
+
+int
+MultiplexedChannel::recvID(int dbTag, int commitTag, 
+			   ID &theID, 
+			   ChannelAddress *theAddress)
+{
+  if (theConnection == 0)
+    return -1;
+
+  int res = theConnection->recv(streamID, MUX_ID, (char *)theID.data,
+				theID.sz*sizeof(int), true);
+  return (res < 0) ? res : 0;
+}
+
+
+char *
+MultiplexedChannel::addToProgram(void)
+{
+  opserr << "MultiplexedChannel::addToProgram(void) - ";
+  opserr << " this should not be called\n";
+  char *newStuff =(char *)malloc(10*sizeof(char));
+  for (int i=0; i<10; i++) 
+    newStuff[i] = ' ';
+
+  return newStuff;
+}
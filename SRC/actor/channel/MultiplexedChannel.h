@@ -0,0 +1,115 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/MultiplexedChannel.h,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the class definition for
+// MultiplexedChannel. MultiplexedChannel is a sub-class of channel that
+// lets any number of channels between the same two processes share one
+// persistent TCP connection. Each MultiplexedChannel is identified by a
+// stream id, the same on both ends; the channels of a process connecting
+// to the same port and machine, or listening on the same port, are
+// multiplexed over a single TCP_Socket, opened by the first of them to
+// set up its connection and closed with the last one. Every Vector,
+// Matrix, ID or Message is sent as one framed binary message: a header
+// holding the stream id, the kind and the size of the data, followed by
+// the raw data. A channel receiving a frame for another stream keeps it
+// until that stream asks for it. If built with _ZLIB, data of more than
+// a few kB can be sent zlib compressed.
+//
+// What: "@(#) MultiplexedChannel.h, revA"
+
+#ifndef MultiplexedChannel_h
+#define MultiplexedChannel_h
+
+#include <Channel.h>
+
+class ChannelMultiplexer;
+
+class MultiplexedChannel : public Channel
+{
+  public:
+    MultiplexedChannel(unsigned int port, int streamID,
+		       bool compress = false);
+    MultiplexedChannel(unsigned int other_Port, const char *other_InetAddr,
+		       int streamID, bool compress = false);
+    ~MultiplexedChannel();
+
+    char *addToProgram(void);
+    
+    int setUpConnection(void);
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    ChannelAddress *getLastSendersAddress(void) {return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+		
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+    
+  protected:
+    
+  private:
+    ChannelMultiplexer *theConnection;
+    unsigned int port;
+    char *inetAddr;      // 0 for the listening end
+    int streamID;
+    bool compress;
+};
+
+#endif 
@@ -0,0 +1,447 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/SharedMemoryChannel.cpp,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the implementation of the methods needed
+// to define the SharedMemoryChannel class interface.
+//
+// What: "@(#) SharedMemoryChannel.C, revA"
+
+#include <SharedMemoryChannel.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Message.h>
+#include <MovableObject.h>
+
+#include <atomic>
+#include <new>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sched.h>
+#endif
+
+// size of each ring, a power of 2
+#define SHM_RING_SIZE  262144
+#define SHM_RING_MASK  (SHM_RING_SIZE-1)
+
+// the spins of a busy wait after which the process yields its core
+#define SHM_SPINS      4096
+
+// the two counts are kept on different cache lines so that the writer
+// and the reader do not invalidate each others cache
+struct SharedMemoryRing {
+  std::atomic<long long> head;    // bytes written
+  char pad1[64-sizeof(std::atomic<long long>)];
+  std::atomic<long long> tail;    // bytes read
+  char pad2[64-sizeof(std::atomic<long long>)];
+  char data[SHM_RING_SIZE];
+};
+
+struct SharedMemorySegment {
+  std::atomic<int> state;         // 0 created, 1 server ready, 2 client attached
+  char pad[64-sizeof(std::atomic<int>)];
+  SharedMemoryRing ring[2];       // 0 server to client, 1 client to server
+};
+
+static inline void
+waitABit(int &spins)
+{
+  if (++spins > SHM_SPINS) {
+    spins = 0;
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+  }
+}
+
+
+SharedMemoryChannel::SharedMemoryChannel(const char *theName, bool server)
+  :name(0), isServer(server), theSegment(0), sendRing(0), recvRing(0)
+{
+#ifdef _WIN32
+  hMapFile = 0;
+#else
+  fd = -1;
+#endif
+
+  // posix wants the name of a shared memory object to start with a /
+  name = new char[strlen(theName)+2];
+#ifdef _WIN32
+  strcpy(name, theName);
+#else
+  if (theName[0] == '/')
+    strcpy(name, theName);
+  else {
+    name[0] = '/';
+    strcpy(&name[1], theName);
+  }
+#endif
+}
+
+
+SharedMemoryChannel::~SharedMemoryChannel()
+{
+#ifdef _WIN32
+  if (theSegment != 0)
+    UnmapViewOfFile(theSegment);
+  if (hMapFile != 0)
+    CloseHandle((HANDLE)hMapFile);
+#else
+  if (theSegment != 0)
+    munmap(theSegment, sizeof(SharedMemorySegment));
+  if (fd >= 0)
+    close(fd);
+  if (isServer == true)
+    shm_unlink(name);
+#endif
+
+  if (name != 0)
+    delete [] name;
+}
+
+
+int
+SharedMemoryChannel::setUpConnection(void)
+{
+  if (theSegment != 0)
+    return 0;
+
+  void *addr = 0;
+
+#ifdef _WIN32
+  if (isServer == true) 
+    hMapFile = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+				  0, sizeof(SharedMemorySegment), name);
+  else {
+    // wait for the server to create the segment
+    while ((hMapFile = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name)) == 0)
+      Sleep(1);
+  }
+  if (hMapFile == 0) {
+    opserr << "SharedMemoryChannel::setUpConnection() - could not create ";
+    opserr << "shared memory " << name << endln;
+    return -1;
+  }
+  addr = MapViewOfFile((HANDLE)hMapFile, FILE_MAP_ALL_ACCESS, 0, 0,
+		       sizeof(SharedMemorySegment));
+  if (addr == 0) {
+    opserr << "SharedMemoryChannel::setUpConnection() - could not map ";
+    opserr << "shared memory " << name << endln;
+    return -2;
+  }
+#else
+  if (isServer == true) {
+    shm_unlink(name);
+    fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0 || ftruncate(fd, sizeof(SharedMemorySegment)) != 0) {
+      opserr << "SharedMemoryChannel::setUpConnection() - could not create ";
+      opserr << "shared memory " << name << endln;
+      return -1;
+    }
+  } else {
+    // wait for the server to create the segment and size it
+    struct stat st;
+    while (true) {
+      fd = shm_open(name, O_RDWR, 0600);
+      if (fd >= 0) {
+	if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(SharedMemorySegment))
+	  break;
+	close(fd);
+	fd = -1;
+      }
+      usleep(1000);
+    }
+  }
+  addr = mmap(0, sizeof(SharedMemorySegment), PROT_READ | PROT_WRITE,
+	      MAP_SHARED, fd, 0);
+  if (addr == MAP_FAILED) {
+    opserr << "SharedMemoryChannel::setUpConnection() - could not map ";
+    opserr << "shared memory " << name << endln;
+    return -2;
+  }
+#endif
+
+  theSegment = (SharedMemorySegment *)addr;
+
+  if (isServer == true) {
+    // initialize the rings, then tell the client and wait for it
+    for (int i=0; i<2; i++) {
+      new (&theSegment->ring[i].head) std::atomic<long long>(0);
+      new (&theSegment->ring[i].tail) std::atomic<long long>(0);
+    }
+    theSegment->state.store(1, std::memory_order_release);
+
+    int spins = 0;
+    while (theSegment->state.load(std::memory_order_acquire) != 2)
+      waitABit(spins);
+
+    sendRing = &theSegment->ring[0];
+    recvRing = &theSegment->ring[1];
+  } else {
+    int spins = 0;
+    while (theSegment->state.load(std::memory_order_acquire) != 1)
+      waitABit(spins);
+
+    theSegment->state.store(2, std::memory_order_release);
+
+    sendRing = &theSegment->ring[1];
+    recvRing = &theSegment->ring[0];
+  }
+
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::writeBytes(const char *data, long long numBytes)
+{
+  if (sendRing == 0) {
+    opserr << "SharedMemoryChannel::writeBytes() - channel not connected\n";
+    return -1;
+  }
+
+  long long head = sendRing->head.load(std::memory_order_relaxed);
+  int spins = 0;
+
+  while (numBytes > 0) {
+    long long tail = sendRing->tail.load(std::memory_order_acquire);
+    long long space = SHM_RING_SIZE - (head - tail);
+    if (space == 0) {
+      waitABit(spins);
+      continue;
+    }
+
+    // copy up to the end of the ring at most
+    long long loc = head & SHM_RING_MASK;
+    long long num = numBytes;
+    if (num > space)
+      num = space;
+    if (num > SHM_RING_SIZE - loc)
+      num = SHM_RING_SIZE - loc;
+
+    memcpy(&sendRing->data[loc], data, num);
+    head += num;
+    sendRing->head.store(head, std::memory_order_release);
+
+    data += num;
+    numBytes -= num;
+    spins = 0;
+  }
+
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::readBytes(char *data, long long numBytes)
+{
+  if (recvRing == 0) {
+    opserr << "SharedMemoryChannel::readBytes() - channel not connected\n";
+    return -1;
+  }
+
+  long long tail = recvRing->tail.load(std::memory_order_relaxed);
+  int spins = 0;
+
+  while (numBytes > 0) {
+    long long head = recvRing->head.load(std::memory_order_acquire);
+    long long avail = head - tail;
+    if (avail == 0) {
+      waitABit(spins);
+      continue;
+    }
+
+    long long loc = tail & SHM_RING_MASK;
+    long long num = numBytes;
+    if (num > avail)
+      num = avail;
+    if (num > SHM_RING_SIZE - loc)
+      num = SHM_RING_SIZE - loc;
+
+    memcpy(data, &recvRing->data[loc], num);
+    tail += num;
+    recvRing->tail.store(tail, std::memory_order_release);
+
+    data += num;
+    numBytes -= num;
+    spins = 0;
+  }
+
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::setNextAddress(const ChannelAddress &theAddress)
+{
+  opserr << "SharedMemoryChannel::setNextAddress() - ";
+  opserr << "a SharedMemoryChannel has only one other end\n";
+  return -1;
+}
+
+
+int
+SharedMemoryChannel::sendObj(int commitTag,
+			     MovableObject &theObject, 
+			     ChannelAddress *theAddress)
+{
+  return theObject.sendSelf(commitTag, *this);
+}
+
+
+int
+SharedMemoryChannel::recvObj(int commitTag,
+			     MovableObject &theObject, 
+			     FEM_ObjectBroker &theBroker,
+			     ChannelAddress *theAddress)
+{
+  return theObject.recvSelf(commitTag, *this, theBroker);
+}
+
+
+int
+SharedMemoryChannel::sendMsg(int dbTag, int commitTag, 
+			     const Message &msg, 
+			     ChannelAddress *theAddress)
+{
+  return this->writeBytes(msg.data, msg.length);
+}
+
+
+int
+SharedMemoryChannel::recvMsg(int dbTag, int commitTag, 
+			     Message &msg, 
+			     ChannelAddress *theAddress)
+{
+  return this->readBytes(msg.data, msg.length);
+}
+
+
+int
+SharedMemoryChannel::recvMsgUnknownSize(int dbTag, int commitTag, 
+					Message &msg, 
+					ChannelAddress *theAddress)
+{
+  // read up to and including the end of line or string
+  char *gMsg = msg.data;
+  for (int i=0; i<msg.length; i++) {
+    if (this->readBytes(gMsg, 1) != 0)
+      return -1;
+    if (*gMsg == '\0')
+      return 0;
+    if (*gMsg == '\n') {
+      if (i+1 < msg.length)
+	gMsg[1] = '\0';
+      return 0;
+    }
+    gMsg++;
+  }
+
+  return 0;
+}
+
+
+int
+SharedMemoryChannel::sendMatrix(int dbTag, int commitTag, 
+				const Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  return this->writeBytes((const char *)theMatrix.data,
+			  (long long)theMatrix.dataSize*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::recvMatrix(int dbTag, int commitTag, 
+				Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  return this->readBytes((char *)theMatrix.data,
+			 (long long)theMatrix.dataSize*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::sendVector(int dbTag, int commitTag, 
+				const Vector &theVector,
+				ChannelAddress *theAddress)
+{
+  return this->writeBytes((const char *)theVector.theData,
+			  (long long)theVector.sz*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::recvVector(int dbTag, int commitTag, 
+				Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  return this->readBytes((char *)theVector.theData,
+			 (long long)theVector.sz*sizeof(double));
+}
+
+
+int
+SharedMemoryChannel::sendID(int dbTag, int commitTag, 
+			    const ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  return this->writeBytes((const char *)theID.data,
+			  (long long)theID.sz*sizeof(int));
+}
+
+
+int
+SharedMemoryChannel::recvID(int dbTag, int commitTag, 
+			    ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  return this->readBytes((char *)theID.data,
+			 (long long)theID.sz*sizeof(int));
+}
+
+
+char *
+SharedMemoryChannel::addToProgram(void)
+{
+  opserr << "SharedMemoryChannel::addToProgram(void) - ";
+  opserr << " this should not be called\n";
+  char *newStuff =(char *)malloc(10*sizeof(char));
+  for (int i=0; i<10; i++) 
+    newStuff[i] = ' ';
+
+  return newStuff;
+}
@@ -0,0 +1,124 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/channel/SharedMemoryChannel.h,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the class definition for
+// SharedMemoryChannel. SharedMemoryChannel is a sub-class of channel
+// connecting two processes on the same machine, e.g. a GenericClient and
+// a co-located Adapter or controller, through a named shared memory
+// segment. The segment holds two single producer single consumer byte
+// rings, one for each direction; the writer and the reader only share a
+// byte count each, published with release/acquire atomics, so no lock or
+// system call is involved in sending or receiving. As for a TCP_Socket the
+// data of a Vector, Matrix, ID or Message is sent as raw bytes, one after
+// the other, and the receiver must know what to expect. A receiver that
+// finds no data busy waits for it, which gives the lowest latency at the
+// cost of keeping a core busy. The process that creates the channel with
+// isServer true creates the segment and waits in setUpConnection() for
+// the other one to attach to it.
+//
+// What: "@(#) SharedMemoryChannel.h, revA"
+
+#ifndef SharedMemoryChannel_h
+#define SharedMemoryChannel_h
+
+#include <Channel.h>
+
+struct SharedMemorySegment;
+struct SharedMemoryRing;
+
+class SharedMemoryChannel : public Channel
+{
+  public:
+    SharedMemoryChannel(const char *name, bool isServer);
+    ~SharedMemoryChannel();
+
+    char *addToProgram(void);
+    
+    int setUpConnection(void);
+
+    int setNextAddress(const ChannelAddress &otherChannelAddress);
+    ChannelAddress *getLastSendersAddress(void) {return 0;};
+
+    int sendObj(int commitTag,
+		MovableObject &theObject, 
+		ChannelAddress *theAddress =0);
+    int recvObj(int commitTag,
+		MovableObject &theObject, 
+		FEM_ObjectBroker &theBroker,
+		ChannelAddress *theAddress =0);
+		
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector,
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag, 
+	       const ID &theID, 
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag, 
+	       ID &theID, 
+	       ChannelAddress *theAddress =0);    
+    
+  protected:
+    
+  private:
+    int writeBytes(const char *data, long long numBytes);
+    int readBytes(char *data, long long numBytes);
+
+    char *name;
+    bool isServer;
+
+    SharedMemorySegment *theSegment;
+    SharedMemoryRing *sendRing;
+    SharedMemoryRing *recvRing;
+
+#ifdef _WIN32
+    void *hMapFile;
+#else
+    int fd;
+#endif
+};
+
+#endif 
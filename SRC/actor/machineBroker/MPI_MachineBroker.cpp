@@ -34,16 +34,24 @@
 
 #include <mpi.h>
 
-MPI_MachineBroker::MPI_MachineBroker(FEM_ObjectBroker *theBroker, int argc, char **argv)
+MPI_MachineBroker::MPI_MachineBroker(FEM_ObjectBroker *theBroker, int argc, char **argv,
+				     bool aggregate)
   :MachineBroker(theBroker)
 {
-  MPI_Init(&argc, &argv);
+  // only this thread calls MPI, any OpenMP threads of the solvers and the
+  // element loops do not
+  int provided;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &size);
 
+  // the channels get a communicator of their own, kept apart from the
+  // messages of MUMPS, PETSc and the other solvers on MPI_COMM_WORLD
+  MPI_Comm_dup(MPI_COMM_WORLD, &channelComm);
+
   theChannels = new MPI_Channel *[size];
   for (int i=0; i<size; i++) {
-    theChannels[i] = new MPI_Channel(i);
+    theChannels[i] = new MPI_Channel(i, channelComm, aggregate);
   }
   usedChannels = new ID(size);
   usedChannels->Zero();
@@ -59,6 +67,7 @@ MPI_MachineBroker::~MPI_MachineBroker()
   delete [] theChannels;
   delete usedChannels;
 
+  MPI_Comm_free(&channelComm);
   MPI_Finalize();
 }
 
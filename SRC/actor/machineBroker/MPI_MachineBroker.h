@@ -28,7 +28,10 @@
 //
 // Purpose: This file contains the class definition for MPI_MachineBroker.
 // MPI_MachineBroker is the broker responsible for monitoring the usage of
-// the processes in an mpi run.
+// the processes in an mpi run. The channels communicate over a duplicate
+// of MPI_COMM_WORLD, so their messages never match those of the parallel
+// solvers; if aggregate is true they aggregate the data of each object
+// sent into a single non-blocking message (see MPI_Channel).
 //
 // What: "@(#) MPI_MachineBroker.h, revA"
 
@@ -36,6 +39,7 @@
 #define MPI_MachineBroker_h
 
 #include <MachineBroker.h>
+#include <mpi.h>
 class ID;
 class MPI_Channel;
 class FEM_ObjectBroker;
@@ -43,7 +47,8 @@ class FEM_ObjectBroker;
 class MPI_MachineBroker : public MachineBroker
 {
   public:
-    MPI_MachineBroker(FEM_ObjectBroker *theBroker, int argc, char **argv);
+    MPI_MachineBroker(FEM_ObjectBroker *theBroker, int argc, char **argv,
+		      bool aggregate = false);
     ~MPI_MachineBroker();
 
     // methods to return info about local process id and num processes
@@ -62,6 +67,7 @@ class MPI_MachineBroker : public MachineBroker
     int size;
     ID *usedChannels;
     MPI_Channel **theChannels;
+    MPI_Comm channelComm;
 };
 
 #endif
@@ -0,0 +1,211 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/message/Archive.cpp,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the implementation of Archive.
+
+// What: "@(#) Archive.C, revA"
+
+#include <Archive.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <string.h>
+
+Archive::Archive(int sizeEstimate)
+:spans(0), sizes(0), doubleSpans(0), numSpans(0), maxSpans(0),
+ numDouble(0), numInt(0)
+{
+  if (sizeEstimate < 1)
+    sizeEstimate = 1;
+
+  spans = new void *[sizeEstimate];
+  sizes = new int[sizeEstimate];
+  doubleSpans = new bool[sizeEstimate];
+  maxSpans = sizeEstimate;
+}
+
+
+Archive::~Archive()
+{
+  if (spans != 0) delete [] spans;
+  if (sizes != 0) delete [] sizes;
+  if (doubleSpans != 0) delete [] doubleSpans;
+}
+
+
+int
+Archive::addSpan(void *theData, int size, bool isDouble)
+{
+  if (size <= 0)
+    return 0;
+
+  if (numSpans == maxSpans) {
+    int newMax = 2*maxSpans;
+    void **newSpans = new void *[newMax];
+    int *newSizes = new int[newMax];
+    bool *newDoubleSpans = new bool[newMax];
+    for (int i=0; i<numSpans; i++) {
+      newSpans[i] = spans[i];
+      newSizes[i] = sizes[i];
+      newDoubleSpans[i] = doubleSpans[i];
+    }
+    delete [] spans;
+    delete [] sizes;
+    delete [] doubleSpans;
+    spans = newSpans;
+    sizes = newSizes;
+    doubleSpans = newDoubleSpans;
+    maxSpans = newMax;
+  }
+
+  spans[numSpans] = theData;
+  sizes[numSpans] = size;
+  doubleSpans[numSpans] = isDouble;
+  numSpans++;
+
+  if (isDouble == true)
+    numDouble += size;
+  else
+    numInt += size;
+
+  return 0;
+}
+
+
+int
+Archive::addData(double *theData, int size)
+{
+  return this->addSpan((void *)theData, size, true);
+}
+
+
+int
+Archive::addData(int *theData, int size)
+{
+  return this->addSpan((void *)theData, size, false);
+}
+
+
+int
+Archive::addData(Vector &theVector)
+{
+  return this->addSpan((void *)theVector.theData, theVector.sz, true);
+}
+
+
+int
+Archive::addData(Matrix &theMatrix)
+{
+  return this->addSpan((void *)theMatrix.data, theMatrix.numRows*theMatrix.numCols, true);
+}
+
+
+int
+Archive::addData(ID &theID)
+{
+  return this->addSpan((void *)theID.data, theID.sz, false);
+}
+
+
+void
+Archive::clear(void)
+{
+  numSpans = 0;
+  numDouble = 0;
+  numInt = 0;
+}
+
+
+int
+Archive::getNumSpans(void) const
+{
+  return numSpans;
+}
+
+
+bool
+Archive::isDouble(int span) const
+{
+  return doubleSpans[span];
+}
+
+
+void *
+Archive::getSpan(int span) const
+{
+  return spans[span];
+}
+
+
+int
+Archive::getSpanSize(int span) const
+{
+  return sizes[span];
+}
+
+
+int
+Archive::getNumDouble(void) const
+{
+  return numDouble;
+}
+
+
+int
+Archive::getNumInt(void) const
+{
+  return numInt;
+}
+
+
+void
+Archive::pack(double *doubleData, int *intData) const
+{
+  for (int i=0; i<numSpans; i++) {
+    if (doubleSpans[i] == true) {
+      memcpy(doubleData, spans[i], sizes[i]*sizeof(double));
+      doubleData += sizes[i];
+    } else {
+      memcpy(intData, spans[i], sizes[i]*sizeof(int));
+      intData += sizes[i];
+    }
+  }
+}
+
+
+void
+Archive::unpack(const double *doubleData, const int *intData)
+{
+  for (int i=0; i<numSpans; i++) {
+    if (doubleSpans[i] == true) {
+      memcpy(spans[i], doubleData, sizes[i]*sizeof(double));
+      doubleData += sizes[i];
+    } else {
+      memcpy(spans[i], intData, sizes[i]*sizeof(int));
+      intData += sizes[i];
+    }
+  }
+}
@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/actor/message/Archive.h,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the class definition for Archive.
+// An Archive is a list of spans of existing storage, the data of Vectors,
+// Matrices and IDs or any double or int array, that an object registers
+// in sendSelf()/recvSelf() and then sends or receives with one call to
+// Channel::sendArchive()/recvArchive(). The Archive does not copy or own
+// the storage, so the spans must stay valid until the call returns; on
+// the receiving side the spans must be of the sizes that were sent.
+
+// What: "@(#) Archive.h, revA"
+
+#ifndef Archive_h
+#define Archive_h
+
+class Vector;
+class Matrix;
+class ID;
+
+class Archive
+{
+  public:
+    Archive(int sizeEstimate = 8);
+    virtual ~Archive();
+
+    int addData(double *theData, int size);
+    int addData(int *theData, int size);
+    int addData(Vector &theVector);
+    int addData(Matrix &theMatrix);
+    int addData(ID &theID);
+    void clear(void);
+
+    int getNumSpans(void) const;
+    bool isDouble(int span) const;
+    void *getSpan(int span) const;
+    int getSpanSize(int span) const;
+
+    int getNumDouble(void) const;
+    int getNumInt(void) const;
+
+    // copy the spans to/from contiguous arrays of getNumDouble()
+    // doubles and getNumInt() ints, for channels that can not gather
+    void pack(double *doubleData, int *intData) const;
+    void unpack(const double *doubleData, const int *intData);
+
+  private:
+    int addSpan(void *theData, int size, bool isDouble);
+
+    void **spans;
+    int *sizes;
+    bool *doubleSpans;
+    int numSpans, maxSpans;
+    int numDouble, numInt;
+};
+
+#endif
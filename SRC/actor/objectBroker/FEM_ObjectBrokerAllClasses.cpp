@@ -55,6 +55,7 @@
 
 // graph numbering schemes
 #include <RCM.h>
+#include <MetisNumberer.h>
 #include <MyRCM.h>
 #include <SimpleNumberer.h>
 
@@ -260,6 +261,7 @@
 #include <BbarBrick.h>
 #include <Joint2D.h>		// Arash
 #include <TwoNodeLink.h>
+#include <SuperElement.h>
 
 #include <ElastomericBearingBoucWen2d.h>
 #include <ElastomericBearingBoucWen3d.h>
@@ -310,6 +312,13 @@
 #include <DataFileStream.h>
 #include <DataFileStreamAdd.h>
 #include <BinaryFileStream.h>
+#include <ColumnarFileStream.h>
+#include <ReductionStream.h>
+#include <AsyncStream.h>
+#include <ServerStream.h>
+#ifdef _HDF5
+#include <H5FileStream.h>
+#endif
 #include <DatabaseStream.h>
 #include <DummyStream.h>
 
@@ -376,8 +385,11 @@
 #include <KrylovNewton.h>
 #include <AcceleratedNewton.h>
 #include <ModifiedNewton.h>
+#include <AdaptiveNewton.h>
+#include <InexactNewton.h>
 
 #include <KrylovAccelerator.h>
+#include <AndersonAccelerator.h>
 #include <RaphsonAccelerator.h>
 
 
@@ -405,6 +417,7 @@
 #include <CentralDifference.h>
 #include <CentralDifferenceAlternative.h>
 #include <CentralDifferenceNoDamping.h>
+#include <CentralDifferenceSubcycling.h>
 #include <Collocation.h>
 #include <CollocationHSFixedNumIter.h>
 #include <CollocationHSIncrLimit.h>
@@ -586,6 +599,9 @@ FEM_ObjectBrokerAllClasses::getPtrNewGraphNumberer(int classTag)
 	     
 	case GraphNUMBERER_TAG_SimpleNumberer:  
 	     return new SimpleNumberer();				
+
+	case GraphNUMBERER_TAG_Metis:  
+	     return new MetisNumberer();
 	     
 	     
 	default:
@@ -1672,6 +1688,23 @@ FEM_ObjectBrokerAllClasses::getPtrNewStream(int classTag)
     case OPS_STREAM_TAGS_BinaryFileStream:
 	     return new BinaryFileStream();
 
+    case OPS_STREAM_TAGS_ColumnarFileStream:
+	     return new ColumnarFileStream();
+
+    case OPS_STREAM_TAGS_ReductionStream:
+	     return new ReductionStream();
+
+    case OPS_STREAM_TAGS_AsyncStream:
+	     return new AsyncStream();
+
+    case OPS_STREAM_TAGS_ServerStream:
+	     return new ServerStream();
+
+#ifdef _HDF5
+    case OPS_STREAM_TAGS_H5FileStream:
+	     return new H5FileStream();
+#endif
+
     case OPS_STREAM_TAGS_DatabaseStream:
       return new DatabaseStream();
 
@@ -1822,6 +1855,12 @@ FEM_ObjectBrokerAllClasses::getNewEquiSolnAlgo(int classTag)
 	case EquiALGORITHM_TAGS_ModifiedNewton:  
 	     return new ModifiedNewton();
 
+	case EquiALGORITHM_TAGS_AdaptiveNewton:  
+	     return new AdaptiveNewton();
+
+	case EquiALGORITHM_TAGS_InexactNewton:  
+	     return new InexactNewton();
+
 	case EquiALGORITHM_TAGS_Broyden:  
 	     return new Broyden();
 	     
@@ -1841,6 +1880,8 @@ FEM_ObjectBrokerAllClasses::getAccelerator(int classTag)
 
     case ACCELERATOR_TAGS_Krylov:
       return new KrylovAccelerator;
+    case ACCELERATOR_TAGS_Anderson:
+      return new AndersonAccelerator;
     case ACCELERATOR_TAGS_Raphson:
       return new RaphsonAccelerator;
 
@@ -1946,6 +1987,9 @@ FEM_ObjectBrokerAllClasses::getNewTransientIntegrator(int classTag)
     case INTEGRATOR_TAGS_CentralDifferenceNoDamping:  
 	     return new CentralDifferenceNoDamping();      // must recvSelf
 
+	case INTEGRATOR_TAGS_CentralDifferenceSubcycling:  
+	     return new CentralDifferenceSubcycling();      // must recvSelf
+
 	case INTEGRATOR_TAGS_Collocation:  
 	     return new Collocation();
 
@@ -2265,6 +2309,7 @@ FEM_ObjectBrokerAllClasses::addUniaxialMaterial(int classTag,
     if ((strcmp(lib, matCommands->libName) == 0) && (strcmp(funcName, matCommands->funcName) == 0)) {
       return 0;
     }
+    matCommands = matCommands->next;
   }
 
   //
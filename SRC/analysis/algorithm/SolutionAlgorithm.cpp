@@ -29,7 +29,7 @@
 #include <OPS_Globals.h>
 
 
-int SOLUTION_ALGORITHM_tangentFlag = 0;
+OPS_THREAD_LOCAL int SOLUTION_ALGORITHM_tangentFlag = 0;
 
 SolutionAlgorithm::SolutionAlgorithm(int clasTag)
 :MovableObject(clasTag), theRecorders(0), numRecorders(0)
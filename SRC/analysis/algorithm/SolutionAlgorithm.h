@@ -39,12 +39,13 @@
 // What: "@(#) SolutionAlgorithm.h, revA"
 
 #include <MovableObject.h>
+#include <OPS_Globals.h>
 
 class Channel;
 class FEM_ObjectBroker;
 class Recorder;
 
-extern int SOLUTION_ALGORITHM_tangentFlag;
+extern OPS_THREAD_LOCAL int SOLUTION_ALGORITHM_tangentFlag;
 
 class SolutionAlgorithm: public MovableObject
 {
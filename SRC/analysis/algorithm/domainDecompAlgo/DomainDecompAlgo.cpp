@@ -46,6 +46,7 @@
 #include <Subdomain.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Tracer.h>
 
 DomainDecompAlgo::DomainDecompAlgo()
 :SolutionAlgorithm(DomDecompALGORITHM_TAGS_DomainDecompAlgo),
@@ -71,7 +72,9 @@ DomainDecompAlgo::solveCurrentStep(void)
 	    theSubdomain->getLastExternalSysResponse();
 
 	theSolver->setComputedXext(extResponse);
+	Tracer::begin("interior solve");
 	theSolver->solveXint();
+	Tracer::end("interior solve");
 
 	theIntegrator->update(theLinearSOE->getX());
 	
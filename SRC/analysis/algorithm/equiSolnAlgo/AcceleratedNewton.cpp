@@ -47,6 +47,7 @@
 #include <ID.h>
 
 #include <fstream>
+#include <Profiler.h>
 
 // Constructor
 AcceleratedNewton::AcceleratedNewton(int theTangentToUse)
@@ -208,7 +209,9 @@ AcceleratedNewton::solveCurrentStep(void)
     numIterations++;
 
     // Check convergence criteria
+    Profiler::begin(PROFILE_TEST);
     result = theTest->test();
+    Profiler::end(PROFILE_TEST);
 
     if (result == -1) {
       // Let the accelerator update the tangent if needed
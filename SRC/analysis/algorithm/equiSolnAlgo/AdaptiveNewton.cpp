@@ -0,0 +1,278 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.cpp,v $
+
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for AdaptiveNewton.
+//
+// What: "@(#)AdaptiveNewton.C, revA"
+
+#include <AdaptiveNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <elementAPI.h>
+#include <Profiler.h>
+
+void* OPS_AdaptiveNewton()
+{
+    int formTangent = CURRENT_TANGENT;
+    double maxRatio = 0.25;
+    bool keepAcrossSteps = true;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* type = OPS_GetString();
+	if (strcmp(type,"-secant") == 0) {
+	    formTangent = CURRENT_SECANT;
+	} else if (strcmp(type,"-initial") == 0) {
+	    formTangent = INITIAL_TANGENT;
+	} else if (strcmp(type,"-maxRatio") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    int numdata = 1;
+	    if (OPS_GetDoubleInput(&numdata, &maxRatio) < 0) {
+		opserr << "WARNING AdaptiveNewton -maxRatio $ratio - invalid ratio\n";
+		return 0;
+	    }
+	} else if (strcmp(type,"-everyStep") == 0) {
+	    keepAcrossSteps = false;
+	}
+    }
+
+    return new AdaptiveNewton(formTangent, maxRatio, keepAcrossSteps);
+}
+
+// Constructor
+AdaptiveNewton::AdaptiveNewton(int theTangentToUse, double ratio, bool keep)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_AdaptiveNewton),
+ tangent(theTangentToUse), maxRatio(ratio), keepAcrossSteps(keep),
+ haveTangent(false), numFactorizations(0), numIterations(0)
+{
+  
+}
+
+
+AdaptiveNewton::AdaptiveNewton(ConvergenceTest &theT, int theTangentToUse, 
+			       double ratio, bool keep)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_AdaptiveNewton),
+ tangent(theTangentToUse), maxRatio(ratio), keepAcrossSteps(keep),
+ haveTangent(false), numFactorizations(0), numIterations(0)
+{
+
+}
+
+// Destructor
+AdaptiveNewton::~AdaptiveNewton()
+{
+
+}
+
+
+void
+AdaptiveNewton::setLinks(AnalysisModel &theModel, 
+			 IncrementalIntegrator &theIntegrator,
+			 LinearSOE &theSOE,
+			 ConvergenceTest *theTest)
+{
+  this->EquiSolnAlgo::setLinks(theModel, theIntegrator, theSOE, theTest);
+  haveTangent = false;
+}
+
+
+int
+AdaptiveNewton::domainChanged(void)
+{
+  // the LinearSOE has been sized again
+  haveTangent = false;
+  return 0;
+}
+
+
+int
+AdaptiveNewton::formTangent(IncrementalIntegrator *theIncIntegratorr)
+{
+  SOLUTION_ALGORITHM_tangentFlag = tangent;
+  if (theIncIntegratorr->formTangent(tangent) < 0){
+    opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+    opserr << "the Integrator failed in formTangent()\n";
+    haveTangent = false;
+    return -1;
+  }
+
+  haveTangent = true;
+  numFactorizations++;
+  return 0;
+}
+
+
+int 
+AdaptiveNewton::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    // NOTE this could be taken away if we set Ptrs as protecetd in superclass
+    AnalysisModel       *theAnalysisModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIncIntegratorr = this->getIncrementalIntegratorPtr();
+    LinearSOE	        *theSOE = this->getLinearSOEptr();
+
+    if ((theAnalysisModel == 0) || (theIncIntegratorr == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING AdaptiveNewton::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }	
+
+    if (theIncIntegratorr->formUnbalance() < 0) {
+	opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";	
+	haveTangent = false;
+	return -2;
+    }	
+
+    // the tangent factored in the LinearSOE in an earlier step is used
+    // while the iterations with it contract
+    if (haveTangent == false || keepAcrossSteps == false)
+      if (this->formTangent(theIncIntegratorr) < 0)
+	return -1;
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+      opserr << "AdaptiveNewton::solveCurrentStep() -";
+      opserr << "the ConvergenceTest object failed in start()\n";
+      return -3;
+    }
+
+    // repeat until convergence is obtained or reach max num iterations
+    int result = -1;
+    numIterations = 0;
+    do {
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";	
+	    haveTangent = false;
+	    return -3;
+	}	    
+
+	if (theIncIntegratorr->update(theSOE->getX()) < 0) {
+	    opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";	
+	    haveTangent = false;
+	    return -4;
+	}	        
+
+	if (theIncIntegratorr->formUnbalance() < 0) {
+	    opserr << "WARNING AdaptiveNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";	
+	    haveTangent = false;
+	    return -2;
+	}	
+
+	this->record(numIterations++);
+	Profiler::begin(PROFILE_TEST);
+	result = theTest->test();
+	Profiler::end(PROFILE_TEST);
+
+	// the norms of the last two iterations give the contraction,
+	// when it is too slow the tangent is formed at the current state
+	if (result == -1 && numIterations > 1) {
+	  const Vector &norms = theTest->getNorms();
+	  if (numIterations <= norms.Size()) {
+	    double lastNorm = norms(numIterations-2);
+	    double norm = norms(numIterations-1);
+	    if (norm > maxRatio*lastNorm)
+	      if (this->formTangent(theIncIntegratorr) < 0)
+		return -1;
+	  }
+	}
+
+    } while (result == -1);
+
+    if (result == -2) {
+      opserr << "AdaptiveNewton::solveCurrentStep() -";
+      opserr << "the ConvergenceTest object failed in test()\n";
+      // the step is tried again from the last committed state
+      haveTangent = false;
+      return -3;
+    }
+
+    return result;
+}
+
+
+int
+AdaptiveNewton::getNumFactorizations(void)
+{
+  return numFactorizations;
+}
+
+
+int
+AdaptiveNewton::getNumIterations(void)
+{
+  return numIterations;
+}
+
+
+int
+AdaptiveNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector data(3);
+  data(0) = tangent;
+  data(1) = maxRatio;
+  data(2) = (keepAcrossSteps == true) ? 1.0 : 0.0;
+  return theChannel.sendVector(this->getDbTag(), cTag, data);
+}
+
+
+int
+AdaptiveNewton::recvSelf(int cTag, 
+			 Channel &theChannel, 
+			 FEM_ObjectBroker &theBroker)
+{
+  static Vector data(3);
+  if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "AdaptiveNewton::recvSelf() - failed to receive data\n";
+    return -1;
+  }
+  tangent = (int)data(0);
+  maxRatio = data(1);
+  keepAcrossSteps = (data(2) != 0.0);
+  haveTangent = false;
+  return 0;
+}
+
+
+void
+AdaptiveNewton::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+	s << "AdaptiveNewton" << endln;
+	s << "Max ratio: " << maxRatio << endln;
+	s << "Factorizations: " << numFactorizations << endln;
+    }
+}
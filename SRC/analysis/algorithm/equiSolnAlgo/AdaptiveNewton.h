@@ -0,0 +1,85 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/AdaptiveNewton.h,v $
+
+#ifndef AdaptiveNewton_h
+#define AdaptiveNewton_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// AdaptiveNewton. AdaptiveNewton iterates as ModifiedNewton with the
+// factored tangent in the LinearSOE, but forms the tangent again when the
+// ratio of the last two norms of the ConvergenceTest exceeds maxRatio,
+// i.e. when the contraction of the iterations degrades. The tangent is
+// kept across steps, so that while the model stays near linear a step
+// needs no factorization; it is formed at the start of a step only for
+// the first step, after the domain has changed or a step has failed, or
+// for every step if keepAcrossSteps is false.
+//
+// What: "@(#)AdaptiveNewton.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class ConvergenceTest;
+
+class AdaptiveNewton: public EquiSolnAlgo
+{
+  public:
+    AdaptiveNewton(int tangent = CURRENT_TANGENT, double maxRatio = 0.25,
+		   bool keepAcrossSteps = true);
+    AdaptiveNewton(ConvergenceTest &theTest, int tangent = CURRENT_TANGENT,
+		   double maxRatio = 0.25, bool keepAcrossSteps = true);
+    ~AdaptiveNewton();
+
+    int solveCurrentStep(void);    
+    int domainChanged(void);
+    void setLinks(AnalysisModel &theModel, 
+		  IncrementalIntegrator &theIntegrator,
+		  LinearSOE &theSOE,
+		  ConvergenceTest *theTest);
+
+    int getNumFactorizations(void);
+    int getNumIterations(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, 
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);    
+    
+  protected:
+    
+  private:
+    int formTangent(IncrementalIntegrator *theIntegrator);
+
+    int tangent;
+    double maxRatio;
+    bool keepAcrossSteps;
+
+    bool haveTangent;      // a tangent formed by this is in the LinearSOE
+    int numFactorizations;
+    int numIterations;
+};
+
+#endif
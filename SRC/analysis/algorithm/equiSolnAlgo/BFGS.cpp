@@ -37,6 +37,7 @@
 #include <ConvergenceTest.h>
 #include <ID.h>
 #include <elementAPI.h>
+#include <Profiler.h>
 
 void* OPS_BFGS()
 {
@@ -370,13 +371,17 @@ BFGS::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";	
         }	    
 
+        Profiler::begin(PROFILE_TEST);
         result = localTest->test();
+        Profiler::end(PROFILE_TEST);
  
         
       } while ( result == -1 && nBFGS <= numberLoops );
 
 
+      Profiler::begin(PROFILE_TEST);
       result = theTest->test();
+      Profiler::end(PROFILE_TEST);
       this->record(count++);
 
     }  while (result == -1);
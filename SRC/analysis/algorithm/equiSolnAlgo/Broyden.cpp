@@ -43,6 +43,7 @@
 #include <ID.h>
 #include <math.h>
 #include <elementAPI.h>
+#include <Profiler.h>
 
 void* OPS_Broyden()
 {
@@ -353,12 +354,16 @@ Broyden::solveCurrentStep(void)
           opserr << "the Integrator failed in formUnbalance()\n";	
         }	    
 	
+	Profiler::begin(PROFILE_TEST);
 	result = localTest->test() ;
+	Profiler::end(PROFILE_TEST);
         
       } while ( result == -1 && nBroyden <= numberLoops );
 
 
+      Profiler::begin(PROFILE_TEST);
       result = theTest->test();
+      Profiler::end(PROFILE_TEST);
       this->record(count++);
 
     }  while (result == -1);
@@ -558,7 +563,9 @@ Broyden::Print(OPS_Stream &s, int flag)
 	    return -2;
 	}	
 	
+	Profiler::begin(PROFILE_TEST);
 	result = theTest->test();
+	Profiler::end(PROFILE_TEST);
 	this->record(nBroyden++);
 
       const Vector &du = BroydengetX( theIntegrator, theSOE, nBroyden )  ;
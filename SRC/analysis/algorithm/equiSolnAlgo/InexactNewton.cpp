@@ -0,0 +1,277 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/InexactNewton.cpp,v $
+
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for InexactNewton.
+//
+// What: "@(#)InexactNewton.C, revA"
+
+#include <InexactNewton.h>
+#include <AnalysisModel.h>
+#include <IncrementalIntegrator.h>
+#include <LinearSOE.h>
+#include <LinearSOESolver.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <ConvergenceTest.h>
+#include <elementAPI.h>
+#include <Profiler.h>
+#include <math.h>
+#include <string.h>
+
+void* OPS_InexactNewton()
+{
+    int formTangent = CURRENT_TANGENT;
+    double eta0 = 0.5;
+    double etaMax = 0.9;
+    double gamma = 0.9;
+    double alpha = 2.0;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* type = OPS_GetString();
+	double *value = 0;
+	if (strcmp(type,"-secant") == 0) {
+	    formTangent = CURRENT_SECANT;
+	} else if (strcmp(type,"-initial") == 0) {
+	    formTangent = INITIAL_TANGENT;
+	} else if (strcmp(type,"-eta0") == 0) {
+	    value = &eta0;
+	} else if (strcmp(type,"-etaMax") == 0) {
+	    value = &etaMax;
+	} else if (strcmp(type,"-gamma") == 0) {
+	    value = &gamma;
+	} else if (strcmp(type,"-alpha") == 0) {
+	    value = &alpha;
+	}
+
+	if (value != 0) {
+	    int numdata = 1;
+	    if (OPS_GetNumRemainingInputArgs() < 1 ||
+		OPS_GetDoubleInput(&numdata, value) < 0) {
+		opserr << "WARNING InexactNewton " << type << " $value - invalid value\n";
+		return 0;
+	    }
+	}
+    }
+
+    return new InexactNewton(formTangent, eta0, etaMax, gamma, alpha);
+}
+
+// Constructor
+InexactNewton::InexactNewton(int theTangentToUse, double e0, double eMax,
+			     double g, double a)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_InexactNewton),
+ tangent(theTangentToUse), eta0(e0), etaMax(eMax), gamma(g), alpha(a),
+ eta(0.0), numIterations(0)
+{
+  
+}
+
+
+InexactNewton::InexactNewton(ConvergenceTest &theT, int theTangentToUse,
+			     double e0, double eMax, double g, double a)
+:EquiSolnAlgo(EquiALGORITHM_TAGS_InexactNewton),
+ tangent(theTangentToUse), eta0(e0), etaMax(eMax), gamma(g), alpha(a),
+ eta(0.0), numIterations(0)
+{
+
+}
+
+// Destructor
+InexactNewton::~InexactNewton()
+{
+
+}
+
+
+int 
+InexactNewton::solveCurrentStep(void)
+{
+    // set up some pointers and check they are valid
+    // NOTE this could be taken away if we set Ptrs as protecetd in superclass
+    AnalysisModel       *theAnalysisModel = this->getAnalysisModelPtr();
+    IncrementalIntegrator *theIncIntegratorr = this->getIncrementalIntegratorPtr();
+    LinearSOE	        *theSOE = this->getLinearSOEptr();
+
+    if ((theAnalysisModel == 0) || (theIncIntegratorr == 0) || (theSOE == 0)
+	|| (theTest == 0)){
+	opserr << "WARNING InexactNewton::solveCurrentStep() - setLinks() has";
+	opserr << " not been called - or no ConvergenceTest has been set\n";
+	return -5;
+    }	
+
+    // the tolerance the solver was given is the least used and is set
+    // again when the step is done; a direct solver has none
+    LinearSOESolver *theSolver = theSOE->getSolver();
+    double solverTol = 0.0;
+    if (theSolver != 0)
+      solverTol = theSolver->getTolerance();
+    bool inexact = (solverTol > 0.0);
+
+    if (theIncIntegratorr->formUnbalance() < 0) {
+	opserr << "WARNING InexactNewton::solveCurrentStep() -";
+	opserr << "the Integrator failed in formUnbalance()\n";	
+	return -2;
+    }	
+
+    // set itself as the ConvergenceTest objects EquiSolnAlgo
+    theTest->setEquiSolnAlgo(*this);
+    if (theTest->start() < 0) {
+      opserr << "InexactNewton::solveCurrentStep() -";
+      opserr << "the ConvergenceTest object failed in start()\n";
+      return -3;
+    }
+
+    double normR = theSOE->getB().Norm();
+    eta = (eta0 > solverTol) ? eta0 : solverTol;
+
+    // repeat until convergence is obtained or reach max num iterations
+    int result = -1;
+    numIterations = 0;
+    do {
+	SOLUTION_ALGORITHM_tangentFlag = tangent;
+	if (theIncIntegratorr->formTangent(tangent) < 0){
+	    opserr << "WARNING InexactNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formTangent()\n";
+	    result = -1;
+	    break;
+	}		    
+
+	if (inexact == true)
+	  theSolver->setTolerance(eta);
+
+	if (theSOE->solve() < 0) {
+	    opserr << "WARNING InexactNewton::solveCurrentStep() -";
+	    opserr << "the LinearSysOfEqn failed in solve()\n";	
+	    result = -3;
+	    break;
+	}	    
+
+	if (theIncIntegratorr->update(theSOE->getX()) < 0) {
+	    opserr << "WARNING InexactNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in update()\n";	
+	    result = -4;
+	    break;
+	}	        
+
+	if (theIncIntegratorr->formUnbalance() < 0) {
+	    opserr << "WARNING InexactNewton::solveCurrentStep() -";
+	    opserr << "the Integrator failed in formUnbalance()\n";	
+	    result = -2;
+	    break;
+	}	
+
+	Profiler::begin(PROFILE_TEST);
+	result = theTest->test();
+	Profiler::end(PROFILE_TEST);
+	numIterations++;
+	this->record(numIterations);
+
+	// the forcing term of the next solve from the reduction of the
+	// unbalance in this iteration
+	if (result == -1 && inexact == true) {
+	  double lastNormR = normR;
+	  normR = theSOE->getB().Norm();
+
+	  double etaSafe = gamma*pow(eta, alpha);
+	  if (lastNormR > 0.0)
+	    eta = gamma*pow(normR/lastNormR, alpha);
+	  else
+	    eta = 0.0;
+	  if (etaSafe > 0.1 && etaSafe > eta)
+	    eta = etaSafe;
+	  if (eta > etaMax)
+	    eta = etaMax;
+	  if (eta < solverTol)
+	    eta = solverTol;
+	}
+
+    } while (result == -1);
+
+    if (inexact == true)
+      theSolver->setTolerance(solverTol);
+
+    if (result == -2) {
+      opserr << "InexactNewton::solveCurrentStep() -";
+      opserr << "the ConvergenceTest object failed in test()\n";
+      return -3;
+    }
+
+    return result;
+}
+
+
+int
+InexactNewton::getNumIterations(void)
+{
+  return numIterations;
+}
+
+
+int
+InexactNewton::sendSelf(int cTag, Channel &theChannel)
+{
+  static Vector data(5);
+  data(0) = tangent;
+  data(1) = eta0;
+  data(2) = etaMax;
+  data(3) = gamma;
+  data(4) = alpha;
+  return theChannel.sendVector(this->getDbTag(), cTag, data);
+}
+
+
+int
+InexactNewton::recvSelf(int cTag, 
+			Channel &theChannel, 
+			FEM_ObjectBroker &theBroker)
+{
+  static Vector data(5);
+  if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "InexactNewton::recvSelf() - failed to receive data\n";
+    return -1;
+  }
+  tangent = (int)data(0);
+  eta0 = data(1);
+  etaMax = data(2);
+  gamma = data(3);
+  alpha = data(4);
+  return 0;
+}
+
+
+void
+InexactNewton::Print(OPS_Stream &s, int flag)
+{
+    if (flag == 0) {
+	s << "InexactNewton" << endln;
+	s << "eta0: " << eta0 << " etaMax: " << etaMax;
+	s << " gamma: " << gamma << " alpha: " << alpha << endln;
+	s << "Last forcing term: " << eta << endln;
+    }
+}
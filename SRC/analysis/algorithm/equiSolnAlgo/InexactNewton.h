@@ -0,0 +1,80 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/InexactNewton.h,v $
+
+#ifndef InexactNewton_h
+#define InexactNewton_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// InexactNewton. InexactNewton iterates as NewtonRaphson, but each
+// solve() of an iterative LinearSOESolver is only converged to the
+// relative tolerance eta, |B - AX| <= eta |B|, chosen as in Eisenstat and
+// Walker ("Choosing the Forcing Terms in an Inexact Newton Method", SIAM
+// J. Sci. Comput. 17, 1996, choice 2):
+//       eta_k = gamma (|R_k| / |R_k-1|)^alpha
+// with the safeguard eta_k >= gamma eta_k-1^alpha when the latter is over
+// 0.1, and eta_k <= etaMax. The first solve of a step uses eta0. R is the
+// unbalance in the LinearSOE after formUnbalance(). The tolerance of the
+// solver when the step starts is the least eta used, and is given back to
+// the solver at the end of the step. For a direct solver the algorithm is
+// NewtonRaphson.
+//
+// What: "@(#)InexactNewton.h, revA"
+
+#include <EquiSolnAlgo.h>
+
+class ConvergenceTest;
+
+class InexactNewton: public EquiSolnAlgo
+{
+  public:
+    InexactNewton(int tangent = CURRENT_TANGENT, double eta0 = 0.5,
+		  double etaMax = 0.9, double gamma = 0.9, double alpha = 2.0);
+    InexactNewton(ConvergenceTest &theTest, int tangent = CURRENT_TANGENT,
+		  double eta0 = 0.5, double etaMax = 0.9, double gamma = 0.9,
+		  double alpha = 2.0);
+    ~InexactNewton();
+
+    int solveCurrentStep(void);    
+
+    int getNumIterations(void);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, 
+			 FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag =0);    
+    
+  protected:
+    
+  private:
+    int tangent;
+    double eta0, etaMax, gamma, alpha;
+
+    double eta;            // the tolerance of the last solve
+    int numIterations;
+};
+
+#endif
@@ -44,6 +44,7 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <ID.h>
+#include <Profiler.h>
 
 // Constructor
 KrylovNewton::KrylovNewton(int theTangentToUse, int maxDim)
@@ -216,7 +217,9 @@ KrylovNewton::solveCurrentStep(void)
     // Increase current dimension of Krylov subspace
     dim++;
 
+    Profiler::begin(PROFILE_TEST);
     result = theTest->test();
+    Profiler::end(PROFILE_TEST);
     this->record(k++);
 
   } while (result == -1);
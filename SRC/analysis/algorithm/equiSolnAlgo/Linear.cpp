@@ -105,6 +105,22 @@ Linear::solveCurrentStep(void)
 	return -5;
     }
 
+    // an explicit integrator with a lumped system takes the step itself,
+    // the LinearSOE is only used if the system turns out not to be diagonal
+    if (theIncIntegrator->isLumped() == true) {
+      int res = theIncIntegrator->solveLumped(incrTangent, factorOnce != 2);
+      if (res < 0) {
+	opserr << "WARNING Linear::solveCurrentStep() -";
+	opserr << "the Integrator failed in solveLumped()\n";
+	return -4;
+      }
+      if (res == 0) {
+	if (factorOnce == 1)
+	  factorOnce = 2;
+	return 0;
+      }
+    }
+
 	if (factorOnce != 2) {
 		if (theIncIntegrator->formTangent(incrTangent) < 0) {
 		  opserr << "WARNING Linear::solveCurrentStep() -";
@@ -48,6 +48,7 @@
 #include <ConvergenceTest.h>
 #include <Timer.h>
 #include <elementAPI.h>
+#include <Profiler.h>
 
 void* OPS_ModifiedNewton()
 {
@@ -157,7 +158,9 @@ ModifiedNewton::solveCurrentStep(void)
 	}	
 
 	this->record(numIterations++);
+	Profiler::begin(PROFILE_TEST);
 	result = theTest->test();
+	Profiler::end(PROFILE_TEST);
 
 	if(((theIncIntegratorr->activateSensitivity())==true) && (theIncIntegratorr->computeSensitivityAtEachIteration())==true)
 	{
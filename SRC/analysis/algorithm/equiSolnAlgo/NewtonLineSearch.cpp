@@ -39,6 +39,7 @@
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
 #include <ID.h>
+#include <Profiler.h>
 
 
 //Null Constructor
@@ -152,7 +153,9 @@ NewtonLineSearch::solveCurrentStep(void)
 
 	// do a line search only if convergence criteria not met
 	theOtherTest->start();
+	Profiler::begin(PROFILE_TEST);
 	result = theOtherTest->test();
+	Profiler::end(PROFILE_TEST);
 
 	if (result < 1) {
 	  //new residual 
@@ -167,7 +170,9 @@ NewtonLineSearch::solveCurrentStep(void)
 
 	this->record(0);
 	  
+	Profiler::begin(PROFILE_TEST);
 	result = theTest->test();
+	Profiler::end(PROFILE_TEST);
 
     } while (result == -1);
 
@@ -49,6 +49,7 @@
 #include <ID.h>
 #include <elementAPI.h>
 #include <string>
+#include <Profiler.h>
 
 
 void* OPS_NewtonRaphsonAlgorithm()
@@ -177,7 +178,9 @@ NewtonRaphson::solveCurrentStep(void)
      
 
 
+      Profiler::begin(PROFILE_TEST);
       result = theTest->test();
+      Profiler::end(PROFILE_TEST);
        numIterations++;
       this->record(numIterations);
 
@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <Profiler.h>
 
 // Constructor
 PeriodicNewton::PeriodicNewton(int theTangentToUse, int mc)
@@ -125,7 +126,9 @@ PeriodicNewton::solveCurrentStep(void)
 	}	
 
 	this->record(count++);
+	Profiler::begin(PROFILE_TEST);
 	result = theTest->test();
+	Profiler::end(PROFILE_TEST);
 	
 	iter++;
 	if (iter > maxCount) {
@@ -0,0 +1,306 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/accelerator/AndersonAccelerator.cpp,v $
+
+
+// Created: 10/26
+
+// Description: This file contains the class implementation for 
+// AndersonAccelerator. 
+
+#include <AndersonAccelerator.h>
+
+#include <Vector.h>
+#include <LinearSOE.h>
+#include <IncrementalIntegrator.h>
+
+#include <ID.h>
+#include <Channel.h>
+#include <math.h>
+#include <string.h>
+
+#ifdef _WIN32
+
+extern "C" int DGEMV(char *T, int *M, int *N, double *alpha,
+		     double *A, int *LDA, double *X, int *incX,
+		     double *beta, double *Y, int *incY);
+
+#else
+
+extern "C" int dgemv_(char *T, int *M, int *N, double *alpha,
+		      double *A, int *LDA, double *X, int *incX,
+		      double *beta, double *Y, int *incY);
+
+#endif
+
+// y = alpha * op(A) * x + beta * y for the m x n A stored by column
+static void
+gemv(const char *trans, int m, int n, double alpha, double *A, double *x,
+     double beta, double *y)
+{
+  int inc = 1;
+#ifdef _WIN32
+  DGEMV((char *)trans, &m, &n, &alpha, A, &m, x, &inc, &beta, y, &inc);
+#else
+  dgemv_((char *)trans, &m, &n, &alpha, A, &m, x, &inc, &beta, y, &inc);
+#endif
+}
+
+AndersonAccelerator::AndersonAccelerator(int max, int rs, double mix, int tangent)
+  :Accelerator(ACCELERATOR_TAGS_Anderson),
+   dimension(0), numIter(0), numEqns(0), maxDimension(max),
+   restart(rs), mixing(mix),
+   dX(0), dR(0), Q(0), R(0), vLast(0), rLast(0), c(0), h(0),
+   theTangent(tangent)
+{
+  if (maxDimension < 0)
+    maxDimension = 0;
+  if (restart < 0)
+    restart = 0;
+}
+
+AndersonAccelerator::~AndersonAccelerator()
+{
+  this->freeArrays();
+}
+
+void
+AndersonAccelerator::freeArrays(void)
+{
+  if (dX != 0) delete [] dX;
+  if (dR != 0) delete [] dR;
+  if (Q != 0) delete [] Q;
+  if (R != 0) delete [] R;
+  if (vLast != 0) delete [] vLast;
+  if (rLast != 0) delete [] rLast;
+  if (c != 0) delete [] c;
+  if (h != 0) delete [] h;
+
+  dX = 0; dR = 0; Q = 0; R = 0;
+  vLast = 0; rLast = 0; c = 0; h = 0;
+}
+
+int 
+AndersonAccelerator::newStep(LinearSOE &theSOE)
+{
+  int newNumEqns = theSOE.getNumEqn();
+
+  if (numEqns != newNumEqns || dX == 0) {
+    this->freeArrays();
+
+    numEqns = newNumEqns;
+    if (maxDimension > numEqns)
+      maxDimension = numEqns;
+
+    int size = numEqns*maxDimension;
+    dX = new double [size];
+    dR = new double [size];
+    Q = new double [size];
+    R = new double [maxDimension*maxDimension];
+    vLast = new double [numEqns];
+    rLast = new double [numEqns];
+    c = new double [maxDimension+1];
+    h = new double [maxDimension+1];
+  }
+
+  // Reset the subspace
+  dimension = 0;
+  numIter = 0;
+
+  return 0;
+}
+
+int
+AndersonAccelerator::addColumn(int col)
+{
+  // Orthogonalize column col of dR against the first col columns of Q,
+  // twice as classical Gram-Schmidt loses orthogonality otherwise
+  double *f = &dR[col*numEqns];
+  double *q = &Q[col*numEqns];
+  double *rCol = &R[col*maxDimension];
+
+  double norm0 = 0.0;
+  for (int i = 0; i < numEqns; i++) {
+    q[i] = f[i];
+    norm0 += f[i]*f[i];
+  }
+  for (int j = 0; j < maxDimension; j++)
+    rCol[j] = 0.0;
+
+  if (col > 0) {
+    for (int pass = 0; pass < 2; pass++) {
+      // h = Q^T q, q = q - Q h
+      gemv("T", numEqns, col, 1.0, Q, q, 0.0, h);
+      gemv("N", numEqns, col, -1.0, Q, h, 1.0, q);
+      for (int j = 0; j < col; j++)
+	rCol[j] += h[j];
+    }
+  }
+
+  double norm = 0.0;
+  for (int i = 0; i < numEqns; i++)
+    norm += q[i]*q[i];
+  norm = sqrt(norm);
+  norm0 = sqrt(norm0);
+
+  // A difference in the span of the others adds nothing
+  if (norm0 == 0.0 || norm <= 1.0e-12*norm0)
+    return -1;
+
+  double invNorm = 1.0/norm;
+  for (int i = 0; i < numEqns; i++)
+    q[i] *= invNorm;
+  rCol[col] = norm;
+
+  return 0;
+}
+
+int
+AndersonAccelerator::accelerate(Vector &vStar, LinearSOE &theSOE, 
+				IncrementalIntegrator &theIntegrator)
+{
+  Vector &r = vStar;
+
+  if (dX == 0 || r.Size() != numEqns) {
+    opserr << "WARNING AndersonAccelerator::accelerate() - newStep() not called for ";
+    opserr << r.Size() << " equations\n";
+    return -1;
+  }
+
+  // Add the differences of the last increment and the residual it gave
+  if (numIter > 0 && maxDimension > 0) {
+
+    // Drop the oldest when the window is full and factor the rest again
+    if (dimension == maxDimension) {
+      int size = numEqns*(maxDimension-1);
+      memmove(dX, &dX[numEqns], size*sizeof(double));
+      memmove(dR, &dR[numEqns], size*sizeof(double));
+      int numKept = 0;
+      for (int j = 0; j < maxDimension-1; j++) {
+	if (j != numKept) {
+	  memmove(&dX[numKept*numEqns], &dX[j*numEqns], numEqns*sizeof(double));
+	  memmove(&dR[numKept*numEqns], &dR[j*numEqns], numEqns*sizeof(double));
+	}
+	if (this->addColumn(numKept) == 0)
+	  numKept++;
+      }
+      dimension = numKept;
+    }
+
+    double *x = &dX[dimension*numEqns];
+    double *f = &dR[dimension*numEqns];
+    for (int i = 0; i < numEqns; i++) {
+      x[i] = vLast[i];
+      f[i] = rLast[i] - r(i);
+    }
+    if (this->addColumn(dimension) == 0)
+      dimension++;
+  }
+
+  for (int i = 0; i < numEqns; i++)
+    rLast[i] = r(i);
+
+  if (dimension > 0) {
+    // c = R^-1 Q^T r, the least squares solution of dR c = r
+    gemv("T", numEqns, dimension, 1.0, Q, rLast, 0.0, c);
+    for (int i = dimension-1; i >= 0; i--) {
+      double sum = c[i];
+      for (int j = i+1; j < dimension; j++)
+	sum -= R[j*maxDimension+i]*c[j];
+      c[i] = sum/R[i*maxDimension+i];
+    }
+
+    // v = mixing * (r - dR c) + dX c
+    for (int i = 0; i < numEqns; i++)
+      vLast[i] = mixing*rLast[i];
+    gemv("N", numEqns, dimension, -mixing, dR, c, 1.0, vLast);
+    gemv("N", numEqns, dimension, 1.0, dX, c, 1.0, vLast);
+  }
+  else {
+    for (int i = 0; i < numEqns; i++)
+      vLast[i] = mixing*rLast[i];
+  }
+
+  for (int i = 0; i < numEqns; i++)
+    r(i) = vLast[i];
+
+  numIter++;
+
+  return 0; 
+}
+
+int
+AndersonAccelerator::updateTangent(IncrementalIntegrator &theIntegrator)
+{
+  if (this->updateTangent() == true && theTangent != NO_TANGENT) {
+    theIntegrator.formTangent(theTangent);
+    return 1;
+  }
+  else
+    return 0;
+}
+
+bool
+AndersonAccelerator::updateTangent(void)
+{
+  if (restart > 0 && numIter >= restart) {
+    dimension = 0;
+    numIter = 0;
+    return true;
+  }
+  else
+    return false;
+}
+
+void
+AndersonAccelerator::Print(OPS_Stream &s, int flag)
+{
+  s << "AndersonAccelerator" << endln;
+  s << "\tMax subspace dimension: " << maxDimension << endln;
+  s << "\tRestart: " << restart << endln;
+  s << "\tMixing: " << mixing << endln;
+}
+
+int
+AndersonAccelerator::sendSelf(int commitTag, Channel &theChannel)
+{
+  static Vector data(4);
+  data(0) = theTangent;
+  data(1) = maxDimension;
+  data(2) = restart;
+  data(3) = mixing;
+  return theChannel.sendVector(0, commitTag, data);
+}
+
+int
+AndersonAccelerator::recvSelf(int commitTag, Channel &theChannel, 
+			      FEM_ObjectBroker &theBroker)
+{
+  static Vector data(4);
+  int res = theChannel.recvVector(0, commitTag, data);
+  theTangent = (int)data(0);
+  maxDimension = (int)data(1);
+  restart = (int)data(2);
+  mixing = data(3);
+  return res;
+}
@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/algorithm/equiSolnAlgo/accelerator/AndersonAccelerator.h,v $
+
+// Created: 10/26
+
+// Description: This file contains the class definition for 
+// AndersonAccelerator, Anderson mixing of the modified Newton
+// increments. With the differences of the last maxDim increments, dX, and
+// of the residual increments they gave, dR, the increment is
+//       v = mixing * (r - dR c) + dX c,  c = arg min |r - dR c|
+// which for a mixing of 1 is the update of KrylovAccelerator. The
+// differences are kept in a sliding window, the oldest being dropped when
+// it is full, and the subspace is cleared and the tangent formed after
+// every restart iterations (never if restart is 0). The differences are
+// stored by column in contiguous blocks, and the least squares problem is
+// solved with a QR factorization of dR that is updated as each difference
+// is added, by Gram-Schmidt with reorthogonalization in BLAS-2 dgemv.
+
+#ifndef AndersonAccelerator_h
+#define AndersonAccelerator_h
+
+#include <Accelerator.h>
+#include <IncrementalIntegrator.h>
+
+class AndersonAccelerator : public Accelerator
+{
+ public:
+  AndersonAccelerator(int maxDim = 3, int restart = 0, double mixing = 1.0,
+		      int tangent = CURRENT_TANGENT);
+  virtual ~AndersonAccelerator();
+  
+  int newStep(LinearSOE &theSOE);
+  int accelerate(Vector &v, LinearSOE &theSOE, 
+		 IncrementalIntegrator &theIntegrator);
+  int updateTangent(IncrementalIntegrator &theIntegrator);
+  bool updateTangent(void);
+
+  int getTangent(void) {return theTangent;}
+
+  void Print(OPS_Stream &s, int flag=0);
+  
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel, 
+	       FEM_ObjectBroker &theBroker);
+
+ protected:
+  
+ private:
+  void freeArrays(void);
+  int addColumn(int col);
+
+  // Number of differences stored, and iterations since the last restart
+  int dimension;
+  int numIter;
+
+  // Size information
+  int numEqns;
+  int maxDimension;
+  int restart;
+  double mixing;
+
+  // The differences dX and dR, their QR factorization Q and R, all
+  // numEqns x maxDimension by column except R maxDimension x maxDimension
+  double *dX, *dR, *Q, *R;
+
+  // The last increment and residual, and work arrays
+  double *vLast, *rLast;
+  double *c, *h;
+
+  // Which tangent to form at restart
+  int theTangent;
+};
+
+#endif
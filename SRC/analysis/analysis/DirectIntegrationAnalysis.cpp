@@ -151,6 +151,7 @@ DirectIntegrationAnalysis::clearAll(void)
 
 #include <NodeIter.h>
 #include <Node.h>
+#include <ConvergenceLog.h>
 
 int 
 DirectIntegrationAnalysis::initialize(void)
@@ -210,7 +211,11 @@ DirectIntegrationAnalysis::analyze(int numSteps, double dT)
       return -2;
     }
     
+    double stepStart = (ConvergenceLog::active == true) ? ConvergenceLog::getTime() : 0.0;
     result = theAlgorithm->solveCurrentStep();
+    if (ConvergenceLog::active == true)
+      ConvergenceLog::record(the_Domain->getCurrentTime(), dT, *theAlgorithm,
+			     result, stepStart);
     if (result < 0) {
       opserr << "DirectIntegrationAnalysis::analyze() - the Algorithm failed";
       opserr << " at time " << the_Domain->getCurrentTime() << endln;
@@ -345,10 +350,19 @@ DirectIntegrationAnalysis::eigen(int numMode, bool generalized, bool findSmalles
     //
 
     theAnalysisModel->setNumEigenvectors(numMode);
+
+    // all the modes go to the nodes in one pass when the solver holds
+    // the eigenvectors in one array, otherwise a mode at a time
+    int numEqn = 0;
+    const double *theEigenvectors = theEigenSOE->getEigenvectors(numEqn);
+    if (theEigenvectors != 0)
+      theAnalysisModel->setEigenvectors(theEigenvectors, numEqn, numMode);
+
     Vector theEigenvalues(numMode);
     for (int i = 1; i <= numMode; i++) {
       theEigenvalues[i-1] = theEigenSOE->getEigenvalue(i);
-      theAnalysisModel->setEigenvector(i, theEigenSOE->getEigenvector(i));
+      if (theEigenvectors == 0)
+	theAnalysisModel->setEigenvector(i, theEigenSOE->getEigenvector(i));
     }    
     theAnalysisModel->setEigenvalues(theEigenvalues);
   
@@ -364,42 +378,95 @@ DirectIntegrationAnalysis::domainChanged(void)
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
 
-    theAnalysisModel->clearAll();    
-    theConstraintHandler->clearAll();
+    // the FE_Elements, DOF_Groups and equation numbers are reused when
+    // another analysis of the model has built them for this domain with
+    // the same handler and numberer, e.g. a gravity or eigen analysis
+    // before a transient one
+    bool built = theAnalysisModel->isBuilt(stamp, theConstraintHandler, theDOF_Numberer);
+    bool sizeUnchanged = built;
+
+    if (built == false) {
+      // save the current numbering; when the change to the domain leaves
+      // the DOFs and the sparsity of the system unchanged, or only removes
+      // connectivity (e.g. elements removed), the numbering and the size of
+      // the system of equations are reused
+      theDOF_Numberer->saveNumbering();
+
+      theAnalysisModel->clearAll();    
+      theConstraintHandler->clearAll();
     
-    // now we invoke handle() on the constraint handler which
-    // causes the creation of FE_Element and DOF_Group objects
-    // and their addition to the AnalysisModel.
-    theConstraintHandler->handle();
+      // now we invoke handle() on the constraint handler which
+      // causes the creation of FE_Element and DOF_Group objects
+      // and their addition to the AnalysisModel.
+      theConstraintHandler->handle();
+
+      if (theDOF_Numberer->reuseNumbering() == 0) {
+	if (theAnalysisModel->isDOFGraphPatternValid() == true)
+	  sizeUnchanged = true;
+	else {
+	  // start again, a new numbering is needed
+	  theAnalysisModel->clearAll();    
+	  theConstraintHandler->clearAll();
+	  theConstraintHandler->handle();
+	}
+      }
 
-    // we now invoke number() on the numberer which causes
-    // equation numbers to be assigned to all the DOFs in the
-    // AnalysisModel.
-    theDOF_Numberer->numberDOF();
+      // we now invoke number() on the numberer which causes
+      // equation numbers to be assigned to all the DOFs in the
+      // AnalysisModel.
+      if (sizeUnchanged == false)
+	theDOF_Numberer->numberDOF();
 
-    theConstraintHandler->doneNumberingDOF();
+      theConstraintHandler->doneNumberingDOF();
+    }
 
-    // we invoke setGraph() on the LinearSOE which
-    // causes that object to determine its size
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
+    bool sizeSOE = sizeUnchanged == false || theAnalysisModel->isSized(theSOE) == false;
+    bool sizeEigenSOE = theEigenSOE != 0 &&
+      (sizeUnchanged == false || theAnalysisModel->isSized(theEigenSOE) == false);
 
-    int result = theSOE->setSize(theGraph);
-    if (result < 0) {
-	opserr << "DirectIntegrationAnalysis::handle() - ";
-	opserr << "LinearSOE::setSize() failed";
-	return -3;
-    }	    
+    if (sizeSOE == true || sizeEigenSOE == true) {
 
-    if (theEigenSOE != 0) {
-      result = theEigenSOE->setSize(theGraph);
+      // we invoke setGraph() on the LinearSOE which
+      // causes that object to determine its size, unless
+      // it has been sized for the saved pattern already
+      Graph &theGraph = theAnalysisModel->getDOFGraph();
+
+      if (sizeSOE == true) {
+	int result = theSOE->setSize(theGraph);
+	if (result < 0) {
+	  opserr << "DirectIntegrationAnalysis::handle() - ";
+	  opserr << "LinearSOE::setSize() failed";
+	  return -3;
+	}	    
+      }
+
+      if (sizeEigenSOE == true) {
+	int result = theEigenSOE->setSize(theGraph);
+	if (result < 0) {
+	  opserr << "DirectIntegrationAnalysis::handle() - ";
+	  opserr << "EigenSOE::setSize() failed";
+	  return -3;
+	}	    
+      }
+
+      if (sizeUnchanged == false)
+	theAnalysisModel->saveDOFGraphPattern();
+      theAnalysisModel->setSized(sizeSOE ? theSOE : 0, sizeEigenSOE ? theEigenSOE : 0);
+      theAnalysisModel->clearDOFGraph();
+    }
+
+    // a system kept at its size for a saved pattern is told of the new
+    // FE_Elements, so that it forgets anything formed for the old ones
+    if (built == false && sizeSOE == false) {
+      int result = theSOE->domainChanged();
       if (result < 0) {
 	opserr << "DirectIntegrationAnalysis::handle() - ";
-	opserr << "EigenSOE::setSize() failed";
+	opserr << "LinearSOE::domainChanged() failed";
 	return -3;
-      }	    
+      }
     }
 
-    theAnalysisModel->clearDOFGraph();
+    theAnalysisModel->setBuilt(stamp, theConstraintHandler, theDOF_Numberer);
 
     // we invoke domainChange() on the integrator and algorithm
     theIntegrator->domainChanged();
@@ -441,6 +508,7 @@ DirectIntegrationAnalysis::setNumberer(DOF_Numberer &theNewNumberer)
 
     // invoke domainChanged() either indirectly or directly
     domainStamp = 0;
+    theAnalysisModel->clearDOFGraphPattern();
     return 0;
 }
 
@@ -506,6 +574,7 @@ DirectIntegrationAnalysis::setLinearSOE(LinearSOE &theNewSOE)
   
   // cause domainChanged to be invoked on next analyze
   domainStamp = 0;
+  theAnalysisModel->clearDOFGraphPattern();
   
   return 0;
 }
@@ -533,6 +602,7 @@ DirectIntegrationAnalysis::setEigenSOE(EigenSOE &theNewSOE)
     }
     */
     domainStamp = 0;
+    // the new system is sized by domainChanged(), the model is kept
   }
  
   return 0;
@@ -603,5 +673,12 @@ DirectIntegrationAnalysis::getConvergenceTest(void)
 }
 
 
+LinearSOE *
+DirectIntegrationAnalysis::getLinearSOE(void)
+{
+  return theSOE;
+}
+
+
 
 
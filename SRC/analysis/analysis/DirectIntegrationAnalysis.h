@@ -88,6 +88,7 @@ class DirectIntegrationAnalysis: public TransientAnalysis
     TransientIntegrator *getIntegrator(void);
     ConvergenceTest     *getConvergenceTest(void); 
     AnalysisModel       *getModel(void) ;
+    LinearSOE           *getLinearSOE(void);
 
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
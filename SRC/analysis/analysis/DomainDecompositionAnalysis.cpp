@@ -58,6 +58,7 @@
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <Tracer.h>
 
 DomainDecompositionAnalysis::DomainDecompositionAnalysis(Subdomain &the_Domain)
 :Analysis(the_Domain),
@@ -335,7 +336,9 @@ DomainDecompositionAnalysis::formTangent(void)
 	result = theIntegrator->formTangent();
 	if (result < 0)
 	    return result;
+	Tracer::begin("Schur condensation");
 	result = theSolver->condenseA(numEqn-numExtEqn);
+	Tracer::end("Schur condensation");
 	if (result < 0)
 	    return result;
     }
@@ -373,7 +376,10 @@ DomainDecompositionAnalysis::formResidual(void)
 
     if (result < 0)
 	return result;
-    return theSolver->condenseRHS(numEqn-numExtEqn);
+    Tracer::begin("condense unbalance");
+    result = theSolver->condenseRHS(numEqn-numExtEqn);
+    Tracer::end("condense unbalance");
+    return result;
 }
 
 
@@ -0,0 +1,377 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/HarmonicAnalysis.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of HarmonicAnalysis.
+//
+// What: "@(#) HarmonicAnalysis.cpp, revA"
+
+#include <HarmonicAnalysis.h>
+#include <AnalysisModel.h>
+#include <Domain.h>
+#include <Node.h>
+#include <FE_Element.h>
+#include <DOF_Group.h>
+#include <FE_EleIter.h>
+#include <DOF_GrpIter.h>
+#include <ThreadPool.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <complex>
+
+typedef std::complex<double> complex;
+
+static int factor(int size, const int *first, const int *start,
+		  complex *U, complex *L);
+static void solve(int size, const int *first, const int *start,
+		  const complex *U, const complex *L, complex *x);
+
+HarmonicAnalysis::HarmonicAnalysis(Domain &the_Domain, AnalysisModel &the_Model)
+  :Analysis(the_Domain), theModel(&the_Model), domainStamp(-1),
+   size(0), profileSize(0), first(0), start(0), K(0), M(0), C(0), f(0),
+   numOmega(0), u(0)
+{
+
+}
+
+HarmonicAnalysis::~HarmonicAnalysis()
+{
+  this->clearAll();
+}
+
+void
+HarmonicAnalysis::clearAll(void)
+{
+  if (first != 0) delete [] first;
+  if (start != 0) delete [] start;
+  if (K != 0) delete [] K;
+  if (M != 0) delete [] M;
+  if (C != 0) delete [] C;
+  if (f != 0) delete [] f;
+  if (u != 0) delete [] u;
+  first = 0; start = 0;
+  K = 0; M = 0; C = 0; f = 0;
+  u = 0;
+  size = 0;
+  profileSize = 0;
+  numOmega = 0;
+  domainStamp = -1;
+}
+
+int
+HarmonicAnalysis::domainChanged(void)
+{
+  this->clearAll();
+
+  size = theModel->getNumEqn();
+  if (size <= 0)
+    return 0;
+
+  // the envelope: the first equation coupled to each equation by an
+  // FE_Element or a DOF_Group
+  first = new int[size];
+  start = new int[size+1];
+  for (int i=0; i<size; i++)
+    first[i] = i;
+
+  FE_EleIter &theEles = theModel->getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    const ID &id = elePtr->getID();
+    int minEqn = size;
+    for (int a=0; a<id.Size(); a++)
+      if (id(a) >= 0 && id(a) < minEqn)
+	minEqn = id(a);
+    for (int a=0; a<id.Size(); a++) {
+      int eqn = id(a);
+      if (eqn >= 0 && eqn < size && minEqn < first[eqn])
+	first[eqn] = minEqn;
+    }
+  }
+
+  DOF_GrpIter &theDofs = theModel->getDOFs();
+  DOF_Group *dofPtr;
+  while ((dofPtr = theDofs()) != 0) {
+    const ID &id = dofPtr->getID();
+    int minEqn = size;
+    for (int a=0; a<id.Size(); a++)
+      if (id(a) >= 0 && id(a) < minEqn)
+	minEqn = id(a);
+    for (int a=0; a<id.Size(); a++) {
+      int eqn = id(a);
+      if (eqn >= 0 && eqn < size && minEqn < first[eqn])
+	first[eqn] = minEqn;
+    }
+  }
+
+  start[0] = 0;
+  for (int j=0; j<size; j++)
+    start[j+1] = start[j] + j - first[j] + 1;
+  profileSize = start[size];
+
+  K = new double[2*profileSize];
+  M = new double[2*profileSize];
+  C = new double[2*profileSize];
+  f = new double[size];
+
+  domainStamp = this->getDomainPtr()->hasDomainChanged();
+  return 0;
+}
+
+// adds m into A, the U part (i <= j) by columns and the L part (i > j)
+// by rows, both in the envelope
+static void
+addToProfile(double *A, const Matrix &m, const ID &id, const int *first,
+	     const int *start, int size, int profileSize)
+{
+  int n = id.Size();
+  for (int b=0; b<n; b++) {
+    int j = id(b);
+    if (j < 0 || j >= size)
+      continue;
+    for (int a=0; a<n; a++) {
+      int i = id(a);
+      if (i < 0 || i >= size)
+	continue;
+      if (i <= j)
+	A[start[j] + i - first[j]] += m(a,b);
+      else
+	A[profileSize + start[i] + j - first[i]] += m(a,b);
+    }
+  }
+}
+
+int
+HarmonicAnalysis::assemble(void)
+{
+  for (int i=0; i<2*profileSize; i++) {
+    K[i] = 0.0;
+    M[i] = 0.0;
+    C[i] = 0.0;
+  }
+  for (int i=0; i<size; i++)
+    f[i] = 0.0;
+
+  FE_EleIter &theEles = theModel->getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    const ID &id = elePtr->getID();
+    elePtr->zeroTangent();
+    elePtr->addKtToTang(1.0);
+    addToProfile(K, elePtr->getTangent(0), id, first, start, size, profileSize);
+    elePtr->zeroTangent();
+    elePtr->addMtoTang(1.0);
+    addToProfile(M, elePtr->getTangent(0), id, first, start, size, profileSize);
+    elePtr->zeroTangent();
+    elePtr->addCtoTang(1.0);
+    addToProfile(C, elePtr->getTangent(0), id, first, start, size, profileSize);
+  }
+
+  // the nodal masses and dampings, and the load amplitudes
+  Domain *theDomain = this->getDomainPtr();
+  theModel->applyLoadDomain(theDomain->getCurrentTime());
+
+  DOF_GrpIter &theDofs = theModel->getDOFs();
+  DOF_Group *dofPtr;
+  while ((dofPtr = theDofs()) != 0) {
+    const ID &id = dofPtr->getID();
+    dofPtr->zeroTangent();
+    dofPtr->addMtoTang(1.0);
+    addToProfile(M, dofPtr->getTangent(0), id, first, start, size, profileSize);
+    dofPtr->zeroTangent();
+    dofPtr->addCtoTang(1.0);
+    addToProfile(C, dofPtr->getTangent(0), id, first, start, size, profileSize);
+
+    dofPtr->zeroUnbalance();
+    dofPtr->addPtoUnbalance(1.0);
+    const Vector &P = dofPtr->getUnbalance(0);
+    for (int a=0; a<id.Size(); a++)
+      if (id(a) >= 0 && id(a) < size)
+	f[id(a)] += P(a);
+  }
+
+  return 0;
+}
+
+int
+HarmonicAnalysis::analyze(const Vector &omegas)
+{
+  Domain *theDomain = this->getDomainPtr();
+  if (theDomain->hasDomainChanged() != domainStamp || size != theModel->getNumEqn())
+    if (this->domainChanged() < 0) {
+      opserr << "HarmonicAnalysis::analyze() - domainChanged() failed\n";
+      return -1;
+    }
+
+  if (size == 0) {
+    opserr << "HarmonicAnalysis::analyze() - no equations, has an analysis been set up?\n";
+    return -1;
+  }
+
+  this->assemble();
+
+  if (u != 0)
+    delete [] u;
+  numOmega = omegas.Size();
+  u = new double[2*numOmega*size];
+
+  int result = 0;
+
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#pragma omp parallel num_threads(numT)
+#endif
+  {
+    // each thread factors into its own copy of the profile
+    complex *U = new complex[2*profileSize];
+    complex *L = U + profileSize;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 1)
+#endif
+    for (int k=0; k<numOmega; k++) {
+      double w = omegas(k);
+      double w2 = w*w;
+      for (int i=0; i<profileSize; i++) {
+	U[i] = complex(K[i] - w2*M[i], w*C[i]);
+	L[i] = complex(K[profileSize+i] - w2*M[profileSize+i], w*C[profileSize+i]);
+      }
+
+      // the re & im pairs of u have the layout of complex
+      complex *x = reinterpret_cast<complex *>(u) + k*size;
+      for (int i=0; i<size; i++)
+	x[i] = f[i];
+
+      if (factor(size, first, start, U, L) < 0) {
+	opserr << "WARNING HarmonicAnalysis::analyze() - singular system at w = " << w << endln;
+	for (int i=0; i<size; i++)
+	  x[i] = 0.0;
+#ifdef _OPENMP
+#pragma omp atomic write
+#endif
+	result = -2;
+      } else
+	solve(size, first, start, U, L, x);
+    }
+
+    delete [] U;
+  }
+
+  return result;
+}
+
+// LU factorization without pivoting in the envelope, L with a unit
+// diagonal stored by rows and U by columns
+static int
+factor(int size, const int *first, const int *start, complex *U, complex *L)
+{
+  for (int j=0; j<size; j++) {
+    int fj = first[j];
+    complex *Uj = U + start[j] - fj;   // Uj[i] = U(i,j)
+    complex *Lj = L + start[j] - fj;   // Lj[i] = L(j,i)
+
+    for (int i=fj; i<j; i++) {
+      int k0 = (first[i] > fj) ? first[i] : fj;
+      const complex *Li = L + start[i] - first[i];
+      complex sum = 0.0;
+      for (int k=k0; k<i; k++)
+	sum += Li[k]*Uj[k];
+      Uj[i] -= sum;
+    }
+
+    for (int i=fj; i<j; i++) {
+      int k0 = (first[i] > fj) ? first[i] : fj;
+      const complex *Ui = U + start[i] - first[i];
+      complex sum = 0.0;
+      for (int k=k0; k<i; k++)
+	sum += Lj[k]*Ui[k];
+      Lj[i] = (Lj[i] - sum)/Ui[i];
+    }
+
+    complex sum = 0.0;
+    for (int k=fj; k<j; k++)
+      sum += Lj[k]*Uj[k];
+    Uj[j] -= sum;
+
+    if (Uj[j] == 0.0)
+      return -1;
+  }
+
+  return 0;
+}
+
+static void
+solve(int size, const int *first, const int *start,
+      const complex *U, const complex *L, complex *x)
+{
+  for (int j=0; j<size; j++) {
+    const complex *Lj = L + start[j] - first[j];
+    complex sum = 0.0;
+    for (int k=first[j]; k<j; k++)
+      sum += Lj[k]*x[k];
+    x[j] -= sum;
+  }
+
+  for (int j=size-1; j>=0; j--) {
+    const complex *Uj = U + start[j] - first[j];
+    x[j] /= Uj[j];
+    complex xj = x[j];
+    for (int i=first[j]; i<j; i++)
+      x[i] -= Uj[i]*xj;
+  }
+}
+
+int
+HarmonicAnalysis::getNodeResponse(int nodeTag, int dof, int freq,
+				  double &re, double &im)
+{
+  re = 0.0;
+  im = 0.0;
+
+  if (freq < 0 || freq >= numOmega || u == 0)
+    return -1;
+
+  Node *theNode = this->getDomainPtr()->getNode(nodeTag);
+  if (theNode == 0)
+    return -1;
+
+  DOF_Group *dofPtr = theNode->getDOF_GroupPtr();
+  if (dofPtr == 0)
+    return -1;
+
+  const ID &id = dofPtr->getID();
+  if (dof < 0 || dof >= id.Size())
+    return -1;
+
+  // fixed dofs have no equation and no response
+  int eqn = id(dof);
+  if (eqn >= 0 && eqn < size) {
+    re = u[2*(freq*size + eqn)];
+    im = u[2*(freq*size + eqn) + 1];
+  }
+
+  return 0;
+}
@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/analysis/HarmonicAnalysis.h,v $
+
+#ifndef HarmonicAnalysis_h
+#define HarmonicAnalysis_h
+
+// Created: 10/26
+//
+// Description: This file contains the interface for the HarmonicAnalysis
+// class. HarmonicAnalysis is a subclass of Analysis, it is used to find
+// the steady state response to harmonic loading over a sweep of circular
+// frequencies w, solving (K - w^2 M + i w C) u = f for each. K, M and C
+// are assembled once from the FE_Elements and DOF_Groups of an
+// AnalysisModel already set up by the current analysis, each into the
+// same variable band (profile) storage whose envelope is found once from
+// the equation numbers, the symbolic factorization for all w. The load
+// amplitudes f are the nodal loads of the load patterns at the current
+// time. The complex LU factorizations, which need not be symmetric, are
+// done for the frequencies in parallel on the threads of the ThreadPool.
+//
+// What: "@(#) HarmonicAnalysis.h, revA"
+
+#include <Analysis.h>
+
+class AnalysisModel;
+class Vector;
+
+class HarmonicAnalysis : public Analysis
+{
+  public:
+    HarmonicAnalysis(Domain &theDomain, AnalysisModel &theModel);
+    virtual ~HarmonicAnalysis();
+
+    virtual int analyze(const Vector &omegas);
+    void clearAll(void);
+    virtual int domainChanged(void);
+
+    int getNumFrequencies(void) const {return numOmega;}
+    int getNodeResponse(int nodeTag, int dof, int freq, double &re, double &im);
+
+  protected:
+
+  private:
+    int assemble(void);
+
+    AnalysisModel *theModel;
+    int domainStamp;
+
+    int size;          // number of equations
+    int profileSize;
+    int *first;        // first equation in the envelope of each row/column
+    int *start;        // location of each column of U and row of L
+    double *K, *M, *C; // upper part then lower part, each of profileSize
+    double *f;
+
+    int numOmega;
+    double *u;  // the responses, size re & im pairs for each frequency
+};
+
+#endif
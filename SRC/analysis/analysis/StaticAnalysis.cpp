@@ -44,10 +44,12 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <Matrix.h>
+#include <Vector.h>
 #include <ID.h>
 #include <Graph.h>
 #include <Timer.h>
 #include <Integrator.h>//Abbas
+#include <ConvergenceLog.h>
 
 // AddingSensitivity:BEGIN //////////////////////////////////
 #ifdef _RELIABILITY
@@ -74,7 +76,10 @@ StaticAnalysis::StaticAnalysis(Domain &the_Domain,
  theDOF_Numberer(&theNumberer), theAnalysisModel(&theModel), 
  theAlgorithm(&theSolnAlgo), theSOE(&theLinSOE), theEigenSOE(0),
  theIntegrator(&theStaticIntegrator), theTest(theConvergenceTest),
- domainStamp(0)
+ domainStamp(0), theFallbacks(0), numFallbacks(0),
+ cutFactor(0.0), growFactor(1.0), numGrow(1), maxCuts(10),
+ usePredictor(false), Ulast(0), Uprev(0), lambdaLast(0.0), lambdaPrev(0.0),
+ numHistory(0)
 {
     // first we set up the links needed by the elements in the 
     // aggregation
@@ -123,6 +128,15 @@ StaticAnalysis::clearAll(void)
     delete theTest;
   if (theEigenSOE != 0)
     delete theEigenSOE;
+
+  for (int i=0; i<numFallbacks; i++)
+    delete theFallbacks[i];
+  if (theFallbacks != 0)
+    delete [] theFallbacks;
+  if (Ulast != 0)
+    delete Ulast;
+  if (Uprev != 0)
+    delete Uprev;
   
   theAnalysisModel =0;
   theConstraintHandler =0;
@@ -132,6 +146,11 @@ StaticAnalysis::clearAll(void)
   theSOE =0;
   theEigenSOE =0;
   theTest = 0;
+  theFallbacks = 0;
+  numFallbacks = 0;
+  Ulast = 0;
+  Uprev = 0;
+  numHistory = 0;
   
   // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -148,6 +167,11 @@ StaticAnalysis::analyze(int numSteps)
 {
     int result = 0;
     Domain *the_Domain = this->getDomainPtr();
+    int numSucceeded = 0;
+
+    // the last steps predict nothing once the domain has been moved since
+    if (numHistory > 0 && the_Domain->getCurrentTime() != lambdaLast)
+      numHistory = 0;
 
     for (int i=0; i<numSteps; i++) {
 
@@ -180,28 +204,95 @@ StaticAnalysis::analyze(int numSteps)
 	    }	
 	}
 
-	result = theIntegrator->newStep();
-	if (result < 0) {
-	    opserr << "StaticAnalysis::analyze() - the Integrator failed";
-	    opserr << " at iteration: " << i << " with domain at load factor ";
-	    opserr << the_Domain->getCurrentTime() << endln;
-	    the_Domain->revertToLastCommit();
-	    theIntegrator->revertToLastStep();
+	// the step is tried with the integrator of the analysis and then
+	// with each fallback, and the increment cut when all of them fail
+	int numCuts = 0;
+	bool relink = false;
+	while (true) {
+
+	  for (int j=0; j<=numFallbacks; j++) {
+
+	    // the fallbacks are linked when used, the integrator of the
+	    // analysis again after a fallback failed
+	    StaticIntegrator *theStepIntegrator = theIntegrator;
+	    if (j > 0)
+	      theStepIntegrator = theFallbacks[j-1];
+	    if (j > 0 || relink == true) {
+	      if (this->linkIntegrator(theStepIntegrator) < 0)
+		return -1;
+	      relink = (j > 0);
+	    }
+
+	    result = this->solveStep(theStepIntegrator, i);
+	    if (result >= 0) {
+	      // past a limit point the integrator that failed would fail
+	      // again, the one that succeeded goes on
+	      if (j > 0) {
+		theFallbacks[j-1] = theIntegrator;
+		theIntegrator = theStepIntegrator;
+		relink = false;
+	      }
+	      break;
+	    }
+	  }
+
+	  if (result >= 0)
+	    break;
+
+	  if (relink == true)
+	    this->linkIntegrator(theIntegrator);
+
+	  if (cutFactor <= 0.0 || numCuts >= maxCuts ||
+	      theIntegrator->scaleIncrement(cutFactor) < 0)
+	    return result;
+
+	  numCuts++;
+	  numSucceeded = 0;
+	  relink = false;
+	}
 
-	 
-	    return -2;
+	if (cutFactor > 0.0 && ++numSucceeded >= numGrow) {
+	  theIntegrator->scaleIncrement(growFactor);
+	  numSucceeded = 0;
 	}
+    }
+    
+    return 0;
+}
 
-           result = theAlgorithm->solveCurrentStep();
-	if (result < 0) {
-	    opserr << "StaticAnalysis::analyze() - the Algorithm failed";
-	    opserr << " at iteration: " << i << " with domain at load factor ";
-	    opserr << the_Domain->getCurrentTime() << endln;
-	    the_Domain->revertToLastCommit();	    
-	    theIntegrator->revertToLastStep();
 
-	    return -3;
-	}    
+int
+StaticAnalysis::solveStep(StaticIntegrator *theStepIntegrator, int step)
+{
+    int result = 0;
+    Domain *the_Domain = this->getDomainPtr();
+
+    result = theStepIntegrator->newStep();
+    if (result < 0) {
+	opserr << "StaticAnalysis::analyze() - the Integrator failed";
+	opserr << " at iteration: " << step << " with domain at load factor ";
+	opserr << the_Domain->getCurrentTime() << endln;
+	the_Domain->revertToLastCommit();
+	theStepIntegrator->revertToLastStep();
+	return -2;
+    }
+
+    if (usePredictor == true && theStepIntegrator->hasPredictor() == false)
+      this->predictStep();
+
+    double stepStart = (ConvergenceLog::active == true) ? ConvergenceLog::getTime() : 0.0;
+    result = theAlgorithm->solveCurrentStep();
+    if (ConvergenceLog::active == true)
+      ConvergenceLog::record(the_Domain->getCurrentTime(), 0.0, *theAlgorithm,
+			     result, stepStart);
+    if (result < 0) {
+	opserr << "StaticAnalysis::analyze() - the Algorithm failed";
+	opserr << " at iteration: " << step << " with domain at load factor ";
+	opserr << the_Domain->getCurrentTime() << endln;
+	the_Domain->revertToLastCommit();	    
+	theStepIntegrator->revertToLastStep();
+	return -3;
+    }    
 
 // AddingSensitivity:BEGIN ////////////////////////////////////
 
@@ -213,10 +304,10 @@ StaticAnalysis::analyze(int numSteps)
 //		result = theSensitivityAlgorithm->computeSensitivities();
 //		if (result < 0) {
 //			opserr << "StaticAnalysis::analyze() - the SensitivityAlgorithm failed";
-//			opserr << " at iteration: " << i << " with domain at load factor ";
+//			opserr << " at iteration: " << step << " with domain at load factor ";
 //			opserr << the_Domain->getCurrentTime() << endln;
 //			the_Domain->revertToLastCommit();	    
-//			theIntegrator->revertToLastStep();
+//			theStepIntegrator->revertToLastStep();
 //			return -5;
 //		}    
 //	}
@@ -225,19 +316,144 @@ StaticAnalysis::analyze(int numSteps)
 
 // AddingSensitivity:END //////////////////////////////////////
 
-	result = theIntegrator->commit();
-	if (result < 0) {
-	    opserr << "StaticAnalysis::analyze() - ";
-	    opserr << "the Integrator failed to commit";
-	    opserr << " at iteration: " << i << " with domain at load factor ";
-	    opserr << the_Domain->getCurrentTime() << endln;
-	    the_Domain->revertToLastCommit();	    
-	    theIntegrator->revertToLastStep();
+    result = theStepIntegrator->commit();
+    if (result < 0) {
+	opserr << "StaticAnalysis::analyze() - ";
+	opserr << "the Integrator failed to commit";
+	opserr << " at iteration: " << step << " with domain at load factor ";
+	opserr << the_Domain->getCurrentTime() << endln;
+	the_Domain->revertToLastCommit();	    
+	theStepIntegrator->revertToLastStep();
+	return -4;
+    }    	
 
-	    return -4;
-	}    	
+    if (usePredictor == true)
+      this->saveStep();
+
+    return 0;
+}
+
+
+int
+StaticAnalysis::linkIntegrator(StaticIntegrator *theStepIntegrator)
+{
+    Domain *the_Domain = this->getDomainPtr();
+
+    theStepIntegrator->setLinks(*theAnalysisModel, *theSOE, theTest);
+    theConstraintHandler->setLinks(*the_Domain, *theAnalysisModel, *theStepIntegrator);
+    theAlgorithm->setLinks(*theAnalysisModel, *theStepIntegrator, *theSOE, theTest);
+
+    if (theStepIntegrator->domainChanged() < 0) {
+	opserr << "StaticAnalysis::analyze() - ";
+	opserr << "Integrator::domainChanged() failed for a fallback integrator\n";
+	return -1;
     }
-    
+
+    return 0;
+}
+
+
+// the trial displacements of the new load factor on the secant through
+// the last two converged steps
+int
+StaticAnalysis::predictStep(void)
+{
+    if (numHistory < 2 || lambdaLast == lambdaPrev)
+      return 0;
+
+    double lambda = theAnalysisModel->getCurrentDomainTime();
+    double factor = (lambda - lambdaLast)/(lambdaLast - lambdaPrev);
+
+    Vector deltaU(*Ulast);
+    deltaU.addVector(factor, *Uprev, -factor);
+
+    theAnalysisModel->incrDisp(deltaU);
+    return theAnalysisModel->updateDomain();
+}
+
+
+int
+StaticAnalysis::saveStep(void)
+{
+    int size = theAnalysisModel->getNumEqn();
+    if (Ulast == 0 || Ulast->Size() != size) {
+      if (Ulast != 0)
+	delete Ulast;
+      if (Uprev != 0)
+	delete Uprev;
+      Ulast = new Vector(size);
+      Uprev = new Vector(size);
+      numHistory = 0;
+    }
+
+    Vector *U = Uprev;
+    Uprev = Ulast;
+    Ulast = U;
+    lambdaPrev = lambdaLast;
+
+    Ulast->Zero();
+    DOF_GrpIter &theDOFs = theAnalysisModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+      const ID &id = dofPtr->getID();
+      const Vector &disp = dofPtr->getCommittedDisp();
+      for (int j=0; j<id.Size(); j++) {
+	int eqn = id(j);
+	if (eqn >= 0 && eqn < size)
+	  (*Ulast)(eqn) = disp(j);
+      }
+    }
+    lambdaLast = theAnalysisModel->getCurrentDomainTime();
+
+    if (numHistory < 2)
+      numHistory++;
+
+    return 0;
+}
+
+
+int
+StaticAnalysis::addFallback(StaticIntegrator &theNewIntegrator)
+{
+    StaticIntegrator **newFallbacks = new StaticIntegrator *[numFallbacks+1];
+    for (int i=0; i<numFallbacks; i++)
+      newFallbacks[i] = theFallbacks[i];
+    newFallbacks[numFallbacks] = &theNewIntegrator;
+
+    if (theFallbacks != 0)
+      delete [] theFallbacks;
+    theFallbacks = newFallbacks;
+    numFallbacks++;
+
+    return 0;
+}
+
+
+int
+StaticAnalysis::setStepCutting(double cut, double grow, int num, int max)
+{
+    if (cut < 0.0 || cut >= 1.0 || grow < 1.0 || num < 1 || max < 1) {
+      opserr << "StaticAnalysis::setStepCutting() - ";
+      opserr << "invalid cut factor " << cut << ", grow factor " << grow;
+      opserr << ", number of steps " << num << " or of cuts " << max << endln;
+      return -1;
+    }
+
+    cutFactor = cut;
+    growFactor = grow;
+    numGrow = num;
+    maxCuts = max;
+
+    return 0;
+}
+
+
+int
+StaticAnalysis::setPredictor(bool flag)
+{
+    usePredictor = flag;
+    numHistory = 0;
+
     return 0;
 }
 
@@ -339,10 +555,19 @@ StaticAnalysis::eigen(int numMode, bool generalized, bool findSmallest)
     //
 
     theAnalysisModel->setNumEigenvectors(numMode);
+
+    // all the modes go to the nodes in one pass when the solver holds
+    // the eigenvectors in one array, otherwise a mode at a time
+    int numEqn = 0;
+    const double *theEigenvectors = theEigenSOE->getEigenvectors(numEqn);
+    if (theEigenvectors != 0)
+      theAnalysisModel->setEigenvectors(theEigenvectors, numEqn, numMode);
+
     Vector theEigenvalues(numMode);
     for (int i = 1; i <= numMode; i++) {
       theEigenvalues[i-1] = theEigenSOE->getEigenvalue(i);
-      theAnalysisModel->setEigenvector(i, theEigenSOE->getEigenvector(i));
+      if (theEigenvectors == 0)
+	theAnalysisModel->setEigenvector(i, theEigenSOE->getEigenvector(i));
     }    
     theAnalysisModel->setEigenvalues(theEigenvalues);
     
@@ -373,6 +598,24 @@ StaticAnalysis::initialize(void)
     return 0;
 }
 
+int
+StaticAnalysis::checkDomainChange(void)
+{
+    Domain *the_Domain = this->getDomainPtr();
+
+    // check if domain has undergone change
+    int stamp = the_Domain->hasDomainChanged();
+    if (stamp != domainStamp) {
+	domainStamp = stamp;
+	if (this->domainChanged() < 0) {
+	    opserr << "StaticAnalysis::checkDomainChange() - domainChanged() failed\n";
+	    return -1;
+	}
+    }
+
+    return 0;
+}
+
 int
 StaticAnalysis::domainChanged(void)
 {
@@ -382,68 +625,129 @@ StaticAnalysis::domainChanged(void)
     int stamp = the_Domain->hasDomainChanged();
     domainStamp = stamp;
 
+    // the equations of the last steps are no longer those of the model
+    numHistory = 0;
+
     // Timer theTimer; theTimer.start();
     // opserr << "StaticAnalysis::domainChanged(void)\n";
 
-    theAnalysisModel->clearAll();    
-    theConstraintHandler->clearAll();
+    // the FE_Elements, DOF_Groups and equation numbers are reused when
+    // another analysis of the model has built them for this domain with
+    // the same handler and numberer, e.g. a gravity or eigen analysis
+    // before a transient one
+    bool built = theAnalysisModel->isBuilt(stamp, theConstraintHandler, theDOF_Numberer);
+    bool sizeUnchanged = built;
+
+    if (built == false) {
+      // save the current numbering; when the change to the domain leaves
+      // the DOFs and the sparsity of the system unchanged, or only removes
+      // connectivity (e.g. elements removed), the numbering and the size of
+      // the system of equations are reused
+      theDOF_Numberer->saveNumbering();
+
+      theAnalysisModel->clearAll();    
+      theConstraintHandler->clearAll();
+
+      // theTimer.pause(); 
+      // cout <<  "StaticAnalysis::clearAll() " << theTimer.getReal();
+      // cout << theTimer.getCPU() << endln;
+      // theTimer.start();    
+
+      // now we invoke handle() on the constraint handler which
+      // causes the creation of FE_Element and DOF_Group objects
+      // and their addition to the AnalysisModel.
+
+      result = theConstraintHandler->handle();
+      if (result < 0) {
+	  opserr << "StaticAnalysis::handle() - ";
+	  opserr << "ConstraintHandler::handle() failed";
+	  return -1;
+      }
 
-    // theTimer.pause(); 
-    // cout <<  "StaticAnalysis::clearAll() " << theTimer.getReal();
-    // cout << theTimer.getCPU() << endln;
-    // theTimer.start();    
+      if (theDOF_Numberer->reuseNumbering() == 0) {
+	if (theAnalysisModel->isDOFGraphPatternValid() == true)
+	  sizeUnchanged = true;
+	else {
+	  // start again, a new numbering is needed
+	  theAnalysisModel->clearAll();    
+	  theConstraintHandler->clearAll();
+	  result = theConstraintHandler->handle();
+	  if (result < 0) {
+	    opserr << "StaticAnalysis::handle() - ";
+	    opserr << "ConstraintHandler::handle() failed";
+	    return -1;
+	  }
+	}
+      }
 
-    // now we invoke handle() on the constraint handler which
-    // causes the creation of FE_Element and DOF_Group objects
-    // and their addition to the AnalysisModel.
+      // we now invoke number() on the numberer which causes
+      // equation numbers to be assigned to all the DOFs in the
+      // AnalysisModel.
 
-    result = theConstraintHandler->handle();
-    if (result < 0) {
-	opserr << "StaticAnalysis::handle() - ";
-	opserr << "ConstraintHandler::handle() failed";
-	return -1;
+      if (sizeUnchanged == false) {
+	result = theDOF_Numberer->numberDOF();
+	if (result < 0) {
+	  opserr << "StaticAnalysis::handle() - ";
+	  opserr << "DOF_Numberer::numberDOF() failed";
+	  return -2;
+	}	    
+      }
+
+      result = theConstraintHandler->doneNumberingDOF();
+      if (result < 0) {
+	  opserr << "StaticAnalysis::handle() - ";
+	  opserr << "ConstraintHandler::doneNumberingDOF() failed";
+	  return -2;
+      }	    
     }
 
-    // we now invoke number() on the numberer which causes
-    // equation numbers to be assigned to all the DOFs in the
-    // AnalysisModel.
+    // we invoke setSize() on the LinearSOE which
+    // causes that object to determine its size, unless
+    // it has been sized for the saved pattern already
 
-    result = theDOF_Numberer->numberDOF();
-    if (result < 0) {
-	opserr << "StaticAnalysis::handle() - ";
-	opserr << "DOF_Numberer::numberDOF() failed";
-	return -2;
-    }	    
+    bool sizeSOE = sizeUnchanged == false || theAnalysisModel->isSized(theSOE) == false;
+    bool sizeEigenSOE = theEigenSOE != 0 &&
+      (sizeUnchanged == false || theAnalysisModel->isSized(theEigenSOE) == false);
 
-    result = theConstraintHandler->doneNumberingDOF();
-    if (result < 0) {
-	opserr << "StaticAnalysis::handle() - ";
-	opserr << "ConstraintHandler::doneNumberingDOF() failed";
-	return -2;
-    }	    
+    if (sizeSOE == true || sizeEigenSOE == true) {
+      Graph &theGraph = theAnalysisModel->getDOFGraph();
 
-    // we invoke setSize() on the LinearSOE which
-    // causes that object to determine its size
+      if (sizeSOE == true) {
+	result = theSOE->setSize(theGraph);
+	if (result < 0) {
+	  opserr << "StaticAnalysis::handle() - ";
+	  opserr << "LinearSOE::setSize() failed";
+	  return -3;
+	}	    
+      }
 
-    Graph &theGraph = theAnalysisModel->getDOFGraph();
+      if (sizeEigenSOE == true) {
+	result = theEigenSOE->setSize(theGraph);
+	if (result < 0) {
+	  opserr << "StaticAnalysis::handle() - ";
+	  opserr << "EigenSOE::setSize() failed";
+	  return -3;
+	}	    
+      }
 
-    result = theSOE->setSize(theGraph);
-    if (result < 0) {
-	opserr << "StaticAnalysis::handle() - ";
-	opserr << "LinearSOE::setSize() failed";
-	return -3;
-    }	    
+      if (sizeUnchanged == false)
+	theAnalysisModel->saveDOFGraphPattern();
+      theAnalysisModel->setSized(sizeSOE ? theSOE : 0, sizeEigenSOE ? theEigenSOE : 0);
+      theAnalysisModel->clearDOFGraph();
+    }
 
-    if (theEigenSOE != 0) {
-      result = theEigenSOE->setSize(theGraph);
+    // a system kept at its size for a saved pattern is told of the new
+    // FE_Elements, so that it forgets anything formed for the old ones
+    if (built == false && sizeSOE == false) {
+      result = theSOE->domainChanged();
       if (result < 0) {
 	opserr << "StaticAnalysis::handle() - ";
-	opserr << "EigenSOE::setSize() failed";
+	opserr << "LinearSOE::domainChanged() failed";
 	return -3;
-      }	    
+      }
     }
 
-    theAnalysisModel->clearDOFGraph();
+    theAnalysisModel->setBuilt(stamp, theConstraintHandler, theDOF_Numberer);
 
     // finally we invoke domainChanged on the Integrator and Algorithm
     // objects .. informing them that the model has changed
@@ -502,6 +806,7 @@ StaticAnalysis::setNumberer(DOF_Numberer &theNewNumberer)
 
     // invoke domainChanged() either indirectly or directly
     domainStamp = 0;
+    theAnalysisModel->clearDOFGraphPattern();
 
     return 0;
 }
@@ -548,6 +853,7 @@ StaticAnalysis::setIntegrator(StaticIntegrator &theNewIntegrator)
 
     // cause domainChanged to be invoked on next analyze
     domainStamp = 0;
+    theAnalysisModel->clearDOFGraphPattern();
 
     /*
     if (domainStamp != 0)
@@ -581,6 +887,7 @@ StaticAnalysis::setLinearSOE(LinearSOE &theNewSOE)
     }
     */
     domainStamp = 0;
+    theAnalysisModel->clearDOFGraphPattern();
     return 0;
 }
 
@@ -607,6 +914,7 @@ StaticAnalysis::setEigenSOE(EigenSOE &theNewSOE)
     }
     */
     domainStamp = 0;
+    // the new system is sized by domainChanged(), the model is kept
   }
   
   return 0;
@@ -55,6 +55,7 @@ class LinearSOE;
 class EquiSolnAlgo;
 class ConvergenceTest;
 class EigenSOE;
+class Vector;
 
 class StaticAnalysis: public Analysis
 {
@@ -76,6 +77,7 @@ class StaticAnalysis: public Analysis
     int eigen(int numMode, bool generlzed = true, bool findSmallest = true);
     int initialize(void);
     int domainChanged(void);
+    int checkDomainChange(void);
 
     int setNumberer(DOF_Numberer &theNumberer);
     int setAlgorithm(EquiSolnAlgo &theAlgorithm);
@@ -88,6 +90,24 @@ class StaticAnalysis: public Analysis
     StaticIntegrator *getIntegrator(void);
     ConvergenceTest  *getConvergenceTest(void);
 
+    // a step that fails is tried again from the last committed state with
+    // each fallback integrator in turn, e.g. a DisplacementControl or
+    // ArcLength behind a LoadControl near a limit point; a fallback that
+    // succeeds becomes the integrator of the analysis. The analysis takes
+    // ownership of the fallbacks
+    int addFallback(StaticIntegrator &theIntegrator);
+
+    // with a cutFactor the increment of the integrator is cut by it, at
+    // most maxCuts times, when all the integrators fail a step, and grown
+    // by growFactor after numGrow steps in a row succeed
+    int setStepCutting(double cutFactor, double growFactor, int numGrow = 1,
+		       int maxCuts = 10);
+
+    // with the predictor, integrators that start a step from the last
+    // converged state are given trial displacements extrapolated from the
+    // last two converged steps
+    int setPredictor(bool usePredictor);
+
     // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
     int setSensitivityAlgorithm(/*SensitivityAlgorithm*/Integrator *theSensitivityAlgorithm);
@@ -97,6 +117,11 @@ class StaticAnalysis: public Analysis
   protected: 
     
   private:
+    int solveStep(StaticIntegrator *theStepIntegrator, int step);
+    int linkIntegrator(StaticIntegrator *theStepIntegrator);
+    int predictStep(void);
+    int saveStep(void);
+
     ConstraintHandler 	*theConstraintHandler;    
     DOF_Numberer 	*theDOF_Numberer;
     AnalysisModel 	*theAnalysisModel;
@@ -107,6 +132,17 @@ class StaticAnalysis: public Analysis
     ConvergenceTest     *theTest;
     int domainStamp;
 
+    StaticIntegrator **theFallbacks;
+    int numFallbacks;
+    double cutFactor, growFactor;
+    int numGrow, maxCuts;
+
+    // the displacements and load factors of the last two converged steps
+    bool usePredictor;
+    Vector *Ulast, *Uprev;
+    double lambdaLast, lambdaPrev;
+    int numHistory;
+
 #ifdef _RELIABILITY
 
 #endif
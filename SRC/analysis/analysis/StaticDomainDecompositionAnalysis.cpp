@@ -330,10 +330,19 @@ StaticDomainDecompositionAnalysis::eigen(int numMode, bool generalized, bool fin
     //
 
     theAnalysisModel->setNumEigenvectors(numMode);
+
+    // all the modes go to the nodes in one pass when the solver holds
+    // the eigenvectors in one array, otherwise a mode at a time
+    int numEqn = 0;
+    const double *theEigenvectors = theEigenSOE->getEigenvectors(numEqn);
+    if (theEigenvectors != 0)
+      theAnalysisModel->setEigenvectors(theEigenvectors, numEqn, numMode);
+
     Vector theEigenvalues(numMode);
     for (int i = 1; i <= numMode; i++) {
       theEigenvalues[i-1] = theEigenSOE->getEigenvalue(i);
-      theAnalysisModel->setEigenvector(i, theEigenSOE->getEigenvector(i));
+      if (theEigenvectors == 0)
+	theAnalysisModel->setEigenvector(i, theEigenSOE->getEigenvector(i));
     }    
     theAnalysisModel->setEigenvalues(theEigenvalues);
 
@@ -41,6 +41,7 @@
 #include <ConvergenceTest.h>
 #include <float.h>
 #include <AnalysisModel.h>
+#include <ConvergenceLog.h>
 
 // Constructor
 VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnalysis(
@@ -54,14 +55,26 @@ VariableTimeStepDirectIntegrationAnalysis::VariableTimeStepDirectIntegrationAnal
 			      ConvergenceTest *theTest)
 
 :DirectIntegrationAnalysis(the_Domain, theHandler, theNumberer, theModel, 
-			   theSolnAlgo, theLinSOE, theTransientIntegrator, theTest)
+			   theSolnAlgo, theLinSOE, theTransientIntegrator, theTest),
+ courantFraction(0.0), courantInterval(1), courantInitial(false),
+ dtCritical(0.0), numUntilEstimate(0),
+ theFallbacks(0), theFallbackTests(0), numFallbacks(0),
+ cutFactor(0.0), growFactor(1.0), numGrow(1)
 {
 
 }    
 
 VariableTimeStepDirectIntegrationAnalysis::~VariableTimeStepDirectIntegrationAnalysis()
 {
-
+  for (int i=0; i<numFallbacks; i++) {
+    delete theFallbacks[i];
+    if (theFallbackTests[i] != 0)
+      delete theFallbackTests[i];
+  }
+  if (theFallbacks != 0)
+    delete [] theFallbacks;
+  if (theFallbackTests != 0)
+    delete [] theFallbackTests;
 }    
 
 int 
@@ -80,70 +93,113 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
   double totalTimeIncr = numSteps * dT;
   double currentTimeIncr = 0.0;
   double currentDt = dT;
+  numUntilEstimate = 0;
+  int numSucceeded = 0;
+
+  // when the step is set from the critical step or cut, the last step
+  // ends at the requested time
+  bool fixedEnd = (courantFraction > 0.0 || cutFactor > 0.0);
 
   // loop until analysis has performed the total time incr requested
   while (currentTimeIncr < totalTimeIncr) {
 
-    if (theModel->analysisStep(currentDt) < 0) {
-      opserr << "DirectIntegrationAnalysis::analyze() - the AnalysisModel failed in newStepDomain";
-      opserr << " at time " << theDom->getCurrentTime() << endln;
-      theDom->revertToLastCommit();
-      return -2;
-    }
+    if (fixedEnd == true && totalTimeIncr - currentTimeIncr <= 1.0e-12*totalTimeIncr)
+      break;
 
-    if (this->checkDomainChange() != 0) {
-      opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - failed checkDomainChange\n";
-      return -1;
+    if (courantFraction > 0.0) {
+      currentDt = this->getCourantDt(dtMax);
+      if (currentDt < dtMin) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - the step from the critical step, ";
+	opserr << currentDt << ", is less than dtMin at time " << theDom->getCurrentTime() << endln;
+	return -5;
+      }
     }
 
+    double stepDt = currentDt;
+    if (fixedEnd == true && currentTimeIncr + stepDt > totalTimeIncr)
+      stepDt = totalTimeIncr - currentTimeIncr;
+
     //
     // do newStep(), solveCurrentStep() and commit() as in regular
     // DirectINtegrationAnalysis - difference is we do not return
-    // if a failure - we stop the analysis & resize time step if failure
+    // if a failure - we try the fallback algorithms from the last
+    // committed state & then stop the analysis or resize the time step
     //
 
-    if (theIntegratr->newStep(currentDt) < 0) {
-      result = -2;
-    }
+    for (int i=0; i<=numFallbacks; i++) {
 
+      if (theModel->analysisStep(stepDt) < 0) {
+	opserr << "DirectIntegrationAnalysis::analyze() - the AnalysisModel failed in newStepDomain";
+	opserr << " at time " << theDom->getCurrentTime() << endln;
+	theDom->revertToLastCommit();
+	return -2;
+      }
 
-    if (result >= 0) {
-      result = theAlgo->solveCurrentStep();
-      if (result < 0) 
-	result = -3;
-    }    
+      if (this->checkDomainChange() != 0) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - failed checkDomainChange\n";
+	return -1;
+      }
 
-    if (result >= 0) {
-      result = theIntegratr->commit();
-      if (result < 0) 
-	result = -4;
+      // the fallbacks are linked when used, so that they see any change
+      // in the objects of the analysis
+      EquiSolnAlgo *theStepAlgo = theAlgo;
+      if (i > 0) {
+	theStepAlgo = theFallbacks[i-1];
+	ConvergenceTest *theStepTest = theFallbackTests[i-1];
+	if (theStepTest == 0)
+	  theStepTest = this->getConvergenceTest();
+	theStepAlgo->setLinks(*theModel, *theIntegratr, *(this->getLinearSOE()), theStepTest);
+	theStepAlgo->domainChanged();
+      }
+
+      result = this->solveStep(stepDt, theStepAlgo);
+      if (result >= 0)
+	break;
     }
 
     // if the time step was successfull increment delta T for the analysis
-    // othewise revert the Domain to last committed state & see if can go on
+    // othewise see if can go on from the last committed state
 
-    if (result >= 0) 
-      currentTimeIncr += currentDt;
+    if (result >= 0) {
+      currentTimeIncr += stepDt;
+
+      if (cutFactor > 0.0 && ++numSucceeded >= numGrow) {
+	currentDt *= growFactor;
+	if (currentDt > dtMax)
+	  currentDt = dtMax;
+	numSucceeded = 0;
+      }
+    }
     else {
 
-      // invoke the revertToLastCommit
-      theDom->revertToLastCommit();	    
-      theIntegratr->revertToLastStep();
+      // the step is not reduced when set from the critical step
+      if (courantFraction > 0.0) {
+	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - ";
+	opserr << " failed at time " << theDom->getCurrentTime() << endln;
+	return result;
+      }
 
       // if last dT was <= min specified the analysis FAILS - return FAILURE
-      if (currentDt <= dtMin) {
+      if (stepDt <= dtMin) {
 	opserr << "VariableTimeStepDirectIntegrationAnalysis::analyze() - ";
 	opserr << " failed at time " << theDom->getCurrentTime() << endln;
 	return result;
       }
 
+      if (cutFactor > 0.0) {
+	currentDt = stepDt*cutFactor;
+	if (currentDt < dtMin)
+	  currentDt = dtMin;
+	numSucceeded = 0;
+      }
       
       // if still here reset result for next loop
       result = 0;
     }
 
     // now we determine a new delta T for next loop
-    currentDt = this->determineDt(currentDt, dtMin, dtMax, Jd, theTest);
+    if (cutFactor <= 0.0)
+      currentDt = this->determineDt(currentDt, dtMin, dtMax, Jd, theTest);
   }
 
 
@@ -151,6 +207,42 @@ VariableTimeStepDirectIntegrationAnalysis::analyze(int numSteps, double dT, doub
 }
 
 
+int
+VariableTimeStepDirectIntegrationAnalysis::solveStep(double dT, EquiSolnAlgo *theAlgo)
+{
+  Domain *theDom = this->getDomainPtr();
+  TransientIntegrator *theIntegratr = this->getIntegrator();
+
+  int result = 0;
+  if (theIntegratr->newStep(dT) < 0)
+    result = -2;
+
+  if (result >= 0) {
+    double stepStart = (ConvergenceLog::active == true) ? ConvergenceLog::getTime() : 0.0;
+    result = theAlgo->solveCurrentStep();
+    if (ConvergenceLog::active == true)
+      ConvergenceLog::record(theDom->getCurrentTime(), dT, *theAlgo, result,
+			     stepStart);
+    if (result < 0) 
+      result = -3;
+  }    
+
+  if (result >= 0) {
+    result = theIntegratr->commit();
+    if (result < 0) 
+      result = -4;
+  }
+
+  // invoke the revertToLastCommit if the step failed
+  if (result < 0) {
+    theDom->revertToLastCommit();	    
+    theIntegratr->revertToLastStep();
+  }
+
+  return result;
+}
+
+
 
 
 
@@ -184,3 +276,101 @@ VariableTimeStepDirectIntegrationAnalysis::determineDt(double dT,
 }
 
 
+int
+VariableTimeStepDirectIntegrationAnalysis::setCourantFraction(double fraction,
+							      int interval,
+							      bool initial)
+{
+  if (fraction < 0.0 || interval < 1) {
+    opserr << "VariableTimeStepDirectIntegrationAnalysis::setCourantFraction() - ";
+    opserr << "invalid fraction " << fraction << " or interval " << interval << endln;
+    return -1;
+  }
+
+  courantFraction = fraction;
+  courantInterval = interval;
+  courantInitial = initial;
+  numUntilEstimate = 0;
+
+  return 0;
+}
+
+
+double
+VariableTimeStepDirectIntegrationAnalysis::getCourantDt(double dtMax)
+{
+  if (numUntilEstimate <= 0) {
+    Domain *theDom = this->getDomainPtr();
+    dtCritical = theDom->getCriticalTimeStep(courantInitial);
+    numUntilEstimate = courantInterval;
+  }
+  numUntilEstimate--;
+
+  // no dof with both mass and stiffness
+  if (dtCritical <= 0.0)
+    return dtMax;
+
+  double dt = courantFraction*dtCritical;
+  if (dt > dtMax)
+    dt = dtMax;
+
+  return dt;
+}
+
+
+int
+VariableTimeStepDirectIntegrationAnalysis::addFallback(EquiSolnAlgo &theAlgo)
+{
+  EquiSolnAlgo **newFallbacks = new EquiSolnAlgo *[numFallbacks+1];
+  ConvergenceTest **newTests = new ConvergenceTest *[numFallbacks+1];
+  for (int i=0; i<numFallbacks; i++) {
+    newFallbacks[i] = theFallbacks[i];
+    newTests[i] = theFallbackTests[i];
+  }
+  newFallbacks[numFallbacks] = &theAlgo;
+  newTests[numFallbacks] = 0;
+
+  if (theFallbacks != 0)
+    delete [] theFallbacks;
+  if (theFallbackTests != 0)
+    delete [] theFallbackTests;
+  theFallbacks = newFallbacks;
+  theFallbackTests = newTests;
+  numFallbacks++;
+
+  return 0;
+}
+
+
+int
+VariableTimeStepDirectIntegrationAnalysis::setFallbackTest(ConvergenceTest &theTest)
+{
+  if (numFallbacks == 0) {
+    opserr << "VariableTimeStepDirectIntegrationAnalysis::setFallbackTest() - no fallback algorithm\n";
+    return -1;
+  }
+
+  if (theFallbackTests[numFallbacks-1] != 0)
+    delete theFallbackTests[numFallbacks-1];
+  theFallbackTests[numFallbacks-1] = &theTest;
+
+  return 0;
+}
+
+
+int
+VariableTimeStepDirectIntegrationAnalysis::setStepCutting(double cut, double grow, int num)
+{
+  if (cut < 0.0 || cut >= 1.0 || grow < 1.0 || num < 1) {
+    opserr << "VariableTimeStepDirectIntegrationAnalysis::setStepCutting() - ";
+    opserr << "invalid cut factor " << cut << ", grow factor " << grow;
+    opserr << " or number of steps " << num << endln;
+    return -1;
+  }
+
+  cutFactor = cut;
+  growFactor = grow;
+  numGrow = num;
+
+  return 0;
+}
@@ -62,11 +62,41 @@ class VariableTimeStepDirectIntegrationAnalysis: public DirectIntegrationAnalysi
 
     int analyze(int numSteps, double dT, double dtMin, double dtMax, int Jd);
 
+    // for explicit integrators, each step is set to fraction times the
+    // critical step of the Domain, estimated again every interval steps
+    // from the initial or current stiffness, and to at most dtMax
+    int setCourantFraction(double fraction, int interval = 1, bool initial = false);
+
+    // a step that fails is tried again from the last committed state with
+    // each fallback algorithm in turn, with the test set for it or that of
+    // the analysis; the analysis takes ownership of both
+    int addFallback(EquiSolnAlgo &theAlgo);
+    int setFallbackTest(ConvergenceTest &theTest);
+
+    // with a cutFactor the step is cut by it when all the algorithms fail,
+    // and grown by growFactor up to dtMax after numGrow steps in a row
+    // succeed, in place of the step from the number of iterations
+    int setStepCutting(double cutFactor, double growFactor, int numGrow = 1);
+
   protected:
     virtual double determineDt(double dT, double dtMin, double dtMax, int Jd,
 			       ConvergenceTest *theTest);
 
   private:
+    double getCourantDt(double dtMax);
+    int solveStep(double dT, EquiSolnAlgo *theAlgo);
+
+    double courantFraction;    // 0 if the step is not set from the critical step
+    int courantInterval;
+    bool courantInitial;
+    double dtCritical;
+    int numUntilEstimate;
+
+    EquiSolnAlgo **theFallbacks;
+    ConvergenceTest **theFallbackTests;
+    int numFallbacks;
+    double cutFactor, growFactor;
+    int numGrow;
 };
 
 #endif
@@ -42,6 +42,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <TransientIntegrator.h>
+#include <Workspace.h>
 
 #define MAX_NUM_DOF 256
 
@@ -49,9 +50,10 @@
 // static variables initialisation
 Matrix DOF_Group::errMatrix(1,1);
 Vector DOF_Group::errVect(1);
-Matrix **DOF_Group::theMatrices; // array of pointers to class wide matrices
-Vector **DOF_Group::theVectors;  // array of pointers to class widde vectors
-int DOF_Group::numDOFs(0);           // number of objects
+
+// keys identifying the Workspace objects used for tangent and unbalance
+static char tangentKey;
+static char unbalanceKey;
 
 
 //  DOF_Group(Node *);
@@ -82,43 +84,13 @@ DOF_Group::DOF_Group(int tag, Node *node)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "DOF_Group::DOF_Group(Node *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-    
     // set the pointers for the tangent and residual
     if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
-		tangent == 0 || tangent->noCols() != numDOF)	{  
-		opserr << "DOF_Group::DOF_Group(Node *) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
+	// use the Workspace objects of the thread creating the DOF_Group,
+	// shared by the DOF_Groups of the same size it creates, so that
+	// the DOF_Groups of models analyzed in other threads do not share them
+	unbalance = &Workspace::getVector(&unbalanceKey, numDOF);
+	tangent = &Workspace::getMatrix(&tangentKey, numDOF, numDOF);
     } else {
 	// create matrices and vectors for each object instance
 	unbalance = new Vector(numDOF);
@@ -132,8 +104,6 @@ DOF_Group::DOF_Group(int tag, Node *node)
 	    exit(-1);
 	}
     }
-    
-    numDOFs++;
 }
 
 
@@ -162,43 +132,13 @@ DOF_Group::DOF_Group(int tag, int ndof)
     for (int i=0; i<numDOF; i++)
 	myID(i) = -2;
     
-    // if this is the first DOF_Group we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numDOFs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }    
-
     // set the pointers for the tangent and residual
     if (numDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (theVectors[numDOF] == 0) {
-	    // have to create matrix and vector of size as none yet created
-	    theVectors[numDOF] = new Vector(numDOF);
-	    theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	    if (unbalance == 0 || unbalance->Size() != numDOF ||	
-		tangent == 0 || tangent->noCols() != numDOF)	{  
-		opserr << "DOF_Group::DOF_Group(int, int ndof) ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    unbalance = theVectors[numDOF];
-	    tangent = theMatrices[numDOF];
-	}
+	// use the Workspace objects of the thread creating the DOF_Group,
+	// shared by the DOF_Groups of the same size it creates, so that
+	// the DOF_Groups of models analyzed in other threads do not share them
+	unbalance = &Workspace::getVector(&unbalanceKey, numDOF);
+	tangent = &Workspace::getMatrix(&tangentKey, numDOF, numDOF);
     } else {
 	// create matrices and vectors for each object instance
 	unbalance = new Vector(numDOF);
@@ -212,8 +152,6 @@ DOF_Group::DOF_Group(int tag, int ndof)
 	    exit(-1);
 	}
     }
-    
-    numDOFs++;
 }
 
 // ~DOF_Group();    
@@ -221,8 +159,6 @@ DOF_Group::DOF_Group(int tag, int ndof)
 
 DOF_Group::~DOF_Group()
 {
-    numDOFs--;
-
     int numDOF = unbalance->Size();
 
     // set the pointer in the associated Node to 0, to stop
@@ -235,19 +171,6 @@ DOF_Group::~DOF_Group()
 	if (tangent != 0) delete tangent;
 	if (unbalance != 0) delete unbalance;
     }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numDOFs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
-    }    
 }    
 
 // void setID(int index, int value);
@@ -729,6 +652,13 @@ DOF_Group::incrNodeAccel(const Vector &udotdot)
 }
 
 
+Node *
+DOF_Group::getResponseNode(void)
+{
+    return myNode;
+}
+
+
 
 void
 DOF_Group::setEigenvector(int mode, const Vector &theVector)
@@ -753,6 +683,31 @@ DOF_Group::setEigenvector(int mode, const Vector &theVector)
 }
 
 
+void
+DOF_Group::setEigenvectors(const double *eigenvectors, int numEqn, int numModes)
+{
+    if (myNode == 0) {
+	opserr << "DOF_Group::setEigenvectors: 0 Node Pointer\n";
+	exit(-1);
+    }
+
+    // all the modes in one pass, the eigenvectors stored by column
+    static Matrix theVectors;
+    theVectors.resize(numDOF, numModes);
+    
+    for (int i=0; i<numDOF; i++) {
+	int loc = myID(i);
+	if (loc >= 0)
+	    for (int j=0; j<numModes; j++)
+		theVectors(i,j) = eigenvectors[j*numEqn+loc];
+	else
+	    for (int j=0; j<numModes; j++)
+		theVectors(i,j) = 0.0;
+    }
+    myNode->setEigenvectors(theVectors);
+}
+
+
 
 const Matrix &
 DOF_Group::getEigenvectors(void)
@@ -97,8 +97,13 @@ class DOF_Group: public TaggedObject
     virtual void incrNodeVel(const Vector &udot);
     virtual void incrNodeAccel(const Vector &udotdot);
 
+    // the Node whose trial response the methods above set from the
+    // equations in the ID, 0 if they do something else
+    virtual Node *getResponseNode(void);
+
     // methods to set the eigen vectors
     virtual void setEigenvector(int mode, const Vector &eigenvalue);
+    virtual void setEigenvectors(const double *eigenvectors, int numEqn, int numModes);
     virtual const Matrix &getEigenvectors(void);
 
     virtual double getDampingBetaFactor(int mode, double ratio, double wn);
@@ -144,9 +149,6 @@ class DOF_Group: public TaggedObject
     // static variables - single copy for all objects of the class	    
     static Matrix errMatrix;
     static Vector errVect;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numDOFs;           // number of objects    
 };
 
 #endif
@@ -48,10 +48,10 @@
 #define MAX_NUM_DOF 16
 
 // static variables initialisation
-Matrix **TransformationDOF_Group::modMatrices; 
-Vector **TransformationDOF_Group::modVectors;  
-int TransformationDOF_Group::numTransDOFs(0);     // number of objects
-TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
+OPS_THREAD_LOCAL Matrix **TransformationDOF_Group::modMatrices; 
+OPS_THREAD_LOCAL Vector **TransformationDOF_Group::modVectors;  
+OPS_THREAD_LOCAL int TransformationDOF_Group::numTransDOFs(0);     // number of objects
+OPS_THREAD_LOCAL TransformationConstraintHandler *TransformationDOF_Group::theHandler = 0;     // number of objects
 
 TransformationDOF_Group::TransformationDOF_Group(int tag, Node *node, 
 						 MP_Constraint *mp,
@@ -197,17 +197,8 @@ TransformationDOF_Group::TransformationDOF_Group(int tag,
     for (int i=0; i<modNumDOF; i++) 
 	theSPs[i] = 0;
 
-    // set the SP_Constraint corresponding to the dof in myID
-    Domain *theDomain=node->getDomain();
-    int nodeTag = node->getTag();
-    SP_ConstraintIter &theSPIter = theDomain->getSPs();
-    SP_Constraint *sp;
-    while ((sp = theSPIter()) != 0) {
-	if (sp->getNodeTag() == nodeTag) {
-	    int dof = sp->getDOF_Number();
-	    theSPs[dof] = sp;
-	}
-    }    
+    // the SP_Constraints on the node are set by the handler through
+    // addSP_Constraint(), rather than by searching all those of the domain
     
     // if this is the first TransformationDOF_Group we now
     // create the arrays used to store pointers to class wide
@@ -683,6 +674,17 @@ TransformationDOF_Group::incrNodeAccel(const Vector &u)
 }
 
 
+Node *
+TransformationDOF_Group::getResponseNode(void)
+{
+  // with an MP_Constraint the response comes through T
+  if (theMP == 0)
+    return myNode;
+  else
+    return 0;
+}
+
+
 void
 TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
 {
@@ -711,6 +713,40 @@ TransformationDOF_Group::setEigenvector(int mode, const Vector &u)
 }
 
 
+void
+TransformationDOF_Group::setEigenvectors(const double *eigenvectors, int numEqn, int numModes)
+{
+  // call base class method and return if no MP_Constraint
+  if (theMP == 0) {
+    this->DOF_Group::setEigenvectors(eigenvectors, numEqn, numModes);
+    return;
+  }
+
+  static Matrix modVectors;
+  modVectors.resize(modNumDOF, numModes);
+
+  const ID &theID = this->getID();
+  for (int i=0; i<modNumDOF; i++) {
+    int loc = theID(i);
+    if (loc >= 0)
+      for (int j=0; j<numModes; j++)
+	modVectors(i,j) = eigenvectors[j*numEqn+loc];
+    else
+      for (int j=0; j<numModes; j++)
+	modVectors(i,j) = 0.0;
+  }
+  Matrix *T = this->getT();
+
+  if (T != 0) {
+    static Matrix theVectors;
+    theVectors.resize(T->noRows(), numModes);
+    theVectors.addMatrixProduct(0.0, *T, modVectors, 1.0);
+    myNode->setEigenvectors(theVectors);
+  } else
+    myNode->setEigenvectors(modVectors);
+}
+
+
 Matrix *
 TransformationDOF_Group::getT(void)
 {
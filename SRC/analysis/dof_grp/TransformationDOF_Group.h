@@ -84,8 +84,10 @@ class TransformationDOF_Group: public DOF_Group
     void incrNodeDisp(const Vector &u);
     void incrNodeVel(const Vector &udot);
     void incrNodeAccel(const Vector &udotdot);
+    Node *getResponseNode(void);
 
     virtual void setEigenvector(int mode, const Vector &eigenvalue);
+    virtual void setEigenvectors(const double *eigenvectors, int numEqn, int numModes);
 
     int addSP_Constraint(SP_Constraint &theSP);
     int enforceSPs(int doMP);
@@ -119,11 +121,12 @@ class TransformationDOF_Group: public DOF_Group
     int needRetainedData;
     SP_Constraint **theSPs;
     
-    // static variables - single copy for all objects of the class	    
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static int numTransDOFs;           // number of objects        
-    static TransformationConstraintHandler *theHandler;
+    // static variables - single copy for all objects of the class created
+    // by a thread, so that models can be analyzed concurrently in threads	    
+    static OPS_THREAD_LOCAL Matrix **modMatrices; // array of pointers to class wide matrices
+    static OPS_THREAD_LOCAL Vector **modVectors;  // array of pointers to class widde vectors
+    static OPS_THREAD_LOCAL int numTransDOFs;           // number of objects        
+    static OPS_THREAD_LOCAL TransformationConstraintHandler *theHandler;
 };
 
 #endif
@@ -42,15 +42,22 @@
 #include <AnalysisModel.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <Workspace.h>
 
 #define MAX_NUM_DOF 64
 
 // static variables initialisation
 Matrix FE_Element::errMatrix(1,1);
 Vector FE_Element::errVector(1);
-Matrix **FE_Element::theMatrices; // pointers to class wide matrices
-Vector **FE_Element::theVectors;  // pointers to class widde vectors
-int FE_Element::numFEs(0);           // number of objects
+OPS_THREAD_LOCAL int FE_Element::numFEs(0);           // number of objects
+
+// keys identifying the Workspace objects used for tangent and residual
+static char tangentKey;
+static char residualKey;
+static char inactiveKey;
+
+// fraction of the initial stiffness kept by an inactive element
+static const double inactiveStiffFactor = 1.0e-6;
 
 //  FE_Element(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
@@ -58,7 +65,8 @@ FE_Element::FE_Element(int tag, Element *ele)
   :TaggedObject(tag),
    myDOF_Groups((ele->getExternalNodes()).Size()), myID(ele->getNumDOF()), 
    numDOF(ele->getNumDOF()), theModel(0), myEle(ele), 
-   theResidual(0), theTangent(0), theIntegrator(0)
+   theResidual(0), theTangent(0), theIntegrator(0), theLinearK(0),
+   rayleighSplit(-1)
 {
   if (numDOF <= 0) {
     opserr << "FE_Element::FE_Element(Element *) ";
@@ -96,46 +104,16 @@ FE_Element::FE_Element(int tag, Element *ele)
 	}
     }
 
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
-
     if (ele->isSubdomain() == false) {
 	
 	// if Elements are not subdomains, set up pointers to
 	// objects to return tangent Matrix and residual Vector.
 
 	if (numDOF <= MAX_NUM_DOF) {
-	    // use class wide objects
-	    if (theVectors[numDOF] == 0) {
-		theVectors[numDOF] = new Vector(numDOF);
-		theMatrices[numDOF] = new Matrix(numDOF,numDOF);
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-		if (theResidual == 0 || theResidual->Size() != numDOF ||	
-		    theTangent == 0 || theTangent->noCols() != numDOF)	{  
-		    opserr << "FE_Element::FE_Element(Element *) ";
-		    opserr << " ran out of memory for vector/Matrix of size :";
-		    opserr << numDOF << endln;
-		    exit(-1);
-		}
-	    } else {
-		theResidual = theVectors[numDOF];
-		theTangent = theMatrices[numDOF];
-	    }
+	    // use the Workspace objects of the calling thread, 
+	    // see getTangentStorage() and getResidualStorage()
+	    theResidual = 0;
+	    theTangent = 0;
 	} else {
 	    // create matrices and vectors for each object instance
 	    theResidual = new Vector(numDOF);
@@ -167,27 +145,11 @@ FE_Element::FE_Element(int tag, Element *ele)
 FE_Element::FE_Element(int tag, int numDOF_Group, int ndof)
   :TaggedObject(tag),
    myDOF_Groups(numDOF_Group), myID(ndof), numDOF(ndof), theModel(0),
-   myEle(0), theResidual(0), theTangent(0), theIntegrator(0)
+   myEle(0), theResidual(0), theTangent(0), theIntegrator(0), theLinearK(0),
+   rayleighSplit(-1)
 {
     // this is for a subtype, the subtype must set the myDOF_Groups ID array
     numFEs++;
-
-    // if this is the first FE_Element we now
-    // create the arrays used to store pointers to class wide
-    // matrix and vector objects used to return tangent and residual
-    if (numFEs == 0) {
-	theMatrices = new Matrix *[MAX_NUM_DOF+1];
-	theVectors  = new Vector *[MAX_NUM_DOF+1];
-	
-	if (theMatrices == 0 || theVectors == 0) {
-	    opserr << "FE_Element::FE_Element(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    theMatrices[i] = 0;
-	    theVectors[i] = 0;
-	}
-    }
     
     // as subtypes have no access to the tangent or residual we don't set them
     // this way we can detect if subclass does not provide all methods it should
@@ -209,20 +171,61 @@ FE_Element::~FE_Element()
 	if (theResidual != 0) delete theResidual;
     }
 
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numFEs == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (theVectors[i] != 0)
-		delete theVectors[i];
-	    if (theMatrices[i] != 0)
-		delete theMatrices[i];
-	}	
-	delete [] theMatrices;
-	delete [] theVectors;
-    }
+    if (theLinearK != 0)
+	delete theLinearK;
 }    
 
+// the tangent and residual of the FE_Element; unless the element has more
+// than MAX_NUM_DOF dof these are the calling thread's Workspace objects, so
+// like the class wide objects they replace, their contents are only valid
+// until another FE_Element of the same size is formed by the same thread.
+
+Matrix *
+FE_Element::getTangentStorage(void)
+{
+    if (theTangent != 0)
+	return theTangent;
+    return &Workspace::getMatrix(&tangentKey, numDOF, numDOF);
+}
+
+Vector *
+FE_Element::getResidualStorage(void)
+{
+    if (theResidual != 0)
+	return theResidual;
+    return &Workspace::getVector(&residualKey, numDOF);
+}
+
+// the stiffness of the element; while the element reports it is linear
+// the first stiffness it returned is kept and reused, so that its state
+// determination is skipped when the tangent is formed again. The copy is
+// dropped as soon as the element is no longer linear. An inactive element
+// gives inactiveStiffFactor times its initial stiffness, enough to keep the
+// equations of nodes left with only inactive elements nonsingular.
+
+const Matrix &
+FE_Element::getStiff(void)
+{
+    if (myEle->isActive() == false) {
+	Matrix &theK = Workspace::getMatrix(&inactiveKey, numDOF, numDOF);
+	theK.addMatrix(0.0, myEle->getInitialStiff(), inactiveStiffFactor);
+	return theK;
+    }
+
+    if (myEle->isLinear() == false) {
+	if (theLinearK != 0) {
+	    delete theLinearK;
+	    theLinearK = 0;
+	}
+	return myEle->getTangentStiff();
+    }
+
+    if (theLinearK == 0)
+	theLinearK = new Matrix(myEle->getTangentStiff());
+
+    return *theLinearK;
+}
+
 
 const ID &
 FE_Element::getDOFtags(void) const 
@@ -300,7 +303,7 @@ FE_Element::getTangent(Integrator *theNewIntegrator)
       if (theNewIntegrator != 0)
 	theNewIntegrator->formEleTangent(this);	    	    
 
-      return *theTangent;
+      return *this->getTangentStorage();
     } else {
       Subdomain *theSub = (Subdomain *)myEle;
       theSub->computeTang();	    
@@ -314,7 +317,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
     theIntegrator = theNewIntegrator;
 
     if (theIntegrator == 0)
-      return *theResidual;
+      return *this->getResidualStorage();
 
     if (myEle == 0) {
 	opserr << "FATAL FE_Element::getTangent() - no Element *given ";
@@ -325,7 +328,7 @@ FE_Element::getResidual(Integrator *theNewIntegrator)
 
     if (myEle->isSubdomain() == false) {
       theNewIntegrator->formEleResidual(this);
-      return *theResidual;
+      return *this->getResidualStorage();
     } else {
       Subdomain *theSub = (Subdomain *)myEle;
       theSub->computeResidual();	    
@@ -340,7 +343,7 @@ FE_Element::zeroTangent(void)
 {
     if (myEle != 0) {
 	if (myEle->isSubdomain() == false)
-	    theTangent->Zero();
+	    this->getTangentStorage()->Zero();
 	else {
 	    opserr << "WARNING FE_Element::zeroTangent() - ";
 	    opserr << "- this should not be called on a Subdomain!\n";
@@ -357,7 +360,7 @@ FE_Element::addKtToTang(double fact)
 	if (fact == 0.0) 
 	    return;
 	else if (myEle->isSubdomain() == false)	    
-	    theTangent->addMatrix(1.0, myEle->getTangentStiff(),fact);
+	    this->getTangentStorage()->addMatrix(1.0, this->getStiff(),fact);
 	else {
 	    opserr << "WARNING FE_Element::addKToTang() - ";
 	    opserr << "- this should not be called on a Subdomain!\n";
@@ -371,10 +374,10 @@ FE_Element::addCtoTang(double fact)
     if (myEle != 0) {
 	
 	// check for a quick return	
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	  return;
 	else if (myEle->isSubdomain() == false)	    	    
-	  theTangent->addMatrix(1.0, myEle->getDamp(),fact);
+	  this->getTangentStorage()->addMatrix(1.0, myEle->getDamp(),fact);
 	else {
 	  opserr << "WARNING FE_Element::addCToTang() - ";
 	  opserr << "- this should not be called on a Subdomain!\n";
@@ -388,10 +391,10 @@ FE_Element::addMtoTang(double fact)
     if (myEle != 0) {
 
 	// check for a quick return	
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	  return;
 	else if (myEle->isSubdomain() == false)	    	    
-	  theTangent->addMatrix(1.0, myEle->getMass(),fact);
+	  this->getTangentStorage()->addMatrix(1.0, myEle->getMass(),fact);
 	else {
 	  opserr << "WARNING FE_Element::addMToTang() - ";
 	  opserr << "- this should not be called on a Subdomain!\n";
@@ -408,7 +411,7 @@ FE_Element::addKiToTang(double fact)
     if (fact == 0.0) 
       return;
     else if (myEle->isSubdomain() == false)	    	    
-      theTangent->addMatrix(1.0, myEle->getInitialStiff(), fact);
+      this->getTangentStorage()->addMatrix(1.0, (myEle->isLinear() || myEle->isActive() == false) ? this->getStiff() : myEle->getInitialStiff(), fact);
     else {
 	opserr << "WARNING FE_Element::addKiToTang() - ";
 	opserr << "- this should not be called on a Subdomain!\n";
@@ -421,10 +424,10 @@ FE_Element::addKgToTang(double fact)
 {
   if (myEle != 0) {
     // check for a quick return	
-    if (fact == 0.0) 
+    if (fact == 0.0 || myEle->isActive() == false) 
       return;
     else if (myEle->isSubdomain() == false)	    	    
-      theTangent->addMatrix(1.0, myEle->getGeometricTangentStiff(), fact);
+      this->getTangentStorage()->addMatrix(1.0, myEle->getGeometricTangentStiff(), fact);
     else {
 	opserr << "WARNING FE_Element::addKgToTang() - ";
 	opserr << "- this should not be called on a Subdomain!\n";
@@ -437,12 +440,12 @@ FE_Element::addKpToTang(double fact, int numP)
 {
   if (myEle != 0) {
     // check for a quick return	
-    if (fact == 0.0) 
+    if (fact == 0.0 || myEle->isActive() == false) 
       return;
     else if (myEle->isSubdomain() == false) {
       const Matrix *thePrevMat = myEle->getPreviousK(numP);
       if (thePrevMat != 0)
-	theTangent->addMatrix(1.0, *thePrevMat, fact);
+	this->getTangentStorage()->addMatrix(1.0, *thePrevMat, fact);
     } else {
       opserr << "WARNING FE_Element::addKpToTang() - ";
       opserr << "- this should not be called on a Subdomain!\n";
@@ -467,7 +470,7 @@ FE_Element::zeroResidual(void)
 {
     if (myEle != 0) {
 	if (myEle->isSubdomain() == false)
-	    theResidual->Zero();
+	    this->getResidualStorage()->Zero();
 	else {
 	    opserr << "WARNING FE_Element::zeroResidual() - ";
 	    opserr << "- this should not be called on a Subdomain!\n";
@@ -484,11 +487,11 @@ FE_Element::addRtoResidual(double fact)
 {
   if (myEle != 0) {
     // check for a quick return	
-    if (fact == 0.0) 
+    if (fact == 0.0 || myEle->isActive() == false) 
       return;
     else if (myEle->isSubdomain() == false) {
       const Vector &eleResisting = myEle->getResistingForce();
-      theResidual->addVector(1.0, eleResisting, -fact);
+      this->getResidualStorage()->addVector(1.0, eleResisting, -fact);
     }
     else {
       opserr << "WARNING FE_Element::addRtoResidual() - ";
@@ -507,11 +510,11 @@ FE_Element::addRIncInertiaToResidual(double fact)
 {
     if (myEle != 0) {
 	// check for a quick return	
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	    return;
 	else if (myEle->isSubdomain() == false) {
 	  const Vector &eleResisting = myEle->getResistingForceIncInertia();
-	  theResidual->addVector(1.0, eleResisting, -fact);
+	  this->getResidualStorage()->addVector(1.0, eleResisting, -fact);
 	}
 	else {
 	    opserr << "WARNING FE_Element::addRtoResidual() - ";
@@ -531,11 +534,11 @@ FE_Element::getTangForce(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->getResidualStorage()->Zero();
 
 	// check for a quick return
 	if (fact == 0.0) 
-	    return *theResidual;
+	    return *this->getResidualStorage();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
@@ -551,19 +554,19 @@ FE_Element::getTangForce(const Vector &disp, double fact)
 	if (myEle->isSubdomain() == false) {
 	    // form the tangent again and then add the force
 	    theIntegrator->formEleTangent(this);
-	    if (theResidual->addMatrixVector(1.0, *theTangent,tmp,fact) < 0) {
+	    if (this->getResidualStorage()->addMatrixVector(1.0, *this->getTangentStorage(),tmp,fact) < 0) {
 		opserr << "WARNING FE_Element::getTangForce() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }				
 	}
 	else {
 	    Subdomain *theSub = (Subdomain *)myEle;
-	    if (theResidual->addMatrixVector(1.0, theSub->getTang(),tmp,fact) < 0) {
+	    if (this->getResidualStorage()->addMatrixVector(1.0, theSub->getTang(),tmp,fact) < 0) {
 		opserr << "WARNING FE_Element::getTangForce() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }						
 	}
-	return *theResidual;
+	return *this->getResidualStorage();
     }
     else {
 	opserr << "WARNING FE_Element::addTangForce() - no Element *given ";
@@ -580,11 +583,11 @@ FE_Element::getK_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->getResidualStorage()->Zero();
 
 	// check for a quick return
 	if (fact == 0.0) 
-	    return *theResidual;
+	    return *this->getResidualStorage();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
@@ -597,12 +600,12 @@ FE_Element::getK_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
+	if (this->getResidualStorage()->addMatrixVector(1.0, this->getStiff(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getKForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
-	return *theResidual;
+	return *this->getResidualStorage();
     }
     else {
 	opserr << "WARNING FE_Element::getKForce() - no Element *given ";
@@ -618,11 +621,11 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->getResidualStorage()->Zero();
 
 	// check for a quick return
 	if (fact == 0.0) 
-	    return *theResidual;
+	    return *this->getResidualStorage();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
@@ -635,12 +638,12 @@ FE_Element::getKi_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getInitialStiff(), tmp, fact) < 0){
+	if (this->getResidualStorage()->addMatrixVector(1.0, myEle->isActive() ? myEle->getInitialStiff() : this->getStiff(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getKForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
-	return *theResidual;
+	return *this->getResidualStorage();
     }
     else {
 	opserr << "WARNING FE_Element::getKForce() - no Element *given ";
@@ -656,11 +659,11 @@ FE_Element::getM_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->getResidualStorage()->Zero();
 
 	// check for a quick return
-	if (fact == 0.0) 
-	    return *theResidual;
+	if (fact == 0.0 || myEle->isActive() == false) 
+	    return *this->getResidualStorage();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
@@ -673,13 +676,13 @@ FE_Element::getM_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
+	if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getMForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
 
-	return *theResidual;
+	return *this->getResidualStorage();
     }
     else {
 	opserr << "WARNING FE_Element::getMForce() - no Element *given ";
@@ -694,11 +697,11 @@ FE_Element::getC_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// zero out the force vector
-	theResidual->Zero();
+	this->getResidualStorage()->Zero();
 
 	// check for a quick return
-	if (fact == 0.0) 
-	    return *theResidual;
+	if (fact == 0.0 || myEle->isActive() == false) 
+	    return *this->getResidualStorage();
 
 	// get the components we need out of the vector
 	// and place in a temporary vector
@@ -711,12 +714,12 @@ FE_Element::getC_Force(const Vector &disp, double fact)
 	    tmp(i) = 0.0;
 	}
 
-	if (theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
+	if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
 	  opserr << "WARNING FE_Element::getDForce() - ";
 	  opserr << "- addMatrixVector returned error\n";		 
 	}		
 
-	return *theResidual;
+	return *this->getResidualStorage();
     }
     else {
 	opserr << "WARNING FE_Element::getDForce() - no Element *given ";
@@ -738,18 +741,18 @@ FE_Element::getLastResponse(void)
 {
     if (myEle != 0) {
       if (theIntegrator != 0) {
-	if (theIntegrator->getLastResponse(*theResidual,myID) < 0) {
+	if (theIntegrator->getLastResponse(*this->getResidualStorage(),myID) < 0) {
 	  opserr << "WARNING FE_Element::getLastResponse(void)";
 	  opserr << " - the Integrator had problems with getLastResponse()\n";
 	}
       }
       else {
-	theResidual->Zero();
+	this->getResidualStorage()->Zero();
 	opserr << "WARNING  FE_Element::getLastResponse()";
 	opserr << " No Integrator yet passed\n";
       }
     
-      Vector &result = *theResidual;
+      Vector &result = *this->getResidualStorage();
       return result;
     }
     else {
@@ -765,7 +768,7 @@ FE_Element::addM_Force(const Vector &accel, double fact)
     if (myEle != 0) {    
 
 	// check for a quick return
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	    return;
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
@@ -779,7 +782,7 @@ FE_Element::addM_Force(const Vector &accel, double fact)
 		    tmp(i) = 0.0;		
 	    }	 
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getMass(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addM_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -801,7 +804,7 @@ FE_Element::addD_Force(const Vector &accel, double fact)
     if (myEle != 0) {    
 
 	// check for a quick return
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	    return;
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
@@ -815,7 +818,7 @@ FE_Element::addD_Force(const Vector &accel, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getDamp(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addD_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -851,7 +854,7 @@ FE_Element::addK_Force(const Vector &disp, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getTangentStiff(), tmp, fact) < 0){
+	    if (this->getResidualStorage()->addMatrixVector(1.0, this->getStiff(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addK_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -873,7 +876,7 @@ FE_Element::addKg_Force(const Vector &disp, double fact)
     if (myEle != 0) {    
 
 	// check for a quick return
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	    return;
 	if (myEle->isSubdomain() == false) {
 	    // get the components we need out of the vector
@@ -887,7 +890,7 @@ FE_Element::addKg_Force(const Vector &disp, double fact)
 		    tmp(i) = 0.0;		
 	    }	  
 		
-	    if (theResidual->addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact) < 0){
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getGeometricTangentStiff(), tmp, fact) < 0){
 		opserr << "WARNING FE_Element::addKg_Force() - ";
 		opserr << "- addMatrixVector returned error\n";		 
 	    }		
@@ -910,10 +913,10 @@ FE_Element::addLocalM_Force(const Vector &accel, double fact)
     if (myEle != 0) {    
 
 	// check for a quick return
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getMass(),
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getMass(),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalM_Force() - ";
@@ -937,10 +940,10 @@ FE_Element::addLocalD_Force(const Vector &accel, double fact)
     if (myEle != 0) {    
 
 	// check for a quick return
-	if (fact == 0.0) 
+	if (fact == 0.0 || myEle->isActive() == false) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getDamp(),
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getDamp(),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_Force() - ";
@@ -966,11 +969,111 @@ FE_Element::getElement(void)
 }
 
 
+bool
+FE_Element::isLinear(void)
+{
+  if (myEle == 0)
+    return false;
+
+  // an inactive element is not part of the linear base of the system
+  return myEle->isActive() && myEle->isLinear();
+}
+
+
+bool
+FE_Element::isRayleighSplit(void)
+{
+  if (myEle == 0 || myEle->isSubdomain() == true)
+    return false;
+
+  // whether the damping is Rayleigh alone does not change, the element is
+  // asked the first time
+  if (rayleighSplit == -1)
+    rayleighSplit = (myEle->hasRayleighDampingOnly() == true) ? 1 : 0;
+
+  return rayleighSplit == 1 && myEle->isActive();
+}
+
+const Matrix &
+FE_Element::getConstantTangent(double fC, double fM)
+{
+  Matrix *theMatrix = this->getTangentStorage();
+  theMatrix->Zero();
+
+  double alphaM, betaK, betaK0, betaKc;
+  myEle->getRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+
+  double factM = fM + fC*alphaM;
+  if (factM != 0.0)
+    theMatrix->addMatrix(1.0, myEle->getMass(), factM);
+  if (fC*betaK0 != 0.0)
+    theMatrix->addMatrix(1.0, myEle->getInitialStiff(), fC*betaK0);
+
+  return *theMatrix;
+}
+
+void
+FE_Element::addKtAndVaryingCtoTang(double fK, double fC, bool initial)
+{
+  double alphaM, betaK, betaK0, betaKc;
+  myEle->getRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+
+  Matrix *theMatrix = this->getTangentStorage();
+
+  // the current tangent is formed once for both the stiffness and damping
+  if (initial == false) {
+    if (fK + fC*betaK != 0.0)
+      theMatrix->addMatrix(1.0, this->getStiff(), fK + fC*betaK);
+  } else {
+    this->addKiToTang(fK);
+    if (fC*betaK != 0.0)
+      theMatrix->addMatrix(1.0, myEle->getTangentStiff(), fC*betaK);
+  }
+
+  const Matrix *Kc = myEle->getCommittedStiff();
+  if (fC*betaKc != 0.0 && Kc != 0)
+    theMatrix->addMatrix(1.0, *Kc, fC*betaKc);
+}
+
+bool
+FE_Element::isDirect(void)
+{
+  return myEle != 0 && myEle->isSubdomain() == false;
+}
+
+const Matrix &
+FE_Element::getTransientTangent(double fK, double fC, double fM, bool initial, bool split)
+{
+  Matrix *theMatrix = this->getTangentStorage();
+  theMatrix->Zero();
+
+  if (split == true && this->isRayleighSplit() == true) {
+    this->addKtAndVaryingCtoTang(fK, fC, initial);
+    return *theMatrix;
+  }
+
+  if (fK != 0.0) {
+    if (initial == false || myEle->isLinear() || myEle->isActive() == false)
+      theMatrix->addMatrix(1.0, this->getStiff(), fK);
+    else
+      theMatrix->addMatrix(1.0, myEle->getInitialStiff(), fK);
+  }
+
+  if (myEle->isActive() == true) {
+    if (fC != 0.0)
+      theMatrix->addMatrix(1.0, myEle->getDamp(), fC);
+    if (fM != 0.0)
+      theMatrix->addMatrix(1.0, myEle->getMass(), fM);
+  }
+
+  return *theMatrix;
+}
+
 // AddingSensitivity:BEGIN /////////////////////////////////
 void  
 FE_Element::addResistingForceSensitivity(int gradNumber, double fact)
 {
-  theResidual->addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
+  this->getResidualStorage()->addVector(1.0, myEle->getResistingForceSensitivity(gradNumber), -fact);
 }
 
 void  
@@ -988,7 +1091,7 @@ FE_Element::addM_ForceSensitivity(int gradNumber, const Vector &vect, double fac
       tmp(i) = 0.0;
     }
   }
-  if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
+  if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),tmp,fact) < 0) {
     opserr << "WARNING FE_Element::addM_ForceSensitivity() - ";
     opserr << "- addMatrixVector returned error\n";		 
   }
@@ -1013,7 +1116,7 @@ FE_Element::addD_ForceSensitivity(int gradNumber, const Vector &vect, double fac
 	else
 	  tmp(i) = 0.0;		
       }	
-      if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
+      if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber), tmp, fact) < 0){
 	opserr << "WARNING FE_Element::addD_ForceSensitivity() - ";
 	opserr << "- addMatrixVector returned error\n";		 
       }		
@@ -1038,7 +1141,7 @@ FE_Element::addLocalD_ForceSensitivity(int gradNumber, const Vector &accel, doub
 	if (fact == 0.0) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getDampSensitivity(gradNumber),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
@@ -1065,7 +1168,7 @@ FE_Element::addLocalM_ForceSensitivity(int gradNumber, const Vector &accel, doub
 	if (fact == 0.0) 
 	    return;
 	if (myEle->isSubdomain() == false) {
-	    if (theResidual->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),
+	    if (this->getResidualStorage()->addMatrixVector(1.0, myEle->getMassSensitivity(gradNumber),
 					     accel, fact) < 0){
 
 	      opserr << "WARNING FE_Element::addLocalD_ForceSensitivity() - ";
@@ -1101,7 +1204,7 @@ FE_Element::commitSensitivity(int gradNum, int numGrads)
 int  
 FE_Element::updateElement(void)
 {
-  if (myEle != 0) {
+  if (myEle != 0 && myEle->isActive() == true) {
     return myEle->update();
     opserr << "FE_Element::update()"; myEle->Print(opserr, 0);
   }
@@ -93,6 +93,27 @@ class FE_Element: public TaggedObject
     virtual const Vector &getLastResponse(void);
     Element *getElement(void);
 
+    // true while the tangent of the FE_Element does not change, i.e. that
+    // of a linear element added without transformation
+    virtual bool isLinear(void);
+
+    // the tangent of a transient integrator split into a constant part,
+    // fC (alphaM M + betaK0 K0) + fM M, formed once, and the part that
+    // varies, fK K + fC (betaK K + betaKc Kc) with K the current tangent or
+    // for initial the initial stiffness and betaK K still the current one;
+    // only for an active element whose damping is Rayleigh damping alone
+    virtual bool isRayleighSplit(void);
+    const Matrix &getConstantTangent(double fC, double fM);
+    void addKtAndVaryingCtoTang(double fK, double fC, bool initial = false);
+
+    // true if getTangent() forms the tangent of the element itself, so that
+    // getTransientTangent() may be called instead; that is fK K + fC C + fM M
+    // with K the current tangent or for initial the initial stiffness, and
+    // for split only the part that varies as in addKtAndVaryingCtoTang()
+    virtual bool isDirect(void);
+    const Matrix &getTransientTangent(double fK, double fC, double fM,
+				      bool initial, bool split);
+
     virtual void  Print(OPS_Stream&, int = 0) {return;};
 
     // AddingSensitivity:BEGIN ////////////////////////////////////
@@ -121,14 +142,17 @@ class FE_Element: public TaggedObject
     Vector *theResidual;
     Matrix *theTangent;
     Integrator *theIntegrator; // need for Subdomain
+    Matrix *theLinearK;        // stiffness kept for a linear element
+    int rayleighSplit;         // -1 until the element is asked
 
+    Matrix *getTangentStorage(void);
+    Vector *getResidualStorage(void);
+    const Matrix &getStiff(void);
     
     // static variables - single copy for all objects of the class	
     static Matrix errMatrix;
     static Vector errVector;
-    static Matrix **theMatrices; // array of pointers to class wide matrices
-    static Vector **theVectors;  // array of pointers to class widde vectors
-    static int numFEs;           // number of objects
+    static OPS_THREAD_LOCAL int numFEs;           // number of objects
     
 
 };
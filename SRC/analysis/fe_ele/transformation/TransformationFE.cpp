@@ -41,20 +41,30 @@
 #include <Matrix.h>
 #include <Vector.h>
 #include <TransformationConstraintHandler.h>
+#include <Workspace.h>
 
 #define MAX_NUM_DOF 64
 
-// static variables initialisation
-Matrix **TransformationFE::modMatrices; 
-Vector **TransformationFE::modVectors;  
-Matrix **TransformationFE::theTransformations; 
-int TransformationFE::numTransFE(0);           
-int TransformationFE::transCounter(0);           
-int TransformationFE::sizeTransformations(0);          
-double *TransformationFE::dataBuffer = 0;          
-double *TransformationFE::localKbuffer = 0;          
-int    *TransformationFE::dofData = 0;    ;          
-int TransformationFE::sizeBuffer(0);            
+// the storage used in transforming the tangent and residual; it is taken
+// from the Workspace of the calling thread, so that the FE_Elements can be
+// formed by the threads of the integrator concurrently
+struct TransformationFE_Buffers {
+  double dataBuffer[MAX_NUM_DOF*MAX_NUM_DOF];
+  double localKbuffer[MAX_NUM_DOF*MAX_NUM_DOF];
+  int dofData[MAX_NUM_DOF];
+  Matrix *theTransformations[MAX_NUM_DOF];
+};
+
+static char buffersKey;
+static char modTangentKey;
+static char modResidualKey;
+
+static TransformationFE_Buffers &
+getBuffers(void)
+{
+  int size = sizeof(TransformationFE_Buffers)/sizeof(double) + 1;
+  return *((TransformationFE_Buffers *)Workspace::getDoubles(&buffersKey, size));
+}
 
 //  TransformationFE(Element *, Integrator *theIntegrator);
 //	construictor that take the corresponding model element.
@@ -95,46 +105,11 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 	theDOFs[i] = theDofGroup;
     }
 
-    // see if theTransformation array is big enough
-    // if not delete the old and create a new one
-    if (numNodes > sizeTransformations) {
-	if (theTransformations != 0) 
-	    delete [] theTransformations;
-	
-	theTransformations = new Matrix *[numNodes];
-	if (theTransformations == 0) {
-	    opserr << "FATAL TransformationFE::TransformationFE() - out of memory ";
-	    opserr << "for array of pointers for Transformation matrices of size ";
-	    opserr << numNodes;
-	    exit(-1);
-	}		    
-	sizeTransformations = numNodes;
-    }	
-
-    // if this is the first element of this type create the arrays for 
-    // modified tangent and residual matrices
-    if (numTransFE == 0) {
-
-	modMatrices = new Matrix *[MAX_NUM_DOF+1];
-	modVectors  = new Vector *[MAX_NUM_DOF+1];
-	dataBuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	localKbuffer = new double[MAX_NUM_DOF*MAX_NUM_DOF];
-	dofData      = new int[MAX_NUM_DOF];
-	sizeBuffer = MAX_NUM_DOF*MAX_NUM_DOF;
-	
-	if (modMatrices == 0 || modVectors == 0 || dataBuffer == 0 ||
-	    localKbuffer == 0 || dofData == 0) {
-	    opserr << "TransformationFE::TransformationFE(Element *) ";
-	    opserr << " ran out of memory";	    
-	}
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    modMatrices[i] = 0;
-	    modVectors[i] = 0;
-	}
+    if (numNodes > MAX_NUM_DOF) {
+	opserr << "FATAL TransformationFE::TransformationFE() - element has more than ";
+	opserr << MAX_NUM_DOF << " nodes\n";
+	exit(-1);
     }
-
-    // increment the number of transformations
-    numTransFE++;
 }
 
 
@@ -145,51 +120,17 @@ TransformationFE::TransformationFE(int tag, Element *ele)
 TransformationFE::~TransformationFE()
 {
 
-    numTransFE--;
-    
     if (theDOFs != 0)
 	delete [] theDOFs;
     if (theSPs != 0)
 	delete [] theSPs;
 
-    int numDOF = 0;    
-    if (modID != 0)
-	numDOF = modID->Size();
-    
     if (modID != 0)
 	delete modID;
 
-    if (numDOF > MAX_NUM_DOF) {
-	// tangent and residual may have been  created specially
-	if (modTangent != 0) delete modTangent;
-	if (modResidual != 0) delete modResidual;
-    }
-
-    // if this is the last FE_Element, clean up the
-    // storage for the matrix and vector objects
-    if (numTransFE == 0) {
-	for (int i=0; i<MAX_NUM_DOF; i++) {
-	    if (modVectors[i] != 0)
-		delete modVectors[i];
-	    if (modMatrices[i] != 0)
-		delete modMatrices[i];
-	}
-	delete [] modMatrices;
-	delete [] modVectors;
-	delete [] theTransformations;
-	delete [] dataBuffer;
-	delete [] localKbuffer;
-	delete [] dofData;
-	modMatrices = 0;
-	modVectors = 0;
-	theTransformations = 0;
-	dataBuffer = 0;
-	localKbuffer = 0;
-	dofData = 0;
-	sizeTransformations = 0;
-	sizeBuffer = 0;
-	transCounter = 0;
-    }
+    // tangent and residual may have been created specially
+    if (modTangent != 0) delete modTangent;
+    if (modResidual != 0) delete modResidual;
 }    
 
 
@@ -252,26 +193,14 @@ TransformationFE::setID(void)
 	    }		
     }
     
-    // set the pointers to the modified tangent matrix and residual vector
-    if (numTransformedDOF <= MAX_NUM_DOF) {
-	// use class wide objects
-	if (modVectors[numTransformedDOF] == 0) {
-	    modVectors[numTransformedDOF] = new Vector(numTransformedDOF);
-	    modMatrices[numTransformedDOF] = new Matrix(numTransformedDOF,numTransformedDOF);
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	    if (modResidual == 0 || modResidual->Size() != numTransformedDOF ||	
-		modTangent == 0 || modTangent->noCols() != numTransformedDOF)	{  
-		opserr << "TransformationFE::setID() ";
-		opserr << " ran out of memory for vector/Matrix of size :";
-		opserr << numTransformedDOF << endln;
-		exit(-1);
-	    }
-	} else {
-	    modResidual = modVectors[numTransformedDOF];
-	    modTangent = modMatrices[numTransformedDOF];
-	}
-    } else {
+    // the modified tangent matrix and residual vector are taken from the
+    // Workspace, see getModTangent(), unless the element is too large
+    if (modTangent != 0) delete modTangent;
+    if (modResidual != 0) delete modResidual;
+    modTangent = 0;
+    modResidual = 0;
+
+    if (numTransformedDOF > MAX_NUM_DOF) {
 	// create matrices and vectors for each object instance
 	modResidual = new Vector(numTransformedDOF);
 	modTangent = new Matrix(numTransformedDOF, numTransformedDOF);
@@ -288,102 +217,37 @@ TransformationFE::setID(void)
     return 0;
 }
 
+// the modified tangent and residual: unless created for the object by
+// setID(), the Workspace storage of the calling thread for the size, valid
+// until the thread forms another TransformationFE of the same size
+
+Matrix &
+TransformationFE::getModTangent(void)
+{
+    if (modTangent != 0)
+	return *modTangent;
+    return Workspace::getMatrix(&modTangentKey, numTransformedDOF, numTransformedDOF);
+}
+
+Vector &
+TransformationFE::getModResidual(void)
+{
+    if (modResidual != 0)
+	return *modResidual;
+    return Workspace::getVector(&modResidualKey, numTransformedDOF);
+}
+
 const Matrix &
 TransformationFE::getTangent(Integrator *theNewIntegrator)
 {
+    Matrix &theModTangent = this->getModTangent();
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
 
-    static ID numDOFs(dofData, 1);
-    numDOFs.setData(dofData, numGroups);
-    
     // DO THE SP STUFF TO THE TANGENT 
     
-    // get the transformation matrix from each dof group & number of local dof
-    // for original node.
-    int numNode = numGroups;
-    for (int a = 0; a<numNode; a++) {
-      Matrix *theT = theDOFs[a]->getT();
-      theTransformations[a] = theT;
-      if (theT != 0)
-	numDOFs[a] = theT->noRows(); // T^ 
-      else
-	numDOFs[a] = theDOFs[a]->getNumDOF();
-    }
-
-    // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-    // where blocks are of size equal to num ele dof at a node
-
-    int startRow = 0;
-    int noRowsTransformed = 0;
-    int noRowsOriginal = 0;
-
-    static Matrix localK;
-
-    // foreach block row, for each block col do
-    for (int i=0; i<numNode; i++) {
-
-	int startCol = 0;
-	int numDOFi = numDOFs[i];	
-	int noColsOriginal = 0;
+    this->transformTangent(theTangent);
 
-	for (int j=0; j<numNode; j++) {
-
-	    const Matrix *Ti = theTransformations[i];
-	    const Matrix *Tj = theTransformations[j];
-	    int numDOFj = numDOFs[j];	
-	    localK.setData(localKbuffer, numDOFi, numDOFj);
-
-	    // copy K(i,j) into localK matrix
-	    // CHECK SIZE OF BUFFFER	    
-	    for (int a=0; a<numDOFi; a++)
-		for (int b=0; b<numDOFj; b++)
-		    localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-
-	    // now perform the matrix computation T(i)^T localK T(j)
-	    // note: if T == 0 then the Identity is assumed
-	    int noColsTransformed = 0;
-	    static Matrix localTtKT;
-	    
-	    if (Ti != 0 && Tj != 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK * (*Tj);
-		localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-	    } else if (Ti == 0 && Tj != 0) {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = Tj->noCols();
-		// CHECK SIZE OF BUFFFER
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		// localTtKT = localK * (*Tj);	       
-		localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-	    } else if (Ti != 0 && Tj == 0) {
-		noRowsTransformed = Ti->noCols();
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		//localTtKT = (*Ti) ^ localK;
-		localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-	    } else {
-		noRowsTransformed = numDOFi;
-		noColsTransformed = numDOFj;
-		localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-		localTtKT = localK;
-	    }
-	    // now copy into modTangent the T(i)^t K(i,j) T(j) product
-	    for (int c=0; c<noRowsTransformed; c++) 
-		for (int d=0; d<noColsTransformed; d++) 
-		    (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-	    
-	    startCol += noColsTransformed;
-	    noColsOriginal += numDOFj;
-	}
-
-	noRowsOriginal += numDOFi;
-	startRow += noRowsTransformed;
-    }
-
-    return *modTangent;
+    return theModTangent;
 }
 
 
@@ -391,6 +255,7 @@ const Vector &
 TransformationFE::getResidual(Integrator *theNewIntegrator)
 
 {
+    Vector &theModResidual = this->getModResidual();
     const Vector &theResidual = this->FE_Element::getResidual(theNewIntegrator);
     // DO THE SP STUFF TO THE TANGENT
     
@@ -425,20 +290,20 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 	    double sum = 0.0;
 	    for (int k=0; k<noCols; k++)
 	      sum += (*Ti)(k,j) * theResidual(startRowOriginal + k);
-	    (*modResidual)(startRowTransformed +j) = sum;
+	    theModResidual(startRowTransformed +j) = sum;
 	  }
 
 	} else {
 	  noCols = theDOFs[i]->getNumDOF();
 	  noRows = noCols;
 	  for (int j=0; j<noRows; j++)
-	    (*modResidual)(startRowTransformed +j) = theResidual(startRowOriginal + j);
+	    theModResidual(startRowTransformed +j) = theResidual(startRowOriginal + j);
 	}
 	startRowTransformed += noRows;
 	startRowOriginal += noCols;
     }
 
-    return *modResidual;
+    return theModResidual;
 }
 
 
@@ -447,108 +312,22 @@ TransformationFE::getResidual(Integrator *theNewIntegrator)
 const Vector &
 TransformationFE::getTangForce(const Vector &disp, double fact)
 {
+    Vector &theModResidual = this->getModResidual();
     opserr << "TransformationFE::getTangForce() - not yet implemented\n";
-    modResidual->Zero();
-    return *modResidual;
+    theModResidual.Zero();
+    return theModResidual;
 }
 
 const Vector &
 TransformationFE::getK_Force(const Vector &accel, double fact)
 {
+  Matrix &theModTangent = this->getModTangent();
+  Vector &theModResidual = this->getModResidual();
   this->FE_Element::zeroTangent();    
   this->FE_Element::addKtToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
-    
-  // DO THE SP STUFF TO THE TANGENT 
-  
-  // get the transformation matrix from each dof group & number of local dof
-  // for original node.
-  int numNode = numGroups;
-  for (int a = 0; a<numNode; a++) {
-    Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
-    if (theT != 0)
-      numDOFs[a] = theT->noRows(); // T^ 
-    else
-      numDOFs[a] = theDOFs[a]->getNumDOF();
-  }
-  
-  // perform Tt K T -- as T is block diagonal do T(i)^T K(i,j) T(j)
-  // where blocks are of size equal to num ele dof at a node
-  
-  int startRow = 0;
-  int noRowsTransformed = 0;
-  int noRowsOriginal = 0;
-  
-  static Matrix localK;
-  
-  // foreach block row, for each block col do
-  for (int i=0; i<numNode; i++) {
-    
-    int startCol = 0;
-    int numDOFi = numDOFs[i];	
-    int noColsOriginal = 0;
-    
-    for (int j=0; j<numNode; j++) {
-      
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
-      int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
-      
-      // copy K(i,j) into localK matrix
-      // CHECK SIZE OF BUFFFER	    
-      for (int a=0; a<numDOFi; a++)
-	for (int b=0; b<numDOFj; b++)
-	  localK(a,b) = theTangent(noRowsOriginal+a, noColsOriginal+b);
-      
-      // now perform the matrix computation T(i)^T localK T(j)
-      // note: if T == 0 then the Identity is assumed
-      int noColsTransformed = 0;
-      static Matrix localTtKT;
-      
-      if (Ti != 0 && Tj != 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK * (*Tj);
-	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
-      } else if (Ti == 0 && Tj != 0) {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = Tj->noCols();
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	// localTtKT = localK * (*Tj);	       
-	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
-      } else if (Ti != 0 && Tj == 0) {
-	noRowsTransformed = Ti->noCols();
-	noColsTransformed = numDOFj;
-	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	//localTtKT = (*Ti) ^ localK;
-	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
-      } else {
-	noRowsTransformed = numDOFi;
-	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
-	localTtKT = localK;
-      }
-      // now copy into modTangent the T(i)^t K(i,j) T(j) product
-      for (int c=0; c<noRowsTransformed; c++) 
-	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
-      
-      startCol += noColsTransformed;
-      noColsOriginal += numDOFj;
-    }
-    
-    noRowsOriginal += numDOFi;
-    startRow += noRowsTransformed;
-  }
+  this->transformTangent(theTangent);
   
   // get the components we need out of the vector
   // and place in a temporary vector
@@ -561,21 +340,24 @@ TransformationFE::getK_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  theModResidual.addMatrixVector(0.0, theModTangent, tmp, 1.0);
 
-  return *modResidual;
+  return theModResidual;
 }
 
 
 const Vector &
 TransformationFE::getKi_Force(const Vector &accel, double fact)
 {
+  Matrix &theModTangent = this->getModTangent();
+  Vector &theModResidual = this->getModResidual();
+  TransformationFE_Buffers &theBuffers = getBuffers();
   this->FE_Element::zeroTangent();    
   this->FE_Element::addKiToTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  ID numDOFs(theBuffers.dofData, 1);
+  numDOFs.setData(theBuffers.dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -584,7 +366,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   int numNode = numGroups;
   for (int a = 0; a<numNode; a++) {
     Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
+    theBuffers.theTransformations[a] = theT;
     if (theT != 0)
       numDOFs[a] = theT->noRows(); // T^ 
     else
@@ -598,7 +380,7 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -609,10 +391,10 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
     
     for (int j=0; j<numNode; j++) {
       
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
+      const Matrix *Ti = theBuffers.theTransformations[i];
+      const Matrix *Tj = theBuffers.theTransformations[j];
       int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
+      localK.setData(theBuffers.localKbuffer, numDOFi, numDOFj);
       
       // copy K(i,j) into localK matrix
       // CHECK SIZE OF BUFFFER	    
@@ -623,39 +405,39 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
 	noColsTransformed = Tj->noCols();
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	//localTtKT = (*Ti) ^ localK * (*Tj);
 	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
       } else if (Ti == 0 && Tj != 0) {
 	noRowsTransformed = numDOFi;
 	noColsTransformed = Tj->noCols();
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	// localTtKT = localK * (*Tj);	       
 	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
       } else if (Ti != 0 && Tj == 0) {
 	noRowsTransformed = Ti->noCols();
 	noColsTransformed = numDOFj;
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	//localTtKT = (*Ti) ^ localK;
 	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
       } else {
 	noRowsTransformed = numDOFi;
 	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	localTtKT = localK;
       }
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  theModTangent(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -676,20 +458,23 @@ TransformationFE::getKi_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  theModResidual.addMatrixVector(0.0, theModTangent, tmp, 1.0);
 
-  return *modResidual;
+  return theModResidual;
 }
 
 const Vector &
 TransformationFE::getM_Force(const Vector &accel, double fact)
 {
+  Matrix &theModTangent = this->getModTangent();
+  Vector &theModResidual = this->getModResidual();
+  TransformationFE_Buffers &theBuffers = getBuffers();
   this->FE_Element::zeroTangent();    
   this->FE_Element::addMtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  ID numDOFs(theBuffers.dofData, 1);
+  numDOFs.setData(theBuffers.dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -698,7 +483,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   int numNode = numGroups;
   for (int a = 0; a<numNode; a++) {
     Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
+    theBuffers.theTransformations[a] = theT;
     if (theT != 0)
       numDOFs[a] = theT->noRows(); // T^ 
     else
@@ -712,7 +497,7 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -723,10 +508,10 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
     
     for (int j=0; j<numNode; j++) {
       
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
+      const Matrix *Ti = theBuffers.theTransformations[i];
+      const Matrix *Tj = theBuffers.theTransformations[j];
       int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
+      localK.setData(theBuffers.localKbuffer, numDOFi, numDOFj);
       
       // copy K(i,j) into localK matrix
       // CHECK SIZE OF BUFFFER	    
@@ -737,39 +522,39 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
 	noColsTransformed = Tj->noCols();
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	//localTtKT = (*Ti) ^ localK * (*Tj);
 	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
       } else if (Ti == 0 && Tj != 0) {
 	noRowsTransformed = numDOFi;
 	noColsTransformed = Tj->noCols();
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	// localTtKT = localK * (*Tj);	       
 	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
       } else if (Ti != 0 && Tj == 0) {
 	noRowsTransformed = Ti->noCols();
 	noColsTransformed = numDOFj;
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	//localTtKT = (*Ti) ^ localK;
 	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
       } else {
 	noRowsTransformed = numDOFi;
 	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	localTtKT = localK;
       }
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  theModTangent(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -790,20 +575,23 @@ TransformationFE::getM_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  theModResidual.addMatrixVector(0.0, theModTangent, tmp, 1.0);
 
-  return *modResidual;
+  return theModResidual;
 }
 
 const Vector &
 TransformationFE::getC_Force(const Vector &accel, double fact)
 {
+  Matrix &theModTangent = this->getModTangent();
+  Vector &theModResidual = this->getModResidual();
+  TransformationFE_Buffers &theBuffers = getBuffers();
   this->FE_Element::zeroTangent();    
   this->FE_Element::addCtoTang();    
   const Matrix &theTangent = this->FE_Element::getTangent(0);
 
-  static ID numDOFs(dofData, 1);
-  numDOFs.setData(dofData, numGroups);
+  ID numDOFs(theBuffers.dofData, 1);
+  numDOFs.setData(theBuffers.dofData, numGroups);
     
   // DO THE SP STUFF TO THE TANGENT 
   
@@ -812,7 +600,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   int numNode = numGroups;
   for (int a = 0; a<numNode; a++) {
     Matrix *theT = theDOFs[a]->getT();
-    theTransformations[a] = theT;
+    theBuffers.theTransformations[a] = theT;
     if (theT != 0)
       numDOFs[a] = theT->noRows(); // T^ 
     else
@@ -826,7 +614,7 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
   int noRowsTransformed = 0;
   int noRowsOriginal = 0;
   
-  static Matrix localK;
+  Matrix localK;
   
   // foreach block row, for each block col do
   for (int i=0; i<numNode; i++) {
@@ -837,10 +625,10 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
     
     for (int j=0; j<numNode; j++) {
       
-      const Matrix *Ti = theTransformations[i];
-      const Matrix *Tj = theTransformations[j];
+      const Matrix *Ti = theBuffers.theTransformations[i];
+      const Matrix *Tj = theBuffers.theTransformations[j];
       int numDOFj = numDOFs[j];	
-      localK.setData(localKbuffer, numDOFi, numDOFj);
+      localK.setData(theBuffers.localKbuffer, numDOFi, numDOFj);
       
       // copy K(i,j) into localK matrix
       // CHECK SIZE OF BUFFFER	    
@@ -851,39 +639,39 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       // now perform the matrix computation T(i)^T localK T(j)
       // note: if T == 0 then the Identity is assumed
       int noColsTransformed = 0;
-      static Matrix localTtKT;
+      Matrix localTtKT;
       
       if (Ti != 0 && Tj != 0) {
 	noRowsTransformed = Ti->noCols();
 	noColsTransformed = Tj->noCols();
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	//localTtKT = (*Ti) ^ localK * (*Tj);
 	localTtKT.addMatrixTripleProduct(0.0, *Ti, localK, *Tj, 1.0);
       } else if (Ti == 0 && Tj != 0) {
 	noRowsTransformed = numDOFi;
 	noColsTransformed = Tj->noCols();
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	// localTtKT = localK * (*Tj);	       
 	localTtKT.addMatrixProduct(0.0, localK, *Tj, 1.0);
       } else if (Ti != 0 && Tj == 0) {
 	noRowsTransformed = Ti->noCols();
 	noColsTransformed = numDOFj;
 	// CHECK SIZE OF BUFFFER
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	//localTtKT = (*Ti) ^ localK;
 	localTtKT.addMatrixTransposeProduct(0.0, *Ti, localK, 1.0);
       } else {
 	noRowsTransformed = numDOFi;
 	noColsTransformed = numDOFj;
-	localTtKT.setData(dataBuffer, noRowsTransformed, noColsTransformed);
+	localTtKT.setData(theBuffers.dataBuffer, noRowsTransformed, noColsTransformed);
 	localTtKT = localK;
       }
       // now copy into modTangent the T(i)^t K(i,j) T(j) product
       for (int c=0; c<noRowsTransformed; c++) 
 	for (int d=0; d<noColsTransformed; d++) 
-	  (*modTangent)(startRow+c, startCol+d) = localTtKT(c,d);
+	  theModTangent(startRow+c, startCol+d) = localTtKT(c,d);
       
       startCol += noColsTransformed;
       noColsOriginal += numDOFj;
@@ -904,49 +692,53 @@ TransformationFE::getC_Force(const Vector &accel, double fact)
       tmp(j) = 0.0;
   }
 
-  modResidual->addMatrixVector(0.0, *modTangent, tmp, 1.0);
+  theModResidual.addMatrixVector(0.0, theModTangent, tmp, 1.0);
 
-  return *modResidual;
+  return theModResidual;
 }
 
 
 void  
 TransformationFE::addD_Force(const Vector &disp,  double fact)
 {
+    Vector &theModResidual = this->getModResidual();
+    TransformationFE_Buffers &theBuffers = getBuffers();
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response;
+    response.setData(theBuffers.dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    theModResidual(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    theModResidual(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(theModResidual, response);
     this->addLocalD_Force(response, fact);
 }   	 
 
 void  
 TransformationFE::addM_Force(const Vector &disp,  double fact)
 {
+    Vector &theModResidual = this->getModResidual();
+    TransformationFE_Buffers &theBuffers = getBuffers();
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response;
+    response.setData(theBuffers.dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    theModResidual(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    theModResidual(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(theModResidual, response);
     this->addLocalM_Force(response, fact);
 }   	 
 
@@ -956,24 +748,131 @@ TransformationFE::addM_Force(const Vector &disp,  double fact)
 const Vector &
 TransformationFE::getLastResponse(void)
 {
+    Vector &theModResidual = this->getModResidual();
     Integrator *theLastIntegrator = this->getLastIntegrator();
     if (theLastIntegrator != 0) {
-	if (theLastIntegrator->getLastResponse(*modResidual,*modID) < 0) {
+	if (theLastIntegrator->getLastResponse(theModResidual,*modID) < 0) {
 	    opserr << "WARNING TransformationFE::getLastResponse(void)";
 	    opserr << " - the Integrator had problems with getLastResponse()\n";
 	}
     }
     else {
-	modResidual->Zero();
+	theModResidual.Zero();
 	opserr << "WARNING  TransformationFE::getLastResponse()";
 	opserr << " No Integrator yet passed\n";
     }
     
-    Vector &result = *modResidual;
+    Vector &result = theModResidual;
     return result;
 }
 
 
+// forms modTangent = T^t K T; as T is block diagonal this is done as
+// T(i)^t K(i,j) T(j), where blocks are of size equal to num ele dof at a
+// node. The T(i) are sparse, a unit column for each unconstrained dof and
+// the constraint matrix for the retained dof, so only their nonzero
+// entries are used, and the blocks of nodes without T are copied.
+void
+TransformationFE::transformTangent(const Matrix &theTangent)
+{
+    Matrix &theModTangent = this->getModTangent();
+    TransformationFE_Buffers &theBuffers = getBuffers();
+
+    // get the transformation matrix from each dof group & number of local dof
+    // for original node.
+    int numNode = numGroups;
+    int *numDOFs = theBuffers.dofData;
+    for (int a = 0; a<numNode; a++) {
+      Matrix *theT = theDOFs[a]->getT();
+      theBuffers.theTransformations[a] = theT;
+      if (theT != 0)
+	numDOFs[a] = theT->noRows(); // T^ 
+      else
+	numDOFs[a] = theDOFs[a]->getNumDOF();
+    }
+
+    // K(i,j) T(j), stored by columns
+    double *KTj = theBuffers.localKbuffer;
+
+    int startRow = 0;
+    int noRowsOriginal = 0;
+
+    // foreach block row, for each block col do
+    for (int i=0; i<numNode; i++) {
+
+	const Matrix *Ti = theBuffers.theTransformations[i];
+	int numDOFi = numDOFs[i];
+	int noRowsTransformed = (Ti != 0) ? Ti->noCols() : numDOFi;
+
+	int startCol = 0;
+	int noColsOriginal = 0;
+
+	for (int j=0; j<numNode; j++) {
+
+	    const Matrix *Tj = theBuffers.theTransformations[j];
+	    int numDOFj = numDOFs[j];
+	    int noColsTransformed = (Tj != 0) ? Tj->noCols() : numDOFj;
+
+	    if (Ti == 0 && Tj == 0) {
+		// neither node is transformed, copy K(i,j)
+		for (int c=0; c<numDOFi; c++)
+		    for (int d=0; d<numDOFj; d++)
+			theModTangent(startRow+c, startCol+d) = 
+			    theTangent(noRowsOriginal+c, noColsOriginal+d);
+
+		startCol += noColsTransformed;
+		noColsOriginal += numDOFj;
+		continue;
+	    }
+
+	    // KTj = K(i,j) T(j), note: if T == 0 then the Identity is assumed
+	    if (Tj != 0) {
+		for (int e=0; e<numDOFi*noColsTransformed; e++)
+		    KTj[e] = 0.0;
+		for (int b=0; b<numDOFj; b++)
+		    for (int d=0; d<noColsTransformed; d++) {
+			double t = (*Tj)(b,d);
+			if (t == 0.0)
+			    continue;
+			double *KTjd = &KTj[d*numDOFi];
+			for (int a=0; a<numDOFi; a++)
+			    KTjd[a] += theTangent(noRowsOriginal+a, noColsOriginal+b) * t;
+		    }
+	    } else {
+		for (int d=0; d<noColsTransformed; d++)
+		    for (int a=0; a<numDOFi; a++)
+			KTj[d*numDOFi+a] = theTangent(noRowsOriginal+a, noColsOriginal+d);
+	    }
+
+	    // now copy into modTangent the T(i)^t KTj product
+	    if (Ti != 0) {
+		for (int c=0; c<noRowsTransformed; c++) 
+		    for (int d=0; d<noColsTransformed; d++) 
+			theModTangent(startRow+c, startCol+d) = 0.0;
+		for (int a=0; a<numDOFi; a++)
+		    for (int c=0; c<noRowsTransformed; c++) {
+			double t = (*Ti)(a,c);
+			if (t == 0.0)
+			    continue;
+			for (int d=0; d<noColsTransformed; d++) 
+			    theModTangent(startRow+c, startCol+d) += t * KTj[d*numDOFi+a];
+		    }
+	    } else {
+		for (int c=0; c<noRowsTransformed; c++) 
+		    for (int d=0; d<noColsTransformed; d++) 
+			theModTangent(startRow+c, startCol+d) = KTj[d*numDOFi+c];
+	    }
+	    
+	    startCol += noColsTransformed;
+	    noColsOriginal += numDOFj;
+	}
+
+	noRowsOriginal += numDOFi;
+	startRow += noRowsTransformed;
+    }
+}
+
+
 int 
 TransformationFE::transformResponse(const Vector &modResp, 
 				    Vector &unmodResp)
@@ -1016,40 +915,44 @@ TransformationFE::transformResponse(const Vector &modResp,
 void  
 TransformationFE::addD_ForceSensitivity(int gradNumber, const Vector &disp,  double fact)
 {
+    Vector &theModResidual = this->getModResidual();
+    TransformationFE_Buffers &theBuffers = getBuffers();
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response;
+    response.setData(theBuffers.dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    theModResidual(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    theModResidual(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(theModResidual, response);
     this->addLocalD_ForceSensitivity(gradNumber, response, fact);
 }   	 
 
 void  
 TransformationFE::addM_ForceSensitivity(int gradNumber, const Vector &disp,  double fact)
 {
+    Vector &theModResidual = this->getModResidual();
+    TransformationFE_Buffers &theBuffers = getBuffers();
     if (fact == 0.0)
 	return;
 
-    static Vector response;
-    response.setData(dataBuffer, numOriginalDOF);
+    Vector response;
+    response.setData(theBuffers.dataBuffer, numOriginalDOF);
 		    
     for (int i=0; i<numTransformedDOF; i++) {
 	int loc = (*modID)(i);
 	if (loc >= 0)
-	    (*modResidual)(i) = disp(loc);
+	    theModResidual(i) = disp(loc);
 	else
-	    (*modResidual)(i) = 0.0;
+	    theModResidual(i) = 0.0;
     }
-    transformResponse(*modResidual, response);
+    transformResponse(theModResidual, response);
     this->addLocalM_ForceSensitivity(gradNumber, response, fact);
 }   	 
 
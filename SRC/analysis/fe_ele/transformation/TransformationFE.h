@@ -55,6 +55,9 @@ class TransformationFE: public FE_Element
     
     // methods to form and obtain the tangent and residual
     virtual const Matrix &getTangent(Integrator *theIntegrator);
+    virtual bool isLinear(void) {return false;}
+    virtual bool isRayleighSplit(void) {return false;}
+    virtual bool isDirect(void) {return false;}
     virtual const Vector &getResidual(Integrator *theIntegrator);
     
     // methods for ele-by-ele strategies
@@ -77,6 +80,7 @@ class TransformationFE: public FE_Element
     
   protected:
     int transformResponse(const Vector &modResponse, Vector &unmodResponse);
+    void transformTangent(const Matrix &theTangent);
     
   private:
     
@@ -85,23 +89,14 @@ class TransformationFE: public FE_Element
     int numSPs;
     SP_Constraint **theSPs;
     ID *modID;
-    Matrix *modTangent;
+    Matrix *modTangent;   // 0 unless larger than MAX_NUM_DOF, see getModTangent()
     Vector *modResidual;
     int numGroups;
     int numTransformedDOF;
     int numOriginalDOF;
-    
-    // static variables - single copy for all objects of the class	
-    static Matrix **modMatrices; // array of pointers to class wide matrices
-    static Vector **modVectors;  // array of pointers to class widde vectors
-    static Matrix **theTransformations; // for holding pointers to the T matrices
-    static int numTransFE;     // number of objects    
-    static int transCounter;   // a counter used to indicate when to do something
-    static int sizeTransformations; // size of theTransformations array
-    static double *dataBuffer;
-    static double *localKbuffer;
-    static int    *dofData;
-    static int sizeBuffer;
+
+    Matrix &getModTangent(void);
+    Vector &getModResidual(void);
 };
 
 #endif
@@ -53,6 +53,8 @@
 #include <FEM_ObjectBroker.h>
 #include <TransformationDOF_Group.h>
 #include <TransformationFE.h>
+#include <map>
+#include <set>
 
 void* OPS_TransformationConstraintHandler()
 {
@@ -101,12 +103,18 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	numSPConstraints++;
     
     numDOF = 0;
-    ID transformedNode(0, 64);
 
     int i;
     
-    // create an ID of constrained node tags in MP_Constraints
-    ID constrainedNodesMP(0, numMPConstraints);
+    // the constrained nodes are looked up in maps from the node tag to
+    // the (first) constraint on the node, the further SP_Constraints on
+    // a node follow in nextSP; a linear search of the constraints for
+    // each node and element is quadratic in large constrained models
+    std::map<int, int> firstMP;
+    std::map<int, int> firstSP, lastSP;
+    std::map<int, int>::iterator theLoc;
+    ID nextSP(numSPConstraints);
+
     MP_Constraint **mps =0;
     if (numMPConstraints != 0) {
 	mps = new MP_Constraint *[numMPConstraints];
@@ -121,16 +129,15 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int index = 0;
 	while ((theMP = theMPs()) != 0) {
 	  int nodeConstrained = theMP->getNodeConstrained();
-	  if (transformedNode.getLocation(nodeConstrained) < 0)
-	    transformedNode[numDOF++] = nodeConstrained;
-	  constrainedNodesMP[index] = nodeConstrained;
+	  if (firstMP.find(nodeConstrained) == firstMP.end())
+	    firstMP[nodeConstrained] = index;
 	  mps[index] = theMP;
 	  index++;
 	}	
     }
+    numDOF = firstMP.size();
 
-    // create an ID of constrained node tags in SP_Constraints
-    ID constrainedNodesSP(0, numSPConstraints);;
+    // and the SP_Constraints
     SP_Constraint **sps =0;
     if (numSPConstraints != 0) {
 	sps = new SP_Constraint *[numSPConstraints];
@@ -147,9 +154,17 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int index = 0;
 	while ((theSP = theSPs()) != 0) {
 	  int constrainedNode = theSP->getNodeTag();
-	  if (transformedNode.getLocation(constrainedNode) < 0)
-	    transformedNode[numDOF++] = constrainedNode;	    
-	  constrainedNodesSP[index] = constrainedNode;
+	  nextSP[index] = -1;
+	  theLoc = lastSP.find(constrainedNode);
+	  if (theLoc == lastSP.end()) {
+	    firstSP[constrainedNode] = index;
+	    lastSP[constrainedNode] = index;
+	    if (firstMP.find(constrainedNode) == firstMP.end())
+	      numDOF++;
+	  } else {
+	    nextSP[theLoc->second] = index;
+	    theLoc->second = index;
+	  }
 	  sps[index] = theSP;
 	  index++;
 	}	
@@ -184,8 +199,9 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int loc = -1;
 	int createdDOF = 0;
 
-	loc = constrainedNodesMP.getLocation(nodeTag);
-	if (loc >= 0) {
+	theLoc = firstMP.find(nodeTag);
+	if (theLoc != firstMP.end()) {
+	  loc = theLoc->second;
 
 	  TransformationDOF_Group *tDofPtr = 
 	    new TransformationDOF_Group(numDofGrp++, nodPtr, mps[loc], this); 
@@ -195,13 +211,10 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	  
 	  // add any SPs
 	  if (numSPConstraints != 0) {
-	    loc = constrainedNodesSP.getLocation(nodeTag);
-	    if (loc >= 0) {
-	      tDofPtr->addSP_Constraint(*(sps[loc]));
-	      for (int i = loc+1; i<numSPConstraints; i++) {
-		if (constrainedNodesSP(i) == nodeTag)
-		  tDofPtr->addSP_Constraint(*(sps[i]));
-	      }
+	    theLoc = firstSP.find(nodeTag);
+	    if (theLoc != firstSP.end()) {
+	      for (loc = theLoc->second; loc >= 0; loc = nextSP(loc))
+		tDofPtr->addSP_Constraint(*(sps[loc]));
 	    }
 	    // add the DOF to the array	    
 	    theDOFs[numDOF++] = dofPtr;	    	    
@@ -210,8 +223,9 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	}
 	
 	if (createdDOF == 0) {
-	  loc = constrainedNodesSP.getLocation(nodeTag);
-	  if (loc >= 0) {
+	  theLoc = firstSP.find(nodeTag);
+	  if (theLoc != firstSP.end()) {
+	    loc = theLoc->second;
 	    TransformationDOF_Group *tDofPtr = 
 	      new TransformationDOF_Group(numDofGrp++, nodPtr, this);
 
@@ -220,12 +234,10 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	    dofPtr = tDofPtr;
 	    tDofPtr->addSP_Constraint(*(sps[loc]));
 	
-	    // check for more SP_constraints acting on node and add them
-	    for (int i = loc+1; i<numSPConstraints; i++) {
-	      if (constrainedNodesSP(i) == nodeTag) {
-		tDofPtr->addSP_Constraint(*(sps[i]));
-		numSPs++;
-	      }
+	    // add the further SP_constraints acting on node
+	    for (loc = nextSP(loc); loc >= 0; loc = nextSP(loc)) {
+	      tDofPtr->addSP_Constraint(*(sps[loc]));
+	      numSPs++;
 	    }
 	    // add the DOF to the array
 	    theDOFs[numDOF++] = dofPtr;	    	    
@@ -261,7 +273,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
     FE_Element *fePtr;
 
     numFE = 0;
-    ID transformedEle(0, 64);
+    std::set<int> transformedEle;
 
     while ((elePtr = theEle()) != 0) {
       int flag = 0;
@@ -278,24 +290,16 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	int isConstrainedNode = 0;
 	for (int i=0; i<nodesSize; i++) {
 	  int nodeTag = nodes(i);
-	  if (numMPConstraints != 0) {
-	    int loc = constrainedNodesMP.getLocation(nodeTag);
-	    if (loc >= 0) {
-	      isConstrainedNode = 1;
-	      i = nodesSize;
-	    }
-	  } 
-	  if (numSPConstraints != 0 && isConstrainedNode == 0) {
-	    int loc = constrainedNodesSP.getLocation(nodeTag);
-	    if (loc >= 0) {
-	      isConstrainedNode = 1;		    
-	      i = nodesSize;
-	    }
+	  if (firstMP.find(nodeTag) != firstMP.end() ||
+	      firstSP.find(nodeTag) != firstSP.end()) {
+	    isConstrainedNode = 1;
+	    i = nodesSize;
 	  }
 	}
 	
 	if (isConstrainedNode == 1) {
-	  transformedEle[numFE++] = elePtr->getTag();
+	  transformedEle.insert(elePtr->getTag());
+	  numFE++;
 	}
       }
     }
@@ -322,7 +326,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	Subdomain *theSub = (Subdomain *)elePtr;
 	if (theSub->doesIndependentAnalysis() == false) {
 	  
-	  if (transformedEle.getLocation(tag) < 0) {
+	  if (transformedEle.find(tag) == transformedEle.end()) {
 	    if ((fePtr = new FE_Element(numFeEle, elePtr)) == 0) {
 	      opserr << "WARNING TransformationConstraintHandler::handle()";
 	      opserr << " - ran out of memory";
@@ -348,7 +352,7 @@ TransformationConstraintHandler::handle(const ID *nodesLast)
 	  theSub->setFE_ElementPtr(fePtr);
 	}
       } else {
-	if (transformedEle.getLocation(tag) < 0) {
+	if (transformedEle.find(tag) == transformedEle.end()) {
 	  if ((fePtr = new FE_Element(numFeEle, elePtr)) == 0) {
 	    opserr << "WARNING TransformationConstraintHandler::handle()";
 	    opserr << " - ran out of memory";
@@ -39,6 +39,7 @@
 #include <AnalysisModel.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <RealTimeMonitor.h>
 #include <elementAPI.h>
 #define OPS_Export
 
@@ -49,37 +50,57 @@ void *    OPS_AlphaOS(void)
     TransientIntegrator *theIntegrator = 0;
     
     int argc = OPS_GetNumRemainingInputArgs();
-    if (argc < 1 || argc > 4) {
-        opserr << "WARNING - incorrect number of args want AlphaOS $alpha <-updateElemDisp>\n";
-        opserr << "          or AlphaOS $alpha $beta $gamma <-updateElemDisp>\n";
+    if (argc < 1) {
+        opserr << "WARNING - incorrect number of args want AlphaOS $alpha <-updateElemDisp> <-realTime $period <-noPace>>\n";
+        opserr << "          or AlphaOS $alpha $beta $gamma <-updateElemDisp> <-realTime $period <-noPace>>\n";
         return 0;
     }
     
     bool updElemDisp = false;
+    double rtPeriod = 0.0;
+    bool rtPace = true;
     double dData[3];
-    int numData;
-    if (argc < 3)
-        numData = 1;
-    else
-        numData = 3;
+    int numData = 0;
     
-    if (OPS_GetDouble(&numData, dData) != 0) {
-        opserr << "WARNING - invalid args want AlphaOS $alpha <-updateElemDisp>\n";
-        opserr << "          or AlphaOS $alpha $beta $gamma <-updateElemDisp>\n";
+    // count number of numeric parameters
+    while (OPS_GetNumRemainingInputArgs() > 0)  {
+        const char *argvLoc = OPS_GetString();
+        if (argvLoc[0] == '-')
+            break;
+        numData++;
+    }
+    // reset to read from beginning
+    OPS_ResetCurrentInputArg(2);
+    
+    if ((numData != 1 && numData != 3) || OPS_GetDouble(&numData, dData) != 0) {
+        opserr << "WARNING - invalid args want AlphaOS $alpha <-updateElemDisp> <-realTime $period <-noPace>>\n";
+        opserr << "          or AlphaOS $alpha $beta $gamma <-updateElemDisp> <-realTime $period <-noPace>>\n";
         return 0;
     }
     
-    if (argc == 2 || argc == 4) {
+    while (OPS_GetNumRemainingInputArgs() > 0)  {
         const char *argvLoc = OPS_GetString();
         if (strcmp(argvLoc, "-updateElemDisp") == 0)
             updElemDisp = true;
+        else if (strcmp(argvLoc, "-realTime") == 0)  {
+            int numOne = 1;
+            if (OPS_GetDouble(&numOne, &rtPeriod) != 0 || rtPeriod <= 0.0) {
+                opserr << "WARNING - invalid period want AlphaOS ... -realTime $period\n";
+                return 0;
+            }
+        }
+        else if (strcmp(argvLoc, "-noPace") == 0)
+            rtPace = false;
     }
     
-    if (argc < 3)
+    if (numData == 1)
         theIntegrator = new AlphaOS(dData[0], updElemDisp);
     else
         theIntegrator = new AlphaOS(dData[0], dData[1], dData[2], updElemDisp);
     
+    if (theIntegrator != 0 && rtPeriod > 0.0)
+        ((AlphaOS *)theIntegrator)->setRealTime(rtPeriod, rtPace);
+    
     if (theIntegrator == 0)
         opserr << "WARNING - out of memory creating AlphaOS integrator\n";
     
@@ -93,7 +114,7 @@ AlphaOS::AlphaOS()
     updElemDisp(0), deltaT(0.0),
     updateCount(0), c1(0.0), c2(0.0), c3(0.0), 
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-    Ualpha(0), Ualphadot(0), Upt(0)
+    Ualpha(0), Ualphadot(0), Upt(0), theMonitor(0)
 {
     
 }
@@ -106,7 +127,7 @@ AlphaOS::AlphaOS(double _alpha,
     updElemDisp(updelemdisp), deltaT(0.0),
     updateCount(0), c1(0.0), c2(0.0), c3(0.0),
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-    Ualpha(0), Ualphadot(0), Upt(0)
+    Ualpha(0), Ualphadot(0), Upt(0), theMonitor(0)
 {
     
 }
@@ -119,7 +140,7 @@ AlphaOS::AlphaOS(double _alpha, double _beta, double _gamma,
     updElemDisp(updelemdisp), deltaT(0.0),
     updateCount(0), c1(0.0), c2(0.0), c3(0.0),
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
-    Ualpha(0), Ualphadot(0), Upt(0)
+    Ualpha(0), Ualphadot(0), Upt(0), theMonitor(0)
 {
     
 }
@@ -146,6 +167,28 @@ AlphaOS::~AlphaOS()
         delete Ualphadot;
     if (Upt != 0)
         delete Upt;
+    
+    // report the timing of a real-time run
+    if (theMonitor != 0)  {
+        if (theMonitor->getNumSteps() > 0)  {
+            opserr << "AlphaOS - real time summary\n";
+            theMonitor->Print(opserr);
+        }
+        delete theMonitor;
+    }
+}
+
+
+int AlphaOS::setRealTime(double period, bool pace)
+{
+    if (theMonitor != 0)
+        delete theMonitor;
+    theMonitor = 0;
+    
+    if (period > 0.0)
+        theMonitor = new RealTimeMonitor(period, pace);
+    
+    return 0;
 }
 
 
@@ -179,6 +222,10 @@ int AlphaOS::newStep(double _deltaT)
         return -3;
     }
     
+    // start the wall clock of a real-time run
+    if (theMonitor != 0)
+        theMonitor->startStep();
+    
     // set response at t to be that at t+deltaT of previous step
     (*Ut) = *U;
     (*Utdot) = *Udot;
@@ -447,7 +494,13 @@ int AlphaOS::commit(void)
     if (updElemDisp == true)
         theModel->updateDomain();
     
-    return theModel->commitDomain();
+    int res = theModel->commitDomain();
+    
+    // hold the step until its real-time deadline
+    if (theMonitor != 0)
+        theMonitor->endStep();
+    
+    return res;
 }
 
 
@@ -503,6 +556,8 @@ void AlphaOS::Print(OPS_Stream &s, int flag)
             s << "  updateElemDisp: yes\n";
         else
             s << "  updateElemDisp: no\n";
+        if (theMonitor != 0)
+            theMonitor->Print(s, flag);
     } else
         s << "AlphaOS - no associated AnalysisModel\n";
 }
@@ -39,6 +39,7 @@
 class DOF_Group;
 class FE_Element;
 class Vector;
+class RealTimeMonitor;
 
 class AlphaOS : public TransientIntegrator
 {
@@ -64,6 +65,9 @@ public:
     int update(const Vector &deltaU);
     int commit(void);
     
+    // wall clock period of a real-time hybrid simulation, 0 to turn off
+    int setRealTime(double period, bool pace = true);
+    
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
     
@@ -85,6 +89,8 @@ private:
     Vector *U, *Udot, *Udotdot;     // response quantities at time t+deltaT
     Vector *Ualpha, *Ualphadot;     // response quantities at time t+alpha*deltaT
     Vector *Upt;                    // predictor displacements at time t
+    
+    RealTimeMonitor *theMonitor;    // step timing of a real-time run
 };
 
 #endif
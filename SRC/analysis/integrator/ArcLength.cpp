@@ -94,6 +94,14 @@ ArcLength::~ArcLength()
 	delete phat;
 }
 
+int
+ArcLength::scaleIncrement(double factor)
+{
+    // the arc length squared
+    arcLength2 *= factor*factor;
+    return 0;
+}
+
 int
 ArcLength::newStep(void)
 {
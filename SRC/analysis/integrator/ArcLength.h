@@ -58,6 +58,7 @@ class ArcLength : public StaticIntegrator
     ~ArcLength();
 
     int newStep(void);    
+    int scaleIncrement(double factor);
     int update(const Vector &deltaU);
     int domainChanged(void);
     
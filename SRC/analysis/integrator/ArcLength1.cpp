@@ -94,6 +94,14 @@ ArcLength1::~ArcLength1()
 	delete phat;
 }
 
+int
+ArcLength1::scaleIncrement(double factor)
+{
+    // the arc length squared
+    arcLength2 *= factor*factor;
+    return 0;
+}
+
 int
 ArcLength1::newStep(void)
 {
@@ -58,6 +58,7 @@ class ArcLength1 : public StaticIntegrator
     ~ArcLength1();
 
     int newStep(void);    
+    int scaleIncrement(double factor);
     int update(const Vector &deltaU);
     int domainChanged(void);
     
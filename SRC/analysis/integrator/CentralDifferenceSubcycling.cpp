@@ -0,0 +1,719 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/CentralDifferenceSubcycling.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of the
+// CentralDifferenceSubcycling class.
+
+// What: "@(#) CentralDifferenceSubcycling.C, revA"
+
+#include <CentralDifferenceSubcycling.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <LinearSOE.h>
+#include <AnalysisModel.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <Profiler.h>
+#include <elementAPI.h>
+#include <math.h>
+#include <string.h>
+
+void *    OPS_CentralDifferenceSubcycling(void)
+{
+    double safety = 0.9;
+    int maxRatio = 64;
+
+    while (OPS_GetNumRemainingInputArgs() > 1) {
+	const char *type = OPS_GetString();
+	int numData = 1;
+	if (strcmp(type, "-safety") == 0) {
+	    if (OPS_GetDouble(&numData, &safety) < 0 || safety <= 0.0) {
+		opserr << "WARNING CentralDifferenceSubcycling -safety $factor - invalid factor\n";
+		return 0;
+	    }
+	} else if (strcmp(type, "-maxRatio") == 0) {
+	    if (OPS_GetInt(&numData, &maxRatio) < 0 || maxRatio < 1) {
+		opserr << "WARNING CentralDifferenceSubcycling -maxRatio $n - invalid ratio\n";
+		return 0;
+	    }
+	} else {
+	    opserr << "WARNING CentralDifferenceSubcycling <-safety $factor> <-maxRatio $n> - unknown option ";
+	    opserr << type << endln;
+	    return 0;
+	}
+    }
+
+    TransientIntegrator *theIntegrator = new CentralDifferenceSubcycling(safety, maxRatio);
+
+    if (theIntegrator == 0)
+	opserr << "WARNING - out of memory creating CentralDifferenceSubcycling integrator\n";
+
+    return theIntegrator;
+}
+
+
+CentralDifferenceSubcycling::CentralDifferenceSubcycling(double s, int maxR)
+:TransientIntegrator(INTEGRATOR_TAGS_CentralDifferenceSubcycling),
+ safety(s), maxRatio(1), deltaT(0.0), updateCount(0),
+ size(0), U(0), Udot(0), Udotdot(0), Utrial(0), B(0), invMass(0), eqnPeriod(0),
+ numFE(0), numDOF(0), theFEs(0), theDOFs(0), dtCritical(0), theResiduals(0),
+ levelDeltaT(0.0), numSubsteps(1), numLevels(1),
+ elePeriod(0), dofPeriod(0), setPeriod(0),
+ activeFEs(0), activeDOFs(0), setDOFs(0),
+ numActiveFEs(0), numActiveDOFs(0), numSetDOFs(0)
+{
+  // the ratios are powers of 2
+  while (2*maxRatio <= maxR)
+    maxRatio *= 2;
+}
+
+
+CentralDifferenceSubcycling::~CentralDifferenceSubcycling()
+{
+  this->freeArrays();
+}
+
+
+void
+CentralDifferenceSubcycling::freeArrays(void)
+{
+  if (U != 0) delete U;
+  if (Udot != 0) delete Udot;
+  if (Udotdot != 0) delete Udotdot;
+  if (Utrial != 0) delete Utrial;
+  if (B != 0) delete B;
+  if (invMass != 0) delete [] invMass;
+  if (eqnPeriod != 0) delete [] eqnPeriod;
+
+  if (theResiduals != 0) {
+    for (int i=0; i<numFE; i++)
+      if (theResiduals[i] != 0)
+	delete theResiduals[i];
+    delete [] theResiduals;
+  }
+
+  if (theFEs != 0) delete [] theFEs;
+  if (theDOFs != 0) delete [] theDOFs;
+  if (dtCritical != 0) delete [] dtCritical;
+  if (elePeriod != 0) delete [] elePeriod;
+  if (dofPeriod != 0) delete [] dofPeriod;
+  if (setPeriod != 0) delete [] setPeriod;
+  if (activeFEs != 0) delete [] activeFEs;
+  if (activeDOFs != 0) delete [] activeDOFs;
+  if (setDOFs != 0) delete [] setDOFs;
+  if (numActiveFEs != 0) delete [] numActiveFEs;
+  if (numActiveDOFs != 0) delete [] numActiveDOFs;
+  if (numSetDOFs != 0) delete [] numSetDOFs;
+
+  size = 0; numFE = 0; numDOF = 0;
+  U = 0; Udot = 0; Udotdot = 0; Utrial = 0; B = 0;
+  invMass = 0; eqnPeriod = 0;
+  theFEs = 0; theDOFs = 0; dtCritical = 0; theResiduals = 0;
+  elePeriod = 0; dofPeriod = 0; setPeriod = 0;
+  activeFEs = 0; activeDOFs = 0; setDOFs = 0;
+  numActiveFEs = 0; numActiveDOFs = 0; numSetDOFs = 0;
+  levelDeltaT = 0.0;
+}
+
+
+int
+CentralDifferenceSubcycling::formEleTangent(FE_Element *theEle)
+{
+  theEle->zeroTangent();
+  theEle->addMtoTang();
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::formNodTangent(DOF_Group *theDof)
+{
+  theDof->zeroTangent();
+  theDof->addMtoTang();
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::formEleResidual(FE_Element *theEle)
+{
+  theEle->zeroResidual();
+  theEle->addRtoResidual();
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::formNodUnbalance(DOF_Group *theDof)
+{
+  theDof->zeroUnbalance();
+  theDof->addPtoUnbalance();
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::newStep(double _deltaT)
+{
+  updateCount = 0;
+
+  deltaT = _deltaT;
+
+  if (deltaT <= 0.0) {
+    opserr << "CentralDifferenceSubcycling::newStep() - error in variable\n";
+    opserr << "dT = " << deltaT << endln;
+    return -2;
+  }
+
+  AnalysisModel *theModel = this->getAnalysisModel();
+  double time = theModel->getCurrentDomainTime();
+  theModel->applyLoadDomain(time);
+
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::domainChanged()
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == 0) {
+    opserr << "CentralDifferenceSubcycling::domainChanged - no AnalysisModel set\n";
+    return -1;
+  }
+
+  this->freeArrays();
+
+  size = theModel->getNumEqn();
+  U = new Vector(size);
+  Udot = new Vector(size);
+  Udotdot = new Vector(size);
+  Utrial = new Vector(size);
+  B = new Vector(size);
+  invMass = new double[size];
+  eqnPeriod = new int[size];
+  for (int i=0; i<size; i++) {
+    invMass[i] = 0.0;
+    eqnPeriod[i] = 1;
+  }
+
+  // the FE_Elements and DOF_Groups
+  numFE = theModel->getNumFE_Elements();
+  numDOF = theModel->getNumDOF_Groups();
+  theFEs = new FE_Element *[numFE];
+  theDOFs = new DOF_Group *[numDOF];
+  dtCritical = new double[numFE];
+  theResiduals = new Vector *[numFE];
+  elePeriod = new int[numFE];
+  dofPeriod = new int[numDOF];
+  setPeriod = new int[numDOF];
+  activeFEs = new FE_Element *[numFE];
+  activeDOFs = new DOF_Group *[numDOF];
+  setDOFs = new DOF_Group *[numDOF];
+  for (int i=0; i<numFE; i++)
+    theResiduals[i] = 0;
+
+  int count = 0;
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel->getFEs();
+  while ((elePtr = theEles()) != 0 && count < numFE)
+    theFEs[count++] = elePtr;
+  numFE = count;
+
+  count = 0;
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theModel->getDOFs();
+  while ((dofPtr = theDofs()) != 0 && count < numDOF)
+    theDOFs[count++] = dofPtr;
+  numDOF = count;
+
+  // the lumped mass, which must be diagonal
+  for (int pass=0; pass<2; pass++) {
+    int num = (pass == 0) ? numDOF : numFE;
+    for (int i=0; i<num; i++) {
+      const Matrix &m = (pass == 0) ? theDOFs[i]->getTangent(this) : theFEs[i]->getTangent(this);
+      const ID &id = (pass == 0) ? theDOFs[i]->getID() : theFEs[i]->getID();
+      int idSize = id.Size();
+      for (int j=0; j<idSize; j++) {
+	for (int k=0; k<idSize; k++)
+	  if (j != k && m(j,k) != 0.0) {
+	    opserr << "CentralDifferenceSubcycling::domainChanged - the mass is not lumped for ID " << id;
+	    return -2;
+	  }
+	int loc = id(j);
+	if (loc >= 0 && loc < size)
+	  invMass[loc] += m(j,j);
+      }
+    }
+  }
+
+  for (int i=0; i<size; i++) {
+    if (invMass[i] == 0.0) {
+      opserr << "CentralDifferenceSubcycling::domainChanged - no mass for equation " << i << endln;
+      return -3;
+    }
+    invMass[i] = 1.0/invMass[i];
+  }
+
+  // the critical time step of the equations, from the bound on the
+  // largest eigenvalue of inv(M)K given by the row sums of K, and that of
+  // an element the smallest of its equations
+  double *rowSum = new double[size];
+  for (int i=0; i<size; i++)
+    rowSum[i] = 0.0;
+
+  for (int i=0; i<numFE; i++) {
+    elePtr = theFEs[i];
+    elePtr->zeroTangent();
+    elePtr->addKtToTang(1.0);
+    const Matrix &K = elePtr->getTangent(0);
+    const ID &id = elePtr->getID();
+    int idSize = id.Size();
+    for (int j=0; j<idSize; j++) {
+      int loc = id(j);
+      if (loc < 0 || loc >= size)
+	continue;
+      for (int k=0; k<idSize; k++)
+	rowSum[loc] += fabs(K(j,k));
+    }
+  }
+
+  for (int i=0; i<numFE; i++) {
+    const ID &id = theFEs[i]->getID();
+    double omega2 = 0.0;
+    for (int j=0; j<id.Size(); j++) {
+      int loc = id(j);
+      if (loc >= 0 && loc < size && rowSum[loc]*invMass[loc] > omega2)
+	omega2 = rowSum[loc]*invMass[loc];
+    }
+    dtCritical[i] = (omega2 > 0.0) ? 2.0/sqrt(omega2) : 0.0;
+  }
+
+  delete [] rowSum;
+
+  // now go through and populate U and Udot by iterating through
+  // the DOF_Groups and getting the last committed velocity and accel
+  for (int i=0; i<numDOF; i++) {
+    dofPtr = theDOFs[i];
+    const ID &id = dofPtr->getID();
+    int idSize = id.Size();
+    const Vector &disp = dofPtr->getCommittedDisp();
+    const Vector &vel = dofPtr->getCommittedVel();
+    const Vector &accel = dofPtr->getCommittedAccel();
+    for (int j=0; j < idSize; j++)  {
+      int loc = id(j);
+      if (loc >= 0 && loc < size)  {
+	(*U)(loc) = disp(j);
+	(*Udot)(loc) = vel(j);
+	(*Udotdot)(loc) = accel(j);
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::setLevels(void)
+{
+  // the ratio of each element, a dtCritical of 0 has no stiffness
+  int numUnstable = 0;
+  numSubsteps = 1;
+  for (int i=0; i<numFE; i++) {
+    int n = 1;
+    if (dtCritical[i] > 0.0) {
+      double dtAllowed = safety*dtCritical[i];
+      while (n < maxRatio && deltaT/n > dtAllowed)
+	n *= 2;
+      if (deltaT/n > dtAllowed)
+	numUnstable++;
+    }
+    elePeriod[i] = n;
+    if (n > numSubsteps)
+      numSubsteps = n;
+  }
+
+  if (numUnstable != 0) {
+    opserr << "WARNING CentralDifferenceSubcycling - the step of " << numUnstable;
+    opserr << " elements is over the critical step with a ratio of " << maxRatio << endln;
+  }
+
+  // DOF_Group tags are not assumed to be the locations in theDOFs
+  int maxTag = 0;
+  for (int i=0; i<numDOF; i++)
+    if (theDOFs[i]->getTag() > maxTag)
+      maxTag = theDOFs[i]->getTag();
+  ID dofLoc(maxTag+1);
+  for (int i=0; i<=maxTag; i++)
+    dofLoc(i) = -1;
+  for (int i=0; i<numDOF; i++)
+    dofLoc(theDOFs[i]->getTag()) = i;
+
+  // the ratio of a node is the largest of its elements, its period the
+  // number of substeps between two of its steps
+  for (int i=0; i<numDOF; i++)
+    dofPeriod[i] = 1;
+  for (int i=0; i<numFE; i++) {
+    const ID &tags = theFEs[i]->getDOFtags();
+    for (int j=0; j<tags.Size(); j++) {
+      int tag = tags(j);
+      int loc = (tag >= 0 && tag <= maxTag) ? dofLoc(tag) : -1;
+      if (loc >= 0 && elePeriod[i] > dofPeriod[loc])
+	dofPeriod[loc] = elePeriod[i];
+    }
+  }
+  for (int i=0; i<numDOF; i++) {
+    dofPeriod[i] = numSubsteps/dofPeriod[i];
+    setPeriod[i] = dofPeriod[i];
+  }
+
+  // an element is updated whenever one of its nodes takes a step, and the
+  // displacements of all its nodes are then set
+  for (int i=0; i<numFE; i++) {
+    const ID &tags = theFEs[i]->getDOFtags();
+    int period = numSubsteps;
+    for (int j=0; j<tags.Size(); j++) {
+      int tag = tags(j);
+      int loc = (tag >= 0 && tag <= maxTag) ? dofLoc(tag) : -1;
+      if (loc >= 0 && dofPeriod[loc] < period)
+	period = dofPeriod[loc];
+    }
+    elePeriod[i] = period;
+  }
+  for (int i=0; i<numFE; i++) {
+    const ID &tags = theFEs[i]->getDOFtags();
+    for (int j=0; j<tags.Size(); j++) {
+      int tag = tags(j);
+      int loc = (tag >= 0 && tag <= maxTag) ? dofLoc(tag) : -1;
+      if (loc >= 0 && elePeriod[i] < setPeriod[loc])
+	setPeriod[loc] = elePeriod[i];
+    }
+  }
+
+  for (int i=0; i<numDOF; i++) {
+    const ID &id = theDOFs[i]->getID();
+    for (int j=0; j<id.Size(); j++) {
+      int loc = id(j);
+      if (loc >= 0 && loc < size)
+	eqnPeriod[loc] = dofPeriod[i];
+    }
+  }
+
+  // the lists in order of increasing period, those with a period of
+  // 2^level are active in a substep of that level or higher
+  numLevels = 1;
+  while ((1 << (numLevels-1)) < numSubsteps)
+    numLevels++;
+
+  if (numActiveFEs != 0) delete [] numActiveFEs;
+  if (numActiveDOFs != 0) delete [] numActiveDOFs;
+  if (numSetDOFs != 0) delete [] numSetDOFs;
+  numActiveFEs = new int[numLevels];
+  numActiveDOFs = new int[numLevels];
+  numSetDOFs = new int[numLevels];
+
+  int numEle = 0, numAct = 0, numSet = 0;
+  for (int level=0; level<numLevels; level++) {
+    int period = 1 << level;
+    for (int i=0; i<numFE; i++)
+      if (elePeriod[i] == period) {
+	int numEleDOF = theFEs[i]->getID().Size();
+	if (theResiduals[numEle] == 0 || theResiduals[numEle]->Size() != numEleDOF) {
+	  if (theResiduals[numEle] != 0)
+	    delete theResiduals[numEle];
+	  theResiduals[numEle] = new Vector(numEleDOF);
+	}
+	activeFEs[numEle++] = theFEs[i];
+      }
+    for (int i=0; i<numDOF; i++) {
+      if (dofPeriod[i] == period)
+	activeDOFs[numAct++] = theDOFs[i];
+      if (setPeriod[i] == period)
+	setDOFs[numSet++] = theDOFs[i];
+    }
+    numActiveFEs[level] = numEle;
+    numActiveDOFs[level] = numAct;
+    numSetDOFs[level] = numSet;
+  }
+
+  levelDeltaT = deltaT;
+
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::getLevel(int substep)
+{
+  // the level of the largest period dividing the substep
+  int period = (substep == 0) ? numSubsteps : (substep & -substep);
+  int level = 0;
+  while ((1 << level) < period)
+    level++;
+  return level;
+}
+
+
+bool
+CentralDifferenceSubcycling::isLumped(void)
+{
+  return true;
+}
+
+
+int
+CentralDifferenceSubcycling::solveLumped(int statFlag, bool formDiagonal)
+{
+  updateCount++;
+  if (updateCount > 1) {
+    opserr << "ERROR CentralDifferenceSubcycling::solveLumped() - called more than once -";
+    opserr << " Central Difference integraion schemes require a LINEAR solution algorithm\n";
+    return -1;
+  }
+
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == 0 || U == 0) {
+    opserr << "WARNING CentralDifferenceSubcycling::solveLumped() - domainChange() failed or not called\n";
+    return -2;
+  }
+
+  statusFlag = statFlag;
+
+  if (levelDeltaT != deltaT)
+    this->setLevels();
+
+  double h = deltaT/numSubsteps;
+#ifdef _OPENMP
+  int numT = this->getNumThreads();
+#endif
+
+  for (int j=0; j<=numSubsteps; j++) {
+    int level = this->getLevel(j);
+
+    // the equations taking a step now end the last one, D += dT * V
+    if (j > 0) {
+      int num = numActiveDOFs[level];
+      for (int i=0; i<num; i++) {
+	const ID &id = activeDOFs[i]->getID();
+	for (int k=0; k<id.Size(); k++) {
+	  int loc = id(k);
+	  if (loc >= 0 && loc < size)
+	    (*U)(loc) += eqnPeriod[loc]*h*(*Udot)(loc);
+	}
+      }
+    }
+
+    if (j == numSubsteps)
+      break;
+
+    Profiler::begin(PROFILE_UNBALANCE);
+
+    // the displacements at the nodes of the elements to be updated, those
+    // of the equations in the middle of a step are interpolated
+    int numSet = numSetDOFs[level];
+    for (int i=0; i<numSet; i++) {
+      const ID &id = setDOFs[i]->getID();
+      for (int k=0; k<id.Size(); k++) {
+	int loc = id(k);
+	if (loc >= 0 && loc < size)
+	  (*Utrial)(loc) = (*U)(loc) + (j % eqnPeriod[loc])*h*(*Udot)(loc);
+      }
+      setDOFs[i]->setNodeDisp(*Utrial);
+    }
+
+    // the element forces, each into its own vector
+    int numEle = numActiveFEs[level];
+    const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(numT) if(numT > 1)
+#endif
+    for (int i=0; i<numEle; i++) {
+      theGlobals.set();
+      activeFEs[i]->updateElement();
+      *theResiduals[i] = activeFEs[i]->getResidual(this);
+    }
+
+    // the unbalance at the equations taking a step
+    int numAct = numActiveDOFs[level];
+    for (int i=0; i<numAct; i++) {
+      const ID &id = activeDOFs[i]->getID();
+      for (int k=0; k<id.Size(); k++) {
+	int loc = id(k);
+	if (loc >= 0 && loc < size)
+	  (*B)(loc) = 0.0;
+      }
+    }
+
+    for (int i=0; i<numEle; i++) {
+      const ID &id = activeFEs[i]->getID();
+      const Vector &r = *theResiduals[i];
+      for (int k=0; k<id.Size(); k++) {
+	int loc = id(k);
+	if (loc >= 0 && loc < size && j % eqnPeriod[loc] == 0)
+	  (*B)(loc) += r(k);
+      }
+    }
+
+    for (int i=0; i<numAct; i++) {
+      const ID &id = activeDOFs[i]->getID();
+      const Vector &p = activeDOFs[i]->getUnbalance(this);
+      for (int k=0; k<id.Size(); k++) {
+	int loc = id(k);
+	if (loc >= 0 && loc < size)
+	  (*B)(loc) += p(k);
+      }
+    }
+
+    Profiler::end(PROFILE_UNBALANCE);
+
+    // An = M(-1) (Pn - Fn), Vn+1/2 = Vn-1/2 + dT * An
+    for (int i=0; i<numAct; i++) {
+      const ID &id = activeDOFs[i]->getID();
+      for (int k=0; k<id.Size(); k++) {
+	int loc = id(k);
+	if (loc >= 0 && loc < size) {
+	  double a = invMass[loc]*(*B)(loc);
+	  (*Udotdot)(loc) = a;
+	  (*Udot)(loc) += eqnPeriod[loc]*h*a;
+	}
+      }
+    }
+  }
+
+  // update the disp & responses at the DOFs
+  theModel->setDisp(*U);
+  theModel->updateDomain();
+
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::update(const Vector &X)
+{
+  // the step without subcycling, for an algorithm solving the LinearSOE
+  updateCount++;
+  if (updateCount > 1) {
+    opserr << "ERROR CentralDifferenceSubcycling::update() - called more than once -";
+    opserr << " Central Difference integraion schemes require a LINEAR solution algorithm\n";
+    return -1;
+  }
+
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == 0 || U == 0) {
+    opserr << "WARNING CentralDifferenceSubcycling::update() - domainChange() failed or not called\n";
+    return -2;
+  }
+
+  if (X.Size() != U->Size()) {
+    opserr << "WARNING CentralDifferenceSubcycling::update() - Vectors of incompatable size ";
+    opserr << " expecting " << U->Size() << " obtained " << X.Size() << endln;
+    return -3;
+  }
+
+  (*Udotdot) = X;
+  Udot->addVector(1.0, X, deltaT);
+  U->addVector(1.0, *Udot, deltaT);
+
+  theModel->setDisp(*U);
+  theModel->updateDomain();
+
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::commit(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == 0) {
+    opserr << "WARNING CentralDifferenceSubcycling::commit() - no AnalysisModel set\n";
+    return -1;
+  }
+
+  // update time in Domain to T + deltaT & commit the domain
+  double time = theModel->getCurrentDomainTime() + deltaT;
+  theModel->setCurrentDomainTime(time);
+
+  return theModel->commitDomain();
+}
+
+
+int
+CentralDifferenceSubcycling::sendSelf(int cTag, Channel &theChannel)
+{
+  Vector data(2);
+  data(0) = safety;
+  data(1) = maxRatio;
+
+  if (theChannel.sendVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "WARNING CentralDifferenceSubcycling::sendSelf() - could not send data\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+CentralDifferenceSubcycling::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  Vector data(2);
+  if (theChannel.recvVector(this->getDbTag(), cTag, data) < 0) {
+    opserr << "WARNING CentralDifferenceSubcycling::recvSelf() - could not receive data\n";
+    return -1;
+  }
+
+  safety = data(0);
+  maxRatio = (int)data(1);
+
+  return 0;
+}
+
+
+void
+CentralDifferenceSubcycling::Print(OPS_Stream &s, int flag)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel != 0) {
+    double currentTime = theModel->getCurrentDomainTime();
+    s << "\t CentralDifferenceSubcycling - currentTime: " << currentTime << endln;
+    s << "\t safety: " << safety << "  maxRatio: " << maxRatio;
+    s << "  substeps: " << numSubsteps << endln;
+    if (numActiveFEs != 0 && levelDeltaT != 0.0)
+      for (int level=0; level<numLevels; level++) {
+	int numEle = numActiveFEs[level] - ((level > 0) ? numActiveFEs[level-1] : 0);
+	s << "\t elements updated every " << (1 << level) << " substeps: " << numEle << endln;
+      }
+  } else
+    s << "\t CentralDifferenceSubcycling - no associated AnalysisModel\n";
+}
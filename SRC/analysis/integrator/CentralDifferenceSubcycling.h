@@ -0,0 +1,129 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/CentralDifferenceSubcycling.h,v $
+
+#ifndef CentralDifferenceSubcycling_h
+#define CentralDifferenceSubcycling_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// CentralDifferenceSubcycling, the central difference scheme of
+// CentralDifferenceNoDamping with a lumped mass where the stiff parts of
+// the model are subcycled within the step:
+//       An = M(-1) (Pn - Fn)
+//       Vn+1/2 = Vn-1/2 + dT * An
+//       Dn+1   = Dn + dT * Vn+1/2
+//
+// The critical time step of each equation is estimated when the domain
+// changes from the row sums of the element stiffnesses and the lumped
+// mass, dTcr = 2/sqrt(sum_e sum_j |Ke_ij| / M_ii), and that of an element
+// is the smallest of its equations. For a step dT each element is
+// given the smallest power of 2, n, for which dT/n <= safety * dTcr, and
+// each node the largest n of its elements. The step is then taken in N
+// substeps of dT/N, N the largest n; the equations of a node with n are
+// advanced every N/n substeps with a step of dT/n, and only the elements
+// connected to the nodes advanced in a substep are updated in it. The
+// displacements of the nodes not advanced in a substep are interpolated
+// from their last displacement and velocity, so the forces exchanged
+// across the interface between two rates are consistent with the motion
+// of both sides (Belytschko, Yen and Mullen, "Mixed Methods for Time
+// Integration", CMAME 17/18, 1979).
+//
+// The step is taken by solveLumped() and so needs a Linear algorithm;
+// the LinearSOE is not used. As CentralDifferenceNoDamping there is no
+// damping and only the displacements are set at the nodes.
+
+// What: "@(#) CentralDifferenceSubcycling.h, revA"
+
+#include <TransientIntegrator.h>
+
+class DOF_Group;
+class FE_Element;
+class Vector;
+
+class CentralDifferenceSubcycling : public TransientIntegrator
+{
+  public:
+    CentralDifferenceSubcycling(double safety = 0.9, int maxRatio = 64);
+    ~CentralDifferenceSubcycling();
+
+    // methods which define what the FE_Element and DOF_Groups add
+    // to the system of equation object.
+    int formEleTangent(FE_Element *theEle);
+    int formNodTangent(DOF_Group *theDof);
+    int formEleResidual(FE_Element *theEle);
+    int formNodUnbalance(DOF_Group *theDof);
+
+    int domainChanged(void);
+    int newStep(double deltaT);
+    int update(const Vector &X);
+    int commit(void);
+
+    // the step is always taken without the LinearSOE
+    bool isLumped(void);
+    int solveLumped(int statusFlag, bool formDiagonal);
+
+    virtual int sendSelf(int commitTag, Channel &theChannel);
+    virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  protected:
+
+  private:
+    void freeArrays(void);
+    int setLevels(void);
+    int getLevel(int substep);
+
+    double safety;
+    int maxRatio;
+    double deltaT;
+    int updateCount;
+
+    // the response at the equations; U and Udot are those at the last
+    // time the equation was advanced, Utrial the interpolated displacement
+    // set at the nodes in a substep
+    int size;
+    Vector *U, *Udot, *Udotdot, *Utrial, *B;
+    double *invMass;
+    int *eqnPeriod;
+
+    // the FE_Elements and DOF_Groups with their critical time step,
+    // each list is in order of increasing period so that those active in
+    // a substep are the first numActive[level] of them
+    int numFE, numDOF;
+    FE_Element **theFEs;
+    DOF_Group **theDOFs;
+    double *dtCritical;
+    Vector **theResiduals;
+
+    double levelDeltaT;    // the step the levels were set for
+    int numSubsteps, numLevels;
+    int *elePeriod, *dofPeriod, *setPeriod;
+    FE_Element **activeFEs;
+    DOF_Group **activeDOFs, **setDOFs;
+    int *numActiveFEs, *numActiveDOFs, *numSetDOFs;
+};
+
+#endif
@@ -176,6 +176,20 @@ DisplacementControl::~DisplacementControl()
 }
  
    int
+DisplacementControl::scaleIncrement(double factor)
+{
+   double oldIncrement = theIncrement;
+
+   theIncrement *= factor;
+   if (theIncrement < minIncrement)
+      theIncrement = minIncrement;
+   else if (theIncrement > maxIncrement)
+      theIncrement = maxIncrement;
+
+   return (theIncrement == oldIncrement) ? -1 : 0;
+}
+
+int
 DisplacementControl::newStep(void)
 {
 
@@ -1028,7 +1042,14 @@ DisplacementControl::computeSensitivities(void)
   int  numGrads = theDomain->getNumParameters();
   paramIter = theDomain->getParameters();
 
- 
+  // form the right hand side of every parameter, then solve for all of
+  // them with one tangent and one substitution
+  int numEqn = theSOE->getNumEqn();
+  if (numGrads == 0 || numEqn == 0)
+    return 0;
+  static Matrix theRHS;
+  theRHS.resize(numEqn, numGrads);
+  int numParam = 0;
   while ((theParam = paramIter()) != 0) {
     // Activate this parameter
     theParam->activate(true);
@@ -1038,36 +1059,49 @@ DisplacementControl::computeSensitivities(void)
     
     // Get the grad index for this parameter
     int gradIndex = theParam->getGradIndex();
-                  
-    // this->formResidualDispSensitivity( dUIJdh, gradIndex);//./.
- 
+
     // Form the RHS
-    
-    //  this->formTangDispSensitivity(dUhatdh,gradIndex);
     this->formSensitivityRHS(gradIndex);
-     
-    this->formTangent();
-    theSOE->solve();
-    *dUIJdh=theSOE->getX();// sensitivity of the residual displacement
- 
-    //  opserr<<"computeSensitivities: dUfRdh is  "<<*dUIJdh<<endln;//
-    //    opserr<<"deltaUbar is "<<*deltaUbar<<endln;   
+    for (int i=0; i<numEqn; i++)
+      theRHS(i, numParam) = (*Residual)(i);
+    numParam++;
+
+    // De-activate this parameter for the next one
+    theParam->activate(false);
+  }
+
+  if (numParam == 0)
+    return 0;
+  if (numParam != numGrads)
+    theRHS.resize(numEqn, numParam);
+
+  // Solve for the sensitivity of the residual displacement, which with
+  // the tangent unchanged is also the response sensitivity
+  this->formTangent();
+  theSOE->setBlockB(theRHS);
+  if (theSOE->solveBlock() < 0) {
+    opserr << "WARNING DisplacementControl::computeSensitivities() - the LinearSOE failed in solveBlock()\n";
+    return -1;
+  }
+  static Matrix theX;
+  theX = theSOE->getBlockX();
+
+  numParam = 0;
+  paramIter = theDomain->getParameters();
+  while ((theParam = paramIter()) != 0) {
+
+    theParam->activate(true);
+    int gradIndex = theParam->getGradIndex();
+
+    for (int i=0; i<numEqn; i++)
+      (*dUIJdh)(i) = theX(i, numParam);// sensitivity of the residual displacement
+    numParam++;
+
     this->formTangDispSensitivity(dUhatdh,gradIndex);
     double dlamdh = this->getLambdaSensitivity(gradIndex);
 
-    // To obtain the response sensitivity 
-    theSOE->setB(*Residual);
-    theSOE->solve();
-    //theSOE->getX();
-       
-    //Vector *x=new Vector(size);
-    //(*x)=theSOE->getX();
-    //  x->addVector(1.0,*deltaUhat,Dlambdadh);
-    //  x->addVector(1.0,*dUhatdh,dLambda);
-    (*sensU) = theSOE->getX();//.................................
-    //   sensU->addVector(1.0,*deltaUhat,Dlambdadh);
-    //    opserr<<" computeSensitivities::...... final dudh is "<<theSOE->getX()<<endln;
-    //(*sensU) +=(*x);
+    // To obtain the response sensitivity
+    (*sensU) = (*dUIJdh);
 
     // Save sensitivity to nodes
     this->saveSensitivity( (*sensU), gradIndex, numGrads );
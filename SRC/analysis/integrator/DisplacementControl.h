@@ -60,6 +60,7 @@ class DisplacementControl : public StaticIntegrator
       ~DisplacementControl();
 
       int newStep(void);    
+      int scaleIncrement(double factor);
       int update(const Vector &deltaU);
       int domainChanged(void);
 
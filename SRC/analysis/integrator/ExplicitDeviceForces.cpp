@@ -0,0 +1,364 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/ExplicitDeviceForces.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for ExplicitDeviceForces.
+//
+// What: "@(#) ExplicitDeviceForces.C, revA"
+
+#include <ExplicitDeviceForces.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <Element.h>
+#include <Node.h>
+#include <Domain.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <ElementalLoadIter.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <classTags.h>
+#include <map>
+
+#include <cuda_runtime.h>
+
+// copies h to newly allocated device memory
+template <class T> static int
+toDevice(T *&d, const std::vector<T> &h)
+{
+  d = 0;
+  if (h.empty())
+    return 0;
+  if (cudaMalloc((void **)&d, h.size()*sizeof(T)) != cudaSuccess) {
+    d = 0;
+    return -1;
+  }
+  if (cudaMemcpy(d, &h[0], h.size()*sizeof(T), cudaMemcpyHostToDevice) != cudaSuccess)
+    return -1;
+  return 0;
+}
+
+template <class T> static void
+freeOnDevice(T *&d)
+{
+  if (d != 0)
+    cudaFree(d);
+  d = 0;
+}
+
+
+ExplicitDeviceForces::ExplicitDeviceForces(int dev)
+:device(dev), numEle(0), numRows(0), numEqn(0), numSlots(0),
+ dRowEle(0), dEleRow(0), dRowSlot(0), dEqPtr(0), dEqRows(0), dEleK(0),
+ dK(0), dMass(0), dAlpha(0), dBeta(0), dState(0), dFe(0), dR(0),
+ warned(false)
+{
+
+}
+
+
+ExplicitDeviceForces::~ExplicitDeviceForces()
+{
+  this->freeDevice();
+}
+
+
+void
+ExplicitDeviceForces::freeDevice(void)
+{
+  freeOnDevice(dRowEle);
+  freeOnDevice(dEleRow);
+  freeOnDevice(dRowSlot);
+  freeOnDevice(dEqPtr);
+  freeOnDevice(dEqRows);
+  freeOnDevice(dEleK);
+  freeOnDevice(dK);
+  freeOnDevice(dMass);
+  freeOnDevice(dAlpha);
+  freeOnDevice(dBeta);
+  freeOnDevice(dState);
+  freeOnDevice(dFe);
+  freeOnDevice(dR);
+
+  numEle = 0;
+  numRows = 0;
+  numSlots = 0;
+}
+
+
+// the residual of an FE_Element is formed on the device if its element has
+// a constant tangent and a lumped mass, and its ID is that of the
+// DOF_Groups of the nodes, as it is without a constraint transformation
+static bool
+isForDevice(FE_Element *elePtr)
+{
+  Element *theEle = elePtr->getElement();
+  if (theEle == 0 || theEle->isSubdomain() == true || theEle->isActive() == false)
+    return false;
+  if (theEle->hasConstantTangent() == false)
+    return false;
+
+  const ID &id = elePtr->getID();
+  int numDOF = theEle->getNumDOF();
+  if (id.Size() != numDOF)
+    return false;
+
+  Node **nodes = theEle->getNodePtrs();
+  int numNodes = theEle->getNumExternalNodes();
+  int loc = 0;
+  for (int i=0; i<numNodes; i++) {
+    DOF_Group *theDOF = nodes[i]->getDOF_GroupPtr();
+    if (theDOF == 0)
+      return false;
+    const ID &nodeID = theDOF->getID();
+    int ndf = nodes[i]->getNumberDOF();
+    if (nodeID.Size() != ndf || loc+ndf > numDOF)
+      return false;
+    for (int j=0; j<ndf; j++)
+      if (id(loc++) != nodeID(j))
+	return false;
+  }
+  if (loc != numDOF)
+    return false;
+
+  const Matrix &M = theEle->getMass();
+  for (int j=0; j<numDOF; j++)
+    for (int k=0; k<numDOF; k++)
+      if (j != k && M(j,k) != 0.0)
+	return false;
+
+  return true;
+}
+
+
+int
+ExplicitDeviceForces::setModel(AnalysisModel &theModel)
+{
+  this->freeDevice();
+  onDevice.clear();
+  theNodes.clear();
+
+  if (cudaSetDevice(device) != cudaSuccess) {
+    opserr << "WARNING ExplicitDeviceForces::setModel() - failed to set device " << device << endln;
+    return -1;
+  }
+
+  numEqn = theModel.getNumEqn();
+
+  std::vector<int> rowEle, eleRow, rowSlot, rowEqn;
+  std::vector<long long> eleK;
+  std::vector<double> K, mass, alpha, beta;
+  std::map<Node *, int> nodeSlots;
+  std::vector<int> slotOfNode;
+
+  eleRow.push_back(0);
+  eleK.push_back(0);
+
+  FE_EleIter &theEles = theModel.getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    if (isForDevice(elePtr) == false) {
+      onDevice.push_back(0);
+      continue;
+    }
+    onDevice.push_back(1);
+
+    Element *theEle = elePtr->getElement();
+    const ID &id = elePtr->getID();
+    int numDOF = id.Size();
+
+    // the slots of the nodal state of the rows
+    Node **nodes = theEle->getNodePtrs();
+    int numNodes = theEle->getNumExternalNodes();
+    for (int i=0; i<numNodes; i++) {
+      std::map<Node *, int>::iterator theSlot = nodeSlots.find(nodes[i]);
+      int slot = numSlots;
+      if (theSlot == nodeSlots.end()) {
+	nodeSlots[nodes[i]] = numSlots;
+	theNodes.push_back(nodes[i]);
+	slotOfNode.push_back(numSlots);
+	numSlots += nodes[i]->getNumberDOF();
+      } else
+	slot = theSlot->second;
+      for (int j=0; j<nodes[i]->getNumberDOF(); j++)
+	rowSlot.push_back(slot+j);
+    }
+
+    // the stiffness by rows and the lumped mass
+    const Matrix &theK = theEle->getTangentStiff();
+    for (int j=0; j<numDOF; j++)
+      for (int k=0; k<numDOF; k++)
+	K.push_back(theK(j,k));
+    const Matrix &theM = theEle->getMass();
+    for (int j=0; j<numDOF; j++) {
+      mass.push_back(theM(j,j));
+      rowEle.push_back(numEle);
+      rowEqn.push_back(id(j));
+    }
+
+    // with the tangent constant the Rayleigh damping is alphaM M + beta K
+    double alphaM, betaK, betaK0, betaKc;
+    theEle->getRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
+    alpha.push_back(alphaM);
+    beta.push_back(betaK + betaK0 + betaKc);
+
+    numEle++;
+    numRows += numDOF;
+    eleRow.push_back(numRows);
+    eleK.push_back(eleK.back() + (long long)numDOF*numDOF);
+  }
+
+  if (numEle == 0)
+    return 0;
+
+  // the rows adding to each equation, in the order of the FE_EleIter
+  std::vector<int> eqPtr(numEqn+1, 0);
+  for (int r=0; r<numRows; r++)
+    if (rowEqn[r] >= 0 && rowEqn[r] < numEqn)
+      eqPtr[rowEqn[r]+1]++;
+  for (int i=0; i<numEqn; i++)
+    eqPtr[i+1] += eqPtr[i];
+  std::vector<int> eqRows(eqPtr[numEqn]);
+  std::vector<int> next(eqPtr.begin(), eqPtr.end()-1);
+  for (int r=0; r<numRows; r++)
+    if (rowEqn[r] >= 0 && rowEqn[r] < numEqn)
+      eqRows[next[rowEqn[r]]++] = r;
+
+  // the slots are kept with the nodes for the copies of each step
+  nodeSlotOffsets.swap(slotOfNode);
+  hostState.assign(3*numSlots, 0.0);
+  hostR.assign(numEqn, 0.0);
+
+  std::vector<double> zeroState(3*numSlots, 0.0);
+  std::vector<double> zeroFe(numRows, 0.0);
+  std::vector<double> zeroR(numEqn, 0.0);
+
+  if (toDevice(dRowEle, rowEle) < 0 || toDevice(dEleRow, eleRow) < 0 ||
+      toDevice(dRowSlot, rowSlot) < 0 || toDevice(dEqPtr, eqPtr) < 0 ||
+      toDevice(dEqRows, eqRows) < 0 || toDevice(dEleK, eleK) < 0 ||
+      toDevice(dK, K) < 0 || toDevice(dMass, mass) < 0 ||
+      toDevice(dAlpha, alpha) < 0 || toDevice(dBeta, beta) < 0 ||
+      toDevice(dState, zeroState) < 0 || toDevice(dFe, zeroFe) < 0 ||
+      toDevice(dR, zeroR) < 0) {
+    opserr << "WARNING ExplicitDeviceForces::setModel() - failed to copy the elements to device ";
+    opserr << device << endln;
+    this->freeDevice();
+    return -2;
+  }
+
+  return numEle;
+}
+
+
+bool
+ExplicitDeviceForces::isOnDevice(int feIndex) const
+{
+  if (numEle == 0 || feIndex < 0 || feIndex >= (int)onDevice.size())
+    return false;
+  return onDevice[feIndex] != 0;
+}
+
+
+int
+ExplicitDeviceForces::getNumOnDevice(void) const
+{
+  return numEle;
+}
+
+
+bool
+ExplicitDeviceForces::hasElementLoads(Domain &theDomain)
+{
+  // the ground motion of a uniform excitation and the elemental loads are
+  // added by the elements to their resisting force
+  LoadPatternIter &thePatterns = theDomain.getLoadPatterns();
+  LoadPattern *thePattern;
+  while ((thePattern = thePatterns()) != 0) {
+    if (thePattern->getClassTag() == PATTERN_TAG_UniformExcitation)
+      return true;
+    ElementalLoadIter &theLoads = thePattern->getElementalLoads();
+    if (theLoads() != 0)
+      return true;
+  }
+  return false;
+}
+
+
+int
+ExplicitDeviceForces::addResiduals(Vector &R, Domain &theDomain)
+{
+  if (numEle == 0)
+    return 1;
+
+  if (this->hasElementLoads(theDomain) == true) {
+    if (warned == false) {
+      opserr << "WARNING ExplicitDeviceForces::addResiduals() - elemental loads or a ";
+      opserr << "uniform excitation, the element residuals are formed on the host\n";
+      warned = true;
+    }
+    return 1;
+  }
+
+  if (numEqn == 0)
+    return 0;
+
+  // the nodal state, the trial disp, vel and accel of the nodes in turn,
+  // includes the values the single point constraints impose
+  double *disp = &hostState[0];
+  double *vel = disp + numSlots;
+  double *accel = vel + numSlots;
+  int numNodes = theNodes.size();
+  for (int i=0; i<numNodes; i++) {
+    Node *theNode = theNodes[i];
+    int slot = nodeSlotOffsets[i];
+    const Vector &u = theNode->getTrialDisp();
+    const Vector &v = theNode->getTrialVel();
+    const Vector &a = theNode->getTrialAccel();
+    int ndf = u.Size();
+    for (int j=0; j<ndf; j++) {
+      disp[slot+j] = u(j);
+      vel[slot+j] = v(j);
+      accel[slot+j] = a(j);
+    }
+  }
+
+  if (cudaMemcpy(dState, disp, 3*numSlots*sizeof(double), cudaMemcpyHostToDevice) != cudaSuccess ||
+      explicitDeviceElementForces(numRows, dRowEle, dEleRow, dEleK, dK, dMass, dAlpha, dBeta,
+				  dRowSlot, numSlots, dState, dFe) < 0 ||
+      explicitDeviceAssemble(numEqn, dEqPtr, dEqRows, dFe, dR) < 0 ||
+      cudaMemcpy(&hostR[0], dR, numEqn*sizeof(double), cudaMemcpyDeviceToHost) != cudaSuccess) {
+    opserr << "WARNING ExplicitDeviceForces::addResiduals() - the device failed\n";
+    return -1;
+  }
+
+  int size = R.Size();
+  for (int i=0; i<numEqn && i<size; i++)
+    R(i) += hostR[i];
+
+  return 0;
+}
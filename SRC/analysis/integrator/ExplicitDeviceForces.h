@@ -0,0 +1,102 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/ExplicitDeviceForces.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for ExplicitDeviceForces.
+// ExplicitDeviceForces forms the residuals of the FE_Elements whose elements
+// have a constant tangent, see Element::hasConstantTangent(), on a CUDA
+// device for the lumped step of the explicit integrators, see
+// TransientIntegrator::solveLumped(). The stiffness, lumped mass and Rayleigh
+// factors of those elements stay on the device; each step the trial
+// displacements, velocities and accelerations of their nodes are copied down
+// and the summed residuals of the equations copied back.
+//
+// What: "@(#) ExplicitDeviceForces.h, revA"
+
+#ifndef ExplicitDeviceForces_h
+#define ExplicitDeviceForces_h
+
+#include <vector>
+
+class AnalysisModel;
+class Domain;
+class Node;
+class Vector;
+
+class ExplicitDeviceForces
+{
+  public:
+    ExplicitDeviceForces(int device);
+    ~ExplicitDeviceForces();
+
+    // copies the elements with a constant tangent to the device, returns
+    // the number copied or a negative number if the device failed
+    int setModel(AnalysisModel &theModel);
+
+    // whether the residual of the i-th FE_Element of the FE_EleIter of
+    // the AnalysisModel is formed on the device
+    bool isOnDevice(int feIndex) const;
+    int getNumOnDevice(void) const;
+
+    // adds the residuals of the elements on the device to R; returns 1,
+    // without adding them, while the domain has loads the device does not
+    // form (elemental loads or a uniform excitation), the residuals of all
+    // the FE_Elements are then to be formed on the host
+    int addResiduals(Vector &R, Domain &theDomain);
+
+  private:
+    void freeDevice(void);
+    bool hasElementLoads(Domain &theDomain);
+
+    int device;
+    int numEle, numRows, numEqn, numSlots;
+
+    std::vector<char> onDevice;
+    std::vector<Node *> theNodes;  // the nodes of the elements on the device
+    std::vector<int> nodeSlotOffsets;
+    std::vector<double> hostState; // their trial disp, vel and accel
+    std::vector<double> hostR;
+
+    // the device arrays: the rows of the elements, the stiffness (rows of
+    // each element in turn), the lumped mass of each row, the Rayleigh
+    // factors of each element, the slot of the nodal state of each row and
+    // the rows adding to each equation in the order of the FE_EleIter
+    int *dRowEle, *dEleRow, *dRowSlot, *dEqPtr, *dEqRows;
+    long long *dEleK;
+    double *dK, *dMass, *dAlpha, *dBeta, *dState, *dFe, *dR;
+
+    bool warned;
+};
+
+// the kernels, see ExplicitDeviceKernels.cu
+int explicitDeviceElementForces(int numRows, const int *rowEle, const int *eleRow,
+				const long long *eleK, const double *K,
+				const double *mass, const double *alpha, const double *beta,
+				const int *rowSlot, int numSlots, const double *state,
+				double *fe);
+int explicitDeviceAssemble(int numEqn, const int *eqPtr, const int *eqRows,
+			   const double *fe, double *R);
+
+#endif
@@ -0,0 +1,116 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/analysis/integrator/ExplicitDeviceKernels.cu,v $
+
+// Created: 10/26
+//
+// Description: This file contains the CUDA kernels of ExplicitDeviceForces.
+// One thread forms one row of the residual of an element,
+//   fe = -( K (u + beta v) + m (a + alpha v) ),
+// and one thread then sums the rows adding to an equation in the order of
+// the FE_EleIter, so no atomics are used and the sums do not depend on the
+// order the threads run in.
+//
+// What: "@(#) ExplicitDeviceKernels.cu, revA"
+
+#include <ExplicitDeviceForces.h>
+#include <cuda_runtime.h>
+
+#define EXPLICIT_DEVICE_THREADS 128
+
+__global__ void
+elementForcesKernel(int numRows, const int *rowEle, const int *eleRow,
+		    const long long *eleK, const double *K,
+		    const double *mass, const double *alpha, const double *beta,
+		    const int *rowSlot, int numSlots, const double *state,
+		    double *fe)
+{
+  int r = blockIdx.x*blockDim.x + threadIdx.x;
+  if (r >= numRows)
+    return;
+
+  const double *disp = state;
+  const double *vel = state + numSlots;
+  const double *accel = vel + numSlots;
+
+  int e = rowEle[r];
+  int first = eleRow[e];
+  int n = eleRow[e+1] - first;
+  const double *Kr = K + eleK[e] + (long long)(r-first)*n;
+  double b = beta[e];
+
+  double sum = 0.0;
+  for (int j=0; j<n; j++) {
+    int s = rowSlot[first+j];
+    sum += Kr[j]*(disp[s] + b*vel[s]);
+  }
+
+  int s = rowSlot[r];
+  fe[r] = -(sum + mass[r]*(accel[s] + alpha[e]*vel[s]));
+}
+
+
+__global__ void
+assembleKernel(int numEqn, const int *eqPtr, const int *eqRows,
+	       const double *fe, double *R)
+{
+  int i = blockIdx.x*blockDim.x + threadIdx.x;
+  if (i >= numEqn)
+    return;
+
+  double sum = 0.0;
+  for (int p=eqPtr[i]; p<eqPtr[i+1]; p++)
+    sum += fe[eqRows[p]];
+  R[i] = sum;
+}
+
+
+int
+explicitDeviceElementForces(int numRows, const int *rowEle, const int *eleRow,
+			    const long long *eleK, const double *K,
+			    const double *mass, const double *alpha, const double *beta,
+			    const int *rowSlot, int numSlots, const double *state,
+			    double *fe)
+{
+  if (numRows == 0)
+    return 0;
+
+  int numBlocks = (numRows + EXPLICIT_DEVICE_THREADS - 1)/EXPLICIT_DEVICE_THREADS;
+  elementForcesKernel<<<numBlocks, EXPLICIT_DEVICE_THREADS>>>(numRows, rowEle, eleRow, eleK, K,
+							      mass, alpha, beta, rowSlot,
+							      numSlots, state, fe);
+  return (cudaGetLastError() == cudaSuccess) ? 0 : -1;
+}
+
+
+int
+explicitDeviceAssemble(int numEqn, const int *eqPtr, const int *eqRows,
+		       const double *fe, double *R)
+{
+  if (numEqn == 0)
+    return 0;
+
+  int numBlocks = (numEqn + EXPLICIT_DEVICE_THREADS - 1)/EXPLICIT_DEVICE_THREADS;
+  assembleKernel<<<numBlocks, EXPLICIT_DEVICE_THREADS>>>(numEqn, eqPtr, eqRows, fe, R);
+  return (cudaGetLastError() == cudaSuccess) ? 0 : -1;
+}
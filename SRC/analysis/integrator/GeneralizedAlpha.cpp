@@ -222,6 +222,12 @@ int GeneralizedAlpha::revertToLastStep()
 int GeneralizedAlpha::formEleTangent(FE_Element *theEle)
 {
     theEle->zeroTangent();
+    
+    // with the constant part in the base only the part that varies is added
+    if (splitTangent == true && theEle->isRayleighSplit() == true) {
+        theEle->addKtAndVaryingCtoTang(alphaF*c1, alphaF*c2, statusFlag == INITIAL_TANGENT);
+        return 0;
+    }
     if (statusFlag == CURRENT_TANGENT)  {
         theEle->addKtToTang(alphaF*c1);
         theEle->addCtoTang(alphaF*c2);
@@ -232,6 +238,18 @@ int GeneralizedAlpha::formEleTangent(FE_Element *theEle)
         theEle->addMtoTang(alphaM*c3);
     }
     
+    return 0;
+}
+
+int GeneralizedAlpha::getTangentFactors(double &fK, double &fC, double &fM)
+{
+    if ((statusFlag != CURRENT_TANGENT && statusFlag != INITIAL_TANGENT))
+        return -1;
+    
+    fK = alphaF*c1;
+    fC = alphaF*c2;
+    fM = alphaM*c3;
+    
     return 0;
 }   
  
@@ -381,20 +399,15 @@ int GeneralizedAlpha::update(const Vector &deltaU)
     }
     
     //  determine the response at t+deltaT
-    (*U) += deltaU;
-    Udot->addVector(1.0, deltaU, c2);
-    Udotdot->addVector(1.0, deltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, deltaU, 1.0, c2, c3);
 
     // determine displacement and velocity at t+alphaF*deltaT
-    (*Ualpha) = *Ut;
-    Ualpha->addVector((1.0-alphaF), *U, alphaF);
+    this->interpolateResponse(*Ualpha, *Ut, *U, alphaF);
 
-    (*Ualphadot) = *Utdot;
-    Ualphadot->addVector((1.0-alphaF), *Udot, alphaF);
+    this->interpolateResponse(*Ualphadot, *Utdot, *Udot, alphaF);
 
     // determine the velocities at t+alphaM*deltaT
-    (*Ualphadotdot) = *Utdotdot;
-    Ualphadotdot->addVector((1.0-alphaM), *Udotdot, alphaM);
+    this->interpolateResponse(*Ualphadotdot, *Utdotdot, *Udotdot, alphaM);
 
     
     // update the response at the DOFs
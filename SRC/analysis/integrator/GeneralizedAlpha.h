@@ -71,6 +71,7 @@ public:
     void Print(OPS_Stream &s, int flag = 0);        
     
 protected:
+    int getTangentFactors(double &fK, double &fC, double &fM);
     
 private:
     double alphaM;
@@ -209,6 +209,12 @@ int HHT::revertToLastStep()
 int HHT::formEleTangent(FE_Element *theEle)
 {
     theEle->zeroTangent();
+    
+    // with the constant part in the base only the part that varies is added
+    if (splitTangent == true && theEle->isRayleighSplit() == true) {
+        theEle->addKtAndVaryingCtoTang(alpha*c1, alpha*c2, statusFlag == INITIAL_TANGENT);
+        return 0;
+    }
     if (statusFlag == CURRENT_TANGENT)  {
         theEle->addKtToTang(alpha*c1);
         theEle->addCtoTang(alpha*c2);
@@ -222,6 +228,18 @@ int HHT::formEleTangent(FE_Element *theEle)
     return 0;
 }
 
+int HHT::getTangentFactors(double &fK, double &fC, double &fM)
+{
+    if ((statusFlag != CURRENT_TANGENT && statusFlag != INITIAL_TANGENT))
+        return -1;
+    
+    fK = alpha*c1;
+    fC = alpha*c2;
+    fM = c3;
+    
+    return 0;
+}
+
 
 int HHT::formNodTangent(DOF_Group *theDof)
 {
@@ -370,18 +388,12 @@ int HHT::update(const Vector &deltaU)
     }
     
     //  determine the response at t+deltaT
-    (*U) += deltaU;
-    
-    Udot->addVector(1.0, deltaU, c2);
-    
-    Udotdot->addVector(1.0, deltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, deltaU, 1.0, c2, c3);
     
     // determine displacement and velocity at t+alpha*deltaT
-    (*Ualpha) = *Ut;
-    Ualpha->addVector((1.0-alpha), *U, alpha);
+    this->interpolateResponse(*Ualpha, *Ut, *U, alpha);
     
-    (*Ualphadot) = *Utdot;
-    Ualphadot->addVector((1.0-alpha), *Udot, alpha);
+    this->interpolateResponse(*Ualphadot, *Utdot, *Udot, alpha);
     
     // update the response at the DOFs
     theModel->setResponse(*Ualpha,*Ualphadot,*Udotdot);
@@ -380,21 +380,14 @@ int HHTGeneralized::update(const Vector &deltaU)
     }
     
     //  determine the response at t+deltaT
-    U->addVector(1.0, deltaU, c1);
-    
-    Udot->addVector(1.0, deltaU, c2);
-    
-    Udotdot->addVector(1.0, deltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, deltaU, c1, c2, c3);
     
     // determine response at t+alpha*deltaT
-    (*Ualpha) = *Ut;
-    Ualpha->addVector((1.0-alphaF), *U, alphaF);
+    this->interpolateResponse(*Ualpha, *Ut, *U, alphaF);
     
-    (*Ualphadot) = *Utdot;
-    Ualphadot->addVector((1.0-alphaF), *Udot, alphaF);
+    this->interpolateResponse(*Ualphadot, *Utdot, *Udot, alphaF);
     
-    (*Ualphadotdot) = *Utdotdot;
-    Ualphadotdot->addVector((1.0-alphaI), *Udotdot, alphaI);
+    this->interpolateResponse(*Ualphadotdot, *Utdotdot, *Udotdot, alphaI);
     
     // update the response at the DOFs
     theModel->setResponse(*Ualpha, *Ualphadot, *Ualphadotdot);
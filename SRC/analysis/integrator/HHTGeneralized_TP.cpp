@@ -439,11 +439,7 @@ int HHTGeneralized_TP::update(const Vector &deltaU)
     }
     
     //  determine the response at t+deltaT
-    U->addVector(1.0, deltaU, c1);
-    
-    Udot->addVector(1.0, deltaU, c2);
-    
-    Udotdot->addVector(1.0, deltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, deltaU, c1, c2, c3);
     
     // update the response at the DOFs
     theModel->setResponse(*U, *Udot, *Udotdot);
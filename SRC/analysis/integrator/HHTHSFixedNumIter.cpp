@@ -40,6 +40,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <ConvergenceTest.h>
+#include <RealTimeMonitor.h>
 #include <elementAPI.h>
 #define OPS_Export 
 
@@ -50,43 +51,62 @@ void *    OPS_HHTHSFixedNumIter(void)
     TransientIntegrator *theIntegrator = 0;
     
     int argc = OPS_GetNumRemainingInputArgs();
-    if (argc != 1 && argc != 3 && argc != 4 && argc != 6) {
-        opserr << "WARNING - incorrect number of args want HHTHSFixedNumIter $rhoInf <-polyOrder $O>\n";
-        opserr << "          or HHTHSFixedNumIter $alphaI $alphaF $beta $gamma <-polyOrder $O>\n";
+    if (argc < 1) {
+        opserr << "WARNING - incorrect number of args want HHTHSFixedNumIter $rhoInf <-polyOrder $O> <-realTime $period <-noPace>>\n";
+        opserr << "          or HHTHSFixedNumIter $alphaI $alphaF $beta $gamma <-polyOrder $O> <-realTime $period <-noPace>>\n";
         return 0;
     }
     
     double dData[4];
     int polyOrder = 2;
     bool updDomFlag = true;
-    int numData;
-    if (argc < 4)
-        numData = 1;
-    else
-        numData = 4;
+    double rtPeriod = 0.0;
+    bool rtPace = true;
+    int numData = 0;
+    
+    // count number of numeric parameters
+    while (OPS_GetNumRemainingInputArgs() > 0)  {
+        const char *argvLoc = OPS_GetString();
+        if (argvLoc[0] == '-')
+            break;
+        numData++;
+    }
+    // reset to read from beginning
+    OPS_ResetCurrentInputArg(2);
     
-    if (OPS_GetDouble(&numData, dData) != 0) {
-        opserr << "WARNING - invalid args want HHTHSFixedNumIter $rhoInf <-polyOrder $O>\n";
-        opserr << "          or HHTHSFixedNumIter $alphaI $alphaF $beta $gamma <-polyOrder $O>\n";
+    if ((numData != 1 && numData != 4) || OPS_GetDouble(&numData, dData) != 0) {
+        opserr << "WARNING - invalid args want HHTHSFixedNumIter $rhoInf <-polyOrder $O> <-realTime $period <-noPace>>\n";
+        opserr << "          or HHTHSFixedNumIter $alphaI $alphaF $beta $gamma <-polyOrder $O> <-realTime $period <-noPace>>\n";
         return 0;
     }
     
-    if (argc == 3 || argc == 6) {
+    while (OPS_GetNumRemainingInputArgs() > 0)  {
         const char *argvLoc = OPS_GetString();
+        int numOne = 1;
         if (strcmp(argvLoc, "-polyOrder") == 0) {
-            numData = 1;
-            if (OPS_GetInt(&numData, &polyOrder) != 0) {
+            if (OPS_GetInt(&numOne, &polyOrder) != 0) {
                 opserr << "WARNING - invalid polyOrder want HHTHSFixedNumIter $rhoInf <-polyOrder $O>\n";
                 opserr << "          or HHTHSFixedNumIter $alphaI $alphaF $beta $gamma <-polyOrder $O>\n";
             }
         }
+        else if (strcmp(argvLoc, "-realTime") == 0) {
+            if (OPS_GetDouble(&numOne, &rtPeriod) != 0 || rtPeriod <= 0.0) {
+                opserr << "WARNING - invalid period want HHTHSFixedNumIter ... -realTime $period\n";
+                return 0;
+            }
+        }
+        else if (strcmp(argvLoc, "-noPace") == 0)
+            rtPace = false;
     }
     
-    if (argc < 4)
+    if (numData == 1)
         theIntegrator = new HHTHSFixedNumIter(dData[0], polyOrder, updDomFlag);
     else
         theIntegrator = new HHTHSFixedNumIter(dData[0], dData[1], dData[2], dData[3], polyOrder, updDomFlag);
     
+    if (theIntegrator != 0 && rtPeriod > 0.0)
+        ((HHTHSFixedNumIter *)theIntegrator)->setRealTime(rtPeriod, rtPace);
+    
     if (theIntegrator == 0)
         opserr << "WARNING - out of memory creating HHTHSFixedNumIter integrator\n";
     
@@ -101,7 +121,7 @@ HHTHSFixedNumIter::HHTHSFixedNumIter()
     deltaT(0.0), c1(0.0), c2(0.0), c3(0.0), x(1.0),
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
     Ualpha(0), Ualphadot(0), Ualphadotdot(0),
-    Utm1(0), Utm2(0), scaledDeltaU(0)
+    Utm1(0), Utm2(0), scaledDeltaU(0), theMonitor(0)
 {
     
 }
@@ -116,7 +136,7 @@ HHTHSFixedNumIter::HHTHSFixedNumIter(double _rhoInf,
     deltaT(0.0), c1(0.0), c2(0.0), c3(0.0), x(1.0),
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
     Ualpha(0), Ualphadot(0), Ualphadotdot(0),
-    Utm1(0), Utm2(0), scaledDeltaU(0)
+    Utm1(0), Utm2(0), scaledDeltaU(0), theMonitor(0)
 {
     
 }
@@ -130,7 +150,7 @@ HHTHSFixedNumIter::HHTHSFixedNumIter(double _alphaI, double _alphaF,
     deltaT(0.0), c1(0.0), c2(0.0), c3(0.0), x(1.0),
     Ut(0), Utdot(0), Utdotdot(0), U(0), Udot(0), Udotdot(0),
     Ualpha(0), Ualphadot(0), Ualphadotdot(0),
-    Utm1(0), Utm2(0), scaledDeltaU(0)
+    Utm1(0), Utm2(0), scaledDeltaU(0), theMonitor(0)
 {
     
 }
@@ -163,6 +183,28 @@ HHTHSFixedNumIter::~HHTHSFixedNumIter()
         delete Utm2;
     if (scaledDeltaU != 0)
         delete scaledDeltaU;
+    
+    // report the timing of a real-time run
+    if (theMonitor != 0)  {
+        if (theMonitor->getNumSteps() > 0)  {
+            opserr << "HHTHSFixedNumIter - real time summary\n";
+            theMonitor->Print(opserr);
+        }
+        delete theMonitor;
+    }
+}
+
+
+int HHTHSFixedNumIter::setRealTime(double period, bool pace)
+{
+    if (theMonitor != 0)
+        delete theMonitor;
+    theMonitor = 0;
+    
+    if (period > 0.0)
+        theMonitor = new RealTimeMonitor(period, pace);
+    
+    return 0;
 }
 
 
@@ -194,6 +236,10 @@ int HHTHSFixedNumIter::newStep(double _deltaT)
         return -3;
     }
     
+    // start the wall clock of a real-time run
+    if (theMonitor != 0)
+        theMonitor->startStep();
+    
     // set response at t to be that at t+deltaT of previous step
     (*Utm2) = *Utm1;
     (*Utm1) = *Ut;
@@ -463,21 +509,14 @@ int HHTHSFixedNumIter::update(const Vector &deltaU)
     }
     
     // determine the response at t+deltaT
-    U->addVector(1.0, *scaledDeltaU, c1);
-    
-    Udot->addVector(1.0, *scaledDeltaU, c2);
-    
-    Udotdot->addVector(1.0, *scaledDeltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, *scaledDeltaU, c1, c2, c3);
     
     // determine response at t+alpha*deltaT
-    (*Ualpha) = *Ut;
-    Ualpha->addVector((1.0-alphaF), *U, alphaF);
+    this->interpolateResponse(*Ualpha, *Ut, *U, alphaF);
     
-    (*Ualphadot) = *Utdot;
-    Ualphadot->addVector((1.0-alphaF), *Udot, alphaF);
+    this->interpolateResponse(*Ualphadot, *Utdot, *Udot, alphaF);
     
-    (*Ualphadotdot) = *Utdotdot;
-    Ualphadotdot->addVector((1.0-alphaI), *Udotdot, alphaI);
+    this->interpolateResponse(*Ualphadotdot, *Utdotdot, *Udotdot, alphaI);
     
     // update the response at the DOFs
     theModel->setResponse(*Ualpha, *Ualphadot, *Ualphadotdot);
@@ -534,7 +573,13 @@ int HHTHSFixedNumIter::commit(void)
     time += (1.0-alphaF)*deltaT;
     theModel->setCurrentDomainTime(time);
     
-    return theModel->commitDomain();
+    int res = theModel->commitDomain();
+    
+    // hold the step until its real-time deadline
+    if (theMonitor != 0)
+        theMonitor->endStep();
+    
+    return res;
 }
 
 
@@ -596,6 +641,8 @@ void HHTHSFixedNumIter::Print(OPS_Stream &s, int flag)
             s << "  update Domain: yes\n";
         else
             s << "  update Domain: no\n";
+        if (theMonitor != 0)
+            theMonitor->Print(s, flag);
     } else
         s << "HHTHSFixedNumIter - no associated AnalysisModel\n";
 }
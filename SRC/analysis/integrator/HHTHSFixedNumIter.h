@@ -43,6 +43,7 @@
 class DOF_Group;
 class FE_Element;
 class Vector;
+class RealTimeMonitor;
 
 class HHTHSFixedNumIter : public TransientIntegrator
 {
@@ -69,6 +70,9 @@ public:
     int update(const Vector &deltaU);
     int commit(void);
     
+    // wall clock period of a real-time hybrid simulation, 0 to turn off
+    int setRealTime(double period, bool pace = true);
+    
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
     
@@ -92,6 +96,8 @@ private:
     Vector *Ualpha, *Ualphadot, *Ualphadotdot;  // response quantities at time t+alpha*deltaT
     Vector *Utm1, *Utm2;                        // disp at time t-deltaT and t-2*deltaT
     Vector *scaledDeltaU;                       // scaled displacement increment
+    
+    RealTimeMonitor *theMonitor;                // step timing of a real-time run
 };
 
 #endif
@@ -516,11 +516,7 @@ int HHTHSFixedNumIter_TP::update(const Vector &deltaU)
     }
     
     // determine the response at t+deltaT
-    U->addVector(1.0, *scaledDeltaU, c1);
-    
-    Udot->addVector(1.0, *scaledDeltaU, c2);
-    
-    Udotdot->addVector(1.0, *scaledDeltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, *scaledDeltaU, c1, c2, c3);
     
     // update the response at the DOFs
     theModel->setResponse(*U, *Udot, *Udotdot);
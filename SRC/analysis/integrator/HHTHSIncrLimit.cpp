@@ -419,21 +419,14 @@ int HHTHSIncrLimit::update(const Vector &deltaU)
         (*scaledDeltaU) = scale*deltaU;
     
     // determine the response at t+deltaT
-    U->addVector(1.0, *scaledDeltaU, c1);
-    
-    Udot->addVector(1.0, *scaledDeltaU, c2);
-    
-    Udotdot->addVector(1.0, *scaledDeltaU, c3);
+    this->updateResponse(*U, *Udot, *Udotdot, *scaledDeltaU, c1, c2, c3);
     
     // determine response at t+alpha*deltaT
-    (*Ualpha) = *Ut;
-    Ualpha->addVector((1.0-alphaF), *U, alphaF);
+    this->interpolateResponse(*Ualpha, *Ut, *U, alphaF);
     
-    (*Ualphadot) = *Utdot;
-    Ualphadot->addVector((1.0-alphaF), *Udot, alphaF);
+    this->interpolateResponse(*Ualphadot, *Utdot, *Udot, alphaF);
     
-    (*Ualphadotdot) = *Utdotdot;
-    Ualphadotdot->addVector((1.0-alphaI), *Udotdot, alphaI);
+    this->interpolateResponse(*Ualphadotdot, *Utdotdot, *Udotdot, alphaI);
     
     // update the response at the DOFs
     theModel->setResponse(*Ualpha, *Ualphadot, *Ualphadotdot);
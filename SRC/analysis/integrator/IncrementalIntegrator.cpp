@@ -32,6 +32,8 @@
 
 #include <IncrementalIntegrator.h>
 #include <FE_Element.h>
+#include <Element.h>
+#include <Parameter.h>
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
 #include <Vector.h>
@@ -39,14 +41,41 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 #include <EigenSOE.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Profiler.h>
+#include <ThreadPool.h>
+#include <SparseGenColLinSOE.h>
+#include <SparseGenRowLinSOE.h>
+#include <UmfpackGenLinSOE.h>
 #include <cmath>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef _WIN32
+extern "C" int DGEMV(char *trans, int *M, int *N, double *alpha, double *A,
+		     int *lda, double *X, int *incX, double *beta, double *Y,
+		     int *incY);
+#else
+extern "C" int dgemv_(char *trans, int *M, int *N, double *alpha, double *A,
+		      int *lda, double *X, int *incX, double *beta, double *Y,
+		      int *incY);
+#endif
+
+int IncrementalIntegrator::defaultNumThreads = 1;
+
 IncrementalIntegrator::IncrementalIntegrator(int clasTag)
 :Integrator(clasTag),
  statusFlag(CURRENT_TANGENT), theEigenSOE(0), 
  eigenVectors(0), eigenValues(0), dampingForces(0),isDiagonal(false),diagMass(0),
  mV(0),tmpV1(0),tmpV2(0),
- theSOE(0), theAnalysisModel(0), theTest(0)
+ theSOE(0), theAnalysisModel(0), theTest(0),
+ numThreads(defaultNumThreads), numThreadedFEs(0), sizeThreadedFEs(0),
+ theThreadedFEs(0), theThreadedTangents(0), theThreadedResiduals(0),
+ skipLinearFEs(false), linearBaseKept(false), linearFE_Stamp(0),
+ linearActivationStamp(0), linearParameterStamp(0), linearStatusFlag(CURRENT_TANGENT)
 {
   
 }
@@ -65,6 +94,19 @@ IncrementalIntegrator::~IncrementalIntegrator()
     delete tmpV1;
   if (tmpV2 != 0)
     delete tmpV2;
+
+  for (int i=0; i<sizeThreadedFEs; i++) {
+    if (theThreadedTangents[i] != 0)
+      delete theThreadedTangents[i];
+    if (theThreadedResiduals[i] != 0)
+      delete theThreadedResiduals[i];
+  }
+  if (theThreadedFEs != 0)
+    delete [] theThreadedFEs;
+  if (theThreadedTangents != 0)
+    delete [] theThreadedTangents;
+  if (theThreadedResiduals != 0)
+    delete [] theThreadedResiduals;
 }
 
 void
@@ -73,6 +115,9 @@ IncrementalIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, C
     theAnalysisModel = &theModel;
     theSOE = &theLinSOE;
     theTest = theConvergenceTest;
+
+    // a base kept for another model is not one for this
+    linearBaseKept = false;
 }
 
 
@@ -93,25 +138,195 @@ IncrementalIntegrator::formTangent(int statFlag)
 	return -1;
     }
 
-    // zero the A matrix of the linearSOE
-    theSOE->zeroA();
+    Profiler::begin(PROFILE_TANGENT);
+
+    // start from the tangents of the linear FE_Elements if there are
+    // any, otherwise zero the A matrix of the linearSOE
+    if (this->formLinearBase() == 0)
+      skipLinearFEs = true;
+    else
+      theSOE->zeroA();
+
+    // no modal damping in a static tangent
+    theSOE->setLowRankUpdate(0, 0, 0);
 
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations - CHANGE
 
     // loop through the FE_Elements adding their contributions to the tangent
+    if (this->formElementTangent() < 0)
+      result = -3;
+
+    skipLinearFEs = false;
+
+    Profiler::end(PROFILE_TANGENT);
+
+    return result;
+}
+
+// sets A to the sum of the tangents of the linear FE_Elements: the sum is
+// formed once and kept by the LinearSOE, and set again with restoreA()
+// while neither the FE_Elements of the AnalysisModel, the active elements
+// nor a parameter have changed and the statusFlag is the same. The LinearSOE
+// drops the base when it is sized again or told of new FE_Elements.
+// Returns 0 if A holds the sum, -1 if there are no linear FE_Elements and
+// A is untouched.
+
+int
+IncrementalIntegrator::formLinearBase(void)
+{
     FE_Element *elePtr;
-    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
-    while((elePtr = theEles2()) != 0)     
+    int numLinear = 0;
+    FE_EleIter &theEles = theAnalysisModel->getFEs();
+    while ((elePtr = theEles()) != 0)
+      if (elePtr->isLinear())
+	numLinear++;
+
+    if (numLinear == 0) {
+      linearBaseKept = false;
+      return -1;
+    }
+
+    int feStamp = theAnalysisModel->getFE_Stamp();
+    int activationStamp = Element::getActivationStamp();
+    int parameterStamp = Parameter::getUpdateStamp();
+    if (linearBaseKept == true && feStamp == linearFE_Stamp &&
+	activationStamp == linearActivationStamp &&
+	parameterStamp == linearParameterStamp &&
+	statusFlag == linearStatusFlag && theSOE->restoreA() == 0)
+      return 0;
+
+    theSOE->zeroA();
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();
+    while ((elePtr = theEles2()) != 0)
+      if (elePtr->isLinear())
 	if (theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
+	  opserr << "WARNING IncrementalIntegrator::formTangent -";
+	  opserr << " failed in addA for ID " << elePtr->getID();
+	}
+
+    // if the LinearSOE does not keep a base the sum is formed every time
+    linearBaseKept = (theSOE->saveA() == 0);
+    linearFE_Stamp = feStamp;
+    linearActivationStamp = activationStamp;
+    linearParameterStamp = parameterStamp;
+    linearStatusFlag = statusFlag;
+
+    return 0;
+}
+
+int 
+IncrementalIntegrator::formElementTangent(void)
+{
+    int result = 0;
+    FE_Element *elePtr;
+
+    int numT = this->getNumThreads();
+    if (numT > 1 && this->setThreadedFEs() > 0) {
+
+      // have the threads form the tangents, each into its own matrix
+      int numFE = numThreadedFEs;
+      const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for private(elePtr) schedule(runtime) num_threads(numT)
+#endif
+      for (int i=0; i<numFE; i++) {
+	theGlobals.set();
+	elePtr = theThreadedFEs[i];
+	if (skipLinearFEs == false || elePtr->isLinear() == false)
+	  *theThreadedTangents[i] = elePtr->getTangent(this);
+      }
+
+      // add them to the system in the same order as the serial loop
+      for (int j=0; j<numFE; j++) {
+	elePtr = theThreadedFEs[j];
+	if (skipLinearFEs == true && elePtr->isLinear() == true)
+	  continue;
+	if (theSOE->addA(*theThreadedTangents[j],elePtr->getID()) < 0) {
+	    opserr << "WARNING IncrementalIntegrator::formTangent -";
+	    opserr << " failed in addA for ID " << elePtr->getID();	    
+	    result = -3;
+	}
+      }
+      return result;
+    }
+
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+    while((elePtr = theEles2()) != 0) {
+	if (skipLinearFEs == true && elePtr->isLinear() == true)
+	  continue;
+	// the profiler times each element
+	const Matrix &theTangent = (Profiler::active == false) ?
+	  elePtr->getTangent(this) : Profiler::getTangent(*elePtr, this);
+	if (theSOE->addA(theTangent,elePtr->getID()) < 0) {
 	    opserr << "WARNING IncrementalIntegrator::formTangent -";
 	    opserr << " failed in addA for ID " << elePtr->getID();	    
 	    result = -3;
 	}
+    }
 
     return result;
 }
 
+// the loop of formElementTangent(fK, fC, fM, split) for a LinearSOE of class
+// SOE; the tangents are formed by the FE_Elements without a call back to the
+// integrator and added by a call to SOE::addA() the compiler can inline
+
+template <class SOE>
+static int
+addTransientTangents(SOE &theSOE, const ComponentRange<FE_Element> &theEles,
+		     Integrator *theIntegrator, double fK, double fC, double fM,
+		     bool initial, bool split, bool skipLinear)
+{
+  int result = 0;
+  int numFE = theEles.size();
+  for (int i=0; i<numFE; i++) {
+    FE_Element *elePtr = theEles[i];
+    if (skipLinear == true && elePtr->isLinear() == true)
+      continue;
+    const Matrix &theTangent = (elePtr->isDirect() == true) ?
+      elePtr->getTransientTangent(fK, fC, fM, initial, split) :
+      elePtr->getTangent(theIntegrator);
+    if (theSOE.SOE::addA(theTangent, elePtr->getID()) < 0) {
+      opserr << "WARNING IncrementalIntegrator::formTangent -";
+      opserr << " failed in addA for ID " << elePtr->getID();	    
+      result = -3;
+    }
+  }
+  return result;
+}
+
+// adds the tangents fK K + fC C + fM M of the FE_Elements of a transient
+// integrator whose formEleTangent() forms no more than that, see
+// FE_Element::getTransientTangent(); returns 1 without adding anything if
+// the class of the LinearSOE has no specialized loop, or the tangents are
+// formed by threads or timed by the profiler, formElementTangent() is then
+// to be called.
+
+int
+IncrementalIntegrator::formElementTangent(double fK, double fC, double fM, bool split)
+{
+  if (this->getNumThreads() > 1 || Profiler::active == true)
+    return 1;
+
+  ComponentRange<FE_Element> theEles = theAnalysisModel->getFE_Range();
+  bool initial = (statusFlag == INITIAL_TANGENT);
+
+  switch (theSOE->getClassTag()) {
+  case LinSOE_TAGS_SparseGenColLinSOE:
+    return addTransientTangents(*(SparseGenColLinSOE *)theSOE, theEles, this,
+				fK, fC, fM, initial, split, skipLinearFEs);
+  case LinSOE_TAGS_SparseGenRowLinSOE:
+    return addTransientTangents(*(SparseGenRowLinSOE *)theSOE, theEles, this,
+				fK, fC, fM, initial, split, skipLinearFEs);
+  case LinSOE_TAGS_UmfpackGenLinSOE:
+    return addTransientTangents(*(UmfpackGenLinSOE *)theSOE, theEles, this,
+				fK, fC, fM, initial, split, skipLinearFEs);
+  default:
+    return 1;
+  }
+}
+
 int
 IncrementalIntegrator::formIndependentSensitivityLHS(int statFlag)
 {
@@ -129,18 +344,24 @@ IncrementalIntegrator::formUnbalance(void)
     
     theSOE->zeroB();
 
+    Profiler::begin(PROFILE_UNBALANCE);
+
     if (this->formElementResidual() < 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance ";
 	opserr << " - this->formElementResidual failed\n";
+	Profiler::end(PROFILE_UNBALANCE);
 	return -1;
     }
     
     if (this->formNodalUnbalance() < 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance ";
 	opserr << " - this->formNodalUnbalance failed\n";
+	Profiler::end(PROFILE_UNBALANCE);
 	return -2;
     }    
 
+    Profiler::end(PROFILE_UNBALANCE);
+
     return 0;
 }
     
@@ -207,13 +428,16 @@ IncrementalIntegrator::revertToLastStep(void)
   return 0;
 }   
 
+// the integrators keeping the response of the last step take it again
+// from the DOF_Groups, which the domain has reverted to the start; the
+// vectors are not reallocated as the size of the system is unchanged
 int
 IncrementalIntegrator::revertToStart()
 {
-  opserr << "ERROR: revertToStart() method not yet implemented " << endln
-	 << " for the chosen type of integrator. " << endln;
-  
-  return 0;
+  if (this->getAnalysisModel() == 0 || theSOE == 0)
+    return 0;
+
+  return this->domainChanged();
 }    
 
 LinearSOE *
@@ -263,10 +487,39 @@ IncrementalIntegrator::formElementResidual(void)
 
     int res = 0;    
 
+    int numT = this->getNumThreads();
+    if (numT > 1 && this->setThreadedFEs() > 0) {
+
+      // have the threads form the residuals, each into its own vector
+      int numFE = numThreadedFEs;
+      const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for private(elePtr) schedule(runtime) num_threads(numT)
+#endif
+      for (int i=0; i<numFE; i++) {
+	theGlobals.set();
+	elePtr = theThreadedFEs[i];
+	*theThreadedResiduals[i] = elePtr->getResidual(this);
+      }
+
+      // add them to the system in the same order as the serial loop
+      for (int j=0; j<numFE; j++) {
+	elePtr = theThreadedFEs[j];
+	if (theSOE->addB(*theThreadedResiduals[j],elePtr->getID()) <0) {
+	    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
+	    opserr << " failed in addB for ID " << elePtr->getID();
+	    res = -2;
+	}
+      }
+      return res;
+    }
+
     FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
     while((elePtr = theEles2()) != 0) {
 
-	if (theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0) {
+	const Vector &theResidual = (Profiler::active == false) ?
+	  elePtr->getResidual(this) : Profiler::getResidual(*elePtr, this);
+	if (theSOE->addB(theResidual,elePtr->getID()) <0) {
 	    opserr << "WARNING IncrementalIntegrator::formElementResidual -";
 	    opserr << " failed in addB for ID " << elePtr->getID();
 	    res = -2;
@@ -276,6 +529,186 @@ IncrementalIntegrator::formElementResidual(void)
     return res;	    
 }
 
+int
+IncrementalIntegrator::addElementResiduals(Vector &R)
+{
+    // as formElementResidual() but the residuals are added to R and not
+    // the LinearSOE, no LinearSOE need be involved
+    FE_Element *elePtr;
+    int res = 0;
+    int size = R.Size();
+
+    int numT = this->getNumThreads();
+    if (numT > 1 && this->setThreadedFEs() > 0) {
+
+      int numFE = numThreadedFEs;
+      const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for private(elePtr) schedule(runtime) num_threads(numT)
+#endif
+      for (int i=0; i<numFE; i++) {
+	theGlobals.set();
+	elePtr = theThreadedFEs[i];
+	*theThreadedResiduals[i] = elePtr->getResidual(this);
+      }
+
+      for (int j=0; j<numFE; j++) {
+	const ID &id = theThreadedFEs[j]->getID();
+	const Vector &r = *theThreadedResiduals[j];
+	int idSize = id.Size();
+	for (int k=0; k<idSize; k++) {
+	  int loc = id(k);
+	  if (loc >= 0 && loc < size)
+	    R(loc) += r(k);
+	}
+      }
+      return res;
+    }
+
+    FE_EleIter &theEles2 = theAnalysisModel->getFEs();    
+    while((elePtr = theEles2()) != 0) {
+      const ID &id = elePtr->getID();
+      const Vector &r = elePtr->getResidual(this);
+      int idSize = id.Size();
+      if (r.Size() != idSize) {
+	opserr << "WARNING IncrementalIntegrator::addElementResiduals -";
+	opserr << " residual and ID not of similar sizes for ID " << id;
+	res = -2;
+	continue;
+      }
+      for (int k=0; k<idSize; k++) {
+	int loc = id(k);
+	if (loc >= 0 && loc < size)
+	  R(loc) += r(k);
+      }
+    }
+
+    return res;
+}
+
+bool
+IncrementalIntegrator::isLumped(void)
+{
+  return false;
+}
+
+int
+IncrementalIntegrator::solveLumped(int statFlag, bool formDiagonal)
+{
+  // the system is formed and solved in the LinearSOE
+  return 1;
+}
+
+int
+IncrementalIntegrator::setNumThreads(int numT)
+{
+  // 0 takes the number set with the threads command; as not all the
+  // elements are re-entrant the default stays 1
+  if (numT < 0)
+    numT = 0;
+
+#ifndef _OPENMP
+  if (numT > 1) {
+    opserr << "WARNING IncrementalIntegrator::setNumThreads() - ";
+    opserr << "not compiled with OpenMP, using 1 thread\n";
+    numT = 1;
+  }
+#endif
+
+  numThreads = numT;
+  return 0;
+}
+
+int
+IncrementalIntegrator::getNumThreads(void) const
+{
+  if (numThreads == 0)
+    return ThreadPool::getNumThreads();
+  return numThreads;
+}
+
+void
+IncrementalIntegrator::setDefaultNumThreads(int numT)
+{
+  if (numT >= 0)
+    defaultNumThreads = numT;
+}
+
+int
+IncrementalIntegrator::setThreadedFEs(void)
+{
+  if (theAnalysisModel == 0)
+    return 0;
+
+  // the FE_Elements are gathered every call, the AnalysisModel may have 
+  // changed without the integrator being informed; the matrices and vectors
+  // are only reallocated if the size for a location changes
+  int numFE = theAnalysisModel->getNumFE_Elements();
+
+  if (numFE > sizeThreadedFEs) {
+    FE_Element **newFEs = new FE_Element *[numFE];
+    Matrix **newTangents = new Matrix *[numFE];
+    Vector **newResiduals = new Vector *[numFE];
+    for (int i=0; i<sizeThreadedFEs; i++) {
+      newTangents[i] = theThreadedTangents[i];
+      newResiduals[i] = theThreadedResiduals[i];
+    }
+    for (int j=sizeThreadedFEs; j<numFE; j++) {
+      newTangents[j] = 0;
+      newResiduals[j] = 0;
+    }
+    if (theThreadedFEs != 0)
+      delete [] theThreadedFEs;
+    if (theThreadedTangents != 0)
+      delete [] theThreadedTangents;
+    if (theThreadedResiduals != 0)
+      delete [] theThreadedResiduals;
+
+    theThreadedFEs = newFEs;
+    theThreadedTangents = newTangents;
+    theThreadedResiduals = newResiduals;
+    sizeThreadedFEs = numFE;
+  }
+
+  numThreadedFEs = 0;
+  int numNew = 0;
+  ComponentRange<FE_Element> theEles = theAnalysisModel->getFE_Range();
+  for (int i=0; i<theEles.size() && numThreadedFEs < sizeThreadedFEs; i++) {
+    FE_Element *elePtr = theEles[i];
+    int numDOF = elePtr->getID().Size();
+    int loc = numThreadedFEs++;
+    theThreadedFEs[loc] = elePtr;
+    if (theThreadedTangents[loc] == 0 || theThreadedTangents[loc]->noRows() != numDOF) {
+      if (theThreadedTangents[loc] != 0)
+	delete theThreadedTangents[loc];
+      if (theThreadedResiduals[loc] != 0)
+	delete theThreadedResiduals[loc];
+      theThreadedTangents[loc] = 0;
+      theThreadedResiduals[loc] = 0;
+      numNew++;
+    }
+  }
+
+  // the new matrices and vectors are allocated in the schedule of the
+  // element loops, with the threads pinned by the thread that uses them
+  if (numNew != 0) {
+    int numFE = numThreadedFEs;
+#ifdef _OPENMP
+    int numT = (ThreadPool::isPinned() == true) ? this->getNumThreads() : 1;
+#pragma omp parallel for schedule(runtime) num_threads(numT) if (numT > 1)
+#endif
+    for (int i=0; i<numFE; i++) {
+      if (theThreadedTangents[i] == 0) {
+	int numDOF = theThreadedFEs[i]->getID().Size();
+	theThreadedTangents[i] = new Matrix(numDOF, numDOF);
+	theThreadedResiduals[i] = new Vector(numDOF);
+      }
+    }
+  }
+
+  return numThreadedFEs;
+}
+
 /*
 int
 IncrementalIntegrator::setModalDampingFactors(const Vector &factors)
@@ -481,6 +914,7 @@ IncrementalIntegrator::setupModal(const Vector *modalDampingValues)
       Vector v2(mEigenVectorI,numDOF);
       this->doMv(v1, v2);    
     }
+    delete [] eigenVectors;
     eigenVectors = eigenVectors2;
   }
 
@@ -510,34 +944,43 @@ IncrementalIntegrator::addModalDampingForce(const Vector *modalDampingValues)
     this->setupModal(modalDampingValues);
   }
 
+  if (numModes == 0 || numDOF == 0)
+    return 0;
 
-  const Vector &vel = this->getVel();
-  dampingForces->Zero();
+  // the damping force -(M Phi) diag(2 zeta wn) (M Phi)^T v in two
+  // matrix vector products, C itself is never formed
+  Vector vel(this->getVel());
+  Vector beta(numModes);
+  char charT = 'T';
+  char charN = 'N';
+  int inc = 1;
+  double one = 1.0;
+  double zero = 0.0;
+#ifdef _WIN32
+  DGEMV(&charT, &numDOF, &numModes, &one, eigenVectors, &numDOF, 
+	&vel(0), &inc, &zero, &beta(0), &inc);
+#else
+  dgemv_(&charT, &numDOF, &numModes, &one, eigenVectors, &numDOF, 
+	 &vel(0), &inc, &zero, &beta(0), &inc);
+#endif
 
   for (int i=0; i<numModes; i++) {
-
     double eigenvalue = (*eigenValues)(i);
-    if (eigenvalue > 0) {
-      double wn = sqrt(eigenvalue);
-      double *eigenVectorI = &eigenVectors[numDOF*i];
-      double beta = 0.0;
-      
-      for (int j=0; j<numDOF; j++) {
-	double eij = eigenVectorI[j];
-	if (eij != 0)
-	  beta += eij * vel(j);
-      }
-      
-      beta = -2.0 * (*modalDampingValues)(i) * wn * beta;
-
-      for (int j=0; j<numDOF; j++) {
-	double eij = eigenVectorI[j];
-	if (eij != 0)
-	  (*dampingForces)(j) += beta * eij;
-      }
-    }
+    if (eigenvalue > 0)
+      beta(i) *= -2.0 * (*modalDampingValues)(i) * sqrt(eigenvalue);
+    else
+      beta(i) = 0.0;
   }
 
+  dampingForces->Zero();
+#ifdef _WIN32
+  DGEMV(&charN, &numDOF, &numModes, &one, eigenVectors, &numDOF, 
+	&beta(0), &inc, &zero, &(*dampingForces)(0), &inc);
+#else
+  dgemv_(&charN, &numDOF, &numModes, &one, eigenVectors, &numDOF, 
+	 &beta(0), &inc, &zero, &(*dampingForces)(0), &inc);
+#endif
+
   theSOE->setB(*dampingForces);
   
   return res;
@@ -570,6 +1013,20 @@ IncrementalIntegrator::addModalDampingMatrix(const Vector *modalDampingValues) {
     this->setupModal(modalDampingValues);
   }
 
+  // cFactor (M Phi) diag(2 zeta wn) (M Phi)^T is of rank numModes; it is
+  // given to the LinearSOE as a low rank update of A so that A keeps the
+  // sparsity of the model
+  Vector factors(numModes);
+  for (int i=0; i<numModes; i++) {
+    double eigenvalue = (*eigenValues)(i);
+    if (eigenvalue > 0)
+      factors(i) = 2.0 * (*modalDampingValues)(i) * sqrt(eigenvalue) * cFactor;
+  }
+  if (numModes > 0 && 
+      theSOE->setLowRankUpdate(eigenVectors, &factors(0), numModes) == 0)
+    return 0;
+
+  // the system cannot take one, the columns of the matrix are added
   for (int dof = 0; dof<numDOF; dof++) {
     dampingForces->Zero();
     bool zeroCol = true;
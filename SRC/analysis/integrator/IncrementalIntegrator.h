@@ -45,6 +45,7 @@ class ConvergenceTest;
 class FE_Element;
 class DOF_Group;
 class Vector;
+class Matrix;
 
 #define CURRENT_TANGENT 0
 #define INITIAL_TANGENT 1
@@ -99,6 +100,20 @@ class IncrementalIntegrator : public Integrator
     
     // method introduced for domain decomposition
     virtual int getLastResponse(Vector &result, const ID &id);
+
+    // methods to have the element contributions formed by several threads,
+    // 0 for as many as set with the threads command
+    int setNumThreads(int numThreads);
+    int getNumThreads(void) const;
+
+    // the number new integrators start with, 1 unless changed, as it is
+    // by an ActorSubdomain for all the integrators of its process
+    static void setDefaultNumThreads(int numThreads);
+
+    // methods for an explicit integrator to take the step without the
+    // LinearSOE when the system it forms is diagonal, see TransientIntegrator
+    virtual bool isLumped(void);
+    virtual int solveLumped(int statusFlag, bool formDiagonal);
     
   protected:
     LinearSOE *getLinearSOE(void) const;
@@ -107,6 +122,9 @@ class IncrementalIntegrator : public Integrator
 
     virtual int  formNodalUnbalance(void);        
     virtual int  formElementResidual(void);            
+    int formElementTangent(void);
+    int formElementTangent(double fK, double fC, double fM, bool split);
+    int addElementResiduals(Vector &R);
     int statusFlag;
 
     //    Vector *modalDampingValues;
@@ -121,10 +139,31 @@ class IncrementalIntegrator : public Integrator
     Vector *tmpV2;
     
   private:
+    int setThreadedFEs(void);
+    int formLinearBase(void);
+
     LinearSOE *theSOE;
     AnalysisModel *theAnalysisModel;
     ConvergenceTest *theTest;
 
+    // storage for the threaded formation of element contributions; each
+    // FE_Element's tangent & residual is copied to its own Matrix & Vector
+    // by the threads and then added to the SOE in FE_EleIter order
+    int numThreads;
+    static int defaultNumThreads;
+    int numThreadedFEs, sizeThreadedFEs;
+    FE_Element **theThreadedFEs;
+    Matrix **theThreadedTangents;
+    Vector **theThreadedResiduals;
+
+    // the tangents of linear FE_Elements are added to A once and kept by
+    // the LinearSOE as the base A starts from, see formTangent()
+    bool skipLinearFEs;         // formElementTangent() leaves them out
+    bool linearBaseKept;        // the LinearSOE holds the base
+    int linearFE_Stamp;         // AnalysisModel FE stamp of the base
+    int linearActivationStamp;  // Element activation stamp of the base
+    int linearParameterStamp;   // Parameter update stamp of the base
+    int linearStatusFlag;       // statusFlag the base was formed for
 };
 
 #endif
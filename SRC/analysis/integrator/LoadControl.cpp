@@ -40,6 +40,7 @@
 #include <AnalysisModel.h>
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <Matrix.h>
 #include <Channel.h>
 #include <FE_Element.h>
 #include <FE_EleIter.h>
@@ -134,6 +135,20 @@ LoadControl::newStep(void)
      return 0;
 }
     
+int
+LoadControl::scaleIncrement(double factor)
+{
+  double oldDeltaLambda = deltaLambda;
+
+  deltaLambda *= factor;
+  if (deltaLambda < dLambdaMin)
+    deltaLambda = dLambdaMin;
+  else if (deltaLambda > dLambdaMax)
+    deltaLambda = dLambdaMax;
+
+  return (deltaLambda == oldDeltaLambda) ? -1 : 0;
+}
+
 int
 LoadControl::update(const Vector &deltaU)
 {
@@ -411,6 +426,14 @@ LoadControl::computeSensitivities(void)
 	int numGrads = theDomain->getNumParameters();
 	paramIter = theDomain->getParameters();
 	
+	// form the right hand side of every parameter, then solve for all of
+	// them with one substitution
+	int numEqn = theSOE->getNumEqn();
+	if (numGrads == 0 || numEqn == 0)
+	  return 0;
+	static Matrix theRHS;
+	theRHS.resize(numEqn, numGrads);
+	int numParam = 0;
 	while ((theParam = paramIter()) != 0) {
 
 	  // Activate this parameter
@@ -424,21 +447,48 @@ LoadControl::computeSensitivities(void)
 
 	  // Form the RHS
 	  this->formSensitivityRHS(gradIndex);
-         
-	  // Solve for displacement sensitivity
-	 
-	  theSOE->solve();
-	  // Save sensitivity to nodes
-	  this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-	 
+	  const Vector &theB = theSOE->getB();
+	  for (int i=0; i<numEqn; i++)
+	    theRHS(i, numParam) = theB(i);
+	  numParam++;
+
+	  // De-activate this parameter for the next one
+	  theParam->activate(false);
+	}
+
+	if (numParam == 0)
+	  return 0;
+	if (numParam != numGrads)
+	  theRHS.resize(numEqn, numParam);
 
+	// Solve for displacement sensitivity
+	theSOE->setBlockB(theRHS);
+	if (theSOE->solveBlock() < 0) {
+	  opserr << "WARNING LoadControl::computeSensitivities() - the LinearSOE failed in solveBlock()\n";
+	  return -1;
+	}
+	const Matrix &theX = theSOE->getBlockX();
+
+	static Vector theDU;
+	theDU.resize(numEqn);
+	numParam = 0;
+	paramIter = theDomain->getParameters();
+	while ((theParam = paramIter()) != 0) {
+
+	  theParam->activate(true);
+	  int gradIndex = theParam->getGradIndex();
+
+	  // Save sensitivity to nodes
+	  for (int i=0; i<numEqn; i++)
+	    theDU(i) = theX(i, numParam);
+	  numParam++;
+	  this->saveSensitivity(theDU, gradIndex, numGrads);
 
 	  // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
 	  this->commitSensitivity(gradIndex, numGrads);
-	  
+
 	  // De-activate this parameter for next sensitivity calc
 	  theParam->activate(false);
-	//  opserr<<"LoadControl::..........ComputeSensitivities. end"<<endln;
 	}
 
 	return 0;
@@ -58,6 +58,8 @@ class LoadControl : public StaticIntegrator
     int newStep(void);    
     int update(const Vector &deltaU);
     int setDeltaLambda(double newDeltaLambda);
+    int scaleIncrement(double factor);
+    bool hasPredictor(void) {return false;}
 
     // Public methods for Output
     int sendSelf(int commitTag, Channel &theChannel);
@@ -122,6 +122,20 @@ MinUnbalDispNorm::~MinUnbalDispNorm()
 	delete phat;
 }
 
+int
+MinUnbalDispNorm::scaleIncrement(double factor)
+{
+    double oldLambda = dLambda1LastStep;
+
+    dLambda1LastStep *= factor;
+    if (dLambda1LastStep < dLambda1min)
+      dLambda1LastStep = dLambda1min;
+    else if (dLambda1LastStep > dLambda1max)
+      dLambda1LastStep = dLambda1max;
+
+    return (dLambda1LastStep == oldLambda) ? -1 : 0;
+}
+
 int
 MinUnbalDispNorm::newStep(void)
 {
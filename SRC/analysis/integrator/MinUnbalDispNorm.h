@@ -58,6 +58,7 @@ class MinUnbalDispNorm : public StaticIntegrator
     ~MinUnbalDispNorm();
 
     int newStep(void);    
+    int scaleIncrement(double factor);
     int update(const Vector &deltaU);
     int domainChanged(void);
     
@@ -37,6 +37,7 @@
 #include <LinearSOE.h>
 #include <AnalysisModel.h>
 #include <Vector.h>
+#include <Matrix.h>
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
 #include <AnalysisModel.h>
@@ -53,8 +54,8 @@
 #include<ReliabilityDomain.h>//Abbas
 #include<Parameter.h>
 #include<ParameterIter.h>//Abbas
-static bool converged = false;
-static int count = 0;
+static OPS_THREAD_LOCAL bool converged = false;
+static OPS_THREAD_LOCAL int count = 0;
 
 void *
 OPS_Newmark(void)
@@ -273,6 +274,12 @@ int Newmark::formEleTangent(FE_Element *theEle)
     
     theEle->zeroTangent();
     
+    // with the constant part in the base only the part that varies is added
+    if (splitTangent == true && theEle->isRayleighSplit() == true) {
+        theEle->addKtAndVaryingCtoTang(c1, c2, statusFlag == INITIAL_TANGENT);
+        return 0;
+    }
+    
     if (statusFlag == CURRENT_TANGENT)  {
         theEle->addKtToTang(c1);
         theEle->addCtoTang(c2);
@@ -283,6 +290,18 @@ int Newmark::formEleTangent(FE_Element *theEle)
         theEle->addMtoTang(c3);
     }
     
+    return 0;
+}
+
+int Newmark::getTangentFactors(double &fK, double &fC, double &fM)
+{
+    if (determiningMass == true || (statusFlag != CURRENT_TANGENT && statusFlag != INITIAL_TANGENT))
+        return -1;
+    
+    fK = c1;
+    fC = c2;
+    fM = c3;
+    
     return 0;
 }    
 
@@ -453,15 +472,9 @@ int Newmark::update(const Vector &deltaU)
     
     //  determine the response at t+deltaT
     if (displ == true)  {
-        (*U) += deltaU;
-
-        Udot->addVector(1.0, deltaU, c2);
-        Udotdot->addVector(1.0, deltaU, c3);
+        this->updateResponse(*U, *Udot, *Udotdot, deltaU, 1.0, c2, c3);
     } else  {
-        U->addVector(1.0, deltaU, c1);        
-        Udot->addVector(1.0, deltaU, c2);
-        
-        (*Udotdot) += deltaU;
+        this->updateResponse(*U, *Udot, *Udotdot, deltaU, c1, c2, 1.0);
     }
     
     // update the response at the DOFs
@@ -915,36 +928,71 @@ Newmark::computeSensitivities(void)
   //opserr<<"the numGrads is "<<numGrads<<endln;//Abbas...............................
   paramIter = theDomain->getParameters();
   
+  // form the right hand side of every parameter, then solve for all of
+  // them with one substitution
+  int numEqn = theSOE->getNumEqn();
+  if (numGrads == 0 || numEqn == 0)
+    return 0;
+  static Matrix theRHS;
+  theRHS.resize(numEqn, numGrads);
+  int numParam = 0;
   while ((theParam = paramIter()) != 0) {
-    
+
     // Activate this parameter
     theParam->activate(true);
-    
+
     // Zero the RHS vector
     theSOE->zeroB();
-    
+
     // Get the grad index for this parameter
     int gradIndex = theParam->getGradIndex();
-    //   opserr<<"gradNumber = "<<gradIndex<<endln;
+
     // Form the RHS
     this->formSensitivityRHS(gradIndex);
-    
-    // Solve for displacement sensitivity
-    
-    theSOE->solve();
+    const Vector &theB = theSOE->getB();
+    for (int i=0; i<numEqn; i++)
+      theRHS(i, numParam) = theB(i);
+    numParam++;
+
+    // De-activate this parameter for the next one
+    theParam->activate(false);
+  }
+
+  if (numParam == 0)
+    return 0;
+  if (numParam != numGrads)
+    theRHS.resize(numEqn, numParam);
+
+  // Solve for displacement sensitivity
+  theSOE->setBlockB(theRHS);
+  if (theSOE->solveBlock() < 0) {
+    opserr << "WARNING Newmark::computeSensitivities() - the LinearSOE failed in solveBlock()\n";
+    return -1;
+  }
+  const Matrix &theX = theSOE->getBlockX();
+
+  static Vector theDU;
+  theDU.resize(numEqn);
+  numParam = 0;
+  paramIter = theDomain->getParameters();
+  while ((theParam = paramIter()) != 0) {
+
+    theParam->activate(true);
+    int gradIndex = theParam->getGradIndex();
+
     // Save sensitivity to nodes
-    this->saveSensitivity( theSOE->getX(), gradIndex, numGrads );
-    
-    
-    
+    for (int i=0; i<numEqn; i++)
+      theDU(i) = theX(i, numParam);
+    numParam++;
+    this->saveSensitivity(theDU, gradIndex, numGrads);
+
     // Commit unconditional history variables (also for elastic problems; strain sens may be needed anyway)
     this->commitSensitivity(gradIndex, numGrads);
-    
+
     // De-activate this parameter for next sensitivity calc
     theParam->activate(false);
-    //  opserr<<"LoadControl::..........ComputeSensitivities. end"<<endln;
   }
-  
+
   return 0;
 }
 
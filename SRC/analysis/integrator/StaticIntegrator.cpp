@@ -108,6 +108,18 @@ StaticIntegrator::formNodUnbalance(DOF_Group *theDof)
 }    
 
 
+int
+StaticIntegrator::scaleIncrement(double factor)
+{
+  return -1;
+}
+
+bool
+StaticIntegrator::hasPredictor(void)
+{
+  return true;
+}
+
 int
 StaticIntegrator::formEleTangentSensitivity(FE_Element *theEle,int gradNumber)
 {
@@ -64,6 +64,16 @@ class StaticIntegrator : public IncrementalIntegrator
    
    virtual int newStep(void) =0;    
 
+    // scales the increment of the next step by factor, for an adaptive
+    // static analysis to cut or grow it; returns -1 if the integrator can
+    // not, or the increment is already at its bound
+    virtual int scaleIncrement(double factor);
+
+    // true if newStep() sets trial displacements for the new load, false if
+    // the step starts from the last converged state and may be given a
+    // predictor by the analysis
+    virtual bool hasPredictor(void);
+
   protected:
 
  
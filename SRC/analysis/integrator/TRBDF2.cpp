@@ -174,6 +174,12 @@ int TRBDF2::formEleTangent(FE_Element *theEle)
 {
     theEle->zeroTangent();
     
+    // with the constant part in the base only the part that varies is added
+    if (splitTangent == true && theEle->isRayleighSplit() == true) {
+        theEle->addKtAndVaryingCtoTang(c1, c2, statusFlag == INITIAL_TANGENT);
+        return 0;
+    }
+    
     if (statusFlag == CURRENT_TANGENT)  {
         theEle->addKtToTang(c1);
         theEle->addCtoTang(c2);
@@ -184,6 +190,18 @@ int TRBDF2::formEleTangent(FE_Element *theEle)
         theEle->addMtoTang(c3);
     }
     
+    return 0;
+}
+
+int TRBDF2::getTangentFactors(double &fK, double &fC, double &fM)
+{
+    if ((statusFlag != CURRENT_TANGENT && statusFlag != INITIAL_TANGENT))
+        return -1;
+    
+    fK = c1;
+    fC = c2;
+    fM = c3;
+    
     return 0;
 }    
 
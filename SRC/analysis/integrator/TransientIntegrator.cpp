@@ -44,16 +44,50 @@
 #include <DOF_Group.h>
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Profiler.h>
+#include <Element.h>
+#include <Domain.h>
+#include <Parameter.h>
+
+#ifdef _CUDA
+#include <ExplicitDeviceForces.h>
+#endif
+
+// the loops are only threaded for systems of at least this size, for less
+// the cost of starting the threads is more than the time saved
+#define TRANSIENT_MIN_THREADED_SIZE 50000
 
 TransientIntegrator::TransientIntegrator(int clasTag)
-:IncrementalIntegrator(clasTag)
+:IncrementalIntegrator(clasTag), splitTangent(false),
+ lumped(false), lumpedX(0), lumpedInvA(0), theDeviceForces(0),
+ deviceGeoTag(-1), constantBaseKept(false),
+ baseFE_Stamp(0), baseActivationStamp(0), baseDampingStamp(0),
+ baseParameterStamp(0), baseFC(0.0), baseFM(0.0)
 {
 
 }
 
 TransientIntegrator::~TransientIntegrator()
 {
+  if (lumpedX != 0)
+    delete lumpedX;
+  if (lumpedInvA != 0)
+    delete [] lumpedInvA;
+#ifdef _CUDA
+  if (theDeviceForces != 0)
+    delete theDeviceForces;
+#endif
+}
 
+void
+TransientIntegrator::setLinks(AnalysisModel &theModel, LinearSOE &theLinSOE, ConvergenceTest *theConvergenceTest)
+{
+  this->IncrementalIntegrator::setLinks(theModel, theLinSOE, theConvergenceTest);
+
+  // a base kept for another model is not one for this
+  constantBaseKept = false;
 }
 
 int 
@@ -73,9 +107,21 @@ TransientIntegrator::formTangent(int statFlag)
     // the loops to form and add the tangents are broken into two for 
     // efficiency when performing parallel computations
     
-    theLinSOE->zeroA();
+    Profiler::begin(PROFILE_TANGENT);
 
-    // do modal damping
+    // start from the constant part of the tangents if the integrator splits
+    // them, otherwise zero the A matrix of the linearSOE
+    double fK, fC, fM;
+    bool haveFactors = (this->getTangentFactors(fK, fC, fM) == 0);
+    splitTangent = false;
+    if (haveFactors == true && this->formConstantBase(fC, fM) == 0)
+      splitTangent = true;
+    else
+      theLinSOE->zeroA();
+
+    // do modal damping, the low rank update of an earlier tangent is
+    // dropped first
+    theLinSOE->setLowRankUpdate(0, 0, 0);
     bool inclModalMatrix=theModel->inclModalDampingMatrix();
     if (inclModalMatrix == true) {
       const Vector *modalValues = theModel->getModalDampingFactors();
@@ -96,18 +142,87 @@ TransientIntegrator::formTangent(int statFlag)
 	}
     }    
 
-    // loop through the FE_Elements getting them to add the tangent    
-    FE_EleIter &theEles2 = theModel->getFEs();    
-    FE_Element *elePtr;    
-    while((elePtr = theEles2()) != 0)     {
-	if (theLinSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0) {
-	    opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
-	    result = -2;
-	}
+    // loop through the FE_Elements getting them to add the tangent, with
+    // the factors known that loop is specialized for the LinearSOE
+    int res = 1;
+    if (haveFactors == true)
+      res = this->formElementTangent(fK, fC, fM, splitTangent);
+    if (res == 1)
+      res = this->formElementTangent();
+    if (res < 0) {
+	opserr << "TransientIntegrator::formTangent() - failed to addA:ele\n";
+	result = -2;
     }
+
+    splitTangent = false;
+
+    Profiler::end(PROFILE_TANGENT);
     return result;
 }
 
+int
+TransientIntegrator::getTangentFactors(double &fK, double &fC, double &fM)
+{
+    return -1;
+}
+
+// sets A to the sum of the constant parts of the tangents of the FE_Elements
+// that split, formed once and kept by the LinearSOE, and set again with
+// restoreA() while neither the FE_Elements of the AnalysisModel, the active
+// elements, the Rayleigh factors of the elements nor a parameter, e.g. of
+// the density or stiffness of a material, have changed and fC and fM are
+// the same. Returns 0 if A holds the sum, -1 if no FE_Element splits and A
+// is untouched.
+
+int
+TransientIntegrator::formConstantBase(double fC, double fM)
+{
+    LinearSOE *theLinSOE = this->getLinearSOE();
+    AnalysisModel *theModel = this->getAnalysisModel();
+
+    int numSplit = 0;
+    FE_Element *elePtr;
+    FE_EleIter &theEles = theModel->getFEs();
+    while ((elePtr = theEles()) != 0)
+      if (elePtr->isRayleighSplit() == true)
+	numSplit++;
+
+    if (numSplit == 0) {
+      constantBaseKept = false;
+      return -1;
+    }
+
+    int feStamp = theModel->getFE_Stamp();
+    int activationStamp = Element::getActivationStamp();
+    int dampingStamp = Element::getDampingStamp();
+    int parameterStamp = Parameter::getUpdateStamp();
+    if (constantBaseKept == true && feStamp == baseFE_Stamp &&
+	activationStamp == baseActivationStamp && dampingStamp == baseDampingStamp &&
+	parameterStamp == baseParameterStamp &&
+	fC == baseFC && fM == baseFM && theLinSOE->restoreA() == 0)
+      return 0;
+
+    theLinSOE->zeroA();
+    FE_EleIter &theEles2 = theModel->getFEs();
+    while ((elePtr = theEles2()) != 0)
+      if (elePtr->isRayleighSplit() == true)
+	if (theLinSOE->addA(elePtr->getConstantTangent(fC, fM), elePtr->getID()) < 0) {
+	  opserr << "WARNING TransientIntegrator::formTangent -";
+	  opserr << " failed in addA for ID " << elePtr->getID();
+	}
+
+    // if the LinearSOE does not keep a base the sum is formed every time
+    constantBaseKept = (theLinSOE->saveA() == 0);
+    baseFE_Stamp = feStamp;
+    baseActivationStamp = activationStamp;
+    baseDampingStamp = dampingStamp;
+    baseParameterStamp = parameterStamp;
+    baseFC = fC;
+    baseFM = fM;
+
+    return 0;
+}
+
 
     
 int
@@ -129,18 +244,24 @@ TransientIntegrator::formUnbalance(void) {
       this->addModalDampingForce(modalValues);
     }
     
+    Profiler::begin(PROFILE_UNBALANCE);
+
     if (this->formElementResidual() < 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance ";
 	opserr << " - this->formElementResidual failed\n";
+	Profiler::end(PROFILE_UNBALANCE);
 	return -1;
     }
     
     if (this->formNodalUnbalance() < 0) {
 	opserr << "WARNING IncrementalIntegrator::formUnbalance ";
 	opserr << " - this->formNodalUnbalance failed\n";
+	Profiler::end(PROFILE_UNBALANCE);
 	return -2;
     }    
 
+    Profiler::end(PROFILE_UNBALANCE);
+
     return 0;
 }
     
@@ -161,4 +282,278 @@ TransientIntegrator::formNodUnbalance(DOF_Group *theDof)
 }    
 
 
+void
+TransientIntegrator::updateResponse(Vector &U, Vector &Udot, Vector &Udotdot,
+				    const Vector &deltaU,
+				    double cU, double cUdot, double cUdotdot)
+{
+  int size = deltaU.Size();
+  if (size == 0)
+    return;
+
+  double *u = &U(0);
+  double *v = &Udot(0);
+  double *a = &Udotdot(0);
+  const double *du = &((Vector &)deltaU)(0);
+
+#ifdef _OPENMP
+  int numT = (size < TRANSIENT_MIN_THREADED_SIZE) ? 1 : this->getNumThreads();
+#pragma omp parallel for schedule(static) num_threads(numT) if(numT > 1)
+#endif
+  for (int i=0; i<size; i++) {
+    double dui = du[i];
+    u[i] += cU*dui;
+    v[i] += cUdot*dui;
+    a[i] += cUdotdot*dui;
+  }
+}
+
+
+void
+TransientIntegrator::interpolateResponse(Vector &Ualpha, const Vector &Ut,
+					 const Vector &U, double alpha)
+{
+  int size = U.Size();
+  if (size == 0)
+    return;
+
+  double *ua = &Ualpha(0);
+  const double *ut = &((Vector &)Ut)(0);
+  const double *u = &((Vector &)U)(0);
+  double alphaT = 1.0-alpha;
+
+#ifdef _OPENMP
+  int numT = (size < TRANSIENT_MIN_THREADED_SIZE) ? 1 : this->getNumThreads();
+#pragma omp parallel for schedule(static) num_threads(numT) if(numT > 1)
+#endif
+  for (int i=0; i<size; i++)
+    ua[i] = ut[i]*alphaT + u[i]*alpha;
+}
 
+
+int
+TransientIntegrator::setLumped(bool isLump)
+{
+  lumped = isLump;
+  return 0;
+}
+
+
+bool
+TransientIntegrator::isLumped(void)
+{
+  return lumped;
+}
+
+
+int
+TransientIntegrator::setDevice(int device)
+{
+#ifdef _CUDA
+  if (theDeviceForces != 0)
+    delete theDeviceForces;
+  theDeviceForces = new ExplicitDeviceForces(device);
+  deviceGeoTag = -1;
+  lumped = true;
+  return 0;
+#else
+  opserr << "WARNING TransientIntegrator::setDevice() - not compiled with CUDA, ";
+  opserr << "the element residuals are formed on the host\n";
+  return -1;
+#endif
+}
+
+
+// adds the element residuals, those of the elements with a constant tangent
+// formed on the device and the others here; returns 1 if the device does
+// not form them, all are then to be added by addElementResiduals()
+int
+TransientIntegrator::addDeviceResiduals(Vector &R, bool formDiagonal)
+{
+#ifdef _CUDA
+  AnalysisModel *theModel = this->getAnalysisModel();
+  Domain *theDomain = theModel->getDomainPtr();
+
+  // the elements are copied to the device again when the tangent is
+  // formed or the domain has changed
+  int geoTag = theDomain->hasDomainChanged();
+  if (formDiagonal == true || geoTag != deviceGeoTag) {
+    deviceGeoTag = geoTag;
+    if (theDeviceForces->setModel(*theModel) < 0)
+      return -1;
+  }
+
+  int res = theDeviceForces->addResiduals(R, *theDomain);
+  if (res != 0)
+    return res;
+
+  // the FE_Elements left on the host, in FE_EleIter order
+  int size = R.Size();
+  int feIndex = 0;
+  FE_EleIter &theEles = theModel->getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0) {
+    if (theDeviceForces->isOnDevice(feIndex++) == true)
+      continue;
+    const ID &id = elePtr->getID();
+    const Vector &r = elePtr->getResidual(this);
+    int idSize = id.Size();
+    if (r.Size() != idSize) {
+      opserr << "WARNING TransientIntegrator::solveLumped() -";
+      opserr << " residual and ID not of similar sizes for ID " << id;
+      return -2;
+    }
+    for (int k=0; k<idSize; k++) {
+      int loc = id(k);
+      if (loc >= 0 && loc < size)
+	R(loc) += r(k);
+    }
+  }
+
+  return 0;
+#else
+  return 1;
+#endif
+}
+
+
+// adds the diagonal of m to A, returns false if m has off diagonal terms
+static bool
+addLumpedDiagonal(double *A, int size, const Matrix &m, const ID &id)
+{
+  int idSize = id.Size();
+  for (int j=0; j<idSize; j++) {
+    for (int k=0; k<idSize; k++)
+      if (j != k && m(j,k) != 0.0)
+	return false;
+    int loc = id(j);
+    if (loc >= 0 && loc < size)
+      A[loc] += m(j,j);
+  }
+  return true;
+}
+
+
+int
+TransientIntegrator::formLumpedDiagonal(void)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  int size = lumpedX->Size();
+  double *A = lumpedInvA;
+  for (int i=0; i<size; i++)
+    A[i] = 0.0;
+
+  // the DOF_Groups and then the FE_Elements, as in formTangent()
+  DOF_GrpIter &theDOFs = theModel->getDOFs();
+  DOF_Group *dofPtr;
+  while ((dofPtr = theDOFs()) != 0)
+    if (addLumpedDiagonal(A, size, dofPtr->getTangent(this), dofPtr->getID()) == false)
+      return 1;
+
+  FE_EleIter &theEles = theModel->getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEles()) != 0)
+    if (addLumpedDiagonal(A, size, elePtr->getTangent(this), elePtr->getID()) == false)
+      return 1;
+
+  for (int i=0; i<size; i++) {
+    if (A[i] == 0.0) {
+      opserr << "WARNING TransientIntegrator::solveLumped() - zero diagonal for equation ";
+      opserr << i << endln;
+      return -1;
+    }
+    A[i] = 1.0/A[i];
+  }
+
+  return 0;
+}
+
+
+int
+TransientIntegrator::solveLumped(int statFlag, bool formDiagonal)
+{
+  AnalysisModel *theModel = this->getAnalysisModel();
+  if (theModel == 0) {
+    opserr << "WARNING TransientIntegrator::solveLumped() - no AnalysisModel has been set\n";
+    return -1;
+  }
+
+  // modal damping couples the equations
+  if (theModel->getModalDampingFactors() != 0) {
+    opserr << "WARNING TransientIntegrator::solveLumped() - modal damping, ";
+    opserr << "the system is formed and solved in the LinearSOE\n";
+    lumped = false;
+    return 1;
+  }
+
+  statusFlag = statFlag;
+
+  int size = theModel->getNumEqn();
+  if (lumpedX == 0 || lumpedX->Size() != size) {
+    if (lumpedX != 0)
+      delete lumpedX;
+    if (lumpedInvA != 0)
+      delete [] lumpedInvA;
+    lumpedX = new Vector(size);
+    lumpedInvA = new double[size];
+    formDiagonal = true;
+  }
+
+  if (formDiagonal == true) {
+    Profiler::begin(PROFILE_TANGENT);
+    int res = this->formLumpedDiagonal();
+    Profiler::end(PROFILE_TANGENT);
+    if (res > 0) {
+      opserr << "WARNING TransientIntegrator::solveLumped() - the system is not diagonal, ";
+      opserr << "it is formed and solved in the LinearSOE\n";
+      lumped = false;
+      return 1;
+    }
+    if (res < 0)
+      return -2;
+  }
+
+  if (size == 0)
+    return this->update(*lumpedX);
+
+  // the unbalance, in the same order as formUnbalance()
+  Profiler::begin(PROFILE_UNBALANCE);
+
+  lumpedX->Zero();
+  int resDevice = 1;
+  if (theDeviceForces != 0)
+    resDevice = this->addDeviceResiduals(*lumpedX, formDiagonal);
+  if (resDevice < 0 || (resDevice > 0 && this->addElementResiduals(*lumpedX) < 0)) {
+    opserr << "WARNING TransientIntegrator::solveLumped() - failed to add the element residuals\n";
+    Profiler::end(PROFILE_UNBALANCE);
+    return -3;
+  }
+
+  DOF_GrpIter &theDOFs = theModel->getDOFs();
+  DOF_Group *dofPtr;
+  while ((dofPtr = theDOFs()) != 0) {
+    const ID &id = dofPtr->getID();
+    const Vector &p = dofPtr->getUnbalance(this);
+    int idSize = id.Size();
+    for (int k=0; k<idSize; k++) {
+      int loc = id(k);
+      if (loc >= 0 && loc < size)
+	(*lumpedX)(loc) += p(k);
+    }
+  }
+
+  Profiler::end(PROFILE_UNBALANCE);
+
+  // the solution, X = inv(A) * B
+  double *x = &(*lumpedX)(0);
+  const double *invA = lumpedInvA;
+
+#ifdef _OPENMP
+  int numT = (size < TRANSIENT_MIN_THREADED_SIZE) ? 1 : this->getNumThreads();
+#pragma omp parallel for schedule(static) num_threads(numT) if(numT > 1)
+#endif
+  for (int i=0; i<size; i++)
+    x[i] *= invA[i];
+
+  return this->update(*lumpedX);
+}
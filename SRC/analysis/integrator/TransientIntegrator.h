@@ -46,6 +46,7 @@ class AnalysisModel;
 class FE_Element;
 class DOF_Group;
 class Vector;
+class ExplicitDeviceForces;
 
 class TransientIntegrator : public IncrementalIntegrator
 {
@@ -53,6 +54,10 @@ class TransientIntegrator : public IncrementalIntegrator
     TransientIntegrator(int classTag);
     virtual ~TransientIntegrator();
 
+    virtual void setLinks(AnalysisModel &theModel,
+			  LinearSOE &theSOE,
+			  ConvergenceTest *theTest);
+
     virtual int formTangent(int statFlag);
     virtual int formUnbalance(void);
     virtual int formEleResidual(FE_Element *theEle);
@@ -60,9 +65,56 @@ class TransientIntegrator : public IncrementalIntegrator
 
     virtual int initialize(void) {return 0;};
 
+    // with a lumped mass (and damping) the explicit integrators form a
+    // diagonal system; when set the step is then taken by solveLumped(),
+    // which inverts the diagonal and adds the unbalance into its own
+    // vector, the LinearSOE is not used
+    int setLumped(bool lumped);
+    bool isLumped(void);
+    int solveLumped(int statusFlag, bool formDiagonal);
+
+    // the residuals of the elements with a constant tangent are then formed
+    // on the CUDA device, see ExplicitDeviceForces; sets the lumped step
+    int setDevice(int device);
+
   protected:
+    // one pass over the equations for the update of the response,
+    // U += cU*deltaU, Udot += cUdot*deltaU, Udotdot += cUdotdot*deltaU
+    void updateResponse(Vector &U, Vector &Udot, Vector &Udotdot,
+			const Vector &deltaU, double cU, double cUdot, double cUdotdot);
+    // Ualpha = (1-alpha)*Ut + alpha*U
+    void interpolateResponse(Vector &Ualpha, const Vector &Ut, const Vector &U,
+			     double alpha);
+
+    // the factors fK, fC and fM of the stiffness, damping and mass in the
+    // tangent; an integrator that returns 0 has formTangent() add the
+    // constant part of the tangents of the FE_Elements with Rayleigh damping
+    // once, see FE_Element::isRayleighSplit(), and while splitTangent is set
+    // its formEleTangent() adds only the part that varies for them
+    virtual int getTangentFactors(double &fK, double &fC, double &fM);
+    bool splitTangent;
     
   private:
+    int formLumpedDiagonal(void);
+    int formConstantBase(double fC, double fM);
+    int addDeviceResiduals(Vector &R, bool formDiagonal);
+
+    bool lumped;
+    Vector *lumpedX;       // the unbalance and then the solution
+    double *lumpedInvA;    // the inverse of the diagonal
+    ExplicitDeviceForces *theDeviceForces;
+    int deviceGeoTag;      // the domain the device was set up for
+
+    // the constant part of the tangents is added to A once and kept by the
+    // LinearSOE as the base A starts from while the FE_Elements, the active
+    // elements, their Rayleigh factors, the parameters and the factors of
+    // the integrator stay the same
+    bool constantBaseKept;
+    int baseFE_Stamp;          // AnalysisModel FE stamp of the base
+    int baseActivationStamp;   // Element activation stamp of the base
+    int baseDampingStamp;      // Element damping stamp of the base
+    int baseParameterStamp;    // Parameter update stamp of the base
+    double baseFC, baseFM;
 };
 
 #endif
@@ -39,16 +39,22 @@
 
 #include <ArrayOfTaggedObjects.h>
 #include <AnalysisModel.h>
+#include <LinearSOE.h>
 #include <Domain.h>
 #include <FE_Element.h>
 #include <DOF_Group.h>
 #include <DOF_GrpIter.h>
 #include <FE_EleIter.h>
 #include <Graph.h>
+#include <CSR_Graph.h>
 #include <Vertex.h>
+#include <ID.h>
 #include <Node.h>
 #include <NodeIter.h>
 #include <ConstraintHandler.h>
+#include <Element.h>
+#include <vector>
+#include <algorithm>
 
 
 #include <MapOfTaggedObjects.h>
@@ -56,6 +62,17 @@
 #define START_EQN_NUM 0
 #define START_VERTEX_NUM 0
 
+// the nodal trial response entries of a dof and its equation number,
+// -1 if constrained; the committed and incremental displacements are
+// at multiples of stride from the trial
+struct NodeResponseEntry {
+  int eqn;
+  int stride;
+  double *disp;
+  double *vel;
+  double *accel;
+};
+
 //  AnalysisModel();
 //	constructor
 
@@ -63,7 +80,14 @@ AnalysisModel::AnalysisModel(int theClassTag)
 :MovableObject(theClassTag),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ numPatternEqn(0), patternStart(0), patternAdj(0),
+ builtStamp(0), builtHandler(0), builtNumberer(0), sizedSOE(0), sizedEigenSOE(0),
+ feStamp(0),
+ orderByClass(false), orderByEqn(false), orderValid(false), orderedFEs(0), sizeOrderedFEs(0),
+ gatherValid(false), theGather(0), numGather(0), sizeGather(0),
+ otherDOFs(0), numOtherDOFs(0), sizeOtherDOFs(0),
+ feRangeValid(false), dofRangeValid(false)
 {
     theFEs     = new ArrayOfTaggedObjects(1024);
     theDOFs    =  new ArrayOfTaggedObjects(1024);
@@ -77,7 +101,14 @@ AnalysisModel::AnalysisModel()
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ numPatternEqn(0), patternStart(0), patternAdj(0),
+ builtStamp(0), builtHandler(0), builtNumberer(0), sizedSOE(0), sizedEigenSOE(0),
+ feStamp(0),
+ orderByClass(false), orderByEqn(false), orderValid(false), orderedFEs(0), sizeOrderedFEs(0),
+ gatherValid(false), theGather(0), numGather(0), sizeGather(0),
+ otherDOFs(0), numOtherDOFs(0), sizeOtherDOFs(0),
+ feRangeValid(false), dofRangeValid(false)
 {
   theFEs     = new ArrayOfTaggedObjects(256);
   theDOFs    = new ArrayOfTaggedObjects(256);
@@ -90,7 +121,14 @@ AnalysisModel::AnalysisModel(TaggedObjectStorage &theFes, TaggedObjectStorage &t
 :MovableObject(AnaMODEL_TAGS_AnalysisModel),
  myDomain(0), myHandler(0),
  myDOFGraph(0), myGroupGraph(0),
- numFE_Ele(0), numDOF_Grp(0), numEqn(0)
+ numFE_Ele(0), numDOF_Grp(0), numEqn(0),
+ numPatternEqn(0), patternStart(0), patternAdj(0),
+ builtStamp(0), builtHandler(0), builtNumberer(0), sizedSOE(0), sizedEigenSOE(0),
+ feStamp(0),
+ orderByClass(false), orderByEqn(false), orderValid(false), orderedFEs(0), sizeOrderedFEs(0),
+ gatherValid(false), theGather(0), numGather(0), sizeGather(0),
+ otherDOFs(0), numOtherDOFs(0), sizeOtherDOFs(0),
+ feRangeValid(false), dofRangeValid(false)
 {
   theFEs     = &theFes;
   theDOFs    = &theDofs;
@@ -115,6 +153,15 @@ AnalysisModel::~AnalysisModel()
   if (theFEiter != 0)
     delete theFEiter;
 
+  if (orderedFEs != 0)
+    delete [] orderedFEs;
+
+  if (theGather != 0)
+    delete [] theGather;
+
+  if (otherDOFs != 0)
+    delete [] otherDOFs;
+
   if (theDOFiter != 0)
     delete theDOFiter;
 
@@ -125,6 +172,8 @@ AnalysisModel::~AnalysisModel()
   if (myDOFGraph != 0) {
     delete myDOFGraph;
   }
+
+  this->clearDOFGraphPattern();
 }    
 
 void
@@ -159,6 +208,9 @@ AnalysisModel::addFE_Element(FE_Element *theElement)
   if (result == true) {
     theElement->setAnalysisModel(*this);
     numFE_Ele++;
+    feStamp++;
+    orderValid = false;
+    feRangeValid = false;
     return true;  // o.k.
   } else
     return false;
@@ -195,6 +247,8 @@ AnalysisModel::addDOF_Group(DOF_Group *theGroup)
   bool result = theDOFs->addComponent(theGroup);
   if (result == true) {
     numDOF_Grp++;
+    gatherValid = false;
+    dofRangeValid = false;
     return true;  // o.k.
   } else
     return false;
@@ -219,6 +273,13 @@ AnalysisModel::clearAll(void)
     numFE_Ele =0;
     numDOF_Grp = 0;
     numEqn = 0;    
+    orderValid = false;
+    feRangeValid = false;
+    gatherValid = false;
+    dofRangeValid = false;
+    feStamp++;
+
+    builtStamp = 0;
 }
 
 void
@@ -237,6 +298,9 @@ AnalysisModel::clearDOFGroupGraph(void)
     delete myGroupGraph;    
   
   myGroupGraph = 0;
+
+  // invoked by the numberers once the DOF_Groups are numbered
+  gatherValid = false;
 }
 
 
@@ -248,6 +312,12 @@ AnalysisModel::getNumDOF_Groups(void) const
   return numDOF_Grp;
 }
 
+int
+AnalysisModel::getNumFE_Elements(void) const
+{
+  return numFE_Ele;
+}
+
 
 DOF_Group *
 AnalysisModel::getDOF_GroupPtr(int tag)
@@ -264,10 +334,98 @@ AnalysisModel::getDOF_GroupPtr(int tag)
 FE_EleIter &
 AnalysisModel::getFEs()
 {
+    if (orderByClass == true && orderValid == false)
+      this->orderFEs();
+
     theFEiter->reset();
     return *theFEiter;
 }
 
+void
+AnalysisModel::setFE_Order(bool byClass, bool byEqn)
+{
+    orderByClass = byClass;
+    orderByEqn = byEqn;
+    orderValid = false;
+    feRangeValid = false;
+
+    if (byClass == false)
+      theFEiter->setOrder(0, 0);
+}
+
+// the key the FE_Elements are sorted on, a FE_Element without an element
+// (one for a constraint) has class tag -1 and is formed first
+struct FE_OrderKey {
+  int classTag;
+  int eqn;
+  int loc;
+  FE_Element *theFE;
+  bool operator<(const FE_OrderKey &other) const {
+    if (classTag != other.classTag)
+      return classTag < other.classTag;
+    if (eqn != other.eqn)
+      return eqn < other.eqn;
+    return loc < other.loc;
+  }
+};
+
+void
+AnalysisModel::orderFEs(void)
+{
+    orderValid = true;
+
+    // collect the FE_Elements in the order of the storage
+    theFEiter->setOrder(0, 0);
+    theFEiter->reset();
+
+    std::vector<FE_OrderKey> keys;
+    keys.reserve(numFE_Ele);
+
+    FE_Element *theFE;
+    while ((theFE = (*theFEiter)()) != 0) {
+      FE_OrderKey key;
+      Element *theEle = theFE->getElement();
+      key.classTag = (theEle != 0) ? theEle->getClassTag() : -1;
+      key.eqn = 0;
+      key.loc = keys.size();
+      key.theFE = theFE;
+
+      // the smallest equation number of the DOF_Groups of the FE_Element,
+      // taken from the DOF_Groups as the FE_Element may not have set its
+      // ID from them yet
+      if (orderByEqn == true) {
+	key.eqn = numEqn;
+	const ID &theDOFtags = theFE->getDOFtags();
+	for (int i=0; i<theDOFtags.Size(); i++) {
+	  DOF_Group *theDOF = this->getDOF_GroupPtr(theDOFtags(i));
+	  if (theDOF == 0)
+	    continue;
+	  const ID &theID = theDOF->getID();
+	  for (int j=0; j<theID.Size(); j++)
+	    if (theID(j) >= 0 && theID(j) < key.eqn)
+	      key.eqn = theID(j);
+	}
+      }
+
+      keys.push_back(key);
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    int numFEs = keys.size();
+    if (numFEs > sizeOrderedFEs) {
+      if (orderedFEs != 0)
+	delete [] orderedFEs;
+      orderedFEs = new FE_Element *[numFEs];
+      sizeOrderedFEs = numFEs;
+    }
+
+    for (int i=0; i<numFEs; i++)
+      orderedFEs[i] = keys[i].theFE;
+
+    theFEiter->setOrder(orderedFEs, numFEs);
+}
+
 DOF_GrpIter &
 AnalysisModel::getDOFs()
 {
@@ -275,10 +433,56 @@ AnalysisModel::getDOFs()
     return *theDOFiter;
 }
 
+ComponentRange<FE_Element>
+AnalysisModel::getFE_Range(void)
+{
+    // getFEs() orders the FE_Elements first if that is asked for
+    if (feRangeValid == false || (orderByClass == true && orderValid == false)) {
+      theFE_Range.clear();
+      theFE_Range.reserve(numFE_Ele);
+      FE_EleIter &theFEs = this->getFEs();
+      FE_Element *theFE;
+      while ((theFE = theFEs()) != 0)
+	theFE_Range.push_back(theFE);
+      feRangeValid = true;
+    }
+
+    if (theFE_Range.empty())
+      return ComponentRange<FE_Element>();
+    return ComponentRange<FE_Element>(&theFE_Range[0], theFE_Range.size());
+}
+
+ComponentRange<DOF_Group>
+AnalysisModel::getDOF_Range(void)
+{
+    if (dofRangeValid == false) {
+      theDOF_Range.clear();
+      theDOF_Range.reserve(numDOF_Grp);
+      DOF_GrpIter &theDOFs = this->getDOFs();
+      DOF_Group *theDOF;
+      while ((theDOF = theDOFs()) != 0)
+	theDOF_Range.push_back(theDOF);
+      dofRangeValid = true;
+    }
+
+    if (theDOF_Range.empty())
+      return ComponentRange<DOF_Group>();
+    return ComponentRange<DOF_Group>(&theDOF_Range[0], theDOF_Range.size());
+}
+
 void 
 AnalysisModel::setNumEqn(int theNumEqn)
 {
     numEqn = theNumEqn;
+
+    // the DOF_Group IDs have been set
+    gatherValid = false;
+
+    // the equation numbers have changed
+    if (orderByEqn == true) {
+      orderValid = false;
+    }
+    feRangeValid = false;
 }
 
 int 
@@ -288,20 +492,46 @@ AnalysisModel::getNumEqn(void) const
 }
 
 
+size_t
+AnalysisModel::getNumBytes(void)
+{
+    // the FE_Elements and DOF_Groups with their mapping ID's; the tangents
+    // and residuals they share between them are not counted
+    size_t numBytes = 0;
+    FE_Element *theFE;
+    FE_EleIter &theFEs = this->getFEs();
+    while ((theFE = theFEs()) != 0)
+	numBytes += sizeof(FE_Element) + 2*theFE->getID().Size()*sizeof(int);
+
+    DOF_Group *theDOF;
+    DOF_GrpIter &theDOFs = this->getDOFs();
+    while ((theDOF = theDOFs()) != 0)
+	numBytes += sizeof(DOF_Group) + theDOF->getNumDOF()*sizeof(int);
+
+    // the graphs kept, a vertex per equation or DOF_Group and its adjacency
+    Graph *theGraphs[2] = {myDOFGraph, myGroupGraph};
+    for (int i=0; i<2; i++)
+	if (theGraphs[i] != 0)
+	    numBytes += theGraphs[i]->getNumVertex()*sizeof(Vertex) +
+		2*theGraphs[i]->getNumEdge()*sizeof(int);
+
+    if (patternStart != 0)
+	numBytes += (patternStart->Size() + patternAdj->Size())*sizeof(int);
+
+    return numBytes;
+}
+
+
 Graph &
 AnalysisModel::getDOFGraph(void)
 {
   if (myDOFGraph == 0) {
-    int numVertex = this->getNumDOF_Groups();
-
-    //    myDOFGraph = new Graph(numVertex);
-    MapOfTaggedObjects *graphStorage = new MapOfTaggedObjects();
-    myDOFGraph = new Graph(*graphStorage);
 
     //
-    // create a vertex for each dof
+    // the vertices are the equations, find how many there are
     //
-    
+
+    int numVertex = 0;
     DOF_Group *dofPtr =0;
     DOF_GrpIter &theDOFs = this->getDOFs();
     while ((dofPtr = theDOFs()) != 0) {
@@ -309,57 +539,232 @@ AnalysisModel::getDOFGraph(void)
       int size = id.Size();
       for (int i=0; i<size; i++) {
 	int dofTag = id(i);
-	if (dofTag >= START_EQN_NUM) {
-	  Vertex *vertexPtr = myDOFGraph->getVertexPtr(dofTag);
-	  if (vertexPtr == 0) {
-	    Vertex *vertexPtr = new Vertex(dofTag, dofTag);      
-	    if (vertexPtr == 0) {
-	      opserr << "WARNING AnalysisModel::getDOFGraph";
-	      opserr << " - Not Enough Memory to create " << i+1 << "th Vertex\n";
-	      return *myDOFGraph;
-	    }
-	    if (myDOFGraph->addVertex(vertexPtr, false) == false) {
-	      opserr << "WARNING AnalysisModel::getDOFGraph - error adding vertex\n";
-	      return *myDOFGraph;
-	    }
-	  }
-	}
+	if (dofTag >= START_EQN_NUM && dofTag-START_EQN_NUM >= numVertex)
+	  numVertex = dofTag-START_EQN_NUM+1;
       }
     }
-    
-    // now add the edges, by looping over the FE_elements, getting their
-    // IDs and adding edges between DOFs for equation numbers >= START_EQN_NUM
-    
+
+    //
+    // the edges are created between all DOFs of each FE_Element with 
+    // valid eqn numbers. first pass counts the entries of each row, 
+    // with duplicates, and second pass fills them in; CSR_Graph then
+    // sorts the rows and removes the duplicates.
+    // 
+
+    int *start = new int[numVertex+1];
+    if (start == 0) {
+      opserr << "WARNING AnalysisModel::getDOFGraph";
+      opserr << " - Not Enough Memory to create graph of size " << numVertex << endln;
+      myDOFGraph = new CSR_Graph(0, 0, 0);
+      return *myDOFGraph;
+    }
+    for (int i=0; i<=numVertex; i++)
+      start[i] = 0;
+
     FE_Element *elePtr =0;
     FE_EleIter &eleIter = this->getFEs();
-    int cnt = 0;
-    
     while((elePtr = eleIter()) != 0) {
       const ID &id = elePtr->getID();
-      cnt++;
       int size = id.Size();
+      int numValid = 0;
+      for (int i=0; i<size; i++)
+	if (id(i) >= START_EQN_NUM && id(i)-START_EQN_NUM < numVertex)
+	  numValid++;
       for (int i=0; i<size; i++) {
-	int eqn1 = id(i);
-	
-	// if eqnNum of DOF is a valid eqn number add an edge
-	// to all other DOFs with valid eqn numbers.
-	
-	if (eqn1 >=START_EQN_NUM) {
-	  for (int j=i+1; j<size; j++) {
-	    int eqn2 = id(j);
-	    if (eqn2 >=START_EQN_NUM)
-	      myDOFGraph->addEdge(eqn1-START_EQN_NUM+START_VERTEX_NUM,
-				  eqn2-START_EQN_NUM+START_VERTEX_NUM);
-	  }
+	int eqn = id(i)-START_EQN_NUM;
+	if (eqn >= 0 && eqn < numVertex)
+	  start[eqn+1] += numValid-1;
+      }
+    }
+
+    for (int i=0; i<numVertex; i++)
+      start[i+1] += start[i];
+
+    int *adjacency = new int[start[numVertex]+1];
+    int *next = new int[numVertex+1];
+    if (adjacency == 0 || next == 0) {
+      opserr << "WARNING AnalysisModel::getDOFGraph";
+      opserr << " - Not Enough Memory to create graph with " << start[numVertex] << " entries\n";
+      delete [] start;
+      if (adjacency != 0) delete [] adjacency;
+      if (next != 0) delete [] next;
+      myDOFGraph = new CSR_Graph(0, 0, 0);
+      return *myDOFGraph;
+    }
+    for (int i=0; i<numVertex; i++)
+      next[i] = start[i];
+
+    FE_EleIter &eleIter2 = this->getFEs();
+    while((elePtr = eleIter2()) != 0) {
+      const ID &id = elePtr->getID();
+      int size = id.Size();
+      for (int i=0; i<size; i++) {
+	int eqn1 = id(i)-START_EQN_NUM;
+	if (eqn1 < 0 || eqn1 >= numVertex)
+	  continue;
+	for (int j=0; j<size; j++) {
+	  int eqn2 = id(j)-START_EQN_NUM;
+	  if (j != i && eqn2 >= 0 && eqn2 < numVertex)
+	    adjacency[next[eqn1]++] = eqn2+START_VERTEX_NUM;
 	}
       }
     }
+
+    delete [] next;
+
+    myDOFGraph = new CSR_Graph(numVertex, start, adjacency);
   }    
 
   return *myDOFGraph;
 }
 
 
+void
+AnalysisModel::saveDOFGraphPattern(void)
+{
+  this->clearDOFGraphPattern();
+
+  Graph &theGraph = this->getDOFGraph();
+  
+  numPatternEqn = numEqn;
+  patternStart = new ID(numEqn+1);
+  patternAdj = new ID(2*theGraph.getNumEdge());
+  if (patternStart == 0 || patternAdj == 0) {
+    opserr << "WARNING AnalysisModel::saveDOFGraphPattern";
+    opserr << " - Not Enough Memory\n";
+    this->clearDOFGraphPattern();
+    return;
+  }
+
+  // the adjacency of each vertex is held in ascending order
+  int loc = 0;
+  for (int i=0; i<numEqn; i++) {
+    (*patternStart)(i) = loc;
+    Vertex *vertexPtr = theGraph.getVertexPtr(i+START_VERTEX_NUM);
+    if (vertexPtr != 0) {
+      const ID &adjacency = vertexPtr->getAdjacency();
+      for (int j=0; j<adjacency.Size(); j++)
+	(*patternAdj)[loc++] = adjacency(j)-START_VERTEX_NUM;
+    }
+  }
+  (*patternStart)(numEqn) = loc;
+}
+
+
+void
+AnalysisModel::clearDOFGraphPattern(void)
+{
+  if (patternStart != 0)
+    delete patternStart;
+  if (patternAdj != 0)
+    delete patternAdj;
+
+  numPatternEqn = 0;
+  patternStart = 0;
+  patternAdj = 0;
+
+  // the components may have changed
+  builtStamp = 0;
+  sizedSOE = 0;
+  sizedEigenSOE = 0;
+}
+
+
+void
+AnalysisModel::setBuilt(int domainStamp, ConstraintHandler *theHandler,
+			DOF_Numberer *theNumberer)
+{
+  builtStamp = domainStamp;
+  builtHandler = theHandler;
+  builtNumberer = theNumberer;
+}
+
+
+bool
+AnalysisModel::isBuilt(int domainStamp, ConstraintHandler *theHandler,
+		       DOF_Numberer *theNumberer)
+{
+  return builtStamp != 0 && builtStamp == domainStamp &&
+    builtHandler == theHandler && builtNumberer == theNumberer;
+}
+
+
+void
+AnalysisModel::setSized(LinearSOE *theSOE, EigenSOE *theEigenSOE)
+{
+  if (theSOE != 0)
+    sizedSOE = theSOE;
+  if (theEigenSOE != 0)
+    sizedEigenSOE = theEigenSOE;
+}
+
+
+bool
+AnalysisModel::isSized(LinearSOE *theSOE)
+{
+  // a new system at the address of a deleted one has no equations yet
+  return theSOE != 0 && theSOE == sizedSOE && patternStart != 0 &&
+    theSOE->getNumEqn() == numEqn;
+}
+
+
+bool
+AnalysisModel::isSized(EigenSOE *theEigenSOE)
+{
+  return theEigenSOE != 0 && theEigenSOE == sizedEigenSOE && patternStart != 0;
+}
+
+
+int
+AnalysisModel::getFE_Stamp(void) const
+{
+  return feStamp;
+}
+
+
+bool
+AnalysisModel::isDOFGraphPatternValid(void)
+{
+  if (patternStart == 0 || numPatternEqn != numEqn)
+    return false;
+
+  // check every pair of equations of each FE_Element is an edge of
+  // the saved graph
+  FE_Element *elePtr =0;
+  FE_EleIter &eleIter = this->getFEs();
+  while((elePtr = eleIter()) != 0) {
+    const ID &id = elePtr->getID();
+    int size = id.Size();
+    for (int i=0; i<size; i++) {
+      int eqn1 = id(i)-START_EQN_NUM;
+      if (eqn1 < 0 || eqn1 >= numEqn)
+	continue;
+      for (int j=0; j<size; j++) {
+	int eqn2 = id(j)-START_EQN_NUM;
+	if (eqn2 < 0 || eqn2 >= numEqn || eqn2 == eqn1)
+	  continue;
+	int low = (*patternStart)(eqn1);
+	int high = (*patternStart)(eqn1+1)-1;
+	while (low <= high) {
+	  int middle = (low+high)/2;
+	  int value = (*patternAdj)(middle);
+	  if (value == eqn2)
+	    break;
+	  else if (value < eqn2)
+	    low = middle+1;
+	  else
+	    high = middle-1;
+	}
+	if (low > high)
+	  return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+
 Graph &
 AnalysisModel::getDOFGroupGraph(void)
 {
@@ -431,80 +836,192 @@ AnalysisModel::getDOFGroupGraph(void)
 
 
 
+void
+AnalysisModel::formGather(void)
+{
+    gatherValid = true;
+    numGather = 0;
+    numOtherDOFs = 0;
+
+    int numEntries = 0;
+    DOF_GrpIter &theDOFGrps = this->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFGrps()) != 0)
+      if (dofPtr->getResponseNode() != 0)
+	numEntries += dofPtr->getID().Size();
+
+    if (numEntries > sizeGather) {
+      if (theGather != 0)
+	delete [] theGather;
+      theGather = new NodeResponseEntry[numEntries];
+      sizeGather = numEntries;
+    }
+    if (numDOF_Grp > sizeOtherDOFs) {
+      if (otherDOFs != 0)
+	delete [] otherDOFs;
+      otherDOFs = new DOF_Group *[numDOF_Grp];
+      sizeOtherDOFs = numDOF_Grp;
+    }
+
+    DOF_GrpIter &theDOFGrps2 = this->getDOFs();
+    while ((dofPtr = theDOFGrps2()) != 0) {
+      Node *theNode = dofPtr->getResponseNode();
+      const ID &theID = dofPtr->getID();
+      double *disp, *vel, *accel;
+      int stride;
+      if (theNode == 0 || theNode->getNumberDOF() != theID.Size() ||
+	  theNode->getResponseArrays(disp, vel, accel, stride) < 0) {
+	if (numOtherDOFs < sizeOtherDOFs)
+	  otherDOFs[numOtherDOFs++] = dofPtr;
+	continue;
+      }
+      for (int i=0; i<theID.Size(); i++) {
+	NodeResponseEntry &theEntry = theGather[numGather++];
+	theEntry.eqn = theID(i);
+	theEntry.stride = stride;
+	theEntry.disp = &disp[i];
+	theEntry.vel = &vel[i];
+	theEntry.accel = &accel[i];
+      }
+    }
+}
+
+
 void 
 AnalysisModel::setResponse(const Vector &disp,
 			   const Vector &vel, 
 			   const Vector &accel)
 {
-    DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      NodeResponseEntry &theEntry = theGather[i];
+      int loc = theEntry.eqn;
+      double *d = theEntry.disp;
+      int stride = theEntry.stride;
+      double tDisp = (loc >= 0) ? disp(loc) : d[0];
+      d[2*stride] = tDisp - d[stride];
+      d[3*stride] = tDisp - d[0];
+      d[0] = tDisp;
+      if (loc >= 0) {
+	*theEntry.vel = vel(loc);
+	*theEntry.accel = accel(loc);
+      }
+    }
 
-    while ((dofPtr = theDOFGrps()) != 0) {
-	dofPtr->setNodeDisp(disp);
-	dofPtr->setNodeVel(vel);
-	dofPtr->setNodeAccel(accel);	
+    for (int i=0; i<numOtherDOFs; i++) {
+	otherDOFs[i]->setNodeDisp(disp);
+	otherDOFs[i]->setNodeVel(vel);
+	otherDOFs[i]->setNodeAccel(accel);	
     }
 }	
 	
 void 
 AnalysisModel::setDisp(const Vector &disp)
 {
-    DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      NodeResponseEntry &theEntry = theGather[i];
+      int loc = theEntry.eqn;
+      double *d = theEntry.disp;
+      int stride = theEntry.stride;
+      double tDisp = (loc >= 0) ? disp(loc) : d[0];
+      d[2*stride] = tDisp - d[stride];
+      d[3*stride] = tDisp - d[0];
+      d[0] = tDisp;
+    }
 
-    while ((dofPtr = theDOFGrps()) != 0) 
-	dofPtr->setNodeDisp(disp);
+    for (int i=0; i<numOtherDOFs; i++) 
+	otherDOFs[i]->setNodeDisp(disp);
 }	
 	
 void 
 AnalysisModel::setVel(const Vector &vel)
 {
-        DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
-    
-    while ((dofPtr = theDOFGrps()) != 0) 
-	dofPtr->setNodeVel(vel);
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      int loc = theGather[i].eqn;
+      if (loc >= 0)
+	*theGather[i].vel = vel(loc);
+    }
+
+    for (int i=0; i<numOtherDOFs; i++) 
+	otherDOFs[i]->setNodeVel(vel);
 }	
 	
 
 void 
 AnalysisModel::setAccel(const Vector &accel)
 {
-    DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
-    
-    while ((dofPtr = theDOFGrps()) != 0) 
-	dofPtr->setNodeAccel(accel);	
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      int loc = theGather[i].eqn;
+      if (loc >= 0)
+	*theGather[i].accel = accel(loc);
+    }
+
+    for (int i=0; i<numOtherDOFs; i++) 
+	otherDOFs[i]->setNodeAccel(accel);	
 }	
 
 void 
 AnalysisModel::incrDisp(const Vector &disp)
 {
-    DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      NodeResponseEntry &theEntry = theGather[i];
+      int loc = theEntry.eqn;
+      double *d = theEntry.disp;
+      int stride = theEntry.stride;
+      double incrDispI = (loc >= 0) ? disp(loc) : 0.0;
+      d[0] += incrDispI;
+      d[2*stride] += incrDispI;
+      d[3*stride] = incrDispI;
+    }
 
-    while ((dofPtr = theDOFGrps()) != 0) 
-	dofPtr->incrNodeDisp(disp);
+    for (int i=0; i<numOtherDOFs; i++) 
+	otherDOFs[i]->incrNodeDisp(disp);
 }	
 	
 void 
 AnalysisModel::incrVel(const Vector &vel)
 {
-        DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
-    
-    while ((dofPtr = theDOFGrps()) != 0) 
-	dofPtr->incrNodeVel(vel);
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      int loc = theGather[i].eqn;
+      if (loc >= 0)
+	*theGather[i].vel += vel(loc);
+    }
+
+    for (int i=0; i<numOtherDOFs; i++) 
+	otherDOFs[i]->incrNodeVel(vel);
 }	
 	
 void 
 AnalysisModel::incrAccel(const Vector &accel)
 {
-    DOF_GrpIter &theDOFGrps = this->getDOFs();
-    DOF_Group 	*dofPtr;
-    
-    while ((dofPtr = theDOFGrps()) != 0) 
-	dofPtr->incrNodeAccel(accel);	
+    if (gatherValid == false)
+      this->formGather();
+
+    for (int i=0; i<numGather; i++) {
+      int loc = theGather[i].eqn;
+      if (loc >= 0)
+	*theGather[i].accel += accel(loc);
+    }
+
+    for (int i=0; i<numOtherDOFs; i++) 
+	otherDOFs[i]->incrNodeAccel(accel);	
 }	
 
 
@@ -552,6 +1069,18 @@ AnalysisModel::setEigenvector(int mode, const Vector &eigenvalue)
 	dofPtr->setEigenvector(mode, eigenvalue);	
 }	
 
+void 
+AnalysisModel::setEigenvectors(const double *eigenvectors, int numEqn, int numModes)
+{
+    // one pass over the DOF_Groups for all the modes, the eigenvectors
+    // stored by column in one array of numEqn rows
+    DOF_GrpIter &theDOFGrps = this->getDOFs();
+    DOF_Group 	*dofPtr;
+    
+    while ((dofPtr = theDOFGrps()) != 0) 
+	dofPtr->setEigenvectors(eigenvectors, numEqn, numModes);
+}	
+
 void 
 AnalysisModel::applyLoadDomain(double pseudoTime)
 {
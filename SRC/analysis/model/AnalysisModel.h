@@ -40,6 +40,9 @@
 // What: "@(#) AnalysisModel.h, revA"
 
 #include <MovableObject.h>
+#include <ComponentRange.h>
+#include <stddef.h>
+#include <vector>
 
 class TaggedObjectStorage;
 class Domain;
@@ -49,8 +52,13 @@ class Graph;
 class FE_Element;
 class DOF_Group;
 class Vector;
+class ID;
 class FEM_ObjectBroker;
 class ConstraintHandler;
+class DOF_Numberer;
+class LinearSOE;
+class EigenSOE;
+struct NodeResponseEntry;
 
 class AnalysisModel: public MovableObject
 {
@@ -70,15 +78,53 @@ class AnalysisModel: public MovableObject
     
     // methods to access the FE_Elements and DOF_Groups and their numbers
     virtual int getNumDOF_Groups(void) const;		
+    virtual int getNumFE_Elements(void) const;
     virtual DOF_Group *getDOF_GroupPtr(int tag);	
     virtual FE_EleIter &getFEs();
     virtual DOF_GrpIter &getDOFs();
 
+    // methods to access the FE_Elements and DOF_Groups as ranges, in the
+    // order of getFEs() and getDOFs(); valid until the model changes
+    virtual ComponentRange<FE_Element> getFE_Range(void);
+    virtual ComponentRange<DOF_Group> getDOF_Range(void);
+
+    // method to have getFEs() return the FE_Elements grouped by the class
+    // of their element, and within a group in the order of their smallest
+    // equation number if byEqn, so that the elements of a class are formed
+    // one after the other and their contributions go to the system in order
+    virtual void setFE_Order(bool byClass, bool byEqn = false);
+
     // method to access the connectivity for SysOfEqn to size itself
     virtual void setNumEqn(int) ;	
     virtual int getNumEqn(void) const ; 
     virtual Graph &getDOFGraph(void);
     virtual Graph &getDOFGroupGraph(void);
+
+    // the approximate bytes held by the FE_Elements, DOF_Groups and graphs
+    virtual size_t getNumBytes(void);
+
+    // methods to record the sparsity of the DOF graph and to check if 
+    // the connectivity of the current FE_Elements is contained in it
+    virtual void saveDOFGraphPattern(void);
+    virtual void clearDOFGraphPattern(void);
+    virtual bool isDOFGraphPatternValid(void);
+
+    // methods to record the domain stamp, ConstraintHandler and
+    // DOF_Numberer the FE_Elements, DOF_Groups and equation numbers were
+    // built for, and the systems of equations sized for the saved DOF
+    // graph, so that another analysis of the model can reuse them; the
+    // records go with clearAll() and clearDOFGraphPattern() respectively
+    virtual void setBuilt(int domainStamp, ConstraintHandler *theHandler,
+			  DOF_Numberer *theNumberer);
+    virtual bool isBuilt(int domainStamp, ConstraintHandler *theHandler,
+			 DOF_Numberer *theNumberer);
+    virtual void setSized(LinearSOE *theSOE, EigenSOE *theEigenSOE);
+    virtual bool isSized(LinearSOE *theSOE);
+    virtual bool isSized(EigenSOE *theEigenSOE);
+
+    // a stamp changed whenever FE_Elements are added or cleared, so that
+    // what is formed from the FE_Elements can be checked to be current
+    virtual int getFE_Stamp(void) const;
     
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new nodal trial response quantities.
@@ -96,6 +142,7 @@ class AnalysisModel: public MovableObject
     // methods added to store the eigenvalues and vectors in the domain
     virtual void setNumEigenvectors(int numEigenvectors);
     virtual void setEigenvector(int mode, const Vector &);
+    virtual void setEigenvectors(const double *eigenvectors, int numEqn, int numModes);
     virtual void setEigenvalues(const Vector &);    
     virtual const Vector &getEigenvalues(void);    
     const Vector *getModalDampingFactors(void);
@@ -135,11 +182,49 @@ class AnalysisModel: public MovableObject
     int numDOF_Grp;            // number of DOF_Group objects added
     int numEqn;                // numEqn set by the ConstraintHandler typically
 
+    int numPatternEqn;         // numEqn and adjacency of the saved DOF graph
+    ID *patternStart;
+    ID *patternAdj;
+
+    int builtStamp;            // 0 if not built
+    ConstraintHandler *builtHandler;
+    DOF_Numberer *builtNumberer;
+    LinearSOE *sizedSOE;
+    EigenSOE *sizedEigenSOE;
+    int feStamp;               // changed by addFE_Element() and clearAll()
+
     TaggedObjectStorage  *theFEs;
     TaggedObjectStorage  *theDOFs;
     
     FE_EleIter    *theFEiter;     
     DOF_GrpIter   *theDOFiter;    
+
+    bool orderByClass;         // order set with setFE_Order()
+    bool orderByEqn;
+    bool orderValid;           // false until the FE_Elements are ordered again
+    FE_Element **orderedFEs;
+    int sizeOrderedFEs;
+
+    void orderFEs(void);
+
+    // the equation and nodal trial response entries of each dof of the
+    // DOF_Groups that set their Node response straight from their ID, for
+    // setDisp() etc. to gather the response without going through the
+    // DOF_Groups; the other DOF_Groups are still invoked. Formed again
+    // after the DOF_Groups or the equation numbers change.
+    bool gatherValid;
+    NodeResponseEntry *theGather;
+    int numGather, sizeGather;
+    DOF_Group **otherDOFs;
+    int numOtherDOFs, sizeOtherDOFs;
+
+    void formGather(void);
+
+    // the arrays behind getFE_Range() and getDOF_Range()
+    std::vector<FE_Element *> theFE_Range;
+    std::vector<DOF_Group *> theDOF_Range;
+    bool feRangeValid;
+    bool dofRangeValid;
 };
 
 #endif
@@ -38,7 +38,8 @@
 //	constructor that takes the model, just the basic iter
 
 FE_EleIter::FE_EleIter(TaggedObjectStorage *theStorage)
-  :myIter(&(theStorage->getComponents()))
+  :myIter(&(theStorage->getComponents())),
+   orderedFEs(0), numOrderedFEs(0), currOrderedFE(0)
 {
 }
 
@@ -50,13 +51,31 @@ FE_EleIter::~FE_EleIter()
 void
 FE_EleIter::reset(void)
 {
-    myIter->reset();
+    if (orderedFEs != 0)
+	currOrderedFE = 0;
+    else
+	myIter->reset();
 }    
 
+void
+FE_EleIter::setOrder(FE_Element **theOrderedFEs, int numFEs)
+{
+    orderedFEs = theOrderedFEs;
+    numOrderedFEs = numFEs;
+    currOrderedFE = 0;
+}
+
 
 FE_Element *
 FE_EleIter::operator()(void)
 {
+    if (orderedFEs != 0) {
+	if (currOrderedFE < numOrderedFEs)
+	    return orderedFEs[currOrderedFE++];
+	else
+	    return 0;
+    }
+
     // check if we still have elements in the model
     // if not return 0, indicating we are done
     TaggedObject *theComponent = (*myIter)();
@@ -53,10 +53,17 @@ class FE_EleIter
     virtual void reset(void);
     virtual FE_Element *operator()(void);
 
+    // method to have the iter return the FE_Elements of an array in
+    // place of those of the storage, a 0 array returns to the storage
+    virtual void setOrder(FE_Element **theOrderedFEs, int numOrderedFEs);
+
   protected:
     
   private:
     TaggedObjectIter *myIter;
+    FE_Element **orderedFEs;
+    int numOrderedFEs;
+    int currOrderedFE;
 };
 
 #endif
@@ -57,21 +57,24 @@
 
 DOF_Numberer::DOF_Numberer(int clsTag) 
 :MovableObject(clsTag),
- theAnalysisModel(0), theGraphNumberer(0)
+ theAnalysisModel(0), theGraphNumberer(0),
+ numSavedGroups(0), numSavedEqn(0)
 {
 
 }
 
 DOF_Numberer::DOF_Numberer(GraphNumberer &aGraphNumberer)
 :MovableObject(NUMBERER_TAG_DOF_Numberer),
- theAnalysisModel(0), theGraphNumberer(&aGraphNumberer)
+ theAnalysisModel(0), theGraphNumberer(&aGraphNumberer),
+ numSavedGroups(0), numSavedEqn(0)
 {
 
 }    
 
 DOF_Numberer::DOF_Numberer()
 :MovableObject(NUMBERER_TAG_DOF_Numberer),
- theAnalysisModel(0), theGraphNumberer(0)
+ theAnalysisModel(0), theGraphNumberer(0),
+ numSavedGroups(0), numSavedEqn(0)
 {
 
 }    
@@ -229,6 +232,105 @@ DOF_Numberer::numberDOF(int lastDOF_Group)
 
 
 
+// int saveNumbering(void)
+//	Method to record the node tag and the equation numbers of each
+//	DOF_Group currently in the AnalysisModel.
+
+int
+DOF_Numberer::saveNumbering(void)
+{
+    numSavedGroups = 0;
+    numSavedEqn = 0;
+
+    if (theAnalysisModel == 0)
+	return -1;
+
+    int loc = 0;
+    DOF_GrpIter &theDOFs = theAnalysisModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+	const ID &theID = dofPtr->getID();
+	savedNodeTags[numSavedGroups] = dofPtr->getNodeTag();
+	savedLocs[numSavedGroups] = loc;
+	for (int j=0; j<theID.Size(); j++)
+	    savedIDs[loc++] = theID(j);
+	numSavedGroups++;
+    }
+    savedLocs[numSavedGroups] = loc;
+    numSavedEqn = theAnalysisModel->getNumEqn();
+
+    return 0;
+}
+
+
+// int reuseNumbering(void)
+//	Method to assign the saved equation numbers to the DOF_Groups in the
+//	AnalysisModel, which have yet to be numbered. This is only done if
+//	the DOF_Groups are for the same nodes, in the same order, with the
+//	same free and constrained DOFs as the saved ones, in which case 0 is
+//	returned. Otherwise the DOF_Groups are left unnumbered and a
+//	negative number is returned; numberDOF() must then be invoked.
+
+int
+DOF_Numberer::reuseNumbering(void)
+{
+    if (theAnalysisModel == 0 || numSavedEqn == 0 ||
+	theAnalysisModel->getNumDOF_Groups() != numSavedGroups)
+	return -1;
+
+    // first check the DOF_Groups match those saved, each saved equation
+    // number must be used once only
+    ID used(numSavedEqn);
+    int numEqn = 0;
+    int i = 0;
+    DOF_GrpIter &theDOFs = theAnalysisModel->getDOFs();
+    DOF_Group *dofPtr;
+    while ((dofPtr = theDOFs()) != 0) {
+	int nodeTag = dofPtr->getNodeTag();
+	const ID &theID = dofPtr->getID();
+	int loc = savedLocs(i);
+	if (nodeTag < 0 || nodeTag != savedNodeTags(i) ||
+	    theID.Size() != savedLocs(i+1) - loc)
+	    return -2;
+	for (int j=0; j<theID.Size(); j++) {
+	    int code = theID(j);
+	    int eqn = savedIDs(loc+j);
+	    if (code == -2 || code == -3) {
+		if (eqn < 0 || eqn >= numSavedEqn || used(eqn) != 0)
+		    return -3;
+		used(eqn) = 1;
+		numEqn++;
+	    } else if (code != eqn)
+		return -4;
+	}
+	i++;
+    }
+
+    if (numEqn != numSavedEqn)
+	return -5;
+
+    // now set the IDs of the DOF_Groups and FE_Elements
+    i = 0;
+    DOF_GrpIter &theDOFs2 = theAnalysisModel->getDOFs();
+    while ((dofPtr = theDOFs2()) != 0) {
+	const ID &theID = dofPtr->getID();
+	int loc = savedLocs(i++);
+	for (int j=0; j<theID.Size(); j++)
+	    if (theID(j) == -2 || theID(j) == -3) 
+		dofPtr->setID(j, savedIDs(loc+j));
+    }
+
+    FE_EleIter &theEle = theAnalysisModel->getFEs();
+    FE_Element *elePtr;
+    while ((elePtr = theEle()) != 0)
+	elePtr->setID();
+
+    theAnalysisModel->setNumEqn(numEqn);
+
+    return 0;
+}
+
+
 int 
 DOF_Numberer::numberDOF(ID &lastDOFs) 
 {
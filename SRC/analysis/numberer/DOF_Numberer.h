@@ -39,11 +39,11 @@
 #define DOF_Numberer_h
 
 #include <MovableObject.h>
+#include <ID.h>
 
 class AnalysisModel;
 class GraphNumberer;
 class FEM_ObjectBroker;
-class ID;
 
 class DOF_Numberer: public MovableObject
 {
@@ -60,6 +60,11 @@ class DOF_Numberer: public MovableObject
     virtual int numberDOF(int lastDOF_Group = -1);
     virtual int numberDOF(ID &lastDOF_Groups);    
 
+    // save the numbering of the DOF_Groups in the AnalysisModel, and
+    // reapply it to a new set of DOF_Groups for the same DOFs
+    virtual int saveNumbering(void);
+    virtual int reuseNumbering(void);
+
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
 			 FEM_ObjectBroker &theBroker);
@@ -72,6 +77,12 @@ class DOF_Numberer: public MovableObject
   private:
     AnalysisModel *theAnalysisModel;
     GraphNumberer *theGraphNumberer;
+
+    int numSavedGroups;  // number of DOF_Groups and equations saved
+    int numSavedEqn;
+    ID savedNodeTags;    // node tag and start location in savedIDs of each
+    ID savedLocs;  
+    ID savedIDs;         // equation numbers of the saved DOF_Groups
 };
 
 #endif
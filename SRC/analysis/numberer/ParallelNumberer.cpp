@@ -47,6 +47,11 @@
 #include <MP_Constraint.h>
 #include <MP_ConstraintIter.h>
 #include <Node.h>
+#include <stdlib.h>
+
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
 
 
 ParallelNumberer::ParallelNumberer(int dTag, int numSub, Channel **theC) 
@@ -109,9 +114,9 @@ ParallelNumberer::setChannels(int nChannels, Channel **theC)
 
 
 // int numberDOF(void)
-// The ParalellNumberer sitting on P0, collects each partition graph from P1 through Pn-1, 
-// merges them into 1 large graph, & then numbers this graph. The ParallelNumberers sitting 
-// on P1 through Pn-1 then receive the mapping info for the dof tag and dof numbering from P0.
+// Numbers the dof of all the partitions, in OpenSeesMP without a GraphNumberer by
+// numberDistributed(), otherwise by numberGathered() on P0; the dof constrained by
+// MP_Constraints and the FE_Element IDs are then set on each process.
 
 int
 ParallelNumberer::numberDOF(int lastDOF)
@@ -134,6 +139,75 @@ ParallelNumberer::numberDOF(int lastDOF)
     opserr << " does not use the lastDOF as requested\n";
   }
 
+  // the plain numbering needs no graph, each process numbers its own
+  if (theNumberer == 0 && this->isDistributed())
+    result = this->numberDistributed(*theModel);
+  else
+    result = this->numberGathered(*theModel, lastDOF);
+
+  // iterate through the DOFs one last time setting any -4 values
+  // iterate throgh  the DOFs second time setting -3 values
+  AnalysisModel *theAModel = this->getAnalysisModelPtr();
+  DOF_GrpIter &tDOFs = theAModel->getDOFs();
+
+  DOF_Group *dofPtr;
+  while ((dofPtr = tDOFs()) != 0) {
+    const ID &theID = dofPtr->getID();
+    int have4s = 0;
+    for (int i=0; i<theID.Size(); i++)
+      if (theID(i) == -4) have4s = 1;
+    
+    if (have4s == 1) {
+      int nodeID = dofPtr->getNodeTag();
+      // loop through the MP_Constraints to see if any of the
+      // DOFs are constrained, note constraint matrix must be diagonal
+      // with 1's on the diagonal
+      MP_ConstraintIter &theMPs = theDomain->getMPs();
+      MP_Constraint *mpPtr;
+      while ((mpPtr = theMPs()) != 0 ) {
+	// note keep looping over all in case multiple constraints
+	// are used to constrain a node -- can't assume intelli user
+	if (mpPtr->getNodeConstrained() == nodeID) {
+	  int nodeRetained = mpPtr->getNodeRetained();
+	  Node *nodeRetainedPtr = theDomain->getNode(nodeRetained);
+	  DOF_Group *retainedDOF = nodeRetainedPtr->getDOF_GroupPtr();
+	  const ID&retainedDOFIDs = retainedDOF->getID();
+	  const ID&constrainedDOFs = mpPtr->getConstrainedDOFs();
+	  const ID&retainedDOFs = mpPtr->getRetainedDOFs();
+	  for (int i=0; i<constrainedDOFs.Size(); i++) {
+	    int dofC = constrainedDOFs(i);
+	    int dofR = retainedDOFs(i);
+	    int dofID = retainedDOFIDs(dofR);
+	    dofPtr->setID(dofC, dofID);
+	  }
+	}
+      }		
+    }	
+  }
+
+  // iterate through the FE_Element getting them to set their IDs
+  FE_EleIter &theEle = theModel->getFEs();
+  FE_Element *elePtr;
+  while ((elePtr = theEle()) != 0)
+    elePtr->setID();
+
+  theModel->clearDOFGroupGraph();
+  
+  return result;
+}
+
+
+// int numberGathered(AnalysisModel &, int)
+// The ParalellNumberer sitting on P0, collects each partition graph from P1 through Pn-1, 
+// merges them into 1 large graph, & then numbers this graph. The ParallelNumberers sitting 
+// on P1 through Pn-1 then receive the mapping info for the dof tag and dof numbering from P0.
+
+int
+ParallelNumberer::numberGathered(AnalysisModel &theAnalysisModel, int lastDOF)
+{
+  int result = 0;
+  AnalysisModel *theModel = &theAnalysisModel;
+
   Graph &theGraph = theModel->getDOFGroupGraph();
 
   // if subdomain, collect graph, send it off, get 
@@ -307,56 +381,220 @@ ParallelNumberer::numberDOF(int lastDOF)
     delete [] theSubdomainIDs;
   }
 
+  return result;
+}
 
 
-  // iterate through the DOFs one last time setting any -4 values
-  // iterate throgh  the DOFs second time setting -3 values
-  AnalysisModel *theAModel = this->getAnalysisModelPtr();
-  DOF_GrpIter &tDOFs = theAModel->getDOFs();
+// int reuseNumbering(void)
+// Always returns -1, the numbering is never reused: whether the saved one
+// still fits is known only to each process for its own partition, and
+// numberDOF() and the sizing of a distributed system that follow a new
+// numbering are collective, so the processes must all take the same path.
+
+int
+ParallelNumberer::reuseNumbering(void)
+{
+  return -1;
+}
+
+
+// bool isDistributed(void)
+// The processes of OpenSeesMP number by collective MPI calls; the test is the same
+// on all of them, so they all take the same path.
+
+bool
+ParallelNumberer::isDistributed(void)
+{
+#ifdef _PARALLEL_INTERPRETERS
+  int mpiInitialized = 0;
+  MPI_Initialized(&mpiInitialized);
+  if (mpiInitialized) {
+    int np = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &np);
+    return (np > 1);
+  }
+#endif
+  return false;
+}
+
+
+#ifdef _PARALLEL_INTERPRETERS
+// the entries a directory process holds: the node, the order of the
+// process holding it (1 through np-1, then 0) and the entry's position
+static int
+compareDirectoryEntries(const void *a, const void *b)
+{
+  const int *entryA = (const int *)a;
+  const int *entryB = (const int *)b;
+  if (entryA[0] != entryB[0])
+    return (entryA[0] < entryB[0]) ? -1 : 1;
+  if (entryA[1] != entryB[1])
+    return (entryA[1] < entryB[1]) ? -1 : 1;
+  return 0;
+}
+#endif
+
+
+// int numberDistributed(AnalysisModel &)
+// Numbers the dof as numberGathered() does without a GraphNumberer, the partitions in
+// the order P1 through Pn-1 then P0 and each partition's DOF_Groups in order, a node
+// in several partitions numbered by the first, but without collecting the graphs:
+// each node is looked up in a directory on process nodeTag % np, which finds the
+// partition numbering it, each process numbers the dof it owns from the sum of the
+// numbers of dof of the partitions before it, and the directory passes the start
+// of each shared node on to the others. Memory and messages grow with the size of
+// the partition, not of the model.
+
+int
+ParallelNumberer::numberDistributed(AnalysisModel &theModel)
+{
+  int result = 0;
 
+#ifdef _PARALLEL_INTERPRETERS
+  int np = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+  int myOrder = (processID == 0) ? np : processID;
+
+  // the DOF_Groups in order, with their node and number of free dof
+  int numGroups = theModel.getNumDOF_Groups();
+  DOF_Group **theGroups = new DOF_Group *[numGroups+1];
+  int *sendCounts = new int[4*np];
+  int *sendDispls = sendCounts + np;
+  int *recvCounts = sendCounts + 2*np;
+  int *recvDispls = sendCounts + 3*np;
+  for (int p=0; p<np; p++)
+    sendCounts[p] = 0;
+
+  DOF_GrpIter &theDOFs = theModel.getDOFs();
   DOF_Group *dofPtr;
-  while ((dofPtr = tDOFs()) != 0) {
-    const ID &theID = dofPtr->getID();
-    int have4s = 0;
-    for (int i=0; i<theID.Size(); i++)
-      if (theID(i) == -4) have4s = 1;
-    
-    if (have4s == 1) {
-      int nodeID = dofPtr->getNodeTag();
-      // loop through the MP_Constraints to see if any of the
-      // DOFs are constrained, note constraint matrix must be diagonal
-      // with 1's on the diagonal
-      MP_ConstraintIter &theMPs = theDomain->getMPs();
-      MP_Constraint *mpPtr;
-      while ((mpPtr = theMPs()) != 0 ) {
-	// note keep looping over all in case multiple constraints
-	// are used to constrain a node -- can't assume intelli user
-	if (mpPtr->getNodeConstrained() == nodeID) {
-	  int nodeRetained = mpPtr->getNodeRetained();
-	  Node *nodeRetainedPtr = theDomain->getNode(nodeRetained);
-	  DOF_Group *retainedDOF = nodeRetainedPtr->getDOF_GroupPtr();
-	  const ID&retainedDOFIDs = retainedDOF->getID();
-	  const ID&constrainedDOFs = mpPtr->getConstrainedDOFs();
-	  const ID&retainedDOFs = mpPtr->getRetainedDOFs();
-	  for (int i=0; i<constrainedDOFs.Size(); i++) {
-	    int dofC = constrainedDOFs(i);
-	    int dofR = retainedDOFs(i);
-	    int dofID = retainedDOFIDs(dofR);
-	    dofPtr->setID(dofC, dofID);
-	  }
-	}
-      }		
-    }	
+  int numGroup = 0;
+  while ((dofPtr = theDOFs()) != 0 && numGroup < numGroups) {
+    theGroups[numGroup++] = dofPtr;
+    int nodeTag = dofPtr->getNodeTag();
+    if (nodeTag >= 0)
+      sendCounts[nodeTag % np]++;
+  }
+  numGroups = numGroup;
+
+  // the nodes to their directories; a DOF_Group without a node (e.g. of a
+  // LagrangeMP_FE) is its partition's own
+  int numSend = 0;
+  for (int p=0; p<np; p++) {
+    sendDispls[p] = numSend;
+    numSend += sendCounts[p];
+  }
+  MPI_Alltoall(sendCounts, 1, MPI_INT, recvCounts, 1, MPI_INT, MPI_COMM_WORLD);
+  int numRecv = 0;
+  for (int p=0; p<np; p++) {
+    recvDispls[p] = numRecv;
+    numRecv += recvCounts[p];
   }
 
-  // iterate through the FE_Element getting them to set their IDs
-  FE_EleIter &theEle = theModel->getFEs();
-  FE_Element *elePtr;
-  while ((elePtr = theEle()) != 0)
-    elePtr->setID();
+  int *position = new int[numGroups+1];
+  int *sendData = new int[numSend+1];
+  int *recvData = new int[numRecv+1];
+  int *entries = new int[3*numRecv+1];
+  int *fill = new int[np];
+  for (int p=0; p<np; p++)
+    fill[p] = sendDispls[p];
+  for (int i=0; i<numGroups; i++) {
+    int nodeTag = theGroups[i]->getNodeTag();
+    if (nodeTag >= 0) {
+      position[i] = fill[nodeTag % np]++;
+      sendData[position[i]] = nodeTag;
+    } else
+      position[i] = -1;
+  }
+  MPI_Alltoallv(sendData, sendCounts, sendDispls, MPI_INT,
+		recvData, recvCounts, recvDispls, MPI_INT, MPI_COMM_WORLD);
+
+  // the directory sorts its entries by node then order, the first of each
+  // node's entries is its owner's
+  for (int p=0; p<np; p++) {
+    int order = (p == 0) ? np : p;
+    for (int k=recvDispls[p]; k<recvDispls[p]+recvCounts[p]; k++) {
+      entries[3*k] = recvData[k];
+      entries[3*k+1] = order;
+      entries[3*k+2] = k;
+    }
+  }
+  qsort(entries, numRecv, 3*sizeof(int), compareDirectoryEntries);
+  for (int k=0; k<numRecv; ) {
+    int last = k;
+    while (last < numRecv && entries[3*last] == entries[3*k])
+      last++;
+    for (int l=k; l<last; l++)
+      recvData[entries[3*l+2]] = entries[3*k+1];
+    k = last;
+  }
+  MPI_Alltoallv(recvData, recvCounts, recvDispls, MPI_INT,
+		sendData, sendCounts, sendDispls, MPI_INT, MPI_COMM_WORLD);
+
+  // the dof owned, and the offset of this partition from those before it
+  int *startIDs = new int[numGroups+1];
+  int numOwned = 0;
+  for (int i=0; i<numGroups; i++)
+    if (position[i] < 0 || sendData[position[i]] == myOrder)
+      numOwned += theGroups[i]->getNumFreeDOF();
+
+  int *numOwnedAll = new int[np];
+  MPI_Allgather(&numOwned, 1, MPI_INT, numOwnedAll, 1, MPI_INT, MPI_COMM_WORLD);
+  int startID = 0;
+  for (int p=0; p<np; p++) {
+    int order = (p == 0) ? np : p;
+    if (order < myOrder)
+      startID += numOwnedAll[p];
+  }
+
+  for (int i=0; i<numGroups; i++) {
+    startIDs[i] = -1;
+    if (position[i] < 0 || sendData[position[i]] == myOrder) {
+      startIDs[i] = startID;
+      startID += theGroups[i]->getNumFreeDOF();
+    }
+  }
+
+  // the starts of the owners to the directories and back to the others
+  for (int i=0; i<numGroups; i++)
+    if (position[i] >= 0)
+      sendData[position[i]] = startIDs[i];
+  MPI_Alltoallv(sendData, sendCounts, sendDispls, MPI_INT,
+		recvData, recvCounts, recvDispls, MPI_INT, MPI_COMM_WORLD);
+  for (int k=0; k<numRecv; ) {
+    int last = k;
+    while (last < numRecv && entries[3*last] == entries[3*k])
+      last++;
+    int ownerStart = recvData[entries[3*k+2]];
+    for (int l=k; l<last; l++)
+      recvData[entries[3*l+2]] = ownerStart;
+    k = last;
+  }
+  MPI_Alltoallv(recvData, recvCounts, recvDispls, MPI_INT,
+		sendData, sendCounts, sendDispls, MPI_INT, MPI_COMM_WORLD);
+
+  for (int i=0; i<numGroups; i++) {
+    int startDOF = (position[i] >= 0) ? sendData[position[i]] : startIDs[i];
+    DOF_Group *dofPtr = theGroups[i];
+    const ID &theDOFID = dofPtr->getID();
+    int idSize = theDOFID.Size();
+    for (int j=0; j<idSize; j++)
+      if (theDOFID(j) == -2 || theDOFID(j) == -3) dofPtr->setID(j, startDOF++);
+  }
+
+  delete [] theGroups;
+  delete [] sendCounts;
+  delete [] position;
+  delete [] sendData;
+  delete [] recvData;
+  delete [] entries;
+  delete [] fill;
+  delete [] startIDs;
+  delete [] numOwnedAll;
+#else
+  opserr << "WARNING ParallelNumberer::numberDistributed() - needs MPI\n";
+  result = -1;
+#endif
 
-  theModel->clearDOFGroupGraph();
-  
   return result;
 }
 
@@ -28,10 +28,12 @@
 // Description: This file contains the class definition for ParallelNumberer.
 // ParallelNumberer is a subclass of DOF_Numberer. The ParallelNumberer numbers
 // the dof of a partitioned domain, where the partitions are on different processors
-// and each processor has a ParallelNumberer. The ParalellNumberer sitting on P0, 
-// collects each partition graph from P1 through Pn-1, merges them into 1 large graph, 
-// & then numbers this graph. The ParallelNumberers sitting on P1 through Pn-1 then 
-// receive the mapping info for the dof tag and dof numbering from P0.
+// and each processor has a ParallelNumberer. With a GraphNumberer the ParalellNumberer 
+// sitting on P0, collects each partition graph from P1 through Pn-1, merges them into 
+// 1 large graph, & then numbers this graph. The ParallelNumberers sitting on P1 through 
+// Pn-1 then receive the mapping info for the dof tag and dof numbering from P0. Without 
+// one the processes of OpenSeesMP number their own dof, sharing only the numbers of the 
+// nodes in several partitions, see numberDistributed().
 //
 // What: "@(#) ParallelNumberer.h, revA"
 
@@ -53,6 +55,7 @@ class ParallelNumberer: public DOF_Numberer
 
     int numberDOF(int lastDOF = -1);
     int numberDOF(ID &lastDOFs);    
+    int reuseNumbering(void);
 
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, 
@@ -63,6 +66,9 @@ class ParallelNumberer: public DOF_Numberer
 
   protected:
     int mergeSubGraph(Graph &theGraph, Graph &theSubGraph, ID &vertexTags, ID &vertexRefs, ID &theSubdomainMap);
+    int numberGathered(AnalysisModel &theModel, int lastDOF);
+    int numberDistributed(AnalysisModel &theModel);
+    bool isDistributed(void);
 
   private:
     GraphNumberer *theNumberer;
@@ -51,9 +51,47 @@ extern SimulationInformation *theSimulationInfoPtr;
 #include <dlfcn.h>
 #endif
 
+#include <map>
+#include <string>
+
+//
+// the libraries opened and the functions looked up in them are kept, so that
+// a package used many times in a model is only searched for once and its
+// localInit is only called when the library is first opened. a function
+// found missing in an opened library is kept as NULL.
+//
+
+static std::map<std::string, void *> theLibraries;
+static std::map<std::string, void *> theLibraryFunctions;
+
+static int
+openLibraryFunction(const char *libName, const char *funcName, void **libHandle, void **funcHandle);
+
 int 
 getLibraryFunction(const char *libName, const char *funcName, void **libHandle, void **funcHandle) {
 
+  std::string key(libName);
+  key += ':';
+  key += funcName;
+
+  std::map<std::string, void *>::iterator theFunc = theLibraryFunctions.find(key);
+  if (theFunc != theLibraryFunctions.end()) {
+    *libHandle = theLibraries[libName];
+    *funcHandle = theFunc->second;
+    return (theFunc->second != NULL) ? 0 : -1;
+  }
+
+  int result = openLibraryFunction(libName, funcName, libHandle, funcHandle);
+
+  if (result == 0 || theLibraries.find(libName) != theLibraries.end())
+    theLibraryFunctions[key] = (result == 0) ? *funcHandle : NULL;
+
+  return result;
+}
+
+static int 
+openLibraryFunction(const char *libName, const char *funcName, void **libHandle, void **funcHandle) {
+
   int result = 0;
   
   *libHandle = NULL;
@@ -286,13 +324,39 @@ getLibraryFunction(const char *libName, const char *funcName, void **libHandle,
   */
   char *error;
 
-  *libHandle = dlopen (localLibName, RTLD_NOW);
+  // a library already opened is not opened or initialized again
+  bool libOpened = false;
+  std::map<std::string, void *>::iterator theLib = theLibraries.find(libName);
+  if (theLib != theLibraries.end()) {
+    *libHandle = theLib->second;
+    libOpened = true;
+  } else
+    *libHandle = dlopen (localLibName, RTLD_NOW);
   
   if (*libHandle == NULL)  {
     delete [] localLibName;
     return -1; // no lib exists
   }
 
+  theLibraries[libName] = *libHandle;
+
+  if (libOpened == false) {
+    typedef int (*localInitPtrType)();
+    localInitPtrType initFunct;
+    void *funcPtr = dlsym(*libHandle, "localInit");
+  
+    if (funcPtr != NULL ) {
+      initFunct = (localInitPtrType)funcPtr;
+      initFunct();
+    } else {
+      funcPtr = dlsym(*libHandle, "localinit_");
+      if (funcPtr != NULL ) {
+        initFunct = (localInitPtrType)funcPtr;
+        initFunct();
+      }
+    }
+  }
+
   void *funcPtr = dlsym(*libHandle, funcName);
   
   error = dlerror();
@@ -312,7 +376,7 @@ getLibraryFunction(const char *libName, const char *funcName, void **libHandle,
   } 
   
   if (funcPtr == NULL)  {
-    dlclose(*libHandle);
+    // the library is kept open for the other functions looked up in it
     delete [] localLibName;
     return -1;
   }
@@ -320,21 +384,6 @@ getLibraryFunction(const char *libName, const char *funcName, void **libHandle,
   
   *funcHandle = funcPtr;
   
-  typedef int (*localInitPtrType)();
-  localInitPtrType initFunct;
-  funcPtr = dlsym(*libHandle, "localInit");
-  
-  if (funcPtr != NULL ) {
-    initFunct = (localInitPtrType)funcPtr;
-    initFunct();
-  } else {
-    funcPtr = dlsym(*libHandle, "localinit_");
-    if (funcPtr != NULL ) {
-      initFunct = (localInitPtrType)funcPtr;
-      initFunct();
-    }
-  }
-  
   delete [] localLibName;
 
 #endif
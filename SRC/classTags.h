@@ -55,12 +55,16 @@
 #define EigenSOE_TAGS_FullGenEigenSOE   4
 #define EigenSOE_TAGS_ArpackSOE 	5
 #define EigenSOE_TAGS_GeneralArpackSOE 	6
+#define EigenSOE_TAGS_DampedArpackSOE 	7
+#define EigenSOE_TAGS_BlockLanczosSOE 	8
 #define EigenSOLVER_TAGS_BandArpackSolver 	1
 #define EigenSOLVER_TAGS_SymArpackSolver 	2
 #define EigenSOLVER_TAGS_SymBandEigenSolver     3
 #define EigenSOLVER_TAGS_FullGenEigenSolver  4
 #define EigenSOLVER_TAGS_ArpackSolver  5
 #define EigenSOLVER_TAGS_GeneralArpackSolver  6
+#define EigenSOLVER_TAGS_DampedArpackSolver  7
+#define EigenSOLVER_TAGS_BlockLanczosSolver  8
 
 #define EigenALGORITHM_TAGS_Frequency 1
 #define EigenALGORITHM_TAGS_Standard  2
@@ -647,6 +651,8 @@
 #define ELE_TAG_PFEMElement2DFIC          164
 #define ELE_TAG_ElastomericBearingBoucWenMod3d 165
 #define ELE_TAG_FPBearingPTV              166
+#define ELE_TAG_SuperElement              167
+#define ELE_TAG_GroupTruss                168
 
 #define FRN_TAG_Coulomb            1
 #define FRN_TAG_VelDependent       2
@@ -759,6 +765,8 @@
 #define EquiALGORITHM_TAGS_AcceleratedNewtonLineSearch          12
 #define EquiALGORITHM_TAGS_InitialNewton          13
 #define EquiALGORITHM_TAGS_ElasticAlgorithm 14
+#define EquiALGORITHM_TAGS_AdaptiveNewton 15
+#define EquiALGORITHM_TAGS_InexactNewton 16
 
 #define ACCELERATOR_TAGS_Krylov		1
 #define ACCELERATOR_TAGS_Secant		2
@@ -767,6 +775,7 @@
 #define ACCELERATOR_TAGS_Raphson        5
 #define ACCELERATOR_TAGS_Periodic       6
 #define ACCELERATOR_TAGS_Difference     7
+#define ACCELERATOR_TAGS_Anderson       8
 
 #define LINESEARCH_TAGS_InitialInterpolatedLineSearch 1
 #define LINESEARCH_TAGS_BisectionLineSearch           2
@@ -828,6 +837,7 @@
 #define INTEGRATOR_TAGS_PFEMIntegrator                  52
 #define INTEGRATOR_TAGS_KRAlphaExplicit                 53
 #define INTEGRATOR_TAGS_KRAlphaExplicit_TP              54
+#define INTEGRATOR_TAGS_CentralDifferenceSubcycling     55
 
 #define LinSOE_TAGS_FullGenLinSOE		1
 #define LinSOE_TAGS_BandGenLinSOE		2
@@ -857,6 +867,9 @@
 #define LinSOE_TAGS_PFEMLinSOE 26
 #define LinSOE_TAGS_SProfileSPDLinSOE		27
 #define LinSOE_TAGS_PFEMCompressibleLinSOE 28
+#define LinSOE_TAGS_SparseBlockRowLinSOE 29
+#define LinSOE_TAGS_AutoLinSOE 30
+#define LinSOE_TAGS_PardisoSOE 31
 
 
 #define SOLVER_TAGS_FullGenLinLapackSolver  	1
@@ -890,6 +903,12 @@
 #define SOLVER_TAGS_CulaSparseS4                        29
 #define SOLVER_TAGS_CulaSparseS5                        30
 #define SOLVER_TAGS_CuSP                                31
+#define SOLVER_TAGS_ProfileSPDLinSupernodeSolver        32
+#define SOLVER_TAGS_SparseGenRowKrylovSolver            33
+#define SOLVER_TAGS_CuDSSSolver                         34
+#define SOLVER_TAGS_BandGenLinMixedSolver               35
+#define SOLVER_TAGS_SparseBlockRowKrylovSolver          36
+#define SOLVER_TAGS_PardisoSolver                       37
 
 #define RECORDER_TAGS_ElementRecorder		1
 #define RECORDER_TAGS_NodeRecorder		2
@@ -922,6 +941,11 @@
 #define OPS_STREAM_TAGS_ChannelStream           9
 #define OPS_STREAM_TAGS_DataTurbineStream      10
 #define OPS_STREAM_TAGS_DataFileStreamAdd      11
+#define OPS_STREAM_TAGS_ColumnarFileStream     12
+#define OPS_STREAM_TAGS_H5FileStream           13
+#define OPS_STREAM_TAGS_ReductionStream        14
+#define OPS_STREAM_TAGS_AsyncStream            15
+#define OPS_STREAM_TAGS_ServerStream           16
 
 
 #define DomDecompALGORITHM_TAGS_DomainDecompAlgo 1
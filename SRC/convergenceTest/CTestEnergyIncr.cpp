@@ -145,7 +145,8 @@ int CTestEnergyIncr::test(void)
     // determine the energy & save value in norms vector
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();    
-    double product = x ^ b;
+    theSOE->formNorms(nType);
+    double product = theSOE->getBdotX();
     if (product < 0.0)
         product *= -0.5;
     else
@@ -162,7 +163,7 @@ int CTestEnergyIncr::test(void)
     if (printFlag == 4) {
         opserr << "CTestEnergyIncr::test() - iteration: " << currentIter;
         opserr << " current EnergyIncr: " << product << " (max: " << tol << ")\n";
-        opserr << "\tNorm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << endln;
+        opserr << "\tNorm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << endln;
         opserr << "\tdeltaX: " << x << "\tdeltaR: " << b;
     }
     
@@ -191,7 +192,7 @@ int CTestEnergyIncr::test(void)
     else if ((printFlag == 5 || printFlag == 6) && currentIter >= maxNumIter) {
         opserr << "WARNING: CTestEnergyIncr::test() - failed to converge but goin on -";
         opserr << " current EnergyIncr: " << product << " (max: " << tol << ")\n";
-        opserr << "\tNorm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << endln;
+        opserr << "\tNorm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << endln;
         return currentIter;
     }
     
@@ -200,7 +201,7 @@ int CTestEnergyIncr::test(void)
         opserr << "WARNING: CTestEnergyIncr::test() - failed to converge \n";
         opserr << "after: " << currentIter << " iterations\n";	
         opserr << " current EnergyIncr: " << product << " (max: " << tol << ") ";
-        opserr << "\tNorm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << endln;
+        opserr << "\tNorm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << endln;
         currentIter++;    
         return -2;
     } 
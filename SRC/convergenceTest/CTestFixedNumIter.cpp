@@ -116,7 +116,8 @@ int CTestFixedNumIter::test(void)
     // determine the energy & save value in norms vector
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();    
-    double product = x ^ b;
+    theSOE->formNorms(nType);
+    double product = theSOE->getBdotX();
     if (product < 0.0)
         product *= -0.5;
     else
@@ -129,12 +130,12 @@ int CTestFixedNumIter::test(void)
     if (printFlag == 1)  {
         opserr << "CTestFixedNumIter::test() - iteration: " << currentIter;
         opserr << " current EnergyIncr: " << product;
-        opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+        opserr << " (Norm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << ")\n";
     } 
     if (printFlag == 4)  {
         opserr << "CTestFixedNumIter::test() - iteration: " << currentIter;
         opserr << " current EnergyIncr: " << product;
-        opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+        opserr << " (Norm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << ")\n";
         opserr << "\tdeltaX: " << x << "\tdeltaR: " << b;
     } 
     
@@ -152,7 +153,7 @@ int CTestFixedNumIter::test(void)
             else if (printFlag == 2 || printFlag == 6)  {
                 opserr << "CTestFixedNumIter::test() - iteration: " << currentIter;
                 opserr << " last EnergyIncr: " << product;
-                opserr << " (Norm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << ")\n";
+                opserr << " (Norm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << ")\n";
             }
         }
         
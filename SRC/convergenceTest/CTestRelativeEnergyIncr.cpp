@@ -131,7 +131,8 @@ int CTestRelativeEnergyIncr::test(void)
     // determine the energy & save value in norms vector
     const Vector &b = theSOE->getB();
     const Vector &x = theSOE->getX();    
-    double product = x ^ b;
+    theSOE->formNorms(nType);
+    double product = theSOE->getBdotX();
     if (product < 0.0)
         product *= -0.5;
     else
@@ -157,7 +158,7 @@ int CTestRelativeEnergyIncr::test(void)
     if (printFlag == 4) {
         opserr << "CTestRelativeEnergyIncr::test() - iteration: " << currentIter;
         opserr << " current Ratio (dX*dR/dX1*dR1): " << product << " (max: " << tol << ")\n";
-        opserr << "\tNorm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << endln;
+        opserr << "\tNorm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << endln;
         opserr << "\tdeltaX: " << x << "\tdeltaR: " << b;
     }
     
@@ -186,7 +187,7 @@ int CTestRelativeEnergyIncr::test(void)
     else if ((printFlag == 5 || printFlag == 6) && currentIter >= maxNumIter) {
         opserr << "WARNING: CTestRelativeEnergyIncr::test() - failed to converge but goin on -";
         opserr << " current Ratio (dX*dR/dX1*dR1): " << product << " (max: " << tol << ")\n";
-        opserr << "\tNorm deltaX: " << x.pNorm(nType) << ", Norm deltaR: " << b.pNorm(nType) << endln;
+        opserr << "\tNorm deltaX: " << theSOE->getNormX() << ", Norm deltaR: " << theSOE->getNormB() << endln;
         return currentIter;
     }
     
@@ -127,10 +127,11 @@ int NormDispOrUnbalance::test(void)
     }
     
     // get the X vector & determine it's norm & save the value in norms vector
+    // the norms of X and B in one pass over the two vectors
     const Vector &x = theSOE->getX();
-    double normX = x.pNorm(nType);
-    const Vector &b = theSOE->getB();
-    double normB = b.pNorm(nType);
+    theSOE->formNorms(nType);
+    double normX = theSOE->getNormX();
+    double normB = theSOE->getNormB();
 
     if((currentIter>1 && norms(currentIter-2)<normX) && (currentIter>1 && norms(maxNumIter+currentIter-2)<normB)) {
         numIncr++;
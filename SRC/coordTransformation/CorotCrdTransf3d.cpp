@@ -43,17 +43,9 @@
 #include <CorotCrdTransf3d.h>
 
 // initialize static variables
-Matrix CorotCrdTransf3d::RI(3,3); 
-Matrix CorotCrdTransf3d::RJ(3,3); 
-Matrix CorotCrdTransf3d::Rbar(3,3); 
-Matrix CorotCrdTransf3d::e(3,3); 
 Matrix CorotCrdTransf3d::Tp(6,7); 
-Matrix CorotCrdTransf3d::T(7,12);
 Matrix CorotCrdTransf3d::Tlg(12,12);
 Matrix CorotCrdTransf3d::kg(12,12);
-Matrix CorotCrdTransf3d::Lr2(12,3);
-Matrix CorotCrdTransf3d::Lr3(12,3);
-Matrix CorotCrdTransf3d::A(3,3);
 
 void* OPS_CorotCrdTransf3d()
 {
@@ -98,7 +90,8 @@ nodeIPtr(0), nodeJPtr(0), R0(3,3), L(0), Ln(0),
 alphaIq(4), alphaJq(4), 
 alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
 ulcommit(7), ul(7),  ulpr(7),
-nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false)
+RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Lr2(12,3), Lr3(12,3), A(3,3),
+nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false), updated(false)
 {
     // check vector that defines local xz plane
     if (&vecInLocXZPlane == 0 || vecInLocXZPlane.Size() != 3 )
@@ -180,7 +173,8 @@ nodeIPtr(0), nodeJPtr(0), R0(3,3), L(0), Ln(0),
 alphaIq(4), alphaJq(4), 
 alphaIqcommit(4), alphaJqcommit(4), alphaI(3), alphaJ(3),
 ulcommit(7), ul(7),  ulpr(7),
-nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false)
+RI(3,3), RJ(3,3), Rbar(3,3), e(3,3), T(7,12), Lr2(12,3), Lr3(12,3), A(3,3),
+nodeIInitialDisp(0), nodeJInitialDisp(0), initialDispChecked(false), updated(false)
 {
     // Permutation matrix (to renumber basic dof's)
     
@@ -257,6 +251,7 @@ CorotCrdTransf3d::revertToLastCommit(void)
     alphaIq = alphaIqcommit;
     alphaJq = alphaJqcommit;
     
+    updated = false;
     this->update();
     
     return 0;
@@ -273,6 +268,7 @@ CorotCrdTransf3d::revertToStart(void)
     alphaI.Zero();
     alphaJ.Zero();
     
+    updated = false;
     this->update();
     return 0;
 }
@@ -337,6 +333,7 @@ CorotCrdTransf3d::initialize(Node *nodeIPointer, Node *nodeJPointer)
     //opserr << "alphaIq: " << alphaIq;
     //opserr << "alphaJq: " << alphaJq;
     
+    updated = false;
     this->commitState();
 
     return 0;
@@ -367,11 +364,28 @@ CorotCrdTransf3d::update(void)
         }   
     **************************************************************/
     
+    // the element and the transformation both invoke update() each
+    // iteration; while the nodal trial displacements are those of the
+    // last update the rotations and the transformation matrix are kept
+    const Vector &trialI = nodeIPtr->getTrialDisp();
+    const Vector &trialJ = nodeJPtr->getTrialDisp();
+    
+    if (updated == true) {
+        for (k = 0; k < 6; k++)
+            if (trialI(k) != trialDispI[k] || trialJ(k) != trialDispJ[k])
+                updated = false;
+        
+        if (updated == true) {
+            ulpr = ul;
+            return 0;
+        }
+    }
+    
     // determine global displacement increments from last iteration
     static Vector dispI(6);
     static Vector dispJ(6);
-    dispI = nodeIPtr->getTrialDisp();
-    dispJ = nodeJPtr->getTrialDisp();
+    dispI = trialI;
+    dispJ = trialJ;
     
     if (nodeIInitialDisp != 0) {
         for (int j=0; j<6; j++)
@@ -546,6 +560,12 @@ CorotCrdTransf3d::update(void)
             // compute the transformation matrix
             this->compTransfMatrixBasicGlobal();
             
+            for (k = 0; k < 6; k++) {
+                trialDispI[k] = trialI(k);
+                trialDispJ[k] = trialJ(k);
+            }
+            updated = true;
+            
             return 0;
 }
 
@@ -1362,20 +1382,20 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
             rm = rI3;
             rm.addVector (1.0, rJ3, -1.0); 
             //opserr << "ks2(r2,rI3-rJ3):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rm), m(3));
+            this->addKs2Matrix(kg, r2, rm, m(3));
             
             rm = rJ2;
             rm.addVector (1.0, rI2, -1.0); 
             //opserr << "ks2(r3,rJ2-rI2):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rm), m(3));
+            this->addKs2Matrix(kg, r3, rm, m(3));
             //opserr << "ks2(r2,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rI1), m(1));
+            this->addKs2Matrix(kg, r2, rI1, m(1));
             //opserr << "ks2(r3,rI1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rI1), m(2));
+            this->addKs2Matrix(kg, r3, rI1, m(2));
             //opserr << "ks2(r2,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r2, rJ1), m(4));
+            this->addKs2Matrix(kg, r2, rJ1, m(4));
             //opserr << "ks2(r3,rJ1):\n "; 
-            kg.addMatrix (1.0, this->getKs2Matrix(r3, rJ1), m(5));
+            this->addKs2Matrix(kg, r3, rJ1, m(5));
             
             //opserr << "kg += ksigma2: " << kg;
             
@@ -1384,9 +1404,13 @@ CorotCrdTransf3d::getGlobalStiffMatrix(const Matrix &kb, const Vector &pb)
             for (k = 0; k < 6; k++)
             {
                 factor = pl(k) * tan(ul(k));
-                for (i = 0; i < 12; i++)
+                if (factor == 0.0)
+                    continue;
+                for (i = 0; i < 12; i++) {
+                    double Tki = T(k,i) * factor;
                     for (j = 0; j < 12; j++)
-                        kg(i,j) += T(k,i) * factor * T(k,j);
+                        kg(i,j) += Tki * T(k,j);
+                }
             }
             
 	    //            opserr << "COROATIONAL 3d: kg final: " << kg;
@@ -1772,13 +1796,14 @@ CorotCrdTransf3d::getLMatrix(const Vector &ri) const
 }
 
 
-const Matrix &
-CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
+// adds fact*Ksigma2 to the 12x12 matrix k, assembling the 3x3 blocks
+// directly into it
+void
+CorotCrdTransf3d::addKs2Matrix(Matrix &k, const Vector &ri, const Vector &z, double fact) const
 {
-    static Matrix ks2(12,12);
     static Vector e1(3), r1(3);
     
-    //opserr << "\ngetKs2Matrix:\n";
+    //opserr << "\naddKs2Matrix:\n";
     //opserr << "ri: " << ri;
     
     //opserr << "z: " << z;
@@ -1855,12 +1880,10 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             
             //opserr << "Ks211: " << ks;
             
-            ks2.Zero();
-            
-            ks2.Assemble(ks, 0, 0,  1.0);
-            ks2.Assemble(ks, 0, 6, -1.0);
-            ks2.Assemble(ks, 6, 0, -1.0);
-            ks2.Assemble(ks, 6, 6,  1.0);
+            k.Assemble(ks, 0, 0,  fact);
+            k.Assemble(ks, 0, 6, -fact);
+            k.Assemble(ks, 6, 0, -fact);
+            k.Assemble(ks, 6, 6,  fact);
             
             static Matrix Sri(3,3), Sr1(3,3), Sz(3,3), Se1(3,3);
             
@@ -1883,15 +1906,15 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             
             //opserr << "Ks2_12: " << ks;
             
-            ks2.Assemble(ks, 0, 3,  1.0);
-            ks2.Assemble(ks, 0, 9,  1.0);
-            ks2.Assemble(ks, 6, 3, -1.0);
-            ks2.Assemble(ks, 6, 9, -1.0);
+            k.Assemble(ks, 0, 3,  fact);
+            k.Assemble(ks, 0, 9,  fact);
+            k.Assemble(ks, 6, 3, -fact);
+            k.Assemble(ks, 6, 9, -fact);
             
-            ks2.AssembleTranspose(ks, 3, 0,  1.0);
-            ks2.AssembleTranspose(ks, 3, 6, -1.0);
-            ks2.AssembleTranspose(ks, 9, 0,  1.0);
-            ks2.AssembleTranspose(ks, 9, 6, -1.0);
+            k.AssembleTranspose(ks, 3, 0,  fact);
+            k.AssembleTranspose(ks, 3, 6, -fact);
+            k.AssembleTranspose(ks, 9, 0,  fact);
+            k.AssembleTranspose(ks, 9, 6, -fact);
             
             //K22 = (1/8)*((-ri'*e1)*Sz*Sr1 + Sr1*z*e1'*Sri + ...
             //      Sri*e1*z'*Sr1 - (e1+r1)'*z*S(e1)*Sri + 2*Sz*Sri);
@@ -1914,12 +1937,10 @@ CorotCrdTransf3d::getKs2Matrix(const Vector &ri, const Vector &z) const
             //             -K11  -K12  K11  -K12;
             //              K12t  K22 -K12t  K22];
             
-            ks2.Assemble(ks, 3, 3, 1.0);
-            ks2.Assemble(ks, 3, 9, 1.0);
-            ks2.Assemble(ks, 9, 3, 1.0);
-            ks2.Assemble(ks, 9, 9, 1.0);
-            
-            return ks2;
+            k.Assemble(ks, 3, 3, fact);
+            k.Assemble(ks, 3, 9, fact);
+            k.Assemble(ks, 9, 3, fact);
+            k.Assemble(ks, 9, 9, fact);
 }
 
 
@@ -2073,6 +2094,7 @@ CorotCrdTransf3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theB
   alphaJq = alphaJqcommit;
   
   initialDispChecked = true;
+  updated = false;
   return 0;  
 }
 
@@ -98,7 +98,7 @@ private:
     const Matrix &getRotMatrixFromTangScaledPseudoVector(const Vector &w) const;
     const Matrix &getSkewSymMatrix(const Vector &theta) const;
     const Matrix &getLMatrix(const Vector &ri) const;
-    const Matrix &getKs2Matrix(const Vector &ri, const Vector &z) const;
+    void addKs2Matrix(Matrix &k, const Vector &ri, const Vector &z, double fact) const;
     
     // internal data
     Node *nodeIPtr, *nodeJPtr;  // pointers to the element two endnodes
@@ -124,17 +124,22 @@ private:
     Vector ulcommit;            // commited local displacements
     Vector ulpr;                // previous local displacements
     
-    static Matrix RI;           // nodal triad for node 1
-    static Matrix RJ;           // nodal triad for node 2
-    static Matrix Rbar;         // mean nodal triad 
-    static Matrix e;            // base vectors
+    Matrix RI;                  // nodal triad for node 1
+    Matrix RJ;                  // nodal triad for node 2
+    Matrix Rbar;                // mean nodal triad 
+    Matrix e;                   // base vectors
+    Matrix T;                   // transformation matrix from basic to global system
+    Matrix Lr2, Lr3, A;         // auxiliary matrices
+    
     static Matrix Tp;           // transformation matrix to renumber dofs
-    static Matrix T;            // transformation matrix from basic to global system
     static Matrix Tlg;          // transformation matrix from global to local system
     static Matrix kg;           // global stiffness matrix
-    static Matrix Lr2, Lr3, A;  // auxiliary matrices
     
     double *nodeIInitialDisp, *nodeJInitialDisp;
     bool initialDispChecked;
+    
+    double trialDispI[6];       // nodal trial displacements at the last update
+    double trialDispJ[6];
+    bool updated;               // true while the matrices above are those of trialDispI, trialDispJ
 };
 #endif
@@ -37,15 +37,23 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theCrdTransfObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theCrdTransfObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theCrdTransfObjects(void)
+{
+  if (theCrdTransfObjectsPtr == 0)
+    theCrdTransfObjectsPtr = new MapOfTaggedObjects();
+  return *theCrdTransfObjectsPtr;
+}
 
 bool OPS_addCrdTransf(CrdTransf *newComponent) {
-  return theCrdTransfObjects.addComponent(newComponent);
+  return theCrdTransfObjects().addComponent(newComponent);
 }
 
 CrdTransf *OPS_getCrdTransf(int tag) {
 
-  TaggedObject *theResult = theCrdTransfObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theCrdTransfObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "CrdTransf *getCrdTransf(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -56,7 +64,7 @@ CrdTransf *OPS_getCrdTransf(int tag) {
 }
 
 void OPS_clearAllCrdTransf(void) {
-  theCrdTransfObjects.clearAll();
+  theCrdTransfObjects().clearAll();
 }
 
 
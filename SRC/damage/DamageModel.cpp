@@ -36,15 +36,23 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theDamageModelObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theDamageModelObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theDamageModelObjects(void)
+{
+  if (theDamageModelObjectsPtr == 0)
+    theDamageModelObjectsPtr = new MapOfTaggedObjects();
+  return *theDamageModelObjectsPtr;
+}
 
 bool OPS_addDamageModel(DamageModel *newComponent) {
-  return theDamageModelObjects.addComponent(newComponent);
+  return theDamageModelObjects().addComponent(newComponent);
 }
 
 DamageModel *OPS_getDamageModel(int tag) {
 
-  TaggedObject *theResult = theDamageModelObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theDamageModelObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "DamageModel *getDamageModel(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -55,7 +63,7 @@ DamageModel *OPS_getDamageModel(int tag) {
 }
 
 void OPS_clearAllDamageModel(void) {
-  theDamageModelObjects.clearAll();
+  theDamageModelObjects().clearAll();
 }
 
 DamageModel::DamageModel(int tag, int clasTag)
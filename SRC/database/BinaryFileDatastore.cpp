@@ -0,0 +1,612 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/database/BinaryFileDatastore.cpp,v $
+                                                                        
+// Created: 10/26
+//
+// Description: This file contains the class implementation for
+// BinaryFileDatastore.
+//
+// What: "@(#) BinaryFileDatastore.C, revA"
+
+#include "BinaryFileDatastore.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#define BINARY_FSEEK _fseeki64
+#define BINARY_FTELL _ftelli64
+#else
+#include <sys/mman.h>
+#define BINARY_FSEEK fseeko
+#define BINARY_FTELL ftello
+#endif
+
+#include <FEM_ObjectBroker.h>
+#include <Domain.h>
+#include <Message.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+#define BINARY_PAGE_SIZE 4096
+#define BINARY_TYPE_ID 0
+#define BINARY_TYPE_VECTOR 1
+#define BINARY_TYPE_MATRIX 2
+#define BINARY_TYPE_MSG 3
+
+static const char binaryMagic[8] = {'O','P','S','B','I','N','0','1'};
+
+#ifndef _WIN32
+extern "C" void *
+binaryFileWriter(void *theStore)
+{
+  ((BinaryFileDatastore *)theStore)->drainBlocks();
+  return 0;
+}
+#endif
+
+static long long
+roundUp(long long loc, long long boundary)
+{
+  return ((loc + boundary - 1)/boundary)*boundary;
+}
+
+bool
+binaryFileDatastoreKey::operator<(const struct binaryFileDatastoreKey &other) const
+{
+  if (type != other.type) return type < other.type;
+  if (dbTag != other.dbTag) return dbTag < other.dbTag;
+  if (commitTag != other.commitTag) return commitTag < other.commitTag;
+  return size < other.size;
+}
+
+
+BinaryFileDatastore::BinaryFileDatastore(const char *name,
+					 Domain &theDomain, 
+					 FEM_ObjectBroker &theObjBroker) 
+  :FE_Datastore(theDomain, theObjBroker), 
+   fileName(0), theFile(0), fileEnd(BINARY_PAGE_SIZE), lastIndex(0),
+   buffer(0), bufferSize(0), bufferLength(0),
+   mappedData(0), mappedLength(0),
+   blocks(0), numBlocks(0), fillBlock(0), drainBlock(0), numFull(0),
+   finished(false), threaded(false), writeError(0)
+{
+  fileName = new char [strlen(name)+1];
+  strcpy(fileName, name);
+
+  // open an existing checkpoint file and read in its indexes, newest
+  // first so that data sent again in a later commit replaces the older
+  theFile = fopen(fileName, "r+b");
+  if (theFile != 0) {
+    char magic[8];
+    if (fread(magic, 1, 8, theFile) != 8 || memcmp(magic, binaryMagic, 8) != 0 ||
+	fread(&lastIndex, sizeof(long long), 1, theFile) != 1) {
+      opserr << "BinaryFileDatastore::BinaryFileDatastore() - " << fileName;
+      opserr << " is not a checkpoint file, it will be overwritten\n";
+      fclose(theFile);
+      theFile = 0;
+      lastIndex = 0;
+    } else {
+      long long indexOffset = lastIndex;
+      while (indexOffset != 0) {
+	long long indexData[2];
+	BINARY_FSEEK(theFile, indexOffset, SEEK_SET);
+	if (fread(indexData, sizeof(long long), 2, theFile) != 2) {
+	  opserr << "BinaryFileDatastore::BinaryFileDatastore() - index of " << fileName;
+	  opserr << " is truncated\n";
+	  break;
+	}
+	BinaryFileDatastoreEntry theEntry;
+	for (long long i=0; i<indexData[1]; i++) {
+	  if (fread(&theEntry, sizeof(BinaryFileDatastoreEntry), 1, theFile) != 1) 
+	    break;
+	  BinaryFileDatastoreKey theKey = {theEntry.type, theEntry.dbTag, 
+					   theEntry.commitTag, theEntry.size};
+	  theIndex.insert(MAP_BINARY_INDEX::value_type(theKey, theEntry.offset));
+	}
+	indexOffset = indexData[0];
+      }
+      BINARY_FSEEK(theFile, 0, SEEK_END);
+      fileEnd = roundUp(BINARY_FTELL(theFile), BINARY_PAGE_SIZE);
+    }
+  }
+
+  // or start a new one, the first page is the header
+  if (theFile == 0) {
+    theFile = fopen(fileName, "w+b");
+    if (theFile == 0) {
+      opserr << "BinaryFileDatastore::BinaryFileDatastore() - could not open file: ";
+      opserr << fileName << endln;
+    } else {
+      char header[BINARY_PAGE_SIZE];
+      memset(header, 0, BINARY_PAGE_SIZE);
+      memcpy(header, binaryMagic, 8);
+      fwrite(header, 1, BINARY_PAGE_SIZE, theFile);
+      fflush(theFile);
+      fileEnd = BINARY_PAGE_SIZE;
+    }
+  }
+}
+
+
+BinaryFileDatastore::~BinaryFileDatastore() 
+{
+  this->flush();
+  this->stopWriter();
+  this->unmapFile();
+
+  if (theFile != 0)
+    fclose(theFile);
+  if (buffer != 0)
+    free(buffer);
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+
+int 
+BinaryFileDatastore::commitState(int commitTag)
+{
+  // the domain sends everything into the buffer, which is then written
+  int result = this->FE_Datastore::commitState(commitTag);
+  if (this->flush() < 0 || writeError != 0) {
+    writeError = 0;
+    opserr << "BinaryFileDatastore::commitState() - failed to write to " << fileName << endln;
+    return -1;
+  }
+    
+  return result;
+}
+
+
+int 
+BinaryFileDatastore::restoreState(int commitTag)
+{
+  if (this->flush() < 0)
+    return -1;
+
+  return this->FE_Datastore::restoreState(commitTag);
+}
+
+
+int
+BinaryFileDatastore::addData(int type, int dbTag, int commitTag, int size, 
+			     const void *theData, int numBytes)
+{
+  // each piece of data starts on an 8 byte boundary
+  long long stepSize = roundUp(numBytes, 8);
+  if (bufferLength + stepSize > bufferSize || buffer == 0) {
+    long long newSize = 2*bufferSize;
+    if (newSize < bufferLength + stepSize)
+      newSize = bufferLength + stepSize;
+    if (newSize < 1024*1024)
+      newSize = 1024*1024;
+    char *newBuffer = (char *)realloc(buffer, newSize);
+    if (newBuffer == 0) {
+      opserr << "BinaryFileDatastore::addData() - out of memory\n";
+      return -1;
+    }
+    buffer = newBuffer;
+    bufferSize = newSize;
+  }
+
+  if (numBytes > 0)
+    memcpy(&buffer[bufferLength], theData, numBytes);
+
+  BinaryFileDatastoreKey theKey = {type, dbTag, commitTag, size};
+  BinaryFileDatastoreEntry theEntry = {type, dbTag, commitTag, size, 
+				       fileEnd + bufferLength};
+  theIndex[theKey] = theEntry.offset;
+  newEntries.push_back(theEntry);
+  bufferLength += stepSize;
+
+  return 0;
+}
+
+
+int
+BinaryFileDatastore::getData(int type, int dbTag, int commitTag, int size, 
+			     void *theData, int numBytes)
+{
+  // data may still be queued for the writer
+  if (threaded == true)
+    this->waitForWriter();
+
+  BinaryFileDatastoreKey theKey = {type, dbTag, commitTag, size};
+  MAP_BINARY_INDEX::iterator theEntry = theIndex.find(theKey);
+  if (theEntry == theIndex.end())
+    return -1;
+
+  long long offset = theEntry->second;
+  if (numBytes == 0)
+    return 0;
+
+  // data sent since the last commit is still in the buffer
+  if (offset >= fileEnd) {
+    memcpy(theData, &buffer[offset-fileEnd], numBytes);
+    return 0;
+  }
+
+  if (mappedData == 0 || offset + numBytes > mappedLength)
+    if (this->mapFile() < 0)
+      return -2;
+
+  memcpy(theData, &mappedData[offset], numBytes);
+  return 0;
+}
+
+
+int
+BinaryFileDatastore::flush(void)
+{
+  if (theFile == 0)
+    return -1;
+
+  if (newEntries.empty())
+    return 0;
+
+  if (threaded == false) {
+    BinaryFileDatastoreBlock theBlock;
+    this->prepareBlock(theBlock);
+    return this->writeBlock(theBlock);
+  }
+
+#ifndef _WIN32
+  // the block takes the buffer, the next commit gets a new one; then
+  // pass the block to the writer & wait until the next one is free
+  BinaryFileDatastoreBlock &theBlock = blocks[fillBlock];
+  this->prepareBlock(theBlock);
+  buffer = (char *)malloc(bufferSize);
+  if (buffer == 0)
+    bufferSize = 0;
+
+  pthread_mutex_lock(&lock);
+  numFull++;
+  fillBlock = (fillBlock+1)%numBlocks;
+  pthread_cond_signal(&blockFull);
+  while (numFull == numBlocks)
+    pthread_cond_wait(&blockFree, &lock);
+  pthread_mutex_unlock(&lock);
+#endif
+
+  return 0;
+}
+
+
+void
+BinaryFileDatastore::prepareBlock(BinaryFileDatastoreBlock &theBlock)
+{
+  // only the last of data sent more than once in the commit is indexed
+  int numLive = 0;
+  for (size_t i=0; i<newEntries.size(); i++) {
+    BinaryFileDatastoreEntry &theEntry = newEntries[i];
+    BinaryFileDatastoreKey theKey = {theEntry.type, theEntry.dbTag, 
+				     theEntry.commitTag, theEntry.size};
+    if (theIndex[theKey] == theEntry.offset)
+      newEntries[numLive++] = theEntry;
+  }
+  newEntries.resize(numLive);
+
+  // the data of the commit goes at the end of the file, its index after it
+  theBlock.data = buffer;
+  theBlock.length = bufferLength;
+  theBlock.offset = fileEnd;
+  theBlock.prevIndex = lastIndex;
+  theBlock.entries.swap(newEntries);
+  newEntries.clear();
+
+  lastIndex = fileEnd + bufferLength;
+  fileEnd = roundUp(lastIndex + 2*sizeof(long long) + 
+		    numLive*sizeof(BinaryFileDatastoreEntry), BINARY_PAGE_SIZE);
+  bufferLength = 0;
+}
+
+
+int
+BinaryFileDatastore::writeBlock(BinaryFileDatastoreBlock &theBlock)
+{
+  // the data of the commit goes in one write, then its index after it; the
+  // header is rewritten last so that an interrupted write leaves the file
+  // at the previous commit
+  if (BINARY_FSEEK(theFile, theBlock.offset, SEEK_SET) != 0 ||
+      fwrite(theBlock.data, 1, theBlock.length, theFile) != (size_t)theBlock.length)
+    return -1;
+
+  long long indexOffset = theBlock.offset + theBlock.length;
+  long long numEntries = theBlock.entries.size();
+  long long indexData[2] = {theBlock.prevIndex, numEntries};
+  if (fwrite(indexData, sizeof(long long), 2, theFile) != 2 ||
+      fwrite(&(theBlock.entries[0]), sizeof(BinaryFileDatastoreEntry), numEntries, theFile) != (size_t)numEntries)
+    return -1;
+  fflush(theFile);
+
+  BINARY_FSEEK(theFile, 8, SEEK_SET);
+  fwrite(&indexOffset, sizeof(long long), 1, theFile);
+  fflush(theFile);
+
+  return 0;
+}
+
+
+int
+BinaryFileDatastore::setAsync(int queueDepth)
+{
+  this->flush();
+  this->stopWriter();
+  if (queueDepth < 1)
+    return 0;
+
+  blocks = new BinaryFileDatastoreBlock[queueDepth];
+  numBlocks = queueDepth;
+  fillBlock = 0;
+  drainBlock = 0;
+  numFull = 0;
+  finished = false;
+
+#ifndef _WIN32
+  pthread_mutex_init(&lock, 0);
+  pthread_cond_init(&blockFull, 0);
+  pthread_cond_init(&blockFree, 0);
+  if (pthread_create(&writer, 0, binaryFileWriter, (void *)this) == 0)
+    threaded = true;
+  else {
+    opserr << "WARNING - BinaryFileDatastore - could not start a writer thread,";
+    opserr << " writing " << fileName << " synchronously\n";
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&blockFull);
+    pthread_cond_destroy(&blockFree);
+  }
+#endif
+
+  if (threaded == false) {
+    delete [] blocks;
+    blocks = 0;
+    numBlocks = 0;
+    return -1;
+  }
+
+  return 0;
+}
+
+
+void
+BinaryFileDatastore::drainBlocks(void)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+  while (true) {
+    while (numFull == 0 && finished == false)
+      pthread_cond_wait(&blockFull, &lock);
+    if (numFull == 0)
+      break;
+
+    BinaryFileDatastoreBlock &theBlock = blocks[drainBlock];
+    pthread_mutex_unlock(&lock);
+
+    int result = this->writeBlock(theBlock);
+    free(theBlock.data);
+    theBlock.data = 0;
+    theBlock.entries.clear();
+
+    pthread_mutex_lock(&lock);
+    if (result < 0)
+      writeError = result;
+    drainBlock = (drainBlock+1)%numBlocks;
+    numFull--;
+    pthread_cond_signal(&blockFree);
+  }
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+
+void
+BinaryFileDatastore::waitForWriter(void)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+  while (numFull != 0)
+    pthread_cond_wait(&blockFree, &lock);
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+
+void
+BinaryFileDatastore::stopWriter(void)
+{
+#ifndef _WIN32
+  if (threaded == true) {
+    pthread_mutex_lock(&lock);
+    finished = true;
+    pthread_cond_signal(&blockFull);
+    pthread_mutex_unlock(&lock);
+
+    pthread_join(writer, 0);
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&blockFull);
+    pthread_cond_destroy(&blockFree);
+    threaded = false;
+  }
+#endif
+
+  if (blocks != 0)
+    delete [] blocks;
+  blocks = 0;
+  numBlocks = 0;
+}
+
+
+int
+BinaryFileDatastore::mapFile(void)
+{
+  this->unmapFile();
+  if (theFile == 0)
+    return -1;
+
+  fflush(theFile);
+  BINARY_FSEEK(theFile, 0, SEEK_END);
+  long long length = BINARY_FTELL(theFile);
+
+#ifdef _WIN32
+  mappedData = (char *)malloc(length);
+  if (mappedData == 0) {
+    opserr << "BinaryFileDatastore::mapFile() - out of memory\n";
+    return -1;
+  }
+  BINARY_FSEEK(theFile, 0, SEEK_SET);
+  if (fread(mappedData, 1, length, theFile) != (size_t)length) {
+    free(mappedData);
+    mappedData = 0;
+    return -1;
+  }
+#else
+  void *theMap = mmap(0, length, PROT_READ, MAP_SHARED, fileno(theFile), 0);
+  if (theMap == MAP_FAILED) {
+    opserr << "BinaryFileDatastore::mapFile() - could not map " << fileName << endln;
+    return -1;
+  }
+  mappedData = (char *)theMap;
+#endif
+
+  mappedLength = length;
+  return 0;
+}
+
+
+void
+BinaryFileDatastore::unmapFile(void)
+{
+  if (mappedData == 0)
+    return;
+
+#ifdef _WIN32
+  free(mappedData);
+#else
+  munmap(mappedData, mappedLength);
+#endif
+
+  mappedData = 0;
+  mappedLength = 0;
+}
+
+
+int 
+BinaryFileDatastore::sendMsg(int dataTag, int commitTag, 
+			     const Message &theMessage, 
+			     ChannelAddress *theAddress)
+{
+  Message &theMsg = (Message &)theMessage;
+  int size = theMsg.getSize();
+  return this->addData(BINARY_TYPE_MSG, dataTag, commitTag, size, theMsg.getData(), size);
+}		       
+
+int 
+BinaryFileDatastore::recvMsg(int dataTag, int commitTag, 
+			     Message &theMessage, 
+			     ChannelAddress *theAddress)
+{
+  int size = theMessage.getSize();
+  return this->getData(BINARY_TYPE_MSG, dataTag, commitTag, size, 
+		       (void *)theMessage.getData(), size);
+}		       
+
+int 
+BinaryFileDatastore::recvMsgUnknownSize(int dataTag, int commitTag, 
+					Message &, 
+					ChannelAddress *theAddress)
+{
+  opserr << "BinaryFileDatastore::recvMsgUnknownSize() - not yet implemented\n";
+  return -1;
+}		       
+
+
+int 
+BinaryFileDatastore::sendMatrix(int dataTag, int commitTag, 
+				const Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.noRows() * theMatrix.noCols();
+  const void *theData = (size > 0) ? &((Matrix &)theMatrix)(0,0) : 0;
+  return this->addData(BINARY_TYPE_MATRIX, dataTag, commitTag, size, 
+		       theData, size*sizeof(double));
+}		       
+
+int 
+BinaryFileDatastore::recvMatrix(int dataTag, int commitTag, 
+				Matrix &theMatrix, 
+				ChannelAddress *theAddress)
+{
+  int size = theMatrix.noRows() * theMatrix.noCols();
+  void *theData = (size > 0) ? &theMatrix(0,0) : 0;
+  return this->getData(BINARY_TYPE_MATRIX, dataTag, commitTag, size, 
+		       theData, size*sizeof(double));
+}		       
+
+
+int 
+BinaryFileDatastore::sendVector(int dataTag, int commitTag, 
+				const Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  const void *theData = (size > 0) ? &((Vector &)theVector)(0) : 0;
+  return this->addData(BINARY_TYPE_VECTOR, dataTag, commitTag, size, 
+		       theData, size*sizeof(double));
+}		       
+
+int 
+BinaryFileDatastore::recvVector(int dataTag, int commitTag, 
+				Vector &theVector, 
+				ChannelAddress *theAddress)
+{
+  int size = theVector.Size();
+  void *theData = (size > 0) ? &theVector(0) : 0;
+  return this->getData(BINARY_TYPE_VECTOR, dataTag, commitTag, size, 
+		       theData, size*sizeof(double));
+}		       
+
+
+int 
+BinaryFileDatastore::sendID(int dataTag, int commitTag, 
+			    const ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  const void *theData = (size > 0) ? &((ID &)theID)(0) : 0;
+  return this->addData(BINARY_TYPE_ID, dataTag, commitTag, size, 
+		       theData, size*sizeof(int));
+}		       
+
+int 
+BinaryFileDatastore::recvID(int dataTag, int commitTag, 
+			    ID &theID, 
+			    ChannelAddress *theAddress)
+{
+  int size = theID.Size();
+  void *theData = (size > 0) ? &theID(0) : 0;
+  return this->getData(BINARY_TYPE_ID, dataTag, commitTag, size, 
+		       theData, size*sizeof(int));
+}
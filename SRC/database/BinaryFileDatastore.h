@@ -0,0 +1,179 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/database/BinaryFileDatastore.h,v $
+                                                                        
+#ifndef BinaryFileDatastore_h
+#define BinaryFileDatastore_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// BinaryFileDatastore. BinaryFileDatastore is a concrete subclass of
+// FE_Datastore for fast checkpoint and restart: all the data of all the
+// commits is kept in one binary file. The data sent during a commit is
+// gathered in memory and written with one write, starting on a page
+// boundary, followed by an index giving the offset of each ID, Vector,
+// Matrix and Message of the commit by (type, dbTag, commitTag, size) and
+// the location of the index of the previous commit. The first page of the
+// file holds a header locating the last index. On restore the file is
+// memory mapped and the data copied straight out of the mapping.
+//
+// With setAsync() the commitState() returns once the domain has sent its
+// state into memory, a snapshot of the committed state; a writer thread
+// (pthreads, not on _WIN32) writes the snapshots to the file, at most
+// queueDepth of them being held in memory at once.
+//
+// What: "@(#) BinaryFileDatastore.h, revA"
+
+#include <FE_Datastore.h>
+
+#include <map>
+#include <vector>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class FEM_ObjectBroker;
+
+typedef struct binaryFileDatastoreKey {
+  int type;
+  int dbTag;
+  int commitTag;
+  int size;
+  bool operator<(const struct binaryFileDatastoreKey &other) const;
+} BinaryFileDatastoreKey;
+
+// an entry of an index as written to the file
+typedef struct binaryFileDatastoreEntry {
+  int type;
+  int dbTag;
+  int commitTag;
+  int size;
+  long long offset;
+} BinaryFileDatastoreEntry;
+
+typedef std::map<BinaryFileDatastoreKey, long long> MAP_BINARY_INDEX;
+
+// the data of a commit & its index, ready to be written
+typedef struct binaryFileDatastoreBlock {
+  char *data;
+  long long length;
+  long long offset;
+  long long prevIndex;
+  std::vector<BinaryFileDatastoreEntry> entries;
+} BinaryFileDatastoreBlock;
+
+class BinaryFileDatastore: public FE_Datastore
+{
+  public:
+    BinaryFileDatastore(const char *fileName,
+			Domain &theDomain, 
+			FEM_ObjectBroker &theBroker);    
+    
+    ~BinaryFileDatastore();
+
+    // methods for sending and receiving the data
+    int sendMsg(int dbTag, int commitTag, 
+		const Message &, 
+		ChannelAddress *theAddress =0);    
+    int recvMsg(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+    int recvMsgUnknownSize(int dbTag, int commitTag, 
+		Message &, 
+		ChannelAddress *theAddress =0);        
+
+    int sendMatrix(int dbTag, int commitTag, 
+		   const Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    int recvMatrix(int dbTag, int commitTag, 
+		   Matrix &theMatrix, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendVector(int dbTag, int commitTag, 
+		   const Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    int recvVector(int dbTag, int commitTag, 
+		   Vector &theVector, 
+		   ChannelAddress *theAddress =0);
+    
+    int sendID(int dbTag, int commitTag,
+	       const ID &theID,
+	       ChannelAddress *theAddress =0);
+    int recvID(int dbTag, int commitTag,
+	       ID &theID,
+	       ChannelAddress *theAddress =0);
+
+    int commitState(int commitTag);        
+    int restoreState(int commitTag);        
+
+    int setAsync(int queueDepth);
+
+    // called by the writer thread
+    void drainBlocks(void);
+    
+  protected:
+
+  private:
+    int addData(int type, int dbTag, int commitTag, int size, 
+		const void *theData, int numBytes);
+    int getData(int type, int dbTag, int commitTag, int size, 
+		void *theData, int numBytes);
+    int flush(void);
+    void prepareBlock(BinaryFileDatastoreBlock &theBlock);
+    int writeBlock(BinaryFileDatastoreBlock &theBlock);
+    void waitForWriter(void);
+    void stopWriter(void);
+    int mapFile(void);
+    void unmapFile(void);
+
+    char *fileName;
+    FILE *theFile;
+    long long fileEnd;         // where the next commit's data starts
+    long long lastIndex;       // where the index of the last commit is
+
+    MAP_BINARY_INDEX theIndex; // file offset of every piece of data
+    std::vector<BinaryFileDatastoreEntry> newEntries;
+
+    char *buffer;              // the data of the current commit
+    long long bufferSize, bufferLength;
+
+    char *mappedData;          // the file as mapped for a restore
+    long long mappedLength;
+
+    // the queue of commits for the writer thread
+    BinaryFileDatastoreBlock *blocks;
+    int numBlocks, fillBlock, drainBlock, numFull;
+    bool finished, threaded;
+    int writeError;
+#ifndef _WIN32
+    pthread_t writer;
+    pthread_mutex_t lock;
+    pthread_cond_t blockFull;
+    pthread_cond_t blockFree;
+#endif
+};
+
+#endif
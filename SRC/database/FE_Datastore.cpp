@@ -47,7 +47,7 @@ int FE_Datastore::lastDbTag(0);
 //	of external nodes for the FE_Datastore.
 
 FE_Datastore::FE_Datastore(Domain &thDomain, FEM_ObjectBroker &theBroker) 
-  :theObjectBroker(&theBroker), theDomain(&thDomain)
+  :theObjectBroker(&theBroker), theDomain(&thDomain), insertBatch(100)
 {
 
 }
@@ -185,6 +185,26 @@ FE_Datastore::getData(const char *table, char *column[], int commitTag, Vector &
   return -1;
 }
 
+int
+FE_Datastore::setInsertBatch(int numRows)
+{
+  if (numRows < 1) {
+    opserr << "FE_Datastore::setInsertBatch - numRows " << numRows << " < 1, using 1\n";
+    numRows = 1;
+  }
+
+  // the rows kept for the old size are written first
+  this->flushData();
+  insertBatch = numRows;
+  return 0;
+}
+
+int
+FE_Datastore::flushData(void)
+{
+  return 0;
+}
+
 int
 FE_Datastore::getDbTag(void)
 {
@@ -79,6 +79,14 @@ class FE_Datastore: public Channel
 			   int commitTag, const Vector &data);
     virtual int getData(const char *tableName, char *columns[], 
 			int commitTag, Vector &data);
+
+    // the rows given to insertData() may be kept by a datastore and
+    // written numRows at a time, e.g. in one INSERT statement; 
+    // flushData() writes the rows kept, it is invoked by the streams
+    // inserting the rows once they are done
+    virtual int setInsertBatch(int numRows);
+    int getInsertBatch(void) const {return insertBatch;}
+    virtual int flushData(void);
 			
   protected:
     FEM_ObjectBroker *getObjectBroker(void);
@@ -86,6 +94,7 @@ class FE_Datastore: public Channel
   private:
     FEM_ObjectBroker *theObjectBroker;
     Domain *theDomain;
+    int insertBatch;
     static int lastDbTag;
 
 };
@@ -67,6 +67,7 @@ FileDatastore::FileDatastore(const char *dataBaseName,
 
 FileDatastore::~FileDatastore() 
 {
+  this->flushData();
 
   if (data != 0)
     delete [] data;
@@ -1137,40 +1138,60 @@ int
 FileDatastore::insertData(const char *tableName, char *columns[], 
 			  int commitTag, const Vector &data)
 {
-  // open the file
-  char *fileName = new char[strlen(tableName) + strlen(dataBase) + 10];
-  if (fileName == 0) {
-    opserr << "FileDatastore::insertData - out of memory; failed to open file: " << fileName << endln;
-    return -1;
+  // the line is kept, the file is opened once for a batch of lines
+  std::string &theRows = theInsertRows[tableName];
+  char value[32];
+  for (int i=0; i<data.Size(); i++) {
+    sprintf(value, "%.16e\t", data(i));
+    theRows += value;
   }
+  theRows += "\n";
 
-  strcpy(fileName, dataBase);    
-  strcat(fileName,".");
-  strcat(fileName, tableName);
+  int &numRows = numInsertRows[tableName];
+  numRows++;
+  if (numRows >= this->getInsertBatch())
+    return this->flushTable(tableName);
+
+  return 0;
+}
+
+int
+FileDatastore::flushTable(const std::string &tableName)
+{
+  std::string &theRows = theInsertRows[tableName];
+  numInsertRows[tableName] = 0;
+  if (theRows.empty())
+    return 0;
+
+  std::string fileName = std::string(dataBase) + "." + tableName;
 
   ofstream table;
-  table.open(fileName, ios::app); 
+  table.open(fileName.c_str(), ios::app); 
   if (table.bad() == true || table.is_open() == false) {
-    opserr << "FileDatastore::insertData - failed to open file: " << fileName << endln;
-    delete [] fileName;
+    opserr << "FileDatastore::insertData - failed to open file: " << fileName.c_str() << endln;
+    theRows.clear();
     return -1;
   }
 
-  table << setiosflags(ios::scientific);
-  table << std::setprecision(16);
-
-  // write the data
-  for (int i=0; i<data.Size(); i++) {
-    table << data(i) << "\t";
-  }
-  
-  table << "\n";
+  table << theRows;
   table.close();
+  theRows.clear();
 
-  delete [] fileName;
   return 0;
 }
 
+int
+FileDatastore::flushData(void)
+{
+  int result = 0;
+  map<std::string, std::string>::iterator theTable;
+  for (theTable = theInsertRows.begin(); theTable != theInsertRows.end(); theTable++)
+    if (this->flushTable(theTable->first) < 0)
+      result = -1;
+
+  return result;
+}
+
 
 int 
 FileDatastore::getData(const char *tableName, char *columns[], int commitTag, Vector &data)
@@ -41,6 +41,7 @@
 
 #include <fstream>
 #include <map>
+#include <string>
 using std::fstream;
 using std::map;
 
@@ -116,6 +117,7 @@ class FileDatastore: public FE_Datastore
     int insertData(const char *tableName, char *columns[], 
 		   int commitTag, const Vector &data);
     int getData(const char *tableName, char *columns[], int commitTag, Vector &data);
+    int flushData(void);
 
     // the commitState method
     int commitState(int commitTag);        
@@ -128,9 +130,16 @@ class FileDatastore: public FE_Datastore
     int resizeDouble(int newSize);
     void resetFilePointers(void);
     int openFile(char *fileName, FileDatastoreOutputFile *, int dataSize);
+    int flushTable(const std::string &tableName);
 
     // private attributes
     char *dataBase;
+
+    // the lines kept by insertData() for each table and their number,
+    // appended to the file of the table by flushTable()
+    map<std::string, std::string> theInsertRows;
+    map<std::string, int> numInsertRows;
+
     MAP_FILES theIDFiles;
     MAP_FILES theVectFiles;
     MAP_FILES theMatFiles;
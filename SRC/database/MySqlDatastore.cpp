@@ -114,8 +114,10 @@ MySqlDatastore::MySqlDatastore(const char *databaseName,
 
 MySqlDatastore::~MySqlDatastore()
 {
-  if (connection == true) 
+  if (connection == true) {
+    this->flushData();
     mysql_close(&mysql);
+  }
 
   if (query != 0)
     delete [] query;
@@ -631,54 +633,75 @@ MySqlDatastore::insertData(const char *tableName, char *columns[], int commitTag
   if (connection == false)
     return -1;
 
-  // check that query string is big enough to hold the data, if not enlarge
-  int sizeData = 128 + strlen(tableName);
-  if ((query == 0) || (sizeData > sizeQuery)) { // *2 for extra space mysql needs
-    if (query != 0)
-      delete [] query;
-    sizeQuery = sizeData; // 256 for the SLECECT data FROM ... blah blah
-    query = new char [sizeQuery];
-    if (query == 0) {
-      opserr << "MySqlDatastore::getData - out of memory creating query of size";
-      opserr << sizeQuery << endln;
-      return -2;
+  // the row is added to those kept for the table, a row already in the
+  // table for the commitTag is replaced when they are inserted
+  InsertRows &theRows = theInsertRows[tableName];
+  if (theRows.numRows == 0) {
+    theRows.update = " ON DUPLICATE KEY UPDATE ";
+    for (int i=0; i<data.Size(); i++) {
+      if (i != 0)
+	theRows.update += ", ";
+      theRows.update += columns[i];
+      theRows.update += "=VALUES(";
+      theRows.update += columns[i];
+      theRows.update += ")";
     }
-  }
+  } else
+    theRows.rows += ", ";
 
-  // form the insert query
-  sprintf(query, "INSERT INTO %s VALUES (%d, %d ", tableName, dbRun, commitTag);  
-  char *p = query + strlen(query);
-  for (int i=0; i<data.Size(); i++)
-    p += sprintf(p, ", %f ", data(i));  
-  strcpy(p, ")");
+  char value[32];
+  sprintf(value, "(%d, %d", dbRun, commitTag);
+  theRows.rows += value;
+  for (int i=0; i<data.Size(); i++) {
+    sprintf(value, ", %.16g", data(i));
+    theRows.rows += value;
+  }
+  theRows.rows += ")";
+  theRows.numRows++;
 
-  // execute the query
-  if (mysql_query(&mysql, query) != 0) {
+  // written once the batch is full, or the statement nears the packet
+  // size of older servers
+  if (theRows.numRows >= this->getInsertBatch() || theRows.rows.size() > 1000000)
+    return this->flushTable(tableName, theRows);
 
+  return 0;
+}
 
-    //
-    // if INSERT fails we reformulate query and try an UPDATE
-    //
+int
+MySqlDatastore::flushTable(const std::string &tableName, InsertRows &theRows)
+{
+  if (theRows.numRows == 0)
+    return 0;
 
-    // formulate the query
-    sprintf(query, "UPDATE %s SET %s=%f", tableName, columns[0], data(0));
-    char *p = query + strlen(query);
-    for (int i=1; i<data.Size(); i++)
-      p += sprintf(p, ", %s=%f ", columns[i], data(i));  
-    sprintf(p, " WHERE dbRun=%d AND commitTag=%d", dbTag, commitTag);  
+  std::string insert = "INSERT INTO " + tableName + " VALUES " + theRows.rows + theRows.update;
+  theRows.rows.clear();
+  theRows.numRows = 0;
 
-    // invoke the query on the database
-    if (mysql_query(&mysql, query) != 0) {    
-      opserr << "MySqlDatastore::insertData() - failed to send the data to MySQL database";
-      opserr << p;
-      opserr << endln << mysql_error(&mysql) << endln;          
-      return -3;      
-    }
+  if (mysql_query(&mysql, insert.c_str()) != 0) {
+    opserr << "MySqlDatastore::insertData() - failed to send the data to MySQL database table ";
+    opserr << tableName.c_str();
+    opserr << endln << mysql_error(&mysql) << endln;          
+    return -3;      
   }
 
   return 0;
 }
 
+int
+MySqlDatastore::flushData(void)
+{
+  if (connection == false)
+    return -1;
+
+  int result = 0;
+  std::map<std::string, InsertRows>::iterator theTable;
+  for (theTable = theInsertRows.begin(); theTable != theInsertRows.end(); theTable++)
+    if (this->flushTable(theTable->first, theTable->second) < 0)
+      result = -3;
+
+  return result;
+}
+
 int 
 MySqlDatastore::getData(const char *tableName, char *columns[], int commitTag, Vector &data)
 {
@@ -700,6 +723,11 @@ MySqlDatastore::getData(const char *tableName, char *columns[], int commitTag, V
     }
   }
 
+  // the rows kept for the table are written first
+  std::map<std::string, InsertRows>::iterator theTable = theInsertRows.find(tableName);
+  if (theTable != theInsertRows.end())
+    this->flushTable(theTable->first, theTable->second);
+
   // to receive the data the database we do the following:
   // 1. use SELECT to receive the data from the database
   // 2. fetch the results from the server and copy to the Vectors data area
@@ -38,6 +38,8 @@
 
 #include <FE_Datastore.h>
 #include <mysql.h>
+#include <map>
+#include <string>
 
 class MySqlDatastore: public FE_Datastore
 {
@@ -92,6 +94,7 @@ class MySqlDatastore: public FE_Datastore
   int createTable(const char *tableName, int numColumns, char *columns[]);
   int insertData(const char *tableName, char *columns[], int commitTag, const Vector &data);
   int getData(const char *tableName, char *columns[], int commitTag, Vector &data);
+  int flushData(void);
 
   int setDbRun(int run);
   int getDbRun(void);
@@ -110,6 +113,17 @@ class MySqlDatastore: public FE_Datastore
   char *query;
   int sizeQuery;
   int sizeColumnString;
+
+  // the rows kept by insertData() for a table, written by flushTable() in
+  // one INSERT that replaces the rows already in the table
+  struct InsertRows {
+    InsertRows() :numRows(0) {}
+    std::string rows;
+    std::string update;
+    int numRows;
+  };
+  std::map<std::string, InsertRows> theInsertRows;
+  int flushTable(const std::string &tableName, InsertRows &theRows);
 };
 
 #endif
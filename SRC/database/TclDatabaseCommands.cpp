@@ -46,6 +46,8 @@
 
 // known databases
 #include <FileDatastore.h>
+#include <BinaryFileDatastore.h>
+#include <DatastoreRecorder.h>
 
 // linked list of struct for other types of
 // databases that can be added dynamically
@@ -68,6 +70,7 @@ typedef struct databasePackageCommand {
 // static variables
 static DatabasePackageCommand *theDatabasePackageCommands = NULL;
 static bool createdDatabaseCommands = false;
+static int theDatastoreRecorderTag = -1;
 
 
 int 
@@ -78,6 +81,10 @@ restore(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
 extern FE_Datastore *theDatabase;
 
+#ifdef _PARALLEL_INTERPRETERS
+extern int OPS_rank;
+#endif
+
 int
 TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv, 
 	       Domain &theDomain, 
@@ -100,6 +107,35 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
     return TCL_ERROR;
   }    
 
+  // check for the option to insert the rows of the recorders in batches
+  // of numRows, strip it and create the database with what is left
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-batch") == 0) {
+      int numRows;
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &numRows) != TCL_OK) {
+	opserr << "WARNING database " << argv[1] << " ... -batch numRows\n";
+	return TCL_ERROR;
+      }
+
+      TCL_Char **newArgv = new TCL_Char *[argc];
+      int newArgc = 0;
+      for (int j=0; j<argc; j++)
+	if (j != i && j != i+1)
+	  newArgv[newArgc++] = argv[j];
+
+      FE_Datastore *oldDatabase = theDatabase;
+      int res = TclAddDatabase(clientData, interp, newArgc, newArgv, theDomain, theBroker);
+      delete [] newArgv;
+      if (res != TCL_OK)
+	return res;
+
+      if (theDatabase != oldDatabase && theDatabase != 0)
+	theDatabase->setInsertBatch(numRows);
+
+      return TCL_OK;
+    }
+  }
+
   //
   // check argv[1] for type of Database, parse in rest of arguments
   // needed for the type of Database, create the object and add to Domain
@@ -113,6 +149,10 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
     }    
 
     // delete the old database
+    if (theDatastoreRecorderTag >= 0) {
+      theDomain.removeRecorder(theDatastoreRecorderTag);
+      theDatastoreRecorderTag = -1;
+    }
     if (theDatabase != 0)
       delete theDatabase;
 
@@ -123,6 +163,75 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
       return TCL_ERROR;
     } 
     
+    return TCL_OK;
+
+  // a checkpoint File Database, one binary file for all the commits
+  } else if (strcmp(argv[1],"Binary") == 0 || strcmp(argv[1],"BinaryFile") == 0) {
+    // database Binary fileName? <-async queueDepth?> <-commit numCommits?>
+    if (argc < 3) {
+      opserr << "WARNING database Binary fileName? <-async queueDepth?> <-commit numCommits?>";
+      return TCL_ERROR;
+    }    
+
+    int queueDepth = 0;
+    int numCommits = 0;
+    for (int loc=3; loc<argc; loc++) {
+      if (strcmp(argv[loc],"-async") == 0) {
+	queueDepth = 2;
+	if (loc+1 < argc && argv[loc+1][0] != '-')
+	  if (Tcl_GetInt(interp, argv[++loc], &queueDepth) != TCL_OK) {
+	    opserr << "WARNING database Binary - invalid queueDepth " << argv[loc] << endln;
+	    return TCL_ERROR;
+	  }
+      } else if (strcmp(argv[loc],"-commit") == 0) {
+	numCommits = 1;
+	if (loc+1 < argc && argv[loc+1][0] != '-')
+	  if (Tcl_GetInt(interp, argv[++loc], &numCommits) != TCL_OK) {
+	    opserr << "WARNING database Binary - invalid numCommits " << argv[loc] << endln;
+	    return TCL_ERROR;
+	  }
+      } else {
+	opserr << "WARNING database Binary - unknown option " << argv[loc] << endln;
+	return TCL_ERROR;
+      }
+    }
+
+    // delete the old database & the recorder committing it
+    if (theDatastoreRecorderTag >= 0) {
+      theDomain.removeRecorder(theDatastoreRecorderTag);
+      theDatastoreRecorderTag = -1;
+    }
+    if (theDatabase != 0)
+      delete theDatabase;
+
+    BinaryFileDatastore *theBinaryDatabase = 0;
+#ifdef _PARALLEL_INTERPRETERS
+    // each process writes its own file
+    char *fileName = new char[strlen(argv[2])+16];
+    sprintf(fileName, "%s.%d", argv[2], OPS_rank);
+    theBinaryDatabase = new BinaryFileDatastore(fileName, theDomain, theBroker);
+    delete [] fileName;
+#else
+    theBinaryDatabase = new BinaryFileDatastore(argv[2], theDomain, theBroker);
+#endif
+    theDatabase = theBinaryDatabase;
+
+    if (theDatabase == 0) {
+      opserr << "WARNING ran out of memory - database Binary " << argv[2] << endln;
+      return TCL_ERROR;
+    } 
+
+    // write the commits in the background, holding at most queueDepth
+    if (queueDepth > 0)
+      theBinaryDatabase->setAsync(queueDepth);
+
+    // save the state every numCommits commits of the domain
+    if (numCommits > 0) {
+      DatastoreRecorder *theRecorder = new DatastoreRecorder(*theDatabase, numCommits);
+      theDomain.addRecorder(*theRecorder);
+      theDatastoreRecorderTag = theRecorder->getTag();
+    }
+    
     return TCL_OK;
   } else {
 
@@ -173,7 +282,7 @@ TclAddDatabase(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **a
     }
   }
   opserr << "WARNING No database type exists ";
-  opserr << "for database of type:" << argv[1] << "valid database type File\n";
+  opserr << "for database of type:" << argv[1] << "valid database type File, Binary\n";
 
   return TCL_ERROR;
 }    
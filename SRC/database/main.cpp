@@ -48,8 +48,8 @@
 #include <FEM_ObjectBroker.h>
 #include <bool.h>
 
-double ops_Dt;
-Domain * ops_TheActiveDomain;
+OPS_THREAD_LOCAL double ops_Dt;
+OPS_THREAD_LOCAL Domain * ops_TheActiveDomain;
 #include <StandardStream.h>
 StandardStream sserr;
 OPS_Stream *opserrPtr = &sserr;
@@ -26,6 +26,8 @@
 #include <Parameter.h>
 #include <DomainComponent.h>
 
+int Parameter::updateStamp = 0;
+
 Parameter::Parameter(int passedTag,
 		     DomainComponent *parentObject,
 		     const char **argv, int argc)
@@ -179,6 +181,7 @@ int
 Parameter::update(int newValue)
 {
   theInfo.theInt = newValue;
+  updateStamp++;
 
   int ok = 0;
 
@@ -192,6 +195,7 @@ int
 Parameter::update(double newValue)
 {
   theInfo.theDouble = newValue;
+  updateStamp++;
 
   int ok = 0;
 
@@ -51,6 +51,9 @@ class Parameter : public TaggedObject, public MovableObject
   
   virtual int update(int newValue); 
   virtual int update(double newValue); 
+
+  // the number of times any parameter updated its objects
+  static int getUpdateStamp(void) {return updateStamp;}
   virtual int activate(bool active);
   virtual double getValue(void) {return theInfo.theDouble;}
   virtual void setValue(double newValue) {theInfo.theDouble = newValue;}
@@ -94,6 +97,8 @@ class Parameter : public TaggedObject, public MovableObject
   int maxNumComponents;
 
   int gradIndex; // 0,...,nparam-1
+
+  static int updateStamp;
 };
 
 #endif
@@ -42,8 +42,9 @@
 #include <elementAPI.h>
 #include <Domain.h>
 
-static int numMPs = 0;
-static int nextTag = 0;
+// the constraints of each thread are counted and tagged separately
+static OPS_THREAD_LOCAL int numMPs = 0;
+static OPS_THREAD_LOCAL int nextTag = 0;
 
 int OPS_EqualDOF()
 {
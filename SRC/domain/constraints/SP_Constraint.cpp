@@ -39,8 +39,9 @@
 #include <Node.h>
 #include <ID.h>
 
-static int numSPs = 0;
-static int nextTag = 0;
+// the constraints of each thread are counted and tagged separately
+static OPS_THREAD_LOCAL int numSPs = 0;
+static OPS_THREAD_LOCAL int nextTag = 0;
 
 int OPS_HomogeneousBC()
 {
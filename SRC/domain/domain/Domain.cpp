@@ -70,18 +70,26 @@
 #include <Matrix.h>
 #include <Graph.h>
 #include <Recorder.h>
+#include <ElementResponse.h>
 #include <MeshRegion.h>
 #include <Analysis.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <Profiler.h>
+#include <NodalState.h>
+#include <ThreadPool.h>
+#include <Workspace.h>
+
+#include <vector>
+#include <algorithm>
 
 //
 // global variables
 //
 
-Domain       *ops_TheActiveDomain = 0;
-double        ops_Dt = 0.0;
-bool          ops_InitialStateAnalysis = false;
+OPS_THREAD_LOCAL Domain       *ops_TheActiveDomain = 0;
+OPS_THREAD_LOCAL double        ops_Dt = 0.0;
+OPS_THREAD_LOCAL bool          ops_InitialStateAnalysis = false;
 
 Domain::Domain()
 :theRecorders(0), numRecorders(0),
@@ -90,11 +98,20 @@ Domain::Domain()
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false),  nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), commitTag(0), numNodalStateNodes(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
  lastChannel(0),
- paramIndex(0), paramSize(0), numParameters(0)
+ reactionNodesBuilt(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodeTags(0), reactionNodeStart(0), reactionNodeEles(0),
+ reactionNodePtrs(0), reactionEles(0),
+ recordingReactions(false), allReactions(false), reactionFlag(-1),
+ reactionStamp(0), reactionPass(0), numReactionFormed(0),
+ reactionNodeStamp(0), reactionElePass(0), reactionFormed(0),
+ responseQueries(0), nextResponseQuery(0),
+ damageIndex(0.0), damageLimit(0.0),
+ paramIndex(0), paramSize(0), numParameters(0),
+ eleRangeValid(false), nodRangeValid(false)
 {
   
     // init the arrays for storing the domain components
@@ -145,10 +162,20 @@ Domain::Domain(int numNodes, int numElements, int numSPs, int numMPs,
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0),
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), commitTag(0), numNodalStateNodes(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0), paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),
+ reactionNodesBuilt(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodeTags(0), reactionNodeStart(0), reactionNodeEles(0),
+ reactionNodePtrs(0), reactionEles(0),
+ recordingReactions(false), allReactions(false), reactionFlag(-1),
+ reactionStamp(0), reactionPass(0), numReactionFormed(0),
+ reactionNodeStamp(0), reactionElePass(0), reactionFormed(0),
+ responseQueries(0), nextResponseQuery(0),
+ damageIndex(0.0), damageLimit(0.0),
+ paramIndex(0), paramSize(0), numParameters(0),
+ eleRangeValid(false), nodRangeValid(false)
 {
     // init the arrays for storing the domain components
     theElements = new MapOfTaggedObjects();
@@ -205,10 +232,20 @@ Domain::Domain(TaggedObjectStorage &theNodesStorage,
  theSPs(&theSPsStorage),
  theMPs(&theMPsStorage), 
  theLoadPatterns(&theLoadPatternsStorage),
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), commitTag(0), numNodalStateNodes(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),
+ reactionNodesBuilt(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodeTags(0), reactionNodeStart(0), reactionNodeEles(0),
+ reactionNodePtrs(0), reactionEles(0),
+ recordingReactions(false), allReactions(false), reactionFlag(-1),
+ reactionStamp(0), reactionPass(0), numReactionFormed(0),
+ reactionNodeStamp(0), reactionElePass(0), reactionFormed(0),
+ responseQueries(0), nextResponseQuery(0),
+ damageIndex(0.0), damageLimit(0.0),
+ paramIndex(0), paramSize(0), numParameters(0),
+ eleRangeValid(false), nodRangeValid(false)
 {
     // init the arrays for storing the domain components
     thePCs      = new MapOfTaggedObjects();
@@ -263,10 +300,20 @@ Domain::Domain(TaggedObjectStorage &theStorage)
  dbEle(0), dbNod(0), dbSPs(0), dbPCs(0), dbMPs(0), dbLPs(0), dbParam(0),
  eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false), theNodeGraph(0), 
  theElementGraph(0), 
- theRegions(0), numRegions(0), commitTag(0),
+ theRegions(0), numRegions(0), commitTag(0), numNodalStateNodes(0),
  theBounds(6), theEigenvalues(0), theEigenvalueSetTime(0), 
  theModalDampingFactors(0), inclModalMatrix(false),
- lastChannel(0),paramIndex(0), paramSize(0), numParameters(0)
+ lastChannel(0),
+ reactionNodesBuilt(false), numReactionNodes(0), numReactionEles(0),
+ reactionNodeTags(0), reactionNodeStart(0), reactionNodeEles(0),
+ reactionNodePtrs(0), reactionEles(0),
+ recordingReactions(false), allReactions(false), reactionFlag(-1),
+ reactionStamp(0), reactionPass(0), numReactionFormed(0),
+ reactionNodeStamp(0), reactionElePass(0), reactionFormed(0),
+ responseQueries(0), nextResponseQuery(0),
+ damageIndex(0.0), damageLimit(0.0),
+ paramIndex(0), paramSize(0), numParameters(0),
+ eleRangeValid(false), nodRangeValid(false)
 {
     // init the arrays for storing the domain components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -368,6 +415,9 @@ Domain::~Domain()
   if (theParamIter != 0)
     delete theParamIter;
 
+  this->freeReactionNodes();
+  this->freeResponseQueries();
+
   if (theEigenvalues != 0)
     delete theEigenvalues;
 
@@ -470,6 +520,9 @@ Domain::addNode(Node * node)
   if (result == true) {
       node->setDomain(this);
       this->domainChange();
+
+      if (node->hasNodalState() == true)
+	numNodalStateNodes++;
       
       // see if the physical bounds are changed
       // note this assumes 0,0,0,0,0,0 as startup min,max values
@@ -498,6 +551,172 @@ Domain::addNode(Node * node)
 }
 
 
+// int addNodes(Node **, int);
+//	Method to add many nodes to the model, with the storage sized for
+//	them once and the domain marked as changed once.
+
+int
+Domain::addNodes(Node **nodes, int numNodes)
+{
+  if (numNodes <= 0)
+    return 0;
+
+  theNodes->setSize(theNodes->getNumComponents()+numNodes);
+
+  int numAdded = 0;
+  for (int i=0; i<numNodes; i++) {
+    Node *node = nodes[i];
+
+    // the container refuses a node with a tag already in it
+    if (theNodes->addComponent(node) == false) {
+      opserr << "Domain::addNodes - node with tag " << node->getTag();
+      opserr << " could not be added, it may already exist in the model\n";
+      break;
+    }
+    node->setDomain(this);
+
+    if (node->hasNodalState() == true)
+      numNodalStateNodes++;
+
+    // see if the physical bounds are changed
+    const Vector &crds = node->getCrds();
+    int dim = crds.Size();
+    for (int j=0; j<dim && j<3; j++) {
+      double x = crds(j);
+      if (x < theBounds(j)) theBounds(j) = x;
+      if (x > theBounds(j+3)) theBounds(j+3) = x;
+    }
+
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->domainChange();
+
+  return numAdded;
+}
+
+
+// int addElements(Element **, int);
+//	Method to add many elements to the model. The nodes of all of them
+//	are checked first, the storage is then sized for them once and the
+//	domain marked as changed once.
+
+int
+Domain::addElements(Element **elements, int numElements)
+{
+  if (numElements <= 0)
+    return 0;
+
+  // check the nodes of the elements exist in the domain
+  int numValid = numElements;
+  for (int i=0; i<numElements && numValid == numElements; i++) {
+    const ID &nodes = elements[i]->getExternalNodes();
+    for (int j=0; j<nodes.Size(); j++)
+      if (this->getNode(nodes(j)) == 0) {
+	opserr << "WARNING Domain::addElements - In element " << elements[i]->getTag();
+	opserr << "\n no Node " << nodes(j) << " exists in the domain\n";
+	numValid = i;
+	break;
+      }
+  }
+
+  theElements->setSize(theElements->getNumComponents()+numValid);
+
+  int numAdded = 0;
+  for (int i=0; i<numValid; i++) {
+    Element *element = elements[i];
+    ops_TheActiveElement = element;
+
+    // the container refuses an element with a tag already in it
+    if (theElements->addComponent(element) == false) {
+      opserr << "Domain::addElements - element with tag " << element->getTag();
+      opserr << " could not be added, it may already exist in the model\n";
+      break;
+    }
+    element->setDomain(this);
+    element->update();
+
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->domainChange();
+
+  return numAdded;
+}
+
+
+// int addSP_Constraints(SP_Constraint **, int);
+//	Method to add many constraints to the model. The domain change is
+//	marked once for all of them.
+
+int
+Domain::addSP_Constraints(SP_Constraint **spConstraints, int numSPs)
+{
+  if (numSPs <= 0)
+    return 0;
+
+  int numValid = numSPs;
+
+  // check the nodes & dofs exist in the domain
+  for (int i=0; i<numSPs && numValid == numSPs; i++) {
+    int nodeTag = spConstraints[i]->getNodeTag();
+    Node *nodePtr = this->getNode(nodeTag);
+    if (nodePtr == 0) {
+      opserr << "Domain::addSP_Constraints - cannot add as node with tag " <<
+	nodeTag << " does not exist in model\n";
+      numValid = i;
+    } else if (nodePtr->getNumberDOF() < spConstraints[i]->getDOF_Number()) {
+      opserr << "Domain::addSP_Constraints - cannot add as node with tag " <<
+	nodeTag << " does not have associated constrained DOF\n";
+      numValid = i;
+    }
+  }
+
+  // check no dof is constrained twice, by the constraints in the domain or
+  // by those before it in the array
+  int numExisting = theSPs->getNumComponents();
+  int numUnique = numValid;
+  for (int i=0; i<numValid; i++) {
+    std::pair<int,int> theDOF(spConstraints[i]->getNodeTag(),
+			      spConstraints[i]->getDOF_Number());
+    if (theSP_DOFs.find(theDOF) != theSP_DOFs.end()) {
+      numUnique = i;
+      break;
+    }
+    theSP_DOFs[theDOF] = spConstraints[i]->getTag();
+  }
+
+  if (numUnique < numValid) {
+    opserr << "Domain::addSP_Constraints - cannot add as node already constrained in that dof by existing SP_Constraint\n";
+    spConstraints[numUnique]->Print(opserr);
+    numValid = numUnique;
+  }
+
+  theSPs->setSize(numExisting+numValid);
+
+  int numAdded = 0;
+  for (int i=0; i<numValid; i++) {
+    if (theSPs->addComponent(spConstraints[i]) == false) {
+      opserr << "Domain::addSP_Constraints - cannot add constraint with tag " <<
+	spConstraints[i]->getTag() << " to the container\n";
+      for (int j=i; j<numValid; j++)
+	theSP_DOFs.erase(std::pair<int,int>(spConstraints[j]->getNodeTag(),
+					    spConstraints[j]->getDOF_Number()));
+      break;
+    }
+    spConstraints[i]->setDomain(this);
+    numAdded++;
+  }
+
+  if (numAdded > 0)
+    this->domainChange();
+
+  return numAdded;
+}
+
+
 // void addSP_Constraint(SP_Constraint *);
 //	Method to add a constraint to the model.
 //
@@ -527,18 +746,8 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
     // #endif
 
     // check if an existing SP_COnstraint exists for that dof at the node
-    bool found = false;
-    SP_ConstraintIter &theExistingSPs = this->getSPs();
-    SP_Constraint *theExistingSP = 0;
-    while ((found == false) && ((theExistingSP = theExistingSPs()) != 0)) {
-      int spNodeTag = theExistingSP->getNodeTag();
-      int spDof = theExistingSP->getDOF_Number();
-      if (nodeTag == spNodeTag && spDof == dof) {
-	found = true;
-      }
-    }
-    
-    if (found == true) {
+    std::pair<int,int> theDOF(nodeTag, dof);
+    if (theSP_DOFs.find(theDOF) != theSP_DOFs.end()) {
 	opserr << "Domain::addSP_Constraint - cannot add as node already constrained in that dof by existing SP_Constraint\n";
 	spConstraint->Print(opserr);
 	return false;
@@ -561,6 +770,7 @@ Domain::addSP_Constraint(SP_Constraint *spConstraint)
 	tag << "to the container\n";             
       return false;
   } 
+  theSP_DOFs[theDOF] = tag;
 
   spConstraint->setDomain(this);
   this->domainChange();  
@@ -638,16 +848,8 @@ Domain::addSP_Constraint(int axisDirn, double axisValue,
 	  if ((i < numDOF) && (fixityConditions(i) == 1)) {
 
 	    // check if an existing SP_COnstraint exists for that dof at the node
-	    bool found = false;
-	    SP_ConstraintIter &theExistingSPs = this->getSPs();
-	    SP_Constraint *theExistingSP = 0;
-	    while ((found == false) && ((theExistingSP = theExistingSPs()) != 0)) {
-	      int spNodeTag = theExistingSP->getNodeTag();
-	      int dof = theExistingSP->getDOF_Number();
-	      if (nodeTag == spNodeTag && i == dof) {
-		found = true;
-	      }
-	    }
+	    bool found = 
+	      (theSP_DOFs.find(std::pair<int,int>(nodeTag, i)) != theSP_DOFs.end());
 	    
 	    // if no sp constraint, create one and ass it
 	    if (found == false) {
@@ -933,12 +1135,18 @@ Domain::clearAll(void) {
   // clean out the containers
   theElements->clearAll();
   theNodes->clearAll();
+  eleRangeValid = false;
+  nodRangeValid = false;
+  numNodalStateNodes = 0;
   theSPs->clearAll();
+  theSP_DOFs.clear();
   thePCs->clearAll();
   theMPs->clearAll();
   theLoadPatterns->clearAll();
   theParameters->clearAll();
   numParameters = 0;
+  this->freeReactionNodes();
+  this->freeResponseQueries();
 
   // remove the recorders
   int i;
@@ -1044,6 +1252,8 @@ Domain::removeNode(int tag)
   // this container and return the result of the cast
   Node *result = (Node *)mc;
   // result->setDomain(0);
+  if (result->hasNodalState() == true)
+    numNodalStateNodes--;
   return result;
 }
 
@@ -1056,14 +1266,11 @@ Domain::removeSP_Constraint(int theNode, int theDOF, int loadPatternTag)
   int spTag = 0;
 
   if (loadPatternTag == -1) {
-    SP_ConstraintIter &theSPs = this->getSPs();
-    while ((found == false) && ((theSP = theSPs()) != 0)) {
-      int nodeTag = theSP->getNodeTag();
-      int dof = theSP->getDOF_Number();
-      if (nodeTag == theNode && dof == theDOF) {
-	spTag = theSP->getTag();
-	found = true;
-      }
+    std::map<std::pair<int,int>, int>::iterator theLoc =
+      theSP_DOFs.find(std::pair<int,int>(theNode, theDOF));
+    if (theLoc != theSP_DOFs.end()) {
+      spTag = theLoc->second;
+      found = true;
     }
     
   } else {
@@ -1106,6 +1313,10 @@ Domain::removeSP_Constraint(int tag)
     if (mc == 0) 
 	return 0;
 
+    SP_Constraint *theSP = (SP_Constraint *)mc;
+    theSP_DOFs.erase(std::pair<int,int>(theSP->getNodeTag(), 
+					theSP->getDOF_Number()));
+
     // mark the domain as having changed    
     this->domainChange();
     
@@ -1339,6 +1550,86 @@ Domain::removeSP_Constraint(int tag, int loadPattern)
   return theSP;
 }    
 
+// moves the objects of theOldStorage into an empty copy of theStorageType,
+// returns the new storage or 0 if it could not be done, in which case
+// the objects are left in theOldStorage
+static TaggedObjectStorage *
+moveComponents(TaggedObjectStorage *theOldStorage, TaggedObjectStorage &theStorageType)
+{
+  TaggedObjectStorage *theNewStorage = theStorageType.getEmptyCopy();
+  if (theNewStorage == 0)
+    return 0;
+
+  theNewStorage->setSize(theOldStorage->getNumComponents());
+
+  TaggedObject *theObject;
+  TaggedObjectIter &theObjects = theOldStorage->getComponents();
+  while ((theObject = theObjects()) != 0) {
+    if (theNewStorage->addComponent(theObject) == false) {
+      theNewStorage->clearAll(false);
+      delete theNewStorage;
+      return 0;
+    }
+  }
+
+  theOldStorage->clearAll(false);
+  return theNewStorage;
+}
+
+int
+Domain::setStorage(int components, TaggedObjectStorage &theStorageType)
+{
+  TaggedObjectStorage **theStorage[7] = {&theNodes, &theElements, &theSPs, &thePCs,
+					 &theMPs, &theLoadPatterns, &theParameters};
+
+  for (int i=0; i<7; i++) {
+    if ((components & (1 << i)) == 0)
+      continue;
+
+    TaggedObjectStorage *theNewStorage = moveComponents(*theStorage[i], theStorageType);
+    if (theNewStorage == 0) {
+      opserr << "Domain::setStorage() - failed to move the components to the new storage\n";
+      return -1;
+    }
+    delete *theStorage[i];
+    *theStorage[i] = theNewStorage;
+  }
+
+  // the iters hold the iter of the storage they were created with
+  eleRangeValid = false;
+  nodRangeValid = false;
+  if ((components & NODES) != 0) {
+    delete theNodIter;
+    theNodIter = new SingleDomNodIter(theNodes);
+  }
+  if ((components & ELEMENTS) != 0) {
+    delete theEleIter;
+    theEleIter = new SingleDomEleIter(theElements);
+  }
+  if ((components & SP_CONSTRAINTS) != 0) {
+    delete theSP_Iter;
+    theSP_Iter = new SingleDomSP_Iter(theSPs);
+  }
+  if ((components & PRESSURE_CONSTRAINTS) != 0) {
+    delete thePC_Iter;
+    thePC_Iter = new SingleDomPC_Iter(thePCs);
+  }
+  if ((components & MP_CONSTRAINTS) != 0) {
+    delete theMP_Iter;
+    theMP_Iter = new SingleDomMP_Iter(theMPs);
+  }
+  if ((components & LOAD_PATTERNS) != 0) {
+    delete theLoadPatternIter;
+    theLoadPatternIter = new LoadPatternIter(theLoadPatterns);
+  }
+  if ((components & PARAMETERS) != 0) {
+    delete theParamIter;
+    theParamIter = new SingleDomParamIter(theParameters);
+  }
+
+  return 0;
+}
+
 ElementIter &
 Domain::getElements()
 {
@@ -1354,6 +1645,46 @@ Domain::getNodes()
     return *theNodIter;
 }
 
+
+ComponentRange<Element>
+Domain::getElementRange(void)
+{
+    // gathered with the virtual iterator, so that the range of a subclass
+    // holds the elements that subclass iterates over
+    if (eleRangeValid == false) {
+      theEleRange.clear();
+      theEleRange.reserve(this->getNumElements());
+      ElementIter &theEles = this->getElements();
+      Element *elePtr;
+      while ((elePtr = theEles()) != 0)
+	theEleRange.push_back(elePtr);
+      eleRangeValid = true;
+    }
+
+    if (theEleRange.empty())
+      return ComponentRange<Element>();
+    return ComponentRange<Element>(&theEleRange[0], theEleRange.size());
+}
+
+
+ComponentRange<Node>
+Domain::getNodeRange(void)
+{
+    if (nodRangeValid == false) {
+      theNodRange.clear();
+      theNodRange.reserve(this->getNumNodes());
+      NodeIter &theNods = this->getNodes();
+      Node *nodPtr;
+      while ((nodPtr = theNods()) != 0)
+	theNodRange.push_back(nodPtr);
+      nodRangeValid = true;
+    }
+
+    if (theNodRange.empty())
+      return ComponentRange<Node>();
+    return ComponentRange<Node>(&theNodRange[0], theNodRange.size());
+}
+
 SP_ConstraintIter &
 Domain::getSPs()
 {
@@ -1592,7 +1923,8 @@ Domain::getNodeResponse(int nodeTag, NodeResponseType responseType)
 }
 
 
-static Vector responseData(0);
+// key identifying the Workspace vector returned by getElementResponse()
+static char responseKey;
 
 const Vector *
 Domain::getElementResponse(int eleTag, const char **argv, int argc)
@@ -1608,8 +1940,7 @@ Domain::getElementResponse(int eleTag, const char **argv, int argc)
       } else if (strcmp(argv[0],"nodeTags") == 0) {
 	const ID&theNodes = theEle->getExternalNodes();
 	int size = theNodes.Size();
-	if (responseData.Size() != size) 
-	  responseData.resize(size);
+	Vector &responseData = Workspace::getVector(&responseKey, size);
 	for (int i=0; i<size; i++)
 	  responseData(i) = theNodes(i);
 	return &responseData;
@@ -1628,14 +1959,224 @@ Domain::getElementResponse(int eleTag, const char **argv, int argc)
     }
 
     Information &eleInfo = theResponse->getInformation();
-    //const Vector *data = &(eleInfo.getData());
-    responseData = eleInfo.getData();
+    const Vector &data = eleInfo.getData();
+    Vector &responseData = Workspace::getVector(&responseKey, data.Size());
+    responseData = data;
     delete theResponse;
     return &responseData;
   }
 }
 
 
+int
+Domain::getNodeResponses(const ID &nodeTags, NodeResponseType responseType,
+			 int dof, Vector &result)
+{
+  int numNodes = nodeTags.Size();
+  const Vector **theResponses = new const Vector *[numNodes];
+
+  int numValues = 0;
+  for (int i=0; i<numNodes; i++) {
+    theResponses[i] = this->getNodeResponse(nodeTags(i), responseType);
+    if (theResponses[i] == 0) {
+      opserr << "WARNING Domain::getNodeResponses() - no response for node " << nodeTags(i) << endln;
+      delete [] theResponses;
+      return -1;
+    }
+    if (dof >= 0) {
+      if (dof >= theResponses[i]->Size()) {
+	opserr << "WARNING Domain::getNodeResponses() - dof " << dof+1 << " too large for node " << nodeTags(i) << endln;
+	delete [] theResponses;
+	return -1;
+      }
+      numValues++;
+    } else
+      numValues += theResponses[i]->Size();
+  }
+
+  if (result.Size() != numValues)
+    result.resize(numValues);
+
+  int loc = 0;
+  for (int i=0; i<numNodes; i++) {
+    const Vector &theResponse = *theResponses[i];
+    if (dof >= 0)
+      result(loc++) = theResponse(dof);
+    else
+      for (int j=0; j<theResponse.Size(); j++)
+	result(loc++) = theResponse(j);
+  }
+
+  delete [] theResponses;
+  return numValues;
+}
+
+
+// the Responses of a getElementResponses() query, its arguments are kept
+// one after the other each with its terminating null character
+struct ElementResponseQuery {
+  char *args;
+  int argsLength;
+  ID eleTags;
+  Response **theResponses;
+};
+
+static void
+deleteResponseQuery(ElementResponseQuery *theQuery)
+{
+  for (int i=0; i<theQuery->eleTags.Size(); i++)
+    if (theQuery->theResponses[i] != 0)
+      delete theQuery->theResponses[i];
+  delete [] theQuery->theResponses;
+  delete [] theQuery->args;
+  delete theQuery;
+}
+
+void
+Domain::freeResponseQueries(void)
+{
+  if (responseQueries == 0)
+    return;
+
+  for (int i=0; i<maxResponseQueries; i++)
+    if (responseQueries[i] != 0)
+      deleteResponseQuery(responseQueries[i]);
+  delete [] responseQueries;
+  responseQueries = 0;
+  nextResponseQuery = 0;
+}
+
+int
+Domain::getElementResponses(const ID &eleTags, const char **argv, int argc,
+			    Vector &result)
+{
+  int numEles = eleTags.Size();
+
+  // the resisting forces and the node tags are got from the elements
+  // directly as in getElementResponse()
+  if (argc == 1 && (strcmp(argv[0],"forces") == 0 || strcmp(argv[0],"nodeTags") == 0)) {
+    bool forces = strcmp(argv[0],"forces") == 0;
+    int numValues = 0;
+    for (int i=0; i<numEles; i++) {
+      Element *theEle = this->getElement(eleTags(i));
+      if (theEle == 0) {
+	opserr << "WARNING Domain::getElementResponses() - no element " << eleTags(i) << endln;
+	return -1;
+      }
+      numValues += forces ? theEle->getResistingForce().Size() : theEle->getNumExternalNodes();
+    }
+
+    if (result.Size() != numValues)
+      result.resize(numValues);
+
+    int loc = 0;
+    for (int i=0; i<numEles; i++) {
+      Element *theEle = this->getElement(eleTags(i));
+      if (forces) {
+	const Vector &theForce = theEle->getResistingForce();
+	for (int j=0; j<theForce.Size(); j++)
+	  result(loc++) = theForce(j);
+      } else {
+	const ID &theNodes = theEle->getExternalNodes();
+	for (int j=0; j<theNodes.Size(); j++)
+	  result(loc++) = theNodes(j);
+      }
+    }
+    return numValues;
+  }
+
+  int argsLength = 0;
+  for (int i=0; i<argc; i++)
+    argsLength += strlen(argv[i])+1;
+
+  // look for the Responses of the same query, they are set up again
+  // only after the domain changes
+  ElementResponseQuery *theQuery = 0;
+  if (responseQueries != 0) {
+    for (int i=0; i<maxResponseQueries && theQuery == 0; i++) {
+      ElementResponseQuery *query = responseQueries[i];
+      if (query == 0 || query->argsLength != argsLength || query->eleTags.Size() != numEles)
+	continue;
+      const char *args = query->args;
+      int j = 0;
+      for (; j<argc; j++) {
+	if (strcmp(args, argv[j]) != 0)
+	  break;
+	args += strlen(argv[j])+1;
+      }
+      if (j < argc)
+	continue;
+      for (j=0; j<numEles; j++)
+	if (query->eleTags(j) != eleTags(j))
+	  break;
+      if (j == numEles)
+	theQuery = query;
+    }
+  }
+
+  if (theQuery == 0) {
+    theQuery = new ElementResponseQuery;
+    theQuery->argsLength = argsLength;
+    theQuery->args = new char[argsLength > 0 ? argsLength : 1];
+    char *args = theQuery->args;
+    for (int i=0; i<argc; i++) {
+      strcpy(args, argv[i]);
+      args += strlen(argv[i])+1;
+    }
+    theQuery->eleTags = eleTags;
+    theQuery->theResponses = new Response *[numEles];
+
+    DummyStream dummy;
+    for (int i=0; i<numEles; i++) {
+      Element *theEle = this->getElement(eleTags(i));
+      theQuery->theResponses[i] = 0;
+      if (theEle == 0)
+	opserr << "WARNING Domain::getElementResponses() - no element " << eleTags(i) << endln;
+      else if ((theQuery->theResponses[i] = theEle->setResponse(argv, argc, dummy)) == 0)
+	opserr << "WARNING Domain::getElementResponses() - no such response for element " << eleTags(i) << endln;
+      if (theQuery->theResponses[i] == 0) {
+	for (int j=i+1; j<numEles; j++)
+	  theQuery->theResponses[j] = 0;
+	deleteResponseQuery(theQuery);
+	return -1;
+      }
+    }
+
+    if (responseQueries == 0) {
+      responseQueries = new ElementResponseQuery *[maxResponseQueries];
+      for (int i=0; i<maxResponseQueries; i++)
+	responseQueries[i] = 0;
+    }
+    if (responseQueries[nextResponseQuery] != 0)
+      deleteResponseQuery(responseQueries[nextResponseQuery]);
+    responseQueries[nextResponseQuery] = theQuery;
+    nextResponseQuery = (nextResponseQuery+1) % maxResponseQueries;
+  }
+
+  int numValues = 0;
+  for (int i=0; i<numEles; i++) {
+    Response *theResponse = theQuery->theResponses[i];
+    if (theResponse->getResponse() < 0) {
+      opserr << "WARNING Domain::getElementResponses() - failed to get the response of element " << eleTags(i) << endln;
+      return -1;
+    }
+    numValues += theResponse->getInformation().getData().Size();
+  }
+
+  if (result.Size() != numValues)
+    result.resize(numValues);
+
+  int loc = 0;
+  for (int i=0; i<numEles; i++) {
+    const Vector &theData = theQuery->theResponses[i]->getInformation().getData();
+    for (int j=0; j<theData.Size(); j++)
+      result(loc++) = theData(j);
+  }
+
+  return numValues;
+}
+
+
 Graph  &
 Domain::getElementGraph(void)
 {
@@ -1860,10 +2401,17 @@ Domain::record(bool fromAnalysis)
 {
   int res = 0;
 
-  // invoke record on all recorders
+  // invoke record on all recorders, sharing the element responses
+  // and the nodal reactions
+  ElementResponse::startSharing();
+  recordingReactions = true;
+  reactionFlag = -1;
+  damageIndex = 0.0;
   for (int i=0; i<numRecorders; i++)
     if (theRecorders[i] != 0)
       res += theRecorders[i]->record(commitTag, currentTime);
+  recordingReactions = false;
+  ElementResponse::stopSharing();
   
   // update the commitTag
   commitTag++;
@@ -1871,38 +2419,115 @@ Domain::record(bool fromAnalysis)
   return res;
 }
 
+// the number of threads for a pass over num nodes or elements, 1 unless
+// the domain passes are threaded with ThreadPool::setDomainThreaded()
+static int
+getNumPassThreads(int num)
+{
+  if (ThreadPool::isDomainThreaded() == false || num < 2)
+    return 1;
+  int numT = ThreadPool::getNumThreads();
+  return (numT > 1) ? numT : 1;
+}
+
 int
 Domain::commit(void)
 {
+    Profiler::begin(PROFILE_COMMIT);
+
     // 
-    // first invoke commit on all nodes and elements in the domain
+    // first invoke commit on all nodes and elements in the domain, on the
+    // threads if asked for; the nodes and elements are independent
     //
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0) {
-      nodePtr->commitState();
+    const OPS_ThreadGlobals theGlobals;
+    if (this->ownsNodalState() == true)
+      NodalState::commitState();
+    else {
+      ComponentRange<Node> theNodeRange = this->getNodeRange();
+      int numNodes = theNodeRange.size();
+#ifdef _OPENMP
+      int numT = getNumPassThreads(numNodes);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(numT) if(numT > 1)
+#endif
+      for (int i=0; i<numNodes; i++)
+	theNodeRange[i]->commitState();
     }
 
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-      elePtr->commitState();
+    ComponentRange<Element> theEleRange = this->getElementRange();
+    int numEles = theEleRange.size();
+#ifdef _OPENMP
+    int numT = getNumPassThreads(numEles);
+#pragma omp parallel for schedule(dynamic, 16) num_threads(numT) if(numT > 1)
+#endif
+    for (int i=0; i<numEles; i++) {
+      theGlobals.set();
+      Element *elePtr = theEleRange[i];
+      if (elePtr->isActive() == true)
+	elePtr->commitState();
     }
 
     // set the new committed time in the domain
     committedTime = currentTime;
     dT = 0.0;
 
+    Profiler::end(PROFILE_COMMIT);
+
     // invoke record on all recorders
+    Profiler::begin(PROFILE_RECORD);
+    ElementResponse::startSharing();
+    recordingReactions = true;
+    reactionFlag = -1;
+    damageIndex = 0.0;
     for (int i=0; i<numRecorders; i++)
       if (theRecorders[i] != 0)
 	theRecorders[i]->record(commitTag, currentTime);
+    recordingReactions = false;
+    ElementResponse::stopSharing();
+    Profiler::end(PROFILE_RECORD);
 
     // update the commitTag
     commitTag++;
+
+    // halt the analysis once the damage limit is reached
+    if (damageLimit > 0.0 && damageIndex >= damageLimit) {
+      opserr << "Domain::commit - damage index " << damageIndex 
+	     << " reached the damage limit " << damageLimit 
+	     << " at time " << committedTime << endln;
+      return -1;
+    }
+
     return 0;
 }
 
+void
+Domain::updateDamageIndex(double index)
+{
+  if (index > damageIndex)
+    damageIndex = index;
+}
+
+double
+Domain::getDamageIndex(void)
+{
+  return damageIndex;
+}
+
+void
+Domain::setDamageLimit(double limit)
+{
+  damageLimit = limit;
+}
+
+// true if the response of all the nodes in the domain, and of no other,
+// is in NodalState, so that it can be committed as a whole
+bool
+Domain::ownsNodalState(void)
+{
+  int numNodes = theNodes->getNumComponents();
+  return (numNodes > 0 && numNodalStateNodes == numNodes &&
+	  NodalState::getNumNodes() == numNodes);
+}
+
 int
 Domain::revertToLastCommit(void)
 {
@@ -1910,15 +2535,29 @@ Domain::revertToLastCommit(void)
     // first invoke revertToLastCommit  on all nodes and elements in the domain
     //
     
-    Node *nodePtr;
-    NodeIter &theNodeIter = this->getNodes();
-    while ((nodePtr = theNodeIter()) != 0)
-	nodePtr->revertToLastCommit();
+    const OPS_ThreadGlobals theGlobals;
+    if (this->ownsNodalState() == true)
+      NodalState::revertToLastCommit();
+    else {
+      ComponentRange<Node> theNodeRange = this->getNodeRange();
+      int numNodes = theNodeRange.size();
+#ifdef _OPENMP
+      int numT = getNumPassThreads(numNodes);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(numT) if(numT > 1)
+#endif
+      for (int i=0; i<numNodes; i++)
+	theNodeRange[i]->revertToLastCommit();
+    }
     
-    Element *elePtr;
-    ElementIter &theElemIter = this->getElements();    
-    while ((elePtr = theElemIter()) != 0) {
-	elePtr->revertToLastCommit();
+    ComponentRange<Element> theEleRange = this->getElementRange();
+    int numEles = theEleRange.size();
+#ifdef _OPENMP
+    int numT = getNumPassThreads(numEles);
+#pragma omp parallel for schedule(dynamic, 16) num_threads(numT) if(numT > 1)
+#endif
+    for (int i=0; i<numEles; i++) {
+      theGlobals.set();
+      theEleRange[i]->revertToLastCommit();
     }
 
     // set the current time and load factor in the domain to last committed
@@ -1961,6 +2600,7 @@ Domain::revertToStart(void)
     committedTime = 0;
     currentTime = 0;
     dT = 0.0;
+    damageIndex = 0.0;
     // apply load for the last committed time
     this->applyLoad(currentTime);
 
@@ -1976,15 +2616,54 @@ Domain::update(void)
 
   int ok = 0;
 
+  Profiler::begin(PROFILE_UPDATE);
+
   // invoke update on all the ele's
   ElementIter &theEles = this->getElements();
   Element *theEle;
 
-  while ((theEle = theEles()) != 0) {
-    ops_TheActiveElement = theEle;
-    ok += theEle->update();
+  ComponentRange<Element> theEleRange;
+  int numT = 1;
+  if (Profiler::active == false) {
+    theEleRange = this->getElementRange();
+    numT = getNumPassThreads(theEleRange.size());
   }
 
+  if (numT > 1) {
+    // the threads update the elements, each with its own active element
+    int numEles = theEleRange.size();
+    const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(numT) reduction(+:ok)
+#endif
+    for (int i=0; i<numEles; i++) {
+      theGlobals.set();
+      Element *theThreadEle = theEleRange[i];
+      if (theThreadEle->isActive() == false)
+	continue;
+      ops_TheActiveElement = theThreadEle;
+      ok += theThreadEle->update();
+    }
+  } else if (Profiler::active == false) {
+    while ((theEle = theEles()) != 0) {
+      // inactive elements are left out of the state determination
+      if (theEle->isActive() == false)
+	continue;
+      ops_TheActiveElement = theEle;
+      ok += theEle->update();
+    }
+  } else {
+    // profiler times each element class
+    while ((theEle = theEles()) != 0) {
+      if (theEle->isActive() == false)
+	continue;
+      ops_TheActiveElement = theEle;
+      ok += Profiler::update(*theEle);
+    }
+  }
+
+  Profiler::end(PROFILE_UPDATE);
+
   if (ok != 0)
     opserr << "Domain::update - domain failed in update\n";
 
@@ -2143,6 +2822,13 @@ void
 Domain::domainChange(void)
 {
     hasDomainChangedFlag = true;
+
+    eleRangeValid = false;
+    nodRangeValid = false;
+
+    // the nodes and elements connected to them are found again
+    this->freeReactionNodes();
+    this->freeResponseQueries();
 }
 
 
@@ -2348,172 +3034,82 @@ Domain::getRegionTags(ID& rtags) const
 
 }
 
-typedef map<int, int> MAP_INT;
-typedef MAP_INT::value_type   MAP_INT_TYPE;
-typedef MAP_INT::iterator     MAP_INT_ITERATOR;
-
-typedef map<int, ID *> MAP_ID;
-typedef MAP_ID::value_type   MAP_ID_TYPE;
-typedef MAP_ID::iterator     MAP_ID_ITERATOR;
+// int formEleGraph(Graph *theEleGraph, TaggedObjectIter &theEles);
+// Adds a vertex for each element given by theEles to theEleGraph, with
+// a reference equal to the element tag, and an edge between each pair of
+// elements that share a node. Instead of keeping a list of the elements
+// of each node in a map, the (node, element) pairs of the element
+// connectivity are sorted, which places the elements of each node next to
+// each other, and the edges are formed once each, sorted, so that each
+// edge is appended to the end of the adjacency of its two vertices.
 
-
-int 
-Domain::buildEleGraph(Graph *theEleGraph)
+int
+Domain::formEleGraph(Graph *theEleGraph, TaggedObjectIter &theEles)
 {
-   // see if quick return
-    int numVertex = this->getNumElements();
-    if (numVertex == 0)
-        return 0;
-
-    //
-    // iterate over the lements of the domain
-    //  create a vertex with a unique tag for each element
-    //  also create a map to hold element tag - vertex tag mapping
-    //
-
-    MAP_INT theEleToVertexMap;
-    MAP_INT_ITERATOR theEleToVertexMapEle;
-
-    Element *theEle;
-    ElementIter &theElements = this->getElements();
-    int count = START_VERTEX_NUM;
-    while ((theEle = theElements()) != 0) {
-      int eleTag = theEle->getTag();
-      Vertex *vertexPtr = new Vertex(count, eleTag);
-
-      if (vertexPtr == 0) {
-        opserr << "WARNING Domain::buildEleGraph - Not Enough Memory to create the " << count << " vertex\n";
-        return -1;
-      }
-
-      theEleGraph->addVertex(vertexPtr);
-      theEleToVertexMapEle = theEleToVertexMap.find(eleTag);
-      if (theEleToVertexMapEle == theEleToVertexMap.end()) {
-        theEleToVertexMap.insert(MAP_INT_TYPE(eleTag, count));
-
-        // check if sucessfully added
-        theEleToVertexMapEle = theEleToVertexMap.find(eleTag);
-        if (theEleToVertexMapEle == theEleToVertexMap.end()) {
-          opserr << "Domain::buildEleGraph - map STL failed to add object with tag : " << eleTag << endln;
-          return false;
-        }
-
-        count++;
-      }
+    std::vector<Element *> theEleList;
+    std::vector<std::pair<int,int> > nodeEles;
+
+    TaggedObject *theObject;
+    while ((theObject = theEles()) != 0) {
+      Element *theEle = (Element *)theObject;
+      const ID &theNodes = theEle->getExternalNodes();
+      int eleIndex = theEleList.size();
+      for (int i=0; i<theNodes.Size(); i++)
+	nodeEles.push_back(std::pair<int,int>(theNodes(i), eleIndex));
+      theEleList.push_back(theEle);
     }
 
-    //
-    // We now need to determine which elements are asssociated with each node.
-    // As this info is not in the Node interface we must build it;
-    //
-    // again we will use an stl map, index will be nodeTag, object will be Vertex
-    // do using vertices for each node, when we addVertex at thes nodes we
-    // will not be adding vertices but element tags.
-    //
-
-    MAP_ID theNodeToVertexMap;
-    MAP_ID_ITERATOR theNodeEle;
-
-    Node *nodPtr;
-
-    // now create the vertices with a reference equal to the node number.
-    // and a tag which ranges from 0 through numVertex-1 and placed in
-    // theNodeTagVertices at a position equal to the node's tag.
-
-    NodeIter &theNodes = this->getNodes();
-    while ((nodPtr = theNodes()) != 0) {
-      int nodeTag = nodPtr->getTag();
-      ID *eleTags = new ID(0, 4);
-
-      if (eleTags == 0) {
-        opserr << "WARNING Domain::buildEleGraph - Not Enough Memory to create the " << count << " vertex\n";
-        return -1;
-      }
+    // create a vertex for each element, the vertex tags range from
+    // START_VERTEX_NUM through numEle-1+START_VERTEX_NUM
 
-      theNodeEle = theNodeToVertexMap.find(nodeTag);
-      if (theNodeEle == theNodeToVertexMap.end()) {
-        theNodeToVertexMap.insert(MAP_ID_TYPE(nodeTag, eleTags));
-
-        // check if sucessfully added
-        theNodeEle = theNodeToVertexMap.find(nodeTag);
-        if (theNodeEle == theNodeToVertexMap.end()) {
-          opserr << "Domain::buildEleGraph - map STL failed to add object with tag : " << nodeTag << endln;
-          return false;
-        }
+    int numEle = theEleList.size();
+    for (int i=0; i<numEle; i++) {
+      Vertex *vertexPtr = new Vertex(i+START_VERTEX_NUM, theEleList[i]->getTag());
+      if (vertexPtr == 0) {
+	opserr << "WARNING Domain::buildEleGraph - Not Enough Memory to create the " << i << " vertex\n";
+	return -1;
       }
+      theEleGraph->addVertex(vertexPtr, false);
     }
 
-    // now add the the Elements to the node vertices
-
-    ElementIter &eleIter3 = this->getElements();
-
-    while((theEle = eleIter3()) != 0) {
-      int eleTag = theEle->getTag();
-      const ID &id = theEle->getExternalNodes();
-
-      int size = id.Size();
-      for (int i=0; i<size; i++) {
-        int nodeTag = id(i);
-
-        MAP_ID_ITERATOR theNodeEle;
-        theNodeEle = theNodeToVertexMap.find(nodeTag);
-        if (theNodeEle == theNodeToVertexMap.end()) {
-          return -1;
-        } else {
-          ID *theNodeEleTags = (*theNodeEle).second;
-          theNodeEleTags->insert(eleTag);
-        }
-      }
+    // the elements of a node are now consecutive and in ascending order,
+    // each pair of them is an edge
+
+    std::sort(nodeEles.begin(), nodeEles.end());
+
+    std::vector<std::pair<int,int> > edges;
+    size_t numPairs = nodeEles.size();
+    size_t first = 0;
+    while (first < numPairs) {
+      size_t last = first+1;
+      while (last < numPairs && nodeEles[last].first == nodeEles[first].first)
+	last++;
+      for (size_t i=first; i<last; i++)
+	for (size_t j=i+1; j<last; j++)
+	  if (nodeEles[i].second != nodeEles[j].second)
+	    edges.push_back(std::pair<int,int>(nodeEles[i].second, nodeEles[j].second));
+      first = last;
     }
 
-    //
-    // now add the edges to the vertices of our element graph;
-    // this is done by looping over the Node vertices, getting their
-    // Adjacenecy and adding edges between elements with common nodes
-    //
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 
-    MAP_ID_ITERATOR currentComponent;
-    currentComponent = theNodeToVertexMap.begin();
-    while (currentComponent != theNodeToVertexMap.end()) {
-      ID *id = (*currentComponent).second;
-
-      int size = id->Size();
-      for (int i=0; i<size; i++) {
-        int eleTag1 = (*id)(i);
-
-        theEleToVertexMapEle = theEleToVertexMap.find(eleTag1);
-        if (theEleToVertexMapEle != theEleToVertexMap.end()) {
-          int vertexTag1 = (*theEleToVertexMapEle).second;
-
-          for (int j=0; j<size; j++)
-            if (i != j) {
-	      int eleTag2 = (*id)(j);
-              theEleToVertexMapEle = theEleToVertexMap.find(eleTag2);
-              if (theEleToVertexMapEle != theEleToVertexMap.end()) {
-                int vertexTag2 = (*theEleToVertexMapEle).second;
-
-                // addEdge() adds for both vertices - do only once
-
-                if (vertexTag1 > vertexTag2) {
-                  theEleGraph->addEdge(vertexTag1,vertexTag2);
-		  theEleGraph->addEdge(vertexTag2,vertexTag1);
-		}
-              }
-            }
-        }
-      }
-      currentComponent++;
-    }
-
-    // clean up - delete the ID's associated with the nodes
-    currentComponent = theNodeToVertexMap.begin();
-    while (currentComponent != theNodeToVertexMap.end()) {
-      delete (*currentComponent).second;
-      currentComponent++;
-    }
+    for (size_t i=0; i<edges.size(); i++)
+      if (theEleGraph->addEdge(edges[i].first+START_VERTEX_NUM,
+			       edges[i].second+START_VERTEX_NUM) < 0)
+	return -1;
 
     return 0;
+}
 
+int 
+Domain::buildEleGraph(Graph *theEleGraph)
+{
+    // see if quick return
+    if (this->getNumElements() == 0)
+        return 0;
+
+    return this->formEleGraph(theEleGraph, theElements->getComponents());
 }
 
 int
@@ -2525,13 +3121,15 @@ Domain::buildNodeGraph(Graph *theNodeGraph)
 	return 0;
     }	
 	
-    Node *nodPtr;
-    MAP_INT theNodeTagVertices;
-
     // now create the vertices with a reference equal to the node number.
     // and a tag which ranges from START_VERTEX_NUM through 
-    // numNodes+START_VERTEX_NUM
+    // numNodes+START_VERTEX_NUM; the vertex of a node is found from
+    // the node tags sorted with their vertex tags
+
+    std::vector<std::pair<int,int> > theNodeTagVertices;
+    theNodeTagVertices.reserve(numVertex);
 
+    Node *nodPtr;
     NodeIter &nodeIter2 = this->getNodes();
     int count = START_VERTEX_NUM;
     while ((nodPtr = nodeIter2()) != 0) {
@@ -2546,13 +3144,19 @@ Domain::buildNodeGraph(Graph *theNodeGraph)
 	}
 
 	// add the vertex to the graph
-	theNodeGraph->addVertex(vertexPtr);
-	theNodeTagVertices[nodeTag] = count++;
+	theNodeGraph->addVertex(vertexPtr, false);
+	theNodeTagVertices.push_back(std::pair<int,int>(nodeTag, count++));
     }
 
-    // now add the edges, by looping over the Elements, getting their
-    // IDs and adding edges between all elements who share a node.
-    
+    std::sort(theNodeTagVertices.begin(), theNodeTagVertices.end());
+
+    // now form the edges, by looping over the Elements, getting their
+    // IDs and adding edges between all nodes of an element; each edge
+    // is then added once
+
+    std::vector<std::pair<int,int> > edges;
+    std::vector<int> vertexTags;
+
     Element *elePtr;
     ElementIter &eleIter = this->getElements();
 
@@ -2560,22 +3164,28 @@ Domain::buildNodeGraph(Graph *theNodeGraph)
 	const ID &id = elePtr->getExternalNodes();
 
 	int size = id.Size();
+	vertexTags.clear();
 	for (int i=0; i<size; i++) {
-	    int node1 = id(i);
-	    int vertexTag1 = theNodeTagVertices[node1];
-	    
-	    for (int j=0; j<size; j++) 
-		if (i != j) {
-
-		    int node2 = id(j);
-		    int vertexTag2 = theNodeTagVertices[node2];
-		    
-		    // addEdge() adds for both vertices - do only once
-		    if (vertexTag1 > vertexTag2) 
-			theNodeGraph->addEdge(vertexTag1,vertexTag2);
-		}
+	    std::vector<std::pair<int,int> >::iterator theNode =
+	      std::lower_bound(theNodeTagVertices.begin(), theNodeTagVertices.end(),
+			       std::pair<int,int>(id(i), START_VERTEX_NUM-1));
+	    if (theNode != theNodeTagVertices.end() && theNode->first == id(i))
+		vertexTags.push_back(theNode->second);
 	}
+
+	for (size_t i=0; i<vertexTags.size(); i++)
+	    for (size_t j=0; j<vertexTags.size(); j++)
+		if (vertexTags[i] > vertexTags[j])
+		    edges.push_back(std::pair<int,int>(vertexTags[j], vertexTags[i]));
     }
+
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    for (size_t i=0; i<edges.size(); i++)
+	if (theNodeGraph->addEdge(edges[i].first, edges[i].second) < 0)
+	    return -1;
+
     return 0;
 }
 
@@ -3036,7 +3646,8 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 
       // now for each node we 1) get a new node of the correct type from the ObjectBroker
       // 2) ensure the node exists and set it's dbTag, 3) we invoke recvSelf on this new 
-      // blank node and 4) add this node to the domain
+      // blank node and 4) add the nodes to the domain together
+      Node **theNodes = new Node *[numNod];
       loc = 0;
       for (i=0; i<numNod; i++) {
 	int classTag = nodeData(loc);
@@ -3046,6 +3657,7 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 
 	if (theNode == 0) {
 	  opserr << "Domain::recv - cannot create node with classTag " << classTag << endln;
+	  delete [] theNodes;
 	  return -2;
 	}			
 
@@ -3053,16 +3665,21 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
       
 	if (theNode->recvSelf(commitTag, theChannel, theBroker) < 0) {
 	  opserr << "Domain::recv - node with dbTag " << dbTag << " failed in recvSelf\n";
+	  delete [] theNodes;
 	  return -2;
 	}			
 
-	if (this->addNode(theNode) == false) {
-	  opserr << "Domain::recv - could not add node with tag " << theNode->getTag() << " into domain\n!";
-	  return -3;
-	}			
-
+	theNodes[i] = theNode;
 	loc+=2;
       }
+
+      int numAdded = this->addNodes(theNodes, numNod);
+      if (numAdded < numNod) {
+	opserr << "Domain::recv - could not add node with tag " << theNodes[numAdded]->getTag() << " into domain\n!";
+	delete [] theNodes;
+	return -3;
+      }			
+      delete [] theNodes;
     }
 
     // 
@@ -3080,6 +3697,7 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 	return -2;
       }
 
+      Element **theEles = new Element *[numEle];
       loc = 0;
       for (i=0; i<numEle; i++) {
 	int classTag = eleData(loc);
@@ -3088,22 +3706,28 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 	Element *theEle = theBroker.getNewElement(classTag);
 	if (theEle == 0) {
 	  opserr << "Domain::recv - cannot create element with classTag " << classTag << endln;
+	  delete [] theEles;
 	  return -2;
 	}			
 	theEle->setDbTag(dbTag);
       
 	if (theEle->recvSelf(commitTag, theChannel, theBroker) < 0) {
 	  opserr << "Domain::recv - Ele with dbTag " << dbTag << " failed in recvSelf()\n";
+	  delete [] theEles;
 	  return -2;
 	}			
 
-	if (this->addElement(theEle) == false) {
-	  opserr << "Domain::recv - could not add Ele with tag " << theEle->getTag() << " into domain!\n";
-	  return -3;
-	}			
-
+	theEles[i] = theEle;
 	loc+=2;
       }
+
+      int numAdded = this->addElements(theEles, numEle);
+      if (numAdded < numEle) {
+	opserr << "Domain::recv - could not add Ele with tag " << theEles[numAdded]->getTag() << " into domain!\n";
+	delete [] theEles;
+	return -3;
+      }			
+      delete [] theEles;
     }
 
     // 
@@ -3120,6 +3744,7 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 	return -2;
       }
 
+      SP_Constraint **theSPs = new SP_Constraint *[numSPs];
       loc = 0;
       for (i=0; i<numSPs; i++) {
 	int classTag = spData(loc);
@@ -3128,22 +3753,28 @@ Domain::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 	SP_Constraint *theSP = theBroker.getNewSP(classTag);
 	if (theSP == 0) {
 	  opserr << "Domain::recv - cannot create SP_Constraint with classTag " << classTag << endln;
+	  delete [] theSPs;
 	  return -2;
 	}			
 	theSP->setDbTag(dbTag);
       
 	if (theSP->recvSelf(commitTag, theChannel, theBroker) < 0) {
 	  opserr << "Domain::recv - SP_Constraint with dbTag " << dbTag << " failed in recvSelf\n";
+	  delete [] theSPs;
 	  return -2;
 	}			
 
-	if (this->addSP_Constraint(theSP) == false) {
-	  opserr << "Domain::recv - could not add SP_Constraint with tag " << theSP->getTag() << " into domain!\n";
-	  return -3;
-	}			
-
+	theSPs[i] = theSP;
 	loc+=2;
       }
+
+      int numAdded = this->addSP_Constraints(theSPs, numSPs);
+      if (numAdded < numSPs) {
+	opserr << "Domain::recv - could not add SP_Constraint with tag " << theSPs[numAdded]->getTag() << " into domain!\n";
+	delete [] theSPs;
+	return -3;
+      }			
+      delete [] theSPs;
     }
 
 
@@ -3424,6 +4055,9 @@ Domain::setMass(const Matrix &mass, int nodeTag)
 int
 Domain::calculateNodalReactions(int flag)
 {
+  // while the recorders record the reactions are formed once for all
+  if (recordingReactions == true && reactionFlag == flag && allReactions == true)
+    return 0;
 
   // apply load again! (for case ele load removed and record before an analysis)
   this->applyLoad(committedTime);
@@ -3435,9 +4069,375 @@ Domain::calculateNodalReactions(int flag)
     theNode->resetReactionForce(flag);
   }
 
+  // an inactive element carries no force
   ElementIter &theElements = this->getElements();
   while ((theElement = theElements()) != 0)
-    if (theElement->isSubdomain() == false)
+    if (theElement->isSubdomain() == false && theElement->isActive() == true)
       theElement->addResistingForceToNodalReaction(flag);
+
+  reactionFlag = flag;
+  allReactions = true;
+  return 0;
+}
+
+
+static int
+compareReactionNodeTags(const void *a, const void *b)
+{
+  int tagA = *(const int *)a;
+  int tagB = *(const int *)b;
+  return (tagA < tagB) ? -1 : ((tagA > tagB) ? 1 : 0);
+}
+
+static int
+findReactionNode(const int *tags, int numTags, int tag)
+{
+  int left = 0;
+  int right = numTags-1;
+  while (left <= right) {
+    int middle = (left+right)/2;
+    if (tags[middle] == tag)
+      return middle;
+    else if (tags[middle] < tag)
+      left = middle+1;
+    else
+      right = middle-1;
+  }
+  return -1;
+}
+
+int
+Domain::buildReactionNodes(void)
+{
+  this->freeReactionNodes();
+
+  numReactionNodes = this->getNumNodes();
+  if (numReactionNodes == 0) {
+    reactionNodesBuilt = true;
+    return 0;
+  }
+
+  reactionNodeTags = new int[numReactionNodes];
+  reactionNodePtrs = new Node *[numReactionNodes];
+  reactionNodeStart = new int[numReactionNodes+1];
+  reactionNodeStamp = new int[numReactionNodes];
+  reactionFormed = new int[numReactionNodes];
+
+  Node *theNode;
+  NodeIter &theNodes = this->getNodes();
+  int numNodes = 0;
+  while ((theNode = theNodes()) != 0 && numNodes < numReactionNodes)
+    reactionNodeTags[numNodes++] = theNode->getTag();
+  numReactionNodes = numNodes;
+  qsort(reactionNodeTags, numReactionNodes, sizeof(int), compareReactionNodeTags);
+  for (int i=0; i<numReactionNodes; i++) {
+    reactionNodePtrs[i] = this->getNode(reactionNodeTags[i]);
+    reactionNodeStart[i] = 0;
+    reactionNodeStamp[i] = 0;
+  }
+  reactionNodeStart[numReactionNodes] = 0;
+
+  // count the elements at each node, then list them
+  Element *theElement;
+  numReactionEles = 0;
+  ElementIter &theElements = this->getElements();
+  while ((theElement = theElements()) != 0) {
+    if (theElement->isSubdomain() == true)
+      continue;
+    numReactionEles++;
+    const ID &eleNodes = theElement->getExternalNodes();
+    for (int j=0; j<eleNodes.Size(); j++) {
+      int loc = findReactionNode(reactionNodeTags, numReactionNodes, eleNodes(j));
+      if (loc >= 0)
+	reactionNodeStart[loc+1]++;
+    }
+  }
+  for (int i=0; i<numReactionNodes; i++)
+    reactionNodeStart[i+1] += reactionNodeStart[i];
+
+  reactionEles = new Element *[numReactionEles > 0 ? numReactionEles : 1];
+  reactionElePass = new int[numReactionEles > 0 ? numReactionEles : 1];
+  reactionNodeEles = new int[reactionNodeStart[numReactionNodes] > 0 ? reactionNodeStart[numReactionNodes] : 1];
+
+  int *next = new int[numReactionNodes];
+  for (int i=0; i<numReactionNodes; i++)
+    next[i] = reactionNodeStart[i];
+
+  int numEles = 0;
+  ElementIter &theElements2 = this->getElements();
+  while ((theElement = theElements2()) != 0 && numEles < numReactionEles) {
+    if (theElement->isSubdomain() == true)
+      continue;
+    reactionEles[numEles] = theElement;
+    reactionElePass[numEles] = 0;
+    const ID &eleNodes = theElement->getExternalNodes();
+    for (int j=0; j<eleNodes.Size(); j++) {
+      int loc = findReactionNode(reactionNodeTags, numReactionNodes, eleNodes(j));
+      if (loc >= 0)
+	reactionNodeEles[next[loc]++] = numEles;
+    }
+    numEles++;
+  }
+  delete [] next;
+
+  reactionNodesBuilt = true;
   return 0;
 }
+
+void
+Domain::freeReactionNodes(void)
+{
+  if (reactionNodeTags != 0)
+    delete [] reactionNodeTags;
+  if (reactionNodePtrs != 0)
+    delete [] reactionNodePtrs;
+  if (reactionNodeStart != 0)
+    delete [] reactionNodeStart;
+  if (reactionNodeEles != 0)
+    delete [] reactionNodeEles;
+  if (reactionEles != 0)
+    delete [] reactionEles;
+  if (reactionNodeStamp != 0)
+    delete [] reactionNodeStamp;
+  if (reactionElePass != 0)
+    delete [] reactionElePass;
+  if (reactionFormed != 0)
+    delete [] reactionFormed;
+
+  reactionNodeTags = 0;
+  reactionNodePtrs = 0;
+  reactionNodeStart = 0;
+  reactionNodeEles = 0;
+  reactionEles = 0;
+  reactionNodeStamp = 0;
+  reactionElePass = 0;
+  reactionFormed = 0;
+  numReactionNodes = 0;
+  numReactionEles = 0;
+  numReactionFormed = 0;
+  reactionNodesBuilt = false;
+
+  // any reactions formed in the current record are formed again
+  reactionFlag = -1;
+}
+
+// the reactions of the nodes in nodeTags only, found from the elements
+// connected to them; while the recorders record the nodes whose
+// reactions are formed are kept, so that those asked for by another
+// recorder are not formed again
+int
+Domain::calculateNodalReactions(int flag, const ID &nodeTags)
+{
+  if (reactionNodesBuilt == false)
+    this->buildReactionNodes();
+
+  bool shared = (recordingReactions == true && reactionFlag == flag);
+  if (shared == true && allReactions == true)
+    return 0;
+
+  if (shared == false) {
+    // apply load again! (for case ele load removed and record before an analysis)
+    this->applyLoad(committedTime);
+    reactionFlag = flag;
+    allReactions = false;
+    reactionStamp++;
+    numReactionFormed = 0;
+  }
+
+  int numFormed = numReactionFormed;
+  for (int i=0; i<nodeTags.Size(); i++) {
+    int loc = findReactionNode(reactionNodeTags, numReactionNodes, nodeTags(i));
+    if (loc >= 0 && reactionNodeStamp[loc] != reactionStamp) {
+      reactionNodeStamp[loc] = reactionStamp;
+      reactionFormed[numReactionFormed++] = loc;
+    }
+  }
+  if (shared == true && numReactionFormed == numFormed)
+    return 0;
+
+  // the elements of the new nodes also add to the nodes formed before,
+  // so the reactions of all of them are formed again
+  for (int i=0; i<numReactionFormed; i++)
+    reactionNodePtrs[reactionFormed[i]]->resetReactionForce(flag);
+
+  reactionPass++;
+  for (int i=0; i<numReactionFormed; i++) {
+    int loc = reactionFormed[i];
+    for (int j=reactionNodeStart[loc]; j<reactionNodeStart[loc+1]; j++) {
+      int ele = reactionNodeEles[j];
+      if (reactionElePass[ele] != reactionPass) {
+	reactionElePass[ele] = reactionPass;
+	if (reactionEles[ele]->isActive() == true)
+	  reactionEles[ele]->addResistingForceToNodalReaction(flag);
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+// the nodes in order of their tags with the location of their first dof,
+// for the lookup of the dof of the elements in getCriticalTimeStep()
+struct CriticalStepNode {
+  int tag;
+  int loc;
+};
+
+static int
+compareCriticalStepNodes(const void *a, const void *b)
+{
+  int tagA = ((const CriticalStepNode *)a)->tag;
+  int tagB = ((const CriticalStepNode *)b)->tag;
+  return (tagA < tagB) ? -1 : ((tagA > tagB) ? 1 : 0);
+}
+
+// the elements are asked for their sums in blocks of this many, so that
+// the vectors of only one block are held at a time
+#define CRITICAL_STEP_BLOCK 4096
+
+double
+Domain::getCriticalTimeStep(bool initial)
+{
+  // the dof of the nodes, with the nodal mass on the diagonal
+  int numNodes = this->getNumNodes();
+  if (numNodes == 0)
+    return 0.0;
+
+  CriticalStepNode *theNodeLocs = new CriticalStepNode[numNodes];
+  int numDOF = 0;
+  int count = 0;
+  Node *theNode;
+  NodeIter &theNodes = this->getNodes();
+  while ((theNode = theNodes()) != 0 && count < numNodes) {
+    theNodeLocs[count].tag = theNode->getTag();
+    theNodeLocs[count].loc = numDOF;
+    numDOF += theNode->getNumberDOF();
+    count++;
+  }
+  numNodes = count;
+  qsort(theNodeLocs, numNodes, sizeof(CriticalStepNode), compareCriticalStepNodes);
+
+  double *stiffSum = new double[numDOF];
+  double *massSum = new double[numDOF];
+  bool *isFixed = new bool[numDOF];
+  for (int i=0; i<numDOF; i++) {
+    stiffSum[i] = 0.0;
+    massSum[i] = 0.0;
+    isFixed[i] = false;
+  }
+
+  for (int i=0; i<numNodes; i++) {
+    theNode = this->getNode(theNodeLocs[i].tag);
+    const Matrix &mass = theNode->getMass();
+    int nodeDOF = theNode->getNumberDOF();
+    if (mass.noRows() == nodeDOF)
+      for (int j=0; j<nodeDOF; j++)
+	massSum[theNodeLocs[i].loc+j] += mass(j,j);
+  }
+
+  // the fixed dof are left out
+  SP_Constraint *theSP;
+  SP_ConstraintIter &theSPs = this->getDomainAndLoadPatternSPs();
+  while ((theSP = theSPs()) != 0) {
+    CriticalStepNode key;
+    key.tag = theSP->getNodeTag();
+    CriticalStepNode *theLoc = (CriticalStepNode *)
+      bsearch(&key, theNodeLocs, numNodes, sizeof(CriticalStepNode), compareCriticalStepNodes);
+    if (theLoc != 0) {
+      theNode = this->getNode(key.tag);
+      int dof = theSP->getDOF_Number();
+      if (dof >= 0 && dof < theNode->getNumberDOF())
+	isFixed[theLoc->loc+dof] = true;
+    }
+  }
+
+  // the elements, their sums formed by the threads a block at a time and
+  // then added to those of the dof of their nodes in turn
+  int numEle = this->getNumElements();
+  int blockSize = (numEle < CRITICAL_STEP_BLOCK) ? numEle : CRITICAL_STEP_BLOCK;
+  Element **theBlock = new Element *[blockSize > 0 ? blockSize : 1];
+  Vector **theStiffSums = new Vector *[blockSize > 0 ? blockSize : 1];
+  Vector **theMassSums = new Vector *[blockSize > 0 ? blockSize : 1];
+  for (int i=0; i<blockSize; i++) {
+    theStiffSums[i] = new Vector(0);
+    theMassSums[i] = new Vector(0);
+  }
+
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#endif
+
+  Element *theEle;
+  ElementIter &theElements = this->getElements();
+  bool done = (numEle == 0);
+  while (done == false) {
+    int numBlock = 0;
+    while (numBlock < blockSize && (theEle = theElements()) != 0)
+      if (theEle->isSubdomain() == false)
+	theBlock[numBlock++] = theEle;
+    if (numBlock < blockSize)
+      done = true;
+
+    const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(numT) if(numT > 1)
+#endif
+    for (int i=0; i<numBlock; i++) {
+      theGlobals.set();
+      theBlock[i]->getStableTimeStepSums(*theStiffSums[i], *theMassSums[i], initial);
+    }
+
+    for (int i=0; i<numBlock; i++) {
+      theEle = theBlock[i];
+      const Vector &eleStiff = *theStiffSums[i];
+      const Vector &eleMass = *theMassSums[i];
+      int numEleNodes = theEle->getNumExternalNodes();
+      const ID &theEleNodes = theEle->getExternalNodes();
+      int eleDOF = 0;
+      for (int j=0; j<numEleNodes; j++) {
+	CriticalStepNode key;
+	key.tag = theEleNodes(j);
+	CriticalStepNode *theLoc = (CriticalStepNode *)
+	  bsearch(&key, theNodeLocs, numNodes, sizeof(CriticalStepNode), compareCriticalStepNodes);
+	if (theLoc == 0)
+	  break;
+	int nodeDOF = this->getNode(key.tag)->getNumberDOF();
+	for (int k=0; k<nodeDOF && eleDOF < eleStiff.Size(); k++, eleDOF++) {
+	  stiffSum[theLoc->loc+k] += eleStiff(eleDOF);
+	  if (eleDOF < eleMass.Size())
+	    massSum[theLoc->loc+k] += eleMass(eleDOF);
+	}
+      }
+      if (eleDOF != eleStiff.Size()) {
+	opserr << "WARNING Domain::getCriticalTimeStep() - the dof of element " << theEle->getTag();
+	opserr << " are not those of its nodes, it is left out\n";
+      }
+    }
+  }
+
+  for (int i=0; i<blockSize; i++) {
+    delete theStiffSums[i];
+    delete theMassSums[i];
+  }
+  delete [] theBlock;
+  delete [] theStiffSums;
+  delete [] theMassSums;
+
+  // the bound of Gershgorin on the highest frequency of the free dof that
+  // have both mass and stiffness, dt = 2/omega
+  double maxOmega2 = 0.0;
+  for (int i=0; i<numDOF; i++)
+    if (isFixed[i] == false && massSum[i] > 0.0 && stiffSum[i]/massSum[i] > maxOmega2)
+      maxOmega2 = stiffSum[i]/massSum[i];
+
+  delete [] theNodeLocs;
+  delete [] stiffSum;
+  delete [] massSum;
+  delete [] isFixed;
+
+  if (maxOmega2 <= 0.0)
+    return 0.0;
+
+  return 2.0/sqrt(maxOmega2);
+}
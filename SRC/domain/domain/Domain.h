@@ -38,8 +38,13 @@
 
 #include <OPS_Stream.h>
 #include <Vector.h>
+#include <ComponentRange.h>
+#include <map>
+#include <vector>
 
 class Element;
+class ID;
+struct ElementResponseQuery;
 class Node;
 class SP_Constraint;
 class MP_Constraint;
@@ -74,6 +79,7 @@ class Channel;
 class FEM_ObjectBroker;
 
 class TaggedObjectStorage;
+class TaggedObjectIter;
 
 class Domain
 {
@@ -104,6 +110,12 @@ class Domain
     virtual  bool addMP_Constraint(MP_Constraint *); 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addParameter(Parameter *);            
+
+    // methods to populate a domain with many components at once, these
+    // return the number added, stopping at the first that can not be
+    virtual  int addNodes(Node **theNodes, int numNodes);
+    virtual  int addElements(Element **theElements, int numElements);
+    virtual  int addSP_Constraints(SP_Constraint **theSPs, int numSPs);
     
     // methods to add components to a LoadPattern object
     virtual  bool addSP_Constraint(SP_Constraint *, int loadPatternTag); 
@@ -128,6 +140,12 @@ class Domain
     virtual ElementalLoad *removeElementalLoad(int tag, int loadPattern);
     virtual SP_Constraint *removeSP_Constraint(int tag, int loadPattern);
 
+    // method to change the storage of the components, components is a
+    // sum of the flags below, each gets an empty copy of theStorageType
+    // and the objects already added are moved into it
+    enum {NODES = 1, ELEMENTS = 2, SP_CONSTRAINTS = 4, PRESSURE_CONSTRAINTS = 8,
+	  MP_CONSTRAINTS = 16, LOAD_PATTERNS = 32, PARAMETERS = 64};
+    virtual int setStorage(int components, TaggedObjectStorage &theStorageType);
     
     // methods to access the components of a domain
     virtual  ElementIter       &getElements();
@@ -138,6 +156,13 @@ class Domain
     virtual  LoadPatternIter   &getLoadPatterns();
     virtual  SP_ConstraintIter &getDomainAndLoadPatternSPs();
     virtual  ParameterIter     &getParameters();
+
+    // methods to access the elements and nodes as ranges, in the order of
+    // getElements() and getNodes(); a range may be used by nested loops and
+    // split between threads, it is to be obtained outside the threads and
+    // is valid until the domain changes
+    virtual  ComponentRange<Element> getElementRange(void);
+    virtual  ComponentRange<Node>    getNodeRange(void);
     
     virtual  Element       *getElement(int tag);
     virtual  Node          *getNode(int tag);
@@ -164,6 +189,18 @@ class Domain
     virtual const Vector *getNodeResponse(int nodeTag, NodeResponseType responseType); 
     virtual const Vector *getElementResponse(int eleTag, const char **argv, int argc); 
 
+    // the responses of several nodes or elements packed one after the
+    // other in result, returns the number of values or -1 if a node or
+    // element or its response is missing
+    virtual int getNodeResponses(const ID &nodeTags, NodeResponseType responseType,
+				 int dof, Vector &result);
+    virtual int getElementResponses(const ID &eleTags, const char **argv, int argc,
+				    Vector &result);
+
+    // the critical step of the central difference scheme, bounded from the
+    // sums of the elements, 0 if no free dof has both mass and stiffness
+    virtual double getCriticalTimeStep(bool initial = false);
+
     // methods to get element and node graphs
     virtual  Graph  &getElementGraph(void);
     virtual  Graph  &getNodeGraph(void);
@@ -212,6 +249,15 @@ class Domain
     virtual int  removeRecorders(void);
     virtual int  removeRecorder(int tag);
     virtual int  record(bool fromAnalysis=true);
+    int getNumRecorders(void) const {return numRecorders;}
+    Recorder *getRecorder(int i) {return theRecorders[i];}
+
+    // damage state: the largest damage index the damage recorders report
+    // while recording a commit; once it reaches a positive damage limit
+    // the commit fails, halting the analysis
+    virtual void   updateDamageIndex(double damageIndex);
+    virtual double getDamageIndex(void);
+    virtual void   setDamageLimit(double limit);
 
     virtual int  addRegion(MeshRegion &theRegion);    	
     virtual MeshRegion *getRegion(int region);    	
@@ -231,16 +277,23 @@ class Domain
     virtual int setMass(const Matrix &mass, int nodeTag);
 
     virtual int calculateNodalReactions(int flag);
+    virtual int calculateNodalReactions(int flag, const ID &nodeTags);
 
   protected:    
 
     virtual int buildEleGraph(Graph *theEleGraph);
     virtual int buildNodeGraph(Graph *theNodeGraph);
+    int formEleGraph(Graph *theEleGraph, TaggedObjectIter &theEles);
 
     Recorder **theRecorders;
     int numRecorders;    
 
   private:
+    bool ownsNodalState(void);
+    int buildReactionNodes(void);
+    void freeReactionNodes(void);
+    void freeResponseQueries(void);
+
     double currentTime;               // current pseudo time
     double committedTime;             // the committed pseudo time
     double dT;                        // difference between committed and current time
@@ -264,6 +317,10 @@ class Domain
     TaggedObjectStorage  *theLoadPatterns;        
     TaggedObjectStorage  *theParameters;        
 
+    // the tags of the SP_Constraints in theSPs by node tag and dof, so
+    // that a dof constrained twice is found without a search of theSPs
+    std::map<std::pair<int,int>, int> theSP_DOFs;
+
     SingleDomEleIter      *theEleIter;
     SingleDomNodIter  	  *theNodIter;
     SingleDomSP_Iter      *theSP_Iter;
@@ -277,6 +334,7 @@ class Domain
     int numRegions;    
 
     int commitTag;
+    int numNodalStateNodes;   // nodes whose response is in NodalState
     
     Vector theBounds;
     
@@ -287,6 +345,31 @@ class Domain
 
     int lastChannel;
 
+    // for the reactions of only some nodes, the nodes in order of their
+    // tags with the elements connected to them, built when first needed
+    // after the domain has changed
+    bool reactionNodesBuilt;
+    int numReactionNodes, numReactionEles;
+    int *reactionNodeTags, *reactionNodeStart, *reactionNodeEles;
+    Node **reactionNodePtrs;
+    Element **reactionEles;
+
+    // the reactions formed while the recorders record, so that they are
+    // formed once for all of them: the nodes whose stamp is reactionStamp,
+    // or all the nodes if allReactions
+    bool recordingReactions, allReactions;
+    int reactionFlag, reactionStamp, reactionPass, numReactionFormed;
+    int *reactionNodeStamp, *reactionElePass, *reactionFormed;
+
+    // the Responses set up for the last getElementResponses() queries,
+    // kept until the domain changes
+    enum {maxResponseQueries = 8};
+    ElementResponseQuery **responseQueries;
+    int nextResponseQuery;
+
+    // damage state, see updateDamageIndex()
+    double damageIndex, damageLimit;
+
     // Integer array: index[i] = tag of component i
     // Should put these in another class eventually -- MHS
     int *paramIndex;
@@ -294,6 +377,13 @@ class Domain
     enum {paramSize_grow = 20};
     int paramSize;
     int numParameters;
+
+    // the arrays behind getElementRange() and getNodeRange(), formed again
+    // after the domain changes
+    std::vector<Element *> theEleRange;
+    std::vector<Node *> theNodRange;
+    bool eleRangeValid;
+    bool nodRangeValid;
 };
 
 #endif
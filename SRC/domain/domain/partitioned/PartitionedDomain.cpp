@@ -54,6 +54,7 @@
 #include <PartitionedDomainSubIter.h>
 #include <SingleDomEleIter.h>
 #include <Vertex.h>
+#include <VertexIter.h>
 #include <Graph.h>
 #include <LoadPattern.h>
 #include <NodalLoad.h>
@@ -77,7 +78,8 @@ typedef MAP_ID::iterator     MAP_ID_ITERATOR;
 PartitionedDomain::PartitionedDomain()
 :Domain(),
  theSubdomains(0),theDomainPartitioner(0),
- theSubdomainIter(0), mySubdomainGraph(0)
+ theSubdomainIter(0), mySubdomainGraph(0),
+ maxImbalance(0.0), balanceInterval(1), numCommitsSinceBalance(0)
 {
     elements = new ArrayOfTaggedObjects(1024);    
     theSubdomains = new ArrayOfTaggedObjects(32);
@@ -100,7 +102,8 @@ PartitionedDomain::PartitionedDomain()
 PartitionedDomain::PartitionedDomain(DomainPartitioner &thePartitioner)
 :Domain(),
  theSubdomains(0),theDomainPartitioner(&thePartitioner),
- theSubdomainIter(0), mySubdomainGraph(0)
+ theSubdomainIter(0), mySubdomainGraph(0),
+ maxImbalance(0.0), balanceInterval(1), numCommitsSinceBalance(0)
 {
     elements = new ArrayOfTaggedObjects(1024);    
     theSubdomains = new ArrayOfTaggedObjects(32);
@@ -127,7 +130,8 @@ PartitionedDomain::PartitionedDomain(int numNodes, int numElements,
 
 :Domain(numNodes,0,numSPs,numMPs,numLoadPatterns),
  theSubdomains(0),theDomainPartitioner(&thePartitioner),
- theSubdomainIter(0), mySubdomainGraph(0)
+ theSubdomainIter(0), mySubdomainGraph(0),
+ maxImbalance(0.0), balanceInterval(1), numCommitsSinceBalance(0)
 {
     elements = new ArrayOfTaggedObjects(numElements);    
     theSubdomains = new ArrayOfTaggedObjects(numSubdomains);
@@ -189,6 +193,17 @@ PartitionedDomain::addElement(Element *elePtr)
   if (elePtr->isSubdomain() == true)
     return this->addSubdomain((Subdomain *)elePtr);
 
+  // with a pre-partitioned mesh the element goes straight to its subdomain
+  if (theDomainPartitioner != 0 && theDomainPartitioner->hasPartitions() == true) {
+    int placed = theDomainPartitioner->placeElement(elePtr);
+    if (placed < 0)
+      return false;
+    else if (placed == 1) {
+      this->domainChange();
+      return true;
+    }
+  }
+
   int eleTag = elePtr->getTag();
 #ifdef _DEBUG      
 
@@ -233,12 +248,54 @@ PartitionedDomain::addElement(Element *elePtr)
 
 
 
+// the components are placed in the subdomains one at a time
+int
+PartitionedDomain::addNodes(Node **theNodes, int numNodes)
+{
+  int numAdded = 0;
+  while (numAdded < numNodes && this->addNode(theNodes[numAdded]) == true)
+    numAdded++;
+
+  return numAdded;
+}
+
+int
+PartitionedDomain::addElements(Element **theElements, int numElements)
+{
+  int numAdded = 0;
+  while (numAdded < numElements && this->addElement(theElements[numAdded]) == true)
+    numAdded++;
+
+  return numAdded;
+}
+
+int
+PartitionedDomain::addSP_Constraints(SP_Constraint **theSPs, int numSPs)
+{
+  int numAdded = 0;
+  while (numAdded < numSPs && this->addSP_Constraint(theSPs[numAdded]) == true)
+    numAdded++;
+
+  return numAdded;
+}
+
+
 bool 
 PartitionedDomain::addNode(Node *nodePtr)
 {
 #ifdef _DEBUG    
    
 #endif
+  // with a pre-partitioned mesh a node in one partition goes straight to
+  // its subdomain, an interface node is also kept here
+  if (theDomainPartitioner != 0 && theDomainPartitioner->hasPartitions() == true) {
+    int placed = theDomainPartitioner->placeNode(nodePtr);
+    if (placed < 0)
+      return false;
+    else if (placed == 1)
+      return true;
+  }
+
     return (this->Domain::addNode(nodePtr));    
 }
 
@@ -1198,11 +1255,36 @@ PartitionedDomain::commit(void)
     }
   }
 
-  // now we load balance if we have subdomains and a partitioner
+  // now we load balance if we have subdomains and a partitioner; the
+  // subdomain graph is weighted by the time each subdomain measured in
+  // state determination since the last check, and the load balancer is
+  // only invoked if the heaviest is maxImbalance times the average
   int numSubdomains = this->getNumSubdomains();
-  if (numSubdomains != 0 && theDomainPartitioner != 0)  {
-    Graph &theSubGraphs = this->getSubdomainGraph();
-    theDomainPartitioner->balance(theSubGraphs);
+  if (numSubdomains != 0 && theDomainPartitioner != 0 &&
+      theDomainPartitioner->hasLoadBalancer() == true)  {
+
+    numCommitsSinceBalance++;
+    if (numCommitsSinceBalance >= balanceInterval) {
+      numCommitsSinceBalance = 0;
+
+      Graph &theSubGraphs = this->getSubdomainGraph();
+
+      double maxCost = 0.0;
+      double sumCost = 0.0;
+      int numVertex = 0;
+      Vertex *vertexPtr;
+      VertexIter &theVertices = theSubGraphs.getVertices();
+      while ((vertexPtr = theVertices()) != 0) {
+	double cost = vertexPtr->getWeight();
+	if (cost > maxCost)
+	  maxCost = cost;
+	sumCost += cost;
+	numVertex++;
+      }
+
+      if (sumCost > 0.0 && maxCost*numVertex > maxImbalance*sumCost)
+	theDomainPartitioner->balance(theSubGraphs);
+    }
   }
 
   return 0;
@@ -1394,6 +1476,21 @@ PartitionedDomain::setPartitioner(DomainPartitioner *thePartitioner)
 }
 
 
+int
+PartitionedDomain::setLoadBalancing(double maxImb, int numCommitsBetween)
+{
+  if (numCommitsBetween < 1) {
+    opserr << "PartitionedDomain::setLoadBalancing() - number of commits between checks must be > 0\n";
+    return -1;
+  }
+
+  maxImbalance = maxImb;
+  balanceInterval = numCommitsBetween;
+  numCommitsSinceBalance = 0;
+  return 0;
+}
+
+
 int 
 PartitionedDomain::partition(int numPartitions, bool usingMain, int mainPartitionID, int specialElementTag)
 {
@@ -1512,161 +1609,11 @@ PartitionedDomain::getPartitioner(void) const
 int 
 PartitionedDomain::buildEleGraph(Graph *theEleGraph)
 {
-   // see if quick return
-    int numVertex = this->getNumElements();
-    if (numVertex == 0)
+    // see if quick return
+    if (this->getNumElements() == 0)
         return 0;
 
-    //
-    // iterate over the lements of the domain
-    //  create a vertex with a unique tag for each element
-    //  also create a map to hold element tag - vertex tag mapping
-    //
-
-    MAP_INT theEleToVertexMap;
-    MAP_INT_ITERATOR theEleToVertexMapEle;
-
-
-    TaggedObject *theTagged;
-    TaggedObjectIter &theElements = elements->getComponents();
-    int count = START_VERTEX_NUM;
-    while ((theTagged = theElements()) != 0) {
-      int eleTag = theTagged->getTag();
-      Vertex *vertexPtr = new Vertex(count, eleTag);
-
-      if (vertexPtr == 0) {
-        opserr << "WARNING Domain::buildEleGraph - Not Enough Memory to create the " << count << " vertex\n";
-        return -1;
-      }
-
-      theEleGraph->addVertex(vertexPtr);
-      theEleToVertexMapEle = theEleToVertexMap.find(eleTag);
-      if (theEleToVertexMapEle == theEleToVertexMap.end()) {
-        theEleToVertexMap.insert(MAP_INT_TYPE(eleTag, count));
-
-        // check if sucessfully added
-        theEleToVertexMapEle = theEleToVertexMap.find(eleTag);
-        if (theEleToVertexMapEle == theEleToVertexMap.end()) {
-          opserr << "Domain::buildEleGraph - map STL failed to add object with tag : " << eleTag << endln;
-          return false;
-        }
-
-        count++;
-      }
-    }
-
-    //
-    // We now need to determine which elements are asssociated with each node.
-    // As this info is not in the Node interface we must build it;
-    //
-    // again we will use an stl map, index will be nodeTag, object will be Vertex
-    // do using vertices for each node, when we addVertex at thes nodes we
-    // will not be adding vertices but element tags.
-    //
-
-    MAP_ID theNodeToVertexMap;
-    MAP_ID_ITERATOR theNodeEle;
-
-    Node *nodPtr;
-
-    // now create the vertices with a reference equal to the node number.
-    // and a tag which ranges from 0 through numVertex-1 and placed in
-    // theNodeTagVertices at a position equal to the node's tag.
-
-    NodeIter &theNodes = this->getNodes();
-    while ((nodPtr = theNodes()) != 0) {
-      int nodeTag = nodPtr->getTag();
-      ID *eleTags = new ID(0, 4);
-
-      if (eleTags == 0) {
-        opserr << "WARNING Domain::buildEleGraph - Not Enough Memory to create the " << count << " vertex\n";
-        return -1;
-      }
-
-      theNodeEle = theNodeToVertexMap.find(nodeTag);
-      if (theNodeEle == theNodeToVertexMap.end()) {
-        theNodeToVertexMap.insert(MAP_ID_TYPE(nodeTag, eleTags));
-
-        // check if sucessfully added
-        theNodeEle = theNodeToVertexMap.find(nodeTag);
-        if (theNodeEle == theNodeToVertexMap.end()) {
-          opserr << "Domain::buildEleGraph - map STL failed to add object with tag : " << nodeTag << endln;
-          return false;
-        }
-      }
-    }
-
-    // now add the the Elements to the node vertices
-    Element *theEle;
-    TaggedObjectIter &theEle3 = elements->getComponents();
-
-    while((theTagged = theEle3()) != 0) {
-      theEle = (Element *)theTagged;
-      int eleTag = theEle->getTag();
-      const ID &id = theEle->getExternalNodes();
-
-      int size = id.Size();
-      for (int i=0; i<size; i++) {
-        int nodeTag = id(i);
-
-        MAP_ID_ITERATOR theNodeEle;
-        theNodeEle = theNodeToVertexMap.find(nodeTag);
-        if (theNodeEle == theNodeToVertexMap.end()) {
-          return -1;
-        } else {
-          ID *theNodeEleTags = (*theNodeEle).second;
-          theNodeEleTags->insert(eleTag);
-        }
-      }
-    }
-
-    //
-    // now add the edges to the vertices of our element graph;
-    // this is done by looping over the Node vertices, getting their
-    // Adjacenecy and adding edges between elements with common nodes
-    //
-
-    MAP_ID_ITERATOR currentComponent;
-    currentComponent = theNodeToVertexMap.begin();
-    while (currentComponent != theNodeToVertexMap.end()) {
-      ID *id = (*currentComponent).second;
-
-      int size = id->Size();
-      for (int i=0; i<size; i++) {
-        int eleTag1 = (*id)(i);
-
-        theEleToVertexMapEle = theEleToVertexMap.find(eleTag1);
-        if (theEleToVertexMapEle != theEleToVertexMap.end()) {
-          int vertexTag1 = (*theEleToVertexMapEle).second;
-
-          for (int j=0; j<size; j++)
-            if (i != j) {
-	      int eleTag2 = (*id)(j);
-              theEleToVertexMapEle = theEleToVertexMap.find(eleTag2);
-              if (theEleToVertexMapEle != theEleToVertexMap.end()) {
-                int vertexTag2 = (*theEleToVertexMapEle).second;
-
-                // addEdge() adds for both vertices - do only once
-
-                if (vertexTag1 > vertexTag2) {
-                  theEleGraph->addEdge(vertexTag1,vertexTag2);
-		  theEleGraph->addEdge(vertexTag2,vertexTag1);
-		}
-              }
-            }
-        }
-      }
-      currentComponent++;
-    }
-
-    // clean up - delete the ID's associated with the nodes
-    currentComponent = theNodeToVertexMap.begin();
-    while (currentComponent != theNodeToVertexMap.end()) {
-      delete (*currentComponent).second;
-      currentComponent++;
-    }
-	    
-    return 0;    
+    return this->formEleGraph(theEleGraph, elements->getComponents());
 }
 
 
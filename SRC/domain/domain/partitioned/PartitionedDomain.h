@@ -67,6 +67,9 @@ class PartitionedDomain: public Domain
     // public methods to populate a domain	
     virtual  bool addElement(Element *elePtr);
     virtual  bool addNode(Node *nodePtr);
+    virtual  int addNodes(Node **theNodes, int numNodes);
+    virtual  int addElements(Element **theElements, int numElements);
+    virtual  int addSP_Constraints(SP_Constraint **theSPs, int numSPs);
 
     virtual  bool addLoadPattern(LoadPattern *);            
     virtual  bool addSP_Constraint(SP_Constraint *); 
@@ -129,6 +132,7 @@ class PartitionedDomain: public Domain
 
     // public member functions in addition to the standard domain
     virtual int setPartitioner(DomainPartitioner *thePartitioner);
+    virtual int setLoadBalancing(double maxImbalance, int numCommitsBetween = 1);
     virtual int partition(int numPartitions, bool usingMain = false, int mainPartitionID = 0, int specialElementTag = 0);
 			
     virtual bool addSubdomain(Subdomain *theSubdomain);
@@ -165,6 +169,10 @@ class PartitionedDomain: public Domain
     PartitionedDomainEleIter   *theEleIter;
     
     Graph *mySubdomainGraph;    // a graph of subdomain connectivity
+
+    double maxImbalance;        // heaviest/average subdomain cost to balance at
+    int balanceInterval;        // number of commits between cost checks
+    int numCommitsSinceBalance;
 };
 
 #endif
@@ -85,7 +85,7 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 :MovableObject(GROUND_MOTION_TAG_GroundMotion), 
  theAccelSeries(accelSeries), theVelSeries(velSeries), 
  theDispSeries(dispSeries), theIntegrator(theIntegratr),
- data(3), delta(dTintegration), fact(factor)
+ data(3), delta(dTintegration), fact(factor), dataTime(-1.0)
 {
 
 }
@@ -95,7 +95,7 @@ GroundMotion::GroundMotion(TimeSeries *dispSeries,
 GroundMotion::GroundMotion(int theClassTag)
 :MovableObject(theClassTag), 
  theAccelSeries(0), theVelSeries(0), theDispSeries(0), theIntegrator(0),
- data(3), delta(0.0), fact(1.0)
+ data(3), delta(0.0), fact(1.0), dataTime(-1.0)
 {
 
 }
@@ -120,6 +120,7 @@ GroundMotion::setIntegrator(TimeSeriesIntegrator *integrator)
     delete theIntegrator;
 
   theIntegrator = integrator;
+  dataTime = -1.0;
 }
 
 TimeSeries*
@@ -314,6 +315,10 @@ GroundMotion::getDispVelAccel(double time)
     return data;
   }
 
+  // all the imposed motions using the motion ask for the same time
+  if (time == dataTime)
+    return data;
+
   if (theAccelSeries != 0 && theVelSeries != 0 && theDispSeries != 0) {
     data(0) = fact*(theDispSeries->getFactor(time));
     data(1) = fact*(theVelSeries->getFactor(time));
@@ -323,6 +328,7 @@ GroundMotion::getDispVelAccel(double time)
     data(1) = this->getVel(time);
     data(0) = this->getDisp(time);
   }
+  dataTime = time;
 
   return data;
 }
@@ -524,6 +530,7 @@ GroundMotion::recvSelf(int commitTag, Channel &theChannel,
 
   fact = data(0);
   delta = data(1);
+  dataTime = -1.0;
 
   return 0;
 }
@@ -532,6 +539,8 @@ GroundMotion::recvSelf(int commitTag, Channel &theChannel,
 int
 GroundMotion::setParameter(const char **argv, int argc, Parameter &param)
 {
+  // the factors of a parameterized series may change at the same time
+  dataTime = -1.0;
   return theAccelSeries->setParameter(argv, argc, param);
 }
 
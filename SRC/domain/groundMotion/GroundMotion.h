@@ -66,6 +66,10 @@ class GroundMotion : public MovableObject
     virtual double getVel(double time);
     virtual double getDisp(double time);
     virtual const  Vector &getDispVelAccel(double time);
+
+    // getDispVelAccel() returns the response it last evaluated if asked
+    // for the same time again, until the pattern clears it for a new step
+    void clearCache(void) {dataTime = -1.0;}
     
     void setIntegrator(TimeSeriesIntegrator *integrator);
     TimeSeries *integrate(TimeSeries *theSeries, double delta = 0.01); 
@@ -94,6 +98,7 @@ class GroundMotion : public MovableObject
     Vector data;
     double delta;
     double fact;
+    double dataTime;  // the time data was evaluated at
 };
 
 #endif
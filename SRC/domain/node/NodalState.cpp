@@ -0,0 +1,137 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/node/NodalState.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for NodalState.
+//
+// What: "@(#) NodalState.C, revA"
+
+#include <NodalState.h>
+#include <ModelArena.h>
+#include <string.h>
+
+// the number of entries in each array of a chunk, unless a node needs more
+#define NODAL_STATE_CHUNK_SIZE 8192
+
+// the header of a chunk, the eight arrays follow it in the same block
+struct NodalStateChunk {
+  NodalStateChunk *next;
+  int size;       // entries in each array
+  int numUsed;    // entries handed out
+  int numNodes;   // nodes still holding entries
+  double *values;
+};
+
+OPS_THREAD_LOCAL void *NodalState::theChunks = 0;
+OPS_THREAD_LOCAL int NodalState::numNodes = 0;
+
+double *
+NodalState::allocate(int numDOF, int &stride, void *&theChunk)
+{
+  NodalStateChunk *current = (NodalStateChunk *)theChunks;
+
+  if (current == 0 || current->numUsed + numDOF > current->size) {
+    int size = (numDOF > NODAL_STATE_CHUNK_SIZE) ? numDOF : NODAL_STATE_CHUNK_SIZE;
+    size_t headerSize = (sizeof(NodalStateChunk) + 15) & ~((size_t)15);
+    char *theBlock = (char *)ModelArena::allocate(headerSize + 8*size*sizeof(double));
+    if (theBlock == 0)
+      return 0;
+
+    current = (NodalStateChunk *)theBlock;
+    current->next = (NodalStateChunk *)theChunks;
+    current->size = size;
+    current->numUsed = 0;
+    current->numNodes = 0;
+    current->values = (double *)(theBlock + headerSize);
+    theChunks = current;
+  }
+
+  double *theValues = current->values + current->numUsed;
+  for (int j=0; j<8; j++)
+    memset(theValues + j*current->size, 0, numDOF*sizeof(double));
+
+  current->numUsed += numDOF;
+  current->numNodes++;
+  numNodes++;
+
+  stride = current->size;
+  theChunk = current;
+  return theValues;
+}
+
+void
+NodalState::deallocate(void *theChunk)
+{
+  NodalStateChunk *chunk = (NodalStateChunk *)theChunk;
+  if (chunk == 0)
+    return;
+
+  numNodes--;
+  if (--chunk->numNodes > 0)
+    return;
+
+  // the last chunk is kept for the nodes to come, unless no node is left
+  if (chunk == theChunks && numNodes > 0)
+    return;
+
+  NodalStateChunk **prev = (NodalStateChunk **)&theChunks;
+  while (*prev != chunk)
+    prev = &((*prev)->next);
+  *prev = chunk->next;
+
+  ModelArena::deallocate(chunk);
+}
+
+void
+NodalState::commitState(void)
+{
+  // committed = trial, incr = incrDelta = 0
+  for (NodalStateChunk *chunk = (NodalStateChunk *)theChunks; chunk != 0; chunk = chunk->next) {
+    int size = chunk->size;
+    size_t numBytes = chunk->numUsed*sizeof(double);
+    double *values = chunk->values;
+    memcpy(values + size, values, numBytes);
+    memset(values + 2*size, 0, numBytes);
+    memset(values + 3*size, 0, numBytes);
+    memcpy(values + 5*size, values + 4*size, numBytes);
+    memcpy(values + 7*size, values + 6*size, numBytes);
+  }
+}
+
+void
+NodalState::revertToLastCommit(void)
+{
+  // trial = committed, incr = incrDelta = 0
+  for (NodalStateChunk *chunk = (NodalStateChunk *)theChunks; chunk != 0; chunk = chunk->next) {
+    int size = chunk->size;
+    size_t numBytes = chunk->numUsed*sizeof(double);
+    double *values = chunk->values;
+    memcpy(values, values + size, numBytes);
+    memset(values + 2*size, 0, numBytes);
+    memset(values + 3*size, 0, numBytes);
+    memcpy(values + 4*size, values + 5*size, numBytes);
+    memcpy(values + 6*size, values + 7*size, numBytes);
+  }
+}
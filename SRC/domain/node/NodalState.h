@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/node/NodalState.h,v $
+
+#ifndef NodalState_h
+#define NodalState_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for NodalState.
+// NodalState holds the response of the nodes created while the ModelArena
+// is active as structures of arrays: storage is taken in chunks, each with
+// eight arrays of the same length for the trial, committed, incremental and
+// incremental delta displacements and the trial and committed velocities
+// and accelerations, and a node is given the same numDOF entries of each.
+// The Node keeps Vector objects viewing its entries. Committing or going
+// back to the last commit is then a few memcpy calls per chunk for all the
+// nodes at once; Domain does so when every node in the domain, and no
+// other, has its response here. Entries of removed nodes are not reused,
+// a chunk is freed when its last node is. Like the ModelArena its chunks
+// come from, each thread has its own chunks, so that the models built in
+// different threads are committed separately; a node is to be deleted by
+// the thread that created it.
+//
+// What: "@(#) NodalState.h, revA"
+
+#include <OPS_Globals.h>
+
+class NodalState
+{
+  public:
+    // returns the trial displacements of numDOF entries, the other arrays
+    // follow at multiples of stride; theChunk is needed to deallocate
+    static double *allocate(int numDOF, int &stride, void *&theChunk);
+    static void deallocate(void *theChunk);
+
+    static int getNumNodes(void) {return numNodes;}
+
+    static void commitState(void);
+    static void revertToLastCommit(void);
+
+  private:
+    static OPS_THREAD_LOCAL void *theChunks;  // the chunks, the last one created first
+    static OPS_THREAD_LOCAL int numNodes;     // nodes with their response in the chunks
+};
+
+#endif
@@ -38,6 +38,7 @@
 #include <Vector.h>
 #include <Matrix.h>
 #include <Channel.h>
+#include <Archive.h>
 #include <FEM_ObjectBroker.h>
 #include <DOF_Group.h>
 #include <Renderer.h>
@@ -55,9 +56,13 @@
 
 #include <OPS_Globals.h>
 #include <elementAPI.h>
+#include <Workspace.h>
+#include <ModelArena.h>
+#include <NodalState.h>
+#include <new>
 
-Matrix **Node::theMatrices = 0;
-int Node::numMatrices = 0;
+// key identifying the Workspace matrix returned when node has no mass
+static char massKey;
 
 int OPS_Node()
 {
@@ -187,9 +192,9 @@ Node::Node(int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0), 
  incrDeltaDisp(0),
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), arenaBlock(0), stride(0), stateChunk(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // for FEM_ObjectBroker, recvSelf() must be invoked on object
 
@@ -208,9 +213,9 @@ Node::Node(int tag, int theClassTag)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), arenaBlock(0), stride(0), stateChunk(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
   R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // for subclasses - they must implement all the methods with
   // their own data structures.
@@ -229,9 +234,9 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), arenaBlock(0), stride(0), stateChunk(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0), 
- index(-1), reaction(0), displayLocation(0)
+ reaction(0), displayLocation(0)
 {
   // AddingSensitivity:BEGIN /////////////////////////////////////////
   dispSensitivity = 0;
@@ -246,35 +251,11 @@ Node::Node(int tag, int ndof, double Crd1, Vector *dLoc)
   if (dLoc != 0) {
     displayLocation = new Vector(*dLoc);
   }
-  
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
+
+  // the Domain can only commit the NodalState as a whole if the
+  // nodes in it have their entries from the start
+  if (ModelArena::isActive() == true)
+    this->createArena();
 }
 
 
@@ -286,7 +267,7 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), arenaBlock(0), stride(0), stateChunk(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0), displayLocation(0)
 {
@@ -304,35 +285,11 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
   if (dLoc != 0) {
     displayLocation = new Vector(*dLoc);
   }
-  
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
+
+  // the Domain can only commit the NodalState as a whole if the
+  // nodes in it have their entries from the start
+  if (ModelArena::isActive() == true)
+    this->createArena();
 }
 
 
@@ -345,7 +302,7 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), arenaBlock(0), stride(0), stateChunk(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
  reaction(0), displayLocation(0)
 {
@@ -364,35 +321,11 @@ Node::Node(int tag, int ndof, double Crd1, double Crd2, Vector *dLoc)
   if (dLoc != 0) {
     displayLocation = new Vector(*dLoc);
   }
-  
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == ndof) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(ndof, ndof);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
+
+  // the Domain can only commit the NodalState as a whole if the
+  // nodes in it have their entries from the start
+  if (ModelArena::isActive() == true)
+    this->createArena();
 }
 
 
@@ -405,7 +338,7 @@ Node::Node(const Node &otherNode, bool copyMass)
  Crd(0), commitDisp(0), commitVel(0), commitAccel(0), 
  trialDisp(0), trialVel(0), trialAccel(0), unbalLoad(0), incrDisp(0),
  incrDeltaDisp(0), 
- disp(0), vel(0), accel(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
+ disp(0), vel(0), accel(0), arenaBlock(0), stride(0), stateChunk(0), dbTag1(0), dbTag2(0), dbTag3(0), dbTag4(0),
  R(0), mass(0), unbalLoadWithInertia(0), alphaM(0.0), theEigenvectors(0),
    reaction(0), displayLocation(0)
 {
@@ -431,8 +364,9 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for displacement\n";
       exit(-1);
     }
-    for (int i=0; i<4*numberDOF; i++)
-      disp[i] = otherNode.disp[i];
+    for (int j=0; j<4; j++)
+      for (int i=0; i<numberDOF; i++)
+	disp[j*stride+i] = otherNode.disp[j*otherNode.stride+i];
   }    
   
   if (otherNode.commitVel != 0) {
@@ -440,8 +374,9 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for velocity\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
-      vel[i] = otherNode.vel[i];
+    for (int j=0; j<2; j++)
+      for (int i=0; i<numberDOF; i++)
+	vel[j*stride+i] = otherNode.vel[j*otherNode.stride+i];
   }    
   
   if (otherNode.commitAccel != 0) {
@@ -449,8 +384,9 @@ Node::Node(const Node &otherNode, bool copyMass)
       opserr << " FATAL Node::Node(node *) - ran out of memory for acceleration\n";
       exit(-1);
     }
-    for (int i=0; i<2*numberDOF; i++)
-      accel[i] = otherNode.accel[i];
+    for (int j=0; j<2; j++)
+      for (int i=0; i<numberDOF; i++)
+	accel[j*stride+i] = otherNode.accel[j*otherNode.stride+i];
   }    
   
   
@@ -479,34 +415,6 @@ Node::Node(const Node &otherNode, bool copyMass)
     }
   }
 
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
-    }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }  
 }
 
 
@@ -519,42 +427,44 @@ Node::~Node()
     if (Crd != 0)
 	delete Crd;
 
-    if (commitDisp != 0)
+    if (arenaBlock != 0) {
+      // the response Vectors are in the one block from the ModelArena and
+      // the arrays in NodalState, only the Vector destructors are invoked
+      Vector *theVectors[8] = {commitDisp, commitVel, commitAccel, trialDisp,
+			       trialVel, trialAccel, incrDisp, incrDeltaDisp};
+      for (int i=0; i<8; i++)
+	if (theVectors[i] != 0)
+	  theVectors[i]->~Vector();
+      ModelArena::deallocate(arenaBlock);
+      NodalState::deallocate(stateChunk);
+    } else {
+      if (commitDisp != 0)
 	delete commitDisp;
-
-    if (commitVel != 0)
+      if (commitVel != 0)
 	delete commitVel;
-
-    if (commitAccel != 0)
+      if (commitAccel != 0)
 	delete commitAccel;
-
-    if (trialDisp != 0)
+      if (trialDisp != 0)
 	delete trialDisp;
-
-    if (trialVel != 0)
+      if (trialVel != 0)
 	delete trialVel;
-
-    if (trialAccel != 0)
+      if (trialAccel != 0)
 	delete trialAccel;
-
-    if (incrDisp != 0)
+      if (incrDisp != 0)
 	delete incrDisp;
-    
-    if (incrDeltaDisp != 0)
-	delete incrDeltaDisp;    
-    
-    if (unbalLoad != 0)
-	delete unbalLoad;
-    
-    if (disp != 0)
+      if (incrDeltaDisp != 0)
+	delete incrDeltaDisp;
+      if (disp != 0)
 	delete [] disp;
-
-    if (vel != 0)
+      if (vel != 0)
 	delete [] vel;
-
-    if (accel != 0)
+      if (accel != 0)
 	delete [] accel;
+    }
 
+    if (unbalLoad != 0)
+	delete unbalLoad;
+    
     if (mass != 0)
 	delete mass;
     
@@ -596,6 +506,42 @@ Node::getNumberDOF(void) const
 }
 
 
+size_t
+Node::getNumBytes(void) const
+{
+    size_t numBytes = sizeof(Node);
+
+    // the response Vectors are views of the disp, vel and accel arrays
+    const Vector *theViews[] = {commitDisp, commitVel, commitAccel,
+				trialDisp, trialVel, trialAccel,
+				incrDisp, incrDeltaDisp};
+    for (int i=0; i<8; i++)
+      if (theViews[i] != 0)
+	numBytes += sizeof(Vector);
+    if (disp != 0)
+      numBytes += 4*numberDOF*sizeof(double);
+    if (vel != 0)
+      numBytes += 2*numberDOF*sizeof(double);
+    if (accel != 0)
+      numBytes += 2*numberDOF*sizeof(double);
+
+    const Vector *theVectors[] = {Crd, unbalLoad, unbalLoadWithInertia,
+				  reaction, displayLocation};
+    for (int i=0; i<5; i++)
+      if (theVectors[i] != 0)
+	numBytes += sizeof(Vector) + theVectors[i]->Size()*sizeof(double);
+
+    const Matrix *theMatrices[] = {R, mass, theEigenvectors, dispSensitivity,
+				   velSensitivity, accSensitivity};
+    for (int i=0; i<6; i++)
+      if (theMatrices[i] != 0)
+	numBytes += sizeof(Matrix) + 
+	  theMatrices[i]->noRows()*theMatrices[i]->noCols()*sizeof(double);
+
+    return numBytes;
+}
+
+
 void
 Node::setDOF_GroupPtr(DOF_Group *theDOF_Grp)
 {
@@ -722,6 +668,24 @@ Node::getTrialAccel(void)
     return *trialAccel;
 }
 
+int
+Node::getResponseArrays(double *&theDisp, double *&theVel, 
+			double *&theAccel, int &theStride)
+{
+    if ((trialDisp == 0 && this->createDisp() < 0) ||
+	(trialVel == 0 && this->createVel() < 0) ||
+	(trialAccel == 0 && this->createAccel() < 0)) {
+	opserr << "WARNING Node::getResponseArrays() - ran out of memory\n";
+	return -1;
+    }
+
+    theDisp = disp;
+    theVel = vel;
+    theAccel = accel;
+    theStride = stride;
+    return 0;
+}
+
 const Vector &
 Node::getIncrDisp(void) 
 {
@@ -772,8 +736,8 @@ Node::setTrialDisp(double value, int dof)
     // perform the assignment .. we dont't go through Vector interface
     // as we are sure of size and this way is quicker
     double tDisp = value;
-    disp[dof+2*numberDOF] = tDisp - disp[dof+numberDOF];
-    disp[dof+3*numberDOF] = tDisp - disp[dof];	
+    disp[dof+2*stride] = tDisp - disp[dof+stride];
+    disp[dof+3*stride] = tDisp - disp[dof];	
     disp[dof] = tDisp;
 
     return 0;
@@ -803,8 +767,8 @@ Node::setTrialDisp(const Vector &newTrialDisp)
     // as we are sure of size and this way is quicker
     for (int i=0; i<numberDOF; i++) {
         double tDisp = newTrialDisp(i);
-	disp[i+2*numberDOF] = tDisp - disp[i+numberDOF];
-	disp[i+3*numberDOF] = tDisp - disp[i];	
+	disp[i+2*stride] = tDisp - disp[i+stride];
+	disp[i+3*stride] = tDisp - disp[i];	
 	disp[i] = tDisp;
     }
 
@@ -879,8 +843,8 @@ Node::incrTrialDisp(const Vector &incrDispl)
 	for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
 	  disp[i] = incrDispI;
-	  disp[i+2*numberDOF] = incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  disp[i+2*stride] = incrDispI;
+	  disp[i+3*stride] = incrDispI;
 	}
 	return 0;
     }
@@ -889,8 +853,8 @@ Node::incrTrialDisp(const Vector &incrDispl)
     for (int i = 0; i<numberDOF; i++) {
 	  double incrDispI = incrDispl(i);
 	  disp[i] += incrDispI;
-	  disp[i+2*numberDOF] += incrDispI;
-	  disp[i+3*numberDOF] = incrDispI;
+	  disp[i+2*stride] += incrDispI;
+	  disp[i+3*stride] = incrDispI;
     }
 
     return 0;
@@ -1124,22 +1088,22 @@ Node::commitState()
     // check disp exists, if does set commit = trial, incr = 0.0
     if (trialDisp != 0) {
       for (int i=0; i<numberDOF; i++) {
-	disp[i+numberDOF] = disp[i];  
-        disp[i+2*numberDOF] = 0.0;
-        disp[i+3*numberDOF] = 0.0;
+	disp[i+stride] = disp[i];  
+        disp[i+2*stride] = 0.0;
+        disp[i+3*stride] = 0.0;
       }
     }		    
     
     // check vel exists, if does set commit = trial    
     if (trialVel != 0) {
       for (int i=0; i<numberDOF; i++)
-	vel[i+numberDOF] = vel[i];
+	vel[i+stride] = vel[i];
     }
     
     // check accel exists, if does set commit = trial        
     if (trialAccel != 0) {
       for (int i=0; i<numberDOF; i++)
-	accel[i+numberDOF] = accel[i];
+	accel[i+stride] = accel[i];
     }
 
     // if we get here we are done
@@ -1154,22 +1118,22 @@ Node::revertToLastCommit()
     // check disp exists, if does set trial = last commit, incr = 0
     if (disp != 0) {
       for (int i=0 ; i<numberDOF; i++) {
-	disp[i] = disp[i+numberDOF];
-	disp[i+2*numberDOF] = 0.0;
-	disp[i+3*numberDOF] = 0.0;
+	disp[i] = disp[i+stride];
+	disp[i+2*stride] = 0.0;
+	disp[i+3*stride] = 0.0;
       }
     }
     
     // check vel exists, if does set trial = last commit
     if (vel != 0) {
       for (int i=0 ; i<numberDOF; i++)
-	vel[i] = vel[numberDOF+i];
+	vel[i] = vel[stride+i];
     }
 
     // check accel exists, if does set trial = last commit
     if (accel != 0) {    
       for (int i=0 ; i<numberDOF; i++)
-	accel[i] = accel[numberDOF+i];
+	accel[i] = accel[stride+i];
     }
 
     // if we get here we are done
@@ -1182,20 +1146,23 @@ Node::revertToStart()
 {
     // check disp exists, if does set all to zero
     if (disp != 0) {
-      for (int i=0 ; i<4*numberDOF; i++)
-	disp[i] = 0.0;
+      for (int j=0; j<4; j++)
+	for (int i=0 ; i<numberDOF; i++)
+	  disp[j*stride+i] = 0.0;
     }
 
     // check vel exists, if does set all to zero
     if (vel != 0) {
-      for (int i=0 ; i<2*numberDOF; i++)
-	vel[i] = 0.0;
+      for (int j=0; j<2; j++)
+	for (int i=0 ; i<numberDOF; i++)
+	  vel[j*stride+i] = 0.0;
     }
 
     // check accel exists, if does set all to zero
     if (accel != 0) {    
-      for (int i=0 ; i<2*numberDOF; i++)
-	accel[i] = 0.0;
+      for (int j=0; j<2; j++)
+	for (int i=0 ; i<numberDOF; i++)
+	  accel[j*stride+i] = 0.0;
     }
     
     if (unbalLoad != 0) 
@@ -1227,8 +1194,9 @@ Node::getMass(void)
 {
     // make sure it was created before we return it
     if (mass == 0) {
-      theMatrices[index]->Zero();
-      return *theMatrices[index];
+      Matrix &result = Workspace::getMatrix(&massKey, numberDOF, numberDOF);
+      result.Zero();
+      return result;
     } else 
       return *mass;
 }
@@ -1245,11 +1213,11 @@ const Matrix &
 Node::getDamp(void) 
 {
     // make sure it was created before we return it
+    Matrix &result = Workspace::getMatrix(&massKey, numberDOF, numberDOF);
     if (mass == 0 || alphaM == 0.0) {
-      theMatrices[index]->Zero();
-      return *theMatrices[index];
+      result.Zero();
+      return result;
     } else {
-      Matrix &result = *theMatrices[index];
       result = *mass;
       result *= alphaM;
       return result;
@@ -1261,11 +1229,11 @@ const Matrix &
 Node::getDampSensitivity(void) 
 {
     // make sure it was created before we return it
+    Matrix &result = Workspace::getMatrix(&massKey, numberDOF, numberDOF);
     if (mass == 0 || alphaM == 0.0) {
-      theMatrices[index]->Zero();
-      return *theMatrices[index];
+      result.Zero();
+      return result;
     } else {
-      Matrix &result = *theMatrices[index];
 	  result.Zero();
       //result = *mass;
       //result *= alphaM;
@@ -1439,6 +1407,26 @@ Node::setEigenvector(int mode, const Vector &eigenVector)
 
   return 0;
 }
+
+int 
+Node::setEigenvectors(const Matrix &eigenVectors)
+{
+  if (theEigenvectors == 0 || theEigenvectors->noCols() != eigenVectors.noCols()) {
+    opserr << "Node::setEigenvectors() - " << eigenVectors.noCols() << " modes invalid\n";
+    return -1;
+  }
+
+  if (eigenVectors.noRows() != numberDOF) {
+      opserr << "Node::setEigenvectors() - eigenvectors of incorrect size\n";
+      return -2;
+  }
+
+  // set all the modes at once
+  *theEigenvectors = eigenVectors;
+
+  return 0;
+}
+
 const Matrix &
 Node::getEigenvectors(void)
 {
@@ -1462,9 +1450,9 @@ Node::sendSelf(int cTag, Channel &theChannel)
     data(1) = numberDOF; 
     
     // indicate whether vector quantaties have been formed
-    if (disp == 0)       data(2) = 1; else data(2) = 0;
-    if (vel == 0)        data(3) = 1; else data(3) = 0;
-    if (accel == 0)      data(4) = 1; else data(4) = 0;
+    if (commitDisp == 0) data(2) = 1; else data(2) = 0;
+    if (commitVel == 0)  data(3) = 1; else data(3) = 0;
+    if (commitAccel == 0) data(4) = 1; else data(4) = 0;
     if (mass == 0)       data(5) = 1; else data(5) = 0;
     if (unbalLoad  == 0) data(6) = 1; else data(6) = 0;    
     if (R == 0) 	 
@@ -1498,60 +1486,29 @@ Node::sendSelf(int cTag, Channel &theChannel)
       return res;
     }
 
-    res = theChannel.sendVector(dataTag, cTag, *Crd);
+    // the coordinates and the response quantities go as one message,
+    // straight from the storage of the vectors and matrices
+    Archive theArchive(8);
+    theArchive.addData(*Crd);
+    if (commitDisp != 0)
+      theArchive.addData(*commitDisp);
+    if (commitVel != 0)
+      theArchive.addData(*commitVel);
+    if (commitAccel != 0)
+      theArchive.addData(*commitAccel);
+    if (mass != 0)
+      theArchive.addData(*mass);
+    if (R != 0)
+      theArchive.addData(*R);
+    if (unbalLoad != 0)
+      theArchive.addData(*unbalLoad);
+
+    res = theChannel.sendArchive(dataTag, cTag, theArchive);
     if (res < 0) {
-      opserr << " Node::sendSelf() - failed to send Vecor data\n";
+      opserr << " Node::sendSelf() - failed to send Vector data\n";
       return res;
     }
 
-    if (commitDisp != 0) {
-	res = theChannel.sendVector(dbTag1, cTag, *commitDisp);	
-	if (res < 0) {
-	  opserr << " Node::sendSelf() - failed to send Disp data\n";
-	  return res;
-	}
-    }
-
-    if (commitVel != 0) {
-	res = theChannel.sendVector(dbTag2, cTag, *commitVel);		
-	if (res < 0) {
-	  opserr << " Node::sendSelf() - failed to send Vel data\n";
-	  return res;
-	}
-    }
-
-    if (commitAccel != 0) {
-	res = theChannel.sendVector(dbTag3, cTag, *commitAccel); 
-	if (res < 0) {
-	  opserr << " Node::sendSelf() - failed to send Accel data\n";
-	  return res;
-	}
-    }
-
-    if (mass != 0) {
-	res = theChannel.sendMatrix(dataTag, cTag, *mass);
-	if (res < 0) {
-	  opserr << " Node::sendSelf() - failed to send Mass data\n";
-	  return res;
-	}
-    }
-    
-    if (R != 0) {
-	res = theChannel.sendMatrix(dataTag, cTag, *R);
-	if (res < 0) {
-	  opserr << " Node::sendSelf() - failed to send R data\n";
-	  return res;
-	}
-    }    
-
-    if (unbalLoad  != 0) {
-	res = theChannel.sendVector(dbTag4, cTag, *unbalLoad);	
-	if (res < 0) {
-	  opserr << " Node::sendSelf() - failed to send Load data\n";
-	  return res;
-	}
-    }
-
     // if get here succesfull
     return 0;
 }
@@ -1592,67 +1549,32 @@ Node::recvSelf(int cTag, Channel &theChannel,
       return -1;
     }
 
-    if (theChannel.recvVector(dataTag, cTag, *Crd) < 0) {
-      opserr << "Node::recvSelf() - failed to receive the Coordinate vector\n";
-      return -2;
-    }
+    Archive theArchive(8);
+    theArchive.addData(*Crd);
 
     if (data(2) == 0) {
       // create the disp vectors if node is a total blank
       if (commitDisp == 0)
 	this->createDisp();
-
-      // recv the committed disp
-      if (theChannel.recvVector(dbTag1, cTag, *commitDisp) < 0) {
-	opserr << "Node::recvSelf - failed to receive Disp data\n";
-	return res;
-      }
-
-      // set the trial quantities equal to committed
-      for (int i=0; i<numberDOF; i++)
-	disp[i] = disp[i+numberDOF];  // set trial equal commited
-
-    } else if (commitDisp != 0) {
-      // if going back to initial we will just zero the vectors
-      commitDisp->Zero();
-      trialDisp->Zero();
+      theArchive.addData(*commitDisp);
     }
-      
-    
+
     if (data(3) == 0) {
       // create the vel vectors if node is a total blank
       if (commitVel == 0) 
 	this->createVel();
-
-      // recv the committed vel
-      if (theChannel.recvVector(dbTag2, cTag, *commitVel) < 0) {
-	opserr << "Node::recvSelf - failed to receive Velocity data\n";
-	return -3;
-      }
-
-      // set the trial quantity
-      for (int i=0; i<numberDOF; i++)
-	vel[i] = vel[i+numberDOF];  // set trial equal commited
+      theArchive.addData(*commitVel);
     }
 
     if (data(4) == 0) {
-      // create the vel vectors if node is a total blank
+      // create the accel vectors if node is a total blank
       if (commitAccel == 0) 
 	this->createAccel();
-
-      // recv the committed accel
-      if (theChannel.recvVector(dbTag3, cTag, *commitAccel) < 0) {
-	opserr << "Node::recvSelf - failed to receive Acceleration data\n";
-	return -4;
-      }
-      
-      // set the trial values
-      for (int i=0; i<numberDOF; i++)
-	accel[i] = accel[i+numberDOF];  // set trial equal commited
+      theArchive.addData(*commitAccel);
     }
 
     if (data(5) == 0) {
-      // make some room and read in the vector
+      // make some room for the mass
       if (mass == 0) {
 	mass = new Matrix(numberDOF,numberDOF);
 	if (mass == 0) {
@@ -1660,10 +1582,7 @@ Node::recvSelf(int cTag, Channel &theChannel,
 	  return -5;
 	}
       }
-      if (theChannel.recvMatrix(dataTag, cTag, *mass) < 0) {
-	opserr << "Node::recvSelf() - failed to receive Mass data\n";
-	return -6;
-      }
+      theArchive.addData(*mass);
     }            
     
     if (data(12) == 0) {
@@ -1676,14 +1595,9 @@ Node::recvSelf(int cTag, Channel &theChannel,
 	  return -1;
 	}
       }
-      // now recv the R matrix
-      if (theChannel.recvMatrix(dataTag, cTag, *R) < 0) {
-	opserr << "Node::recvSelf() - failed to receive R data\n";
-	return res;
-      }
+      theArchive.addData(*R);
     }
 
-
     if (data(6) == 0) {
       // create a vector for the load
       if (unbalLoad == 0) {
@@ -1693,41 +1607,32 @@ Node::recvSelf(int cTag, Channel &theChannel,
 	  return -10;
 	}
       }
-      if (theChannel.recvVector(dbTag4, cTag, *unbalLoad) < 0) {
-	opserr << "Node::recvSelf() - failed to receive Load data\n";
-	return res;
-      }
+      theArchive.addData(*unbalLoad);
     }        
 
-
-  index = -1;
-  if (numMatrices != 0) {
-    for (int i=0; i<numMatrices; i++)
-      if (theMatrices[i]->noRows() == numberDOF) {
-	index = i;
-	i = numMatrices;
-      }
-  }
-  if (index == -1) {
-    Matrix **nextMatrices = new Matrix *[numMatrices+1];
-    if (nextMatrices == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
+    // receive the coordinates and response quantities in one message
+    if (theChannel.recvArchive(dataTag, cTag, theArchive) < 0) {
+      opserr << "Node::recvSelf() - failed to receive the Vector data\n";
+      return -2;
     }
-    for (int j=0; j<numMatrices; j++)
-      nextMatrices[j] = theMatrices[j];
-    Matrix *theMatrix = new Matrix(numberDOF, numberDOF);
-    if (theMatrix == 0) {
-      opserr << "Element::getTheMatrix - out of memory\n";
-      exit(-1);
+
+    // set the trial quantities equal to committed
+    if (data(2) == 0) {
+      for (int i=0; i<numberDOF; i++)
+	disp[i] = disp[i+stride];
+    } else if (commitDisp != 0) {
+      // if going back to initial we will just zero the vectors
+      commitDisp->Zero();
+      trialDisp->Zero();
     }
-    nextMatrices[numMatrices] = theMatrix;
-    if (numMatrices != 0) 
-      delete [] theMatrices;
-    index = numMatrices;
-    numMatrices++;
-    theMatrices = nextMatrices;
-  }
+
+    if (data(3) == 0)
+      for (int i=0; i<numberDOF; i++)
+	vel[i] = vel[i+stride];
+
+    if (data(4) == 0)
+      for (int i=0; i<numberDOF; i++)
+	accel[i] = accel[i+stride];
 
   return 0;
 }
@@ -1798,12 +1703,55 @@ Node::displaySelf(Renderer &theRenderer, int displayMode, float fact)
 // createDisp(), createVel() and createAccel():
 // private methods to create the arrays to hold the disp, vel and acceleration
 // values and the Vector objects for the committed and trial quantaties.
+// The trial, committed and incremental values of each are stride apart.
+//
+// With the ModelArena active the arrays are the entries of the node in
+// the NodalState chunks and the eight Vector objects are constructed in
+// place in one block from the arena, both obtained by createArena().
+
+// the location in the arena block of the i'th Vector object
+#define NODE_ARENA_VECTOR(i) ((void *)((char *)arenaBlock + (i)*sizeof(Vector)))
+
+int
+Node::createArena(void)
+{
+  arenaBlock = ModelArena::allocate(8*sizeof(Vector));
+  if (arenaBlock == 0) {
+    opserr << "WARNING - Node::createArena() ran out of memory for the Vectors\n";
+    return -1;
+  }
+
+  disp = NodalState::allocate(numberDOF, stride, stateChunk);
+  if (disp == 0) {
+    opserr << "WARNING - Node::createArena() ran out of memory for the nodal state\n";
+    ModelArena::deallocate(arenaBlock);
+    arenaBlock = 0;
+    return -1;
+  }
+  vel = &disp[4*stride];
+  accel = &disp[6*stride];
+
+  return 0;
+}
 
 int
 Node::createDisp(void)
 {
+  if (arenaBlock == 0 && ModelArena::isActive() == true)
+    if (this->createArena() < 0)
+      return -1;
+
+  if (arenaBlock != 0) {
+    commitDisp = new (NODE_ARENA_VECTOR(0)) Vector(&disp[stride], numberDOF);
+    trialDisp = new (NODE_ARENA_VECTOR(1)) Vector(disp, numberDOF);
+    incrDisp = new (NODE_ARENA_VECTOR(2)) Vector(&disp[2*stride], numberDOF);
+    incrDeltaDisp = new (NODE_ARENA_VECTOR(3)) Vector(&disp[3*stride], numberDOF);
+    return 0;
+  }
+
   // trial , committed, incr = (committed-trial)
   disp = new double[4*numberDOF];
+  stride = numberDOF;
     
   if (disp == 0) {
     opserr << "WARNING - Node::createDisp() ran out of memory for array of size " << 2*numberDOF << endln;
@@ -1813,10 +1761,10 @@ Node::createDisp(void)
   for (int i=0; i<4*numberDOF; i++)
     disp[i] = 0.0;
     
-  commitDisp = new Vector(&disp[numberDOF], numberDOF); 
+  commitDisp = new Vector(&disp[stride], numberDOF); 
   trialDisp = new Vector(disp, numberDOF);
-  incrDisp = new Vector(&disp[2*numberDOF], numberDOF);
-  incrDeltaDisp = new Vector(&disp[3*numberDOF], numberDOF);
+  incrDisp = new Vector(&disp[2*stride], numberDOF);
+  incrDeltaDisp = new Vector(&disp[3*stride], numberDOF);
   
   if (commitDisp == 0 || trialDisp == 0 || incrDisp == 0 || incrDeltaDisp == 0) {
     opserr << "WARNING - Node::createDisp() " <<
@@ -1831,7 +1779,18 @@ Node::createDisp(void)
 int
 Node::createVel(void)
 {
+    if (arenaBlock == 0 && ModelArena::isActive() == true)
+      if (this->createArena() < 0)
+	return -1;
+
+    if (arenaBlock != 0) {
+      commitVel = new (NODE_ARENA_VECTOR(4)) Vector(&vel[stride], numberDOF);
+      trialVel = new (NODE_ARENA_VECTOR(5)) Vector(vel, numberDOF);
+      return 0;
+    }
+
     vel = new double[2*numberDOF];
+    stride = numberDOF;
     
     if (vel == 0) {
       opserr << "WARNING - Node::createVel() ran out of memory for array of size " << 2*numberDOF << endln;
@@ -1840,7 +1799,7 @@ Node::createVel(void)
     for (int i=0; i<2*numberDOF; i++)
       vel[i] = 0.0;
     
-    commitVel = new Vector(&vel[numberDOF], numberDOF); 
+    commitVel = new Vector(&vel[stride], numberDOF); 
     trialVel = new Vector(vel, numberDOF);
     
     if (commitVel == 0 || trialVel == 0) {
@@ -1855,7 +1814,18 @@ Node::createVel(void)
 int
 Node::createAccel(void)
 {
+    if (arenaBlock == 0 && ModelArena::isActive() == true)
+      if (this->createArena() < 0)
+	return -1;
+
+    if (arenaBlock != 0) {
+      commitAccel = new (NODE_ARENA_VECTOR(6)) Vector(&accel[stride], numberDOF);
+      trialAccel = new (NODE_ARENA_VECTOR(7)) Vector(accel, numberDOF);
+      return 0;
+    }
+
     accel = new double[2*numberDOF];
+    stride = numberDOF;
     
     if (accel == 0) {
       opserr << "WARNING - Node::createAccel() ran out of memory for array of size " << 2*numberDOF << endln;
@@ -1864,7 +1834,7 @@ Node::createAccel(void)
     for (int i=0; i<2*numberDOF; i++)
 	accel[i] = 0.0;
     
-    commitAccel = new Vector(&accel[numberDOF], numberDOF);
+    commitAccel = new Vector(&accel[stride], numberDOF);
     trialAccel = new Vector(accel, numberDOF);
     
     if (commitAccel == 0 || trialAccel == 0) {
@@ -1882,8 +1852,9 @@ Matrix
 Node::getMassSensitivity(void)
 {
 	if (mass == 0) {
-		theMatrices[index]->Zero();
-		return *theMatrices[index];
+		Matrix &result = Workspace::getMatrix(&massKey, numberDOF, numberDOF);
+		result.Zero();
+		return result;
 	} 
 	else {
 		Matrix massSens(mass->noRows(),mass->noCols());
@@ -68,6 +68,9 @@ class Node : public DomainComponent
     virtual void setDOF_GroupPtr(DOF_Group *theDOF_Grp);
     virtual DOF_Group *getDOF_GroupPtr(void);
 
+    // the bytes of the node with its Vectors, Matrices and response arrays
+    size_t getNumBytes(void) const;
+
     // public methods for obtaining the nodal coordinates
     virtual const Vector &getCrds(void) const;
     virtual int getDisplayCrds(Vector &results, double fact);
@@ -94,6 +97,12 @@ class Node : public DomainComponent
     virtual int incrTrialDisp(const Vector &);    
     virtual int incrTrialVel(const Vector &);    
     virtual int incrTrialAccel(const Vector &);        
+
+    // public method returning the arrays holding the trial displacements, 
+    // velocities and accelerations, created if not there; the committed
+    // and incremental values of each follow at multiples of theStride
+    int getResponseArrays(double *&theDisp, double *&theVel, 
+			  double *&theAccel, int &theStride);
     
     // public methods for adding and obtaining load information
     virtual void zeroUnbalancedLoad(void);
@@ -106,6 +115,7 @@ class Node : public DomainComponent
     virtual int commitState();
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
+    bool hasNodalState(void) const {return stateChunk != 0;}
 
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void);
@@ -120,6 +130,7 @@ class Node : public DomainComponent
     // public methods for eigen vector
     virtual int setNumEigenvectors(int numVectorsToStore);
     virtual int setEigenvector(int mode, const Vector &eigenVector);
+    virtual int setEigenvectors(const Matrix &eigenVectors);
     virtual const Matrix &getEigenvectors(void);
     
     // public methods for output
@@ -166,6 +177,7 @@ class Node : public DomainComponent
     int createDisp(void);
     int createVel(void);
     int createAccel(void); 
+    int createArena(void);
 
     // private data associated with each node object
     int numberDOF;                    // number of dof at Node
@@ -179,6 +191,9 @@ class Node : public DomainComponent
     
     double *disp, *vel, *accel; // double arrays holding the displ, 
                                 // vel and accel values
+    void *arenaBlock;           // the block holding the Vectors if from the ModelArena
+    int stride;                 // distance between the trial, committed, .. values
+    void *stateChunk;           // the NodalState chunk holding the arrays, if any
 
     int dbTag1, dbTag2, dbTag3, dbTag4; // needed for database
     Matrix *R;                          // nodal participation matrix
@@ -195,12 +210,6 @@ class Node : public DomainComponent
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static Matrix **theMatrices;
-    static int numMatrices;
-    static Matrix **theVectors;
-    static int numVectors;
-    int index;
-
     Vector *reaction;
     Vector *displayLocation;
 };
@@ -34,6 +34,9 @@
 #include <DomainPartitioner.h>
  
 #include <stdlib.h>
+#include <fstream>
+#include <sstream>
+#include <string>
 #include <GraphPartitioner.h>
 #include <PartitionedDomain.h>
 #include <Subdomain.h>
@@ -99,7 +102,8 @@ NodeLocations::addPartition(int partition)
 DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(0),
  theElementGraph(0), theBoundaryElements(0), 
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ elementParts(0), nodeParts(0), sharedPlaces(0), numShared(0), sizeShared(0)
 {
 
 }    
@@ -108,7 +112,8 @@ DomainPartitioner::DomainPartitioner(GraphPartitioner &theGraphPartitioner,
 				     LoadBalancer &theLoadBalancer)
 :myDomain(0),thePartitioner(theGraphPartitioner),theBalancer(&theLoadBalancer),
  theElementGraph(0), theBoundaryElements(0),
- theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false)
+ theNodeLocations(0),elementPlace(0), numPartitions(0), partitionFlag(false), usingMainDomain(false),
+ elementParts(0), nodeParts(0), sharedPlaces(0), numShared(0), sizeShared(0)
 {
     // set the links the loadBalancer needs
     theLoadBalancer.setLinks(*this);
@@ -123,6 +128,8 @@ DomainPartitioner::~DomainPartitioner()
 	delete theBoundaryElements[i];
     delete []theBoundaryElements;
   }
+
+  this->clearPartitions();
 }
 
 void 
@@ -607,6 +614,198 @@ DomainPartitioner::balance(Graph &theWeightedPGraph)
 
 
 
+bool
+DomainPartitioner::hasLoadBalancer(void) const
+{
+    return (theBalancer != 0);
+}
+
+
+int
+DomainPartitioner::setPartitions(const char *meshFile, int numParts,
+				 bool usingMain, int mainPartitionTag)
+{
+  usingMainDomain = usingMain;
+  mainPartition = mainPartitionTag;
+
+  // ensure the partitioned domain has the subdomains to place into
+  for (int i=1; i<=numParts; i++) {
+    if (usingMainDomain == false || i != mainPartition) {
+      Subdomain *subdomainPtr = myDomain->getSubdomainPtr(i);
+      if (subdomainPtr == 0) {
+	opserr << "DomainPartitioner::setPartitions - No Subdomain: ";
+	opserr << i << " exists\n";
+	return -1;
+      }
+    }
+  }
+
+  std::ifstream theFile(meshFile);
+  if (!theFile) {
+    opserr << "DomainPartitioner::setPartitions - could not open file: " << meshFile << endln;
+    return -2;
+  }
+
+  this->clearPartitions();
+  elementParts = new ID(0, 1024);
+  nodeParts = new ID(0, 1024);
+
+  // each line holds: eleTag partition nodeTag1 nodeTag2 ...
+  std::string line;
+  int lineNum = 0;
+  while (std::getline(theFile, line)) {
+    lineNum++;
+    std::istringstream theLine(line);
+    int eleTag, partition, nodeTag;
+    if (!(theLine >> eleTag))
+      continue;
+    if (!(theLine >> partition) || eleTag < 0 || partition < 1 || partition > numParts) {
+      opserr << "DomainPartitioner::setPartitions - invalid line " << lineNum;
+      opserr << " in file: " << meshFile << endln;
+      return -3;
+    }
+    (*elementParts)[eleTag] = partition;
+
+    while (theLine >> nodeTag) {
+      if (nodeTag < 0)
+	continue;
+      int place = (*nodeParts)[nodeTag];
+      if (place == 0)
+	(*nodeParts)[nodeTag] = partition;
+      else if (place > 0 && place != partition) {
+	// first time the node is seen in a second partition
+	if (numShared == sizeShared) {
+	  int newSize = (sizeShared == 0) ? 256 : 2*sizeShared;
+	  ID **newShared = new ID *[newSize];
+	  for (int i=0; i<numShared; i++)
+	    newShared[i] = sharedPlaces[i];
+	  if (sharedPlaces != 0)
+	    delete [] sharedPlaces;
+	  sharedPlaces = newShared;
+	  sizeShared = newSize;
+	}
+	ID *thePlaces = new ID(0, 2);
+	thePlaces->insert(place);
+	thePlaces->insert(partition);
+	sharedPlaces[numShared] = thePlaces;
+	numShared++;
+	(*nodeParts)[nodeTag] = -numShared;
+      } else if (place < 0)
+	sharedPlaces[-place-1]->insert(partition);
+    }
+  }
+
+  numPartitions = numParts;
+  return 0;
+}
+
+
+void
+DomainPartitioner::clearPartitions(void)
+{
+  if (elementParts != 0)
+    delete elementParts;
+  if (nodeParts != 0)
+    delete nodeParts;
+  if (sharedPlaces != 0) {
+    for (int i=0; i<numShared; i++)
+      delete sharedPlaces[i];
+    delete [] sharedPlaces;
+  }
+  elementParts = 0;
+  nodeParts = 0;
+  sharedPlaces = 0;
+  numShared = 0;
+  sizeShared = 0;
+}
+
+
+bool
+DomainPartitioner::hasPartitions(void) const
+{
+  return (nodeParts != 0);
+}
+
+
+int
+DomainPartitioner::placeNode(Node *theNode)
+{
+  // returns 1 if the node was taken by a subdomain, 0 if it is to be
+  // added to the main domain and < 0 if it cannot be placed
+  if (nodeParts == 0)
+    return 0;
+
+  int nodeTag = theNode->getTag();
+  if (nodeTag < 0 || nodeTag >= nodeParts->Size())
+    return 0;
+
+  int place = (*nodeParts)(nodeTag);
+  if (place == 0)
+    return 0;
+
+  if (place > 0) {
+    if (usingMainDomain == true && place == mainPartition)
+      return 0;
+    Subdomain *theSubdomain = myDomain->getSubdomainPtr(place);
+    if (theSubdomain == 0 || theSubdomain->addNode(theNode) == false) {
+      opserr << "DomainPartitioner::placeNode - failed to add node " << nodeTag;
+      opserr << " to subdomain " << place << endln;
+      return -1;
+    }
+    return 1;
+  }
+
+  // an interface node: it is kept in the main domain and an external
+  // copy is sent to each of the subdomains
+  if (myDomain->Domain::getNode(nodeTag) != 0) {
+    opserr << "DomainPartitioner::placeNode - node " << nodeTag << " already exists\n";
+    return -1;
+  }
+
+  const ID &thePlaces = *(sharedPlaces[-place-1]);
+  for (int i=0; i<thePlaces.Size(); i++) {
+    int partition = thePlaces(i);
+    if (usingMainDomain == true && partition == mainPartition)
+      continue;
+    Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition);
+    if (theSubdomain == 0 || theSubdomain->addExternalNode(theNode) == false) {
+      opserr << "DomainPartitioner::placeNode - failed to add external node " << nodeTag;
+      opserr << " to subdomain " << partition << endln;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+int
+DomainPartitioner::placeElement(Element *theElement)
+{
+  // returns 1 if the element was taken by a subdomain, 0 if it is to be
+  // added to the main domain and < 0 if it cannot be placed
+  if (elementParts == 0)
+    return 0;
+
+  int eleTag = theElement->getTag();
+  if (eleTag < 0 || eleTag >= elementParts->Size())
+    return 0;
+
+  int place = (*elementParts)(eleTag);
+  if (place == 0 || (usingMainDomain == true && place == mainPartition))
+    return 0;
+
+  Subdomain *theSubdomain = myDomain->getSubdomainPtr(place);
+  if (theSubdomain == 0 || theSubdomain->addElement(theElement) == false) {
+    opserr << "DomainPartitioner::placeElement - failed to add element " << eleTag;
+    opserr << " to subdomain " << place << endln;
+    return -1;
+  }
+
+  return 1;
+}
+
+
 int 
 DomainPartitioner::getNumPartitions(void) const
 {
@@ -42,6 +42,8 @@
 
 class GraphPartitioner;
 class LoadBalancer;
+class Node;
+class Element;
 class PartitionedDomain;
 class Vector;
 class Graph;
@@ -61,6 +63,16 @@ class DomainPartitioner
     virtual int partition(int numParts, bool useMainDomain = false, int mainPartition = 0, int specialElementTag = 0);
 
     virtual int balance(Graph &theWeightedSubdomainGraph);
+    virtual bool hasLoadBalancer(void) const;
+
+    // member functions to place the nodes and elements of a model in the
+    // subdomains as they are added, given a pre-partitioned mesh file
+    virtual int setPartitions(const char *meshFile, int numParts, 
+			      bool useMainDomain = false, int mainPartition = 0);
+    virtual void clearPartitions(void);
+    virtual bool hasPartitions(void) const;
+    virtual int placeNode(Node *theNode);
+    virtual int placeElement(Element *theElement);
 
     // public member functions needed by the load balancer
     virtual int getNumPartitions(void) const;
@@ -107,6 +119,14 @@ class DomainPartitioner
     
     bool usingMainDomain;
     int mainPartition;
+
+    // the pre-partitioned mesh: partition of each element tag, and for each
+    // node tag 0 if in no element, p if only in partition p, or -(k+1) if
+    // on the interface with the partitions in sharedPlaces[k]
+    ID *elementParts;
+    ID *nodeParts;
+    ID **sharedPlaces;
+    int numShared, sizeShared;
 };
 
 #endif
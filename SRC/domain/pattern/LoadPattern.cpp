@@ -48,6 +48,9 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <GroundMotion.h>
+#include <Domain.h>
+#include <Element.h>
+#include <Node.h>
 
 #include <OPS_Globals.h>
 #include <elementAPI.h>
@@ -112,7 +115,9 @@ LoadPattern::LoadPattern(int tag, int clasTag, double fact)
  theSeries(0), 
  currentGeoTag(0), lastGeoSendTag(-1),
  theNodalLoads(0), theElementalLoads(0), theSPs(0),
- theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0)
+ theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0),
+ refLoadGeoTag(-1), refLoadDomainStamp(-1), numRefLoads(0),
+ refLoadEles(0), refLoadNodes(0), refLoads(0), numEleLoads(0), eleLoads(0)
 {
     // constructor for subclass
     theNodalLoads = new MapOfTaggedObjects();
@@ -146,7 +151,9 @@ LoadPattern::LoadPattern()
  currentGeoTag(0), lastGeoSendTag(-1),
  dbSPs(0), dbNod(0), dbEle(0), 
  theNodalLoads(0), theElementalLoads(0), theSPs(0),
- theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0)
+ theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0),
+ refLoadGeoTag(-1), refLoadDomainStamp(-1), numRefLoads(0),
+ refLoadEles(0), refLoadNodes(0), refLoads(0), numEleLoads(0), eleLoads(0)
 {
     theNodalLoads = new MapOfTaggedObjects();
     theElementalLoads = new MapOfTaggedObjects();
@@ -179,7 +186,9 @@ LoadPattern::LoadPattern(int tag, double fact)
  currentGeoTag(0), lastGeoSendTag(-1),
  dbSPs(0), dbNod(0), dbEle(0), 
  theNodalLoads(0), theElementalLoads(0), theSPs(0),
- theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0)
+ theNodIter(0), theEleIter(0), theSpIter(0), lastChannel(0),
+ refLoadGeoTag(-1), refLoadDomainStamp(-1), numRefLoads(0),
+ refLoadEles(0), refLoadNodes(0), refLoads(0), numEleLoads(0), eleLoads(0)
 {
     theNodalLoads = new MapOfTaggedObjects();
     theElementalLoads = new MapOfTaggedObjects();
@@ -237,6 +246,8 @@ LoadPattern::~LoadPattern()
     if (dLambdadh != 0)
       delete dLambdadh;
     // AddingSensitivity:END ///////////////////////////////
+
+    this->clearReferenceLoads();
 }
 
 
@@ -274,6 +285,8 @@ LoadPattern::setDomain(Domain *theDomain)
 
     // now we set this load patterns domain
     this->DomainComponent::setDomain(theDomain);
+
+    refLoadGeoTag = -1;
 }
 
 
@@ -412,11 +425,25 @@ LoadPattern::applyLoad(double pseudoTime)
 
   while ((nodLoad = theNodalIter()) != 0)
     nodLoad->applyLoad(loadFactor);
-    
-  ElementalLoad *eleLoad;
-  ElementalLoadIter &theElementalIter = this->getElementalLoads();
-  while ((eleLoad = theElementalIter()) != 0)
-    eleLoad->applyLoad(loadFactor);
+
+  // the elemental loads, those with a reference load as a scaled add
+  // into the nodal loads
+  Domain *theDomain = this->getDomain();
+  if (theDomain != 0) {
+    int stamp = theDomain->hasDomainChanged();
+    if (refLoadGeoTag != currentGeoTag || refLoadDomainStamp != stamp) {
+      this->formReferenceLoads();
+      refLoadGeoTag = currentGeoTag;
+      refLoadDomainStamp = stamp;
+    }
+
+    for (int i = 0; i < numRefLoads; i++)
+      if (refLoadEles[i]->isActive() == true)
+	refLoadNodes[i]->addUnbalancedLoad(*refLoads[i], loadFactor);
+
+    for (int i = 0; i < numEleLoads; i++)
+      eleLoads[i]->applyLoad(loadFactor);
+  }
 
   SP_Constraint *sp;
   SP_ConstraintIter &theIter = this->getSPs();
@@ -424,6 +451,97 @@ LoadPattern::applyLoad(double pseudoTime)
     sp->applyConstraint(loadFactor);
 }
 
+void
+LoadPattern::formReferenceLoads(void)
+{
+  this->clearReferenceLoads();
+
+  int numLoads = theElementalLoads->getNumComponents();
+  if (numLoads == 0)
+    return;
+
+  eleLoads = new ElementalLoad *[numLoads];
+  ElementalLoad **theRefLoads = new ElementalLoad *[numLoads];
+  const Vector **theRefVectors = new const Vector *[numLoads];
+  int numRefEleLoads = 0;
+
+  // ask the element of each load for its reference load
+  ElementalLoad *eleLoad;
+  ElementalLoadIter &theElementalIter = this->getElementalLoads();
+  while ((eleLoad = theElementalIter()) != 0) {
+    Element *theEle = eleLoad->getElement();
+    const Vector *P = 0;
+    if (theEle != 0) {
+      P = theEle->getReferenceLoad(eleLoad);
+      if (P != 0 && P->Size() != theEle->getNumDOF())
+	P = 0;
+      Node **theNodes = theEle->getNodePtrs();
+      for (int j = 0; P != 0 && j < theEle->getNumExternalNodes(); j++)
+	if (theNodes[j] == 0)
+	  P = 0;
+    }
+    if (P != 0) {
+      theRefLoads[numRefEleLoads] = eleLoad;
+      theRefVectors[numRefEleLoads] = P;
+      numRefEleLoads++;
+      numRefLoads += theEle->getNumExternalNodes();
+    } else
+      eleLoads[numEleLoads++] = eleLoad;
+  }
+
+  // split the reference loads into the nodal loads
+  if (numRefLoads != 0) {
+    refLoadEles = new Element *[numRefLoads];
+    refLoadNodes = new Node *[numRefLoads];
+    refLoads = new Vector *[numRefLoads];
+
+    int loc = 0;
+    for (int i = 0; i < numRefEleLoads; i++) {
+      Element *theEle = theRefLoads[i]->getElement();
+      Node **theNodes = theEle->getNodePtrs();
+      const Vector &P = *theRefVectors[i];
+      int pos = 0;
+      for (int j = 0; j < theEle->getNumExternalNodes(); j++) {
+	int numDOF = theNodes[j]->getNumberDOF();
+	Vector *nodeP = new Vector(numDOF);
+	for (int k = 0; k < numDOF; k++)
+	  (*nodeP)(k) = P(pos+k);
+	pos += numDOF;
+	refLoadEles[loc] = theEle;
+	refLoadNodes[loc] = theNodes[j];
+	refLoads[loc] = nodeP;
+	loc++;
+      }
+    }
+  }
+
+  delete [] theRefLoads;
+  delete [] theRefVectors;
+}
+
+void
+LoadPattern::clearReferenceLoads(void)
+{
+  for (int i = 0; i < numRefLoads; i++)
+    delete refLoads[i];
+
+  if (refLoads != 0)
+    delete [] refLoads;
+  if (refLoadNodes != 0)
+    delete [] refLoadNodes;
+  if (refLoadEles != 0)
+    delete [] refLoadEles;
+  if (eleLoads != 0)
+    delete [] eleLoads;
+
+  refLoads = 0;
+  refLoadNodes = 0;
+  refLoadEles = 0;
+  eleLoads = 0;
+  numRefLoads = 0;
+  numEleLoads = 0;
+}
+
 void
 LoadPattern::setLoadConstant(void) 
 {
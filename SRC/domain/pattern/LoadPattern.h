@@ -51,6 +51,8 @@ class SingleDomSP_Iter;
 class SP_ConstraintIter;
 class TaggedObjectStorage;
 class GroundMotion;
+class Element;
+class Node;
 
 class LoadPattern : public DomainComponent    
 {
@@ -140,6 +142,19 @@ class LoadPattern : public DomainComponent
     // AddingSensitivity:END ////////////////////////////////////////
 
     int lastChannel; 
+
+    // the elemental loads whose element gives a reference load are applied
+    // as scaled nodal loads, one entry for each node of the element; the
+    // others through Element::addLoad()
+    void formReferenceLoads(void);
+    void clearReferenceLoads(void);
+    int refLoadGeoTag, refLoadDomainStamp;
+    int numRefLoads;
+    Element **refLoadEles;
+    Node **refLoadNodes;
+    Vector **refLoads;
+    int numEleLoads;
+    ElementalLoad **eleLoads;
 };
 
 #endif
@@ -99,6 +99,10 @@ MultiSupportPattern::~MultiSupportPattern()
 void 
 MultiSupportPattern::applyLoad(double time)
 {
+  // the ImposedMotionSPs of a motion share its response at the time
+  for (int i=0; i<numMotions; i++)
+    theMotions[i]->clearCache();
+
   SP_Constraint *sp;
   SP_ConstraintIter &theIter = this->getSPs();
   while ((sp = theIter()) != 0) {
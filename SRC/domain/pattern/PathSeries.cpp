@@ -43,6 +43,7 @@ using std::ifstream;
 using std::ios;
 
 #include <PathTimeSeries.h>
+#include <SeriesFile.h>
 #include <elementAPI.h>
 #include <string>
 
@@ -223,7 +224,8 @@ void* OPS_PathSeries()
 
 PathSeries::PathSeries()	
   :TimeSeries(TSERIES_TAG_PathSeries),
-   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1)
+   thePath(0), pathTimeIncr(0.0), cFactor(0.0), otherDbTag(0), lastSendCommitTag(-1),
+   theFile(0)
 {
   // does nothing
 }
@@ -237,7 +239,8 @@ PathSeries::PathSeries(int tag,
                double tStart)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
-   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
+   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart),
+   theFile(0)
 {
   // create a copy of the vector containg path points
   if (prependZero == false) {
@@ -267,8 +270,31 @@ PathSeries::PathSeries(int tag,
                double tStart)
   :TimeSeries(tag, TSERIES_TAG_PathSeries),
    thePath(0), pathTimeIncr(theTimeIncr), cFactor(theFactor),
-   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart)
+   otherDbTag(0), lastSendCommitTag(-1), useLast(last), startTime(tStart),
+   theFile(0)
 {
+  // a binary series file is used in place
+  theFile = SeriesFile::open(fileName);
+  if (theFile != 0) {
+    int numPoints = theFile->getNumPoints();
+    if (theFile->getNumColumns() != 1 || numPoints == 0) {
+      opserr << "WARNING - PathSeries::PathSeries() - series file " << fileName;
+      opserr << " does not contain one column of values\n";
+      SeriesFile::release(theFile);
+      theFile = 0;
+      return;
+    }
+    if (prependZero == false) {
+      thePath = new Vector(theFile->getColumn(0), numPoints);
+    } else {
+      thePath = new Vector(1 + numPoints);
+      thePath->Assemble(Vector(theFile->getColumn(0), numPoints), 1);
+      SeriesFile::release(theFile);
+      theFile = 0;
+    }
+    return;
+  }
+
   // determine the number of data points .. open file and count num entries
   int numDataPoints = 0;
   double dataPoint;
@@ -334,10 +360,16 @@ PathSeries::~PathSeries()
 {
   if (thePath != 0)
     delete thePath;
+  SeriesFile::release(theFile);
 }
 
 TimeSeries *
 PathSeries::getCopy(void) {
+  // a copy of a mapped series maps the same file
+  if (theFile != 0)
+    return new PathSeries(this->getTag(), theFile->getFileName(), pathTimeIncr,
+			  cFactor, useLast, false, startTime);
+
   return new PathSeries(this->getTag(), *thePath, pathTimeIncr, cFactor,
                         useLast, false, startTime);
 }
@@ -38,6 +38,7 @@
 #include <TimeSeries.h>
 
 class Vector;
+class SeriesFile;
 
 class PathSeries : public TimeSeries
 {
@@ -87,6 +88,7 @@ class PathSeries : public TimeSeries
     int lastSendCommitTag;
     bool useLast;
     double startTime;
+    SeriesFile *theFile;  // the binary file thePath is mapped from, if any
 };
 
 #endif
@@ -36,6 +36,7 @@
 
 
 #include <PathTimeSeries.h>
+#include <SeriesFile.h>
 #include <Vector.h>
 #include <Channel.h>
 #include <math.h>
@@ -49,7 +50,7 @@ using std::ios;
 PathTimeSeries::PathTimeSeries()	
   :TimeSeries(TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(0.0),
-   dbTag1(0), dbTag2(0), lastSendCommitTag(-1)
+   dbTag1(0), dbTag2(0), lastSendCommitTag(-1), pathFile(0), timeFile(0)
 {
   // does nothing
 }
@@ -62,7 +63,7 @@ PathTimeSeries::PathTimeSeries(int tag,
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
-   useLast(last)
+   useLast(last), pathFile(0), timeFile(0)
 {
   // check vectors are of same size
   if (theLoadPath.Size() != theTimePath.Size()) {
@@ -97,8 +98,29 @@ PathTimeSeries::PathTimeSeries(int tag,
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
    dbTag1(0), dbTag2(0), lastSendCommitTag(-1), lastChannel(0),
-   useLast(last)
+   useLast(last), pathFile(0), timeFile(0)
 {
+  // binary series files are used in place
+  pathFile = SeriesFile::open(filePathName);
+  timeFile = SeriesFile::open(fileTimeName);
+  if (pathFile != 0 || timeFile != 0) {
+    if (pathFile == 0 || timeFile == 0 ||
+	pathFile->getNumColumns() != 1 || timeFile->getNumColumns() != 1 ||
+	pathFile->getNumPoints() != timeFile->getNumPoints() ||
+	pathFile->getNumPoints() == 0) {
+      opserr << "WARNING PathTimeSeries::PathTimeSeries() - files containing data ";
+      opserr << "points for path and time are not series files of one column of the same size\n";
+      SeriesFile::release(pathFile);
+      SeriesFile::release(timeFile);
+      pathFile = 0;
+      timeFile = 0;
+      return;
+    }
+    thePath = new Vector(pathFile->getColumn(0), pathFile->getNumPoints());
+    time = new Vector(timeFile->getColumn(0), timeFile->getNumPoints());
+    return;
+  }
+
   // determine the number of data points
   int numDataPoints1 =0;
   int numDataPoints2 =0;
@@ -204,8 +226,25 @@ PathTimeSeries::PathTimeSeries(int tag,
 			       bool last)
   :TimeSeries(tag, TSERIES_TAG_PathTimeSeries),
    thePath(0), time(0), currentTimeLoc(0), cFactor(theFactor),
-   dbTag1(0), dbTag2(0), lastChannel(0), useLast(last)
+   dbTag1(0), dbTag2(0), lastChannel(0), useLast(last),
+   pathFile(0), timeFile(0)
 {
+  // a binary series file of times & values is used in place
+  timeFile = SeriesFile::open(fileName);
+  if (timeFile != 0) {
+    if (timeFile->getNumColumns() != 2 || timeFile->getNumPoints() == 0) {
+      opserr << "WARNING - PathTimeSeries::PathTimeSeries() - series file " << fileName;
+      opserr << " does not contain times & values\n";
+      SeriesFile::release(timeFile);
+      timeFile = 0;
+      return;
+    }
+    pathFile = SeriesFile::open(fileName);
+    time = new Vector(timeFile->getColumn(0), timeFile->getNumPoints());
+    thePath = new Vector(timeFile->getColumn(1), timeFile->getNumPoints());
+    return;
+  }
+
   // determine the number of data points
   int numDataPoints = 0;
   double dataPoint;
@@ -218,10 +257,8 @@ PathTimeSeries::PathTimeSeries(int tag,
     opserr << " - could not open file " << fileName << endln;
   }
   else {
-    while (theFile >> dataPoint) {
+    while (theFile >> dataPoint)
       numDataPoints++;
-      theFile >> dataPoint;	// Read in second value of pair
-    }
   }
 
   if ((numDataPoints % 2) != 0) {
@@ -286,11 +323,20 @@ PathTimeSeries::~PathTimeSeries()
     delete thePath;
   if (time != 0)
     delete time;
+  SeriesFile::release(pathFile);
+  SeriesFile::release(timeFile);
 }
 
 TimeSeries *
 PathTimeSeries::getCopy(void) 
 {
+  // a copy of a mapped series maps the same files
+  if (pathFile == timeFile && pathFile != 0)
+    return new PathTimeSeries(this->getTag(), pathFile->getFileName(), cFactor, useLast);
+  if (pathFile != 0)
+    return new PathTimeSeries(this->getTag(), pathFile->getFileName(),
+			      timeFile->getFileName(), cFactor, useLast);
+
   return new PathTimeSeries(this->getTag(), *thePath, *time, cFactor, useLast);
 }
 
@@ -308,59 +354,95 @@ PathTimeSeries::getFactor(double pseudoTime)
   if (thePath == 0)
     return 0.0;
 
-  // determine indexes into the data array whose boundary holds the time
-  double time1 = (*time)(currentTimeLoc);
+  const Vector &theTime = *time;
+  int size = theTime.Size();
+  int sizem1 = size - 1;
 
-  // check for another quick return
-  if (pseudoTime < time1 && currentTimeLoc == 0)
+  // check for another quick return, before the start or after the end
+  if (pseudoTime < theTime(0))
     return 0.0;
-  if (pseudoTime == time1)
-    return cFactor * (*thePath)[currentTimeLoc];
-
-  int size = time->Size();
-  int sizem1 = size - 1;
-  int sizem2 = size - 2;
-  
-  // check we are not at the end
-  if (pseudoTime > time1 && currentTimeLoc == sizem1) {
-    if (useLast == false)
-      return 0.0;
-    else
+  if (pseudoTime >= theTime(sizem1)) {
+    if (pseudoTime == theTime(sizem1) || useLast == true)
       return cFactor*(*thePath)[sizem1];
+    else
+      return 0.0;
   }
 
-  // otherwise go find the current interval
-  double time2 = (*time)(currentTimeLoc+1);
-  if (pseudoTime > time2) {
-    while ((pseudoTime > time2) && (currentTimeLoc < sizem2)) {
+  // otherwise go find the current interval, usually the last one or the
+  // next, else, as after a revert, with a binary search
+  if (currentTimeLoc > size-2)
+    currentTimeLoc = 0;
+  if (pseudoTime < theTime(currentTimeLoc) || pseudoTime > theTime(currentTimeLoc+1)) {
+    if (currentTimeLoc < size-2 && pseudoTime >= theTime(currentTimeLoc+1)
+	&& pseudoTime <= theTime(currentTimeLoc+2)) {
       currentTimeLoc++;
-      time1 = time2;
-      time2 = (*time)(currentTimeLoc+1);
-    }
-    // if pseudo time greater than ending time return 0
-    if (pseudoTime > time2) {
-      if (useLast == false)
-        return 0.0;
-      else
-        return cFactor*(*thePath)[sizem1];
-    }
-
-  } else if (pseudoTime < time1) {
-    while ((pseudoTime < time1) && (currentTimeLoc > 0)) {
-      currentTimeLoc--;
-      time2 = time1;	
-      time1 = (*time)(currentTimeLoc);
+    } else {
+      int low = 0;
+      int high = sizem1;
+      while (high - low > 1) {
+	int mid = (low + high)/2;
+	if (theTime(mid) <= pseudoTime)
+	  low = mid;
+	else
+	  high = mid;
+      }
+      currentTimeLoc = low;
     }
-    // if starting time less than initial starting time return 0
-    if (pseudoTime < time1)
-      return 0.0;
   }
 
+  double time1 = theTime(currentTimeLoc);
+  double time2 = theTime(currentTimeLoc+1);
   double value1 = (*thePath)[currentTimeLoc];
   double value2 = (*thePath)[currentTimeLoc+1];
+  if (time2 == time1)
+    return cFactor*value2;
   return cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
 }
 
+int
+PathTimeSeries::getFactors(const double *pseudoTimes, double *factors, int num)
+{
+  if (thePath == 0) {
+    for (int i=0; i<num; i++)
+      factors[i] = 0.0;
+    return 0;
+  }
+
+  const Vector &theTime = *time;
+  int size = theTime.Size();
+  int sizem1 = size - 1;
+
+  // while the times increase the interval is found by walking forward
+  // from the last one, so the cost is that of one pass over the path
+  int loc = 0;
+  double lastTime = pseudoTimes[0];
+  for (int i=0; i<num; i++) {
+    double pseudoTime = pseudoTimes[i];
+    if (pseudoTime < lastTime || size < 2 ||
+	pseudoTime < theTime(0) || pseudoTime >= theTime(sizem1)) {
+      factors[i] = this->getFactor(pseudoTime);
+      lastTime = pseudoTime;
+      loc = (size < 2 || pseudoTime < theTime(0)) ? 0 : currentTimeLoc;
+      continue;
+    }
+    while (loc < size-2 && pseudoTime > theTime(loc+1))
+      loc++;
+    lastTime = pseudoTime;
+
+    double time1 = theTime(loc);
+    double time2 = theTime(loc+1);
+    double value1 = (*thePath)[loc];
+    double value2 = (*thePath)[loc+1];
+    if (time2 == time1)
+      factors[i] = cFactor*value2;
+    else
+      factors[i] = cFactor*(value1 + (value2-value1)*(pseudoTime-time1)/(time2 - time1));
+  }
+  currentTimeLoc = loc;
+
+  return 0;
+}
+
 double
 PathTimeSeries::getDuration()
 {
@@ -34,13 +34,16 @@
 // PathTimeSeries is a TimeSeries class which linear interpolates the
 // load factor using user specified control points provided in a vector object.
 // the points in the vector are given at time points specified in another vector.
-// object. 
+// object. The data of a binary series file (SeriesFile) is used in place.
+// The interval holding the time is looked for from the last one used and, if
+// not next to it as after a revert, by a binary search.
 //
 // What: "@(#) PathTimeSeries.h, revA"
 
 #include <TimeSeries.h>
 
 class Vector;
+class SeriesFile;
 
 class PathTimeSeries : public TimeSeries
 {
@@ -72,6 +75,7 @@ class PathTimeSeries : public TimeSeries
 
     // method to get factor
     double getFactor(double pseudoTime);
+    int getFactors(const double *pseudoTimes, double *factors, int num);
     double getDuration ();
     double getPeakFactor ();
     double getTimeIncr (double pseudoTime);
@@ -94,6 +98,8 @@ class PathTimeSeries : public TimeSeries
     int lastSendCommitTag;
     Channel *lastChannel;
     bool useLast;
+    SeriesFile *pathFile;  // the binary files the data is mapped from, if any
+    SeriesFile *timeFile;
 };
 
 #endif
@@ -0,0 +1,260 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/pattern/SeriesFile.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of SeriesFile.
+//
+// What: "@(#) SeriesFile.cpp, revA"
+
+#include <SeriesFile.h>
+#include <OPS_Globals.h>
+
+#include <string.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <fstream>
+using std::ifstream;
+using std::ofstream;
+
+#include <iomanip>
+using std::ios;
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+static const char seriesMagic[] = "OPSSER01";
+static const int seriesHeaderSize = 8 + 4*sizeof(int) + sizeof(double);
+
+std::map<std::string, SeriesFile *> SeriesFile::theFiles;
+
+bool
+SeriesFile::isSeriesFile(const char *fileName)
+{
+  ifstream theFile(fileName, ios::in | ios::binary);
+  char start[8];
+  if (!theFile.read(start, 8))
+    return false;
+  return strncmp(start, seriesMagic, 8) == 0;
+}
+
+SeriesFile *
+SeriesFile::open(const char *fileName)
+{
+  std::map<std::string, SeriesFile *>::iterator it = theFiles.find(fileName);
+  if (it != theFiles.end()) {
+    it->second->numUsers++;
+    return it->second;
+  }
+
+  if (isSeriesFile(fileName) == false)
+    return 0;
+
+  SeriesFile *theFile = new SeriesFile(fileName);
+  if (theFile->theData == 0) {
+    delete theFile;
+    return 0;
+  }
+
+  theFiles[fileName] = theFile;
+  return theFile;
+}
+
+void
+SeriesFile::release(SeriesFile *theFile)
+{
+  if (theFile == 0)
+    return;
+
+  theFile->numUsers--;
+  if (theFile->numUsers == 0) {
+    theFiles.erase(theFile->fileName);
+    delete theFile;
+  }
+}
+
+SeriesFile::SeriesFile(const char *name)
+  :fileName(name), numColumns(0), numPoints(0), dt(0.0),
+   theData(0), length(0), numUsers(1)
+{
+#ifndef _WIN32
+  int fd = ::open(name, O_RDONLY);
+  if (fd < 0) {
+    opserr << "WARNING - SeriesFile::SeriesFile() - could not open file " << name << endln;
+    return;
+  }
+  struct stat info;
+  if (fstat(fd, &info) == 0)
+    length = (long)info.st_size;
+
+  // private so that the pages stay shared as long as no series writes them
+  void *data = MAP_FAILED;
+  if (length >= seriesHeaderSize)
+    data = mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    opserr << "WARNING - SeriesFile::SeriesFile() - could not map file " << name << endln;
+    return;
+  }
+  theData = (char *)data;
+#else
+  // no mmap, the file is read into memory
+  ifstream theFile(name, ios::in | ios::binary);
+  theFile.seekg(0, ios::end);
+  length = (long)theFile.tellg();
+  theFile.seekg(0, ios::beg);
+  if (length >= seriesHeaderSize) {
+    theData = (char *)malloc(length);
+    if (theData != 0 && !theFile.read(theData, length)) {
+      free(theData);
+      theData = 0;
+    }
+  }
+  if (theData == 0) {
+    opserr << "WARNING - SeriesFile::SeriesFile() - could not read file " << name << endln;
+    return;
+  }
+#endif
+
+  int *header = (int *)&theData[8];
+  numColumns = header[1];
+  numPoints = header[2];
+  dt = *(double *)&theData[8 + 4*sizeof(int)];
+
+  if (header[0] != 1 || numColumns < 1 || numPoints < 0 ||
+      seriesHeaderSize + (long)numColumns*numPoints*(long)sizeof(double) > length) {
+    opserr << "WARNING - SeriesFile::SeriesFile() - " << name;
+    opserr << " is not a series file written on a machine of this byte order\n";
+#ifndef _WIN32
+    munmap(theData, length);
+#else
+    free(theData);
+#endif
+    theData = 0;
+  }
+}
+
+SeriesFile::~SeriesFile()
+{
+  if (theData != 0) {
+#ifndef _WIN32
+    munmap(theData, length);
+#else
+    free(theData);
+#endif
+  }
+}
+
+double *
+SeriesFile::getColumn(int column) const
+{
+  if (column < 0 || column >= numColumns)
+    return 0;
+  return (double *)&theData[seriesHeaderSize] + (long)column*numPoints;
+}
+
+int
+textToSeries(const char *inputFilename, const char *outputFilename,
+	     const char *format, double dt)
+{
+  ifstream input(inputFilename, ios::in);
+  if (!input.is_open()) {
+    opserr << "WARNING - textToSeries() - could not open file " << inputFilename << endln;
+    return -1;
+  }
+
+  std::vector<double> data;
+  int numColumns = 1;
+  double value;
+
+  if (strcmp(format, "-peer") == 0 || strcmp(format, "-PEER") == 0) {
+
+    // three lines of title, then NPTS= nPts, DT= dt SEC or in the older
+    // format nPts dt NPTS, DT
+    std::string line;
+    for (int i=0; i<4; i++)
+      std::getline(input, line);
+    if (!input) {
+      opserr << "WARNING - textToSeries() - " << inputFilename << " is not a PEER record\n";
+      return -1;
+    }
+    const char *dtData = strstr(line.c_str(), "DT=");
+    if (dtData != 0)
+      dt = strtod(dtData+3, 0);
+    else {
+      char *next = 0;
+      strtol(line.c_str(), &next, 10);
+      dt = strtod(next, 0);
+    }
+    if (dt <= 0.0) {
+      opserr << "WARNING - textToSeries() - no time step in PEER record " << inputFilename << endln;
+      return -1;
+    }
+
+  } else if (strcmp(format, "-time") == 0) {
+    numColumns = 2;
+    dt = 0.0;
+  } else if (strcmp(format, "-values") != 0) {
+    opserr << "WARNING - textToSeries() - unknown format " << format;
+    opserr << ", -peer, -time or -values\n";
+    return -1;
+  }
+
+  while (input >> value)
+    data.push_back(value);
+  input.close();
+
+  int numPoints = (int)data.size()/numColumns;
+  if ((int)data.size() % numColumns != 0)
+    opserr << "WARNING - textToSeries() - num data entries in file NOT EVEN! " << inputFilename << endln;
+
+  ofstream output(outputFilename, ios::out | ios::binary);
+  if (!output.is_open()) {
+    opserr << "WARNING - textToSeries() - could not open file " << outputFilename << endln;
+    return -1;
+  }
+
+  int header[4] = {1, numColumns, numPoints, 0};
+  output.write(seriesMagic, 8);
+  output.write((const char *)header, 4*sizeof(int));
+  output.write((const char *)&dt, sizeof(double));
+
+  // time & value pairs are written column by column
+  for (int j=0; j<numColumns; j++)
+    for (int i=0; i<numPoints; i++)
+      output.write((const char *)&data[i*numColumns+j], sizeof(double));
+
+  output.close();
+  if (!output) {
+    opserr << "WARNING - textToSeries() - failed to write file " << outputFilename << endln;
+    return -1;
+  }
+
+  return 0;
+}
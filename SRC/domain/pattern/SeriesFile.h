@@ -0,0 +1,84 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/pattern/SeriesFile.h,v $
+
+#ifndef SeriesFile_h
+#define SeriesFile_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for SeriesFile.
+// A SeriesFile is a binary time series file mapped into memory, so that the
+// series reading it use the data in place instead of parsing text into a
+// Vector of their own. The file is mapped once per process and shared by
+// all the series that open it, and with mmap the pages are also shared by
+// the processes of a parallel run on a machine. The file is:
+//
+//   char[8]  "OPSSER01"
+//   int      1              (byte order check)
+//   int      numColumns     (1 values, 2 times & values)
+//   int      numPoints
+//   int      0
+//   double   dt             (the time step of a PEER record, else 0)
+//   numColumns x numPoints doubles, column by column
+//
+// textToSeries() writes the file from a text file of values, of time &
+// value pairs or a PEER/NGA record (.AT2).
+//
+// What: "@(#) SeriesFile.h, revA"
+
+#include <map>
+#include <string>
+
+int textToSeries(const char *inputFilename, const char *outputFilename,
+		 const char *format, double dt = 0.0);
+
+class SeriesFile
+{
+  public:
+    // returns 0 if the file is not a series file
+    static SeriesFile *open(const char *fileName);
+    static void release(SeriesFile *theFile);
+    static bool isSeriesFile(const char *fileName);
+
+    const char *getFileName(void) const {return fileName.c_str();}
+    int getNumColumns(void) const {return numColumns;}
+    int getNumPoints(void) const {return numPoints;}
+    double getTimeIncr(void) const {return dt;}
+    double *getColumn(int column) const;
+
+  private:
+    SeriesFile(const char *fileName);
+    ~SeriesFile();
+
+    std::string fileName;
+    int numColumns, numPoints;
+    double dt;
+    char *theData;        // the mapped file
+    long length;
+    int numUsers;
+
+    static std::map<std::string, SeriesFile *> theFiles;
+};
+
+#endif
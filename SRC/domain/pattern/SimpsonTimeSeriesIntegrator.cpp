@@ -86,13 +86,18 @@ TimeSeries* SimpsonTimeSeriesIntegrator::integrate(TimeSeries *theSeries, double
         return 0;
     }
     
-    double t = 0.0;
     double fi, fj, fk;
     
+    // evaluate the series at all the times at once
+    Vector f(numSteps+2);
+    for (int i=0; i<numSteps+2; i++)
+        f[i] = i*delta;
+    theSeries->getFactors(&f[0], &f[0], numSteps+2);
+    
     // set the first two integrated values (assume that f(0) = 0)
-    fi = theSeries->getFactor(0.0);
-    fj = theSeries->getFactor(delta);
-    fk = theSeries->getFactor(2.0*delta);
+    fi = f[0];
+    fj = f[1];
+    fk = f[2];
     (*theInt)[0] = 0.0;
     (*theInt)[1] = delta/12.0*(5.0*fi + 8.0*fj - fk);
     
@@ -104,7 +109,7 @@ TimeSeries* SimpsonTimeSeriesIntegrator::integrate(TimeSeries *theSeries, double
         // update function values
         fi = fj;
         fj = fk;
-        fk = theSeries->getFactor((i+1)*delta);
+        fk = f[i+1];
     }
     
     // calculate the last integrated value
@@ -112,6 +117,7 @@ TimeSeries* SimpsonTimeSeriesIntegrator::integrate(TimeSeries *theSeries, double
     
     // set the method return value
     PathSeries *returnSeries = new PathSeries(0, *theInt, delta, true);
+    delete theInt;
     
     if (returnSeries == 0)  {
         opserr << "SimpsonTimeSeriesIntegrator::integrate() - ran out of memory creating PathSeries.\n";
@@ -71,6 +71,20 @@ SimulatedRandomProcessSeries::SimulatedRandomProcessSeries(int tag,
 	deltaW = (theSpectrum->getMaxFrequency()-theSpectrum->getMinFrequency())/numFreqIntervals;
 
 
+	// The spectrum at the midpoint of each interval does not change with
+	// time, so evaluate it once here rather than at every getFactor()
+	W = new Vector(numFreqIntervals);
+	amplitude = new Vector(numFreqIntervals);
+	for (int i=0; i<numFreqIntervals; i++) {
+		double Wi = (i+0.5)*deltaW+theSpectrum->getMinFrequency();
+		double S = theSpectrum->getAmplitude(Wi);
+		(*W)(i) = Wi;
+		(*amplitude)(i) = sqrt(2.0*S*deltaW) * (*A)(i);
+	}
+
+	lastTime = 0.0;
+	lastFactor = 0.0;
+
 }
 
 
@@ -87,6 +101,10 @@ SimulatedRandomProcessSeries::~SimulatedRandomProcessSeries()
 		delete theta;
 	if (A != 0) 
 		delete A;
+	if (W != 0)
+		delete W;
+	if (amplitude != 0)
+		delete amplitude;
 }
 
 
@@ -98,19 +116,23 @@ SimulatedRandomProcessSeries::getFactor(double time)
 	if (time == 0.0) {
 		return 0.0;
 	}
+	else if (time == lastTime) {
+		// the load pattern asks again at each iteration of the step
+		return lastFactor;
+	}
 	else {
 
 		// Add up over all frequency intervals
 		double factor = 0.0;
-		double W, S;
 		for (int i=0; i<numFreqIntervals; i++) {
-			W = (i+0.5)*deltaW+theSpectrum->getMinFrequency();
-			S = theSpectrum->getAmplitude(W);
-			factor += sqrt(2.0*S*deltaW) * (*A)(i) * cos(W*time+(*theta)(i));
+			factor += (*amplitude)(i) * cos((*W)(i)*time+(*theta)(i));
 		}
 
 //outputFile << (mean+factor) << endl;
 
+		lastTime = time;
+		lastFactor = mean + factor;
+
 		return (mean + factor);
 	}
 }
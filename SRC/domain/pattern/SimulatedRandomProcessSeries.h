@@ -78,6 +78,12 @@ private:
 	double deltaW;
 	Vector *theta;
 	Vector *A;
+
+	// the frequency and amplitude of each interval, and the last factor
+	Vector *W;
+	Vector *amplitude;
+	double lastTime;
+	double lastFactor;
 };
 
 #endif
@@ -38,19 +38,27 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theTimeSeriesObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theTimeSeriesObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theTimeSeriesObjects(void)
+{
+  if (theTimeSeriesObjectsPtr == 0)
+    theTimeSeriesObjectsPtr = new MapOfTaggedObjects();
+  return *theTimeSeriesObjectsPtr;
+}
 
 bool OPS_addTimeSeries(TimeSeries *newComponent) {
-  return theTimeSeriesObjects.addComponent(newComponent);
+  return theTimeSeriesObjects().addComponent(newComponent);
 }
 
 bool OPS_removeTimeSeries(int tag) {
-  return (theTimeSeriesObjects.removeComponent(tag) != 0);
+  return (theTimeSeriesObjects().removeComponent(tag) != 0);
 }
 
 TimeSeries *OPS_getTimeSeries(int tag) {
 
-  TaggedObject *theResult = theTimeSeriesObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theTimeSeriesObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "TimeSeries *getTimeSeries(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -61,7 +69,7 @@ TimeSeries *OPS_getTimeSeries(int tag) {
 }
 
 void OPS_clearAllTimeSeries(void) {
-  theTimeSeriesObjects.clearAll();
+  theTimeSeriesObjects().clearAll();
 }
     
 
@@ -81,3 +89,11 @@ TimeSeries::~TimeSeries()
 {
 
 }
+
+int
+TimeSeries::getFactors(const double *pseudoTimes, double *factors, int num)
+{
+  for (int i=0; i<num; i++)
+    factors[i] = this->getFactor(pseudoTimes[i]);
+  return 0;
+}
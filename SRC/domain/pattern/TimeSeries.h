@@ -56,6 +56,11 @@ class TimeSeries : public TaggedObject, public MovableObject
     virtual double getDuration () = 0;
     virtual double getPeakFactor () = 0;
 
+    // the factors at num times, as getFactor() at each; the two arrays
+    // may be the same. Series that can do better for increasing times, as
+    // when integrated, override it
+    virtual int getFactors(const double *pseudoTimes, double *factors, int num);
+
     virtual double getTimeIncr (double pseudoTime) = 0;
     // This is defined to be the time increment from the argument
     // 'pseudoTime' to the NEXT point in the time series path
@@ -89,27 +89,28 @@ TrapezoidalTimeSeriesIntegrator::integrate(TimeSeries *theSeries, double delta)
   }
 
   int i;                // Counter for indexing
-  double dummyTime;     // Dummy variable for integrating
   double previousValue; // Temporary storage to avoid accessing same value twice
 	                        // through identical method calls
   double currentValue;
+
+  // the series is evaluated at all the times at once, in place in the
+  // integrated values
+  double *values = &(*theIntegratedValues)[0];
+  for (i = 0; i < numSteps; i++)
+    values[i] = i*delta;
+  theSeries->getFactors(values, values, numSteps);
       
   // Set the first point
   // Assuming initial condition is zero, i.e. F(0) = 0
 
-
-  (*theIntegratedValues)[0] = theSeries->getFactor(0.0) * delta * 0.5;
-
-  previousValue = (*theIntegratedValues)[0];
-  
-  dummyTime = delta;
+  previousValue = values[0] * delta * 0.5;
+  values[0] = previousValue;
     
-  for (i = 1; i < numSteps; i++, dummyTime += delta) {
-    currentValue = theSeries->getFactor(dummyTime);
+  for (i = 1; i < numSteps; i++) {
+    currentValue = values[i];
     
     // Apply the trapezoidal rule to update the integrated value
-    (*theIntegratedValues)[i] = (*theIntegratedValues)[i-1] +
-      delta*0.5 * (currentValue + previousValue);
+    values[i] = values[i-1] + delta*0.5 * (currentValue + previousValue);
     
     previousValue = currentValue;
   }
@@ -122,6 +123,7 @@ TrapezoidalTimeSeriesIntegrator::integrate(TimeSeries *theSeries, double delta)
 
   // Set the method return value
   PathSeries *returnSeries = new PathSeries (0, *theIntegratedValues, delta, true);
+  delete theIntegratedValues;
 
   if (returnSeries == 0) {
     opserr << "TrapezoidalTimeSeriesIntegrator::integrate() Ran out of memory creating PathSeries\n";
@@ -39,6 +39,15 @@ Vector PlaneDRMInputHandler::Vtempm1(3);
 Vector PlaneDRMInputHandler::Vtempp1(3);
 Vector PlaneDRMInputHandler::Vtempp2(3);
 
+#ifndef _WIN32
+extern "C" void *
+drmPrefetcher(void *theHandler)
+{
+  ((PlaneDRMInputHandler *)theHandler)->prefetchWindows();
+  return 0;
+}
+#endif
+
 
 
 
@@ -170,11 +179,48 @@ PlaneDRMInputHandler::PlaneDRMInputHandler(int tag, char** in_files, int files,
   nd1 = _nd1;
   nd2 = _nd2;
 
+  for (int j=0; j<4; j++)
+    stage[j] = new double[3*(this->cacheValue + 1)*this->fileData[3*j]];
+  stage[4] = new double[3*(this->cacheValue + 1)*(nd1 + nd2)];
+  stageRem = -1;
+  stageFull = false;
+  finished = false;
+  threaded = false;
+
+#ifndef _WIN32
+  pthread_mutex_init(&lock, 0);
+  pthread_cond_init(&windowFull, 0);
+  pthread_cond_init(&windowWanted, 0);
+  if (pthread_create(&prefetcher, 0, drmPrefetcher, (void *)this) == 0)
+    threaded = true;
+  else {
+    opserr << "WARNING PlaneDRMInputHandler - could not start prefetch thread, reading in step\n";
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&windowFull);
+    pthread_cond_destroy(&windowWanted);
+  }
+#endif
+
   populateBuffers();
 }
 
 PlaneDRMInputHandler::~PlaneDRMInputHandler()
 {
+#ifndef _WIN32
+  if (threaded == true) {
+    pthread_mutex_lock(&lock);
+    finished = true;
+    pthread_cond_signal(&windowWanted);
+    pthread_mutex_unlock(&lock);
+    pthread_join(prefetcher, 0);
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&windowFull);
+    pthread_cond_destroy(&windowWanted);
+  }
+#endif
+  for (int j=0; j<5; j++)
+    delete [] stage[j];
+
   delete [] f1buffer;
   delete [] f2buffer;
   delete [] f3buffer;
@@ -252,7 +298,8 @@ void PlaneDRMInputHandler::populateBuffers()
     timeBuf[2] = deltaT;
     for (int i=0; i<this->cacheValue+1; i++)
       timeBuf[3+i] = timeBuf[2+i]+this->deltaT;
-    
+
+    this->requestWindow();
   }
   else {
     int rem = numSteps - globalCounter;
@@ -263,69 +310,21 @@ void PlaneDRMInputHandler::populateBuffers()
     else {
       rem = cacheValue;
     }
-    int temp = this->fileData[0];
-    for (int i=0; i<3*temp; i++) {
-      f1buffer[i] = f1buffer[i+ 3*(cacheValue+1)*temp];
-      f1buffer[i+3*temp] = f1buffer[i+3*(cacheValue+2)*temp];			
-      f1buffer[i+6*temp] = f1buffer[i+3*(cacheValue+3)*temp];			
-    }
-    double dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile1 >> dataIn;
-      f1buffer[i] = dataIn;
-    }
-    temp = this->fileData[3];
-    for (int i=0; i<3*temp; i++) {
-      f2buffer[i] = f2buffer[i+ 3*(cacheValue+1)*temp];
-      f2buffer[i+3*temp] = f2buffer[i+3*(cacheValue+2)*temp];			
-      f2buffer[i+6*temp] = f2buffer[i+3*(cacheValue+3)*temp];			
-    }
-    dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile2 >> dataIn;
-      f2buffer[i] = dataIn;
-    }
-    temp = this->fileData[6];
-    for (int i=0; i<3*temp; i++) {
-      f3buffer[i] = f3buffer[i+ 3*(cacheValue+1)*temp];
-      f3buffer[i+3*temp] = f3buffer[i+3*(cacheValue+2)*temp];			
-      f3buffer[i+6*temp] = f3buffer[i+3*(cacheValue+3)*temp];			
-    }
-    dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile3 >> dataIn;
-      f3buffer[i] = dataIn;
-    }
-    temp = this->fileData[9];
-    for (int i=0; i<3*temp; i++) {
-      f4buffer[i] = f4buffer[i+ 3*(cacheValue+1)*temp];
-      f4buffer[i+3*temp] = f4buffer[i+3*(cacheValue+2)*temp];			
-      f4buffer[i+6*temp] = f4buffer[i+3*(cacheValue+3)*temp];			
-    }
-    dataIn=0.0;
-    for (int i=9*temp; i<3*(rem + 4)*temp; i++) {
-      ifile4 >> dataIn;
-      f4buffer[i] = dataIn;
-    }
-    temp = this->fileData[12];
-    for (int i=0; i<3*temp; i++) {
-      f5buffer[i] = f5buffer[i+ 3*(cacheValue+1)*temp];
-      f5buffer[i+3*temp] = f5buffer[i+3*(cacheValue+2)*temp];			
-      f5buffer[i+6*temp] = f5buffer[i+3*(cacheValue+3)*temp];			
-    }
-    dataIn=0.0;
-    int index = 9*temp;
-    //need some change here for two files
-    //for (int i=6*temp; i<3*(rem + 3)*temp; i++) {
-    for (int k=3; k<(cacheValue +4); k++) {
-      for (int i=0; i<3*nd1; i++) {
-	ifile5a >> dataIn;
-	f5buffer[index++] = dataIn;
-      }
-      for (int i=0; i<3*nd2; i++) {
-	ifile5b >> dataIn;
-	f5buffer[index++] = dataIn;
+    // keep the last three steps of the window, then copy in the new ones
+    this->takeWindow(rem);
+
+    for (int j=0; j<5; j++) {
+      double *buffer = buffers[j];
+      int temp = this->fileData[3*j];
+      for (int i=0; i<3*temp; i++) {
+	buffer[i] = buffer[i+ 3*(cacheValue+1)*temp];
+	buffer[i+3*temp] = buffer[i+3*(cacheValue+2)*temp];
+	buffer[i+6*temp] = buffer[i+3*(cacheValue+3)*temp];
       }
+      int numNew = (j < 4) ? 3*(rem + 1)*temp : 3*(cacheValue + 1)*(nd1 + nd2);
+      double *newData = stage[j];
+      for (int i=0; i<numNew; i++)
+	buffer[9*temp + i] = newData[i];
     }
     globalCounter += cacheValue+1;
 
@@ -335,8 +334,99 @@ void PlaneDRMInputHandler::populateBuffers()
     timeBuf[2] = timeBuf[this->cacheValue+3];
     for (int i=0; i<this->cacheValue+1; i++)
       timeBuf[3+i] = timeBuf[2+i]+this->deltaT;
-    
+
+    this->requestWindow();
+  }
+}
+
+// reads the steps of the next window from the files into the stage
+// buffers, the same values the old in-step read put after the kept steps
+void PlaneDRMInputHandler::readWindow(int rem)
+{
+  std::ifstream *files[4] = {&ifile1, &ifile2, &ifile3, &ifile4};
+
+  double dataIn=0.0;
+  for (int j=0; j<4; j++) {
+    int numNew = 3*(rem + 1)*this->fileData[3*j];
+    double *newData = stage[j];
+    for (int i=0; i<numNew; i++) {
+      *files[j] >> dataIn;
+      newData[i] = dataIn;
+    }
+  }
+
+  int index = 0;
+  for (int k=3; k<(cacheValue +4); k++) {
+    for (int i=0; i<3*nd1; i++) {
+      ifile5a >> dataIn;
+      stage[4][index++] = dataIn;
+    }
+    for (int i=0; i<3*nd2; i++) {
+      ifile5b >> dataIn;
+      stage[4][index++] = dataIn;
+    }
+  }
+}
+
+// waits for the prefetch thread to finish the window requested at the end
+// of the last populateBuffers(), or reads it now if there is no thread
+void PlaneDRMInputHandler::takeWindow(int rem)
+{
+#ifndef _WIN32
+  if (threaded == true) {
+    pthread_mutex_lock(&lock);
+    while (stageFull == false)
+      pthread_cond_wait(&windowFull, &lock);
+    pthread_mutex_unlock(&lock);
+    return;
+  }
+#endif
+  this->readWindow(rem);
+}
+
+// asks the prefetch thread for the window the next populateBuffers() will
+// need; the rem computed there depends only on globalCounter, set by now
+void PlaneDRMInputHandler::requestWindow(void)
+{
+#ifndef _WIN32
+  if (threaded == false)
+    return;
+
+  int rem = numSteps - globalCounter;
+  if (rem > cacheValue)
+    rem = cacheValue;
+
+  pthread_mutex_lock(&lock);
+  stageFull = false;
+  stageRem = rem;
+  if (rem >= 0)
+    pthread_cond_signal(&windowWanted);
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+void PlaneDRMInputHandler::prefetchWindows(void)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+  while (true) {
+    while ((stageRem < 0 || stageFull == true) && finished == false)
+      pthread_cond_wait(&windowWanted, &lock);
+    if (finished == true)
+      break;
+
+    int rem = stageRem;
+    pthread_mutex_unlock(&lock);
+
+    this->readWindow(rem);
+
+    pthread_mutex_lock(&lock);
+    stageFull = true;
+    stageRem = -1;
+    pthread_cond_signal(&windowFull);
   }
+  pthread_mutex_unlock(&lock);
+#endif
 }
 
 void PlaneDRMInputHandler::getMotions(Element* eletag, double time, Vector& U, Vector& Ud, Vector& Udd)
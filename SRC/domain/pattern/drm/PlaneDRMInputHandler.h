@@ -21,6 +21,10 @@
 #include "Mesh3DSubdomain.h"
 #include <math.h>
 
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
 class PlaneDRMInputHandler : public DRMInputHandler {
   
  public:
@@ -52,9 +56,16 @@ class PlaneDRMInputHandler : public DRMInputHandler {
   void pointerCopy(int node_from, int node_to);
   void populateTempBuffers(int index, int fileptr, double ksi, double eta);
 
+  // run by the prefetch thread
+  void prefetchWindows(void);
+
   
   private :
     
+  void readWindow(int rem);
+  void takeWindow(int rem);
+  void requestWindow(void);
+
     bool initial;
   
   double* f1buffer;
@@ -117,6 +128,21 @@ class PlaneDRMInputHandler : public DRMInputHandler {
   int globalCounter;
   int localCounter;
   GeometricBrickDecorator* myDecorator;
+
+  // the steps of the next cache window are read from the files into the
+  // stage buffers by a prefetch thread (pthreads, not on _WIN32) while the
+  // current window is in use, and copied in by populateBuffers()
+  double* stage[5];
+  int stageRem;      // rem of the window requested, -1 if none
+  bool stageFull;
+  bool finished;
+  bool threaded;
+#ifndef _WIN32
+  pthread_t prefetcher;
+  pthread_mutex_t lock;
+  pthread_cond_t windowFull;
+  pthread_cond_t windowWanted;
+#endif
   
   // some helpers perhaps
 };
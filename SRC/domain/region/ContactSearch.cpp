@@ -0,0 +1,395 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/region/ContactSearch.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ContactSearch.
+//
+// What: "@(#) ContactSearch.cpp, revA"
+
+#include <ContactSearch.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <math.h>
+
+static const int MASTER = 0;
+static const int SLAVE = 1;
+
+static double
+distance(const double *a, const double *b)
+{
+  double d0 = a[0]-b[0];
+  double d1 = a[1]-b[1];
+  double d2 = a[2]-b[2];
+  return sqrt(d0*d0 + d1*d1 + d2*d2);
+}
+
+ContactSearch::ContactSearch(int tag, const ID &masterNodes, const ID &slaveNodes,
+			     double r, double s, bool n)
+  :TaggedObject(tag), masterTags(masterNodes), slaveTags(slaveNodes),
+   radius(r), skin(s), nearest(n), ndm(0), numBuckets(16),
+   candidates(0), paired(0), newPairs(0), pairs(0), numNewPairs(0), numPairs(0)
+{
+  numNodes[MASTER] = masterNodes.Size();
+  numNodes[SLAVE] = slaveNodes.Size();
+
+  int maxNodes = numNodes[MASTER] > numNodes[SLAVE] ? numNodes[MASTER] : numNodes[SLAVE];
+  while (numBuckets < 2*maxNodes)
+    numBuckets *= 2;
+
+  for (int g=0; g<2; g++) {
+    int n = numNodes[g];
+    x[g] = new double[3*n+1];
+    xRef[g] = new double[3*n+1];
+    xLast[g] = new double[3*n+1];
+    cell[g] = new int[3*n+1];
+    head[g] = new int[numBuckets];
+    next[g] = new int[n+1];
+    moved[g] = new bool[n+1];
+  }
+
+  candidates = new std::vector<int>[numNodes[SLAVE]+1];
+  paired = new std::vector<int>[numNodes[SLAVE]+1];
+}
+
+ContactSearch::~ContactSearch()
+{
+  for (int g=0; g<2; g++) {
+    delete [] x[g];
+    delete [] xRef[g];
+    delete [] xLast[g];
+    delete [] cell[g];
+    delete [] head[g];
+    delete [] next[g];
+    delete [] moved[g];
+  }
+
+  delete [] candidates;
+  delete [] paired;
+}
+
+int
+ContactSearch::search(Domain &theDomain)
+{
+  if (this->getPositions(theDomain) < 0)
+    return -1;
+
+  // bin all the nodes
+  for (int g=0; g<2; g++) {
+    for (int b=0; b<numBuckets; b++)
+      head[g][b] = -1;
+    for (int i=0; i<numNodes[g]; i++) {
+      this->bin(g, i);
+      moved[g][i] = true;
+    }
+  }
+
+  for (int s=0; s<numNodes[SLAVE]; s++) {
+    paired[s].clear();
+    this->findCandidates(s);
+  }
+
+  numPairs = 0;
+  pairs = ID(0);
+
+  return this->findPairs(true);
+}
+
+int
+ContactSearch::update(Domain &theDomain)
+{
+  if (ndm == 0)
+    return this->search(theDomain);
+
+  if (this->getPositions(theDomain) < 0)
+    return -1;
+
+  double halfSkin = 0.5*skin;
+
+  // re-bin the nodes moved more than half the skin, the candidates of
+  // the slave nodes are found again and the master nodes are added to
+  // the candidates of the slave nodes near them
+  std::vector<int> rebinned;
+  for (int g=0; g<2; g++) {
+    for (int i=0; i<numNodes[g]; i++) {
+      double *xi = &x[g][3*i];
+      moved[g][i] = distance(xi, &xLast[g][3*i]) > 0.0;
+      if (moved[g][i] && distance(xi, &xRef[g][3*i]) > halfSkin) {
+	this->unbin(g, i);
+	this->bin(g, i);
+	if (g == SLAVE)
+	  this->findCandidates(i);
+	else
+	  rebinned.push_back(i);
+      }
+    }
+  }
+
+  for (unsigned int l=0; l<rebinned.size(); l++)
+    this->addCandidate(rebinned[l]);
+
+  return this->findPairs(false);
+}
+
+const ID &
+ContactSearch::getNewPairs(void)
+{
+  return newPairs;
+}
+
+const ID &
+ContactSearch::getPairs(void)
+{
+  return pairs;
+}
+
+void
+ContactSearch::Print(OPS_Stream &s, int flag)
+{
+  s << "ContactSearch: " << this->getTag() << endln;
+  s << "\tmaster nodes: " << numNodes[MASTER] << " slave nodes: " << numNodes[SLAVE] << endln;
+  s << "\tradius: " << radius << " skin: " << skin;
+  if (nearest == true)
+    s << " nearest";
+  s << endln;
+  s << "\tpairs: " << numPairs << endln;
+}
+
+int
+ContactSearch::getPositions(Domain &theDomain)
+{
+  for (int g=0; g<2; g++) {
+    const ID &theTags = g == MASTER ? masterTags : slaveTags;
+    for (int i=0; i<numNodes[g]; i++) {
+      Node *theNode = theDomain.getNode(theTags(i));
+      if (theNode == 0) {
+	opserr << "WARNING ContactSearch::getPositions() - node " << theTags(i)
+	       << " not found in the domain\n";
+	return -1;
+      }
+
+      const Vector &crd = theNode->getCrds();
+      const Vector &disp = theNode->getTrialDisp();
+      if (ndm == 0)
+	ndm = crd.Size() < 3 ? crd.Size() : 3;
+
+      double *xi = &x[g][3*i];
+      for (int d=0; d<3; d++) {
+	xi[d] = 0.0;
+	if (d < ndm && d < crd.Size()) {
+	  xi[d] = crd(d);
+	  if (d < disp.Size())
+	    xi[d] += disp(d);
+	}
+      }
+    }
+  }
+
+  return 0;
+}
+
+// hashes the cell of a node into a bucket
+static int
+getBucket(const int *c, int numBuckets)
+{
+  unsigned int h = ((unsigned int)c[0]*73856093u) ^ ((unsigned int)c[1]*19349663u) ^
+    ((unsigned int)c[2]*83492791u);
+  return (int)(h & (unsigned int)(numBuckets-1));
+}
+
+void
+ContactSearch::bin(int g, int i)
+{
+  double h = radius + skin;
+
+  double *xi = &x[g][3*i];
+  double *xr = &xRef[g][3*i];
+  int *c = &cell[g][3*i];
+  for (int d=0; d<3; d++) {
+    xr[d] = xi[d];
+    c[d] = (int)floor(xi[d]/h);
+  }
+
+  int b = getBucket(c, numBuckets);
+  next[g][i] = head[g][b];
+  head[g][b] = i;
+}
+
+void
+ContactSearch::unbin(int g, int i)
+{
+  int b = getBucket(&cell[g][3*i], numBuckets);
+  int *link = &head[g][b];
+  while (*link != -1) {
+    if (*link == i) {
+      *link = next[g][i];
+      return;
+    }
+    link = &next[g][*link];
+  }
+}
+
+// the master nodes binned within the radius plus the skin of slave node s
+void
+ContactSearch::findCandidates(int s)
+{
+  std::vector<int> &theCandidates = candidates[s];
+  theCandidates.clear();
+
+  double h = radius + skin;
+  const double *xs = &xRef[SLAVE][3*s];
+  const int *cs = &cell[SLAVE][3*s];
+  int nz = ndm > 2 ? 1 : 0;
+
+  int c[3];
+  for (int i=-1; i<=1; i++)
+    for (int j=-1; j<=1; j++)
+      for (int k=-nz; k<=nz; k++) {
+	c[0] = cs[0]+i;
+	c[1] = cs[1]+j;
+	c[2] = cs[2]+k;
+	int m = head[MASTER][getBucket(c, numBuckets)];
+	while (m != -1) {
+	  const int *cm = &cell[MASTER][3*m];
+	  if (cm[0] == c[0] && cm[1] == c[1] && cm[2] == c[2] &&
+	      distance(xs, &xRef[MASTER][3*m]) <= h)
+	    theCandidates.push_back(m);
+	  m = next[MASTER][m];
+	}
+      }
+}
+
+// adds master node m to the candidates of the slave nodes binned within
+// the radius plus the skin of it
+void
+ContactSearch::addCandidate(int m)
+{
+  double h = radius + skin;
+  const double *xm = &xRef[MASTER][3*m];
+  const int *cm = &cell[MASTER][3*m];
+  int nz = ndm > 2 ? 1 : 0;
+
+  int c[3];
+  for (int i=-1; i<=1; i++)
+    for (int j=-1; j<=1; j++)
+      for (int k=-nz; k<=nz; k++) {
+	c[0] = cm[0]+i;
+	c[1] = cm[1]+j;
+	c[2] = cm[2]+k;
+	int s = head[SLAVE][getBucket(c, numBuckets)];
+	while (s != -1) {
+	  const int *cs = &cell[SLAVE][3*s];
+	  if (cs[0] == c[0] && cs[1] == c[1] && cs[2] == c[2] &&
+	      distance(xm, &xRef[SLAVE][3*s]) <= h) {
+	    std::vector<int> &theCandidates = candidates[s];
+	    int n = theCandidates.size();
+	    int l = 0;
+	    while (l < n && theCandidates[l] != m)
+	      l++;
+	    if (l == n)
+	      theCandidates.push_back(m);
+	  }
+	  s = next[SLAVE][s];
+	}
+      }
+}
+
+// tests the candidates of the slave nodes that have moved, or whose
+// candidates have moved, against the radius
+int
+ContactSearch::findPairs(bool all)
+{
+  numNewPairs = 0;
+  newPairs = ID(0);
+
+  for (int s=0; s<numNodes[SLAVE]; s++) {
+    std::vector<int> &theCandidates = candidates[s];
+    int n = theCandidates.size();
+
+    bool test = all || moved[SLAVE][s];
+    for (int l=0; l<n && test == false; l++)
+      test = moved[MASTER][theCandidates[l]];
+    if (test == false)
+      continue;
+
+    const double *xs = &x[SLAVE][3*s];
+    int closest = -1;
+    double closestDistance = radius;
+
+    for (int l=0; l<n; l++) {
+      int m = theCandidates[l];
+      double d = distance(xs, &x[MASTER][3*m]);
+      if (d > radius)
+	continue;
+
+      if (nearest == true) {
+	if (closest == -1 || d < closestDistance) {
+	  closest = m;
+	  closestDistance = d;
+	}
+	continue;
+      }
+
+      std::vector<int> &thePaired = paired[s];
+      int numPaired = thePaired.size();
+      int p = 0;
+      while (p < numPaired && thePaired[p] != m)
+	p++;
+      if (p == numPaired) {
+	thePaired.push_back(m);
+	newPairs[2*numNewPairs] = slaveTags(s);
+	newPairs[2*numNewPairs+1] = masterTags(m);
+	numNewPairs++;
+      }
+    }
+
+    if (closest != -1) {
+      std::vector<int> &thePaired = paired[s];
+      int numPaired = thePaired.size();
+      int p = 0;
+      while (p < numPaired && thePaired[p] != closest)
+	p++;
+      if (p == numPaired) {
+	thePaired.push_back(closest);
+	newPairs[2*numNewPairs] = slaveTags(s);
+	newPairs[2*numNewPairs+1] = masterTags(closest);
+	numNewPairs++;
+      }
+    }
+  }
+
+  for (int g=0; g<2; g++) {
+    int n = 3*numNodes[g];
+    for (int i=0; i<n; i++)
+      xLast[g][i] = x[g][i];
+  }
+
+  for (int i=0; i<2*numNewPairs; i++)
+    pairs[2*numPairs+i] = newPairs(i);
+  numPairs += numNewPairs;
+
+  return numNewPairs;
+}
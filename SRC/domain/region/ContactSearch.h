@@ -0,0 +1,112 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/domain/region/ContactSearch.h,v $
+
+#ifndef ContactSearch_h
+#define ContactSearch_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for ContactSearch.
+// A ContactSearch finds the pairs of a slave node and a master node closer
+// than a radius, e.g. to create the contact elements of the pairs, without
+// testing every slave node against every master node. The positions of the
+// nodes are their coordinates plus their trial displacements.
+//
+// The master and slave nodes are binned in uniform grids, kept in hash
+// tables, with cells of the radius plus a skin. search() finds for each
+// slave node the candidate master nodes within the radius plus the skin.
+// update() re-bins only the nodes that have moved more than half the skin
+// since they were last binned, and finds the candidates of these nodes
+// again; the candidates of the other slave nodes are still complete, as
+// two nodes that have each moved less than half the skin can only have
+// come within the radius if they were within the radius plus the skin. Only
+// the slave nodes that have moved, or whose candidates have moved, are then
+// tested against the radius.
+//
+// A pair found is kept, so search() and update() return the number of new
+// pairs, given by getNewPairs() as slave and master tags; getPairs() gives
+// all of them. With nearest only the nearest master node within the radius
+// of a slave node is paired with it.
+
+// What: "@(#) ContactSearch.h, revA"
+
+#include <TaggedObject.h>
+#include <ID.h>
+#include <vector>
+
+class Domain;
+class Node;
+
+class ContactSearch : public TaggedObject
+{
+  public:
+    ContactSearch(int tag, const ID &masterNodes, const ID &slaveNodes,
+		  double radius, double skin, bool nearest = false);
+    ~ContactSearch();
+
+    int search(Domain &theDomain);
+    int update(Domain &theDomain);
+
+    const ID &getNewPairs(void);
+    const ID &getPairs(void);
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  protected:
+
+  private:
+    int getPositions(Domain &theDomain);
+    void bin(int group, int i);
+    void unbin(int group, int i);
+    void findCandidates(int s);
+    void addCandidate(int m);
+    int findPairs(bool all);
+
+    ID masterTags, slaveTags;
+    double radius, skin;
+    bool nearest;
+
+    int ndm;
+    int numBuckets;
+
+    // of the master nodes [0] and the slave nodes [1]
+    int numNodes[2];
+    double *x[2];       // current positions
+    double *xRef[2];    // positions when binned
+    double *xLast[2];   // positions when last tested
+    int *cell[2];       // cells when binned
+    int *head[2];       // first node in a bucket
+    int *next[2];       // next node in the bucket
+    bool *moved[2];     // moved since last tested
+
+    std::vector<int> *candidates;   // of each slave node
+    std::vector<int> *paired;       // of each slave node
+
+    ID newPairs;
+    ID pairs;
+    int numNewPairs;
+    int numPairs;
+};
+
+#endif
@@ -49,6 +49,7 @@
 #include <FEM_ObjectBroker.h>
 #include <SP_Constraint.h>
 #include <elementAPI.h>
+#include <set>
 
 MeshRegion::MeshRegion(int tag) 
   :DomainComponent(tag, REGION_TAG_MeshRegion), 
@@ -104,13 +105,15 @@ MeshRegion::setNodes(const ID &theNods)
     return -1;
   }
 
-  // add nodes to the node list if in the domain
+  // add nodes to the node list if in the domain, the set of the tags
+  // is kept to test membership
+  std::set<int> nodeSet;
   int loc = 0;
   for (int i=0; i<numNodes; i++) {
     int nodeTag = theNods(i);
     Node *theNode = theDomain->getNode(nodeTag);
     if (theNode != 0) {
-      if (theNodes->getLocation(nodeTag) < 0)
+      if (nodeSet.insert(nodeTag).second == true)
 	(*theNodes)[loc++] = nodeTag;      
     }
   }
@@ -134,7 +137,7 @@ MeshRegion::setNodes(const ID &theNods)
 
     for (int i=0; i<numNodes; i++) {
       int nodeTag = theEleNodes(i);
-      if (theNodes->getLocation(nodeTag) < 0) {
+      if (nodeSet.find(nodeTag) == nodeSet.end()) {
 	in = false;
 	i = numNodes;
       }
@@ -182,13 +185,17 @@ MeshRegion::setElements(const ID &theEles)
     return -1;
   }
 
+  // the sets of the tags added are kept to test membership
+  std::set<int> eleSet;
+  std::set<int> nodeSet;
+
   Element *theEle;
   for (int i=0; i<numEle; i++) {
     int eleTag = theEles(i);
     theEle = theDomain->getElement(eleTag);
     if (theEle != 0) {
 
-      if (theElements->getLocation(eleTag) < 0)
+      if (eleSet.insert(eleTag).second == true)
 	  (*theElements)[locEle++] = eleTag;
 
       const ID &theEleNodes = theEle->getExternalNodes();
@@ -196,7 +203,7 @@ MeshRegion::setElements(const ID &theEles)
       for (int i=0; i<theEleNodes.Size(); i++) {
 	int nodeTag = theEleNodes(i);
 	// add the node tag if not already there
-	if (theNodes->getLocation(nodeTag) < 0)
+	if (nodeSet.insert(nodeTag).second == true)
 	  (*theNodes)[locNode++] = nodeTag;
       }
     }
@@ -209,8 +216,11 @@ MeshRegion::setElements(const ID &theEles)
 const ID &
 MeshRegion::getNodes(void)
 {
-  if (theNodes == 0)
+  static ID noTags(0);
+  if (theNodes == 0) {
     opserr << "FATAL::MeshRegion::getNodes(void) - no nodes yet set\n";
+    return noTags;
+  }
   
   return *theNodes;
 }
@@ -218,8 +228,11 @@ MeshRegion::getNodes(void)
 const ID &
 MeshRegion::getElements(void)
 {
-  if (theElements == 0)
+  static ID noTags(0);
+  if (theElements == 0) {
     opserr << "FATAL::MeshRegion::getElements(void) - no elements yet set\n";
+    return noTags;
+  }
   
   return *theElements;
 }
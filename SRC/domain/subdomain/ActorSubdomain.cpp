@@ -44,6 +44,8 @@
 #include <Recorder.h>
 #include <Parameter.h>
 #include <Message.h>
+#include <BufferChannel.h>
+#include <ThreadPool.h>
 
 #include <ArrayOfTaggedObjects.h>
 #include <ShadowActorSubdomain.h>
@@ -66,6 +68,77 @@ ActorSubdomain::~ActorSubdomain()
 }
 
 
+// receives the nodes and elements shipped together by a ShadowSubdomain,
+// see ShadowSubdomain::flushComponents(), and adds them in order
+
+int
+ActorSubdomain::addComponents(int numComponents, int numBytes, int numBytesSent)
+{
+  ID theTypes(3*numComponents);
+  if (this->recvID(theTypes) < 0) {
+    opserr << "ActorSubdomain::addComponents() - failed to receive the component types\n";
+    return -1;
+  }
+
+  BufferChannel theComponents;
+  if (numBytesSent != 0) {
+    char *data = new char[numBytesSent];
+    Message theMessage(data, numBytesSent);
+    int res = this->recvMessage(theMessage);
+    if (res == 0)
+      res = theComponents.setData(data, numBytesSent, numBytes);
+    delete [] data;
+    if (res < 0) {
+      opserr << "ActorSubdomain::addComponents() - failed to receive the components\n";
+      return -2;
+    }
+  }
+
+  int result = 0;
+  int commitTag = this->getTag();
+  for (int i=0; i<numComponents; i++) {
+    int msgType = theTypes(3*i);
+    int classTag = theTypes(3*i+1);
+    int dbTag = theTypes(3*i+2);
+
+    if (msgType == ShadowActorSubdomain_addElement) {
+      Element *theEle = theBroker->getNewElement(classTag);
+      if (theEle == 0) {
+	opserr << "ActorSubdomain::addComponents() - no element of class " << classTag << endln;
+	return -3;
+      }
+      theEle->setDbTag(dbTag);
+      theComponents.recvObj(commitTag, *theEle, *theBroker);
+      if (this->addElement(theEle) == false)
+	result = -4;
+
+    } else if (msgType == ShadowActorSubdomain_addNode ||
+	       msgType == ShadowActorSubdomain_addExternalNode) {
+      Node *theNod = theBroker->getNewNode(classTag);
+      if (theNod == 0) {
+	opserr << "ActorSubdomain::addComponents() - no node of class " << classTag << endln;
+	return -3;
+      }
+      theNod->setDbTag(dbTag);
+      theComponents.recvObj(commitTag, *theNod, *theBroker);
+      if (msgType == ShadowActorSubdomain_addNode) {
+	if (this->addNode(theNod) == false)
+	  result = -4;
+      } else {
+	if (this->Subdomain::addExternalNode(theNod) == false)
+	  result = -4;
+	delete theNod;
+      }
+
+    } else {
+      opserr << "ActorSubdomain::addComponents() - unknown component type " << msgType << endln;
+      return -3;
+    }
+  }
+
+  return result;
+}
+
 int
 ActorSubdomain::run(void)
 {
@@ -131,6 +204,16 @@ ActorSubdomain::run(void)
 	    this->Actor::setCommitTag(tag);
 	    break;
 
+	  case ShadowActorSubdomain_setNumThreads:
+	    // the threads are used by the solver and, as the integrators of
+	    // the analysis are created here, in forming the element tangents
+	    // and residuals of the whole subdomain
+	    msgData(0) = ThreadPool::setNumThreads(msgData(1));
+	    if (msgData(0) == 0)
+	      IncrementalIntegrator::setDefaultNumThreads(0);
+	    this->sendID(msgData);
+	    break;
+
 	  case ShadowActorSubdomain_analysisStep:
 	    this->recvVector(theVect);
 	    this->analysisStep(theVect(0));
@@ -208,6 +291,10 @@ ActorSubdomain::run(void)
 	    break;
 
 	    
+	  case ShadowActorSubdomain_addComponents:
+	    this->addComponents(msgData(1), msgData(2), msgData(3));
+	    break;
+
 	  case ShadowActorSubdomain_hasNode:
 	    theType = msgData(1);
 	    res = this->hasNode(theType);
@@ -827,11 +914,20 @@ opserr << "ActorSubdomain::addSP_AXIS :: DONE\n";
 	    tag = msgData(1);
 	    this->setTag(tag);
 	    this->computeTang();
+	    // send the tangent now if the shadow will not ask for it
+	    if (msgData(2) == 1) {
+	      theMatrix = &(this->getTang());
+	      this->sendMatrix(*theMatrix);
+	    }
 	    break;
 
 
 	  case ShadowActorSubdomain_computeResidual:
 	    this->computeResidual();
+	    if (msgData(1) == 1) {
+	      theVector = &(this->getResistingForce());
+	      this->sendVector(*theVector);
+	    }
 	    break;
 
 	  case ShadowActorSubdomain_clearAll:
@@ -58,6 +58,8 @@ class ActorSubdomain: public Subdomain, public Actor
 
     
   private:
+    int addComponents(int numComponents, int numBytes, int numBytesSent);
+
     ID msgData;
     Vector *lastResponse;
 };
@@ -67,6 +67,11 @@
 
 #include <ShadowActorSubdomain.h>
 #include <Message.h>
+#include <BufferChannel.h>
+#include <ThreadPool.h>
+
+// the most bytes of components held before they are shipped
+#define SHADOW_MAX_COMPONENT_BYTES 67108864
 
 int ShadowSubdomain::count = 0; // MHS
 int ShadowSubdomain::numShadowSubdomains = 0;
@@ -82,6 +87,7 @@ ShadowSubdomain::ShadowSubdomain(int tag,
   :Shadow(ACTOR_TAGS_SUBDOMAIN, theObjectBroker, theMachineBroker, 0),
 	  
    Subdomain(tag),
+   theComponents(0), theComponentTypes(0, 3*128), numComponents(0),
    msgData(4),
    theElements(0,128),
    theNodes(0,128),
@@ -90,6 +96,7 @@ ShadowSubdomain::ShadowSubdomain(int tag,
    theShadowSPs(0), theShadowMPs(0), theShadowLPs(0),
    numDOF(0),numElements(0),numNodes(0),numExternalNodes(0),
    numSPs(0),numMPs(0), buildRemote(false), gotRemoteData(false), 
+   tangSent(false), residSent(false),
    theFEele(0),
    theVector(0), theMatrix(0)
 {
@@ -121,6 +128,10 @@ ShadowSubdomain::ShadowSubdomain(int tag,
   this->sendID(msgData);
 
   this->setCommitTag(tag);
+
+  // the remote process runs as many threads as this one
+  if (ThreadPool::getNumThreads() > 1)
+    this->setNumThreads(ThreadPool::getNumThreads());
 }
 
 
@@ -129,6 +140,7 @@ ShadowSubdomain::ShadowSubdomain(int tag,
 				 FEM_ObjectBroker &theObjectBroker)
   :Shadow(the_Channel, theObjectBroker),
    Subdomain(tag),
+   theComponents(0), theComponentTypes(0, 3*128), numComponents(0),
    msgData(4),
    theElements(0,128),
    theNodes(0,128),
@@ -137,6 +149,7 @@ ShadowSubdomain::ShadowSubdomain(int tag,
    theShadowSPs(0), theShadowMPs(0), theShadowLPs(0),
    numDOF(0),numElements(0),numNodes(0),numExternalNodes(0),
    numSPs(0),numMPs(0), buildRemote(false), gotRemoteData(false), 
+   tangSent(false), residSent(false),
    theFEele(0),
    theVector(0), theMatrix(0)
 {
@@ -176,6 +189,9 @@ ShadowSubdomain::~ShadowSubdomain()
   delete theShadowSPs;
   delete theShadowMPs;
   delete theShadowLPs;
+
+  if (theComponents != 0)
+    delete theComponents;
 }
 
 /*
@@ -235,11 +251,7 @@ ShadowSubdomain::addElement(Element *theEle)
 	// do all the checking stuff
 #endif
 
-    msgData(0) = ShadowActorSubdomain_addElement;
-    msgData(1) = theEle->getClassTag();
-    msgData(2) = theEle->getDbTag();
-    this->sendID(msgData);
-    this->sendObject(*theEle);
+    this->addComponent(ShadowActorSubdomain_addElement, *theEle);
     theElements[numElements] = tag;
     numElements++;
     //    this->Domain::domainChange();
@@ -266,11 +278,7 @@ ShadowSubdomain::addNode(Node *theNode)
 #ifdef _G3DEBUG
   // do all the checking stuff
 #endif
-  msgData(0) = ShadowActorSubdomain_addNode;
-  msgData(1) = theNode->getClassTag();
-  msgData(2) = theNode->getDbTag();
-  this->sendID(msgData);
-  this->sendObject(*theNode);
+  this->addComponent(ShadowActorSubdomain_addNode, *theNode);
   theNodes[numNodes] = tag;
   numNodes++;    
   // this->Domain::domainChange();
@@ -288,11 +296,7 @@ ShadowSubdomain::addExternalNode(Node *theNode)
 	// do all the checking stuff
 #endif
 
-    msgData(0) = ShadowActorSubdomain_addExternalNode;
-    msgData(1) = theNode->getClassTag();
-    msgData(2) = theNode->getDbTag();
-    this->sendID(msgData);
-    this->sendObject(*theNode);
+    this->addComponent(ShadowActorSubdomain_addExternalNode, *theNode);
     theNodes[numNodes] = tag;
     theExternalNodes[numExternalNodes] = tag;    
     numNodes++;    
@@ -304,6 +308,147 @@ ShadowSubdomain::addExternalNode(Node *theNode)
     return true;    
 }
 
+// serializes the component into the buffer of components to be shipped,
+// which is sent when it gets too large
+
+int
+ShadowSubdomain::addComponent(int msgType, MovableObject &theComponent)
+{
+  if (theComponents == 0)
+    theComponents = new BufferChannel();
+
+  int loc = 3*numComponents;
+  theComponentTypes[loc] = msgType;
+  theComponentTypes[loc+1] = theComponent.getClassTag();
+  theComponentTypes[loc+2] = theComponent.getDbTag();
+  numComponents++;
+
+  // the commit tag is that of the ActorSubdomain, the tag of the subdomain
+  int res = theComponents->sendObj(this->getTag(), theComponent);
+  if (res < 0) {
+    opserr << "ShadowSubdomain::addComponent() - failed to serialize component of class ";
+    opserr << theComponent.getClassTag() << endln;
+  }
+
+  if (theComponents->getNumBytes() > SHADOW_MAX_COMPONENT_BYTES)
+    this->flushComponents();
+
+  return res;
+}
+
+// ships the components added since the last call in three messages: their
+// number and the size of the buffer, their types and the buffer itself,
+// zlib compressed if built with _ZLIB; the ActorSubdomain adds them in the
+// order they were added here
+
+int
+ShadowSubdomain::flushComponents(void)
+{
+  if (numComponents == 0)
+    return 0;
+
+  int numBytes = 0;
+  const char *data = theComponents->getData(numBytes, true);
+
+  ID flushData(4);
+  flushData(0) = ShadowActorSubdomain_addComponents;
+  flushData(1) = numComponents;
+  flushData(2) = theComponents->getNumBytes();
+  flushData(3) = numBytes;
+
+  ID theTypes(3*numComponents);
+  for (int i=0; i<3*numComponents; i++)
+    theTypes(i) = theComponentTypes(i);
+  numComponents = 0;
+
+  int res = 0;
+  if (this->Shadow::sendID(flushData) < 0 ||
+      this->Shadow::sendID(theTypes) < 0)
+    res = -1;
+  else if (numBytes != 0) {
+    Message theMessage((char *)data, numBytes);
+    if (this->Shadow::sendMessage(theMessage) < 0)
+      res = -1;
+  }
+
+  theComponents->clear();
+
+  if (res < 0)
+    opserr << "ShadowSubdomain::flushComponents() - failed to send the components\n";
+
+  return res;
+}
+
+int
+ShadowSubdomain::sendObject(MovableObject &theObject)
+{
+  this->flushComponents();
+  return this->Shadow::sendObject(theObject);
+}
+
+int
+ShadowSubdomain::recvObject(MovableObject &theObject)
+{
+  this->flushComponents();
+  return this->Shadow::recvObject(theObject);
+}
+
+int
+ShadowSubdomain::sendMessage(const Message &theMessage)
+{
+  this->flushComponents();
+  return this->Shadow::sendMessage(theMessage);
+}
+
+int
+ShadowSubdomain::recvMessage(Message &theMessage)
+{
+  this->flushComponents();
+  return this->Shadow::recvMessage(theMessage);
+}
+
+int
+ShadowSubdomain::sendMatrix(const Matrix &theMatrix)
+{
+  this->flushComponents();
+  return this->Shadow::sendMatrix(theMatrix);
+}
+
+int
+ShadowSubdomain::recvMatrix(Matrix &theMatrix)
+{
+  this->flushComponents();
+  return this->Shadow::recvMatrix(theMatrix);
+}
+
+int
+ShadowSubdomain::sendVector(const Vector &theVector)
+{
+  this->flushComponents();
+  return this->Shadow::sendVector(theVector);
+}
+
+int
+ShadowSubdomain::recvVector(Vector &theVector)
+{
+  this->flushComponents();
+  return this->Shadow::recvVector(theVector);
+}
+
+int
+ShadowSubdomain::sendID(const ID &theID)
+{
+  this->flushComponents();
+  return this->Shadow::sendID(theID);
+}
+
+int
+ShadowSubdomain::recvID(ID &theID)
+{
+  this->flushComponents();
+  return this->Shadow::recvID(theID);
+}
+
 bool 
 ShadowSubdomain::addSP_Constraint(SP_Constraint *theSP)
 {
@@ -1265,8 +1410,12 @@ ShadowSubdomain::getTang(void)
   if (gotRemoteData == false && buildRemote == true)
     this->getRemoteData();
 
-    msgData(0) =  ShadowActorSubdomain_getTang;
-    this->sendID(msgData);
+    // if computeTang() asked for it the tangent is already on its way
+    if (tangSent == false) {
+      msgData(0) =  ShadowActorSubdomain_getTang;
+      this->sendID(msgData);
+    }
+    tangSent = false;
     
     if (theMatrix == 0)
 	theMatrix = new Matrix(numDOF,numDOF);
@@ -1288,8 +1437,11 @@ ShadowSubdomain::getResistingForce(void)
   if (gotRemoteData == false && buildRemote == true)
     this->getRemoteData();
 
-    msgData(0) = ShadowActorSubdomain_getResistingForce;
-    this->sendID(msgData);
+    if (residSent == false) {
+      msgData(0) = ShadowActorSubdomain_getResistingForce;
+      this->sendID(msgData);
+    }
+    residSent = false;
     
     if (theVector == 0)
 	theVector = new Vector(numDOF);
@@ -1306,12 +1458,18 @@ ShadowSubdomain::getResistingForce(void)
 int  	  
 ShadowSubdomain::computeTang(void)
 {
+    // the actors are all started on their tangents by the first call; each
+    // sends its condensed tangent back as soon as it is formed, without
+    // waiting for the getTang() request, so the transfer from the faster
+    // subdomains overlaps the work of the slower ones and the assembly
     count++;
 
     if (count == 1) {
       msgData(0) = ShadowActorSubdomain_computeTang;
       msgData(1) = this->getTag();
+      msgData(2) = 1;
       this->sendID(msgData);
+      tangSent = true;
 
       for (int i = 0; i < numShadowSubdomains; i++) {
 	ShadowSubdomain *theShadow = theShadowSubdomains[i];
@@ -1322,9 +1480,13 @@ ShadowSubdomain::computeTang(void)
     else if (count <= numShadowSubdomains) {
       msgData(0) = ShadowActorSubdomain_computeTang;
       msgData(1) = this->getTag();
+      msgData(2) = 1;
       this->sendID(msgData);
+      tangSent = true;
     }
-    else if (count == 2*numShadowSubdomains - 1)
+
+    // with a single subdomain the first call is also the last
+    if (count == 2*numShadowSubdomains - 1)
       count = 0;
     
     return 0;
@@ -1337,7 +1499,9 @@ ShadowSubdomain::computeResidual(void)
 
     if (count == 1) {
       msgData(0) = ShadowActorSubdomain_computeResidual;
+      msgData(1) = 1;
       this->sendID(msgData);
+      residSent = true;
 
       for (int i = 0; i < numShadowSubdomains; i++) {
 	ShadowSubdomain *theShadow = theShadowSubdomains[i];
@@ -1347,9 +1511,13 @@ ShadowSubdomain::computeResidual(void)
     }
     else if (count <= numShadowSubdomains) {
       msgData(0) = ShadowActorSubdomain_computeResidual;
+      msgData(1) = 1;
       this->sendID(msgData);
+      residSent = true;
     }
-    else if (count == 2*numShadowSubdomains - 1)
+
+    // with a single subdomain the first call is also the last
+    if (count == 2*numShadowSubdomains - 1)
       count = 0;
 
     return 0;
@@ -1434,15 +1602,24 @@ ShadowSubdomain::eigenAnalysis(int numMode, bool generalized, bool findSmallest)
 double
 ShadowSubdomain::getCost(void)    
 {
-  /*
     msgData(0) = ShadowActorSubdomain_getCost;
     
     this->sendID(msgData);
-    Vector cost(2);
+    static Vector cost(4);
     this->recvVector(cost);
     return cost(0);
-  */
-  return 0.0;
+}
+
+
+int
+ShadowSubdomain::setNumThreads(int numThreads)
+{
+    msgData(0) = ShadowActorSubdomain_setNumThreads;
+    msgData(1) = numThreads;
+    this->sendID(msgData);
+    this->recvID(msgData);
+
+    return msgData(0);
 }
 
 
@@ -41,6 +41,8 @@
 #include <Shadow.h>
 #include <remote.h>
 
+class BufferChannel;
+
 class ShadowSubdomain: public Shadow, public Subdomain
 {
   public:
@@ -166,10 +168,27 @@ class ShadowSubdomain: public Shadow, public Subdomain
 			 FEM_ObjectBroker &theBroker);    
 
     virtual double getCost(void);
+
+    // number of threads the remote process uses for its solver and, in
+    // its integrator, for forming the element contributions
+    virtual int setNumThreads(int numThreads);
     
     virtual  void Print(OPS_Stream &s, int flag =0);
     virtual void Print(OPS_Stream &s, ID *nodeTags, ID *eleTags, int flag =0);
 
+    // the Shadow methods, which first send the components still to be
+    // shipped to the remote process
+    virtual int sendObject(MovableObject &theObject);  
+    virtual int recvObject(MovableObject &theObject);      
+    virtual int sendMessage(const Message &theMessage);  
+    virtual int recvMessage(Message &theMessage);  
+    virtual int sendMatrix(const Matrix &theMatrix);  
+    virtual int recvMatrix(Matrix &theMatrix);      
+    virtual int sendVector(const Vector &theVector);  
+    virtual int recvVector(Vector &theVector);      
+    virtual int sendID(const ID &theID);  
+    virtual int recvID(ID &theID);      
+
     // nodal methods required in domain interface for parallel interprter
     virtual double getNodeDisp(int nodeTag, int dof, int &errorFlag);
     virtual int setMass(const Matrix &mass, int nodeTag);
@@ -186,6 +205,16 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual int buildNodeGraph(Graph *theNodeGraph);    
     
   private:
+    // the nodes and elements added one after the other are serialized
+    // into one buffer and shipped in bulk by flushComponents(), which is
+    // called before any other message goes to the remote process
+    int addComponent(int msgType, MovableObject &theComponent);
+    int flushComponents(void);
+
+    BufferChannel *theComponents;
+    ID theComponentTypes;  // message type, class tag and dbTag of each
+    int numComponents;
+
     ID msgData;
     ID theElements;
     ID theNodes;
@@ -206,6 +235,8 @@ class ShadowSubdomain: public Shadow, public Subdomain
 
     bool buildRemote;
     bool gotRemoteData;
+    bool tangSent;     // actor sends the tangent once computed
+    bool residSent;    // actor sends the residual once computed
     
     FE_Element *theFEele;
 
@@ -200,6 +200,38 @@ Subdomain::addNode(Node * node)
   return result;
 }
 
+// the components are added one at a time, so that a ShadowSubdomain
+// sends each to its actor
+int
+Subdomain::addNodes(Node **theNodes, int numNodes)
+{
+  int numAdded = 0;
+  while (numAdded < numNodes && this->addNode(theNodes[numAdded]) == true)
+    numAdded++;
+
+  return numAdded;
+}
+
+int
+Subdomain::addElements(Element **theElements, int numElements)
+{
+  int numAdded = 0;
+  while (numAdded < numElements && this->addElement(theElements[numAdded]) == true)
+    numAdded++;
+
+  return numAdded;
+}
+
+int
+Subdomain::addSP_Constraints(SP_Constraint **theSPs, int numSPs)
+{
+  int numAdded = 0;
+  while (numAdded < numSPs && this->addSP_Constraint(theSPs[numAdded]) == true)
+    numAdded++;
+
+  return numAdded;
+}
+
 bool 
 Subdomain::addExternalNode(Node *thePtr)
 {
@@ -360,13 +392,31 @@ Subdomain::revertToStart(void)
 int
 Subdomain::update(void)
 {
-  return this->Domain::update();
+  theTimer.start();
+
+  int res = this->Domain::update();
+
+  theTimer.pause();
+  realCost += theTimer.getReal();
+  cpuCost += theTimer.getCPU();
+  pageCost += theTimer.getNumPageFaults();
+
+  return res;
 }
 
 int
 Subdomain::update(double newTime, double dT)
 {
-    return this->Domain::update(newTime, dT);
+    theTimer.start();
+
+    int res = this->Domain::update(newTime, dT);
+
+    theTimer.pause();
+    realCost += theTimer.getReal();
+    cpuCost += theTimer.getCPU();
+    pageCost += theTimer.getNumPageFaults();
+
+    return res;
 }
 
 void
@@ -683,11 +733,16 @@ int
 Subdomain::computeTang(void)
 {   
   if (theAnalysis != 0) {
-    //    theTimer.start();
+    theTimer.start();
     
     int res =0;
     res = theAnalysis->formTangent();
     
+    theTimer.pause();
+    realCost += theTimer.getReal();
+    cpuCost += theTimer.getCPU();
+    pageCost += theTimer.getNumPageFaults();
+
     return res;
     
   } else {
@@ -703,15 +758,15 @@ int
 Subdomain::computeResidual(void)
 {
   if (theAnalysis != 0) {
-    //    theTimer.start();
+    theTimer.start();
     
     int res =0;
     res = theAnalysis->formResidual();
     
-    //theTimer.pause();
-    //    realCost += theTimer.getReal();
-    //    cpuCost += theTimer.getCPU();
-    //    pageCost += theTimer.getNumPageFaults();
+    theTimer.pause();
+    realCost += theTimer.getReal();
+    cpuCost += theTimer.getCPU();
+    pageCost += theTimer.getNumPageFaults();
     
     return res;
     
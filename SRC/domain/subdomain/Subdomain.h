@@ -40,6 +40,7 @@
 
 #include <Domain.h>
 #include <Element.h>
+#include <Timer.h>
 
 class Node;
 class ID;
@@ -77,6 +78,9 @@ class Subdomain: public Element, public Domain
     // Domain methods which must be rewritten
     virtual void clearAll(void);
     virtual bool addNode(Node *);	
+    virtual int addNodes(Node **theNodes, int numNodes);
+    virtual int addElements(Element **theElements, int numElements);
+    virtual int addSP_Constraints(SP_Constraint **theSPs, int numSPs);
     virtual Node *removeNode(int tag);        
     virtual NodeIter &getNodes(void);    
     virtual Node *getNode(int tag);            
@@ -175,9 +179,12 @@ class Subdomain: public Element, public Domain
     DomainDecompositionAnalysis *getDDAnalysis(void);
 
   private:
+    // time spent in state determination and forming the tangent and
+    // residual since getCost() was last called, used for load balancing
     double realCost;
     double cpuCost;
     int pageCost;
+    Timer theTimer;
     DomainDecompositionAnalysis *theAnalysis;
     ID *extNodes;
     FE_Element *theFEele;
@@ -43,13 +43,19 @@
 #include <Matrix.h>
 #include <Node.h>
 #include <Domain.h>
+#include <ModelArena.h>
+#include <Workspace.h>
 
-Element  *ops_TheActiveElement = 0;
+OPS_THREAD_LOCAL Element  *ops_TheActiveElement = 0;
 
-Matrix **Element::theMatrices; 
-Vector **Element::theVectors1; 
-Vector **Element::theVectors2; 
-int  Element::numMatrices(0);
+// keys identifying the Workspace storage used to compute & return the
+// damping matrix and residual force of the elements, one of each size
+static char matrixKey;
+static char vector1Key;
+static char vector2Key;
+
+int Element::activationStamp = 0;
+int Element::dampingStamp = 0;
 
 // Element(int tag, int noExtNodes);
 // 	constructor that takes the element's unique tag and the number
@@ -58,7 +64,7 @@ int  Element::numMatrices(0);
 Element::Element(int tag, int cTag) 
   :DomainComponent(tag, cTag), alphaM(0.0), 
   betaK(0.0), betaK0(0.0), betaKc(0.0), 
-   Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1)
+   Kc(0), previousK(0), numPreviousK(0), index(-1), nodeIndex(-1), active(true)
 {
   // does nothing
   ops_TheActiveElement = this;
@@ -76,6 +82,18 @@ Element::~Element()
   }
 }
 
+void *
+Element::operator new(size_t numBytes)
+{
+  return ModelArena::allocateObject(numBytes);
+}
+
+void
+Element::operator delete(void *theObject)
+{
+  ModelArena::deallocateObject(theObject);
+}
+
 int
 Element::commitState(void)
 {
@@ -114,72 +132,17 @@ Element::addInertiaLoadToUnbalance(const Vector &accel)
 int
 Element::setRayleighDampingFactors(double alpham, double betak, double betak0, double betakc)
 {
+  if (alpham != alphaM || betak != betaK || betak0 != betaK0 || betakc != betaKc)
+    dampingStamp++;
+
   alphaM = alpham;
   betaK  = betak;
   betaK0 = betak0;
   betaKc = betakc;
 
-  // check that memory has been allocated to store compute/return
-  // damping matrix & residual force calculations
-  if (index == -1) {
-    int numDOF = this->getNumDOF();
-
-    for (int i=0; i<numMatrices; i++) {
-      Matrix *aMatrix = theMatrices[i];
-      if (aMatrix->noRows() == numDOF) {
-	index = i;
-	i = numMatrices;
-      }
-    }
-    if (index == -1) {
-      Matrix **nextMatrices = new Matrix *[numMatrices+1];
-      if (nextMatrices == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-      }
-	  int j;
-      for (j=0; j<numMatrices; j++)
-	nextMatrices[j] = theMatrices[j];
-      Matrix *theMatrix = new Matrix(numDOF, numDOF);
-      if (theMatrix == 0) {
-	opserr << "Element::getTheMatrix - out of memory\n";
-	exit(-1);
-      }
-      nextMatrices[numMatrices] = theMatrix;
-
-      Vector **nextVectors1 = new Vector *[numMatrices+1];
-      Vector **nextVectors2 = new Vector *[numMatrices+1];
-      if (nextVectors1 == 0 || nextVectors2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      for (j=0; j<numMatrices; j++) {
-	nextVectors1[j] = theVectors1[j];
-	nextVectors2[j] = theVectors2[j];
-      }
-	
-      Vector *theVector1 = new Vector(numDOF);
-      Vector *theVector2 = new Vector(numDOF);
-      if (theVector1 == 0 || theVector2 == 0) {
-	opserr << "Element::getTheVector - out of memory\n";
-	exit(-1);
-      }
-
-      nextVectors1[numMatrices] = theVector1;
-      nextVectors2[numMatrices] = theVector2;
-
-      if (numMatrices != 0) {
-	delete [] theMatrices;
-	delete [] theVectors1;
-	delete [] theVectors2;
-      }
-      index = numMatrices;
-      numMatrices++;
-      theMatrices = nextMatrices;
-      theVectors1 = nextVectors1;
-      theVectors2 = nextVectors2;
-    }
-  }
+  // the damping matrix & residual force are computed in the Workspace
+  // storage of the calling thread, of size numDOF
+  index = 0;
 
   // if need storage for Kc go get it
   if (betaKc != 0.0) {  
@@ -207,7 +170,7 @@ Element::getDamp(void)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF()); 
   theMatrix->Zero();
   if (alphaM != 0.0)
     theMatrix->addMatrix(0.0, this->getMass(), alphaM);
@@ -224,6 +187,32 @@ Element::getDamp(void)
 
 
 
+bool
+Element::hasRayleighDampingOnly(void)
+{
+  // an override that adds damping of its own returns a matrix of its own
+  const Matrix *theDamp = &this->getDamp();
+  int numDOF = this->getNumDOF();
+  return theDamp == &Workspace::getMatrix(&matrixKey, numDOF, numDOF);
+}
+
+bool
+Element::hasConstantTangent(void)
+{
+  return false;
+}
+
+void
+Element::getRayleighDampingFactors(double &alpham, double &betak,
+				   double &betak0, double &betakc) const
+{
+  alpham = alphaM;
+  betak = betaK;
+  betak0 = betaK0;
+  betakc = betaKc;
+}
+
+
 const Matrix &
 Element::getMass(void)
 {
@@ -232,7 +221,7 @@ Element::getMass(void)
   }
 
   // zero the matrix & return it
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF()); 
   theMatrix->Zero();
   return *theMatrix;
 }
@@ -244,9 +233,9 @@ Element::getResistingForceIncInertia(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF()); 
+  Vector *theVector = &Workspace::getVector(&vector2Key, this->getNumDOF());
+  Vector *theVector2 = &Workspace::getVector(&vector1Key, this->getNumDOF());
 
   //
   // perform: R = P(U) - Pext(t);
@@ -311,9 +300,9 @@ Element::getRayleighDampingForces(void)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index]; 
-  Vector *theVector = theVectors2[index];
-  Vector *theVector2 = theVectors1[index];
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF()); 
+  Vector *theVector = &Workspace::getVector(&vector2Key, this->getNumDOF());
+  Vector *theVector2 = &Workspace::getVector(&vector1Key, this->getNumDOF());
 
   //
   // perform: R = (alphaM * M + betaK0 * K0 + betaK * K) * v
@@ -358,6 +347,11 @@ Element::addLoad(ElementalLoad *theLoad, const Vector &loadFactors) {
   return 0;
 }
 
+const Vector *
+Element::getReferenceLoad(ElementalLoad *theLoad) {
+  return 0;
+}
+
 /*
 int 
 Element::addInertiaLoadToUnbalance(const Vector &accel)
@@ -407,6 +401,20 @@ Element::isSubdomain(void)
     return false;
 }
 
+bool
+Element::isLinear(void)
+{
+    return false;
+}
+
+void
+Element::setActive(bool flag)
+{
+    if (flag != active)
+      activationStamp++;
+    active = flag;
+}
+
 Response*
 Element::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
@@ -489,7 +497,7 @@ Element::getResistingForceSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Vector *theVector = theVectors1[index];
+  Vector *theVector = &Workspace::getVector(&vector1Key, this->getNumDOF());
   theVector->Zero();
 
   return *theVector;
@@ -502,7 +510,7 @@ Element::getInitialStiffSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF());
   theMatrix->Zero();
 
   return *theMatrix;
@@ -515,7 +523,7 @@ Element::getMassSensitivity(int gradIndex)
     this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
   }
 
-  Matrix *theMatrix = theMatrices[index];
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF());
   theMatrix->Zero();
 
   return *theMatrix;
@@ -546,7 +554,7 @@ Element::getDampSensitivity(int gradIndex)
   }
 
   // now compute the damping matrix
-  Matrix *theMatrix = theMatrices[index]; 
+  Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF()); 
   theMatrix->Zero();
   if (alphaM != 0.0) {
     theMatrix->addMatrix(0.0, this->getMassSensitivity(gradIndex), alphaM);
@@ -613,6 +621,37 @@ Element::addResistingForceToNodalReaction(int flag)
   return result;
 }
 
+int
+Element::getStableTimeStepSums(Vector &stiffSums, Vector &massSums, bool initial)
+{
+  const Matrix &K = (initial == true) ? this->getInitialStiff() : this->getTangentStiff();
+  int numDOF = K.noRows();
+  if (stiffSums.Size() != numDOF)
+    stiffSums.resize(numDOF);
+  if (massSums.Size() != numDOF)
+    massSums.resize(numDOF);
+
+  for (int i=0; i<numDOF; i++) {
+    double sum = 0.0;
+    for (int j=0; j<numDOF; j++)
+      sum += fabs(K(i,j));
+    stiffSums(i) = sum;
+  }
+
+  // the mass lumped by row sums
+  const Matrix &M = this->getMass();
+  massSums.Zero();
+  if (M.noRows() == numDOF && M.noCols() == numDOF)
+    for (int i=0; i<numDOF; i++) {
+      double sum = 0.0;
+      for (int j=0; j<numDOF; j++)
+	sum += M(i,j);
+      massSums(i) = sum;
+    }
+
+  return 0;
+}
+
 double Element::getCharacteristicLength(void)
 {
   int numNodes = this->getNumExternalNodes();
@@ -707,7 +746,7 @@ Element::getGeometricTangentStiff()
 	this->setRayleighDampingFactors(alphaM, betaK, betaK0, betaKc);
     }
     
-    Matrix *theMatrix = theMatrices[index];
+    Matrix *theMatrix = &Workspace::getMatrix(&matrixKey, this->getNumDOF(), this->getNumDOF());
     theMatrix->Zero();
     
     return *theMatrix;
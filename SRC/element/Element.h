@@ -53,6 +53,10 @@ class Element : public DomainComponent
     Element(int tag, int classTag);    
     virtual ~Element();
 
+    // the object is placed in the ModelArena while it is active
+    static void *operator new(size_t numBytes);
+    static void operator delete(void *theObject);
+
     // methods dealing with nodes and number of external dof
     virtual int getNumExternalNodes(void) const =0;
     virtual const ID &getExternalNodes(void)  =0;	
@@ -75,14 +79,60 @@ class Element : public DomainComponent
     virtual const Matrix &getMass(void);
     virtual const Matrix &getGeometricTangentStiff();
 
+    // true while the stiffness does not depend on the state of the element,
+    // so the analysis may keep the first getTangentStiff() and reuse it
+    virtual bool isLinear(void);
+
+    // an inactive element stays in the Domain with its nodes and equations
+    // but no longer adds mass, damping or resisting force to the system, and
+    // only a small fraction of its initial stiffness, see FE_Element; used
+    // to take elements out of an analysis without a change in the Domain
+    void setActive(bool flag);
+    bool isActive(void) const {return active;}
+
+    // the number of times any element was activated or deactivated
+    static int getActivationStamp(void) {return activationStamp;}
+    // the number of times any element had its Rayleigh factors changed
+    static int getDampingStamp(void) {return dampingStamp;}
+
+    // for each dof the sum of the absolute values in its row of the
+    // stiffness and the row sum of the mass, from which the Domain bounds
+    // the highest frequency for the critical step of explicit integrators
+    virtual int getStableTimeStepSums(Vector &stiffSums, Vector &massSums,
+				      bool initial = false);
+
     // methods for applying loads
     virtual void zeroLoad(void);	
     virtual int addLoad(ElementalLoad *theLoad, double loadFactor);
     virtual int addLoad(ElementalLoad *theLoad, const Vector &loadFactors);
 
+    // the nodal forces of theLoad at a load factor of 1 for an element whose
+    // load does not depend on its state; the LoadPattern then applies them
+    // as scaled nodal loads and no longer calls addLoad() for theLoad. The
+    // default returns 0, the load is taken through addLoad()
+    virtual const Vector *getReferenceLoad(ElementalLoad *theLoad);
+
     virtual int addInertiaLoadToUnbalance(const Vector &accel);
     virtual int setRayleighDampingFactors(double alphaM, double betaK, double betaK0, double betaKc);
 
+    // true if getDamp() gives the Rayleigh damping of the factors alone, as
+    // it does if not overridden or if an override returns Element::getDamp();
+    // its constant part alphaM M + betaK0 K0 may then be formed once, see
+    // TransientIntegrator, and the part betaK K + betaKc Kc that varies with
+    // the tangent and committed stiffness Kc
+    bool hasRayleighDampingOnly(void);
+    void getRayleighDampingFactors(double &alphaM, double &betaK,
+				   double &betaK0, double &betaKc) const;
+    const Matrix *getCommittedStiff(void) const {return Kc;}
+
+    // true if the tangent stiffness K never changes and the resisting force
+    // is K times the trial displacements plus the loads of addLoad() and
+    // addInertiaLoadToUnbalance() alone, as for an elastic element without
+    // body forces; the explicit integrators may then form the forces of
+    // the element outside of it, see ExplicitDeviceForces. The default
+    // returns false
+    virtual bool hasConstantTangent(void);
+
     // methods for obtaining resisting force (force includes elemental loads)
     virtual const Vector &getResistingForce(void) =0;
     virtual const Vector &getResistingForceIncInertia(void);        
@@ -120,11 +170,9 @@ class Element : public DomainComponent
 
   private:
     int index, nodeIndex;
-
-    static Matrix ** theMatrices; 
-    static Vector ** theVectors1; 
-    static Vector ** theVectors2; 
-    static int numMatrices;
+    bool active;
+    static int activationStamp;
+    static int dampingStamp;
 };
 
 
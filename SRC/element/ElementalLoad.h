@@ -51,6 +51,7 @@ class ElementalLoad : public Load
     virtual const Vector &getSensitivityData(int gradIndex);
 
     virtual int getElementTag(void);
+    Element *getElement(void) {return theElement;}
 
   protected:
     int eleTag;
@@ -0,0 +1,62 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/GeometryCache.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for
+// GeometryCache.
+//
+// What: "@(#) GeometryCache.C, revA"
+
+#include <GeometryCache.h>
+#include <stdlib.h>
+
+OPS_THREAD_LOCAL bool GeometryCache::active = false;
+OPS_THREAD_LOCAL int GeometryCache::numCaches = 0;
+OPS_THREAD_LOCAL size_t GeometryCache::numBytes = 0;
+
+void *
+GeometryCache::allocate(size_t theNumBytes)
+{
+  void *theCache = malloc(theNumBytes);
+  if (theCache == 0)
+    return 0;
+
+  numCaches++;
+  numBytes += theNumBytes;
+
+  return theCache;
+}
+
+void
+GeometryCache::deallocate(void *theCache, size_t theNumBytes)
+{
+  if (theCache == 0)
+    return;
+
+  free(theCache);
+
+  numCaches--;
+  numBytes -= theNumBytes;
+}
@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/GeometryCache.h,v $
+
+#ifndef GeometryCache_h
+#define GeometryCache_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for GeometryCache.
+// In a small deformation analysis the shape function derivatives, volume
+// elements and strain-displacement matrices of a continuum or shell
+// element are the same in every call, as the nodes do not move. Elements
+// that support it keep them from the first call when created with the
+// cache on, setActive(true) or the geometryCache command, and form them
+// again when their domain is set. The nodes must then not be moved
+// during the analysis, e.g. by an updated basis or a setNodeCoord.
+//
+// The elements take the storage from allocate() and give it back with
+// deallocate(), so that the number of caches and the bytes held by them
+// can be reported when the model has been built. As with the ModelArena
+// each thread has its own setting and count.
+//
+// What: "@(#) GeometryCache.h, revA"
+
+#include <stddef.h>
+#include <OPS_Globals.h>
+
+class GeometryCache
+{
+  public:
+    static void setActive(bool onOff) {active = onOff;}
+    static bool isActive(void) {return active;}
+
+    static void *allocate(size_t theNumBytes);
+    static void deallocate(void *theCache, size_t theNumBytes);
+
+    static int getNumCaches(void) {return numCaches;}
+    static size_t getNumBytes(void) {return numBytes;}
+
+  private:
+    static OPS_THREAD_LOCAL bool active;
+    static OPS_THREAD_LOCAL int numCaches;     // caches handed out and not given back
+    static OPS_THREAD_LOCAL size_t numBytes;   // bytes in these caches
+};
+
+#endif
@@ -35,7 +35,7 @@
 #include <elementAPI.h>
 
 BackgroundGrid::BackgroundGrid()
-    :data(), size(0), iter()
+    :data(), buckets(), size(0), iter()
 {
     iter = data.end();
 }
@@ -56,9 +56,61 @@ BackgroundGrid::~BackgroundGrid()
     }
     
     data.clear();
+    buckets.clear();
     iter = data.end();
 }
 
+BackgroundGrid::GridData*
+BackgroundGrid::find(const GridIndex& index) const
+{
+    if (buckets.empty()) return 0;
+
+    GridData* griddata = buckets[index.hash() & (buckets.size()-1)];
+    while (griddata != 0) {
+	if (griddata->index == index) return griddata;
+	griddata = griddata->link;
+    }
+
+    return 0;
+}
+
+BackgroundGrid::GridData*
+BackgroundGrid::insert(const GridIndex& index)
+{
+    GridData* griddata = find(index);
+    if (griddata != 0) return griddata;
+
+    // keep the buckets at least twice the grids
+    if (2*(data.size()+1) > buckets.size()) {
+	rehash(buckets.empty()? 1024 : 2*(int)buckets.size());
+    }
+
+    // create grid
+    griddata = new GridData;
+    griddata->index = index;
+    data.insert(std::make_pair(index, griddata));
+
+    unsigned int b = index.hash() & (buckets.size()-1);
+    griddata->link = buckets[b];
+    buckets[b] = griddata;
+
+    return griddata;
+}
+
+void
+BackgroundGrid::rehash(int numBuckets)
+{
+    buckets.assign(numBuckets, (GridData*)0);
+
+    std::map<GridIndex,GridData*>::iterator it;
+    for (it=data.begin(); it!=data.end(); it++) {
+	GridData* griddata = it->second;
+	unsigned int b = griddata->index.hash() & (buckets.size()-1);
+	griddata->link = buckets[b];
+	buckets[b] = griddata;
+    }
+}
+
 void
 BackgroundGrid::reset(const GridIndex& index)
 {
@@ -66,85 +118,68 @@ BackgroundGrid::reset(const GridIndex& index)
 }
 
 void
-BackgroundGrid::addParticle(const GridIndex& index, Particle* p)
+BackgroundGrid::addGrid(const GridIndex& index)
 {
-    // create grid
-    GridData* griddata = new GridData;
-
-    // insert the grid
-    std::pair<std::map<GridIndex,GridData*>::iterator, bool> res;
-    res = data.insert(std::make_pair(index, griddata));
+    insert(index);
+}
 
-    // if the grid already existed
-    if (res.second == false) {
-	delete griddata;
-	griddata = res.first->second;
-    }
+void
+BackgroundGrid::addParticle(const GridIndex& index, Particle* p)
+{
+    // insert the grid, if not existed
+    GridData* griddata = insert(index);
 
     // add particle
     griddata->particles.push_back(p);
 
     // other grids
-    griddata = new GridData;
-    if (data.insert(std::make_pair(index.east(), griddata)).second == false) {
-	delete griddata;
-    }
-
-    griddata = new GridData;
-    if (data.insert(std::make_pair(index.north(), griddata)).second == false) {
-	delete griddata;
-    }
-
-    griddata = new GridData;
-    if (data.insert(std::make_pair(index.northEast(), griddata)).second == false) {
-	delete griddata;
-    }
+    insert(index.east());
+    insert(index.north());
+    insert(index.northEast());
 }
 
 void
 BackgroundGrid::addElement(const GridIndex& index, Element* e)
 {
-    data[index]->elements.push_back(e);
+    insert(index)->elements.push_back(e);
 }
 
 void
 BackgroundGrid::setNode(const GridIndex& index, Node* nd)
 {
-    data[index]->node = nd;
+    insert(index)->node = nd;
 }
 
 std::vector<Particle*>*
 BackgroundGrid::getParticles(const GridIndex& index)
 {
-    std::map<GridIndex,GridData*>::iterator it = data.find(index);
-    if (it == data.end()) return 0;
+    GridData* griddata = find(index);
+    if (griddata == 0) return 0;
     
-    return &(it->second->particles);
+    return &(griddata->particles);
 }
 
 std::vector<Element*>*
 BackgroundGrid::getElements(const GridIndex& index)
 {
-    std::map<GridIndex,GridData*>::iterator it = data.find(index);
-    if (it == data.end()) return 0;
+    GridData* griddata = find(index);
+    if (griddata == 0) return 0;
 
-    return &(it->second->elements);
+    return &(griddata->elements);
 }
 
 Node*
 BackgroundGrid::getNode(const GridIndex& index)
 {
-    std::map<GridIndex,GridData*>::iterator it = data.find(index);
-    if (it == data.end()) return 0;
-    return it->second->node;
+    GridData* griddata = find(index);
+    if (griddata == 0) return 0;
+    return griddata->node;
 }
 
 bool
 BackgroundGrid::hasGrid(const GridIndex& index)
 {
-    std::map<GridIndex,GridData*>::iterator it = data.find(index);
-    if (it == data.end()) return false;
-    return true;
+    return find(index) != 0;
 }
 
 void
@@ -196,6 +231,7 @@ BackgroundGrid::clear(const ID& structuralNodes)
     }
     
     data.clear();
+    buckets.clear();
     iter = data.end();
 }
 
@@ -264,15 +300,15 @@ BackgroundGrid::next()
 bool
 BackgroundGrid::isCorner(const GridIndex& center) const
 {
-    std::map<GridIndex,GridData*>::const_iterator iternorth = data.find(center.north());
-    std::map<GridIndex,GridData*>::const_iterator itersouth = data.find(center.south());
-    std::map<GridIndex,GridData*>::const_iterator itereast = data.find(center.east());
-    std::map<GridIndex,GridData*>::const_iterator iterwest = data.find(center.west());
-
-    if (iternorth == data.end() && iterwest == data.end()) return true;
-    if (iternorth == data.end() && itereast == data.end()) return true;
-    if (itersouth == data.end() && iterwest == data.end()) return true;
-    if (itersouth == data.end() && itereast == data.end()) return true;
+    bool north = find(center.north()) != 0;
+    bool south = find(center.south()) != 0;
+    bool east = find(center.east()) != 0;
+    bool west = find(center.west()) != 0;
+
+    if (!north && !west) return true;
+    if (!north && !east) return true;
+    if (!south && !west) return true;
+    if (!south && !east) return true;
 
     return false;
 }
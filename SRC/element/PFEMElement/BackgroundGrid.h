@@ -50,6 +50,12 @@ public:
 	// if (i == index.i) return j < index.j;
 	// return i < index.i;
     }
+    bool operator==(const GridIndex& index) const {
+	return i == index.i && j == index.j;
+    }
+    unsigned int hash() const {
+	return ((unsigned int)i*73856093u) ^ ((unsigned int)j*19349663u);
+    }
 
     bool isValid() const {return valid;}
 
@@ -73,11 +79,13 @@ private:
 class BackgroundGrid
 {
     struct GridData {
-	GridData():particles(),node(0),elements() {}
+	GridData():particles(),node(0),elements(),index(),link(0) {}
 	
 	std::vector<Particle*> particles;
 	Node* node;
 	std::vector<Element*> elements;
+	GridIndex index;
+	GridData* link; // next grid in the hash bucket
     };
     
 public:
@@ -121,8 +129,15 @@ public:
     // check if corner
     bool isCorner(const GridIndex& center) const;
 
+private:
+    // the grids are found in a hash table, and iterated in the map
+    GridData* find(const GridIndex& index) const;
+    GridData* insert(const GridIndex& index);
+    void rehash(int numBuckets);
+
 private:
     std::map<GridIndex,GridData*> data;
+    std::vector<GridData*> buckets;
     double size;
     std::map<GridIndex,GridData*>::iterator iter;
 };
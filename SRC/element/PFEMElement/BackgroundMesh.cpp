@@ -46,6 +46,8 @@
 #include <fstream>
 #include <iostream>
 #include <string.h>
+#include <set>
+#include <ThreadPool.h>
 
 void* OPS_PVDRecorder();
 
@@ -580,7 +582,8 @@ BackgroundMesh::fix()
 int
 BackgroundMesh::particlesInGrids()
 {
-    
+    // all particles
+    std::vector<Particle*> particles;
     for (int i=0; i<(int)groups.size(); i++) {
 	ParticleGroup* group = groups[i];
 	if (group == 0) continue;
@@ -588,19 +591,28 @@ BackgroundMesh::particlesInGrids()
 	for (int j=0; j<group->numParticles(); j++) {
 	    Particle* p = group->getParticle(j);
 	    if (p == 0) return -1;
-	    
-	    // locate the particle 
-	    const Vector& crds = p->getCrds();
-	    if (crds.Size() < 2) return -1;
-
-	    int nx = (int)floor(crds(0)/grids.getSize());
-	    int ny = (int)floor(crds(1)/grids.getSize());
+	    if (p->getCrds().Size() < 2) return -1;
+	    particles.push_back(p);
+	}
+    }
 
-	    // add particle to the grid
-	    GridIndex index(nx,ny);
-	    grids.addParticle(index,p);
+    // locate the particles 
+    int numP = (int)particles.size();
+    std::vector<int> nx(numP), ny(numP);
+#ifdef _OPENMP
+    int numT = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(static) num_threads(numT)
+#endif
+    for (int j=0; j<numP; j++) {
+	const Vector& crds = particles[j]->getCrds();
+	nx[j] = (int)floor(crds(0)/grids.getSize());
+	ny[j] = (int)floor(crds(1)/grids.getSize());
+    }
 
-	}
+    // add particles to the grids
+    for (int j=0; j<numP; j++) {
+	GridIndex index(nx[j],ny[j]);
+	grids.addParticle(index,particles[j]);
     }
     
     return 0;
@@ -784,77 +796,44 @@ BackgroundMesh::nodesInGrids()
 	return 0;
     }
 
-    // for each grid
+    // all grids
+    std::vector<GridIndex> allindex;
     grids.reset();
     while (grids.isEnd() == false) {
-
-	// get locations of neibors
-	GridIndex index[4];
-	index[0] = grids.getIndex();
-	if (index[0].isValid() == false) {
+	GridIndex index = grids.getIndex();
+	if (index.isValid() == false) {
 	    opserr<<"index[0].isValid() == false\n";
-	    grids.next();
-	    continue;
+	} else {
+	    allindex.push_back(index);
 	}
-	index[1] = index[0].west();
-	index[2] = index[0].southWest();
-	index[3] = index[0].south();
-
-	// grid's crds
-	double x = index[0].getX(grids.getSize());
-	double y = index[0].getY(grids.getSize());
-
-	// nodal data
-	double wt = 0.0, pressure = 0.0;
-	Vector vel;
-	
-	// map all particles in neighbor to current location
-	for (int i=0; i<4; i++) {
-
-	    // particles
-	    std::vector<Particle*>* particles = grids.getParticles(index[i]);
-	    if (particles == 0) continue;
-
-	    // for each particle
-	    for (int j=0; j<(int)particles->size(); j++) {
-
-		Particle* p = (*particles)[j];
-		if (p == 0) continue;
-
-		// particle crds
-		const Vector& crds = p->getCrds();
-		if (crds.Size() < 2) continue;
-
-		// distance from particle to current location
-		double dx = crds(0) - x;
-		double dy = crds(1) - y;
-		double q = sqrt(dx*dx+dy*dy)/grids.getSize();
+	grids.next();
+    }
 
-		// weight for the particle
-		double w = QuinticKernel(q, grids.getSize(), crds.Size());
+    // map particles to the grids, each grid gathers the particles
+    // around it, so the grids are mapped at the same time
+    int numGrids = (int)allindex.size();
+    std::vector<double> allwt(numGrids), allpressure(numGrids);
+    std::vector<Vector> allvel(numGrids);
+#ifdef _OPENMP
+    int numT = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(numT)
+#endif
+    for (int n=0; n<numGrids; n++) {
+	this->gatherParticles(allindex[n], allwt[n], allpressure[n], allvel[n]);
+    }
 
-		// add weight
-		wt += w;
+    // for each grid
+    for (int n=0; n<numGrids; n++) {
 
-		// add pressure
-		pressure += p->getPressure() * w;
+	// grid's crds
+	double x = allindex[n].getX(grids.getSize());
+	double y = allindex[n].getY(grids.getSize());
 
-		// add velocity
-		const Vector& pvel = p->getVel();
-		if (vel.Size() == 0) {
-		    vel.resize(pvel.Size());
-		    vel.Zero();
-		}
-		for (int k=0; k<vel.Size(); k++) {
-		    if (k < pvel.Size()) {
-			vel(k) += w*pvel(k);
-		    }
-		}
-	    }
-	}
+	// nodal data
+	double wt = allwt[n], pressure = allpressure[n];
+	Vector& vel = allvel[n];
 
 	if (wt == 0) {
-	    grids.next();
 	    continue;
 	}
 
@@ -901,16 +880,78 @@ BackgroundMesh::nodesInGrids()
 	}
 
 	// add node to the grid
-	grids.setNode(node);
-
-	// go to next grid
-	grids.next();
+	grids.setNode(allindex[n], node);
     }
    
     
     return 0;
 }
 
+void
+BackgroundMesh::gatherParticles(const GridIndex& center, double& wt,
+				double& pressure, Vector& vel)
+{
+    // get locations of neibors
+    GridIndex index[4];
+    index[0] = center;
+    index[1] = index[0].west();
+    index[2] = index[0].southWest();
+    index[3] = index[0].south();
+
+    // grid's crds
+    double x = index[0].getX(grids.getSize());
+    double y = index[0].getY(grids.getSize());
+
+    // nodal data
+    wt = 0.0;
+    pressure = 0.0;
+	
+    // map all particles in neighbor to current location
+    for (int i=0; i<4; i++) {
+
+	// particles
+	std::vector<Particle*>* particles = grids.getParticles(index[i]);
+	if (particles == 0) continue;
+
+	// for each particle
+	for (int j=0; j<(int)particles->size(); j++) {
+
+	    Particle* p = (*particles)[j];
+	    if (p == 0) continue;
+
+	    // particle crds
+	    const Vector& crds = p->getCrds();
+	    if (crds.Size() < 2) continue;
+
+	    // distance from particle to current location
+	    double dx = crds(0) - x;
+	    double dy = crds(1) - y;
+	    double q = sqrt(dx*dx+dy*dy)/grids.getSize();
+
+	    // weight for the particle
+	    double w = QuinticKernel(q, grids.getSize(), crds.Size());
+
+	    // add weight
+	    wt += w;
+
+	    // add pressure
+	    pressure += p->getPressure() * w;
+
+	    // add velocity
+	    const Vector& pvel = p->getVel();
+	    if (vel.Size() == 0) {
+		vel.resize(pvel.Size());
+		vel.Zero();
+	    }
+	    for (int k=0; k<vel.Size(); k++) {
+		if (k < pvel.Size()) {
+		    vel(k) += w*pvel(k);
+		}
+	    }
+	}
+    }
+}
+
 
 int
 BackgroundMesh::mesh()
@@ -1542,6 +1583,16 @@ BackgroundMesh::moveParticles()
     
     Domain* domain = OPS_GetDomain();
     if (domain == 0) return 0;
+
+    // the cells with elements, their corner nodes and nodal pressures
+    std::vector<GridIndex> cells;
+    std::vector<Node*> cellnodes;
+    std::vector<double> cellpressure;
+    std::vector<bool> structural;
+
+    // the cells whose particles are moved in the elements of the
+    // cells with structural nodes
+    std::set<GridIndex> gathered;
     
     // for each grid
     grids.reset();
@@ -1568,16 +1619,75 @@ BackgroundMesh::moveParticles()
 
 
 	// get all four nodes
-	Node* nodes[4];
+	bool hasStructure = false;
 	for (int i=0; i<4; i++) {
 
 	    // get node
-	    nodes[i] = grids.getNode(index[i]);
-	    if (nodes[i] == 0) {
+	    Node* node = grids.getNode(index[i]);
+	    if (node == 0) {
 		opserr << "WARNING: no corner node "<<i<<"\n";
 		return -1;
 	    }
+	    cellnodes.push_back(node);
+
+	    Pressure_Constraint* pc = domain->getPressure_Constraint(node->getTag());
+	    double pressure = 0.0;
+	    if (pc != 0) pressure = pc->getPressure();
+	    cellpressure.push_back(pressure);
+
+	    // if a corner node is structural node
+	    if (structuralNodes.getLocationOrdered(node->getTag()) >= 0) {
+		hasStructure = true;
+		gathered.insert(index[i]);
+		gathered.insert(index[i].west());
+		gathered.insert(index[i].southWest());
+		gathered.insert(index[i].south());
+	    }
+	}
+
+	cells.push_back(index[0]);
+	structural.push_back(hasStructure);
+	grids.next();
+    }
+
+    // move the particles in the cells without structural nodes,
+    // each particle is in one cell, so the cells are moved at the
+    // same time, except those gathered by the cells with structural
+    // nodes, which are moved in order with them below
+    int numCells = (int)cells.size();
+    std::vector<bool> moved(numCells, false);
+    for (int n=0; n<numCells; n++) {
+	if (structural[n] == false && gathered.find(cells[n]) == gathered.end()) {
+	    moved[n] = true;
 	}
+    }
+#ifdef _OPENMP
+    int numT = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(dynamic, 16) num_threads(numT)
+#endif
+    for (int n=0; n<numCells; n++) {
+	if (moved[n]) {
+	    this->moveParticlesInCell(cells[n], &cellnodes[4*n], &cellpressure[4*n]);
+	}
+    }
+
+    // for the other cells in order
+    for (int n=0; n<numCells; n++) {
+
+	if (moved[n]) continue;
+
+	// get all four grid points
+	GridIndex index[4];
+	index[0] = cells[n];
+	index[1] = index[0].east();
+	index[2] = index[0].northEast();
+	index[3] = index[0].north();
+
+	// get grid elements
+	std::vector<Element*>* eles = grids.getElements(index[0]);
+
+	// get all four nodes
+	Node** nodes = &cellnodes[4*n];
 
 	// if a corner node is structural node
 	// gather particles
@@ -1594,62 +1704,8 @@ BackgroundMesh::moveParticles()
 	// if no structural node, move particles in the cell
 	if (allparticles.empty()) {
 
-	    std::vector<Particle*>* particles = grids.getParticles();
-	    if (particles == 0) {
-		grids.next();
-		continue;
-	    }
-	    if (particles->empty()) {
-		grids.next();
-		continue;
-	    }
-
-	    // grid's crds
-	    double x0 = index[0].getX(grids.getSize());
-	    double y0 = index[0].getY(grids.getSize());
-
-	    // shape functions
-	    Vector N;
-	
-	    // move all particles in the cell
-	    for (int i=0; i<(int)particles->size(); i++) {
-
-		// get shape function
-		const Vector& crds = (*particles)[i]->getCrds();
-		if (crds.Size() < 2) continue;
-		getNForRect(x0,y0,grids.getSize(),grids.getSize(),crds(0),crds(1),N);
-		Vector pdisp(crds.Size());
-		Vector pvel((*particles)[i]->getVel().Size());
-		double ppre = 0.0;
-
-		// interpolation
-		for (int j=0; j<4; j++) {
-		    const Vector& disp = nodes[j]->getDisp();
-		    const Vector& vel = nodes[j]->getVel();
-		    Pressure_Constraint* pc = domain->getPressure_Constraint(nodes[j]->getTag());
-		    double pressure = 0.0;
-		    if (pc != 0) pressure = pc->getPressure();
-
-		    for (int k=0; k<pdisp.Size(); k++) {
-			if (k < disp.Size()) {
-			    pdisp(k) += N(j)*disp(k);
-			}
-		    }
-		    for (int k=0; k<pvel.Size(); k++) {
-			if (k < vel.Size()) {
-			    pvel(k) += N(j)*vel(k);
-			}
-		    }
-		    if (pressure != 0.0) {
-			ppre += N(j) * pressure;
-		    }
-		}
+	    this->moveParticlesInCell(index[0], nodes, &cellpressure[4*n]);
 
-		// move the particle
-		(*particles)[i]->move(pdisp);
-		(*particles)[i]->setVel(pvel);
-		(*particles)[i]->setPressure(ppre);
-	    }
 	} else {
 
 	    // if there is structural nodes, move particles in elements
@@ -1750,13 +1806,69 @@ BackgroundMesh::moveParticles()
 	    }
 
 	}
-	
-	grids.next();
     }
     
     return 0;
 }
 
+void
+BackgroundMesh::moveParticlesInCell(const GridIndex& index, Node** nodes,
+				    const double* nodalPressure)
+{
+    std::vector<Particle*>* particles = grids.getParticles(index);
+    if (particles == 0) {
+	return;
+    }
+    if (particles->empty()) {
+	return;
+    }
+
+    // grid's crds
+    double x0 = index.getX(grids.getSize());
+    double y0 = index.getY(grids.getSize());
+
+    // shape functions
+    Vector N;
+	
+    // move all particles in the cell
+    for (int i=0; i<(int)particles->size(); i++) {
+
+	// get shape function
+	const Vector& crds = (*particles)[i]->getCrds();
+	if (crds.Size() < 2) continue;
+	getNForRect(x0,y0,grids.getSize(),grids.getSize(),crds(0),crds(1),N);
+	Vector pdisp(crds.Size());
+	Vector pvel((*particles)[i]->getVel().Size());
+	double ppre = 0.0;
+
+	// interpolation
+	for (int j=0; j<4; j++) {
+	    const Vector& disp = nodes[j]->getDisp();
+	    const Vector& vel = nodes[j]->getVel();
+	    double pressure = nodalPressure[j];
+
+	    for (int k=0; k<pdisp.Size(); k++) {
+		if (k < disp.Size()) {
+		    pdisp(k) += N(j)*disp(k);
+		}
+	    }
+	    for (int k=0; k<pvel.Size(); k++) {
+		if (k < vel.Size()) {
+		    pvel(k) += N(j)*vel(k);
+		}
+	    }
+	    if (pressure != 0.0) {
+		ppre += N(j) * pressure;
+	    }
+	}
+
+	// move the particle
+	(*particles)[i]->move(pdisp);
+	(*particles)[i]->setVel(pvel);
+	(*particles)[i]->setPressure(ppre);
+    }
+}
+
 void
 BackgroundMesh::getNForRect(double x0, double y0, double hx, double hy, double x, double y,
 			    Vector& N)
@@ -87,6 +87,10 @@ private:
     int fix();
 
     int moveParticles();
+    void gatherParticles(const GridIndex& index, double& wt,
+			 double& pressure, Vector& vel);
+    void moveParticlesInCell(const GridIndex& index, Node** nodes,
+			     const double* pressure);
     // int structureToGrids();
     void clear();
     
@@ -874,14 +874,8 @@ PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups,
     if(numeles == 0) return 0;
     int etag = starteletag-1;
     for(int i=0; i<numeles; i++) {
-        Element* theEle = 0;
-        if(type == 1) {
-            theEle = new PFEMElement2D(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk);
-        } else if(type == 3) {
-            theEle = new PFEMElement2DCompressible(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
-        } else if(type == 4) {
-            theEle = new PFEMElement2DBubble(++etag, eles(3*i), eles(3*i+1), eles(3*i+2),rho, mu, b1, b2, thk, kappa);
-        }
+        Element* theEle = newFluidElement(type, ++etag, eles(3*i), eles(3*i+1), eles(3*i+2),
+                                          rho, mu, b1, b2, thk, kappa);
         
         if(theEle == 0) {
             opserr<<"WARNING: no enough memory -- ";
@@ -906,6 +900,171 @@ PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups,
     
 }
 
+Element*
+PFEMMesher2D::newFluidElement(int type, int tag, int nd1, int nd2, int nd3,
+                              double rho, double mu, double b1, double b2,
+                              double thk, double kappa)
+{
+    Element* theEle = 0;
+    if(type == 1) {
+        theEle = new PFEMElement2D(tag, nd1, nd2, nd3, rho, mu, b1, b2, thk);
+    } else if(type == 3) {
+        theEle = new PFEMElement2DCompressible(tag, nd1, nd2, nd3, rho, mu, b1, b2, thk, kappa);
+    } else if(type == 4) {
+        theEle = new PFEMElement2DBubble(tag, nd1, nd2, nd3, rho, mu, b1, b2, thk, kappa);
+    }
+    return theEle;
+}
+
+// linear elements of an element region: the elements of the triangles
+// found again are kept, only those of the triangles gone are removed and
+// those of the new triangles added, so that the domain is not changed if
+// the triangles are the same. With threshold > 0 the triangulation is
+// skipped if the nodes are the same and none has moved more than the
+// threshold since the region was meshed; the isolated nodes are still
+// moved by identify(). Returns the number of elements removed and added.
+int
+PFEMMesher2D::updateTriangulation(int starteletag, int eleRegTag, double alpha,
+                                  const ID& groups, const ID& addgroups,
+                                  Domain* theDomain, double rho, double mu,
+                                  double b1, double b2, double thk, double kappa,
+                                  int type, double threshold, int& endele)
+{
+    if(theDomain == 0) {
+        opserr<<"WARNING: null domain";
+        opserr<<" -- PFEMMesher2D::updateTriangulation\n";
+        return -1;
+    }
+
+    endele = starteletag-1;
+    MeshState& state = meshStates[eleRegTag];
+
+    // current positions
+    std::map<int,int> fluidNodes;
+    getNodes(groups,fluidNodes,theDomain);
+    getNodes(addgroups,fluidNodes,theDomain);
+    std::map<int, std::pair<double,double> > crds;
+    bool moved = fluidNodes.size() != state.crds.size();
+    for(std::map<int,int>::iterator it=fluidNodes.begin(); it!=fluidNodes.end(); it++) {
+        Node* node = theDomain->getNode(it->first);
+        if(node == 0) continue;
+        const Vector& coord = node->getCrds();
+        const Vector& disp = node->getTrialDisp();
+        if(coord.Size() < 2 || disp.Size() < 2) {
+            opserr<<"WARNING: 2d and 2 ndf are required -- PFEMMesher2D::updateTriangulation\n";
+            return -1;
+        }
+        std::pair<double,double>& crd = crds[it->first];
+        crd.first = coord(0)+disp(0);
+        crd.second = coord(1)+disp(1);
+
+        if(moved == false) {
+            std::map<int, std::pair<double,double> >::iterator meshed = state.crds.find(it->first);
+            if(meshed == state.crds.end()) {
+                moved = true;
+            } else {
+                double dx = crd.first-meshed->second.first;
+                double dy = crd.second-meshed->second.second;
+                moved = sqrt(dx*dx+dy*dy) > threshold;
+            }
+        }
+    }
+
+    MeshRegion* eleReg = theDomain->getRegion(eleRegTag);
+    if(threshold > 0 && moved == false && eleReg != 0) {
+        identify(b2,theDomain);
+        return 0;
+    }
+
+    // do triangulation
+    ID eles;
+    int res = doTriangulation(alpha,groups,addgroups,theDomain,eles);
+    if(res < 0) {
+        opserr<<"WARNING: failed to do triangulation --";
+        opserr<<"PFEMMesher2D::updateTriangulation\n";
+        return res;
+    }
+
+    // the new triangles, with their sorted nodes
+    int numeles = eles.Size()/3;
+    std::map<std::vector<int>, int> newTriangles;
+    std::vector<int> nds(3);
+    for(int i=0; i<numeles; i++) {
+        for(int j=0; j<3; j++) {
+            nds[j] = eles(3*i+j);
+        }
+        std::sort(nds.begin(),nds.end());
+        newTriangles[nds] = i;
+    }
+
+    // keep the elements of the triangles found again, remove the others
+    int numchanged = 0;
+    std::vector<bool> kept(numeles, false);
+    std::map<int, std::vector<int> > triangles;
+    if(eleReg != 0) {
+        ID regEles = eleReg->getElements();
+        for(int i=0; i<regEles.Size(); i++) {
+            int etag = regEles(i);
+            std::map<int, std::vector<int> >::iterator it = state.triangles.find(etag);
+            if(it != state.triangles.end() && theDomain->getElement(etag) != 0) {
+                std::map<std::vector<int>, int>::iterator found = newTriangles.find(it->second);
+                if(found != newTriangles.end() && kept[found->second] == false) {
+                    kept[found->second] = true;
+                    triangles[etag] = it->second;
+                    continue;
+                }
+            }
+            Element* ele = theDomain->removeElement(etag);
+            if(ele != 0) {
+                delete ele;
+                numchanged++;
+            }
+        }
+    }
+
+    // add the elements of the new triangles
+    int etag = starteletag-1;
+    for(int i=0; i<numeles; i++) {
+        if(kept[i]) continue;
+        Element* theEle = newFluidElement(type, ++etag, eles(3*i), eles(3*i+1), eles(3*i+2),
+                                          rho, mu, b1, b2, thk, kappa);
+        if(theEle == 0) {
+            opserr<<"WARNING: no enough memory -- ";
+            opserr<<" -- PFEMMesher2D::updateTriangulation\n";
+            return -1;
+        }
+        if(theDomain->addElement(theEle) == false) {
+            opserr<<"WARNING: failed to add element to domain -- ";
+            opserr<<" -- PFEMMesher2D::updateTriangulation\n";
+            delete theEle;
+            return -1;
+        }
+        for(int j=0; j<3; j++) {
+            nds[j] = eles(3*i+j);
+        }
+        std::sort(nds.begin(),nds.end());
+        triangles[etag] = nds;
+        numchanged++;
+    }
+    endele = etag;
+
+    // the elements of the region
+    ID regioneles(0, (int)triangles.size());
+    int num = 0;
+    for(std::map<int, std::vector<int> >::iterator it=triangles.begin(); it!=triangles.end(); it++) {
+        regioneles[num++] = it->first;
+    }
+    setElements(regioneles,eleRegTag,true,0,theDomain);
+
+    state.triangles.swap(triangles);
+    state.crds.swap(crds);
+
+    // identify
+    identify(b2,theDomain);
+
+    return numchanged;
+}
+
 // solid elements
 int
 PFEMMesher2D::doTriangulation(int starteletag, double alpha, const ID& groups, 
@@ -2007,4 +2166,7 @@ PFEMMesher2D::removeElements(int regTag, Domain* theDomain)
         }
         eleReg->setElements(ID());
     }
+
+    // the region is no longer meshed by updateTriangulation
+    meshStates.erase(regTag);
 }
@@ -49,6 +49,7 @@ extern "C" {
 #include <vector>
 
 class Domain;
+class Element;
 
 
 class PFEMMesher2D 
@@ -118,6 +119,14 @@ public:
                         double p, double rho, double b1, double b2, 
                         int& endele);
 
+    // linear elements of an element region, keeping the elements
+    // of the triangles found again
+    int updateTriangulation(int startele, int eleRegTag, double alpha,
+                            const ID& groups, const ID& addgroups,
+                            Domain* theDomain, double rho, double mu,
+                            double b1, double b2, double thk, double kappa,
+                            int type, double threshold, int& endele);
+
     // Crouzeix-Raviart element
     int doTriangulation(int newNodeRegTag, int eleRegTag,
                         double alpha, const ID& groups, const ID& addgroups,
@@ -168,8 +177,22 @@ private:
     void freeTri(triangulateio& tri);
     void freeTriOut(triangulateio& tri);
     
+    // linear element
+    Element* newFluidElement(int type, int tag, int nd1, int nd2, int nd3,
+                             double rho, double mu, double b1, double b2,
+                             double thk, double kappa);
+
     // PI
     static double PI;
+
+    // an element region meshed by updateTriangulation
+    struct MeshState {
+        // the sorted nodes of each element
+        std::map<int, std::vector<int> > triangles;
+        // the positions of the nodes when meshed
+        std::map<int, std::pair<double,double> > crds;
+    };
+    std::map<int, MeshState> meshStates;
 };
 
 
@@ -2066,7 +2066,8 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                 opserr << "-PFEMElement2D {rho mu b1 b2 <thk kappa>} ";
                 opserr << "-PFEMElement2DCompressible {rho mu b1 b2 <thk kappa>} ";
                 opserr << "-PFEMElement2DBubble {rho mu b1 b2 <thk kappa>} ";
-                opserr << "-Tri31 {thk type matTag <pressure rho b1 b2>}\n ";
+                opserr << "-Tri31 {thk type matTag <pressure rho b1 b2>} ";
+                opserr << "<-incremental threshold>\n ";
                 return TCL_ERROR;
             }
             double alpha;
@@ -2085,6 +2086,8 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
             int eletype = 0;
             std::string type;
             ID nodes, addnodes;
+            bool incremental = false;
+            double threshold = 0.0;
             while(loc < argc) {
 
                 Vector* vecPtr = 0;
@@ -2094,6 +2097,15 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     idPtr = &nodes;
                     loc++;
 
+                } else if(strcmp(argv[loc], "-incremental") == 0) {
+                    if(loc+1 >= argc || 
+                       Tcl_GetDouble(interp, argv[loc+1], &threshold) != TCL_OK) {
+                        opserr<<"WARNING: invalid threshold -- PFEM2D region mesh\n";
+                        return TCL_ERROR;
+                    }
+                    incremental = true;
+                    loc++;
+
                 } else if(strcmp(argv[loc], "-addNodeRegions") == 0) {
                     idPtr = &addnodes;
                     loc++;
@@ -2186,6 +2198,27 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     kappa = params(5);
                 }
 
+                // keep the elements of the triangles found again
+                if(incremental) {
+                    int startele = theMesher2D.findEleTag(theDomain);
+                    int endele = startele;
+                    res = theMesher2D.updateTriangulation(startele,eleRegTag,alpha,
+                                                          nodes,addnodes,theDomain,
+                                                          rho,mu,b1,b2,thk,kappa,
+                                                          eletype,threshold,endele);
+                    if(res < 0) {
+                        opserr<<"WARNING: failed to mesh -- ";
+                        opserr<<" -- PFEM2D region mesh\n";
+                        return TCL_ERROR; 
+                    }
+
+                    // the number of elements removed and added
+                    char buffer[40];
+                    sprintf(buffer, "%d", res);
+                    Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+                    return TCL_OK;
+                }
+
                 // remove all elements in eleReg
                 theMesher2D.removeElements(eleRegTag,theDomain);
 
@@ -2237,6 +2270,11 @@ TclModelBuilderPFEM2DCommand(ClientData clientData, Tcl_Interp *interp, int argc
                     b2 = params(6);
                 }
 
+                if(incremental) {
+                    opserr<<"WARNING: -incremental is only for the PFEM elements, ignored";
+                    opserr<<" -- PFEM2D region mesh\n";
+                }
+
                 // remove all elements in eleReg
                 theMesher2D.removeElements(eleRegTag,theDomain);
             
@@ -35,6 +35,7 @@
 #include <Element.h>
 #include <stdlib.h>
 #include <string.h>
+#include <map>
 #include <OPS_Stream.h>
 #include <Domain.h>
 
@@ -106,6 +107,7 @@ extern void *OPS_ElasticBeam2d(void);
 extern void *OPS_ElasticBeam3d(void);
 extern void *OPS_ElasticTimoshenkoBeam2d(void);
 extern void *OPS_ElasticTimoshenkoBeam3d(void);
+extern void *OPS_SuperElement(void);
 extern void *OPS_TPB1D(void);
 extern void *OPS_BeamEndContact3D(void);
 extern void *OPS_BeamEndContact3Dp(void);
@@ -151,6 +153,9 @@ extern void *OPS_PFEMElement2D();
 extern int TclModelBuilder_addFeapTruss(ClientData clientData, Tcl_Interp *interp,  int argc,
 					TCL_Char **argv, Domain*, TclModelBuilder *, int argStart);
 
+extern int TclModelBuilder_addTrussGroup(ClientData clientData, Tcl_Interp *interp, int argc,
+					 TCL_Char **argv, Domain*, TclModelBuilder *);
+
 extern int
 Tcl_addWrapperElement(eleObj *, ClientData clientData, Tcl_Interp *interp,  int argc,
 		      TCL_Char **argv, Domain*, TclModelBuilder *);
@@ -352,6 +357,110 @@ extern int
 TclModelBuilder_addYamamotoBiaxialHDR(ClientData clientData, Tcl_Interp *interp,  int argc,
 				  TCL_Char **argv, Domain*, TclModelBuilder *);
 
+namespace {
+
+  struct char_cmp { 
+    bool operator () (const char *a,const char *b) const 
+    {
+      return strcmp(a,b)<0;
+    } 
+  };
+
+  typedef std::map<const char *, void *(*)(void), char_cmp> OPS_ParsingFunctionMap;
+
+  // the element types built by a single OPS_ function, by name
+  static OPS_ParsingFunctionMap elementFunctions;
+
+  static void setUpElementFunctions(void)
+  {
+    elementFunctions.insert(std::make_pair("trussSection", &OPS_TrussSectionElement));
+    elementFunctions.insert(std::make_pair("TrussSection", &OPS_TrussSectionElement));
+    elementFunctions.insert(std::make_pair("corotTrussSection", &OPS_CorotTrussSectionElement));
+    elementFunctions.insert(std::make_pair("CorotTrussSection", &OPS_CorotTrussSectionElement));
+    elementFunctions.insert(std::make_pair("zeroLengthContactNTS2D", &OPS_ZeroLengthContactNTS2D));
+    elementFunctions.insert(std::make_pair("zeroLengthInterface2D", &OPS_ZeroLengthInterface2D));
+    elementFunctions.insert(std::make_pair("componentElement2d", &OPS_ComponentElement2d));
+    elementFunctions.insert(std::make_pair("zeroLengthImpact3D", &OPS_ZeroLengthImpact3D));
+    elementFunctions.insert(std::make_pair("superElement", &OPS_SuperElement));
+    elementFunctions.insert(std::make_pair("SuperElement", &OPS_SuperElement));
+    elementFunctions.insert(std::make_pair("pyMacro2D", &OPS_PY_Macro2D));
+    elementFunctions.insert(std::make_pair("PY_Macro2D", &OPS_PY_Macro2D));
+    elementFunctions.insert(std::make_pair("SimpleContact2d", &OPS_SimpleContact2D));
+    elementFunctions.insert(std::make_pair("SimpleContact2D", &OPS_SimpleContact2D));
+    elementFunctions.insert(std::make_pair("N4BiaxialTruss", &OPS_N4BiaxialTruss));
+    elementFunctions.insert(std::make_pair("SimpleContact3d", &OPS_SimpleContact3D));
+    elementFunctions.insert(std::make_pair("SimpleContact3D", &OPS_SimpleContact3D));
+    elementFunctions.insert(std::make_pair("BeamContact3d", &OPS_BeamContact3D));
+    elementFunctions.insert(std::make_pair("BeamContact3D", &OPS_BeamContact3D));
+    elementFunctions.insert(std::make_pair("BeamContact3dp", &OPS_BeamContact3Dp));
+    elementFunctions.insert(std::make_pair("BeamContact3Dp", &OPS_BeamContact3Dp));
+    elementFunctions.insert(std::make_pair("PileToe3d", &OPS_PileToe3D));
+    elementFunctions.insert(std::make_pair("PileToe3D", &OPS_PileToe3D));
+    elementFunctions.insert(std::make_pair("TFPbearing", &OPS_TFP_Bearing));
+    elementFunctions.insert(std::make_pair("TFP", &OPS_TFP_Bearing));
+    elementFunctions.insert(std::make_pair("FPBearingPTV", &OPS_FPBearingPTV));
+    elementFunctions.insert(std::make_pair("TripleFrictionPendulum", &OPS_TripleFrictionPendulum));
+    elementFunctions.insert(std::make_pair("HDR", &OPS_HDR));
+    elementFunctions.insert(std::make_pair("LeadRubberX", &OPS_LeadRubberX));
+    elementFunctions.insert(std::make_pair("ElastomericX", &OPS_ElastomericX));
+    elementFunctions.insert(std::make_pair("MVLEM", &OPS_MVLEM));
+    elementFunctions.insert(std::make_pair("SFI_MVLEM", &OPS_SFI_MVLEM));
+    elementFunctions.insert(std::make_pair("MultiFP2d", &OPS_MultiFP2d));
+    elementFunctions.insert(std::make_pair("MultiFPB2d", &OPS_MultiFP2d));
+    elementFunctions.insert(std::make_pair("shell", &OPS_ShellMITC4));
+    elementFunctions.insert(std::make_pair("shellMITC4", &OPS_ShellMITC4));
+    elementFunctions.insert(std::make_pair("Shell", &OPS_ShellMITC4));
+    elementFunctions.insert(std::make_pair("ShellMITC4", &OPS_ShellMITC4));
+    elementFunctions.insert(std::make_pair("shellNL", &OPS_ShellMITC9));
+    elementFunctions.insert(std::make_pair("ShellNL", &OPS_ShellMITC9));
+    elementFunctions.insert(std::make_pair("shellMITC9", &OPS_ShellMITC9));
+    elementFunctions.insert(std::make_pair("ShellMITC9", &OPS_ShellMITC9));
+    elementFunctions.insert(std::make_pair("shellDKGQ", &OPS_ShellDKGQ));
+    elementFunctions.insert(std::make_pair("ShellDKGQ", &OPS_ShellDKGQ));
+    elementFunctions.insert(std::make_pair("shellNLDKGQ", &OPS_ShellNLDKGQ));
+    elementFunctions.insert(std::make_pair("ShellNLDKGQ", &OPS_ShellNLDKGQ));
+    elementFunctions.insert(std::make_pair("CoupledZeroLength", &OPS_CoupledZeroLength));
+    elementFunctions.insert(std::make_pair("ZeroLengthCoupled", &OPS_CoupledZeroLength));
+    elementFunctions.insert(std::make_pair("BeamContact2d", &OPS_BeamContact2D));
+    elementFunctions.insert(std::make_pair("BeamContact2D", &OPS_BeamContact2D));
+    elementFunctions.insert(std::make_pair("BeamContact2dp", &OPS_BeamContact2Dp));
+    elementFunctions.insert(std::make_pair("BeamContact2Dp", &OPS_BeamContact2Dp));
+    elementFunctions.insert(std::make_pair("BeamEndContact3d", &OPS_BeamEndContact3D));
+    elementFunctions.insert(std::make_pair("BeamEndContact3D", &OPS_BeamEndContact3D));
+    elementFunctions.insert(std::make_pair("BeamEndContact3dp", &OPS_BeamEndContact3Dp));
+    elementFunctions.insert(std::make_pair("BeamEndContact3Dp", &OPS_BeamEndContact3Dp));
+    elementFunctions.insert(std::make_pair("Tri31", &OPS_Tri31));
+    elementFunctions.insert(std::make_pair("tri31", &OPS_Tri31));
+    elementFunctions.insert(std::make_pair("SSPquad", &OPS_SSPquad));
+    elementFunctions.insert(std::make_pair("SSPQuad", &OPS_SSPquad));
+    elementFunctions.insert(std::make_pair("SSPquadUP", &OPS_SSPquadUP));
+    elementFunctions.insert(std::make_pair("SSPQuadUP", &OPS_SSPquadUP));
+    elementFunctions.insert(std::make_pair("SSPbrick", &OPS_SSPbrick));
+    elementFunctions.insert(std::make_pair("SSPBrick", &OPS_SSPbrick));
+    elementFunctions.insert(std::make_pair("SSPbrickUP", &OPS_SSPbrickUP));
+    elementFunctions.insert(std::make_pair("SSPBrickUP", &OPS_SSPbrickUP));
+    elementFunctions.insert(std::make_pair("SurfaceLoad", &OPS_SurfaceLoad));
+    elementFunctions.insert(std::make_pair("TPB1D", &OPS_TPB1D));
+    elementFunctions.insert(std::make_pair("elasticTubularJoint", &OPS_ElasticTubularJoint));
+    elementFunctions.insert(std::make_pair("ElasticTubularJoint", &OPS_ElasticTubularJoint));
+    elementFunctions.insert(std::make_pair("quad3d", &OPS_FourNodeQuad3d));
+    elementFunctions.insert(std::make_pair("Quad3d", &OPS_FourNodeQuad3d));
+    elementFunctions.insert(std::make_pair("Quad4FiberOverlay", &OPS_Quad4FiberOverlay));
+    elementFunctions.insert(std::make_pair("Brick8FiberOverlay", &OPS_Brick8FiberOverlay));
+    elementFunctions.insert(std::make_pair("QuadBeamEmbedContact", &OPS_QuadBeamEmbedContact));
+    elementFunctions.insert(std::make_pair("Truss2", &OPS_Truss2));
+    elementFunctions.insert(std::make_pair("CorotTruss2", &OPS_CorotTruss2));
+    elementFunctions.insert(std::make_pair("AC3D8", &OPS_AC3D8HexWithSensitivity));
+    elementFunctions.insert(std::make_pair("ASI3D8", &OPS_ASID8QuadWithSensitivity));
+    elementFunctions.insert(std::make_pair("AV3D4", &OPS_AV3D4QuadWithSensitivity));
+    elementFunctions.insert(std::make_pair("elastomericBearingBoucWenMod", &OPS_ElastomericBearingBoucWenMod3d));
+    elementFunctions.insert(std::make_pair("VS3D4", &OPS_VS3D4WuadWithSensitivity));
+    elementFunctions.insert(std::make_pair("PFEMElement2DBuble", &OPS_PFEMElement2DBubble));
+    elementFunctions.insert(std::make_pair("PFEMElement2DMini", &OPS_PFEMElement2DMini));
+    elementFunctions.insert(std::make_pair("PFEMElement2D", &OPS_PFEMElement2D));
+  }
+}
+
 int
 TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
 			      int argc, TCL_Char **argv,
@@ -363,6 +472,11 @@ TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
     return TCL_ERROR;
   }
 
+  static bool initDone = false;
+  if (initDone == false) {
+    setUpElementFunctions();
+    initDone = true;
+  }
 
   OPS_ResetInput(clientData, interp, 2, argc, argv, theTclDomain, theTclBuilder);
 
@@ -375,31 +489,35 @@ TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
 
   Element *theElement = 0;
 
-  if ((strcmp(argv[1],"truss") == 0) || (strcmp(argv[1],"Truss") == 0)) {
-    
-    void *theEle = OPS_TrussElement();
-    // for backward compatability
-	if (theEle == 0) {
-      theEle = OPS_TrussSectionElement(); 
-	}
+  // the element types built by a single OPS_ function are looked up in
+  // the table, the others are matched in the chain below
+  OPS_ParsingFunctionMap::const_iterator iter = elementFunctions.find(argv[1]);
+  if (iter != elementFunctions.end()) {
 
+    void *theEle = (*iter->second)();
     if (theEle != 0) 
       theElement = (Element *)theEle;
-
     else  {
       opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
       return TCL_ERROR;      
     }
 
-  } else if ((strcmp(argv[1],"trussSection") == 0) || (strcmp(argv[1],"TrussSection") == 0)) {
+  } else if ((strcmp(argv[1],"truss") == 0) || (strcmp(argv[1],"Truss") == 0)) {
+    
+    void *theEle = OPS_TrussElement();
+    // for backward compatability
+	if (theEle == 0) {
+      theEle = OPS_TrussSectionElement(); 
+	}
 
-    void *theEle = OPS_TrussSectionElement(); 
     if (theEle != 0) 
       theElement = (Element *)theEle;
+
     else  {
       opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
       return TCL_ERROR;      
     }
+
   }
 
   else if ((strcmp(argv[1],"corotTruss") == 0) || (strcmp(argv[1],"CorotTruss") == 0)) {
@@ -417,63 +535,6 @@ TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
       return TCL_ERROR;      
     }
 
-  } else if ((strcmp(argv[1],"corotTrussSection") == 0) || (strcmp(argv[1],"CorotTrussSection") == 0)) {
-
-    void *theEle = OPS_CorotTrussSectionElement(); 
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else  {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;      
-    }
-
-  } else if (strcmp(argv[1],"zeroLengthContactNTS2D") == 0) {
-      Element *theEle = (Element*) OPS_ZeroLengthContactNTS2D();
-    if (theEle != 0) 
-      theElement = theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"zeroLengthInterface2D") == 0) {
-      Element *theEle = (Element*) OPS_ZeroLengthInterface2D();
-    if (theEle != 0) 
-      theElement = theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-
-  } else if (strcmp(argv[1],"componentElement2d") == 0) {
-    void *theEle = OPS_ComponentElement2d();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-    /*
-  } else if (strcmp(argv[1],"componentElementDamp2d") == 0) {
-    void *theEle = OPS_ComponentElementDamp2d();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-    */
-  } else if (strcmp(argv[1],"zeroLengthImpact3D") == 0) {
-    void *theEle = OPS_ZeroLengthImpact3D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
   } else if ((strcmp(argv[1],"ModElasticBeam2d") == 0) || (strcmp(argv[1],"modElasticBeam2d")) == 0) {
     Element *theEle = (Element *)OPS_ModElasticBeam2d();
     if (theEle != 0) 
@@ -509,483 +570,6 @@ TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
       return TCL_ERROR;
     }
 
-  } else if ((strcmp(argv[1],"pyMacro2D") == 0) || (strcmp(argv[1],"PY_Macro2D") == 0)) {
-    
-    void *theEle = OPS_PY_Macro2D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"SimpleContact2d") == 0) || (strcmp(argv[1],"SimpleContact2D") == 0)) {
-    
-    void *theEle = OPS_SimpleContact2D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"N4BiaxialTruss") == 0)) {
-    
-    void *theEle = OPS_N4BiaxialTruss();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																								
-  } else if ((strcmp(argv[1],"SimpleContact3d") == 0) || (strcmp(argv[1],"SimpleContact3D") == 0)) {
-    
-    void *theEle = OPS_SimpleContact3D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"BeamContact3d") == 0) || (strcmp(argv[1],"BeamContact3D") == 0)) {
-    
-    void *theEle = OPS_BeamContact3D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"BeamContact3dp") == 0) || (strcmp(argv[1],"BeamContact3Dp") == 0)) {
-    
-    void *theEle = OPS_BeamContact3Dp();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-    
-  } else if ((strcmp(argv[1],"PileToe3d") == 0) || (strcmp(argv[1],"PileToe3D") == 0)) {
-    
-    void *theEle = OPS_PileToe3D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"TFPbearing") == 0) || (strcmp(argv[1],"TFP") == 0)) {
-    
-    void *theEle = OPS_TFP_Bearing();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"FPBearingPTV") == 0)) {
-    
-    void *theEle = OPS_FPBearingPTV();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"TripleFrictionPendulum") == 0) {
-    
-    void *theEle = OPS_TripleFrictionPendulum();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"HDR") == 0) {
-    
-    void *theEle = OPS_HDR();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"LeadRubberX") == 0) {
-    
-    void *theEle = OPS_LeadRubberX();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"ElastomericX") == 0) {
-    
-    void *theEle = OPS_ElastomericX();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"MVLEM") == 0) {
-    
-    void *theEle = OPS_MVLEM();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if (strcmp(argv[1],"SFI_MVLEM") == 0) {
-    
-    void *theEle = OPS_SFI_MVLEM();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"MultiFP2d") == 0) || (strcmp(argv[1],"MultiFPB2d") == 0)){
-    
-    void *theEle = OPS_MultiFP2d();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"shell") == 0) || (strcmp(argv[1],"shellMITC4") == 0) ||
-	     (strcmp(argv[1],"Shell") == 0) || (strcmp(argv[1],"ShellMITC4") == 0)) {
-    
-    void *theEle = OPS_ShellMITC4();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }    
-
-  } else if ((strcmp(argv[1],"shellNL") == 0) || (strcmp(argv[1],"ShellNL") == 0) ||
-	     (strcmp(argv[1],"shellMITC9") == 0) || (strcmp(argv[1],"ShellMITC9") == 0)) {
-    
-    void *theEle = OPS_ShellMITC9();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }    
-
-  } else if ((strcmp(argv[1],"shellDKGQ") == 0) || (strcmp(argv[1],"ShellDKGQ") == 0)) {     //Lisha Wang & Xinzheng Lu
-    
-    void *theEle = OPS_ShellDKGQ();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }    
-
-  } else if ((strcmp(argv[1],"shellNLDKGQ") == 0) || (strcmp(argv[1],"ShellNLDKGQ") == 0)) {    //Lisha Wang & Xinzheng Lu
-    
-    void *theEle = OPS_ShellNLDKGQ();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    } 
-    
-    
-  } else if ((strcmp(argv[1],"CoupledZeroLength") == 0) || (strcmp(argv[1],"ZeroLengthCoupled") == 0)) {
-    
-    void *theEle = OPS_CoupledZeroLength();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"BeamContact2d") == 0) || (strcmp(argv[1],"BeamContact2D") == 0)) {
-    
-    void *theEle = OPS_BeamContact2D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"BeamContact2dp") == 0) || (strcmp(argv[1],"BeamContact2Dp") == 0)) {
-    
-    void *theEle = OPS_BeamContact2Dp();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"BeamEndContact3d") == 0) || (strcmp(argv[1],"BeamEndContact3D") == 0)) {
-    
-    void *theEle = OPS_BeamEndContact3D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"BeamEndContact3dp") == 0) || (strcmp(argv[1],"BeamEndContact3Dp") == 0)) {
-    
-    void *theEle = OPS_BeamEndContact3Dp();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"Tri31") == 0) || (strcmp(argv[1],"tri31") == 0)) {
-    
-    void *theEle = OPS_Tri31();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"SSPquad") == 0) || (strcmp(argv[1],"SSPQuad") == 0)) {
-    
-    void *theEle = OPS_SSPquad();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"SSPquadUP") == 0) || (strcmp(argv[1],"SSPQuadUP") == 0)) {
-    
-    void *theEle = OPS_SSPquadUP();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"SSPbrick") == 0) || (strcmp(argv[1],"SSPBrick") == 0)) {
-    
-    void *theEle = OPS_SSPbrick();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"SSPbrickUP") == 0) || (strcmp(argv[1],"SSPBrickUP") == 0)) {
-    
-    void *theEle = OPS_SSPbrickUP();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"SurfaceLoad") == 0)) {
-    
-    void *theEle = OPS_SurfaceLoad();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"TPB1D") == 0)) {
-    
-    void *theEle = OPS_TPB1D();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-  
-  } else if ((strcmp(argv[1],"elasticTubularJoint") == 0) || (strcmp(argv[1],"ElasticTubularJoint") == 0)) {
-    
-    void *theEle = OPS_ElasticTubularJoint();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-
-  } else if ((strcmp(argv[1],"quad3d") == 0) || (strcmp(argv[1],"Quad3d") == 0)) {
-
-    void *theEle = OPS_FourNodeQuad3d();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "TclElementCommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }	
-
-  } else if ((strcmp(argv[1],"Quad4FiberOverlay") == 0)) { 	//////////////////////// mmc
-    
-    void *theEle = OPS_Quad4FiberOverlay();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																								
-  } else if ((strcmp(argv[1],"Brick8FiberOverlay") == 0)) { //////////////////////// mmc
-    
-    void *theEle = OPS_Brick8FiberOverlay();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																									
-  } else if ((strcmp(argv[1],"QuadBeamEmbedContact") == 0)) { 	//////////////////////// mmc
-    
-    void *theEle = OPS_QuadBeamEmbedContact();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																								
-  } else if ((strcmp(argv[1],"Truss2") == 0)) { 	//////////////////////// mmc
-    
-    void *theEle = OPS_Truss2();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																								
-  } else if ((strcmp(argv[1],"CorotTruss2") == 0)) { 	//////////////////////// mmc
-    
-    void *theEle = OPS_CorotTruss2();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																								
-  }  
-
-  else if (strcmp(argv[1], "AC3D8") == 0) {
-      
-    void *theEle = OPS_AC3D8HexWithSensitivity();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }																								
-  }
-
-  else if (strcmp(argv[1], "ASI3D8") == 0) {
-    
-    void *theEle = OPS_ASID8QuadWithSensitivity();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-    
-  } 
-
-  else if (strcmp(argv[1], "AV3D4") == 0) {
-    
-    void *theEle = OPS_AV3D4QuadWithSensitivity();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-  } 
-  
-
-  else if (strcmp(argv[1],"elastomericBearingBoucWenMod") == 0) {
-    void *theEle = OPS_ElastomericBearingBoucWenMod3d();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-  }
-
-
-  else if (strcmp(argv[1], "VS3D4") == 0) {
-
-    void *theEle = OPS_VS3D4WuadWithSensitivity();
-    if (theEle != 0) 
-      theElement = (Element *)theEle;
-    else {
-      opserr << "tclelementcommand -- unable to create element of type : " << argv[1] << endln;
-      return TCL_ERROR;
-    }
-  }
-
-  else if (strcmp(argv[1], "PFEMElement2DBuble") == 0) {
-      void *theEle = OPS_PFEMElement2DBubble();
-      if (theEle != 0) {
-	  theElement = (Element*)theEle;
-      } else {
-	  opserr<<"tclelementcommand -- unable to create element of type : "
-		<<argv[1]<<endln;
-	  return TCL_ERROR;
-      }
-  }
-
-  else if (strcmp(argv[1], "PFEMElement2DMini") == 0) {
-      void *theEle = OPS_PFEMElement2DMini();
-      if (theEle != 0) {
-	  theElement = (Element*)theEle;
-      } else {
-	  opserr<<"tclelementcommand -- unable to create element of type : "
-		<<argv[1]<<endln;
-	  return TCL_ERROR;
-      }
-  }
-
-  else if (strcmp(argv[1], "PFEMElement2D") == 0) {
-      void *theEle = OPS_PFEMElement2D();
-      if (theEle != 0) {
-	  theElement = (Element*)theEle;
-      } else {
-	  opserr<<"tclelementcommand -- unable to create element of type : "
-		<<argv[1]<<endln;
-	  return TCL_ERROR;
-      }
   }
 
 
@@ -1007,6 +591,11 @@ TclModelBuilderElementCommand(ClientData clientData, Tcl_Interp *interp,
 					      theTclDomain, theTclBuilder, eleArgStart);
     return result;
 
+  } else if (strcmp(argv[1],"trussGroup") == 0) {
+    int result = TclModelBuilder_addTrussGroup(clientData, interp, argc, argv,
+					       theTclDomain, theTclBuilder);
+    return result;
+
   } else if (strcmp(argv[1],"dispBeamColumnInt") == 0) {
     int result = TclModelBuilder_addDispBeamColumnInt(clientData, interp, argc, argv,
 						   theTclDomain, theTclBuilder);
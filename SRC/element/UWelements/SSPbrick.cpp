@@ -745,6 +745,26 @@ SSPbrick::getResistingForceIncInertia()
   return mInternalForces;
 }
 
+bool
+SSPbrick::hasConstantTangent(void)
+// the tangent is constant for an elastic material, with no body forces the
+// resisting force is then the tangent times the displacements
+{
+	switch (theMaterial->getClassTag()) {
+	case ND_TAG_ElasticIsotropic:
+	case ND_TAG_ElasticIsotropicPlaneStrain2d:
+	case ND_TAG_ElasticIsotropicPlaneStress2d:
+	case ND_TAG_ElasticIsotropicThreeDimensional:
+	case ND_TAG_ElasticOrthotropic:
+	case ND_TAG_ElasticOrthotropicPlaneStrain2d:
+	case ND_TAG_ElasticOrthotropicPlaneStress2d:
+	case ND_TAG_ElasticOrthotropicThreeDimensional:
+		return b[0] == 0.0 && b[1] == 0.0 && b[2] == 0.0;
+	default:
+		return false;
+	}
+}
+
 int
 SSPbrick::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -76,6 +76,7 @@ class SSPbrick : public Element
 	int addInertiaLoadToUnbalance(const Vector &accel);
 	const Vector &getResistingForce(void);
 	const Vector &getResistingForceIncInertia(void);
+	bool hasConstantTangent(void);
 
 	// public methods for element output
 	int sendSelf(int commitTag, Channel &theChannel);
@@ -541,6 +541,26 @@ SSPquad::getResistingForceIncInertia()
 	return mInternalForces;
 }
 
+bool
+SSPquad::hasConstantTangent(void)
+// the tangent is constant for an elastic material, with no body forces the
+// resisting force is then the tangent times the displacements
+{
+	switch (theMaterial->getClassTag()) {
+	case ND_TAG_ElasticIsotropic:
+	case ND_TAG_ElasticIsotropicPlaneStrain2d:
+	case ND_TAG_ElasticIsotropicPlaneStress2d:
+	case ND_TAG_ElasticIsotropicThreeDimensional:
+	case ND_TAG_ElasticOrthotropic:
+	case ND_TAG_ElasticOrthotropicPlaneStrain2d:
+	case ND_TAG_ElasticOrthotropicPlaneStress2d:
+	case ND_TAG_ElasticOrthotropicThreeDimensional:
+		return b[0] == 0.0 && b[1] == 0.0;
+	default:
+		return false;
+	}
+}
+
 int
 SSPquad::sendSelf(int commitTag, Channel &theChannel)
 {
@@ -33,11 +33,14 @@
 #include <Domain.h>
 #include <Node.h>
 #include <Channel.h>
+#include <Message.h>
 #include <FEM_ObjectBroker.h>
 #include <Renderer.h>
 #include <Information.h>
 #include <ElementResponse.h>
 #include <TCP_Socket.h>
+#include <SharedMemoryChannel.h>
+#include <MultiplexedChannel.h>
 
 #include <math.h>
 #include <stdlib.h>
@@ -47,10 +50,12 @@
 // responsible for allocating the necessary space needed
 // by each object and storing the tags of the end nodes.
 Adapter::Adapter(int tag, ID nodes, ID *dof,
-    const Matrix &_kb, int ipport, int addRay, const Matrix *_mb)
+    const Matrix &_kb, int ipport, int addRay, const Matrix *_mb,
+    const char *shmname, int _mux)
     : Element(tag, ELE_TAG_Adapter),
     connectedExternalNodes(nodes), basicDOF(1), numExternalNodes(0),
-    numDOF(0), numBasicDOF(0), kb(_kb), ipPort(ipport), addRayleigh(addRay),
+    numDOF(0), numBasicDOF(0), kb(_kb), ipPort(ipport), shmName(0),
+    mux(_mux), addRayleigh(addRay),
     mb(0), tPast(0.0), theMatrix(1,1), theVector(1), theLoad(1), db(1), q(1),
     theChannel(0), rData(0), recvData(0), sData(0), sendData(0),
     ctrlDisp(0), ctrlVel(0), ctrlAccel(0), ctrlForce(0), ctrlTime(0),
@@ -87,6 +92,12 @@ Adapter::Adapter(int tag, ID nodes, ID *dof,
     if (_mb != 0)
         mb = new Matrix(*_mb);
     
+    // save the name of the shared memory channel
+    if (shmname != 0)  {
+        shmName = new char [strlen(shmname)+1];
+        strcpy(shmName, shmname);
+    }
+    
     // set the vector sizes and zero them
     basicDOF.resize(numBasicDOF);
     basicDOF.Zero();
@@ -102,7 +113,8 @@ Adapter::Adapter(int tag, ID nodes, ID *dof,
 Adapter::Adapter()
     : Element(0, ELE_TAG_Adapter),
     connectedExternalNodes(1), basicDOF(1), numExternalNodes(0),
-    numDOF(0), numBasicDOF(0), kb(1,1), ipPort(0), addRayleigh(0), mb(0),
+    numDOF(0), numBasicDOF(0), kb(1,1), ipPort(0), shmName(0),
+    mux(0), addRayleigh(0), mb(0),
     tPast(0.0), theMatrix(1,1), theVector(1), theLoad(1), db(1), q(1),
     theChannel(0), rData(0), recvData(0), sData(0), sendData(0),
     ctrlDisp(0), ctrlVel(0), ctrlAccel(0), ctrlForce(0), ctrlTime(0),
@@ -158,6 +170,8 @@ Adapter::~Adapter()
         delete [] rData;
     if (theChannel != 0)
         delete theChannel;
+    if (shmName != 0)
+        delete [] shmName;
 }
 
 
@@ -502,7 +516,7 @@ const Vector& Adapter::getResistingForceIncInertia()
 int Adapter::sendSelf(int commitTag, Channel &sChannel)
 {
     // send element parameters
-    static Vector data(9);
+    static Vector data(11);
     data(0) = this->getTag();
     data(1) = numExternalNodes;
     data(2) = ipPort;
@@ -512,6 +526,8 @@ int Adapter::sendSelf(int commitTag, Channel &sChannel)
     data(6) = betaK;
     data(7) = betaK0;
     data(8) = betaKc;
+    data(9) = (shmName==0) ? 0 : strlen(shmName);
+    data(10) = mux;
     sChannel.sendVector(0, commitTag, data);
     
     // send the end nodes and dofs
@@ -524,6 +540,12 @@ int Adapter::sendSelf(int commitTag, Channel &sChannel)
     if ((int)data(4))
         sChannel.sendMatrix(0, commitTag, *mb);
     
+    // send the name of the shared memory channel
+    if (shmName != 0)  {
+        Message theMessage(shmName, strlen(shmName));
+        sChannel.sendMsg(0, commitTag, theMessage);
+    }
+    
     return 0;
 }
 
@@ -538,9 +560,12 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
         delete [] theDOF;
     if (mb != 0)
         delete mb;
+    if (shmName != 0)
+        delete [] shmName;
+    shmName = 0;
     
     // receive element parameters
-    static Vector data(9);
+    static Vector data(11);
     rChannel.recvVector(0, commitTag, data);
     this->setTag((int)data(0));
     numExternalNodes = (int)data(1);
@@ -550,6 +575,7 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
     betaK = data(6);
     betaK0 = data(7);
     betaKc = data(8);
+    mux = (int)data(10);
     
     // initialize nodes and receive them
     connectedExternalNodes.resize(numExternalNodes);
@@ -589,6 +615,14 @@ int Adapter::recvSelf(int commitTag, Channel &rChannel,
         rChannel.recvMatrix(0, commitTag, *mb);
     }
     
+    // receive the name of the shared memory channel
+    if ((int)data(9) > 0)  {
+        shmName = new char [(int)data(9) + 1];
+        Message theMessage(shmName, (int)data(9));
+        rChannel.recvMsg(0, commitTag, theMessage);
+        shmName[(int)data(9)] = '\0';
+    }
+    
     // set the vector sizes and zero them
     basicDOF.resize(numBasicDOF);
     basicDOF.Zero();
@@ -867,7 +901,12 @@ int Adapter::getResponse(int responseID, Information &eleInformation)
 int Adapter::setupConnection()
 {
     // setup the connection
-    theChannel = new TCP_Socket(ipPort);
+    if (shmName != 0)
+        theChannel = new SharedMemoryChannel(shmName, true);
+    else if (mux > 0)
+        theChannel = new MultiplexedChannel(ipPort, mux);
+    else
+        theChannel = new TCP_Socket(ipPort);
     if (theChannel != 0) {
         opserr << "\nChannel successfully created: "
             << "Waiting for ECSimAdapter experimental control...\n";
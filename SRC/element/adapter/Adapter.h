@@ -64,7 +64,8 @@ public:
     // constructors
     Adapter(int tag, ID nodes, ID *dof,
         const Matrix &stif, int ipPort,
-        int addRayleigh = 0, const Matrix *mass = 0);
+        int addRayleigh = 0, const Matrix *mass = 0,
+        const char *shmName = 0, int mux = 0);
     Adapter();
     
     // destructor
@@ -124,6 +125,8 @@ private:
     
     Matrix kb;                  // stiffness matrix in basic system
     int ipPort;                 // ipPort
+    char *shmName;              // name of the shared memory channel, 0 for tcp/ip
+    int mux;                    // stream id on a shared tcp/ip connection, 0 for none
     int addRayleigh;            // flag to add Rayleigh damping
     Matrix *mb;                 // mass matrix in basic system
     double tPast;               // past time
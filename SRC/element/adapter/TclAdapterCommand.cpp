@@ -54,7 +54,8 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
     if ((argc-eleArgStart) < 8) {
         opserr << "WARNING insufficient arguments\n";
         printCommand(argc, argv);
-        opserr << "Want: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij ipPort <-doRayleigh> <-mass Mij>\n";
+        opserr << "Want: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij ipPort <-mux streamID> <-doRayleigh> <-mass Mij>\n";
+        opserr << "  or: element adapter eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -stif Kij -shm name <-doRayleigh> <-mass Mij>\n";
         return TCL_ERROR;
     }
     
@@ -66,6 +67,8 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
     int numNodes = 0, numDOFj = 0, numDOF = 0;
     int doRayleigh = 0;
     Matrix *mass = 0;
+    const char *shmName = 0;
+    int mux = 0;
     
     if (Tcl_GetInt(interp, argv[1+eleArgStart], &tag) != TCL_OK) {
         opserr << "WARNING invalid adapter eleTag" << endln;
@@ -161,17 +164,29 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
             argi++;
         }
     }
-    // get ip-port
-    if (Tcl_GetInt(interp, argv[argi], &ipPort) != TCL_OK) {
+    // get ip-port or the name of a shared memory channel
+    if (strcmp(argv[argi], "-shm") == 0 && argi+1 < argc)  {
+        argi++;
+        ipPort = 0;
+        shmName = argv[argi];
+    }
+    else if (Tcl_GetInt(interp, argv[argi], &ipPort) != TCL_OK) {
         opserr << "WARNING invalid ipPort\n";
         opserr << "adapter element: " << tag << endln;
         return TCL_ERROR;
     }
     argi++;
-    // get optional rayleigh flag
+    // get optional rayleigh flag and stream id
     for (int i = argi; i < argc; i++)  {
         if (strcmp(argv[i], "-doRayleigh") == 0)
             doRayleigh = 1;
+        else if (strcmp(argv[i], "-mux") == 0)  {
+            if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &mux) != TCL_OK || mux < 1)  {
+                opserr << "WARNING invalid streamID, want an integer > 0\n";
+                opserr << "adapter element: " << tag << endln;
+                return TCL_ERROR;
+            }
+        }
     }
     // get optional mass matrix
     for (int i = argi; i < argc; i++) {
@@ -198,9 +213,9 @@ int TclModelBuilder_addAdapter(ClientData clientData, Tcl_Interp *interp,  int a
     
     // now create the adapter and add it to the Domain
     if (mass == 0)
-        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh);
+        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh, 0, shmName, mux);
     else
-        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh, mass);
+        theElement = new Adapter(tag, nodes, dofs, kb, ipPort, doRayleigh, mass, shmName, mux);
     
     // cleanup dynamic memory
     if (dofs != 0)
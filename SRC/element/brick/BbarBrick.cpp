@@ -757,71 +757,28 @@ void   BbarBrick::formInertiaTerms( int tangFlag )
 }
 
 //*********************************************************************
-//form residual and tangent
-void  BbarBrick::formResidAndTangent( int tang_flag )
+//shape functions and volume elements of the gauss points, and the mean
+//shape functions, shared by the response and the sensitivities
+void  BbarBrick::formShapeFunctions( double Shape[4][8][8],
+				     double shpBar[4][8],
+				     double dvol[8] )
 {
-
-  //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31
-
   static const int ndm = 3 ;
 
-  static const int ndf = 3 ;
-
-  static const int nstress = 6 ;
-
   static const int numberNodes = 8 ;
 
-  static const int numberGauss = 8 ;
-
   static const int nShape = 4 ;
 
   int i, j, k, p, q ;
-  int jj, kk ;
 
-  int success ;
+  double volume ;
 
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix
-
-  static double dvol[numberGauss] ; //volume element
+  double xsj ;  // determinant jacaobian matrix
 
-  static double gaussPoint[ndm] ;
-
-  static Vector strain(nstress) ;  //strain
+  double gaussPoint[ndm] ;
 
   static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
 
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
-
-  static Vector residJ(ndf) ; //nodeJ residual
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
-
-  static Vector stress(nstress) ;  //stress
-
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-
-  //zero stiffness and residual
-  stiff.Zero( ) ;
-  resid.Zero( ) ;
-
   //compute basis vectors and local nodal coordinates
   computeBasis( ) ;
 
@@ -880,6 +837,69 @@ void  BbarBrick::formResidAndTangent( int tang_flag )
     for ( q = 0; q < numberNodes; q++ )
       shpBar[p][q] /= volume ;
   } // end for p
+}
+
+
+//*********************************************************************
+//form residual and tangent
+void  BbarBrick::formResidAndTangent( int tang_flag )
+{
+
+  //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31
+
+  static const int ndf = 3 ;
+
+  static const int nstress = 6 ;
+
+  static const int numberNodes = 8 ;
+
+  static const int numberGauss = 8 ;
+
+  static const int nShape = 4 ;
+
+  int i, j, k, p, q ;
+  int jj, kk ;
+
+  int success ;
+
+  static double dvol[numberGauss] ; //volume element
+
+  static Vector strain(nstress) ;  //strain
+
+  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+
+  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+
+  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+
+  static Vector residJ(ndf) ; //nodeJ residual
+
+  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness
+
+  static Vector stress(nstress) ;  //stress
+
+  static Matrix dd(nstress,nstress) ;  //material tangent
+
+
+  //---------B-matrices------------------------------------
+
+    static Matrix BJ(nstress,ndf) ;      // B matrix node J
+
+    static Matrix BJtran(ndf,nstress) ;
+
+    static Matrix BK(nstress,ndf) ;      // B matrix node k
+
+    static Matrix BJtranD(ndf,nstress) ;
+
+  //-------------------------------------------------------
+
+
+  //zero stiffness and residual
+  stiff.Zero( ) ;
+  resid.Zero( ) ;
+
+  //compute the shape functions of the gauss points
+  formShapeFunctions( Shape, shpBar, dvol ) ;
 
 
   //gauss loop
@@ -994,6 +1014,134 @@ void  BbarBrick::formResidAndTangent( int tang_flag )
 }
 
 
+// AddingSensitivity:BEGIN ///////////////////////////////////
+//*********************************************************************
+//residual sensitivity, from the conditional stress sensitivities of the
+//materials; the body forces do not depend on the material parameters
+const Vector&  BbarBrick::getResistingForceSensitivity( int gradNumber )
+{
+  static const int ndf = 3 ;
+
+  static const int numberNodes = 8 ;
+
+  static const int numberGauss = 8 ;
+
+  static const int nShape = 4 ;
+
+  int i, j, p, q ;
+  int jj ;
+
+  static double dvol[numberGauss] ; //volume element
+
+  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+
+  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+
+  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+
+  static Vector residJ(ndf) ; //nodeJ residual
+
+  static Vector stress(6) ;  //stress sensitivity
+
+  resid.Zero( ) ;
+
+  formShapeFunctions( Shape, shpBar, dvol ) ;
+
+  //gauss loop
+  for ( i = 0; i < numberGauss; i++ ) {
+
+    //extract shape functions from saved array
+    for ( p = 0; p < nShape; p++ ) {
+       for ( q = 0; q < numberNodes; q++ )
+	  shp[p][q]  = Shape[p][q][i] ;
+    } // end for p
+
+    stress = materialPointers[i]->getStressSensitivity( gradNumber, true ) ;
+
+    //multiply by volume element
+    stress  *= dvol[i] ;
+
+    jj = 0 ;
+    for ( j = 0; j < numberNodes; j++ ) {
+
+      const Matrix &BJ = computeBbar( j, shp, shpBar ) ;
+
+      //residJ = BJtran * stress ;
+      residJ.addMatrixTransposeVector(0.0,  BJ,stress,1.0);
+
+      for ( p = 0; p < ndf; p++ )
+        resid( jj + p ) += residJ(p)  ;
+
+      jj += ndf ;
+    } // end for j loop
+
+  } //end for i gauss loop
+
+  return resid ;
+}
+
+
+//*********************************************************************
+//commit the strain sensitivities of the materials
+int  BbarBrick::commitSensitivity( int gradNumber, int numGrads )
+{
+  static const int numberNodes = 8 ;
+
+  static const int numberGauss = 8 ;
+
+  static const int nShape = 4 ;
+
+  int i, j, p, q ;
+
+  int ret = 0 ;
+
+  static double dvol[numberGauss] ; //volume element
+
+  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
+
+  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
+
+  static double shpBar[nShape][numberNodes] ;  //mean value of shape functions
+
+  static Vector strain(6) ;  //strain sensitivity
+
+  static Vector ul(3) ;  //nodal displacement sensitivity
+
+  formShapeFunctions( Shape, shpBar, dvol ) ;
+
+  //gauss loop
+  for ( i = 0; i < numberGauss; i++ ) {
+
+    //extract shape functions from saved array
+    for ( p = 0; p < nShape; p++ ) {
+       for ( q = 0; q < numberNodes; q++ )
+	  shp[p][q]  = Shape[p][q][i] ;
+    } // end for p
+
+    strain.Zero( ) ;
+
+    // j-node loop to compute strain sensitivity
+    for ( j = 0; j < numberNodes; j++ )  {
+
+      const Matrix &BJ = computeBbar( j, shp, shpBar ) ;
+
+      for ( p = 0; p < 3; p++ )
+        ul(p) = nodePointers[j]->getDispSensitivity( p+1, gradNumber ) ;
+
+      //strain += (BJ*ul) ;
+      strain.addMatrixVector(1.0,  BJ,ul,1.0 ) ;
+
+    } // end for j
+
+    ret += materialPointers[i]->commitSensitivity( strain, gradNumber, numGrads ) ;
+
+  } //end for i gauss loop
+
+  return ret ;
+}
+// AddingSensitivity:END /////////////////////////////////////
+
+
 //************************************************************************
 //compute local coordinates and basis
 
@@ -114,6 +114,11 @@ class BbarBrick : public Element {
     int setParameter(const char **argv, int argc, Parameter &param);
     int updateParameter(int parameterID, Information &info);
 
+    // AddingSensitivity:BEGIN //////////////////////////////////////////
+    const Vector &getResistingForceSensitivity(int gradNumber);
+    int commitSensitivity(int gradNumber, int numGrads);
+    // AddingSensitivity:END ///////////////////////////////////////////
+
     //plotting 
     int displaySelf(Renderer &, int mode, float fact, const char **displayModes=0, int numModes=0);
 
@@ -155,6 +160,12 @@ class BbarBrick : public Element {
     //form residual and tangent					  
     void formResidAndTangent( int tang_flag ) ;
 
+    //shape functions and volume elements of the gauss points, and the
+    //mean shape functions
+    void formShapeFunctions( double Shape[4][8][8],
+			     double shpBar[4][8],
+			     double dvol[8] ) ;
+
     //compute coordinate system
     void computeBasis( ) ;
 
@@ -30,6 +30,7 @@
 #include <stdio.h> 
 #include <stdlib.h> 
 #include <math.h> 
+#include <string.h>
 
 #include <ID.h> 
 #include <Vector.h>
@@ -39,7 +40,9 @@
 #include <Domain.h>
 #include <ErrorHandler.h>
 #include <Brick.h>
-#include <shp3d.h>
+#include <hex8.h>
+#include <Workspace.h>
+#include <GeometryCache.h>
 #include <Renderer.h>
 #include <ElementResponse.h>
 #include <Parameter.h>
@@ -53,7 +56,7 @@ void* OPS_Brick()
 {
     if (OPS_GetNumRemainingInputArgs() < 10) {
 	opserr << "WARNING insufficient arguments\n";
-	opserr << "Want: element Brick eleTag? Node1? Node2? Node3? Node4? Node5? Node6? Node7? Node 8? matTag?\n";
+	opserr << "Want: element Brick eleTag? Node1? Node2? Node3? Node4? Node5? Node6? Node7? Node 8? matTag? <b1? b2? b3?> <-cacheGeometry>\n";
 	return 0;
     }
 
@@ -71,50 +74,44 @@ void* OPS_Brick()
 	opserr << "\nBrick element: " << idata[0] << endln;
     }
 
+    // optional body forces and -cacheGeometry
     double data[3] = {0,0,0};
-    num = OPS_GetNumRemainingInputArgs();
-    if (num > 3) {
-	num = 3;
-    }
-    if (num > 0) {
-	if (OPS_GetDoubleInput(&num,data) < 0) {
-	    opserr<<"WARNING: invalid double data\n";
+    int numData = 0;
+    bool cache = false;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	num = 1;
+	if (numData < 3) {
+	    if (OPS_GetDoubleInput(&num,&data[numData]) >= 0) {
+		numData++;
+		continue;
+	    }
+	    OPS_ResetCurrentInputArg(-1);
+	}
+	const char *opt = OPS_GetString();
+	if (strcmp(opt,"-cacheGeometry") == 0) {
+	    cache = true;
+	} else {
+	    opserr << "WARNING: invalid Brick option " << opt << endln;
 	    return 0;
-	}	
+	}
     }
 
     return new Brick(idata[0],idata[1],idata[2],idata[3],idata[4],idata[5],idata[6],idata[7],
-		     idata[8],*mat,data[0],data[1],data[2]);
+		     idata[8],*mat,data[0],data[1],data[2],cache);
 }
 
-//static data
-double  Brick::xl[3][8] ;
-
-Matrix  Brick::stiff(24,24) ;
-Vector  Brick::resid(24) ;
-Matrix  Brick::mass(24,24) ;
-
-    
-//quadrature data
-const double  Brick::root3 = sqrt(3.0) ;
-const double  Brick::one_over_root3 = 1.0 / root3 ;
-
-const double  Brick::sg[] = { -one_over_root3,  
-			       one_over_root3  } ;
-
-const double  Brick::wg[] = { 1.0, 1.0, 1.0, 1.0, 
-                              1.0, 1.0, 1.0, 1.0  } ;
-
-  
-static Matrix B(6,3) ;
+// keys identifying the Workspace objects of the bricks
+static char stiffKey ;
+static char residKey ;
+static char massKey ;
+static char resIncKey ;
 
 //null constructor
 Brick::Brick( ) 
 :Element( 0, ELE_TAG_Brick ),
- connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+ connectedExternalNodes(8), applyLoad(0), load(0), Ki(0),
+ cacheGeometry(false), geometry(0)
 {
-  B.Zero();
-
   for (int i=0; i<8; i++ ) {
     materialPointers[i] = 0;
     nodePointers[i] = 0;
@@ -138,11 +135,14 @@ Brick::Brick(int tag,
 	     int node7,
 	     int node8,
 	     NDMaterial &theMaterial,
-	     double b1, double b2, double b3)
+	     double b1, double b2, double b3,
+	     bool cache)
   :Element(tag, ELE_TAG_Brick),
-   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0)
+   connectedExternalNodes(8), applyLoad(0), load(0), Ki(0),
+   cacheGeometry(cache), geometry(0)
 {
-  B.Zero();
+  if (GeometryCache::isActive() == true)
+    cacheGeometry = true;
 
   connectedExternalNodes(0) = node1 ;
   connectedExternalNodes(1) = node2 ;
@@ -184,6 +184,9 @@ Brick::~Brick( )
 
   if (Ki != 0)
     delete Ki;
+
+  if (geometry != 0)
+    GeometryCache::deallocate(geometry, sizeof(Hex8Geometry));
   
 }
 
@@ -198,6 +201,12 @@ void  Brick::setDomain( Domain *theDomain )
   for ( i=0; i<8; i++ ) 
      nodePointers[i] = theDomain->getNode( connectedExternalNodes(i) ) ;
 
+  // the geometry is formed again from the nodes of the domain
+  if (geometry != 0) {
+    GeometryCache::deallocate( geometry, sizeof(Hex8Geometry) ) ;
+    geometry = 0 ;
+  }
+
   this->DomainComponent::setDomain(theDomain);
 
 }
@@ -358,7 +367,7 @@ const Matrix&  Brick::getTangentStiff( )
   //do tangent and residual here
   formResidAndTangent( tang_flag ) ;  
 
-  return stiff ;
+  return Workspace::getMatrix(&stiffKey, 24, 24) ;
 }    
 
 
@@ -366,138 +375,27 @@ const Matrix&  Brick::getTangentStiff( )
 //const Matrix&  Brick::getSecantStiff( ) 
 
 const Matrix&  Brick::getInitialStiff( ) 
-
 {
   if (Ki != 0)
     return *Ki;
 
-  //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
-  static const int ndm = 3 ;
-  static const int ndf = 3 ; 
-  static const int nstress = 6 ;
-  static const int numberNodes = 8 ;
   static const int numberGauss = 8 ;
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-  int jj, kk ;
-
-  
-  static double volume ;
-  static double xsj ;  // determinant jacaobian matrix 
-  static double dvol[numberGauss] ; //volume element
-  static double gaussPoint[ndm] ;
-  static Vector strain(nstress) ;  //strain
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-  static Matrix dd(nstress,nstress) ;  //material tangent
 
+  double K[576] ;  //stiffness, see hex8.h
 
-  //---------B-matrices------------------------------------
+  for ( int i = 0; i < 576; i++ )
+    K[i] = 0.0 ;
 
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-  
-  //zero stiffness and residual 
-  stiff.Zero( ) ;
-
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  Hex8Geometry theGeometry ;
+  const Hex8Geometry &geometry = this->getGeometry( theGeometry ) ;
 
   //gauss loop 
-  for ( i = 0; i < numberGauss; i++ ) {
-
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
+  for ( int i = 0; i < numberGauss; i++ ) 
+    hex8AddStiff( geometry.shp[i], materialPointers[i]->getInitialTangent( ),
+		  geometry.dvol[i], K ) ;
 
-
-    dd = materialPointers[i]->getInitialTangent( ) ;
-    dd *= dvol[i] ;
-    
-    jj = 0;
-    for ( j = 0; j < numberNodes; j++ ) {
-
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++) 
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-      //BJtranD = BJtran * dd ;
-      BJtranD.addMatrixProduct(0.0,  BJtran, dd, 1.0) ;
-      
-      kk = 0 ;
-      for ( k = 0; k < numberNodes; k++ ) {
-	
-	BK = computeB( k, shp ) ;
-	
-	
-	//stiffJK =  BJtranD * BK  ;
-	stiffJK.addMatrixProduct(0.0,  BJtranD, BK, 1.0) ;
-	
-	for ( p = 0; p < ndf; p++ )  {
-	  for ( q = 0; q < ndf; q++ )
-	    stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-	} //end for p
-
-	kk += ndf ;
-
-      } // end for k loop
-
-      jj += ndf ;
-
-    } // end for j loop
-  } //end for i gauss loop 
+  Matrix &stiff = Workspace::getMatrix(&stiffKey, 24, 24) ;
+  hex8SetStiff( K, stiff ) ;
 
   Ki = new Matrix(stiff);
 
@@ -512,7 +410,7 @@ const Matrix&  Brick::getMass( )
 
   formInertiaTerms( tangFlag ) ;
 
-  return mass ;
+  return Workspace::getMatrix(&massKey, 24, 24) ;
 } 
 
 
@@ -584,6 +482,7 @@ Brick::addInertiaLoadToUnbalance(const Vector &accel)
   formInertiaTerms( tangFlag ) ;
 
   // store computed RV fro nodes in resid vector
+  Vector &resid = Workspace::getVector(&residKey, 24) ;
   int count = 0;
   for (i=0; i<numberNodes; i++) {
     const Vector &Raccel = nodePointers[i]->getRV(accel);
@@ -596,7 +495,7 @@ Brick::addInertiaLoadToUnbalance(const Vector &accel)
     load = new Vector(numberNodes*ndf);
 
   // add -M * RV(accel) to the load vector
-  load->addMatrixVector(1.0, mass, resid, -1.0);
+  load->addMatrixVector(1.0, Workspace::getMatrix(&massKey, 24, 24), resid, -1.0);
   
   return 0;
 }
@@ -609,6 +508,8 @@ const Vector&  Brick::getResistingForce( )
 
   formResidAndTangent( tang_flag ) ;
 
+  Vector &resid = Workspace::getVector(&residKey, 24) ;
+
   if (load != 0)
     resid -= *load;
 
@@ -619,7 +520,7 @@ const Vector&  Brick::getResistingForce( )
 //get residual with inertia terms
 const Vector&  Brick::getResistingForceIncInertia( )
 {
-  static Vector res(24);
+  Vector &res = Workspace::getVector(&resIncKey, 24) ;
 
   int tang_flag = 0 ; //don't get the tangent
 
@@ -628,7 +529,7 @@ const Vector&  Brick::getResistingForceIncInertia( )
 
   formInertiaTerms( tang_flag ) ;
 
-  res = resid;
+  res = Workspace::getVector(&residKey, 24) ;
 
   // add the damping forces if rayleigh damping
   if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
@@ -647,8 +548,6 @@ const Vector&  Brick::getResistingForceIncInertia( )
 void   Brick::formInertiaTerms( int tangFlag ) 
 {
 
-  static const int ndm = 3 ;
-
   static const int ndf = 3 ; 
 
   static const int numberNodes = 8 ;
@@ -659,80 +558,40 @@ void   Brick::formInertiaTerms( int tangFlag )
 
   static const int massIndex = nShape - 1 ;
 
-  double xsj ;  // determinant jacaobian matrix 
-
-  double dvol[numberGauss] ; //volume element
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static double gaussPoint[ndm] ;
+  double momentum[ndf] ;
 
-  static Vector momentum(ndf) ;
-
-  int i, j, k, p, q ;
+  int i, j, k, p ;
   int jj, kk ;
 
   double temp, rho, massJK ;
 
+  Vector &resid = Workspace::getVector(&residKey, 24) ;
+  Matrix &mass = Workspace::getMatrix(&massKey, 24, 24) ;
 
   //zero mass 
   mass.Zero( ) ;
 
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	count++ ;
-
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions and volume elements of the gauss points
+  Hex8Geometry theGeometry ;
+  const Hex8Geometry &geometry = this->getGeometry( theGeometry ) ;
 
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
-
+    const double (*shp)[8] = geometry.shp[i] ;
+    double dvol = geometry.dvol[i] ;
 
     //node loop to compute acceleration
-    momentum.Zero( ) ;
-    for ( j = 0; j < numberNodes; j++ ) 
+    momentum[0] = 0.0 ;
+    momentum[1] = 0.0 ;
+    momentum[2] = 0.0 ;
+    for ( j = 0; j < numberNodes; j++ ) {
       //momentum += shp[massIndex][j] * ( nodePointers[j]->getTrialAccel()  ) ; 
-      momentum.addVector( 1.0,
-			  nodePointers[j]->getTrialAccel(),
-			  shp[massIndex][j] ) ;
+      const Vector &accel = nodePointers[j]->getTrialAccel() ;
+      for ( p = 0; p < ndf; p++ )
+	momentum[p] += accel(p) * shp[massIndex][j] ;
+    }
 
 
     //density
@@ -740,17 +599,18 @@ void   Brick::formInertiaTerms( int tangFlag )
 
 
     //multiply acceleration by density to form momentum
-    momentum *= rho ;
+    for ( p = 0; p < ndf; p++ )
+      momentum[p] *= rho ;
 
 
     //residual and tangent calculations node loops
     jj = 0 ;
     for ( j = 0; j < numberNodes; j++ ) {
 
-      temp = shp[massIndex][j] * dvol[i] ;
+      temp = shp[massIndex][j] * dvol ;
 
       for ( p = 0; p < ndf; p++ )
-        resid( jj+p ) += ( temp * momentum(p) )  ;
+        resid( jj+p ) += ( temp * momentum[p] )  ;
 
       
       if ( tangFlag == 1 ) {
@@ -788,159 +648,70 @@ Brick::update(void)
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
-  static const int ndf = 3 ; 
-
   static const int nstress = 6 ;
  
   static const int numberNodes = 8 ;
 
   static const int numberGauss = 8 ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
+  int i, j ;
   int success ;
-  
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static Vector strain(nstress) ;  //strain
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
 
-    static Matrix BJtran(ndf,nstress) ;
+  double strain[nstress] ;  //strain
+  Vector theStrain(strain, nstress) ;
 
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
-
-  //-------------------------------------------------------
-
-  
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
-
-	count++ ;
+  //nodal displacements
+  double ul[3][numberNodes] ;
+  for ( j = 0; j < numberNodes; j++ ) {
+    const Vector &disp = nodePointers[j]->getTrialDisp( ) ;
+    ul[0][j] = disp(0) ;
+    ul[1][j] = disp(1) ;
+    ul[2][j] = disp(2) ;
+  }
 
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  //shape functions and volume elements of the gauss points
+  Hex8Geometry theGeometry ;
+  const Hex8Geometry &geometry = this->getGeometry( theGeometry ) ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
-
+    const double (*shp)[8] = geometry.shp[i] ;
 
     //zero the strains
-    strain.Zero( ) ;
+    for ( j = 0; j < nstress; j++ )
+      strain[j] = 0.0 ;
+
+    // j-node loop to compute strain, strain += BJ*ul with
+    //
+    //               | N,1      0     0    | 
+    //   B       =   |   0     N,2    0    |
+    //               |   0      0     N,3  |   (6x3)
+    //               | N,2     N,1     0   |
+    //               |   0     N,3    N,2  |
+    //               | N,3      0     N,1  |
 
-    // j-node loop to compute strain 
     for ( j = 0; j < numberNodes; j++ )  {
 
-      /**************** fmk - unwinding for performance
-      //compute B matrix 
-      BJ = computeB( j, shp ) ;
-
-      //nodal displacements 
-      const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
-
-      //compute the strain
-      //strain += (BJ*ul) ; 
-      strain.addMatrixVector(1.0,  BJ,ul,1.0 ) ;
-      ***************************************************/
-
-
-      //               | N,1      0     0    | 
-      //   B       =   |   0     N,2    0    |
-      //               |   0      0     N,3  |   (6x3)
-      //               | N,2     N,1     0   |
-      //               |   0     N,3    N,2  |
-      //               | N,3      0     N,1  |
-
-      //      B(0,0) = shp[0][node] ;
-      //      B(1,1) = shp[1][node] ;
-      //      B(2,2) = shp[2][node] ;
-      //      B(3,0) = shp[1][node] ;
-      //      B(3,1) = shp[0][node] ;
-      //      B(4,1) = shp[2][node] ;
-      //      B(4,2) = shp[1][node] ;
-      //      B(5,0) = shp[2][node] ;
-      //      B(5,2) = shp[0][node] ;
-
-      double b00 = shp[0][j];
-      double b11 = shp[1][j];
-      double b22 = shp[2][j];
-      double b30 = shp[1][j];
-      double b31 = shp[0][j];
-      double b41 = shp[2][j];
-      double b42 = shp[1][j];
-      double b50 = shp[2][j];
-      double b52 = shp[0][j];
-
-      const Vector &ul = nodePointers[j]->getTrialDisp();
-
-      double ul0 = ul(0);
-      double ul1 = ul(1);
-      double ul2 = ul(2);
-
-      strain(0) += b00 * ul0;
-      strain(1) += b11 * ul1;
-      strain(2) += b22 * ul2;
-      strain(3) += b30 * ul0 + b31 * ul1;
-      strain(4) += b41 * ul1 + b42 * ul2;
-      strain(5) += b50 * ul0 + b52 * ul2;
+      double N1 = shp[0][j];
+      double N2 = shp[1][j];
+      double N3 = shp[2][j];
+
+      double ul0 = ul[0][j];
+      double ul1 = ul[1][j];
+      double ul2 = ul[2][j];
+
+      strain[0] += N1 * ul0;
+      strain[1] += N2 * ul1;
+      strain[2] += N3 * ul2;
+      strain[3] += N2 * ul0 + N1 * ul1;
+      strain[4] += N3 * ul1 + N2 * ul2;
+      strain[5] += N3 * ul0 + N1 * ul2;
 
     } // end for j
     
     //send the strain to the material 
-    success = materialPointers[i]->setTrialStrain( strain ) ;
+    success = materialPointers[i]->setTrialStrain( theStrain ) ;
 
   } //end for i gauss loop 
 
@@ -955,215 +726,43 @@ void  Brick::formResidAndTangent( int tang_flag )
 
   //strains ordered : eps11, eps22, eps33, 2*eps12, 2*eps23, 2*eps31 
 
-  static const int ndm = 3 ;
-
-  static const int ndf = 3 ; 
-
-  static const int nstress = 6 ;
- 
-  static const int numberNodes = 8 ;
-
   static const int numberGauss = 8 ;
 
-  static const int nShape = 4 ;
-
-  int i, j, k, p, q ;
-
-
-  static double volume ;
-
-  static double xsj ;  // determinant jacaobian matrix 
-
-  static double dvol[numberGauss] ; //volume element
-
-  static double gaussPoint[ndm] ;
-
-  static double shp[nShape][numberNodes] ;  //shape functions at a gauss point
-
-  static double Shape[nShape][numberNodes][numberGauss] ; //all the shape functions
-
-  static Vector residJ(ndf) ; //nodeJ residual 
-
-  static Matrix stiffJK(ndf,ndf) ; //nodeJK stiffness 
-
-  static Vector stress(nstress) ;  //stress
-
-  static Matrix dd(nstress,nstress) ;  //material tangent
-
-
-  //---------B-matrices------------------------------------
-
-    static Matrix BJ(nstress,ndf) ;      // B matrix node J
-
-    static Matrix BJtran(ndf,nstress) ;
-
-    static Matrix BK(nstress,ndf) ;      // B matrix node k
-
-    static Matrix BJtranD(ndf,nstress) ;
+  int i ;
 
-  //-------------------------------------------------------
+  double K[576] ;  //stiffness, see hex8.h
+  double R[24] ;   //residual, see hex8.h
 
-  
   //zero stiffness and residual 
-  stiff.Zero( ) ;
-  resid.Zero( ) ;
-
-  //compute basis vectors and local nodal coordinates
-  computeBasis( ) ;
-
-  //gauss loop to compute and save shape functions 
-
-  int count = 0 ;
-  volume = 0.0 ;
-
-  for ( i = 0; i < 2; i++ ) {
-    for ( j = 0; j < 2; j++ ) {
-      for ( k = 0; k < 2; k++ ) {
-
-        gaussPoint[0] = sg[i] ;        
-	gaussPoint[1] = sg[j] ;        
-	gaussPoint[2] = sg[k] ;
-
-	//get shape functions    
-	shp3d( gaussPoint, xsj, shp, xl ) ;
-
-	//save shape functions
-	for ( p = 0; p < nShape; p++ ) {
-	  for ( q = 0; q < numberNodes; q++ )
-	    Shape[p][q][count] = shp[p][q] ;
-	} // end for p
-
-
-	//volume element to also be saved
-	dvol[count] = wg[count] * xsj ;  
-
-	//volume += dvol[count] ;
+  for ( i = 0; i < 24; i++ )
+    R[i] = 0.0 ;
+  if ( tang_flag == 1 ) {
+    for ( i = 0; i < 576; i++ )
+      K[i] = 0.0 ;
+  }
 
-	count++ ;
+  //shape functions and volume elements of the gauss points
+  Hex8Geometry theGeometry ;
+  const Hex8Geometry &geometry = this->getGeometry( theGeometry ) ;
 
-      } //end for k
-    } //end for j
-  } // end for i 
-  
+  const double *bodyForce = (applyLoad == 0) ? b : appliedB ;
 
   //gauss loop 
   for ( i = 0; i < numberGauss; i++ ) {
 
-    //extract shape functions from saved array
-    for ( p = 0; p < nShape; p++ ) {
-       for ( q = 0; q < numberNodes; q++ )
-	  shp[p][q]  = Shape[p][q][i] ;
-    } // end for p
-
-
-    //compute the stress
-    stress = materialPointers[i]->getStress( ) ;
-
-
-    //multiply by volume element
-    stress  *= dvol[i] ;
-
-    if ( tang_flag == 1 ) {
-      dd = materialPointers[i]->getTangent( ) ;
-      dd *= dvol[i] ;
-    } //end if tang_flag
-
-
-    double stress0 = stress(0);
-    double stress1 = stress(1);
-    double stress2 = stress(2);
-    double stress3 = stress(3);
-    double stress4 = stress(4);
-    double stress5 = stress(5);
-
-    //residual and tangent calculations node loops
-
-    int jj = 0 ;
-    for ( j = 0; j < numberNodes; j++ ) {
-
-      /* ************** fmk - unwinding for performance 
-      ************************************************* */
-
-      //               | N,1      0     0    | 
-      //   B       =   |   0     N,2    0    |
-      //               |   0      0     N,3  |   (6x3)
-      //               | N,2     N,1     0   |
-      //               |   0     N,3    N,2  |
-      //               | N,3      0     N,1  |
-
-      //      B(0,0) = shp[0][node] ;
-      //      B(1,1) = shp[1][node] ;
-      //      B(2,2) = shp[2][node] ;
-      //      B(3,0) = shp[1][node] ;
-      //      B(3,1) = shp[0][node] ;
-      //      B(4,1) = shp[2][node] ;
-      //      B(4,2) = shp[1][node] ;
-      //      B(5,0) = shp[2][node] ;
-      //      B(5,2) = shp[0][node] ;
-
-      double b00 = shp[0][j];
-      double b11 = shp[1][j];
-      double b22 = shp[2][j];
-      double b30 = shp[1][j];
-      double b31 = shp[0][j];
-      double b41 = shp[2][j];
-      double b42 = shp[1][j];
-      double b50 = shp[2][j];
-      double b52 = shp[0][j];
-
-      residJ(0) = b00 * stress0 + b30 * stress3 + b50 * stress5;
-      residJ(1) = b11 * stress1 + b31 * stress3 + b41 * stress4;
-      residJ(2) = b22 * stress2 + b42 * stress4 + b52 * stress5;
-      
-      BJ = computeB( j, shp ) ;
-   
-      //transpose 
-      //BJtran = transpose( nstress, ndf, BJ ) ;
-      for (p=0; p<ndf; p++) {
-	for (q=0; q<nstress; q++) 
-	  BJtran(p,q) = BJ(q,p) ;
-      }//end for p
-
-
-      //residual 
-      for ( p = 0; p < ndf; p++ ) {
-        resid( jj + p ) += residJ(p)  ;
-	if (applyLoad == 0)
-	  resid( jj + p ) -= dvol[i]*b[p]*shp[3][j];
-	else
-	  resid( jj + p ) -= dvol[i]*appliedB[p]*shp[3][j];
-      }
-
-      if ( tang_flag == 1 ) {
-
-	//BJtranD = BJtran * dd ;
-	BJtranD.addMatrixProduct(0.0,  BJtran,dd,1.0) ;
-
-	int kk = 0 ;
-         for ( k = 0; k < numberNodes; k++ ) {
-
-            BK = computeB( k, shp ) ;
-  
- 
-            //stiffJK =  BJtranD * BK  ;
-	    stiffJK.addMatrixProduct(0.0,  BJtranD,BK,1.0) ;
-
-            for ( p = 0; p < ndf; p++ )  {
-               for ( q = 0; q < ndf; q++ )
-                  stiff( jj+p, kk+q ) += stiffJK( p, q ) ;
-            } //end for p
-
-            kk += ndf ;
-          } // end for k loop
-
-      } // end if tang_flag 
-
-      jj += ndf ;
-    } // end for j loop
+    hex8AddResid( geometry.shp[i], materialPointers[i]->getStress( ),
+		  geometry.dvol[i], bodyForce, R ) ;
 
+    if ( tang_flag == 1 ) 
+      hex8AddStiff( geometry.shp[i], materialPointers[i]->getTangent( ),
+		    geometry.dvol[i], K ) ;
 
   } //end for i gauss loop 
 
+  hex8SetResid( R, Workspace::getVector(&residKey, 24) ) ;
+
+  if ( tang_flag == 1 )
+    hex8SetStiff( K, Workspace::getMatrix(&stiffKey, 24, 24) ) ;
   
   return ;
 }
@@ -1172,7 +771,7 @@ void  Brick::formResidAndTangent( int tang_flag )
 //************************************************************************
 //compute local coordinates and basis
 
-void   Brick::computeBasis( ) 
+void   Brick::computeBasis( double xl[3][8] ) 
 {
 
   //nodal coordinates 
@@ -1190,41 +789,29 @@ void   Brick::computeBasis( )
 
 }
 
-//*************************************************************************
-//compute B
+//************************************************************************
+//shape functions and volume elements at the gauss points, those kept by
+//the element if the geometry is cached and otherwise formed in theGeometry
 
-const Matrix&   
-Brick::computeB( int node, const double shp[4][8] )
+const Hex8Geometry &
+Brick::getGeometry( Hex8Geometry &theGeometry )
 {
+  if (geometry != 0)
+    return *geometry ;
 
-//---B Matrix in standard {1,2,3} mechanics notation---------
-//
-//                -                   -
-//               | N,1      0     0    | 
-//   B       =   |   0     N,2    0    |
-//               |   0      0     N,3  |   (6x3)
-//               | N,2     N,1     0   |
-//               |   0     N,3    N,2  |
-//               | N,3      0     N,1  |
-//                -                   -       
-//
-//-------------------------------------------------------------------
-
-  B(0,0) = shp[0][node] ;
-  B(1,1) = shp[1][node] ;
-  B(2,2) = shp[2][node] ;
-
-  B(3,0) = shp[1][node] ;
-  B(3,1) = shp[0][node] ;
-
-  B(4,1) = shp[2][node] ;
-  B(4,2) = shp[1][node] ;
+  double xl[3][8] ;
+  computeBasis( xl ) ;
 
-  B(5,0) = shp[2][node] ;
-  B(5,2) = shp[0][node] ;
-
-  return B ;
+  if (cacheGeometry == true) {
+    geometry = (Hex8Geometry *)GeometryCache::allocate( sizeof(Hex8Geometry) ) ;
+    if (geometry != 0) {
+      hex8Geometry( xl, *geometry ) ;
+      return *geometry ;
+    }
+  }
 
+  hex8Geometry( xl, theGeometry ) ;
+  return theGeometry ;
 }
 
 //***********************************************************************
@@ -1263,13 +850,14 @@ int  Brick::sendSelf (int commitTag, Channel &theChannel)
   // Now quad sends the ids of its materials
   int matDbTag;
   
-  static ID idData(26);
+  static ID idData(27);
 
   idData(24) = this->getTag();
   if (alphaM != 0 || betaK != 0 || betaK0 != 0 || betaKc != 0) 
     idData(25) = 1;
   else
     idData(25) = 0;
+  idData(26) = (cacheGeometry == true) ? 1 : 0;
   
   int i;
   for (i = 0; i < 8; i++) {
@@ -1335,7 +923,7 @@ int  Brick::recvSelf (int commitTag,
   
   int dataTag = this->getDbTag();
 
-  static ID idData(26);
+  static ID idData(27);
   res += theChannel.recvID(dataTag, commitTag, idData);
   if (res < 0) {
     opserr << "WARNING Brick::recvSelf() - " << this->getTag() << " failed to receive ID\n";
@@ -1343,6 +931,7 @@ int  Brick::recvSelf (int commitTag,
   }
 
   this->setTag(idData(24));
+  cacheGeometry = (idData(26) == 1);
 
   static Vector dData(7);
   if (theChannel.recvVector(dataTag, commitTag, dData) < 0) {
@@ -1578,7 +1167,7 @@ Brick::setResponse(const char **argv, int argc, OPS_Stream &output)
       output.tag("ResponseType",outputData);
     }
 
-    theResponse = new ElementResponse(this, 1, resid);
+    theResponse = new ElementResponse(this, 1, Vector(24));
   
   }   else if (strcmp(argv[0],"material") == 0 || strcmp(argv[0],"integrPoint") == 0) {
 
@@ -41,6 +41,7 @@
 #include <Element.h>
 #include <Node.h>
 #include <NDMaterial.h>
+#include <hex8.h>
 
 
 class Brick : public Element {
@@ -61,7 +62,8 @@ class Brick : public Element {
 	  int node7,
 	  int node8,
 	  NDMaterial &theMaterial,
-	  double b1 = 0.0, double b2 = 0.0, double b3 = 0.0);
+	  double b1 = 0.0, double b2 = 0.0, double b3 = 0.0,
+	  bool cacheGeometry = false);
     
     //destructor 
     virtual ~Brick( ) ;
@@ -144,23 +146,11 @@ class Brick : public Element {
     Vector *load;
     Matrix *Ki;
 
-    //
-    // static attributes
-    //
-
-    static Matrix stiff ;
-    static Vector resid ;
-    static Matrix mass ;
-    static Matrix damping ;
-
-    //quadrature data
-    static const double root3 ;
-    static const double one_over_root3 ;    
-    static const double sg[2] ;
-    static const double wg[8] ;
-  
-    //local nodal coordinates, three coordinates for each of four nodes
-    static double xl[3][8] ; 
+    // the shape functions and volume elements at the gauss points are
+    // kept by the element with -cacheGeometry or the GeometryCache on,
+    // so that they are not formed again in each call
+    bool cacheGeometry;
+    Hex8Geometry *geometry;
 
     //
     // private methods
@@ -173,10 +163,10 @@ class Brick : public Element {
     void formResidAndTangent( int tang_flag ) ;
 
     //compute coordinate system
-    void computeBasis( ) ;
+    void computeBasis( double xl[3][8] ) ;
 
-    //compute B matrix
-    const Matrix& computeB( int node, const double shp[4][8] ) ;
+    //shape functions and volume elements at the gauss points
+    const Hex8Geometry &getGeometry( Hex8Geometry &theGeometry ) ;
   
     //Matrix transpose
     Matrix transpose( int dim1, int dim2, const Matrix &M ) ;
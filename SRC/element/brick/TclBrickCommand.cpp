@@ -58,7 +58,7 @@ TclModelBuilder_addBrick(ClientData clientData, Tcl_Interp *interp,  int argc,
   if ((argc-eleArgStart) < 11) {
     opserr << "WARNING insufficient arguments\n";
     printCommand(argc, argv);
-    opserr << "Want: element Brick eleTag? Node1? Node2? Node3? Node4? Node5? Node6? Node7? Node 8? matTag?\n";
+    opserr << "Want: element Brick eleTag? Node1? Node2? Node3? Node4? Node5? Node6? Node7? Node 8? matTag? <b1? b2? b3?> <-cacheGeometry>\n";
     return TCL_ERROR;
   }    
 
@@ -129,6 +129,18 @@ TclModelBuilder_addBrick(ClientData clientData, Tcl_Interp *interp,  int argc,
     return TCL_ERROR;
   }
   
+  // the geometry of a stdBrick may be kept by the element
+  bool cacheGeometry = false;
+  if ((argc-eleArgStart) > 11 && strcmp(argv[argc-1],"-cacheGeometry") == 0) {
+    if (strcmp(argv[1],"stdBrick") != 0) {
+      opserr << "WARNING -cacheGeometry is only an option of stdBrick\n";
+      opserr << "Brick element: " << BrickId << endln;
+      return TCL_ERROR;
+    }
+    cacheGeometry = true;
+    argc--;
+  }
+
   double b1=0.0;
   double b2=0.0; 
   double b3=0.0;
@@ -161,7 +173,7 @@ TclModelBuilder_addBrick(ClientData clientData, Tcl_Interp *interp,  int argc,
   if (strcmp(argv[1],"stdBrick") == 0) {
     theBrick = new Brick(BrickId,Node1,Node2,Node3,Node4,
 			 Node5, Node6, Node7, Node8, *theMaterial,
-			 b1, b2, b3);
+			 b1, b2, b3, cacheGeometry);
   }
   else if (strcmp(argv[1],"bbarBrickWithSensitivity") == 0) {
     theBrick = new BbarBrickWithSensitivity(BrickId,Node1,Node2,Node3,Node4,
@@ -46,6 +46,14 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <GeometryCache.h>
+#include <ThreadPool.h>
+#include <classTags.h>
+#include <string.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 void* OPS_Twenty_Node_Brick()
 {
@@ -110,11 +118,17 @@ double Twenty_Node_Brick::shlu[4][20][27];
 double Twenty_Node_Brick::wu[27];
 double Twenty_Node_Brick::dvolu[27];
 
+// doubles in the geometry cache, shgu followed by dvolu
+static const int geometrySize = 4*20*27 + 27;
+
 //null constructor
 Twenty_Node_Brick::Twenty_Node_Brick( ) :
 Element( 0, ELE_TAG_Twenty_Node_Brick ),
-connectedExternalNodes(20), applyLoad(0), load(0), Ki(0)//, kc(0), rho(0)
+connectedExternalNodes(20), applyLoad(0), load(0), Ki(0),
+cacheGeometry(GeometryCache::isActive()), geometry(0)//, kc(0), rho(0)
 {
+	for (int i=0; i<4; i++ )
+		gaussTime[i] = -1.0;
 	for (int i=0; i<20; i++ ) {
 		nodePointers[i] = 0;
 	}
@@ -151,8 +165,11 @@ Twenty_Node_Brick::Twenty_Node_Brick(int tag,
 											   NDMaterial &theMaterial,
 											   double b1, double b2, double b3) :
 Element( tag, ELE_TAG_Twenty_Node_Brick ),
-connectedExternalNodes(20), applyLoad(0), load(0), Ki(0)//, kc(bulk), rho(rhof)
+connectedExternalNodes(20), applyLoad(0), load(0), Ki(0),
+cacheGeometry(GeometryCache::isActive()), geometry(0)//, kc(bulk), rho(rhof)
 {
+	for (int i=0; i<4; i++ )
+		gaussTime[i] = -1.0;
 	connectedExternalNodes(0) = node1 ;
 	connectedExternalNodes(1) = node2 ;
 	connectedExternalNodes(2) = node3 ;
@@ -226,6 +243,9 @@ Twenty_Node_Brick::~Twenty_Node_Brick( )
 
 	if (Ki != 0)
 		delete Ki;
+
+	if (geometry != 0)
+		GeometryCache::deallocate(geometry, geometrySize*sizeof(double));
 }
 
 
@@ -253,6 +273,16 @@ void  Twenty_Node_Brick::setDomain( Domain *theDomain )
 			return;
 		}
 	}
+
+	// the cached geometry is formed again from the new nodes
+	if (geometry != 0) {
+		GeometryCache::deallocate(geometry, geometrySize*sizeof(double));
+		geometry = 0;
+	}
+
+	for ( i=0; i<4; i++ )
+		gaussTime[i] = -1.0;
+
 	this->DomainComponent::setDomain(theDomain);
 }
 
@@ -415,11 +445,8 @@ void  Twenty_Node_Brick::Print( OPS_Stream &s, int flag )
 int
 Twenty_Node_Brick::update()
 {
-	int i, j, k, k1;
+	int i, j;
 	static double u[3][20];
-	static double xsj;
-	static Matrix B(6, 3);
-	double volume = 0.;
 
 	for (i = 0; i < nenu; i++) {
 	     const Vector &disp = nodePointers[i]->getTrialDisp();
@@ -428,76 +455,89 @@ Twenty_Node_Brick::update()
 	     u[2][i] = disp(2);
     }
 
-	static Vector eps(6);
-
-	int ret = 0;
+	// strains at the integration points
+	double strains[27*6];
 
-	//compute basis vectors and local nodal coordinates
-	computeBasis( ) ;
-
-	for( i = 0; i < nintu; i++ ) {
-		// compute Jacobian and global shape functions
-		Jacobian3d(i, xsj, 0);
-		//volume element to also be saved
-		dvolu[i] = wu[i] * xsj ;
-		volume += dvolu[i];
-	} // end for i
-    //printf("volume = %f\n", volume);
+	//global shape functions and volume elements at the gauss points
+	formGeometry( ) ;
 
 	// Loop over the integration points
 	for (i = 0; i < nintu; i++) {
 
 		// Interpolate strains
 		//eps = B*u;
-		//eps.addMatrixVector(0.0, B, u, 1.0);
-		eps.Zero();
+		double *eps = &strains[6*i];
+		for (int k = 0; k < 6; k++)
+			eps[k] = 0.;
 		for ( j = 0; j < nenu; j++) {
+			double N1 = shgu[0][j][i];
+			double N2 = shgu[1][j][i];
+			double N3 = shgu[2][j][i];
+			eps[0] += N1*u[0][j];
+			eps[1] += N2*u[1][j];
+			eps[2] += N3*u[2][j];
+			eps[3] += N2*u[0][j] + N1*u[1][j];
+			eps[4] += N3*u[1][j] + N2*u[2][j];
+			eps[5] += N3*u[0][j] + N1*u[2][j];
+		}
+	}
 
+	// Set the material strains
+	return this->evaluateGauss(0, strains);
+}
 
-			B(0,0) = shgu[0][j][i];
-			B(0,1) = 0.;
-			B(0,2) = 0.;
-			B(1,0) = 0.;
-			B(1,1) = shgu[1][j][i];
-			B(1,2) = 0.;
-			B(2,0) = 0.;
-			B(2,1) = 0.;
-			B(2,2) = shgu[2][j][i];
-			B(3,0) = shgu[1][j][i];
-			B(3,1) = shgu[0][j][i];
-			B(3,2) = 0.;
-			B(4,0) = 0.;
-			B(4,1) = shgu[2][j][i];
-			B(4,2) = shgu[1][j][i];
-			B(5,0) = shgu[2][j][i];
-			B(5,1) = 0.;
-			B(5,2) = shgu[0][j][i];
-
-			//BJ = computeB( j, shp ) ;
-
-			//nodal displacements
-			const Vector &ul = nodePointers[j]->getTrialDisp( ) ;
-			Vector ul3(3);
-			ul3(0) = ul(0);
-			ul3(1) = ul(1);
-			ul3(2) = ul(2);
-			//compute the strain
-			//strain += (BJ*ul) ;
-			eps.addMatrixVector(1.0,B,ul3,1.0 ) ;
-
-			/* for( k = 0; k < 6; k++) {
-			for( k1 = 0; k1 < 3; k1++) {
-			eps[k] += BJ(k, k1)*u[k1][j];
-			}
-		}	*/
 
+// the materials at the integration points: what is 0 to set the trial
+// strains in data, 1 to get the stresses, 2 the tangents and 3 the initial
+// tangents into data. Only PressureDependMultiYield02 keeps no shared work
+// storage, for it the points are evaluated on the threads once the last
+// serial evaluation took longer than the element threshold of ThreadPool
+int
+Twenty_Node_Brick::evaluateGauss(int what, double *data)
+{
+	int size = (what < 2) ? 6 : 36;
+	double threshold = ThreadPool::getElementThreshold();
+
+	bool parallel = false;
+#ifdef _OPENMP
+	int numT = ThreadPool::getNumThreads();
+	if (numT > 1 && threshold >= 0.0 && gaussTime[what] > threshold &&
+	    !omp_in_parallel() &&
+	    materialPointers[0]->getClassTag() == ND_TAG_PressureDependMultiYield02)
+		parallel = true;
+#endif
+
+	double start = 0.0;
+	if (!parallel && threshold >= 0.0)
+		start = ThreadPool::getTime();
 
+	int ret = 0;
+	const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numT) reduction(+:ret) if(parallel)
+#endif
+	for (int i = 0; i < nintu; i++) {
+		theGlobals.set();
+		double *datai = &data[size*i];
+		if (what == 0) {
+			Vector eps(datai, 6);
+			ret += materialPointers[i]->setTrialStrain(eps);
+		} else if (what == 1) {
+			const Vector &sigma = materialPointers[i]->getStress();
+			for (int k = 0; k < 6; k++)
+				datai[k] = sigma(k);
+		} else {
+			Matrix D(datai, 6, 6);
+			if (what == 2)
+				D = materialPointers[i]->getTangent();
+			else
+				D = materialPointers[i]->getInitialTangent();
 		}
-
-		// Set the material strain
-		ret += materialPointers[i]->setTrialStrain(eps);
 	}
 
+	if (!parallel && threshold >= 0.0)
+		gaussTime[what] = ThreadPool::getTime() - start;
+
 	return ret;
 }
 
@@ -552,9 +592,7 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 
 
-	static double xsj ;  // determinant jacaobian matrix
 
-	double volume = 0.;
 
 	//-------------------------------------------------------
 
@@ -564,8 +602,6 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 	static Matrix BTDB(nenu*3,nenu*3);
 
-	static Matrix D(6, 6);
-
 	B.Zero();
 
 	BTDB.Zero();
@@ -578,25 +614,9 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 
 
-	//compute basis vectors and local nodal coordinates
+	//global shape functions and volume elements at the gauss points
 
-	computeBasis( ) ;
-
-
-
-	for( i = 0; i < nintu; i++ ) {
-
-		// compute Jacobian and global shape functions
-
-		Jacobian3d(i, xsj, 0);
-
-		//volume element to also be saved
-
-		dvolu[i] = wu[i] * xsj ;
-
-		volume += dvolu[i];
-
-	} // end for i
+	formGeometry( ) ;
 
     //printf("volume = %f\n", volume);
 
@@ -618,23 +638,23 @@ const Matrix&  Twenty_Node_Brick::getStiff( int flag )
 
 
 
-	// Loop over the integration points
+	// the material tangents at the integration points
 
-	for (i = 0; i < nintu; i++) {
+	double tangents[27*36];
 
+	this->evaluateGauss(flag == 0 ? 3 : 2, tangents);
 
 
-		// Get the material tangent
 
-		if( flag == 0 )
+	// Loop over the integration points
 
-			D = materialPointers[i]->getInitialTangent();
+	for (i = 0; i < nintu; i++) {
 
-		else
 
-			D = materialPointers[i]->getTangent();
 
-		//const Matrix &D = materialPointers[i]->getTangent();
+		// the material tangent
+
+		Matrix D(&tangents[36*i], 6, 6);
 
 
 
@@ -981,11 +1001,9 @@ const Vector&  Twenty_Node_Brick::getResistingForce( )
 
 	int i, j, jk, k, k1;
 
-	double xsj;
 
 	static Matrix B(6, 3);
 
-	double volume = 0.;
 
 
 
@@ -995,27 +1013,19 @@ const Vector&  Twenty_Node_Brick::getResistingForce( )
 
 
 
-	//compute basis vectors and local nodal coordinates
-
-	computeBasis( ) ;
+	//global shape functions and volume elements at the gauss points
 
-	//gauss loop to compute and save shape functions
+	formGeometry( ) ;
 
-	for( i = 0; i < nintu; i++ ) {
+	//printf("volume = %f\n", volume);
 
-		// compute Jacobian and global shape functions
 
-		Jacobian3d(i, xsj, 0);
 
-		//volume element to also be saved
+	// the material stresses at the integration points
 
-		dvolu[i] = wu[i] * xsj ;
+	double stresses[27*6];
 
-		volume += dvolu[i];
-
-	} // end for i
-
-	//printf("volume = %f\n", volume);
+	this->evaluateGauss(1, stresses);
 
 
 
@@ -1027,7 +1037,7 @@ const Vector&  Twenty_Node_Brick::getResistingForce( )
 
 		// Get material stress response
 
-		const Vector &sigma = materialPointers[i]->getStress();
+		Vector sigma(&stresses[6*i], 6);
 
 
 
@@ -1282,7 +1292,6 @@ void   Twenty_Node_Brick::formInertiaTerms( int tangFlag )
 
 {
 
-	static double xsj ;  // determinant jacaobian matrix
 
 	int i, j, k, ik, m, jk;
 
@@ -1296,23 +1305,9 @@ void   Twenty_Node_Brick::formInertiaTerms( int tangFlag )
 
 
 
-	//compute basis vectors and local nodal coordinates
+	//global shape functions and volume elements at the gauss points
 
-	computeBasis( ) ;
-
-	//gauss loop to compute and save shape functions
-
-	for( i = 0; i < nintu; i++ ) {
-
-		// compute Jacobian and global shape functions
-
-		Jacobian3d(i, xsj, 0);
-
-		//volume element to also be saved
-
-		dvolu[i] = wu[i] * xsj ;
-
-	} // end for i
+	formGeometry( ) ;
 
 
 
@@ -1409,7 +1404,39 @@ void   Twenty_Node_Brick::computeBasis( )
 }
 
 
+//**********************************************************************
+// the global shape functions and volume elements at the gauss points in
+// shgu and dvolu, copied from the cache of the element if it keeps the
+// geometry
 
+void Twenty_Node_Brick::formGeometry( )
+{
+	if (geometry != 0) {
+		memcpy(shgu, geometry, 4*20*27*sizeof(double));
+		memcpy(dvolu, geometry + 4*20*27, 27*sizeof(double));
+		return;
+	}
+
+	double xsj ;  // determinant jacaobian matrix
+
+	//compute basis vectors and local nodal coordinates
+	computeBasis( ) ;
+
+	for( int i = 0; i < nintu; i++ ) {
+		// compute Jacobian and global shape functions
+		Jacobian3d(i, xsj, 0);
+		//volume element to also be saved
+		dvolu[i] = wu[i] * xsj ;
+	} // end for i
+
+	if (cacheGeometry == true) {
+		geometry = (double *)GeometryCache::allocate(geometrySize*sizeof(double));
+		if (geometry != 0) {
+			memcpy(geometry, shgu, 4*20*27*sizeof(double));
+			memcpy(geometry + 4*20*27, dvolu, 27*sizeof(double));
+		}
+	}
+}
 
 
 //**********************************************************************
@@ -172,14 +172,27 @@ private :
     //compute coordinate system
     void computeBasis( ) ;
 
+    //global shape functions and volume elements at the gauss points
+    void formGeometry( ) ;
+
     Vector *load;
     Matrix *Ki;
 
+    // shgu and dvolu kept with the GeometryCache on
+    bool cacheGeometry;
+    double *geometry;
+
 	// compute local shape functions
 	void compuLocalShapeFunction();
 	void Jacobian3d(int gaussPoint, double& xsj, int mode);
 	const Matrix&  getStiff( int flag );
 
+	// evaluates the materials at the integration points, on the threads
+	// when expensive enough; gaussTime holds the time of the last serial
+	// evaluation of each kind, < 0 if not timed
+	int evaluateGauss(int what, double *data);
+	double gaussTime[4];
+
 
 } ;
 
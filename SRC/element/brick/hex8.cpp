@@ -0,0 +1,159 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/brick/hex8.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the kernels of the eight node
+// hexahedral elements.
+
+// What: "@(#) hex8.cpp, revA"
+
+#include <math.h>
+
+#include <hex8.h>
+#include <shp3d.h>
+#include <Matrix.h>
+#include <Vector.h>
+
+void
+hex8Geometry(const double xl[3][8], Hex8Geometry &theGeometry)
+{
+  static const double one_over_root3 = 1.0 / sqrt(3.0);
+  static const double sg[2] = {-one_over_root3, one_over_root3};
+  static const double wg = 1.0;
+
+  double gaussPoint[3];
+  double xsj;
+
+  int count = 0;
+  for (int i = 0; i < 2; i++) {
+    for (int j = 0; j < 2; j++) {
+      for (int k = 0; k < 2; k++) {
+	gaussPoint[0] = sg[i];
+	gaussPoint[1] = sg[j];
+	gaussPoint[2] = sg[k];
+
+	shp3d(gaussPoint, xsj, theGeometry.shp[count], xl);
+	theGeometry.dvol[count] = wg * xsj;
+	count++;
+      }
+    }
+  }
+}
+
+//               | N,1      0     0    |
+//   B       =   |   0     N,2    0    |
+//               |   0      0     N,3  |   (6x3)
+//               | N,2     N,1     0   |
+//               |   0     N,3    N,2  |
+//               | N,3      0     N,1  |
+
+void
+hex8AddStiff(const double shp[4][8], const Matrix &dd, double dvol, double *K)
+{
+  double D[6][6];
+  for (int q = 0; q < 6; q++)
+    for (int r = 0; r < 6; r++)
+      D[q][r] = dd(q,r) * dvol;
+
+  const double *N1 = shp[0];
+  const double *N2 = shp[1];
+  const double *N3 = shp[2];
+
+  // T[p][r][j] = (BJ^T D)(p,r) of node j
+  double T[3][6][8];
+  for (int r = 0; r < 6; r++) {
+    double D0 = D[0][r], D1 = D[1][r], D2 = D[2][r];
+    double D3 = D[3][r], D4 = D[4][r], D5 = D[5][r];
+    for (int j = 0; j < 8; j++) {
+      T[0][r][j] = N1[j]*D0 + N2[j]*D3 + N3[j]*D5;
+      T[1][r][j] = N2[j]*D1 + N1[j]*D3 + N3[j]*D4;
+      T[2][r][j] = N3[j]*D2 + N2[j]*D4 + N1[j]*D5;
+    }
+  }
+
+  // K[k][s][p][j] += (BJ^T D BK)(p,s)
+  for (int k = 0; k < 8; k++) {
+    double M1 = N1[k], M2 = N2[k], M3 = N3[k];
+    for (int p = 0; p < 3; p++) {
+      const double (*Tp)[8] = T[p];
+      double *K0 = K + 72*k + 8*p;
+      double *K1 = K0 + 24;
+      double *K2 = K0 + 48;
+      for (int j = 0; j < 8; j++) {
+	K0[j] += Tp[0][j]*M1 + Tp[3][j]*M2 + Tp[5][j]*M3;
+	K1[j] += Tp[1][j]*M2 + Tp[3][j]*M1 + Tp[4][j]*M3;
+	K2[j] += Tp[2][j]*M3 + Tp[4][j]*M2 + Tp[5][j]*M1;
+      }
+    }
+  }
+}
+
+void
+hex8AddResid(const double shp[4][8], const Vector &stress, double dvol,
+	     const double b[3], double *R)
+{
+  double s0 = stress(0) * dvol;
+  double s1 = stress(1) * dvol;
+  double s2 = stress(2) * dvol;
+  double s3 = stress(3) * dvol;
+  double s4 = stress(4) * dvol;
+  double s5 = stress(5) * dvol;
+
+  double b0 = dvol * b[0];
+  double b1 = dvol * b[1];
+  double b2 = dvol * b[2];
+
+  const double *N1 = shp[0];
+  const double *N2 = shp[1];
+  const double *N3 = shp[2];
+  const double *N = shp[3];
+
+  for (int j = 0; j < 8; j++) {
+    R[j]    += N1[j]*s0 + N2[j]*s3 + N3[j]*s5;
+    R[j]    -= b0*N[j];
+    R[8+j]  += N2[j]*s1 + N1[j]*s3 + N3[j]*s4;
+    R[8+j]  -= b1*N[j];
+    R[16+j] += N3[j]*s2 + N2[j]*s4 + N1[j]*s5;
+    R[16+j] -= b2*N[j];
+  }
+}
+
+void
+hex8SetStiff(const double *K, Matrix &stiff)
+{
+  for (int k = 0; k < 8; k++)
+    for (int s = 0; s < 3; s++)
+      for (int p = 0; p < 3; p++)
+	for (int j = 0; j < 8; j++)
+	  stiff(3*j+p, 3*k+s) = K[72*k + 24*s + 8*p + j];
+}
+
+void
+hex8SetResid(const double *R, Vector &resid)
+{
+  for (int p = 0; p < 3; p++)
+    for (int j = 0; j < 8; j++)
+      resid(3*j+p) = R[8*p + j];
+}
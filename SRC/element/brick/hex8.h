@@ -0,0 +1,68 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/brick/hex8.h,v $
+
+#ifndef hex8_h
+#define hex8_h
+
+// Created: 10/26
+//
+// Description: This file contains the kernels of the eight node
+// hexahedral elements integrated at the 2x2x2 Gauss points.
+// hex8Geometry() forms the shape functions and their derivatives with
+// shp3d() at each Gauss point, together with its volume element, which an
+// element may keep if its nodes do not move.
+//
+// The stiffness and the residual of the Gauss points are accumulated in
+// arrays with the node j as the innermost index, K[k][s][p][j] for the
+// entry (3j+p, 3k+s) and R[p][j] for the entry 3j+p, so that the loops
+// over the eight nodes are vectorized by the compiler. The products are
+// formed in the same order as those of B^T D B with the Matrix class, so
+// the results are the same to the last bit. hex8SetStiff() and
+// hex8SetResid() copy the arrays into the element Matrix and Vector.
+
+// What: "@(#) hex8.h, revA"
+
+class Matrix;
+class Vector;
+
+struct Hex8Geometry
+{
+  double shp[8][4][8];   // shp3d() shape functions of each Gauss point
+  double dvol[8];        // weight times jacobian of each Gauss point
+};
+
+// forms the geometry from the nodal coordinates xl[3][8]
+void hex8Geometry(const double xl[3][8], Hex8Geometry &theGeometry);
+
+// adds B^T (dd*dvol) B of a Gauss point to K[8*3*3*8]
+void hex8AddStiff(const double shp[4][8], const Matrix &dd, double dvol, double *K);
+
+// adds B^T (stress*dvol) - N (b*dvol) of a Gauss point to R[3*8]
+void hex8AddResid(const double shp[4][8], const Vector &stress, double dvol,
+		  const double b[3], double *R);
+
+void hex8SetStiff(const double *K, Matrix &stiff);
+void hex8SetResid(const double *R, Vector &resid);
+
+#endif
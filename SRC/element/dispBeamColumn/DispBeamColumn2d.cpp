@@ -442,8 +442,7 @@ DispBeamColumn2d::update(void)
   double oneOverL = 1.0/L;
 
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
+  const double *xi = beamInt->getSectionTable(numSections, L);
   
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -489,10 +488,8 @@ DispBeamColumn2d::getBasicStiff(Matrix &kb, int initial)
   double L = crdTransf->getInitialLength();
   double oneOverL = 1.0/L;
   
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -566,10 +563,8 @@ DispBeamColumn2d::getTangentStiff()
   
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -625,10 +620,8 @@ DispBeamColumn2d::getInitialBasicStiff()
   
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -866,10 +859,8 @@ DispBeamColumn2d::getResistingForce()
   
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);  
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
   // Zero for integration
   q.Zero();
@@ -1127,6 +1118,9 @@ DispBeamColumn2d::recvSelf(int commitTag, Channel &theChannel,
 
   beamInt->setDbTag(beamIntDbTag);
 
+  // the section table is formed again from the received data
+  beamInt->clearSectionTable();
+
   // invoke recvSelf on the beamInt object
   if (beamInt->recvSelf(commitTag, theChannel, theBroker) < 0)  
   {
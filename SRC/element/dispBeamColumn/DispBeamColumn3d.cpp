@@ -363,8 +363,7 @@ DispBeamColumn3d::update(void)
   double oneOverL = 1.0/L;
   
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
+  const double *xi = beamInt->getSectionTable(numSections, L);
 
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -422,10 +421,8 @@ DispBeamColumn3d::getTangentStiff()
 
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -553,10 +550,8 @@ DispBeamColumn3d::getInitialBasicStiff()
 
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
   
   // Loop over the integration points
   for (int i = 0; i < numSections; i++) {
@@ -846,10 +841,8 @@ DispBeamColumn3d::getResistingForce()
 
   //const Matrix &pts = quadRule.getIntegrPointCoords(numSections);
   //const Vector &wts = quadRule.getIntegrPointWeights(numSections);
-  double xi[maxNumSections];
-  beamInt->getSectionLocations(numSections, L, xi);
-  double wt[maxNumSections];
-  beamInt->getSectionWeights(numSections, L, wt);
+  const double *xi = beamInt->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
   // Zero for integration
   q.Zero();
@@ -1118,6 +1111,9 @@ DispBeamColumn3d::recvSelf(int commitTag, Channel &theChannel,
 
   beamInt->setDbTag(beamIntDbTag);
 
+  // the section table is formed again from the received data
+  beamInt->clearSectionTable();
+
   // invoke recvSelf on the beamInt object
   if (beamInt->recvSelf(commitTag, theChannel, theBroker) < 0)  
   {
@@ -344,9 +344,6 @@ DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial)
     int order = theSections[i]->getOrder();
     const ID &code = theSections[i]->getType();
 
-    Matrix ka(workArea, order, 3);
-    ka.Zero();
-
     double xi6 = 6.0*xi[i];
     double zeta = xi[i];
 
@@ -378,97 +375,63 @@ DispBeamColumnNL2d::getBasicStiff(Matrix &kb, int initial)
       }
     }
 
-    Matrix B(order,3);
-    Matrix C(order,3);
-    Matrix C1(1,3);
+    // B and C of the section in workArea, row-major, zero in the rows of
+    // the responses other than P and MZ
+    double *B = workArea;
+    double *C = workArea + 3*order;
+    bool hasP = false;
+    for (j = 0; j < 6*order; j++)
+      workArea[j] = 0.0;
     for (j = 0; j < order; j++) {
       switch(code(j)) {
       case SECTION_RESPONSE_P:
-	B(j,0) = 1.0;
-	C(j,1) = c1;
-	C(j,2) = c2;
-	C1(0,1) = c1;
-	C1(0,2) = c2;
+	B[3*j] = 1.0;
+	C[3*j+1] = c1;
+	C[3*j+2] = c2;
+	hasP = true;
 	break;
       case SECTION_RESPONSE_MZ:
-	B(j,1) = xi6-4.0;
-	B(j,2) = xi6-2.0;
+	B[3*j+1] = xi6-4.0;
+	B[3*j+2] = xi6-2.0;
 	break;
       default:
 	break;
       }
     }
 
-    // B'*ks*B
-    kb.addMatrixTripleProduct(1.0, B, ks, wti);
-    
-    Matrix kC(order,3);
-
-    // B'*ks*C*theta
-    kC.addMatrixProduct(0.0, ks, C, 1.0);
-    kb.addMatrixTransposeProduct(1.0, B, kC, theta*wt[i]);
-
-    Matrix ks1(1,order);
-    Matrix ksB(1,3);
-
+    // B'*ks*B*wti + B'*ks*C*theta*wt
+    double wB = wti;
+    double wC = theta*wt[i];
     for (j = 0; j < order; j++) {
-      if (code(j) == SECTION_RESPONSE_P) {
-	for (int jj = 0; jj < order; jj++)
-	  ks1(0,jj) = ks(j,jj);
-
-	ksB.addMatrixProduct(0.0, ks1, B, 1.0);
-
-	kb.addMatrixTransposeProduct(1.0, C1, ksB, theta*wt[i]);
-
-	ksB.addMatrixProduct(0.0, ks1, C, 1.0);
-
-	kb.addMatrixTransposeProduct(1.0, C1, ksB, theta*theta*wt[i]*L);
-      }
-    }
-
-    continue;
-    
-    for (j = 0; j < order; j++) {
-      switch(code(j)) {
-      case SECTION_RESPONSE_P:
-	for (k = 0; k < order; k++)
-	  ka(k,0) += ks(k,j)*wti;
-	break;
-      case SECTION_RESPONSE_MZ:
-	for (k = 0; k < order; k++) {
-	  tmp = ks(k,j)*wti;
-	  ka(k,1) += (xi6-4.0)*tmp;
-	  ka(k,2) += (xi6-2.0)*tmp;
+      for (k = 0; k < order; k++) {
+	double ksjk = ks(j,k);
+	if (ksjk == 0.0)
+	  continue;
+	for (int a = 0; a < 3; a++) {
+	  double tmpa = ksjk*B[3*j+a];
+	  if (tmpa == 0.0)
+	    continue;
+	  for (int b = 0; b < 3; b++)
+	    kb(a,b) += tmpa*(wB*B[3*k+b] + wC*C[3*k+b]);
 	}
-	for (int jj = 0; jj < order; jj++) {
-	  switch(code(jj)) {
-	  case SECTION_RESPONSE_P:
-	    tmp = ks(k,jj)*wt[i]*theta;
-	    ka(k,1) += tmp*c1;
-	    ka(k,2) += tmp*c2;
-	    break;
-	  }
-	}
-	break;
-      default:
-	break;
       }
     }
-    for (j = 0; j < order; j++) {
-      switch (code(j)) {
-      case SECTION_RESPONSE_P:
-	for (k = 0; k < 3; k++)
-	  kb(0,k) += ka(j,k);
-	break;
-      case SECTION_RESPONSE_MZ:
-	for (k = 0; k < 3; k++) {
-	  tmp = ka(j,k);
-	  kb(1,k) += (xi6-4.0)*tmp;
-	  kb(2,k) += (xi6-2.0)*tmp;
+
+    // C1'*ks(P,:)*(B*theta*wt + C*theta*theta*wt*L), C1 = [0 c1 c2]
+    if (hasP == true) {
+      double c[3] = {0.0, c1, c2};
+      wB = theta*wt[i];
+      wC = theta*theta*wt[i]*L;
+      for (j = 0; j < order; j++) {
+	if (code(j) != SECTION_RESPONSE_P)
+	  continue;
+	for (int b = 0; b < 3; b++) {
+	  double ksB = 0.0;
+	  for (k = 0; k < order; k++)
+	    ksB += ks(j,k)*(wB*B[3*k+b] + wC*C[3*k+b]);
+	  for (int a = 1; a < 3; a++)
+	    kb(a,b) += c[a]*ksB;
 	}
-	break;
-      default:
-	break;
       }
     }
   }
@@ -479,14 +442,12 @@ DispBeamColumnNL2d::getTangentStiff()
 {
   static Matrix kb(3,3);
 
+  // getBasicStiff() has updated the transformation
   this->getBasicStiff(kb);
 
   // Zero for integral
   q.Zero();
   
-  // Update the transformation
-  crdTransf->update();
-  
   // Get basic deformations
   const Vector &v = crdTransf->getBasicTrialDisp();
 
@@ -199,7 +199,8 @@ int OPS_ElasticBeam2d(Domain& theDomain, const ID& elenodes, ID& eletags)
 ElasticBeam2d::ElasticBeam2d()
   :Element(0,ELE_TAG_ElasticBeam2d), 
   A(0.0), E(0.0), I(0.0), alpha(0.0), d(0.0), rho(0.0), cMass(0),
-  Q(6), q(3), connectedExternalNodes(2), theCoordTransf(0)
+  Q(6), q(3), connectedExternalNodes(2), theCoordTransf(0),
+  parameterUpdated(false), Kg(0)
 {
   // does nothing
   q0[0] = 0.0;
@@ -221,7 +222,8 @@ ElasticBeam2d::ElasticBeam2d(int tag, double a, double e, double i,
   :Element(tag,ELE_TAG_ElasticBeam2d), 
   A(a), E(e), I(i), alpha(Alpha), d(depth), rho(r), cMass(cm),
   Q(6), q(3),
-  connectedExternalNodes(2), theCoordTransf(0)
+  connectedExternalNodes(2), theCoordTransf(0),
+  parameterUpdated(false), Kg(0)
 {
   connectedExternalNodes(0) = Nd1;
   connectedExternalNodes(1) = Nd2;
@@ -248,6 +250,9 @@ ElasticBeam2d::ElasticBeam2d(int tag, double a, double e, double i,
 
 ElasticBeam2d::~ElasticBeam2d()
 {
+    if (Kg != 0)
+	delete Kg;
+
     if (theCoordTransf)
 	delete theCoordTransf;
 }
@@ -279,6 +284,11 @@ ElasticBeam2d::getNumDOF(void)
 void
 ElasticBeam2d::setDomain(Domain *theDomain)
 {
+  if (Kg != 0) {
+    delete Kg;
+    Kg = 0;
+  }
+
   if (theDomain == 0) {
     opserr << "ElasticBeam2d::setDomain -- Domain is null\n";
     exit(-1);
@@ -360,6 +370,11 @@ ElasticBeam2d::update(void)
 const Matrix &
 ElasticBeam2d::getTangentStiff(void)
 {
+  // the basic forces only enter the geometric stiffness, which a
+  // linear transformation does not have
+  if (this->isLinear())
+    return this->getInitialStiff();
+
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -388,6 +403,15 @@ ElasticBeam2d::getTangentStiff(void)
 const Matrix &
 ElasticBeam2d::getInitialStiff(void)
 {
+  // the global stiffness of a linear element is formed once
+  if (this->isLinear()) {
+    if (Kg != 0)
+      return *Kg;
+  } else if (Kg != 0) {
+    delete Kg;
+    Kg = 0;
+  }
+
   double L = theCoordTransf->getInitialLength();
 
   double EoverL   = E/L;
@@ -399,7 +423,25 @@ ElasticBeam2d::getInitialStiff(void)
   kb(1,1) = kb(2,2) = EIoverL4;
   kb(2,1) = kb(1,2) = EIoverL2;
   
-  return theCoordTransf->getInitialGlobalStiffMatrix(kb);
+  const Matrix &K = theCoordTransf->getInitialGlobalStiffMatrix(kb);
+
+  if (this->isLinear()) {
+    Kg = new Matrix(K);
+    return *Kg;
+  }
+
+  return K;
+}
+
+// with a linear transformation the stiffness does not depend on the
+// displacements, so once formed it can be reused until a parameter changes
+bool
+ElasticBeam2d::isLinear(void)
+{
+  if (theCoordTransf == 0 || parameterUpdated == true)
+    return false;
+
+  return theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf2d;
 }
 
 const Matrix &
@@ -711,6 +753,11 @@ ElasticBeam2d::sendSelf(int cTag, Channel &theChannel)
 int
 ElasticBeam2d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+  if (Kg != 0) {
+    delete Kg;
+    Kg = 0;
+  }
+
     int res = 0;
 	
     static Vector data(16);
@@ -1040,6 +1087,10 @@ ElasticBeam2d::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticBeam2d::updateParameter (int parameterID, Information &info)
 {
+	// the stiffness the FE_Element may have kept is no longer valid
+	if (parameterID > 0)
+		parameterUpdated = true;
+
 	switch (parameterID) {
 	case -1:
 		return -1;
@@ -70,6 +70,7 @@ class ElasticBeam2d : public Element
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
+    bool isLinear(void);
 
     void zeroLoad(void);	
     int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -110,6 +111,8 @@ class ElasticBeam2d : public Element
     ID  connectedExternalNodes;    
 
     CrdTransf *theCoordTransf;
+    bool parameterUpdated;  // properties changed since the element was formed
+    Matrix *Kg;             // global stiffness kept while the element is linear
 };
 
 #endif
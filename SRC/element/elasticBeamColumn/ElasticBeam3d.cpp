@@ -132,7 +132,8 @@ void* OPS_ElasticBeam3d(void)
 ElasticBeam3d::ElasticBeam3d()
   :Element(0,ELE_TAG_ElasticBeam3d), 
   A(0.0), E(0.0), G(0.0), Jx(0.0), Iy(0.0), Iz(0.0), rho(0.0), cMass(0),
-  Q(12), q(6), connectedExternalNodes(2), theCoordTransf(0)
+  Q(12), q(6), connectedExternalNodes(2), theCoordTransf(0),
+  parameterUpdated(false), Kg(0)
 {
   // does nothing
   q0[0] = 0.0;
@@ -157,7 +158,8 @@ ElasticBeam3d::ElasticBeam3d(int tag, double a, double e, double g,
 			     CrdTransf &coordTransf, double r, int cm, int sectTag)
   :Element(tag,ELE_TAG_ElasticBeam3d), 
   A(a), E(e), G(g), Jx(jx), Iy(iy), Iz(iz), rho(r), cMass(cm), sectionTag(sectTag),
-  Q(12), q(6), connectedExternalNodes(2), theCoordTransf(0)
+  Q(12), q(6), connectedExternalNodes(2), theCoordTransf(0),
+  parameterUpdated(false), Kg(0)
 {
   connectedExternalNodes(0) = Nd1;
   connectedExternalNodes(1) = Nd2;
@@ -189,7 +191,8 @@ ElasticBeam3d::ElasticBeam3d(int tag, double a, double e, double g,
 ElasticBeam3d::ElasticBeam3d(int tag, int Nd1, int Nd2, SectionForceDeformation *section,  
 			     CrdTransf &coordTransf, double r, int cm)
   :Element(tag,ELE_TAG_ElasticBeam3d), 
-  Q(12), q(6), connectedExternalNodes(2), theCoordTransf(0)
+  Q(12), q(6), connectedExternalNodes(2), theCoordTransf(0),
+  parameterUpdated(false), Kg(0)
 {
   if (section != 0) {
     sectionTag = section->getTag();
@@ -256,6 +259,9 @@ ElasticBeam3d::ElasticBeam3d(int tag, int Nd1, int Nd2, SectionForceDeformation
 
 ElasticBeam3d::~ElasticBeam3d()
 {
+  if (Kg != 0)
+    delete Kg;
+
   if (theCoordTransf)
     delete theCoordTransf;
 }
@@ -287,6 +293,11 @@ ElasticBeam3d::getNumDOF(void)
 void
 ElasticBeam3d::setDomain(Domain *theDomain)
 {
+  if (Kg != 0) {
+    delete Kg;
+    Kg = 0;
+  }
+
   if (theDomain == 0) {
     opserr << "ElasticBeam3d::setDomain -- Domain is null\n";
     exit(-1);
@@ -369,6 +380,11 @@ ElasticBeam3d::update(void)
 const Matrix &
 ElasticBeam3d::getTangentStiff(void)
 {
+  // the basic forces only enter the geometric stiffness, which a
+  // linear transformation does not have
+  if (this->isLinear())
+    return this->getInitialStiff();
+
   const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -408,6 +424,15 @@ ElasticBeam3d::getTangentStiff(void)
 const Matrix &
 ElasticBeam3d::getInitialStiff(void)
 {
+  // the global stiffness of a linear element is formed once
+  if (this->isLinear()) {
+    if (Kg != 0)
+      return *Kg;
+  } else if (Kg != 0) {
+    delete Kg;
+    Kg = 0;
+  }
+
   //  const Vector &v = theCoordTransf->getBasicTrialDisp();
   
   double L = theCoordTransf->getInitialLength();
@@ -427,7 +452,25 @@ ElasticBeam3d::getInitialStiff(void)
   kb(4,3) = kb(3,4) = EIyoverL2;
   kb(5,5) = GJoverL;
   
-  return theCoordTransf->getInitialGlobalStiffMatrix(kb);
+  const Matrix &K = theCoordTransf->getInitialGlobalStiffMatrix(kb);
+
+  if (this->isLinear()) {
+    Kg = new Matrix(K);
+    return *Kg;
+  }
+
+  return K;
+}
+
+// with a linear transformation the stiffness does not depend on the
+// displacements, so once formed it can be reused until a parameter changes
+bool
+ElasticBeam3d::isLinear(void)
+{
+  if (theCoordTransf == 0 || parameterUpdated == true)
+    return false;
+
+  return theCoordTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf3d;
 }
 
 const Matrix &
@@ -764,6 +807,11 @@ ElasticBeam3d::sendSelf(int cTag, Channel &theChannel)
 int
 ElasticBeam3d::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+  if (Kg != 0) {
+    delete Kg;
+    Kg = 0;
+  }
+
   int res = 0;
   static Vector data(17);
 
@@ -1172,6 +1220,10 @@ ElasticBeam3d::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticBeam3d::updateParameter (int parameterID, Information &info)
 {
+	// the stiffness the FE_Element may have kept is no longer valid
+	if (parameterID > 0)
+		parameterUpdated = true;
+
 	switch (parameterID) {
 	case -1:
 		return -1;
@@ -76,6 +76,7 @@ class ElasticBeam3d : public Element
     const Matrix &getTangentStiff(void);
     const Matrix &getInitialStiff(void);
     const Matrix &getMass(void);    
+    bool isLinear(void);
 
     void zeroLoad(void);	
     int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -117,6 +118,8 @@ class ElasticBeam3d : public Element
     ID  connectedExternalNodes;    
 
     CrdTransf *theCoordTransf;
+    bool parameterUpdated;  // properties changed since the element was formed
+    Matrix *Kg;             // global stiffness kept while the element is linear
 };
 
 #endif
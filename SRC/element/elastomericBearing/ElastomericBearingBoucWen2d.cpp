@@ -466,16 +466,17 @@ int ElastomericBearingBoucWen2d::update()
         
         // calculate hysteretic evolution parameter z using Newton-Raphson
         int iter = 0;
-        double zAbs, tmp1, f, Df, delta_z;
+        double zAbs, zPow, tmp1, f, Df, delta_z;
         do  {
             zAbs = fabs(z);
             if (zAbs == 0.0)    // check because of negative exponents
                 zAbs = DBL_EPSILON;
             tmp1 = gamma + beta*sgn(z*delta_ub);
+            zPow = pow(zAbs,eta-1.0);
             
             // function and derivative
-            f  = z - zC - delta_ub/uy*(A - pow(zAbs,eta)*tmp1);
-            Df = 1.0 + delta_ub/uy*eta*pow(zAbs,eta-1.0)*sgn(z)*tmp1;
+            f  = z - zC - delta_ub/uy*(A - zAbs*zPow*tmp1);
+            Df = 1.0 + delta_ub/uy*eta*zPow*sgn(z)*tmp1;
             
             // issue warning if derivative Df is zero
             if (fabs(Df) <= DBL_EPSILON)  {
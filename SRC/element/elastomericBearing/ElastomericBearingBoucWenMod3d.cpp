@@ -472,7 +472,9 @@ int ElastomericBearingBoucWenMod3d::update()
     
     // 2) calculate shear forces and stiffnesses in basic y- and z-direction
     // get displacement increments (trial - commited)
-    Vector delta_ub = ub - ubC;
+    static Vector delta_ub(6);
+    delta_ub = ub;
+    delta_ub -= ubC;
 	// calculate dependency parameters
 	double alphaT = b1+b2*T+b3*pow(T,2)+b4*pow(T,3);
 	double Ac=(PI/4)*(D2*D2-D1*D1);
@@ -491,32 +493,40 @@ int ElastomericBearingBoucWenMod3d::update()
         // calculate hysteretic evolution parameter z using Newton-Raphson
         int iter = 0;
         double zNrm, tmp1, tmp2, tmp3, tmp4;
-        Vector f(2), delta_z(2);
-        Matrix Df(2,2);
+        // the 2x2 system is solved in closed form on the stack and
+        // pow() is evaluated once per iteration
+        double du1 = delta_ub(1), du2 = delta_ub(2);
+        double z0, z1, zNrmPow, f0, f1, Df00, Df01, Df10, Df11, detDf;
+        double delta_z0, delta_z1, delta_zNrm;
         do  {
-            zNrm = z.Norm();
+            z0 = z(0);
+            z1 = z(1);
+            zNrm = sqrt(z0*z0 + z1*z1);
             if (zNrm == 0.0)  // check because of negative exponents
                 zNrm = DBL_EPSILON;
-            tmp1 = z(0)*delta_ub(1) + z(1)*delta_ub(2);
+            tmp1 = z0*du1 + z1*du2;
             tmp2 = gamma + beta*sgn(tmp1);
-            tmp3 = pow(zNrm,eta-2.0)*tmp1*tmp2;
-            tmp4 = pow(zNrm,eta-4.0)*tmp2;
+            zNrmPow = pow(zNrm,eta-2.0);
+            tmp3 = zNrmPow*tmp1*tmp2;
+            tmp4 = zNrmPow/(zNrm*zNrm)*tmp2;
             
             // function and derivative
-            f(0) = z(0) - zC(0) - 1.0/uy*(A*delta_ub(1) - z(0)*tmp3);
-            f(1) = z(1) - zC(1) - 1.0/uy*(A*delta_ub(2) - z(1)*tmp3);
+            f0 = z0 - zC(0) - 1.0/uy*(A*du1 - z0*tmp3);
+            f1 = z1 - zC(1) - 1.0/uy*(A*du2 - z1*tmp3);
             
-            Df(0,0) = 1.0 + tmp4/uy*(pow(z(1),3)*delta_ub(2) + 2.0*pow(z(1),2)*z(0)*delta_ub(1)
-                + z(1)*pow(z(0),2)*delta_ub(2)*(eta-1.0) + pow(z(0),3)*delta_ub(1)*eta);
-            Df(1,0) = z(1)*tmp4/uy*(pow(z(1),2)*delta_ub(1) + z(0)*z(1)*delta_ub(2)*(eta-2.0)
-                + pow(z(0),2)*delta_ub(1)*(eta-1.0));
-            Df(0,1) = z(0)*tmp4/uy*(pow(z(0),2)*delta_ub(2) + z(0)*z(1)*delta_ub(1)*(eta-2.0)
-                + pow(z(1),2)*delta_ub(2)*(eta-1.0));
-            Df(1,1) = 1.0 + tmp4/uy*(pow(z(0),3)*delta_ub(1) + 2.0*pow(z(0),2)*z(1)*delta_ub(2)
-                + z(0)*pow(z(1),2)*delta_ub(1)*(eta-1.0) + pow(z(1),3)*delta_ub(2)*eta);
+            Df00 = 1.0 + tmp4/uy*(z1*z1*z1*du2 + 2.0*z1*z1*z0*du1
+                + z1*z0*z0*du2*(eta-1.0) + z0*z0*z0*du1*eta);
+            Df10 = z1*tmp4/uy*(z1*z1*du1 + z0*z1*du2*(eta-2.0)
+                + z0*z0*du1*(eta-1.0));
+            Df01 = z0*tmp4/uy*(z0*z0*du2 + z0*z1*du1*(eta-2.0)
+                + z1*z1*du2*(eta-1.0));
+            Df11 = 1.0 + tmp4/uy*(z0*z0*z0*du1 + 2.0*z0*z0*z1*du2
+                + z0*z1*z1*du1*(eta-1.0) + z1*z1*z1*du2*eta);
+            detDf = Df00*Df11 - Df01*Df10;
             
             // issue warning if diagonal of derivative Df is zero
-            if ((fabs(Df(0,0)) <= DBL_EPSILON) || (fabs(Df(1,1)) <= DBL_EPSILON))  {
+            if ((fabs(Df00) <= DBL_EPSILON) || (fabs(Df11) <= DBL_EPSILON) ||
+                (detDf == 0.0))  {
                 opserr << "WARNING: ElastomericBearingBoucWenMod3d::update() - "
                     << "zero Jacobian in Newton-Raphson scheme for hysteretic "
                     << "evolution parameter z.\n";
@@ -524,28 +534,32 @@ int ElastomericBearingBoucWenMod3d::update()
             }
             
             // advance one step
-            delta_z = f/Df;
-            z -= delta_z;
+            delta_z0 = (Df11*f0 - Df01*f1)/detDf;
+            delta_z1 = (Df00*f1 - Df10*f0)/detDf;
+            z(0) = z0 - delta_z0;
+            z(1) = z1 - delta_z1;
+            delta_zNrm = sqrt(delta_z0*delta_z0 + delta_z1*delta_z1);
             iter++;
-        } while ((delta_z.Norm() >= tol) && (iter < maxIter));
+        } while ((delta_zNrm >= tol) && (iter < maxIter));
         
         // issue warning if Newton-Raphson scheme did not converge
         if (iter >= maxIter)   {
             opserr << "WARNING: ElastomericBearingBoucWenMod3d::update() - "
                 << "did not find the hysteretic evolution parameters z after "
-                << iter << " iterations and norm: " << delta_z.Norm() << endln;
+                << iter << " iterations and norm: " << delta_zNrm << endln;
             return -2;
         }
         
         // get derivative of hysteretic evolution parameter
-        delta_z = z-zC;
+        delta_z0 = z(0) - zC(0);
+        delta_z1 = z(1) - zC(1);
         if (fabs(delta_ub(1)) > 0.0)  {
-            dzdu(0,0) = delta_z(0)/delta_ub(1);
-            dzdu(1,0) = delta_z(1)/delta_ub(1);
+            dzdu(0,0) = delta_z0/delta_ub(1);
+            dzdu(1,0) = delta_z1/delta_ub(1);
         }
         if (fabs(delta_ub(2)) > 0.0)  {
-            dzdu(0,1) = delta_z(0)/delta_ub(2);
-            dzdu(1,1) = delta_z(1)/delta_ub(2);
+            dzdu(0,1) = delta_z0/delta_ub(2);
+            dzdu(1,1) = delta_z1/delta_ub(2);
         }
 		
 		
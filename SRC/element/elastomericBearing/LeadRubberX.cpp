@@ -630,7 +630,9 @@ int LeadRubberX::update()
     
     //2) calculate shear forces and stiffnesses in basic y- and z-direction
     // get displacement increments (trial-commited)
-    Vector delta_ub = ub - ubC;
+    static Vector delta_ub(6);
+    delta_ub = ub;
+    delta_ub -= ubC;
     if (sqrt(pow(delta_ub(1),2)+pow(delta_ub(2),2)) > 0.0)  {
         
         // get yield displacement
@@ -643,8 +645,7 @@ int LeadRubberX::update()
         double beta = 0.1; // note here beta and gamma are as per Nagarajaih(1991), which is opposite to Park et al.(1986)
         double gamma = 0.9;
         double zNrm, tmp1, tmp2, tmp3;
-        Vector f(2), delta_z(2);
-        Matrix Df(2,2);
+        double f[2], delta_z[2], Df[2][2];
         do  {
             zNrm = z.Norm();
             if (zNrm == 0.0)  // check because of negative exponents
@@ -654,16 +655,16 @@ int LeadRubberX::update()
             tmp3 = z(0)*delta_ub(1)*tmp1 + z(1)*delta_ub(2)*tmp2;
             
             // function and derivative
-            f(0) = z(0) - zC(0) - 1.0/uy*(delta_ub(1) - z(0)*tmp3);
-            f(1) = z(1) - zC(1) - 1.0/uy*(delta_ub(2) - z(1)*tmp3);
+            f[0] = z(0) - zC(0) - 1.0/uy*(delta_ub(1) - z(0)*tmp3);
+            f[1] = z(1) - zC(1) - 1.0/uy*(delta_ub(2) - z(1)*tmp3);
             
-            Df(0,0) = 1.0 + (1.0/uy)*(2*z(0)*delta_ub(1)*tmp1+z(1)*delta_ub(2)*tmp2);
-            Df(1,0) = (tmp1/uy)*z(1)*delta_ub(1);
-            Df(0,1) = (tmp2/uy)*z(0)*delta_ub(2);
-            Df(1,1) = 1.0 + (1.0/uy)*(z(0)*delta_ub(1)*tmp1+2*z(1)*delta_ub(2)*tmp2);
+            Df[0][0] = 1.0 + (1.0/uy)*(2*z(0)*delta_ub(1)*tmp1+z(1)*delta_ub(2)*tmp2);
+            Df[1][0] = (tmp1/uy)*z(1)*delta_ub(1);
+            Df[0][1] = (tmp2/uy)*z(0)*delta_ub(2);
+            Df[1][1] = 1.0 + (1.0/uy)*(z(0)*delta_ub(1)*tmp1+2*z(1)*delta_ub(2)*tmp2);
             
             // issue warning if diagonal of derivative Df is zero
-            if ((fabs(Df(0,0)) <= DBL_EPSILON) || (fabs(Df(1,1)) <= DBL_EPSILON))  {
+            if ((fabs(Df[0][0]) <= DBL_EPSILON) || (fabs(Df[1][1]) <= DBL_EPSILON))  {
                 opserr << "WARNING: LeadRubberX::update() - "
                     << "zero Jacobian in Newton-Raphson scheme for hysteretic "
                     << "evolution parameter z.\n";
@@ -672,17 +673,18 @@ int LeadRubberX::update()
             
             // advance one step
             // delta_z = f/Df; either write a function to do matrix devision or use the solution below
-            delta_z(0) = (f(0)*Df(1,1)-f(1)*Df(0,1))/(Df(0,0)*Df(1,1)-Df(0,1)*Df(1,0));
-            delta_z(1) = (f(0)*Df(1,0)-f(1)*Df(0,0))/(Df(0,1)*Df(1,0)-Df(0,0)*Df(1,1));
-            z -= delta_z;
+            delta_z[0] = (f[0]*Df[1][1]-f[1]*Df[0][1])/(Df[0][0]*Df[1][1]-Df[0][1]*Df[1][0]);
+            delta_z[1] = (f[0]*Df[1][0]-f[1]*Df[0][0])/(Df[0][1]*Df[1][0]-Df[0][0]*Df[1][1]);
+            z(0) -= delta_z[0];
+            z(1) -= delta_z[1];
             iter++;
-        } while ((delta_z.Norm() >= tol) && (iter < maxIter));
+        } while ((sqrt(delta_z[0]*delta_z[0] + delta_z[1]*delta_z[1]) >= tol) && (iter < maxIter));
         
         // issue warning if Newton-Raphson scheme did not converge
         if (iter >= maxIter)   {
             opserr << "WARNING: LeadRubberX::update() - "
                 << "did not find the hysteretic evolution parameters z after "
-                << iter << " iterations and norm: " << delta_z.Norm() << endln;
+                << iter << " iterations and norm: " << sqrt(delta_z[0]*delta_z[0] + delta_z[1]*delta_z[1]) << endln;
             return -2;
         }
         
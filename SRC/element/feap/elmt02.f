@@ -1,11 +1,14 @@
 c.... *****************************************************************<-70
-      subroutine ELMT02(d,ul,xl,ix,tl,s,r,ndf,ndm,nst,isw)
+      subroutine ELMT02(d,ul,xl,ix,tl,s,r,ndf,ndm,nst,isw,dm,
+     1                  nen,n,nh1,nh2,nh3,h,ctan,ior,iow)
 c .....................................................................
 c     elmt02 - Two dimensional truss element
 c
 c     written:  fmk
 c     created:  03/99
-c     revision: A
+c     revision: B - state passed as arguments and not through the
+c                   FEAP common blocks, so that it can be invoked by
+c                   several threads at the same time (10/26)
 c .....................................................................
 c     element data:
 c       d(1) = Crss Sectional Area, A
@@ -15,33 +18,12 @@ c .....................................................................
 
       implicit none
 
-c.... common declarations
-      character*4 o,head
-      common /bdata/ o,head(20)
-
-      integer         numnp,numel,nummat,nen,neq,ipr
-      common /cdata/  numnp,numel,nummat,nen,neq,ipr
-
-      real*8          dm
-      integer            n,ma,mct,iel,nel
-      common /eldata/ dm,n,ma,mct,iel,nel
-
-      real *8         bpr, ctan
-      common /eltran/ bpr(3), ctan(3)
-
-      integer         ior,iow
-      common /iofile/ ior,iow
-
-      integer         nh1,nh2,nh3
-      common /hdata/  nh1,nh2,nh3
-
-      real*8  h
-      common  h(1000)
-
 c ... subroutine arguments
       integer ix(*)
-      integer ndf,ndm,nst,isw
+      integer ndf,ndm,nst,isw,nen,n,nh1,nh2,nh3,ior,iow
+      real*8  dm
       real*8  d(*),ul(ndf,nen,*),xl(ndm,*),tl(*),s(nst,*),r(*)   
+      real*8  h(*),ctan(*)
 
 c ... local variables
       integer  i,j
@@ -45,14 +45,14 @@
 #include <stdlib.h>
 
 // initialise all class wise pointers to 0 and numfElements to 0
-Matrix **fElement::fElementM;
-Vector **fElement::fElementV;
-double *fElement::r;
-double *fElement::s;
-double *fElement::ul;
-double *fElement::xl;
-double *fElement::tl;
-int    *fElement::ix;
+OPS_THREAD_LOCAL Matrix **fElement::fElementM = 0;
+OPS_THREAD_LOCAL Vector **fElement::fElementV = 0;
+OPS_THREAD_LOCAL double *fElement::r = 0;
+OPS_THREAD_LOCAL double *fElement::s = 0;
+OPS_THREAD_LOCAL double *fElement::ul = 0;
+OPS_THREAD_LOCAL double *fElement::xl = 0;
+OPS_THREAD_LOCAL double *fElement::tl = 0;
+OPS_THREAD_LOCAL int    *fElement::ix = 0;
 int    fElement::numfElements(0);
 
 static double *work = 0;
@@ -107,32 +107,7 @@ fElement::fElement(int tag,
     data = new Vector(d, sizeD);
 
     // allocate space for static varaibles on creation of first instance
-    if (numfElements == 0) {
-	fElementM = new Matrix *[MAX_NST+1];
-	fElementV = new Vector *[MAX_NST+1];
-	s = new double[(MAX_NST+1)*(MAX_NST+1)];
-	r = new double[MAX_NST+1];
-	ul = new double[(MAX_NST+1)*6];
-	xl = new double[MAX_NST+1];
-	tl = new double[MAX_NST+1];
-	ix = new int[MAX_NST+1];	
-
-	// check space was available -- otherwise exit
-	if (fElementM == 0 || fElementV == 0 || ix == 0 ||
-	    r == 0 || s == 0 || ul == 0 || xl == 0 || tl == 0) {
-
-	    opserr << "FATAL: fElement::fElement() - eleTag: " << tag;
-	    opserr << " ran out of memory initialising static stuff\n";
-	    exit(-1);	    
-	}
-	
-	for (int i=0; i<MAX_NST+1; i++) {
-	    fElementM[i] = 0;
-	    fElementV[i] = 0;
-	}
-        fElementM[0] = new Matrix(1,1); // dummy for error
-	fElementV[0] = new Vector(1);
-    }
+    this->setWorkspace();
     
     // increment number of elements
     numfElements++;
@@ -189,32 +164,7 @@ fElement::fElement(int tag,
     }
 
     // allocate space for static varaibles on creation of first instance
-    if (numfElements == 0) {
-	fElementM = new Matrix *[MAX_NST+1];
-	fElementV = new Vector *[MAX_NST+1];
-	s = new double[(MAX_NST+1)*(MAX_NST+1)];
-	r = new double[MAX_NST+1];
-	ul = new double[(MAX_NST+1)*6];
-	xl = new double[MAX_NST+1];
-	tl = new double[MAX_NST+1];
-	ix = new int[MAX_NST+1];	
-
-	// check space was available -- otherwise exit
-	if (fElementM == 0 || fElementV == 0 || ix == 0 ||
-	    r == 0 || s == 0 || ul == 0 || xl == 0 || tl == 0) {
-
-	    opserr << "FATAL: fElement::fElement() - eleTag: " << tag;
-	    opserr << " ran out of memory initialising static stuff\n";
-	    exit(-1);	    
-	}
-	
-	for (int i=0; i<MAX_NST+1; i++) {
-	    fElementM[i] = 0;
-	    fElementV[i] = 0;
-	}
-        fElementM[0] = new Matrix(1,1); // dummy for error
-	fElementV[0] = new Vector(1);
-    }
+    this->setWorkspace();
 
     // increment number of elements
     numfElements++;
@@ -257,10 +207,11 @@ fElement::~fElement()
     if (Ki != 0)
       delete Ki;
 
-    // if last element - clear up space allocated
+    // if last element - clear up space allocated; this is the space of the
+    // thread deleting the element, that of any other thread is kept
 
     numfElements --;    
-    if (numfElements == 0) {
+    if (numfElements == 0 && fElementM != 0) {
 	for (int i=0; i<MAX_NST+1; i++) {
 	    if (fElementM[i] != 0) delete fElementM[i];
 	    if (fElementV[i] != 0) delete fElementV[i];
@@ -273,9 +224,45 @@ fElement::~fElement()
 	delete [] xl;
 	delete [] tl;
 	delete [] ix;	
+	fElementM = 0;
+	fElementV = 0;
     }
 }
 
+// setWorkspace():
+//   allocates the static workspace for the calling thread if it has none
+void
+fElement::setWorkspace(void)
+{
+    if (fElementM != 0)
+	return;
+
+    fElementM = new Matrix *[MAX_NST+1];
+    fElementV = new Vector *[MAX_NST+1];
+    s = new double[(MAX_NST+1)*(MAX_NST+1)];
+    r = new double[MAX_NST+1];
+    ul = new double[(MAX_NST+1)*6];
+    xl = new double[MAX_NST+1];
+    tl = new double[MAX_NST+1];
+    ix = new int[MAX_NST+1];	
+
+    // check space was available -- otherwise exit
+    if (fElementM == 0 || fElementV == 0 || ix == 0 ||
+	r == 0 || s == 0 || ul == 0 || xl == 0 || tl == 0) {
+
+	opserr << "FATAL: fElement::setWorkspace() - ";
+	opserr << " ran out of memory initialising static stuff\n";
+	exit(-1);	    
+    }
+	
+    for (int i=0; i<MAX_NST+1; i++) {
+	fElementM[i] = 0;
+	fElementV[i] = 0;
+    }
+    fElementM[0] = new Matrix(1,1); // dummy for error
+    fElementV[0] = new Vector(1);
+}
+
 int
 fElement::getNumExternalNodes(void) const
 {
@@ -381,20 +368,7 @@ fElement::setDomain(Domain *theDomain)
       opserr << "Truss::setDomain - truss " << this->getTag() << 
 	"out of memory creating vector of size" << nst << endln;
       exit(-1);
-    }          
-
-    // allocate the Matrix and Vector objects if none yet for this size nst
-   if (fElementM[nst] == 0) {
-       fElementM[nst] = new Matrix(s,nst,nst);
-       fElementV[nst] = new Vector(r,nst);       
-
-       if ((fElementM[nst] == 0) || (fElementV[nst] == 0)) {
-	   opserr << "WARNING fElement::setDomain(Domain *theDomain) -  ";
-	   opserr << " ran out of memory creating Matrix and Vector for " << *this;
-	   ndm = 0; nen = 0; ndf = 0;
-	   return;			
-       }
-   }
+    }
 }
 
 
@@ -439,8 +413,10 @@ fElement::getTangentStiff(void)
 {
 
     // check for quick return
-    if (nen == 0)
+    if (nen == 0) {
+	this->setWorkspace();
 	return (*fElementM[0]);
+    }
     
     // get the current load factor
     Domain *theDomain=this->getDomain();
@@ -479,8 +455,10 @@ const Matrix &
 fElement::getDamp(void)
 {
     // check for quick return
-    if (nen == 0)
+    if (nen == 0) {
+	this->setWorkspace();
 	return (*fElementM[0]);
+    }
     
     // get the current load factor
     Domain *theDomain=this->getDomain();
@@ -520,8 +498,10 @@ const Matrix &
 fElement::getMass(void)
 {
     // check for quick return
-    if (nen == 0)
+    if (nen == 0) {
+	this->setWorkspace();
 	return (*fElementM[0]);
+    }
     
     // get the current load factor
     Domain *theDomain=this->getDomain();
@@ -606,8 +586,10 @@ const Vector &
 fElement::getResistingForce()
 {		
     // check for quick return
-    if (nen == 0)
+    if (nen == 0) {
+	this->setWorkspace();
 	return (*fElementV[0]);
+    }
     
     // get the current load factor
     Domain *theDomain=this->getDomain();
@@ -651,8 +633,10 @@ const Vector &
 fElement::getResistingForceIncInertia()
 {	
     // check for quick return
-    if (nen == 0)
+    if (nen == 0) {
+	this->setWorkspace();
 	return (*fElementV[0]);
+    }
     
     // get the current load factor
     Domain *theDomain=this->getDomain();
@@ -756,7 +740,9 @@ extern "C" int ELMT01(double *d, double *ul, double *xl, int *ix,
 
 extern "C" int ELMT02(double *d, double *ul, double *xl, int *ix, 
 			       double *tl, double *s, double *r, int *ndf, 
-			       int *ndm, int *nst, int *isw);
+			       int *ndm, int *nst, int *isw, double *dm,
+			       int *nen, int *n, int *nh1, int *nh2, int *nh3,
+			       double *h, double *ctan, int *ior, int *iow);
 		       
 extern "C" int ELMT03(double *d, double *ul, double *xl, int *ix, 
 			       double *tl, double *s, double *r, int *ndf, 
@@ -793,7 +779,9 @@ extern "C" int elmt01_(double *d, double *ul, double *xl, int *ix, double *tl,
 
 extern "C" int elmt02_(double *d, double *ul, double *xl, int *ix, double *tl, 
                        double *s, double *r, int *ndf, int *ndm, int *nst, 
-		       int *isw);
+		       int *isw, double *dm, int *nen, int *n, int *nh1, 
+		       int *nh2, int *nh3, double *h, double *ctan, 
+		       int *ior, int *iow);
 		       
 extern "C" int elmt03_(double *d, double *ul, double *xl, int *ix, double *tl, 
                        double *s, double *r, int *ndf, int *ndm, int *nst, 
@@ -834,17 +822,31 @@ fElement::invokefRoutine(int ior, int iow, double *ctan, int isw)
 
     double dm = 0.0; // load factor
 
+    int nst = nen*ndf;
+
+    // elmt02 is passed its state as arguments and can be invoked by a 
+    // number of threads at once
+    if (eleType == 2) {
+	if (nst != 0)
+	    elmt02_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw,&dm,&nen,&n,
+		    &NH1,&NH2,&NH3,h,ctan,&ior,&iow);
+	return nst;
+    }
+
+    // the other subroutines share the FEAP common blocks, only one thread
+    // at a time can fill them, invoke the subroutine and get them back
+#ifdef _OPENMP
+#pragma omp critical (fElementCommon)
+#endif
+    {
     fillcommon_(&nen, &dm, &n, &ior, &iow, &NH1, &NH2, &NH3, &sum, 
 		h, ctan, &count);
 
     // invoke the fortran subroutine
 
-    int nst = nen*ndf;
     if (nst != 0) {
 	if (eleType == 1)
 	    elmt01_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw);
-	else if (eleType == 2)
-	    elmt02_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw);	    
 	else if (eleType == 3)
 	    elmt03_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw);	    
 	else if (eleType == 4)
@@ -859,6 +861,7 @@ fElement::invokefRoutine(int ior, int iow, double *ctan, int isw)
 	// now copy the stuff from common block to h array
 	getcommon_(&NH1,&NH3,&sum,h);
     }
+    }
 
     return nst;
 }
@@ -883,18 +886,30 @@ fElement::invokefInit(int isw, int iow)
     int count = nrCount;
 
     double dm = 0.0;
-    
+
+    // make sure this thread has its workspace
+    this->setWorkspace();
+
+    int nst = nen*ndf;
+
+    if (eleType == 2) {
+	// elmt02 returns the size of the state info it needs in NH1 and NH3
+	if (nst != 0)
+	    elmt02_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw,&dm,&nen,&n,
+		    &NH1,&NH2,&NH3,h,ctan,&ior,&iow);
+    } else {
+#ifdef _OPENMP
+#pragma omp critical (fElementCommon)
+#endif
+    {
     fillcommon_(&nen, &dm, &n, &ior, &iow, &NH1, &NH2, &NH3, &sum, 
 		h, ctan, &count);
 
     // invoke the fortran subroutine
 
-    int nst = nen*ndf;
     if (nst != 0) {
 	if (eleType == 1)
 	    elmt01_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw);
-	else if (eleType == 2)
-	    elmt02_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw);	    
 	else if (eleType == 3)
 	    elmt03_(d,ul,xl,ix,tl,s,r,&NDF,&NDM,&nst,&isw);	    
 	else if (eleType == 4)
@@ -905,17 +920,20 @@ fElement::invokefInit(int isw, int iow)
 	    opserr << "fElement::invokefRoutine() unknown element type ";
 	    opserr << eleType << endln;
 	}
-
-	if (nst < 0) {
-	    opserr << "FATAL: fElement::fElement() - eleTag: " << this->getTag();
-	    opserr << " ran out of memory creating h of size " << nst << endln;
-	    exit(-1);
-	}
     }
 
     // now get the size of the state info needed by the element
     sum = 0;
     getcommon_(&NH1,&NH3,&sum,h);
+    }
+    }
+
+    if (nst < 0) {
+	opserr << "FATAL: fElement::fElement() - eleTag: " << this->getTag();
+	opserr << " ran out of memory creating h of size " << nst << endln;
+	exit(-1);
+    }
+
     nh1 = NH1; nh3=NH3;
 	return 0;
 }
@@ -926,6 +944,9 @@ fElement::readyfRoutine(bool incInertia)
     // determine nst 
     int nst = ndf*nen;
 
+    // make sure this thread has its workspace
+    this->setWorkspace();
+
     // loop over nodes - fill in xl, ul, ix as we go
     int posUl = 0;
     int posXl = 0;
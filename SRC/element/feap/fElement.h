@@ -34,6 +34,9 @@
 //
 // Description: This file contains the class definition for fElement. fElement
 // is a wrapper used to call fortran element subroutine. It is an abstract class.
+// The elmt02 subroutine is passed all its state as arguments and may be
+// invoked by several threads at once; the user subroutines elmt01 and
+// elmt03-05 use the FEAP common blocks and are invoked by one thread at a time.
 //
 // What: "@(#) fElement.h, revA"
 
@@ -103,6 +106,7 @@ class fElement : public Element
     virtual int invokefRoutine(int ior, int iow, double *ctan, int isw);
     virtual int readyfRoutine(bool incInertia);
     virtual int invokefInit(int isw, int iow); 
+    static void setWorkspace(void);
 
     // protected data
     Vector *data;
@@ -124,15 +128,16 @@ class fElement : public Element
     Vector *theLoad;    // vector to hold the applied load P
     Matrix *Ki;
 	
-    // static data - single copy for all objects of the class	
-    static Matrix **fElementM;   // class wide matrices - use s array
-    static Vector **fElementV;   // class wide vectors - use r array
-    static double *s;  // element tangent (nst x nst)
-    static double *r;  // element residual (ndf x nen) == (nst)
-    static double *ul; // nodal responses (ndf x nen x 5) == (nst X 5)
-    static double *xl; // nodal coordinates (ndf x nen) == (nst)
-    static double *tl; // nodal temp (nen)
-    static int    *ix; // nodal tags (nen)
+    // static data - a copy for each thread invoking the fortran routines,
+    // allocated by setWorkspace() on first use in that thread
+    static OPS_THREAD_LOCAL Matrix **fElementM;   // class wide matrices - use s array
+    static OPS_THREAD_LOCAL Vector **fElementV;   // class wide vectors - use r array
+    static OPS_THREAD_LOCAL double *s;  // element tangent (nst x nst)
+    static OPS_THREAD_LOCAL double *r;  // element residual (ndf x nen) == (nst)
+    static OPS_THREAD_LOCAL double *ul; // nodal responses (ndf x nen x 5) == (nst X 5)
+    static OPS_THREAD_LOCAL double *xl; // nodal coordinates (ndf x nen) == (nst)
+    static OPS_THREAD_LOCAL double *tl; // nodal temp (nen)
+    static OPS_THREAD_LOCAL int    *ix; // nodal tags (nen)
     static int numfElements;
 };
 
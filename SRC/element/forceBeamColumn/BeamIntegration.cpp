@@ -27,15 +27,27 @@
 
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theBeamIntegrationRuleObjects;
+#include <set>
+#include <vector>
+#include <mutex>
+
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theBeamIntegrationRuleObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theBeamIntegrationRuleObjects(void)
+{
+  if (theBeamIntegrationRuleObjectsPtr == 0)
+    theBeamIntegrationRuleObjectsPtr = new MapOfTaggedObjects();
+  return *theBeamIntegrationRuleObjectsPtr;
+}
 
 bool OPS_addBeamIntegrationRule(BeamIntegrationRule *newComponent) {
-  return theBeamIntegrationRuleObjects.addComponent(newComponent);
+  return theBeamIntegrationRuleObjects().addComponent(newComponent);
 }
 
 BeamIntegrationRule *OPS_getBeamIntegrationRule(int tag) {
 
-  TaggedObject *theResult = theBeamIntegrationRuleObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theBeamIntegrationRuleObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "BeamIntegrationRule - none found with tag: " << tag << endln;
     return 0;
@@ -46,11 +58,16 @@ BeamIntegrationRule *OPS_getBeamIntegrationRule(int tag) {
 }
 
 void OPS_clearAllBeamIntegrationRule(void) {
-  theBeamIntegrationRuleObjects.clearAll();
+  theBeamIntegrationRuleObjects().clearAll();
 }
 
+// the section tables of all the BeamIntegrations, each kept once; they
+// are shared by all threads and are never freed
+static std::set<std::vector<double> > theSectionTables;
+static std::mutex theSectionTablesMutex;
+
 BeamIntegration::BeamIntegration(int classTag):
-  MovableObject(classTag)
+  MovableObject(classTag), sectionTable(0), tableNIP(0), tableL(0.0)
 {
   // Nothing to do
 }
@@ -60,6 +77,28 @@ BeamIntegration::~BeamIntegration()
   // Nothing to do
 }
 
+const double *
+BeamIntegration::getSectionTable(int nIP, double L)
+{
+  if (sectionTable != 0 && nIP == tableNIP && L == tableL)
+    return sectionTable;
+
+  std::vector<double> table(2*nIP);
+  if (nIP > 0) {
+    this->getSectionLocations(nIP, L, &table[0]);
+    this->getSectionWeights(nIP, L, &table[nIP]);
+  }
+
+  std::lock_guard<std::mutex> lock(theSectionTablesMutex);
+  const std::vector<double> &theTable = *(theSectionTables.insert(table).first);
+
+  sectionTable = theTable.empty() ? 0 : &theTable[0];
+  tableNIP = nIP;
+  tableL = L;
+
+  return sectionTable;
+}
+
 void
 BeamIntegration::getLocationsDeriv(int nIP, double L, double dLdh,
 				   double *dptsdh)
@@ -43,6 +43,12 @@ class BeamIntegration : public MovableObject
   virtual void getSectionLocations(int nIP, double L, double *xi) = 0;
   virtual void getSectionWeights(int nIP, double L, double *wt) = 0;
 
+  // The nIP section locations followed by the nIP weights for length L.
+  // The table is formed on the first call and kept until nIP, L or a
+  // parameter changes; equal tables are shared by all BeamIntegrations
+  const double *getSectionTable(int nIP, double L);
+  void clearSectionTable(void) {sectionTable = 0;}
+
   virtual void addElasticDeformations(ElementalLoad *theLoad,
 				      double loadFactor,
 				      double L, double *v0) {return;}
@@ -65,6 +71,11 @@ class BeamIntegration : public MovableObject
 				  double dLdh = 0.0) {return 0;}
 
   virtual void Print(OPS_Stream &s, int flag = 0) = 0;
+
+ private:
+  const double *sectionTable;
+  int tableNIP;
+  double tableL;
 };
 
 // a BeamIntegrationRule store BeamIntegration and section tags
@@ -179,6 +179,8 @@ DistHingeIntegration::setParameter(const char **argv, int argc,
 int
 DistHingeIntegration::updateParameter(int parameterID, Information &info)
 {
+  this->clearSectionTable();
+
   switch (parameterID) {
   case 1:
     lpI = info.theDouble;
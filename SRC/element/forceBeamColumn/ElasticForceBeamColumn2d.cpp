@@ -152,7 +152,8 @@ ElasticForceBeamColumn2d::ElasticForceBeamColumn2d():
   Element(0,ELE_TAG_ElasticForceBeamColumn2d), connectedExternalNodes(2), 
   beamIntegr(0), numSections(0), crdTransf(0),
   rho(0.0), initialFlag(0), numEleLoads(0),
-  parameterID(0)
+  parameterID(0), fv(NEBD,NEBD), kv(NEBD,NEBD),
+  formedStiff(false), parameterSet(false)
 {
   theNodes[0] = 0;  
   theNodes[1] = 0;
@@ -175,7 +176,8 @@ ElasticForceBeamColumn2d::ElasticForceBeamColumn2d (int tag,
   beamIntegr(0), numSections(numSec), crdTransf(0),
   rho(massDensPerUnitLength),
   initialFlag(0), numEleLoads(0),
-  parameterID(0)
+  parameterID(0), fv(NEBD,NEBD), kv(NEBD,NEBD),
+  formedStiff(false), parameterSet(false)
 {
   theNodes[0] = 0;
   theNodes[1] = 0;
@@ -253,6 +255,8 @@ ElasticForceBeamColumn2d::getNumDOF(void)
 void
 ElasticForceBeamColumn2d::setDomain(Domain *theDomain)
 {
+  formedStiff = false;
+
   // check Domain is not null - invoked when object removed from a domain
   if (theDomain == 0) {
     theNodes[0] = 0;
@@ -322,60 +326,46 @@ int ElasticForceBeamColumn2d::revertToStart()
 const Matrix &
 ElasticForceBeamColumn2d::getInitialStiff(void)
 {
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
+  this->formBasicStiff();
 
-  /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
-  I.Zero();
-  for (int i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
-  
-  // calculate element stiffness matrix
-  // invert3by3Matrix(f, kv);
+  static Vector SeInit(NEBD);
+  SeInit.Zero();
+  return crdTransf->getGlobalStiffMatrix(kv, SeInit);
+}
 
-  static Matrix kvInit(NEBD, NEBD);
-  if (f.Solve(I, kvInit) < 0)
-    opserr << "ElasticForceBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
-  */
+// with a linear transformation the stiffness does not depend on the
+// displacements, so the FE_Element can keep it
+bool
+ElasticForceBeamColumn2d::isLinear(void)
+{
+  if (crdTransf == 0 || parameterSet == true)
+    return false;
 
-  static Matrix kvInit(NEBD, NEBD);
-  f.Invert(kvInit);
+  return crdTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf2d;
+}
 
-  static Vector SeInit(NEBD);
-  SeInit.Zero();
-  return crdTransf->getGlobalStiffMatrix(kvInit, SeInit);
+void
+ElasticForceBeamColumn2d::formBasicStiff(void)
+{
+  if (formedStiff == true && parameterSet == false)
+    return;
+
+  this->getInitialFlexibility(fv);
+  fv.Invert(kv);
+  formedStiff = true;
 }
 
 const Matrix &
 ElasticForceBeamColumn2d::getTangentStiff(void)
 {
   crdTransf->update();	// Will remove once we clean up the corotational 2d transformation -- MHS
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
-
-  /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
-  I.Zero();
-  for (int i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
-  
-  // calculate element stiffness matrix
-  // invert3by3Matrix(f, kv);
-
-  static Matrix kvInit(NEBD, NEBD);
-  if (f.Solve(I, kvInit) < 0)
-    opserr << "ElasticForceBeamColumn2d::getInitialStiff() -- could not invert flexibility\n";
-  */
-
-  static Matrix kvInit(NEBD, NEBD);
-  f.Invert(kvInit);
+  this->formBasicStiff();
 
   static Vector q(NEBD);
   q.Zero();
   this->computeBasicForces(q);
 
-  return crdTransf->getGlobalStiffMatrix(kvInit, q);
+  return crdTransf->getGlobalStiffMatrix(kv, q);
 }
     
 void
@@ -429,9 +419,6 @@ ElasticForceBeamColumn2d::getResistingForce(void)
   if (numEleLoads > 0)
     this->computeReactions(p0);
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
-
   static Vector Se(NEBD);
   this->computeBasicForces(Se);
 
@@ -446,11 +433,10 @@ ElasticForceBeamColumn2d::computeBasicForces(Vector &q)
     return;
   }
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
+  this->formBasicStiff();
 
   const Vector &v = crdTransf->getBasicTrialDisp();
-  f.Solve(v, q);
+  q.addMatrixVector(0.0, kv, v, 1.0);
 }
 
 /********* NEWTON , SUBDIVIDE AND INITIAL ITERATIONS ********************
@@ -1279,8 +1265,11 @@ ElasticForceBeamColumn2d::setParameter(const char **argv, int argc, Parameter &p
   if (strcmp(argv[0],"rho") == 0)
     return param.addObject(1, this);
   
+  // the remaining parameters belong to the sections or the integration
+  parameterSet = true;
+
   // section response -
-  else if (strstr(argv[0],"sectionX") != 0) {
+  if (strstr(argv[0],"sectionX") != 0) {
     if (argc > 2) {
       double sectionLoc = atof(argv[1]);
 
@@ -152,7 +152,8 @@ ElasticForceBeamColumn3d::ElasticForceBeamColumn3d():
   Element(0,ELE_TAG_ElasticForceBeamColumn3d), connectedExternalNodes(2), 
   beamIntegr(0), numSections(0), crdTransf(0),
   rho(0.0), initialFlag(0), Se(NEBD), numEleLoads(0),
-  parameterID(0)
+  parameterID(0), fv(NEBD,NEBD), kv(NEBD,NEBD),
+  formedStiff(false), parameterSet(false)
 {
   theNodes[0] = 0;  
   theNodes[1] = 0;
@@ -176,7 +177,8 @@ ElasticForceBeamColumn3d::ElasticForceBeamColumn3d (int tag,
   rho(massDensPerUnitLength),
   initialFlag(0), Se(NEBD), 
   numEleLoads(0),
-  parameterID(0)
+  parameterID(0), fv(NEBD,NEBD), kv(NEBD,NEBD),
+  formedStiff(false), parameterSet(false)
 {
   theNodes[0] = 0;
   theNodes[1] = 0;
@@ -254,6 +256,8 @@ ElasticForceBeamColumn3d::getNumDOF(void)
 void
 ElasticForceBeamColumn3d::setDomain(Domain *theDomain)
 {
+  formedStiff = false;
+
   // check Domain is not null - invoked when object removed from a domain
   if (theDomain == 0) {
     theNodes[0] = 0;
@@ -323,29 +327,33 @@ int ElasticForceBeamColumn3d::revertToStart()
 const Matrix &
 ElasticForceBeamColumn3d::getInitialStiff(void)
 {
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
+  this->formBasicStiff();
 
-  /*
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse  
-  I.Zero();
-  for (int i=0; i<NEBD; i++)
-    I(i,i) = 1.0;
-  
-  // calculate element stiffness matrix
-  // invert3by3Matrix(f, kv);
+  static Vector SeInit(NEBD);
+  SeInit.Zero();
+  return crdTransf->getGlobalStiffMatrix(kv, SeInit);
+}
 
-  static Matrix kvInit(NEBD, NEBD);
-  if (f.Solve(I, kvInit) < 0)
-    opserr << "ElasticForceBeamColumn3d::getInitialStiff() -- could not invert flexibility\n";
-  */
+// with a linear transformation the stiffness does not depend on the
+// displacements, so the FE_Element can keep it
+bool
+ElasticForceBeamColumn3d::isLinear(void)
+{
+  if (crdTransf == 0 || parameterSet == true)
+    return false;
+
+  return crdTransf->getClassTag() == CRDTR_TAG_LinearCrdTransf3d;
+}
 
-  static Matrix kvInit(NEBD, NEBD);
-  f.Invert(kvInit);
+void
+ElasticForceBeamColumn3d::formBasicStiff(void)
+{
+  if (formedStiff == true && parameterSet == false)
+    return;
 
-  static Vector SeInit(NEBD);
-  SeInit.Zero();
-  return crdTransf->getGlobalStiffMatrix(kvInit, SeInit);
+  this->getInitialFlexibility(fv);
+  fv.Invert(kv);
+  formedStiff = true;
 }
 
 const Matrix &
@@ -410,9 +418,6 @@ ElasticForceBeamColumn3d::getResistingForce(void)
   if (numEleLoads > 0)
     this->computeReactions(p0);
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
-
   static Vector Se(NEBD);
   this->computeBasicForces(Se);
 
@@ -427,11 +432,10 @@ ElasticForceBeamColumn3d::computeBasicForces(Vector &q)
     return;
   }
 
-  static Matrix f(NEBD, NEBD);   // element flexibility matrix  
-  this->getInitialFlexibility(f);
+  this->formBasicStiff();
 
   const Vector &v = crdTransf->getBasicTrialDisp();
-  f.Solve(v, q);
+  q.addMatrixVector(0.0, kv, v, 1.0);
 }
 
 /********* NEWTON , SUBDIVIDE AND INITIAL ITERATIONS ********************
@@ -1468,8 +1472,11 @@ ElasticForceBeamColumn3d::setParameter(const char **argv, int argc, Parameter &p
   if (strcmp(argv[0],"rho") == 0)
     return param.addObject(1, this);
   
+  // the remaining parameters belong to the sections or the integration
+  parameterSet = true;
+
   // section response -
-  else if (strstr(argv[0],"sectionX") != 0) {
+  if (strstr(argv[0],"sectionX") != 0) {
     if (argc > 2) {
       float sectionLoc = atof(argv[1]);
 
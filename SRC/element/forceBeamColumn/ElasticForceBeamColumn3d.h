@@ -101,6 +101,7 @@ class ElasticForceBeamColumn3d: public Element
   const Matrix &getTangentStiff(void);
   const Matrix &getInitialStiff(void);
   const Matrix &getMass(void);    
+  bool isLinear(void);
   
   void zeroLoad(void);	
   int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -169,6 +170,14 @@ class ElasticForceBeamColumn3d: public Element
   static double workArea[];
   
   int parameterID;
+
+  // the basic flexibility and stiffness depend only on the elastic
+  // sections and the integration, so they are formed once
+  void formBasicStiff(void);
+  Matrix fv;
+  Matrix kv;
+  bool   formedStiff;
+  bool   parameterSet;          // a section or integration parameter is set
 };
 
 #endif
@@ -66,6 +66,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <Information.h>
 #include <Parameter.h>
 #include <ForceBeamColumn2d.h>
+#include <Workspace.h>
 #include <MatrixUtil.h>
 #include <Domain.h>
 #include <Channel.h>
@@ -79,13 +80,11 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <ElementalLoad.h>
 #include <ElementIter.h>
 
-Matrix ForceBeamColumn2d::theMatrix(6,6);
-Vector ForceBeamColumn2d::theVector(6);
-double ForceBeamColumn2d::workArea[200];
-
-Vector *ForceBeamColumn2d::vsSubdivide = 0;
-Matrix *ForceBeamColumn2d::fsSubdivide = 0;
-Vector *ForceBeamColumn2d::SsrSubdivide = 0;
+// keys identifying the scratch storage each thread obtains from Workspace
+static char matrixKey;
+static char vectorKey;
+static char workKey;
+static char subdivideKey;
 
 void* OPS_ForceBeamColumn2d()
 {
@@ -112,6 +111,8 @@ void* OPS_ForceBeamColumn2d()
     // options
     double mass = 0.0, tol=1e-12;
     int maxIter = 10;
+    bool warmStart = false, reuseElastic = false;
+    double sectionTol = 0.0;
     numData = 1;
     while(OPS_GetNumRemainingInputArgs() > 0) {
 	const char* type = OPS_GetString();
@@ -133,6 +134,17 @@ void* OPS_ForceBeamColumn2d()
 		    return 0;
 		}
 	    }
+	} else if(strcmp(type,"-warmStart") == 0) {
+	    warmStart = true;
+	} else if(strcmp(type,"-sectionTol") == 0) {
+	    if(OPS_GetNumRemainingInputArgs() > 0) {
+		if(OPS_GetDoubleInput(&numData,&sectionTol) < 0) {
+		    opserr << "WARNING invalid sectionTol\n";
+		    return 0;
+		}
+	    }
+	} else if(strcmp(type,"-reuseElastic") == 0) {
+	    reuseElastic = true;
 	}
     }
 
@@ -168,7 +180,8 @@ void* OPS_ForceBeamColumn2d()
     }
 
     Element *theEle =  new ForceBeamColumn2d(iData[0],iData[1],iData[2],secTags.Size(),sections,
-					     *bi,*theTransf,mass,maxIter,tol);
+					     *bi,*theTransf,mass,maxIter,tol,
+					     warmStart,sectionTol,reuseElastic);
     delete [] sections;
     return theEle;
 }
@@ -188,6 +201,8 @@ int OPS_ForceBeamColumn2d(Domain& theDomain, const ID& elenodes, ID& eletags)
     // options
     double mass = 0.0, tol=1e-12;
     int maxIter = 10;
+    bool warmStart = false, reuseElastic = false;
+    double sectionTol = 0.0;
     numData = 1;
     while(OPS_GetNumRemainingInputArgs() > 0) {
 	const char* type = OPS_GetString();
@@ -200,6 +215,14 @@ int OPS_ForceBeamColumn2d(Domain& theDomain, const ID& elenodes, ID& eletags)
 	    if(OPS_GetNumRemainingInputArgs() > 0) {
 		if(OPS_GetDoubleInput(&numData,&mass) < 0) return -1;
 	    }
+	} else if(strcmp(type,"-warmStart") == 0) {
+	    warmStart = true;
+	} else if(strcmp(type,"-sectionTol") == 0) {
+	    if(OPS_GetNumRemainingInputArgs() > 0) {
+		if(OPS_GetDoubleInput(&numData,&sectionTol) < 0) return -1;
+	    }
+	} else if(strcmp(type,"-reuseElastic") == 0) {
+	    reuseElastic = true;
 	}
     }
 
@@ -244,7 +267,8 @@ int OPS_ForceBeamColumn2d(Domain& theDomain, const ID& elenodes, ID& eletags)
     eletags.resize(elenodes.Size()/2);
     for (int i=0; i<elenodes.Size()/2; i++) {
 	theEle = new ForceBeamColumn2d(--currTag,elenodes(2*i),elenodes(2*i+1),secTags.Size(),
-				       sections,*bi,*theTransf,mass,maxIter,tol);
+				       sections,*bi,*theTransf,mass,maxIter,tol,
+				       warmStart,sectionTol,reuseElastic);
 	if (theEle == 0) {
 	    opserr<<"WARING: run out of memory for creating element\n";
 	    return -1;
@@ -272,21 +296,11 @@ ForceBeamColumn2d::ForceBeamColumn2d():
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0), Ssr(0), vscommit(0), 
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0),
-  Ki(0), parameterID(0)
+  Ki(0), warmStart(false), sectionTol(0.0), reuseElastic(false),
+  lastScheme(0), lastSubdivide(1), numSectionUpdates(0), parameterID(0)
 {
   theNodes[0] = 0;  
   theNodes[1] = 0;
-
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn2d::ForceBeamColumn2d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -296,7 +310,8 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
 				      int numSec, SectionForceDeformation **sec,
 				      BeamIntegration &bi,
 				      CrdTransf &coordTransf, double massDensPerUnitLength,
-				      int maxNumIters, double tolerance):
+				      int maxNumIters, double tolerance,
+				      bool ws, double secTol, bool reuse):
   Element(tag,ELE_TAG_ForceBeamColumn2d), connectedExternalNodes(2),
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
   rho(massDensPerUnitLength),maxIters(maxNumIters), tol(tolerance), 
@@ -305,7 +320,8 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0),Ssr(0), vscommit(0), 
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0),
-  Ki(0), parameterID(0)
+  Ki(0), warmStart(ws), sectionTol(secTol), reuseElastic(reuse),
+  lastScheme(0), lastSubdivide(1), numSectionUpdates(0), parameterID(0)
 {
   theNodes[0] = 0;
   theNodes[1] = 0;
@@ -327,17 +343,6 @@ ForceBeamColumn2d::ForceBeamColumn2d (int tag, int nodeI, int nodeJ,
   }
 
   this->setSectionPointers(numSec, sec);
-  
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn2d::ForceBeamColumn2d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn2d():
@@ -463,6 +468,9 @@ ForceBeamColumn2d::setDomain(Domain *theDomain)
     exit(0);
   }
 
+  // form the section locations and weights for the element length
+  beamIntegr->getSectionTable(numSections, L);
+
   if (initialFlag == 0) 
     this->initializeSectionHistoryVariables();
 }
@@ -563,6 +571,9 @@ int ForceBeamColumn2d::revertToStart()
   Se.Zero();
   kv.Zero();
   
+  lastScheme = 0;
+  lastSubdivide = 1;
+
   initialFlag = 0;
   // this->update();
   return err;
@@ -756,6 +767,7 @@ ForceBeamColumn2d::initializeSectionHistoryVariables (void)
 int
 ForceBeamColumn2d::update()
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   // if have completed a recvSelf() - do a revertToLastCommit
   // to get Ssr, etc. set correctly
   if (initialFlag == 2)
@@ -767,30 +779,32 @@ ForceBeamColumn2d::update()
   // get basic displacements and increments
   const Vector &v = crdTransf->getBasicTrialDisp();    
 
-  static Vector dv(NEBD);
+  double dvData[NEBD];
+  Vector dv(dvData, NEBD);
 
   dv = crdTransf->getBasicIncrDeltaDisp();    
 
   if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && numEleLoads == 0)
     return 0;
 
-  static Vector vin(NEBD);
+  double vinData[NEBD];
+  Vector vin(vinData, NEBD);
   vin = v;
   vin -= dv;
 
   double L = crdTransf->getInitialLength();
   double oneOverL  = 1.0/L;  
 
-  double xi[maxNumSections];
-  beamIntegr->getSectionLocations(numSections, L, xi);
-  
-  double wt[maxNumSections];
-  beamIntegr->getSectionWeights(numSections, L, wt);
+  const double *xi = beamIntegr->getSectionTable(numSections, L);
+  const double *wt = xi + numSections;
 
-  static Vector vr(NEBD);       // element residual displacements
-  static Matrix f(NEBD,NEBD);   // element flexibility matrix
+  double vrData[NEBD];
+  Vector vr(vrData, NEBD);       // element residual displacements
+  double fData[NEBD*NEBD];
+  Matrix f(fData, NEBD,NEBD);   // element flexibility matrix
   
-  static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+  double IData[NEBD*NEBD];
+  Matrix I(IData, NEBD,NEBD);   // an identity matrix for matrix inverse
   double dW;                    // section strain energy (work) norm 
   int i, j;
   
@@ -800,11 +814,36 @@ ForceBeamColumn2d::update()
 
   int numSubdivide = 1;
   bool converged = false;
-  static Vector dSe(NEBD);
-  static Vector dvToDo(NEBD);
-  static Vector dvTrial(NEBD);
-  static Vector SeTrial(NEBD);
-  static Matrix kvTrial(NEBD, NEBD);
+  double dSeData[NEBD];
+  Vector dSe(dSeData, NEBD);
+  double dvToDoData[NEBD];
+  Vector dvToDo(dvToDoData, NEBD);
+  double dvTrialData[NEBD];
+  Vector dvTrial(dvTrialData, NEBD);
+  double SeTrialData[NEBD];
+  Vector SeTrial(SeTrialData, NEBD);
+  double kvTrialData[NEBD*NEBD];
+  Matrix kvTrial(kvTrialData, NEBD, NEBD);
+
+  // section deformations, stress resultants and flexibilities of the
+  // current trial, kept in the workspace of the calling thread
+  Vector vsSubdivide[maxNumSections];
+  Vector SsrSubdivide[maxNumSections];
+  Matrix fsSubdivide[maxNumSections];
+
+  int sizeSubdivide = 0;
+  for (i=0; i<numSections; i++) {
+    int order = sections[i]->getOrder();
+    sizeSubdivide += order*(order+2);
+  }
+  double *subdivideData = Workspace::getDoubles(&subdivideKey, sizeSubdivide);
+  for (i=0; i<numSections; i++) {
+    int order = sections[i]->getOrder();
+    vsSubdivide[i].setData(subdivideData, order);
+    SsrSubdivide[i].setData(&subdivideData[order], order);
+    fsSubdivide[i].setData(&subdivideData[2*order], order, order);
+    subdivideData += order*(order+2);
+  }
 
   dvToDo = dv;
   dvTrial = dvToDo;
@@ -813,6 +852,18 @@ ForceBeamColumn2d::update()
 
   maxSubdivisions = 4;
 
+  // with -warmStart begin with the scheme and subdivision of dv with which
+  // the last update converged rather than regular newton on all of dv
+  int firstScheme = 0;
+  bool warmStarted = false;
+  bool schemeRecorded = false;
+  if (warmStart == true && initialFlag == 1 && (lastScheme > 0 || lastSubdivide > 1)) {
+    firstScheme = lastScheme;
+    for ( ; numSubdivide < lastSubdivide; numSubdivide++)
+      dvTrial /= factor;
+    warmStarted = true;
+  }
+
   // fmk - modification to get compatable ele forces and deformations 
   //   for a change in deformation dV we try first a newton iteration, if
   //   that fails we try an initial flexibility iteration on first iteration 
@@ -829,7 +880,7 @@ ForceBeamColumn2d::update()
     // initial tangent on first iteration then regular newton (if l==1), or 
     // initial tangent iterations (if l==2)
 
-    for (int l=0; l<3; l++) {
+    for (int l=firstScheme; l<3; l++) {
 
       //      if (l == 1) l = 2;
       SeTrial = Se;
@@ -878,15 +929,10 @@ ForceBeamColumn2d::update()
 	    int order      = sections[i]->getOrder();
 	    const ID &code = sections[i]->getType();
 
-	    static Vector Ss;
-	    static Vector dSs;
-	    static Vector dvs;
-	    static Matrix fb;
-	    
-	    Ss.setData(workArea, order);
-	    dSs.setData(&workArea[order], order);
-	    dvs.setData(&workArea[2*order], order);
-	    fb.setData(&workArea[3*order], order, NEBD);
+	    Vector Ss(workArea, order);
+	    Vector dSs(&workArea[order], order);
+	    Vector dvs(&workArea[2*order], order);
+	    Matrix fb(&workArea[3*order], order, NEBD);
 	    
 	    double xL  = xi[i];
 	    double xL1 = xL-1.0;
@@ -952,20 +998,32 @@ ForceBeamColumn2d::update()
 	      dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
 	    }
 	    
-	    // set section deformations
-	    if (initialFlag != 0)
-	      vsSubdivide[i] += dvs;
-
-	    if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-	      opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
-	      return -1;
-	    }
+	    // with -sectionTol a section whose unbalance work is below the
+	    // tolerance keeps its state, the residual deformations fs*dSs are
+	    // still integrated below
+	    bool updateSection = true;
+	    if (sectionTol > 0.0 && initialFlag != 0 && fabs(dvs ^ dSs) < sectionTol)
+	      updateSection = false;
+
+	    if (updateSection == true) {
+	      // set section deformations
+	      if (initialFlag != 0)
+		vsSubdivide[i] += dvs;
+
+	      if (sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
+		opserr << "ForceBeamColumn2d::update() - section failed in setTrial\n";
+		return -1;
+	      }
+	      numSectionUpdates++;
 
-	    // get section resisting forces
-	    SsrSubdivide[i] = sections[i]->getStressResultant();
+	      // get section resisting forces
+	      SsrSubdivide[i] = sections[i]->getStressResultant();
 
-	    // get section flexibility matrix
-	    fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	      // get section flexibility matrix, with -reuseElastic that of a
+	      // linear section is kept once formed
+	      if (reuseElastic == false || initialFlag == 0 || sections[i]->isLinear() == false)
+		fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	    }
 
 	    // calculate section residual deformations
 	    // dvs = fs * (Ss - Ssr);
@@ -1076,6 +1134,19 @@ ForceBeamColumn2d::update()
 	  
 	  // check for convergence of this interval
 	  if (fabs(dW) < tol) { 
+
+	    // remember where the first interval converged for a warm start,
+	    // if that is where this update began try one level easier next time
+	    if (schemeRecorded == false) {
+	      if (warmStarted == true && l == lastScheme && numSubdivide == lastSubdivide) {
+		lastScheme = 0;
+		lastSubdivide = (numSubdivide > 1) ? numSubdivide-1 : 1;
+	      } else {
+		lastScheme = l;
+		lastSubdivide = numSubdivide;
+	      }
+	      schemeRecorded = true;
+	    }
 	    
 	    // set the target displacement
 	    dvToDo -= dvTrial;
@@ -1119,6 +1190,9 @@ ForceBeamColumn2d::update()
 	} // for (j=0; j<numIters; j++)
       } // if (initialFlag != 2)
     } // for (int l=0; l<2; l++)
+
+    // later subdivisions try all the schemes
+    firstScheme = 0;
   } // while (converged == false)
 
 
@@ -1184,6 +1258,7 @@ void ForceBeamColumn2d::getDistrLoadInterpolatMatrix(double xi, Matrix &bp, cons
 const Matrix &
 ForceBeamColumn2d::getMass(void)
 { 
+  Matrix &theMatrix = Workspace::getMatrix(&matrixKey, 6, 6);
   theMatrix.Zero();
   
   double L = crdTransf->getInitialLength();
@@ -1530,6 +1605,7 @@ ForceBeamColumn2d::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 ForceBeamColumn2d::getResistingForceIncInertia()
 {	
+  Vector &theVector = Workspace::getVector(&vectorKey, 6);
   // Compute the current resisting force
   theVector = this->getResistingForce();
 
@@ -1654,12 +1730,15 @@ ForceBeamColumn2d::sendSelf(int commitTag, Channel &theChannel)
      secDefSize   += size;
   }
 
-  Vector dData(1+1+NEBD+NEBD*NEBD+secDefSize+4); 
+  Vector dData(1+1+3+NEBD+NEBD*NEBD+secDefSize+4); 
   loc = 0;
 
   // place double variables into Vector
   dData(loc++) = rho;
   dData(loc++) = tol;
+  dData(loc++) = warmStart ? 1.0 : 0.0;
+  dData(loc++) = sectionTol;
+  dData(loc++) = reuseElastic ? 1.0 : 0.0;
   
   // put  distrLoadCommit into the Vector
   //  for (i=0; i<NL; i++) 
@@ -1761,6 +1840,9 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 
   beamIntegr->setDbTag(beamIntegrDbTag);
 
+  // the section table is formed again from the received data
+  beamIntegr->clearSectionTable();
+
   // invoke recvSelf on the beamIntegr object
   if (beamIntegr->recvSelf(commitTag, theChannel, theBroker) < 0)  
   {
@@ -1918,7 +2000,7 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
      secDefSize   += size;
   }
   
-  Vector dData(1+1+NEBD+NEBD*NEBD+secDefSize+4);   
+  Vector dData(1+1+3+NEBD+NEBD*NEBD+secDefSize+4);   
   
   if (theChannel.recvVector(dbTag, commitTag, dData) < 0)  {
     opserr << "ForceBeamColumn2d::sendSelf() - failed to send Vector data\n";
@@ -1930,6 +2012,9 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
   // place double variables into Vector
   rho = dData(loc++);
   tol = dData(loc++);
+  warmStart = (dData(loc++) != 0.0);
+  sectionTol = dData(loc++);
+  reuseElastic = (dData(loc++) != 0.0);
 
   // put  distrLoadCommit into the Vector
   //for (i=0; i<NL; i++) 
@@ -1970,6 +2055,7 @@ ForceBeamColumn2d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker
 int
 ForceBeamColumn2d::getInitialFlexibility(Matrix &fe)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   fe.Zero();
   
   double L = crdTransf->getInitialLength();
@@ -2055,6 +2141,7 @@ ForceBeamColumn2d::getInitialFlexibility(Matrix &fe)
 int
 ForceBeamColumn2d::getInitialDeformations(Vector &v0)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   v0.Zero();
   if (numEleLoads < 1)
     return 0;
@@ -2192,6 +2279,7 @@ void ForceBeamColumn2d::compSectionDisplacements(Vector sectionCoords[], Vector
 void
 ForceBeamColumn2d::Print(OPS_Stream &s, int flag)
 {
+  Vector &theVector = Workspace::getVector(&vectorKey, 6);
   if (flag == 2) {
 
     s << "#ForceBeamColumn2D\n";
@@ -2397,6 +2485,7 @@ ForceBeamColumn2d::displaySelf(Renderer &theViewer, int displayMode, float fact,
 Response*
 ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 {
+  Vector &theVector = Workspace::getVector(&vectorKey, 6);
   Response *theResponse = 0;
 
   output.tag("ElementOutput");
@@ -2506,6 +2595,10 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
   else if (strcmp(argv[0],"integrationWeights") == 0)
     theResponse = new ElementResponse(this, 11, Vector(numSections));
 
+  // number of section state determinations
+  else if (strcmp(argv[0],"sectionUpdates") == 0)
+    theResponse = new ElementResponse(this, 20, 0.0);
+
   else if (strcmp(argv[0],"RayleighForces") == 0 || strcmp(argv[0],"rayleighForces") ==0 || strcmp(argv[0],"dampingForces") == 0) { 
 
     output.tag("ResponseType","Px_1");
@@ -2621,6 +2714,7 @@ ForceBeamColumn2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
 {
+  Vector &theVector = Workspace::getVector(&vectorKey, 6);
   static Vector vp(3);
   static Matrix fe(3,3);
 
@@ -2776,6 +2870,9 @@ ForceBeamColumn2d::getResponse(int responseID, Information &eleInfo)
     return eleInfo.setVector(weights);
   }
 
+  else if (responseID == 20)
+    return eleInfo.setDouble(numSectionUpdates);
+
   else
     return -1;
 }
@@ -3042,6 +3139,7 @@ ForceBeamColumn2d::activateParameter(int passedParameterID)
 const Matrix&
 ForceBeamColumn2d::getKiSensitivity(int gradNumber)
 {
+  Matrix &theMatrix = Workspace::getMatrix(&matrixKey, 6, 6);
   theMatrix.Zero();
   return theMatrix;
 }
@@ -3049,6 +3147,7 @@ ForceBeamColumn2d::getKiSensitivity(int gradNumber)
 const Matrix&
 ForceBeamColumn2d::getMassSensitivity(int gradNumber)
 {
+  Matrix &theMatrix = Workspace::getMatrix(&matrixKey, 6, 6);
   theMatrix.Zero();
   
   double L = crdTransf->getInitialLength();
@@ -3089,6 +3188,7 @@ ForceBeamColumn2d::getResistingForceSensitivity(int gradNumber)
 int
 ForceBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   int err = 0;
 
   double L = crdTransf->getInitialLength();
@@ -3185,6 +3285,7 @@ ForceBeamColumn2d::commitSensitivity(int gradNumber, int numGrads)
 const Vector &
 ForceBeamColumn2d::computedqdh(int gradNumber)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   //opserr << "FBC2d::computedqdh " << gradNumber << endln;
 
   double L = crdTransf->getInitialLength();
@@ -3320,6 +3421,7 @@ ForceBeamColumn2d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn2d::computedfedh(int gradNumber)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   static Matrix dfedh(3,3);
 
   dfedh.Zero();
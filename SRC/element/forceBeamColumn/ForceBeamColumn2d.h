@@ -81,7 +81,9 @@ class ForceBeamColumn2d: public Element
 		    int numSections, SectionForceDeformation **sec,
 		    BeamIntegration &beamIntegr,
 		    CrdTransf &coordTransf, double rho = 0.0, 
-		    int maxNumIters = 10, double tolerance = 1.0e-12);
+		    int maxNumIters = 10, double tolerance = 1.0e-12,
+		    bool warmStart = false, double sectionTol = 0.0,
+		    bool reuseElastic = false);
   
   ~ForceBeamColumn2d();
   
@@ -190,19 +192,20 @@ class ForceBeamColumn2d: public Element
 
   Matrix *Ki;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
-  
   enum {maxNumSections = 30};
   enum {maxSectionOrder = 5};
 
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
-  
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
+
+  // options of the element state determination
+  bool   warmStart;             // begin with the scheme and subdivision that converged last
+  double sectionTol;            // unbalance work below which a section keeps its state
+  bool   reuseElastic;          // keep the flexibility of linear sections
+  int    lastScheme;            // the scheme and number of subdivisions of dv with
+  int    lastSubdivide;         //   which the last update converged
+  int    numSectionUpdates;     // number of section state determinations
+
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
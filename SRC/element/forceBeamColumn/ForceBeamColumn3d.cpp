@@ -66,6 +66,7 @@ Journal of Structural Engineering, Approved for publication, February 2007.
 #include <Information.h>
 #include <Parameter.h>
 #include <ForceBeamColumn3d.h>
+#include <Workspace.h>
 #include <MatrixUtil.h>
 #include <Domain.h>
 #include <Channel.h>
@@ -90,13 +91,11 @@ using std::ifstream;
 
 #define DefaultLoverGJ 1.0e-10
 
-Matrix ForceBeamColumn3d::theMatrix(12,12);
-Vector ForceBeamColumn3d::theVector(12);
-double ForceBeamColumn3d::workArea[200];
-
-Vector *ForceBeamColumn3d::vsSubdivide = 0;
-Matrix *ForceBeamColumn3d::fsSubdivide = 0;
-Vector *ForceBeamColumn3d::SsrSubdivide = 0;
+// keys identifying the scratch storage each thread obtains from Workspace
+static char matrixKey;
+static char vectorKey;
+static char workKey;
+static char subdivideKey;
 
 void* OPS_ForceBeamColumn3d()
 {
@@ -123,6 +122,8 @@ void* OPS_ForceBeamColumn3d()
     // options
     double mass = 0.0, tol=1e-12;
     int maxIter = 10;
+    bool warmStart = false, reuseElastic = false;
+    double sectionTol = 0.0;
     numData = 1;
     while(OPS_GetNumRemainingInputArgs() > 0) {
 	const char* type = OPS_GetString();
@@ -144,6 +145,17 @@ void* OPS_ForceBeamColumn3d()
 		    return 0;
 		}
 	    }
+	} else if(strcmp(type,"-warmStart") == 0) {
+	    warmStart = true;
+	} else if(strcmp(type,"-sectionTol") == 0) {
+	    if(OPS_GetNumRemainingInputArgs() > 0) {
+		if(OPS_GetDoubleInput(&numData,&sectionTol) < 0) {
+		    opserr << "WARNING invalid sectionTol\n";
+		    return 0;
+		}
+	    }
+	} else if(strcmp(type,"-reuseElastic") == 0) {
+	    reuseElastic = true;
 	}
     }
 
@@ -178,7 +190,8 @@ void* OPS_ForceBeamColumn3d()
     }
 
     Element *theEle =  new ForceBeamColumn3d(iData[0],iData[1],iData[2],secTags.Size(),sections,
-					     *bi,*theTransf,mass,maxIter,tol);
+					     *bi,*theTransf,mass,maxIter,tol,
+					     warmStart,sectionTol,reuseElastic);
     delete [] sections;
     return theEle;
 }
@@ -195,11 +208,16 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0), Ssr(0), vscommit(0), sp(0),
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0),
-  Ki(0), isTorsion(false), parameterID(0)
+  Ki(0), isTorsion(false), warmStart(false), sectionTol(0.0), reuseElastic(false),
+  lastScheme(0), lastSubdivide(1), numSectionUpdates(0), validResponses(0),
+  parameterID(0)
 {
   theNodes[0] = 0;  
   theNodes[1] = 0;
 
+  for (int i = 0; i < maxNumResponses; i++)
+    theResponses[i] = 0;
+
   p0[0] = 0.0;
   p0[1] = 0.0;
   p0[2] = 0.0;
@@ -211,17 +229,6 @@ ForceBeamColumn3d::ForceBeamColumn3d():
   v0[2] = 0.0;
   v0[3] = 0.0;
   v0[4] = 0.0;
-
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0) 
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // constructor which takes the unique element tag, sections,
@@ -231,7 +238,8 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
 				      int numSec, SectionForceDeformation **sec,
 				      BeamIntegration &bi,
 				      CrdTransf &coordTransf, double massDensPerUnitLength,
-				      int maxNumIters, double tolerance):
+				      int maxNumIters, double tolerance,
+				      bool ws, double secTol, bool reuse):
   Element(tag,ELE_TAG_ForceBeamColumn3d), connectedExternalNodes(2),
   beamIntegr(0), numSections(0), sections(0), crdTransf(0),
   rho(massDensPerUnitLength),maxIters(maxNumIters), tol(tolerance), 
@@ -240,11 +248,16 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
   kvcommit(NEBD,NEBD), Secommit(NEBD),
   fs(0), vs(0),Ssr(0), vscommit(0), sp(0), 
   numEleLoads(0), sizeEleLoads(0), eleLoads(0), eleLoadFactors(0), 
-  Ki(0), isTorsion(false), parameterID(0)
+  Ki(0), isTorsion(false), warmStart(ws), sectionTol(secTol), reuseElastic(reuse),
+  lastScheme(0), lastSubdivide(1), numSectionUpdates(0), validResponses(0),
+  parameterID(0)
 {
   theNodes[0] = 0;
   theNodes[1] = 0;
 
+  for (int i = 0; i < maxNumResponses; i++)
+    theResponses[i] = 0;
+
   connectedExternalNodes(0) = nodeI;
   connectedExternalNodes(1) = nodeJ;    
 
@@ -275,17 +288,6 @@ ForceBeamColumn3d::ForceBeamColumn3d (int tag, int nodeI, int nodeJ,
   v0[2] = 0.0;
   v0[3] = 0.0;
   v0[4] = 0.0;
-
-  if (vsSubdivide == 0)
-    vsSubdivide  = new Vector [maxNumSections];
-  if (fsSubdivide == 0)
-    fsSubdivide  = new Matrix [maxNumSections];
-  if (SsrSubdivide == 0)
-    SsrSubdivide  = new Vector [maxNumSections];
-  if (!vsSubdivide || !fsSubdivide || !SsrSubdivide) {
-    opserr << "ForceBeamColumn3d::ForceBeamColumn3d() -- failed to allocate Subdivide arrays";   
-    exit(-1);
-  }
 }
 
 // ~ForceBeamColumn3d():
@@ -323,6 +325,10 @@ ForceBeamColumn3d::~ForceBeamColumn3d()
 
   if (Ki != 0)
     delete Ki;
+
+  for (int i = 0; i < maxNumResponses; i++)
+    if (theResponses[i] != 0)
+      delete theResponses[i];
 }
 
 int
@@ -352,6 +358,8 @@ ForceBeamColumn3d::getNumDOF(void)
 void
 ForceBeamColumn3d::setDomain(Domain *theDomain)
 {
+  validResponses = 0;
+
   // check Domain is not null - invoked when object removed from a domain
   if (theDomain == 0) {
     theNodes[0] = 0;
@@ -406,6 +414,9 @@ ForceBeamColumn3d::setDomain(Domain *theDomain)
     exit(0);
   }
 
+  // form the section locations and weights for the element length
+  beamIntegr->getSectionTable(numSections, L);
+
   if (initialFlag == 0) 
     this->initializeSectionHistoryVariables();
 }
@@ -446,6 +457,8 @@ ForceBeamColumn3d::commitState()
 
 int ForceBeamColumn3d::revertToLastCommit()
 {
+  validResponses = 0;
+
   int err;
   int i = 0;
   
@@ -480,6 +493,8 @@ int ForceBeamColumn3d::revertToLastCommit()
 
 int ForceBeamColumn3d::revertToStart()
 {
+  validResponses = 0;
+
   // revert the sections state to start
   int err;
   int i = 0;
@@ -506,6 +521,9 @@ int ForceBeamColumn3d::revertToStart()
   Se.Zero();
   kv.Zero();
   
+  lastScheme = 0;
+  lastSubdivide = 1;
+
   initialFlag = 0;
   // this->update();
   return err;
@@ -693,6 +711,9 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
   int
   ForceBeamColumn3d::update()
   {
+    validResponses = 0;
+
+    double *workArea = Workspace::getDoubles(&workKey, 200);
     // if have completed a recvSelf() - do a revertToLastCommit
     // to get Ssr, etc. set correctly
     if (initialFlag == 2)
@@ -704,28 +725,30 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
     // get basic displacements and increments
     const Vector &v = crdTransf->getBasicTrialDisp();    
 
-    static Vector dv(NEBD);
+    double dvData[NEBD];
+    Vector dv(dvData, NEBD);
     dv = crdTransf->getBasicIncrDeltaDisp();    
 
     if (initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp == 0)
       return 0;
 
-    static Vector vin(NEBD);
+    double vinData[NEBD];
+    Vector vin(vinData, NEBD);
     vin = v;
     vin -= dv;
     double L = crdTransf->getInitialLength();
     double oneOverL  = 1.0/L;  
 
-    double xi[maxNumSections];
-    beamIntegr->getSectionLocations(numSections, L, xi);
+    const double *xi = beamIntegr->getSectionTable(numSections, L);
+    const double *wt = xi + numSections;
 
-    double wt[maxNumSections];
-    beamIntegr->getSectionWeights(numSections, L, wt);
+    double vrData[NEBD];
+    Vector vr(vrData, NEBD);       // element residual displacements
+    double fData[NEBD*NEBD];
+    Matrix f(fData, NEBD,NEBD);   // element flexibility matrix
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
-
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    double IData[NEBD*NEBD];
+    Matrix I(IData, NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW;                    // section strain energy (work) norm 
     int i, j;
 
@@ -735,11 +758,36 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static Vector SeTrial(NEBD);
-    static Matrix kvTrial(NEBD, NEBD);
+    double dSeData[NEBD];
+    Vector dSe(dSeData, NEBD);
+    double dvToDoData[NEBD];
+    Vector dvToDo(dvToDoData, NEBD);
+    double dvTrialData[NEBD];
+    Vector dvTrial(dvTrialData, NEBD);
+    double SeTrialData[NEBD];
+    Vector SeTrial(SeTrialData, NEBD);
+    double kvTrialData[NEBD*NEBD];
+    Matrix kvTrial(kvTrialData, NEBD, NEBD);
+
+    // section deformations, stress resultants and flexibilities of the
+    // current trial, kept in the workspace of the calling thread
+    Vector vsSubdivide[maxNumSections];
+    Vector SsrSubdivide[maxNumSections];
+    Matrix fsSubdivide[maxNumSections];
+
+    int sizeSubdivide = 0;
+    for (i=0; i<numSections; i++) {
+      int order = sections[i]->getOrder();
+      sizeSubdivide += order*(order+2);
+    }
+    double *subdivideData = Workspace::getDoubles(&subdivideKey, sizeSubdivide);
+    for (i=0; i<numSections; i++) {
+      int order = sections[i]->getOrder();
+      vsSubdivide[i].setData(subdivideData, order);
+      SsrSubdivide[i].setData(&subdivideData[order], order);
+      fsSubdivide[i].setData(&subdivideData[2*order], order, order);
+      subdivideData += order*(order+2);
+    }
 
     dvToDo = dv;
     dvTrial = dvToDo;
@@ -749,6 +797,18 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 
     maxSubdivisions = 10;
 
+    // with -warmStart begin with the scheme and subdivision of dv with which
+    // the last update converged rather than regular newton on all of dv
+    int firstScheme = 0;
+    bool warmStarted = false;
+    bool schemeRecorded = false;
+    if (warmStart == true && initialFlag == 1 && (lastScheme > 0 || lastSubdivide > 1)) {
+      firstScheme = lastScheme;
+      for ( ; numSubdivide < lastSubdivide; numSubdivide++)
+	dvTrial /= factor;
+      warmStarted = true;
+    }
+
     // fmk - modification to get compatable ele forces and deformations 
     //   for a change in deformation dV we try first a newton iteration, if
     //   that fails we try an initial flexibility iteration on first iteration 
@@ -765,7 +825,7 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
       // initial tangent iterations (if l==1), or
       // initial tangent on first iteration then regular newton (if l==2)
 
-      for (int l=0; l<3; l++) {
+      for (int l=firstScheme; l<3; l++) {
 
 	//      if (l == 1) l = 2;
 	SeTrial = Se;
@@ -814,15 +874,10 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	      int order      = sections[i]->getOrder();
 	      const ID &code = sections[i]->getType();
 
-	      static Vector Ss;
-	      static Vector dSs;
-	      static Vector dvs;
-	      static Matrix fb;
-
-	      Ss.setData(workArea, order);
-	      dSs.setData(&workArea[order], order);
-	      dvs.setData(&workArea[2*order], order);
-	      fb.setData(&workArea[3*order], order, NEBD);
+	      Vector Ss(workArea, order);
+	      Vector dSs(&workArea[order], order);
+	      Vector dvs(&workArea[2*order], order);
+	      Matrix fb(&workArea[3*order], order, NEBD);
 
 	      double xL  = xi[i];
 	      double xL1 = xL-1.0;
@@ -919,21 +974,33 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 		dvs.addMatrixVector(0.0, fs0, dSs, 1.0);
 	      }
 
-	      // set section deformations
-	      if (initialFlag != 0)
-		vsSubdivide[i] += dvs;
-
-	      if ( sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
-		opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
-		return -1;
-	      }
+	      // with -sectionTol a section whose unbalance work is below the
+	      // tolerance keeps its state, the residual deformations fs*dSs are
+	      // still integrated below
+	      bool updateSection = true;
+	      if (sectionTol > 0.0 && initialFlag != 0 && fabs(dvs ^ dSs) < sectionTol)
+		updateSection = false;
+
+	      if (updateSection == true) {
+		// set section deformations
+		if (initialFlag != 0)
+		  vsSubdivide[i] += dvs;
+
+		if ( sections[i]->setTrialSectionDeformation(vsSubdivide[i]) < 0) {
+		  opserr << "ForceBeamColumn3d::update() - section failed in setTrial\n";
+		  return -1;
+		}
+		numSectionUpdates++;
 
-	      // get section resisting forces
-	      SsrSubdivide[i] = sections[i]->getStressResultant();
+		// get section resisting forces
+		SsrSubdivide[i] = sections[i]->getStressResultant();
 
-	      // get section flexibility matrix
-	      // FRANK 
-	      fsSubdivide[i] = sections[i]->getSectionFlexibility();
+		// get section flexibility matrix
+		// FRANK 
+		// with -reuseElastic that of a linear section is kept once formed
+		if (reuseElastic == false || initialFlag == 0 || sections[i]->isLinear() == false)
+		  fsSubdivide[i] = sections[i]->getSectionFlexibility();
+	      }
 
 	      /*
 	      const Matrix &sectionStiff = sections[i]->getSectionTangent();
@@ -1110,6 +1177,19 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	    // check for convergence of this interval
 	    if (fabs(dW) < tol) { 
 
+	      // remember where the first interval converged for a warm start,
+	      // if that is where this update began try one level easier next time
+	      if (schemeRecorded == false) {
+		if (warmStarted == true && l == lastScheme && numSubdivide == lastSubdivide) {
+		  lastScheme = 0;
+		  lastSubdivide = (numSubdivide > 1) ? numSubdivide-1 : 1;
+		} else {
+		  lastScheme = l;
+		  lastSubdivide = numSubdivide;
+		}
+		schemeRecorded = true;
+	      }
+
 	      // set the target displacement
 	      dvToDo -= dvTrial;
 	      vin += dvTrial;
@@ -1152,6 +1232,9 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 	  } // for (j=0; j<numIters; j++)
 	} // if (initialFlag != 2)
       } // for (int l=0; l<2; l++)
+
+      // later subdivisions try all the schemes
+      firstScheme = 0;
     } // while (converged == false)
 
     // if fail to converge we return an error flag & print an error message
@@ -1245,6 +1328,7 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
   const Matrix &
   ForceBeamColumn3d::getMass(void)
   { 
+    Matrix &theMatrix = Workspace::getMatrix(&matrixKey, 12, 12);
     theMatrix.Zero();
 
     double L = crdTransf->getInitialLength();
@@ -1258,6 +1342,8 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
   void 
   ForceBeamColumn3d::zeroLoad(void)
   {
+    validResponses = 0;
+
     if (sp != 0)
       sp->Zero();
 
@@ -1388,6 +1474,8 @@ ForceBeamColumn3d::computeReactionSensitivity(double *dp0dh, int gradNumber)
 int
 ForceBeamColumn3d::addLoad(ElementalLoad *theLoad, double loadFactor)
 {
+  validResponses = 0;
+
   if (numEleLoads == sizeEleLoads) {
 
     //
@@ -1680,6 +1768,7 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
   const Vector &
   ForceBeamColumn3d::getResistingForceIncInertia()
   {	
+    Vector &theVector = Workspace::getVector(&vectorKey, 12);
     // Compute the current resisting force
     theVector = this->getResistingForce();
 
@@ -1808,12 +1897,15 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
        secDefSize   += size;
     }
 
-    Vector dData(1+1+NEBD+NEBD*NEBD+secDefSize + 4); 
+    Vector dData(1+1+3+NEBD+NEBD*NEBD+secDefSize + 4); 
     loc = 0;
 
     // place double variables into Vector
     dData(loc++) = rho;
     dData(loc++) = tol;
+    dData(loc++) = warmStart ? 1.0 : 0.0;
+    dData(loc++) = sectionTol;
+    dData(loc++) = reuseElastic ? 1.0 : 0.0;
 
     // put  distrLoadCommit into the Vector
     //  for (i=0; i<NL; i++) 
@@ -1850,6 +1942,8 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
   int
   ForceBeamColumn3d::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
   {
+    validResponses = 0;
+
     //
     // receive the integer data containing tag, numSections and coord transformation info
     //
@@ -1914,7 +2008,10 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
 
     beamIntegr->setDbTag(beamIntegrDbTag);
 
-    // invoke recvSelf on the beamIntegr object
+    // the section table is formed again from the received data
+  beamIntegr->clearSectionTable();
+
+  // invoke recvSelf on the beamIntegr object
     if (beamIntegr->recvSelf(commitTag, theChannel, theBroker) < 0)  
     {
        opserr << "ForceBeamColumn3d::sendSelf() - failed to recv beam integration\n";
@@ -2072,7 +2169,7 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
        secDefSize   += size;
     }
 
-    Vector dData(1+1+NEBD+NEBD*NEBD+secDefSize+4);   
+    Vector dData(1+1+3+NEBD+NEBD*NEBD+secDefSize+4);   
 
     if (theChannel.recvVector(dbTag, commitTag, dData) < 0)  {
       opserr << "ForceBeamColumn3d::recvSelf() - failed to send Vector data\n";
@@ -2084,6 +2181,9 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
     // place double variables into Vector
     rho = dData(loc++);
     tol = dData(loc++);
+    warmStart = (dData(loc++) != 0.0);
+    sectionTol = dData(loc++);
+    reuseElastic = (dData(loc++) != 0.0);
 
     // put  distrLoadCommit into the Vector
     //for (i=0; i<NL; i++) 
@@ -2123,6 +2223,7 @@ ForceBeamColumn3d::computeSectionForceSensitivity(Vector &dspdh, int isec,
   int
   ForceBeamColumn3d::getInitialFlexibility(Matrix &fe)
   {
+    double *workArea = Workspace::getDoubles(&workKey, 200);
     fe.Zero();
 
     double L = crdTransf->getInitialLength();
@@ -2347,6 +2448,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
   void
   ForceBeamColumn3d::Print(OPS_Stream &s, int flag)
   {
+    Vector &theVector = Workspace::getVector(&vectorKey, 12);
     // flags with negative values are used by GSA
     if (flag == -1) { 
       int eleTag = this->getTag();
@@ -2550,6 +2652,7 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
   Response*
   ForceBeamColumn3d::setResponse(const char **argv, int argc, OPS_Stream &output)
   {
+    Vector &theVector = Workspace::getVector(&vectorKey, 12);
     Response *theResponse = 0;
     
     output.tag("ElementOutput");
@@ -2633,6 +2736,10 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
     } else if (strcmp(argv[0],"tangentDrift") == 0) {
       theResponse = new ElementResponse(this, 6, Vector(4));
   
+      // number of section state determinations
+    } else if (strcmp(argv[0],"sectionUpdates") == 0) {
+      theResponse = new ElementResponse(this, 20, 0.0);
+
     } else if (strcmp(argv[0],"getRemCriteria1") == 0) {
       theResponse = new ElementResponse(this, 7, Vector(2));
 
@@ -2702,84 +2809,74 @@ ForceBeamColumn3d::getInitialDeformations(Vector &v0)
     return theResponse;
 }
 
-int 
-ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
+int
+ForceBeamColumn3d::formResponse(int responseID, Vector &theResponse)
 {
-  static Vector vp(6);
-  static Matrix fe(6,6);
-
-  if (responseID == 1)
-    return eleInfo.setVector(this->getResistingForce());
-  
-  else if (responseID == 2) {
+  if (responseID == 2) {
     // Axial
     double N = Se(0);
-    theVector(6) =  N;
-    theVector(0) = -N+p0[0];
+    theResponse(6) =  N;
+    theResponse(0) = -N+p0[0];
     
     // Torsion
     double T = Se(5);
-    theVector(9) =  T;
-    theVector(3) = -T;
+    theResponse(9) =  T;
+    theResponse(3) = -T;
     
     // Moments about z and shears along y
     double M1 = Se(1);
     double M2 = Se(2);
-    theVector(5)  = M1;
-    theVector(11) = M2;
+    theResponse(5)  = M1;
+    theResponse(11) = M2;
     double L = crdTransf->getInitialLength();
     double V = (M1+M2)/L;
-    theVector(1) =  V+p0[1];
-    theVector(7) = -V+p0[2];
+    theResponse(1) =  V+p0[1];
+    theResponse(7) = -V+p0[2];
     
     // Moments about y and shears along z
     M1 = Se(3);
     M2 = Se(4);
-    theVector(4)  = M1;
-    theVector(10) = M2;
+    theResponse(4)  = M1;
+    theResponse(10) = M2;
     V = (M1+M2)/L;
-    theVector(2) = -V+p0[3];
-    theVector(8) =  V+p0[4];
+    theResponse(2) = -V+p0[3];
+    theResponse(8) =  V+p0[4];
       
-    return eleInfo.setVector(theVector);
-
+    return 0;
   }
       
   // Chord rotation
   else if (responseID == 3) {
-    vp = crdTransf->getBasicTrialDisp();
-    return eleInfo.setVector(vp);
+    theResponse = crdTransf->getBasicTrialDisp();
+    return 0;
   }
 
   // Plastic rotation
   else if (responseID == 4) {
+    static Matrix fe(6,6);
+    static Vector v0(6);
     this->getInitialFlexibility(fe);
-    vp = crdTransf->getBasicTrialDisp();
-    vp.addMatrixVector(1.0, fe, Se, -1.0);
-    Vector v0(6);
+    theResponse = crdTransf->getBasicTrialDisp();
+    theResponse.addMatrixVector(1.0, fe, Se, -1.0);
     this->getInitialDeformations(v0);
-    vp.addVector(1.0, v0, -1.0);
-    return eleInfo.setVector(vp);
+    theResponse.addVector(1.0, v0, -1.0);
+    return 0;
   }
 
-  else if (responseID == 12)
-    return eleInfo.setVector(this->getRayleighDampingForces());
-
   // Point of inflection
   else if (responseID == 5) {
-    static Vector LI(2);
-    LI(0) = 0.0;
-    LI(1) = 0.0;
+    theResponse(0) = 0.0;
+    theResponse(1) = 0.0;
 
     double L = crdTransf->getInitialLength();
 
     if (fabs(Se(1)+Se(2)) > DBL_EPSILON)
-      LI(0) = Se(1)/(Se(1)+Se(2))*L;
+      theResponse(0) = Se(1)/(Se(1)+Se(2))*L;
 
     if (fabs(Se(3)+Se(4)) > DBL_EPSILON)
-      LI(1) = Se(3)/(Se(3)+Se(4))*L;
+      theResponse(1) = Se(3)/(Se(3)+Se(4))*L;
 
-    return eleInfo.setVector(LI);
+    return 0;
   }
 
   // Tangent drift
@@ -2857,15 +2954,42 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     d3z += beamIntegr->getTangentDriftJ(L, LIz, Se(1), Se(2));
     d3y += beamIntegr->getTangentDriftJ(L, LIy, Se(3), Se(4), true);
 
-    static Vector d(4);
-    d(0) = d2z;
-    d(1) = d3z;
-    d(2) = d2y;
-    d(3) = d3y;
+    theResponse(0) = d2z;
+    theResponse(1) = d3z;
+    theResponse(2) = d2y;
+    theResponse(3) = d3y;
 
-    return eleInfo.setVector(d);
+    return 0;
+  }
+
+  return -1;
+}
+
+int 
+ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
+{
+  if (responseID == 1)
+    return eleInfo.setVector(this->getResistingForce());
+  
+  // responses formed from the element state are kept until the
+  // state changes, so that several recorders on the element share them
+  else if (responseID >= 2 && responseID <= 6) {
+    if ((validResponses & (1 << responseID)) == 0) {
+      if (theResponses[responseID] == 0) {
+	static const int sizes[7] = {0, 0, 12, 6, 6, 2, 4};
+	theResponses[responseID] = new Vector(sizes[responseID]);
+      }
+      if (this->formResponse(responseID, *theResponses[responseID]) < 0)
+	return -1;
+      validResponses |= (1 << responseID);
+    }
+    return eleInfo.setVector(*theResponses[responseID]);
+  }
 
-  } else if (responseID == 7) {
+  else if (responseID == 12)
+    return eleInfo.setVector(this->getRayleighDampingForces());
+
+  else if (responseID == 7) {
     return -1;
   } else if (responseID == 8) {
 
@@ -2981,6 +3105,9 @@ ForceBeamColumn3d::getResponse(int responseID, Information &eleInfo)
     return -1;
   }
 
+  else if (responseID == 20)
+    return eleInfo.setDouble(numSectionUpdates);
+
   else
     return -1;
 }
@@ -3267,6 +3394,7 @@ ForceBeamColumn3d::activateParameter(int passedParameterID)
 const Matrix&
 ForceBeamColumn3d::getKiSensitivity(int gradNumber)
 {
+  Matrix &theMatrix = Workspace::getMatrix(&matrixKey, 12, 12);
   theMatrix.Zero();
   return theMatrix;
 }
@@ -3274,6 +3402,7 @@ ForceBeamColumn3d::getKiSensitivity(int gradNumber)
 const Matrix&
 ForceBeamColumn3d::getMassSensitivity(int gradNumber)
 {
+  Matrix &theMatrix = Workspace::getMatrix(&matrixKey, 12, 12);
     theMatrix.Zero();
 
     double L = crdTransf->getInitialLength();
@@ -3317,6 +3446,7 @@ ForceBeamColumn3d::getResistingForceSensitivity(int gradNumber)
 int
 ForceBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   int err = 0;
 
   double L = crdTransf->getInitialLength();
@@ -3428,6 +3558,7 @@ ForceBeamColumn3d::commitSensitivity(int gradNumber, int numGrads)
 const Vector &
 ForceBeamColumn3d::computedqdh(int gradNumber)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   //opserr << "FBC3d::computedqdh " << gradNumber << endln;
 
   double L = crdTransf->getInitialLength();
@@ -3599,6 +3730,7 @@ ForceBeamColumn3d::computedqdh(int gradNumber)
 const Matrix&
 ForceBeamColumn3d::computedfedh(int gradNumber)
 {
+  double *workArea = Workspace::getDoubles(&workKey, 200);
   static Matrix dfedh(6,6);
 
   dfedh.Zero();
@@ -81,7 +81,9 @@ class ForceBeamColumn3d: public Element
 		    int numSections, SectionForceDeformation **sec,
 		    BeamIntegration &beamIntegr,
 		    CrdTransf &coordTransf, double rho = 0.0, 
-		    int maxNumIters = 10, double tolerance = 1.0e-12);
+		    int maxNumIters = 10, double tolerance = 1.0e-12,
+		    bool warmStart = false, double sectionTol = 0.0,
+		    bool reuseElastic = false);
   
   ~ForceBeamColumn3d();
   const char *getClassType(void) const {return "ForceBeamColumn3d";};
@@ -195,18 +197,25 @@ class ForceBeamColumn3d: public Element
 
   bool isTorsion;
   
-  static Matrix theMatrix;
-  static Vector theVector;
-  static double workArea[];
-  
   enum {maxNumSections = 10};
   
   // following are added for subdivision of displacement increment
   int    maxSubdivisions;       // maximum number of subdivisons of dv for local iterations
-  
-  static Vector *vsSubdivide;
-  static Vector *SsrSubdivide;
-  static Matrix *fsSubdivide;
+
+  // options of the element state determination
+  bool   warmStart;             // begin with the scheme and subdivision that converged last
+  double sectionTol;            // unbalance work below which a section keeps its state
+  bool   reuseElastic;          // keep the flexibility of linear sections
+  int    lastScheme;            // the scheme and number of subdivisions of dv with
+  int    lastSubdivide;         //   which the last update converged
+  int    numSectionUpdates;     // number of section state determinations
+
+  // element responses of getResponse() formed from the current state
+  enum {maxNumResponses = 7};
+  Vector *theResponses[maxNumResponses];
+  int    validResponses;        // bit i set while theResponses[i] is current
+  int    formResponse(int responseID, Vector &theResponse);
+
   //static int maxNumSections;
 
   // AddingSensitivity:BEGIN //////////////////////////////////////////
@@ -188,6 +188,8 @@ int
 HingeEndpointBeamIntegration::updateParameter(int parameterID,
 					      Information &info)
 {
+  this->clearSectionTable();
+
   switch (parameterID) {
   case 1:
     lpI = info.theDouble;
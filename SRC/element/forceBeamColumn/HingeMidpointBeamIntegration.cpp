@@ -187,6 +187,8 @@ int
 HingeMidpointBeamIntegration::updateParameter(int parameterID,
 					      Information &info)
 {
+  this->clearSectionTable();
+
   switch (parameterID) {
   case 1:
     lpI = info.theDouble;
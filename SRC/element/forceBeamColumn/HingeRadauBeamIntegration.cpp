@@ -193,6 +193,8 @@ int
 HingeRadauBeamIntegration::updateParameter(int parameterID,
 					   Information &info)
 {
+  this->clearSectionTable();
+
   switch (parameterID) {
   case 1:
     lpI = info.theDouble;
@@ -193,6 +193,8 @@ int
 HingeRadauTwoBeamIntegration::updateParameter(int parameterID,
 					      Information &info)
 {
+  this->clearSectionTable();
+
   switch (parameterID) {
   case 1:
     lpI = info.theDouble;
@@ -268,6 +268,8 @@ int
 LowOrderBeamIntegration::updateParameter(int parameterID,
 					 Information &info)
 {
+  this->clearSectionTable();
+
   if (parameterID <= 10) { // xf
     pts(Nc+(parameterID-1)) = info.theDouble;
     computed = false;
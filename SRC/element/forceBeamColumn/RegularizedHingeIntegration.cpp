@@ -174,6 +174,8 @@ int
 RegularizedHingeIntegration::updateParameter(int parameterID,
 					     Information &info)
 {
+  this->clearSectionTable();
+
   switch (parameterID) {
   case 1:
     lpI = info.theDouble;
@@ -265,6 +265,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
       
     int numIter = 10;
     double tol = 1.0e-12;
+    bool warmStart = false, reuseElastic = false;
+    double sectionTol = 0.0;
     double mass = 0.0;
     int cMass = 0;
     BeamIntegration *beamIntegr = 0;
@@ -299,6 +301,24 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 	  return TCL_ERROR;
 	}
 	argi += 2;
+      } else if (strcmp(argv[argi],"-warmStart") == 0) {
+	warmStart = true;
+	argi++;
+      } else if (strcmp(argv[argi],"-sectionTol") == 0) {
+	if (argc < argi+2) {
+	  opserr << "WARNING not enough -sectionTol args need -sectionTol tol?\n";
+	  opserr << argv[1] << " element: " << eleTag << endln;
+	  return TCL_ERROR;
+	}
+	if (Tcl_GetDouble(interp, argv[argi+1], &sectionTol) != TCL_OK) {
+	  opserr << "WARNING invalid sectionTol\n";
+	  opserr << argv[1] << " element: " << eleTag << endln;
+	  return TCL_ERROR;
+	}
+	argi += 2;
+      } else if (strcmp(argv[argi],"-reuseElastic") == 0) {
+	reuseElastic = true;
+	argi++;
       } else if ((strcmp(argv[argi],"-lMass") == 0) || (strcmp(argv[argi],"lMass") == 0)) {
           cMass = 0;
           argi++;
@@ -389,7 +409,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
       else if (strcmp(argv[1],"dispBeamColumnWithSensitivity") == 0)
 	theElement = new DispBeamColumn2dWithSensitivity(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass);
       else
-	theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass, numIter, tol);
+	theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf2d, mass, numIter, tol,
+					 warmStart, sectionTol, reuseElastic);
     }
     else {
       if (strcmp(argv[1],"elasticForceBeamColumn") == 0)
@@ -399,7 +420,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 	  else if (strcmp(argv[1],"dispBeamColumnWithSensitivity") == 0)
 	theElement = new DispBeamColumn3dWithSensitivity(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf3d, mass);
       else
-	theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf3d, mass, numIter, tol);
+	theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, nIP, sections, *beamIntegr, *theTransf3d, mass, numIter, tol,
+					 warmStart, sectionTol, reuseElastic);
     }
 
     delete beamIntegr;
@@ -1258,6 +1280,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
   int cMass = 0;
   int numIter = 10;
   double tol = 1.0e-12;
+  bool warmStart = false, reuseElastic = false;
+  double sectionTol = 0.0;
 
   while (argi < argc) {
     if (strcmp(argv[argi],"-iter") == 0) {
@@ -1289,6 +1313,22 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
 	return TCL_ERROR;
       }
       argi += 2;
+    } else if (strcmp(argv[argi],"-warmStart") == 0) {
+      warmStart = true;
+    } else if (strcmp(argv[argi],"-sectionTol") == 0) {
+      if (argc < argi+2) {
+	opserr << "WARNING not enough -sectionTol args need -sectionTol tol?\n";
+	opserr << argv[1] << " element: " << eleTag << endln;
+	return TCL_ERROR;
+      }
+      if (Tcl_GetDouble(interp, argv[argi+1], &sectionTol) != TCL_OK) {
+	opserr << "WARNING invalid sectionTol\n";
+	opserr << argv[1] << " element: " << eleTag << endln;
+	return TCL_ERROR;
+      }
+      argi++;
+    } else if (strcmp(argv[argi],"-reuseElastic") == 0) {
+      reuseElastic = true;
     } else if ((strcmp(argv[argi],"-lMass") == 0 || strcmp(argv[argi],"lMass") == 0)) {
       cMass = 0;
       argi++;
@@ -1321,7 +1361,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
     else if (strcmp(argv[1],"elasticForceBeamColumnWarping") == 0)
       theElement = new ElasticForceBeamColumnWarping2d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf2d);
     else 
-      theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf2d, mass, numIter, tol);
+      theElement = new ForceBeamColumn2d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf2d, mass, numIter, tol,
+					 warmStart, sectionTol, reuseElastic);
   }
   else {
     if (strcmp(argv[1],"elasticForceBeamColumn") == 0)
@@ -1329,7 +1370,8 @@ TclModelBuilder_addForceBeamColumn(ClientData clientData, Tcl_Interp *interp,
     else if (strcmp(argv[1],"dispBeamColumn") == 0)
       theElement = new DispBeamColumn3d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf3d, mass, cMass);
     else
-      theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf3d, mass, numIter, tol);
+      theElement = new ForceBeamColumn3d(eleTag, iNode, jNode, numSections, sections, *beamIntegr, *theTransf3d, mass, numIter, tol,
+					 warmStart, sectionTol, reuseElastic);
   }
 
   if (beamIntegr != 0)
@@ -153,6 +153,8 @@ UserDefinedBeamIntegration::setParameter(const char **argv, int argc, Parameter
 int
 UserDefinedBeamIntegration::updateParameter(int parameterID, Information &info)
 {
+  this->clearSectionTable();
+
   if (parameterID <= 10) { // pt
     pts(parameterID-1) = info.theDouble;
     return 0;
@@ -44,6 +44,7 @@
 #include <ElementResponse.h>
 #include <ElementalLoad.h>
 #include <elementAPI.h>
+#include <GeometryCache.h>
 
 void* OPS_FourNodeQuad()
 {
@@ -123,7 +124,8 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 			   double p, double r, double b1, double b2)
 :Element (tag, ELE_TAG_FourNodeQuad), 
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0)
+ Q(8), pressureLoad(8), thickness(t), applyLoad(0), pressure(p), rho(r), Ki(0),
+ cacheGeometry(GeometryCache::isActive()), geometry(0)
 {
 	pts[0][0] = -0.5773502691896258;
 	pts[0][1] = -0.5773502691896258;
@@ -183,7 +185,8 @@ FourNodeQuad::FourNodeQuad(int tag, int nd1, int nd2, int nd3, int nd4,
 FourNodeQuad::FourNodeQuad()
 :Element (0,ELE_TAG_FourNodeQuad),
   theMaterial(0), connectedExternalNodes(4), 
- Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0)
+ Q(8), pressureLoad(8), thickness(0.0), applyLoad(0), pressure(0.0), Ki(0),
+ cacheGeometry(GeometryCache::isActive()), geometry(0)
 {
   pts[0][0] = -0.577350269189626;
   pts[0][1] = -0.577350269189626;
@@ -216,6 +219,9 @@ FourNodeQuad::~FourNodeQuad()
 
   if (Ki != 0)
     delete Ki;
+
+  if (geometry != 0)
+    GeometryCache::deallocate(geometry, 4*13*sizeof(double));
 }
 
 int
@@ -246,6 +252,12 @@ FourNodeQuad::getNumDOF()
 void
 FourNodeQuad::setDomain(Domain *theDomain)
 {
+    // the cached geometry is formed again from the new nodes
+    if (geometry != 0) {
+	GeometryCache::deallocate(geometry, 4*13*sizeof(double));
+	geometry = 0;
+    }
+
 	// Check Domain is not null - invoked when object removed from a domain
     if (theDomain == 0) {
 	theNodes[0] = 0;
@@ -358,7 +370,7 @@ FourNodeQuad::update()
 	for (int i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		this->shapeFunction(pts[i][0], pts[i][1]);
+		this->shapeFunction(i);
 
 		// Interpolate strains
 		//eps = B*u;
@@ -391,7 +403,7 @@ FourNodeQuad::getTangentStiff()
 	for (int i = 0; i < 4; i++) {
 
 	  // Determine Jacobian for this integration point
-	  dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+	  dvol = this->shapeFunction(i);
 	  dvol *= (thickness*wts[i]);
 	  
 	  // Get the material tangent
@@ -452,7 +464,7 @@ FourNodeQuad::getInitialStiff()
   for (int i = 0; i < 4; i++) {
     
     // Determine Jacobian for this integration point
-    dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+    dvol = this->shapeFunction(i);
     dvol *= (thickness*wts[i]);
     
     // Get the material tangent
@@ -515,7 +527,7 @@ FourNodeQuad::getMass()
 	for (i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		rhodvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		rhodvol = this->shapeFunction(i);
 
 		// Element plus material density ... MAY WANT TO REMOVE ELEMENT DENSITY
 		rhodvol *= (rhoi[i]*thickness*wts[i]);
@@ -623,7 +635,7 @@ FourNodeQuad::getResistingForce()
 	for (int i = 0; i < 4; i++) {
 
 		// Determine Jacobian for this integration point
-		dvol = this->shapeFunction(pts[i][0], pts[i][1]);
+		dvol = this->shapeFunction(i);
 		dvol *= (thickness*wts[i]);
 
 		// Get material stress response
@@ -1231,6 +1243,124 @@ FourNodeQuad::updateParameter(int parameterID, Information &info)
   }
 }
 
+// AddingSensitivity:BEGIN ///////////////////////////////////
+// The sensitivities take the shape functions of the integration points
+// from the same geometry cache as the response, and the conditional
+// stress sensitivities from the materials; the body forces, pressure and
+// nodal loads do not depend on the material parameters.
+const Vector &
+FourNodeQuad::getResistingForceSensitivity(int gradNumber)
+{
+	P.Zero();
+
+	double dvol;
+
+	// Loop over the integration points
+	for (int i = 0; i < 4; i++) {
+
+		// Determine Jacobian for this integration point
+		dvol = this->shapeFunction(i);
+		dvol *= (thickness*wts[i]);
+
+		// Get material stress sensitivity
+		const Vector &dsigdh = theMaterial[i]->getStressSensitivity(gradNumber, true);
+
+		for (int alpha = 0, ia = 0; alpha < 4; alpha++, ia += 2) {
+			P(ia) += dvol*(shp[0][alpha]*dsigdh(0) + shp[1][alpha]*dsigdh(2));
+			P(ia+1) += dvol*(shp[1][alpha]*dsigdh(1) + shp[0][alpha]*dsigdh(2));
+		}
+	}
+
+	return P;
+}
+
+const Matrix &
+FourNodeQuad::getMassSensitivity(int gradNumber)
+{
+	K.Zero();
+
+	// the element density is not a parameter
+	if (rho != 0.0)
+	  return K;
+
+	double rhodvol, Nrho;
+
+	// Lumped mass matrix, as in getMass()
+	for (int i = 0; i < 4; i++) {
+
+		double drhodh = theMaterial[i]->getRhoSensitivity(gradNumber);
+		if (drhodh == 0.0)
+		  continue;
+
+		rhodvol = this->shapeFunction(i);
+		rhodvol *= (drhodh*thickness*wts[i]);
+
+		for (int alpha = 0, ia = 0; alpha < 4; alpha++, ia++) {
+			Nrho = shp[2][alpha]*rhodvol;
+			K(ia,ia) += Nrho;
+			ia++;
+			K(ia,ia) += Nrho;
+		}
+	}
+
+	return K;
+}
+
+int
+FourNodeQuad::commitSensitivity(int gradNumber, int numGrads)
+{
+	double u[2][4];
+	for (int i = 0; i < 4; i++) {
+		u[0][i] = theNodes[i]->getDispSensitivity(1,gradNumber);
+		u[1][i] = theNodes[i]->getDispSensitivity(2,gradNumber);
+	}
+
+	static Vector deps(3);
+
+	int ret = 0;
+
+	// Loop over the integration points
+	for (int i = 0; i < 4; i++) {
+
+		// Determine Jacobian for this integration point
+		this->shapeFunction(i);
+
+		// Interpolate strain sensitivities
+		deps.Zero();
+		for (int beta = 0; beta < 4; beta++) {
+			deps(0) += shp[0][beta]*u[0][beta];
+			deps(1) += shp[1][beta]*u[1][beta];
+			deps(2) += shp[0][beta]*u[1][beta] + shp[1][beta]*u[0][beta];
+		}
+
+		ret += theMaterial[i]->commitSensitivity(deps, gradNumber, numGrads);
+	}
+
+	return ret;
+}
+// AddingSensitivity:END /////////////////////////////////////
+
+// the shape functions at integration point i, copied from the cache of
+// the element if it keeps the geometry: shp and the determinant of the
+// jacobian of each point
+double
+FourNodeQuad::shapeFunction(int i)
+{
+  if (geometry == 0 && cacheGeometry == true) {
+    geometry = (double *)GeometryCache::allocate(4*13*sizeof(double));
+    for (int j = 0; geometry != 0 && j < 4; j++) {
+      geometry[13*j+12] = this->shapeFunction(pts[j][0], pts[j][1]);
+      memcpy(&geometry[13*j], shp, 12*sizeof(double));
+    }
+  }
+
+  if (geometry == 0)
+    return this->shapeFunction(pts[i][0], pts[i][1]);
+
+  memcpy(shp, &geometry[13*i], 12*sizeof(double));
+  return geometry[13*i+12];
+}
+
 double FourNodeQuad::shapeFunction(double xi, double eta)
 {
 	const Vector &nd1Crds = theNodes[0]->getCrds();
@@ -98,6 +98,12 @@ class FourNodeQuad : public Element
     int setParameter(const char **argv, int argc, Parameter &param);
     int updateParameter(int parameterID, Information &info);
 
+    // AddingSensitivity:BEGIN //////////////////////////////////////////
+    const Vector & getResistingForceSensitivity(int gradNumber);
+    const Matrix & getMassSensitivity(int gradNumber);
+    int            commitSensitivity(int gradNumber, int numGrads);
+    // AddingSensitivity:END ///////////////////////////////////////////
+
     // RWB; PyLiq1 & TzLiq1 need to see the excess pore pressure and initial stresses.
     friend class PyLiq1;
     friend class TzLiq1;
@@ -134,9 +140,14 @@ class FourNodeQuad : public Element
 
     // private member functions - only objects of this class can call these
     double shapeFunction(double xi, double eta);
+    double shapeFunction(int i);
     void setPressureLoadAtNodes(void);
 
     Matrix *Ki;
+
+    // shp and the jacobian at the gauss points kept with the GeometryCache on
+    bool cacheGeometry;
+    double *geometry;
 };
 
 #endif
@@ -34,18 +34,26 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theFrictionModelObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theFrictionModelObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theFrictionModelObjects(void)
+{
+  if (theFrictionModelObjectsPtr == 0)
+    theFrictionModelObjectsPtr = new MapOfTaggedObjects();
+  return *theFrictionModelObjectsPtr;
+}
 
 
 bool OPS_addFrictionModel(FrictionModel *newComponent)
 {
-    return theFrictionModelObjects.addComponent(newComponent);
+    return theFrictionModelObjects().addComponent(newComponent);
 }
 
 
 FrictionModel *OPS_getFrictionModel(int tag)
 {
-    TaggedObject *theResult = theFrictionModelObjects.getComponentPtr(tag);
+    TaggedObject *theResult = theFrictionModelObjects().getComponentPtr(tag);
     if (theResult == 0) {
         opserr << "FrictionModel *getFrictionModel(int tag) - none found with tag: " << tag << endln;
         return 0;
@@ -58,7 +66,7 @@ FrictionModel *OPS_getFrictionModel(int tag)
 
 void OPS_clearAllFrictionModel()
 {
-    theFrictionModelObjects.clearAll();
+    theFrictionModelObjects().clearAll();
 }
 
 
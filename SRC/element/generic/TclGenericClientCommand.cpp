@@ -54,7 +54,8 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
     if ((argc-eleArgStart) < 8)  {
         opserr << "WARNING insufficient arguments\n";
         printCommand(argc, argv);
-        opserr << "Want: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -server ipPort <ipAddr> <-ssl> <-udp> <-dataSize size> <-noRayleigh>\n";
+        opserr << "Want: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -server ipPort <ipAddr> <-ssl> <-udp> <-mux streamID> <-dataSize size> <-noRayleigh>\n";
+        opserr << "  or: element genericClient eleTag -node Ndi Ndj ... -dof dofNdi -dof dofNdj ... -shm name <-dataSize size> <-noRayleigh>\n";
         return TCL_ERROR;
     }
     
@@ -65,7 +66,7 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
     int tag, node, dof, ipPort, argi, i, j;
     int numNodes = 0, numDOFj = 0, numDOF = 0;
     char *ipAddr = 0;
-    int ssl = 0, udp = 0;
+    int ssl = 0, udp = 0, shm = 0, mux = 0;
     int dataSize = 256;
     int doRayleigh = 1;
     
@@ -120,6 +121,7 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
         i = argi;
         while (strcmp(argv[i], "-dof") != 0 &&
             strcmp(argv[i], "-server") != 0 &&
+            strcmp(argv[i], "-shm") != 0 &&
             strcmp(argv[i], "-doRayleigh") != 0 &&
             strcmp(argv[i], "-noRayleigh") != 0 &&
             i < argc)  {
@@ -153,7 +155,8 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
             strcmp(argv[argi], "-noRayleigh") != 0 &&
             strcmp(argv[argi], "-dataSize") != 0 &&
             strcmp(argv[argi], "-ssl") != 0 &&
-            strcmp(argv[argi], "-udp") != 0)  {
+            strcmp(argv[argi], "-udp") != 0 &&
+            strcmp(argv[argi], "-mux") != 0)  {
                 ipAddr = new char [strlen(argv[argi])+1];
                 strcpy(ipAddr,argv[argi]);
                 argi++;
@@ -169,6 +172,15 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
             else if (strcmp(argv[i], "-udp") == 0)  {
                 udp = 1; ssl = 0;
             }
+            else if (strcmp(argv[i], "-mux") == 0)  {
+                // share one tcp/ip connection with the other elements
+                if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &mux) != TCL_OK || mux < 1)  {
+                    opserr << "WARNING invalid streamID, want an integer > 0\n";
+                    opserr << "genericClient element: " << tag << endln;
+                    return TCL_ERROR;
+                }
+                ssl = 0; udp = 0;
+            }
             else if (strcmp(argv[i], "-dataSize") == 0)  {
                 if (Tcl_GetInt(interp, argv[i+1], &dataSize) != TCL_OK)  {
                     opserr << "WARNING invalid dataSize\n";
@@ -178,6 +190,24 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
             }
         }
     }
+    else if (strcmp(argv[argi], "-shm") == 0 && argi+1 < argc)  {
+        // co-located site, connect through shared memory
+        argi++;
+        ipPort = 0;
+        shm = 1;
+        ipAddr = new char [strlen(argv[argi])+1];
+        strcpy(ipAddr,argv[argi]);
+        argi++;
+        for (i = argi; i < argc; i++)  {
+            if (strcmp(argv[i], "-dataSize") == 0)  {
+                if (Tcl_GetInt(interp, argv[i+1], &dataSize) != TCL_OK)  {
+                    opserr << "WARNING invalid dataSize\n";
+                    opserr << "genericClient element: " << tag << endln;
+                    return TCL_ERROR;
+                }
+            }
+        }
+    }
     else  {
         opserr << "WARNING expecting -server string but got ";
         opserr << argv[argi] << endln;
@@ -194,7 +224,7 @@ int TclModelBuilder_addGenericClient(ClientData clientData, Tcl_Interp *interp,
     
     // now create the GenericClient
     theElement = new GenericClient(tag, nodes, dofs, ipPort, ipAddr,
-        ssl, udp, dataSize, doRayleigh);
+        ssl, udp, dataSize, doRayleigh, shm, mux);
     
     // cleanup dynamic memory
     if (dofs != 0)
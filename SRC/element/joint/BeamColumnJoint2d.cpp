@@ -112,7 +112,7 @@ BeamColumnJoint2d::BeamColumnJoint2d(int tag,int Nd1, int Nd2, int Nd3, int Nd4,
   nodeDbTag(0), dofDbTag(0), elemActHeight(0.0), elemActWidth(0.0), 
   elemWidth(0.0), elemHeight(0.0), HgtFac(1.0), WdtFac(1.0),
   Uecommit(12), UeIntcommit(4), UeprCommit(12), UeprIntCommit(4), 
-  BCJoint(13,16), dg_df(4,13), dDef_du(13,4), K(12,12), R(12)
+  K(12,12), R(12)
 {
 	// ensure the connectedExternalNode ID is of correct size & set values
  
@@ -205,7 +205,7 @@ BeamColumnJoint2d::BeamColumnJoint2d(int tag,int Nd1, int Nd2, int Nd3, int Nd4,
   nodeDbTag(0), dofDbTag(0), elemActHeight(0.0), elemActWidth(0.0),
   elemWidth(0.0), elemHeight(0.0), HgtFac(elHgtFac), WdtFac(elWdtFac),
   Uecommit(12), UeIntcommit(4), UeprCommit(12), UeprIntCommit(4),
-  BCJoint(13,16), dg_df(4,13), dDef_du(13,4), K(12,12), R(12)
+  K(12,12), R(12)
 {
 	// ensure the connectedExternalNode ID is of correct size & set values
  
@@ -286,7 +286,7 @@ BeamColumnJoint2d::BeamColumnJoint2d():
   nodeDbTag(0), dofDbTag(0), elemActHeight(0.0), elemActWidth(0.0),
   elemWidth(0.0), elemHeight(0.0), HgtFac(1.0), WdtFac(1.0),
   Uecommit(12), UeIntcommit(4), UeprCommit(12), UeprIntCommit(4),
-  BCJoint(13,16), dg_df(4,13), dDef_du(13,4), K(12,12), R(12)
+  K(12,12), R(12)
 {
 	nodePtr[0] = 0;
 	nodePtr[1] = 0;
@@ -456,7 +456,8 @@ BeamColumnJoint2d::revertToStart(void)
 int
 BeamColumnJoint2d::update(void)
 {	
-		Vector Ue(16);
+		double UeData[16];
+	Vector Ue(UeData, 16);
 		Ue.Zero();
 
 	// determine commited displacements given trial displacements
@@ -503,24 +504,24 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 	double dLoadStep = 1.0;
 	double stepSize = 0.0;
 
-	Vector uExtOld(12);   uExtOld.Zero();
-	Vector uExt(12);      uExt.Zero();
-	Vector duExt(12);     duExt.Zero();
-	Vector uIntOld(4);    uIntOld.Zero(); 
-	Vector uInt(4);       uInt.Zero();
-	Vector duInt(4);      duInt.Zero(); 
-	Vector duIntTemp(4);  duIntTemp.Zero();
-	Vector intEq(4);      intEq.Zero();
-	Vector intEqLast(4);  intEqLast.Zero();
-	Vector Uepr(12);      Uepr.Zero();
-	Vector UeprInt(4);    UeprInt.Zero();
-	Vector Ut(12);        Ut.Zero();
+	VectorN<12> uExtOld;   uExtOld.Zero();
+	VectorN<12> uExt;      uExt.Zero();
+	VectorN<12> duExt;     duExt.Zero();
+	VectorN<4> uIntOld;    uIntOld.Zero(); 
+	VectorN<4> uInt;       uInt.Zero();
+	VectorN<4> duInt;      duInt.Zero(); 
+	VectorN<4> duIntTemp;  duIntTemp.Zero();
+	VectorN<4> intEq;      intEq.Zero();
+	VectorN<4> intEqLast;  intEqLast.Zero();
+	VectorN<12> Uepr;      Uepr.Zero();
+	VectorN<4> UeprInt;    UeprInt.Zero();
+	VectorN<12> Ut;        Ut.Zero();
 	
 
-    Vector disp1 = nodePtr[0]->getTrialDisp(); 
-    Vector disp2 = nodePtr[1]->getTrialDisp();
-    Vector disp3 = nodePtr[2]->getTrialDisp();
-    Vector disp4 = nodePtr[3]->getTrialDisp();
+    const Vector &disp1 = nodePtr[0]->getTrialDisp(); 
+    const Vector &disp2 = nodePtr[1]->getTrialDisp();
+    const Vector &disp3 = nodePtr[2]->getTrialDisp();
+    const Vector &disp4 = nodePtr[3]->getTrialDisp();
 
 	for (int i = 0; i < 3; i++)
     {
@@ -535,7 +536,8 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 	UeprInt = UeprIntCommit;  
 
 	uExtOld = Uepr;
-	duExt = Ut -Uepr;
+	duExt = Ut;
+	duExt -= Uepr;
 
 	uExt = uExtOld;
 
@@ -552,17 +554,15 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 	double normIntEq = tolIntEq;
 	double normIntEqdU = tolIntEqdU;
 	   
-	Vector u(16);
+	VectorN<16> u;
 	u.Zero();
 
 	double engrLast = 0.0;
 	double engr = 0.0;
 
-	Vector fSpring(13);   fSpring.Zero();
-	Vector kSpring(13);   kSpring.Zero();
-    Matrix dintEq_du(4,4);     dintEq_du.Zero();
-    Matrix df_dDef(13,13);     df_dDef.Zero();
-    Matrix tempintEq_du (4,13);  tempintEq_du.Zero();
+	VectorN<13> fSpring;   fSpring.Zero();
+	VectorN<13> kSpring;   kSpring.Zero();
+	MatrixN<4,4> dintEq_du;
 
 	
  	while ((loadStep < 1.0) && (totalCount < maxTotalCount))
@@ -607,14 +607,15 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 		intEq(3) = ((1+WdtFac)/2)*(fSpring(0)-fSpring(6))+((1-WdtFac)/2)*(fSpring(1)-fSpring(7))-fSpring(11)-fSpring(12)/elemActWidth; 
 
 
-		df_dDef.Zero();
-		matDiag(kSpring, df_dDef);
-
-		//////////////////////// dintEq_du = dg_df*df_dDef*dDef_du
-		tempintEq_du.Zero(); dintEq_du.Zero();
-
-		tempintEq_du.addMatrixProduct(0.0,dg_df,df_dDef,1.0);
-		dintEq_du.addMatrixProduct(0.0,tempintEq_du,dDef_du,1.0);
+		//////////////////////// dintEq_du = dg_df*diag(kSpring)*dDef_du
+		for (int id = 0; id < 4; id++) {
+			for (int jd = 0; jd < 4; jd++) {
+				double sum = 0.0;
+				for (int sd = 0; sd < 13; sd++)
+					sum += dg_df(id,sd)*kSpring(sd)*dDef_du(sd,jd);
+				dintEq_du(id,jd) = sum;
+			}
+		}
 
 		normIntEq = intEq.Norm();
 		normIntEqdU = 0.0;
@@ -651,13 +652,14 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 		else
 		{
 			////////////// duInt = -dintEq_du/intEq
-			dintEq_du.Solve(intEq,duInt);
+			if (dintEq_du.Solve(intEq,duInt) < 0)
+				opserr << "WARNING : BeamColumnJoint2d::getGlobalDispls() - singular internal stiffness" << endln;
 			duInt *= -1;
 
 			normDuInt = duInt.Norm();
 			if (!linesearch)
 			{
-				uInt = uInt + duInt;
+				uInt += duInt;
 			}
 			else
 			{
@@ -679,16 +681,16 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 					
 					if (fabs(stepSize) > 0.001)
 					{
-						uInt = uInt + stepSize*duInt;
+						uInt.addVector(1.0, duInt, stepSize);
 					}
 					else
 					{
-						uInt = uInt + duInt;
+						uInt += duInt;
 					}
 				}
 				else
 				{
-					uInt = uInt + duInt;
+					uInt += duInt;
 				}
 				intEqLast = intEq;
 			}
@@ -710,7 +712,7 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 			{					
 				uInt = uIntOld;
 				duInt.Zero();
-				duExt = duExt*0.1;
+				duExt *= 0.1;
 
 				dLoadStep = dLoadStep*0.1;
 			}
@@ -722,10 +724,10 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 			normDuInt = toluInt;
 			if ((incCount < maxCount) || dtConverge)
 			{
-				uExt = uExt + duExt;
+				uExt += duExt;
 				if (loadStep + dLoadStep > 1.0)
 				{
-					duExt = duExt*(1.0 - loadStep)/dLoadStep;
+					duExt *= (1.0 - loadStep)/dLoadStep;
 					dLoadStep = 1.0 - loadStep;
 					incCount = 9;
 				}
@@ -734,11 +736,11 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 			{
 				incCount = 0;
 
-				uExt = uExt + duExt;
+				uExt += duExt;
 				dLoadStep = dLoadStep*10;
 				if (loadStep + dLoadStep > 1.0)
 				{
-					uExt = uExt + duExt*(1.0 - loadStep)/dLoadStep;
+					uExt.addVector(1.0, duExt, (1.0 - loadStep)/dLoadStep);
 					dLoadStep = 1.0 - loadStep;
 					incCount = 9;
 				}
@@ -766,14 +768,14 @@ void BeamColumnJoint2d::getGlobalDispls(Vector &dg)
 	dg(15) = uInt(3);
 }
 
-void BeamColumnJoint2d::getMatResponse(Vector U, Vector &fS, Vector &kS)
+void BeamColumnJoint2d::getMatResponse(const VectorN<16> &U, VectorN<13> &fS, VectorN<13> &kS)
 {
 // formulation 2 (abandoned Oct 19, 2004)
 //	double jh = HgtFac;            // factor for beams
 //	double jw = WdtFac;            // factor for column
 
 	// obtains the material response from the material class
-	Vector defSpring(13);
+	VectorN<13> defSpring;
 	defSpring.Zero();
 	fS.Zero();
 	kS.Zero();
@@ -840,67 +842,51 @@ void BeamColumnJoint2d::getdDef_du()
 	}
 }
 
-void BeamColumnJoint2d::matDiag(Vector k,Matrix &dfd)
-{
-	dfd.Zero();
-	// takes in a vector and converts it to a diagonal matrix (could have been placed as a method in matrix class)
-	for (int ja=0; ja<13; ja++)
-	{
-		dfd(ja,ja) = k(ja);
-	}
-}
-
-void BeamColumnJoint2d::formR(Vector f)
+void BeamColumnJoint2d::formR(const VectorN<13> &f)
 {
 	// develops the element residual force vector
-	Vector rForceTemp(16);
-	rForceTemp.Zero();
+	VectorN<16> rForceTemp;
 	
 	rForceTemp.addMatrixTransposeVector(0.0,BCJoint,f,1.0);   // rForceTemp = BCJoint'*f
-	R.Extract(rForceTemp,0,1.0);
+	for (int i = 0; i < 12; i++)
+		R(i) = rForceTemp(i);
 }
 
-void BeamColumnJoint2d::formK(Vector k)
+void BeamColumnJoint2d::formK(const VectorN<13> &k)
 {
-    // develops the element stiffness matrix
-	Matrix kSprDiag(13,13);
-	kSprDiag.Zero();
-    Matrix kRForce(16,16);
-	kRForce.Zero();
-	Matrix kRFT1(4,12);
-	kRFT1.Zero();
-	Matrix kRFT2(4,4);
-	kRFT2.Zero();
-	Matrix kRFT3(12,4);
-	kRFT3.Zero();
-	Matrix I(4,4);
-	I.Zero();
-	Matrix kRSTinv(4,4);
-	kRSTinv.Zero();
-    Matrix kRF(12,12);
-	kRF.Zero();
-	Matrix K2Temp(12,4);
-	K2Temp.Zero();
-	Matrix K2(12,12);
-	K2.Zero();
-
-	matDiag(k,kSprDiag);
-
-	kRForce.addMatrixTripleProduct(0.0,BCJoint,kSprDiag,1.0);    // kRForce = BCJoint'*kSprDiag*BCJoint
-	kRFT2.Extract(kRForce,12,12,1.0);
-	kRFT1.Extract(kRForce,12,0,1.0);
-	kRFT3.Extract(kRForce,0,12,1.0);
-	kRF.Extract(kRForce,0,0,1.0);
-	
-    for (int ic=0; ic<4; ic++)
-	{
-		I(ic,ic) = 1.0;
+    // develops the element stiffness matrix; the 4 internal dof are
+    // condensed out with the fixed size kernels of MatrixN on the stack
+	MatrixN<13,16> kSprB;
+	MatrixN<16,16> kRForce;
+	MatrixN<4,12> kRFT1;
+	MatrixN<4,4> kRFT2;
+	MatrixN<12,4> kRFT3;
+	MatrixN<4,4> kRSTinv;
+	MatrixN<12,12> kRF;
+
+	for (int jb = 0; jb < 16; jb++)
+		for (int ib = 0; ib < 13; ib++)
+			kSprB(ib,jb) = k(ib)*BCJoint(ib,jb);
+
+	kRForce.addMatrixTransposeProduct(0.0,BCJoint,kSprB,1.0);    // kRForce = BCJoint'*kSprDiag*BCJoint
+	for (int ie = 0; ie < 12; ie++) {
+		for (int je = 0; je < 12; je++)
+			kRF(ie,je) = kRForce(ie,je);
+		for (int ji = 0; ji < 4; ji++) {
+			kRFT3(ie,ji) = kRForce(ie,12+ji);
+			kRFT1(ji,ie) = kRForce(12+ji,ie);
+		}
 	}
-	kRFT2.Solve(I,kRSTinv);
+	for (int ii = 0; ii < 4; ii++)
+		for (int ji = 0; ji < 4; ji++)
+			kRFT2(ii,ji) = kRForce(12+ii,12+ji);
+
+	if (kRFT2.Invert(kRSTinv) < 0)
+		opserr << "WARNING : BeamColumnJoint2d::formK() - singular internal stiffness" << endln;
 	
-	K2Temp.addMatrixProduct(0.0,kRFT3,kRSTinv,1.0);
+	MatrixN<12,4> K2Temp = kRFT3*kRSTinv;
 
-	// loop done for some idiotic reason
+	// done for some idiotic reason
 	for(int i = 0; i < 12; ++i)
 	{	
 		for(int j = 0; j < 4; ++j)
@@ -910,9 +896,9 @@ void BeamColumnJoint2d::formK(Vector k)
 		}
 	}
 
-	K2.addMatrixProduct(0.0,K2Temp,kRFT1,1.0);
+	MatrixN<12,12> K2 = K2Temp*kRFT1;      // K2 = kRFT3*kRSTinv*kRFT1 
 
-	// loop done for some idiotic reason
+    // done for some idiotic reason
 	for(int i1 = 0; i1 < 12; ++i1)
 	{	
 		for(int j1 = 0; j1 < 12; ++j1)
@@ -922,9 +908,9 @@ void BeamColumnJoint2d::formK(Vector k)
 		}
 	}
 
-	kRF.addMatrix(1.0,K2,-1.0);
-	
-	K = kRF;    // K = kRF - kRFT3*kRSTinv*kRFT1
+	kRF -= K2;                     // kRF = kRF - K2
+
+	kRF.copyTo(K);    // K = kRF - kRFT3*kRSTinv*kRFT1
 }
 
 void BeamColumnJoint2d::getdg_df()
@@ -1029,12 +1015,13 @@ void BeamColumnJoint2d::getBCJoint()
 */
 }
 
-double BeamColumnJoint2d::getStepSize(double s0,double s1,Vector uExt,Vector duExt,Vector uInt,Vector duInt,double tol)
+double BeamColumnJoint2d::getStepSize(double s0,double s1,const VectorN<12> &uExt,const VectorN<12> &duExt,
+				       const VectorN<4> &uInt,const VectorN<4> &duInt,double tol)
 {
-	Vector u(16);    u.Zero();
-	Vector fSpr(13); fSpr.Zero();
-	Vector kSpr(13); kSpr.Zero();
-	Vector intEq(4); intEq.Zero();
+	VectorN<16> u;    u.Zero();
+	VectorN<13> fSpr; fSpr.Zero();
+	VectorN<13> kSpr; kSpr.Zero();
+	VectorN<4> intEq; intEq.Zero();
 
 	double r0 = 0.0;            // tolerance chcek for line-search
 	double tolerance = 0.8;     // slack region tolerance set for line-search
@@ -1343,9 +1330,9 @@ BeamColumnJoint2d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 BeamColumnJoint2d::getResponse(int responseID, Information &eleInfo)
 {
-	static Vector delta(13);
+	VectorN<13> delta;
 	static Vector def(4);
-	static Vector U(16);
+	VectorN<16> U;
 	int tr,ty;
 	double bsFa, bsFb, bsFc, bsFd;
 	double bsFac, bsFbd, isFac, isFbd; 
@@ -41,6 +41,7 @@
 #include <ID.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
 #include <FileStream.h>
 #include <OPS_Stream.h>
 
@@ -163,11 +164,11 @@ class BeamColumnJoint2d : public Element
   void getBCJoint(void);
   void getdg_df(void);
   void getdDef_du(void);
-  void matDiag(Vector, Matrix&);
-  void getMatResponse(Vector, Vector&, Vector&);
-  void formR(Vector);
-  void formK(Vector);
-  double getStepSize(double,double,Vector,Vector,Vector,Vector,double);
+  void getMatResponse(const VectorN<16> &, VectorN<13> &, VectorN<13> &);
+  void formR(const VectorN<13> &);
+  void formK(const VectorN<13> &);
+  double getStepSize(double,double,const VectorN<12> &,const VectorN<12> &,
+		     const VectorN<4> &,const VectorN<4> &,double);
   
   // material info
   UniaxialMaterial **MaterialPtr;  // pointer to the 13 different materials
@@ -191,9 +192,9 @@ class BeamColumnJoint2d : public Element
   Vector UeIntcommit;          // vector of internal commited displacements   
   Vector UeprCommit;           // vector of previous external committed displacements
   Vector UeprIntCommit;        // vector of previous internal committed displacements  
-  Matrix BCJoint;       // matrix describing relation between the component deformations and the external and internal deformations
-  Matrix dg_df;         // matrix of derivative of internal equilibrium 
-  Matrix dDef_du;       // matrix of a portion of BCJoint reqd. for static condensation
+  MatrixN<13,16> BCJoint;       // matrix describing relation between the component deformations and the external and internal deformations
+  MatrixN<4,13> dg_df;       // matrix of derivative of internal equilibrium 
+  MatrixN<13,4> dDef_du;       // matrix of a portion of BCJoint reqd. for static condensation
   
   Matrix K;              // element stiffness matrix
   Vector R;              // element residual matrix  
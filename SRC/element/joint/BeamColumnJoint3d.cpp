@@ -113,7 +113,7 @@ BeamColumnJoint3d::BeamColumnJoint3d(int tag,int Nd1, int Nd2, int Nd3, int Nd4,
   connectedExternalNodes(4), elemActHeight(0.0), elemActWidth(0.0), 
   elemWidth(0.0), elemHeight(0.0), HgtFac(1.0), WdtFac(1.0),
   Uecommit(24), UeIntcommit(4), UeprCommit(24), UeprIntCommit(4),
-  BCJoint(13,16), dg_df(4,13), dDef_du(13,4), K(24,24), R(24), Node1(3), Node2(3), Node3(3), Node4(3)
+  K(24,24), R(24), Node1(3), Node2(3), Node3(3), Node4(3)
 {  
 // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 4)
@@ -204,7 +204,7 @@ BeamColumnJoint3d::BeamColumnJoint3d(int tag,int Nd1, int Nd2, int Nd3, int Nd4,
   connectedExternalNodes(4), elemActHeight(0.0), elemActWidth(0.0), 
   elemWidth(0), elemHeight(0), HgtFac(elHgtFac), WdtFac(elWdtFac),
   Uecommit(24), UeIntcommit(4), UeprCommit(24), UeprIntCommit(4),
-  BCJoint(13,16), dg_df(4,13), dDef_du(13,4), K(24,24), R(24), Node1(3), Node2(3), Node3(3), Node4(3)
+  K(24,24), R(24), Node1(3), Node2(3), Node3(3), Node4(3)
 {  
 // ensure the connectedExternalNode ID is of correct size & set values
     if (connectedExternalNodes.Size() != 4)
@@ -281,7 +281,7 @@ BeamColumnJoint3d::BeamColumnJoint3d():
   connectedExternalNodes(4), elemActHeight(0.0), elemActWidth(0.0), 
   elemWidth(0), elemHeight(0), HgtFac(1.0), WdtFac(1.0),
   Uecommit(24), UeIntcommit(4), UeprCommit(24), UeprIntCommit(4),
-  BCJoint(13,16), dg_df(4,13), dDef_du(13,4), K(24,24), R(24), Node1(3), Node2(3), Node3(3), Node4(3)
+  K(24,24), R(24), Node1(3), Node2(3), Node3(3), Node4(3)
 {
     nodePtr[0] = 0;
 	nodePtr[1] = 0;
@@ -457,7 +457,8 @@ int
 BeamColumnJoint3d::update()
 {	
 
-	Vector Ue(28);
+	double UeData[28];
+	Vector Ue(UeData, 28);
 	Ue.Zero();
 
 	// determine commited displacements given trial displacements
@@ -506,24 +507,24 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 	double dLoadStep = 1.0;
 	double stepSize;
 
-	Vector uExtOld(24);       uExtOld.Zero();
-	Vector uExt(12);          uExt.Zero();
-	Vector duExt(12);         duExt.Zero();
-	Vector uIntOld(4);        uIntOld.Zero();
-	Vector uInt(4);           uInt.Zero();
-	Vector duInt(4);          duInt.Zero();
-	Vector duIntTemp(4);      duIntTemp.Zero();
-	Vector intEq(4);          intEq.Zero();
-	Vector intEqLast(4);      intEqLast.Zero();
-	Vector Uepr(24);          Uepr.Zero();
-	Vector UeprInt(4);        UeprInt.Zero();
-	Vector Ut(24);            Ut.Zero();
-	Vector duExtTemp(24);     duExtTemp.Zero();
-
-    Vector disp1 = nodePtr[0]->getTrialDisp(); 
-    Vector disp2 = nodePtr[1]->getTrialDisp();
-    Vector disp3 = nodePtr[2]->getTrialDisp();
-    Vector disp4 = nodePtr[3]->getTrialDisp();
+	VectorN<24> uExtOld;       uExtOld.Zero();
+	VectorN<12> uExt;          uExt.Zero();
+	VectorN<12> duExt;         duExt.Zero();
+	VectorN<4> uIntOld;        uIntOld.Zero();
+	VectorN<4> uInt;           uInt.Zero();
+	VectorN<4> duInt;          duInt.Zero();
+	VectorN<4> duIntTemp;      duIntTemp.Zero();
+	VectorN<4> intEq;          intEq.Zero();
+	VectorN<4> intEqLast;      intEqLast.Zero();
+	VectorN<24> Uepr;          Uepr.Zero();
+	VectorN<4> UeprInt;        UeprInt.Zero();
+	VectorN<24> Ut;            Ut.Zero();
+	VectorN<24> duExtTemp;     duExtTemp.Zero();
+
+    const Vector &disp1 = nodePtr[0]->getTrialDisp(); 
+    const Vector &disp2 = nodePtr[1]->getTrialDisp();
+    const Vector &disp3 = nodePtr[2]->getTrialDisp();
+    const Vector &disp4 = nodePtr[3]->getTrialDisp();
 
 	for (int i = 0; i < 6; i++)
     {
@@ -539,9 +540,16 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 
 	uExtOld = Uepr;
 
-	duExtTemp = Ut - Uepr;
-	duExt.addMatrixVector(0.0,Transf,duExtTemp,1.0);
-	uExt.addMatrixVector(0.0,Transf,uExtOld,1.0);  
+	duExtTemp = Ut;
+	duExtTemp -= Uepr;
+	for (int it = 0; it < 12; it++) {
+		duExt(it) = 0.0;
+		uExt(it) = 0.0;
+		for (int jt = 0; jt < 24; jt++) {
+			duExt(it) += Transf(it,jt)*duExtTemp(jt);
+			uExt(it) += Transf(it,jt)*uExtOld(jt);
+		}
+	}
 
 	uIntOld = UeprInt;
 	uInt = uIntOld;
@@ -556,16 +564,14 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 	double normIntEq = tolIntEq;
 	double normIntEqdU = tolIntEqdU;
 	    
-	Vector u(16);   u.Zero();
+	VectorN<16> u;   u.Zero();
 
 	double engrLast = 0.0;
 	double engr = 0.0;
 
-	Vector fSpring(13);          fSpring.Zero();
-	Vector kSpring(13);          kSpring.Zero();
-	Matrix dintEq_du(4,4);       dintEq_du.Zero();
-	Matrix df_dDef(13,13);       df_dDef.Zero();
-	Matrix tempintEq_du (4,13);  tempintEq_du.Zero();
+	VectorN<13> fSpring;          fSpring.Zero();
+	VectorN<13> kSpring;          kSpring.Zero();
+	MatrixN<4,4> dintEq_du;
 
 
 	while ((loadStep < 1.0) && (totalCount < maxTotalCount))
@@ -600,11 +606,15 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 		intEq(2) = -fSpring(4)-fSpring(8)+fSpring(10)+fSpring(12)/elemHeight; 
 		intEq(3) = fSpring(0)-fSpring(6)-fSpring(11)-fSpring(12)/elemWidth; 
 
-		matDiag(kSpring, df_dDef);
-
-		//////////////////////// dintEq_du = dg_df*df_dDef*dDef_du
-		tempintEq_du.addMatrixProduct(0.0,dg_df,df_dDef,1.0);
-		dintEq_du.addMatrixProduct(0.0,tempintEq_du,dDef_du,1.0);
+		//////////////////////// dintEq_du = dg_df*diag(kSpring)*dDef_du
+		for (int id = 0; id < 4; id++) {
+			for (int jd = 0; jd < 4; jd++) {
+				double sum = 0.0;
+				for (int sd = 0; sd < 13; sd++)
+					sum += dg_df(id,sd)*kSpring(sd)*dDef_du(sd,jd);
+				dintEq_du(id,jd) = sum;
+			}
+		}
 		normIntEq = intEq.Norm();
 		normIntEqdU = 0.0;
 		for (int jc = 0; jc<4 ; jc++)
@@ -647,13 +657,14 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 		else
 		{
 			////////////// duInt = -dintEq_du/intEq
-			dintEq_du.Solve(intEq,duInt);
+			if (dintEq_du.Solve(intEq,duInt) < 0)
+				opserr << "WARNING : BeamColumnJoint3d::getGlobalDispls() - singular internal stiffness" << endln;
 			duInt *= -1;
 			
 			normDuInt = duInt.Norm();
 			if (!linesearch)
 			{
-				uInt = uInt + duInt;
+				uInt += duInt;
 			}
 			else
 			{
@@ -675,16 +686,16 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 					
 					if (fabs(stepSize) > 0.001)
 					{
-						uInt = uInt + stepSize*duInt;
+						uInt.addVector(1.0, duInt, stepSize);
 					}
 					else
 					{
-						uInt = uInt + duInt;
+						uInt += duInt;
 					}
 				}
 				else
 				{
-					uInt = uInt + duInt;
+					uInt += duInt;
 				}
 				intEqLast = intEq;
 			}
@@ -703,11 +714,11 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 			}
 			else
 			{
-				opserr << "WARNING : BeamColumnJoint::getGlobalDispls() - convergence problem in state determination" << endln;
+				opserr << "WARNING : BeamColumnJoint3d::getGlobalDispls() - convergence problem in state determination" << endln;
 
 				uInt = uIntOld;
 				duInt.Zero();
-				duExt = duExt*0.1;
+				duExt *= 0.1;
 
 				dLoadStep = dLoadStep*0.1;
 			}
@@ -719,10 +730,10 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 			normDuInt = toluInt;
 			if ((incCount < maxCount) || dtConverge)
 			{
-				uExt = uExt + duExt;
+				uExt += duExt;
 				if (loadStep + dLoadStep > 1.0)
 				{
-					duExt = duExt*(1.0 - loadStep)/dLoadStep;
+					duExt *= (1.0 - loadStep)/dLoadStep;
 					dLoadStep = 1.0 - loadStep;
 					incCount = 9;
 				}
@@ -730,11 +741,11 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 			else
 			{
 				incCount = 0;
-				uExt = uExt + duExt;
+				uExt += duExt;
 				dLoadStep = dLoadStep*10;
 				if (loadStep + dLoadStep > 1.0)
 				{
-					uExt = uExt + duExt*(1.0 - loadStep)/dLoadStep;
+					uExt.addVector(1.0, duExt, (1.0 - loadStep)/dLoadStep);
 					dLoadStep = 1.0 - loadStep;
 					incCount = 9;
 				}
@@ -764,13 +775,13 @@ void BeamColumnJoint3d::getGlobalDispls(Vector &dg)
 
 }
 
-void BeamColumnJoint3d::getMatResponse(Vector U, Vector &fS, Vector &kS)
+void BeamColumnJoint3d::getMatResponse(const VectorN<16> &U, VectorN<13> &fS, VectorN<13> &kS)
 {
 	double jh = HgtFac;            // factor for beams
 	double jw = WdtFac;            // factor for column
 
 	// obtains the material response from the material class
-	Vector defSpring(13);
+	VectorN<13> defSpring;
 	defSpring.Zero();
 	fS.Zero();
 	kS.Zero();
@@ -791,9 +802,9 @@ void BeamColumnJoint3d::getMatResponse(Vector U, Vector &fS, Vector &kS)
 
 	for (int j=0; j<13; j++)
 	{
-		MaterialPtr[j]->setTrialStrain(defSpring[j]);
-		kS[j] = MaterialPtr[j]->getTangent();
-		fS[j] = MaterialPtr[j]->getStress();
+		MaterialPtr[j]->setTrialStrain(defSpring(j));
+		kS(j) = MaterialPtr[j]->getTangent();
+		fS(j) = MaterialPtr[j]->getStress();
 	}
 
 	// force @ spring = force @ bar * tc couple
@@ -835,70 +846,51 @@ void BeamColumnJoint3d::getdDef_du()
 	}
 }
 
-void BeamColumnJoint3d::matDiag(Vector k,Matrix &dfd)
-{
-	dfd.Zero();
-	// takes in a vector and converts it to a diagonal matrix (could have been placed as a method in matrix class)
-	for (int ja=0; ja<13; ja++)
-	{
-		dfd(ja,ja) = k(ja);
-	}
-
-}
-
-void BeamColumnJoint3d::formR(Vector f)
+void BeamColumnJoint3d::formR(const VectorN<13> &f)
 {
 	
 	// develops the element residual force vector
-	Vector rForceTemp(16);
-	Vector Rtempo(12);
-	rForceTemp.Zero();
+	VectorN<16> rForceTemp;
 	
 	rForceTemp.addMatrixTransposeVector(0.0,BCJoint,f,1.0);   // rForceTemp = BCJoint'*f
-	Rtempo.Extract(rForceTemp,0,1.0);
+	Vector Rtempo(rForceTemp.values, 12);                      // the first 12 of rForceTemp
 
 	R.addMatrixTransposeVector(0.0,Transf,Rtempo,1.0);    // R = Transf'*Rtempo
 }
 
-void BeamColumnJoint3d::formK(Vector k)
+void BeamColumnJoint3d::formK(const VectorN<13> &k)
 {
-    // develops the element stiffness matrix
-	Matrix kSprDiag(13,13);
-	kSprDiag.Zero();
-    Matrix kRForce(16,16);
-	kRForce.Zero();
-	Matrix kRFT1(4,12);
-	kRFT1.Zero();
-	Matrix kRFT2(4,4);
-	kRFT2.Zero();
-	Matrix kRFT3(12,4);
-	kRFT3.Zero();
-	Matrix I(4,4);
-	I.Zero();
-	Matrix kRSTinv(4,4);
-	kRSTinv.Zero();
-    Matrix kRF(12,12);
-	kRF.Zero();
-	Matrix K2Temp(12,4);
-	K2Temp.Zero();
-	Matrix K2(12,12);
-	K2.Zero();
-
-	matDiag(k,kSprDiag);
-
-	kRForce.addMatrixTripleProduct(0.0,BCJoint,kSprDiag,1.0);    // kRForce = BCJoint'*kSprDiag*BCJoint
-	kRFT2.Extract(kRForce,12,12,1.0);
-	kRFT1.Extract(kRForce,12,0,1.0);
-	kRFT3.Extract(kRForce,0,12,1.0);
-	kRF.Extract(kRForce,0,0,1.0);
-	
-    for (int ic=0; ic<4; ic++)
-	{
-		I(ic,ic) = 1.0;
+    // develops the element stiffness matrix; the 4 internal dof are
+    // condensed out with the fixed size kernels of MatrixN on the stack
+	MatrixN<13,16> kSprB;
+	MatrixN<16,16> kRForce;
+	MatrixN<4,12> kRFT1;
+	MatrixN<4,4> kRFT2;
+	MatrixN<12,4> kRFT3;
+	MatrixN<4,4> kRSTinv;
+	MatrixN<12,12> kRF;
+
+	for (int jb = 0; jb < 16; jb++)
+		for (int ib = 0; ib < 13; ib++)
+			kSprB(ib,jb) = k(ib)*BCJoint(ib,jb);
+
+	kRForce.addMatrixTransposeProduct(0.0,BCJoint,kSprB,1.0);    // kRForce = BCJoint'*kSprDiag*BCJoint
+	for (int ie = 0; ie < 12; ie++) {
+		for (int je = 0; je < 12; je++)
+			kRF(ie,je) = kRForce(ie,je);
+		for (int ji = 0; ji < 4; ji++) {
+			kRFT3(ie,ji) = kRForce(ie,12+ji);
+			kRFT1(ji,ie) = kRForce(12+ji,ie);
+		}
 	}
-	kRFT2.Solve(I,kRSTinv);
+	for (int ii = 0; ii < 4; ii++)
+		for (int ji = 0; ji < 4; ji++)
+			kRFT2(ii,ji) = kRForce(12+ii,12+ji);
+
+	if (kRFT2.Invert(kRSTinv) < 0)
+		opserr << "WARNING : BeamColumnJoint3d::formK() - singular internal stiffness" << endln;
 	
-	K2Temp.addMatrixProduct(0.0,kRFT3,kRSTinv,1.0);
+	MatrixN<12,4> K2Temp = kRFT3*kRSTinv;
 
 	// done for some idiotic reason
 	for(int i = 0; i < 12; ++i)
@@ -910,7 +902,7 @@ void BeamColumnJoint3d::formK(Vector k)
 		}
 	}
 
-	K2.addMatrixProduct(0.0,K2Temp,kRFT1,1.0);      // K2 = kRFT3*kRSTinv*kRFT1 
+	MatrixN<12,12> K2 = K2Temp*kRFT1;      // K2 = kRFT3*kRSTinv*kRFT1 
 
     // done for some idiotic reason
 	for(int i1 = 0; i1 < 12; ++i1)
@@ -922,9 +914,10 @@ void BeamColumnJoint3d::formK(Vector k)
 		}
 	}
 
-	kRF.addMatrix(1.0,K2,-1.0);                     // kRF = kRF - K2
+	kRF -= K2;                     // kRF = kRF - K2
 
-	K.addMatrixTripleProduct(0.0,Transf,kRF,1.0);   // K = Transf'*kRF*Transf
+	Matrix kRFm(kRF.values, 12, 12);
+	K.addMatrixTripleProduct(0.0,Transf,kRFm,1.0);   // K = Transf'*kRF*Transf
 }
 
 void BeamColumnJoint3d::formTransfMat()
@@ -1019,13 +1012,14 @@ void BeamColumnJoint3d::getBCJoint()
 
 }
 
-double BeamColumnJoint3d::getStepSize(double s0,double s1,Vector uExt,Vector duExt,Vector uInt,Vector duInt,double tol)
+double BeamColumnJoint3d::getStepSize(double s0,double s1,const VectorN<12> &uExt,const VectorN<12> &duExt,
+				       const VectorN<4> &uInt,const VectorN<4> &duInt,double tol)
 {
 	// finds out the factor to be used for linesearch method
-	Vector u(16);    u.Zero();
-	Vector fSpr(13); fSpr.Zero();
-	Vector kSpr(13); kSpr.Zero();
-	Vector intEq(4); intEq.Zero();
+	VectorN<16> u;    u.Zero();
+	VectorN<13> fSpr; fSpr.Zero();
+	VectorN<13> kSpr; kSpr.Zero();
+	VectorN<4> intEq; intEq.Zero();
 
 	double r0 = 0.0;            // tolerance chcek for line-search
 	double tolerance = 0.8;     // slack region tolerance set for line-search
@@ -1271,9 +1265,9 @@ BeamColumnJoint3d::setResponse(const char **argv, int argc, OPS_Stream &output)
 int 
 BeamColumnJoint3d::getResponse(int responseID, Information &eleInfo)
 {
-	static Vector delta(13);
+	VectorN<13> delta;
 	static Vector def(4);
-	static Vector U(16);
+	VectorN<16> U;
 	static Vector Utemp(12);
 	double bsFa, bsFb, bsFc, bsFd;
 	double bsFac, bsFbd, isFac, isFbd; 
@@ -1322,8 +1316,10 @@ BeamColumnJoint3d::getResponse(int responseID, Information &eleInfo)
 
 		// modified 01.04.03  -------- determine which plane the joint lies
 		Utemp.addMatrixVector(0.0,Transf,UeprCommit,1.0);
-		U.Assemble(Utemp,0,1.0);
-		U.Assemble(UeprIntCommit,12,1.0);
+		for (int it = 0; it < 12; it++)
+			U(it) = Utemp(it);
+		for (int it = 0; it < 4; it++)
+			U(12+it) = UeprIntCommit(it);
 
 		delta.addMatrixVector(0.0,BCJoint,U,1.0);
 		
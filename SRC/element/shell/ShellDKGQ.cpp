@@ -48,6 +48,7 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 #include <elementAPI.h>
+#include <GeometryCache.h>
 
 #define min(a,b) ( (a)<(b) ? (a):(b) )
 
@@ -104,12 +105,22 @@ double ShellDKGQ::sg[4] ;
 double ShellDKGQ::tg[4] ;
 double ShellDKGQ::wg[4] ;
 
+// the B matrices and volume elements of the gauss points kept by an
+// element with the GeometryCache on, see formB()
+struct ShellDKGQ_Geometry
+{
+  double dvol[4];
+  double B[4][8][6][4];
+  double BPT[4][8][6][4];
+};
+
  
 
 //null constructor
 ShellDKGQ::ShellDKGQ( ) :
 Element( 0, ELE_TAG_ShellDKGQ ),
-connectedExternalNodes(4), load(0), Ki(0)
+connectedExternalNodes(4), load(0), Ki(0),
+cacheGeometry(GeometryCache::isActive()), geometry(0)
 { 
   for (int i = 0 ;  i < 4; i++ ) 
     materialPointers[i] = 0;
@@ -140,7 +151,8 @@ ShellDKGQ::ShellDKGQ(  int tag,
                          int node4,
 	                     SectionForceDeformation &theMaterial ) :
 Element( tag, ELE_TAG_ShellDKGQ ),
-connectedExternalNodes(4), load(0), Ki(0)
+connectedExternalNodes(4), load(0), Ki(0),
+cacheGeometry(GeometryCache::isActive()), geometry(0)
 {
   int i;
 
@@ -195,6 +207,9 @@ ShellDKGQ::~ShellDKGQ( )
 
   if (Ki != 0)
     delete Ki;
+
+  if (geometry != 0)
+    GeometryCache::deallocate(geometry, sizeof(ShellDKGQ_Geometry));
 }
 //**************************************************************************
 
@@ -221,6 +236,12 @@ void  ShellDKGQ::setDomain( Domain *theDomain )
   //basis vectors and local coordinates
   computeBasis( ) ;
 
+  //the cached geometry is formed again from the new nodes
+  if (geometry != 0) {
+    GeometryCache::deallocate(geometry, sizeof(ShellDKGQ_Geometry));
+    geometry = 0;
+  }
+
   this->DomainComponent::setDomain(theDomain);
 }
 
@@ -1026,18 +1047,10 @@ ShellDKGQ::formResidAndTangent( int tang_flag )
 
 	double volume = 0.0;
 
-	static double xsj; //determinant jacobian matrix
-
 	static double dvol[ngauss]; //volume element
 
 	static Vector strain(nstress); //strain
 
-	static double shp[3][numnodes]; //shape fuction 2d at a gauss point
-
-	static double shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
-
-	static double shpBend[6][12]; //shape fuction - bending part at a gauss point
-
 	static Vector residJ(ndf); //nodeJ residual, global coordinates
 
 	static Matrix stiffJK(ndf,ndf);//nodeJK stiffness, global coordinates
@@ -1058,11 +1071,6 @@ ShellDKGQ::formResidAndTangent( int tang_flag )
 
 	static Matrix dd(nstress,nstress);//material tangent
 
-	//static Matrix J0(2,2); //Jacobian at center
-
-	//static Matrix J0inv(2,2); //inverse of Jacobian at center
-	static double sx[2][2];
-
 	Matrix Tmat(6,6);  //local-global coordinates transform matrix
 
 	Matrix TmatTran(6,6);
@@ -1081,18 +1089,16 @@ ShellDKGQ::formResidAndTangent( int tang_flag )
 
 	static Matrix BJtranD(ndf, nstress); //BJtran * dd
 
-	static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
-
-	static Matrix BJPT(nstress,ndf); //BJP * Tmmat, from global coordinates to local coordinates
+	static Matrix BJPT(nstress,ndf); //BJ * Pmat * Tmat, from global coordinates to local coordinates
 
+	static double localB[nstress][ndf][numnodes];
 
-	static Matrix Bmembrane(3,3); //membrane B matrix
+	static double localBPT[nstress][ndf][numnodes];
 
-	static Matrix Bbend(3,3); //bending B matrix
+	//the B matrices of a gauss point, local or kept by the element
+	double (*saveB)[ndf][numnodes];
 
-	static Matrix Bshear(2,3); //shear B matrix (zero)
-
-	static double saveB[nstress][ndf][numnodes];
+	double (*saveBPT)[ndf][numnodes];
 	//---------------------------------------------------------------
 
 	//zero stiffness and residual
@@ -1149,43 +1155,41 @@ ShellDKGQ::formResidAndTangent( int tang_flag )
 		}
 	}//end for p2
 
+	//the B matrices of the gauss points are kept by the element with
+	//the GeometryCache on, the geometry does not change
+	if (geometry == 0 && cacheGeometry == true) {
+		geometry = (ShellDKGQ_Geometry *)GeometryCache::allocate(sizeof(ShellDKGQ_Geometry));
+		for (i=0; geometry != 0 && i<ngauss; i++)
+			formB(i, Pmat, Tmat, geometry->dvol[i], geometry->B[i], geometry->BPT[i]);
+	}
+
 	//------------gauss loop--------------------------
 	for (i=0; i<ngauss;i++){
 
-		//get shape functions
-		shape2d(sg[i],tg[i],xl,shp,xsj,sx);
-
-		shapeDrill(sg[i],tg[i],xl,sx,shpDrill);
-
-		shapeBend(sg[i],tg[i],xl,sx,shpBend);
-
-		//volume element to be saved
-		dvol[i] = wg[i] * xsj;
+		//B matrices and volume element
+		if (geometry != 0) {
+			dvol[i] = geometry->dvol[i];
+			saveB = geometry->B[i];
+			saveBPT = geometry->BPT[i];
+		} else {
+			formB(i, Pmat, Tmat, dvol[i], localB, localBPT);
+			saveB = localB;
+			saveBPT = localBPT;
+		}
 		volume += dvol[i];
 
-		Bshear.Zero( );
-
 		//zero the strains
 		strain.Zero( );
 
 		// j-node loop to compute strain
 		for (j = 0; j < numnodes; j++){
 
-			//compute B matrix
-
-			Bmembrane = computeBmembrane(j,shp,shpDrill);
-
-			Bbend = computeBbend(j,shpBend);
-
-			BJ = assembleB(Bmembrane, Bbend, Bshear);
-
-			//save the B-matrix
+			//extract BJ * Pmat * Tmat
 			for (p=0;p<nstress; p++){
 				for(q=0;q<ndf;q++){
-					saveB[p][q][j] = BJ(p,q);
+					BJPT(p,q) = saveBPT[p][q][j];
 				}
 			}//end for p
-			//opserr<<Bmembrane<<endln;
 
 			//nodal "displacements"
 			const Vector &ul = nodePointers[j]->getTrialDisp( );
@@ -1193,9 +1197,6 @@ ShellDKGQ::formResidAndTangent( int tang_flag )
 
 			//compute the strain 
 			//Note: transform the dof's order
-			//BJP = BJ * P;
-			BJP.addMatrixProduct(0.0, BJ, Pmat,1.0);
-			BJPT.addMatrixProduct(0.0,BJP,Tmat,1.0);
 			//strain += (BJ*ul);
 			strain.addMatrixVector(1.0, BJPT, ul,1.0);
 
@@ -1296,6 +1297,83 @@ ShellDKGQ::formResidAndTangent( int tang_flag )
 }
 
 
+
+
+//*********************************************************************
+//B matrices of gauss point i: B in the local dof order and coordinates,
+//BPT = B * Pmat * Tmat in the nodal dof, and the volume element
+
+void
+ShellDKGQ::formB( int i, const Matrix &Pmat, const Matrix &Tmat,
+		  double &dvol, double B[8][6][4], double BPT[8][6][4] )
+{
+	static const int ndf = 6; //two membrane + 3 moment +drill
+
+	static const int nstress = 8; //3 membrane , 3 moment, 2 shear
+
+	static const int numnodes = 4;
+
+	int j,p,q;
+
+	double xsj; //determinant jacobian matrix
+
+	double shp[3][numnodes]; //shape fuction 2d at a gauss point
+
+	double shpDrill[4][numnodes]; //shape function drilling dof at a gauss point
+
+	double shpBend[6][12]; //shape fuction - bending part at a gauss point
+
+	double sx[2][2];
+
+	static Matrix BJ(nstress, ndf); // B matrix node J
+
+	static Matrix BJP(nstress, ndf); //BJ * Pmat, transform the dof order
+
+	static Matrix BJPT(nstress,ndf); //BJP * Tmmat, from global coordinates to local coordinates
+
+	static Matrix Bmembrane(3,3); //membrane B matrix
+
+	static Matrix Bbend(3,3); //bending B matrix
+
+	static Matrix Bshear(2,3); //shear B matrix (zero)
+
+	//get shape functions
+	shape2d(sg[i],tg[i],xl,shp,xsj,sx);
+
+	shapeDrill(sg[i],tg[i],xl,sx,shpDrill);
+
+	shapeBend(sg[i],tg[i],xl,sx,shpBend);
+
+	//volume element to be saved
+	dvol = wg[i] * xsj;
+
+	Bshear.Zero( );
+
+	for (j = 0; j < numnodes; j++){
+
+		//compute B matrix
+
+		Bmembrane = computeBmembrane(j,shp,shpDrill);
+
+		Bbend = computeBbend(j,shpBend);
+
+		BJ = assembleB(Bmembrane, Bbend, Bshear);
+
+		//Note: transform the dof's order
+		//BJP = BJ * P;
+		BJP.addMatrixProduct(0.0, BJ, Pmat,1.0);
+		BJPT.addMatrixProduct(0.0,BJP,Tmat,1.0);
+
+		//save the B-matrices
+		for (p=0;p<nstress; p++){
+			for(q=0;q<ndf;q++){
+				B[p][q][j] = BJ(p,q);
+				BPT[p][q][j] = BJPT(p,q);
+			}
+		}//end for p
+
+	}//end j-node loop
+}
 //************************************************************************
 //compute local coordinates and basis
 
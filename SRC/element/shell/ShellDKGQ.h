@@ -40,6 +40,8 @@
 #include <SectionForceDeformation.h>
 #include <R3vectors.h>
 
+struct ShellDKGQ_Geometry;
+
 class ShellDKGQ : public Element {
 
  public:
@@ -186,9 +188,17 @@ class ShellDKGQ : public Element {
 	void shapeBend(double ss, double tt, const double x[2][4],
 		          double sx[2][2], double shpBend[6][12]);
 
+    //B matrices of a gauss point
+    void formB( int i, const Matrix &Pmat, const Matrix &Tmat,
+		double &dvol, double B[8][6][4], double BPT[8][6][4] ) ;
+
     // vector for applying loads
     Vector *load;
     Matrix *Ki;
+
+    // the B matrices kept with the GeometryCache on
+    bool cacheGeometry;
+    ShellDKGQ_Geometry *geometry;
 } ; 
 
 
@@ -0,0 +1,1003 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/superElement/SuperElement.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for SuperElement.
+
+// What: "@(#) SuperElement.C, revA"
+
+#include <SuperElement.h>
+#include <Domain.h>
+#include <Node.h>
+#include <ElementIter.h>
+#include <SP_Constraint.h>
+#include <SP_ConstraintIter.h>
+#include <MP_Constraint.h>
+#include <MP_ConstraintIter.h>
+#include <LoadPattern.h>
+#include <LoadPatternIter.h>
+#include <NodalLoad.h>
+#include <NodalLoadIter.h>
+#include <ElementalLoad.h>
+#include <ElementalLoadIter.h>
+#include <MeshRegion.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinSubstrSolver.h>
+#include <SymBandEigenSOE.h>
+#include <SymBandEigenSolver.h>
+#include <FullGenEigenSOE.h>
+#include <FullGenEigenSolver.h>
+#include <AnalysisModel.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <elementAPI.h>
+#include <string.h>
+#include <math.h>
+
+static SuperElement *condenseRegion(int tag, Domain &theDomain, const ID &eleTags,
+				    int numModes, int modalNode);
+
+static bool
+isZero(const Matrix &m)
+{
+  for (int j=0; j<m.noCols(); j++)
+    for (int i=0; i<m.noRows(); i++)
+      if (m(i,j) != 0.0)
+	return false;
+  return true;
+}
+
+void *
+OPS_SuperElement(void)
+{
+  // element superElement tag -region regionTag <-modes numModes modalNodeTag>
+  // element superElement tag -ele eleTag1 eleTag2 ... <-modes numModes modalNodeTag>
+  if (OPS_GetNumRemainingInputArgs() < 3) {
+    opserr << "WARNING insufficient arguments\n";
+    opserr << "Want: element superElement tag -region regionTag <or> -ele eleTag1 eleTag2 ..";
+    opserr << " <-modes numModes modalNodeTag>\n";
+    return 0;
+  }
+
+  int tag;
+  int numData = 1;
+  if (OPS_GetIntInput(&numData, &tag) < 0) {
+    opserr << "WARNING invalid superElement tag\n";
+    return 0;
+  }
+
+  Domain *theDomain = OPS_GetDomain();
+  if (theDomain == 0)
+    return 0;
+
+  ID eleTags(0, 32);
+  int numModes = 0;
+  int modalNode = 0;
+  while (OPS_GetNumRemainingInputArgs() > 0) {
+    const char *type = OPS_GetString();
+    if (strcmp(type, "-region") == 0) {
+      int regionTag;
+      if (OPS_GetIntInput(&numData, &regionTag) < 0) {
+	opserr << "WARNING invalid region tag - superElement " << tag << endln;
+	return 0;
+      }
+      MeshRegion *theRegion = theDomain->getRegion(regionTag);
+      if (theRegion == 0) {
+	opserr << "WARNING region " << regionTag << " does not exist - superElement " << tag << endln;
+	return 0;
+      }
+      eleTags = theRegion->getElements();
+    } else if (strcmp(type, "-ele") == 0) {
+      int loc = eleTags.Size();
+      while (OPS_GetNumRemainingInputArgs() > 0) {
+	int eleTag;
+	if (OPS_GetIntInput(&numData, &eleTag) < 0) {
+	  OPS_ResetCurrentInputArg(-1);
+	  break;
+	}
+	eleTags[loc++] = eleTag;
+      }
+    } else if (strcmp(type, "-modes") == 0) {
+      if (OPS_GetNumRemainingInputArgs() < 2 ||
+	  OPS_GetIntInput(&numData, &numModes) < 0 ||
+	  OPS_GetIntInput(&numData, &modalNode) < 0 || numModes < 0) {
+	opserr << "WARNING -modes numModes modalNodeTag - superElement " << tag << endln;
+	return 0;
+      }
+    } else {
+      opserr << "WARNING unknown option " << type << " - superElement " << tag << endln;
+      return 0;
+    }
+  }
+
+  return condenseRegion(tag, *theDomain, eleTags, numModes, modalNode);
+}
+
+
+// the rows of the basis for the equations eqns; an interior equation
+// takes its row of Psi, an interface equation a unit entry
+static void
+formBasis(const ID &eqns, int numInt, const Matrix &Psi, Matrix &Te)
+{
+  int numCol = Te.noCols();
+  for (int r=0; r<eqns.Size(); r++) {
+    int eqn = eqns(r);
+    if (eqn >= numInt)
+      Te(r, eqn-numInt) = 1.0;
+    else if (eqn >= 0)
+      for (int j=0; j<numCol; j++)
+	Te(r,j) = Psi(eqn,j);
+  }
+}
+
+
+// the modes of the region with the interface fixed, K11 phi = w^2 M11 phi,
+// placed in the columns numExt on of Psi. With a lumped mass positive on
+// all the interior equations the banded solver is used, otherwise the
+// dense generalized one.
+static int
+fixedInterfaceModes(Domain &theDomain, const ID &regionEles, ID **eleEqns,
+		    const ID &regionNodes, const ID &nodeStart, const ID &dofEqn,
+		    int numInt, int numModes, Matrix &Psi)
+{
+  int numEle = regionEles.Size();
+  int numNodes = regionNodes.Size();
+  int numExt = Psi.noCols() - numModes;
+
+  if (numModes > numInt) {
+    opserr << "WARNING superElement - the region has only " << numInt << " interior equations\n";
+    return -1;
+  }
+
+  // the interior equations of the elements and nodes, and the graph
+  Graph theGraph(numInt);
+  for (int i=0; i<numInt; i++)
+    theGraph.addVertex(new Vertex(i, i), false);
+
+  ID **intEqns = new ID *[numEle+numNodes];
+  Vector diagM(numInt);
+  bool lumped = true;
+  for (int i=0; i<numEle; i++) {
+    const ID &eqns = *eleEqns[i];
+    intEqns[i] = new ID(eqns);
+    for (int j=0; j<eqns.Size(); j++)
+      if (eqns(j) >= numInt)
+	(*intEqns[i])(j) = -1;
+
+    const ID &ids = *intEqns[i];
+    for (int j=0; j<ids.Size(); j++)
+      for (int k=j+1; k<ids.Size(); k++)
+	if (ids(j) >= 0 && ids(k) >= 0 && ids(j) != ids(k))
+	  theGraph.addEdge(ids(j), ids(k));
+
+    const Matrix &Me = theDomain.getElement(regionEles(i))->getMass();
+    for (int j=0; j<ids.Size(); j++)
+      for (int k=0; k<ids.Size(); k++)
+	if (j != k && Me(j,k) != 0.0)
+	  lumped = false;
+	else if (j == k && ids(j) >= 0)
+	  diagM(ids(j)) += Me(j,j);
+  }
+
+  for (int i=0; i<numNodes; i++) {
+    int numEqn = nodeStart(i+1) - nodeStart(i);
+    intEqns[numEle+i] = new ID(numEqn);
+    ID &ids = *intEqns[numEle+i];
+    for (int r=0; r<numEqn; r++) {
+      int eqn = dofEqn(nodeStart(i)+r);
+      ids(r) = (eqn < numInt) ? eqn : -1;
+    }
+    const Matrix &Mn = theDomain.getNode(regionNodes(i))->getMass();
+    for (int j=0; j<numEqn; j++)
+      for (int k=0; k<numEqn; k++)
+	if (j != k && Mn(j,k) != 0.0)
+	  lumped = false;
+	else if (j == k && ids(j) >= 0)
+	  diagM(ids(j)) += Mn(j,j);
+  }
+
+  for (int i=0; i<numInt; i++)
+    if (diagM(i) <= 0.0)
+      lumped = false;
+
+  AnalysisModel theModel;
+  EigenSOE *theEigenSOE = 0;
+  if (lumped == true)
+    theEigenSOE = new SymBandEigenSOE(*(new SymBandEigenSolver()), theModel);
+  else
+    theEigenSOE = new FullGenEigenSOE(*(new FullGenEigenSolver()), theModel);
+
+  int ok = theEigenSOE->setSize(theGraph);
+  for (int i=0; i<numEle && ok >= 0; i++) {
+    Element *theEle = theDomain.getElement(regionEles(i));
+    if (theEigenSOE->addA(theEle->getTangentStiff(), *intEqns[i]) < 0 ||
+	theEigenSOE->addM(theEle->getMass(), *intEqns[i]) < 0)
+      ok = -1;
+  }
+  for (int i=0; i<numNodes && ok >= 0; i++) {
+    Node *theNode = theDomain.getNode(regionNodes(i));
+    if (theEigenSOE->addM(theNode->getMass(), *intEqns[numEle+i]) < 0)
+      ok = -1;
+  }
+
+  for (int i=0; i<numEle+numNodes; i++)
+    delete intEqns[i];
+  delete [] intEqns;
+
+  if (ok >= 0)
+    ok = theEigenSOE->solve(numModes, true, true);
+
+  for (int m=0; m<numModes && ok >= 0; m++) {
+    double lambda = theEigenSOE->getEigenvalue(m+1);
+    if (!(lambda > 0.0) || lambda != lambda || lambda > 1.0e300)
+      ok = -1;
+    const Vector &phi = theEigenSOE->getEigenvector(m+1);
+    for (int i=0; i<numInt; i++)
+      Psi(i, numExt+m) = phi(i);
+  }
+
+  delete theEigenSOE;
+  return ok;
+}
+
+
+// the equations of the region are numbered with the interior ones first,
+// so that condenseA() leaves the condensed stiffness in the last rows
+static SuperElement *
+condenseRegion(int tag, Domain &theDomain, const ID &eleTags,
+	       int numModes, int modalNode)
+{
+  if (theDomain.getElement(tag) != 0) {
+    opserr << "WARNING superElement " << tag << " - an element with this tag already exists\n";
+    return 0;
+  }
+
+  if (numModes > 0 && theDomain.getNode(modalNode) != 0) {
+    opserr << "WARNING superElement " << tag << " - modal node " << modalNode << " already exists\n";
+    return 0;
+  }
+
+  int numEle = eleTags.Size();
+  if (numEle == 0) {
+    opserr << "WARNING superElement " << tag << " - no elements in the region\n";
+    return 0;
+  }
+
+  // the elements and nodes of the region, both in order of their tags
+  ID regionEles(0, numEle);
+  ID regionNodes(0, 4*numEle);
+  for (int i=0; i<numEle; i++) {
+    Element *theEle = theDomain.getElement(eleTags(i));
+    if (theEle == 0) {
+      opserr << "WARNING superElement " << tag << " - element " << eleTags(i) << " does not exist\n";
+      return 0;
+    }
+    regionEles.insert(eleTags(i));
+    const ID &eleNodes = theEle->getExternalNodes();
+    for (int j=0; j<eleNodes.Size(); j++)
+      regionNodes.insert(eleNodes(j));
+  }
+  numEle = regionEles.Size();
+  int numNodes = regionNodes.Size();
+
+  //
+  // find the interface nodes
+  //
+
+  ID isExt(numNodes);
+  isExt.Zero();
+
+  Element *theEle;
+  ElementIter &theEles = theDomain.getElements();
+  while ((theEle = theEles()) != 0) {
+    if (regionEles.getLocationOrdered(theEle->getTag()) >= 0)
+      continue;
+    const ID &eleNodes = theEle->getExternalNodes();
+    for (int j=0; j<eleNodes.Size(); j++) {
+      int loc = regionNodes.getLocationOrdered(eleNodes(j));
+      if (loc >= 0)
+	isExt(loc) = 1;
+    }
+  }
+
+  MP_Constraint *theMP;
+  MP_ConstraintIter &theMPs = theDomain.getMPs();
+  while ((theMP = theMPs()) != 0) {
+    int loc = regionNodes.getLocationOrdered(theMP->getNodeRetained());
+    if (loc >= 0)
+      isExt(loc) = 1;
+    loc = regionNodes.getLocationOrdered(theMP->getNodeConstrained());
+    if (loc >= 0)
+      isExt(loc) = 1;
+  }
+
+  SP_Constraint *theSP;
+  SP_ConstraintIter &theSPs = theDomain.getSPs();
+  while ((theSP = theSPs()) != 0) {
+    int loc = regionNodes.getLocationOrdered(theSP->getNodeTag());
+    if (loc >= 0 && theSP->isHomogeneous() == false)
+      isExt(loc) = 1;
+  }
+
+  LoadPattern *thePattern;
+  LoadPatternIter &thePatterns = theDomain.getLoadPatterns();
+  while ((thePattern = thePatterns()) != 0) {
+    NodalLoad *theNodalLoad;
+    NodalLoadIter &theNodalLoads = thePattern->getNodalLoads();
+    while ((theNodalLoad = theNodalLoads()) != 0) {
+      int loc = regionNodes.getLocationOrdered(theNodalLoad->getNodeTag());
+      if (loc >= 0)
+	isExt(loc) = 1;
+    }
+
+    SP_ConstraintIter &thePatternSPs = thePattern->getSPs();
+    while ((theSP = thePatternSPs()) != 0) {
+      int loc = regionNodes.getLocationOrdered(theSP->getNodeTag());
+      if (loc >= 0)
+	isExt(loc) = 1;
+    }
+
+    ElementalLoad *theEleLoad;
+    ElementalLoadIter &theEleLoads = thePattern->getElementalLoads();
+    while ((theEleLoad = theEleLoads()) != 0) {
+      if (regionEles.getLocationOrdered(theEleLoad->getElementTag()) >= 0) {
+	opserr << "WARNING superElement " << tag << " - element " << theEleLoad->getElementTag();
+	opserr << " has an elemental load in pattern " << thePattern->getTag() << endln;
+	return 0;
+      }
+    }
+  }
+
+  //
+  // number the equations, -1 for the fixed dof of the interior nodes
+  //
+
+  ID nodeStart(numNodes+1);
+  nodeStart(0) = 0;
+  for (int i=0; i<numNodes; i++) {
+    Node *theNode = theDomain.getNode(regionNodes(i));
+    if (theNode == 0) {
+      opserr << "WARNING superElement " << tag << " - node " << regionNodes(i) << " does not exist\n";
+      return 0;
+    }
+    nodeStart(i+1) = nodeStart(i) + theNode->getNumberDOF();
+  }
+
+  ID dofEqn(nodeStart(numNodes));
+  dofEqn.Zero();
+
+  ID fixedSPs(0, 16);
+  int numFixedSPs = 0;
+  SP_ConstraintIter &theFixities = theDomain.getSPs();
+  while ((theSP = theFixities()) != 0) {
+    int loc = regionNodes.getLocationOrdered(theSP->getNodeTag());
+    if (loc >= 0 && isExt(loc) == 0) {
+      dofEqn(nodeStart(loc) + theSP->getDOF_Number()) = -1;
+      fixedSPs[numFixedSPs++] = theSP->getTag();
+    }
+  }
+
+  int numInt = 0;
+  int numExt = 0;
+  int numExtNodes = 0;
+  for (int i=0; i<numNodes; i++)
+    if (isExt(i) == 0) {
+      for (int j=nodeStart(i); j<nodeStart(i+1); j++)
+	if (dofEqn(j) == 0)
+	  dofEqn(j) = numInt++;
+    } else
+      numExtNodes++;
+
+  ID extNodes(numExtNodes);
+  numExtNodes = 0;
+  for (int i=0; i<numNodes; i++)
+    if (isExt(i) != 0) {
+      extNodes(numExtNodes++) = regionNodes(i);
+      for (int j=nodeStart(i); j<nodeStart(i+1); j++)
+	dofEqn(j) = numInt + numExt++;
+    }
+
+  if (numInt == 0 || numExt == 0) {
+    opserr << "WARNING superElement " << tag << " - the region has " << numInt;
+    opserr << " interior and " << numExt << " interface equations, nothing to condense\n";
+    return 0;
+  }
+  int size = numInt + numExt;
+
+  // the equations of each element
+  ID **eleEqns = new ID *[numEle];
+  for (int i=0; i<numEle; i++) {
+    theEle = theDomain.getElement(regionEles(i));
+    const ID &eleNodes = theEle->getExternalNodes();
+    eleEqns[i] = new ID(theEle->getNumDOF());
+    int loc = 0;
+    for (int j=0; j<eleNodes.Size(); j++) {
+      int nodeLoc = regionNodes.getLocationOrdered(eleNodes(j));
+      for (int k=nodeStart(nodeLoc); k<nodeStart(nodeLoc+1) && loc<eleEqns[i]->Size(); k++)
+	(*eleEqns[i])(loc++) = dofEqn(k);
+    }
+  }
+
+  //
+  // assemble and condense the stiffness
+  //
+
+  // the profile from the lowest equation each equation is coupled to
+  int *iLoc = new int[size];
+  for (int i=0; i<size; i++)
+    iLoc[i] = i;
+  for (int i=0; i<numEle; i++) {
+    const ID &eqns = *eleEqns[i];
+    int minEqn = size;
+    for (int j=0; j<eqns.Size(); j++)
+      if (eqns(j) >= 0 && eqns(j) < minEqn)
+	minEqn = eqns(j);
+    for (int j=0; j<eqns.Size(); j++)
+      if (eqns(j) >= 0 && minEqn < iLoc[eqns(j)])
+	iLoc[eqns(j)] = minEqn;
+  }
+  iLoc[0] = 1;  // NOTE FORTRAN ARRAY LOCATION
+  for (int i=1; i<size; i++)
+    iLoc[i] = iLoc[i-1] + i - iLoc[i] + 1;
+
+  ProfileSPDLinSubstrSolver *theSolver = new ProfileSPDLinSubstrSolver();
+  ProfileSPDLinSOE *theSOE = new ProfileSPDLinSOE(size, iLoc, *theSolver);
+  delete [] iLoc;
+
+  for (int i=0; i<numEle; i++) {
+    theEle = theDomain.getElement(regionEles(i));
+    theSOE->addA(theEle->getTangentStiff(), *eleEqns[i]);
+  }
+
+  int ok = theSolver->condenseA(numInt);
+  Matrix K(theSolver->getCondensedA());
+  for (int i=0; i<numExt && ok == 0; i++)
+    if (!(K(i,i) > 0.0))
+      ok = -1;
+  if (ok != 0) {
+    opserr << "WARNING superElement " << tag << " - failed to condense the stiffness, ";
+    opserr << "the interior of the region must be restrained by the interface\n";
+    for (int i=0; i<numEle; i++)
+      delete eleEqns[i];
+    delete [] eleEqns;
+    delete theSOE;
+    return 0;
+  }
+
+  // the interior displacements of the unit interface displacements, the
+  // first numExt columns of the basis
+  int numBasis = numExt + numModes;
+  Matrix Psi(numInt, numBasis);
+  for (int j=0; j<numExt; j++) {
+    theSOE->zeroB();
+    for (int k=0; k<numExt; k++)
+      theSOE->setX(numInt+k, 0.0);
+    theSOE->setX(numInt+j, 1.0);
+    theSolver->solveXint();
+    const Vector &X = theSOE->getX();
+    for (int i=0; i<numInt; i++)
+      Psi(i,j) = X(i);
+  }
+  delete theSOE;
+
+  // the fixed interface modes, the last numModes columns of the basis
+  if (numModes > 0 &&
+      fixedInterfaceModes(theDomain, regionEles, eleEqns, regionNodes, nodeStart,
+			  dofEqn, numInt, numModes, Psi) < 0) {
+    opserr << "WARNING superElement " << tag << " - failed to find " << numModes;
+    opserr << " fixed interface modes of the region\n";
+    for (int i=0; i<numEle; i++)
+      delete eleEqns[i];
+    delete [] eleEqns;
+    return 0;
+  }
+
+  //
+  // reduce the mass and damping of the elements and the nodal masses,
+  // and with modes the stiffness, onto the basis
+  //
+
+  if (numModes > 0) {
+    Matrix Kc(K);
+    K.resize(numBasis, numBasis);
+    K.Zero();
+    for (int i=0; i<numExt; i++)
+      for (int j=0; j<numExt; j++)
+	K(i,j) = Kc(i,j);
+  }
+
+  Matrix M(numBasis, numBasis);
+  Matrix C(numBasis, numBasis);
+  for (int i=0; i<numEle; i++) {
+    theEle = theDomain.getElement(regionEles(i));
+    const ID &eqns = *eleEqns[i];
+
+    Matrix Te(eqns.Size(), numBasis);
+    formBasis(eqns, numInt, Psi, Te);
+
+    const Matrix &Me = theEle->getMass();
+    if (isZero(Me) == false)
+      M.addMatrixTripleProduct(1.0, Te, Me, 1.0);
+    const Matrix &Ce = theEle->getDamp();
+    if (isZero(Ce) == false)
+      C.addMatrixTripleProduct(1.0, Te, Ce, 1.0);
+
+    // the modal stiffness, the modes are K orthogonal to the
+    // constraint modes so only that block is needed
+    if (numModes > 0) {
+      Matrix Tm(eqns.Size(), numModes);
+      for (int r=0; r<eqns.Size(); r++)
+	if (eqns(r) >= 0 && eqns(r) < numInt)
+	  for (int j=0; j<numModes; j++)
+	    Tm(r,j) = Psi(eqns(r), numExt+j);
+      Matrix Km(numModes, numModes);
+      Km.addMatrixTripleProduct(0.0, Tm, theEle->getTangentStiff(), 1.0);
+      for (int k=0; k<numModes; k++)
+	for (int j=0; j<numModes; j++)
+	  K(numExt+k, numExt+j) += Km(k,j);
+    }
+
+    delete eleEqns[i];
+  }
+  delete [] eleEqns;
+
+  // the interface nodes keep their own mass
+  for (int i=0; i<numNodes; i++) {
+    if (isExt(i) != 0)
+      continue;
+    Node *theNode = theDomain.getNode(regionNodes(i));
+    const Matrix &Mn = theNode->getMass();
+    if (isZero(Mn) == true)
+      continue;
+    int numEqn = nodeStart(i+1) - nodeStart(i);
+    ID eqns(numEqn);
+    for (int r=0; r<numEqn; r++)
+      eqns(r) = dofEqn(nodeStart(i)+r);
+    Matrix Tn(numEqn, numBasis);
+    formBasis(eqns, numInt, Psi, Tn);
+    M.addMatrixTripleProduct(1.0, Tn, Mn, 1.0);
+  }
+
+  // scale the modes to unit modal mass
+  for (int m=numExt; m<numBasis; m++) {
+    double scale = 1.0/sqrt(M(m,m));
+    for (int j=0; j<numBasis; j++) {
+      K(m,j) *= scale; K(j,m) *= scale;
+      M(m,j) *= scale; M(j,m) *= scale;
+      C(m,j) *= scale; C(j,m) *= scale;
+    }
+  }
+
+  //
+  // replace the region by the SuperElement
+  //
+
+  for (int i=0; i<numEle; i++) {
+    Element *theRemoved = theDomain.removeElement(regionEles(i));
+    if (theRemoved != 0)
+      delete theRemoved;
+  }
+
+  for (int i=0; i<numFixedSPs; i++) {
+    SP_Constraint *theRemoved = theDomain.removeSP_Constraint(fixedSPs(i));
+    if (theRemoved != 0)
+      delete theRemoved;
+  }
+
+  for (int i=0; i<numNodes; i++)
+    if (isExt(i) == 0) {
+      Node *theRemoved = theDomain.removeNode(regionNodes(i));
+      if (theRemoved != 0)
+	delete theRemoved;
+    }
+
+  // the modal coordinates are the dof of a node added at the first
+  // interface node
+  if (numModes > 0) {
+    Node *theNode = theDomain.getNode(extNodes(0));
+    const Vector &crds = theNode->getCrds();
+    Node *theModalNode = 0;
+    if (crds.Size() == 1)
+      theModalNode = new Node(modalNode, numModes, crds(0));
+    else if (crds.Size() == 2)
+      theModalNode = new Node(modalNode, numModes, crds(0), crds(1));
+    else
+      theModalNode = new Node(modalNode, numModes, crds(0), crds(1), crds(2));
+    if (theDomain.addNode(theModalNode) == false) {
+      opserr << "WARNING superElement " << tag << " - failed to add modal node " << modalNode << endln;
+      delete theModalNode;
+      return 0;
+    }
+    extNodes[extNodes.Size()] = modalNode;
+  }
+
+  return new SuperElement(tag, extNodes, K, M, C);
+}
+
+
+SuperElement::SuperElement(int tag, const ID &nodes,
+			   const Matrix &k, const Matrix &m, const Matrix &c)
+  :Element(tag, ELE_TAG_SuperElement),
+   connectedExternalNodes(nodes), theNodes(0), numDOF(0),
+   K(0), M(0), C(0), D(0), P(0), theLoad(0), work(0)
+{
+  if (this->setSize(nodes.Size(), k.noRows()) < 0)
+    exit(-1);
+
+  *K = k;
+  *M = m;
+  *C = c;
+}
+
+
+SuperElement::SuperElement()
+  :Element(0, ELE_TAG_SuperElement),
+   connectedExternalNodes(0), theNodes(0), numDOF(0),
+   K(0), M(0), C(0), D(0), P(0), theLoad(0), work(0)
+{
+  // does nothing
+}
+
+
+SuperElement::~SuperElement()
+{
+  if (theNodes != 0) delete [] theNodes;
+  if (K != 0) delete K;
+  if (M != 0) delete M;
+  if (C != 0) delete C;
+  if (D != 0) delete D;
+  if (P != 0) delete P;
+  if (theLoad != 0) delete theLoad;
+  if (work != 0) delete work;
+}
+
+
+int
+SuperElement::setSize(int numNodes, int ndof)
+{
+  if (theNodes != 0) delete [] theNodes;
+  if (K != 0) delete K;
+  if (M != 0) delete M;
+  if (C != 0) delete C;
+  if (D != 0) delete D;
+  if (P != 0) delete P;
+  if (theLoad != 0) delete theLoad;
+  if (work != 0) delete work;
+
+  numDOF = ndof;
+  theNodes = new Node *[numNodes];
+  for (int i=0; i<numNodes; i++)
+    theNodes[i] = 0;
+
+  K = new Matrix(numDOF, numDOF);
+  M = new Matrix(numDOF, numDOF);
+  C = new Matrix(numDOF, numDOF);
+  D = new Matrix(numDOF, numDOF);
+  P = new Vector(numDOF);
+  theLoad = new Vector(numDOF);
+  work = new Vector(numDOF);
+
+  if (theNodes == 0 || K == 0 || M == 0 || C == 0 || D == 0 ||
+      P == 0 || theLoad == 0 || work == 0 || work->Size() != numDOF) {
+    opserr << "SuperElement::setSize() - out of memory for " << numDOF << " dof\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+
+int
+SuperElement::getNumExternalNodes(void) const
+{
+  return connectedExternalNodes.Size();
+}
+
+
+const ID &
+SuperElement::getExternalNodes(void)
+{
+  return connectedExternalNodes;
+}
+
+
+Node **
+SuperElement::getNodePtrs(void)
+{
+  return theNodes;
+}
+
+
+int
+SuperElement::getNumDOF(void)
+{
+  return numDOF;
+}
+
+
+void
+SuperElement::setDomain(Domain *theDomain)
+{
+  if (theDomain == 0) {
+    this->DomainComponent::setDomain(0);
+    return;
+  }
+
+  int numNodes = connectedExternalNodes.Size();
+  int ndof = 0;
+  for (int i=0; i<numNodes; i++) {
+    theNodes[i] = theDomain->getNode(connectedExternalNodes(i));
+    if (theNodes[i] == 0) {
+      opserr << "SuperElement::setDomain() - element " << this->getTag();
+      opserr << " node " << connectedExternalNodes(i) << " does not exist\n";
+      return;
+    }
+    ndof += theNodes[i]->getNumberDOF();
+  }
+
+  if (ndof != numDOF) {
+    opserr << "SuperElement::setDomain() - element " << this->getTag();
+    opserr << " has " << numDOF << " dof but its nodes have " << ndof << endln;
+    return;
+  }
+
+  this->DomainComponent::setDomain(theDomain);
+}
+
+
+int
+SuperElement::commitState(void)
+{
+  int retVal = 0;
+  if ((retVal = this->Element::commitState()) != 0) {
+    opserr << "SuperElement::commitState () - failed in base class";
+  }
+  return retVal;
+}
+
+
+int
+SuperElement::revertToLastCommit(void)
+{
+  return 0;
+}
+
+
+int
+SuperElement::revertToStart(void)
+{
+  return 0;
+}
+
+
+int
+SuperElement::update(void)
+{
+  return 0;
+}
+
+
+const Matrix &
+SuperElement::getTangentStiff(void)
+{
+  return *K;
+}
+
+
+const Matrix &
+SuperElement::getInitialStiff(void)
+{
+  return *K;
+}
+
+
+// the condensed damping of the region plus any Rayleigh damping
+// assigned to the SuperElement itself
+const Matrix &
+SuperElement::getDamp(void)
+{
+  *D = *C;
+  if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
+    D->addMatrix(1.0, this->Element::getDamp(), 1.0);
+
+  return *D;
+}
+
+
+const Matrix &
+SuperElement::getMass(void)
+{
+  return *M;
+}
+
+
+void
+SuperElement::zeroLoad(void)
+{
+  theLoad->Zero();
+}
+
+
+int
+SuperElement::addLoad(ElementalLoad *theLoad, double loadFactor)
+{
+  opserr << "SuperElement::addLoad() - element " << this->getTag();
+  opserr << " does not accept elemental loads\n";
+  return -1;
+}
+
+
+int
+SuperElement::addInertiaLoadToUnbalance(const Vector &accel)
+{
+  // want to add ( - M R * accel ) to unbalance
+  int loc = 0;
+  int numNodes = connectedExternalNodes.Size();
+  for (int i=0; i<numNodes; i++) {
+    const Vector &Raccel = theNodes[i]->getRV(accel);
+    for (int j=0; j<Raccel.Size(); j++)
+      (*work)(loc++) = Raccel(j);
+  }
+
+  theLoad->addMatrixVector(1.0, *M, *work, -1.0);
+
+  return 0;
+}
+
+
+// the displacements (0), velocities (1) or accelerations (2) of the
+// nodes of the element
+const Vector &
+SuperElement::getNodalVector(int type)
+{
+  int loc = 0;
+  int numNodes = connectedExternalNodes.Size();
+  for (int i=0; i<numNodes; i++) {
+    const Vector &u = (type == 0) ? theNodes[i]->getTrialDisp() :
+      (type == 1) ? theNodes[i]->getTrialVel() : theNodes[i]->getTrialAccel();
+    for (int j=0; j<u.Size(); j++)
+      (*work)(loc++) = u(j);
+  }
+
+  return *work;
+}
+
+
+const Vector &
+SuperElement::getResistingForce(void)
+{
+  P->addMatrixVector(0.0, *K, this->getNodalVector(0), 1.0);
+  P->addVector(1.0, *theLoad, -1.0);
+
+  return *P;
+}
+
+
+const Vector &
+SuperElement::getResistingForceIncInertia(void)
+{
+  this->getResistingForce();
+
+  P->addMatrixVector(1.0, *M, this->getNodalVector(2), 1.0);
+  P->addMatrixVector(1.0, this->getDamp(), this->getNodalVector(1), 1.0);
+
+  return *P;
+}
+
+
+int
+SuperElement::sendSelf(int commitTag, Channel &theChannel)
+{
+  int dbTag = this->getDbTag();
+
+  static ID idData(3);
+  idData(0) = this->getTag();
+  idData(1) = connectedExternalNodes.Size();
+  idData(2) = numDOF;
+  if (theChannel.sendID(dbTag, commitTag, idData) < 0) {
+    opserr << "SuperElement::sendSelf() - failed to send ID data\n";
+    return -1;
+  }
+
+  if (theChannel.sendID(dbTag, commitTag, connectedExternalNodes) < 0) {
+    opserr << "SuperElement::sendSelf() - failed to send the nodes\n";
+    return -2;
+  }
+
+  static Vector data(4);
+  data(0) = alphaM;
+  data(1) = betaK;
+  data(2) = betaK0;
+  data(3) = betaKc;
+  if (theChannel.sendVector(dbTag, commitTag, data) < 0) {
+    opserr << "SuperElement::sendSelf() - failed to send Vector data\n";
+    return -3;
+  }
+
+  if (theChannel.sendMatrix(dbTag, commitTag, *K) < 0 ||
+      theChannel.sendMatrix(dbTag, commitTag, *M) < 0 ||
+      theChannel.sendMatrix(dbTag, commitTag, *C) < 0) {
+    opserr << "SuperElement::sendSelf() - failed to send the matrices\n";
+    return -4;
+  }
+
+  return 0;
+}
+
+
+int
+SuperElement::recvSelf(int commitTag, Channel &theChannel,
+		       FEM_ObjectBroker &theBroker)
+{
+  int dbTag = this->getDbTag();
+
+  static ID idData(3);
+  if (theChannel.recvID(dbTag, commitTag, idData) < 0) {
+    opserr << "SuperElement::recvSelf() - failed to receive ID data\n";
+    return -1;
+  }
+  this->setTag(idData(0));
+
+  connectedExternalNodes.resize(idData(1));
+  if (this->setSize(idData(1), idData(2)) < 0)
+    return -1;
+
+  if (theChannel.recvID(dbTag, commitTag, connectedExternalNodes) < 0) {
+    opserr << "SuperElement::recvSelf() - failed to receive the nodes\n";
+    return -2;
+  }
+
+  static Vector data(4);
+  if (theChannel.recvVector(dbTag, commitTag, data) < 0) {
+    opserr << "SuperElement::recvSelf() - failed to receive Vector data\n";
+    return -3;
+  }
+  if (data(0) != 0.0 || data(1) != 0.0 || data(2) != 0.0 || data(3) != 0.0)
+    this->setRayleighDampingFactors(data(0), data(1), data(2), data(3));
+
+  if (theChannel.recvMatrix(dbTag, commitTag, *K) < 0 ||
+      theChannel.recvMatrix(dbTag, commitTag, *M) < 0 ||
+      theChannel.recvMatrix(dbTag, commitTag, *C) < 0) {
+    opserr << "SuperElement::recvSelf() - failed to receive the matrices\n";
+    return -4;
+  }
+
+  return 0;
+}
+
+
+void
+SuperElement::Print(OPS_Stream &s, int flag)
+{
+  s << "Element: " << this->getTag() << " type: SuperElement";
+  s << " numDOF: " << numDOF << endln;
+  s << "  Connected Nodes: " << connectedExternalNodes;
+  if (flag == 1) {
+    s << "  Condensed Stiffness: " << *K;
+    s << "  Condensed Mass: " << *M;
+  }
+}
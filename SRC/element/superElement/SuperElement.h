@@ -0,0 +1,118 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/superElement/SuperElement.h,v $
+
+#ifndef SuperElement_h
+#define SuperElement_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for SuperElement.
+// A SuperElement replaces a region of linear elements by its stiffness,
+// mass and damping condensed onto the nodes of the region shared with the
+// rest of the model. OPS_SuperElement() assembles the region into a
+// ProfileSPDLinSOE with the interior equations numbered first, condenses
+// the stiffness with ProfileSPDLinSubstrSolver::condenseA() and reduces
+// the mass and damping with the same static modes, T = [-K11^-1 K12; I]
+// (Guyan reduction). The elements of the region, its interior nodes and
+// the fixities of these nodes are then removed from the Domain.
+//
+// With -modes the basis is extended by numModes fixed interface modes,
+// K11 phi = w^2 M11 phi, found with a SymBandEigenSOE for a lumped mass and
+// a FullGenEigenSOE otherwise (Craig-Bampton reduction). Their modal
+// coordinates are the dof of a node added to the Domain for the element,
+// and the modes are scaled to unit modal mass, so that the modal block of
+// the stiffness is diag(w^2).
+//
+// The interface nodes are those of the region connected to an element
+// outside it, used by a multi-point constraint, or loaded by a nodal load
+// or a load pattern's single-point constraint. Elemental loads on the
+// region are not condensed and so are an error. The response of the
+// interior nodes is not recovered.
+
+// What: "@(#) SuperElement.h, revA"
+
+#include <Element.h>
+#include <Matrix.h>
+#include <Vector.h>
+
+class Channel;
+class Domain;
+
+class SuperElement : public Element
+{
+  public:
+    SuperElement(int tag, const ID &nodes,
+		 const Matrix &K, const Matrix &M, const Matrix &C);
+    SuperElement();
+    ~SuperElement();
+
+    const char *getClassType(void) const {return "SuperElement";};
+
+    int getNumExternalNodes(void) const;
+    const ID &getExternalNodes(void);
+    Node **getNodePtrs(void);
+
+    int getNumDOF(void);
+    void setDomain(Domain *theDomain);
+
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+    int update(void);
+
+    const Matrix &getTangentStiff(void);
+    const Matrix &getInitialStiff(void);
+    const Matrix &getDamp(void);
+    const Matrix &getMass(void);
+
+    void zeroLoad(void);
+    int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int addInertiaLoadToUnbalance(const Vector &accel);
+
+    const Vector &getResistingForce(void);
+    const Vector &getResistingForceIncInertia(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  protected:
+
+  private:
+    int setSize(int numNodes, int ndof);
+    const Vector &getNodalVector(int type);
+
+    ID connectedExternalNodes;
+    Node **theNodes;
+    int numDOF;
+
+    Matrix *K, *M, *C;   // the condensed matrices
+    Matrix *D;           // C plus the Rayleigh damping of the element
+    Vector *P;           // the resisting force
+    Vector *theLoad;     // the inertia load
+    Vector *work;        // the displacement, velocity or accel of the nodes
+};
+
+#endif
@@ -98,6 +98,7 @@ SurfaceLoad::SurfaceLoad(int tag, int Nd1, int Nd2, int Nd3, int Nd4, double pre
    myExternalNodes(SL_NUM_NODE),
    tangentStiffness(SL_NUM_DOF, SL_NUM_DOF),
    internalForces(SL_NUM_DOF),
+   refLoad(SL_NUM_DOF),
    g1(SL_NUM_NDF), 
    g2(SL_NUM_NDF),
    myNhat(SL_NUM_NDF), 
@@ -133,6 +134,7 @@ SurfaceLoad::SurfaceLoad()
    	myExternalNodes(SL_NUM_NODE),
    	tangentStiffness(SL_NUM_DOF, SL_NUM_DOF),
    	internalForces(SL_NUM_DOF),
+   	refLoad(SL_NUM_DOF),
    	g1(SL_NUM_NDF), 
    	g2(SL_NUM_NDF),
    	myNhat(SL_NUM_NDF), 
@@ -142,6 +144,8 @@ SurfaceLoad::SurfaceLoad()
    	dcrd3(SL_NUM_NDF),
    	dcrd4(SL_NUM_NDF)
 {
+    my_pressure = 0.0;
+    mLoadFactor = 1.0;
 }
 
 //  destructor:
@@ -191,6 +195,16 @@ SurfaceLoad::setDomain(Domain *theDomain)
     dcrd3 = theNodes[2]->getCrds();
     dcrd4 = theNodes[3]->getCrds();
 
+    // the pressure acts on the undeformed surface, so its nodal forces
+    // are formed once here and only scaled by the load factor
+    refLoad.Zero();
+    for(int i = 0; i < 4; i++) {
+	this->UpdateBase(GsPts[i][0],GsPts[i][1]);
+	for(int j = 0; j < 4; j++)
+	    for(int k = 0; k < 3; k++)
+		refLoad(j*3+k) += my_pressure*myNhat(k)*myNI(j);
+    }
+
     // call the base class method
     this->DomainComponent::setDomain(theDomain);
 }
@@ -289,6 +303,19 @@ SurfaceLoad::addLoad(ElementalLoad *theLoad, double loadFactor)
 	return -1;
 }
 
+const Vector *
+SurfaceLoad::getReferenceLoad(ElementalLoad *theLoad)
+{
+	int type;
+	theLoad->getData(type, 1.0);
+	if (type != LOAD_TAG_SurfaceLoader)
+		return 0;
+
+	// the LoadPattern now applies the pressure as nodal loads
+	mLoadFactor = 0.0;
+	return &refLoad;
+}
+
 int 
 SurfaceLoad::addInertiaLoadToUnbalance(const Vector &accel)
 {
@@ -298,20 +325,7 @@ SurfaceLoad::addInertiaLoadToUnbalance(const Vector &accel)
 const Vector &
 SurfaceLoad::getResistingForce()
 {
-	internalForces.Zero();
-
-	// loop over Gauss points
-	for(int i = 0; i < 4; i++) {
-		this->UpdateBase(GsPts[i][0],GsPts[i][1]);
-
-		// loop over nodes
-		for(int j = 0; j < 4; j++) {
-			// loop over dof
-			for(int k = 0; k < 3; k++) {
-				internalForces[j*3+k] = internalForces[j*3+k] - mLoadFactor*my_pressure*myNhat(k)*myNI(j);
-			}
-		}
-	}
+	internalForces.addVector(0.0, refLoad, -mLoadFactor);
 
 	return internalForces;
 }
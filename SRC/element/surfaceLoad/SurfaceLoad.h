@@ -78,6 +78,7 @@ class SurfaceLoad : public Element
 
     void zeroLoad(void);	
     int addLoad(ElementalLoad *theLoad, double loadFactor);
+    const Vector *getReferenceLoad(ElementalLoad *theLoad);
     int addInertiaLoadToUnbalance(const Vector &accel);
     const Vector &getResistingForce(void);
     const Vector &getResistingForceIncInertia(void);            
@@ -103,6 +104,7 @@ class SurfaceLoad : public Element
     ID  myExternalNodes;      // contains the tags of the end nodes
     Matrix tangentStiffness;  // Tangent Stiffness matrix
     Vector internalForces;    // vector of Internal Forces
+    Vector refLoad;           // nodal forces of the pressure at a load factor of 1
     Vector theVector;         // vector to return the residual
 
     double my_pressure;       // pressure applied to surface of element
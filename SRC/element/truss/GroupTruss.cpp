@@ -0,0 +1,379 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/truss/GroupTruss.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of GroupTruss.
+//
+// What: "@(#) GroupTruss.cpp, revA"
+
+#include <GroupTruss.h>
+#include <TrussGroup.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Vector.h>
+#include <Information.h>
+#include <ElementResponse.h>
+#include <UniaxialMaterial.h>
+#include <Workspace.h>
+#include <elementAPI.h>
+#include <string.h>
+
+// keys identifying the Workspace objects of the bars
+static char matrixKey;
+static char vectorKey;
+
+GroupTruss::GroupTruss(int tag, TrussGroup &group, int b, int Nd1, int Nd2)
+  :Element(tag, ELE_TAG_GroupTruss), theGroup(&group), bar(b),
+   connectedExternalNodes(2), ndf(0), theLoad(0)
+{
+  connectedExternalNodes(0) = Nd1;
+  connectedExternalNodes(1) = Nd2;
+  theNodes[0] = 0;
+  theNodes[1] = 0;
+}
+
+GroupTruss::~GroupTruss()
+{
+  if (theLoad != 0)
+    delete theLoad;
+
+  // the last bar of the group deletes it
+  if (theGroup->removeBar() == 0)
+    delete theGroup;
+}
+
+int
+GroupTruss::getNumExternalNodes(void) const
+{
+  return 2;
+}
+
+const ID &
+GroupTruss::getExternalNodes(void)
+{
+  return connectedExternalNodes;
+}
+
+Node **
+GroupTruss::getNodePtrs(void)
+{
+  return theNodes;
+}
+
+int
+GroupTruss::getNumDOF(void)
+{
+  return 2*ndf;
+}
+
+void
+GroupTruss::setDomain(Domain *theDomain)
+{
+  if (theDomain == 0) {
+    theNodes[0] = 0;
+    theNodes[1] = 0;
+    return;
+  }
+
+  theNodes[0] = theDomain->getNode(connectedExternalNodes(0));
+  theNodes[1] = theDomain->getNode(connectedExternalNodes(1));
+  if (theNodes[0] == 0 || theNodes[1] == 0) {
+    opserr << "WARNING GroupTruss::setDomain() - bar " << this->getTag()
+	   << " node " << ((theNodes[0] == 0) ? connectedExternalNodes(0) : connectedExternalNodes(1))
+	   << " does not exist in the model\n";
+    return;
+  }
+
+  ndf = theNodes[0]->getNumberDOF();
+  if (ndf != theNodes[1]->getNumberDOF() || ndf < theGroup->getNDM()) {
+    opserr << "WARNING GroupTruss::setDomain() - bar " << this->getTag()
+	   << " nodes have differing or too few dofs\n";
+    ndf = 0;
+    return;
+  }
+
+  this->DomainComponent::setDomain(theDomain);
+
+  if (theGroup->setBar(bar, theNodes[0], theNodes[1]) < 0) {
+    opserr << "WARNING GroupTruss::setDomain() - bar " << this->getTag()
+	   << " has zero length\n";
+    return;
+  }
+
+  if (theLoad == 0)
+    theLoad = new Vector(2*ndf);
+  else if (theLoad->Size() != 2*ndf) {
+    delete theLoad;
+    theLoad = new Vector(2*ndf);
+  }
+}
+
+// the first bar of the group updates, commits and reverts all its bars
+
+int
+GroupTruss::commitState(void)
+{
+  int res = this->Element::commitState();
+  if (bar == 0)
+    res += theGroup->commitState();
+  return res;
+}
+
+int
+GroupTruss::revertToLastCommit(void)
+{
+  if (bar == 0)
+    return theGroup->revertToLastCommit();
+  return 0;
+}
+
+int
+GroupTruss::revertToStart(void)
+{
+  if (bar == 0)
+    return theGroup->revertToStart();
+  return 0;
+}
+
+int
+GroupTruss::update(void)
+{
+  if (bar == 0)
+    return theGroup->update();
+  return 0;
+}
+
+const Matrix &
+GroupTruss::formStiff(double kMat, double kGeo)
+{
+  int ndm = theGroup->getNDM();
+  const double *nb = theGroup->getDirection(bar);
+
+  Matrix &stiff = Workspace::getMatrix(&matrixKey, 2*ndf, 2*ndf);
+  stiff.Zero();
+
+  for (int i = 0; i < ndm; i++)
+    for (int j = 0; j < ndm; j++) {
+      double nn = nb[i]*nb[j];
+      double k = kMat*nn + kGeo*((i == j) ? 1.0 - nn : -nn);
+      stiff(i,j) = k;
+      stiff(i+ndf,j+ndf) = k;
+      stiff(i,j+ndf) = -k;
+      stiff(i+ndf,j) = -k;
+    }
+
+  return stiff;
+}
+
+const Matrix &
+GroupTruss::getTangentStiff(void)
+{
+  return this->formStiff(theGroup->getMaterialStiffness(bar),
+			 theGroup->getGeometricStiffness(bar));
+}
+
+const Matrix &
+GroupTruss::getInitialStiff(void)
+{
+  return this->formStiff(theGroup->getInitialStiffness(bar), 0.0);
+}
+
+const Matrix &
+GroupTruss::getMass(void)
+{
+  Matrix &mass = Workspace::getMatrix(&matrixKey, 2*ndf, 2*ndf);
+  mass.Zero();
+
+  // lumped mass matrix
+  double m = 0.5*theGroup->getRho()*theGroup->getL(bar);
+  if (m != 0.0)
+    for (int i = 0; i < theGroup->getNDM(); i++) {
+      mass(i,i) = m;
+      mass(i+ndf,i+ndf) = m;
+    }
+
+  return mass;
+}
+
+void
+GroupTruss::zeroLoad(void)
+{
+  if (theLoad != 0)
+    theLoad->Zero();
+}
+
+int
+GroupTruss::addLoad(ElementalLoad *theLoad, double loadFactor)
+{
+  opserr << "GroupTruss::addLoad - load type unknown for bar with tag: "
+	 << this->getTag() << endln;
+  return -1;
+}
+
+int
+GroupTruss::addInertiaLoadToUnbalance(const Vector &accel)
+{
+  double m = 0.5*theGroup->getRho()*theGroup->getL(bar);
+  if (m == 0.0 || theLoad == 0)
+    return 0;
+
+  const Vector &Raccel1 = theNodes[0]->getRV(accel);
+  const Vector &Raccel2 = theNodes[1]->getRV(accel);
+
+  for (int i = 0; i < theGroup->getNDM(); i++) {
+    (*theLoad)(i) -= m*Raccel1(i);
+    (*theLoad)(i+ndf) -= m*Raccel2(i);
+  }
+
+  return 0;
+}
+
+const Vector &
+GroupTruss::getResistingForce(void)
+{
+  int ndm = theGroup->getNDM();
+  const double *nb = theGroup->getDirection(bar);
+  double N = theGroup->getAxialForce(bar);
+
+  Vector &force = Workspace::getVector(&vectorKey, 2*ndf);
+  force.Zero();
+  for (int i = 0; i < ndm; i++) {
+    force(i) = -N*nb[i];
+    force(i+ndf) = N*nb[i];
+  }
+
+  return force;
+}
+
+const Vector &
+GroupTruss::getResistingForceIncInertia(void)
+{
+  Vector &force = (Vector &)this->getResistingForce();
+
+  if (theLoad != 0)
+    force -= *theLoad;
+
+  double m = 0.5*theGroup->getRho()*theGroup->getL(bar);
+  if (m != 0.0) {
+    const Vector &accel1 = theNodes[0]->getTrialAccel();
+    const Vector &accel2 = theNodes[1]->getTrialAccel();
+    for (int i = 0; i < theGroup->getNDM(); i++) {
+      force(i) += m*accel1(i);
+      force(i+ndf) += m*accel2(i);
+    }
+  }
+
+  if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
+    force.addVector(1.0, this->getRayleighDampingForces(), 1.0);
+
+  return force;
+}
+
+int
+GroupTruss::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "GroupTruss::sendSelf() - the bars of a truss group can not be sent\n";
+  return -1;
+}
+
+int
+GroupTruss::recvSelf(int commitTag, Channel &theChannel,
+		     FEM_ObjectBroker &theBroker)
+{
+  opserr << "GroupTruss::recvSelf() - the bars of a truss group can not be received\n";
+  return -1;
+}
+
+void
+GroupTruss::Print(OPS_Stream &s, int flag)
+{
+  s << "GroupTruss: " << this->getTag() << " bar " << bar << " of its group";
+  s << " iNode: " << connectedExternalNodes(0);
+  s << " jNode: " << connectedExternalNodes(1);
+  s << " Area: " << theGroup->getA() << " Mass/Length: " << theGroup->getRho() << endln;
+  s << " \t strain: " << theGroup->getStrain(bar);
+  s << " axial load: " << theGroup->getAxialForce(bar) << endln;
+}
+
+Response *
+GroupTruss::setResponse(const char **argv, int argc, OPS_Stream &output)
+{
+  Response *theResponse = 0;
+
+  output.tag("ElementOutput");
+  output.attr("eleType","GroupTruss");
+  output.attr("eleTag",this->getTag());
+  output.attr("node1",connectedExternalNodes[0]);
+  output.attr("node2",connectedExternalNodes[1]);
+
+  if ((strcmp(argv[0],"force") == 0) || (strcmp(argv[0],"forces") == 0)
+      || (strcmp(argv[0],"globalForce") == 0) || (strcmp(argv[0],"globalForces") == 0)) {
+    char outputData[10];
+    for (int i=0; i<ndf; i++) {
+      sprintf(outputData,"P1_%d", i+1);
+      output.tag("ResponseType", outputData);
+    }
+    for (int j=0; j<ndf; j++) {
+      sprintf(outputData,"P2_%d", j+1);
+      output.tag("ResponseType", outputData);
+    }
+    theResponse = new ElementResponse(this, 1, Vector(2*ndf));
+
+  } else if ((strcmp(argv[0],"axialForce") == 0) ||
+	     (strcmp(argv[0],"basicForce") == 0) ||
+	     (strcmp(argv[0],"basicForces") == 0)) {
+    output.tag("ResponseType", "N");
+    theResponse = new ElementResponse(this, 2, 0.0);
+
+  } else if (strcmp(argv[0],"deformation") == 0 ||
+	     strcmp(argv[0],"basicDeformation") == 0) {
+    output.tag("ResponseType", "U");
+    theResponse = new ElementResponse(this, 3, 0.0);
+
+  } else if (strcmp(argv[0],"material") == 0 || strcmp(argv[0],"-material") == 0) {
+    theResponse = theGroup->getMaterial(bar)->setResponse(&argv[1], argc-1, output);
+  }
+
+  output.endTag();
+  return theResponse;
+}
+
+int
+GroupTruss::getResponse(int responseID, Information &eleInfo)
+{
+  switch (responseID) {
+  case 1:
+    return eleInfo.setVector(this->getResistingForce());
+
+  case 2:
+    return eleInfo.setDouble(theGroup->getAxialForce(bar));
+
+  case 3:
+    return eleInfo.setDouble(theGroup->getL(bar)*theGroup->getStrain(bar));
+
+  default:
+    return 0;
+  }
+}
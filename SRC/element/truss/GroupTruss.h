@@ -0,0 +1,96 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/truss/GroupTruss.h,v $
+
+#ifndef GroupTruss_h
+#define GroupTruss_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for GroupTruss.
+// A GroupTruss is one bar of a TrussGroup. Its state is held in the
+// arrays of the group, which the first bar of the group updates, commits
+// and reverts for all the bars at once; the bar itself only forms its
+// matrices and vectors from them, the stiffness as the outer product of
+// the direction of the bar. The bars are created for a whole group by the
+// element trussGroup command.
+//
+// What: "@(#) GroupTruss.h, revA"
+
+#include <Element.h>
+#include <Matrix.h>
+
+class Node;
+class TrussGroup;
+
+class GroupTruss : public Element
+{
+  public:
+    GroupTruss(int tag, TrussGroup &theGroup, int bar, int Nd1, int Nd2);
+    ~GroupTruss();
+
+    const char *getClassType(void) const {return "GroupTruss";};
+
+    int getNumExternalNodes(void) const;
+    const ID &getExternalNodes(void);
+    Node **getNodePtrs(void);
+    int getNumDOF(void);
+    void setDomain(Domain *theDomain);
+
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+    int update(void);
+
+    const Matrix &getTangentStiff(void);
+    const Matrix &getInitialStiff(void);
+    const Matrix &getMass(void);
+
+    void zeroLoad(void);
+    int addLoad(ElementalLoad *theLoad, double loadFactor);
+    int addInertiaLoadToUnbalance(const Vector &accel);
+
+    const Vector &getResistingForce(void);
+    const Vector &getResistingForceIncInertia(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+    void Print(OPS_Stream &s, int flag = 0);
+
+    Response *setResponse(const char **argv, int argc, OPS_Stream &s);
+    int getResponse(int responseID, Information &eleInformation);
+
+  protected:
+
+  private:
+    const Matrix &formStiff(double kMat, double kGeo);
+
+    TrussGroup *theGroup;
+    int bar;                   // the index of the bar in the group
+    ID connectedExternalNodes;
+    Node *theNodes[2];
+    int ndf;                   // dofs per node
+    Vector *theLoad;
+};
+
+#endif
@@ -0,0 +1,165 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/truss/TclTrussGroupCommand.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// TclModelBuilder_addTrussGroup(), which creates the TrussGroup and the
+// GroupTruss bars of the command
+//
+//   element trussGroup startTag? matTag? A? <-rho rho?> <-corot>
+//           -bars iNode1? jNode1? iNode2? jNode2? ... | -file fileName?
+//
+// the bars taking the tags startTag, startTag+1, ..., and the file holding
+// the pairs of node tags.
+//
+// What: "@(#) TclTrussGroupCommand.cpp, revA"
+
+#include <stdlib.h>
+#include <string.h>
+#include <fstream>
+#include <vector>
+
+#include <Domain.h>
+#include <TclModelBuilder.h>
+#include <UniaxialMaterial.h>
+#include <TrussGroup.h>
+#include <GroupTruss.h>
+
+extern void printCommand(int argc, TCL_Char **argv);
+
+int
+TclModelBuilder_addTrussGroup(ClientData clientData, Tcl_Interp *interp,
+			      int argc, TCL_Char **argv,
+			      Domain *theTclDomain,
+			      TclModelBuilder *theTclBuilder)
+{
+  // ensure the destructor has not been called -
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed\n";
+    return TCL_ERROR;
+  }
+
+  int ndm = theTclBuilder->getNDM();
+  if (ndm != 2 && ndm != 3) {
+    opserr << "WARNING -- NDM = " << ndm << " not compatible with trussGroup element\n";
+    return TCL_ERROR;
+  }
+
+  if (argc < 7) {
+    opserr << "WARNING insufficient arguments\n";
+    printCommand(argc, argv);
+    opserr << "Want: element trussGroup startTag? matTag? A? <-rho rho?> <-corot> -bars iNode? jNode? ... | -file fileName?\n";
+    return TCL_ERROR;
+  }
+
+  int startTag, matTag;
+  double A;
+  if (Tcl_GetInt(interp, argv[2], &startTag) != TCL_OK) {
+    opserr << "WARNING invalid trussGroup startTag " << argv[2] << endln;
+    return TCL_ERROR;
+  }
+  if (Tcl_GetInt(interp, argv[3], &matTag) != TCL_OK) {
+    opserr << "WARNING invalid trussGroup matTag " << argv[3] << endln;
+    return TCL_ERROR;
+  }
+  if (Tcl_GetDouble(interp, argv[4], &A) != TCL_OK) {
+    opserr << "WARNING invalid trussGroup A " << argv[4] << endln;
+    return TCL_ERROR;
+  }
+
+  UniaxialMaterial *theMaterial = OPS_getUniaxialMaterial(matTag);
+  if (theMaterial == 0) {
+    opserr << "WARNING trussGroup - material " << matTag << " not found\n";
+    return TCL_ERROR;
+  }
+
+  double rho = 0.0;
+  bool corotational = false;
+  std::vector<int> nodeTags;
+
+  int argi = 5;
+  while (argi < argc) {
+    if (strcmp(argv[argi],"-rho") == 0 && argi+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[argi+1], &rho) != TCL_OK) {
+	opserr << "WARNING invalid trussGroup rho " << argv[argi+1] << endln;
+	return TCL_ERROR;
+      }
+      argi += 2;
+    } else if (strcmp(argv[argi],"-corot") == 0) {
+      corotational = true;
+      argi++;
+    } else if (strcmp(argv[argi],"-bars") == 0) {
+      argi++;
+      int tag;
+      while (argi < argc && argv[argi][0] != '-') {
+	if (Tcl_GetInt(interp, argv[argi], &tag) != TCL_OK) {
+	  opserr << "WARNING invalid trussGroup node " << argv[argi] << endln;
+	  return TCL_ERROR;
+	}
+	nodeTags.push_back(tag);
+	argi++;
+      }
+    } else if (strcmp(argv[argi],"-file") == 0 && argi+1 < argc) {
+      std::ifstream theFile(argv[argi+1]);
+      if (!theFile) {
+	opserr << "WARNING trussGroup - could not open file " << argv[argi+1] << endln;
+	return TCL_ERROR;
+      }
+      int tag;
+      while (theFile >> tag)
+	nodeTags.push_back(tag);
+      argi += 2;
+    } else {
+      opserr << "WARNING trussGroup - unknown option " << argv[argi] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  int numBars = (int)nodeTags.size()/2;
+  if (numBars == 0 || (int)nodeTags.size() != 2*numBars) {
+    opserr << "WARNING trussGroup - want pairs of node tags for the bars\n";
+    return TCL_ERROR;
+  }
+
+  // the group is deleted with its last bar
+  TrussGroup *theGroup = new TrussGroup(numBars, ndm, *theMaterial, A, rho,
+					corotational);
+
+  for (int i = 0; i < numBars; i++) {
+    GroupTruss *theBar = new GroupTruss(startTag+i, *theGroup, i,
+					nodeTags[2*i], nodeTags[2*i+1]);
+    if (theTclDomain->addElement(theBar) == false) {
+      opserr << "WARNING trussGroup - could not add bar " << startTag+i
+	     << " to the domain\n";
+      // the bars not created are removed from the group
+      for (int j = i+1; j < numBars; j++)
+	theGroup->removeBar();
+      delete theBar;
+      return TCL_ERROR;
+    }
+  }
+
+  return TCL_OK;
+}
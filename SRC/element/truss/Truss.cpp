@@ -47,18 +47,14 @@
 #include <string.h>
 
 #include <ElementResponse.h>
+#include <Workspace.h>
 
 //#include <fstream>
 
-// initialise the class wide variables
-Matrix Truss::trussM2(2,2);
-Matrix Truss::trussM4(4,4);
-Matrix Truss::trussM6(6,6);
-Matrix Truss::trussM12(12,12);
-Vector Truss::trussV2(2);
-Vector Truss::trussV4(4);
-Vector Truss::trussV6(6);
-Vector Truss::trussV12(12);
+// keys identifying the Workspace objects of the trusses, one of each size
+// for each thread setting the domain of a truss
+static char matrixKey;
+static char vectorKey;
 
 // constructor:
 //  responsible for allocating the necessary space needed by each object
@@ -313,8 +309,8 @@ Truss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
+      theMatrix = &Workspace::getMatrix(&matrixKey, 2, 2);
+      theVector = &Workspace::getVector(&vectorKey, 2);	
 
       return;
     }
@@ -330,8 +326,8 @@ Truss::setDomain(Domain *theDomain)
 
       // fill this in so don't segment fault later
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
+      theMatrix = &Workspace::getMatrix(&matrixKey, 2, 2);
+      theVector = &Workspace::getVector(&vectorKey, 2);	
 	
       return;
     }	
@@ -342,36 +338,36 @@ Truss::setDomain(Domain *theDomain)
     // now set the number of dof for element and set matrix and vector pointer
     if (dimension == 1 && dofNd1 == 1) {
 	numDOF = 2;    
-	theMatrix = &trussM2;
-	theVector = &trussV2;
+	theMatrix = &Workspace::getMatrix(&matrixKey, 2, 2);
+	theVector = &Workspace::getVector(&vectorKey, 2);
     }
     else if (dimension == 2 && dofNd1 == 2) {
 	numDOF = 4;
-	theMatrix = &trussM4;
-	theVector = &trussV4;	
+	theMatrix = &Workspace::getMatrix(&matrixKey, 4, 4);
+	theVector = &Workspace::getVector(&vectorKey, 4);	
     }
     else if (dimension == 2 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;		
+	theMatrix = &Workspace::getMatrix(&matrixKey, 6, 6);
+	theVector = &Workspace::getVector(&vectorKey, 6);		
     }
     else if (dimension == 3 && dofNd1 == 3) {
 	numDOF = 6;	
-	theMatrix = &trussM6;
-	theVector = &trussV6;			
+	theMatrix = &Workspace::getMatrix(&matrixKey, 6, 6);
+	theVector = &Workspace::getVector(&vectorKey, 6);			
     }
     else if (dimension == 3 && dofNd1 == 6) {
 	numDOF = 12;	    
-	theMatrix = &trussM12;
-	theVector = &trussV12;			
+	theMatrix = &Workspace::getMatrix(&matrixKey, 12, 12);
+	theVector = &Workspace::getVector(&vectorKey, 12);			
     }
     else {
       opserr <<"WARNING Truss::setDomain cannot handle " << dimension << " dofs at nodes in " << 
 	dofNd1  << " problem\n";
 
       numDOF = 2;    
-      theMatrix = &trussM2;
-      theVector = &trussV2;	
+      theMatrix = &Workspace::getMatrix(&matrixKey, 2, 2);
+      theVector = &Workspace::getVector(&vectorKey, 2);	
       return;
     }
 
@@ -120,8 +120,8 @@ class Truss : public Element
     int numDOF;	                    // number of dof for truss
 
     Vector *theLoad;    // pointer to the load vector P
-    Matrix *theMatrix;  // pointer to objects matrix (a class wide Matrix)
-    Vector *theVector;  // pointer to objects vector (a class wide Vector)
+    Matrix *theMatrix;  // pointer to objects matrix (a Workspace Matrix)
+    Vector *theVector;  // pointer to objects vector (a Workspace Vector)
 
     double L;               // length of truss based on undeformed configuration
     double A;               // area of truss
@@ -139,16 +139,6 @@ class Truss : public Element
     int parameterID;
     Vector *theLoadSens;
 // AddingSensitivity:END ///////////////////////////////////////////
-
-    // static data - single copy for all objects of the class	
-    static Matrix trussM2;   // class wide matrix for 2*2
-    static Matrix trussM4;   // class wide matrix for 4*4
-    static Matrix trussM6;   // class wide matrix for 6*6
-    static Matrix trussM12;  // class wide matrix for 12*12
-    static Vector trussV2;   // class wide Vector for size 2
-    static Vector trussV4;   // class wide Vector for size 4
-    static Vector trussV6;   // class wide Vector for size 6
-    static Vector trussV12;  // class wide Vector for size 12
 };
 
 #endif
@@ -0,0 +1,276 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/truss/TrussGroup.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of TrussGroup.
+//
+// What: "@(#) TrussGroup.cpp, revA"
+
+#include <TrussGroup.h>
+#include <Node.h>
+#include <Vector.h>
+#include <UniaxialMaterial.h>
+#include <ThreadPool.h>
+#include <OPS_Globals.h>
+#include <math.h>
+
+// the bars are updated in chunks of this size, one batch call each
+#define TRUSS_GROUP_CHUNK 1024
+
+TrussGroup::TrussGroup(int nBars, int nDM, UniaxialMaterial &theMaterial,
+		       double a, double r, bool corot)
+  :numBars(nBars), numAlive(nBars), ndm(nDM), A(a), rho(r),
+   corotational(corot)
+{
+  theNodes = new Node *[2*numBars];
+  dX = new double[ndm*numBars];
+  n = new double[ndm*numBars];
+  L = new double[numBars];
+  Ln = new double[numBars];
+  strain = new double[numBars];
+  stress = new double[numBars];
+  tangent = new double[numBars];
+  theMaterials = new UniaxialMaterial *[numBars];
+
+  for (int i = 0; i < numBars; i++) {
+    theNodes[2*i] = 0;
+    theNodes[2*i+1] = 0;
+    L[i] = 0.0;
+    Ln[i] = 0.0;
+    strain[i] = 0.0;
+    theMaterials[i] = theMaterial.getCopy();
+    if (theMaterials[i] == 0) {
+      opserr << "FATAL TrussGroup::TrussGroup() - failed to get a copy of the material\n";
+      exit(-1);
+    }
+    stress[i] = theMaterials[i]->getStress();
+    tangent[i] = theMaterials[i]->getTangent();
+  }
+  for (int i = 0; i < ndm*numBars; i++) {
+    dX[i] = 0.0;
+    n[i] = 0.0;
+  }
+}
+
+TrussGroup::~TrussGroup()
+{
+  for (int i = 0; i < numBars; i++)
+    if (theMaterials[i] != 0)
+      delete theMaterials[i];
+  delete [] theMaterials;
+  delete [] theNodes;
+  delete [] dX;
+  delete [] n;
+  delete [] L;
+  delete [] Ln;
+  delete [] strain;
+  delete [] stress;
+  delete [] tangent;
+}
+
+int
+TrussGroup::setBar(int bar, Node *nodeI, Node *nodeJ)
+{
+  if (bar < 0 || bar >= numBars)
+    return -1;
+
+  const Vector &crdI = nodeI->getCrds();
+  const Vector &crdJ = nodeJ->getCrds();
+  if (crdI.Size() < ndm || crdJ.Size() < ndm)
+    return -1;
+
+  theNodes[2*bar] = nodeI;
+  theNodes[2*bar+1] = nodeJ;
+
+  double *dXb = dX + ndm*bar;
+  double *nb = n + ndm*bar;
+  double L2 = 0.0;
+  for (int d = 0; d < ndm; d++) {
+    dXb[d] = crdJ(d) - crdI(d);
+    L2 += dXb[d]*dXb[d];
+  }
+  if (L2 == 0.0)
+    return -2;
+
+  L[bar] = sqrt(L2);
+  Ln[bar] = L[bar];
+  for (int d = 0; d < ndm; d++)
+    nb[d] = dXb[d]/L[bar];
+
+  return 0;
+}
+
+int
+TrussGroup::removeBar(void)
+{
+  return --numAlive;
+}
+
+double
+TrussGroup::getGeometricStiffness(int bar) const
+{
+  if (corotational == false)
+    return 0.0;
+  return A*stress[bar]/Ln[bar];
+}
+
+double
+TrussGroup::getInitialStiffness(int bar)
+{
+  return A*theMaterials[bar]->getInitialTangent()/L[bar];
+}
+
+void
+TrussGroup::setTrialStrains(int first, int last)
+{
+  double du[3];
+  for (int i = first; i < last; i++) {
+    if (theNodes[2*i] == 0)
+      continue;
+    const Vector &dispI = theNodes[2*i]->getTrialDisp();
+    const Vector &dispJ = theNodes[2*i+1]->getTrialDisp();
+    for (int d = 0; d < ndm; d++)
+      du[d] = dispJ(d) - dispI(d);
+
+    double *nb = n + ndm*i;
+    if (corotational == false) {
+      double dL = 0.0;
+      for (int d = 0; d < ndm; d++)
+	dL += nb[d]*du[d];
+      strain[i] = dL/L[i];
+    } else {
+      const double *dXb = dX + ndm*i;
+      double L2 = 0.0;
+      for (int d = 0; d < ndm; d++) {
+	nb[d] = dXb[d] + du[d];
+	L2 += nb[d]*nb[d];
+      }
+      Ln[i] = sqrt(L2);
+      for (int d = 0; d < ndm; d++)
+	nb[d] /= Ln[i];
+      strain[i] = (Ln[i] - L[i])/L[i];
+    }
+  }
+}
+
+int
+TrussGroup::update(void)
+{
+  int numChunks = (numBars + TRUSS_GROUP_CHUNK - 1)/TRUSS_GROUP_CHUNK;
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#endif
+  int res = 0;
+
+  const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numT) reduction(+:res)
+#endif
+  for (int c = 0; c < numChunks; c++) {
+    theGlobals.set();
+    int first = c*TRUSS_GROUP_CHUNK;
+    int last = first + TRUSS_GROUP_CHUNK;
+    if (last > numBars)
+      last = numBars;
+    this->setTrialStrains(first, last);
+    res += theMaterials[first]->setTrialBatch(theMaterials+first, strain+first,
+					      stress+first, tangent+first,
+					      last-first);
+  }
+
+  return res;
+}
+
+int
+TrussGroup::commitState(void)
+{
+  int numChunks = (numBars + TRUSS_GROUP_CHUNK - 1)/TRUSS_GROUP_CHUNK;
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#endif
+  int res = 0;
+
+  const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numT) reduction(+:res)
+#endif
+  for (int c = 0; c < numChunks; c++) {
+    theGlobals.set();
+    int first = c*TRUSS_GROUP_CHUNK;
+    int last = first + TRUSS_GROUP_CHUNK;
+    if (last > numBars)
+      last = numBars;
+    res += theMaterials[first]->commitBatch(theMaterials+first, last-first);
+  }
+
+  return res;
+}
+
+int
+TrussGroup::revertToLastCommit(void)
+{
+  int numChunks = (numBars + TRUSS_GROUP_CHUNK - 1)/TRUSS_GROUP_CHUNK;
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#endif
+  int res = 0;
+
+  const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numT) reduction(+:res)
+#endif
+  for (int c = 0; c < numChunks; c++) {
+    theGlobals.set();
+    int first = c*TRUSS_GROUP_CHUNK;
+    int last = first + TRUSS_GROUP_CHUNK;
+    if (last > numBars)
+      last = numBars;
+    // the nodes are reverted before the elements, their trial
+    // displacements are the committed ones
+    this->setTrialStrains(first, last);
+    res += theMaterials[first]->revertBatch(theMaterials+first, stress+first,
+					    tangent+first, last-first);
+  }
+
+  return res;
+}
+
+int
+TrussGroup::revertToStart(void)
+{
+  int res = 0;
+  for (int i = 0; i < numBars; i++) {
+    res += theMaterials[i]->revertToStart();
+    stress[i] = theMaterials[i]->getStress();
+    tangent[i] = theMaterials[i]->getTangent();
+    strain[i] = 0.0;
+    Ln[i] = L[i];
+    if (L[i] != 0.0)
+      for (int d = 0; d < ndm; d++)
+	n[ndm*i+d] = dX[ndm*i+d]/L[i];
+  }
+
+  return res;
+}
@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/element/truss/TrussGroup.h,v $
+
+#ifndef TrussGroup_h
+#define TrussGroup_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for TrussGroup.
+// A TrussGroup holds the state of the bars of a space truss or cable net
+// as arrays over the bars, and updates, commits and reverts all of them at
+// once: the bar strains in one loop over the node displacements, the
+// materials with one setTrialBatch() call per chunk of bars, and the
+// stiffness coefficients, the chunks on the threads of the ThreadPool.
+// The bars are GroupTruss elements, which form their matrices and vectors
+// from these arrays; the first of them invokes the group operations. The
+// bars are small displacement trusses or, for cable nets and form
+// finding, corotational ones with the geometric stiffness.
+//
+// What: "@(#) TrussGroup.h, revA"
+
+class Node;
+class UniaxialMaterial;
+
+class TrussGroup
+{
+  public:
+    TrussGroup(int numBars, int ndm, UniaxialMaterial &theMaterial,
+	       double A, double rho, bool corotational);
+    ~TrussGroup();
+
+    int setBar(int bar, Node *nodeI, Node *nodeJ);
+    int removeBar(void);
+
+    int update(void);
+    int commitState(void);
+    int revertToLastCommit(void);
+    int revertToStart(void);
+
+    int getNumBars(void) const {return numBars;}
+    int getNDM(void) const {return ndm;}
+    double getA(void) const {return A;}
+    double getRho(void) const {return rho;}
+    double getL(int bar) const {return L[bar];}
+    double getStrain(int bar) const {return strain[bar];}
+    double getAxialForce(int bar) const {return A*stress[bar];}
+    UniaxialMaterial *getMaterial(int bar) {return theMaterials[bar];}
+
+    // the unit vector along the bar and the material and geometric
+    // stiffness coefficients, A Et/L and N/Ln
+    const double *getDirection(int bar) const {return n + ndm*bar;}
+    double getMaterialStiffness(int bar) const {return A*tangent[bar]/L[bar];}
+    double getGeometricStiffness(int bar) const;
+    double getInitialStiffness(int bar);
+
+  private:
+    void setTrialStrains(int first, int last);
+
+    int numBars;
+    int numAlive;       // bars not yet deleted
+    int ndm;
+    double A, rho;
+    bool corotational;
+
+    Node **theNodes;    // the two nodes of each bar
+    double *dX;         // initial coordinate differences, ndm per bar
+    double *L;          // initial lengths
+    double *n;          // unit vectors along the bars, ndm per bar
+    double *Ln;         // current lengths
+    double *strain, *stress, *tangent;
+    UniaxialMaterial **theMaterials;
+};
+
+#endif
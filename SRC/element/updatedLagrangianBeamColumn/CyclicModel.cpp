@@ -8,17 +8,25 @@ const int    CyclicModel::Crossover(3);
 const double CyclicModel::Tol(1e-10);
 const double CyclicModel::delK(0.85);
 
-static MapOfTaggedObjects theCyclicModelObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theCyclicModelObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theCyclicModelObjects(void)
+{
+  if (theCyclicModelObjectsPtr == 0)
+    theCyclicModelObjectsPtr = new MapOfTaggedObjects();
+  return *theCyclicModelObjectsPtr;
+}
 
 bool OPS_addCyclicModel(CyclicModel *newComponent)
 {
-    return theCyclicModelObjects.addComponent(newComponent);
+    return theCyclicModelObjects().addComponent(newComponent);
 }
 
 CyclicModel *OPS_getCyclicModel(int tag)
 {
 
-  TaggedObject *theResult = theCyclicModelObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theCyclicModelObjects().getComponentPtr(tag);
   if(theResult == 0) {
       opserr << "NDMaterial no found with tag: " << tag << "\n";
       return 0;
@@ -29,7 +37,7 @@ CyclicModel *OPS_getCyclicModel(int tag)
 }
 
 void OPS_clearAllCyclicModel(void) {
-    theCyclicModelObjects.clearAll();
+    theCyclicModelObjects().clearAll();
 }
 
 CyclicModel::CyclicModel(int tag, int clasTag)
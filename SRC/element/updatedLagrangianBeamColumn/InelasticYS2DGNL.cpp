@@ -131,13 +131,10 @@ int InelasticYS2DGNL::update()
      getIncrNaturalDisp(disp);
 	 //getIncrLocalDisp(disp);   IMPORTANT - Do not change!!
 
-     // Compute local incremental force
-     force = Stiff*disp;
-
-Vector trial_force(6);
-
-     // Compute total trial local force - store in trialForce
-     trial_force = eleForce_hist + force;	 
+     // Compute total trial local force - store in trial_force
+     static Vector trial_force(6);
+     trial_force = eleForce_hist;
+     trial_force.addMatrixVector(1.0, Stiff, disp, 1.0);
 	 computeTrueEleForce(trial_force);
 	 checkSpecialCases();
 	 return 0;
@@ -593,11 +590,13 @@ const Matrix &InelasticYS2DGNL::getTangentStiff(void)
 //	if(forceRecoveryAlgo != -1) // do not use Kt
 //		return this->Element2D02::getTangentStiff();
 	
-	transformToGlobal(Stiff);
+	// Stiff stays local, it is used again by the next update()
+	Kt = Stiff;
+	transformToGlobal(Kt);
 	
-//	opserr << "Kt = " << Stiff;
+//	opserr << "Kt = " << Kt;
 	
-	return Stiff;
+	return Kt;
 }
 
 
@@ -58,7 +58,8 @@ UpdatedLagrangianBeam2D::UpdatedLagrangianBeam2D(int classTag)
   :Element(0, classTag), isLinear(true), L(0.0), sn(0.0), cs(0),
    connectedExternalNodes(2), load(6),
    end1Ptr(0), end2Ptr(0),  eleForce(6), eleForce_hist(6), 
-   nodeRecord(0), dofRecord(0), m_Iter(-1), Ki(0)
+   nodeRecord(0), dofRecord(0), m_Iter(-1), Ki(0),
+   KLocal(6,6), KLocalSet(false)
 {
 	numDof  = 6;
 	massDof = -1;// assumes no lumped mass
@@ -69,7 +70,8 @@ UpdatedLagrangianBeam2D::UpdatedLagrangianBeam2D(int tag, int classTag, int nd1,
   :Element(tag, classTag), isLinear(islinear), L(0.0), sn(0.0), cs(0),
    connectedExternalNodes(2), load(6),
    end1Ptr(0), end2Ptr(0),  eleForce(6), eleForce_hist(6), 
-   nodeRecord(0), dofRecord(0), m_Iter(-1), Ki(0)
+   nodeRecord(0), dofRecord(0), m_Iter(-1), Ki(0),
+   KLocal(6,6), KLocalSet(false)
 {
 	connectedExternalNodes(0) = nd1;
 	connectedExternalNodes(1) = nd2;
@@ -150,6 +152,8 @@ void UpdatedLagrangianBeam2D::setDomain(Domain *theDomain)
 		sn_hist = dy/L;
 	}
 
+	KLocalSet = false;
+
 
 }//setDomain
 
@@ -191,6 +195,7 @@ int UpdatedLagrangianBeam2D::commitState()
 
 	// save the prev. step element forces
 	eleForce_hist = eleForce;
+	KLocalSet = false;
 	return success;
 }
 
@@ -296,6 +301,23 @@ void UpdatedLagrangianBeam2D::addInternalGeomStiff(Matrix &K)
 
 }
 
+// the local stiffness of getLocalStiff() and addInternalGeomStiff() is that
+// of the committed length and axial force, so it is formed on the first call
+// after a commit and reused by getTangentStiff() and getTrialLocalForce() in
+// all the iterations of the step. Subclasses whose getLocalStiff() depends on
+// the trial state do not use these two methods.
+
+const Matrix &UpdatedLagrangianBeam2D::getCommittedLocalStiff(void)
+{
+    if (KLocalSet == false) {
+	getLocalStiff(KLocal);
+	addInternalGeomStiff(KLocal);
+	KLocalSet = true;
+    }
+
+    return KLocal;
+}
+
 void UpdatedLagrangianBeam2D::addExternalGeomStiff(Matrix &K)
 {
 //     if (isLinear)
@@ -352,11 +374,8 @@ int UpdatedLagrangianBeam2D::getNumDOF(void)
 
 const Matrix &UpdatedLagrangianBeam2D::getTangentStiff(void)
 {
-    // Get the local elastic stiffness matrix, store in Kt
-    getLocalStiff(Kt);
-
-    // Add internal geometric stiffness matrix
-    addInternalGeomStiff(Kt);
+    // Get the local elastic and internal geometric stiffness, store in Kt
+    Kt = getCommittedLocalStiff();
 
     // Add external geometric stiffness matrix
     addExternalGeomStiff(Kt);
@@ -437,11 +456,8 @@ int UpdatedLagrangianBeam2D::addLoad(const Vector &moreLoad)
 
 void UpdatedLagrangianBeam2D::getTrialLocalForce(Vector &lforce)
 {
-	// Get the local elastic stiffness matrix, store in Kt
-    getLocalStiff(Kt);
-
-    // Add internal geometric stiffness matrix
-    addInternalGeomStiff(Kt);
+	// Get the local elastic and internal geometric stiffness
+    const Matrix &Kl = getCommittedLocalStiff();
 
     // Get incremental local displacements  trial-conv.
 	
@@ -481,11 +497,9 @@ void UpdatedLagrangianBeam2D::getTrialLocalForce(Vector &lforce)
 // end natural defo
 ///////////////////////////////////////////////
 */
-    // Compute local incremental force
-    force = Kt*disp;
-
-    // Compute total local force
-    lforce = eleForce_hist + force;
+    // Compute total local force, committed plus incremental
+    lforce = eleForce_hist;
+    lforce.addMatrixVector(1.0, Kl, disp, 1.0);
 
 }
 
@@ -568,19 +582,20 @@ UpdatedLagrangianBeam2D::getResistingForceIncInertia()
 	force(3) -= massDof*end2Accel(0);
 	force(4) -= massDof*end2Accel(1);
       } else if(massDof < 0) {
-	M = this->getMass();
+	const Matrix &mass = this->getMass();
 	
 	const Vector &end1Accel = end1Ptr->getTrialAccel();
 	const Vector &end2Accel = end2Ptr->getTrialAccel();
-	Vector Accel(6), f(6);
+	double accel[6];
 	int i=0;
 	for(i=0; i<3; i++)
 	  {
-	    Accel(i)   = end1Accel(i);
-	    Accel(i+3) = end2Accel(i);
+	    accel[i]   = end1Accel(i);
+	    accel[i+3] = end2Accel(i);
 	  }
-	f = M*Accel;
-	for(i=0; i<6; i++) force(i) -= f(i);
+	for(i=0; i<6; i++)
+	  for(int j=0; j<6; j++)
+	    force(i) -= mass(i,j)*accel[j];
       }
 
       if (alphaM != 0.0 || betaK != 0.0 || betaK0 != 0.0 || betaKc != 0.0)
@@ -115,6 +115,7 @@ public:
   virtual	void	updateState(void);
 
   void  addInternalGeomStiff(Matrix &K);
+  const Matrix &getCommittedLocalStiff(void);
   void  addExternalGeomStiff(Matrix &K);
   
   void  transformToGlobal(Matrix &K);
@@ -138,6 +139,11 @@ public:
 
   Matrix *Ki;
 
+  // local elastic and internal geometric stiffness of the last committed
+  // state, formed once per step, see getCommittedLocalStiff()
+  Matrix  KLocal;
+  bool    KLocalSet;
+
   static Matrix K, Kg, Kt; // stiffness matrices
   static Matrix M; // mass matrix
   static Matrix D; // damping matrix
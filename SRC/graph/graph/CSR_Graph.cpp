@@ -0,0 +1,327 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/graph/CSR_Graph.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for CSR_Graph,
+// CSR_Vertex and CSR_VertexIter.
+//
+// What: "@(#) CSR_Graph.C, revA"
+
+#include <CSR_Graph.h>
+#include <VertexIter.h>
+#include <MapOfTaggedObjects.h>
+#include <algorithm>
+
+// storage handed to the VertexIter base class, never used; one for each
+// thread as the base class resets its iterator
+static OPS_THREAD_LOCAL MapOfTaggedObjects *emptyVerticesPtr = 0;
+
+static MapOfTaggedObjects *
+emptyVertices(void)
+{
+  if (emptyVerticesPtr == 0)
+    emptyVerticesPtr = new MapOfTaggedObjects();
+  return emptyVerticesPtr;
+}
+
+class CSR_VertexIter: public VertexIter
+{
+  public:
+    CSR_VertexIter(CSR_Graph *theGraph);
+    
+    void reset(void);
+    Vertex *operator()(void);
+
+  private:
+    CSR_Graph *myGraph;
+    CSR_Vertex myVertex;
+    int currentVertex;
+};
+
+
+CSR_Vertex::CSR_Vertex()
+  :Vertex(START_VERTEX_NUM, START_VERTEX_NUM), 
+ theAdjacency(0), noAdjacency(0), myDegree(0)
+{
+
+}
+
+CSR_Vertex::~CSR_Vertex()
+{
+
+}
+
+void
+CSR_Vertex::setVertex(int tag, int *adjacency, int degree)
+{
+  this->setTag(tag);
+
+  // an ID can not wrap an empty array
+  myDegree = degree;
+  if (degree > 0)
+    theAdjacency.setData(adjacency, degree);
+}
+
+int 
+CSR_Vertex::getRef(void) const
+{
+  return this->getTag();
+}
+
+int
+CSR_Vertex::getDegree(void) const
+{
+  return myDegree;
+}
+
+const ID &
+CSR_Vertex::getAdjacency(void) const
+{
+  if (myDegree == 0)
+    return noAdjacency;
+
+  return theAdjacency;
+}
+
+
+CSR_VertexIter::CSR_VertexIter(CSR_Graph *theGraph)
+  :VertexIter(emptyVertices()), myGraph(theGraph), currentVertex(0)
+{
+
+}
+
+void
+CSR_VertexIter::reset(void)
+{
+  currentVertex = 0;
+}
+
+Vertex *
+CSR_VertexIter::operator()(void)
+{
+  if (currentVertex >= myGraph->numVertex)
+    return 0;
+
+  int *start = myGraph->start;
+  myVertex.setVertex(currentVertex + START_VERTEX_NUM,
+		     &(myGraph->adjacency[start[currentVertex]]),
+		     start[currentVertex+1] - start[currentVertex]);
+  currentVertex++;
+
+  return &myVertex;
+}
+
+
+// CSR_Graph(int numVertex, int *start, int *adjacency):
+//	constructor, the graph takes ownership of the start and adjacency
+//	arrays, which must be allocated with new []. The adjacency of
+//	each vertex may be in any order and contain duplicates and the
+//	vertex itself: on return each list is sorted and these are removed.
+//	The adjacency must be symmetric.
+
+CSR_Graph::CSR_Graph(int numV, int *theStart, int *theAdjacency)
+  :Graph(), numVertex(numV), numEdge(0), 
+   start(theStart), adjacency(theAdjacency), expanded(false),
+   theVertexIter(0)
+{
+  if (numVertex < 0)
+    numVertex = 0;
+
+  int loc = 0;
+  int rowStart = (numVertex != 0) ? start[0] : 0;
+  for (int i=0; i<numVertex; i++) {
+    int rowEnd = start[i+1];
+    int tag = i + START_VERTEX_NUM;
+
+    // sort, take out duplicates and the vertex itself, and move the list
+    // down to follow the previous one
+    int *first = adjacency + rowStart;
+    int *last = adjacency + rowEnd;
+    std::sort(first, last);
+    last = std::unique(first, last);
+    last = std::remove(first, last, tag);
+    start[i] = loc;
+    for (int *value = first; value != last; value++)
+      adjacency[loc++] = *value;
+
+    rowStart = rowEnd;
+  }
+  if (numVertex != 0)
+    start[numVertex] = loc;
+
+  numEdge = loc/2;
+
+  theVertexIter = new CSR_VertexIter(this);
+}
+
+
+CSR_Graph::~CSR_Graph()
+{
+  if (start != 0)
+    delete [] start;
+  if (adjacency != 0)
+    delete [] adjacency;
+  if (theVertexIter != 0)
+    delete theVertexIter;
+}
+
+
+bool
+CSR_Graph::addVertex(Vertex *vertexPtr, bool checkAdjacency)
+{
+  if (expanded == false && this->expand() < 0)
+    return false;
+
+  return this->Graph::addVertex(vertexPtr, checkAdjacency);
+}
+
+
+int 
+CSR_Graph::addEdge(int vertexTag, int otherVertexTag)
+{
+  if (expanded == false && this->expand() < 0)
+    return -1;
+
+  return this->Graph::addEdge(vertexTag, otherVertexTag);
+}
+
+
+Vertex *
+CSR_Graph::getVertexPtr(int vertexTag)
+{
+  if (expanded == true)
+    return this->Graph::getVertexPtr(vertexTag);
+
+  int i = vertexTag - START_VERTEX_NUM;
+  if (i < 0 || i >= numVertex)
+    return 0;
+
+  theVertex.setVertex(vertexTag, &adjacency[start[i]], start[i+1]-start[i]);
+  return &theVertex;
+}
+
+
+VertexIter &
+CSR_Graph::getVertices(void) 
+{
+  if (expanded == true)
+    return this->Graph::getVertices();
+
+  theVertexIter->reset();
+  return *theVertexIter;
+}
+
+
+int 
+CSR_Graph::getNumVertex(void) const
+{
+  if (expanded == true)
+    return this->Graph::getNumVertex();
+
+  return numVertex;
+}
+
+
+int 
+CSR_Graph::getNumEdge(void) const
+{
+  if (expanded == true)
+    return this->Graph::getNumEdge();
+
+  return numEdge;
+}
+
+
+int 
+CSR_Graph::getFreeTag(void) 
+{
+  if (expanded == true)
+    return this->Graph::getFreeTag();
+
+  return numVertex + START_VERTEX_NUM;
+}
+
+
+Vertex *
+CSR_Graph::removeVertex(int tag, bool flag)
+{
+  if (expanded == false && this->expand() < 0)
+    return 0;
+
+  return this->Graph::removeVertex(tag, flag);
+}
+
+
+const int *
+CSR_Graph::getStart(void) const
+{
+  return start;
+}
+
+
+const int *
+CSR_Graph::getAdjacency(void) const
+{
+  return adjacency;
+}
+
+
+// int expand(void)
+//	copies the vertices and edges into Vertex objects held by the Graph
+//	base class, after which the CSR arrays are released.
+
+int
+CSR_Graph::expand(void)
+{
+  for (int i=0; i<numVertex; i++) {
+    int tag = i + START_VERTEX_NUM;
+    Vertex *vertexPtr = new Vertex(tag, tag);
+    if (vertexPtr == 0 || this->Graph::addVertex(vertexPtr, false) == false) {
+      opserr << "WARNING CSR_Graph::expand - could not add vertex " << tag << endln;
+      return -1;
+    }
+  }
+
+  for (int i=0; i<numVertex; i++) {
+    int tag = i + START_VERTEX_NUM;
+    for (int j=start[i]; j<start[i+1]; j++) 
+      if (adjacency[j] > tag && this->Graph::addEdge(tag, adjacency[j]) < 0)
+	return -2;
+  }
+
+  expanded = true;
+
+  if (start != 0)
+    delete [] start;
+  if (adjacency != 0)
+    delete [] adjacency;
+
+  start = 0;
+  adjacency = 0;
+  numVertex = 0;
+  numEdge = 0;
+
+  return 0;
+}
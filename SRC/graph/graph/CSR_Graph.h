@@ -0,0 +1,104 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/graph/graph/CSR_Graph.h,v $
+
+#ifndef CSR_Graph_h
+#define CSR_Graph_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for CSR_Graph.
+// CSR_Graph is a Graph whose vertices are numbered consecutively from
+// START_VERTEX_NUM and whose adjacency is held in compressed sparse row
+// form, i.e. the adjacency of vertex i is adjacency[start[i]] to
+// adjacency[start[i+1]-1]. No Vertex object is stored per vertex; the
+// Vertex returned by getVertexPtr() and by the VertexIter is a single
+// object reused for each call, so it is only valid until the next call.
+//
+// The graph is intended to be built once, e.g. by the AnalysisModel for
+// sizing the system of equations. If it is modified through addVertex(),
+// addEdge() or removeVertex() it first copies itself into Vertex objects
+// held by the Graph base class, and from then on behaves as a Graph.
+//
+// What: "@(#) CSR_Graph.h, revA"
+
+#include <Graph.h>
+#include <Vertex.h>
+
+class CSR_VertexIter;
+
+class CSR_Vertex: public Vertex
+{
+  public:
+    CSR_Vertex();
+    ~CSR_Vertex();
+
+    void setVertex(int tag, int *adjacency, int degree);
+    
+    int getRef(void) const;
+    int getDegree(void) const;
+    const ID &getAdjacency(void) const;
+
+  private:
+    ID theAdjacency;
+    ID noAdjacency;
+    int myDegree;
+};
+
+class CSR_Graph: public Graph
+{
+  public:
+    CSR_Graph(int numVertex, int *start, int *adjacency);
+    ~CSR_Graph();
+
+    bool addVertex(Vertex *vertexPtr, bool checkAdjacency = true);
+    int addEdge(int vertexTag, int otherVertexTag);
+    
+    Vertex *getVertexPtr(int vertexTag);
+    VertexIter &getVertices(void);
+    int getNumVertex(void) const;
+    int getNumEdge(void) const;
+    int getFreeTag(void);
+    Vertex *removeVertex(int tag, bool removeEdgeFlag = true);
+
+    const int *getStart(void) const;
+    const int *getAdjacency(void) const;
+    
+  protected:
+    
+  private:
+    int expand(void);
+    
+    int numVertex;
+    int numEdge;
+    int *start;       // size numVertex+1
+    int *adjacency;   // size start[numVertex]
+    bool expanded;
+
+    CSR_Vertex theVertex;
+    CSR_VertexIter *theVertexIter;
+    
+    friend class CSR_VertexIter;
+};
+
+#endif
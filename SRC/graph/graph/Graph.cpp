@@ -333,6 +333,7 @@ Graph::sendSelf(int commitTag, Channel &theChannel)
   }
 
   int numVertex = this->getNumVertex();
+  int numEdge = this->getNumEdge();
 
   // send numEdge & the number of vertices
   static ID idData(2);
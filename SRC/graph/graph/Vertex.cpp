@@ -45,8 +45,9 @@ Vertex::Vertex(int tag, int ref, double weight, int color)
 
 
 Vertex::Vertex(const Vertex &other) 
-:TaggedObject(other.getTag()), myRef(other.myRef), myWeight(other.myWeight), myColor(other.myColor), 
- myDegree(other.myDegree), myTmp(0), myAdjacency(other.myAdjacency)
+:TaggedObject(other.getTag()), myRef(other.getRef()), myWeight(other.getWeight()), 
+ myColor(other.getColor()), myDegree(other.getDegree()), myTmp(0), 
+ myAdjacency(other.getAdjacency())
 {
 
 }
@@ -17,99 +17,52 @@
 **   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
 **                                                                    **
 ** ****************************************************************** */
-                                                                        
-// $Revision: 1.1.1.1 $
-// $Date: 2000-09-15 08:23:21 $
+
+// $Revision: 1.2 $
+// $Date: 2026-10-15 00:00:00 $
 // $Source: /usr/local/cvs/OpenSees/SRC/graph/numberer/MetisNumberer.h,v $
-                                                                        
-                                                                        
-// File: ~/graph/partitioner/Metis.h
-// 
-// Written: fmk 
-// Created: Sun Sept 15 11:47:47: 1996
-// Revision: A
+
+
+// Created: 10/26
 //
-// Description: This file contains the class definition for Metis.
-// Metis is a type of GraphPartitioner which uses 'METIS - Unstructured
-// Graph Partitioning And Sparse Matrix Ordering System', developed by
-// G. Karypis and V. Kumar at the University of Minnesota. The metis
-// files are found in metis-2.0 which were downloaded.
-//     This class provides the C++ interface for metis which will allow
-// it to fit seamlessly into our system.
+// Description: This file contains the class definition for MetisNumberer.
+// MetisNumberer is a GraphNumberer that orders the vertices of a graph by
+// the multilevel nested dissection of METIS_NodeND() from the METIS
+// library in OTHER/METIS. The graph is first copied into the compact
+// compressed sparse row arrays METIS works on; for a CSR_Graph these are
+// taken over directly. Used through a DOF_Numberer the graph is the
+// DOF_Group graph, so the ordering is done once per node and not per
+// equation, and the equation numbers it gives can be used as they are by
+// the sparse solvers that take the given order, e.g. SuperLU and
+// UmfPack -natural.
 //
-// What: "@(#) Metis.h, revA"
+// What: "@(#) MetisNumberer.h, revA"
 
-#ifndef Metis_h
-#define Metis_h
+#ifndef MetisNumberer_h
+#define MetisNumberer_h
 
-#include <GraphPartitioner.h>
+#include <GraphNumberer.h>
+#include <ID.h>
 
-#ifndef _bool_h
-#include <bool.h>
-#endif
-
-class Metis : public GraphPartitioner
+class MetisNumberer: public GraphNumberer
 {
   public:
-    Metis();
-    Metis(int Ptype, 
-	  int Mtype, 
-	  int coarsenTo,
-	  int Rtype, 
-	  int IPtype);
-    ~Metis();
+    MetisNumberer();
+    ~MetisNumberer();
 
-    bool setOptions(int Ptype, 
-		    int Mtype,
-		    int coarsenTo,
-		    int Rtype, 
-		    int IPtype);
+    const ID &number(Graph &theGraph, int lastVertex = -1);
+    const ID &number(Graph &theGraph, const ID &lastVertices);
 
-    bool setDefaultOptions(void);
-    
-    int partition(Graph &theGraph, int numPart);
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
 
-    
   protected:
 
   private:
-    bool checkOptions(void);
-    
-    int myPtype ; 	// package type: 
-                        //	pmetis = 1
-                        //	kmetis = 2
-
-    int myMtype;     	// type of matching scheme: 
-			//	random = 1
-			//  	heavy edge = 2
-			//    	light edge = 3
-			//	heavy clique = 4
-			//	modified heavy edge = 5
-			//    	sorted random = 11
-			//	sorted heavy edge =21
-			// 	sorted modified heavy edge = 51
-   
-   int myCoarsenTo; 	// the number of vertices the graph is coarsened down to
-                        //   	if pmetis default is 100
-			//	if kmetis default is 2000
-	
-    int myRtype;     	// type of refinement policy:  
-			//	greedy = 1
-			//	kernighan-lin = 2
-			//    	combo greedy and K-L = 3
-			// 	boundary greedy = 11
-			//    	boundary K-L = 12
-			//	combo of boundary greedy and boundary K-L = 13,
-			//    	no-refinement = 20
+    int order(Graph &theGraph);
 
-    int myIPtype; 	// type of bisection algo:  
-	                //    	graph growing partition = 1,
-			//    	greedy graph growing partition = 2,
-			//    	spectral bisection = 3,
-			//    	graph growing followed by K-L = 4
-	
-    bool defaultOptions;			    
+    ID theResult;
 };
 
 #endif
-
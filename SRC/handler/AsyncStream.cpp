@@ -0,0 +1,536 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/AsyncStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of AsyncStream.
+//
+// What: "@(#) AsyncStream.cpp, revA"
+
+#include <AsyncStream.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+
+#ifndef _WIN32
+extern "C" void *
+asyncWriter(void *theStream)
+{
+  ((AsyncStream *)theStream)->drainRows();
+  return 0;
+}
+#endif
+
+AsyncStream::AsyncStream(OPS_Stream *output, int depth)
+  :OPS_Stream(OPS_STREAM_TAGS_AsyncStream),
+   theOutput(output), queueDepth(depth),
+   theRows(0), fillRow(0), drainRow(0), numFull(0),
+   finished(false), threaded(false)
+{
+  if (queueDepth < 1)
+    queueDepth = 1;
+}
+
+AsyncStream::AsyncStream()
+  :OPS_Stream(OPS_STREAM_TAGS_AsyncStream),
+   theOutput(0), queueDepth(16),
+   theRows(0), fillRow(0), drainRow(0), numFull(0),
+   finished(false), threaded(false)
+{
+
+}
+
+AsyncStream::~AsyncStream()
+{
+  this->stop();
+
+  if (theOutput != 0)
+    delete theOutput;
+}
+
+void
+AsyncStream::start(void)
+{
+  theRows = new Vector *[queueDepth];
+  for (int i=0; i<queueDepth; i++)
+    theRows[i] = new Vector();
+
+  fillRow = 0;
+  drainRow = 0;
+  numFull = 0;
+  finished = false;
+  threaded = false;
+
+  if (theOutput->getClassTag() == OPS_STREAM_TAGS_H5FileStream)
+    return;
+
+#ifndef _WIN32
+  pthread_mutex_init(&lock, 0);
+  pthread_cond_init(&rowFull, 0);
+  pthread_cond_init(&rowFree, 0);
+  if (pthread_create(&writer, 0, asyncWriter, (void *)this) == 0)
+    threaded = true;
+  else {
+    opserr << "WARNING - AsyncStream - could not start a writer thread, writing synchronously\n";
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&rowFull);
+    pthread_cond_destroy(&rowFree);
+  }
+#endif
+}
+
+void
+AsyncStream::stop(void)
+{
+  if (theRows == 0)
+    return;
+
+#ifndef _WIN32
+  if (threaded == true) {
+    // the writer writes the rows left in the queue before it exits
+    pthread_mutex_lock(&lock);
+    finished = true;
+    pthread_cond_signal(&rowFull);
+    pthread_mutex_unlock(&lock);
+
+    pthread_join(writer, 0);
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&rowFull);
+    pthread_cond_destroy(&rowFree);
+    threaded = false;
+  }
+#endif
+
+  for (int i=0; i<queueDepth; i++)
+    delete theRows[i];
+  delete [] theRows;
+  theRows = 0;
+}
+
+int
+AsyncStream::flush(void)
+{
+#ifndef _WIN32
+  if (threaded == true) {
+    pthread_mutex_lock(&lock);
+    while (numFull != 0)
+      pthread_cond_wait(&rowFree, &lock);
+    pthread_mutex_unlock(&lock);
+  }
+#endif
+
+  return 0;
+}
+
+void
+AsyncStream::drainRows(void)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+  while (true) {
+    while (numFull == 0 && finished == false)
+      pthread_cond_wait(&rowFull, &lock);
+    if (numFull == 0)
+      break;
+
+    int row = drainRow;
+    pthread_mutex_unlock(&lock);
+
+    theOutput->write(*theRows[row]);
+
+    pthread_mutex_lock(&lock);
+    drainRow = (drainRow+1)%queueDepth;
+    numFull--;
+    pthread_cond_signal(&rowFree);
+  }
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+int
+AsyncStream::write(Vector &data)
+{
+  if (theOutput == 0)
+    return -1;
+
+  if (theRows == 0)
+    this->start();
+
+  if (threaded == false)
+    return theOutput->write(data);
+
+#ifndef _WIN32
+  // wait for a free row, the writer does not touch the free rows
+  pthread_mutex_lock(&lock);
+  while (numFull == queueDepth)
+    pthread_cond_wait(&rowFree, &lock);
+  pthread_mutex_unlock(&lock);
+
+  *theRows[fillRow] = data;
+
+  pthread_mutex_lock(&lock);
+  fillRow = (fillRow+1)%queueDepth;
+  numFull++;
+  pthread_cond_signal(&rowFull);
+  pthread_mutex_unlock(&lock);
+#endif
+
+  return 0;
+}
+
+OPS_Stream&
+AsyncStream::write(const double *s, int n)
+{
+  Vector data((double *)s, n);
+  this->write(data);
+
+  return *this;
+}
+
+//
+// the rest is passed on once the rows before it have been written
+//
+
+int
+AsyncStream::setFile(const char *fileName, openMode mode, bool echo)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->setFile(fileName, mode, echo) : -1;
+}
+
+int
+AsyncStream::setPrecision(int prec)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->setPrecision(prec) : -1;
+}
+
+int
+AsyncStream::setFloatField(floatField field)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->setFloatField(field) : -1;
+}
+
+int
+AsyncStream::precision(int prec)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->precision(prec) : -1;
+}
+
+int
+AsyncStream::width(int w)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->width(w) : -1;
+}
+
+int
+AsyncStream::tag(const char *tagName)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->tag(tagName) : -1;
+}
+
+int
+AsyncStream::tag(const char *tagName, const char *value)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->tag(tagName, value) : -1;
+}
+
+int
+AsyncStream::endTag()
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->endTag() : -1;
+}
+
+int
+AsyncStream::attr(const char *name, int value)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->attr(name, value) : -1;
+}
+
+int
+AsyncStream::attr(const char *name, double value)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->attr(name, value) : -1;
+}
+
+int
+AsyncStream::attr(const char *name, const char *value)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->attr(name, value) : -1;
+}
+
+size_t
+AsyncStream::getNumBytes(void)
+{
+  // the rows of the queue and the buffers of the stream wrapped
+  size_t numBytes = 0;
+  if (theRows != 0)
+    for (int i=0; i<queueDepth; i++)
+      numBytes += theRows[i]->Size()*sizeof(double);
+  if (theOutput != 0)
+    numBytes += theOutput->getNumBytes();
+  return numBytes;
+}
+
+int
+AsyncStream::setOrder(const ID &order)
+{
+  this->flush();
+  return (theOutput != 0) ? theOutput->setOrder(order) : -1;
+}
+
+OPS_Stream&
+AsyncStream::write(const char *s, int n)
+{
+  this->flush();
+  if (theOutput != 0)
+    theOutput->write(s, n);
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::write(const unsigned char *s, int n)
+{
+  this->flush();
+  if (theOutput != 0)
+    theOutput->write(s, n);
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::write(const signed char *s, int n)
+{
+  this->flush();
+  if (theOutput != 0)
+    theOutput->write(s, n);
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::write(const void *s, int n)
+{
+  this->flush();
+  if (theOutput != 0)
+    theOutput->write(s, n);
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(char c)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << c;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(unsigned char c)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << c;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(signed char c)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << c;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(const char *s)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << s;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(const unsigned char *s)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << s;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(const signed char *s)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << s;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(const void *p)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << p;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(int n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(unsigned int n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(long n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(unsigned long n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(short n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(unsigned short n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(bool b)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << b;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(double n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+OPS_Stream&
+AsyncStream::operator<<(float n)
+{
+  this->flush();
+  if (theOutput != 0)
+    *theOutput << n;
+  return *this;
+}
+
+int
+AsyncStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  if (theOutput == 0) {
+    opserr << "AsyncStream::sendSelf() - no stream to write to\n";
+    return -1;
+  }
+
+  static ID idData(2);
+  idData(0) = theOutput->getClassTag();
+  idData(1) = queueDepth;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "AsyncStream::sendSelf() - failed to send id data\n";
+    return -1;
+  }
+
+  return theOutput->sendSelf(commitTag, theChannel);
+}
+
+int
+AsyncStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  static ID idData(2);
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "AsyncStream::recvSelf() - failed to recv id data\n";
+    return -1;
+  }
+
+  this->stop();
+  queueDepth = idData(1);
+
+  if (theOutput != 0)
+    delete theOutput;
+  theOutput = theBroker.getPtrNewStream(idData(0));
+  if (theOutput == 0) {
+    opserr << "AsyncStream::recvSelf() - failed to get a stream of class " << idData(0) << endln;
+    return -1;
+  }
+
+  return theOutput->recvSelf(commitTag, theChannel, theBroker);
+}
@@ -0,0 +1,131 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/AsyncStream.h,v $
+
+#ifndef _AsyncStream
+#define _AsyncStream
+
+// Created: 10/26
+//
+// Description: AsyncStream is an OPS_Stream that takes the rows a
+// recorder writes off the commit of the Domain. write() copies the row
+// into a queue of queueDepth rows and returns; a writer thread (pthreads,
+// not on _WIN32) passes the rows in order to the OPS_Stream it wraps, so
+// the formatting, compression, file I/O or network sends of that stream
+// overlap the next steps of the analysis. write() blocks only when the
+// queue is full. The tags, attributes and text given to the stream are
+// passed on after the queue has been emptied, so the order of the output
+// is kept.
+//
+// An H5FileStream is written synchronously: the recorders writing to the
+// same HDF5 file share it and the HDF5 library is not thread safe.
+
+#include <OPS_Stream.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class AsyncStream : public OPS_Stream
+{
+ public:
+  AsyncStream(OPS_Stream *theOutput, int queueDepth = 16);
+  AsyncStream();
+  ~AsyncStream();
+
+  // waits for the rows in the queue to be written
+  int flush(void);
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE, bool echo = false);
+  int setPrecision(int precision);
+  int setFloatField(floatField);
+  int precision(int precision);
+  int width(int width);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff
+  OPS_Stream& write(const char *s, int n);
+  OPS_Stream& write(const unsigned char *s, int n);
+  OPS_Stream& write(const signed char *s, int n);
+  OPS_Stream& write(const void *s, int n);
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c);
+  OPS_Stream& operator<<(unsigned char c);
+  OPS_Stream& operator<<(signed char c);
+  OPS_Stream& operator<<(const char *s);
+  OPS_Stream& operator<<(const unsigned char *s);
+  OPS_Stream& operator<<(const signed char *s);
+  OPS_Stream& operator<<(const void *p);
+  OPS_Stream& operator<<(int n);
+  OPS_Stream& operator<<(unsigned int n);
+  OPS_Stream& operator<<(long n);
+  OPS_Stream& operator<<(unsigned long n);
+  OPS_Stream& operator<<(short n);
+  OPS_Stream& operator<<(unsigned short n);
+  OPS_Stream& operator<<(bool b);
+  OPS_Stream& operator<<(double n);
+  OPS_Stream& operator<<(float n);
+
+  size_t getNumBytes(void);
+
+  // parallel stuff
+  int setOrder(const ID &order);
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+	       FEM_ObjectBroker &theBroker);
+
+  // called by the writer thread
+  void drainRows(void);
+
+ private:
+  void start(void);
+  void stop(void);
+
+  OPS_Stream *theOutput;
+  int queueDepth;
+
+  // ring of rows, numFull of them from drainRow waiting to be written
+  Vector **theRows;
+  int fillRow;
+  int drainRow;
+  int numFull;
+  bool finished;
+  bool threaded;
+#ifndef _WIN32
+  pthread_t writer;
+  pthread_mutex_t lock;
+  pthread_cond_t rowFull;
+  pthread_cond_t rowFree;
+#endif
+};
+
+#endif
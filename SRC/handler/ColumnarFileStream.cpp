@@ -0,0 +1,852 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFileStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ColumnarFileStream.
+//
+// What: "@(#) ColumnarFileStream.cpp, revA"
+
+#include <ColumnarFileStream.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <Message.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+
+#include <iostream>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <stdint.h>
+
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+using std::ios;
+using std::ifstream;
+
+// number of chunk buffers in the ring & number of doubles in a chunk
+#define COLUMNAR_NUM_CHUNKS 4
+#define COLUMNAR_CHUNK_SIZE 131072
+
+static const char columnarMagic[9] = "OPSCOL01";
+static const char compressedMagic[9] = "OPSCOL02";
+
+// the values are rounded to multiples of 2*tolerance only while the
+// multiples and their differences fit in a 64 bit integer
+#define COLUMNAR_MAX_QUANTUM 4.0e18
+
+// the column of numRows values x as its mode byte & shuffled words
+static void
+encodeColumn(const double *x, int numRows, double tolerance, unsigned char *out)
+{
+  unsigned char mode = 0;
+  double invStep = 0.0;
+  if (tolerance > 0.0) {
+    mode = 1;
+    invStep = 0.5/tolerance;
+    for (int i=0; i<numRows; i++)
+      if (!(fabs(x[i]*invStep) < COLUMNAR_MAX_QUANTUM)) {
+	mode = 0;
+	break;
+      }
+  }
+
+  out[0] = mode;
+  unsigned char *bytes = out+1;
+  uint64_t last = 0;
+  int64_t lastQ = 0;
+  for (int i=0; i<numRows; i++) {
+    uint64_t word;
+    if (mode == 0) {
+      uint64_t bits;
+      memcpy(&bits, &x[i], sizeof(double));
+      word = bits ^ last;
+      last = bits;
+    } else {
+      int64_t q = (int64_t)floor(x[i]*invStep + 0.5);
+      int64_t d = q - lastQ;
+      lastQ = q;
+      word = ((uint64_t)d << 1) ^ (uint64_t)(d >> 63);
+    }
+    for (int b=0; b<8; b++)
+      bytes[b*numRows+i] = (unsigned char)(word >> (8*b));
+  }
+}
+
+static void
+decodeColumn(const unsigned char *in, int numRows, double tolerance, double *x)
+{
+  unsigned char mode = in[0];
+  const unsigned char *bytes = in+1;
+  uint64_t last = 0;
+  int64_t lastQ = 0;
+  double step = 2.0*tolerance;
+  for (int i=0; i<numRows; i++) {
+    uint64_t word = 0;
+    for (int b=0; b<8; b++)
+      word |= (uint64_t)bytes[b*numRows+i] << (8*b);
+    if (mode == 0) {
+      last ^= word;
+      memcpy(&x[i], &last, sizeof(double));
+    } else {
+      int64_t d = (int64_t)(word >> 1) ^ -(int64_t)(word & 1);
+      lastQ += d;
+      x[i] = lastQ*step;
+    }
+  }
+}
+
+#ifndef _WIN32
+extern "C" void *
+columnarWriter(void *theStream)
+{
+  ((ColumnarFileStream *)theStream)->drainChunks();
+  return 0;
+}
+#endif
+
+ColumnarFileStream::ColumnarFileStream()
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarFileStream),
+   fileOpen(0), theOpenMode(OVERWRITE), fileName(0), sendSelfCount(0),
+   numDescribed(0), numColumns(-1), rowsPerChunk(0), chunks(0), chunkRows(0),
+   columnData(0),
+   compressData(false), tolerance(0.0), encoded(0), compressed(0), sizeCompressed(0),
+   fillChunk(0), drainChunk(0), numFull(0), finished(false), threaded(false)
+{
+
+}
+
+ColumnarFileStream::ColumnarFileStream(const char *file, openMode mode,
+				       bool compress, double tol)
+  :OPS_Stream(OPS_STREAM_TAGS_ColumnarFileStream),
+   fileOpen(0), theOpenMode(OVERWRITE), fileName(0), sendSelfCount(0),
+   numDescribed(0), numColumns(-1), rowsPerChunk(0), chunks(0), chunkRows(0),
+   columnData(0),
+   compressData(false), tolerance(0.0), encoded(0), compressed(0), sizeCompressed(0),
+   fillChunk(0), drainChunk(0), numFull(0), finished(false), threaded(false)
+{
+  this->setFile(file, mode);
+  this->setCompression(compress, tol);
+}
+
+ColumnarFileStream::~ColumnarFileStream()
+{
+  this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int
+ColumnarFileStream::setFile(const char *name, openMode mode)
+{
+  if (name == 0) {
+    opserr << "ColumnarFileStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  // if file already open, close it
+  if (fileOpen == 1)
+    this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  theOpenMode = mode;
+
+  return 0;
+}
+
+int
+ColumnarFileStream::setCompression(bool compress, double tol)
+{
+  // a section already started keeps its format
+  if (numColumns >= 0) {
+    opserr << "WARNING - ColumnarFileStream::setCompression() - data already written to ";
+    opserr << fileName << endln;
+    return -1;
+  }
+
+  if (tol < 0.0) {
+    opserr << "WARNING - ColumnarFileStream::setCompression() - tolerance " << tol;
+    opserr << " < 0, values are not rounded\n";
+    tol = 0.0;
+  }
+
+#ifdef _ZLIB
+  compressData = compress || tol > 0.0;
+  tolerance = tol;
+#else
+  if (compress == true || tol > 0.0)
+    opserr << "WARNING - ColumnarFileStream - zlib is not available, the data is not compressed\n";
+  compressData = false;
+  tolerance = 0.0;
+#endif
+
+  return 0;
+}
+
+int
+ColumnarFileStream::open(void)
+{
+  // check setFile has been called
+  if (fileName == 0) {
+    opserr << "ColumnarFileStream::open(void) - no file name has been set\n";
+    return -1;
+  }
+
+  // if file already open, return
+  if (fileOpen == 1)
+    return 0;
+
+  if (theOpenMode == OVERWRITE)
+    theFile.open(fileName, ios::out | ios::binary);
+  else
+    theFile.open(fileName, ios::out | ios::app | ios::binary);
+
+  // a file closed & reopened gets a second header & its own chunks
+  theOpenMode = APPEND;
+
+  if (!theFile.is_open() || theFile.bad()) {
+    opserr << "WARNING - ColumnarFileStream::open()";
+    opserr << " - could not open file " << fileName << endln;
+    fileOpen = 0;
+    return -1;
+  }
+
+  fileOpen = 1;
+  return 0;
+}
+
+int
+ColumnarFileStream::close(void)
+{
+  if (numColumns > 0) {
+
+    // hand over the last partial chunk & wait for the writer to finish
+    if (chunkRows[fillChunk] != 0)
+      this->submitChunk();
+
+#ifndef _WIN32
+    if (threaded == true) {
+      pthread_mutex_lock(&lock);
+      finished = true;
+      pthread_cond_signal(&chunkFull);
+      pthread_mutex_unlock(&lock);
+
+      pthread_join(writer, 0);
+      pthread_mutex_destroy(&lock);
+      pthread_cond_destroy(&chunkFull);
+      pthread_cond_destroy(&chunkFree);
+      threaded = false;
+    }
+#endif
+
+    for (int i=0; i<COLUMNAR_NUM_CHUNKS; i++)
+      delete [] chunks[i];
+    delete [] chunks;
+    delete [] chunkRows;
+    delete [] columnData;
+    chunks = 0;
+    chunkRows = 0;
+    columnData = 0;
+
+    if (encoded != 0)
+      delete [] encoded;
+    if (compressed != 0)
+      delete [] compressed;
+    encoded = 0;
+    compressed = 0;
+    sizeCompressed = 0;
+  }
+
+  numColumns = -1;
+  fillChunk = 0;
+  drainChunk = 0;
+  numFull = 0;
+  finished = false;
+
+  openTags.clear();
+  description.clear();
+  numDescribed = 0;
+
+  if (fileOpen != 0)
+    theFile.close();
+  fileOpen = 0;
+
+  return 0;
+}
+
+int
+ColumnarFileStream::tag(const char *tagName)
+{
+  if (numColumns < 0)
+    openTags.push_back(std::string(tagName));
+
+  return 0;
+}
+
+int
+ColumnarFileStream::tag(const char *tagName, const char *value)
+{
+  // a tag with a value is a leaf, the description of the next column
+  if (numColumns < 0) {
+    for (unsigned int i=0; i<openTags.size(); i++) {
+      description += openTags[i];
+      description += '/';
+    }
+    description += tagName;
+    description += '=';
+    description += value;
+    description += '\n';
+    numDescribed++;
+  }
+
+  return 0;
+}
+
+int
+ColumnarFileStream::endTag()
+{
+  if (numColumns < 0 && openTags.empty() == false)
+    openTags.pop_back();
+
+  return 0;
+}
+
+int
+ColumnarFileStream::attr(const char *name, int value)
+{
+  char buffer[32];
+  sprintf(buffer, "%d", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+ColumnarFileStream::attr(const char *name, double value)
+{
+  char buffer[32];
+  sprintf(buffer, "%.10g", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+ColumnarFileStream::attr(const char *name, const char *value)
+{
+  if (numColumns < 0 && openTags.empty() == false) {
+
+    // attributes in brackets after the tag name: NodeOutput[nodeTag=1 coord1=0]
+    std::string &theTag = openTags.back();
+    if (theTag[theTag.size()-1] == ']') {
+      theTag[theTag.size()-1] = ' ';
+    } else
+      theTag += '[';
+    theTag += name;
+    theTag += '=';
+    theTag += value;
+    theTag += ']';
+  }
+
+  return 0;
+}
+
+int
+ColumnarFileStream::write(Vector &data)
+{
+  if (fileOpen == 0)
+    if (this->open() < 0)
+      return -1;
+
+  int size = data.Size();
+
+  // the first row fixes the number of columns & completes the header
+  if (numColumns < 0)
+    if (this->startData(size) < 0)
+      return -1;
+
+  if (numColumns == 0)
+    return 0;
+
+  double *row = chunks[fillChunk] + chunkRows[fillChunk]*numColumns;
+  if (size >= numColumns)
+    memcpy(row, &data(0), numColumns*sizeof(double));
+  else {
+    if (size > 0)
+      memcpy(row, &data(0), size*sizeof(double));
+    for (int i=size; i<numColumns; i++)
+      row[i] = 0.0;
+  }
+
+  chunkRows[fillChunk]++;
+  if (chunkRows[fillChunk] == rowsPerChunk)
+    this->submitChunk();
+
+  return 0;
+}
+
+OPS_Stream&
+ColumnarFileStream::write(const double *s, int n)
+{
+  Vector data((double *)s, n);
+  this->write(data);
+
+  return *this;
+}
+
+int
+ColumnarFileStream::startData(int numCol)
+{
+  numColumns = numCol;
+
+  if (numDescribed != numColumns) {
+    opserr << "WARNING - ColumnarFileStream - " << fileName << ": " << numDescribed;
+    opserr << " columns described for rows of size " << numColumns << endln;
+  }
+
+  // header
+  int byteOrder = 1;
+  int descriptionLength = description.size();
+  theFile.write(compressData ? compressedMagic : columnarMagic, 8);
+  theFile.write((const char *)&byteOrder, sizeof(int));
+  theFile.write((const char *)&numColumns, sizeof(int));
+  theFile.write((const char *)&descriptionLength, sizeof(int));
+  theFile.write(description.data(), descriptionLength);
+  if (compressData == true)
+    theFile.write((const char *)&tolerance, sizeof(double));
+
+  if (numColumns == 0)
+    return 0;
+
+  rowsPerChunk = COLUMNAR_CHUNK_SIZE/numColumns;
+  if (rowsPerChunk < 1)
+    rowsPerChunk = 1;
+
+  chunks = new double *[COLUMNAR_NUM_CHUNKS];
+  chunkRows = new int[COLUMNAR_NUM_CHUNKS];
+  for (int i=0; i<COLUMNAR_NUM_CHUNKS; i++) {
+    chunks[i] = new double[rowsPerChunk*numColumns];
+    chunkRows[i] = 0;
+  }
+  columnData = new double[rowsPerChunk];
+
+#ifdef _ZLIB
+  if (compressData == true) {
+    unsigned long sizeEncoded = numColumns*(1+rowsPerChunk*8UL);
+    sizeCompressed = compressBound(sizeEncoded);
+    encoded = new unsigned char[sizeEncoded];
+    compressed = new unsigned char[sizeCompressed];
+  }
+#endif
+
+  fillChunk = 0;
+  drainChunk = 0;
+  numFull = 0;
+  finished = false;
+  threaded = false;
+
+#ifndef _WIN32
+  pthread_mutex_init(&lock, 0);
+  pthread_cond_init(&chunkFull, 0);
+  pthread_cond_init(&chunkFree, 0);
+  if (pthread_create(&writer, 0, columnarWriter, (void *)this) == 0)
+    threaded = true;
+  else {
+    opserr << "WARNING - ColumnarFileStream - could not start a writer thread,";
+    opserr << " writing " << fileName << " synchronously\n";
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&chunkFull);
+    pthread_cond_destroy(&chunkFree);
+  }
+#endif
+
+  return 0;
+}
+
+void
+ColumnarFileStream::submitChunk(void)
+{
+  if (threaded == false) {
+    this->writeChunk(fillChunk);
+    chunkRows[fillChunk] = 0;
+    return;
+  }
+
+#ifndef _WIN32
+  // pass the chunk to the writer & wait until the next one is free
+  pthread_mutex_lock(&lock);
+  numFull++;
+  fillChunk = (fillChunk+1)%COLUMNAR_NUM_CHUNKS;
+  pthread_cond_signal(&chunkFull);
+  while (numFull == COLUMNAR_NUM_CHUNKS)
+    pthread_cond_wait(&chunkFree, &lock);
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+void
+ColumnarFileStream::drainChunks(void)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+  while (true) {
+    while (numFull == 0 && finished == false)
+      pthread_cond_wait(&chunkFull, &lock);
+    if (numFull == 0)
+      break;
+
+    int chunk = drainChunk;
+    pthread_mutex_unlock(&lock);
+
+    this->writeChunk(chunk);
+
+    pthread_mutex_lock(&lock);
+    chunkRows[chunk] = 0;
+    drainChunk = (drainChunk+1)%COLUMNAR_NUM_CHUNKS;
+    numFull--;
+    pthread_cond_signal(&chunkFree);
+  }
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+void
+ColumnarFileStream::writeChunk(int chunk)
+{
+  int numRows = chunkRows[chunk];
+  double *data = chunks[chunk];
+
+#ifdef _ZLIB
+  if (compressData == true) {
+    int columnBytes = 1+numRows*8;
+    for (int j=0; j<numColumns; j++) {
+      for (int i=0; i<numRows; i++)
+	columnData[i] = data[i*numColumns+j];
+      encodeColumn(columnData, numRows, tolerance, &encoded[j*columnBytes]);
+    }
+
+    uLongf numBytes = sizeCompressed;
+    if (compress2(compressed, &numBytes, encoded, (uLong)numColumns*columnBytes,
+		  Z_BEST_SPEED) != Z_OK) {
+      opserr << "WARNING - ColumnarFileStream - failed to compress a chunk of ";
+      opserr << fileName << endln;
+      return;
+    }
+
+    int size = numBytes;
+    theFile.write((const char *)&numRows, sizeof(int));
+    theFile.write((const char *)&size, sizeof(int));
+    theFile.write((const char *)compressed, size);
+    return;
+  }
+#endif
+
+  theFile.write((const char *)&numRows, sizeof(int));
+  for (int j=0; j<numColumns; j++) {
+    for (int i=0; i<numRows; i++)
+      columnData[i] = data[i*numColumns+j];
+    theFile.write((const char *)columnData, numRows*sizeof(double));
+  }
+}
+
+size_t
+ColumnarFileStream::getNumBytes(void)
+{
+  if (chunks == 0)
+    return 0;
+
+  // the chunks and the column of one chunk, then the compression buffers
+  size_t numBytes = (COLUMNAR_NUM_CHUNKS*(size_t)numColumns + 1)*rowsPerChunk*sizeof(double);
+  if (compressed != 0)
+    numBytes += numColumns*(1+rowsPerChunk*8UL) + sizeCompressed;
+
+  return numBytes;
+}
+
+int
+ColumnarFileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  sendSelfCount++;
+
+  static ID idData(4);
+  static Vector vectData(1);
+  int fileNameLength = 0;
+  if (fileName != 0)
+    fileNameLength = strlen(fileName);
+
+  idData(0) = fileNameLength;
+
+  if (theOpenMode == OVERWRITE)
+    idData(1) = 0;
+  else
+    idData(1) = 1;
+
+  idData(2) = sendSelfCount;
+  idData(3) = compressData ? 1 : 0;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "ColumnarFileStream::sendSelf() - failed to send id data\n";
+    return -1;
+  }
+
+  vectData(0) = tolerance;
+  if (theChannel.sendVector(0, commitTag, vectData) < 0) {
+    opserr << "ColumnarFileStream::sendSelf() - failed to send vector data\n";
+    return -1;
+  }
+
+  if (fileNameLength != 0) {
+    Message theMessage(fileName, fileNameLength);
+    if (theChannel.sendMsg(0, commitTag, theMessage) < 0) {
+      opserr << "ColumnarFileStream::sendSelf() - failed to send message\n";
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int
+ColumnarFileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  static ID idData(4);
+  static Vector vectData(1);
+
+  sendSelfCount = -1;
+
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "ColumnarFileStream::recvSelf() - failed to recv id data\n";
+    return -1;
+  }
+
+  if (theChannel.recvVector(0, commitTag, vectData) < 0) {
+    opserr << "ColumnarFileStream::recvSelf() - failed to recv vector data\n";
+    return -1;
+  }
+  this->setCompression(idData(3) != 0, vectData(0));
+
+  int fileNameLength = idData(0);
+  openMode mode = OVERWRITE;
+  if (idData(1) != 0)
+    mode = APPEND;
+
+  if (fileNameLength != 0) {
+    char *name = new char[fileNameLength+12];
+    Message theMessage(name, fileNameLength);
+    if (theChannel.recvMsg(0, commitTag, theMessage) < 0) {
+      opserr << "ColumnarFileStream::recvSelf() - failed to recv message\n";
+      delete [] name;
+      return -1;
+    }
+
+    // each remote process writes its own file, fileName.processTag
+    sprintf(&name[fileNameLength], ".%d", idData(2));
+    this->setFile(name, mode);
+    delete [] name;
+  }
+
+  return 0;
+}
+
+int
+columnarToText(const char *inputFilename, const char *outputFilename)
+{
+  ifstream input(inputFilename, ios::in | ios::binary);
+  if (!input.is_open()) {
+    opserr << "WARNING - ColumnarFileStream - columnarToText()";
+    opserr << " - could not open file " << inputFilename << endln;
+    return -1;
+  }
+
+  ofstream output(outputFilename, ios::out);
+  if (!output.is_open()) {
+    opserr << "WARNING - ColumnarFileStream - columnarToText()";
+    opserr << " - could not open file " << outputFilename << endln;
+    input.close();
+    return -1;
+  }
+
+  output.precision(16);
+
+  //
+  // one or more sections, each a header & its chunks; the column
+  // descriptions are written as comment lines starting with #
+  //
+
+  int numColumns = 0;
+  double *data = 0;
+  int sizeData = 0;
+  char start[8];
+  int result = 0;
+
+  // for compressed sections
+  bool compressedSection = false;
+  double tolerance = 0.0;
+  unsigned char *bytes = 0;
+  unsigned char *encoded = 0;
+#ifdef _ZLIB
+  int sizeBytes = 0;
+  unsigned long sizeEncoded = 0;
+#endif
+
+  while (input.read(start, sizeof(int))) {
+
+    if (strncmp(start, columnarMagic, sizeof(int)) == 0) {
+
+      input.read(&start[sizeof(int)], 8-sizeof(int));
+      int byteOrder = 0;
+      int descriptionLength = 0;
+      input.read((char *)&byteOrder, sizeof(int));
+      input.read((char *)&numColumns, sizeof(int));
+      input.read((char *)&descriptionLength, sizeof(int));
+      compressedSection = (strncmp(start, compressedMagic, 8) == 0);
+      if (!input || (strncmp(start, columnarMagic, 8) != 0 && compressedSection == false)
+	  || byteOrder != 1 || numColumns < 0 || descriptionLength < 0) {
+	opserr << "WARNING - ColumnarFileStream - columnarToText() - " << inputFilename;
+	opserr << " is not a columnar file written on a machine of this byte order\n";
+	result = -1;
+	break;
+      }
+
+      char *description = new char[descriptionLength+1];
+      input.read(description, descriptionLength);
+      description[descriptionLength] = '\0';
+      char *line = description;
+      int column = 1;
+      while (*line != '\0') {
+	char *next = strchr(line, '\n');
+	if (next != 0)
+	  *next = '\0';
+	output << "# " << column++ << " " << line << "\n";
+	if (next == 0)
+	  break;
+	line = next+1;
+      }
+      delete [] description;
+
+      if (compressedSection == true) {
+	input.read((char *)&tolerance, sizeof(double));
+#ifndef _ZLIB
+	opserr << "WARNING - ColumnarFileStream - columnarToText() - " << inputFilename;
+	opserr << " is compressed and zlib is not available\n";
+	result = -1;
+	break;
+#endif
+      }
+
+    } else {
+
+      int numRows = *((int *)start);
+      if (numRows < 0 || (numRows > 0 && numColumns == 0)) {
+	opserr << "WARNING - ColumnarFileStream - columnarToText() - " << inputFilename;
+	opserr << " is corrupt\n";
+	result = -1;
+	break;
+      }
+
+      if (numRows*numColumns > sizeData) {
+	if (data != 0)
+	  delete [] data;
+	sizeData = numRows*numColumns;
+	data = new double[sizeData];
+      }
+
+      if (compressedSection == false)
+	input.read((char *)data, numRows*numColumns*sizeof(double));
+#ifdef _ZLIB
+      else {
+	int numBytes = -1;
+	input.read((char *)&numBytes, sizeof(int));
+	if (!input || numBytes < 0) {
+	  opserr << "WARNING - ColumnarFileStream - columnarToText() - " << inputFilename;
+	  opserr << " is corrupt\n";
+	  result = -1;
+	  break;
+	}
+	if (numBytes > sizeBytes) {
+	  if (bytes != 0)
+	    delete [] bytes;
+	  sizeBytes = numBytes;
+	  bytes = new unsigned char[sizeBytes];
+	}
+	input.read((char *)bytes, numBytes);
+
+	int columnBytes = 1+numRows*8;
+	uLongf size = (uLongf)numColumns*columnBytes;
+	if (size > sizeEncoded) {
+	  if (encoded != 0)
+	    delete [] encoded;
+	  sizeEncoded = size;
+	  encoded = new unsigned char[sizeEncoded];
+	}
+	if (input && uncompress(encoded, &size, bytes, numBytes) == Z_OK
+	    && size == (uLongf)numColumns*columnBytes) {
+	  for (int j=0; j<numColumns; j++)
+	    decodeColumn(&encoded[j*columnBytes], numRows, tolerance, &data[j*numRows]);
+	} else if (input) {
+	  opserr << "WARNING - ColumnarFileStream - columnarToText() - " << inputFilename;
+	  opserr << " has a chunk that can not be uncompressed\n";
+	  result = -1;
+	  break;
+	}
+      }
+#endif
+      if (!input) {
+	opserr << "WARNING - ColumnarFileStream - columnarToText() - " << inputFilename;
+	opserr << " ends in an incomplete chunk\n";
+	result = -1;
+	break;
+      }
+
+      for (int i=0; i<numRows; i++) {
+	for (int j=0; j<numColumns; j++) {
+	  output << data[j*numRows+i];
+	  if (j < numColumns-1)
+	    output << " ";
+	}
+	output << "\n";
+      }
+    }
+  }
+
+  if (data != 0)
+    delete [] data;
+  if (bytes != 0)
+    delete [] bytes;
+  if (encoded != 0)
+    delete [] encoded;
+
+  input.close();
+  output.close();
+
+  return result;
+}
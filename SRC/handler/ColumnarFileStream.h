@@ -0,0 +1,174 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ColumnarFileStream.h,v $
+
+#ifndef _ColumnarFileStream
+#define _ColumnarFileStream
+
+// Created: 10/26
+//
+// Description: ColumnarFileStream is an OPS_Stream for the recorders that
+// writes a self-describing binary file. The tags & attributes the recorder
+// outputs before its first write() become the header, one line describing
+// each column (e.g. NodeOutput[nodeTag=3]/ResponseType=UX); the rows given
+// to write() are stored in chunks, each chunk column by column:
+//
+//   char[8]  "OPSCOL01"
+//   int      1              (byte order check)
+//   int      numColumns
+//   int      descriptionLength, char[descriptionLength]
+//   chunks:  int numRows, then numColumns x numRows doubles
+//
+// Rows are copied into a ring of chunk buffers which a writer thread
+// (pthreads, not on _WIN32) drains to the file, so write() returns after the
+// copy. The last partial chunk is written when the stream is closed.
+//
+// With compress (needs zlib, _ZLIB) the file is "OPSCOL02", the header
+// ending in a double tolerance, and each chunk is int numRows, int numBytes
+// and numBytes of zlib compressed data. In this each column is a byte mode
+// then the numRows 64 bit words of the column with their bytes shuffled,
+// all first bytes, then all second bytes and so on. The words are the bits
+// of each value xor those of the value before (mode 0, lossless) or, with
+// a tolerance > 0, the differences between the values rounded to a
+// multiple of 2*tolerance (mode 1), which are then within tolerance of the
+// values recorded. A column with a value too large to round is lossless.
+// The encoding and compression are done by the writer thread.
+
+#include <OPS_Stream.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+using std::ofstream;
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+int columnarToText(const char *inputFilename, const char *outputFilename);
+
+class ColumnarFileStream : public OPS_Stream
+{
+ public:
+  ColumnarFileStream();
+  ColumnarFileStream(const char *fileName, openMode mode = OVERWRITE,
+		     bool compress = false, double tolerance = 0.0);
+  ~ColumnarFileStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE);
+  int setCompression(bool compress, double tolerance = 0.0);
+  int open(void);
+  int close(void);
+
+  int setPrecision(int precision) {return 0;};
+  int setFloatField(floatField) {return 0;};
+  int precision(int precision) {return 0;};
+  int width(int width) {return 0;};
+  const char *getFileName(void) {return fileName;}
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff, only doubles are written
+  OPS_Stream& write(const char *s, int n) {return *this;};
+  OPS_Stream& write(const unsigned char *s, int n) {return *this;};
+  OPS_Stream& write(const signed char *s, int n) {return *this;};
+  OPS_Stream& write(const void *s, int n) {return *this;};
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c) {return *this;};
+  OPS_Stream& operator<<(unsigned char c) {return *this;};
+  OPS_Stream& operator<<(signed char c) {return *this;};
+  OPS_Stream& operator<<(const char *s) {return *this;};
+  OPS_Stream& operator<<(const unsigned char *s) {return *this;};
+  OPS_Stream& operator<<(const signed char *s) {return *this;};
+  OPS_Stream& operator<<(const void *p) {return *this;};
+  OPS_Stream& operator<<(int n) {return *this;};
+  OPS_Stream& operator<<(unsigned int n) {return *this;};
+  OPS_Stream& operator<<(long n) {return *this;};
+  OPS_Stream& operator<<(unsigned long n) {return *this;};
+  OPS_Stream& operator<<(short n) {return *this;};
+  OPS_Stream& operator<<(unsigned short n) {return *this;};
+  OPS_Stream& operator<<(bool b) {return *this;};
+  OPS_Stream& operator<<(double n) {return *this;};
+  OPS_Stream& operator<<(float n) {return *this;};
+
+  size_t getNumBytes(void);
+
+  // parallel stuff, each process writes its own file
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+	       FEM_ObjectBroker &theBroker);
+
+  // called by the writer thread
+  void drainChunks(void);
+
+ private:
+  int startData(int numColumns);
+  void submitChunk(void);
+  void writeChunk(int chunk);
+
+  ofstream theFile;
+  int fileOpen;
+  openMode theOpenMode;
+  char *fileName;
+  int sendSelfCount;
+
+  // header
+  std::vector<std::string> openTags;
+  std::string description;
+  int numDescribed;
+
+  // ring of chunk buffers, each rowsPerChunk x numColumns stored by row
+  int numColumns;
+  int rowsPerChunk;
+  double **chunks;
+  int *chunkRows;
+  double *columnData;
+
+  // compression, the encoded chunk & its compressed bytes
+  bool compressData;
+  double tolerance;
+  unsigned char *encoded;
+  unsigned char *compressed;
+  unsigned long sizeCompressed;
+  int fillChunk;    // chunk being filled by write()
+  int drainChunk;   // next chunk to be written to the file
+  int numFull;
+  bool finished;
+  bool threaded;
+#ifndef _WIN32
+  pthread_t writer;
+  pthread_mutex_t lock;
+  pthread_cond_t chunkFull;
+  pthread_cond_t chunkFree;
+#endif
+};
+
+#endif
@@ -53,6 +53,10 @@ DataOutputDatabaseHandler::DataOutputDatabaseHandler(FE_Datastore *database, con
 
 DataOutputDatabaseHandler::~DataOutputDatabaseHandler()
 {
+  // the rows still kept in a batch are written
+  if (theDatabase != 0)
+    theDatabase->flushData();
+
   if (tableName != 0)
     delete [] tableName;
 
@@ -54,6 +54,10 @@ DatabaseStream::DatabaseStream(FE_Datastore *database, const char *tName)
 
 DatabaseStream::~DatabaseStream()
 {
+  // the rows still kept in a batch are written
+  if (theDatabase != 0)
+    theDatabase->flushData();
+
   if (tableName != 0)
     delete [] tableName;
 
@@ -0,0 +1,630 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/H5FileStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of H5FileStream.
+//
+// What: "@(#) H5FileStream.cpp, revA"
+
+#include <H5FileStream.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <Message.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+
+#include <string.h>
+#include <stdio.h>
+
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
+// number of doubles in a chunk of a data set & in the rows kept in memory
+#define H5_CHUNK_SIZE 65536
+#define H5_WRITE_SIZE 1048576
+
+// deflate level of the data sets
+#define H5_DEFLATE_LEVEL 4
+
+//
+// the files open for the streams, one hid_t for all the recorders writing
+// to a file; a file is created (truncated) by the first stream opening it
+// with OVERWRITE & opened for read/write by the others
+//
+
+struct H5SharedFile {
+  std::string name;
+  hid_t file;
+  int numStreams;
+};
+
+static std::vector<H5SharedFile> theH5Files;
+static std::vector<std::string> createdH5Files;
+
+static hid_t
+openH5File(const char *name, openMode mode, bool collective)
+{
+  for (unsigned int i=0; i<theH5Files.size(); i++)
+    if (theH5Files[i].name == name) {
+      theH5Files[i].numStreams++;
+      return theH5Files[i].file;
+    }
+
+  bool created = false;
+  for (unsigned int i=0; i<createdH5Files.size(); i++)
+    if (createdH5Files[i] == name)
+      created = true;
+
+  hid_t access = H5Pcreate(H5P_FILE_ACCESS);
+#if defined(_PARALLEL_INTERPRETERS) && defined(H5_HAVE_PARALLEL)
+  if (collective == true)
+    H5Pset_fapl_mpio(access, MPI_COMM_WORLD, MPI_INFO_NULL);
+#endif
+
+  hid_t file = -1;
+  if (mode == OVERWRITE && created == false)
+    file = H5Fcreate(name, H5F_ACC_TRUNC, H5P_DEFAULT, access);
+  else {
+    // open an existing file, create it if there is none
+    H5E_BEGIN_TRY {
+      file = H5Fopen(name, H5F_ACC_RDWR, access);
+    } H5E_END_TRY;
+    if (file < 0)
+      file = H5Fcreate(name, H5F_ACC_EXCL, H5P_DEFAULT, access);
+  }
+  H5Pclose(access);
+
+  if (file < 0)
+    return -1;
+
+  if (created == false)
+    createdH5Files.push_back(std::string(name));
+
+  H5SharedFile theFile;
+  theFile.name = name;
+  theFile.file = file;
+  theFile.numStreams = 1;
+  theH5Files.push_back(theFile);
+
+  return file;
+}
+
+static void
+closeH5File(hid_t file)
+{
+  for (unsigned int i=0; i<theH5Files.size(); i++)
+    if (theH5Files[i].file == file) {
+      theH5Files[i].numStreams--;
+      if (theH5Files[i].numStreams == 0) {
+	H5Fclose(file);
+	theH5Files.erase(theH5Files.begin()+i);
+      } else
+	H5Fflush(file, H5F_SCOPE_LOCAL);
+      return;
+    }
+}
+
+H5FileStream::H5FileStream()
+  :OPS_Stream(OPS_STREAM_TAGS_H5FileStream),
+   theFile(-1), fileOpen(0), theOpenMode(OVERWRITE), fileName(0),
+   sendSelfCount(0), collective(false),
+   numDescribed(0), myColumns(-1), numProcesses(1), processID(0),
+   numColumns(0), theGroup(-1), dataSets(0), numRowsWritten(0),
+   rows(0), rowsPerWrite(0), numRows(0)
+{
+
+}
+
+H5FileStream::H5FileStream(const char *file, openMode mode)
+  :OPS_Stream(OPS_STREAM_TAGS_H5FileStream),
+   theFile(-1), fileOpen(0), theOpenMode(OVERWRITE), fileName(0),
+   sendSelfCount(0), collective(false),
+   numDescribed(0), myColumns(-1), numProcesses(1), processID(0),
+   numColumns(0), theGroup(-1), dataSets(0), numRowsWritten(0),
+   rows(0), rowsPerWrite(0), numRows(0)
+{
+#ifdef _PARALLEL_INTERPRETERS
+  int flag = 0;
+  MPI_Initialized(&flag);
+  if (flag != 0) {
+    MPI_Comm_size(MPI_COMM_WORLD, &numProcesses);
+    MPI_Comm_rank(MPI_COMM_WORLD, &processID);
+  }
+#endif
+
+  if (numProcesses > 1) {
+#ifdef H5_HAVE_PARALLEL
+    // every process opens the one file
+    collective = true;
+    this->setFile(file, mode);
+#else
+    // each process writes its own file, fileName.processID
+    char *name = new char[strlen(file)+12];
+    sprintf(name, "%s.%d", file, processID);
+    this->setFile(name, mode);
+    delete [] name;
+    numProcesses = 1;
+    processID = 0;
+#endif
+  } else
+    this->setFile(file, mode);
+}
+
+H5FileStream::~H5FileStream()
+{
+  this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+}
+
+int
+H5FileStream::setFile(const char *name, openMode mode)
+{
+  if (name == 0) {
+    opserr << "H5FileStream::setFile() - no name passed\n";
+    return -1;
+  }
+
+  // if file already open, close it
+  if (fileOpen == 1)
+    this->close();
+
+  if (fileName != 0)
+    delete [] fileName;
+
+  fileName = new char[strlen(name)+1];
+  strcpy(fileName, name);
+
+  theOpenMode = mode;
+
+  return 0;
+}
+
+int
+H5FileStream::open(void)
+{
+  // check setFile has been called
+  if (fileName == 0) {
+    opserr << "H5FileStream::open(void) - no file name has been set\n";
+    return -1;
+  }
+
+  // if file already open, return
+  if (fileOpen == 1)
+    return 0;
+
+  theFile = openH5File(fileName, theOpenMode, collective);
+
+  // a stream closed & opened again writes a new group
+  theOpenMode = APPEND;
+
+  if (theFile < 0) {
+    opserr << "WARNING - H5FileStream::open()";
+    opserr << " - could not open file " << fileName << endln;
+    fileOpen = 0;
+    return -1;
+  }
+
+  fileOpen = 1;
+  return 0;
+}
+
+int
+H5FileStream::close(void)
+{
+  if (myColumns >= 0) {
+
+    // the rows still in memory
+    if (numRows != 0)
+      this->writeRows();
+
+    for (int i=0; i<numProcesses; i++)
+      if (dataSets[i] >= 0)
+	H5Dclose(dataSets[i]);
+    H5Gclose(theGroup);
+
+    delete [] dataSets;
+    delete [] numColumns;
+    if (rows != 0)
+      delete [] rows;
+    dataSets = 0;
+    numColumns = 0;
+    rows = 0;
+  }
+
+  myColumns = -1;
+  theGroup = -1;
+  numRowsWritten = 0;
+  numRows = 0;
+
+  openTags.clear();
+  description.clear();
+  numDescribed = 0;
+
+  if (fileOpen != 0)
+    closeH5File(theFile);
+  theFile = -1;
+  fileOpen = 0;
+
+  return 0;
+}
+
+int
+H5FileStream::tag(const char *tagName)
+{
+  if (myColumns < 0)
+    openTags.push_back(std::string(tagName));
+
+  return 0;
+}
+
+int
+H5FileStream::tag(const char *tagName, const char *value)
+{
+  // a tag with a value is a leaf, the description of the next column
+  if (myColumns < 0) {
+    for (unsigned int i=0; i<openTags.size(); i++) {
+      description += openTags[i];
+      description += '/';
+    }
+    description += tagName;
+    description += '=';
+    description += value;
+    description += '\n';
+    numDescribed++;
+  }
+
+  return 0;
+}
+
+int
+H5FileStream::endTag()
+{
+  if (myColumns < 0 && openTags.empty() == false)
+    openTags.pop_back();
+
+  return 0;
+}
+
+int
+H5FileStream::attr(const char *name, int value)
+{
+  char buffer[32];
+  sprintf(buffer, "%d", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+H5FileStream::attr(const char *name, double value)
+{
+  char buffer[32];
+  sprintf(buffer, "%.10g", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+H5FileStream::attr(const char *name, const char *value)
+{
+  if (myColumns < 0 && openTags.empty() == false) {
+
+    // attributes in brackets after the tag name: NodeOutput[nodeTag=1 coord1=0]
+    std::string &theTag = openTags.back();
+    if (theTag[theTag.size()-1] == ']') {
+      theTag[theTag.size()-1] = ' ';
+    } else
+      theTag += '[';
+    theTag += name;
+    theTag += '=';
+    theTag += value;
+    theTag += ']';
+  }
+
+  return 0;
+}
+
+int
+H5FileStream::write(Vector &data)
+{
+  if (fileOpen == 0)
+    if (this->open() < 0)
+      return -1;
+
+  int size = data.Size();
+
+  // the first row fixes the number of columns & creates the data sets
+  if (myColumns < 0)
+    if (this->startData(size) < 0)
+      return -1;
+
+  if (rowsPerWrite == 0)
+    return 0;
+
+  double *row = rows + numRows*myColumns;
+  if (size >= myColumns) {
+    if (myColumns > 0)
+      memcpy(row, &data(0), myColumns*sizeof(double));
+  } else {
+    if (size > 0)
+      memcpy(row, &data(0), size*sizeof(double));
+    for (int i=size; i<myColumns; i++)
+      row[i] = 0.0;
+  }
+
+  numRows++;
+  if (numRows == rowsPerWrite)
+    return this->writeRows();
+
+  return 0;
+}
+
+OPS_Stream&
+H5FileStream::write(const double *s, int n)
+{
+  Vector data((double *)s, n);
+  this->write(data);
+
+  return *this;
+}
+
+int
+H5FileStream::startData(int numCol)
+{
+  myColumns = numCol;
+
+  if (numDescribed != myColumns) {
+    opserr << "WARNING - H5FileStream - " << fileName << ": " << numDescribed;
+    opserr << " columns described for rows of size " << myColumns << endln;
+  }
+
+  // the number of columns & the length of the description of each process
+  numColumns = new int[numProcesses];
+  dataSets = new hid_t[numProcesses];
+  int *descriptionLength = new int[numProcesses];
+  numColumns[processID] = myColumns;
+  descriptionLength[processID] = description.size();
+#if defined(_PARALLEL_INTERPRETERS) && defined(H5_HAVE_PARALLEL)
+  if (collective == true) {
+    MPI_Allgather(&myColumns, 1, MPI_INT, numColumns, 1, MPI_INT, MPI_COMM_WORLD);
+    int myLength = description.size();
+    MPI_Allgather(&myLength, 1, MPI_INT, descriptionLength, 1, MPI_INT, MPI_COMM_WORLD);
+  }
+#endif
+
+  // the group of the recorder, numbered after those already in the file
+  H5G_info_t fileInfo;
+  H5Gget_info(theFile, &fileInfo);
+  char name[64];
+  sprintf(name, "recorder%d", (int)fileInfo.nlinks+1);
+  theGroup = H5Gcreate(theFile, name, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if (theGroup < 0) {
+    opserr << "WARNING - H5FileStream - " << fileName;
+    opserr << ": could not create group " << name << endln;
+    delete [] descriptionLength;
+    return -1;
+  }
+
+  // the data sets of all processes are created by each of them
+  int maxColumns = 0;
+  for (int i=0; i<numProcesses; i++) {
+    dataSets[i] = -1;
+    if (numColumns[i] > maxColumns)
+      maxColumns = numColumns[i];
+
+    char dataName[32];
+    char columnsName[32];
+    if (numProcesses == 1) {
+      strcpy(dataName, "data");
+      strcpy(columnsName, "columns");
+    } else {
+      sprintf(dataName, "data_%d", i);
+      sprintf(columnsName, "columns_%d", i);
+    }
+
+    if (descriptionLength[i] > 0) {
+      hsize_t length = descriptionLength[i];
+      hid_t space = H5Screate_simple(1, &length, 0);
+      hid_t columns = H5Dcreate(theGroup, columnsName, H5T_NATIVE_CHAR, space,
+				H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+      if (i == processID && columns >= 0)
+	H5Dwrite(columns, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+		 description.data());
+      if (columns >= 0)
+	H5Dclose(columns);
+      H5Sclose(space);
+    }
+
+    if (numColumns[i] <= 0)
+      continue;
+
+    hsize_t dims[2] = {0, (hsize_t)numColumns[i]};
+    hsize_t maxDims[2] = {H5S_UNLIMITED, (hsize_t)numColumns[i]};
+    hsize_t chunk[2] = {(hsize_t)(H5_CHUNK_SIZE/numColumns[i]), (hsize_t)numColumns[i]};
+    if (chunk[0] < 1)
+      chunk[0] = 1;
+
+    hid_t space = H5Screate_simple(2, dims, maxDims);
+    hid_t create = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(create, 2, chunk);
+    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+      H5Pset_shuffle(create);
+      H5Pset_deflate(create, H5_DEFLATE_LEVEL);
+    }
+    dataSets[i] = H5Dcreate(theGroup, dataName, H5T_NATIVE_DOUBLE, space,
+			    H5P_DEFAULT, create, H5P_DEFAULT);
+    H5Pclose(create);
+    H5Sclose(space);
+
+    if (dataSets[i] < 0) {
+      opserr << "WARNING - H5FileStream - " << fileName;
+      opserr << ": could not create data set " << name << "/" << dataName << endln;
+      numColumns[i] = 0;
+    }
+  }
+  delete [] descriptionLength;
+
+  // the same number of rows is kept by all the processes, so that they
+  // write together
+  numRows = 0;
+  numRowsWritten = 0;
+  rowsPerWrite = 0;
+  if (maxColumns > 0) {
+    rowsPerWrite = H5_WRITE_SIZE/maxColumns;
+    if (rowsPerWrite < 1)
+      rowsPerWrite = 1;
+    if (myColumns > 0)
+      rows = new double[rowsPerWrite*myColumns];
+  }
+
+  return 0;
+}
+
+int
+H5FileStream::writeRows(void)
+{
+  hid_t transfer = H5Pcreate(H5P_DATASET_XFER);
+#if defined(_PARALLEL_INTERPRETERS) && defined(H5_HAVE_PARALLEL)
+  if (collective == true)
+    H5Pset_dxpl_mpio(transfer, H5FD_MPIO_COLLECTIVE);
+#endif
+
+  int res = 0;
+  hsize_t newRows = numRowsWritten + numRows;
+  for (int i=0; i<numProcesses; i++) {
+    if (dataSets[i] < 0)
+      continue;
+
+    hsize_t dims[2] = {newRows, (hsize_t)numColumns[i]};
+    H5Dset_extent(dataSets[i], dims);
+
+    // each process writes its own rows, the others take part in the
+    // collective write with nothing selected
+    hid_t fileSpace = H5Dget_space(dataSets[i]);
+    hsize_t start[2] = {numRowsWritten, 0};
+    hsize_t count[2] = {(hsize_t)numRows, (hsize_t)numColumns[i]};
+    hid_t memSpace = H5Screate_simple(2, count, 0);
+    if (i == processID)
+      H5Sselect_hyperslab(fileSpace, H5S_SELECT_SET, start, 0, count, 0);
+    else {
+      H5Sselect_none(fileSpace);
+      H5Sselect_none(memSpace);
+    }
+
+    if (H5Dwrite(dataSets[i], H5T_NATIVE_DOUBLE, memSpace, fileSpace, transfer,
+		 (i == processID) ? rows : 0) < 0) {
+      opserr << "WARNING - H5FileStream - " << fileName << ": failed to write data\n";
+      res = -1;
+    }
+
+    H5Sclose(memSpace);
+    H5Sclose(fileSpace);
+  }
+
+  H5Pclose(transfer);
+
+  numRowsWritten = newRows;
+  numRows = 0;
+
+  return res;
+}
+
+int
+H5FileStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  sendSelfCount++;
+
+  static ID idData(3);
+  int fileNameLength = 0;
+  if (fileName != 0)
+    fileNameLength = strlen(fileName);
+
+  idData(0) = fileNameLength;
+
+  if (theOpenMode == OVERWRITE)
+    idData(1) = 0;
+  else
+    idData(1) = 1;
+
+  idData(2) = sendSelfCount;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "H5FileStream::sendSelf() - failed to send id data\n";
+    return -1;
+  }
+
+  if (fileNameLength != 0) {
+    Message theMessage(fileName, fileNameLength);
+    if (theChannel.sendMsg(0, commitTag, theMessage) < 0) {
+      opserr << "H5FileStream::sendSelf() - failed to send message\n";
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int
+H5FileStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  static ID idData(3);
+
+  sendSelfCount = -1;
+
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "H5FileStream::recvSelf() - failed to recv id data\n";
+    return -1;
+  }
+
+  int fileNameLength = idData(0);
+  openMode mode = OVERWRITE;
+  if (idData(1) != 0)
+    mode = APPEND;
+
+  if (fileNameLength != 0) {
+    char *name = new char[fileNameLength+12];
+    Message theMessage(name, fileNameLength);
+    if (theChannel.recvMsg(0, commitTag, theMessage) < 0) {
+      opserr << "H5FileStream::recvSelf() - failed to recv message\n";
+      delete [] name;
+      return -1;
+    }
+
+    // each remote process writes its own file, fileName.processTag
+    sprintf(&name[fileNameLength], ".%d", idData(2));
+    this->setFile(name, mode);
+    delete [] name;
+  }
+
+  // the remote processes do not open the file together
+  collective = false;
+  numProcesses = 1;
+  processID = 0;
+
+  return 0;
+}
@@ -0,0 +1,141 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/H5FileStream.h,v $
+
+#ifndef _H5FileStream
+#define _H5FileStream
+
+// Created: 10/26
+//
+// Description: H5FileStream is an OPS_Stream for the recorders that writes
+// into an HDF5 file shared by all the recorders given the same file name.
+// Each recorder gets a group /recorderN, N in order of the recorders'
+// first write, holding:
+//
+//   data     numRows x numColumns doubles, chunked & deflate compressed,
+//            extended as the rows are written
+//   columns  chars, the description of the columns, one line each, e.g.
+//            NodeOutput[nodeTag=3]/ResponseType=UX, made from the tags &
+//            attributes the recorder outputs before its first write()
+//
+// The rows are kept in memory and written a block at a time. In OpenSeesMP
+// (_PARALLEL_INTERPRETERS) with a parallel HDF5 library every process
+// opens the one file through MPI-IO and the group holds data_P & columns_P
+// for each process P with columns; the groups & datasets are created &
+// extended collectively, and a block is written with a collective write,
+// so all the processes must write the same number of rows, as the
+// recorders of OpenSeesMP do. With a serial HDF5 library each process
+// writes fileName.P; a stream sent to a remote process writes
+// fileName.tag. Built when _HDF5 is defined.
+
+#include <OPS_Stream.h>
+#include <hdf5.h>
+
+#include <string>
+#include <vector>
+
+class H5FileStream : public OPS_Stream
+{
+ public:
+  H5FileStream();
+  H5FileStream(const char *fileName, openMode mode = OVERWRITE);
+  ~H5FileStream();
+
+  int setFile(const char *fileName, openMode mode = OVERWRITE);
+  int open(void);
+  int close(void);
+
+  int setPrecision(int precision) {return 0;};
+  int setFloatField(floatField) {return 0;};
+  int precision(int precision) {return 0;};
+  int width(int width) {return 0;};
+  const char *getFileName(void) {return fileName;}
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff, only doubles are written
+  OPS_Stream& write(const char *s, int n) {return *this;};
+  OPS_Stream& write(const unsigned char *s, int n) {return *this;};
+  OPS_Stream& write(const signed char *s, int n) {return *this;};
+  OPS_Stream& write(const void *s, int n) {return *this;};
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c) {return *this;};
+  OPS_Stream& operator<<(unsigned char c) {return *this;};
+  OPS_Stream& operator<<(signed char c) {return *this;};
+  OPS_Stream& operator<<(const char *s) {return *this;};
+  OPS_Stream& operator<<(const unsigned char *s) {return *this;};
+  OPS_Stream& operator<<(const signed char *s) {return *this;};
+  OPS_Stream& operator<<(const void *p) {return *this;};
+  OPS_Stream& operator<<(int n) {return *this;};
+  OPS_Stream& operator<<(unsigned int n) {return *this;};
+  OPS_Stream& operator<<(long n) {return *this;};
+  OPS_Stream& operator<<(unsigned long n) {return *this;};
+  OPS_Stream& operator<<(short n) {return *this;};
+  OPS_Stream& operator<<(unsigned short n) {return *this;};
+  OPS_Stream& operator<<(bool b) {return *this;};
+  OPS_Stream& operator<<(double n) {return *this;};
+  OPS_Stream& operator<<(float n) {return *this;};
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  int startData(int numColumns);
+  int writeRows(void);
+
+  hid_t theFile;
+  int fileOpen;
+  openMode theOpenMode;
+  char *fileName;
+  int sendSelfCount;
+  bool collective;   // all the processes write the one file
+
+  // header
+  std::vector<std::string> openTags;
+  std::string description;
+  int numDescribed;
+
+  // the group of the recorder & a data set for each process
+  int myColumns;     // -1 until the first write
+  int numProcesses, processID;
+  int *numColumns;   // of each process
+  hid_t theGroup;
+  hid_t *dataSets;
+  hsize_t numRowsWritten;
+
+  // the rows not yet written, rowsPerWrite x numColumns by row
+  double *rows;
+  int rowsPerWrite;
+  int numRows;
+};
+
+#endif
@@ -26,6 +26,7 @@
 #define _OPS_Stream
 
 #include <MovableObject.h>
+#include <stddef.h>
 enum openMode  {OVERWRITE, APPEND};
 enum floatField {FIXEDD, SCIENTIFIC};
 class Vector;
@@ -77,6 +78,9 @@ class OPS_Stream:  public MovableObject
   virtual OPS_Stream& operator<<(double n);
   virtual OPS_Stream& operator<<(float n);
 
+  // the bytes of the output held in the buffers of the stream
+  virtual size_t getNumBytes(void) {return 0;}
+
   // parallel stuff
   virtual int setOrder(const ID &order);
   virtual int sendSelf(int commitTag, Channel &theChannel) =0;  
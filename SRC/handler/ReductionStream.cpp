@@ -0,0 +1,862 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ReductionStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ReductionStream.
+//
+// What: "@(#) ReductionStream.cpp, revA"
+
+#include <ReductionStream.h>
+#include <ID.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+
+#include <math.h>
+#include <string.h>
+#include <stdio.h>
+#include <algorithm>
+
+//
+// StreamReduction - the state of one reduction for all the columns
+//
+
+class StreamReduction
+{
+ public:
+  StreamReduction(int type, const Vector &parameters);
+
+  int getNumResults(void);
+  void getLabel(int result, char *label);
+
+  void start(int numColumns);
+  void add(const double *x, double time, double dT, int row);
+  void finish(double *results, int numRows);
+
+  int type;
+  Vector parameters;
+
+ private:
+  void setSpectrumCoefficients(double dT);
+  void countRainflow(int column);
+  double percentile(int column, int j, int numRows);
+
+  int numColumns;
+  int numState;                  // state of each column
+  std::vector<double> state;
+
+  // spectrum: the coefficients of each period for the time step dTlast
+  double dTlast;
+  std::vector<double> coefficients;
+
+  // rainflow: the reversals not yet counted & the counts of each column
+  std::vector<std::vector<double> > reversals;
+  std::vector<double> counts;
+};
+
+StreamReduction::StreamReduction(int theType, const Vector &theParameters)
+  :type(theType), parameters(theParameters),
+   numColumns(0), numState(0), dTlast(-1.0)
+{
+
+}
+
+int
+StreamReduction::getNumResults(void)
+{
+  switch (type) {
+  case REDUCE_PEAK:
+    return 2;
+  case REDUCE_SPECTRUM:
+    return parameters.Size()-1;
+  case REDUCE_RAINFLOW:
+    return (int)parameters(0);
+  case REDUCE_PERCENTILE:
+    return parameters.Size();
+  default:
+    return 1;
+  }
+}
+
+void
+StreamReduction::getLabel(int result, char *label)
+{
+  switch (type) {
+  case REDUCE_RMS:
+    strcpy(label, "rms");
+    break;
+  case REDUCE_PEAK:
+    strcpy(label, (result == 0) ? "peak" : "timeOfPeak");
+    break;
+  case REDUCE_SPECTRUM:
+    sprintf(label, "Sa(T=%g)", parameters(result+1));
+    break;
+  case REDUCE_CUMULATIVE:
+    strcpy(label, "cumulative");
+    break;
+  case REDUCE_PLASTIC:
+    strcpy(label, "plastic");
+    break;
+  case REDUCE_RAINFLOW:
+    sprintf(label, "cycles[%g,%g)", result*parameters(1), (result+1)*parameters(1));
+    break;
+  case REDUCE_PERCENTILE:
+    sprintf(label, "p%g", parameters(result));
+    break;
+  default:
+    strcpy(label, "unknown");
+  }
+}
+
+void
+StreamReduction::start(int numCol)
+{
+  numColumns = numCol;
+
+  switch (type) {
+  case REDUCE_RMS:
+    numState = 1;
+    break;
+  case REDUCE_PEAK:
+  case REDUCE_CUMULATIVE:
+  case REDUCE_PLASTIC:
+    numState = 2;
+    break;
+  case REDUCE_SPECTRUM:
+    // u, v & max|u| for each period, the last x
+    numState = 3*(parameters.Size()-1)+1;
+    break;
+  case REDUCE_RAINFLOW:
+    // the last x & the direction it was reached in
+    numState = 2;
+    reversals.assign(numColumns, std::vector<double>());
+    counts.assign(numColumns*this->getNumResults(), 0.0);
+    break;
+  case REDUCE_PERCENTILE:
+    // q, n & n' of the 5 markers of each percentile
+    numState = 15*parameters.Size();
+    break;
+  default:
+    numState = 0;
+  }
+
+  state.assign(numColumns*numState, 0.0);
+  dTlast = -1.0;
+}
+
+void
+StreamReduction::setSpectrumCoefficients(double dT)
+{
+  // u(i+1) = A u(i) + B v(i) + C p(i) + D p(i+1), v(i+1) likewise with
+  // A' B' C' D', p = -x for a linear p over the step (Chopra, 5.2)
+  double zeta = parameters(0);
+  int numPeriods = parameters.Size()-1;
+  coefficients.assign(8*numPeriods, 0.0);
+
+  for (int j=0; j<numPeriods; j++) {
+    double T = parameters(j+1);
+    if (T <= 0.0)
+      continue;
+
+    double w = 2.0*3.14159265358979323846/T;
+    double k = w*w;
+    double sq = sqrt(1.0-zeta*zeta);
+    double wD = w*sq;
+    double e = exp(-zeta*w*dT);
+    double s = sin(wD*dT);
+    double c = cos(wD*dT);
+    double *coef = &coefficients[8*j];
+
+    coef[0] = e*(zeta/sq*s + c);
+    coef[1] = e*s/wD;
+    coef[2] = (2.0*zeta/(w*dT) + e*(((1.0-2.0*zeta*zeta)/(wD*dT) - zeta/sq)*s
+				   - (1.0 + 2.0*zeta/(w*dT))*c))/k;
+    coef[3] = (1.0 - 2.0*zeta/(w*dT) + e*((2.0*zeta*zeta-1.0)/(wD*dT)*s
+					  + 2.0*zeta/(w*dT)*c))/k;
+    coef[4] = -e*w/sq*s;
+    coef[5] = e*(c - zeta/sq*s);
+    coef[6] = (-1.0/dT + e*((w/sq + zeta/(dT*sq))*s + c/dT))/k;
+    coef[7] = (1.0 - e*(zeta/sq*s + c))/(k*dT);
+  }
+
+  dTlast = dT;
+}
+
+void
+StreamReduction::countRainflow(int column)
+{
+  // three point rule on the reversals, the first reversal being the
+  // start of the history
+  std::vector<double> &s = reversals[column];
+  int numBins = (int)parameters(0);
+  double binWidth = parameters(1);
+  double *count = &counts[column*numBins];
+
+  while (s.size() >= 3) {
+    int n = s.size();
+    double X = fabs(s[n-1]-s[n-2]);
+    double Y = fabs(s[n-2]-s[n-3]);
+    if (X < Y)
+      break;
+
+    int bin = (binWidth > 0.0) ? (int)(Y/binWidth) : 0;
+    if (bin >= numBins)
+      bin = numBins-1;
+
+    if (n == 3) {
+      count[bin] += 0.5;
+      s.erase(s.begin());
+    } else {
+      count[bin] += 1.0;
+      s.erase(s.begin()+n-3, s.begin()+n-1);
+    }
+  }
+}
+
+void
+StreamReduction::add(const double *x, double time, double dT, int row)
+{
+  int numPeriods = parameters.Size()-1;
+  int numPercentiles = parameters.Size();
+
+  if (type == REDUCE_SPECTRUM && row > 0 && dT > 0.0 && dT != dTlast)
+    this->setSpectrumCoefficients(dT);
+
+  for (int i=0; i<numColumns; i++) {
+    double xi = x[i];
+    double *si = &state[i*numState];
+
+    switch (type) {
+
+    case REDUCE_RMS:
+      si[0] += xi*xi;
+      break;
+
+    case REDUCE_PEAK:
+      if (row == 0 || fabs(xi) > fabs(si[0])) {
+	si[0] = xi;
+	si[1] = time;
+      }
+      break;
+
+    case REDUCE_SPECTRUM:
+      for (int j=0; j<numPeriods; j++) {
+	double *sj = &si[3*j];
+	if (parameters(j+1) <= 0.0) {
+	  // T = 0, the peak of x itself
+	  if (fabs(xi) > sj[2])
+	    sj[2] = fabs(xi);
+	} else if (row > 0 && dT > 0.0) {
+	  const double *coef = &coefficients[8*j];
+	  double p0 = -si[3*numPeriods];
+	  double p1 = -xi;
+	  double u = coef[0]*sj[0] + coef[1]*sj[1] + coef[2]*p0 + coef[3]*p1;
+	  double v = coef[4]*sj[0] + coef[5]*sj[1] + coef[6]*p0 + coef[7]*p1;
+	  sj[0] = u;
+	  sj[1] = v;
+	  if (fabs(u) > sj[2])
+	    sj[2] = fabs(u);
+	}
+      }
+      si[3*numPeriods] = xi;
+      break;
+
+    case REDUCE_CUMULATIVE:
+      if (row > 0)
+	si[1] += fabs(xi-si[0]);
+      si[0] = xi;
+      break;
+
+    case REDUCE_PLASTIC: {
+      // si[0] the center of the elastic range
+      double yield = parameters(0);
+      if (xi > si[0]+yield) {
+	si[1] += xi-(si[0]+yield);
+	si[0] = xi-yield;
+      } else if (xi < si[0]-yield) {
+	si[1] += (si[0]-yield)-xi;
+	si[0] = xi+yield;
+      }
+      break;
+    }
+
+    case REDUCE_RAINFLOW: {
+      // si[0] the last x, si[1] the direction of the last change
+      if (row == 0) {
+	reversals[i].push_back(xi);
+	si[0] = xi;
+	break;
+      }
+      double dx = xi-si[0];
+      if (dx == 0.0)
+	break;
+      double dir = (dx > 0.0) ? 1.0 : -1.0;
+      if (si[1] != 0.0 && dir != si[1]) {
+	reversals[i].push_back(si[0]);
+	this->countRainflow(i);
+      }
+      si[1] = dir;
+      si[0] = xi;
+      break;
+    }
+
+    case REDUCE_PERCENTILE: {
+      double ax = fabs(xi);
+      for (int j=0; j<numPercentiles; j++) {
+	double *q = &si[15*j];
+	double *n = q+5;
+	double *np = q+10;
+	double p = parameters(j)/100.0;
+
+	if (row < 5) {
+	  q[row] = ax;
+	  if (row == 4) {
+	    std::sort(q, q+5);
+	    for (int m=0; m<5; m++)
+	      n[m] = m+1;
+	    np[0] = 1.0; np[1] = 1.0+2.0*p; np[2] = 1.0+4.0*p;
+	    np[3] = 3.0+2.0*p; np[4] = 5.0;
+	  }
+	  continue;
+	}
+
+	int k;
+	if (ax < q[0]) {
+	  q[0] = ax;
+	  k = 0;
+	} else if (ax >= q[4]) {
+	  q[4] = ax;
+	  k = 3;
+	} else {
+	  k = 0;
+	  while (k < 3 && ax >= q[k+1])
+	    k++;
+	}
+	for (int m=k+1; m<5; m++)
+	  n[m] += 1.0;
+	np[1] += p/2.0;
+	np[2] += p;
+	np[3] += (1.0+p)/2.0;
+	np[4] += 1.0;
+
+	// move the middle markers to their desired positions
+	for (int m=1; m<4; m++) {
+	  double d = np[m]-n[m];
+	  if ((d >= 1.0 && n[m+1]-n[m] > 1.0) || (d <= -1.0 && n[m-1]-n[m] < -1.0)) {
+	    double ds = (d > 0.0) ? 1.0 : -1.0;
+	    double qp = q[m] + ds/(n[m+1]-n[m-1])*
+	      ((n[m]-n[m-1]+ds)*(q[m+1]-q[m])/(n[m+1]-n[m]) +
+	       (n[m+1]-n[m]-ds)*(q[m]-q[m-1])/(n[m]-n[m-1]));
+	    if (q[m-1] < qp && qp < q[m+1])
+	      q[m] = qp;
+	    else {
+	      int o = m + (int)ds;
+	      q[m] += ds*(q[o]-q[m])/(n[o]-n[m]);
+	    }
+	    n[m] += ds;
+	  }
+	}
+      }
+      break;
+    }
+
+    default:
+      break;
+    }
+  }
+}
+
+double
+StreamReduction::percentile(int column, int j, int numRows)
+{
+  double *q = &state[column*numState + 15*j];
+  if (numRows >= 5)
+    return q[2];
+
+  // fewer rows than markers, the percentile of the rows themselves
+  if (numRows <= 0)
+    return 0.0;
+  double sorted[5];
+  for (int m=0; m<numRows; m++)
+    sorted[m] = q[m];
+  std::sort(sorted, sorted+numRows);
+  double pos = parameters(j)/100.0*(numRows-1);
+  int m = (int)pos;
+  if (m >= numRows-1)
+    return sorted[numRows-1];
+  return sorted[m] + (pos-m)*(sorted[m+1]-sorted[m]);
+}
+
+void
+StreamReduction::finish(double *results, int numRows)
+{
+  int numResults = this->getNumResults();
+
+  for (int i=0; i<numColumns; i++) {
+    double *si = &state[i*numState];
+    double *ri = &results[i*numResults];
+
+    switch (type) {
+    case REDUCE_RMS:
+      ri[0] = (numRows > 0) ? sqrt(si[0]/numRows) : 0.0;
+      break;
+
+    case REDUCE_PEAK:
+      ri[0] = si[0];
+      ri[1] = si[1];
+      break;
+
+    case REDUCE_SPECTRUM:
+      for (int j=0; j<numResults; j++) {
+	double T = parameters(j+1);
+	if (T <= 0.0)
+	  ri[j] = si[3*j+2];
+	else {
+	  double w = 2.0*3.14159265358979323846/T;
+	  ri[j] = w*w*si[3*j+2];
+	}
+      }
+      break;
+
+    case REDUCE_CUMULATIVE:
+    case REDUCE_PLASTIC:
+      ri[0] = si[1];
+      break;
+
+    case REDUCE_RAINFLOW: {
+      // the last point is a reversal, the ranges left are half cycles
+      std::vector<double> &s = reversals[i];
+      if (numRows > 1 && si[1] != 0.0) {
+	s.push_back(si[0]);
+	this->countRainflow(i);
+      }
+      double binWidth = parameters(1);
+      double *count = &counts[i*numResults];
+      for (unsigned int m=1; m<s.size(); m++) {
+	double range = fabs(s[m]-s[m-1]);
+	int bin = (binWidth > 0.0) ? (int)(range/binWidth) : 0;
+	if (bin >= numResults)
+	  bin = numResults-1;
+	count[bin] += 0.5;
+      }
+      s.clear();
+      for (int j=0; j<numResults; j++)
+	ri[j] = count[j];
+      break;
+    }
+
+    case REDUCE_PERCENTILE:
+      for (int j=0; j<numResults; j++)
+	ri[j] = this->percentile(i, j, numRows);
+      break;
+
+    default:
+      for (int j=0; j<numResults; j++)
+	ri[j] = 0.0;
+    }
+  }
+}
+
+//
+// ReductionStream
+//
+
+ReductionStream::ReductionStream(OPS_Stream *output, bool time)
+  :OPS_Stream(OPS_STREAM_TAGS_ReductionStream),
+   theOutput(output), timeColumn(time),
+   numColumns(-1), numRows(0), lastTime(0.0)
+{
+
+}
+
+ReductionStream::ReductionStream()
+  :OPS_Stream(OPS_STREAM_TAGS_ReductionStream),
+   theOutput(0), timeColumn(false),
+   numColumns(-1), numRows(0), lastTime(0.0)
+{
+
+}
+
+ReductionStream::~ReductionStream()
+{
+  this->close();
+  this->freeReductions();
+
+  if (theOutput != 0)
+    delete theOutput;
+}
+
+void
+ReductionStream::freeReductions(void)
+{
+  for (unsigned int i=0; i<theReductions.size(); i++)
+    delete theReductions[i];
+  theReductions.clear();
+}
+
+int
+ReductionStream::addReduction(int type, const Vector &parameters)
+{
+  bool ok = true;
+  switch (type) {
+  case REDUCE_RMS:
+  case REDUCE_PEAK:
+  case REDUCE_CUMULATIVE:
+    break;
+  case REDUCE_SPECTRUM:
+    ok = (parameters.Size() > 1 && parameters(0) >= 0.0 && parameters(0) < 1.0);
+    break;
+  case REDUCE_PLASTIC:
+    ok = (parameters.Size() == 1 && parameters(0) >= 0.0);
+    break;
+  case REDUCE_RAINFLOW:
+    ok = (parameters.Size() == 2 && parameters(0) >= 1.0 && parameters(1) > 0.0);
+    break;
+  case REDUCE_PERCENTILE:
+    ok = (parameters.Size() > 0);
+    for (int i=0; i<parameters.Size(); i++)
+      if (parameters(i) < 0.0 || parameters(i) > 100.0)
+	ok = false;
+    break;
+  default:
+    ok = false;
+  }
+
+  if (ok == false) {
+    opserr << "WARNING ReductionStream::addReduction() - invalid reduction " << type;
+    opserr << " or parameters " << parameters;
+    return -1;
+  }
+
+  if (numColumns >= 0) {
+    opserr << "WARNING ReductionStream::addReduction() - rows already reduced\n";
+    return -1;
+  }
+
+  theReductions.push_back(new StreamReduction(type, parameters));
+  return 0;
+}
+
+int
+ReductionStream::setPrecision(int precision)
+{
+  if (theOutput != 0)
+    return theOutput->setPrecision(precision);
+
+  return 0;
+}
+
+int
+ReductionStream::close(void)
+{
+  if (numColumns >= 0)
+    this->writeResults();
+
+  numColumns = -1;
+  numRows = 0;
+  lastTime = 0.0;
+  openTags.clear();
+  descriptions.clear();
+
+  return 0;
+}
+
+int
+ReductionStream::tag(const char *tagName)
+{
+  if (numColumns < 0)
+    openTags.push_back(std::string(tagName));
+
+  return 0;
+}
+
+int
+ReductionStream::tag(const char *tagName, const char *value)
+{
+  // a tag with a value is a leaf, the description of the next column
+  if (numColumns < 0) {
+    std::string description;
+    for (unsigned int i=0; i<openTags.size(); i++) {
+      description += openTags[i];
+      description += '/';
+    }
+    description += tagName;
+    description += '=';
+    description += value;
+    descriptions.push_back(description);
+  }
+
+  return 0;
+}
+
+int
+ReductionStream::endTag()
+{
+  if (numColumns < 0 && openTags.empty() == false)
+    openTags.pop_back();
+
+  return 0;
+}
+
+int
+ReductionStream::attr(const char *name, int value)
+{
+  char buffer[32];
+  sprintf(buffer, "%d", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+ReductionStream::attr(const char *name, double value)
+{
+  char buffer[32];
+  sprintf(buffer, "%.10g", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+ReductionStream::attr(const char *name, const char *value)
+{
+  if (numColumns < 0 && openTags.empty() == false) {
+
+    // attributes in brackets after the tag name: NodeOutput[nodeTag=1 coord1=0]
+    std::string &theTag = openTags.back();
+    if (theTag[theTag.size()-1] == ']') {
+      theTag[theTag.size()-1] = ' ';
+    } else
+      theTag += '[';
+    theTag += name;
+    theTag += '=';
+    theTag += value;
+    theTag += ']';
+  }
+
+  return 0;
+}
+
+int
+ReductionStream::write(Vector &data)
+{
+  int size = data.Size();
+  int first = (timeColumn == true) ? 1 : 0;
+
+  // the first row fixes the number of columns
+  if (numColumns < 0) {
+    numColumns = size;
+    int numReduced = numColumns-first;
+    if (numReduced < 0)
+      numReduced = 0;
+    for (unsigned int i=0; i<theReductions.size(); i++)
+      theReductions[i]->start(numReduced);
+  }
+
+  if (numColumns <= first)
+    return 0;
+
+  double time = (timeColumn == true && size > 0) ? data(0) : (double)numRows;
+  double dT = (numRows > 0) ? time-lastTime : 0.0;
+
+  const double *x;
+  static Vector row;
+  if (size == numColumns)
+    x = &data(first);
+  else {
+    // a row of another size, padded with zeros
+    if (row.Size() != numColumns)
+      row.resize(numColumns);
+    row.Zero();
+    for (int i=0; i<size && i<numColumns; i++)
+      row(i) = data(i);
+    x = &row(first);
+  }
+
+  for (unsigned int i=0; i<theReductions.size(); i++)
+    theReductions[i]->add(x, time, dT, numRows);
+
+  lastTime = time;
+  numRows++;
+
+  return 0;
+}
+
+OPS_Stream&
+ReductionStream::write(const double *s, int n)
+{
+  Vector data((double *)s, n);
+  this->write(data);
+
+  return *this;
+}
+
+int
+ReductionStream::writeResults(void)
+{
+  if (theOutput == 0)
+    return -1;
+
+  int first = (timeColumn == true) ? 1 : 0;
+  int numReduced = numColumns-first;
+  if (numReduced <= 0)
+    return 0;
+
+  // the descriptions of the reduced columns, the time column may or may
+  // not have been described by the recorder
+  int numDescribed = descriptions.size();
+  int skip = 0;
+  if (numDescribed == numColumns && first == 1)
+    skip = 1;
+  else if (numDescribed != numReduced)
+    skip = -1;
+
+  int numResults = 0;
+  for (unsigned int k=0; k<theReductions.size(); k++)
+    numResults += theReductions[k]->getNumResults();
+
+  char label[64];
+  char column[32];
+  for (int i=0; i<numReduced; i++) {
+    const char *description = column;
+    if (skip >= 0)
+      description = descriptions[i+skip].c_str();
+    else
+      sprintf(column, "column%d", i+first+1);
+
+    for (unsigned int k=0; k<theReductions.size(); k++) {
+      int num = theReductions[k]->getNumResults();
+      for (int j=0; j<num; j++) {
+	theReductions[k]->getLabel(j, label);
+	theOutput->tag("ReducedOutput");
+	theOutput->attr("column", description);
+	theOutput->tag("ResponseType", label);
+	theOutput->endTag();
+      }
+    }
+  }
+
+  // the results of each column one after the other
+  Vector results(numReduced*numResults);
+  int loc = 0;
+  std::vector<double> reductionResults;
+  for (unsigned int k=0; k<theReductions.size(); k++) {
+    int num = theReductions[k]->getNumResults();
+    reductionResults.assign(numReduced*num, 0.0);
+    theReductions[k]->finish(&reductionResults[0], numRows);
+    for (int i=0; i<numReduced; i++)
+      for (int j=0; j<num; j++)
+	results(i*numResults + loc + j) = reductionResults[i*num + j];
+    loc += num;
+  }
+
+  return theOutput->write(results);
+}
+
+int
+ReductionStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  if (theOutput == 0) {
+    opserr << "ReductionStream::sendSelf() - no stream to reduce into\n";
+    return -1;
+  }
+
+  int numReductions = theReductions.size();
+  int sizeParameters = 0;
+  for (int i=0; i<numReductions; i++)
+    sizeParameters += 2 + theReductions[i]->parameters.Size();
+
+  static ID idData(4);
+  idData(0) = theOutput->getClassTag();
+  idData(1) = (timeColumn == true) ? 1 : 0;
+  idData(2) = numReductions;
+  idData(3) = sizeParameters;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "ReductionStream::sendSelf() - failed to send id data\n";
+    return -1;
+  }
+
+  // type, number of parameters & parameters of each reduction
+  if (sizeParameters > 0) {
+    Vector data(sizeParameters);
+    int loc = 0;
+    for (int i=0; i<numReductions; i++) {
+      Vector &parameters = theReductions[i]->parameters;
+      data(loc++) = theReductions[i]->type;
+      data(loc++) = parameters.Size();
+      for (int j=0; j<parameters.Size(); j++)
+	data(loc++) = parameters(j);
+    }
+    if (theChannel.sendVector(0, commitTag, data) < 0) {
+      opserr << "ReductionStream::sendSelf() - failed to send reductions\n";
+      return -1;
+    }
+  }
+
+  return theOutput->sendSelf(commitTag, theChannel);
+}
+
+int
+ReductionStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  static ID idData(4);
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "ReductionStream::recvSelf() - failed to recv id data\n";
+    return -1;
+  }
+
+  timeColumn = (idData(1) != 0);
+  int numReductions = idData(2);
+  int sizeParameters = idData(3);
+
+  this->freeReductions();
+  if (sizeParameters > 0) {
+    Vector data(sizeParameters);
+    if (theChannel.recvVector(0, commitTag, data) < 0) {
+      opserr << "ReductionStream::recvSelf() - failed to recv reductions\n";
+      return -1;
+    }
+    int loc = 0;
+    for (int i=0; i<numReductions; i++) {
+      int type = (int)data(loc++);
+      int numParameters = (int)data(loc++);
+      Vector parameters(numParameters);
+      for (int j=0; j<numParameters; j++)
+	parameters(j) = data(loc++);
+      theReductions.push_back(new StreamReduction(type, parameters));
+    }
+  }
+
+  if (theOutput != 0)
+    delete theOutput;
+  theOutput = theBroker.getPtrNewStream(idData(0));
+  if (theOutput == 0) {
+    opserr << "ReductionStream::recvSelf() - failed to get a stream of class " << idData(0) << endln;
+    return -1;
+  }
+
+  return theOutput->recvSelf(commitTag, theChannel, theBroker);
+}
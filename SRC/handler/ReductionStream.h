@@ -0,0 +1,139 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ReductionStream.h,v $
+
+#ifndef _ReductionStream
+#define _ReductionStream
+
+// Created: 10/26
+//
+// Description: ReductionStream is an OPS_Stream that reduces the rows a
+// recorder writes as they arrive and, when it is closed, writes only the
+// reduced values, one row, to the OPS_Stream it wraps. For each column
+// of the recorder, time excluded, and each reduction added:
+//
+//   REDUCE_RMS         rms = sqrt(sum x^2 / n)
+//   REDUCE_PEAK        x at the peak of |x| & the time of the peak
+//   REDUCE_SPECTRUM    pseudo-acceleration Sa = w^2 max|u| of an SDOF
+//                      oscillator, damping & periods T given, driven by x
+//                      as a ground acceleration; piecewise exact (Nigam &
+//                      Jennings) for the time steps of the time column
+//   REDUCE_CUMULATIVE  sum |dx|
+//   REDUCE_PLASTIC     cumulative plastic deformation, sum |dx| outside an
+//                      elastic range of +-yield about a moving center
+//   REDUCE_RAINFLOW    rainflow cycle counts (ASTM E1049), numBins bins of
+//                      the range of width binWidth, half cycles as 0.5
+//   REDUCE_PERCENTILE  percentiles of |x| estimated with the P^2 algorithm
+//                      (Jain & Chlamtac, CACM 28, 1985) in constant memory
+//
+// The time is the first column if the recorder echoes it, otherwise the
+// number of the row. Every result column is described to the wrapped
+// stream as ReducedOutput[column=...]/ResponseType=..., the column being
+// the description made from the tags & attributes of the recorder.
+
+#include <OPS_Stream.h>
+#include <Vector.h>
+
+#include <string>
+#include <vector>
+
+#define REDUCE_RMS         0
+#define REDUCE_PEAK        1
+#define REDUCE_SPECTRUM    2
+#define REDUCE_CUMULATIVE  3
+#define REDUCE_PLASTIC     4
+#define REDUCE_RAINFLOW    5
+#define REDUCE_PERCENTILE  6
+
+class StreamReduction;
+
+class ReductionStream : public OPS_Stream
+{
+ public:
+  ReductionStream(OPS_Stream *theOutput, bool timeColumn);
+  ReductionStream();
+  ~ReductionStream();
+
+  // parameters: SPECTRUM damping T1 T2 .., PLASTIC yield, RAINFLOW
+  // numBins binWidth, PERCENTILE p1 p2 .. (0 to 100), others none
+  int addReduction(int type, const Vector &parameters);
+
+  int close(void);
+
+  int setPrecision(int precision);
+
+  // xml stuff
+  int tag(const char *);
+  int tag(const char *, const char *);
+  int endTag();
+  int attr(const char *name, int value);
+  int attr(const char *name, double value);
+  int attr(const char *name, const char *value);
+  int write(Vector &data);
+
+  // regular stuff, only doubles are reduced
+  OPS_Stream& write(const char *s, int n) {return *this;};
+  OPS_Stream& write(const unsigned char *s, int n) {return *this;};
+  OPS_Stream& write(const signed char *s, int n) {return *this;};
+  OPS_Stream& write(const void *s, int n) {return *this;};
+  OPS_Stream& write(const double *s, int n);
+
+  OPS_Stream& operator<<(char c) {return *this;};
+  OPS_Stream& operator<<(unsigned char c) {return *this;};
+  OPS_Stream& operator<<(signed char c) {return *this;};
+  OPS_Stream& operator<<(const char *s) {return *this;};
+  OPS_Stream& operator<<(const unsigned char *s) {return *this;};
+  OPS_Stream& operator<<(const signed char *s) {return *this;};
+  OPS_Stream& operator<<(const void *p) {return *this;};
+  OPS_Stream& operator<<(int n) {return *this;};
+  OPS_Stream& operator<<(unsigned int n) {return *this;};
+  OPS_Stream& operator<<(long n) {return *this;};
+  OPS_Stream& operator<<(unsigned long n) {return *this;};
+  OPS_Stream& operator<<(short n) {return *this;};
+  OPS_Stream& operator<<(unsigned short n) {return *this;};
+  OPS_Stream& operator<<(bool b) {return *this;};
+  OPS_Stream& operator<<(double n) {return *this;};
+  OPS_Stream& operator<<(float n) {return *this;};
+
+  int sendSelf(int commitTag, Channel &theChannel);
+  int recvSelf(int commitTag, Channel &theChannel,
+	       FEM_ObjectBroker &theBroker);
+
+ private:
+  void freeReductions(void);
+  int writeResults(void);
+
+  OPS_Stream *theOutput;
+  bool timeColumn;
+  std::vector<StreamReduction *> theReductions;
+
+  // descriptions of the columns
+  std::vector<std::string> openTags;
+  std::vector<std::string> descriptions;
+
+  int numColumns;    // -1 until the first write
+  int numRows;
+  double lastTime;
+};
+
+#endif
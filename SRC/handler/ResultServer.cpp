@@ -0,0 +1,448 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ResultServer.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ResultServer.
+//
+// What: "@(#) ResultServer.cpp, revA"
+
+#include <ResultServer.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+
+#include <string.h>
+#include <stdlib.h>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+#define RESULTSERVER_HELLO  0
+#define RESULTSERVER_TOPIC  1
+#define RESULTSERVER_DATA   2
+#define RESULTSERVER_CLOSED 3
+
+// default updates per second of a topic & poll timeout in ms
+#define RESULTSERVER_RATE 30.0
+#define RESULTSERVER_POLL 10
+
+std::map<int, ResultServer *> ResultServer::theServers;
+
+static void
+appendInt(std::string &frame, int value)
+{
+  frame.append((const char *)&value, sizeof(int));
+}
+
+static void
+startFrame(std::string &frame, int type, int length)
+{
+  // length of what follows the length
+  appendInt(frame, length+1);
+  frame += (char)type;
+}
+
+#ifndef _WIN32
+extern "C" void *
+resultServer(void *theServer)
+{
+  ((ResultServer *)theServer)->serve();
+  return 0;
+}
+
+static double
+currentTime(void)
+{
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + 1.0e-6*tv.tv_usec;
+}
+#endif
+
+ResultServer *
+ResultServer::getServer(int port)
+{
+  std::map<int, ResultServer *>::iterator it = theServers.find(port);
+  if (it != theServers.end()) {
+    it->second->numStreams++;
+    return it->second;
+  }
+
+  ResultServer *theServer = new ResultServer(port);
+  if (theServer->start() != 0) {
+    delete theServer;
+    return 0;
+  }
+
+  theServer->numStreams = 1;
+  theServers[port] = theServer;
+  return theServer;
+}
+
+void
+ResultServer::releaseServer(ResultServer *theServer)
+{
+  if (theServer == 0 || --theServer->numStreams > 0)
+    return;
+
+  theServers.erase(theServer->port);
+  delete theServer;
+}
+
+ResultServer::ResultServer(int thePort)
+  :port(thePort), numStreams(0), listenSocket(-1),
+   finished(false), threaded(false)
+{
+
+}
+
+ResultServer::~ResultServer()
+{
+  this->stop();
+}
+
+int
+ResultServer::start(void)
+{
+#ifdef _WIN32
+  opserr << "WARNING ResultServer - not available on Windows\n";
+  return -1;
+#else
+  listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+  if (listenSocket < 0) {
+    opserr << "WARNING ResultServer - could not open a socket\n";
+    return -1;
+  }
+
+  int on = 1;
+  setsockopt(listenSocket, SOL_SOCKET, SO_REUSEADDR, (const char *)&on, sizeof(on));
+
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons((unsigned short)port);
+
+  if (bind(listenSocket, (struct sockaddr *)&address, sizeof(address)) < 0 ||
+      listen(listenSocket, 8) < 0) {
+    opserr << "WARNING ResultServer - could not listen on port " << port << endln;
+    ::close(listenSocket);
+    listenSocket = -1;
+    return -1;
+  }
+  fcntl(listenSocket, F_SETFL, fcntl(listenSocket, F_GETFL, 0) | O_NONBLOCK);
+
+  finished = false;
+  pthread_mutex_init(&lock, 0);
+  if (pthread_create(&server, 0, resultServer, (void *)this) != 0) {
+    opserr << "WARNING ResultServer - could not start the server thread\n";
+    pthread_mutex_destroy(&lock);
+    ::close(listenSocket);
+    listenSocket = -1;
+    return -1;
+  }
+  threaded = true;
+
+  return 0;
+#endif
+}
+
+void
+ResultServer::stop(void)
+{
+#ifndef _WIN32
+  if (threaded == true) {
+    pthread_mutex_lock(&lock);
+    finished = true;
+    pthread_mutex_unlock(&lock);
+
+    pthread_join(server, 0);
+    pthread_mutex_destroy(&lock);
+    threaded = false;
+  }
+
+  for (unsigned int i=0; i<clients.size(); i++)
+    ::close(clients[i].socket);
+  clients.clear();
+
+  if (listenSocket >= 0)
+    ::close(listenSocket);
+  listenSocket = -1;
+#endif
+}
+
+int
+ResultServer::addTopic(const char *name, int numColumns, const std::string &columns)
+{
+  Topic theTopic;
+  theTopic.name = name;
+  theTopic.columns = columns;
+  theTopic.data.assign(numColumns, 0.0);
+  theTopic.version = 0;
+  theTopic.active = true;
+
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+#endif
+  topics.push_back(theTopic);
+  int topic = topics.size()-1;
+#ifndef _WIN32
+  pthread_mutex_unlock(&lock);
+#endif
+
+  return topic;
+}
+
+void
+ResultServer::removeTopic(int topic)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+#endif
+  if (topic >= 0 && topic < (int)topics.size())
+    topics[topic].active = false;
+#ifndef _WIN32
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+int
+ResultServer::publish(int topic, const Vector &data)
+{
+  if (topic < 0 || topic >= (int)topics.size())
+    return -1;
+
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+#endif
+  Topic &theTopic = topics[topic];
+  int size = theTopic.data.size();
+  for (int i=0; i<size && i<data.Size(); i++)
+    theTopic.data[i] = data(i);
+  theTopic.version++;
+#ifndef _WIN32
+  pthread_mutex_unlock(&lock);
+#endif
+
+  return 0;
+}
+
+void
+ResultServer::command(Client &theClient, const std::string &line)
+{
+  // called with the lock held
+  size_t space = line.find(' ');
+  std::string verb = line.substr(0, space);
+  std::string arg;
+  if (space != std::string::npos)
+    arg = line.substr(space+1);
+  while (arg.empty() == false && (arg[arg.size()-1] == '\r' || arg[arg.size()-1] == ' '))
+    arg.erase(arg.size()-1);
+
+  if (verb == "subscribe" || verb == "unsubscribe") {
+    char on = (verb == "subscribe") ? 1 : 0;
+    if (arg == "*") {
+      theClient.all = (on == 1);
+      for (unsigned int i=0; i<theClient.subscribed.size(); i++)
+	theClient.subscribed[i] = on;
+    } else {
+      if (on == 1)
+	theClient.wanted.push_back(arg);
+      else
+	for (int i=theClient.wanted.size()-1; i>=0; i--)
+	  if (theClient.wanted[i] == arg)
+	    theClient.wanted.erase(theClient.wanted.begin()+i);
+      for (unsigned int i=0; i<topics.size(); i++)
+	if (topics[i].name == arg && i < theClient.subscribed.size())
+	  theClient.subscribed[i] = on;
+    }
+  } else if (verb == "rate") {
+    double rate = atof(arg.c_str());
+    theClient.interval = (rate > 0.0) ? 1.0/rate : 0.0;
+  }
+}
+
+void
+ResultServer::fillOutput(Client &theClient, double now)
+{
+  // called with the lock held, the topics the client does not know
+  for (unsigned int i=theClient.subscribed.size(); i<topics.size(); i++) {
+    char on = theClient.all ? 1 : 0;
+    for (unsigned int j=0; j<theClient.wanted.size(); j++)
+      if (theClient.wanted[j] == topics[i].name)
+	on = 1;
+    theClient.subscribed.push_back(on);
+    theClient.described.push_back(0);
+    theClient.sentVersion.push_back(0);
+    theClient.sentTime.push_back(0.0);
+  }
+
+  std::string &frame = theClient.output;
+  for (unsigned int i=0; i<topics.size(); i++) {
+    Topic &theTopic = topics[i];
+    int topic = i;
+
+    if (theClient.described[i] == 0) {
+      int numColumns = theTopic.data.size();
+      int nameLength = theTopic.name.size();
+      startFrame(frame, RESULTSERVER_TOPIC, 3*sizeof(int) + nameLength + theTopic.columns.size());
+      appendInt(frame, topic);
+      appendInt(frame, numColumns);
+      appendInt(frame, nameLength);
+      frame += theTopic.name;
+      frame += theTopic.columns;
+      theClient.described[i] = 1;
+    }
+
+    if (theTopic.active == false) {
+      if (theClient.described[i] == 1) {
+	startFrame(frame, RESULTSERVER_CLOSED, sizeof(int));
+	appendInt(frame, topic);
+	theClient.described[i] = 2;
+      }
+      continue;
+    }
+
+    if (theClient.subscribed[i] == 0 || theTopic.version == theClient.sentVersion[i] ||
+	now - theClient.sentTime[i] < theClient.interval)
+      continue;
+
+    int numColumns = theTopic.data.size();
+    startFrame(frame, RESULTSERVER_DATA, 2*sizeof(int) + numColumns*sizeof(double));
+    appendInt(frame, topic);
+    appendInt(frame, theTopic.version);
+    if (numColumns > 0)
+      frame.append((const char *)&theTopic.data[0], numColumns*sizeof(double));
+    theClient.sentVersion[i] = theTopic.version;
+    theClient.sentTime[i] = now;
+  }
+}
+
+void
+ResultServer::serve(void)
+{
+#ifndef _WIN32
+  std::vector<struct pollfd> fds;
+  char buffer[1024];
+
+  while (true) {
+    pthread_mutex_lock(&lock);
+    bool done = finished;
+    pthread_mutex_unlock(&lock);
+    if (done == true)
+      break;
+
+    fds.resize(clients.size()+1);
+    fds[0].fd = listenSocket;
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+    for (unsigned int i=0; i<clients.size(); i++) {
+      fds[i+1].fd = clients[i].socket;
+      fds[i+1].events = POLLIN;
+      if (clients[i].output.empty() == false)
+	fds[i+1].events |= POLLOUT;
+      fds[i+1].revents = 0;
+    }
+    poll(&fds[0], fds.size(), RESULTSERVER_POLL);
+
+    // read the commands, drop the clients gone
+    std::vector<bool> closed(clients.size(), false);
+    for (unsigned int i=0; i<clients.size(); i++) {
+      if ((fds[i+1].revents & (POLLIN | POLLHUP | POLLERR)) == 0)
+	continue;
+      int n = recv(clients[i].socket, buffer, sizeof(buffer), MSG_DONTWAIT);
+      if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+	closed[i] = true;
+	continue;
+      }
+      if (n < 0)
+	continue;
+
+      Client &theClient = clients[i];
+      theClient.input.append(buffer, n);
+      size_t end;
+      pthread_mutex_lock(&lock);
+      while ((end = theClient.input.find('\n')) != std::string::npos) {
+	this->command(theClient, theClient.input.substr(0, end));
+	theClient.input.erase(0, end+1);
+      }
+      pthread_mutex_unlock(&lock);
+    }
+    for (int i=clients.size()-1; i>=0; i--)
+      if (closed[i] == true) {
+	::close(clients[i].socket);
+	clients.erase(clients.begin()+i);
+      }
+
+    // new clients
+    if (fds[0].revents & POLLIN) {
+      int theSocket;
+      while ((theSocket = accept(listenSocket, 0, 0)) >= 0) {
+	fcntl(theSocket, F_SETFL, fcntl(theSocket, F_GETFL, 0) | O_NONBLOCK);
+	Client theClient;
+	theClient.socket = theSocket;
+	theClient.interval = 1.0/RESULTSERVER_RATE;
+	theClient.all = false;
+	startFrame(theClient.output, RESULTSERVER_HELLO, 2*sizeof(int));
+	appendInt(theClient.output, 1);
+	appendInt(theClient.output, 1);
+	clients.push_back(theClient);
+      }
+    }
+
+    // the latest rows to the clients that have sent all they were given
+    double now = currentTime();
+    pthread_mutex_lock(&lock);
+    for (unsigned int i=0; i<clients.size(); i++)
+      if (clients[i].output.empty() == true)
+	this->fillOutput(clients[i], now);
+    pthread_mutex_unlock(&lock);
+
+    for (int i=clients.size()-1; i>=0; i--) {
+      std::string &output = clients[i].output;
+      if (output.empty() == true)
+	continue;
+      int n = send(clients[i].socket, output.data(), output.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+      if (n > 0)
+	output.erase(0, n);
+      else if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+	::close(clients[i].socket);
+	clients.erase(clients.begin()+i);
+      }
+    }
+  }
+#endif
+}
@@ -0,0 +1,130 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ResultServer.h,v $
+
+#ifndef ResultServer_h
+#define ResultServer_h
+
+// Created: 10/26
+//
+// Description: ResultServer is an in-process publish/subscribe server for
+// monitoring an analysis while it runs. The recorders publish their rows
+// to it through a ServerStream, each recorder a topic; the server keeps
+// only the latest row of each topic and a server thread (pthreads, not on
+// _WIN32) sends the topics a client subscribed to over TCP, at most rate
+// times a second per topic. Publishing only copies the row, so a slow
+// client never holds up the analysis: an update is sent to a client only
+// once what it was sent before has left, the updates in between are
+// dropped. One server is started for each port used and stopped when
+// the last of its streams is deleted.
+//
+// Frames sent by the server, in the byte order of the server:
+//
+//   int    length of the rest of the frame
+//   char   type
+//   HELLO (0):  int 1 (byte order check), int protocol version (1)
+//   TOPIC (1):  int topic, int numColumns, int nameLength, char[] name,
+//               char[] the descriptions of the columns, one per line
+//   DATA  (2):  int topic, int update count, double[numColumns]
+//   CLOSED (3): int topic
+//
+// Commands sent by a client, one per line:
+//
+//   subscribe name     name of a topic, possibly one not yet published,
+//                      or * for all
+//   unsubscribe name
+//   rate updatesPerSecond    0 for every update, 30 by default
+
+#include <string>
+#include <vector>
+#include <map>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class Vector;
+
+class ResultServer
+{
+ public:
+  // the server of port, started on the first call
+  static ResultServer *getServer(int port);
+  static void releaseServer(ResultServer *theServer);
+
+  int addTopic(const char *name, int numColumns, const std::string &columns);
+  void removeTopic(int topic);
+  int publish(int topic, const Vector &data);
+
+  // called by the server thread
+  void serve(void);
+
+ private:
+  ResultServer(int port);
+  ~ResultServer();
+
+  int start(void);
+  void stop(void);
+
+  struct Topic {
+    std::string name;
+    std::string columns;
+    std::vector<double> data;
+    int version;      // number of updates
+    bool active;
+  };
+
+  struct Client {
+    int socket;
+    std::string input;     // the part of a command received
+    std::string output;    // the part of the frames not yet sent
+    double interval;       // minimum time between two updates of a topic
+    bool all;
+    std::vector<std::string> wanted;   // names subscribed to
+    std::vector<char> subscribed;
+    std::vector<char> described;
+    std::vector<int> sentVersion;
+    std::vector<double> sentTime;
+  };
+
+  void command(Client &theClient, const std::string &line);
+  void fillOutput(Client &theClient, double now);
+
+  int port;
+  int numStreams;
+  int listenSocket;
+  bool finished;
+  bool threaded;
+
+  std::vector<Topic> topics;
+  std::vector<Client> clients;
+
+#ifndef _WIN32
+  pthread_t server;
+  pthread_mutex_t lock;
+#endif
+
+  static std::map<int, ResultServer *> theServers;
+};
+
+#endif
@@ -0,0 +1,225 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/handler/ServerStream.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of ServerStream.
+//
+// What: "@(#) ServerStream.cpp, revA"
+
+#include <ServerStream.h>
+#include <ResultServer.h>
+#include <Vector.h>
+#include <ID.h>
+#include <Channel.h>
+#include <Message.h>
+#include <OPS_Globals.h>
+#include <classTags.h>
+
+#include <string.h>
+#include <stdio.h>
+
+ServerStream::ServerStream(int thePort, const char *name)
+  :OPS_Stream(OPS_STREAM_TAGS_ServerStream),
+   port(thePort), topicName(name), sendSelfCount(0),
+   theServer(0), topic(-1)
+{
+  theServer = ResultServer::getServer(port);
+}
+
+ServerStream::ServerStream()
+  :OPS_Stream(OPS_STREAM_TAGS_ServerStream),
+   port(0), sendSelfCount(0),
+   theServer(0), topic(-1)
+{
+
+}
+
+ServerStream::~ServerStream()
+{
+  if (theServer != 0) {
+    if (topic >= 0)
+      theServer->removeTopic(topic);
+    ResultServer::releaseServer(theServer);
+  }
+}
+
+int
+ServerStream::tag(const char *tagName)
+{
+  if (topic < 0)
+    openTags.push_back(std::string(tagName));
+
+  return 0;
+}
+
+int
+ServerStream::tag(const char *tagName, const char *value)
+{
+  // a tag with a value is a leaf, the description of the next column
+  if (topic < 0) {
+    for (unsigned int i=0; i<openTags.size(); i++) {
+      columns += openTags[i];
+      columns += '/';
+    }
+    columns += tagName;
+    columns += '=';
+    columns += value;
+    columns += '\n';
+  }
+
+  return 0;
+}
+
+int
+ServerStream::endTag()
+{
+  if (topic < 0 && openTags.empty() == false)
+    openTags.pop_back();
+
+  return 0;
+}
+
+int
+ServerStream::attr(const char *name, int value)
+{
+  char buffer[32];
+  sprintf(buffer, "%d", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+ServerStream::attr(const char *name, double value)
+{
+  char buffer[32];
+  sprintf(buffer, "%.10g", value);
+
+  return this->attr(name, buffer);
+}
+
+int
+ServerStream::attr(const char *name, const char *value)
+{
+  if (topic < 0 && openTags.empty() == false) {
+
+    // attributes in brackets after the tag name: NodeOutput[nodeTag=1 coord1=0]
+    std::string &theTag = openTags.back();
+    if (theTag[theTag.size()-1] == ']') {
+      theTag[theTag.size()-1] = ' ';
+    } else
+      theTag += '[';
+    theTag += name;
+    theTag += '=';
+    theTag += value;
+    theTag += ']';
+  }
+
+  return 0;
+}
+
+int
+ServerStream::write(Vector &data)
+{
+  if (theServer == 0)
+    return 0;
+
+  // the first row fixes the columns of the topic
+  if (topic < 0) {
+    topic = theServer->addTopic(topicName.c_str(), data.Size(), columns);
+    openTags.clear();
+  }
+
+  return theServer->publish(topic, data);
+}
+
+OPS_Stream&
+ServerStream::write(const double *s, int n)
+{
+  Vector data((double *)s, n);
+  this->write(data);
+
+  return *this;
+}
+
+int
+ServerStream::sendSelf(int commitTag, Channel &theChannel)
+{
+  sendSelfCount++;
+
+  static ID idData(3);
+  idData(0) = port;
+  idData(1) = topicName.size();
+  idData(2) = sendSelfCount;
+
+  if (theChannel.sendID(0, commitTag, idData) < 0) {
+    opserr << "ServerStream::sendSelf() - failed to send id data\n";
+    return -1;
+  }
+
+  if (topicName.empty() == false) {
+    Message theMessage((char *)topicName.c_str(), topicName.size());
+    if (theChannel.sendMsg(0, commitTag, theMessage) < 0) {
+      opserr << "ServerStream::sendSelf() - failed to send message\n";
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+int
+ServerStream::recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
+{
+  static ID idData(3);
+  if (theChannel.recvID(0, commitTag, idData) < 0) {
+    opserr << "ServerStream::recvSelf() - failed to recv id data\n";
+    return -1;
+  }
+
+  int length = idData(1);
+  if (length > 0) {
+    char *name = new char[length+1];
+    Message theMessage(name, length);
+    if (theChannel.recvMsg(0, commitTag, theMessage) < 0) {
+      opserr << "ServerStream::recvSelf() - failed to recv message\n";
+      delete [] name;
+      return -1;
+    }
+    name[length] = '\0';
+    topicName = name;
+    delete [] name;
+  }
+
+  if (theServer != 0) {
+    if (topic >= 0)
+      theServer->removeTopic(topic);
+    ResultServer::releaseServer(theServer);
+  }
+  topic = -1;
+  port = idData(0) + idData(2);
+  theServer = ResultServer::getServer(port);
+
+  return 0;
+}
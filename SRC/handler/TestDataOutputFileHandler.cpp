@@ -44,9 +44,9 @@
 StandardStream sserr;
 OPS_Stream *opserrPtr = &sserr;
 
-double        ops_Dt = 0;
-Domain       *ops_TheActiveDomain = 0;
-Element      *ops_TheActiveElement = 0;
+OPS_THREAD_LOCAL double        ops_Dt = 0;
+OPS_THREAD_LOCAL Domain       *ops_TheActiveDomain = 0;
+OPS_THREAD_LOCAL Element      *ops_TheActiveElement = 0;
 
 
 int main(int argc, char **argv)
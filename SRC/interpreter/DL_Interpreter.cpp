@@ -66,3 +66,13 @@ DL_Interpreter::setString(const char*)
 {
     return -1;
 }
+
+void
+DL_Interpreter::beginComputation(void)
+{
+}
+
+void
+DL_Interpreter::endComputation(void)
+{
+}
@@ -57,6 +57,12 @@ class DL_Interpreter
     virtual int setInt(int *, int numArgs);
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
+
+    // methods bracketing a computation that does not use the interpreter,
+    // e.g. an analysis, so that the interpreter can run its other threads
+    // meanwhile; the calls may nest
+    virtual void beginComputation(void);
+    virtual void endComputation(void);
     
   private:
 
@@ -39,6 +39,7 @@
 #include <PlainHandler.h>
 #include <RCM.h>
 #include <AMDNumberer.h>
+#include <MetisNumberer.h>
 #include <LimitCurve.h>
 #include <DamageModel.h>
 #include <FrictionModel.h>
@@ -46,6 +47,14 @@
 #include <YieldSurface_BC.h>
 #include <CyclicModel.h>
 #include <FileStream.h>
+#include <Profiler.h>
+#include <ThreadPool.h>
+#include <MemoryReport.h>
+#include <Benchmark.h>
+#include <ConvergenceLog.h>
+#include <SDOFEnsemble.h>
+#include <Element.h>
+#include <string>
 #include <CTestNormUnbalance.h>
 #include <NewtonRaphson.h>
 #include <TransformationConstraintHandler.h>
@@ -57,6 +66,8 @@
 #include <SymBandEigenSOE.h>
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
+#include <DampedArpackSOE.h>
+#include <BlockLanczosSOE.h>
 #include <ArpackSOE.h>
 #include <LoadControl.h>
 #include <CTestPFEM.h>
@@ -66,6 +77,7 @@
 #include <PFEMLinSOE.h>
 #include <Accelerator.h>
 #include <KrylovAccelerator.h>
+#include <AndersonAccelerator.h>
 #include <AcceleratedNewton.h>
 #include <RaphsonAccelerator.h>
 #include <SecantAccelerator2.h>
@@ -77,10 +89,15 @@
 #include <RegulaFalsiLineSearch.h>
 #include <NewtonLineSearch.h>
 #include <FileDatastore.h>
+#include <BinaryFileDatastore.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
 
 
-// active object
-static OpenSeesCommands* cmds = 0;
+// active object, each thread running an interpreter has its own
+static OPS_THREAD_LOCAL OpenSeesCommands* cmds = 0;
 
 // define opserr
 StandardStream sserr;
@@ -111,6 +128,7 @@ OpenSeesCommands::OpenSeesCommands(DL_Interpreter* interp)
 
 OpenSeesCommands::~OpenSeesCommands()
 {
+    OPS_FinishAsyncAnalysis();
     this->wipe();
     if (theDomain != 0) delete theDomain;
     if (theDatabase != 0) delete theDatabase;
@@ -154,7 +172,7 @@ OpenSeesCommands::setSOE(LinearSOE* soe)
 
 int
 OpenSeesCommands::eigen(int typeSolver, double shift,
-			bool generalizedAlgo, bool findSmallest)
+			bool generalizedAlgo, bool findSmallest, int blockSize)
 {
     //
     // create a transient analysis if no analysis exists
@@ -216,6 +234,14 @@ OpenSeesCommands::eigen(int typeSolver, double shift,
 	    FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	    theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+	} else if (typeSolver == EigenSOE_TAGS_DampedArpackSOE) {
+
+	    theEigenSOE = new DampedArpackSOE(shift);
+
+	} else if (typeSolver == EigenSOE_TAGS_BlockLanczosSOE) {
+
+	    theEigenSOE = new BlockLanczosSOE(shift, blockSize);
+
 	} else {
 
 	    theEigenSOE = new ArpackSOE(shift);
@@ -237,11 +263,13 @@ OpenSeesCommands::eigen(int typeSolver, double shift,
 
     // run analysis
     int result = 0;
+    interpreter->beginComputation();
     if (theStaticAnalysis != 0) {
 	result = theStaticAnalysis->eigen(numEigen, generalizedAlgo, findSmallest);
     } else if (theTransientAnalysis != 0) {
 	result = theTransientAnalysis->eigen(numEigen, generalizedAlgo, findSmallest);
     }
+    interpreter->endComputation();
     if (newanalysis) {
 	delete theTransientAnalysis;
 	theTransientAnalysis = 0;
@@ -269,6 +297,10 @@ OpenSeesCommands::setNumberer(DOF_Numberer* numberer)
 	    delete theNumberer;
 	    theNumberer = 0;
 	}
+	// the model is no longer numbered by the numberer it was built with
+	if (theAnalysisModel != 0) {
+	    theAnalysisModel->clearDOFGraphPattern();
+	}
     }
 
     // set new one
@@ -293,6 +325,9 @@ OpenSeesCommands::setHandler(ConstraintHandler* handler)
 	    delete theHandler;
 	    theHandler = 0;
 	}
+	if (theAnalysisModel != 0) {
+	    theAnalysisModel->clearDOFGraphPattern();
+	}
 	theHandler = handler;
 	return;
     }
@@ -1002,6 +1037,16 @@ OpenSeesCommands::setFileDatabase(const char* filename)
     }
 }
 
+void
+OpenSeesCommands::setBinaryFileDatabase(const char* filename)
+{
+    if (theDatabase != 0) delete theDatabase;
+    theDatabase = new BinaryFileDatastore(filename, *theDomain, theBroker);
+    if (theDatabase == 0) {
+	opserr << "WARNING ran out of memory - database Binary " << filename << endln;
+    }
+}
+
 /////////////////////////////
 //// OpenSees APIs  /// /////
 /////////////////////////////
@@ -1204,7 +1249,7 @@ int OPS_System()
 
     } else if (strcmp(type, "ProfileSPD") == 0) {
 
-	theSOE = (LinearSOE*)OPS_ProfileSPDLinDirectSolver();
+	theSOE = (LinearSOE*)OPS_ProfileSPDLinSupernodeSolver();
 
     } else if (strcmp(type, "PFEM") == 0) {
 	// PFEM SOE & SOLVER
@@ -1223,6 +1268,26 @@ int OPS_System()
 
 		theSOE = (LinearSOE*)OPS_PFEMSolver_Umfpack();
 
+	    } else if(strcmp(type, "-pcg") == 0) {
+
+		double tol = 1e-12;
+		int maxIter = 50;
+		int numdata = 1;
+		if (OPS_GetNumRemainingInputArgs() > 0) {
+		    if (OPS_GetDoubleInput(&numdata, &tol) < 0) {
+			opserr<<"WARNING: failed to read tol\n";
+			return -1;
+		    }
+		}
+		if (OPS_GetNumRemainingInputArgs() > 0) {
+		    if (OPS_GetIntInput(&numdata, &maxIter) < 0) {
+			opserr<<"WARNING: failed to read maxIter\n";
+			return -1;
+		    }
+		}
+		PFEMSolver* theSolver = new PFEMSolver(true, tol, maxIter);
+		theSOE = new PFEMLinSOE(*theSolver);
+
 	    } else if (strcmp(type,"-mumps") ==0) {
 // #ifdef _PARALLEL_INTERPRETERS
 // 	    int relax = 20;
@@ -1259,6 +1324,25 @@ int OPS_System()
 	// SPARSE GENERAL SOE * SOLVER
 	theSOE = (LinearSOE*)OPS_SuperLUSolver();
 
+    } else if (strcmp(type,"Krylov") == 0) {
+	// PRECONDITIONED KRYLOV SOLVERS ON THE SPARSE ROW SOE
+	theSOE = (LinearSOE*)OPS_SparseGenRowKrylovSolver();
+
+    } else if (strcmp(type,"BlockKrylov") == 0) {
+	// KRYLOV SOLVERS ON THE NODE BLOCK SOE
+	theSOE = (LinearSOE*)OPS_SparseBlockRowKrylovSolver();
+
+#ifdef _CUDSS
+    } else if (strcmp(type,"CuDSS") == 0) {
+	// cuDSS DIRECT SOLVER ON THE GPU
+	theSOE = (LinearSOE*)OPS_CuDSSSolver();
+#endif
+
+#ifdef _PARDISO
+    } else if (strcmp(type,"Pardiso") == 0) {
+	// PARDISO SHARED MEMORY PARALLEL SPARSE DIRECT SOLVER
+	theSOE = (LinearSOE*)OPS_PardisoSolver();
+#endif
 
     } else if ((strcmp(type,"SparseSPD") == 0) || (strcmp(type,"SparseSYM") == 0)) {
 	// now must determine the type of solver to create from rest of args
@@ -1268,6 +1352,10 @@ int OPS_System()
 
 	theSOE = (LinearSOE*)OPS_UmfpackGenLinSolver();
 
+    } else if (strcmp(type, "Auto") == 0) {
+
+	theSOE = (LinearSOE*)OPS_AutoLinSOE();
+
     } else if (strcmp(type,"FullGeneral") == 0) {
 	// now must determine the type of solver to create from rest of args
 	theSOE = (LinearSOE*)OPS_FullGenLinLapackSolver();
@@ -1313,6 +1401,11 @@ int OPS_Numberer()
     	AMD *theAMD = new AMD();
     	theNumberer = new DOF_Numberer(*theAMD);
 
+    } else if (strcmp(type,"Metis") == 0) {
+
+    	MetisNumberer *theMetis = new MetisNumberer();
+    	theNumberer = new DOF_Numberer(*theMetis);
+
     } else {
     	opserr<<"WARNING unknown numberer type "<<type<<"\n";
     	return -1;
@@ -1570,6 +1663,9 @@ int OPS_Integrator()
     } else if (strcmp(type,"CentralDifferenceNoDamping") == 0) {
 	ti = (TransientIntegrator*)OPS_CentralDifferenceNoDamping();
 
+    } else if (strcmp(type,"CentralDifferenceSubcycling") == 0) {
+	ti = (TransientIntegrator*)OPS_CentralDifferenceSubcycling();
+
     } else {
 	opserr<<"WARNING unknown integrator type "<<type<<"\n";
     }
@@ -1604,9 +1700,18 @@ int OPS_Algorithm()
     } else if (strcmp(type, "ModifiedNewton") == 0) {
 	theAlgo = (EquiSolnAlgo*) OPS_ModifiedNewton();
 
+    } else if (strcmp(type, "AdaptiveNewton") == 0) {
+	theAlgo = (EquiSolnAlgo*) OPS_AdaptiveNewton();
+
+    } else if (strcmp(type, "InexactNewton") == 0) {
+	theAlgo = (EquiSolnAlgo*) OPS_InexactNewton();
+
     } else if (strcmp(type, "KrylovNewton") == 0) {
 	theAlgo = (EquiSolnAlgo*) OPS_KrylovNewton();
 
+    } else if (strcmp(type, "AndersonNewton") == 0) {
+	theAlgo = (EquiSolnAlgo*) OPS_AndersonNewton();
+
     } else if (strcmp(type, "RaphsonNewton") == 0) {
 	theAlgo = (EquiSolnAlgo*) OPS_RaphsonNewton();
 
@@ -1699,11 +1804,15 @@ int OPS_analyze()
 	int numIncr;
 	int numdata = 1;
 	if (OPS_GetIntInput(&numdata, &numIncr) < 0) return -1;
+	cmds->getInterpreter()->beginComputation();
 	result = theStaticAnalysis->analyze(numIncr);
+	cmds->getInterpreter()->endComputation();
 
     } else if (thePFEMAnalysis != 0) {
 
+	cmds->getInterpreter()->beginComputation();
 	result = thePFEMAnalysis->analyze();
+	cmds->getInterpreter()->endComputation();
 
     } else if (theTransientAnalysis != 0) {
 	if (OPS_GetNumRemainingInputArgs() < 2) {
@@ -1718,7 +1827,9 @@ int OPS_analyze()
 	if (OPS_GetDoubleInput(&numdata, &dt) < 0) return -1;
 	ops_Dt = dt;
 
+	cmds->getInterpreter()->beginComputation();
 	result = theTransientAnalysis->analyze(numIncr, dt);
+	cmds->getInterpreter()->endComputation();
     } else {
 	opserr << "WARNING No Analysis type has been specified \n";
 	return -1;
@@ -1737,6 +1848,203 @@ int OPS_analyze()
     return 0;
 }
 
+// the analysis started by analyzeStart, taken a step at a time by a
+// worker thread that records its progress for analyzeStatus; the
+// interpreter is to issue no other command until OPS_FinishAsyncAnalysis()
+// has waited for the end of the analysis
+struct AsyncAnalysis {
+    OpenSeesCommands *theCommands;
+    StaticAnalysis *theStaticAnalysis;
+    TransientAnalysis *theTransientAnalysis;
+    Domain *theDomain;
+    OPS_ThreadGlobals theGlobals;
+    int numIncr;
+    double dt;
+    int numDone;        // the steps taken so far
+    double time;        // the domain time after the last step
+    int result;
+    bool running;       // the worker has not taken its last step yet
+    bool started;       // the worker is yet to be joined
+#ifndef _WIN32
+    pthread_t worker;
+    pthread_mutex_t lock;
+#endif
+};
+
+static OPS_THREAD_LOCAL AsyncAnalysis *theAsyncAnalysis = 0;
+
+static void *
+asyncAnalyze(void *data)
+{
+    AsyncAnalysis *theAsync = (AsyncAnalysis *)data;
+
+    // the worker has the globals and commands of the interpreter thread
+    theAsync->theGlobals.set();
+    cmds = theAsync->theCommands;
+
+    for (int i=0; i<theAsync->numIncr; i++) {
+	int result;
+	if (theAsync->theStaticAnalysis != 0)
+	    result = theAsync->theStaticAnalysis->analyze(1);
+	else
+	    result = theAsync->theTransientAnalysis->analyze(1, theAsync->dt);
+
+#ifndef _WIN32
+	pthread_mutex_lock(&theAsync->lock);
+#endif
+	theAsync->numDone++;
+	theAsync->time = theAsync->theDomain->getCurrentTime();
+	theAsync->result = result;
+#ifndef _WIN32
+	pthread_mutex_unlock(&theAsync->lock);
+#endif
+	if (result < 0) {
+	    opserr << "OpenSees > analyzeStart failed at step " << i+1
+		   << ", returned: " << result << " error flag\n";
+	    break;
+	}
+    }
+
+#ifndef _WIN32
+    pthread_mutex_lock(&theAsync->lock);
+#endif
+    theAsync->running = false;
+#ifndef _WIN32
+    pthread_mutex_unlock(&theAsync->lock);
+#endif
+
+    return 0;
+}
+
+void OPS_FinishAsyncAnalysis()
+{
+    if (theAsyncAnalysis == 0 || theAsyncAnalysis->started == false)
+	return;
+
+#ifndef _WIN32
+    // the interpreter runs its other threads while waiting
+    DL_Interpreter *interp = (cmds != 0) ? cmds->getInterpreter() : 0;
+    if (interp != 0)
+	interp->beginComputation();
+    pthread_join(theAsyncAnalysis->worker, 0);
+    if (interp != 0)
+	interp->endComputation();
+#endif
+    theAsyncAnalysis->started = false;
+}
+
+int OPS_analyzeStart()
+{
+    // analyzeStart numIncr <dt>; the steps are taken by a worker thread
+    // while the command returns, see analyzeStatus and analyzeWait
+    OPS_FinishAsyncAnalysis();
+
+    StaticAnalysis* theStaticAnalysis = cmds->getStaticAnalysis();
+    TransientAnalysis* theTransientAnalysis = cmds->getTransientAnalysis();
+    if (cmds->getPFEMAnalysis() != 0 ||
+	(theStaticAnalysis == 0 && theTransientAnalysis == 0)) {
+	opserr << "WARNING analyzeStart - want a static or transient analysis\n";
+	return -1;
+    }
+
+    int numIncr;
+    int numdata = 1;
+    if (OPS_GetNumRemainingInputArgs() < 1 ||
+	OPS_GetIntInput(&numdata, &numIncr) < 0) {
+	opserr << "WARNING want - analyzeStart numIncr <dt>\n";
+	return -1;
+    }
+
+    double dt = 0.0;
+    if (theStaticAnalysis == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1 ||
+	    OPS_GetDoubleInput(&numdata, &dt) < 0) {
+	    opserr << "WARNING want - analyzeStart numIncr dt\n";
+	    return -1;
+	}
+	ops_Dt = dt;
+    }
+
+    if (theAsyncAnalysis == 0) {
+	theAsyncAnalysis = new AsyncAnalysis;
+#ifndef _WIN32
+	pthread_mutex_init(&theAsyncAnalysis->lock, 0);
+#endif
+    }
+
+    AsyncAnalysis *theAsync = theAsyncAnalysis;
+    theAsync->theCommands = cmds;
+    theAsync->theStaticAnalysis = theStaticAnalysis;
+    theAsync->theTransientAnalysis = (theStaticAnalysis == 0) ? theTransientAnalysis : 0;
+    theAsync->theDomain = cmds->getDomain();
+    theAsync->theGlobals = OPS_ThreadGlobals();
+    theAsync->numIncr = numIncr;
+    theAsync->dt = dt;
+    theAsync->numDone = 0;
+    theAsync->time = theAsync->theDomain->getCurrentTime();
+    theAsync->result = 0;
+    theAsync->running = true;
+    theAsync->started = false;
+
+#ifndef _WIN32
+    if (pthread_create(&theAsync->worker, 0, asyncAnalyze, (void *)theAsync) == 0)
+	theAsync->started = true;
+    else {
+	opserr << "WARNING analyzeStart - could not start a worker thread, analyzing synchronously\n";
+	asyncAnalyze((void *)theAsync);
+    }
+#else
+    asyncAnalyze((void *)theAsync);
+#endif
+
+    return 0;
+}
+
+int OPS_analyzeStatus()
+{
+    // analyzeStatus; the steps taken, the steps asked for, the domain time,
+    // 1 if the analysis is finished and the result of the last step
+    double data[5] = {0.0, 0.0, 0.0, 1.0, 0.0};
+    AsyncAnalysis *theAsync = theAsyncAnalysis;
+    if (theAsync != 0) {
+#ifndef _WIN32
+	pthread_mutex_lock(&theAsync->lock);
+#endif
+	data[0] = theAsync->numDone;
+	data[1] = theAsync->numIncr;
+	data[2] = theAsync->time;
+	data[3] = (theAsync->running == true) ? 0.0 : 1.0;
+	data[4] = theAsync->result;
+#ifndef _WIN32
+	pthread_mutex_unlock(&theAsync->lock);
+#endif
+    }
+
+    int numdata = 5;
+    if (OPS_SetDoubleOutput(&numdata, data) < 0) {
+	opserr<<"WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_analyzeWait()
+{
+    // analyzeWait; waits for the analysis of analyzeStart and returns its
+    // result as analyze does
+    OPS_FinishAsyncAnalysis();
+
+    int result = (theAsyncAnalysis != 0) ? theAsyncAnalysis->result : 0;
+    int numdata = 1;
+    if (OPS_SetIntOutput(&numdata, &result) < 0) {
+	opserr<<"WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_eigenAnalysis()
 {
     // make sure at least one other argument to contain type of system
@@ -1752,6 +2060,7 @@ int OPS_eigenAnalysis()
     int typeSolver = EigenSOE_TAGS_ArpackSOE;
     double shift = 0.0;
     bool findSmallest = true;
+    int blockSize = 0;
 
     // Check type of eigenvalue analysis
     while (OPS_GetNumRemainingInputArgs() > 1) {
@@ -1789,6 +2098,23 @@ int OPS_eigenAnalysis()
 		 (strcmp(type,"-fullGenLapackEigen") == 0))
 	    typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
 
+	else if ((strcmp(type,"dampedArpack") == 0) ||
+		 (strcmp(type,"-dampedArpack") == 0))
+	    typeSolver = EigenSOE_TAGS_DampedArpackSOE;
+
+	else if ((strcmp(type,"blockLanczos") == 0) ||
+		 (strcmp(type,"-blockLanczos") == 0))
+	    typeSolver = EigenSOE_TAGS_BlockLanczosSOE;
+
+	else if (strcmp(type,"-blockSize") == 0) {
+	    int numdata = 1;
+	    if (OPS_GetNumRemainingInputArgs() < 2 ||
+		OPS_GetIntInput(&numdata, &blockSize) < 0 || blockSize < 0) {
+		opserr << "WARNING eigen -blockSize blockSize? - invalid blockSize\n";
+		return -1;
+	    }
+	}
+
 	else {
 	    opserr << "eigen - unknown option specified " << type << endln;
 	}
@@ -1810,7 +2136,7 @@ int OPS_eigenAnalysis()
     cmds->setNumEigen(numEigen);
 
     // set eigen soe
-    if (cmds->eigen(typeSolver,shift,generalizedAlgo,findSmallest) < 0) {
+    if (cmds->eigen(typeSolver,shift,generalizedAlgo,findSmallest,blockSize) < 0) {
 	opserr<<"WANRING failed to do eigen analysis\n";
 	return -1;
     }
@@ -1829,6 +2155,12 @@ int OPS_resetModel()
     if (theTransientIntegrator != 0) {
 	theTransientIntegrator->revertToStart();
     }
+    // the algorithm drops any tangent kept from before the reset, the
+    // rest of the analysis is kept for the next run
+    EquiSolnAlgo* theAlgorithm = cmds->getAlgorithm();
+    if (theAlgorithm != 0) {
+	theAlgorithm->domainChanged();
+    }
     return 0;
 }
 
@@ -1990,6 +2322,73 @@ void* OPS_KrylovNewton()
     return new AcceleratedNewton(*theTest, theAccel, incrementTangent);
 }
 
+void* OPS_AndersonNewton()
+{
+    int incrementTangent = CURRENT_TANGENT;
+    int iterateTangent = CURRENT_TANGENT;
+    int maxDim = 3;
+    int restart = 0;
+    double mixing = 1.0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* flag = OPS_GetString();
+
+	if (strcmp(flag,"-iterate") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    const char* flag2 = OPS_GetString();
+
+	    if (strcmp(flag2,"current") == 0) {
+		iterateTangent = CURRENT_TANGENT;
+	    }
+	    if (strcmp(flag2,"initial") == 0) {
+		iterateTangent = INITIAL_TANGENT;
+	    }
+	    if (strcmp(flag2,"noTangent") == 0) {
+		iterateTangent = NO_TANGENT;
+	    }
+	} else if (strcmp(flag,"-increment") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    const char* flag2 = OPS_GetString();
+
+	    if (strcmp(flag2,"current") == 0) {
+		incrementTangent = CURRENT_TANGENT;
+	    }
+	    if (strcmp(flag2,"initial") == 0) {
+		incrementTangent = INITIAL_TANGENT;
+	    }
+	    if (strcmp(flag2,"noTangent") == 0) {
+		incrementTangent = NO_TANGENT;
+	    }
+	} else if (strcmp(flag,"-maxDim") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    int numdata = 1;
+	    if (OPS_GetIntInput(&numdata, &maxDim) < 0) {
+		opserr<< "WARNING AndersonNewton failed to read maxDim\n";
+		return 0;
+	    }
+	} else if (strcmp(flag,"-restart") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    int numdata = 1;
+	    if (OPS_GetIntInput(&numdata, &restart) < 0) {
+		opserr<< "WARNING AndersonNewton failed to read restart\n";
+		return 0;
+	    }
+	} else if (strcmp(flag,"-mixing") == 0 && OPS_GetNumRemainingInputArgs()>0) {
+	    int numdata = 1;
+	    if (OPS_GetDoubleInput(&numdata, &mixing) < 0) {
+		opserr<< "WARNING AndersonNewton failed to read mixing\n";
+		return 0;
+	    }
+	}
+    }
+
+    ConvergenceTest* theTest = cmds->getCTest();
+    if (theTest == 0) {
+      opserr << "ERROR: No ConvergenceTest yet specified\n";
+      return 0;
+    }
+
+    Accelerator *theAccel;
+    theAccel = new AndersonAccelerator(maxDim, restart, mixing, iterateTangent);
+
+    return new AcceleratedNewton(*theTest, theAccel, incrementTangent);
+}
+
 void* OPS_RaphsonNewton()
 {
     int incrementTangent = CURRENT_TANGENT;
@@ -2358,8 +2757,19 @@ int OPS_Database()
 
 	return 0;
     }
+    if (strcmp(type,"Binary") == 0 || strcmp(type,"BinaryFile") == 0) {
+	if (OPS_GetNumRemainingInputArgs() < 1) {
+	    opserr << "WARNING database Binary fileName? ";
+	    return -1;
+	}
+
+	const char* filename = OPS_GetString();
+	cmds->setBinaryFileDatabase(filename);
+
+	return 0;
+    }
     opserr << "WARNING No database type exists ";
-    opserr << "for database of type:" << type << "valid database type File\n";
+    opserr << "for database of type:" << type << "valid database type File, Binary\n";
 
     return -1;
 }
@@ -2441,6 +2851,426 @@ int OPS_stopTimer()
     return 0;
 }
 
+int OPS_profile()
+{
+    if (OPS_GetNumRemainingInputArgs() < 1) {
+	opserr << "WARNING want - profile start <-counters?>|stop|reset|report <fileName?>|trace start fileName|stop\n";
+	return -1;
+    }
+
+    const char* option = OPS_GetString();
+    if (strcmp(option,"start") == 0) {
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* opt = OPS_GetString();
+	    if (strcmp(opt,"-counters") == 0)
+		Profiler::setCounters(true);
+	}
+	Profiler::start();
+    } else if (strcmp(option,"stop") == 0) {
+	Profiler::stop();
+    } else if (strcmp(option,"trace") == 0) {
+	// trace start fileName|stop; the timeline of the phases on each rank
+	const char* opt = (OPS_GetNumRemainingInputArgs() > 0) ? OPS_GetString() : "";
+	if (strcmp(opt,"start") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* fileName = OPS_GetString();
+	    if (Tracer::start(fileName) < 0)
+		return -1;
+	} else if (strcmp(opt,"stop") == 0) {
+	    Tracer::stop();
+	} else {
+	    opserr << "WARNING want - profile trace start fileName|stop\n";
+	    return -1;
+	}
+    } else if (strcmp(option,"reset") == 0) {
+	Profiler::reset();
+    } else if (strcmp(option,"report") == 0) {
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* fileName = OPS_GetString();
+	    FileStream theFile(fileName, APPEND);
+	    Profiler::report(theFile);
+	} else {
+	    Profiler::report(opserr);
+	}
+    } else {
+	opserr << "WARNING profile " << option << " - unknown option, want start|stop|reset|report|trace\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_threads()
+{
+    // threads <numThreads?> <-element threshold?> <-domain flag?>
+    // <-reproducible flag?> <-pin flag?>; with no argument the current number is returned, see
+    // the Tcl threads command for the options
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *opt = OPS_GetString();
+	OPS_ResetCurrentInputArg(-1);
+	if (opt[0] != '-') {
+	    int numThreads;
+	    int numdata = 1;
+	    if (OPS_GetIntInput(&numdata, &numThreads) < 0) {
+		opserr << "WARNING want - threads <numThreads?> <-element threshold?> <-domain flag?> <-reproducible flag?> <-pin flag?>\n";
+		return -1;
+	    }
+	    if (ThreadPool::setNumThreads(numThreads) < 0)
+		return -1;
+	}
+    }
+
+    while (OPS_GetNumRemainingInputArgs() > 1) {
+	const char *opt = OPS_GetString();
+	int numdata = 1;
+	if (strcmp(opt,"-element") == 0) {
+	    double threshold;
+	    if (OPS_GetDoubleInput(&numdata, &threshold) < 0) {
+		opserr << "WARNING threads - invalid threshold\n";
+		return -1;
+	    }
+	    ThreadPool::setElementThreshold(threshold);
+	} else if (strcmp(opt,"-domain") == 0) {
+	    int flag;
+	    if (OPS_GetIntInput(&numdata, &flag) < 0) {
+		opserr << "WARNING threads - invalid flag\n";
+		return -1;
+	    }
+	    ThreadPool::setDomainThreaded(flag != 0);
+	} else if (strcmp(opt,"-reproducible") == 0) {
+	    int flag;
+	    if (OPS_GetIntInput(&numdata, &flag) < 0) {
+		opserr << "WARNING threads - invalid flag\n";
+		return -1;
+	    }
+	    ThreadPool::setReproducible(flag != 0);
+	} else if (strcmp(opt,"-pin") == 0) {
+	    int flag;
+	    if (OPS_GetIntInput(&numdata, &flag) < 0) {
+		opserr << "WARNING threads - invalid flag\n";
+		return -1;
+	    }
+	    if (ThreadPool::setPinned(flag != 0) < 0)
+		return -1;
+	} else
+	    break;
+    }
+
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	opserr << "WARNING want - threads <numThreads?> <-element threshold?> <-domain flag?> <-reproducible flag?> <-pin flag?>\n";
+	return -1;
+    }
+
+    int numThreads = ThreadPool::getNumThreads();
+    int numdata = 1;
+    if (OPS_SetIntOutput(&numdata, &numThreads) < 0) {
+	opserr<<"WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_memoryReport()
+{
+    // memoryReport <fileName?>; prints the bytes of the model and analysis
+    // by subsystem, keeps them for the simulation information and returns
+    // the total
+    Domain* theDomain = cmds->getDomain();
+    if (theDomain == 0) return -1;
+
+    double total;
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* fileName = OPS_GetString();
+	FileStream theFile(fileName, APPEND);
+	total = MemoryReport::report(theFile, *theDomain, cmds->getAnalysisModel(),
+				     cmds->getSOE(), cmds->getSimulationInformation());
+    } else {
+	total = MemoryReport::report(opserr, *theDomain, cmds->getAnalysisModel(),
+				     cmds->getSOE(), cmds->getSimulationInformation());
+    }
+
+    int numdata = 1;
+    if (OPS_SetDoubleOutput(&numdata, &total) < 0) {
+	opserr<<"WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_benchmark()
+{
+    // benchmark uniaxial|nD|section|element tag <-steps n?> <-amp amp?>
+    //   <-minTime seconds?> <-type code?> <-json fileName?>; times the
+    // object on its own under the standard history of Benchmark, materials
+    // and sections on a copy, and returns the nanoseconds per step
+    if (OPS_GetNumRemainingInputArgs() < 2) {
+	opserr << "WARNING want - benchmark uniaxial|nD|section|element tag <-steps n?> <-amp amp?> <-minTime seconds?> <-type code?> <-json fileName?>\n";
+	return -1;
+    }
+
+    std::string type = OPS_GetString();
+    int tag;
+    int numdata = 1;
+    if (OPS_GetIntInput(&numdata, &tag) < 0) {
+	opserr << "WARNING benchmark - invalid tag\n";
+	return -1;
+    }
+
+    int numSteps = 1000;
+    double amp = 0.01;
+    double minTime = 0.2;
+    std::string code, fileName;
+    while (OPS_GetNumRemainingInputArgs() > 1) {
+	std::string option = OPS_GetString();
+	if (option == "-steps") {
+	    if (OPS_GetIntInput(&numdata, &numSteps) < 0) return -1;
+	} else if (option == "-amp") {
+	    if (OPS_GetDoubleInput(&numdata, &amp) < 0) return -1;
+	} else if (option == "-minTime") {
+	    if (OPS_GetDoubleInput(&numdata, &minTime) < 0) return -1;
+	} else if (option == "-type") {
+	    code = OPS_GetString();
+	} else if (option == "-json") {
+	    fileName = OPS_GetString();
+	} else {
+	    opserr << "WARNING benchmark - unknown option " << option.c_str() << endln;
+	    return -1;
+	}
+    }
+
+    Benchmark theBenchmark(numSteps, amp, minTime);
+    double perStep = -1.0;
+    const char *className = 0;
+
+    if (type == "uniaxial") {
+	UniaxialMaterial *theMaterial = OPS_getUniaxialMaterial(tag);
+	if (theMaterial != 0) {
+	    UniaxialMaterial *theCopy = theMaterial->getCopy();
+	    className = theCopy->getClassType();
+	    perStep = theBenchmark.run(*theCopy);
+	    delete theCopy;
+	}
+    } else if (type == "nD") {
+	NDMaterial *theMaterial = OPS_getNDMaterial(tag);
+	if (theMaterial != 0) {
+	    NDMaterial *theCopy = code.empty() ? theMaterial->getCopy() :
+		theMaterial->getCopy(code.c_str());
+	    if (theCopy != 0) {
+		className = theCopy->getClassType();
+		perStep = theBenchmark.run(*theCopy);
+		delete theCopy;
+	    }
+	}
+    } else if (type == "section") {
+	SectionForceDeformation *theSection = OPS_getSectionForceDeformation(tag);
+	if (theSection != 0) {
+	    SectionForceDeformation *theCopy = theSection->getCopy();
+	    className = theCopy->getClassType();
+	    perStep = theBenchmark.run(*theCopy);
+	    delete theCopy;
+	}
+    } else if (type == "element") {
+	Domain* theDomain = cmds->getDomain();
+	Element *theElement = (theDomain != 0) ? theDomain->getElement(tag) : 0;
+	if (theElement != 0) {
+	    className = theElement->getClassType();
+	    perStep = theBenchmark.run(*theElement);
+	}
+    } else {
+	opserr << "WARNING benchmark - unknown type " << type.c_str() << endln;
+	return -1;
+    }
+
+    if (className == 0) {
+	opserr << "WARNING benchmark - no " << type.c_str() << " with tag " << tag << endln;
+	return -1;
+    }
+    if (perStep < 0.0)
+	return -1;
+
+    if (!fileName.empty()) {
+	FileStream theFile(fileName.c_str(), APPEND);
+	theBenchmark.printJSON(theFile, type.c_str(), tag, className);
+    }
+
+    double ns = perStep*1.0e9;
+    if (OPS_SetDoubleOutput(&numdata, &ns) < 0) {
+	opserr<<"WARNING failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_convergenceLog()
+{
+    // convergenceLog start fileName <-text?>|stop; records every step the
+    // analyses solve, binary unless -text, stop returns the number of steps
+    const char* option = (OPS_GetNumRemainingInputArgs() > 0) ? OPS_GetString() : "";
+    if (strcmp(option,"start") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	std::string fileName = OPS_GetString();
+	bool binary = true;
+	if (OPS_GetNumRemainingInputArgs() > 0) {
+	    const char* opt = OPS_GetString();
+	    if (strcmp(opt,"-text") == 0)
+		binary = false;
+	}
+	if (ConvergenceLog::start(fileName.c_str(), binary) < 0)
+	    return -1;
+    } else if (strcmp(option,"stop") == 0) {
+	int numSteps = ConvergenceLog::stop();
+	int numdata = 1;
+	if (OPS_SetIntOutput(&numdata, &numSteps) < 0) {
+	    opserr<<"WARNING failed to set output\n";
+	    return -1;
+	}
+    } else {
+	opserr << "WARNING want - convergenceLog start fileName <-text?>|stop\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+// the values after an option up to the next option; returns their number
+static int sdofEnsembleValues(double *values)
+{
+    int num = 0;
+    int numdata = 1;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *next = OPS_GetString();
+	OPS_ResetCurrentInputArg(-1);
+	if (next[0] == '-' && isalpha(next[1]))
+	    break;
+	if (OPS_GetDoubleInput(&numdata, &values[num]) < 0) {
+	    opserr << "WARNING sdofEnsemble - invalid value\n";
+	    return -1;
+	}
+	num++;
+    }
+    return num;
+}
+
+int OPS_sdofEnsemble()
+{
+    // sdofEnsemble -mat tags -series tags -dt dt -numSteps n <-periods T?>
+    //   <-mass m?> <-factor f?> <-damping zeta?> <-tol tol?> <-maxIter n?>;
+    // see the Tcl command, the peak displacements, velocities, absolute
+    // accelerations and forces are returned in one list, each of the
+    // number of oscillators
+    int maxNum = OPS_GetNumRemainingInputArgs() + 1;
+    double *matTags = new double[maxNum];
+    double *seriesTags = new double[maxNum];
+    double *periods = new double[maxNum];
+    double *masses = new double[maxNum];
+    double *factors = new double[maxNum];
+    int numMat = 0, numSeries = 0, numPeriods = 0, numMass = 0, numFactors = 0;
+    double dt = 0.0, zeta = 0.05, tol = 1.0e-10;
+    int numSteps = 0, maxIter = 20;
+    int numdata = 1;
+    int ok = 0;
+
+    while (OPS_GetNumRemainingInputArgs() > 0 && ok == 0) {
+	std::string option = OPS_GetString();
+	if (option == "-mat") {
+	    if ((numMat = sdofEnsembleValues(matTags)) < 0) ok = -1;
+	} else if (option == "-series") {
+	    if ((numSeries = sdofEnsembleValues(seriesTags)) < 0) ok = -1;
+	} else if (option == "-periods") {
+	    if ((numPeriods = sdofEnsembleValues(periods)) < 0) ok = -1;
+	} else if (option == "-mass") {
+	    if ((numMass = sdofEnsembleValues(masses)) < 0) ok = -1;
+	} else if (option == "-factor") {
+	    if ((numFactors = sdofEnsembleValues(factors)) < 0) ok = -1;
+	} else if (option == "-dt") {
+	    if (OPS_GetDoubleInput(&numdata, &dt) < 0) ok = -1;
+	} else if (option == "-numSteps") {
+	    if (OPS_GetIntInput(&numdata, &numSteps) < 0) ok = -1;
+	} else if (option == "-damping") {
+	    if (OPS_GetDoubleInput(&numdata, &zeta) < 0) ok = -1;
+	} else if (option == "-tol") {
+	    if (OPS_GetDoubleInput(&numdata, &tol) < 0) ok = -1;
+	} else if (option == "-maxIter") {
+	    if (OPS_GetIntInput(&numdata, &maxIter) < 0) ok = -1;
+	} else {
+	    opserr << "WARNING sdofEnsemble - unknown option " << option.c_str() << endln;
+	    ok = -1;
+	}
+    }
+
+    int num = numMat;
+    if (numSeries > num) num = numSeries;
+    if (numPeriods > num) num = numPeriods;
+    if (numMass > num) num = numMass;
+    if (numFactors > num) num = numFactors;
+    if (ok == 0 && (numMat < 1 || numSeries < 1 || dt <= 0.0 || numSteps < 1 ||
+		    (numMat != 1 && numMat != num) || (numSeries != 1 && numSeries != num) ||
+		    (numPeriods > 1 && numPeriods != num) || (numMass > 1 && numMass != num) ||
+		    (numFactors > 1 && numFactors != num))) {
+	opserr << "WARNING want - sdofEnsemble -mat tags -series tags -dt dt -numSteps n <-periods T?> <-mass m?> <-factor f?> <-damping zeta?> <-tol tol?> <-maxIter n?>, the lists of one value or as long as the longest\n";
+	ok = -1;
+    }
+
+    SDOFEnsemble *theEnsemble = 0;
+    if (ok == 0) {
+	theEnsemble = new SDOFEnsemble(num, dt, zeta, tol, maxIter);
+	for (int i = 0; i < num && ok == 0; i++) {
+	    int matTag = (int)matTags[numMat == 1 ? 0 : i];
+	    int seriesTag = (int)seriesTags[numSeries == 1 ? 0 : i];
+	    UniaxialMaterial *theMaterial = OPS_getUniaxialMaterial(matTag);
+	    TimeSeries *theSeries = OPS_getTimeSeries(seriesTag);
+	    if (theMaterial == 0 || theSeries == 0) {
+		opserr << "WARNING sdofEnsemble - no uniaxial material " << matTag << " or time series " << seriesTag << endln;
+		ok = -1;
+		break;
+	    }
+	    double m = (numMass > 0) ? masses[numMass == 1 ? 0 : i] : 1.0;
+	    if (numPeriods > 0) {
+		double T = periods[numPeriods == 1 ? 0 : i];
+		double omega = 4.0*asin(1.0)/T;
+		m = theMaterial->getInitialTangent()/(omega*omega);
+	    }
+	    double f = (numFactors > 0) ? factors[numFactors == 1 ? 0 : i] : 1.0;
+	    if (theEnsemble->setOscillator(i, *theMaterial, m, *theSeries, f) < 0)
+		ok = -1;
+	}
+    }
+
+    if (ok == 0) {
+	int numFailed = theEnsemble->run(numSteps);
+	if (numFailed < 0)
+	    ok = -1;
+	else if (numFailed > 0)
+	    opserr << "WARNING sdofEnsemble - " << numFailed << " oscillators failed to converge in some step\n";
+    }
+
+    if (ok == 0) {
+	double *data = new double[4*num];
+	const double *peaks[4] = {theEnsemble->getPeakDisp(), theEnsemble->getPeakVel(),
+				  theEnsemble->getPeakAccel(), theEnsemble->getPeakForce()};
+	for (int j = 0; j < 4; j++)
+	    for (int i = 0; i < num; i++)
+		data[j*num+i] = peaks[j][i];
+	int numOutput = 4*num;
+	if (OPS_SetDoubleOutput(&numOutput, data) < 0) {
+	    opserr<<"WARNING failed to set output\n";
+	    ok = -1;
+	}
+	delete [] data;
+    }
+
+    if (theEnsemble != 0)
+	delete theEnsemble;
+    delete [] matTags;
+    delete [] seriesTags;
+    delete [] periods;
+    delete [] masses;
+    delete [] factors;
+
+    return ok;
+}
+
 int OPS_modalDamping()
 {
     if (OPS_GetNumRemainingInputArgs() < 1) {
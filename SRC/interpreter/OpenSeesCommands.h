@@ -104,10 +104,12 @@ public:
     EigenSOE* getEigenSOE() {return theEigenSOE;}
     
     void setFileDatabase(const char* filename);
+    void setBinaryFileDatabase(const char* filename);
     FE_Datastore* getDatabase() {return theDatabase;}
 
     Timer* getTimer() {return &theTimer;}
     SimulationInformation* getSimulationInformation() {return &theSimulationInfo;}
+    AnalysisModel* getAnalysisModel() {return theAnalysisModel;}
     
 #ifdef _RELIABILITY
     int setReliabilityStaticAnalysis();
@@ -117,7 +119,7 @@ public:
     void wipeAnalysis();
     void wipe();
     int eigen(int typeSolver, double shift,
-	      bool generalizedAlgo, bool findSmallest);
+	      bool generalizedAlgo, bool findSmallest, int blockSize = 0);
     
 private:
     
@@ -207,6 +209,8 @@ int OPS_nodeReaction();
 int OPS_nodeEigenvector();
 int OPS_getTime();
 int OPS_eleResponse();
+int OPS_nodeResponses();
+int OPS_eleResponses();
 int OPS_getLoadFactor();
 int OPS_printModel();
 int OPS_printModelGID();
@@ -259,6 +263,8 @@ int OPS_domainChange();
 int OPS_stripOpenSeesXML();
 int OPS_convertBinaryToText();
 int OPS_convertTextToBinary();
+int OPS_convertColumnarToText();
+int OPS_convertTextToSeries();
 int OPS_InitialStateAnalysis();
 int OPS_RigidLink();
 int OPS_RigidDiaphragm();
@@ -278,6 +284,10 @@ int OPS_Integrator();
 int OPS_Algorithm();
 int OPS_Analysis();
 int OPS_analyze();
+int OPS_analyzeStart();
+int OPS_analyzeStatus();
+int OPS_analyzeWait();
+void OPS_FinishAsyncAnalysis();
 int OPS_eigenAnalysis();
 int OPS_resetModel();
 int OPS_initializeAnalysis();
@@ -288,6 +298,12 @@ int OPS_save();
 int OPS_restore();
 int OPS_startTimer();
 int OPS_stopTimer();
+int OPS_profile();
+int OPS_threads();
+int OPS_memoryReport();
+int OPS_benchmark();
+int OPS_convergenceLog();
+int OPS_sdofEnsemble();
 int OPS_modalDamping();
 int OPS_modalDampingQ();
 int OPS_neesMetaData();
@@ -300,6 +316,7 @@ int OPS_numIter();
 int OPS_systemSize();
 
 void* OPS_KrylovNewton();
+void* OPS_AndersonNewton();
 void* OPS_RaphsonNewton();
 void* OPS_MillerNewton();
 void* OPS_SecantNewton();
@@ -323,8 +340,18 @@ void* OPS_TimeSeriesIntegrator();
 void* OPS_BandGenLinLapack();
 void* OPS_BandSPDLinLapack();
 void* OPS_SuperLUSolver();
+void* OPS_SparseGenRowKrylovSolver();
+void* OPS_SparseBlockRowKrylovSolver();
+#ifdef _CUDSS
+void* OPS_CuDSSSolver();
+#endif
+#ifdef _PARDISO
+void* OPS_PardisoSolver();
+#endif
 void* OPS_ProfileSPDLinDirectSolver();
+void* OPS_ProfileSPDLinSupernodeSolver();
 void* OPS_UmfpackGenLinSolver();
+void* OPS_AutoLinSOE();
 void* OPS_DiagonalDirectSolver();
 void* OPS_SProfileSPDLinSolver();
 void* OPS_PFEMSolver();
@@ -398,10 +425,13 @@ void* OPS_WilsonTheta();
 void* OPS_CentralDifference();
 void* OPS_CentralDifferenceAlternative();
 void* OPS_CentralDifferenceNoDamping();
+void* OPS_CentralDifferenceSubcycling();
 
 void* OPS_LinearAlgorithm();
 void* OPS_NewtonRaphsonAlgorithm();
 void* OPS_ModifiedNewton();
+void* OPS_AdaptiveNewton();
+void* OPS_InexactNewton();
 void* OPS_Broyden();
 void* OPS_BFGS();
 
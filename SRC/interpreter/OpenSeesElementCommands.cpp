@@ -56,6 +56,7 @@ void* OPS_ZeroLengthImpact3D();
 void* OPS_ModElasticBeam2d();
 void* OPS_ElasticTimoshenkoBeam2d();
 void* OPS_ElasticTimoshenkoBeam3d();
+void* OPS_SuperElement();
 extern "C" void* OPS_PY_Macro2D();
 void* OPS_SimpleContact2D();
 void* OPS_N4BiaxialTruss();
@@ -395,6 +396,8 @@ namespace {
 	functionMap.insert(std::make_pair("zeroLengthImpact3D", &OPS_ZeroLengthImpact3D));
 	functionMap.insert(std::make_pair("ModElasticBeam2d", &OPS_ModElasticBeam2d));
 	functionMap.insert(std::make_pair("modElasticBeam2d", &OPS_ModElasticBeam2d));
+	functionMap.insert(std::make_pair("superElement", &OPS_SuperElement));
+	functionMap.insert(std::make_pair("SuperElement", &OPS_SuperElement));
 	functionMap.insert(std::make_pair("ElasticTimoshenkoBeam", &OPS_ElasticTimoshenkoBeam));
 	functionMap.insert(std::make_pair("elasticTimoshenkoBeam", &OPS_ElasticTimoshenkoBeam));
 	functionMap.insert(std::make_pair("pyMacro2D", &OPS_PY_Macro2D));
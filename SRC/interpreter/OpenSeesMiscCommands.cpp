@@ -1004,6 +1004,40 @@ int OPS_convertTextToBinary()
     return textToBinary(inputFile, outputFile);
 }
 
+extern int columnarToText(const char *inputFilename, const char *outputFilename);
+
+int OPS_convertColumnarToText()
+{
+    if (OPS_GetNumRemainingInputArgs() < 2) {
+	opserr << "ERROR incorrect # args - convertColumnarToText inputFile outputFile\n";
+	return -1;
+    }
+
+    const char *inputFile = OPS_GetString();
+    const char *outputFile = OPS_GetString();
+
+    return columnarToText(inputFile, outputFile);
+}
+
+extern int textToSeries(const char *inputFilename, const char *outputFilename,
+			const char *format, double dt);
+
+int OPS_convertTextToSeries()
+{
+    if (OPS_GetNumRemainingInputArgs() < 2) {
+	opserr << "ERROR incorrect # args - convertTextToSeries inputFile outputFile <-peer|-time|-values>\n";
+	return -1;
+    }
+
+    const char *inputFile = OPS_GetString();
+    const char *outputFile = OPS_GetString();
+    const char *format = "-values";
+    if (OPS_GetNumRemainingInputArgs() > 0)
+	format = OPS_GetString();
+
+    return textToSeries(inputFile, outputFile, format, 0.0);
+}
+
 int OPS_InitialStateAnalysis()
 {
     if (OPS_GetNumRemainingInputArgs() < 1) {
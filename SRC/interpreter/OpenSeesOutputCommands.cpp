@@ -38,6 +38,7 @@
 #include <vector>
 #include <Parameter.h>
 #include <ParameterIter.h>
+#include <MeshRegion.h>
 #include <DummyStream.h>
 #include <Response.h>
 
@@ -1341,6 +1342,172 @@ int OPS_nodeResponse()
     return 0;
 }
 
+// reads the nodes or elements of a batch query:
+//   -node tags... | -nodeRange start? end? | -region regTag?
+// or -ele, -eleRange for the elements
+static int OPS_GetQueryTags(bool nodes, ID &tags)
+{
+    if (OPS_GetNumRemainingInputArgs() < 2) {
+	return -1;
+    }
+
+    const char* flag = OPS_GetString();
+    int numdata = 1;
+
+    if (strcmp(flag, nodes ? "-node" : "-ele") == 0) {
+	int numTags = 0;
+	while (OPS_GetNumRemainingInputArgs() > 0) {
+	    int tag;
+	    if (OPS_GetIntInput(&numdata, &tag) < 0) {
+		OPS_ResetCurrentInputArg(-1);
+		break;
+	    }
+	    tags[numTags++] = tag;
+	}
+	return numTags > 0 ? 0 : -1;
+
+    } else if (strcmp(flag, nodes ? "-nodeRange" : "-eleRange") == 0) {
+	int range[2];
+	numdata = 2;
+	if (OPS_GetIntInput(&numdata, range) < 0 || range[1] < range[0]) {
+	    return -1;
+	}
+	tags.resize(range[1]-range[0]+1);
+	for (int i=range[0]; i<=range[1]; i++) {
+	    tags(i-range[0]) = i;
+	}
+	return 0;
+
+    } else if (strcmp(flag, "-region") == 0) {
+	int tag;
+	if (OPS_GetIntInput(&numdata, &tag) < 0) {
+	    return -1;
+	}
+	Domain* theDomain = OPS_GetDomain();
+	MeshRegion* theRegion = theDomain == 0 ? 0 : theDomain->getRegion(tag);
+	if (theRegion == 0) {
+	    opserr << "WARNING region " << tag << " not found\n";
+	    return -1;
+	}
+	tags = nodes ? theRegion->getNodes() : theRegion->getElements();
+	return 0;
+    }
+
+    return -1;
+}
+
+int OPS_nodeResponses()
+{
+    // nodeResponses type? <-dof dof?> -node tags... | -nodeRange start? end? | -region regTag?
+    if (OPS_GetNumRemainingInputArgs() < 3) {
+	opserr << "WARNING want - nodeResponses type? <-dof dof?> -node tags... | -nodeRange start? end? | -region regTag?\n";
+	return -1;
+    }
+
+    const char* type = OPS_GetString();
+    NodeResponseType responseType;
+    if (strcmp(type,"disp") == 0) {
+	responseType = Disp;
+    } else if (strcmp(type,"vel") == 0) {
+	responseType = Vel;
+    } else if (strcmp(type,"accel") == 0) {
+	responseType = Accel;
+    } else if (strcmp(type,"incrDisp") == 0) {
+	responseType = IncrDisp;
+    } else if (strcmp(type,"incrDeltaDisp") == 0) {
+	responseType = IncrDeltaDisp;
+    } else if (strcmp(type,"reaction") == 0) {
+	responseType = Reaction;
+    } else if (strcmp(type,"unbalance") == 0) {
+	responseType = Unbalance;
+    } else if (strcmp(type,"rayleighForces") == 0) {
+	responseType = RayleighForces;
+    } else {
+	opserr << "WARNING nodeResponses - unknown response type " << type << "\n";
+	return -1;
+    }
+
+    int dof = -1;
+    if (OPS_GetNumRemainingInputArgs() > 0) {
+	const char* flag = OPS_GetString();
+	if (strcmp(flag,"-dof") == 0) {
+	    int numdata = 1;
+	    if (OPS_GetIntInput(&numdata, &dof) < 0) {
+		opserr << "WARNING nodeResponses - could not read dof\n";
+		return -1;
+	    }
+	} else {
+	    OPS_ResetCurrentInputArg(-1);
+	}
+    }
+    dof--;
+
+    ID tags(0, 32);
+    if (OPS_GetQueryTags(true, tags) < 0) {
+	opserr << "WARNING nodeResponses - want -node tags... | -nodeRange start? end? | -region regTag?\n";
+	return -1;
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) return -1;
+
+    static Vector values(0);
+    int size = theDomain->getNodeResponses(tags, responseType, dof, values);
+    if (size < 0) {
+	return -1;
+    }
+    if (size > 0 && OPS_SetDoubleOutput(&size, &values(0)) < 0) {
+	opserr << "WARNING nodeResponses - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
+int OPS_eleResponses()
+{
+    // eleResponses -ele tags... | -eleRange start? end? | -region regTag? args...
+    if (OPS_GetNumRemainingInputArgs() < 3) {
+	opserr << "WARNING want - eleResponses -ele tags... | -eleRange start? end? | -region regTag? eleArgs...\n";
+	return -1;
+    }
+
+    ID tags(0, 32);
+    if (OPS_GetQueryTags(false, tags) < 0) {
+	opserr << "WARNING eleResponses - want -ele tags... | -eleRange start? end? | -region regTag?\n";
+	return -1;
+    }
+
+    int numArgs = OPS_GetNumRemainingInputArgs();
+    if (numArgs < 1) {
+	opserr << "WARNING eleResponses - no response given\n";
+	return -1;
+    }
+    const char** argv = new const char*[numArgs];
+    for (int i=0; i<numArgs; i++) {
+	argv[i] = OPS_GetString();
+    }
+
+    Domain* theDomain = OPS_GetDomain();
+    if (theDomain == 0) {
+	delete [] argv;
+	return -1;
+    }
+
+    static Vector values(0);
+    int size = theDomain->getElementResponses(tags, argv, numArgs, values);
+    delete [] argv;
+    if (size < 0) {
+	return -1;
+    }
+    if (size > 0 && OPS_SetDoubleOutput(&size, &values(0)) < 0) {
+	opserr << "WARNING eleResponses - failed to set output\n";
+	return -1;
+    }
+
+    return 0;
+}
+
 int OPS_nodeCoord()
 {
     // make sure at least one other argument to contain type of system
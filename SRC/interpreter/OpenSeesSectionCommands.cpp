@@ -833,6 +833,46 @@ int OPS_Patch()
 	delete thePatch;
     	return -1;
     }
+
+    // the cells of a uniaxial section are added from arrays, without a
+    // Fiber object and material copy made for each
+    if (theActiveFiberSection2d != 0 || theActiveFiberSection3d != 0) {
+	UniaxialMaterial *material = OPS_getUniaxialMaterial(matTag);
+	if (material == 0) {
+	    opserr << "WARNING material "<<matTag<<" cannot be found\n";
+	    for(int j=0; j<numCells; j++)
+		delete cells[j];
+	    delete [] cells;
+	    delete thePatch;
+	    return -1;
+	}
+	UniaxialMaterial **mats = new UniaxialMaterial*[numCells+1];
+	double *fiberData = new double[3*numCells+3];
+	double *yLocs = fiberData;
+	double *zLocs = fiberData+numCells+1;
+	double *areas = fiberData+2*numCells+2;
+	for(int j=0; j<numCells; j++) {
+	    const Vector& cPos = cells[j]->getCentroidPosition();
+	    mats[j] = material;
+	    yLocs[j] = cPos(0);
+	    zLocs[j] = cPos(1);
+	    areas[j] = cells[j]->getArea();
+	    delete cells[j];
+	}
+
+	int res = 0;
+	if (theActiveFiberSection2d != 0)
+	    res = theActiveFiberSection2d->addFibers(numCells,mats,yLocs,areas);
+	else
+	    res = theActiveFiberSection3d->addFibers(numCells,mats,yLocs,zLocs,areas);
+
+	delete [] mats;
+	delete [] fiberData;
+	delete [] cells;
+	delete thePatch;
+	return res;
+    }
+
     for(int j=0; j<numCells; j++) {
 	// get fiber data
 	double area = cells[j]->getArea();
@@ -875,6 +915,7 @@ int OPS_Patch()
 	    }
 	    theFiber = new NDFiber2d(j,*ndmaterial,area,cPos(0));
 	    theActiveNDFiberSection2d->addFiber(*theFiber);
+	    delete theFiber;
 
 	} else if (theActiveNDFiberSection3d != 0) {
 
@@ -886,6 +927,7 @@ int OPS_Patch()
 	    }
 	    theFiber = new NDFiber3d(j,*ndmaterial,area,cPos(0),cPos(1));
 	    theActiveNDFiberSection3d->addFiber(*theFiber);
+	    delete theFiber;
 	}
 
 	delete cells[j];
@@ -933,6 +975,42 @@ int OPS_Layer()
     	return -1;
     }
 
+    // the bars of a uniaxial section are added from arrays, without a
+    // Fiber object and material copy made for each
+    if (theActiveFiberSection2d != 0 || theActiveFiberSection3d != 0) {
+	UniaxialMaterial *material = OPS_getUniaxialMaterial(matTag);
+	if (material == 0) {
+	    opserr << "WARNING material "<<matTag<<" cannot be found\n";
+	    delete [] reinfBar;
+	    delete theLayer;
+	    return -1;
+	}
+	UniaxialMaterial **mats = new UniaxialMaterial*[numReinfBars+1];
+	double *fiberData = new double[3*numReinfBars+3];
+	double *yLocs = fiberData;
+	double *zLocs = fiberData+numReinfBars+1;
+	double *areas = fiberData+2*numReinfBars+2;
+	for(int j=0; j<numReinfBars; j++) {
+	    const Vector& cPos = reinfBar[j].getPosition();
+	    mats[j] = material;
+	    yLocs[j] = cPos(0);
+	    zLocs[j] = cPos(1);
+	    areas[j] = reinfBar[j].getArea();
+	}
+
+	int res = 0;
+	if (theActiveFiberSection2d != 0)
+	    res = theActiveFiberSection2d->addFibers(numReinfBars,mats,yLocs,areas);
+	else
+	    res = theActiveFiberSection3d->addFibers(numReinfBars,mats,yLocs,zLocs,areas);
+
+	delete [] mats;
+	delete [] fiberData;
+	delete [] reinfBar;
+	delete theLayer;
+	return res;
+    }
+
     for(int j=0; j<numReinfBars; j++) {
 	
     	// get fiber data
@@ -976,6 +1054,7 @@ int OPS_Layer()
 	    }
 	    theFiber = new NDFiber2d(j,*ndmaterial,area,cPos(0));
 	    theActiveNDFiberSection2d->addFiber(*theFiber);
+	    delete theFiber;
 
 	} else if (theActiveNDFiberSection3d != 0) {
 
@@ -987,6 +1066,7 @@ int OPS_Layer()
 	    }
 	    theFiber = new NDFiber3d(j,*ndmaterial,area,cPos(0),cPos(1));
 	    theActiveNDFiberSection3d->addFiber(*theFiber);
+	    delete theFiber;
 	}
 	
     }
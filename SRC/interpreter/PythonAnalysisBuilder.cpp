@@ -73,6 +73,7 @@
 #include <SymBandEigenSOE.h>
 #include <FullGenEigenSolver.h>
 #include <FullGenEigenSOE.h>
+#include <DampedArpackSOE.h>
 #include <ArpackSOE.h>
 #include <iostream>
 #include <ProfileSPDLinSOE.h>
@@ -418,6 +419,9 @@ void PythonAnalysisBuilder::newEigenAnalysis(int typeSolver, double shift)
 	    FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	    theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+	} else if(typeSolver == EigenSOE_TAGS_DampedArpackSOE) {
+	    theEigenSOE = new DampedArpackSOE(shift);
+
 	} else {
 	    theEigenSOE = new ArpackSOE(shift);    
 	}
@@ -1140,6 +1144,8 @@ PyObject *ops_eigenAnalysis(PyObject *self, PyObject *args)
 	} else if(type=="fullGenLapack"||type=="-fullGenLapack"||
 		  type=="fullGenLapackEigen"||type=="-fullGenLapackEigen") {
 	    typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
+	} else if(type=="dampedArpack"||type=="-dampedArpack") {
+	    typeSolver = EigenSOE_TAGS_DampedArpackSOE;
 	} else {
 	    PyErr_SetString(PyExc_RuntimeError,"eigen - unknown option specified");
 	    return NULL;
@@ -287,7 +287,7 @@ void addOpenSeesCommands(void) {
 // void addOpenSeesCommands(void);
 
 PythonInterpreter::PythonInterpreter(int argc, char **argv)
-    :wrapper(), cmds(this)
+    :wrapper(), cmds(this), threadState(0), numComputations(0)
 {
 
     /* fmk - beginning of modifications for OpenSees */
@@ -608,6 +608,7 @@ PythonInterpreter::PythonInterpreter(int argc, char **argv)
 
     wrapper.addOpenSeesCommands();
     Py_InitModule("opensees", wrapper.getMethods());
+    PyEval_InitThreads();
 
     if (Py_VerboseFlag ||
         (command == NULL && filename == NULL && module == NULL && stdin_is_interactive)) {
@@ -770,60 +771,22 @@ PythonInterpreter::removeCommand(const char *) {
 
 int 
 PythonInterpreter::getNumRemainingInputArgs(void) {
-    return wrapper.getNumberArgs() - wrapper.getCurrentArg();
+    return wrapper.getNumRemainingArgs();
 }
 
 int 
 PythonInterpreter::getInt(int *data, int numArgs) {
-    if ((wrapper.getNumberArgs() - wrapper.getCurrentArg()) < numArgs) {
-	return -1;
-    }
-
-    for (int i=0; i<numArgs; i++) {
-	PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
-	wrapper.incrCurrentArg();
-	if (!PyInt_Check(o)) {
-	    return -1;
-	}
-	data[i] = PyInt_AS_LONG(o);
-    }
-    
-    return 0;
+    return wrapper.getInt(data, numArgs);
 }
 
 int 
 PythonInterpreter::getDouble(double *data, int numArgs) {
-    if ((wrapper.getNumberArgs() - wrapper.getCurrentArg()) < numArgs) {
-	return -1;
-    }
-
-    for (int i=0; i<numArgs; i++) {
-	PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
-	wrapper.incrCurrentArg();
-	if (!PyFloat_Check(o)) {
-	    return -1;
-	}
-	data[i] = PyFloat_AS_DOUBLE(o);
-    }
-    
-    return 0;
+    return wrapper.getDouble(data, numArgs);
 }
 
 const char* 
 PythonInterpreter::getString() {
-    
-    if (wrapper.getCurrentArg() >= wrapper.getNumberArgs()) {
-	return 0;
-    }
-    
-    PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
-    wrapper.incrCurrentArg();
-    if (!PyString_Check(o)) {
-	return 0;
-    }
-    
-    
-    return PyString_AS_STRING(o);;
+    return wrapper.getString();
 }
 
 int 
@@ -858,3 +821,17 @@ PythonInterpreter::setString(const char* str)
     return 0;
 }
 
+void
+PythonInterpreter::beginComputation(void)
+{
+    if (numComputations++ == 0)
+	threadState = PyEval_SaveThread();
+}
+
+void
+PythonInterpreter::endComputation(void)
+{
+    if (numComputations > 0 && --numComputations == 0)
+	PyEval_RestoreThread(threadState);
+}
+
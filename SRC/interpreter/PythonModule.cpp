@@ -28,7 +28,7 @@
 
 
 PythonModule::PythonModule()
-    :wrapper(), cmds(this)
+    :wrapper(), cmds(this), threadState(0), numComputations(0)
 {
 }
 
@@ -55,60 +55,22 @@ PythonModule::removeCommand(const char *) {
 
 int 
 PythonModule::getNumRemainingInputArgs(void) {
-    return wrapper.getNumberArgs() - wrapper.getCurrentArg();
+    return wrapper.getNumRemainingArgs();
 }
 
 int 
 PythonModule::getInt(int *data, int numArgs) {
-    if ((wrapper.getNumberArgs() - wrapper.getCurrentArg()) < numArgs) {
-	return -1;
-    }
-
-    for (int i=0; i<numArgs; i++) {
-	PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
-	wrapper.incrCurrentArg();
-	if (!PyInt_Check(o)) {
-	    return -1;
-	}
-	data[i] = PyInt_AS_LONG(o);
-    }
-    
-    return 0;
+    return wrapper.getInt(data, numArgs);
 }
 
 int 
 PythonModule::getDouble(double *data, int numArgs) {
-    if ((wrapper.getNumberArgs() - wrapper.getCurrentArg()) < numArgs) {
-	return -1;
-    }
-
-    for (int i=0; i<numArgs; i++) {
-	PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
-	wrapper.incrCurrentArg();
-	if (!PyFloat_Check(o)) {
-	    return -1;
-	}
-	data[i] = PyFloat_AS_DOUBLE(o);
-    }
-    
-    return 0;
+    return wrapper.getDouble(data, numArgs);
 }
 
 const char* 
 PythonModule::getString() {
-    
-    if (wrapper.getCurrentArg() >= wrapper.getNumberArgs()) {
-	return 0;
-    }
-    
-    PyObject *o = PyTuple_GetItem(wrapper.getCurrentArgv(),wrapper.getCurrentArg());
-    wrapper.incrCurrentArg();
-    if (!PyString_Check(o)) {
-	return 0;
-    }
-    
-    
-    return PyString_AS_STRING(o);;
+    return wrapper.getString();
 }
 
 int 
@@ -143,6 +105,20 @@ PythonModule::setString(const char* str)
     return 0;
 }
 
+void
+PythonModule::beginComputation(void)
+{
+    if (numComputations++ == 0)
+	threadState = PyEval_SaveThread();
+}
+
+void
+PythonModule::endComputation(void)
+{
+    if (numComputations > 0 && --numComputations == 0)
+	PyEval_RestoreThread(threadState);
+}
+
 static PythonModule* module = 0;
 
 void cleanupFunc()
@@ -161,6 +137,9 @@ initopensees(void)
     wrapper->addOpenSeesCommands();
     Py_InitModule("opensees", wrapper->getMethods());
 
+    // the GIL is released during the analyses, see beginComputation()
+    PyEval_InitThreads();
+
     // set up cleanup function at exit
     Py_AtExit(cleanupFunc);
 }
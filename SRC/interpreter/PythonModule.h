@@ -59,12 +59,19 @@ class PythonModule: public DL_Interpreter
     virtual int setDouble(double *, int numArgs);
     virtual int setString(const char*);
 
+    // the GIL is released during a computation, so that the other Python
+    // threads run meanwhile
+    virtual void beginComputation(void);
+    virtual void endComputation(void);
+
     // getwrapper
     PythonWrapper* getWrapper() {return &wrapper;}
     
   private:
     PythonWrapper wrapper;
     OpenSeesCommands cmds;
+    PyThreadState *threadState;
+    int numComputations;
 };
 
 
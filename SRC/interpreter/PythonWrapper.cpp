@@ -26,12 +26,176 @@
 #include "PythonWrapper.h"
 #include "OpenSeesCommands.h"
 #include <OPS_Globals.h>
+#include <string.h>
 
 PythonWrapper* wrapper = 0;
 
+//////////////////////////////////////////////
+/////// arrays of numbers  ///////////////////
+/////////////////////////////////////////////
+
+// The array object returned for several values when arrayOutputs is set.
+// It holds the values in one block and gives them through the buffer
+// protocol, so numpy.asarray() of it is a view without a copy, and as a
+// sequence, so that indexing, len() and iteration work as for a list.
+typedef struct {
+    PyObject_HEAD
+    char* data;
+    Py_ssize_t size;
+    Py_ssize_t itemsize;
+    char format[2];
+} OpenSeesArray;
+
+static PyTypeObject OpenSeesArrayType = {PyVarObject_HEAD_INIT(NULL, 0)};
+static PySequenceMethods OpenSeesArraySequence;
+static PyBufferProcs OpenSeesArrayBuffer;
+
+static void OpenSeesArray_dealloc(PyObject* self)
+{
+    OpenSeesArray* a = (OpenSeesArray*)self;
+    delete [] a->data;
+    PyObject_Del(self);
+}
+
+static Py_ssize_t OpenSeesArray_length(PyObject* self)
+{
+    return ((OpenSeesArray*)self)->size;
+}
+
+static PyObject* OpenSeesArray_item(PyObject* self, Py_ssize_t i)
+{
+    OpenSeesArray* a = (OpenSeesArray*)self;
+    if (i < 0 || i >= a->size) {
+	PyErr_SetString(PyExc_IndexError, "array index out of range");
+	return NULL;
+    }
+    if (a->format[0] == 'd') {
+	return PyFloat_FromDouble(((double*)a->data)[i]);
+    }
+    return PyInt_FromLong(((int*)a->data)[i]);
+}
+
+static PyObject* OpenSeesArray_repr(PyObject* self)
+{
+    PyObject* list = PySequence_List(self);
+    if (list == NULL) return NULL;
+    PyObject* res = PyObject_Repr(list);
+    Py_DECREF(list);
+    return res;
+}
+
+static int OpenSeesArray_getbuffer(PyObject* self, Py_buffer* view, int flags)
+{
+    OpenSeesArray* a = (OpenSeesArray*)self;
+    view->buf = a->data;
+    view->obj = self;
+    Py_INCREF(self);
+    view->len = a->size*a->itemsize;
+    view->readonly = 0;
+    view->itemsize = a->itemsize;
+    view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? a->format : NULL;
+    view->ndim = 1;
+    view->shape = (flags & PyBUF_ND) == PyBUF_ND ? &a->size : NULL;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? &a->itemsize : NULL;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static int OpenSeesArray_ready()
+{
+    if (OpenSeesArrayType.tp_name != 0) return 0;
+
+    OpenSeesArraySequence.sq_length = OpenSeesArray_length;
+    OpenSeesArraySequence.sq_item = OpenSeesArray_item;
+    OpenSeesArrayBuffer.bf_getbuffer = OpenSeesArray_getbuffer;
+
+    OpenSeesArrayType.tp_name = "opensees.array";
+    OpenSeesArrayType.tp_basicsize = sizeof(OpenSeesArray);
+    OpenSeesArrayType.tp_dealloc = OpenSeesArray_dealloc;
+    OpenSeesArrayType.tp_repr = OpenSeesArray_repr;
+    OpenSeesArrayType.tp_as_sequence = &OpenSeesArraySequence;
+    OpenSeesArrayType.tp_as_buffer = &OpenSeesArrayBuffer;
+    OpenSeesArrayType.tp_flags = Py_TPFLAGS_DEFAULT;
+#ifdef Py_TPFLAGS_HAVE_NEWBUFFER
+    OpenSeesArrayType.tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
+#endif
+    OpenSeesArrayType.tp_doc = "values returned by an OpenSees command";
+
+    return PyType_Ready(&OpenSeesArrayType);
+}
+
+static PyObject* OpenSeesArray_new(const void* data, int size, int itemsize, char format)
+{
+    if (OpenSeesArray_ready() < 0) return NULL;
+
+    OpenSeesArray* a = PyObject_New(OpenSeesArray, &OpenSeesArrayType);
+    if (a == NULL) return NULL;
+    a->data = new char[size*itemsize];
+    memcpy(a->data, data, size*itemsize);
+    a->size = size;
+    a->itemsize = itemsize;
+    a->format[0] = format;
+    a->format[1] = '\0';
+
+    return (PyObject*)a;
+}
+
+// gets the buffer of an argument if it is an array of numbers in the
+// native byte order, returns the number of items or -1 if it is not
+static int getNumberBuffer(PyObject* o, Py_buffer* view)
+{
+    if (PyString_Check(o) || PyUnicode_Check(o) || PyByteArray_Check(o) ||
+	!PyObject_CheckBuffer(o)) {
+	return -1;
+    }
+    if (PyObject_GetBuffer(o, view, PyBUF_FORMAT|PyBUF_C_CONTIGUOUS) < 0) {
+	PyErr_Clear();
+	return -1;
+    }
+
+    const char* format = view->format;
+    if (format != 0 && (format[0] == '@' || format[0] == '=')) {
+	format++;
+    }
+    if (format == 0 || format[0] == '\0' || format[1] != '\0' ||
+	strchr("dfbBhHiIlLqQ", format[0]) == 0) {
+	PyBuffer_Release(view);
+	return -1;
+    }
+
+    return (int)(view->len/view->itemsize);
+}
+
+// the item i of a buffer from getNumberBuffer
+static double getBufferItem(const Py_buffer& view, int i, bool& isInt)
+{
+    const char* format = view.format;
+    if (format[0] == '@' || format[0] == '=') {
+	format++;
+    }
+
+    isInt = true;
+    switch (format[0]) {
+    case 'd': isInt = false; return ((double*)view.buf)[i];
+    case 'f': isInt = false; return ((float*)view.buf)[i];
+    case 'b': return ((signed char*)view.buf)[i];
+    case 'B': return ((unsigned char*)view.buf)[i];
+    case 'h': return ((short*)view.buf)[i];
+    case 'H': return ((unsigned short*)view.buf)[i];
+    case 'i': return ((int*)view.buf)[i];
+    case 'I': return ((unsigned int*)view.buf)[i];
+    case 'l': return (double)((long*)view.buf)[i];
+    case 'L': return (double)((unsigned long*)view.buf)[i];
+    case 'q': return (double)((long long*)view.buf)[i];
+    default: return (double)((unsigned long long*)view.buf)[i];
+    }
+}
+
 PythonWrapper::PythonWrapper()
-    :currentArgv(0), currentArg(0), numberArgs(0),
-     methodsOpenSees(), opensees_docstring(""), currentResult(0)
+    :currentArgv(0), currentArg(0), currentItem(0), numberArgs(0),
+     methodsOpenSees(), opensees_docstring(""), currentResult(0),
+     arrayOutputs(false)
 {
     wrapper = this;
 }
@@ -43,9 +207,13 @@ PythonWrapper::~PythonWrapper()
 void
 PythonWrapper::resetCommandLine(int nArgs, int cArg, PyObject* argv)
 {
+    // a command waits for the end of the analysis of analyzeStart
+    OPS_FinishAsyncAnalysis();
+
     numberArgs = nArgs;
     currentArg = cArg-1;
     if (currentArg < 0) currentArg = 0;
+    currentItem = 0;
     currentArgv = argv;
 }
 
@@ -53,13 +221,138 @@ void
 PythonWrapper::resetCommandLine(int cArg)
 {
     if (cArg < 0) {
-	currentArg += cArg;
+	// step back over the items of the array arguments
+	while (cArg < 0 && (currentArg > 0 || currentItem > 0)) {
+	    if (currentItem == 0) {
+		currentArg--;
+		Py_buffer view;
+		int numItems = getNumberBuffer(PyTuple_GetItem(currentArgv,currentArg), &view);
+		if (numItems > 0) {
+		    PyBuffer_Release(&view);
+		    currentItem = numItems;
+		} else {
+		    currentItem = 1;
+		}
+	    }
+	    currentItem--;
+	    cArg++;
+	}
     } else {
 	currentArg = cArg-1;
+	currentItem = 0;
     }
     if (currentArg < 0) currentArg = 0;
 }
 
+int
+PythonWrapper::getNumRemainingArgs()
+{
+    int num = -currentItem;
+    for (int i=currentArg; i<numberArgs; i++) {
+	Py_buffer view;
+	int numItems = getNumberBuffer(PyTuple_GetItem(currentArgv,i), &view);
+	if (numItems >= 0) {
+	    PyBuffer_Release(&view);
+	    num += numItems;
+	} else {
+	    num++;
+	}
+    }
+
+    return num;
+}
+
+int
+PythonWrapper::getInt(int* data, int numArgs)
+{
+    int i = 0;
+    while (i < numArgs) {
+	if (currentArg >= numberArgs) {
+	    return -1;
+	}
+	PyObject *o = PyTuple_GetItem(currentArgv,currentArg);
+
+	Py_buffer view;
+	int numItems = getNumberBuffer(o, &view);
+	if (numItems < 0) {
+	    incrCurrentArg();
+	    if (!PyInt_Check(o)) {
+		return -1;
+	    }
+	    data[i++] = PyInt_AS_LONG(o);
+	    continue;
+	}
+
+	// copy the items of an array of integers
+	for (; i<numArgs && currentItem<numItems; i++, currentItem++) {
+	    bool isInt;
+	    double value = getBufferItem(view, currentItem, isInt);
+	    if (!isInt) {
+		PyBuffer_Release(&view);
+		return -1;
+	    }
+	    data[i] = (int)value;
+	}
+	PyBuffer_Release(&view);
+	if (currentItem >= numItems) {
+	    incrCurrentArg();
+	}
+    }
+
+    return 0;
+}
+
+int
+PythonWrapper::getDouble(double* data, int numArgs)
+{
+    int i = 0;
+    while (i < numArgs) {
+	if (currentArg >= numberArgs) {
+	    return -1;
+	}
+	PyObject *o = PyTuple_GetItem(currentArgv,currentArg);
+
+	Py_buffer view;
+	int numItems = getNumberBuffer(o, &view);
+	if (numItems < 0) {
+	    incrCurrentArg();
+	    if (!PyFloat_Check(o)) {
+		return -1;
+	    }
+	    data[i++] = PyFloat_AS_DOUBLE(o);
+	    continue;
+	}
+
+	// copy the items of an array, of integers or floating point
+	for (; i<numArgs && currentItem<numItems; i++, currentItem++) {
+	    bool isInt;
+	    data[i] = getBufferItem(view, currentItem, isInt);
+	}
+	PyBuffer_Release(&view);
+	if (currentItem >= numItems) {
+	    incrCurrentArg();
+	}
+    }
+
+    return 0;
+}
+
+const char*
+PythonWrapper::getString()
+{
+    if (currentArg >= numberArgs || currentItem > 0) {
+	return 0;
+    }
+
+    PyObject *o = PyTuple_GetItem(currentArgv,currentArg);
+    incrCurrentArg();
+    if (!PyString_Check(o)) {
+	return 0;
+    }
+
+    return PyString_AS_STRING(o);
+}
+
 void
 PythonWrapper::addCommand(const char* name, PyCFunction proc)
 {
@@ -85,6 +378,10 @@ PythonWrapper::setOutputs(int* data, int numArgs)
 	currentResult = Py_BuildValue("i", data[0]);
 	return ;
     }
+    if (arrayOutputs) {
+	currentResult = OpenSeesArray_new(data, numArgs, sizeof(int), 'i');
+	return;
+    }
     currentResult = PyList_New(numArgs);
     for (int i=0; i<numArgs; i++) {
 	PyList_SET_ITEM(currentResult, i, Py_BuildValue("i", data[i]));
@@ -99,6 +396,10 @@ PythonWrapper::setOutputs(double* data, int numArgs)
 	currentResult = Py_BuildValue("d", data[0]);
 	return ;
     }
+    if (arrayOutputs) {
+	currentResult = OpenSeesArray_new(data, numArgs, sizeof(double), 'd');
+	return;
+    }
     currentResult = PyList_New(numArgs);
     for (int i=0; i<numArgs; i++) {
 	PyList_SET_ITEM(currentResult, i, Py_BuildValue("d", data[i]));
@@ -328,6 +629,30 @@ static PyObject *Py_ops_analyze(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_analyzeStart(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_analyzeStart() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_analyzeStatus(PyObject *self, PyObject *args)
+{
+    // no wait for the analysis, the command line is left as it is
+    if (OPS_analyzeStatus() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_analyzeWait(PyObject *self, PyObject *args)
+{
+    if (OPS_analyzeWait() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_nodeDisp(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -553,6 +878,24 @@ static PyObject *Py_ops_eleResponse(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_nodeResponses(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_nodeResponses() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_eleResponses(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_eleResponses() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_SP(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -859,6 +1202,60 @@ static PyObject *Py_ops_stopTimer(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_profile(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_profile() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_threads(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_threads() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_memoryReport(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_memoryReport() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_benchmark(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_benchmark() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_convergenceLog(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_convergenceLog() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_sdofEnsemble(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_sdofEnsemble() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_modalDamping(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -958,6 +1355,24 @@ static PyObject *Py_ops_convertTextToBinary(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+static PyObject *Py_ops_convertColumnarToText(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_convertColumnarToText() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
+static PyObject *Py_ops_convertTextToSeries(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    if (OPS_convertTextToSeries() < 0) return NULL;
+
+    return wrapper->getResults();
+}
+
 static PyObject *Py_ops_convertBinaryToText(PyObject *self, PyObject *args)
 {
     wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
@@ -1266,6 +1681,22 @@ static PyObject *Py_ops_remesh(PyObject *self, PyObject *args)
     return wrapper->getResults();
 }
 
+// arrayOutput flag, with a nonzero flag the commands return several
+// values as an array object instead of a list
+static PyObject *Py_ops_arrayOutput(PyObject *self, PyObject *args)
+{
+    wrapper->resetCommandLine(PyTuple_Size(args), 1, args);
+
+    int flag;
+    if (wrapper->getInt(&flag, 1) < 0) {
+	opserr << "WARNING want - arrayOutput flag?\n";
+	return NULL;
+    }
+    wrapper->setArrayOutputs(flag != 0);
+
+    return wrapper->getResults();
+}
+
 /////////////////////////////////////////////////
 ////////////// Add Python commands //////////////
 /////////////////////////////////////////////////
@@ -1294,6 +1725,9 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("algorithm", &Py_ops_algorithm);
     addCommand("analysis", &Py_ops_analysis);
     addCommand("analyze", &Py_ops_analyze);
+    addCommand("analyzeStart", &Py_ops_analyzeStart);
+    addCommand("analyzeStatus", &Py_ops_analyzeStatus);
+    addCommand("analyzeWait", &Py_ops_analyzeWait);
     addCommand("nodeDisp", &Py_ops_nodeDisp);
     addCommand("test", &Py_ops_test);
     addCommand("section", &Py_ops_section);
@@ -1319,6 +1753,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("nodeEigenvector", &Py_ops_nodeEigenvector);
     addCommand("getTime", &Py_ops_getTime);
     addCommand("eleResponse", &Py_ops_eleResponse);
+    addCommand("nodeResponses", &Py_ops_nodeResponses);
+    addCommand("eleResponses", &Py_ops_eleResponses);
     addCommand("sp", &Py_ops_SP);
     addCommand("fixX", &Py_ops_fixX);
     addCommand("fixY", &Py_ops_fixY);
@@ -1353,6 +1789,12 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("nodeBounds", &Py_ops_nodeBounds);
     addCommand("start", &Py_ops_startTimer);
     addCommand("stop", &Py_ops_stopTimer);
+    addCommand("profile", &Py_ops_profile);
+    addCommand("threads", &Py_ops_threads);
+    addCommand("memoryReport", &Py_ops_memoryReport);
+    addCommand("benchmark", &Py_ops_benchmark);
+    addCommand("convergenceLog", &Py_ops_convergenceLog);
+    addCommand("sdofEnsemble", &Py_ops_sdofEnsemble);
     addCommand("modalDamping", &Py_ops_modalDamping);
     addCommand("modalDampingQ", &Py_ops_modalDampingQ);
     addCommand("setElementRayleighDampingFactors", &Py_ops_setElementRayleighDampingFactors);
@@ -1365,6 +1807,8 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("stripXML", &Py_ops_stripXML);
     addCommand("convertBinaryToText", &Py_ops_convertBinaryToText);
     addCommand("convertTextToBinary", &Py_ops_convertTextToBinary);
+    addCommand("convertColumnarToText", &Py_ops_convertColumnarToText);
+    addCommand("convertTextToSeries", &Py_ops_convertTextToSeries);
     addCommand("getEleTags", &Py_ops_getEleTags);
     addCommand("getNodeTags", &Py_ops_getNodeTags);
     addCommand("getParamTags", &Py_ops_getParamTags);
@@ -1399,6 +1843,7 @@ PythonWrapper::addOpenSeesCommands()
     addCommand("setElementRayleighFactors", &Py_ops_setElementRayleighFactors);
     addCommand("mesh", &Py_ops_mesh);
     addCommand("remesh", &Py_ops_remesh);
+    addCommand("arrayOutput", &Py_ops_arrayOutput);
     
     PyMethodDef method = {NULL,NULL,0,NULL};
     methodsOpenSees.push_back(method);
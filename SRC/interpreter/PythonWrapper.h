@@ -48,23 +48,35 @@ public:
     PyObject* getCurrentArgv() {return currentArgv;}
     int getCurrentArg() const {return currentArg;}
     int getNumberArgs() const {return numberArgs;}
-    void incrCurrentArg() {currentArg++;}
+    void incrCurrentArg() {currentArg++; currentItem = 0;}
 
-    // set outputs
+    // get the values of the remaining arguments, an argument with the
+    // buffer protocol (a NumPy array, array.array, ...) of numbers gives
+    // each of its items in turn as if they were separate arguments
+    int getNumRemainingArgs();
+    int getInt(int* data, int numArgs);
+    int getDouble(double* data, int numArgs);
+    const char* getString();
+
+    // set outputs, with arrayOutputs set several values are returned
+    // as one array object with the buffer protocol instead of a list
     void setOutputs(int* data, int numArgs);
     void setOutputs(double* data, int numArgs);
     void setOutputs(const char* str);
     PyObject* getResults();
+    void setArrayOutputs(bool flag) {arrayOutputs = flag;}
 
 private:
     // command line arguments
     PyObject* currentArgv;
     int currentArg;
+    int currentItem;   // the next item of the current argument
     int numberArgs;
 
     // methods table
     std::vector<PyMethodDef> methodsOpenSees;
     const char* opensees_docstring;
     PyObject* currentResult;
+    bool arrayOutputs;
 };
 #endif
@@ -504,8 +504,10 @@ TclInterpreter::getInt(int *data, int numArgs) {
 	return -1;
     }
     
+    // no interp so that a failed read, which a command may use to find
+    // the end of a list of numbers, leaves no message in the result
     for (int i=0; i<numArgs; i++) {
-	if (Tcl_GetInt(interp, wrapper.getCurrentArgv()[wrapper.getCurrentArg()], &data[i]) != TCL_OK) {
+	if (Tcl_GetInt(0, wrapper.getCurrentArgv()[wrapper.getCurrentArg()], &data[i]) != TCL_OK) {
 	    wrapper.incrCurrentArg();
 	    return -1;
 	}
@@ -523,8 +525,9 @@ TclInterpreter::getDouble(double *data, int numArgs) {
 	return -1;
     }
     
+    // no interp as in getInt()
     for (int i=0; i<numArgs; i++) {
-	if (Tcl_GetDouble(interp, wrapper.getCurrentArgv()[wrapper.getCurrentArg()], &data[i]) != TCL_OK) {
+	if (Tcl_GetDouble(0, wrapper.getCurrentArgv()[wrapper.getCurrentArg()], &data[i]) != TCL_OK) {
 	    wrapper.incrCurrentArg();
 	    return -1;
 	}
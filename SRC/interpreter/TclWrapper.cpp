@@ -27,7 +27,7 @@
 #include "OpenSeesCommands.h"
 #include <OPS_Globals.h>
 
-static TclWrapper* wrapper = 0;
+static OPS_THREAD_LOCAL TclWrapper* wrapper = 0;
 
 TclWrapper::TclWrapper()
     :currentArgv(0), currentArg(0), numberArgs(0)
@@ -277,6 +277,22 @@ static int Tcl_ops_nodeDisp(ClientData clientData, Tcl_Interp *interp, int argc,
     return TCL_OK;
 }
 
+static int Tcl_ops_nodeResponses(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_nodeResponses() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_eleResponses(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_eleResponses() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_test(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -741,6 +757,54 @@ static int Tcl_ops_stopTimer(ClientData clientData, Tcl_Interp *interp, int argc
     return TCL_OK;
 }
 
+static int Tcl_ops_profile(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_profile() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_threads(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_threads() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_memoryReport(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_memoryReport() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_benchmark(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_benchmark() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_convergenceLog(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_convergenceLog() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_sdofEnsemble(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_sdofEnsemble() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_modalDamping(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -837,6 +901,22 @@ static int Tcl_ops_convertTextToBinary(ClientData clientData, Tcl_Interp *interp
     return TCL_OK;
 }
 
+static int Tcl_ops_convertColumnarToText(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_convertColumnarToText() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
+static int Tcl_ops_convertTextToSeries(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
+    wrapper->resetCommandLine(argc, 1, argv);
+
+    if (OPS_convertTextToSeries() < 0) return TCL_ERROR;
+    
+    return TCL_OK;
+}
+
 static int Tcl_ops_getEleTags(ClientData clientData, Tcl_Interp *interp, int argc,   TCL_Char **argv) {
     wrapper->resetCommandLine(argc, 1, argv);
 
@@ -1154,6 +1234,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"nodeEigenvector", &Tcl_ops_nodeEigenvector);
     addCommand(interp,"getTime", &Tcl_ops_getTime);
     addCommand(interp,"eleResponse", &Tcl_ops_eleResponse);
+    addCommand(interp,"nodeResponses", &Tcl_ops_nodeResponses);
+    addCommand(interp,"eleResponses", &Tcl_ops_eleResponses);
     addCommand(interp,"sp", &Tcl_ops_SP);
     addCommand(interp,"fixX", &Tcl_ops_fixX);
     addCommand(interp,"fixY", &Tcl_ops_fixY);
@@ -1188,6 +1270,12 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"nodeBounds", &Tcl_ops_nodeBounds);
     addCommand(interp,"start", &Tcl_ops_startTimer);
     addCommand(interp,"stop", &Tcl_ops_stopTimer);
+    addCommand(interp,"profile", &Tcl_ops_profile);
+    addCommand(interp,"threads", &Tcl_ops_threads);
+    addCommand(interp,"memoryReport", &Tcl_ops_memoryReport);
+    addCommand(interp,"benchmark", &Tcl_ops_benchmark);
+    addCommand(interp,"convergenceLog", &Tcl_ops_convergenceLog);
+    addCommand(interp,"sdofEnsemble", &Tcl_ops_sdofEnsemble);
     addCommand(interp,"modalDamping", &Tcl_ops_modalDamping);
     addCommand(interp,"modalDampingQ", &Tcl_ops_modalDampingQ);
     addCommand(interp,"setElementRayleighDampingFactors", &Tcl_ops_setElementRayleighDampingFactors);
@@ -1200,6 +1288,8 @@ TclWrapper::addOpenSeesCommands(Tcl_Interp* interp)
     addCommand(interp,"stripXML", &Tcl_ops_stripXML);
     addCommand(interp,"convertBinaryToText", &Tcl_ops_convertBinaryToText);
     addCommand(interp,"convertTextToBinary", &Tcl_ops_convertTextToBinary);
+    addCommand(interp,"convertColumnarToText", &Tcl_ops_convertColumnarToText);
+    addCommand(interp,"convertTextToSeries", &Tcl_ops_convertTextToSeries);
     addCommand(interp,"getEleTags", &Tcl_ops_getEleTags);
     addCommand(interp,"getNodeTags", &Tcl_ops_getNodeTags);
     addCommand(interp,"getParamTags", &Tcl_ops_getParamTags);
@@ -0,0 +1,19 @@
+# awaitable analyze: the steps are taken by the worker thread of
+# analyzeStart while the event loop runs, the GIL being released
+# meanwhile; progress(numDone, numIncr, time) is called at each poll
+#
+#   result = await analyzeAsync(ops, 1000, 0.01)
+#
+# the model is not to be used by another command before the end
+
+import asyncio
+
+async def analyzeAsync(ops, numIncr, *dt, poll=0.05, progress=None):
+    ops.analyzeStart(numIncr, *dt)
+    while True:
+        numDone, total, time, finished, result = ops.analyzeStatus()
+        if progress is not None:
+            progress(int(numDone), int(total), time)
+        if finished != 0.0:
+            return ops.analyzeWait()
+        await asyncio.sleep(poll)
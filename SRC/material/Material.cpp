@@ -32,6 +32,7 @@
 // What: "@(#) MaterialModel.C, revA"
 
 #include <Material.h>
+#include <ModelArena.h>
 
 Material::Material(int tag, int clasTag)
 :TaggedObject(tag), MovableObject(clasTag)
@@ -47,6 +48,46 @@ Material::~Material()
 
 }
 
+int Material::numObjects = 0;
+size_t Material::numObjectBytes = 0;
+
+void *
+Material::operator new(size_t numBytes)
+{
+  void *theObject = ModelArena::allocateObject(numBytes);
+
+  // materials may be copied by the threads forming the elements
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  numObjects++;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  numObjectBytes += numBytes;
+
+  return theObject;
+}
+
+void
+Material::operator delete(void *theObject)
+{
+  if (theObject == 0)
+    return;
+
+  size_t numBytes = ModelArena::getObjectSize(theObject);
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  numObjects--;
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+  numObjectBytes -= numBytes;
+
+  ModelArena::deallocateObject(theObject);
+}
+
 Response*
 Material::setResponse(const char **argv, int argc, OPS_Stream &s)
 {
@@ -50,6 +50,15 @@ class Material : public TaggedObject, public MovableObject
     Material(int tag, int classTag);    
     virtual ~Material();
 
+    // the object is placed in the ModelArena while it is active
+    static void *operator new(size_t numBytes);
+    static void operator delete(void *theObject);
+
+    // the number of Material objects in existence and their bytes, not
+    // counting the storage they allocate themselves
+    static int getNumObjects(void) {return numObjects;}
+    static size_t getNumObjectBytes(void) {return numObjectBytes;}
+
 
     virtual Response *setResponse(const char **argv, int argc, OPS_Stream &s);
     virtual int getResponse(int responseID, Information &info);
@@ -62,6 +71,8 @@ class Material : public TaggedObject, public MovableObject
   protected:
     
   private:
+    static int numObjects;
+    static size_t numObjectBytes;
 };
 
 
@@ -384,6 +384,33 @@ J2BeamFiber2d::revertToLastCommit (void)
   return 0;
 }
 
+int
+J2BeamFiber2d::commitBatch (NDMaterial **theMaterials, int n)
+{
+  if (this->getClassTag() != ND_TAG_J2BeamFiber2d)
+    return this->NDMaterial::commitBatch(theMaterials, n);
+
+  // bind the calls statically, as for the uniaxial materials
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += ((J2BeamFiber2d *)theMaterials[i])->J2BeamFiber2d::commitState();
+
+  return res;
+}
+
+int
+J2BeamFiber2d::revertBatch (NDMaterial **theMaterials, int n)
+{
+  if (this->getClassTag() != ND_TAG_J2BeamFiber2d)
+    return this->NDMaterial::revertBatch(theMaterials, n);
+
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += ((J2BeamFiber2d *)theMaterials[i])->J2BeamFiber2d::revertToLastCommit();
+
+  return res;
+}
+
 int
 J2BeamFiber2d::revertToStart (void)
 {
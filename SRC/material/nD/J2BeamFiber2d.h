@@ -61,6 +61,9 @@ class J2BeamFiber2d : public NDMaterial
   int commitState (void);
   int revertToLastCommit (void);
   int revertToStart (void);
+
+  int commitBatch (NDMaterial **theMaterials, int n);
+  int revertBatch (NDMaterial **theMaterials, int n);
   
   NDMaterial *getCopy (void);
   NDMaterial *getCopy (const char *type);
@@ -52,17 +52,25 @@
 Matrix NDMaterial::errMatrix(1,1);
 Vector NDMaterial::errVector(1);
 
-static MapOfTaggedObjects theNDMaterialObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theNDMaterialObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theNDMaterialObjects(void)
+{
+  if (theNDMaterialObjectsPtr == 0)
+    theNDMaterialObjectsPtr = new MapOfTaggedObjects();
+  return *theNDMaterialObjectsPtr;
+}
 
 bool OPS_addNDMaterial(NDMaterial *newComponent)
 {
-    return theNDMaterialObjects.addComponent(newComponent);
+    return theNDMaterialObjects().addComponent(newComponent);
 }
 
 NDMaterial *OPS_getNDMaterial(int tag)
 {
 
-  TaggedObject *theResult = theNDMaterialObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theNDMaterialObjects().getComponentPtr(tag);
   if(theResult == 0) {
       opserr << "NDMaterial no found with tag: " << tag << "\n";
       return 0;
@@ -73,7 +81,7 @@ NDMaterial *OPS_getNDMaterial(int tag)
 }
 
 void OPS_clearAllNDMaterial(void) {
-    theNDMaterialObjects.clearAll();
+    theNDMaterialObjects().clearAll();
 }
 
 NDMaterial::NDMaterial(int tag, int classTag)
@@ -179,6 +187,28 @@ NDMaterial::getStrain(void)
    return errVector;    
 }
 
+int
+NDMaterial::commitBatch(NDMaterial **theMaterials, int n)
+{
+  // default is to invoke commitState() on each; subclasses override this
+  // to avoid the virtual calls when theMaterials are all of their type
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += theMaterials[i]->commitState();
+
+  return res;
+}
+
+int
+NDMaterial::revertBatch(NDMaterial **theMaterials, int n)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += theMaterials[i]->revertToLastCommit();
+
+  return res;
+}
+
 Response*
 NDMaterial::setResponse (const char **argv, int argc, 
 			 OPS_Stream &output)
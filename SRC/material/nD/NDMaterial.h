@@ -70,6 +70,10 @@ class NDMaterial : public Material
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
 
+    // commit or revert n materials of the same type as this one
+    virtual int commitBatch(NDMaterial **theMaterials, int n);
+    virtual int revertBatch(NDMaterial **theMaterials, int n);
+
     virtual NDMaterial *getCopy(void) = 0;
     virtual NDMaterial *getCopy(const char *code);
 
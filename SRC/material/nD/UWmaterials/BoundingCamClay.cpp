@@ -32,6 +32,7 @@
 #include <Information.h>
 #include <MaterialResponse.h>
 #include <Parameter.h>
+#include <VoigtTensor.h>
 
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -99,16 +100,7 @@ BoundingCamClay::BoundingCamClay(int tag, int classTag, double mDen, double C, d
     mSigma_n(6),
     mSIGMAo(6),
     mSIGMAo_n(6),
-    mM(6,6),
-    mCe(6,6),
     mCep(6,6),
-    mI1(6),
-    mIIco(6,6),
-	mIIcon(6,6),
-	mIImix(6,6),
-    mIIvol(6,6),
-	mIIdevCon(6,6),
-	mIIdevMix(6,6),
 	mState(7)
 {
 	massDen = mDen;
@@ -135,16 +127,7 @@ BoundingCamClay ::BoundingCamClay()
     mSigma_n(6),
     mSIGMAo(6),
     mSIGMAo_n(6),
-    mM(6,6),
-    mCe(6,6),
     mCep(6,6),
-    mI1(6),
-    mIIco(6,6),
-	mIIcon(6,6),
-	mIImix(6,6),
-    mIIvol(6,6),
-	mIIdevCon(6,6),
-	mIIdevMix(6,6),
 	mState(7)
 {
 	massDen = 0.0;
@@ -199,45 +182,34 @@ void BoundingCamClay::initialize()
 	flagReversal = false;
 	    
 	// 2nd-order Identity Tensor
-	mI1.Zero();
-	mI1(0) = 1.0;
-	mI1(1) = 1.0;
-	mI1(2) = 1.0;
+	VoigtTensor::identity(mI1);
 
 	// 4th-order mixed variant identity
-	mIImix.Zero();
-	for (int i = 0; i<6; i++) {
-		mIImix(i,i) = 1.0;
-	}
+	VoigtTensor::identity4(mIImix, 1.0);
 
 	// 4th-order covariant identity
-	mIIco = mIImix;
-	mIIco(3,3) = 2.0;
-	mIIco(4,4) = 2.0;
-	mIIco(5,5) = 2.0;
+	VoigtTensor::identity4(mIIco, 2.0);
 
 	// 4th-order contravariant identity
-	mIIcon = mIImix;
-	mIIcon(3,3) = 0.5;
-	mIIcon(4,4) = 0.5;
-	mIIcon(5,5) = 0.5;
+	VoigtTensor::identity4(mIIcon, 0.5);
 
 	// 4th-order Volumetric Tensor, IIvol = I1 tensor I1
-	mIIvol.Zero();
-	for (int i = 0; i<3; i++) {
-		mIIvol(i,0) = 1.0;
-		mIIvol(i,1) = 1.0;
-		mIIvol(i,2) = 1.0;
-	}
+	VoigtTensor::volumetric(mIIvol);
 
 	// 4th-order contravariant deviatoric tensor
-	mIIdevCon = mIIcon - one3*mIIvol;
+	mIIdevCon = mIIcon;
+	mIIdevCon.addMatrix(1.0, mIIvol, -one3);
 
 	// 4th-order mixed variant deviatoric tensor
-	mIIdevMix = mIImix - one3*mIIvol;
+	mIIdevMix = mIImix;
+	mIIdevMix.addMatrix(1.0, mIIvol, -one3);
 
 	// 4th-order tensor M --> needs covariant formulation
-	mM = mIIco - (one3 - (pow((iC/3.0),2.0)))*mIIvol;
+	mM = mIIco;
+	mM.addMatrix(1.0, mIIvol, -(one3 - (pow((iC/3.0),2.0))));
+
+	// elastic tangent
+	mCe.Zero();
 
 	// state parameter vector for recorders
 	mState.Zero();
@@ -326,15 +298,16 @@ void BoundingCamClay::plastic_integrator()
 	double f, ev, es, p, q;
 	double kappa, r, R;
 	double norm_e = 0;
-	Vector SIGMAo(6);
-	Vector epsilonET(6);
-	Vector epsilonE(6);
-	Vector sigma(6);
-	Vector alpha(6);
-	Vector xi(6);
-	Vector df_dSigma(6);
-	Vector e(6);
-	Vector n(6);
+	VectorN<6> SIGMAo;
+	VectorN<6> epsilonET;
+	VectorN<6> epsilonE;
+	VectorN<6> sigma;
+	VectorN<6> alpha;
+	VectorN<6> xi;
+	VectorN<6> df_dSigma;
+	VectorN<6> e;
+	VectorN<6> n;
+	VectorN<6> temp;
 
 	// initialize working variables
 	kappa = mKappa_n;
@@ -347,14 +320,15 @@ void BoundingCamClay::plastic_integrator()
     SIGMAo = mSIGMAo_n;
 
 	// trial elastic strain
-	epsilonET = mEpsilon - mEpsilon_P;
+	for (int i = 0; i < 6; i++)
+		epsilonET(i) = mEpsilon(i) - mEpsilon_P(i);
 		
 	// trial elastic volumetric strain
-	ev = GetTrace(epsilonET);
+	ev = VoigtTensor::trace(epsilonET);
 	// trial elastic deviatoric strain tensor (contravariant)
-	e = mIIdevCon*epsilonET;
+	VoigtTensor::dot(mIIdevCon, epsilonET, e);
 	// norm of trial elastic deviatoric strain (contravariant-type norm)
-	norm_e = GetContraNorm(e);
+	norm_e = VoigtTensor::normContr(e);
 	// trial second invariant of deviatoric strain tensor
 	es = root23*norm_e;
 
@@ -367,16 +341,18 @@ void BoundingCamClay::plastic_integrator()
 		epsilonE = epsilonET;
 
 		// set elastic tangent tensor Ce
-		mCe = GetElasticOperator(p, ev, es, n);
+		GetElasticOperator(p, ev, es, n, mCe);
 		// consistent elastoplastic tangent = elastic tangent
-		mCep = mCe;
+		mCe.copyTo(mCep);
 
 		// compute stress 
-		sigma = mCe*epsilonE;
+		VoigtTensor::dot(mCe, epsilonE, sigma);
 
 		// update stress invariants for recorders
-		p = one3*GetTrace(sigma);
-		q = sqrt(3.0/2.0)*GetContraNorm(sigma - p*mI1);
+		p = one3*VoigtTensor::trace(sigma);
+		for (int i = 0; i < 6; i++)
+			temp(i) = sigma(i) - p*mI1(i);
+		q = sqrt(3.0/2.0)*VoigtTensor::normContr(temp);
 		qCalc = root23*q;
 
 		if (p != 0) {
@@ -412,7 +388,7 @@ void BoundingCamClay::plastic_integrator()
 
     	// set initial volumetric strain
     	if (!initializeState) {
-    		iepsE_vo = ikappa*log(mStressRatio) + GetTrace(mEpsilon);
+    		iepsE_vo = ikappa*log(mStressRatio) + (mEpsilon(0) + mEpsilon(1) + mEpsilon(2));
     		initializeState = true;
 			flagReversal = true;
     	}
@@ -428,18 +404,23 @@ void BoundingCamClay::plastic_integrator()
     		// check for numerical accuracy
         	n.Zero();
         } else {
-    		n = e/norm_e;
+    		for (int i = 0; i < 6; i++)
+    			n(i) = e(i)/norm_e;
     	}
     
     	// trial stress
-    	sigma = p*mI1 + root23*q*n;
+    	for (int i = 0; i < 6; i++)
+    		sigma(i) = p*mI1(i) + (root23*q)*n(i);
     	// trial backstress
-    	alpha = (kappa*SIGMAo - (1.0/iC)*mI1)/(1.0 + kappa)*R;
+    	for (int i = 0; i < 6; i++)
+    		alpha(i) = (kappa*SIGMAo(i) - (1.0/iC)*mI1(i))/(1.0 + kappa)*R;
     	// computational variable, stress difference
-    	xi = sigma - alpha;
+    	for (int i = 0; i < 6; i++)
+    		xi(i) = sigma(i) - alpha(i);
     
     	// trial yield function value
-    	f = DoubleDot2_2(DoubleDot2_4(xi, mM), xi) - r*r;
+    	VoigtTensor::dot(xi, mM, temp);
+    	f = VoigtTensor::dotMixed(temp, xi) - r*r;
     
     	// tolerance for checking trial yield function
     	double tolerance = -1.0e-7;
@@ -452,27 +433,35 @@ void BoundingCamClay::plastic_integrator()
         	// recenter ellipse if stress reversal
         	if (!flagReversal) {
                 //opserr << "re-centering -------------- " << endln;
-           	   	mSIGMAo = mSigma_n/mR_n;
+           	   	for (int i = 0; i < 6; i++)
+           	   		mSIGMAo(i) = mSigma_n(i)/mR_n;
         		flagReversal = true;
         	}
         		
         	// variables for kappa update
-        	Vector sigma_o(6); 
-        	Vector beta(6);
-        	Vector temp(6);
+        	VectorN<6> sigma_o;
+        	VectorN<6> beta;
+        	VectorN<6> dsigma_o;
+        	VectorN<6> dbeta;
         	double a, b, c;
         
         	// projection center
-        	sigma_o = R*mSIGMAo;
+        	for (int i = 0; i < 6; i++)
+        		sigma_o(i) = R*mSIGMAo(i);
         	// backstress on bounding function
-        	beta = -(R/iC)*mI1;
+        	for (int i = 0; i < 6; i++)
+        		beta(i) = -(R/iC)*mI1(i);
+        	for (int i = 0; i < 6; i++) {
+        		dsigma_o(i) = sigma(i) - sigma_o(i);
+        		dbeta(i) = sigma(i) - beta(i);
+        	}
         
         	// terms for quadratic eqn in kappa
-        	temp = DoubleDot2_4((sigma - sigma_o), mM);
-        	a = DoubleDot2_2(temp, (sigma - sigma_o));
-        	b = 2.0*(DoubleDot2_2(temp, (sigma - beta)));
-        	temp = DoubleDot2_4((sigma - beta), mM);
-        	c = (DoubleDot2_2(temp, (sigma - beta))) - R*R;
+        	VoigtTensor::dot(dsigma_o, mM, temp);
+        	a = VoigtTensor::dotMixed(temp, dsigma_o);
+        	b = 2.0*(VoigtTensor::dotMixed(temp, dbeta));
+        	VoigtTensor::dot(dbeta, mM, temp);
+        	c = (VoigtTensor::dotMixed(temp, dbeta)) - R*R;
         
     		// update kappa
         	kappa = (-b + sqrt((b*b - 4.0*a*c)))/(2.0*a);
@@ -490,9 +479,9 @@ void BoundingCamClay::plastic_integrator()
     		epsilonE = epsilonET;
     
     		// set elastic tangent tensor Ce
-    		mCe = GetElasticOperator(p, ev, es, n);
+    		GetElasticOperator(p, ev, es, n, mCe);
     		// consistent elastoplastic tangent = elastic tangent
-    		mCep = mCe;
+    		mCe.copyTo(mCep);
 
     	} else if (f > tolerance) {
 			//opserr << "update of loading function required " << f << endln;
@@ -500,9 +489,9 @@ void BoundingCamClay::plastic_integrator()
     		double Deps_vp, rho, eta, nu;
     		double denom;
     		double dgamma;
-    		Vector x(8);
-    		Vector dx(8);
-    		Vector Resid(8);
+    		VectorN<8> x;
+    		VectorN<8> dx;
+    		VectorN<8> Resid;
     			
     		// elastic strain = trial elastic strain
     		epsilonE = epsilonET;
@@ -510,7 +499,8 @@ void BoundingCamClay::plastic_integrator()
     		// set initial consistency parameter
     		dgamma = 0.0;
     		// compute df_dSigma (covariant)
-    		df_dSigma = 2.0*DoubleDot4_2(mM, xi);
+    		VoigtTensor::dot(mM, xi, df_dSigma);
+    		df_dSigma *= 2.0;
     		// initial change in plastic volumetric strain 
     		Deps_vp = 0.0;
     	
@@ -536,15 +526,18 @@ void BoundingCamClay::plastic_integrator()
     		double TOL = 1e-10;
     		int k = 0;
     	
-    		// computational terms for Jacobian of residual
-    		Matrix A(8,8);
-    		Matrix Ainv(8,8);
-    		Matrix Temp1(6,6);
-    		Vector Temp2(6);
-    		Matrix A11(6,6);
-    		Vector A12(6);
-    		Vector A21(6);
-    		Vector A31(6);
+    		// computational terms for Jacobian of residual, the inverse
+    		// is found by LAPACK through Matrix objects on their storage
+    		MatrixN<8,8> A;
+    		MatrixN<8,8> Ainv;
+    		Matrix theA(A.values, 8, 8);
+    		Matrix theAinv(Ainv.values, 8, 8);
+    		MatrixN<6,6> Temp1;
+    		VectorN<6> Temp2;
+    		MatrixN<6,6> MCe;
+    		MatrixN<6,6> MTemp1;
+    		VectorN<6> df_dSigmaCe;
+    		VectorN<6> df_dSigmaTemp1;
     		double A32;
     
     		// iterative newton loop
@@ -553,37 +546,44 @@ void BoundingCamClay::plastic_integrator()
     			k += 1;
     
     			// set elastic tangent
-    			mCe = GetElasticOperator(p, ev, es, n);
+    			GetElasticOperator(p, ev, es, n, mCe);
     
     			// Compute consistent Jacobian of the residuals [A]
-    			Temp1 = Dyadic2_2(alpha, mI1);
-    			Temp2 = SIGMAo + (1.0/iC)*mI1;
+    			VoigtTensor::dyadic(alpha, mI1, Temp1);
+    			for (int i = 0; i < 6; i++)
+    				Temp2(i) = SIGMAo(i) + (1.0/iC)*mI1(i);
     
-    			A11 = mIImix + 2.0*dgamma*(DoubleDot4_4(mM, mCe)) - 2.0*dgamma*rho/R*(DoubleDot4_4(mM, Temp1));
-    			A12 = -2.0*dgamma*R/((1.0 + kappa)*(1 + kappa))*(DoubleDot4_2(mM, Temp2));
-    			A21 = (rho - (1.0 + kappa)*eta)*mI1;
-    			A31 = DoubleDot2_4(df_dSigma, mCe) - rho/R*(DoubleDot2_4(df_dSigma, Temp1)) - 2.0*eta*r*mI1;
-    			A32 = 2.0*r*nu - r/(1.0 + kappa)*(DoubleDot2_2(df_dSigma, Temp2));
+    			VoigtTensor::dot(mM, mCe, MCe);
+    			VoigtTensor::dot(mM, Temp1, MTemp1);
+    			VoigtTensor::dot(mM, Temp2, temp);
+    			VoigtTensor::dot(df_dSigma, mCe, df_dSigmaCe);
+    			VoigtTensor::dot(df_dSigma, Temp1, df_dSigmaTemp1);
     
+    			double c11 = 2.0*dgamma;
+    			double c12 = 2.0*dgamma*rho/R;
+    			double c2 = -2.0*dgamma*R/((1.0 + kappa)*(1 + kappa));
+    			double c3 = rho/R;
+    			double c4 = 2.0*eta*r;
     			for (int i = 0; i < 6; i++) {
     				for (int j = 0; j < 6; j++) {
-    					A(i,j) = A11(i,j);      // A11
+    					A(i,j) = mIImix(i,j) + c11*MCe(i,j) - c12*MTemp1(i,j);  // A11
     				}
-    				A(i,6) = A12(i);            // A12
-    				A(i,7) = df_dSigma(i);      // A13
-    				A(6,i) = A21(i);            // A21
-    				A(7,i) = A31(i);            // A31
+    				A(i,6) = c2*temp(i);                                       // A12
+    				A(i,7) = df_dSigma(i);                                     // A13
+    				A(6,i) = (rho - (1.0 + kappa)*eta)*mI1(i);                 // A21
+    				A(7,i) = df_dSigmaCe(i) - c3*df_dSigmaTemp1(i) - c4*mI1(i);  // A31
     			}
+    			A32 = 2.0*r*nu - r/(1.0 + kappa)*(VoigtTensor::dotMixed(df_dSigma, Temp2));
     			A(6,6) = (1.0 + kappa)*nu - r;  // A22
     			A(6,7) = 0.0;                   // A23
     			A(7,6) = A32;                   // A32
     			A(7,7) = 0.0;                   // A33
     
     			// compute inverse of Jacobian of residuals
-    			A.Invert(Ainv);
+    			theA.Invert(theAinv);
     
     			// compute incremental change in vector of unknowns
-    			dx = Ainv*Resid;
+    			dx.addMatrixVector(0.0, Ainv, Resid, 1.0);
     			x -= dx;
     
     			// update unknown terms using new vector {x}
@@ -594,11 +594,11 @@ void BoundingCamClay::plastic_integrator()
     			dgamma = x(7);
     
     			// update volumetric strain invariant
-    			ev = GetTrace(epsilonE);
+    			ev = VoigtTensor::trace(epsilonE);
     			// update elastic deviatoric strain tensor (contravariant)
-    			e = mIIdevCon*epsilonE;
+    			VoigtTensor::dot(mIIdevCon, epsilonE, e);
     			// update norm of elastic deviatoric strain (contravariant-type norm)
-    			norm_e = GetContraNorm(e);
+    			norm_e = VoigtTensor::normContr(e);
     			// update second invariant of deviatoric strain tensor
     			es = root23*norm_e;
     
@@ -607,24 +607,28 @@ void BoundingCamClay::plastic_integrator()
     				// check for numerical accuracy
         			n.Zero();
         		} else {
-    				n = e/norm_e;
+    				for (int i = 0; i < 6; i++)
+    					n(i) = e(i)/norm_e;
     			}
     
     			// update stress invariants
     			p = (1.0 + (3.0/2.0)*ialpha/ikappa*es*es)*mp_o*exp((iepsE_vo - ev)/ikappa);
     			q = 3.0*(imu_o - ialpha*mp_o*exp((iepsE_vo - ev)/ikappa))*es;
     
-    			// update stress tensor
-    			sigma = p*mI1 + root23*q*n; 
-    			// update backstress
-    			alpha = (kappa*SIGMAo - (1.0/iC)*mI1)/(1.0 + kappa)*R;
-    			// update stress difference term
-    			xi = sigma - alpha;
+    			for (int i = 0; i < 6; i++) {
+    				// update stress tensor
+    				sigma(i) = p*mI1(i) + (root23*q)*n(i);
+    				// update backstress
+    				alpha(i) = (kappa*SIGMAo(i) - (1.0/iC)*mI1(i))/(1.0 + kappa)*R;
+    				// update stress difference term
+    				xi(i) = sigma(i) - alpha(i);
+    			}
     
     			// update df_dSigma
-    			df_dSigma = 2.0*DoubleDot4_2(mM, xi); 
+    			VoigtTensor::dot(mM, xi, df_dSigma);
+    			df_dSigma *= 2.0;
     			// compute change in plastic volumetric strain
-    			Deps_vp = GetTrace((epsilonET - epsilonE));
+    			Deps_vp = (epsilonET(0) - epsilonE(0)) + (epsilonET(1) - epsilonE(1)) + (epsilonET(2) - epsilonE(2));
     			
     			// update hardening response variables (r and R)
     			denom = 1.0 + mTHETA*Deps_vp;
@@ -637,7 +641,8 @@ void BoundingCamClay::plastic_integrator()
     			nu  = mTHETA*im*ih*pow(kappa, (im-1.0))*Deps_vp/denom;
     
     			// compute new yield function value
-    			f = DoubleDot2_2((DoubleDot2_4(xi, mM)), xi) - r*r;
+    			VoigtTensor::dot(xi, mM, temp);
+    			f = VoigtTensor::dotMixed(temp, xi) - r*r;
     
     			// update residual vector {b}
     			for (int i = 0; i<6; i++) {
@@ -652,20 +657,21 @@ void BoundingCamClay::plastic_integrator()
     		}
     
     		// update plastic strain
-    		mEpsilon_P = mEpsilon - epsilonE;
+    		for (int i = 0; i < 6; i++)
+    			mEpsilon_P(i) = mEpsilon(i) - epsilonE(i);
 			//opserr << "updating plastic strain " << endln;
 			//opserr << "mEpsilon " << mEpsilon << endln;
 			//opserr << "epsilonE " << epsilonE << endln;
     
     		// compute elastic compliance tensor
-    		Matrix De(6,6);
-    		De = GetComplianceOperator(p, ev, es, epsilonE);
+    		MatrixN<6,6> De;
+    		GetComplianceOperator(p, ev, es, epsilonE, De);
     		// compute elastoplastic tangent operator
-    		mCep = GetCep(kappa, r, R, dgamma, rho, eta, nu, SIGMAo, xi, df_dSigma, De);
+    		GetCep(kappa, r, R, dgamma, rho, eta, nu, SIGMAo, xi, df_dSigma, De, mCep);
     
     		// update remaining variables
     		flagReversal = false;
-    		mSIGMAo = SIGMAo;
+    		SIGMAo.copyTo(mSIGMAo);
     	}
 	}
 	
@@ -673,14 +679,15 @@ void BoundingCamClay::plastic_integrator()
 	mr = r;
 	mR = R;
 	mKappa = kappa;
-    mSigma = sigma;
+    sigma.copyTo(mSigma);
 
 	// update recorder variables
-	double evp = GetTrace(mEpsilon_P);
-	Vector esp(6);
-	esp = mIIdevMix*mEpsilon_P;
-	double norm_ep = GetCovariantNorm(mEpsilon_P);
-	double norm_dev_ep = GetCovariantNorm(esp);
+	VectorN<6> ep(mEpsilon_P);
+	VectorN<6> esp;
+	double evp = VoigtTensor::trace(ep);
+	VoigtTensor::dot(mIIdevMix, ep, esp);
+	double norm_ep = VoigtTensor::normCov(ep);
+	double norm_dev_ep = VoigtTensor::normCov(esp);
 
 	mState(0) = p;
 	mState(1) = q;
@@ -693,12 +700,10 @@ void BoundingCamClay::plastic_integrator()
 	return;
 }
 
-Matrix
-BoundingCamClay::GetElasticOperator(double p, double ev, double es, Vector n) 
-// returns the elastic tangent operator
+void
+BoundingCamClay::GetElasticOperator(double p, double ev, double es, const VectorN<6> &n, MatrixN<6,6> &Ce)
+// sets Ce to the elastic tangent operator
 {
-	Matrix Ce(6,6);
-	Matrix temp(6,6);
 	double Omega;
 	double De11, De22, De12;
 
@@ -712,24 +717,24 @@ BoundingCamClay::GetElasticOperator(double p, double ev, double es, Vector n)
 	De22 = 3.0*(imu_o - ialpha*mp_o*exp(Omega));
 	De12 = 3.0*mp_o*ialpha*es*exp(Omega)/ikappa;
 
-	temp = Dyadic2_2(mI1,n) + Dyadic2_2(n,mI1);
-
 	// elastic tangent operator (contravariant)
-	Ce = two3*De22*mIIcon + (De11 - (2.0/9.0)*De22)*mIIvol + root23*De12*temp;
+	double a = two3*De22;
+	double b = De11 - (2.0/9.0)*De22;
+	double c = root23*De12;
+	for (int j = 0; j < 6; j++) {
+		for (int i = 0; i < 6; i++)
+			Ce(i,j) = a*mIIcon(i,j) + b*mIIvol(i,j) + c*(mI1(i)*n(j) + n(i)*mI1(j));
+	}
 
 	//opserr << "elastic tangent " << Ce << endln;
-
-	return Ce;
 }
 
-Matrix
-BoundingCamClay::GetComplianceOperator(double p, double ev, double es, Vector strain)
-// returns the tangential elastic compliance tensor, inv(Ce)
+void
+BoundingCamClay::GetComplianceOperator(double p, double ev, double es, const VectorN<6> &strain, MatrixN<6,6> &D)
+// sets D to the tangential elastic compliance tensor, inv(Ce)
 {
-	Vector e(6);
-	Vector n(6);
-	Matrix D(6,6);
-	Matrix temp(6,6);
+	VectorN<6> e;
+	VectorN<6> n;
 	double norm_e;
 	double Omega;
 	double De11, De12, De22, det;
@@ -756,40 +761,42 @@ BoundingCamClay::GetComplianceOperator(double p, double ev, double es, Vector st
 	Ee12 = -De12/det;
 
 	// compute covariant deviatoric normal
-	e = mIIdevMix*strain;
-	norm_e = GetCovariantNorm(e);
+	VoigtTensor::dot(mIIdevMix, strain, e);
+	norm_e = VoigtTensor::normCov(e);
 	if (norm_e < 1.0e-13) { 
 		// check for numerical accuracy
     	n.Zero();
     } else {
-		n = e/norm_e;
+		for (int i = 0; i < 6; i++)
+			n(i) = e(i)/norm_e;
 	}
 
-	temp = Dyadic2_2(mI1,n) + Dyadic2_2(n,mI1);
-
 	// elastic compliance operator (covariant)
-	D = 1.5*D22inv*mIIco + (Ee11/9.0 - 0.5*D22inv)*mIIvol + Ee12/(sqrt(6.0))*temp 
-	    + 1.5*(Ee22 - D22inv)*Dyadic2_2(n,n);
+	double a = 1.5*D22inv;
+	double b = Ee11/9.0 - 0.5*D22inv;
+	double c = Ee12/(sqrt(6.0));
+	double d = 1.5*(Ee22 - D22inv);
+	for (int j = 0; j < 6; j++) {
+		for (int i = 0; i < 6; i++)
+			D(i,j) = a*mIIco(i,j) + b*mIIvol(i,j) + c*(mI1(i)*n(j) + n(i)*mI1(j)) + d*(n(i)*n(j));
+	}
 
 	//opserr << "elastic compliance " << D << endln;
-
-	return D;
 }
 
-Matrix 
+void
 BoundingCamClay::GetCep(double kappa, double r, double R, double dgamma, double rho, double eta,
-                        double nu, Vector SIGMAo, Vector xi, Vector df_dSigma, Matrix De)
-// returns the consistent elastoplastic tangent operator (contravariant)
+                        double nu, const VectorN<6> &SIGMAo, const VectorN<6> &xi,
+                        const VectorN<6> &df_dSigma, const MatrixN<6,6> &De, Matrix &Cep)
+// sets Cep to the consistent elastoplastic tangent operator (contravariant)
 {
-	Vector alpha_R(6);
-	Vector alpha_k(6);
-	Vector phiAlpha_R(6);
-	Vector phiAlpha_k(6);
-	Matrix Q(4,4);
-	Matrix Qinv(4,4);
-	Matrix D(6,6);
-	Matrix Cinv(6,6);
-	Matrix Cep(6,6);
+	VectorN<6> alpha_R;
+	VectorN<6> alpha_k;
+	VectorN<6> phiAlpha_R;
+	VectorN<6> phiAlpha_k;
+	MatrixN<4,4> Q;
+	MatrixN<4,4> Qinv;
+	MatrixN<6,6> Cinv;
 	double temp;
 	double I1phiAlpha_R;
 	double I1phiAlpha_k;
@@ -797,217 +804,79 @@ BoundingCamClay::GetCep(double kappa, double r, double R, double dgamma, double
 	temp = 1.0/(1.0 + kappa);
 	
 	// derivatives of backstress wrt R and kappa
-	alpha_R = temp*(kappa*SIGMAo - (1.0/iC)*mI1);
-	alpha_k = temp*temp*R*(SIGMAo + (1.0/iC)*mI1);
+	for (int i = 0; i < 6; i++) {
+		alpha_R(i) = temp*(kappa*SIGMAo(i) - (1.0/iC)*mI1(i));
+		alpha_k(i) = temp*temp*R*(SIGMAo(i) + (1.0/iC)*mI1(i));
+	}
 
 	// intermediate computational variables for tensor U
-	phiAlpha_R = 2.0*DoubleDot4_2(mM, alpha_R);
-	phiAlpha_k = 2.0*DoubleDot4_2(mM, alpha_k);
+	VoigtTensor::dot(mM, alpha_R, phiAlpha_R);
+	phiAlpha_R *= 2.0;
+	VoigtTensor::dot(mM, alpha_k, phiAlpha_k);
+	phiAlpha_k *= 2.0;
 
 	// intermediate computational variables for matrix [Q]
-	I1phiAlpha_R = DoubleDot2_2(mI1, phiAlpha_R);
-	I1phiAlpha_k = DoubleDot2_2(mI1, phiAlpha_k);
+	I1phiAlpha_R = VoigtTensor::dotMixed(mI1, phiAlpha_R);
+	I1phiAlpha_k = VoigtTensor::dotMixed(mI1, phiAlpha_k);
 
 	// set non-singular array [Q]
 	Q.Zero();
 	// first row
 	Q(0,0) = 1.0 - dgamma*rho*I1phiAlpha_R;
 	Q(0,2) = -(dgamma*rho*I1phiAlpha_k);
-	Q(0,3) = rho*GetTrace(df_dSigma);
+	Q(0,3) = rho*VoigtTensor::trace(df_dSigma);
 	// second row
 	Q(1,0) = -(dgamma*eta*I1phiAlpha_R);
 	Q(1,1) = 1.0;
 	Q(1,2) = nu - dgamma*eta*I1phiAlpha_k;
-	Q(1,3) = eta*GetTrace(df_dSigma);
+	Q(1,3) = eta*VoigtTensor::trace(df_dSigma);
 	// third row
 	Q(2,0) = 1.0;
 	Q(2,1) = -1.0 - kappa;
 	Q(2,2) = -r;
 	// fourth row
-	Q(3,0) = -1.0*DoubleDot2_2(df_dSigma, alpha_R);
+	Q(3,0) = -1.0*VoigtTensor::dotMixed(df_dSigma, alpha_R);
 	Q(3,1) = -2.0*r;
-	Q(3,2) = -1.0*DoubleDot2_2(df_dSigma, alpha_k);
+	Q(3,2) = -1.0*VoigtTensor::dotMixed(df_dSigma, alpha_k);
 
 	// invert array Q
-	Q.Invert(Qinv);
+	Matrix theQ(Q.values, 4, 4);
+	Matrix theQinv(Qinv.values, 4, 4);
+	theQ.Invert(theQinv);
 	
 	// computational tensors L and U
-    Vector L1(6);
-	Vector L2(6);
-	Vector L3(6);
-	Vector L4(6);
-	Vector U1(6);
-	Vector U2(6);
-	Vector U3(6);
-	Vector U4(6);
-
-	L1 = 2.0*dgamma*rho*DoubleDot2_4(mI1, mM);
-	L2 = 2.0*dgamma*eta*DoubleDot2_4(mI1, mM);
-	L3.Zero();
-	L4 = df_dSigma;
-
-	U1 = -dgamma*phiAlpha_R;
-	U2.Zero();
-	U3 = -dgamma*phiAlpha_k;
-	U4 = df_dSigma;
+	VectorN<6> L[4];
+	VectorN<6> U[4];
+	VectorN<6> I1M;
+
+	VoigtTensor::dot(mI1, mM, I1M);
+	for (int i = 0; i < 6; i++) {
+		L[0](i) = 2.0*dgamma*rho*I1M(i);
+		L[1](i) = 2.0*dgamma*eta*I1M(i);
+		L[3](i) = df_dSigma(i);
+
+		U[0](i) = -dgamma*phiAlpha_R(i);
+		U[2](i) = -dgamma*phiAlpha_k(i);
+		U[3](i) = df_dSigma(i);
+	}
 
 	// compute inverse of Cep
-	Cinv = De + 2.0*dgamma*mM 
-		    - Qinv(0,0)*Dyadic2_2(U1,L1)
-			- Qinv(0,1)*Dyadic2_2(U1,L2)
-			- Qinv(0,2)*Dyadic2_2(U1,L3)
-			- Qinv(0,3)*Dyadic2_2(U1,L4)
-			- Qinv(1,0)*Dyadic2_2(U2,L1)
-			- Qinv(1,1)*Dyadic2_2(U2,L2)
-			- Qinv(1,2)*Dyadic2_2(U2,L3)
-			- Qinv(1,3)*Dyadic2_2(U2,L4)
-			- Qinv(2,0)*Dyadic2_2(U3,L1)
-			- Qinv(2,1)*Dyadic2_2(U3,L2)
-			- Qinv(2,2)*Dyadic2_2(U3,L3)
-			- Qinv(2,3)*Dyadic2_2(U3,L4)
-			- Qinv(3,0)*Dyadic2_2(U4,L1)
-			- Qinv(3,1)*Dyadic2_2(U4,L2)
-			- Qinv(3,2)*Dyadic2_2(U4,L3)
-			- Qinv(3,3)*Dyadic2_2(U4,L4);
+	for (int j = 0; j < 6; j++) {
+		for (int i = 0; i < 6; i++) {
+			double Cij = De(i,j) + 2.0*dgamma*mM(i,j);
+			for (int a = 0; a < 4; a++)
+				for (int b = 0; b < 4; b++)
+					Cij -= Qinv(a,b)*(U[a](i)*L[b](j));
+			Cinv(i,j) = Cij;
+		}
+	}
 
 	// invert to get Cep
-	Cinv.Invert(Cep);
+	Matrix theCinv(Cinv.values, 6, 6);
+	theCinv.Invert(Cep);
 
 	//opserr << "Cinv " << Cinv << endln;
 	//opserr << "Cep " << Cep << endln;
-
-	return Cep;
-}
-
-double
-BoundingCamClay::GetContraNorm(Vector v)
-// computes contravariant (stress-type) norm of input 6x1 tensor
-{
-	double result = 0.0;
-	
-	for (int i = 0; i < 3; i++) {
-		result += v(i)*v(i);
-	}
-	for (int i = 3; i < 6; i++) {
-		result += 2.0*v(i)*v(i);
-	}
-
-    return sqrt(result);
-}
-		
-double
-BoundingCamClay::GetCovariantNorm(Vector v) 
-// computes the norm of the input argument (for strain-type storage)
-{
-	if (v.Size() != 6) {
-		opserr << "ERROR! BoundingCamClay::NormEngStrain requires vector of size(6)!" << endln;
-	}
-    double result = 0.0;
-
-	for (int i = 0; i < 3; i++) {
-		result += v(i)*v(i);
-	}
-	for (int i = 3; i < 6; i++) {
-		result += 0.5*v(i)*v(i);
-	}
-
-    return sqrt(result);
-}
-
-double
-BoundingCamClay::GetTrace(Vector v) 
-// computes the trace of the input argument
-{
-	if (v.Size() != 6)
-		opserr << "ERROR! BoundingCamClay::GetTrace requires vector of size(6)!" << endln;
-
-	return (v(0) + v(1) + v(2));
-}
-
-double
-BoundingCamClay::DoubleDot2_2(Vector v1, Vector v2)
-// computes doubledot product for vector-vector arguments
-{
-	double result = 0.0;
-	
-	if (v1.Size() != v2.Size()) {
-		opserr << "ERROR! BoundingCamClay::DoubleDot2_2 function requires vectors of equal size!" << endln;
-	}
-
-	for (int i = 0; i < v1.Size(); i++) {
-		result += v1(i) * v2(i);
-	}
-
-	return result;
-}
-
-Vector
-BoundingCamClay::DoubleDot2_4(Vector v1, Matrix m1)
-// computes doubledot product for vector-matrix arguments
-{
-	Vector result(6);
-	result.Zero();
-
-	if (v1.Size() != m1.noRows()) {
-		opserr << "ERROR! BoundingCamClay::DoubleDot2_4 function requires Size(v1) = noRows(m1) " << endln;
-	}
-
-	for (int i = 0; i < m1.noRows(); i++) {
-		for (int j = 0; j < m1.noCols(); j++) 
-			result(j) += v1(i) * m1(i,j);
-	}
-
-	return result;
-}
-
-Vector
-BoundingCamClay::DoubleDot4_2(Matrix m1, Vector v1)
-// computes doubledot product for matrix-vector arguments
-{
-	Vector result(6);
-	result.Zero();
-
-	if (m1.noCols() != v1.Size()) {
-		opserr << "ERROR! BoundingCamClay::DoubleDot4_2 function requires noCols(m1) = Size(v1) " << endln;
-	}
-
-	for (int i = 0; i < m1.noRows(); i++) {
-		for (int j = 0; j < m1.noCols(); j++) 
-			result(i) += m1(i,j) * v1(j);
-	}
-
-	return result;
-}
-
-Matrix
-BoundingCamClay::DoubleDot4_4(Matrix m1, Matrix m2)
-// computes doubledot product for matrix-matrix arguments
-{
-	Matrix result(6,6);
-	result.Zero();
-
-	for (int i = 0; i < m1.noRows(); i ++) {
-		for (int j = 0; j < m2.noCols(); j++) {
-			for (int k = 0; k<m1.noRows(); k++) 
-				result(i,j) += m1(i,k) * m2(k,j);
-		}
-	}
-	return result;
-}
-
-Matrix 
-BoundingCamClay::Dyadic2_2(Vector v1, Vector v2)
-// computes dyadic product for two vector-storage arguments
-{
-	Matrix result(6,6);
-	result.Zero();
-
-	for (int i = 0; i < v1.Size(); i++) {
-		for (int j = 0; j < v2.Size(); j++) 
-			result(i,j) = v1(i) * v2(j);
-	}
-	
-	return result;
 }
 
 Vector
@@ -36,6 +36,7 @@
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
 
 class BoundingCamClay : public NDMaterial
 {
@@ -112,39 +113,30 @@ class BoundingCamClay : public NDMaterial
 	static double mElastFlag;
 	bool initializeState;
 
-	Matrix mCe;				// elastic tangent stiffness matrix
+	MatrixN<6,6> mCe;		// elastic tangent stiffness matrix
 	Matrix mCep;			// elastoplastic tangent stiffness matrix
-	Vector mI1;				// 2nd Order Identity Tensor
-	Matrix mIIco;			// 4th-order identity tensor, covariant
-	Matrix mIIcon;			// 4th-order identity tensor, contravariant
-	Matrix mIImix;          // 4th-order identity tensor, mixed variant
-	Matrix mIIvol;			// 4th-order volumetric tensor, IIvol = I1 tensor I1 
-	Matrix mIIdevCon;       // 4th order deviatoric tensor, contravariant
-	Matrix mIIdevMix;       // 4th order deviatoric tensor, mixed variant
-	Matrix mM;              // 4th Order yield function tensor, covariant
+	VectorN<6> mI1;			// 2nd Order Identity Tensor
+	MatrixN<6,6> mIIco;		// 4th-order identity tensor, covariant
+	MatrixN<6,6> mIIcon;	// 4th-order identity tensor, contravariant
+	MatrixN<6,6> mIImix;    // 4th-order identity tensor, mixed variant
+	MatrixN<6,6> mIIvol;	// 4th-order volumetric tensor, IIvol = I1 tensor I1 
+	MatrixN<6,6> mIIdevCon; // 4th order deviatoric tensor, contravariant
+	MatrixN<6,6> mIIdevMix; // 4th order deviatoric tensor, mixed variant
+	MatrixN<6,6> mM;        // 4th Order yield function tensor, covariant
 	Vector mState;          // vector of state param for recorders
 	  
 
 	// member functions
 	void initialize();
 	void plastic_integrator();
-	Matrix GetElasticOperator(double p, double ev, double es, Vector n);
-	Matrix GetCep(double kappa, double r, double R, double dgamma, double rho, double eta,
-                        double nu, Vector SIGMAo, Vector xi, Vector df_dSigma, Matrix Dep);
-	Matrix GetComplianceOperator(double p, double ev, double es, Vector n);
-	double GetContraNorm(Vector v);
-	double GetCovariantNorm(Vector v); 
-	double GetTrace(Vector v);
+	void GetElasticOperator(double p, double ev, double es, const VectorN<6> &n, MatrixN<6,6> &Ce);
+	void GetCep(double kappa, double r, double R, double dgamma, double rho, double eta,
+                        double nu, const VectorN<6> &SIGMAo, const VectorN<6> &xi,
+                        const VectorN<6> &df_dSigma, const MatrixN<6,6> &De, Matrix &Cep);
+	void GetComplianceOperator(double p, double ev, double es, const VectorN<6> &strain, MatrixN<6,6> &D);
 	Vector GetState(); 
 	Vector GetCenter();
 
-	// tensor functions
-	double DoubleDot2_2(Vector v1, Vector v2);       // doubledot product vector-vector
-	Vector DoubleDot2_4(Vector v1, Matrix m1);       // doubledot product vector-matrix
-	Vector DoubleDot4_2(Matrix m1, Vector v2);       // doubledot product matrix-vector
-	Matrix DoubleDot4_4(Matrix m1, Matrix m2);       // doubledot product matrix-matrix
-	Matrix Dyadic2_2(Vector v1, Vector v2);          // dyadic product vector-vector
-
 	// constant computation parameters
 	static const double one3 ;
 	static const double two3 ;
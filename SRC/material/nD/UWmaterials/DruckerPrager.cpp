@@ -39,6 +39,7 @@
 #include <DruckerPragerPlaneStrain.h>
 
 #include <Information.h>
+#include <MatrixN.h>
 #include <MaterialResponse.h>
 #include <Parameter.h>
 
@@ -350,11 +351,12 @@ void DruckerPrager:: plastic_integrator( )
 		double Invariant_ep;
 		double norm_ep;
 		double norm_dev_ep;
-		Vector epsilon_e(6);
-		Vector s(6);
-		Vector eta(6);
-		Vector dev_ep(6);
-		Vector Jact(2);
+		VectorN<6> epsilon_e;
+		VectorN<6> s;
+		VectorN<6> eta;
+		VectorN<6> dev_ep;
+		double JactData[2];
+		Vector Jact(JactData, 2);
 
 		double fTOL;
 		double gTOL;
@@ -365,12 +367,15 @@ void DruckerPrager:: plastic_integrator( )
 
 		double alpha1;			// hardening parameter for DP surface
 		double alpha2;			// hardening parameter for tension cut-off
-		Vector n(6);			// normal to the yield surface in strain space
-		Vector R(2);			// residual vector
-		Vector gamma(2);		// vector of consistency parameters
-		Vector dgamma(2);		// incremental vector of consistency parameters
-		Matrix g(2,2);			// jacobian of the corner region (return map)
-		Matrix g_contra(2,2);	// inverse of jacobian of the corner region
+		VectorN<6> n;			// normal to the yield surface in strain space
+		VectorN<2> R;			// residual vector
+		VectorN<2> gamma;		// vector of consistency parameters
+		VectorN<2> dgamma;		// incremental vector of consistency parameters
+		double gData[4];
+		double g_contraData[4];
+		Matrix g(gData, 2, 2);			// jacobian of the corner region (return map)
+		Matrix g_contra(g_contraData, 2, 2);	// inverse of jacobian of the corner region
+		g_contra.Zero();
 
         // set trial state:
 
@@ -386,20 +391,26 @@ void DruckerPrager:: plastic_integrator( )
         mBeta_n1 = mBeta_n;
 
         // epsilon_elastic = epsilon_n+1 - epsilon_n_p
-		epsilon_e = mEpsilon - mEpsilon_n1_p;
+		for (int i = 0; i < 6; i++)
+			epsilon_e(i) = mEpsilon(i) - mEpsilon_n1_p(i);
 
         // trial stress
-		mSigma = mCe*epsilon_e;
+		mSigma.Zero();
+		for (int j = 0; j < 6; j++)
+			for (int i = 0; i < 6; i++)
+				mSigma(i) += mCe(i,j)*epsilon_e(j);
 
         // deviator stress tensor: s = 2G * IIdev * epsilon_e
         //I1_trial
 		Invariant_1 = ( mSigma(0) + mSigma(1) + mSigma(2) );
 
         // s_n+1_trial
-		s = mSigma - (Invariant_1/3.0)*mI1;
+		for (int i = 0; i < 6; i++)
+			s(i) = mSigma(i) - (Invariant_1/3.0)*mI1(i);
 
         //eta_trial = s_n+1_trial - beta_n;
-		eta = s - mBeta_n;
+		for (int i = 0; i < 6; i++)
+			eta(i) = s(i) - mBeta_n(i);
 		
 		// compute yield function value (contravariant norm)
         norm_eta = sqrt(eta(0)*eta(0) + eta(1)*eta(1) + eta(2)*eta(2) + 2*(eta(3)*eta(3) + eta(4)*eta(4) + eta(5)*eta(5)));
@@ -428,7 +439,8 @@ void DruckerPrager:: plastic_integrator( )
 			norm_ep  = sqrt(mEpsilon_n1_p(0)*mEpsilon_n1_p(0) + mEpsilon_n1_p(1)*mEpsilon_n1_p(1) + mEpsilon_n1_p(2)*mEpsilon_n1_p(2)
                            + 0.5*(mEpsilon_n1_p(3)*mEpsilon_n1_p(3) + mEpsilon_n1_p(4)*mEpsilon_n1_p(4) + mEpsilon_n1_p(5)*mEpsilon_n1_p(5)));
 			
-			dev_ep = mEpsilon_n1_p - one3*Invariant_ep*mI1;
+			for (int i = 0; i < 6; i++)
+				dev_ep(i) = mEpsilon_n1_p(i) - (one3*Invariant_ep)*mI1(i);
 
             norm_dev_ep  = sqrt(dev_ep(0)*dev_ep(0) + dev_ep(1)*dev_ep(1) + dev_ep(2)*dev_ep(2)
                            + 0.5*(dev_ep(3)*dev_ep(3) + dev_ep(4)*dev_ep(4) + dev_ep(5)*dev_ep(5)));
@@ -472,7 +484,8 @@ void DruckerPrager:: plastic_integrator( )
 			if (norm_eta < 1.0e-13) {
 				n.Zero();
 			} else {
-				n = eta/norm_eta;
+				for (int i = 0; i < 6; i++)
+					n(i) = eta(i)/norm_eta;
 			}
 			
 			// initialize R, gamma1, gamma2, dgamma1, dgamma2 = 0
@@ -509,7 +522,11 @@ void DruckerPrager:: plastic_integrator( )
 			//iterate
 			while ((fabs(R.Norm()) > 1e-10) && (m < 10)) {
 
-				dgamma = -1*g_contra * R;
+				// dgamma = -g_contra * R
+				dgamma.Zero();
+				for (int j = 0; j < 2; j++)
+					for (int i = 0; i < 2; i++)
+						dgamma(i) += -g_contra(i,j)*R(j);
 				gamma += dgamma;
 
 				//update alpha1 and alpha2
@@ -599,11 +616,11 @@ void DruckerPrager:: plastic_integrator( )
 
 		//update everything and exit!
 
-		Vector b1(6);
-		Vector b2(6);
-		Vector n_covar(6);
-		Vector temp1(6);
-		Vector temp2(6);
+		VectorN<6> b1;
+		VectorN<6> b2;
+		VectorN<6> n_covar;
+		VectorN<6> temp1;
+		VectorN<6> temp2;
 
 		// update alpha1 and alpha2
 		mAlpha1_n1 = alpha1;
@@ -618,7 +635,8 @@ void DruckerPrager:: plastic_integrator( )
 		n_covar(3) = 2*n(3);
 		n_covar(4) = 2*n(4);
 		n_covar(5) = 2*n(5);
-		mEpsilon_n1_p = mEpsilon_n_p + (mrho_bar*gamma(0) + gamma(1))*mI1 + gamma(0)*n_covar;
+		for (int i = 0; i < 6; i++)
+			mEpsilon_n1_p(i) = mEpsilon_n_p(i) + (mrho_bar*gamma(0) + gamma(1))*mI1(i) + gamma(0)*n_covar(i);
 
            
         Invariant_ep = 	mEpsilon_n1_p(0)+mEpsilon_n1_p(1)+mEpsilon_n1_p(2);
@@ -626,40 +644,47 @@ void DruckerPrager:: plastic_integrator( )
 		norm_ep  = sqrt(mEpsilon_n1_p(0)*mEpsilon_n1_p(0) + mEpsilon_n1_p(1)*mEpsilon_n1_p(1) + mEpsilon_n1_p(2)*mEpsilon_n1_p(2)
                            + 0.5*(mEpsilon_n1_p(3)*mEpsilon_n1_p(3) + mEpsilon_n1_p(4)*mEpsilon_n1_p(4) + mEpsilon_n1_p(5)*mEpsilon_n1_p(5)));
 			
-		dev_ep = mEpsilon_n1_p - one3*Invariant_ep*mI1;
+		for (int i = 0; i < 6; i++)
+			dev_ep(i) = mEpsilon_n1_p(i) - (one3*Invariant_ep)*mI1(i);
 
         norm_dev_ep  = sqrt(dev_ep(0)*dev_ep(0) + dev_ep(1)*dev_ep(1) + dev_ep(2)*dev_ep(2)
                      + 0.5*(dev_ep(3)*dev_ep(3) + dev_ep(4)*dev_ep(4) + dev_ep(5)*dev_ep(5)));
 
 		// update sigma
-		mSigma -= (3*mK*mrho_bar*gamma(0) + 3*mK*gamma(1))*mI1 + 2*mG*gamma(0)*n;
+		for (int i = 0; i < 6; i++)
+			mSigma(i) -= (3*mK*mrho_bar*gamma(0) + 3*mK*gamma(1))*mI1(i) + (2*mG*gamma(0))*n(i);
 
-		s            -= 2*mG*gamma(0) * n;
+		for (int i = 0; i < 6; i++)
+			s(i) -= (2*mG*gamma(0))*n(i);
 		Invariant_1  -= 9*mK*mrho_bar*gamma(0) + 9*mK*gamma(1);
 		//mSigma        = s + Invariant_1/3.0 * mI1;
 
 		//update beta_n1
-		mBeta_n1 = mBeta_n - (two3*mHprime*gamma(0))*n;
+		for (int i = 0; i < 6; i++)
+			mBeta_n1(i) = mBeta_n(i) - (two3*mHprime*gamma(0))*n(i);
 
 		//eta_n+1 = s_n+1 - beta_n+1;
-		eta = s - mBeta_n1;
+		for (int i = 0; i < 6; i++)
+			eta(i) = s(i) - mBeta_n1(i);
         norm_eta = sqrt(eta(0)*eta(0) + eta(1)*eta(1) + eta(2)*eta(2) + 2*(eta(3)*eta(3) + eta(4)*eta(4) + eta(5)*eta(5)));
 			
 		// update Cep
 		// note: Cep is contravariant
-		if ((Jact(0) == 1) && (Jact(1) == 0)) {
-			b1 = 2*mG*n + 3*mK*mrho*mI1;
-			b2.Zero();
-		} else if ((Jact(0) == 0) && (Jact(1) == 1)){
-			b1.Zero();
-			b2 = 3*mK*mI1;
-		} else if ((Jact(0) == 1) && (Jact(1) == 1)){
-			b1 = 2*mG*n + 3*mK*mrho*mI1;
-			b2 = 3*mK*mI1;
-		}
+		for (int i = 0; i < 6; i++) {
+			if ((Jact(0) == 1) && (Jact(1) == 0)) {
+				b1(i) = (2*mG)*n(i) + (3*mK*mrho)*mI1(i);
+				b2(i) = 0.0;
+			} else if ((Jact(0) == 0) && (Jact(1) == 1)){
+				b1(i) = 0.0;
+				b2(i) = (3*mK)*mI1(i);
+			} else if ((Jact(0) == 1) && (Jact(1) == 1)){
+				b1(i) = (2*mG)*n(i) + (3*mK*mrho)*mI1(i);
+				b2(i) = (3*mK)*mI1(i);
+			}
 
-		temp1 = g_contra(0,0)*b1 + g_contra(0,1)*b2;  
-		temp2 = mrho_bar*temp1 + g_contra(1,0)*b1 + g_contra(1,1)*b2;
+			temp1(i) = g_contra(0,0)*b1(i) + g_contra(0,1)*b2(i);
+			temp2(i) = mrho_bar*temp1(i) + g_contra(1,0)*b1(i) + g_contra(1,1)*b2(i);
+		}
 
 		NormCep = 0.0;
 		for (int i = 0; i < 6; i++){
@@ -673,7 +698,8 @@ void DruckerPrager:: plastic_integrator( )
 		}
 
 		if ( NormCep < 1e-10){
-			mCep = 1.0e-3 * mCe;
+			mCep = mCe;
+			mCep *= 1.0e-3;
 			opserr << "NormCep = " << NormCep << endln;
 		}
 
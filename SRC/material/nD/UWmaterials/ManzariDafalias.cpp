@@ -26,6 +26,7 @@
 #include <ManzariDafalias.h>
 #include <ManzariDafalias3D.h>
 #include <ManzariDafaliasPlaneStrain.h>
+#include <VoigtTensor.h>
 #include <MaterialResponse.h>
 
 #include <string.h>
@@ -2185,7 +2186,7 @@ ManzariDafalias::NewtonIter2(const Vector& xo, const Vector& inVar, Vector& sol,
 		opserr << "ManzariDafalias (Tag: " << this->getTag() << ") Newton Iterations:" << endln;
 
 	for (mIter = 1; mIter <= MaxIter; mIter++) {
-		res			= NewtonRes(sol, inVar);
+		NewtonRes(sol, inVar, res);
 		errFlag		= NewtonSol(sol, inVar, del, aCepPart);
 		if (errFlag < 0)
 			return errFlag;
@@ -2252,67 +2253,65 @@ ManzariDafalias::NewtonIter2(const Vector& xo, const Vector& inVar, Vector& sol,
 /*************************************************************/
 //            GetResidual                                    //
 /*************************************************************/
-Vector
-ManzariDafalias::NewtonRes(const Vector& x, const Vector& inVar)
+void
+ManzariDafalias::NewtonRes(const Vector& x, const Vector& inVar, Vector& res)
 {
-	Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-	Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-	Vector fabric(6), curFabric(6);
-	double dGamma, curVoidRatio, voidRatio;
+	VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+	VectorN<6> stress, alpha, curStress, curAlpha, alpha_in, dStress;
+	VectorN<6> fabric, curFabric;
+	double dGamma, voidRatio;
 	// state dependent variables
-	Matrix aD(6,6);
-	Vector n(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
-	double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D, p;
-		
-	// residuals
-	Vector R1(6); Vector R2(6); Vector R3(6); double R4;
+	MatrixN<6,6> aD, dGammaIIco;
+	VectorN<6> n, d, b, R, dGammaR, aBar, zBar; 
+	double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D;
 	
 	// read the trial values
-	stress.Extract(x, 0, 1.0);
-	alpha.Extract(x, 6, 1.0);
-	fabric.Extract(x, 12, 1.0);
+	for (int i = 0; i < 6; i++) {
+		stress(i) = x(i);
+		alpha(i)  = x(6+i);
+		fabric(i) = x(12+i);
+	}
 	dGamma = x(18);
 
 	// current iteration invariants
-	strain.Extract(inVar, 0, 1.0);
-	curStrain.Extract(inVar, 6, 1.0);
-	curStress.Extract(inVar, 12, 1.0);
-	curEStrain.Extract(inVar, 18, 1.0);
-	curAlpha.Extract(inVar, 24, 1.0);
-	curFabric.Extract(inVar, 30, 1.0);
-	curVoidRatio = inVar(36);
+	for (int i = 0; i < 6; i++) {
+		strain(i)     = inVar(i);
+		curStrain(i)  = inVar(6+i);
+		curStress(i)  = inVar(12+i);
+		curEStrain(i) = inVar(18+i);
+		curAlpha(i)   = inVar(24+i);
+		curFabric(i)  = inVar(30+i);
+		alpha_in(i)   = inVar(38+i);
+	}
 	voidRatio = inVar(37);
-	alpha_in.Extract(inVar,38,1.0);
 
-	// elastic trial strain
-	TrialElasticStrain = curEStrain + (strain - curStrain);
-	aD = GetCompliance(mK, mG);
+	GetCompliance(mK, mG, aD);
 
 	GetStateDependent(stress, alpha, fabric, voidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
 					b0, A, D, B, C, R);
 
-	devStress = GetDevPart(stress);
-	p = one3 * GetTrace(stress);
-	p = p < m_Pmin ? m_Pmin : p;
-	aBar = two3 * h * b;
-	zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
+	double zFact = -1.0 * m_cz * Macauley(-1.0 * D);
+	for (int i = 0; i < 6; i++) {
+		// elastic trial strain
+		TrialElasticStrain(i) = curEStrain(i) + (strain(i) - curStrain(i));
+		aBar(i) = two3 * h * b(i);
+		zBar(i) = zFact * (m_z_max * n(i) + fabric(i));
+		dStress(i) = stress(i) - curStress(i);
+	}
 		
-	dEstrain = aD * (stress - curStress);
-	eStrain = curEStrain + dEstrain;
+	dEstrain.addMatrixVector(0.0, aD, dStress, 1.0);
+	VoigtTensor::identity4(dGammaIIco, 2.0);
+	dGammaIIco *= dGamma;
+	dGammaR.addMatrixVector(0.0, dGammaIIco, R, 1.0);
 		
-	R1 = eStrain - TrialElasticStrain + dGamma * mIIco * R;
-	R2 = alpha   - curAlpha			  - dGamma * aBar;
-	R3 = fabric  - curFabric		  - dGamma * zBar;
-	R4 = GetF(stress, alpha);
-	
-	Vector res(19);
 	// fill out residual vector
-	res.Assemble(R1, 0, 1.0);
-	res.Assemble(R2, 6, 1.0);
-	res.Assemble(R3, 12, 1.0);
-	res(18) = R4;
-
-	return res;
+	for (int i = 0; i < 6; i++) {
+		eStrain(i) = curEStrain(i) + dEstrain(i);
+		res(i)     = eStrain(i) - TrialElasticStrain(i) + dGammaR(i);
+		res(6+i)   = alpha(i)   - curAlpha(i)           - dGamma * aBar(i);
+		res(12+i)  = fabric(i)  - curFabric(i)          - dGamma * zBar(i);
+	}
+	res(18) = GetF(stress, alpha);
 }
 /*************************************************************/
 //            GetJacobian                                    //
@@ -2650,9 +2649,12 @@ ManzariDafalias::NewtonIter3(const Vector& xo, const Vector& inVar, Vector& sol,
 				alpha = 1.0;
 				break;
 			}
-			sol2 = sol + (alpha * del);
-			res2	= NewtonRes(sol2, inVar);
-			f_new      = 0.5 * res2 ^ res2;
+			for (int j = 0; j < 19; j++)
+				sol2(j) = sol(j) + alpha * del(j);
+			NewtonRes(sol2, inVar, res2);
+			f_new      = 0.0;
+			for (int j = 0; j < 19; j++)
+				f_new += 0.5 * res2(j) * res2(j);
 
 			aNormR2 = res2.Norm();
 			if(debugFlag) 
@@ -2687,172 +2689,246 @@ ManzariDafalias::NewtonIter3(const Vector& xo, const Vector& inVar, Vector& sol,
 int 
 ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res, Vector& JRes, Vector& del, Matrix& Cep)
 {
-	Vector eStrain(6), strain(6), curStrain(6), curEStrain(6), TrialElasticStrain(6), dEstrain(6); // Strain
-	Vector stress(6), alpha(6), curStress(6), curAlpha(6), alpha_in(6);
-	Vector fabric(6), curFabric(6);
-	double dGamma, curVoidRatio, voidRatio;
+	VectorN<6> eStrain, strain, curStrain, curEStrain, TrialElasticStrain, dEstrain; // Strain
+	VectorN<6> stress, alpha, curStress, curAlpha, alpha_in, dStress;
+	VectorN<6> fabric, curFabric;
+	double dGamma, voidRatio;
 	// state dependent variables
-	Matrix aD(6,6), aC(6,6);
-	Vector n(6), n2(6), d(6), b(6), R(6), devStress(6), r(6), aBar(6), zBar(6); 
+	MatrixN<6,6> aD, aC;
+	VectorN<6> n, n2, d, b, R, devStress, r, aBar, zBar; 
 	double Cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, B, C, D, p, normR, gc;
+
+	// identity tensors
+	VectorN<6> I1;
+	MatrixN<6,6> IIco, IIcon, IImix, IIvol, IIdevCon;
+	VoigtTensor::identity(I1);
+	VoigtTensor::identity4(IIco, 2.0);
+	VoigtTensor::identity4(IIcon, 0.5);
+	VoigtTensor::identity4(IImix, 1.0);
+	VoigtTensor::volumetric(IIvol);
+	IIdevCon = IIcon;
+	IIdevCon.addMatrix(1.0, IIvol, -one3);
 		
 	// analytical Jacobian
 	double AlphaAlphaInDotN;
 	// Differentials of quantities with respect to Sigma
-	Matrix dnOverdSigma(6,6), dAbarOverdSigma(6,6), dROverdSigma(6,6), dZbarOverdSigma(6,6);
-	Vector dPsiOverdSigma(6), db0OverdSigma(6), dCos3ThetaOverdSigma(6), dAdOverdSigma(6), dhOverdSigma(6),
-		dgOverdSigma(6), dAlphaDOverdSigma(6), dCOverdSigma(6), dBOverdSigma(6), dAlphaBOverdSigma(6), dDOverdSigma(6);
+	MatrixN<6,6> dnOverdSigma, dAbarOverdSigma, dROverdSigma, dZbarOverdSigma;
+	VectorN<6> dPsiOverdSigma, db0OverdSigma, dCos3ThetaOverdSigma, dAdOverdSigma, dhOverdSigma,
+		dgOverdSigma, dAlphaDOverdSigma, dCOverdSigma, dBOverdSigma, dAlphaBOverdSigma, dDOverdSigma;
 	// Differentials of quantities with respect to Alpha
-	Matrix dnOverdAlpha(6,6), dAbarOverdAlpha(6,6), dROverdAlpha(6,6), dZbarOverdAlpha(6,6);
-	Vector dCos3ThetaOverdAlpha(6), dAdOverdAlpha(6), dhOverdAlpha(6), dgOverdAlpha(6), dAlphaDOverdAlpha(6), 
-		dCOverdAlpha(6), dBOverdAlpha(6), dAlphaBOverdAlpha(6), dDOverdAlpha(6);
+	MatrixN<6,6> dnOverdAlpha, dAbarOverdAlpha, dROverdAlpha, dZbarOverdAlpha;
+	VectorN<6> dCos3ThetaOverdAlpha, dAdOverdAlpha, dhOverdAlpha, dgOverdAlpha, dAlphaDOverdAlpha, 
+		dCOverdAlpha, dBOverdAlpha, dAlphaBOverdAlpha, dDOverdAlpha;
 	// Differentials of quantities with respect to Fabric
-	Matrix dZbarOverdFabric(6,6), dROverdFabric(6,6);
-	Vector dAdOverdFabric(6), dDOverdFabric(6), dfOverdSigma(6), dfOverdAlpha(6);
+	MatrixN<6,6> dZbarOverdFabric, dROverdFabric;
+	VectorN<6> dAdOverdFabric, dDOverdFabric, dfOverdSigma, dfOverdAlpha;
 
 	// Variables needed to solve the system of equations
-	Matrix	DAlpha(6,6), DFabric(6,6), DSigma(6,6);
-	Matrix	CAlpha(6,6), CFabric(6,6), CSigma(6,6), ASigma(6,6), ZSigma(6,6);
-	Vector	ALambda(6), AConstant(6), ZLambda(6), ZConstant(6), LSigma(6), 
-			SLambda(6), SConstant(6);
+	MatrixN<6,6> DSigma, CSigma, ASigma, ZSigma;
+	VectorN<6> ALambda, AConstant, ZLambda, ZConstant, LSigma, SConstant;
 	double	LConstant;
 
 	// Flags to consider the threshold values
 	double dpFlag = 1.0, dnFlag = 1.0, dhFlag = 1.0;
 	
 	// residuals
-	Vector R1(6); Vector R2(6); Vector R3(6); double R4;
+	VectorN<6> R1, R2, R3; double R4;
+
+	// work areas for the products
+	MatrixN<6,6> IIcoDn, SDn, temp4, temp5;
+	VectorN<6> temp, temp1, temp2, temp3;
 	
 	// read the trial values
-	stress.Extract(xo, 0, 1.0);
-	alpha.Extract(xo, 6, 1.0);
-	fabric.Extract(xo, 12, 1.0);
+	for (int i = 0; i < 6; i++) {
+		stress(i) = xo(i);
+		alpha(i)  = xo(6+i);
+		fabric(i) = xo(12+i);
+	}
 	dGamma = xo(18);
 
 	// current iteration invariants
-	strain.Extract(inVar, 0, 1.0);
-	curStrain.Extract(inVar, 6, 1.0);
-	curStress.Extract(inVar, 12, 1.0);
-	curEStrain.Extract(inVar, 18, 1.0);
-	curAlpha.Extract(inVar, 24, 1.0);
-	curFabric.Extract(inVar, 30, 1.0);
-	curVoidRatio = inVar(36);
+	for (int i = 0; i < 6; i++) {
+		strain(i)     = inVar(i);
+		curStrain(i)  = inVar(6+i);
+		curStress(i)  = inVar(12+i);
+		curEStrain(i) = inVar(18+i);
+		curAlpha(i)   = inVar(24+i);
+		curFabric(i)  = inVar(30+i);
+		alpha_in(i)   = inVar(38+i);
+	}
 	voidRatio = inVar(37);
-	alpha_in.Extract(inVar,38,1.0);
 
-	// elastic trial strain
-	TrialElasticStrain = curEStrain + (strain - curStrain);
-	aC = GetStiffness(mK, mG);
-	aD = GetCompliance(mK, mG);
+	GetStiffness(mK, mG, aC);
+	GetCompliance(mK, mG, aD);
 
 	GetStateDependent(stress, alpha, fabric, voidRatio, alpha_in, n, d, b, Cos3Theta, h, psi, alphaBtheta, alphaDtheta, 
 					b0, A, D, B, C, R);
-	if (DoubleDot2_2_Contr(alpha - alpha_in,n) <= 1.0e-3)
+	VectorN<6> alphaAlphaIn;
+	for (int i = 0; i < 6; i++)
+		alphaAlphaIn(i) = alpha(i) - alpha_in(i);
+	if (VoigtTensor::dotContr(alphaAlphaIn, n) <= 1.0e-3)
 	{
 		AlphaAlphaInDotN = 1.0e-4;
 		dhFlag = 0.0;
 	} else {
-		AlphaAlphaInDotN = DoubleDot2_2_Contr(alpha - alpha_in,n);
+		AlphaAlphaInDotN = VoigtTensor::dotContr(alphaAlphaIn, n);
 		dhFlag = 1.0;
 	}
 
-	n2 = SingleDot(n,n);
-	devStress = GetDevPart(stress);
-	p = one3 * GetTrace(stress);
+	VoigtTensor::singleDot(n, n, n2);
+	VoigtTensor::deviator(stress, devStress);
+	p = one3 * VoigtTensor::trace(stress);
 	p = p < m_Pmin ? m_Pmin : p;
 	dpFlag = p < m_Pmin ? 0.0 : 1.0;
-	r = devStress - p * alpha;
-	normR = GetNorm_Contr(r);
+	for (int i = 0; i < 6; i++)
+		r(i) = devStress(i) - p * alpha(i);
+	normR = VoigtTensor::normContr(r);
 	dnFlag = normR == 0 ? 0.0 : 1.0;
 	gc = g(Cos3Theta, m_c);
-	aBar = two3 * h * b;
-	zBar = -1.0 * m_cz * Macauley(-1.0 * D) * (m_z_max * n + fabric);
 		
-	dEstrain = aD * (stress - curStress);
-	eStrain = curEStrain + dEstrain;
+	double zFact = -1.0 * m_cz * Macauley(-1.0 * D);
+	for (int i = 0; i < 6; i++) {
+		// elastic trial strain
+		TrialElasticStrain(i) = curEStrain(i) + (strain(i) - curStrain(i));
+		aBar(i) = two3 * h * b(i);
+		zBar(i) = zFact * (m_z_max * n(i) + fabric(i));
+		dStress(i) = stress(i) - curStress(i);
+	}
 
-	R1 = eStrain - TrialElasticStrain + dGamma * mIIco * R;
-	R2 = alpha   - curAlpha			  - dGamma * aBar;
-	R3 = fabric  - curFabric		  - dGamma * zBar;
+	dEstrain.addMatrixVector(0.0, aD, dStress, 1.0);
+	MatrixN<6,6> dGammaIIco = IIco;
+	dGammaIIco *= dGamma;
+	temp.addMatrixVector(0.0, dGammaIIco, R, 1.0);
+
+	for (int i = 0; i < 6; i++) {
+		eStrain(i) = curEStrain(i) + dEstrain(i);
+		R1(i) = eStrain(i) - TrialElasticStrain(i) + temp(i);
+		R2(i) = alpha(i)   - curAlpha(i)           - dGamma * aBar(i);
+		R3(i) = fabric(i)  - curFabric(i)          - dGamma * zBar(i);
+	}
 	R4 = GetF(stress, alpha);
 	
 	// fill out residual vector
-	res.Assemble(R1, 0, 1.0);
-	res.Assemble(R2, 6, 1.0);
-	res.Assemble(R3, 12, 1.0);
+	for (int i = 0; i < 6; i++) {
+		res(i)    += R1(i);
+		res(6+i)  += R2(i);
+		res(12+i) += R3(i);
+	}
 	res(18) = R4;
 
-	// d...OverdSigma : Arranged by order of dependence
-	dnOverdSigma          = dnFlag * ( 1.0 / normR * (mIIdevCon - dpFlag*one3*Dyadic2_2(alpha,mI1) - 
-		Dyadic2_2(n,n) + dpFlag*one3*DoubleDot2_2_Contr(alpha,n)*Dyadic2_2(n,mI1)));
-	dPsiOverdSigma        = dpFlag * one3 * m_ksi * m_lambda_c / m_P_atm * pow(p/m_P_atm, m_ksi-1) * mI1;
-	db0OverdSigma         = dpFlag*(-b0 / (6.0*p) * mI1);
-
-	dCos3ThetaOverdSigma  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, mIIco*dnOverdSigma);
-	dAdOverdSigma         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
-		DoubleDot2_4(fabric, mIIco*dnOverdSigma);
-	dhOverdSigma          = dhFlag * (1.0 / AlphaAlphaInDotN * (db0OverdSigma - 
-		h*DoubleDot2_4(alpha-alpha_in, mIIco*dnOverdSigma)));
+	// scalar factors shared by the differentials
+	double alphaDotN   = VoigtTensor::dotContr(alpha, n);
+	double dAdFact     = m_A0 * MacauleyIndex(VoigtTensor::dotContr(fabric, n));
+	double dgFact      = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c);
+	double dAlphaDFact = m_Mc * exp(m_nd * psi);
+	double dCFact      = 3.0 * sqrt(1.5) * (1 - m_c)/m_c;
+	double dBFact      = 1.5 * (1.0 - m_c)/m_c;
+	double dAlphaBFact = m_Mc * exp(-1.0*m_nb*psi);
+	double dZbarFact   = -1.0 * m_cz * MacauleyIndex(-1.0*D);
+	VectorN<6> bTheta, zDir;
+	for (int i = 0; i < 6; i++) {
+		bTheta(i) = root23*alphaBtheta*n(i) - alpha(i);
+		zDir(i)   = m_z_max*n(i) + fabric(i);
+	}
 
-	dgOverdSigma          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdSigma;
+	// d...OverdSigma : Arranged by order of dependence
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++)
+			dnOverdSigma(i,j) = dnFlag * (1.0 / normR * (IIdevCon(i,j) - dpFlag*one3*(alpha(i)*I1(j)) - 
+				n(i)*n(j) + dpFlag*one3*alphaDotN*(n(i)*I1(j))));
+	double dPsiFact = dpFlag * one3 * m_ksi * m_lambda_c / m_P_atm * pow(p/m_P_atm, m_ksi-1);
+	for (int i = 0; i < 6; i++) {
+		dPsiOverdSigma(i) = dPsiFact * I1(i);
+		db0OverdSigma(i)  = dpFlag*(-b0 / (6.0*p) * I1(i));
+	}
 
-	dAlphaDOverdSigma     = m_Mc * exp(m_nd * psi) * (dgOverdSigma + m_nd * gc * dPsiOverdSigma);
-	dCOverdSigma          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdSigma;
-	dBOverdSigma          = 1.5 * (1.0 - m_c)/m_c * (dgOverdSigma * Cos3Theta + gc * dCos3ThetaOverdSigma);
-	dAlphaBOverdSigma     = m_Mc * exp(-1.0*m_nb*psi) * (dgOverdSigma - m_nb * gc * dPsiOverdSigma);
+	IIcoDn.addMatrixProduct(0.0, IIco, dnOverdSigma, 1.0);
+	VoigtTensor::dot(n2, IIcoDn, temp1);
+	VoigtTensor::dot(fabric, IIcoDn, temp2);
+	VoigtTensor::dot(alphaAlphaIn, IIcoDn, temp3);
+	VoigtTensor::dot(alpha, IIcoDn, temp);
+	for (int i = 0; i < 6; i++) {
+		dCos3ThetaOverdSigma(i) = 3.0 * sqrt(6.0) * temp1(i);
+		dAdOverdSigma(i)        = dAdFact * temp2(i);
+		dhOverdSigma(i)         = dhFlag * (1.0 / AlphaAlphaInDotN * (db0OverdSigma(i) - h*temp3(i)));
+
+		dgOverdSigma(i)         = dgFact * dCos3ThetaOverdSigma(i);
+
+		dAlphaDOverdSigma(i)    = dAlphaDFact * (dgOverdSigma(i) + m_nd * gc * dPsiOverdSigma(i));
+		dCOverdSigma(i)         = dCFact * dgOverdSigma(i);
+		dBOverdSigma(i)         = dBFact * (dgOverdSigma(i) * Cos3Theta + gc * dCos3ThetaOverdSigma(i));
+		dAlphaBOverdSigma(i)    = dAlphaBFact * (dgOverdSigma(i) - m_nb * gc * dPsiOverdSigma(i));
+
+		dDOverdSigma(i)         = dAdOverdSigma(i) * (root23 * alphaDtheta - alphaDotN) +
+			A * (root23 * dAlphaDOverdSigma(i) - temp(i));
+	}
 
-	dDOverdSigma          = dAdOverdSigma * (root23 * alphaDtheta - DoubleDot2_2_Contr(alpha, n)) +
-		A * (root23 * dAlphaDOverdSigma - DoubleDot2_4(alpha, mIIco*dnOverdSigma));
-	dAbarOverdSigma       = two3 * (Dyadic2_2(root23*alphaBtheta*n-alpha, dhOverdSigma) + 
-		root23 * h * (Dyadic2_2(n, dAlphaBOverdSigma)+alphaBtheta * dnOverdSigma));
+	VoigtTensor::singleDot(n, dnOverdSigma, SDn);
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++) {
+			dAbarOverdSigma(i,j) = two3 * (bTheta(i)*dhOverdSigma(j) + 
+				root23 * h * (n(i)*dAlphaBOverdSigma(j) + alphaBtheta * dnOverdSigma(i,j)));
 
-	dROverdSigma          = B * dnOverdSigma + Dyadic2_2(n, dBOverdSigma) - C * 
-		(Trans_SingleDot4T_2(dnOverdSigma,n) + SingleDot2_4(n, dnOverdSigma)) -
-		Dyadic2_2((n2 - one3 * mI1),dCOverdSigma) + one3 * Dyadic2_2(mI1, dDOverdSigma);
-	dZbarOverdSigma       = -1.0 * m_cz * MacauleyIndex(-1.0*D) * 
-		(-1.0*Dyadic2_2(m_z_max*n + fabric, dDOverdSigma) - m_z_max * D * dnOverdSigma);
+			dROverdSigma(i,j)    = B * dnOverdSigma(i,j) + n(i)*dBOverdSigma(j) - C * (SDn(i,j) + SDn(i,j)) -
+				(n2(i) - one3 * I1(i))*dCOverdSigma(j) + one3 * (I1(i)*dDOverdSigma(j));
+			dZbarOverdSigma(i,j) = dZbarFact * (-1.0*(zDir(i)*dDOverdSigma(j)) - m_z_max * D * dnOverdSigma(i,j));
+		}
 
 	// d...OverdAlpha : Arranged by order of dependence
-	dnOverdAlpha          = dnFlag * (p / normR * (Dyadic2_2(n,n) - mIIcon));
-
-	dCos3ThetaOverdAlpha  = 3.0 * sqrt(6.0) * DoubleDot2_4(n2, mIIco*dnOverdAlpha);
-	dAdOverdAlpha         = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * 
-		DoubleDot2_4(fabric, mIIco*dnOverdAlpha);
-	dhOverdAlpha          = dhFlag * (-1.0*h / AlphaAlphaInDotN * (n + 
-		DoubleDot2_4(alpha-alpha_in,mIIco*dnOverdAlpha)));
-
-	dgOverdAlpha          = pow(gc,2.0) * (1.0-m_c)/(2.0*m_c) * dCos3ThetaOverdAlpha;
-
-	dAlphaDOverdAlpha     = m_Mc * exp(m_nd * psi) * dgOverdAlpha;
-	dCOverdAlpha          = 3.0 * sqrt(1.5) * (1 - m_c)/m_c * dgOverdAlpha;
-	dBOverdAlpha          = 1.5 * (1.0 - m_c)/m_c * (dgOverdAlpha * Cos3Theta + gc * dCos3ThetaOverdAlpha);
-	dAlphaBOverdAlpha     = m_Mc * exp(-1.0*m_nb*psi) * dgOverdAlpha;
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++)
+			dnOverdAlpha(i,j) = dnFlag * (p / normR * (n(i)*n(j) - IIcon(i,j)));
+
+	IIcoDn.addMatrixProduct(0.0, IIco, dnOverdAlpha, 1.0);
+	VoigtTensor::dot(n2, IIcoDn, temp1);
+	VoigtTensor::dot(fabric, IIcoDn, temp2);
+	VoigtTensor::dot(alphaAlphaIn, IIcoDn, temp3);
+	VoigtTensor::dot(alpha, IIcoDn, temp);
+	for (int i = 0; i < 6; i++) {
+		dCos3ThetaOverdAlpha(i) = 3.0 * sqrt(6.0) * temp1(i);
+		dAdOverdAlpha(i)        = dAdFact * temp2(i);
+		dhOverdAlpha(i)         = dhFlag * (-1.0*h / AlphaAlphaInDotN * (n(i) + temp3(i)));
+
+		dgOverdAlpha(i)         = dgFact * dCos3ThetaOverdAlpha(i);
+
+		dAlphaDOverdAlpha(i)    = dAlphaDFact * dgOverdAlpha(i);
+		dCOverdAlpha(i)         = dCFact * dgOverdAlpha(i);
+		dBOverdAlpha(i)         = dBFact * (dgOverdAlpha(i) * Cos3Theta + gc * dCos3ThetaOverdAlpha(i));
+		dAlphaBOverdAlpha(i)    = dAlphaBFact * dgOverdAlpha(i);
+
+		dDOverdAlpha(i)         = dAdOverdAlpha(i) * (root23 * alphaDtheta - alphaDotN) + 
+			A * (root23 * dAlphaDOverdAlpha(i) - n(i) - temp(i));
+	}
 
-	dDOverdAlpha          = dAdOverdAlpha * (root23 * alphaDtheta - 
-		DoubleDot2_2_Contr(alpha, n)) + A * (root23 * dAlphaDOverdAlpha -
-		n - DoubleDot2_4(alpha, mIIco*dnOverdAlpha));
-	dAbarOverdAlpha       = two3 * (Dyadic2_2(root23*alphaBtheta*n-alpha, dhOverdAlpha) +
-		root23 * h * (Dyadic2_2(n, dAlphaBOverdAlpha)+alphaBtheta * dnOverdAlpha) - h * mIIcon);
+	VoigtTensor::singleDot(n, dnOverdAlpha, SDn);
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++) {
+			dAbarOverdAlpha(i,j) = two3 * (bTheta(i)*dhOverdAlpha(j) +
+				root23 * h * (n(i)*dAlphaBOverdAlpha(j) + alphaBtheta * dnOverdAlpha(i,j)) - h * IIcon(i,j));
 
-	dROverdAlpha          = B * dnOverdAlpha + Dyadic2_2(n, dBOverdAlpha) - C * 
-		(Trans_SingleDot4T_2(dnOverdAlpha,n) + SingleDot2_4(n, dnOverdAlpha)) -
-		Dyadic2_2((n2 - one3 * mI1),dCOverdAlpha) + one3 * Dyadic2_2(mI1, dDOverdAlpha);
-	dZbarOverdAlpha       = -1.0*m_cz*MacauleyIndex(-1.0*D) * (-1.0*
-		Dyadic2_2(m_z_max*n + fabric, dDOverdAlpha) - m_z_max * D * dnOverdAlpha);
+			dROverdAlpha(i,j)    = B * dnOverdAlpha(i,j) + n(i)*dBOverdAlpha(j) - C * (SDn(i,j) + SDn(i,j)) -
+				(n2(i) - one3 * I1(i))*dCOverdAlpha(j) + one3 * (I1(i)*dDOverdAlpha(j));
+			dZbarOverdAlpha(i,j) = dZbarFact * (-1.0*(zDir(i)*dDOverdAlpha(j)) - m_z_max * D * dnOverdAlpha(i,j));
+		}
 
 	// d...OverdFabric : Arranged by order of dependence
-	dAdOverdFabric        = m_A0 * MacauleyIndex(DoubleDot2_2_Contr(fabric, n)) * n;
-
-	dDOverdFabric         = dAdOverdFabric * (root23 * alphaDtheta - DoubleDot2_2_Contr(alpha, n));
-	
-	dROverdFabric         = one3 * Dyadic2_2(mI1, dDOverdFabric);
-
-	dZbarOverdFabric      = -1.0*m_cz* MacauleyIndex(-1.0*D) * 
-		(-1.0*Dyadic2_2(m_z_max * n + fabric, dDOverdFabric) - D * mIIcon);
+	for (int i = 0; i < 6; i++) {
+		dAdOverdFabric(i) = dAdFact * n(i);
+		dDOverdFabric(i)  = dAdOverdFabric(i) * (root23 * alphaDtheta - alphaDotN);
+	}
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++) {
+			dROverdFabric(i,j)    = one3 * (I1(i)*dDOverdFabric(j));
+			dZbarOverdFabric(i,j) = dZbarFact * (-1.0*(zDir(i)*dDOverdFabric(j)) - D * IIcon(i,j));
+		}
 
-		
-	dfOverdSigma		= (n - one3 * DoubleDot2_2_Contr(devStress/p,n) * mI1);
-	dfOverdAlpha		= -1.0 * p * n;
+	for (int i = 0; i < 6; i++)
+		temp(i) = devStress(i) / p;
+	double devDotN = VoigtTensor::dotContr(temp, n);
+	for (int i = 0; i < 6; i++) {
+		dfOverdSigma(i) = n(i) - one3 * devDotN * I1(i);
+		dfOverdAlpha(i) = -1.0 * p * n(i);
+	}
 
 	// -------------------------------------------------------------------------
 	// -------------------------------------------------------------------------
@@ -2865,85 +2941,170 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
 	// -------------------------------------------------------------------------
 		
 	// Jacobian
-	Matrix J11(6,6), J12(6,6), J13(6,6); Vector J14(6);
-	Matrix J21(6,6), J22(6,6);           Vector J24(6);
-	Matrix J31(6,6), J32(6,6), J33(6,6); Vector J34(6);
-	Vector J41(6), J42(6);
+	MatrixN<6,6> J11, J12, J13; VectorN<6> J14;
+	MatrixN<6,6> J21, J22;      VectorN<6> J24;
+	MatrixN<6,6> J31, J32, J33; VectorN<6> J34;
+	VectorN<6> J41, J42;
 	
 	// inv(J22), inv(J33)
-	Matrix J22_1(6,6), J33_1(6,6);
+	MatrixN<6,6> J22_1, J33_1;
 	
-	J11		= aD + dGamma * mIIco * dROverdSigma * mIIco;
-	J12		= dGamma * mIIco * dROverdAlpha  * mIIco;
-	J13		= dGamma * mIIco * dROverdFabric * mIIco;
-	J14		= mIIco * R;
-
-	J21		=  -1.0*dGamma * dAbarOverdSigma * mIIco;
-	J22		=  mIImix - dGamma * dAbarOverdAlpha * mIIco;
-	J24		=  -1.0 *  aBar;
-
-	J31		=  -1.0*dGamma * dZbarOverdSigma * mIIco;
-	J32		=  -1.0*dGamma * dZbarOverdAlpha * mIIco;
-	J33		=  mIImix - dGamma * dZbarOverdFabric * mIIco;
-	J34		=  -1.0 * zBar; 
+	// J11 = aD + dGamma * mIIco * dROverdSigma * mIIco
+	temp4.addMatrixProduct(0.0, dGammaIIco, dROverdSigma, 1.0);
+	J11.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	J11 += aD;
+	// J12 = dGamma * mIIco * dROverdAlpha * mIIco
+	temp4.addMatrixProduct(0.0, dGammaIIco, dROverdAlpha, 1.0);
+	J12.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	// J13 = dGamma * mIIco * dROverdFabric * mIIco
+	temp4.addMatrixProduct(0.0, dGammaIIco, dROverdFabric, 1.0);
+	J13.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	J14.addMatrixVector(0.0, IIco, R, 1.0);
+
+	// J21 = -1.0*dGamma * dAbarOverdSigma * mIIco
+	temp4 = dAbarOverdSigma;
+	temp4 *= -1.0*dGamma;
+	J21.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	// J22 = mIImix - dGamma * dAbarOverdAlpha * mIIco
+	temp4 = dAbarOverdAlpha;
+	temp4 *= dGamma;
+	J22.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	J22.addMatrix(-1.0, IImix, 1.0);
+
+	// J31 = -1.0*dGamma * dZbarOverdSigma * mIIco
+	temp4 = dZbarOverdSigma;
+	temp4 *= -1.0*dGamma;
+	J31.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	// J32 = -1.0*dGamma * dZbarOverdAlpha * mIIco
+	temp4 = dZbarOverdAlpha;
+	temp4 *= -1.0*dGamma;
+	J32.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	// J33 = mIImix - dGamma * dZbarOverdFabric * mIIco
+	temp4 = dZbarOverdFabric;
+	temp4 *= dGamma;
+	J33.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	J33.addMatrix(-1.0, IImix, 1.0);
+
+	for (int i = 0; i < 6; i++) {
+		J24(i) = -1.0 * aBar(i);
+		J34(i) = -1.0 * zBar(i);
+	}
 
-	J41		= mIIco * dfOverdSigma;
-	J42		= mIIco * dfOverdAlpha;
+	J41.addMatrixVector(0.0, IIco, dfOverdSigma, 1.0);
+	J42.addMatrixVector(0.0, IIco, dfOverdAlpha, 1.0);
 
 	// JRes
-	Vector temp(6); double temp2;
-	temp = (J11^R1) + (J21^R2) + (J31^R3) + R4 * J41;
-	JRes.Assemble(temp, 0, 1.0);
-	temp = (J12^R1) + (J22^R2) + (J32^R3) + R4 * J42;
-	JRes.Assemble(temp, 6, 1.0);
-	temp = (J13^R1) + (J33^R3);
-	JRes.Assemble(temp, 12, 1.0);
-	temp2 = (J14^R1) + (J24^R2) + (J34^R3);
-	JRes(18) = temp2;
+	VoigtTensor::dot(R1, J11, temp1);
+	VoigtTensor::dot(R2, J21, temp2);
+	VoigtTensor::dot(R3, J31, temp3);
+	for (int i = 0; i < 6; i++)
+		JRes(i) += temp1(i) + temp2(i) + temp3(i) + R4 * J41(i);
+	VoigtTensor::dot(R1, J12, temp1);
+	VoigtTensor::dot(R2, J22, temp2);
+	VoigtTensor::dot(R3, J32, temp3);
+	for (int i = 0; i < 6; i++)
+		JRes(6+i) += temp1(i) + temp2(i) + temp3(i) + R4 * J42(i);
+	VoigtTensor::dot(R1, J13, temp1);
+	VoigtTensor::dot(R3, J33, temp3);
+	for (int i = 0; i < 6; i++)
+		JRes(12+i) += temp1(i) + temp3(i);
+	JRes(18) = (J14^R1) + (J24^R2) + (J34^R3);
 	
-	if (J22.Invert(J22_1) != 0)
+	// the inverses are found by LAPACK in the storage of J22_1 and J33_1
+	Matrix theJ22(J22.values, 6, 6), theJ22_1(J22_1.values, 6, 6);
+	if (theJ22.Invert(theJ22_1) != 0)
 	{
 		if (debugFlag) opserr << "ManzariDafalias (Tag: " << this->getTag() << "): Singular Matrix in Newton iterations - CAlpha!" << endln;
-		J22_1 = mIImix;
+		J22_1 = IImix;
 		//return -1;
 	}
 
-	if (J33.Invert(J33_1) != 0)
+	Matrix theJ33(J33.values, 6, 6), theJ33_1(J33_1.values, 6, 6);
+	if (theJ33.Invert(theJ33_1) != 0)
 	{
 		if (debugFlag) opserr << "ManzariDafalias (Tag: " << this->getTag() << "): Singular Matrix in Newton iterations - CFabric!" << endln;
-		J33_1 = mIImix;
+		J33_1 = IImix;
 		//return -1;
 	}
 
-	ASigma		= -1.0 * J22_1 * mIIco * J21;
-	ALambda		= -1.0 * J22_1 * mIIco * J24;
-	AConstant	= -1.0 * J22_1 * mIIco * R2;
-
-	ZSigma		= -1.0 * J33_1 * mIIco * (J31 + J32 * mIIcon * ASigma);
-	ZLambda		= -1.0 * J33_1 * mIIco * (J34 + J32 * mIIcon * ALambda);
-	ZConstant	= -1.0 * J33_1 * mIIco * (R3  + J32 * mIIcon * AConstant);
-
-	LSigma		= -1.0 / (J42 ^ (mIIcon * ALambda)) * (J41 + (ASigma ^ (mIIcon * J42)));
-	LConstant	= -1.0 / (J42 ^ (mIIcon * ALambda)) * (R4  + (J42 ^ (mIIcon * AConstant)));
-
-	SConstant   = R1 + J12 * mIIcon * (ALambda * LConstant + AConstant) + 
-					J13 * mIIcon * (ZLambda * LConstant + ZConstant) + J14 * LConstant;
-	DSigma		= J11 + J12 * mIIcon * (ASigma + Dyadic2_2(ALambda, LSigma)) + 
-					J13 * mIIcon * (ZSigma + Dyadic2_2(ZLambda, LSigma)) + Dyadic2_2(J14, LSigma);
+	// ASigma = -1.0 * J22_1 * mIIco * J21, ALambda = ... * J24, AConstant = ... * R2
+	temp4 = J22_1;
+	temp4 *= -1.0;
+	temp5.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	ASigma.addMatrixProduct(0.0, temp5, J21, 1.0);
+	ALambda.addMatrixVector(0.0, temp5, J24, 1.0);
+	AConstant.addMatrixVector(0.0, temp5, R2, 1.0);
+
+	// ZSigma = -1.0 * J33_1 * mIIco * (J31 + J32 * mIIcon * ASigma), ZLambda and ZConstant alike
+	MatrixN<6,6> J32IIcon, J33IIco;
+	J32IIcon.addMatrixProduct(0.0, J32, IIcon, 1.0);
+	temp4 = J33_1;
+	temp4 *= -1.0;
+	J33IIco.addMatrixProduct(0.0, temp4, IIco, 1.0);
+	temp4.addMatrixProduct(0.0, J32IIcon, ASigma, 1.0);
+	temp4 += J31;
+	ZSigma.addMatrixProduct(0.0, J33IIco, temp4, 1.0);
+	temp.addMatrixVector(0.0, J32IIcon, ALambda, 1.0);
+	temp += J34;
+	ZLambda.addMatrixVector(0.0, J33IIco, temp, 1.0);
+	temp.addMatrixVector(0.0, J32IIcon, AConstant, 1.0);
+	temp += R3;
+	ZConstant.addMatrixVector(0.0, J33IIco, temp, 1.0);
+
+	// LSigma = -1.0 / (J42 ^ (mIIcon * ALambda)) * (J41 + (ASigma ^ (mIIcon * J42)))
+	// LConstant = -1.0 / (J42 ^ (mIIcon * ALambda)) * (R4 + (J42 ^ (mIIcon * AConstant)))
+	temp1.addMatrixVector(0.0, IIcon, ALambda, 1.0);
+	double LFact = -1.0 / (J42 ^ temp1);
+	temp2.addMatrixVector(0.0, IIcon, J42, 1.0);
+	VoigtTensor::dot(temp2, ASigma, temp);
+	for (int i = 0; i < 6; i++)
+		LSigma(i) = LFact * (J41(i) + temp(i));
+	temp3.addMatrixVector(0.0, IIcon, AConstant, 1.0);
+	LConstant = LFact * (R4 + (J42 ^ temp3));
+
+	// SConstant = R1 + J12 * mIIcon * (ALambda * LConstant + AConstant) + 
+	//				J13 * mIIcon * (ZLambda * LConstant + ZConstant) + J14 * LConstant
+	// DSigma = J11 + J12 * mIIcon * (ASigma + Dyadic2_2(ALambda, LSigma)) + 
+	//				J13 * mIIcon * (ZSigma + Dyadic2_2(ZLambda, LSigma)) + Dyadic2_2(J14, LSigma)
+	MatrixN<6,6> J12IIcon, J13IIcon;
+	J12IIcon.addMatrixProduct(0.0, J12, IIcon, 1.0);
+	J13IIcon.addMatrixProduct(0.0, J13, IIcon, 1.0);
+	for (int i = 0; i < 6; i++) {
+		temp1(i) = ALambda(i) * LConstant + AConstant(i);
+		temp2(i) = ZLambda(i) * LConstant + ZConstant(i);
+	}
+	temp.addMatrixVector(0.0, J12IIcon, temp1, 1.0);
+	temp3.addMatrixVector(0.0, J13IIcon, temp2, 1.0);
+	for (int i = 0; i < 6; i++)
+		SConstant(i) = R1(i) + temp(i) + temp3(i) + J14(i) * LConstant;
 	
-
-	DSigma		= aC * DSigma;
-	if (DSigma.Invert(CSigma) != 0) 
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++) {
+			temp4(i,j) = ASigma(i,j) + ALambda(i)*LSigma(j);
+			temp5(i,j) = ZSigma(i,j) + ZLambda(i)*LSigma(j);
+		}
+	MatrixN<6,6> P1, P2;
+	P1.addMatrixProduct(0.0, J12IIcon, temp4, 1.0);
+	P2.addMatrixProduct(0.0, J13IIcon, temp5, 1.0);
+	for (int j = 0; j < 6; j++)
+		for (int i = 0; i < 6; i++)
+			temp4(i,j) = J11(i,j) + P1(i,j) + P2(i,j) + J14(i)*LSigma(j);
+
+	DSigma.addMatrixProduct(0.0, aC, temp4, 1.0);
+	Matrix theDSigma(DSigma.values, 6, 6), theCSigma(temp5.values, 6, 6);
+	if (theDSigma.Invert(theCSigma) != 0) 
 	{
 		if (debugFlag) opserr << "ManzariDafalias (Tag: " << this->getTag() << "): Singular Matrix in Newton iterations - Cep!" << endln;
 		CSigma = aC;
 		//return -1;
 	} else
-		CSigma = CSigma * aC;
+		CSigma.addMatrixProduct(0.0, temp5, aC, 1.0);
 
-	Vector delSig(6), delAlph(6), delZ(6);
+	VectorN<6> delSig, delAlph, delZ;
 	double delGamma;
-	delSig		= -1.0 *  CSigma * SConstant;
+	temp4 = CSigma;
+	temp4 *= -1.0;
+	delSig.addMatrixVector(0.0, temp4, SConstant, 1.0);
 	delGamma	= (LSigma ^ delSig) + LConstant;
 	// Check if delGamma is NaN
 	if (delGamma != delGamma)
@@ -2954,37 +3115,28 @@ ManzariDafalias::NewtonSol2(const Vector &xo, const Vector &inVar, Vector& res,
 		delGamma = 0.0;
 		delZ.Zero();
 		delAlph.Zero();
-		Cep = aC;
+		aC.copyTo(Cep);
 	} else {
-		delZ		= mIIcon * (ZSigma * delSig + delGamma * ZLambda + ZConstant);
-		delAlph		= mIIcon * (ASigma * delSig + delGamma * ALambda + AConstant);
-		Cep			= CSigma;
+		// delZ = mIIcon * (ZSigma * delSig + delGamma * ZLambda + ZConstant)
+		temp.addMatrixVector(0.0, ZSigma, delSig, 1.0);
+		for (int i = 0; i < 6; i++)
+			temp(i) = temp(i) + delGamma * ZLambda(i) + ZConstant(i);
+		delZ.addMatrixVector(0.0, IIcon, temp, 1.0);
+		// delAlph = mIIcon * (ASigma * delSig + delGamma * ALambda + AConstant)
+		temp.addMatrixVector(0.0, ASigma, delSig, 1.0);
+		for (int i = 0; i < 6; i++)
+			temp(i) = temp(i) + delGamma * ALambda(i) + AConstant(i);
+		delAlph.addMatrixVector(0.0, IIcon, temp, 1.0);
+		CSigma.copyTo(Cep);
 	}
-	del			= SetManzariComponent(delSig, delAlph, delZ, delGamma);
+	for (int i = 0; i < 6; i++) {
+		del(i)    = delSig(i);
+		del(6+i)  = delAlph(i);
+		del(12+i) = delZ(i);
+	}
+	del(18) = delGamma;
 	return 0;	
 }
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
 /*************************************************************/
 //            GetResidual                                    //
 /*************************************************************/
@@ -3443,12 +3595,19 @@ ManzariDafalias::g(const double cos3theta, const double c)
 // GetF() -----------------------------------------------------
 double 
 ManzariDafalias::GetF(const Vector& nStress, const Vector& nAlpha)
+{
+	return GetF(VectorN<6>(nStress), VectorN<6>(nAlpha));
+}
+
+double 
+ManzariDafalias::GetF(const VectorN<6>& nStress, const VectorN<6>& nAlpha)
 {
 	// Manzari's yield function
-	Vector s(6); s = GetDevPart(nStress);
-	double p = one3 * GetTrace(nStress);
-	s = s - p * nAlpha;
-	return GetNorm_Contr(s) - root23 * m_m * p;
+	VectorN<6> s; VoigtTensor::deviator(nStress, s);
+	double p = one3 * VoigtTensor::trace(nStress);
+	for (int i = 0; i < 6; i++)
+		s(i) -= p * nAlpha(i);
+	return VoigtTensor::normContr(s) - root23 * m_m * p;
 }
 /*************************************************************/
 // GetPSI() ---------------------------------------------------
@@ -3463,7 +3622,17 @@ double
 ManzariDafalias::GetLodeAngle(const Vector& n)
 // Returns cos(3*theta)
 {
-	double Cos3Theta = sqrt(6.0) * GetTrace(SingleDot(n,SingleDot(n,n)));
+	return GetLodeAngle(VectorN<6>(n));
+}
+
+double 
+ManzariDafalias::GetLodeAngle(const VectorN<6>& n)
+// Returns cos(3*theta)
+{
+	VectorN<6> n2, n3;
+	VoigtTensor::singleDot(n, n, n2);
+	VoigtTensor::singleDot(n, n2, n3);
+	double Cos3Theta = sqrt(6.0) * VoigtTensor::trace(n3);
 	Cos3Theta = Cos3Theta > 1 ? 1 : Cos3Theta;
 	Cos3Theta = Cos3Theta < -1 ? -1 : Cos3Theta;
 	return Cos3Theta;
@@ -3544,13 +3713,22 @@ ManzariDafalias::GetStiffness(const double& K, const double& G)
 // returns the stiffness matrix in its contravarinat-contravariant form
 {
 	Matrix C(6,6);
+	MatrixN<6,6> theC;
+	GetStiffness(K, G, theC);
+	theC.copyTo(C);
+	return C;
+}
+
+void
+ManzariDafalias::GetStiffness(const double& K, const double& G, MatrixN<6,6>& C)
+{
+	C.Zero();
 	double a = K + 4.0*one3 * G;
 	double b = K - 2.0*one3 * G;
 	C(0,0) = C(1,1) = C(2,2) = a;
 	C(3,3) = C(4,4) = C(5,5) = G;
 	C(0,1) = C(0,2) = C(1,2) = b;
 	C(1,0) = C(2,0) = C(2,1) = b;
-	return C;
 }
 /*************************************************************/
 // GetCompliance() ---------------------------------------------
@@ -3559,6 +3737,16 @@ ManzariDafalias::GetCompliance(const double& K, const double& G)
 // returns the compliance matrix in its covariant-covariant form
 {
 	Matrix D(6,6);
+	MatrixN<6,6> theD;
+	GetCompliance(K, G, theD);
+	theD.copyTo(D);
+	return D;
+}
+
+void
+ManzariDafalias::GetCompliance(const double& K, const double& G, MatrixN<6,6>& D)
+{
+	D.Zero();
 	double a = 1 / (9*K) + 1 / (3*G);
 	double b = 1 / (9*K) - 1 / (6*G);
 	double c = 1 / G;
@@ -3566,7 +3754,6 @@ ManzariDafalias::GetCompliance(const double& K, const double& G)
 	D(3,3) = D(4,4) = D(5,5) = c;
 	D(0,1) = D(0,2) = D(1,2) = b;
 	D(1,0) = D(2,0) = D(2,1) = b;
-	return D;
 }
 /*************************************************************/
 // GetElastoPlasticTangent()---------------------------------------
@@ -3612,14 +3799,25 @@ ManzariDafalias::GetElastoPlasticTangent(const Vector& NextStress, const double&
 Vector
 ManzariDafalias::GetNormalToYield(const Vector &stress, const Vector &alpha)
 {
-	Vector devStress(6); devStress = GetDevPart(stress);
-	double p = one3 * GetTrace(stress);
-	Vector n(6); n = devStress - p * alpha;
-	if (GetNorm_Contr(n) != 0)
-		n = n / GetNorm_Contr(n);
+	VectorN<6> theN;
+	GetNormalToYield(VectorN<6>(stress), VectorN<6>(alpha), theN);
+	Vector n(6); theN.copyTo(n);
 
 	return n;
 }
+
+void
+ManzariDafalias::GetNormalToYield(const VectorN<6> &stress, const VectorN<6> &alpha, VectorN<6> &n)
+{
+	VoigtTensor::deviator(stress, n);
+	double p = one3 * VoigtTensor::trace(stress);
+	for (int i = 0; i < 6; i++)
+		n(i) -= p * alpha(i);
+	double normN = VoigtTensor::normContr(n);
+	if (normN != 0)
+		for (int i = 0; i < 6; i++)
+			n(i) /= normN;
+}
 /*************************************************************/
 // Check() ---------------------------------------------------
 int
@@ -3630,11 +3828,11 @@ ManzariDafalias::Check(const Vector& TrialStress, const Vector& stress, const Ve
 	
 	if (GetTrace(stress) < 0) result = -2;
 	
-	Vector n(6);    n    = GetNormalToYield(stress, CurAlpha);
-	Vector n_tr(6); n_tr = GetNormalToYield(TrialStress, CurAlpha);
+	VectorN<6> n;    GetNormalToYield(VectorN<6>(stress), VectorN<6>(CurAlpha), n);
+	VectorN<6> n_tr; GetNormalToYield(VectorN<6>(TrialStress), VectorN<6>(CurAlpha), n_tr);
 	
 	// check the direction of stress and trial stress
-	if (DoubleDot2_2_Contr(n, n_tr) < 0) result = -4;
+	if (VoigtTensor::dotContr(n, n_tr) < 0) result = -4;
 	
 	// add any other checks here
 	
@@ -3649,20 +3847,29 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 				, double &alphaDtheta, double &b0, double& A, double& D, double& B
 				, double& C, Vector& R)
 {
-	double p = one3 * GetTrace(stress);
+	VectorN<6> theN, theD, theB, theR;
+	GetStateDependent(VectorN<6>(stress), VectorN<6>(alpha), VectorN<6>(fabric), e, VectorN<6>(alpha_in), 
+					theN, theD, theB, cos3Theta, h, psi, alphaBtheta, alphaDtheta, b0, A, D, B, C, theR);
+	theN.copyTo(n);
+	theD.copyTo(d);
+	theB.copyTo(b);
+	theR.copyTo(R);
+}
+
+void 
+ManzariDafalias::GetStateDependent(const VectorN<6> &stress, const VectorN<6> &alpha, const VectorN<6> &fabric
+				, const double &e, const VectorN<6> &alpha_in, VectorN<6> &n, VectorN<6> &d, VectorN<6> &b
+				, double &cos3Theta, double &h, double &psi, double &alphaBtheta
+				, double &alphaDtheta, double &b0, double& A, double& D, double& B
+				, double& C, VectorN<6>& R)
+{
+	double p = one3 * VoigtTensor::trace(stress);
 	p = (p < m_Pmin) ? m_Pmin : p;
 
 //	if (p != p)
 //		opserr << "p is a NaN" << endln;
 
-	n = GetNormalToYield(stress, alpha);
-	
-//	for (int j = 0; j < 6; j++) 
-//		if (n(j) != n(j)){
-//			opserr << " stress : " << stress << endln;
-//			opserr << " n : " << n << endln;
-//			break;
-//		}
+	GetNormalToYield(stress, alpha, n);
 
 	psi = GetPSI(e, p);
 
@@ -3689,22 +3896,29 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 //	if (b0 != b0)
 //		opserr << "b0 is a NaN" << endln;
 
-	d    = root23 * alphaDtheta * n - alpha;
-	b    = root23 * alphaBtheta * n - alpha;
-	double AlphaAlphaInDotN;
-	if (DoubleDot2_2_Contr(alpha - alpha_in,n) <= 1.0e-3)
+	VectorN<6> alphaAlphaIn;
+	for (int i = 0; i < 6; i++) {
+		d(i) = root23 * alphaDtheta * n(i) - alpha(i);
+		b(i) = root23 * alphaBtheta * n(i) - alpha(i);
+		alphaAlphaIn(i) = alpha(i) - alpha_in(i);
+	}
+	double AlphaAlphaInDotN = VoigtTensor::dotContr(alphaAlphaIn, n);
+	if (AlphaAlphaInDotN <= 1.0e-3)
 		h = 1.0e4 * b0;
 	else
-	{
-		AlphaAlphaInDotN = DoubleDot2_2_Contr(alpha - alpha_in,n);
 		h = b0 / AlphaAlphaInDotN;
-	}
 
-	A = m_A0 * (1 + Macauley(DoubleDot2_2_Contr(fabric, n)));
-	D = A * DoubleDot2_2_Contr(d, n);
+	A = m_A0 * (1 + Macauley(VoigtTensor::dotContr(fabric, n)));
+	D = A * VoigtTensor::dotContr(d, n);
 	B = 1.0 + 1.5 * (1 - m_c)/ m_c * g(cos3Theta, m_c) * cos3Theta;
 	C = 3.0 * sqrt(1.5) * (1 - m_c)/ m_c * g(cos3Theta, m_c);
-	R = B * n - C * (SingleDot(n,n) - one3 * mI1) + one3 * D * mI1;
+
+	VectorN<6> n2;
+	VoigtTensor::singleDot(n, n, n2);
+	for (int i = 0; i < 6; i++) {
+		double I1 = i < 3 ? 1.0 : 0.0;
+		R(i) = B * n(i) - C * (n2(i) - one3 * I1) + one3 * D * I1;
+	}
 //	if (B != B)
 //		opserr << "B is a NaN" << endln;
 //	if (C != C)
@@ -3712,12 +3926,6 @@ ManzariDafalias::GetStateDependent(const Vector &stress, const Vector &alpha, co
 //	if (D != D)
 //		opserr << "D is a NaN" << endln;
 }
-
-
-
-
-
-
 /*************************************************************/
 /*************************************************************/
 //            SYMMETRIC TENSOR OPERATIONS                    //
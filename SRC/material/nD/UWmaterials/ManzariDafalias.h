@@ -33,6 +33,7 @@
 #include <NDMaterial.h>
 #include <Matrix.h>
 #include <Vector.h>
+#include <MatrixN.h>
 
 #include <Information.h>
 //#include <MaterialResponse.h>
@@ -260,7 +261,7 @@ class ManzariDafalias : public NDMaterial
 	int		NewtonSol(const Vector& x, const Vector &inVar, Vector& del, Matrix& Cep);
 	int		NewtonIter3(const Vector& xo, const Vector& inVar, Vector& sol, Matrix& aCepPart);
 	int		NewtonSol2(const Vector& x, const Vector &inVar, Vector& res, Vector& JRes, Vector& del, Matrix& Cep);
-	Vector  NewtonRes(const Vector &xo, const Vector &inVar);
+	void    NewtonRes(const Vector &xo, const Vector &inVar, Vector &res);
 	Vector	GetResidual(const Vector& x, const Vector& inVar);
 	Matrix	GetJacobian(const Vector &x, const Vector &inVar);
 	Matrix	GetFDMJacobian(const Vector &delta, const Vector &inVar);
@@ -277,24 +278,34 @@ class ManzariDafalias : public NDMaterial
 	double	MacauleyIndex(double x);
 	double	g(const double cos3theta, const double c);
 	double	GetF(const Vector& nStress, const Vector& nAlpha);
+	double	GetF(const VectorN<6>& nStress, const VectorN<6>& nAlpha);
 	double	GetPSI(const double& e, const double& p);
 	double	GetLodeAngle(const Vector& n);
+	double	GetLodeAngle(const VectorN<6>& n);
 	void	GetElasticModuli(const Vector& sigma, const double& en, const double& en1,
 				const Vector& nEStrain, const Vector& cEStrain, double &K, 
 				double &G);
 	void	GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G);
 	void	GetElasticModuli(const Vector& sigma, const double& en, double &K, double &G, const double& D);
 	Matrix	GetStiffness(const double& K, const double& G);
+	void	GetStiffness(const double& K, const double& G, MatrixN<6,6>& C);
 	Matrix	GetCompliance(const double& K, const double& G);
+	void	GetCompliance(const double& K, const double& G, MatrixN<6,6>& D);
 	void	GetStateDependent(const Vector &stress, const Vector &alpha, const Vector &fabric
 				, const double &e, const Vector &alpha_in, Vector &n, Vector &d, Vector &b
 				, double &cos3Theta, double &h, double &psi, double &alphaBtheta
 				, double &alphaDtheta, double &b0, double& A, double& D, double& B
 				, double& C, Vector& R);
+	void	GetStateDependent(const VectorN<6> &stress, const VectorN<6> &alpha, const VectorN<6> &fabric
+				, const double &e, const VectorN<6> &alpha_in, VectorN<6> &n, VectorN<6> &d, VectorN<6> &b
+				, double &cos3Theta, double &h, double &psi, double &alphaBtheta
+				, double &alphaDtheta, double &b0, double& A, double& D, double& B
+				, double& C, VectorN<6>& R);
 	Matrix	GetElastoPlasticTangent(const Vector& NextStress, const double& NextDGamma, const Vector& CurStrain, const Vector& NextStrain,
 				const double& G, const double& K, const double& B, const double& C,const double& D, const double& h, 
 				const Vector& n, const Vector& d, const Vector& b) ;
 	Vector	GetNormalToYield(const Vector &stress, const Vector &alpha);
+	void	GetNormalToYield(const VectorN<6> &stress, const VectorN<6> &alpha, VectorN<6> &n);
 	int	Check(const Vector& TrialStress, const Vector& stress, const Vector& CurAlpha, const Vector& NextAlpha);
 
 	// Symmetric Tensor Operations
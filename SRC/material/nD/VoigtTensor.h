@@ -0,0 +1,173 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/material/nD/VoigtTensor.h,v $
+
+#ifndef VoigtTensor_h
+#define VoigtTensor_h
+
+// Created: 10/26
+//
+// Description: This file contains the class VoigtTensor, the operations
+// on symmetric second order tensors stored as VectorN<6> and fourth order
+// tensors stored as MatrixN<6,6> in the order 11, 22, 33, 12, 23, 13 used
+// by the nD materials. As in those materials a contravariant (stress-like)
+// tensor stores the shear components, a covariant (strain-like) tensor
+// stores twice them. The results are written into arguments, so that a
+// material can keep its return mapping on the stack or in members
+// without any heap allocation; the sums are taken in the same order as the
+// Matrix and Vector operations they replace.
+
+// What: "@(#) VoigtTensor.h, revA"
+
+#include <MatrixN.h>
+#include <math.h>
+
+class VoigtTensor
+{
+  public:
+    // second order identity tensor
+    static void identity(VectorN<6> &I1) {
+      for (int i=0; i<6; i++)
+	I1(i) = i < 3 ? 1.0 : 0.0;
+    }
+
+    // fourth order identity tensor, with shearFact 1.0 for the mixed,
+    // 2.0 for the covariant and 0.5 for the contravariant form
+    static void identity4(MatrixN<6,6> &II, double shearFact) {
+      II.Zero();
+      for (int i=0; i<6; i++)
+	II(i,i) = i < 3 ? 1.0 : shearFact;
+    }
+
+    // fourth order volumetric tensor, IIvol = I1 dyadic I1
+    static void volumetric(MatrixN<6,6> &IIvol) {
+      IIvol.Zero();
+      for (int i=0; i<3; i++)
+	for (int j=0; j<3; j++)
+	  IIvol(i,j) = 1.0;
+    }
+
+    static double trace(const VectorN<6> &a) {
+      return a(0) + a(1) + a(2);
+    }
+
+    // dev = a - 1/3 tr(a) I1
+    static void deviator(const VectorN<6> &a, VectorN<6> &dev) {
+      const double one3 = 1.0/3.0;
+      double p = trace(a);
+      dev = a;
+      for (int i=0; i<3; i++)
+	dev(i) -= one3*p;
+    }
+
+    // a : b, both contravariant
+    static double dotContr(const VectorN<6> &a, const VectorN<6> &b) {
+      double result = 0.0;
+      for (int i=0; i<3; i++)
+	result += a(i)*b(i);
+      for (int i=3; i<6; i++)
+	result += 2.0*a(i)*b(i);
+      return result;
+    }
+
+    // a : b, both covariant
+    static double dotCov(const VectorN<6> &a, const VectorN<6> &b) {
+      double result = 0.0;
+      for (int i=0; i<3; i++)
+	result += a(i)*b(i);
+      for (int i=3; i<6; i++)
+	result += 0.5*a(i)*b(i);
+      return result;
+    }
+
+    // a : b, one contravariant and the other covariant
+    static double dotMixed(const VectorN<6> &a, const VectorN<6> &b) {
+      double result = 0.0;
+      for (int i=0; i<6; i++)
+	result += a(i)*b(i);
+      return result;
+    }
+
+    static double normContr(const VectorN<6> &a) {
+      return sqrt(dotContr(a, a));
+    }
+
+    static double normCov(const VectorN<6> &a) {
+      return sqrt(dotCov(a, a));
+    }
+
+    // result = a . b, all contravariant
+    static void singleDot(const VectorN<6> &a, const VectorN<6> &b, VectorN<6> &result) {
+      result(0) = a(0)*b(0) + a(3)*b(3) + a(5)*b(5);
+      result(1) = a(3)*b(3) + a(1)*b(1) + a(4)*b(4);
+      result(2) = a(5)*b(5) + a(4)*b(4) + a(2)*b(2);
+      result(3) = 0.5*(a(0)*b(3) + a(3)*b(0) + a(3)*b(1) + a(1)*b(3) + a(5)*b(4) + a(4)*b(5));
+      result(4) = 0.5*(a(3)*b(5) + a(5)*b(3) + a(1)*b(4) + a(4)*b(1) + a(4)*b(2) + a(2)*b(4));
+      result(5) = 0.5*(a(0)*b(5) + a(5)*b(0) + a(3)*b(4) + a(4)*b(3) + a(5)*b(2) + a(2)*b(5));
+    }
+
+    // result = a . m, the single dot of a into each column of m, all
+    // contravariant
+    static void singleDot(const VectorN<6> &a, const MatrixN<6,6> &m, MatrixN<6,6> &result) {
+      for (int i=0; i<6; i++) {
+	result(0,i) = m(0,i)*a(0) + m(3,i)*a(3) + m(5,i)*a(5);
+	result(1,i) = m(3,i)*a(3) + m(1,i)*a(1) + m(4,i)*a(4);
+	result(2,i) = m(5,i)*a(5) + m(4,i)*a(4) + m(2,i)*a(2);
+	result(3,i) = 0.5*(m(0,i)*a(3) + m(3,i)*a(1) + m(5,i)*a(4)
+			   + m(3,i)*a(0) + m(1,i)*a(3) + m(4,i)*a(5));
+	result(4,i) = 0.5*(m(3,i)*a(5) + m(1,i)*a(4) + m(4,i)*a(2)
+			   + m(5,i)*a(3) + m(4,i)*a(1) + m(2,i)*a(4));
+	result(5,i) = 0.5*(m(0,i)*a(5) + m(3,i)*a(4) + m(5,i)*a(2)
+			   + m(5,i)*a(0) + m(4,i)*a(3) + m(2,i)*a(5));
+      }
+    }
+
+    // result = a dyadic b
+    static void dyadic(const VectorN<6> &a, const VectorN<6> &b, MatrixN<6,6> &result) {
+      for (int j=0; j<6; j++)
+	for (int i=0; i<6; i++)
+	  result(i,j) = a(i)*b(j);
+    }
+
+    // result = m : a
+    static void dot(const MatrixN<6,6> &m, const VectorN<6> &a, VectorN<6> &result) {
+      result.addMatrixVector(0.0, m, a, 1.0);
+    }
+
+    // result = a : m
+    static void dot(const VectorN<6> &a, const MatrixN<6,6> &m, VectorN<6> &result) {
+      for (int j=0; j<6; j++) {
+	double sum = 0.0;
+	for (int i=0; i<6; i++)
+	  sum += a(i)*m(i,j);
+	result(j) = sum;
+      }
+    }
+
+    // result = m1 : m2
+    static void dot(const MatrixN<6,6> &m1, const MatrixN<6,6> &m2, MatrixN<6,6> &result) {
+      result.addMatrixProduct(0.0, m1, m2, 1.0);
+    }
+};
+
+#endif
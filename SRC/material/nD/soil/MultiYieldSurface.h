@@ -29,7 +29,9 @@ public:
   MultiYieldSurface();
   MultiYieldSurface(const Vector & center_init, double size_init, 
                     double plas_modul); 
+  MultiYieldSurface(const MultiYieldSurface &);
   ~MultiYieldSurface();
+  MultiYieldSurface &operator=(const MultiYieldSurface &);
 	void setData(const Vector & center_init, double size_init, 
                double plas_modul); 
   const Vector & center() const {return theCenter; }
@@ -44,6 +46,7 @@ protected:
 
 private:
   double theSize;
+  double centerData[6];  // kept in the object so arrays of surfaces are contiguous
   Vector theCenter;  
   double plastShearModulus;
 
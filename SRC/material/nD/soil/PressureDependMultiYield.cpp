@@ -383,6 +383,7 @@ PressureDependMultiYield::PressureDependMultiYield (int tag, int nd,
   initPress = refPressurex[matN];
 
   e2p = committedActiveSurf = activeSurfaceNum = 0;
+  subStepOnCrossing = 0;
   onPPZCommitted = onPPZ = -1 ;
   PPZSizeCommitted = PPZSize = 0.;
   pressureDCommitted = pressureD = modulusFactor = 0.;
@@ -408,7 +409,7 @@ PressureDependMultiYield::PressureDependMultiYield ()
   PPZPivotCommitted(), PPZCenterCommitted(),
   lockStressCommitted(), theSurfaces(0), committedSurfaces(0)
 {
-  //does nothing
+  subStepOnCrossing = 0;
 }
 
 PressureDependMultiYield::PressureDependMultiYield (const PressureDependMultiYield & a)
@@ -426,6 +427,7 @@ PressureDependMultiYield::PressureDependMultiYield (const PressureDependMultiYie
   int numOfSurfaces = numOfSurfacesx[matN];
 
   e2p = a.e2p;
+  subStepOnCrossing = a.subStepOnCrossing;
   strainPTOcta = a.strainPTOcta;
   modulusFactor = a.modulusFactor;
   activeSurfaceNum = a.activeSurfaceNum;
@@ -921,6 +923,8 @@ int PressureDependMultiYield::setParameter(const char **argv, int argc, Paramete
     else if (strcmp(argv[0],"bulkModulus") == 0) {
       return param.addObject(11, this);
     }
+    else if (strcmp(argv[0],"subStepOnCrossing") == 0)
+      return param.addObject(14, this);
   }
 
   return -1;
@@ -944,6 +948,9 @@ PressureDependMultiYield::updateParameter(int responseID, Information &info)
     refBulkModulusx[matN]=info.theDouble;
   }
 
+  else if (responseID==14)
+    subStepOnCrossing = (info.theDouble != 0.0) ? 1 : 0;
+
   // used by BBarFourNodeQuadUP element
   else if (responseID==20 && ndmx[matN] == 2)
 		ndmx[matN] = 0;
@@ -1884,10 +1891,14 @@ PressureDependMultiYield::setSubStrainRate(void)
   int numOfSub = totalCross/singleCross + 1;
   if (numOfSub > numOfSurfaces) numOfSub = numOfSurfaces;
 
-  int numOfSub1 = strainRate.octahedralShear(1) / 1.0e-4;
-  int numOfSub2 = strainRate.volume() / 1.e-5;
-  if (numOfSub1 > numOfSub) numOfSub = numOfSub1;
-  if (numOfSub2 > numOfSub) numOfSub = numOfSub2;
+  // unless limited to the surfaces crossed, the strain increment of a
+  // sub-step is also limited
+  if (subStepOnCrossing == 0) {
+    int numOfSub1 = strainRate.octahedralShear(1) / 1.0e-4;
+    int numOfSub2 = strainRate.volume() / 1.e-5;
+    if (numOfSub1 > numOfSub) numOfSub = numOfSub1;
+    if (numOfSub2 > numOfSub) numOfSub = numOfSub2;
+  }
 
   workV6.addVector(0.0, strainRate.t2Vector(), 1.0/numOfSub);
 
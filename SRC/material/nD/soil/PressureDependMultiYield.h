@@ -152,6 +152,7 @@ private:
      
 	 int matN;
      int e2p;
+     int subStepOnCrossing; // sub-step only by the number of surfaces crossed
      MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used  
      MultiYieldSurface * committedSurfaces;  
      int    activeSurfaceNum;  
@@ -19,6 +19,7 @@
 #include <Parameter.h>
 #include <string.h>
 #include <elementAPI.h>
+#include <Workspace.h>
 
 int PressureDependMultiYield02::matCount=0;
 int* PressureDependMultiYield02::loadStagex = 0;  //=0 if elastic; =1 if plastic
@@ -52,11 +53,9 @@ double* PressureDependMultiYield02::Pvx=0;
 
 double PressureDependMultiYield02::pAtm = 101.;
 
-Matrix PressureDependMultiYield02::theTangent(6,6);
-T2Vector PressureDependMultiYield02::trialStrain;
-T2Vector PressureDependMultiYield02::subStrainRate;
-Vector PressureDependMultiYield02::workV6(6);
-T2Vector PressureDependMultiYield02::workT2V;
+// the matrix and vector returned by getTangent() and getStress() in 2d
+static char workMKey;
+static char workVKey;
 const	double pi = 3.14159265358979;
 
 //double check;
@@ -192,10 +191,11 @@ PressureDependMultiYield02::PressureDependMultiYield02 (int tag, int nd,
 						    double volLim1, double volLim2, double volLim3,
 						    double atm, double cohesi,
 							double hv, double pv)
- : NDMaterial(tag,ND_TAG_PressureDependMultiYield02), currentStress(),
-   trialStress(), updatedTrialStress(), currentStrain(), strainRate(),
+ : NDMaterial(tag,ND_TAG_PressureDependMultiYield02), theTangent(6,6),
+   currentStress(), trialStress(), updatedTrialStress(), currentStrain(), strainRate(),
    PPZPivot(), PPZCenter(), PPZPivotCommitted(), PPZCenterCommitted(),
-   PivotStrainRate(6), PivotStrainRateCommitted(6), check(0)
+   PivotStrainRate(6), PivotStrainRateCommitted(6), check(0),
+   workV6(6)
 {
   if (nd !=2 && nd !=3) {
     opserr << "FATAL:PressureDependMultiYield02:: dimension error" << endln;
@@ -409,6 +409,7 @@ PressureDependMultiYield02::PressureDependMultiYield02 (int tag, int nd,
   initPress = refPressurex[matN];
 
   e2p = committedActiveSurf = activeSurfaceNum = 0;
+  subStepOnCrossing = 0;
   onPPZCommitted = onPPZ = -1 ;
   PPZSizeCommitted = PPZSize = 0.;
   pressureDCommitted = pressureD = modulusFactor = 0.;
@@ -429,28 +430,31 @@ PressureDependMultiYield02::PressureDependMultiYield02 (int tag, int nd,
 
 
 PressureDependMultiYield02::PressureDependMultiYield02 ()
- : NDMaterial(0,ND_TAG_PressureDependMultiYield02),
+ : NDMaterial(0,ND_TAG_PressureDependMultiYield02), theTangent(6,6),
    currentStress(), trialStress(), currentStrain(),
   strainRate(), PPZPivot(), PPZCenter(), PivotStrainRate(6), PivotStrainRateCommitted(6),
-  PPZPivotCommitted(), PPZCenterCommitted(), theSurfaces(0), committedSurfaces(0)
+  PPZPivotCommitted(), PPZCenterCommitted(), theSurfaces(0), committedSurfaces(0),
+  workV6(6)
 {
-  //does nothing
+  subStepOnCrossing = 0;
 }
 
 
 PressureDependMultiYield02::PressureDependMultiYield02 (const PressureDependMultiYield02 & a)
- : NDMaterial(a.getTag(),ND_TAG_PressureDependMultiYield02),
+ : NDMaterial(a.getTag(),ND_TAG_PressureDependMultiYield02), theTangent(6,6),
    currentStress(a.currentStress), trialStress(a.trialStress),
   currentStrain(a.currentStrain), strainRate(a.strainRate), check(0),
   PPZPivot(a.PPZPivot), PPZCenter(a.PPZCenter), updatedTrialStress(a.updatedTrialStress),
   PPZPivotCommitted(a.PPZPivotCommitted), PPZCenterCommitted(a.PPZCenterCommitted),
-  PivotStrainRate(a.PivotStrainRate), PivotStrainRateCommitted(a.PivotStrainRateCommitted)
+  PivotStrainRate(a.PivotStrainRate), PivotStrainRateCommitted(a.PivotStrainRateCommitted),
+  workV6(6)
 {
   matN = a.matN;
 
   int numOfSurfaces = numOfSurfacesx[matN];
 
   e2p = a.e2p;
+  subStepOnCrossing = a.subStepOnCrossing;
   strainPTOcta = a.strainPTOcta;
   modulusFactor = a.modulusFactor;
   activeSurfaceNum = a.activeSurfaceNum;
@@ -704,7 +708,7 @@ const Matrix & PressureDependMultiYield02::getTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    Matrix &workM = Workspace::getMatrix(&workMKey, 3, 3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -768,7 +772,7 @@ const Matrix & PressureDependMultiYield02::getInitialTangent (void)
   if (ndm==3)
     return theTangent;
   else {
-    static Matrix workM(3,3);
+    Matrix &workM = Workspace::getMatrix(&workMKey, 3, 3);
     workM(0,0) = theTangent(0,0);
     workM(0,1) = theTangent(0,1);
     workM(0,2) = 0.;
@@ -888,7 +892,7 @@ const Vector & PressureDependMultiYield02::getStress (void)
   if (ndm==3)
     return trialStress.t2Vector();
   else {
-	static Vector workV(3);
+	Vector &workV = Workspace::getVector(&workVKey, 3);
     workV[0] = trialStress.t2Vector()[0];
     workV[1] = trialStress.t2Vector()[1];
     workV[2] = trialStress.t2Vector()[3];
@@ -1023,6 +1027,8 @@ int PressureDependMultiYield02::setParameter(const char **argv, int argc, Parame
       return param.addObject(12, this);
     } else if (strcmp(argv[0],"cohesion") == 0) {
       return param.addObject(13, this);
+    } else if (strcmp(argv[0],"subStepOnCrossing") == 0) {
+      return param.addObject(14, this);
     }
   }
   return -1;
@@ -1045,6 +1051,8 @@ int PressureDependMultiYield02::updateParameter(int responseID, Information &inf
     cohesionx[matN] = info.theDouble;
     setUpSurfaces(mGredu);
     initSurfaceUpdate();
+  } else if (responseID==14) {
+    subStepOnCrossing = (info.theDouble != 0.0) ? 1 : 0;
   }
 
   // used by BBarFourNodeQuadUP element
@@ -1876,7 +1884,8 @@ void PressureDependMultiYield02::deviatorScaling(T2Vector & stress,
   if ( surfaceNum < numOfSurfaces && diff < 0. ) {
     double sz = -surfaces[surfaceNum].size()*coneHeight;
     double deviaSz = sqrt(sz*sz + diff);
-    static Vector devia(6);
+    double deviaData[6];
+    Vector devia(deviaData, 6);
     devia = stress.deviator();
     workV6 = devia;
     workV6.addVector(1.0, surfaces[surfaceNum].center(), -coneHeight);
@@ -1906,7 +1915,8 @@ void PressureDependMultiYield02::initSurfaceUpdate(void)
   if (committedActiveSurf == 0) return;
 
   double coneHeight = - (currentStress.volume() - residualPress);
-  static Vector devia(6);
+  double deviaData[6];
+  Vector devia(deviaData, 6);
   devia = currentStress.deviator();
   double Ms = sqrt(3./2.*(devia && devia));
 
@@ -2048,10 +2058,14 @@ int PressureDependMultiYield02::setSubStrainRate(void)
   int numOfSub = totalCross/singleCross + 1;
   if (numOfSub > numOfSurfaces) numOfSub = numOfSurfaces;
 
-  int numOfSub1 = strainRate.octahedralShear(1) / 1.0e-5;
-  int numOfSub2 = strainRate.volume() / 1.e-5;
-  if (numOfSub1 > numOfSub) numOfSub = numOfSub1;
-  if (numOfSub2 > numOfSub) numOfSub = numOfSub2;
+  // unless limited to the surfaces crossed, the strain increment of a
+  // sub-step is also limited
+  if (subStepOnCrossing == 0) {
+    int numOfSub1 = strainRate.octahedralShear(1) / 1.0e-5;
+    int numOfSub2 = strainRate.volume() / 1.e-5;
+    if (numOfSub1 > numOfSub) numOfSub = numOfSub1;
+    if (numOfSub2 > numOfSub) numOfSub = numOfSub2;
+  }
 
   workV6.addVector(0.0, strainRate.t2Vector(), 1.0/numOfSub);
 
@@ -2067,7 +2081,8 @@ PressureDependMultiYield02::getContactStress(T2Vector &contactStress)
     double residualPress = residualPressx[matN];
 
   double conHeig = trialStress.volume() - residualPress;
-  static Vector center(6);
+  double centerData[6];
+  Vector center(centerData, 6);
   center = theSurfaces[activeSurfaceNum].center();
   //workV6 = trialStress.deviator() - center*conHeig;
   workV6 = trialStress.deviator();
@@ -2104,7 +2119,8 @@ PressureDependMultiYield02::getSurfaceNormal(const T2Vector & stress, T2Vector &
 
   double conHeig = stress.volume() - residualPress;
   workV6 = stress.deviator();
-  static Vector center(6);
+  double centerData[6];
+  Vector center(centerData, 6);
   center = theSurfaces[activeSurfaceNum].center();
   double sz = theSurfaces[activeSurfaceNum].size();
   double volume = conHeig*((center && center) - 2./3.*sz*sz) - (workV6 && center);
@@ -2159,11 +2175,15 @@ double PressureDependMultiYield02::getPlasticPotential(const T2Vector & contactS
       else {
          workV6 = trialStress.deviator();
 		 workV6 /= (fabs(trialStress.volume())+fabs(residualPress));
-		 workV6	-= updatedTrialStress.deviator()/(fabs(updatedTrialStress.volume())+fabs(residualPress));
+		 double deviaData[6];
+		 Vector devia(deviaData, 6);
+		 devia = updatedTrialStress.deviator();
+		 devia /= (fabs(updatedTrialStress.volume())+fabs(residualPress));
+		 workV6 -= devia;
 		 //workV6	-= currentStress.deviator()/(fabs(currentStress.volume())+fabs(residualPress));
 		 //workV6.Normalize();
 		 //angle = updatedTrialStress.unitDeviator() && workV6;
-		 workT2V = T2Vector(workV6);
+		 workT2V.setData(workV6);
 		 if (workT2V.deviatorLength() == 0.) angle = 1.0;
 		 //angle = (currentStress.deviator() && workV6)/workT2V.deviatorLength()/currentStress.deviatorLength();
 		 else angle = (updatedTrialStress.deviator() && workV6)/workT2V.deviatorLength()/updatedTrialStress.deviatorLength();
@@ -2458,9 +2478,9 @@ int PressureDependMultiYield02::stressCorrection(int crossedSurface)
     double refShearModulus = refShearModulusx[matN];
 	double refBulkModulus = refBulkModulusx[matN];
 
-  static T2Vector contactStress;
+  T2Vector contactStress;
   getContactStress(contactStress);
-  static T2Vector surfNormal;
+  T2Vector surfNormal;
   getSurfaceNormal(contactStress, surfNormal);
   double plasticPotential = getPlasticPotential(contactStress,surfNormal);
   double tVolume = trialStress.volume();
@@ -2508,10 +2528,14 @@ void PressureDependMultiYield02::updateActiveSurface(void)
   if (activeSurfaceNum == numOfSurfaces) return;
 
   double A, B, C, X;
-  static Vector t1(6);
-  static Vector t2(6);
-  static Vector center(6);
-  static Vector outcenter(6);
+  double t1Data[6];
+  Vector t1(t1Data, 6);
+  double t2Data[6];
+  Vector t2(t2Data, 6);
+  double centerData[6];
+  Vector center(centerData, 6);
+  double outcenterData[6];
+  Vector outcenter(outcenterData, 6);
   double conHeig = trialStress.volume() - residualPress;
   center = theSurfaces[activeSurfaceNum].center();
   double size = theSurfaces[activeSurfaceNum].size();
@@ -2583,8 +2607,10 @@ void PressureDependMultiYield02::updateInnerSurface(void)
     double residualPress = residualPressx[matN];
 
 	if (activeSurfaceNum <= 1) return;
-	static Vector devia(6);
-	static Vector center(6);
+	double deviaData[6];
+	Vector devia(deviaData, 6);
+	double centerData[6];
+	Vector center(centerData, 6);
 
 	double conHeig = currentStress.volume() - residualPress;
 	devia = currentStress.deviator();
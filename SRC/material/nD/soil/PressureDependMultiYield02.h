@@ -155,11 +155,12 @@ private:
      // internal
      static double* residualPressx;
      static double* stressRatioPTx;
-     static Matrix theTangent;
+     Matrix theTangent;
      double * mGredu;
 
 	 int matN;
      int e2p;
+     int subStepOnCrossing; // sub-step only by the number of surfaces crossed
      MultiYieldSurface * theSurfaces; // NOTE: surfaces[0] is not used
      MultiYieldSurface * committedSurfaces;
      int    activeSurfaceNum;
@@ -173,7 +174,7 @@ private:
      T2Vector updatedTrialStress;
      T2Vector currentStrain;
      T2Vector strainRate;
-     static T2Vector subStrainRate;
+     T2Vector subStrainRate;
 
      double pressureD;
      int onPPZ; //=-1 never reach PPZ before; =0 below PPZ; =1 on PPZ; =2 above PPZ
@@ -184,7 +185,7 @@ private:
      double cumuTranslateStrainOcta;
      double prePPZStrainOcta;
      double oppoPrePPZStrainOcta;
-     static T2Vector trialStrain;
+     T2Vector trialStrain;
      T2Vector PPZPivot;
      T2Vector PPZCenter;
 	 Vector PivotStrainRate;
@@ -200,8 +201,10 @@ private:
      T2Vector PPZPivotCommitted;
      T2Vector PPZCenterCommitted;
 	 Vector PivotStrainRateCommitted;
-     static Vector workV6;
-     static T2Vector workT2V;
+     // work storage of the state determination, kept by each material
+     // so that materials may be evaluated in parallel
+     Vector workV6;
+     T2Vector workT2V;
 	 double maxPress;
 
      void elast2Plast(void);
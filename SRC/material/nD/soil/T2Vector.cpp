@@ -15,10 +15,13 @@
 #include <stdlib.h>
 #include <T2Vector.h>
 #include <Matrix.h>
+#include <Workspace.h>
 
 
 
-Vector T2Vector::engrgStrain(6);
+// the vector returned by the engineering strain and unit vector methods;
+// it is kept per thread so materials may be evaluated in parallel
+static char engrgStrainKey;
 
 double operator && (const Vector & a, const Vector & b)
 {
@@ -30,7 +33,7 @@ double operator && (const Vector & a, const Vector & b)
   double result = 0.;  
 
   for (int i=0; i<3; i++)
-    result += a[i]*b[i] + 2*a[i+3]*b[i+3];
+    result += a(i)*b(i) + 2*a(i+3)*b(i+3);
   return result;
 }
 
@@ -46,7 +49,7 @@ void doubledotProduct (Vector & c, const Vector & a, const Matrix & b)
   c.Zero();
   for(int j=0;j<6;j++){
 	  for (int i=0; i<3; i++){
-		c[j] += a[i]*b(i,j) + 2*a[i+3]*b(i+3,j);
+		c(j) += a(i)*b(i,j) + 2*a(i+3)*b(i+3,j);
 	  }
   }
   return;
@@ -85,7 +88,7 @@ void tensorProduct(Matrix & c, const Vector & a, const Vector & b)
   c.Zero();
   for(int j=0;j<6;j++){
 	  for (int i=0; i<6; i++){
-		c(i,j) = a[i]*b[j];
+		c(i,j) = a(i)*b(j);
 	  }
   }
   return;
@@ -99,50 +102,34 @@ double delta(int i,int j){
 
 // T2Vector class methods
 T2Vector::T2Vector() 
-:theT2Vector(6), theDeviator(6), theVolume(0.0)
+:theT2Vector(t2VectorData, 6), theDeviator(deviatorData, 6), theVolume(0.0)
 {
-	
+  for (int i=0; i<6; i++)
+    t2VectorData[i] = deviatorData[i] = 0.0;
 }
 
 
 T2Vector::T2Vector(const Vector &init, int isEngrgStrain)
-:theT2Vector(6), theDeviator(6), theVolume(0)
+:theT2Vector(t2VectorData, 6), theDeviator(deviatorData, 6), theVolume(0)
 {
-  if (init.Size() != 6) {
-    opserr << "FATAL:T2Vector::T2Vector(Vector &): vector size not equal to 6" << endln;
-    exit(-1);
-  }
-  theT2Vector = init;
-
-  theVolume = (theT2Vector[0]+theT2Vector[1]+theT2Vector[2])/3.0;
-  for(int i=0; i<3; i++){
-    theDeviator[i] = theT2Vector[i] - theVolume;
-    theDeviator[i+3] = theT2Vector[i+3];
-    if (isEngrgStrain==1) {
-      theDeviator[i+3] /= 2.;
-      theT2Vector[i+3] /= 2.;
-    }
-  }
+  this->setData(init, isEngrgStrain);
 }
 
 
 
 T2Vector::T2Vector(const Vector & deviat_init, double volume_init)
- : theT2Vector(6), theDeviator(6), theVolume(volume_init)
+ : theT2Vector(t2VectorData, 6), theDeviator(deviatorData, 6), theVolume(volume_init)
 {
-  if (deviat_init.Size() != 6) {
-    opserr << "FATAL:T2Vector::T2Vector(Vector &, double): vector size not equal 6" << endln;
-    exit(-1);
-  }
+  this->setData(deviat_init, volume_init);
+}
 
-  //make sure the deviator has truely volume=0 
-  double devolum = (deviat_init[0]+deviat_init[1]+deviat_init[2])/3.;
 
-  for(int i=0; i<3; i++){
-    theDeviator[i] = deviat_init[i] - devolum;
-    theDeviator[i+3] = deviat_init[i+3];
-    theT2Vector[i] = theDeviator[i] + theVolume;
-    theT2Vector[i+3] = theDeviator[i+3]; 
+T2Vector::T2Vector(const T2Vector &a)
+ : theT2Vector(t2VectorData, 6), theDeviator(deviatorData, 6), theVolume(a.theVolume)
+{
+  for (int i=0; i<6; i++) {
+    t2VectorData[i] = a.t2VectorData[i];
+    deviatorData[i] = a.deviatorData[i];
   }
 }
 
@@ -153,6 +140,19 @@ T2Vector::~T2Vector()
 }
 
 
+T2Vector &
+T2Vector::operator=(const T2Vector &a)
+{
+  for (int i=0; i<6; i++) {
+    t2VectorData[i] = a.t2VectorData[i];
+    deviatorData[i] = a.deviatorData[i];
+  }
+  theVolume = a.theVolume;
+
+  return *this;
+}
+
+
 void
 T2Vector::setData(const Vector &init, int isEngrgStrain)
 {
@@ -160,15 +160,16 @@ T2Vector::setData(const Vector &init, int isEngrgStrain)
     opserr << "FATAL:T2Vector::T2Vector(Vector &): vector size not equal to 6" << endln;
     exit(-1);
   }
-  theT2Vector = init;
+  for (int i=0; i<6; i++)
+    t2VectorData[i] = init(i);
 
-  theVolume = (theT2Vector[0]+theT2Vector[1]+theT2Vector[2])/3.0;
+  theVolume = (t2VectorData[0]+t2VectorData[1]+t2VectorData[2])/3.0;
   for(int i=0; i<3; i++){
-    theDeviator[i] = theT2Vector[i] - theVolume;
-    theDeviator[i+3] = theT2Vector[i+3];
+    deviatorData[i] = t2VectorData[i] - theVolume;
+    deviatorData[i+3] = t2VectorData[i+3];
     if (isEngrgStrain==1) {
-      theDeviator[i+3] /= 2.;
-      theT2Vector[i+3] /= 2.;
+      deviatorData[i+3] /= 2.;
+      t2VectorData[i+3] /= 2.;
     }
   }
 }
@@ -184,13 +185,13 @@ T2Vector::setData(const Vector & deviat, double volume)
   }
 
   //make sure the deviator has truely volume=0 
-  double devolum = (deviat[0]+deviat[1]+deviat[2])/3.;
+  double devolum = (deviat(0)+deviat(1)+deviat(2))/3.;
 
   for(int i=0; i<3; i++){
-    theDeviator[i] = deviat[i] - devolum;
-    theDeviator[i+3] = deviat[i+3];
-    theT2Vector[i] = theDeviator[i] + theVolume;
-    theT2Vector[i+3] = theDeviator[i+3]; 
+    deviatorData[i] = deviat(i) - devolum;
+    deviatorData[i+3] = deviat(i+3);
+    t2VectorData[i] = deviatorData[i] + theVolume;
+    t2VectorData[i+3] = deviatorData[i+3]; 
   }
 }
 
@@ -199,9 +200,10 @@ T2Vector::t2Vector(int isEngrgStrain) const
 {
   if (isEngrgStrain==0) return theT2Vector;
 
+  Vector &engrgStrain = Workspace::getVector(&engrgStrainKey, 6);
   engrgStrain = theT2Vector;
   for(int i=0; i<3; i++){
-    engrgStrain[i+3] *= 2.;
+    engrgStrain(i+3) *= 2.;
   }
   return engrgStrain;
 }
@@ -211,9 +213,10 @@ const Vector & T2Vector::deviator(int isEngrgStrain) const
 {
   if (isEngrgStrain==0) return theDeviator;
 
+  Vector &engrgStrain = Workspace::getVector(&engrgStrainKey, 6);
   engrgStrain = theDeviator;
   for(int i=0; i<3; i++){
-    engrgStrain[i+3] *= 2.;
+    engrgStrain(i+3) *= 2.;
   }
   return engrgStrain;
 }
@@ -257,6 +260,7 @@ T2Vector::deviatorRatio(double residualPress) const
 const Vector &
 T2Vector::unitT2Vector() const
 {
+  Vector &engrgStrain = Workspace::getVector(&engrgStrainKey, 6);
   engrgStrain = theT2Vector;	
   double length = this->t2VectorLength();
   if (length <= LOW_LIMIT) {
@@ -273,6 +277,7 @@ const Vector &
 T2Vector::unitDeviator() const
 {
 
+  Vector &engrgStrain = Workspace::getVector(&engrgStrainKey, 6);
   engrgStrain = theDeviator;;	
   double length = this->deviatorLength();
   if (length <= LOW_LIMIT) {
@@ -321,7 +326,7 @@ int
 T2Vector::operator == (const T2Vector & a) const
 {
   for(int i=0; i<6; i++)
-    if(theT2Vector[i] != a.theT2Vector[i]) return 0;
+    if(t2VectorData[i] != a.t2VectorData[i]) return 0;
 
   return 1;
 }
@@ -330,7 +335,7 @@ int
 T2Vector::isZero(void) const
 {
   for(int i=0; i<6; i++)
-    if(theT2Vector[i] != 0.0) return 0;
+    if(t2VectorData[i] != 0.0) return 0;
 
   return 1;
 }
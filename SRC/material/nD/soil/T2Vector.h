@@ -46,9 +46,12 @@ public:
   T2Vector();
   T2Vector(const Vector & T2Vector_init, int isEngrgStrain=0);
   T2Vector(const Vector & deviat_init, double volume_init);
+  T2Vector(const T2Vector &);
   
   ~T2Vector();
 
+  T2Vector &operator=(const T2Vector &);
+
   void setData(const Vector &init, int isEngrgStrain =0);
   void setData(const Vector &deviat, double volume);
 
@@ -78,10 +81,12 @@ public:
 protected:
 
 private:
+  // the components are kept in the object, the Vectors only refer to them
+  double t2VectorData[6];
+  double deviatorData[6];
   Vector theT2Vector;
   Vector theDeviator;
   double theVolume;
-  static Vector engrgStrain;
 };
 
 
@@ -62,7 +62,7 @@ void* OPS_ElasticSection2d()
 
 ElasticSection2d::ElasticSection2d(void)
 :SectionForceDeformation(0, SEC_TAG_Elastic2d),
- E(0.0), A(0.0), I(0.0), e(2)
+ E(0.0), A(0.0), I(0.0), e(2), parameterUpdated(false)
 {
   if (code(0) != SECTION_RESPONSE_P) {
     code(0) = SECTION_RESPONSE_P;	// P is the first quantity
@@ -73,7 +73,7 @@ ElasticSection2d::ElasticSection2d(void)
 ElasticSection2d::ElasticSection2d
 (int tag, double E_in, double A_in, double I_in)
 :SectionForceDeformation(tag, SEC_TAG_Elastic2d),
- E(E_in), A(A_in), I(I_in), e(2)
+ E(E_in), A(A_in), I(I_in), e(2), parameterUpdated(false)
 {
   if (E <= 0.0)  {
     //opserr << "ElasticSection2d::ElasticSection2d -- Input E <= 0.0\n";
@@ -175,6 +175,14 @@ ElasticSection2d::getInitialFlexibility(void)
   return ks;
 }
 
+// the flexibility does not depend on the deformations, so once formed it
+// can be reused until a parameter changes
+bool
+ElasticSection2d::isLinear(void)
+{
+  return parameterUpdated == false;
+}
+
 SectionForceDeformation*
 ElasticSection2d::getCopy(void)
 {
@@ -280,6 +288,10 @@ ElasticSection2d::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticSection2d::updateParameter(int paramID, Information &info)
 {
+  // the flexibility an element may have kept is no longer valid
+  if (paramID == 1 || paramID == 2 || paramID == 3)
+    parameterUpdated = true;
+
   if (paramID == 1)
     E = info.theDouble;
   if (paramID == 2)
@@ -54,6 +54,7 @@ class ElasticSection2d: public SectionForceDeformation
   const Matrix &getInitialTangent(void);
   const Matrix &getSectionFlexibility(void);
   const Matrix &getInitialFlexibility(void);
+  bool isLinear(void);
   
   SectionForceDeformation *getCopy(void);
   const ID &getType(void);
@@ -88,6 +89,7 @@ class ElasticSection2d: public SectionForceDeformation
   static ID code;
   
   int parameterID;
+  bool parameterUpdated;  // properties changed since the section was formed
 };
 
 #endif
@@ -63,7 +63,7 @@ void* OPS_ElasticSection3d()
 
 ElasticSection3d::ElasticSection3d(void)
 :SectionForceDeformation(0, SEC_TAG_Elastic3d),
- E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0), e(4)
+ E(0.0), A(0.0), Iz(0.0), Iy(0.0), G(0.0), J(0.0), e(4), parameterUpdated(false)
 {
   if (code(0) != SECTION_RESPONSE_P) {
     code(0) = SECTION_RESPONSE_P;	// P is the first quantity
@@ -76,7 +76,7 @@ ElasticSection3d::ElasticSection3d(void)
 ElasticSection3d::ElasticSection3d
 (int tag, double E_in, double A_in, double Iz_in, double Iy_in, double G_in, double J_in)
 :SectionForceDeformation(tag, SEC_TAG_Elastic3d),
- E(E_in), A(A_in), Iz(Iz_in), Iy(Iy_in), G(G_in), J(J_in), e(4)
+ E(E_in), A(A_in), Iz(Iz_in), Iy(Iy_in), G(G_in), J(J_in), e(4), parameterUpdated(false)
 {
   if (E <= 0.0)  {
     //opserr << "ElasticSection3d::ElasticSection3d -- Input E <= 0.0\n";
@@ -202,6 +202,14 @@ ElasticSection3d::getInitialFlexibility (void)
   return ks;
 }
 
+// the flexibility does not depend on the deformations, so once formed it
+// can be reused until a parameter changes
+bool
+ElasticSection3d::isLinear(void)
+{
+  return parameterUpdated == false;
+}
+
 SectionForceDeformation*
 ElasticSection3d::getCopy ()
 {
@@ -331,6 +339,10 @@ ElasticSection3d::setParameter(const char **argv, int argc, Parameter &param)
 int
 ElasticSection3d::updateParameter(int paramID, Information &info)
 {
+  // the flexibility an element may have kept is no longer valid
+  if (paramID >= 1 && paramID <= 6)
+    parameterUpdated = true;
+
   if (paramID == 1)
     E = info.theDouble;
   if (paramID == 2)
@@ -56,6 +56,7 @@ class ElasticSection3d : public SectionForceDeformation
   const Matrix &getInitialTangent(void);
   const Matrix &getSectionFlexibility(void);
   const Matrix &getInitialFlexibility(void);
+  bool isLinear(void);
   
   SectionForceDeformation *getCopy(void);
   const ID &getType(void);
@@ -87,6 +88,7 @@ class ElasticSection3d : public SectionForceDeformation
   static ID code;
 
   int parameterID;
+  bool parameterUpdated;  // properties changed since the section was formed
 };
 
 #endif
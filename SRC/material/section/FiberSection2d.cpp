@@ -44,8 +44,18 @@
 #include <MaterialResponse.h>
 #include <UniaxialMaterial.h>
 #include <SectionIntegration.h>
+#include <Workspace.h>
 #include <elementAPI.h>
 
+// keys identifying the fiber data each thread obtains from Workspace
+static char fiberLocsKey;
+static char fiberAreaKey;
+static char locsDerivKey;
+static char areaDerivKey;
+static char fiberStrainKey;
+static char fiberStressKey;
+static char fiberTangentKey;
+
 ID FiberSection2d::code(2);
 
 void* OPS_FiberSection2d()
@@ -67,7 +77,7 @@ void* OPS_FiberSection2d()
 // constructors:
 FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers > 0) {
@@ -124,7 +134,7 @@ FiberSection2d::FiberSection2d(int tag, int num, Fiber **fibers):
 // allocate memory for fibers
 FiberSection2d::FiberSection2d(int tag, int num): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
-  numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(0), sizeFibers(num), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
     if(sizeFibers > 0) {
@@ -167,7 +177,7 @@ FiberSection2d::FiberSection2d(int tag, int num):
 FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si):
   SectionForceDeformation(tag, SEC_TAG_FiberSection2d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   if (numFibers != 0) {
@@ -191,10 +201,10 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double fiberLocs[10000];
+  double *fiberLocs = Workspace::getDoubles(&fiberLocsKey, numFibers);
   sectionIntegr->getFiberLocations(numFibers, fiberLocs);
   
-  static double fiberArea[10000];
+  double *fiberArea = Workspace::getDoubles(&fiberAreaKey, numFibers);
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
 
   for (int i = 0; i < numFibers; i++) {
@@ -230,7 +240,7 @@ FiberSection2d::FiberSection2d(int tag, int num, UniaxialMaterial **mats,
 // constructor for blank object that recvSelf needs to be invoked upon
 FiberSection2d::FiberSection2d():
   SectionForceDeformation(0, SEC_TAG_FiberSection2d),
-  numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
+  numFibers(0), sizeFibers(0), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), ABar(0.0), yBar(0.0), sectionIntegr(0), e(2), s(0), ks(0), dedh(2)
 {
   s = new Vector(sData, 2);
@@ -252,42 +262,11 @@ int
 FiberSection2d::addFiber(Fiber &newFiber)
 {
   // need to create larger arrays
-  if(numFibers == sizeFibers) {
-      int newsize = 2*sizeFibers;
-      if(newsize == 0) newsize = 30;
-      UniaxialMaterial **newArray = new UniaxialMaterial *[newsize]; 
-      double *newMatData = new double [2 * newsize];
-      if (newArray == 0 || newMatData == 0) {
-	  opserr <<"FiberSection2d::addFiber -- failed to allocate Fiber pointers\n";
-	  return -1;
-      }
-
-      // copy the old pointers and data
-      int i;
-      for (i = 0; i < sizeFibers; i++) {
-	  newArray[i] = theMaterials[i];
-	  newMatData[2*i] = matData[2*i];
-	  newMatData[2*i+1] = matData[2*i+1];
-      }
-
-      // initialize new memory
-      for(i = sizeFibers; i<newsize; i++) {
-	  newArray[i] = 0;
-	  newMatData[2*i] = 0.0;
-	  newMatData[2*i+1] = 0.0;
-      }
-
-      sizeFibers = newsize;
-
-      // set new memory
-      if (theMaterials != 0) {
-	  delete [] theMaterials;
-	  delete [] matData;
-      }
-
-      theMaterials = newArray;
-      matData = newMatData;
-  }
+  if (numFibers == sizeFibers) {
+    if (this->growFibers(2*sizeFibers) < 0)
+      return -1;
+  } else
+    this->ownMatData();
 
   // set the new pointers and data
   double yLoc, zLoc, Area;
@@ -314,6 +293,130 @@ FiberSection2d::addFiber(Fiber &newFiber)
 }
 
 
+// adds num fibers at once, fiber i a copy of mats[i] at yLocs[i] with
+// area areas[i]; the section builders use it in place of creating a
+// Fiber object, and so one more material copy, for each fiber
+int
+FiberSection2d::addFibers(int num, UniaxialMaterial **mats, const double *yLocs,
+			  const double *areas)
+{
+  if (num <= 0)
+    return 0;
+
+  if (numFibers + num > sizeFibers) {
+    if (this->growFibers(numFibers + num) < 0)
+      return -1;
+  } else
+    this->ownMatData();
+
+  for (int i = 0; i < num; i++) {
+    matData[numFibers*2] = yLocs[i];
+    matData[numFibers*2+1] = areas[i];
+    theMaterials[numFibers] = mats[i]->getCopy();
+
+    if (theMaterials[numFibers] == 0) {
+      opserr << "FiberSection2d::addFibers -- failed to get copy of a Material\n";
+      return -1;
+    }
+
+    numFibers++;
+
+    ABar += areas[i];
+    QzBar += yLocs[i]*areas[i];
+  }
+
+  // Recompute centroid
+  yBar = QzBar/ABar;
+
+  return 0;
+}
+
+int
+FiberSection2d::growFibers(int newSize)
+{
+  if (newSize < 30)
+    newSize = 30;
+
+  UniaxialMaterial **newArray = new UniaxialMaterial *[newSize]; 
+  double *newMatData = new double [2 * newSize];
+  if (newArray == 0 || newMatData == 0) {
+    opserr << "FiberSection2d::addFiber -- failed to allocate Fiber pointers\n";
+    return -1;
+  }
+
+  // copy the old pointers and data
+  for (int i = 0; i < numFibers; i++) {
+    newArray[i] = theMaterials[i];
+    for (int j = 0; j < 2; j++)
+      newMatData[2*i+j] = matData[2*i+j];
+  }
+
+  // initialize new memory
+  for (int i = numFibers; i < newSize; i++) {
+    newArray[i] = 0;
+    for (int j = 0; j < 2; j++)
+      newMatData[2*i+j] = 0.0;
+  }
+
+  sizeFibers = newSize;
+
+  // set new memory
+  if (theMaterials != 0)
+    delete [] theMaterials;
+  this->releaseMatData();
+
+  theMaterials = newArray;
+  matData = newMatData;
+
+  return 0;
+}
+
+// the fiber locations and areas are not changed once the section is
+// built, so getCopy() shares them among the copies of a section, counted
+// in matDataRefs; a section that is to change them takes its own first
+void
+FiberSection2d::ownMatData(void)
+{
+  if (matDataRefs == 0)
+    return;
+
+  // the copies sharing the data have all been deleted
+  if (*matDataRefs == 1) {
+    delete matDataRefs;
+    matDataRefs = 0;
+    return;
+  }
+
+  double *newMatData = new double [2 * sizeFibers];
+  for (int i = 0; i < 2*numFibers; i++)
+    newMatData[i] = matData[i];
+  for (int i = 2*numFibers; i < 2*sizeFibers; i++)
+    newMatData[i] = 0.0;
+
+  this->releaseMatData();
+  matData = newMatData;
+}
+
+void
+FiberSection2d::releaseMatData(void)
+{
+  if (matData == 0)
+    return;
+
+  if (matDataRefs != 0) {
+    if (--(*matDataRefs) > 0) {
+      matData = 0;
+      matDataRefs = 0;
+      return;
+    }
+    delete matDataRefs;
+    matDataRefs = 0;
+  }
+
+  delete [] matData;
+  matData = 0;
+}
+
 // destructor:
 FiberSection2d::~FiberSection2d()
 {
@@ -325,8 +428,7 @@ FiberSection2d::~FiberSection2d()
     delete [] theMaterials;
   }
 
-  if (matData != 0)
-    delete [] matData;
+  this->releaseMatData();
 
   if (s != 0)
     delete s;
@@ -338,6 +440,71 @@ FiberSection2d::~FiberSection2d()
     delete sectionIntegr;
 }
 
+// sets the trial strain of each fiber, invoking setTrialBatch() on each
+// run of consecutive fibers whose materials are of the same type
+int
+FiberSection2d::setFiberTrialStrains(const double *strains, double *stresses, double *tangents)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->setTrialBatch(&theMaterials[i], &strains[i], 
+					  &stresses[i], &tangents[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
+// commits the fibers, invoking commitBatch() on each run of fibers whose
+// materials are of the same type
+int
+FiberSection2d::commitFibers(void)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->commitBatch(&theMaterials[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
+// reverts the fibers to their last commit in the same way, returning
+// their stresses and tangents
+int
+FiberSection2d::revertFibers(double *stresses, double *tangents)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->revertBatch(&theMaterials[i], &stresses[i],
+					&tangents[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
 int
 FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
 {
@@ -351,41 +518,62 @@ FiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   double d0 = deforms(0);
   double d1 = deforms(1);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *fiberLocsData = Workspace::getDoubles(&fiberLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
   
+  double *fiberStrain = Workspace::getDoubles(&fiberStrainKey, numFibers);
+  double *fiberStress = Workspace::getDoubles(&fiberStressKey, numFibers);
+  double *fiberTangent = Workspace::getDoubles(&fiberTangentKey, numFibers);
+
+  // determine the material strains
+  for (int i = 0; i < numFibers; i++)
+    fiberStrain[i] = d0 - (fiberLocs[i] - yBar)*d1;
+
+  // set them, one call for each run of fibers of the same material type
+  res += this->setFiberTrialStrains(fiberStrain, fiberStress, fiberTangent);
+
+  // the sums over the fibers are kept in locals, the compiler cannot
+  // keep the kData and sData members in registers over the loop
+  double k0 = 0.0, k1 = 0.0, k3 = 0.0;
+  double s0 = 0.0, s1 = 0.0;
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = fiberLocs[i] - yBar;
     double A = fiberArea[i];
-
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent, stress;
-    res += theMat->setTrial(strain, stress, tangent);
+    double tangent = fiberTangent[i];
+    double stress = fiberStress[i];
 
     double ks0 = tangent * A;
     double ks1 = ks0 * -y;
-    kData[0] += ks0;
-    kData[1] += ks1;
-    kData[3] += ks1 * -y;
+    k0 += ks0;
+    k1 += ks1;
+    k3 += ks1 * -y;
 
     double fs0 = stress * A;
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
+    s0 += fs0;
+    s1 += fs0 * -y;
   }
 
+  kData[0] = k0;
+  kData[1] = k1;
+  kData[3] = k3;
+  sData[0] = s0;
+  sData[1] = s1;
+
   kData[2] = kData[1];
 
   return res;
@@ -404,18 +592,22 @@ FiberSection2d::getInitialTangent(void)
   static Matrix kInitialMatrix(kInitial, 2, 2);
   kInitial[0] = 0.0; kInitial[1] = 0.0; kInitial[2] = 0.0; kInitial[3] = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *fiberLocsData = Workspace::getDoubles(&fiberLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   for (int i = 0; i < numFibers; i++) {
@@ -466,16 +658,14 @@ FiberSection2d::getCopy(void)
       exit(-1);
     }
   
-    theCopy->matData = new double [numFibers*2];
+    // the copy shares the fiber locations and areas
+    if (matDataRefs == 0)
+      matDataRefs = new int(1);
+    (*matDataRefs)++;
+    theCopy->matData = matData;
+    theCopy->matDataRefs = matDataRefs;
 
-    if (theCopy->matData == 0) {
-      opserr << "FiberSection2d::getCopy -- failed to allocate double array for material data\n";
-      exit(-1);
-    }
-			    
     for (int i = 0; i < numFibers; i++) {
-      theCopy->matData[i*2] = matData[i*2];
-      theCopy->matData[i*2+1] = matData[i*2+1];
       theCopy->theMaterials[i] = theMaterials[i]->getCopy();
 
       if (theCopy->theMaterials[i] == 0) {
@@ -523,8 +713,7 @@ FiberSection2d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  err += this->commitFibers();
 
   return err;
 }
@@ -537,31 +726,37 @@ FiberSection2d::revertToLastCommit(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *fiberLocsData = Workspace::getDoubles(&fiberLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
+  double *fiberStress = Workspace::getDoubles(&fiberStressKey, numFibers);
+  double *fiberTangent = Workspace::getDoubles(&fiberTangentKey, numFibers);
+
+  // invoke revertToLast on the materials
+  err += this->revertFibers(fiberStress, fiberTangent);
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = fiberLocs[i] - yBar;
     double A = fiberArea[i];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
     // get material stress & tangent for this strain and determine ks and fs
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
+    double tangent = fiberTangent[i];
+    double stress = fiberStress[i];
     double ks0 = tangent * A;
     double ks1 = ks0 * -y;
     kData[0] += ks0;
@@ -569,8 +764,8 @@ FiberSection2d::revertToLastCommit(void)
     kData[3] += ks1 * -y;
 
     double fs0 = stress * A;
-    sData[0] = fs0;
-    sData[1] = fs0 * -y;
+    sData[0] += fs0;
+    sData[1] += fs0 * -y;
   }
 
   kData[2] = kData[1];
@@ -587,18 +782,22 @@ FiberSection2d::revertToStart(void)
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *fiberLocsData = Workspace::getDoubles(&fiberLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   for (int i = 0; i < numFibers; i++) {
@@ -716,9 +915,7 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
 	for (int i=0; i<numFibers; i++)
 	  delete theMaterials[i];
 	delete [] theMaterials;
-	if (matData != 0)
-	  delete [] matData;
-	matData = 0;
+	this->releaseMatData();
 	theMaterials = 0;
       }
 
@@ -745,6 +942,7 @@ FiberSection2d::recvSelf(int commitTag, Channel &theChannel,
       }
     }
 
+    this->ownMatData();
     Vector fiberData(matData, 2*numFibers);
     res += theChannel.recvVector(dbTag, commitTag, fiberData);
     if (res < 0) {
@@ -1101,22 +1299,26 @@ FiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double tangent = 0.0;
   double sig_dAdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *fiberLocsData = Workspace::getDoubles(&fiberLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = Workspace::getDoubles(&locsDerivKey, numFibers);
+  double *areaDeriv = Workspace::getDoubles(&areaDerivKey, numFibers);
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1177,22 +1379,26 @@ FiberSection2d::getInitialTangentSensitivity(int gradIndex)
   double tangent = 0.0;
   double dtangentdh = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *fiberLocsData = Workspace::getDoubles(&fiberLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = Workspace::getDoubles(&locsDerivKey, numFibers);
+  double *areaDeriv = Workspace::getDoubles(&areaDerivKey, numFibers);
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
@@ -1235,7 +1441,7 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
 
   dedh = defSens;
 
-  static double fiberLocs[10000];
+  double *fiberLocs = Workspace::getDoubles(&fiberLocsKey, numFibers);
 
   if (sectionIntegr != 0)
     sectionIntegr->getFiberLocations(numFibers, fiberLocs);
@@ -1244,8 +1450,8 @@ FiberSection2d::commitSensitivity(const Vector& defSens,
       fiberLocs[i] = matData[2*i];
   }
 
-  static double locsDeriv[10000];
-  static double areaDeriv[10000];
+  double *locsDeriv = Workspace::getDoubles(&locsDerivKey, numFibers);
+  double *areaDeriv = Workspace::getDoubles(&areaDerivKey, numFibers);
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, locsDeriv);  
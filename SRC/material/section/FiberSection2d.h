@@ -79,6 +79,8 @@ class FiberSection2d : public SectionForceDeformation
     int getResponse(int responseID, Information &info);
 
     int addFiber(Fiber &theFiber);
+    int addFibers(int num, UniaxialMaterial **mats, const double *yLocs,
+		  const double *areas);
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int setParameter(const char **argv, int argc, Parameter &param);
@@ -93,9 +95,17 @@ class FiberSection2d : public SectionForceDeformation
   protected:
     
     //  private:
+    int setFiberTrialStrains(const double *strains, double *stresses, double *tangents);
+    int commitFibers(void);
+    int revertFibers(double *stresses, double *tangents);
+    int growFibers(int newSize);
+    void ownMatData(void);
+    void releaseMatData(void);
+
     int numFibers, sizeFibers;       // number of fibers in the section
     UniaxialMaterial **theMaterials; // array of pointers to materials
     double   *matData;               // data for the materials [yloc and area]
+    int      *matDataRefs;           // sections sharing matData, 0 if not shared
     double   kData[4];               // data for ks matrix 
     double   sData[2];               // data for s vector 
     
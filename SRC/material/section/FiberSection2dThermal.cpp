@@ -121,6 +121,10 @@ FiberSection2dThermal::FiberSection2dThermal(int tag, int num, Fiber **fibers):
    for (int i = 0;i<100; i++) {
 	   LocElong[i] = 0;
    }
+  fiberTempData = 0;
+  sizeFiberTempData = 0;
+  fiberTempSet = false;
+
 //temp
 //yBar = 0.02;
 }
@@ -205,6 +209,10 @@ FiberSection2dThermal::FiberSection2dThermal(int tag, int num, UniaxialMaterial
 	   LocElong[i] = 0;
    }
 
+  fiberTempData = 0;
+  sizeFiberTempData = 0;
+  fiberTempSet = false;
+
 //temp
 //yBar = 0.02;
 }
@@ -244,6 +252,10 @@ FiberSection2dThermal::FiberSection2dThermal():
 	   LocElong[i] = 0;
    }
 
+  fiberTempData = 0;
+  sizeFiberTempData = 0;
+  fiberTempSet = false;
+
 //temp
 //yBar = 0.02;
 }
@@ -346,6 +358,8 @@ FiberSection2dThermal::~FiberSection2dThermal()
 //JZ 07/10 /////////////////////////////////////////////////////////////end
   if (LocElong != 0)
     delete [] LocElong;
+  if (fiberTempData != 0)
+    delete [] fiberTempData;
 //JZ 11/10 /////////////////////////////////////////////////////////////end
 }
 
@@ -395,6 +409,25 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector &deforms, const V
     dataTempe[i] = dataMixed(i);
   }
   //JZ 07/10 /////////////////////////////////////////////////////////////end               
+
+  // the fiber temperatures and elongations only change with the thermal
+  // action, so within a step they are formed once and not every iteration
+  if (sizeFiberTempData < 2*numFibers) {
+    if (fiberTempData != 0)
+      delete [] fiberTempData;
+    sizeFiberTempData = 2*numFibers;
+    fiberTempData = new double [sizeFiberTempData];
+    fiberTempSet = false;
+  }
+
+  bool newTemperatures = !fiberTempSet;
+  for (int i = 0; i < 27; i++) {
+    if (dataTempe[i] != lastDataTempe[i]) {
+      lastDataTempe[i] = dataTempe[i];
+      newTemperatures = true;
+    }
+  }
+  fiberTempSet = true;
   
   // theTemperatures = temperatures;  
   
@@ -408,6 +441,14 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector &deforms, const V
     
     //JZ 07/10 /////////////////////////////////////////////////////////////start
     double FiberTemperature = 0 ; //JZ
+    double tangent =0.0;
+    double stress = 0.0; 
+    double ThermalElongation = 0.0;
+
+    if (newTemperatures == false) {
+      FiberTemperature = fiberTempData[2*i];
+      ThermalElongation = fiberTempData[2*i+1];
+    } else {
     double FiberTempMax=0; //PK add for max temp
 
     //opserr << "settrial max temp1 " << dataTempe[18] << endln;
@@ -481,11 +522,6 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector &deforms, const V
 //JZ 07/10 /////////////////////////////////////////////////////////////end 
 
     
-    // determine material strain and set it
-    double strain = d0 - y*d1;
-    double tangent =0.0;
-	double stress = 0.0; 
-	double ThermalElongation = 0.0;
     //double tangent, stress, ThermalElongation;
     //  res += theMat->setTrialTemperature(strain, FiberTemperature, stress, tangent, ThermalElongation);//***JZ
     
@@ -506,6 +542,13 @@ FiberSection2dThermal::setTrialSectionDeformation(const Vector &deforms, const V
     tangent = tData(1);
     ThermalElongation = tData(2);
 
+      fiberTempData[2*i] = FiberTemperature;
+      fiberTempData[2*i+1] = ThermalElongation;
+    }
+
+    // determine material strain and set it
+    double strain = d0 - y*d1;
+
 
    //strain = strain - LocElong[i];
    strain = strain - ThermalElongation;
@@ -1030,6 +1073,8 @@ FiberSection2dThermal::commitState(void)
 {
   int err = 0;
 
+  fiberTempSet = false;
+
   for (int i = 0; i < numFibers; i++)
     err += theMaterials[i]->commitState();
 
@@ -1041,6 +1086,8 @@ FiberSection2dThermal::revertToLastCommit(void)
 {
   int err = 0;
 
+  fiberTempSet = false;
+
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
@@ -1091,6 +1138,8 @@ FiberSection2dThermal::revertToStart(void)
   // revert the fibers to start    
   int err = 0;
 
+  fiberTempSet = false;
+
   kData[0] = 0.0; kData[1] = 0.0; kData[2] = 0.0; kData[3] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;
   
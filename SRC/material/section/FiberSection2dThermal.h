@@ -121,6 +121,15 @@ class FiberSection2dThermal : public SectionForceDeformation
     Vector  *sT;  //  Pointer to sTData
     double  *TemperatureTangent; // JZ  the E of E*A*alpha*DeltaT
     double *LocElong; // JZ  thermal strain in getTemperatureStress(double *)
+
+    // fiber temperatures and thermal elongations for the thermal action in
+    // lastDataTempe, kept until it changes or the section is committed or
+    // reverted, as the temperature dependent material properties are only
+    // evaluated again then
+    double lastDataTempe[27];
+    double *fiberTempData;
+    int sizeFiberTempData;
+    bool fiberTempSet;
     
 // AddingSensitivity:BEGIN //////////////////////////////////////////
     Vector dedh; // MHS hack
@@ -44,9 +44,21 @@
 #include <UniaxialMaterial.h>
 #include <ElasticMaterial.h>
 #include <SectionIntegration.h>
+#include <Workspace.h>
 #include <elementAPI.h>
 #include <string.h>
 
+// keys identifying the fiber data each thread obtains from Workspace
+static char yLocsKey;
+static char zLocsKey;
+static char fiberAreaKey;
+static char dydhKey;
+static char dzdhKey;
+static char areaDerivKey;
+static char fiberStrainKey;
+static char fiberStressKey;
+static char fiberTangentKey;
+
 ID FiberSection3d::code(4);
 
 void* OPS_FiberSection3d()
@@ -68,7 +80,7 @@ void* OPS_FiberSection3d()
 // constructors:
 FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers, UniaxialMaterial *torsion): 
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -140,7 +152,7 @@ FiberSection3d::FiberSection3d(int tag, int num, Fiber **fibers, UniaxialMateria
 
 FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial *torsion): 
     SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
-    numFibers(0), sizeFibers(num), theMaterials(0), matData(0),
+    numFibers(0), sizeFibers(num), theMaterials(0), matData(0), matDataRefs(0),
     QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
     if(sizeFibers != 0) {
@@ -195,7 +207,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial *torsion):
 FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 			       SectionIntegration &si, UniaxialMaterial *torsion):
   SectionForceDeformation(tag, SEC_TAG_FiberSection3d),
-  numFibers(num), sizeFibers(num), theMaterials(0), matData(0),
+  numFibers(num), sizeFibers(num), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
   if (numFibers != 0) {
@@ -219,11 +231,11 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
     exit(-1);
   }
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  double *yLocs = Workspace::getDoubles(&yLocsKey, numFibers);
+  double *zLocs = Workspace::getDoubles(&zLocsKey, numFibers);
   sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
   
-  static double fiberArea[10000];
+  double *fiberArea = Workspace::getDoubles(&fiberAreaKey, numFibers);
   sectionIntegr->getFiberWeights(numFibers, fiberArea);
   
   for (int i = 0; i < numFibers; i++) {
@@ -270,7 +282,7 @@ FiberSection3d::FiberSection3d(int tag, int num, UniaxialMaterial **mats,
 // constructor for blank object that recvSelf needs to be invoked upon
 FiberSection3d::FiberSection3d():
   SectionForceDeformation(0, SEC_TAG_FiberSection3d),
-  numFibers(0), sizeFibers(0), theMaterials(0), matData(0),
+  numFibers(0), sizeFibers(0), theMaterials(0), matData(0), matDataRefs(0),
   QzBar(0.0), QyBar(0.0), Abar(0.0), yBar(0.0), zBar(0.0), sectionIntegr(0), e(4), s(0), ks(0), theTorsion(0)
 {
   s = new Vector(sData, 4);
@@ -293,44 +305,13 @@ FiberSection3d::FiberSection3d():
 int
 FiberSection3d::addFiber(Fiber &newFiber)
 {
-  // need to create a larger array
-  if(numFibers == sizeFibers) {
-      int newSize = 2*sizeFibers;
-      UniaxialMaterial **newArray = new UniaxialMaterial *[newSize]; 
-      double *newMatData = new double [3 * newSize];
-      
-      if (newArray == 0 || newMatData == 0) {
-	  opserr << "FiberSection3d::addFiber -- failed to allocate Fiber pointers\n";
-	  exit(-1);
-      }
-
-      // copy the old pointers
-      for (int i = 0; i < numFibers; i++) {
-	  newArray[i] = theMaterials[i];
-	  newMatData[3*i] = matData[3*i];
-	  newMatData[3*i+1] = matData[3*i+1];
-	  newMatData[3*i+2] = matData[3*i+2];
-      }
-
-      // initialize new memomry
-      for (int i = numFibers; i < newSize; i++) {
-	  newArray[i] = 0;
-	  newMatData[3*i] = 0.0;
-	  newMatData[3*i+1] = 0.0;
-	  newMatData[3*i+2] = 0.0;
-      }
-      sizeFibers = newSize;
-
-      // set new memory
-      if (theMaterials != 0) {
-	  delete [] theMaterials;
-	  delete [] matData;
-      }
+  // need to create larger arrays
+  if (numFibers == sizeFibers) {
+    if (this->growFibers(2*sizeFibers) < 0)
+      return -1;
+  } else
+    this->ownMatData();
 
-      theMaterials = newArray;
-      matData = newMatData;
-  }
-	    
   // set the new pointers
   double yLoc, zLoc, Area;
   newFiber.getFiberLocation(yLoc, zLoc);
@@ -361,6 +342,133 @@ FiberSection3d::addFiber(Fiber &newFiber)
 
 
 
+// adds num fibers at once, fiber i a copy of mats[i] at (yLocs[i],
+// zLocs[i]) with area areas[i]; the section builders use it in place of
+// creating a Fiber object, and so one more material copy, for each fiber
+int
+FiberSection3d::addFibers(int num, UniaxialMaterial **mats, const double *yLocs,
+			  const double *zLocs, const double *areas)
+{
+  if (num <= 0)
+    return 0;
+
+  if (numFibers + num > sizeFibers) {
+    if (this->growFibers(numFibers + num) < 0)
+      return -1;
+  } else
+    this->ownMatData();
+
+  for (int i = 0; i < num; i++) {
+    matData[numFibers*3] = yLocs[i];
+    matData[numFibers*3+1] = zLocs[i];
+    matData[numFibers*3+2] = areas[i];
+    theMaterials[numFibers] = mats[i]->getCopy();
+
+    if (theMaterials[numFibers] == 0) {
+      opserr << "FiberSection3d::addFibers -- failed to get copy of a Material\n";
+      return -1;
+    }
+
+    numFibers++;
+
+    Abar  += areas[i];
+    QzBar += yLocs[i]*areas[i];
+    QyBar += zLocs[i]*areas[i];
+  }
+
+  // Recompute centroid
+  yBar = QzBar/Abar;
+  zBar = QyBar/Abar;
+
+  return 0;
+}
+
+int
+FiberSection3d::growFibers(int newSize)
+{
+  if (newSize < 30)
+    newSize = 30;
+
+  UniaxialMaterial **newArray = new UniaxialMaterial *[newSize]; 
+  double *newMatData = new double [3 * newSize];
+  if (newArray == 0 || newMatData == 0) {
+    opserr << "FiberSection3d::addFiber -- failed to allocate Fiber pointers\n";
+    return -1;
+  }
+
+  // copy the old pointers and data
+  for (int i = 0; i < numFibers; i++) {
+    newArray[i] = theMaterials[i];
+    for (int j = 0; j < 3; j++)
+      newMatData[3*i+j] = matData[3*i+j];
+  }
+
+  // initialize new memory
+  for (int i = numFibers; i < newSize; i++) {
+    newArray[i] = 0;
+    for (int j = 0; j < 3; j++)
+      newMatData[3*i+j] = 0.0;
+  }
+
+  sizeFibers = newSize;
+
+  // set new memory
+  if (theMaterials != 0)
+    delete [] theMaterials;
+  this->releaseMatData();
+
+  theMaterials = newArray;
+  matData = newMatData;
+
+  return 0;
+}
+
+// the fiber locations and areas are not changed once the section is
+// built, so getCopy() shares them among the copies of a section, counted
+// in matDataRefs; a section that is to change them takes its own first
+void
+FiberSection3d::ownMatData(void)
+{
+  if (matDataRefs == 0)
+    return;
+
+  // the copies sharing the data have all been deleted
+  if (*matDataRefs == 1) {
+    delete matDataRefs;
+    matDataRefs = 0;
+    return;
+  }
+
+  double *newMatData = new double [3 * sizeFibers];
+  for (int i = 0; i < 3*numFibers; i++)
+    newMatData[i] = matData[i];
+  for (int i = 3*numFibers; i < 3*sizeFibers; i++)
+    newMatData[i] = 0.0;
+
+  this->releaseMatData();
+  matData = newMatData;
+}
+
+void
+FiberSection3d::releaseMatData(void)
+{
+  if (matData == 0)
+    return;
+
+  if (matDataRefs != 0) {
+    if (--(*matDataRefs) > 0) {
+      matData = 0;
+      matDataRefs = 0;
+      return;
+    }
+    delete matDataRefs;
+    matDataRefs = 0;
+  }
+
+  delete [] matData;
+  matData = 0;
+}
+
 // destructor:
 FiberSection3d::~FiberSection3d()
 {
@@ -372,8 +480,7 @@ FiberSection3d::~FiberSection3d()
     delete [] theMaterials;
   }
 
-  if (matData != 0)
-    delete [] matData;
+  this->releaseMatData();
 
   if (s != 0)
     delete s;
@@ -388,6 +495,71 @@ FiberSection3d::~FiberSection3d()
     delete theTorsion;
 }
 
+// sets the trial strain of each fiber, invoking setTrialBatch() on each
+// run of consecutive fibers whose materials are of the same type
+int
+FiberSection3d::setFiberTrialStrains(const double *strains, double *stresses, double *tangents)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->setTrialBatch(&theMaterials[i], &strains[i], 
+					  &stresses[i], &tangents[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
+// commits the fibers, invoking commitBatch() on each run of fibers whose
+// materials are of the same type
+int
+FiberSection3d::commitFibers(void)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->commitBatch(&theMaterials[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
+// reverts the fibers to their last commit in the same way, returning
+// their stresses and tangents
+int
+FiberSection3d::revertFibers(double *stresses, double *tangents)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->revertBatch(&theMaterials[i], &stresses[i],
+					&tangents[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
 int
 FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 {
@@ -404,56 +576,83 @@ FiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   double d2 = deforms(2);
   double d3 = deforms(3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
- 
+  const double *yLocs, *zLocs, *fiberArea;
+
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
-	
+    double *yLocsData = Workspace::getDoubles(&yLocsKey, numFibers);
+    double *zLocsData = Workspace::getDoubles(&zLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
 		
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
  
+  double *fiberStrain = Workspace::getDoubles(&fiberStrainKey, numFibers);
+  double *fiberStress = Workspace::getDoubles(&fiberStressKey, numFibers);
+  double *fiberTangent = Workspace::getDoubles(&fiberTangentKey, numFibers);
+
+  // determine the material strains
+  for (int i = 0; i < numFibers; i++)
+    fiberStrain[i] = d0 - (yLocs[i] - yBar)*d1 + (zLocs[i] - zBar)*d2;
+
+  // set them, one call for each run of fibers of the same material type
+  res += this->setFiberTrialStrains(fiberStrain, fiberStress, fiberTangent);
+
   double tangent, stress;
+  // the sums over the fibers are kept in locals, the compiler cannot
+  // keep the kData and sData members in registers over the loop
+  double k0 = 0.0, k1 = 0.0, k2 = 0.0, k5 = 0.0, k6 = 0.0, k10 = 0.0;
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0;
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
-
-    // determine material strain and set it
-    double strain = d0 - y*d1 + z*d2;
-    res += theMat->setTrial(strain, stress, tangent);
+    tangent = fiberTangent[i];
+    stress = fiberStress[i];
 
     double value = tangent * A;
     double vas1 = -y*value;
     double vas2 = z*value;
     double vas1as2 = vas1*z;
 
-    kData[0] += value;
-    kData[1] += vas1;
-    kData[2] += vas2;
+    k0 += value;
+    k1 += vas1;
+    k2 += vas2;
     
-    kData[5] += vas1 * -y;
-    kData[6] += vas1as2;
+    k5 += vas1 * -y;
+    k6 += vas1as2;
     
-    kData[10] += vas2 * z; 
+    k10 += vas2 * z; 
 
     double fs0 = stress * A;
 
-    sData[0] += fs0;
-    sData[1] += fs0 * -y;
-    sData[2] += fs0 * z;
+    s0 += fs0;
+    s1 += fs0 * -y;
+    s2 += fs0 * z;
   }
 
+  kData[0] = k0;
+  kData[1] = k1;
+  kData[2] = k2;
+  kData[5] = k5;
+  kData[6] = k6;
+  kData[10] = k10;
+  sData[0] = s0;
+  sData[1] = s1;
+  sData[2] = s2;
+
   kData[4] = kData[1];
   kData[8] = kData[2];
   kData[9] = kData[6];
@@ -473,20 +672,26 @@ FiberSection3d::getInitialTangent(void)
   
   kInitial.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *yLocsData = Workspace::getDoubles(&yLocsKey, numFibers);
+    double *zLocsData = Workspace::getDoubles(&zLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
   for (int i = 0; i < numFibers; i++) {
@@ -556,18 +761,14 @@ FiberSection3d::getCopy(void)
       exit(-1);			    
     }
 
-    theCopy->matData = new double [numFibers*3];
+    // the copy shares the fiber locations and areas
+    if (matDataRefs == 0)
+      matDataRefs = new int(1);
+    (*matDataRefs)++;
+    theCopy->matData = matData;
+    theCopy->matDataRefs = matDataRefs;
 
-    if (theCopy->matData == 0) {
-      opserr << "FiberSection3d::FiberSection3d -- failed to allocate double array for material data\n";
-      exit(-1);
-    }
-			    
-    
     for (int i = 0; i < numFibers; i++) {
-      theCopy->matData[i*3] = matData[i*3];
-      theCopy->matData[i*3+1] = matData[i*3+1];
-      theCopy->matData[i*3+2] = matData[i*3+2];
       theCopy->theMaterials[i] = theMaterials[i]->getCopy();
 
       if (theCopy->theMaterials[i] == 0) {
@@ -622,8 +823,7 @@ FiberSection3d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  err += this->commitFibers();
 
   err += theTorsion->commitState();
 
@@ -641,33 +841,41 @@ FiberSection3d::revertToLastCommit(void)
   kData[15] = 0.0;
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *yLocsData = Workspace::getDoubles(&yLocsKey, numFibers);
+    double *zLocsData = Workspace::getDoubles(&zLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
+  double *fiberStress = Workspace::getDoubles(&fiberStressKey, numFibers);
+  double *fiberTangent = Workspace::getDoubles(&fiberTangentKey, numFibers);
+
+  // invoke revertToLast on the materials
+  err += this->revertFibers(fiberStress, fiberTangent);
+
   for (int i = 0; i < numFibers; i++) {
-    UniaxialMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
     double z = zLocs[i] - zBar;
     double A = fiberArea[i];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
-    double tangent = theMat->getTangent();
-    double stress = theMat->getStress();
+    double tangent = fiberTangent[i];
+    double stress = fiberStress[i];
 
     double value = tangent * A;
     double vas1 = -y*value;
@@ -711,20 +919,26 @@ FiberSection3d::revertToStart(void)
   kData[15] = 0.0; 
   sData[0] = 0.0; sData[1] = 0.0;  sData[2] = 0.0; sData[3] = 0.0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *yLocsData = Workspace::getDoubles(&yLocsKey, numFibers);
+    double *zLocsData = Workspace::getDoubles(&zLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
   for (int i = 0; i < numFibers; i++) {
@@ -878,9 +1092,7 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
 	for (int i=0; i<numFibers; i++)
 	  delete theMaterials[i];
 	delete [] theMaterials;
-	if (matData != 0)
-	  delete [] matData;
-	matData = 0;
+	this->releaseMatData();
 	theMaterials = 0;
       }
 
@@ -908,6 +1120,7 @@ FiberSection3d::recvSelf(int commitTag, Channel &theChannel,
       }
     }
 
+    this->ownMatData();
     Vector fiberData(matData, 3*numFibers);
     res += theChannel.recvVector(dbTag, commitTag, fiberData);
     if (res < 0) {
@@ -1377,25 +1590,31 @@ FiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   double sig_dAdh = 0;
   double tangent = 0;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    double *yLocsData = Workspace::getDoubles(&yLocsKey, numFibers);
+    double *zLocsData = Workspace::getDoubles(&zLocsKey, numFibers);
+    double *fiberAreaData = Workspace::getDoubles(&fiberAreaKey, numFibers);
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
-  static double areaDeriv[10000];
+  double *dydh = Workspace::getDoubles(&dydhKey, numFibers);
+  double *dzdh = Workspace::getDoubles(&dzdhKey, numFibers);
+  double *areaDeriv = Workspace::getDoubles(&areaDerivKey, numFibers);
 
   if (sectionIntegr != 0) {
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
@@ -1486,8 +1705,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
 
   //dedh = defSens;
 
-  static double yLocs[10000];
-  static double zLocs[10000];
+  double *yLocs = Workspace::getDoubles(&yLocsKey, numFibers);
+  double *zLocs = Workspace::getDoubles(&zLocsKey, numFibers);
 
   if (sectionIntegr != 0)
     sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
@@ -1498,8 +1717,8 @@ FiberSection3d::commitSensitivity(const Vector& defSens, int gradIndex, int numG
     }
   }
 
-  static double dydh[10000];
-  static double dzdh[10000];
+  double *dydh = Workspace::getDoubles(&dydhKey, numFibers);
+  double *dzdh = Workspace::getDoubles(&dzdhKey, numFibers);
 
   if (sectionIntegr != 0)
     sectionIntegr->getLocationsDeriv(numFibers, dydh, dzdh);  
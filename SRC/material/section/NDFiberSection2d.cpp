@@ -370,6 +370,47 @@ NDFiberSection2d::~NDFiberSection2d()
     delete sectionIntegr;
 }
 
+// commits the fibers, invoking commitBatch() on each run of fibers whose
+// materials are of the same type
+int
+NDFiberSection2d::commitFibers(void)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->commitBatch(&theMaterials[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
+// reverts the fibers to their last commit in the same way
+int
+NDFiberSection2d::revertFibers(void)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->revertBatch(&theMaterials[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
 int
 NDFiberSection2d::setTrialSectionDeformation (const Vector &deforms)
 {
@@ -395,18 +436,22 @@ NDFiberSection2d::setTrialSectionDeformation (const Vector &deforms)
   double d1 = deforms(1);
   double d2 = deforms(2);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   static Vector eps(2);
@@ -494,18 +539,22 @@ NDFiberSection2d::getInitialTangent(void)
   kInitial[7] = 0.0;
   kInitial[8] = 0.0;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   for (int i = 0; i < numFibers; i++) {
@@ -646,8 +695,7 @@ NDFiberSection2d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  err += this->commitFibers();
 
   return err;
 }
@@ -671,28 +719,32 @@ NDFiberSection2d::revertToLastCommit(void)
   sData[1] = 0.0;
   sData[2] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
+  // invoke revertToLast on the materials
+  err += this->revertFibers();
+
   for (int i = 0; i < numFibers; i++) {
     NDMaterial *theMat = theMaterials[i];
     double y = fiberLocs[i] - yBar;
     double A = fiberArea[i];
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
     // get material stress & tangent for this strain and determine ks and fs
     const Matrix &tangent = theMat->getTangent();
     const Vector &stress = theMat->getStress();
@@ -763,18 +815,22 @@ NDFiberSection2d::revertToStart(void)
   sData[1] = 0.0;
   sData[2] = 0.0;
   
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   for (int i = 0; i < numFibers; i++) {
@@ -1213,18 +1269,22 @@ NDFiberSection2d::getStressResultantSensitivity(int gradIndex, bool conditional)
   static Vector sig_dAdh(2);
   static Matrix tangent(2,2);
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   static double locsDeriv[10000];
@@ -1307,18 +1367,22 @@ NDFiberSection2d::getInitialTangentSensitivity(int gradIndex)
   /*
   double y, A, dydh, dAdh, tangent, dtangentdh;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   static double locsDeriv[10000];
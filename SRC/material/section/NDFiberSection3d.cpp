@@ -361,6 +361,47 @@ NDFiberSection3d::~NDFiberSection3d()
     delete sectionIntegr;
 }
 
+// commits the fibers, invoking commitBatch() on each run of fibers whose
+// materials are of the same type
+int
+NDFiberSection3d::commitFibers(void)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->commitBatch(&theMaterials[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
+// reverts the fibers to their last commit in the same way
+int
+NDFiberSection3d::revertFibers(void)
+{
+  int res = 0;
+
+  int i = 0;
+  while (i < numFibers) {
+    int classTag = theMaterials[i]->getClassTag();
+    int j = i+1;
+    while (j < numFibers && theMaterials[j]->getClassTag() == classTag)
+      j++;
+
+    res += theMaterials[i]->revertBatch(&theMaterials[i], j-i);
+    i = j;
+  }
+
+  return res;
+}
+
 // a = [1 -y z       0       0  0
 //      0  0 0 sqrt(a)       0 -z
 //      0  0 0       0 sqrt(a)  y]
@@ -371,9 +412,6 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
 
   e = deforms;
 
-  s->Zero();
-  ks->Zero();
-
   double d0 = deforms(0);
   double d1 = deforms(1);
   double d2 = deforms(2);
@@ -381,20 +419,26 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   double d4 = deforms(4);
   double d5 = deforms(5);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double yLocsData[10000];
+    static double zLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
   
   static Vector eps(3);
@@ -403,6 +447,16 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
   if (alpha != 1.0)
     rootAlpha = sqrt(alpha);
 
+  // the section stiffness and resultants are summed in local arrays, so
+  // that they are kept in registers over the fibers, and set at the end
+  double ksi[6][6];
+  double si[6];
+  for (int i = 0; i < 6; i++) {
+    si[i] = 0.0;
+    for (int j = 0; j < 6; j++)
+      ksi[i][j] = 0.0;
+  }
+
   for (int i = 0; i < numFibers; i++) {
     NDMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
@@ -433,41 +487,38 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     double d21 = tangent(2,1)*A;
     double d22 = tangent(2,2)*A;
 
-    Matrix &ksi = *ks;
-    Vector &si = *s;
-
     // Bending terms
-    ksi(0,0) += d00;
-    ksi(1,1) += y2*d00;
-    ksi(2,2) += z2*d00;
+    ksi[0][0] += d00;
+    ksi[1][1] += y2*d00;
+    ksi[2][2] += z2*d00;
     tmp = -y*d00;
-    ksi(0,1) += tmp;
-    ksi(1,0) += tmp;
+    ksi[0][1] += tmp;
+    ksi[1][0] += tmp;
     tmp = z*d00;
-    ksi(0,2) += tmp;
-    ksi(2,0) += tmp;
+    ksi[0][2] += tmp;
+    ksi[2][0] += tmp;
     tmp = -yz*d00;
-    ksi(1,2) += tmp;
-    ksi(2,1) += tmp;
+    ksi[1][2] += tmp;
+    ksi[2][1] += tmp;
     
     // Shear terms
-    ksi(3,3) += alpha*d11;
-    ksi(3,4) += alpha*d12;
-    ksi(4,3) += alpha*d21;
-    ksi(4,4) += alpha*d22;
+    ksi[3][3] += alpha*d11;
+    ksi[3][4] += alpha*d12;
+    ksi[4][3] += alpha*d21;
+    ksi[4][4] += alpha*d22;
     
     // Torsion term
-    ksi(5,5) += z2*d11 - yz*(d12+d21) + y2*d22;
+    ksi[5][5] += z2*d11 - yz*(d12+d21) + y2*d22;
     
     // Bending-torsion coupling terms
     tmp = -z*d01 + y*d02;
-    ksi(0,5) += tmp;
-    ksi(1,5) -= y*tmp;
-    ksi(2,5) += z*tmp;
+    ksi[0][5] += tmp;
+    ksi[1][5] -= y*tmp;
+    ksi[2][5] += z*tmp;
     tmp = -z*d10 + y*d20;
-    ksi(5,0) += tmp;
-    ksi(5,1) -= y*tmp;
-    ksi(5,2) += z*tmp;
+    ksi[5][0] += tmp;
+    ksi[5][1] -= y*tmp;
+    ksi[5][2] += z*tmp;
     
     // Hit tangent terms with rootAlpha
     d01 *= rootAlpha; d02 *= rootAlpha;
@@ -475,41 +526,45 @@ NDFiberSection3d::setTrialSectionDeformation (const Vector &deforms)
     d20 *= rootAlpha; d21 *= rootAlpha; d22 *= rootAlpha;
     
     // Bending-shear coupling terms
-    ksi(0,3) += d01;
-    ksi(0,4) += d02;
-    ksi(1,3) -= y*d01;
-    ksi(1,4) -= y*d02;
-    ksi(2,3) += z*d01;
-    ksi(2,4) += z*d02;
-    ksi(3,0) += d10;
-    ksi(4,0) += d20;
-    ksi(3,1) -= y*d10;
-    ksi(4,1) -= y*d20;
-    ksi(3,2) += z*d10;
-    ksi(4,2) += z*d20;
+    ksi[0][3] += d01;
+    ksi[0][4] += d02;
+    ksi[1][3] -= y*d01;
+    ksi[1][4] -= y*d02;
+    ksi[2][3] += z*d01;
+    ksi[2][4] += z*d02;
+    ksi[3][0] += d10;
+    ksi[4][0] += d20;
+    ksi[3][1] -= y*d10;
+    ksi[4][1] -= y*d20;
+    ksi[3][2] += z*d10;
+    ksi[4][2] += z*d20;
     
     // Torsion-shear coupling terms
     y2 =  y*d22;
     z2 = -z*d11;
-    ksi(5,3) +=  z2 + y*d21;
-    ksi(5,4) += -z*d12 + y2;
-    ksi(3,5) +=  z2 + y*d12;
-    ksi(4,5) += -z*d21 + y2;
+    ksi[5][3] +=  z2 + y*d21;
+    ksi[5][4] += -z*d12 + y2;
+    ksi[3][5] +=  z2 + y*d12;
+    ksi[4][5] += -z*d21 + y2;
 
     double sig0 = stress(0)*A;
     double sig1 = stress(1)*A;
     double sig2 = stress(2)*A;
 
-    si(0) += sig0;
-    si(1) += -y*sig0;
-    si(2) += z*sig0;
-    si(3) += rootAlpha*sig1;
-    si(4) += rootAlpha*sig2;
-    si(5) += -z*sig1 + y*sig2;
+    si[0] += sig0;
+    si[1] += -y*sig0;
+    si[2] += z*sig0;
+    si[3] += rootAlpha*sig1;
+    si[4] += rootAlpha*sig2;
+    si[5] += -z*sig1 + y*sig2;
   }
 
-  if (alpha != 1.0) {
-
+  Matrix &kSection = *ks;
+  Vector &sSection = *s;
+  for (int i = 0; i < 6; i++) {
+    sSection(i) = si[i];
+    for (int j = 0; j < 6; j++)
+      kSection(i,j) = ksi[i][j];
   }
 
   return res;
@@ -528,20 +583,26 @@ NDFiberSection3d::getInitialTangent(void)
   static Matrix ki(kInitial, 6, 6);
   ki.Zero();
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double yLocsData[10000];
+    static double zLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
   double rootAlpha = 1.0;
@@ -728,8 +789,7 @@ NDFiberSection3d::commitState(void)
 {
   int err = 0;
 
-  for (int i = 0; i < numFibers; i++)
-    err += theMaterials[i]->commitState();
+  err += this->commitFibers();
 
   return err;
 }
@@ -742,26 +802,35 @@ NDFiberSection3d::revertToLastCommit(void)
   ks->Zero();
   s->Zero();
   
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double yLocsData[10000];
+    static double zLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
   double rootAlpha = 1.0;
   if (alpha != 1.0)
     rootAlpha = sqrt(alpha);
 
+  // invoke revertToLast on the materials
+  err += this->revertFibers();
+
   for (int i = 0; i < numFibers; i++) {
     NDMaterial *theMat = theMaterials[i];
     double y = yLocs[i] - yBar;
@@ -773,9 +842,6 @@ NDFiberSection3d::revertToLastCommit(void)
     double yz = y*z;
     double tmp;
 
-    // invoke revertToLast on the material
-    err += theMat->revertToLastCommit();
-
     // get material stress & tangent for this strain and determine ks and fs
     const Matrix &tangent = theMat->getTangent();
     const Vector &stress = theMat->getStress();
@@ -881,20 +947,26 @@ NDFiberSection3d::revertToStart(void)
   ks->Zero();
   s->Zero();
   
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double yLocsData[10000];
+    static double zLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
   double rootAlpha = 1.0;
@@ -1404,20 +1476,26 @@ NDFiberSection3d::getStressResultantSensitivity(int gradIndex, bool conditional)
   static Vector sig_dAdh(3);
   static Matrix tangent(3,3);
 
-  static double yLocs[10000];
-  static double zLocs[10000];
-  static double fiberArea[10000];
+  const double *yLocs, *zLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, yLocs, zLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    yLocs = fiberTable;
+    zLocs = fiberTable + numFibers;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double yLocsData[10000];
+    static double zLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      yLocs[i] = matData[3*i];
-      zLocs[i] = matData[3*i+1];
-      fiberArea[i] = matData[3*i+2];
+      yLocsData[i] = matData[3*i];
+      zLocsData[i] = matData[3*i+1];
+      fiberAreaData[i] = matData[3*i+2];
     }
+    yLocs = yLocsData;
+    zLocs = zLocsData;
+    fiberArea = fiberAreaData;
   }
 
   static double dydh[10000];
@@ -1527,18 +1605,22 @@ NDFiberSection3d::getInitialTangentSensitivity(int gradIndex)
   /*
   double y, A, dydh, dAdh, tangent, dtangentdh;
 
-  static double fiberLocs[10000];
-  static double fiberArea[10000];
+  const double *fiberLocs, *fiberArea;
 
   if (sectionIntegr != 0) {
-    sectionIntegr->getFiberLocations(numFibers, fiberLocs);
-    sectionIntegr->getFiberWeights(numFibers, fiberArea);
-  }  
+    const double *fiberTable = sectionIntegr->getFiberTable(numFibers);
+    fiberLocs = fiberTable;
+    fiberArea = fiberTable + 2*numFibers;
+  }
   else {
+    static double fiberLocsData[10000];
+    static double fiberAreaData[10000];
     for (int i = 0; i < numFibers; i++) {
-      fiberLocs[i] = matData[2*i];
-      fiberArea[i] = matData[2*i+1];
+      fiberLocsData[i] = matData[2*i];
+      fiberAreaData[i] = matData[2*i+1];
     }
+    fiberLocs = fiberLocsData;
+    fiberArea = fiberAreaData;
   }
 
   static double locsDeriv[10000];
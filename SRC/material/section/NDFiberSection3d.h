@@ -95,6 +95,9 @@ class NDFiberSection3d : public SectionForceDeformation
   protected:
     
     //  private:
+    int commitFibers(void);
+    int revertFibers(void);
+
     int numFibers, sizeFibers;                   // number of fibers in the section
     NDMaterial **theMaterials; // array of pointers to materials
     double   *matData;               // data for the materials [yloc and area]
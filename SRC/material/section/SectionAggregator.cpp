@@ -42,6 +42,7 @@
 #include <SectionAggregator.h>
 #include <MaterialResponse.h>
 #include <ID.h>
+#include <Parameter.h>
 
 #include <string.h>
 
@@ -153,7 +154,7 @@ SectionAggregator::SectionAggregator (int tag, SectionForceDeformation &theSec,
   SectionForceDeformation(tag, SEC_TAG_Aggregator), 
   theSection(0), theAdditions(0), matCodes(0), numMats(numAdds),
   e(0), s(0), ks(0), fs(0), theCode(0),
-  otherDbTag(0)
+  otherDbTag(0), eTrial(0), trialCurrent(false)
 {
     theSection = theSec.getCopy();
     
@@ -216,7 +217,7 @@ SectionAggregator::SectionAggregator (int tag, int numAdds,
   SectionForceDeformation(tag, SEC_TAG_Aggregator), 
   theSection(0), theAdditions(0), matCodes(0), numMats(numAdds),
   e(0), s(0), ks(0), fs(0), theCode(0),
-  otherDbTag(0)
+  otherDbTag(0), eTrial(0), trialCurrent(false)
 {
   if (!theAdds) {
     opserr << "SectionAggregator::SectionAggregator  " << tag << " -- null uniaxial material array passed\n";
@@ -272,7 +273,7 @@ SectionAggregator::SectionAggregator (int tag, SectionForceDeformation &theSec,
   SectionForceDeformation(tag, SEC_TAG_Aggregator),
   theSection(0), theAdditions(0), matCodes(0), numMats(1),
   e(0), s(0), ks(0), fs(0), theCode(0),
-  otherDbTag(0)
+  otherDbTag(0), eTrial(0), trialCurrent(false)
 {
   theSection = theSec.getCopy();
 
@@ -317,7 +318,7 @@ SectionAggregator::SectionAggregator():
   SectionForceDeformation(0, SEC_TAG_Aggregator),
   theSection(0), theAdditions(0), matCodes(0), numMats(0), 
   e(0), s(0), ks(0), fs(0), theCode(0),
-  otherDbTag(0)
+  otherDbTag(0), eTrial(0), trialCurrent(false)
 {
 
 }
@@ -354,10 +355,17 @@ SectionAggregator::~SectionAggregator()
 
    if (matCodes != 0)
      delete matCodes;
+
+   if (eTrial != 0)
+     delete eTrial;
 }
 
 int SectionAggregator::setTrialSectionDeformation (const Vector &def)
 {
+  // the section and materials already hold these deformations
+  if (trialCurrent == true && *eTrial == def)
+    return 0;
+
   int ret = 0;
   int i = 0;
 
@@ -377,6 +385,14 @@ int SectionAggregator::setTrialSectionDeformation (const Vector &def)
   
   for ( ; i < order; i++)
     ret += theAdditions[i-theSectionOrder]->setTrialStrain(def(i));
+
+  if (eTrial == 0 || eTrial->Size() != def.Size()) {
+    if (eTrial != 0)
+      delete eTrial;
+    eTrial = new Vector(def.Size());
+  }
+  *eTrial = def;
+  trialCurrent = (ret == 0);
   
   return ret;
 }
@@ -603,6 +619,8 @@ SectionAggregator::getOrder () const
 int
 SectionAggregator::commitState(void)
 {
+  trialCurrent = false;
+
   int err = 0;
     
   if (theSection)
@@ -617,6 +635,8 @@ SectionAggregator::commitState(void)
 int
 SectionAggregator::revertToLastCommit(void)
 {
+  trialCurrent = false;
+
   int err = 0;
   
   int i = 0;
@@ -635,6 +655,8 @@ SectionAggregator::revertToLastCommit(void)
 int
 SectionAggregator::revertToStart(void)
 {
+  trialCurrent = false;
+
   int err = 0;
   
   // Revert the section
@@ -754,6 +776,8 @@ SectionAggregator::sendSelf(int cTag, Channel &theChannel)
 int
 SectionAggregator::recvSelf(int cTag, Channel &theChannel, FEM_ObjectBroker &theBroker)
 {
+  trialCurrent = false;
+
   int res = 0;
 
   // Create an ID and receive tag and section order
@@ -989,6 +1013,9 @@ SectionAggregator::setParameter(const char **argv, int argc, Parameter &param)
 	  result = ok;
       }
     
+    if (result != -1)
+      param.addObject(1, this);
+
     return result;
   } 
   
@@ -1000,7 +1027,11 @@ SectionAggregator::setParameter(const char **argv, int argc, Parameter &param)
       return -1;
     }
 
-    return theSection->setParameter(&argv[1], argc-1, param);
+    result = theSection->setParameter(&argv[1], argc-1, param);
+    if (result != -1)
+      param.addObject(1, this);
+
+    return result;
   } 
 
   else { // Default -- send to everything
@@ -1017,9 +1048,24 @@ SectionAggregator::setParameter(const char **argv, int argc, Parameter &param)
     }
   }
 
+  // the updates go to the section and materials, this only needs to
+  // know of them to drop the deformations it has kept
+  if (result != -1)
+    param.addObject(1, this);
+
   return result;
 }
 
+int
+SectionAggregator::updateParameter(int parameterID, Information &info)
+{
+  // the state of the section and materials no longer follows from the
+  // deformations last set
+  trialCurrent = false;
+
+  return 0;
+}
+
 const Vector &
 SectionAggregator::getSectionDeformationSensitivity(int gradIndex)
 {
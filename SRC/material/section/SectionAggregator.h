@@ -91,6 +91,7 @@ class SectionAggregator : public SectionForceDeformation
 
     // AddingSensitivity:BEGIN //////////////////////////////////////////
     int setParameter(const char **argv, int argc, Parameter &param);
+    int updateParameter(int parameterID, Information &info);
     const Vector & getStressResultantSensitivity(int gradIndex, bool conditional);
     const Vector & getSectionDeformationSensitivity(int gradIndex);
     const Matrix & getSectionTangentSensitivity(int gradIndex);
@@ -120,6 +121,12 @@ class SectionAggregator : public SectionForceDeformation
    
     int otherDbTag;
 
+    // the deformations last set in the section and the materials, a
+    // setTrialSectionDeformation() with the same deformations is skipped
+    // until the state is committed or reverted or a parameter changes
+    Vector *eTrial;
+    bool trialCurrent;
+
     static double workArea[];
     static int codeArea[];
 
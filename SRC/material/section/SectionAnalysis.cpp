@@ -0,0 +1,245 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/material/section/SectionAnalysis.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of SectionAnalysis.
+//
+// What: "@(#) SectionAnalysis.cpp, revA"
+
+#include <SectionAnalysis.h>
+#include <SectionForceDeformation.h>
+#include <Vector.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <ThreadPool.h>
+#include <OPS_Globals.h>
+#include <math.h>
+
+SectionAnalysis::SectionAnalysis(double maxK, int nSteps, int axs,
+				 double tolerance, int mIter)
+  :maxCurvature(maxK), numSteps(nSteps), axis(axs),
+   tol(tolerance), maxIter(mIter)
+{
+  if (numSteps < 1)
+    numSteps = 1;
+  if (maxIter < 1)
+    maxIter = 1;
+}
+
+SectionAnalysis::~SectionAnalysis()
+{
+
+}
+
+int
+SectionAnalysis::momentCurvature(SectionForceDeformation &theSection, double P,
+				 double *kappa, double *M) const
+{
+  const ID &code = theSection.getType();
+  int order = theSection.getOrder();
+
+  // find the bending component, all others are free
+  int iM = -1;
+  for (int i = 0; i < order; i++)
+    if (code(i) == axis)
+      iM = i;
+
+  if (iM < 0) {
+    opserr << "SectionAnalysis::momentCurvature() - section " << theSection.getTag()
+	   << " has no moment about the axis " << axis << endln;
+    return 0;
+  }
+
+  int numFree = order-1;
+  Vector e(order);
+  Vector r(numFree);
+  Vector de(numFree);
+  Matrix kff(numFree, numFree);
+
+  int numPoints = 0;
+  for (int k = 0; k <= numSteps; k++) {
+
+    e(iM) = maxCurvature*k/numSteps;
+
+    // iterate on the free deformations until their resultants are P and 0
+    bool converged = false;
+    double deNorm = 0.0;
+    for (int iter = 0; iter <= maxIter; iter++) {
+
+      if (theSection.setTrialSectionDeformation(e) < 0)
+	break;
+
+      const Vector &s = theSection.getStressResultant();
+      if (numFree == 0 || (iter > 0 && deNorm <= tol)) {
+	M[numPoints] = s(iM);
+	converged = true;
+	break;
+      }
+
+      const Matrix &ks = theSection.getSectionTangent();
+      for (int i = 0, ii = 0; i < order; i++) {
+	if (i == iM)
+	  continue;
+	r(ii) = ((code(i) == SECTION_RESPONSE_P) ? P : 0.0) - s(i);
+	for (int j = 0, jj = 0; j < order; j++) {
+	  if (j == iM)
+	    continue;
+	  kff(ii,jj) = ks(i,j);
+	  jj++;
+	}
+	ii++;
+      }
+
+      if (kff.Solve(r, de) < 0)
+	break;
+
+      for (int i = 0, ii = 0; i < order; i++)
+	if (i != iM)
+	  e(i) += de(ii++);
+      deNorm = de.Norm();
+    }
+
+    if (converged == false)
+      break;
+
+    theSection.commitState();
+    kappa[numPoints] = e(iM);
+    numPoints++;
+  }
+
+  return numPoints;
+}
+
+int
+SectionAnalysis::momentCurvature(SectionForceDeformation **theSections,
+				 int numSections, const Vector &P,
+				 Matrix &kappa, Matrix &M, ID &numPoints) const
+{
+  int numP = P.Size();
+  int numRuns = numSections*numP;
+  int numPts = numSteps+1;
+
+  if (numRuns < 1) {
+    opserr << "SectionAnalysis::momentCurvature() - no sections or axial forces\n";
+    return -1;
+  }
+
+  kappa.resize(numRuns, numPts);
+  M.resize(numRuns, numPts);
+  numPoints.resize(numRuns);
+  kappa.Zero();
+  M.Zero();
+
+  // run() stores the points of each run contiguously, transpose them
+  double *k = new double[2*numRuns*numPts];
+  double *m = k + numRuns*numPts;
+  int res = this->run(theSections, numSections, P, k, m, &numPoints(0));
+
+  for (int i = 0; i < numRuns; i++)
+    for (int j = 0; j < numPoints(i); j++) {
+      kappa(i,j) = k[i*numPts+j];
+      M(i,j) = m[i*numPts+j];
+    }
+
+  delete [] k;
+  return res;
+}
+
+int
+SectionAnalysis::interaction(SectionForceDeformation **theSections,
+			     int numSections, const Vector &P, Matrix &Mmax) const
+{
+  int numP = P.Size();
+  int numRuns = numSections*numP;
+  int numPts = numSteps+1;
+
+  if (numRuns < 1) {
+    opserr << "SectionAnalysis::interaction() - no sections or axial forces\n";
+    return -1;
+  }
+
+  Mmax.resize(numSections, numP);
+  Mmax.Zero();
+
+  double *k = new double[2*numRuns*numPts];
+  double *m = k + numRuns*numPts;
+  int *numPoints = new int[numRuns];
+  int res = this->run(theSections, numSections, P, k, m, numPoints);
+
+  for (int i = 0; i < numSections; i++)
+    for (int j = 0; j < numP; j++) {
+      int run = i*numP+j;
+      const double *mRun = m + run*numPts;
+      double peak = 0.0;
+      for (int l = 0; l < numPoints[run]; l++)
+	if (fabs(mRun[l]) > fabs(peak))
+	  peak = mRun[l];
+      Mmax(i,j) = peak;
+    }
+
+  delete [] numPoints;
+  delete [] k;
+  return res;
+}
+
+int
+SectionAnalysis::run(SectionForceDeformation **theSections, int numSections,
+		     const Vector &P, double *kappa, double *M, int *numPoints) const
+{
+  int numP = P.Size();
+  int numRuns = numSections*numP;
+  int numPts = numSteps+1;
+
+  // the copies are made here and not in the threads, the constructors of
+  // some materials are not thread safe
+  SectionForceDeformation **theCopies = new SectionForceDeformation *[numRuns];
+  for (int i = 0; i < numSections; i++)
+    for (int j = 0; j < numP; j++)
+      theCopies[i*numP+j] = theSections[i]->getCopy();
+
+  const OPS_ThreadGlobals theGlobals;
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numT)
+#endif
+  for (int i = 0; i < numRuns; i++) {
+    theGlobals.set();
+    numPoints[i] = 0;
+    if (theCopies[i] != 0)
+      numPoints[i] = this->momentCurvature(*theCopies[i], P(i%numP),
+					   kappa + i*numPts, M + i*numPts);
+  }
+
+  int res = 0;
+  for (int i = 0; i < numRuns; i++) {
+    if (theCopies[i] == 0)
+      res = -1;
+    else
+      delete theCopies[i];
+  }
+  delete [] theCopies;
+
+  return res;
+}
@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/material/section/SectionAnalysis.h,v $
+
+#ifndef SectionAnalysis_h
+#define SectionAnalysis_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for SectionAnalysis.
+// SectionAnalysis runs moment-curvature and P-M interaction analyses of
+// sections directly on the SectionForceDeformation objects, without a
+// Domain or a ZeroLengthSection element. The curvature about one axis is
+// imposed in equal steps up to a maximum; at each step the other section
+// deformations are iterated on with Newton's method until the axial force
+// equals the given P and the other stress resultants are zero. A batch of
+// sections, each under one or more axial forces, is analysed on the threads
+// of the ThreadPool, each analysis working on its own copy of the section.
+//
+// What: "@(#) SectionAnalysis.h, revA"
+
+class SectionForceDeformation;
+class Vector;
+class Matrix;
+class ID;
+
+class SectionAnalysis
+{
+  public:
+    SectionAnalysis(double maxCurvature, int numSteps, int axis = 1,
+		    double tol = 1.0e-12, int maxIter = 25);
+    ~SectionAnalysis();
+
+    // the moment-curvature curve of theSection under the axial force P,
+    // numSteps+1 points stored in kappa and M; returns the number of
+    // converged points
+    int momentCurvature(SectionForceDeformation &theSection, double P,
+			double *kappa, double *M) const;
+
+    // the curve of section i under P(j) is stored in row i*numP+j of kappa
+    // and M, its number of converged points in numPoints(i*numP+j)
+    int momentCurvature(SectionForceDeformation **theSections, int numSections,
+			const Vector &P, Matrix &kappa, Matrix &M,
+			ID &numPoints) const;
+
+    // Mmax(i,j) is the peak moment of section i under the axial force P(j)
+    int interaction(SectionForceDeformation **theSections, int numSections,
+		    const Vector &P, Matrix &Mmax) const;
+
+  protected:
+
+  private:
+    int run(SectionForceDeformation **theSections, int numSections,
+	    const Vector &P, double *kappa, double *M, int *numPoints) const;
+
+    double maxCurvature;
+    int numSteps;
+    int axis;          // SECTION_RESPONSE_MZ or SECTION_RESPONSE_MY
+    double tol;        // on the norm of the deformation increments
+    int maxIter;
+};
+
+#endif
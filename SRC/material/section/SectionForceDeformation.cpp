@@ -47,15 +47,23 @@ void invertMatrix(int n, const Matrix &a, Matrix &b);
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theSectionForceDeformationObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theSectionForceDeformationObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theSectionForceDeformationObjects(void)
+{
+  if (theSectionForceDeformationObjectsPtr == 0)
+    theSectionForceDeformationObjectsPtr = new MapOfTaggedObjects();
+  return *theSectionForceDeformationObjectsPtr;
+}
 
 bool OPS_addSectionForceDeformation(SectionForceDeformation *newComponent) {
-  return theSectionForceDeformationObjects.addComponent(newComponent);
+  return theSectionForceDeformationObjects().addComponent(newComponent);
 }
 
 SectionForceDeformation *OPS_getSectionForceDeformation(int tag) {
 
-  TaggedObject *theResult = theSectionForceDeformationObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theSectionForceDeformationObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "SectionForceDeformation *getSectionForceDeformation(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -66,7 +74,7 @@ SectionForceDeformation *OPS_getSectionForceDeformation(int tag) {
 }
 
 void OPS_clearAllSectionForceDeformation(void) {
-  theSectionForceDeformationObjects.clearAll();
+  theSectionForceDeformationObjects().clearAll();
 }
 
 
@@ -152,6 +160,12 @@ SectionForceDeformation::getInitialFlexibility ()
   return *fDefault;
 }
 
+bool
+SectionForceDeformation::isLinear ()
+{
+  return false;
+}
+
 double 
 SectionForceDeformation::getRho(void) 
 {
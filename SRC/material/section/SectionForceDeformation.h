@@ -72,6 +72,10 @@ class SectionForceDeformation : public Material
   virtual const Matrix &getInitialTangent (void) = 0;
   virtual const Matrix &getSectionFlexibility (void);
   virtual const Matrix &getInitialFlexibility (void);
+
+  // true while the tangent does not depend on the section deformations,
+  // so an element may keep the flexibility once it has been formed
+  virtual bool isLinear (void);
   
   virtual double getRho(void);
   
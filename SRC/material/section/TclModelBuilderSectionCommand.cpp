@@ -2626,6 +2626,64 @@ buildSection(Tcl_Interp *interp, TclModelBuilder *theTclModelBuilder,
       for (i=0; i<numSectionRepresFibers; i++)
 	  fiber[i] = sectionRepresFibers[i];
 
+      // the fibers of the patches and layers of a uniaxial section are
+      // added from the arrays, without a Fiber object and a material copy
+      // made and deleted again for each of them
+      if (currentSectionIsND == false && (NDM == 2 || NDM == 3)) {
+	int numNewFibers = numFibers-numSectionRepresFibers;
+	UniaxialMaterial **fibersMat = new UniaxialMaterial *[numNewFibers+1];
+	Vector fibersY(numNewFibers+1);
+	Vector fibersZ(numNewFibers+1);
+	Vector fibersA(numNewFibers+1);
+	for (k = 0; k < numNewFibers; k++) {
+	  fibersMat[k] = OPS_getUniaxialMaterial(fibersMaterial(k));
+	  if (fibersMat[k] == 0) {
+	    opserr <<  "WARNING invalid UniaxialMaterial ID for patch\n";
+	    delete [] fibersMat;
+	    delete [] fiber;
+	    return TCL_ERROR;
+	  }
+	  fibersY(k) = fibersPosition(0,k);
+	  fibersZ(k) = fibersPosition(1,k);
+	  fibersA(k) = fibersArea(k);
+	}
+
+	SectionForceDeformation *section = 0;
+	int res = 0;
+	if (NDM == 2) {
+	  FiberSection2d *theSection = new FiberSection2d(secTag, numFibers);
+	  for (i = 0; i < numSectionRepresFibers; i++)
+	    res += theSection->addFiber(*fiber[i]);
+	  res += theSection->addFibers(numNewFibers, fibersMat, &fibersY(0), &fibersA(0));
+	  section = theSection;
+	} else {
+	  ElasticMaterial theGJ(0, GJ);
+	  FiberSection3d *theSection = new FiberSection3d(secTag, numFibers, isTorsion ? &theGJ : 0);
+	  for (i = 0; i < numSectionRepresFibers; i++)
+	    res += theSection->addFiber(*fiber[i]);
+	  res += theSection->addFibers(numNewFibers, fibersMat, &fibersY(0), &fibersZ(0), &fibersA(0));
+	  section = theSection;
+	}
+
+	for (i = 0; i < numSectionRepresFibers; i++)
+	  delete fiber[i];
+	delete [] fiber;
+	delete [] fibersMat;
+
+	if (res < 0) {
+	  opserr <<  "WARNING - cannot construct section\n";
+	  delete section;
+	  return TCL_ERROR;
+	}
+
+	if (OPS_addSectionForceDeformation(section) != true) {
+	  opserr <<  "WARNING - cannot add section\n";
+	  return TCL_ERROR;
+	}
+
+	return TCL_OK;
+      }
+
       // creates 2d section      
 
 
@@ -220,6 +220,8 @@ int
 RCSectionIntegration::updateParameter(int parameterID,
 				      Information &info)
 {
+  this->clearFiberTable();
+
   switch (parameterID) {
   case 1:
     d = info.theDouble;
@@ -425,6 +427,8 @@ int
 RCSectionIntegration::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
+  this->clearFiberTable();
+
   static Vector data(9);
 
   int dbTag = this->getDbTag();
@@ -296,6 +296,8 @@ int
 RCTBeamSectionIntegration::updateParameter(int parameterID,
 				      Information &info)
 {
+  this->clearFiberTable();
+
   switch (parameterID) {
   case 1:
     d = info.theDouble;
@@ -544,6 +546,8 @@ int
 RCTBeamSectionIntegration::recvSelf(int cTag, Channel &theChannel,
 			       FEM_ObjectBroker &theBroker)
 {
+  this->clearFiberTable();
+
   static Vector data(14);
   
   int dbTag = this->getDbTag();
@@ -26,14 +26,39 @@
 #include <Matrix.h>
 
 SectionIntegration::SectionIntegration(int classTag):
-  MovableObject(classTag)
+  MovableObject(classTag), fiberTable(0), tableFibers(0), sizeTable(0)
 {
   // Nothing to do
 }
 
 SectionIntegration::~SectionIntegration()
 {
-  // Nothing to do
+  if (fiberTable != 0)
+    delete [] fiberTable;
+}
+
+const double *
+SectionIntegration::getFiberTable(int nFibers)
+{
+  if (fiberTable != 0 && nFibers == tableFibers)
+    return fiberTable;
+
+  if (3*nFibers > sizeTable) {
+    if (fiberTable != 0)
+      delete [] fiberTable;
+    sizeTable = 3*nFibers;
+    fiberTable = new double[sizeTable];
+  }
+
+  for (int i = 0; i < 3*nFibers; i++)
+    fiberTable[i] = 0.0;
+
+  this->getFiberLocations(nFibers, fiberTable, fiberTable+nFibers);
+  this->getFiberWeights(nFibers, fiberTable+2*nFibers);
+
+  tableFibers = nFibers;
+
+  return fiberTable;
 }
 
 void
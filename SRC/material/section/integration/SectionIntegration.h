@@ -43,6 +43,12 @@ class SectionIntegration : public MovableObject
   virtual void getFiberLocations(int nFibers, double *yi, double *zi = 0) = 0;
   virtual void getFiberWeights(int nFibers, double *wt) = 0;
 
+  // The y locations, z locations and weights of the nFibers fibers, one
+  // after the other; formed on the first call and kept until nFibers or
+  // a parameter changes
+  const double *getFiberTable(int nFibers);
+  void clearFiberTable(void) {tableFibers = 0;}
+
   virtual SectionIntegration *getCopy(void) = 0;
 
   virtual void getLocationsDeriv(int nFibers, double *dyidh, double *dzidh = 0);
@@ -50,7 +56,10 @@ class SectionIntegration : public MovableObject
 
   virtual void Print(OPS_Stream &s, int flag = 0) = 0;
 
-
+ private:
+  double *fiberTable;
+  int tableFibers;
+  int sizeTable;
 };
 
 #endif
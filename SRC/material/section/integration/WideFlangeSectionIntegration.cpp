@@ -173,6 +173,8 @@ int
 WideFlangeSectionIntegration::updateParameter(int parameterID,
 					      Information &info)
 {
+  this->clearFiberTable();
+
   switch (parameterID) {
   case 1:
     d = info.theDouble;
@@ -336,6 +338,8 @@ int
 WideFlangeSectionIntegration::recvSelf(int cTag, Channel &theChannel,
 				       FEM_ObjectBroker &theBroker)
 {
+  this->clearFiberTable();
+
   static Vector data(6);
 
   int dbTag = this->getDbTag();
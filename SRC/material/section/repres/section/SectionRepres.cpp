@@ -32,16 +32,24 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theSectionRepresObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theSectionRepresObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theSectionRepresObjects(void)
+{
+  if (theSectionRepresObjectsPtr == 0)
+    theSectionRepresObjectsPtr = new MapOfTaggedObjects();
+  return *theSectionRepresObjectsPtr;
+}
 
 bool OPS_addSectionRepres(SectionRepres *newComponent)
 {
-    return theSectionRepresObjects.addComponent(newComponent);
+    return theSectionRepresObjects().addComponent(newComponent);
 }
 
 SectionRepres *OPS_getSectionRepres(int tag)
 {
-    TaggedObject *theResult = theSectionRepresObjects.getComponentPtr(tag);
+    TaggedObject *theResult = theSectionRepresObjects().getComponentPtr(tag);
     if(theResult == 0) {
 	return 0;
     }
@@ -52,7 +60,7 @@ SectionRepres *OPS_getSectionRepres(int tag)
 
 void OPS_clearAllSectionRepres(void)
 {
-    theSectionRepresObjects.clearAll();
+    theSectionRepresObjects().clearAll();
 }
 
 SectionRepres::SectionRepres(int tag):
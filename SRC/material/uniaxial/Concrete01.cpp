@@ -398,6 +398,56 @@ double Concrete01::getTangent ()
    return Ttangent;
 }
 
+int
+Concrete01::setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                          double *stresses, double *tangents, int n)
+{
+  // a subclass gets the default, which calls its own methods
+  if (this->getClassTag() != MAT_TAG_Concrete01)
+    return this->UniaxialMaterial::setTrialBatch(theMaterials, strains, stresses, tangents, n);
+
+  // theMaterials are all Concrete01 objects, bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Concrete01 *theMat = (Concrete01 *)theMaterials[i];
+    res += theMat->Concrete01::setTrial(strains[i], stresses[i], tangents[i]);
+  }
+
+  return res;
+}
+
+int
+Concrete01::commitBatch(UniaxialMaterial **theMaterials, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Concrete01)
+    return this->UniaxialMaterial::commitBatch(theMaterials, n);
+
+  // as for setTrialBatch(), bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += ((Concrete01 *)theMaterials[i])->Concrete01::commitState();
+
+  return res;
+}
+
+int
+Concrete01::revertBatch(UniaxialMaterial **theMaterials,
+            double *stresses, double *tangents, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Concrete01)
+    return this->UniaxialMaterial::revertBatch(theMaterials, stresses, tangents, n);
+
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Concrete01 *theMat = (Concrete01 *)theMaterials[i];
+    res += theMat->Concrete01::revertToLastCommit();
+    stresses[i] = theMat->Concrete01::getStress();
+    tangents[i] = theMat->Concrete01::getTangent();
+  }
+
+  return res;
+}
+
 int Concrete01::commitState ()
 {
    // History variables
@@ -91,34 +91,66 @@ OPS_Concrete02()
 Concrete02::Concrete02(int tag, double _fc, double _epsc0, double _fcu,
 		       double _epscu, double _rat, double _ft, double _Ets):
   UniaxialMaterial(tag, MAT_TAG_Concrete02),
-  fc(_fc), epsc0(_epsc0), fcu(_fcu), epscu(_epscu), rat(_rat), ft(_ft), Ets(_Ets)
+  par(new Concrete02Parameters)
 {
+  par->refs = 1;
+  par->fc = _fc;
+  par->epsc0 = _epsc0;
+  par->fcu = _fcu;
+  par->epscu = _epscu;
+  par->rat = _rat;
+  par->ft = _ft;
+  par->Ets = _Ets;
+
   ecminP = 0.0;
   deptP = 0.0;
 
-  eP = 2.0*fc/epsc0;
+  eP = 2.0*par->fc/par->epsc0;
   epsP = 0.0;
   sigP = 0.0;
   eps = 0.0;
   sig = 0.0;
-  e = 2.0*fc/epsc0;
+  e = 2.0*par->fc/par->epsc0;
 }
 
 Concrete02::Concrete02(void):
-  UniaxialMaterial(0, MAT_TAG_Concrete02)
+  UniaxialMaterial(0, MAT_TAG_Concrete02),
+  par(new Concrete02Parameters)
+{
+  par->refs = 1;
+}
+
+// a copy of theMaterial sharing its parameters
+Concrete02::Concrete02(int tag, Concrete02Parameters *thePar):
+  UniaxialMaterial(tag, MAT_TAG_Concrete02),
+  par(thePar)
 {
- 
+  par->refs++;
+
+  this->Concrete02::revertToStart();
 }
 
 Concrete02::~Concrete02(void)
 {
-  // Does nothing
+  if (--par->refs == 0)
+    delete par;
+}
+
+// makes the parameters private to this material before they are changed
+void
+Concrete02::ownParameters(void)
+{
+  if (par->refs > 1) {
+    par->refs--;
+    par = new Concrete02Parameters(*par);
+    par->refs = 1;
+  }
 }
 
 UniaxialMaterial*
 Concrete02::getCopy(void)
 {
-  Concrete02 *theCopy = new Concrete02(this->getTag(), fc, epsc0, fcu, epscu, rat, ft, Ets);
+  Concrete02 *theCopy = new Concrete02(this->getTag(), par);
   
   return theCopy;
 }
@@ -126,13 +158,13 @@ Concrete02::getCopy(void)
 double
 Concrete02::getInitialTangent(void)
 {
-  return 2.0*fc/epsc0;
+  return 2.0*par->fc/par->epsc0;
 }
 
 int
 Concrete02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double  ec0 = fc * 2. / epsc0;
+  double  ec0 = par->fc * 2. / par->epsc0;
 
   // retrieve concrete hitory variables
 
@@ -164,7 +196,7 @@ Concrete02::setTrialStrain(double trialStrain, double strainRate)
     // (corresponding equations are 2.31 and 2.32 
     // the strain of point R is epsR and the stress is sigmR 
     
-    double epsr = (fcu - rat * ec0 * epscu) / (ec0 * (1.0 - rat));
+    double epsr = (par->fcu - par->rat * ec0 * par->epscu) / (ec0 * (1.0 - par->rat));
     double sigmr = ec0 * epsr;
     
     // calculate the previous minimum stress sigmm from the minimum 
@@ -250,6 +282,58 @@ Concrete02::getTangent(void)
   return e;
 }
 
+int
+Concrete02::setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                          double *stresses, double *tangents, int n)
+{
+  // a subclass gets the default, which calls its own methods
+  if (this->getClassTag() != MAT_TAG_Concrete02)
+    return this->UniaxialMaterial::setTrialBatch(theMaterials, strains, stresses, tangents, n);
+
+  // theMaterials are all Concrete02 objects, bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Concrete02 *theMat = (Concrete02 *)theMaterials[i];
+    res += theMat->Concrete02::setTrialStrain(strains[i]);
+    stresses[i] = theMat->Concrete02::getStress();
+    tangents[i] = theMat->Concrete02::getTangent();
+  }
+
+  return res;
+}
+
+int
+Concrete02::commitBatch(UniaxialMaterial **theMaterials, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Concrete02)
+    return this->UniaxialMaterial::commitBatch(theMaterials, n);
+
+  // as for setTrialBatch(), bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += ((Concrete02 *)theMaterials[i])->Concrete02::commitState();
+
+  return res;
+}
+
+int
+Concrete02::revertBatch(UniaxialMaterial **theMaterials,
+            double *stresses, double *tangents, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Concrete02)
+    return this->UniaxialMaterial::revertBatch(theMaterials, stresses, tangents, n);
+
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Concrete02 *theMat = (Concrete02 *)theMaterials[i];
+    res += theMat->Concrete02::revertToLastCommit();
+    stresses[i] = theMat->Concrete02::getStress();
+    tangents[i] = theMat->Concrete02::getTangent();
+  }
+
+  return res;
+}
+
 int 
 Concrete02::commitState(void)
 {
@@ -280,12 +364,12 @@ Concrete02::revertToStart(void)
   ecminP = 0.0;
   deptP = 0.0;
 
-  eP = 2.0*fc/epsc0;
+  eP = 2.0*par->fc/par->epsc0;
   epsP = 0.0;
   sigP = 0.0;
   eps = 0.0;
   sig = 0.0;
-  e = 2.0*fc/epsc0;
+  e = 2.0*par->fc/par->epsc0;
 
   return 0;
 }
@@ -294,13 +378,13 @@ int
 Concrete02::sendSelf(int commitTag, Channel &theChannel)
 {
   static Vector data(13);
-  data(0) =fc;    
-  data(1) =epsc0; 
-  data(2) =fcu;   
-  data(3) =epscu; 
-  data(4) =rat;   
-  data(5) =ft;    
-  data(6) =Ets;   
+  data(0) =par->fc;    
+  data(1) =par->epsc0; 
+  data(2) =par->fcu;   
+  data(3) =par->epscu; 
+  data(4) =par->rat;   
+  data(5) =par->ft;    
+  data(6) =par->Ets;   
   data(7) =ecminP;
   data(8) =deptP; 
   data(9) =epsP;  
@@ -327,13 +411,15 @@ Concrete02::recvSelf(int commitTag, Channel &theChannel,
     return -1;
   }
 
-  fc = data(0);
-  epsc0 = data(1);
-  fcu = data(2);
-  epscu = data(3);
-  rat = data(4);
-  ft = data(5);
-  Ets = data(6);
+  this->ownParameters();
+
+  par->fc = data(0);
+  par->epsc0 = data(1);
+  par->fcu = data(2);
+  par->epscu = data(3);
+  par->rat = data(4);
+  par->ft = data(5);
+  par->Ets = data(6);
   ecminP = data(7);
   deptP = data(8);
   epsP = data(9);
@@ -371,17 +457,17 @@ Concrete02::Tens_Envlp (double epsc, double &sigc, double &Ect)
 !    Ect  = tangent concrete modulus
 !-----------------------------------------------------------------------*/
   
-  double Ec0  = 2.0*fc/epsc0;
+  double Ec0  = 2.0*par->fc/par->epsc0;
 
-  double eps0 = ft/Ec0;
-  double epsu = ft*(1.0/Ets+1.0/Ec0);
+  double eps0 = par->ft/Ec0;
+  double epsu = par->ft*(1.0/par->Ets+1.0/Ec0);
   if (epsc<=eps0) {
     sigc = epsc*Ec0;
     Ect  = Ec0;
   } else {
     if (epsc<=epsu) {
-      Ect  = -Ets;
-      sigc = ft-Ets*(epsc-eps0);
+      Ect  = -par->Ets;
+      sigc = par->ft-par->Ets*(epsc-eps0);
     } else {
       //      Ect  = 0.0
       Ect  = 1.0e-10;
@@ -410,23 +496,23 @@ Concrete02::Compr_Envlp (double epsc, double &sigc, double &Ect)
 !   Ect   = tangent concrete modulus
 -----------------------------------------------------------------------*/
 
-  double Ec0  = 2.0*fc/epsc0;
+  double Ec0  = 2.0*par->fc/par->epsc0;
 
-  double ratLocal = epsc/epsc0;
-  if (epsc>=epsc0) {
-    sigc = fc*ratLocal*(2.0-ratLocal);
+  double ratLocal = epsc/par->epsc0;
+  if (epsc>=par->epsc0) {
+    sigc = par->fc*ratLocal*(2.0-ratLocal);
     Ect  = Ec0*(1.0-ratLocal);
   } else {
     
     //   linear descending branch between epsc0 and epscu
-    if (epsc>epscu) {
-      sigc = (fcu-fc)*(epsc-epsc0)/(epscu-epsc0)+fc;
-      Ect  = (fcu-fc)/(epscu-epsc0);
+    if (epsc>par->epscu) {
+      sigc = (par->fcu-par->fc)*(epsc-par->epsc0)/(par->epscu-par->epsc0)+par->fc;
+      Ect  = (par->fcu-par->fc)/(par->epscu-par->epsc0);
     } else {
 	   
       // flat friction branch for strains larger than epscu
       
-      sigc = fcu;
+      sigc = par->fcu;
       Ect  = 1.0e-10;
       //       Ect  = 0.0
     }
@@ -438,7 +524,7 @@ int
 Concrete02::getVariable(const char *varName, Information &theInfo)
 {
   if (strcmp(varName,"ec") == 0) {
-    theInfo.theDouble = epsc0;
+    theInfo.theDouble = par->epsc0;
     return 0;
   } else
     return -1;
@@ -57,6 +57,11 @@ class Concrete02 : public UniaxialMaterial
     UniaxialMaterial *getCopy(void);
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                      double *stresses, double *tangents, int n);
+    int commitBatch(UniaxialMaterial **theMaterials, int n);
+    int revertBatch(UniaxialMaterial **theMaterials,
+                    double *stresses, double *tangents, int n);
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
@@ -80,13 +85,23 @@ class Concrete02 : public UniaxialMaterial
     void Compr_Envlp (double epsc, double &sigc, double &Ect);
 
     // matpar : Concrete FIXED PROPERTIES
-    double fc;    // concrete compression strength           : mp(1)
-    double epsc0; // strain at compression strength          : mp(2)
-    double fcu;   // stress at ultimate (crushing) strain    : mp(3)
-    double epscu; // ultimate (crushing) strain              : mp(4)       
-    double rat;   // ratio between unloading slope at epscu and original slope : mp(5)
-    double ft;    // concrete tensile strength               : mp(6)
-    double Ets;   // tension stiffening slope                : mp(7)
+    // the parameters do not change; they are shared by the copies of a
+    // material made by getCopy(), which need only their own state
+    struct Concrete02Parameters {
+      double fc;    // concrete compression strength           : mp(1)
+      double epsc0; // strain at compression strength          : mp(2)
+      double fcu;   // stress at ultimate (crushing) strain    : mp(3)
+      double epscu; // ultimate (crushing) strain              : mp(4)       
+      double rat;   // ratio between unloading slope at epscu and original slope : mp(5)
+      double ft;    // concrete tensile strength               : mp(6)
+      double Ets;   // tension stiffening slope                : mp(7)
+      int refs;
+    };
+    Concrete02Parameters *par;
+
+    Concrete02(int tag, Concrete02Parameters *thePar);
+    void ownParameters(void);
+
 
     // hstvP : Concerete HISTORY VARIABLES last committed step
     double ecminP;  //  hstP(1)
@@ -137,7 +137,9 @@ ParallelMaterial::ParallelMaterial(
 				 Vector *factors)
 :UniaxialMaterial(tag, MAT_TAG_ParallelMaterial),
  trialStrain(0.0), trialStrainRate(0.0), numMaterials(num),
- theModels(0), theFactors(0)
+ theModels(0), theFactors(0),
+ trialCurrent(false), stressCurrent(false), tangentCurrent(false),
+ trialStress(0.0), trialTangent(0.0)
 {
     // create an array (theModels) to store copies of the MaterialModels
     theModels = new UniaxialMaterial *[num];
@@ -168,7 +170,9 @@ ParallelMaterial::ParallelMaterial(
 ParallelMaterial::ParallelMaterial()
 :UniaxialMaterial(0,MAT_TAG_ParallelMaterial),
  trialStrain(0.0), trialStrainRate(0.0), numMaterials(0),
- theModels(0), theFactors(0)
+ theModels(0), theFactors(0),
+ trialCurrent(false), stressCurrent(false), tangentCurrent(false),
+ trialStress(0.0), trialTangent(0.0)
 {
 
 }
@@ -194,6 +198,10 @@ ParallelMaterial::~ParallelMaterial()
 int 
 ParallelMaterial::setTrialStrain(double strain, double strainRate)
 {
+    // the local MaterialModel objects already hold this strain
+    if (trialCurrent == true && strain == trialStrain && strainRate == trialStrainRate)
+      return 0;
+
     // set the trialStrain and the trialStrain in each of the
     // local MaterialModel objects 
     trialStrain = strain;
@@ -202,6 +210,10 @@ ParallelMaterial::setTrialStrain(double strain, double strainRate)
     for (int i=0; i<numMaterials; i++)
       theModels[i]->setTrialStrain(strain, strainRate);
 
+    trialCurrent = true;
+    stressCurrent = false;
+    tangentCurrent = false;
+
     return 0;
 }
 
@@ -221,6 +233,9 @@ ParallelMaterial::getStrainRate(void)
 double 
 ParallelMaterial::getStress(void)
 {
+    if (stressCurrent == true)
+      return trialStress;
+
     // get the stress = sum of stress in all local MaterialModel objects
     double stress = 0.0;
     if (theFactors == 0) {
@@ -231,6 +246,11 @@ ParallelMaterial::getStress(void)
             stress += (*theFactors)(i) * theModels[i]->getStress();
     }
 
+    if (trialCurrent == true) {
+      trialStress = stress;
+      stressCurrent = true;
+    }
+
     return stress;
 }
 
@@ -239,6 +259,9 @@ ParallelMaterial::getStress(void)
 double 
 ParallelMaterial::getTangent(void)
 {
+    if (tangentCurrent == true)
+      return trialTangent;
+
     // get the tangent = sum of tangents in all local MaterialModel objects    
     double E = 0.0;
     if (theFactors == 0) {
@@ -249,6 +272,11 @@ ParallelMaterial::getTangent(void)
             E += (*theFactors)(i) * theModels[i]->getTangent();
     }
 
+    if (trialCurrent == true) {
+      trialTangent = E;
+      tangentCurrent = true;
+    }
+
     return E;
 }
 
@@ -287,6 +315,10 @@ ParallelMaterial::getDampTangent(void)
 int 
 ParallelMaterial::commitState(void)
 {
+  trialCurrent = false;
+  stressCurrent = false;
+  tangentCurrent = false;
+
   // invoke commitState() on each of local MaterialModel objects
   for (int i=0; i<numMaterials; i++)
     if (theModels[i]->commitState() != 0) {
@@ -301,6 +333,10 @@ ParallelMaterial::commitState(void)
 int 
 ParallelMaterial::revertToLastCommit(void)
 {
+  trialCurrent = false;
+  stressCurrent = false;
+  tangentCurrent = false;
+
   // invoke commitState() on each of local MaterialModel objects
   for (int i=0; i<numMaterials; i++)
     if (theModels[i]->revertToLastCommit() != 0) {
@@ -316,6 +352,10 @@ ParallelMaterial::revertToLastCommit(void)
 int 
 ParallelMaterial::revertToStart(void)
 {
+    trialCurrent = false;
+    stressCurrent = false;
+    tangentCurrent = false;
+
     trialStrain = 0.0;
     trialStrainRate = 0.0;
 
@@ -406,6 +446,10 @@ int
 ParallelMaterial::recvSelf(int cTag, Channel &theChannel, 
 				FEM_ObjectBroker &theBroker)
 {
+    trialCurrent = false;
+    stressCurrent = false;
+    tangentCurrent = false;
+
     int res = 0;
     static ID data(3);
     int dbTag = this->getDbTag();
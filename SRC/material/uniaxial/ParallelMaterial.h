@@ -80,6 +80,12 @@ class ParallelMaterial : public UniaxialMaterial
     int numMaterials;   // the number of UniaxialMaterials in the aggregation
     UniaxialMaterial **theModels; // an array of pointers to the UniaxialMaterials
     Vector *theFactors;  // vector with material factors
+
+    // the stress and tangent of the trial strain, kept until the strain
+    // changes or the state is committed or reverted
+    bool trialCurrent;     // the models hold trialStrain and trialStrainRate
+    bool stressCurrent, tangentCurrent;
+    double trialStress, trialTangent;
 };
 
 #endif
@@ -336,6 +336,56 @@ double Steel01::getTangent ()
    return Ttangent;
 }
 
+int
+Steel01::setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                       double *stresses, double *tangents, int n)
+{
+  // a subclass gets the default, which calls its own methods
+  if (this->getClassTag() != MAT_TAG_Steel01)
+    return this->UniaxialMaterial::setTrialBatch(theMaterials, strains, stresses, tangents, n);
+
+  // theMaterials are all Steel01 objects, bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Steel01 *theMat = (Steel01 *)theMaterials[i];
+    res += theMat->Steel01::setTrial(strains[i], stresses[i], tangents[i]);
+  }
+
+  return res;
+}
+
+int
+Steel01::commitBatch(UniaxialMaterial **theMaterials, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Steel01)
+    return this->UniaxialMaterial::commitBatch(theMaterials, n);
+
+  // as for setTrialBatch(), bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += ((Steel01 *)theMaterials[i])->Steel01::commitState();
+
+  return res;
+}
+
+int
+Steel01::revertBatch(UniaxialMaterial **theMaterials,
+         double *stresses, double *tangents, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Steel01)
+    return this->UniaxialMaterial::revertBatch(theMaterials, stresses, tangents, n);
+
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Steel01 *theMat = (Steel01 *)theMaterials[i];
+    res += theMat->Steel01::revertToLastCommit();
+    stresses[i] = theMat->Steel01::getStress();
+    tangents[i] = theMat->Steel01::getTangent();
+  }
+
+  return res;
+}
+
 int Steel01::commitState ()
 {
    // History variables
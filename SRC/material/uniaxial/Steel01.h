@@ -59,6 +59,11 @@ class Steel01 : public UniaxialMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
+    int setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                      double *stresses, double *tangents, int n);
+    int commitBatch(UniaxialMaterial **theMaterials, int n);
+    int revertBatch(UniaxialMaterial **theMaterials,
+                    double *stresses, double *tangents, int n);
     double getStrain(void);              
     double getStress(void);
     double getTangent(void);
@@ -46,6 +46,11 @@
 
 #include <elementAPI.h>
 #include <OPS_Globals.h>
+#include <Workspace.h>
+
+static char epsratKey;
+static char RKey;
+static char onCurveKey;
 
 
 void *
@@ -131,19 +136,31 @@ Steel02::Steel02(int tag,
 		 double _R0, double _cR1, double _cR2,
 		 double _a1, double _a2, double _a3, double _a4, double sigInit):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), a1(_a1), a2(_a2), a3(_a3), a4(_a4), 
-  sigini(sigInit)
+  par(new Steel02Parameters)
 {
+  par->refs = 1;
+  par->Fy = _Fy;
+  par->E0 = _E0;
+  par->b = _b;
+  par->R0 = _R0;
+  par->cR1 = _cR1;
+  par->cR2 = _cR2;
+  par->a1 = _a1;
+  par->a2 = _a2;
+  par->a3 = _a3;
+  par->a4 = _a4;
+  par->sigini = sigInit;
+
   konP = 0;
   kon = 0;
-  eP = E0;
+  eP = par->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;
+  e = par->E0;
 
-  epsmaxP = Fy/E0;
+  epsmaxP = par->Fy/par->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -151,9 +168,9 @@ Steel02::Steel02(int tag,
   epssrP = 0.0;
   sigsrP = 0.0;
 
-  if (sigini != 0.0) {
-    epsP = sigini/E0;
-    sigP = sigini;
+  if (par->sigini != 0.0) {
+    epsP = par->sigini/par->E0;
+    sigP = par->sigini;
   } 
 }
 
@@ -161,24 +178,33 @@ Steel02::Steel02(int tag,
 		 double _Fy, double _E0, double _b,
 		 double _R0, double _cR1, double _cR2):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), R0(_R0), cR1(_cR1), cR2(_cR2), sigini(0.0)
+  par(new Steel02Parameters)
 {
+  par->refs = 1;
+  par->Fy = _Fy;
+  par->E0 = _E0;
+  par->b = _b;
+  par->R0 = _R0;
+  par->cR1 = _cR1;
+  par->cR2 = _cR2;
+  par->sigini = 0.0;
+
   konP = 0;
 
   // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
+  par->a1 = 0.0;
+  par->a2 = 1.0;
+  par->a3 = 0.0;
+  par->a4 = 1.0;
 
-  eP = E0;
+  eP = par->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;
+  e = par->E0;
 
-  epsmaxP = Fy/E0;
+  epsmaxP = par->Fy/par->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -189,29 +215,35 @@ Steel02::Steel02(int tag,
 
 Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
   UniaxialMaterial(tag, MAT_TAG_Steel02),
-  Fy(_Fy), E0(_E0), b(_b), sigini(0.0)
+  par(new Steel02Parameters)
 {
+  par->refs = 1;
+  par->Fy = _Fy;
+  par->E0 = _E0;
+  par->b = _b;
+  par->sigini = 0.0;
+
   konP = 0;
 
   // Default values for elastic to hardening transitions
-  R0 = 15.0;
-  cR1 = 0.925;
-  cR2 = 0.15;
+  par->R0 = 15.0;
+  par->cR1 = 0.925;
+  par->cR2 = 0.15;
 
   // Default values for no isotropic hardening
-  a1 = 0.0;
-  a2 = 1.0;
-  a3 = 0.0;
-  a4 = 1.0;
+  par->a1 = 0.0;
+  par->a2 = 1.0;
+  par->a3 = 0.0;
+  par->a4 = 1.0;
 
-  eP = E0;
+  eP = par->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;
+  e = par->E0;
 
-  epsmaxP = Fy/E0;
+  epsmaxP = par->Fy/par->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -221,20 +253,47 @@ Steel02::Steel02(int tag, double _Fy, double _E0, double _b):
 }
 
 Steel02::Steel02(void):
-  UniaxialMaterial(0, MAT_TAG_Steel02)
+  UniaxialMaterial(0, MAT_TAG_Steel02),
+  par(new Steel02Parameters)
 {
+  par->refs = 1;
+
   konP = 0;
 }
 
+// a copy of theMaterial sharing its parameters
+Steel02::Steel02(int tag, Steel02Parameters *thePar):
+  UniaxialMaterial(tag, MAT_TAG_Steel02),
+  par(thePar)
+{
+  par->refs++;
+
+  konP = 0;
+  kon = 0;
+  this->Steel02::revertToStart();
+}
+
 Steel02::~Steel02(void)
 {
-  // Does nothing
+  if (--par->refs == 0)
+    delete par;
+}
+
+// makes the parameters private to this material before they are changed
+void
+Steel02::ownParameters(void)
+{
+  if (par->refs > 1) {
+    par->refs--;
+    par = new Steel02Parameters(*par);
+    par->refs = 1;
+  }
 }
 
 UniaxialMaterial*
 Steel02::getCopy(void)
 {
-  Steel02 *theCopy = new Steel02(this->getTag(), Fy, E0, b, R0, cR1, cR2, a1, a2, a3, a4, sigini);
+  Steel02 *theCopy = new Steel02(this->getTag(), par);
   
   return theCopy;
 }
@@ -242,18 +301,36 @@ Steel02::getCopy(void)
 double
 Steel02::getInitialTangent(void)
 {
-  return E0;
+  return par->E0;
 }
 
 int
 Steel02::setTrialStrain(double trialStrain, double strainRate)
 {
-  double Esh = b * E0;
-  double epsy = Fy / E0;
+  double epsrat, R;
+  if (this->setTrialBranch(trialStrain, epsrat, R) == false)
+    return 0;
+
+  double dum1  = 1.0 + pow(fabs(epsrat),R);
+  double dum2  = pow(dum1,(1/R));
+
+  this->setTrialCurve(epsrat, dum1, dum2);
+
+  return 0;
+}
+
+// sets the branch of the response for trialStrain and returns the strain
+// ratio and exponent R of its Menegotto-Pinto curve, or false if the
+// stress and tangent are set without it
+bool
+Steel02::setTrialBranch(double trialStrain, double &epsrat, double &R)
+{
+  double Esh = par->b * par->E0;
+  double epsy = par->Fy / par->E0;
 
   // modified C-P. Lamarche 2006
-  if (sigini != 0.0) {
-    double epsini = sigini/E0;
+  if (par->sigini != 0.0) {
+    double epsini = par->sigini/par->E0;
     eps = trialStrain+epsini;
   } else
     eps = trialStrain;
@@ -275,10 +352,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
 
     if (fabs(deps) < 10.0*DBL_EPSILON) {
 
-      e = E0;
-      sig = sigini;                // modified C-P. Lamarche 2006
+      e = par->E0;
+      sig = par->sigini;                // modified C-P. Lamarche 2006
       kon = 3;                     // modified C-P. Lamarche 2006 flag to impose initial stess/strain
-      return 0;
+      return false;
 
     } else {
 
@@ -287,12 +364,12 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
       if (deps < 0.0) {
 	kon = 2;
 	epss0 = epsmin;
-	sigs0 = -Fy;
+	sigs0 = -par->Fy;
 	epspl = epsmin;
       } else {
 	kon = 1;
 	epss0 = epsmax;
-	sigs0 = Fy;
+	sigs0 = par->Fy;
 	epspl = epsmax;
       }
     }
@@ -315,10 +392,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
     //epsmin = min(epsP, epsmin);
     if (epsP < epsmin)
       epsmin = epsP;
-    double d1 = (epsmax - epsmin) / (2.0*(a4 * epsy));
-    double shft = 1.0 + a3 * pow(d1, 0.8);
-    epss0 = (Fy * shft - Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = Fy * shft + Esh * (epss0 - epsy * shft);
+    double d1 = (epsmax - epsmin) / (2.0*(par->a4 * epsy));
+    double shft = 1.0 + par->a3 * pow(d1, 0.8);
+    epss0 = (par->Fy * shft - Esh * epsy * shft - sigr + par->E0 * epsr) / (par->E0 - Esh);
+    sigs0 = par->Fy * shft + Esh * (epss0 - epsy * shft);
     epspl = epsmax;
 
   } else if (kon == 1 && deps < 0.0) {
@@ -337,10 +414,10 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
     if (epsP > epsmax)
       epsmax = epsP;
     
-    double d1 = (epsmax - epsmin) / (2.0*(a2 * epsy));
-    double shft = 1.0 + a1 * pow(d1, 0.8);
-    epss0 = (-Fy * shft + Esh * epsy * shft - sigr + E0 * epsr) / (E0 - Esh);
-    sigs0 = -Fy * shft + Esh * (epss0 + epsy * shft);
+    double d1 = (epsmax - epsmin) / (2.0*(par->a2 * epsy));
+    double shft = 1.0 + par->a1 * pow(d1, 0.8);
+    epss0 = (-par->Fy * shft + Esh * epsy * shft - sigr + par->E0 * epsr) / (par->E0 - Esh);
+    sigs0 = -par->Fy * shft + Esh * (epss0 + epsy * shft);
     epspl = epsmin;
   }
 
@@ -348,18 +425,22 @@ Steel02::setTrialStrain(double trialStrain, double strainRate)
   // calculate current stress sig and tangent modulus E 
 
   double xi     = fabs((epspl-epss0)/epsy);
-  double R      = R0*(1.0 - (cR1*xi)/(cR2+xi));
-  double epsrat = (eps-epsr)/(epss0-epsr);
-  double dum1  = 1.0 + pow(fabs(epsrat),R);
-  double dum2  = pow(dum1,(1/R));
+  R      = par->R0*(1.0 - (par->cR1*xi)/(par->cR2+xi));
+  epsrat = (eps-epsr)/(epss0-epsr);
 
-  sig   = b*epsrat +(1.0-b)*epsrat/dum2;
+  return true;
+}
+
+// sets the stress and tangent on the curve, dum1 = 1 + |epsrat|^R and
+// dum2 = dum1^(1/R)
+void
+Steel02::setTrialCurve(double epsrat, double dum1, double dum2)
+{
+  sig   = par->b*epsrat +(1.0-par->b)*epsrat/dum2;
   sig   = sig*(sigs0-sigr)+sigr;
 
-  e = b + (1.0-b)/(dum1*dum2);
+  e = par->b + (1.0-par->b)/(dum1*dum2);
   e = e*(sigs0-sigr)/(epss0-epsr);
-
-  return 0;
 }
 
 
@@ -382,6 +463,88 @@ Steel02::getTangent(void)
   return e;
 }
 
+int
+Steel02::setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                       double *stresses, double *tangents, int n)
+{
+  // a subclass gets the default, which calls its own methods
+  if (this->getClassTag() != MAT_TAG_Steel02)
+    return this->UniaxialMaterial::setTrialBatch(theMaterials, strains, stresses, tangents, n);
+
+  // theMaterials are all Steel02 objects; set the branch of each, then
+  // evaluate the powers of the curves in one loop with no calls in it,
+  // which the compiler can vectorize with the vector math library, and
+  // then set the stresses and tangents
+  double *epsrat = Workspace::getDoubles(&epsratKey, n);
+  double *R = Workspace::getDoubles(&RKey, n);
+  double *onCurve = Workspace::getDoubles(&onCurveKey, n);
+
+  for (int i = 0; i < n; i++) {
+    Steel02 *theMat = (Steel02 *)theMaterials[i];
+    if (theMat->setTrialBranch(strains[i], epsrat[i], R[i]) == true)
+      onCurve[i] = 1.0;
+    else {
+      onCurve[i] = 0.0;
+      epsrat[i] = 0.0;
+      R[i] = 1.0;
+    }
+  }
+
+  // epsrat becomes dum1 and R becomes dum2
+#ifdef _OPENMP
+#pragma omp simd
+#endif
+  for (int i = 0; i < n; i++) {
+    double dum1 = 1.0 + pow(fabs(epsrat[i]), R[i]);
+    double dum2 = pow(dum1, 1.0/R[i]);
+    stresses[i] = epsrat[i];
+    epsrat[i] = dum1;
+    R[i] = dum2;
+  }
+
+  for (int i = 0; i < n; i++) {
+    Steel02 *theMat = (Steel02 *)theMaterials[i];
+    if (onCurve[i] != 0.0)
+      theMat->setTrialCurve(stresses[i], epsrat[i], R[i]);
+    stresses[i] = theMat->sig;
+    tangents[i] = theMat->e;
+  }
+
+  return 0;
+}
+
+int
+Steel02::commitBatch(UniaxialMaterial **theMaterials, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Steel02)
+    return this->UniaxialMaterial::commitBatch(theMaterials, n);
+
+  // as for setTrialBatch(), bind the calls statically
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += ((Steel02 *)theMaterials[i])->Steel02::commitState();
+
+  return res;
+}
+
+int
+Steel02::revertBatch(UniaxialMaterial **theMaterials,
+         double *stresses, double *tangents, int n)
+{
+  if (this->getClassTag() != MAT_TAG_Steel02)
+    return this->UniaxialMaterial::revertBatch(theMaterials, stresses, tangents, n);
+
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    Steel02 *theMat = (Steel02 *)theMaterials[i];
+    res += theMat->Steel02::revertToLastCommit();
+    stresses[i] = theMat->Steel02::getStress();
+    tangents[i] = theMat->Steel02::getTangent();
+  }
+
+  return res;
+}
+
 int 
 Steel02::commitState(void)
 {
@@ -422,15 +585,15 @@ Steel02::revertToLastCommit(void)
 int 
 Steel02::revertToStart(void)
 {
-  eP = E0;
+  eP = par->E0;
   epsP = 0.0;
   sigP = 0.0;
   sig = 0.0;
   eps = 0.0;
-  e = E0;  
+  e = par->E0;  
 
   konP = 0;
-  epsmaxP = Fy/E0;
+  epsmaxP = par->Fy/par->E0;
   epsminP = -epsmaxP;
   epsplP = 0.0;
   epss0P = 0.0;
@@ -438,9 +601,9 @@ Steel02::revertToStart(void)
   epssrP = 0.0;
   sigsrP = 0.0;
 
-  if (sigini != 0.0) {
-	  epsP = sigini/E0;
-	  sigP = sigini;
+  if (par->sigini != 0.0) {
+	  epsP = par->sigini/par->E0;
+	  sigP = par->sigini;
    } 
 
   return 0;
@@ -450,16 +613,16 @@ int
 Steel02::sendSelf(int commitTag, Channel &theChannel)
 {
   static Vector data(23);
-  data(0) = Fy;
-  data(1) = E0;
-  data(2) = b;
-  data(3) = R0;
-  data(4) = cR1;
-  data(5) = cR2;
-  data(6) = a1;
-  data(7) = a2;
-  data(8) = a3;
-  data(9) = a4;
+  data(0) = par->Fy;
+  data(1) = par->E0;
+  data(2) = par->b;
+  data(3) = par->R0;
+  data(4) = par->cR1;
+  data(5) = par->cR2;
+  data(6) = par->a1;
+  data(7) = par->a2;
+  data(8) = par->a3;
+  data(9) = par->a4;
   data(10) = epsminP;
   data(11) = epsmaxP;
   data(12) = epsplP;
@@ -472,7 +635,7 @@ Steel02::sendSelf(int commitTag, Channel &theChannel)
   data(19) = sigP;  
   data(20) = eP;    
   data(21) = this->getTag();
-  data(22) = sigini;
+  data(22) = par->sigini;
 
   if (theChannel.sendVector(this->getDbTag(), commitTag, data) < 0) {
     opserr << "Steel02::sendSelf() - failed to sendSelf\n";
@@ -492,16 +655,18 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
     return -1;
   }
 
-  Fy = data(0);
-  E0 = data(1);
-  b = data(2); 
-  R0 = data(3);
-  cR1 = data(4);
-  cR2 = data(5);
-  a1 = data(6); 
-  a2 = data(7); 
-  a3 = data(8); 
-  a4 = data(9); 
+  this->ownParameters();
+
+  par->Fy = data(0);
+  par->E0 = data(1);
+  par->b = data(2); 
+  par->R0 = data(3);
+  par->cR1 = data(4);
+  par->cR2 = data(5);
+  par->a1 = data(6); 
+  par->a2 = data(7); 
+  par->a3 = data(8); 
+  par->a4 = data(9); 
   epsminP = data(10);
   epsmaxP = data(11);
   epsplP = data(12); 
@@ -514,7 +679,7 @@ Steel02::recvSelf(int commitTag, Channel &theChannel,
   sigP = data(19);   
   eP   = data(20);   
   this->setTag(data(21));
-  sigini = data(22);
+  par->sigini = data(22);
 
   e = eP;
   sig = sigP;
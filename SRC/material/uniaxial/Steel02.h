@@ -68,6 +68,11 @@ class Steel02 : public UniaxialMaterial
     UniaxialMaterial *getCopy(void);
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(UniaxialMaterial **theMaterials, const double *strains,
+                      double *stresses, double *tangents, int n);
+    int commitBatch(UniaxialMaterial **theMaterials, int n);
+    int revertBatch(UniaxialMaterial **theMaterials,
+                    double *stresses, double *tangents, int n);
     double getStrain(void);      
     double getStress(void);
     double getTangent(void);
@@ -85,18 +90,34 @@ class Steel02 : public UniaxialMaterial
  protected:
     
  private:
+    // setTrialStrain() in two parts, so that setTrialBatch() can evaluate
+    // the powers of the Menegotto-Pinto curve of all the materials in
+    // one loop
+    bool setTrialBranch(double trialStrain, double &epsrat, double &R);
+    void setTrialCurve(double epsrat, double dum1, double dum2);
+
     // matpar : STEEL FIXED PROPERTIES
-    double Fy;  //  = matpar(1)  : yield stress
-    double E0;  //  = matpar(2)  : initial stiffness
-    double b;   //  = matpar(3)  : hardening ratio (Esh/E0)
-    double R0;  //  = matpar(4)  : exp transition elastic-plastic
-    double cR1; //  = matpar(5)  : coefficient for changing R0 to R
-    double cR2; //  = matpar(6)  : coefficient for changing R0 to R
-    double a1;  //  = matpar(7)  : coefficient for isotropic hardening in compression
-    double a2;  //  = matpar(8)  : coefficient for isotropic hardening in compression
-    double a3;  //  = matpar(9)  : coefficient for isotropic hardening in tension
-    double a4;  //  = matpar(10) : coefficient for isotropic hardening in tension
-    double sigini; // initial 
+    // the parameters do not change; they are shared by the copies of a
+    // material made by getCopy(), which need only their own state
+    struct Steel02Parameters {
+      double Fy;  //  = matpar(1)  : yield stress
+      double E0;  //  = matpar(2)  : initial stiffness
+      double b;   //  = matpar(3)  : hardening ratio (Esh/E0)
+      double R0;  //  = matpar(4)  : exp transition elastic-plastic
+      double cR1; //  = matpar(5)  : coefficient for changing R0 to R
+      double cR2; //  = matpar(6)  : coefficient for changing R0 to R
+      double a1;  //  = matpar(7)  : coefficient for isotropic hardening in compression
+      double a2;  //  = matpar(8)  : coefficient for isotropic hardening in compression
+      double a3;  //  = matpar(9)  : coefficient for isotropic hardening in tension
+      double a4;  //  = matpar(10) : coefficient for isotropic hardening in tension
+      double sigini; // initial 
+      int refs;
+    };
+    Steel02Parameters *par;
+
+    Steel02(int tag, Steel02Parameters *thePar);
+    void ownParameters(void);
+
     // hstvP : STEEL HISTORY VARIABLES
     double epsminP; //  = hstvP(1) : max eps in compression
     double epsmaxP; //  = hstvP(2) : max eps in tension
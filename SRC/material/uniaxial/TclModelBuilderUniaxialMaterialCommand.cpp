@@ -71,6 +71,7 @@
 
 #include <Vector.h>
 #include <string.h>
+#include <map>
 
 #include <UniaxialJ2Plasticity.h>   // Quan 
 
@@ -214,6 +215,105 @@ TclModelBuilder_FRPCnfinedConcrete(ClientData clientData, Tcl_Interp *interp, in
 				  
 
 
+namespace {
+
+  struct char_cmp { 
+    bool operator () (const char *a,const char *b) const 
+    {
+      return strcmp(a,b)<0;
+    } 
+  };
+
+  typedef std::map<const char *, void *(*)(void), char_cmp> OPS_ParsingFunctionMap;
+
+  // the materials built by a single OPS_ function, by name
+  static OPS_ParsingFunctionMap materialFunctions;
+
+  static void setUpMaterialFunctions(void)
+  {
+    materialFunctions.insert(std::make_pair("Elastic", &OPS_ElasticMaterial));
+    materialFunctions.insert(std::make_pair("Steel01", &OPS_Steel01));
+    materialFunctions.insert(std::make_pair("Steel02", &OPS_Steel02));
+    materialFunctions.insert(std::make_pair("Steel4", &OPS_Steel4));
+    materialFunctions.insert(std::make_pair("Concrete01", &OPS_Concrete01));
+    materialFunctions.insert(std::make_pair("Concrete02", &OPS_Concrete02));
+    materialFunctions.insert(std::make_pair("ElasticBilin", &OPS_ElasticBilin));
+    materialFunctions.insert(std::make_pair("ElasticBilinear", &OPS_ElasticBilin));
+    materialFunctions.insert(std::make_pair("ImpactMaterial", &OPS_ImpactMaterial));
+    materialFunctions.insert(std::make_pair("Impact", &OPS_ImpactMaterial));
+    materialFunctions.insert(std::make_pair("SteelBRB", &OPS_SteelBRB));
+    materialFunctions.insert(std::make_pair("MinMaxMaterial", &OPS_MinMaxMaterial));
+    materialFunctions.insert(std::make_pair("MinMax", &OPS_MinMaxMaterial));
+    materialFunctions.insert(std::make_pair("SimpleFractureMaterial", &OPS_SimpleFractureMaterial));
+    materialFunctions.insert(std::make_pair("SimpleFracture", &OPS_SimpleFractureMaterial));
+    materialFunctions.insert(std::make_pair("Maxwell", &OPS_Maxwell));
+    materialFunctions.insert(std::make_pair("MaxwellMaterial", &OPS_Maxwell));
+    materialFunctions.insert(std::make_pair("ViscousDamper", &OPS_ViscousDamper));
+    materialFunctions.insert(std::make_pair("BilinearOilDamper", &OPS_BilinearOilDamper));
+    materialFunctions.insert(std::make_pair("Bond_SP01", &OPS_Bond_SP01));
+    materialFunctions.insert(std::make_pair("Bond", &OPS_Bond_SP01));
+    materialFunctions.insert(std::make_pair("Cast", &OPS_Cast));
+    materialFunctions.insert(std::make_pair("CastFuse", &OPS_Cast));
+    materialFunctions.insert(std::make_pair("ElasticMultiLinear", &OPS_ElasticMultiLinear));
+    materialFunctions.insert(std::make_pair("RambergOsgood", &OPS_RambergOsgoodSteel));
+    materialFunctions.insert(std::make_pair("RambergOsgoodSteel", &OPS_RambergOsgoodSteel));
+    materialFunctions.insert(std::make_pair("ReinforcingSteel", &OPS_ReinforcingSteel));
+    materialFunctions.insert(std::make_pair("Steel2", &OPS_Steel2));
+    materialFunctions.insert(std::make_pair("OriginCentered", &OPS_OriginCentered));
+    materialFunctions.insert(std::make_pair("HookGap", &OPS_HookGap));
+    materialFunctions.insert(std::make_pair("HyperbolicGapMaterial", &OPS_HyperbolicGapMaterial));
+    materialFunctions.insert(std::make_pair("FRPConfinedConcrete02", &OPS_FRPConfinedConcrete02));
+    materialFunctions.insert(std::make_pair("PinchingLimitState", &OPS_PinchingLimitState));
+    materialFunctions.insert(std::make_pair("PinchingLimitStateMaterial", &OPS_PinchingLimitState));
+    materialFunctions.insert(std::make_pair("InitStrainMaterial", &OPS_InitStrainMaterial));
+    materialFunctions.insert(std::make_pair("InitStrain", &OPS_InitStrainMaterial));
+    materialFunctions.insert(std::make_pair("InitStressMaterial", &OPS_InitStressMaterial));
+    materialFunctions.insert(std::make_pair("InitStress", &OPS_InitStressMaterial));
+    materialFunctions.insert(std::make_pair("pyUCLA", &OPS_pyUCLA));
+    materialFunctions.insert(std::make_pair("PYUCLA", &OPS_pyUCLA));
+    materialFunctions.insert(std::make_pair("MultiLinear", &OPS_MultiLinear));
+    materialFunctions.insert(std::make_pair("ModIMKPinching", &OPS_ModIMKPinching));
+    materialFunctions.insert(std::make_pair("ModIMKPinching02", &OPS_ModIMKPinching02));
+    materialFunctions.insert(std::make_pair("BWBN", &OPS_BWBN));
+    materialFunctions.insert(std::make_pair("ModIMKPeakOriented", &OPS_ModIMKPeakOriented));
+    materialFunctions.insert(std::make_pair("ModIMKPeakOriented02", &OPS_ModIMKPeakOriented02));
+    materialFunctions.insert(std::make_pair("Bilin02", &OPS_Bilin02));
+    materialFunctions.insert(std::make_pair("Steel01Thermal", &OPS_Steel01Thermal));
+    materialFunctions.insert(std::make_pair("Steel02Thermal", &OPS_Steel02Thermal));
+    materialFunctions.insert(std::make_pair("ConcretewBeta", &OPS_ConcretewBeta));
+    materialFunctions.insert(std::make_pair("ConcreteD", &OPS_ConcreteD));
+    materialFunctions.insert(std::make_pair("ConcreteSakaiKawashima", &OPS_ConcreteSakaiKawashima));
+    materialFunctions.insert(std::make_pair("Concrete02Thermal", &OPS_Concrete02Thermal));
+    materialFunctions.insert(std::make_pair("SteelMPF", &OPS_SteelMPF));
+    materialFunctions.insert(std::make_pair("ConcreteCM", &OPS_ConcreteCM));
+    materialFunctions.insert(std::make_pair("ResilienceLow", &OPS_ResilienceLow));
+    materialFunctions.insert(std::make_pair("ResilienceMaterialHR", &OPS_ResilienceMaterialHR));
+    materialFunctions.insert(std::make_pair("CFSWSWP", &OPS_CFSWSWP));
+    materialFunctions.insert(std::make_pair("CFSSSWP", &OPS_CFSSSWP));
+    materialFunctions.insert(std::make_pair("FRPConfinedConcrete", &OPS_FRPConfinedConcrete));
+    materialFunctions.insert(std::make_pair("ElasticPP", &OPS_ElasticPPMaterial));
+    materialFunctions.insert(std::make_pair("Parallel", &OPS_ParallelMaterial));
+    materialFunctions.insert(std::make_pair("Series", &OPS_SeriesMaterial));
+    materialFunctions.insert(std::make_pair("Hysteretic", &OPS_HystereticMaterial));
+    materialFunctions.insert(std::make_pair("Viscous", &OPS_ViscousMaterial));
+    materialFunctions.insert(std::make_pair("SAWSMaterial", &OPS_SAWSMaterial));
+    materialFunctions.insert(std::make_pair("SAWS", &OPS_SAWSMaterial));
+    materialFunctions.insert(std::make_pair("BilinMaterial", &OPS_Bilin));
+    materialFunctions.insert(std::make_pair("Bilin", &OPS_Bilin));
+    materialFunctions.insert(std::make_pair("ConcreteZ01Material", &OPS_ConcreteZ01Material));
+    materialFunctions.insert(std::make_pair("ConcreteZ01", &OPS_ConcreteZ01Material));
+    materialFunctions.insert(std::make_pair("ConcreteL01Material", &OPS_ConcreteL01Material));
+    materialFunctions.insert(std::make_pair("ConcreteL01", &OPS_ConcreteL01Material));
+    materialFunctions.insert(std::make_pair("SteelZ01Material", &OPS_SteelZ01Material));
+    materialFunctions.insert(std::make_pair("SteelZ01", &OPS_SteelZ01Material));
+    materialFunctions.insert(std::make_pair("TendonL01Material", &OPS_TendonL01Material));
+    materialFunctions.insert(std::make_pair("TendonL01", &OPS_TendonL01Material));
+    materialFunctions.insert(std::make_pair("ConfinedConcrete01", &OPS_ConfinedConcrete01Material));
+    materialFunctions.insert(std::make_pair("ConfinedConcrete", &OPS_ConfinedConcrete01Material));
+    materialFunctions.insert(std::make_pair("Cable", &OPS_CableMaterial));
+  }
+}
+
 int
 TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv, Domain *theDomain)
 {
@@ -225,129 +325,24 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
 	return TCL_ERROR;
     }
 
+    static bool initDone = false;
+    if (initDone == false) {
+      setUpMaterialFunctions();
+      initDone = true;
+    }
+
     OPS_ResetInputNoBuilder(clientData, interp, 2, argc, argv, theDomain);	  
 
     // Pointer to a uniaxial material that will be added to the model builder
     UniaxialMaterial *theMaterial = 0;
 
     // Check argv[2] for uniaxial material type
-    if (strcmp(argv[1],"Elastic") == 0) {
-
-      void *theMat = OPS_ElasticMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Steel01") == 0) {
+    // the materials built by a single OPS_ function are looked up in the
+    // table, the others are matched in the chain below
+    OPS_ParsingFunctionMap::const_iterator iter = materialFunctions.find(argv[1]);
+    if (iter != materialFunctions.end()) {
 
-      void *theMat = OPS_Steel01();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Steel02") == 0) {
-      void *theMat = OPS_Steel02();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Steel4") == 0) {
-      void *theMat = OPS_Steel4();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Concrete01") == 0) {
-      void *theMat = OPS_Concrete01();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-      /*
-	    } else if (strcmp(argv[1],"HoehlerStanton") == 0) {
-      void *theMat = OPS_HoehlerStanton();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-      */
-    } else if (strcmp(argv[1],"Concrete02") == 0) {
-      void *theMat = OPS_Concrete02();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"ElasticBilin") == 0) || (strcmp(argv[1],"ElasticBilinear") == 0)) {
-      void *theMat = OPS_ElasticBilin();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"ImpactMaterial") == 0) || (strcmp(argv[1],"Impact") == 0)) {
-      void *theMat = OPS_ImpactMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"SteelBRB") == 0)) {
-      void *theMat = OPS_SteelBRB();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"MinMaxMaterial") == 0) || (strcmp(argv[1],"MinMax") == 0)) {
-      void *theMat = OPS_MinMaxMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"SimpleFractureMaterial") == 0) || (strcmp(argv[1],"SimpleFracture") == 0)) {
-
-      void *theMat = OPS_SimpleFractureMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"Maxwell") == 0) || (strcmp(argv[1],"MaxwellMaterial") == 0)) {
-      void *theMat = OPS_Maxwell();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"ViscousDamper") == 0)) {
-      void *theMat = OPS_ViscousDamper();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"BilinearOilDamper") == 0)) {
-      void *theMat = OPS_BilinearOilDamper();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"Bond_SP01") == 0) || (strcmp(argv[1],"Bond") == 0)) { 
-      void *theMat = OPS_Bond_SP01();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;      
-
-    } else if ((strcmp(argv[1],"Cast") == 0) || (strcmp(argv[1],"CastFuse") == 0)) {
-      void *theMat = OPS_Cast();
+      void *theMat = (*iter->second)();
       if (theMat != 0) 
 	theMaterial = (UniaxialMaterial *)theMat;
       else 
@@ -372,237 +367,6 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
       else 
 	return TCL_ERROR;
 #endif
-    } else if (strcmp(argv[1],"ElasticMultiLinear") == 0) {
-      void *theMat = OPS_ElasticMultiLinear();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-/*
-	} else if (strcmp(argv[1],"HoehlerStanton") == 0) {
-      void *theMat = OPS_HoehlerStanton();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-*/
-    } else if ((strcmp(argv[1],"RambergOsgood") == 0) || (strcmp(argv[1],"RambergOsgoodSteel") == 0)) {
-      void *theMat = OPS_RambergOsgoodSteel();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ReinforcingSteel") == 0) {
-      void *theMat = OPS_ReinforcingSteel();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Steel2") == 0) {
-      void *theMat = OPS_Steel2();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"OriginCentered") == 0) {
-      void *theMat = OPS_OriginCentered();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"HookGap") == 0) {
-      void *theMat = OPS_HookGap();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"HyperbolicGapMaterial") == 0) {
-      void *theMat = OPS_HyperbolicGapMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"FRPConfinedConcrete02") == 0) {
-      void *theMat = OPS_FRPConfinedConcrete02();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"PinchingLimitState") == 0) || (strcmp(argv[1],"PinchingLimitStateMaterial") == 0)) {
-      void *theMat = OPS_PinchingLimitState();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"InitStrainMaterial") == 0) || (strcmp(argv[1],"InitStrain") == 0)) {
-      void *theMat = OPS_InitStrainMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"InitStressMaterial") == 0) || (strcmp(argv[1],"InitStress") == 0)) {
-      void *theMat = OPS_InitStressMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"pyUCLA") == 0) || (strcmp(argv[1],"PYUCLA") == 0)) {
-      void *theMat = OPS_pyUCLA();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if ((strcmp(argv[1],"MultiLinear") == 0)) {
-      void *theMat = OPS_MultiLinear();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ModIMKPinching") == 0) {
-      void *theMat = OPS_ModIMKPinching();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ModIMKPinching02") == 0) {
-      void *theMat = OPS_ModIMKPinching02();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"BWBN") == 0) {
-      void *theMat = OPS_BWBN();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ModIMKPeakOriented") == 0) {
-      void *theMat = OPS_ModIMKPeakOriented();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ModIMKPeakOriented02") == 0) {
-      void *theMat = OPS_ModIMKPeakOriented02();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Bilin02") == 0) {
-      void *theMat = OPS_Bilin02();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Steel01Thermal") == 0) {
-      void *theMat = OPS_Steel01Thermal();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Steel02Thermal") == 0) {
-      void *theMat = OPS_Steel02Thermal();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ConcretewBeta") == 0) {
-      void *theMat = OPS_ConcretewBeta();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ConcreteD") == 0) {
-      void *theMat = OPS_ConcreteD();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ConcreteSakaiKawashima") == 0) {
-      void *theMat = OPS_ConcreteSakaiKawashima();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"Concrete02Thermal") == 0) {
-      void *theMat = OPS_Concrete02Thermal();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"SteelMPF") == 0) { // K Kolozvari            
-      void *theMat = OPS_SteelMPF();
-      if (theMat != 0)
-        theMaterial = (UniaxialMaterial *)theMat;
-      else
-        return TCL_ERROR;
-      
-    } else if (strcmp(argv[1],"ConcreteCM") == 0) { // K Kolozvari          
-      void *theMat = OPS_ConcreteCM();
-      if (theMat != 0)
-        theMaterial = (UniaxialMaterial *)theMat;
-      else
-        return TCL_ERROR;
-      
-    } else if (strcmp(argv[1],"ResilienceLow") == 0) {
-      void *theMat = OPS_ResilienceLow();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"ResilienceMaterialHR") == 0) {
-      void *theMat = OPS_ResilienceMaterialHR();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"CFSWSWP") == 0) {
-      void *theMat = OPS_CFSWSWP();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"CFSSSWP") == 0) {
-      void *theMat = OPS_CFSSSWP();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    } else if (strcmp(argv[1],"FRPConfinedConcrete") == 0) {
-      void *theMat = OPS_FRPConfinedConcrete();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
     } else if (strcmp(argv[1],"Elastic2") == 0) {
 	if (argc < 4 || argc > 5) {
 	    opserr << "WARNING invalid number of arguments\n";
@@ -664,14 +428,6 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
       
     }
     
-    else if (strcmp(argv[1],"ElasticPP") == 0) {
-      void *theMat = OPS_ElasticPPMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-    
     else if (strcmp(argv[1],"ElasticPPGap") == 0) {
       if (argc < 6) {
         opserr << "WARNING insufficient arguments\n";
@@ -866,26 +622,6 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
 					Ao, deltaA, deltaNu, deltaEta,tolerance,maxNumIter);       
     }
 
-    else if (strcmp(argv[1],"Parallel") == 0) {
-
-      void *theMat = OPS_ParallelMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    }
-
-    else if (strcmp(argv[1],"Series") == 0) {
-
-      void *theMat = OPS_SeriesMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    }
-
 
     else if (strcmp(argv[1],"Steel03") == 0) {
       // Check that there is the minimum number of arguments
@@ -991,17 +727,6 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
       
     }
     
-    
-    else if (strcmp(argv[1],"Hysteretic") == 0) {
-
-      void *theMat = OPS_HystereticMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    }
-    
     else if (strcmp(argv[1],"Concrete04") == 0) {
       //        opserr << argc << endln;
       if (argc != 10 && argc != 9 && argc != 7) {
@@ -1234,16 +959,6 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
       
       theMaterial = new Concrete07(tag, fpc, epsc0, Ec, fpt, epst0, xcrp, xcrn, r);
     }
-
-    
-    else if (strcmp(argv[1],"Viscous") == 0) {
-
-      void *theMat = OPS_ViscousMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
     
     else if (strcmp(argv[1],"PathIndependent") == 0) {
 		if (argc < 4)
@@ -1399,80 +1114,6 @@ TclModelBuilderUniaxialMaterialCommand (ClientData clientData, Tcl_Interp *inter
       theMaterial = new FatigueMaterial(tag, *theMat, Dmax, E0, 
 					m, epsmin, epsmax);
       
-    }
-
-    else if ((strcmp(argv[1],"SAWSMaterial") == 0) || (strcmp(argv[1],"SAWS") == 0)) {
-
-      void *theMat = OPS_SAWSMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
-    }
-
-    else if ((strcmp(argv[1],"BilinMaterial") == 0) || (strcmp(argv[1],"Bilin") == 0)) {
-
-      void *theMat = OPS_Bilin();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-
-    else if ((strcmp(argv[1],"ConcreteZ01Material") == 0) || (strcmp(argv[1],"ConcreteZ01") == 0)) {
-
-      void *theMat = OPS_ConcreteZ01Material();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-
-    else if ((strcmp(argv[1],"ConcreteL01Material") == 0) || (strcmp(argv[1],"ConcreteL01") == 0)) {
-
-      void *theMat = OPS_ConcreteL01Material();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-
-    else if ((strcmp(argv[1],"SteelZ01Material") == 0) || (strcmp(argv[1],"SteelZ01") == 0)) {
-
-      void *theMat = OPS_SteelZ01Material();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-
-    else if ((strcmp(argv[1],"TendonL01Material") == 0) || (strcmp(argv[1],"TendonL01") == 0)) {
-      void *theMat = OPS_TendonL01Material();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-
-
-    else if ((strcmp(argv[1],"ConfinedConcrete01") == 0) || (strcmp(argv[1],"ConfinedConcrete") == 0)) {
-
-      void *theMat = OPS_ConfinedConcrete01Material();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-    }
-
-    else if (strcmp(argv[1],"Cable") == 0) {
-
-      void *theMat = OPS_CableMaterial();
-      if (theMat != 0) 
-	theMaterial = (UniaxialMaterial *)theMat;
-      else 
-	return TCL_ERROR;
-
     }
 
 	else if (strcmp(argv[1],"Pinching4") == 0) {
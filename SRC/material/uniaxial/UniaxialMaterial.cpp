@@ -43,15 +43,23 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theUniaxialMaterialObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theUniaxialMaterialObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theUniaxialMaterialObjects(void)
+{
+  if (theUniaxialMaterialObjectsPtr == 0)
+    theUniaxialMaterialObjectsPtr = new MapOfTaggedObjects();
+  return *theUniaxialMaterialObjectsPtr;
+}
 
 bool OPS_addUniaxialMaterial(UniaxialMaterial *newComponent) {
-  return theUniaxialMaterialObjects.addComponent(newComponent);
+  return theUniaxialMaterialObjects().addComponent(newComponent);
 }
 
 UniaxialMaterial *OPS_getUniaxialMaterial(int tag) {
 
-  TaggedObject *theResult = theUniaxialMaterialObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theUniaxialMaterialObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "UniaxialMaterial *getUniaxialMaterial(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -62,7 +70,7 @@ UniaxialMaterial *OPS_getUniaxialMaterial(int tag) {
 }
 
 void OPS_clearAllUniaxialMaterial(void) {
-  theUniaxialMaterialObjects.clearAll();
+  theUniaxialMaterialObjects().clearAll();
 }
 
 
@@ -127,6 +135,48 @@ UniaxialMaterial::setTrial(double strain, double temperature, double &stress, do
 }
 
 
+int
+UniaxialMaterial::setTrialBatch(UniaxialMaterial **theMaterials, const double *strains, 
+				double *stresses, double *tangents, int n)
+{
+  // default is to invoke setTrial() on each; subclasses override this to 
+  // avoid the virtual calls when theMaterials are all of their type
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += theMaterials[i]->setTrial(strains[i], stresses[i], tangents[i]);
+
+  return res;
+}
+
+
+int
+UniaxialMaterial::commitBatch(UniaxialMaterial **theMaterials, int n)
+{
+  // default is to invoke commitState() on each, as for setTrialBatch()
+  int res = 0;
+  for (int i = 0; i < n; i++)
+    res += theMaterials[i]->commitState();
+
+  return res;
+}
+
+
+int
+UniaxialMaterial::revertBatch(UniaxialMaterial **theMaterials, 
+			      double *stresses, double *tangents, int n)
+{
+  int res = 0;
+  for (int i = 0; i < n; i++) {
+    UniaxialMaterial *theMat = theMaterials[i];
+    res += theMat->revertToLastCommit();
+    stresses[i] = theMat->getStress();
+    tangents[i] = theMat->getTangent();
+  }
+
+  return res;
+}
+
+
 // default operation for strain rate is zero
 double
 UniaxialMaterial::getStrainRate(void)
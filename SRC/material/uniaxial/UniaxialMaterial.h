@@ -60,6 +60,10 @@ class UniaxialMaterial : public Material
     virtual int setTrial (double strain, double &stress, double &tangent, double strainRate = 0.0);
     virtual int setTrial (double strain, double temperature, double &stress, double &tangent, double &thermalElongation, double strainRate = 0.0);
 
+    // sets the trial strain of n materials of the same type as this one
+    virtual int setTrialBatch (UniaxialMaterial **theMaterials, const double *strains, 
+			       double *stresses, double *tangents, int n);
+
     virtual double getStrain (void) = 0;
     virtual double getStrainRate (void);
     virtual double getStress (void) = 0;
@@ -71,6 +75,12 @@ class UniaxialMaterial : public Material
     virtual int commitState (void) = 0;
     virtual int revertToLastCommit (void) = 0;    
     virtual int revertToStart (void) = 0;        
+
+    // commit or revert n materials of the same type as this one; the
+    // reverted stresses and tangents are returned
+    virtual int commitBatch (UniaxialMaterial **theMaterials, int n);
+    virtual int revertBatch (UniaxialMaterial **theMaterials,
+			     double *stresses, double *tangents, int n);
     
     virtual UniaxialMaterial *getCopy (void) = 0;
     virtual UniaxialMaterial *getCopy(SectionForceDeformation *s);
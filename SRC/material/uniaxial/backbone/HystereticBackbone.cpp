@@ -33,15 +33,23 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theHystereticBackboneObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theHystereticBackboneObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theHystereticBackboneObjects(void)
+{
+  if (theHystereticBackboneObjectsPtr == 0)
+    theHystereticBackboneObjectsPtr = new MapOfTaggedObjects();
+  return *theHystereticBackboneObjectsPtr;
+}
 
 bool OPS_addHystereticBackbone(HystereticBackbone *newComponent) {
-  return theHystereticBackboneObjects.addComponent(newComponent);
+  return theHystereticBackboneObjects().addComponent(newComponent);
 }
 
 HystereticBackbone *OPS_getHystereticBackbone(int tag) {
 
-  TaggedObject *theResult = theHystereticBackboneObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theHystereticBackboneObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "HystereticBackbone *getHystereticBackbone(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -52,7 +60,7 @@ HystereticBackbone *OPS_getHystereticBackbone(int tag) {
 }
 
 void OPS_clearAllHystereticBackbone(void) {
-  theHystereticBackboneObjects.clearAll();
+  theHystereticBackboneObjects().clearAll();
 }
 
 
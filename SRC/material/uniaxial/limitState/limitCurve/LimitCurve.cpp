@@ -40,16 +40,24 @@
 #include <TaggedObject.h>
 #include <MapOfTaggedObjects.h>
 
-static MapOfTaggedObjects theLimitCurveObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theLimitCurveObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theLimitCurveObjects(void)
+{
+  if (theLimitCurveObjectsPtr == 0)
+    theLimitCurveObjectsPtr = new MapOfTaggedObjects();
+  return *theLimitCurveObjectsPtr;
+}
 
 
 bool OPS_addLimitCurve(LimitCurve *newComponent) {
-  return theLimitCurveObjects.addComponent(newComponent);
+  return theLimitCurveObjects().addComponent(newComponent);
 }
 
 LimitCurve *OPS_getLimitCurve(int tag) {
 
-  TaggedObject *theResult = theLimitCurveObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theLimitCurveObjects().getComponentPtr(tag);
   if (theResult == 0) {
     opserr << "LimitCurve *getLimitCurve(int tag) - none found with tag: " << tag << endln;
     return 0;
@@ -60,7 +68,7 @@ LimitCurve *OPS_getLimitCurve(int tag) {
 }
 
 void OPS_clearAllLimitCurve(void) {
-  theLimitCurveObjects.clearAll();
+  theLimitCurveObjects().clearAll();
 }
 
 
@@ -14,17 +14,25 @@ const int YieldSurface_BC::NoFP(4);
 const int YieldSurface_BC::SurfOnly(5);
 const int YieldSurface_BC::StateLoading(6);
 
-static MapOfTaggedObjects theYieldSurface_BCObjects;
+static OPS_THREAD_LOCAL MapOfTaggedObjects *theYieldSurface_BCObjectsPtr = 0;
+
+static MapOfTaggedObjects &
+theYieldSurface_BCObjects(void)
+{
+  if (theYieldSurface_BCObjectsPtr == 0)
+    theYieldSurface_BCObjectsPtr = new MapOfTaggedObjects();
+  return *theYieldSurface_BCObjectsPtr;
+}
 
 bool OPS_addYieldSurface_BC(YieldSurface_BC *newComponent)
 {
-    return theYieldSurface_BCObjects.addComponent(newComponent);
+    return theYieldSurface_BCObjects().addComponent(newComponent);
 }
 
 YieldSurface_BC *OPS_getYieldSurface_BC(int tag)
 {
 
-  TaggedObject *theResult = theYieldSurface_BCObjects.getComponentPtr(tag);
+  TaggedObject *theResult = theYieldSurface_BCObjects().getComponentPtr(tag);
   if(theResult == 0) {
       opserr << "NDMaterial no found with tag: " << tag << "\n";
       return 0;
@@ -35,7 +43,7 @@ YieldSurface_BC *OPS_getYieldSurface_BC(int tag)
 }
 
 void OPS_clearAllYieldSurface_BC(void) {
-    theYieldSurface_BCObjects.clearAll();
+    theYieldSurface_BCObjects().clearAll();
 }
 
 //////////////////////////////////////////////////////////////////////
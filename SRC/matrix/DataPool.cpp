@@ -0,0 +1,214 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/DataPool.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of DataPool.
+
+#include <DataPool.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <mutex>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// each array is preceded by a header of one alignment unit holding its
+// size class, -1 for an array allocated directly
+#define DATAPOOL_NUM_CLASSES  (DATAPOOL_MAX_SMALL/8)
+#define DATAPOOL_HEADER       (DATAPOOL_ALIGNMENT/sizeof(double))
+
+// the most arrays of a size class kept by a thread
+#define DATAPOOL_MAX_FREE     1024
+
+struct DataPoolThread {
+  double *freeList[DATAPOOL_NUM_CLASSES];   // linked through the first double
+  int numFree[DATAPOOL_NUM_CLASSES];
+  double numAllocations;
+  double numHits;
+  DataPoolThread *next;
+};
+
+// the state of each thread, also kept in a list for the counts of all
+// threads; it is allocated with malloc() as Vector objects are created
+// during static initialization
+static OPS_THREAD_LOCAL DataPoolThread *thePoolThread = 0;
+static DataPoolThread *thePoolThreads = 0;
+static std::mutex thePoolThreadsMutex;
+
+static DataPoolThread *
+getPoolThread(void)
+{
+  DataPoolThread *thePool = thePoolThread;
+  if (thePool != 0)
+    return thePool;
+
+  thePool = (DataPoolThread *)calloc(1, sizeof(DataPoolThread));
+  if (thePool == 0)
+    return 0;
+
+  std::lock_guard<std::mutex> lock(thePoolThreadsMutex);
+  thePool->next = thePoolThreads;
+  thePoolThreads = thePool;
+  thePoolThread = thePool;
+
+  return thePool;
+}
+
+static double *
+allocateAligned(int size, int sizeClass)
+{
+  size_t numBytes = (size + DATAPOOL_HEADER)*sizeof(double);
+  void *block = 0;
+#ifdef _WIN32
+  block = _aligned_malloc(numBytes, DATAPOOL_ALIGNMENT);
+#else
+  if (posix_memalign(&block, DATAPOOL_ALIGNMENT, numBytes) != 0)
+    block = 0;
+#endif
+  if (block == 0)
+    return 0;
+
+  *(int *)block = sizeClass;
+  return (double *)block + DATAPOOL_HEADER;
+}
+
+static void
+freeAligned(double *data)
+{
+  void *block = data - DATAPOOL_HEADER;
+#ifdef _WIN32
+  _aligned_free(block);
+#else
+  free(block);
+#endif
+}
+
+double *
+DataPool::allocate(int size)
+{
+  if (size < 1)
+    size = 1;
+
+  DataPoolThread *thePool = getPoolThread();
+  if (thePool != 0)
+    thePool->numAllocations++;
+
+  if (size > DATAPOOL_MAX_SMALL || thePool == 0)
+    return allocateAligned(size, -1);
+
+  int sizeClass = (size-1)/8;
+  double *data = thePool->freeList[sizeClass];
+  if (data != 0) {
+    thePool->freeList[sizeClass] = *(double **)data;
+    thePool->numFree[sizeClass]--;
+    thePool->numHits++;
+    return data;
+  }
+
+  return allocateAligned(8*(sizeClass+1), sizeClass);
+}
+
+void
+DataPool::release(double *data)
+{
+  if (data == 0)
+    return;
+
+  int sizeClass = *(int *)(data - DATAPOOL_HEADER);
+  if (sizeClass < 0) {
+    freeAligned(data);
+    return;
+  }
+
+  // an array allocated by another thread joins the list of this one
+  DataPoolThread *thePool = getPoolThread();
+  if (thePool == 0 || thePool->numFree[sizeClass] >= DATAPOOL_MAX_FREE) {
+    freeAligned(data);
+    return;
+  }
+
+  *(double **)data = thePool->freeList[sizeClass];
+  thePool->freeList[sizeClass] = data;
+  thePool->numFree[sizeClass]++;
+}
+
+void
+DataPool::clear(void)
+{
+  DataPoolThread *thePool = thePoolThread;
+  if (thePool == 0)
+    return;
+
+  for (int i=0; i<DATAPOOL_NUM_CLASSES; i++) {
+    double *data = thePool->freeList[i];
+    while (data != 0) {
+      double *next = *(double **)data;
+      freeAligned(data);
+      data = next;
+    }
+    thePool->freeList[i] = 0;
+    thePool->numFree[i] = 0;
+  }
+}
+
+// the counts of the other threads are read while they may be changing,
+// which is good enough for a report
+
+void
+DataPool::getCounts(double &numAllocations, double &numHits)
+{
+  numAllocations = 0.0;
+  numHits = 0.0;
+
+  std::lock_guard<std::mutex> lock(thePoolThreadsMutex);
+  for (DataPoolThread *thePool = thePoolThreads; thePool != 0; thePool = thePool->next) {
+    numAllocations += thePool->numAllocations;
+    numHits += thePool->numHits;
+  }
+}
+
+void
+DataPool::resetCounts(void)
+{
+  std::lock_guard<std::mutex> lock(thePoolThreadsMutex);
+  for (DataPoolThread *thePool = thePoolThreads; thePool != 0; thePool = thePool->next) {
+    thePool->numAllocations = 0.0;
+    thePool->numHits = 0.0;
+  }
+}
+
+void
+DataPool::report(OPS_Stream &s)
+{
+  double numAllocations, numHits;
+  DataPool::getCounts(numAllocations, numHits);
+
+  char buffer[256];
+  sprintf(buffer, "  %-28s %14.0f allocations, %14.0f from the free lists, hit rate %6.2f%%\n",
+	  "vector/matrix data pool", numAllocations, numHits,
+	  (numAllocations > 0.0) ? 100.0*numHits/numAllocations : 0.0);
+  s << buffer;
+}
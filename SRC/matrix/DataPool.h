@@ -0,0 +1,64 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/DataPool.h,v $
+
+#ifndef DataPool_h
+#define DataPool_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for DataPool.
+// DataPool provides the storage of the data of Vector and Matrix objects.
+// All arrays start on a 64 byte boundary, a cache line, so that compilers
+// and intrinsics may use aligned SIMD loads on them. Arrays of up to
+// DATAPOOL_MAX_SMALL doubles, those of the element code, are rounded up
+// to a multiple of 8 doubles; when released they are kept in a free list
+// of the calling thread for that size and handed out again by the next
+// allocate() of the thread for the size, without a call to malloc() or a
+// lock. Larger arrays are allocated and freed directly. The pool counts
+// the allocations and those taken from the free lists, for its hit rate.
+//
+// What: "@(#) DataPool.h, revA"
+
+#include <OPS_Globals.h>
+
+#define DATAPOOL_MAX_SMALL  64
+#define DATAPOOL_ALIGNMENT  64
+
+class DataPool
+{
+  public:
+    // returns an aligned array of at least size doubles, 0 if out of memory
+    static double *allocate(int size);
+    static void release(double *data);
+
+    // frees the arrays kept by the calling thread
+    static void clear(void);
+
+    // the counts of all threads since the last reset
+    static void getCounts(double &numAllocations, double &numHits);
+    static void resetCounts(void);
+    static void report(OPS_Stream &s);
+};
+
+#endif
@@ -78,10 +78,13 @@ class ID
     friend OPS_Stream &operator<<(OPS_Stream &s, const ID &V);
     //    friend istream &operator>>(istream &s, ID &V);    
 
+    friend class Archive;
     friend class UDP_Socket;
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class SharedMemoryChannel;
+    friend class MultiplexedChannel;
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
@@ -34,9 +34,13 @@
 #include "Matrix.h"
 #include "Vector.h"
 #include "ID.h"
+#include <DataPool.h>
 
 #include <stdlib.h>
 #include <iostream>
+#ifdef OPS_RVALUE_REFS
+#include <utility>
+#endif
 using std::nothrow;
 
 #define MATRIX_WORK_AREA 400
@@ -50,11 +54,14 @@ using std::nothrow;
 
 #include <math.h>
 
-int Matrix::sizeDoubleWork = MATRIX_WORK_AREA;
-int Matrix::sizeIntWork = INT_WORK_AREA;
+// the work areas are private to each thread, so that Solve(), Invert()
+// and the triple products can be used concurrently; they are created the
+// first time a thread needs them and enlarged by setWorkSize()
+OPS_THREAD_LOCAL int Matrix::sizeDoubleWork = 0;
+OPS_THREAD_LOCAL int Matrix::sizeIntWork = 0;
 double Matrix::MATRIX_NOT_VALID_ENTRY =0.0;
-double *Matrix::matrixWork = 0;
-int    *Matrix::intWork =0;
+OPS_THREAD_LOCAL double *Matrix::matrixWork = 0;
+OPS_THREAD_LOCAL int    *Matrix::intWork =0;
 
 //double *Matrix::matrixWork = (double *)malloc(400*sizeof(double));
 
@@ -65,15 +72,6 @@ int    *Matrix::intWork =0;
 Matrix::Matrix()
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 }
 
 
@@ -81,15 +79,6 @@ Matrix::Matrix(int nRows,int nCols)
 :numRows(nRows), numCols(nCols), dataSize(0), data(0), fromFree(0)
 {
 
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
 #ifdef _G3DEBUG
     if (nRows < 0) {
@@ -107,7 +96,7 @@ Matrix::Matrix(int nRows,int nCols)
     data = 0;
 
     if (dataSize > 0) {
-      data = new (nothrow) double[dataSize];
+      data = DataPool::allocate(dataSize);
       //data = (double *)malloc(dataSize*sizeof(double));
       if (data == 0) {
 	opserr << "WARNING:Matrix::Matrix(int,int): Ran out of memory on init ";
@@ -125,15 +114,6 @@ Matrix::Matrix(int nRows,int nCols)
 Matrix::Matrix(double *theData, int row, int col) 
 :numRows(row),numCols(col),dataSize(row*col),data(theData),fromFree(1)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
 #ifdef _G3DEBUG
     if (row < 0) {
@@ -154,22 +134,13 @@ Matrix::Matrix(double *theData, int row, int col)
 Matrix::Matrix(const Matrix &other)
 :numRows(0), numCols(0), dataSize(0), data(0), fromFree(0)
 {
-  // allocate work areas if the first matrix
-  if (matrixWork == 0) {
-    matrixWork = new (nothrow) double[sizeDoubleWork];
-    intWork = new (nothrow) int[sizeIntWork];
-    if (matrixWork == 0 || intWork == 0) {
-      opserr << "WARNING: Matrix::Matrix() - out of memory creating work area's\n";
-      exit(-1);
-    }
-  }
 
     numRows = other.numRows;
     numCols = other.numCols;
     dataSize = other.dataSize;
 
     if (dataSize != 0) {
-      data = new (nothrow) double[dataSize];
+      data = DataPool::allocate(dataSize);
       // data = (double *)malloc(dataSize*sizeof(double));
       if (data == 0) {
 	opserr << "WARNING:Matrix::Matrix(Matrix &): ";
@@ -185,6 +156,35 @@ Matrix::Matrix(const Matrix &other)
     }
 }
 
+#ifdef OPS_RVALUE_REFS
+// takes the data of a temporary, unless the temporary only refers to data
+// it does not own, which is copied as by the copy constructor
+Matrix::Matrix(Matrix &&other)
+:numRows(other.numRows), numCols(other.numCols), dataSize(other.dataSize),
+ data(other.data), fromFree(0)
+{
+  if (other.fromFree != 0) {
+    data = 0;
+    if (dataSize != 0) {
+      data = DataPool::allocate(dataSize);
+      if (data == 0) {
+	opserr << "WARNING:Matrix::Matrix(Matrix &&): ";
+	opserr << "Ran out of memory on init of size " << dataSize << endln; 
+	numRows = 0; numCols =0; dataSize = 0;
+      }
+    }
+    for (int i=0; i<dataSize; i++)
+      data[i] = other.data[i];
+    return;
+  }
+
+  other.numRows = 0;
+  other.numCols = 0;
+  other.dataSize = 0;
+  other.data = 0;
+}
+#endif
+
 
 //
 // DESTRUCTOR
@@ -194,7 +194,7 @@ Matrix::~Matrix()
 {
   if (data != 0) 
     if (fromFree == 0)
-      delete [] data; 
+      DataPool::release(data); 
   //  if (data != 0) free((void *) data);
 }
     
@@ -209,7 +209,7 @@ Matrix::setData(double *theData, int row, int col)
   // delete the old if allocated
   if (data != 0) 
     if (fromFree == 0)
-      delete [] data; 
+      DataPool::release(data); 
 
   numRows = row;
   numCols = col;
@@ -259,12 +259,12 @@ Matrix::resize(int rows, int cols) {
     // free the old space
     if (data != 0) 
       if (fromFree == 0)
-	delete [] data; 
+	DataPool::release(data); 
     //  if (data != 0) free((void *) data);
 
     fromFree = 0;
     // create new space
-    data = new (nothrow) double[newSize];
+    data = DataPool::allocate(newSize);
     // data = (double *)malloc(dataSize*sizeof(double));
     if (data == 0) {
       opserr << "Matrix::resize(" << rows << "," << cols << ") - out of memory\n";
@@ -349,6 +349,40 @@ extern "C" int dgerfs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
 
 #endif
 
+int
+Matrix::setWorkSize(int numDouble, int numInt)
+{
+  if (numDouble < MATRIX_WORK_AREA)
+    numDouble = MATRIX_WORK_AREA;
+  if (numInt < INT_WORK_AREA)
+    numInt = INT_WORK_AREA;
+
+  if (numDouble > sizeDoubleWork) {
+    if (matrixWork != 0)
+      delete [] matrixWork;
+    matrixWork = new (nothrow) double[numDouble];
+    sizeDoubleWork = numDouble;
+    if (matrixWork == 0) {
+      sizeDoubleWork = 0;
+      return -1;
+    }
+  }
+
+  if (numInt > sizeIntWork) {
+    if (intWork != 0)
+      delete [] intWork;
+    intWork = new (nothrow) int[numInt];
+    sizeIntWork = numInt;
+    if (intWork == 0) {
+      sizeIntWork = 0;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
 int
 Matrix::Solve(const Vector &b, Vector &x) const
 {
@@ -374,35 +408,9 @@ Matrix::Solve(const Vector &b, Vector &x) const
 #endif
     
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    if (setWorkSize(dataSize, n) < 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
 
     
@@ -469,35 +477,9 @@ Matrix::Solve(const Matrix &b, Matrix &x) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    if (setWorkSize(dataSize, n) < 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
     
     x = b;
@@ -568,35 +550,9 @@ Matrix::Invert(Matrix &theInverse) const
 #endif
 
     // check work area can hold all the data
-    if (dataSize > sizeDoubleWork) {
-
-      if (matrixWork != 0) {
-	delete [] matrixWork;
-      }
-      matrixWork = new (nothrow) double[dataSize];
-      sizeDoubleWork = dataSize;
-      
-      if (matrixWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeDoubleWork = 0;      
-	return -3;
-      }
-    }
-
-    // check work area can hold all the data
-    if (n > sizeIntWork) {
-
-      if (intWork != 0) {
-	delete [] intWork;
-      }
-      intWork = new (nothrow) int[n];
-      sizeIntWork = n;
-      
-      if (intWork == 0) {
-	opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
-	sizeIntWork = 0;      
-	return -3;
-      }
+    if (setWorkSize(dataSize, n) < 0) {
+      opserr << "WARNING: Matrix::Solve() - out of memory creating work area's\n";
+      return -3;
     }
     
     // copy the data
@@ -930,6 +886,88 @@ Matrix::addMatrixTransposeProduct(double thisFact,
 }
 
 
+// fixed size kernels of this = thisFact * this + otherFact * A' * B * C for
+// the sizes most common in elements and sections, B square of dimension N
+// and this R x M. The loops, and so the order of the sums, are those of
+// the general code in addMatrixTripleProduct(), so the results are the
+// same to the bit; with the sizes known the compiler unrolls and
+// vectorizes them.
+template <int N, int R, int M>
+static void
+tripleProductKernel(double *data, const double *A, const double *B,
+		    const double *C, double *work, double thisFact, double otherFact)
+{
+  for (int l=0; l<N*M; l++)
+    work[l] = 0.0;
+
+  const double *ckjPtr = C;
+  for (int j=0; j<M; j++) {
+    double *aijPtr = &work[j*N];
+    for (int k=0; k<N; k++) {
+      double tmp = *ckjPtr++ * otherFact;
+      const double *bikPtr = &B[k*N];
+      for (int i=0; i<N; i++)
+	aijPtr[i] += bikPtr[i] * tmp;
+    }
+  }
+
+  double *dataPtr = data;
+  for (int j=0; j<M; j++) {
+    const double *workkjPtr = &work[j*N];
+    for (int i=0; i<R; i++) {
+      const double *akiPtr = &A[i*N];
+      double aij = 0.0;
+      for (int k=0; k<N; k++)
+	aij += akiPtr[k] * workkjPtr[k];
+      if (thisFact == 1.0)
+	*dataPtr++ += aij;
+      else if (thisFact == 0.0)
+	*dataPtr++ = aij;
+      else {
+	double value = *dataPtr * thisFact + aij;
+	*dataPtr++ = value;
+      }
+    }
+  }
+}
+
+#define TRIPLE_PRODUCT_CASE(n, m) \
+  case n*100 + m: \
+    tripleProductKernel<n, m, m>(data, A, B, C, work, thisFact, otherFact); \
+    return true;
+
+// this is R x M with R == M, as is the case for all the element and
+// section products; returns false if there is no kernel for the size
+static bool
+tripleProductFixed(int dimB, int numRows, int numCols, double *data, const double *A,
+		   const double *B, const double *C, double *work,
+		   double thisFact, double otherFact)
+{
+  if (numRows != numCols || dimB >= 100 || numCols >= 100)
+    return false;
+
+  switch (dimB*100 + numCols) {
+    TRIPLE_PRODUCT_CASE(1, 2)
+    TRIPLE_PRODUCT_CASE(1, 4)
+    TRIPLE_PRODUCT_CASE(2, 3)
+    TRIPLE_PRODUCT_CASE(2, 6)
+    TRIPLE_PRODUCT_CASE(3, 3)
+    TRIPLE_PRODUCT_CASE(3, 6)
+    TRIPLE_PRODUCT_CASE(3, 8)
+    TRIPLE_PRODUCT_CASE(4, 6)
+    TRIPLE_PRODUCT_CASE(5, 6)
+    TRIPLE_PRODUCT_CASE(6, 6)
+    TRIPLE_PRODUCT_CASE(6, 12)
+    TRIPLE_PRODUCT_CASE(6, 24)
+    TRIPLE_PRODUCT_CASE(8, 24)
+    TRIPLE_PRODUCT_CASE(12, 12)
+    TRIPLE_PRODUCT_CASE(24, 24)
+  default:
+    return false;
+  }
+}
+
+
 // to perform this += T' * B * T
 int
 Matrix::addMatrixTripleProduct(double thisFact, 
@@ -951,11 +989,15 @@ Matrix::addMatrixTripleProduct(double thisFact,
     int dimB = B.numCols;
     int sizeWork = dimB * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (setWorkSize(sizeWork, 0) < 0) {
       this->addMatrix(thisFact, T^B*T, otherFact);
       return 0;
     }
 
+    if (tripleProductFixed(dimB, numRows, numCols, data, T.data, B.data, T.data,
+			   matrixWork, thisFact, otherFact) == true)
+      return 0;
+
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
     for (int l=0; l<sizeWork; l++)
@@ -1049,11 +1091,15 @@ Matrix::addMatrixTripleProduct(double thisFact,
     // cheack work area can hold the temporary matrix
     int sizeWork = B.numRows * numCols;
 
-    if (sizeWork > sizeDoubleWork) {
+    if (setWorkSize(sizeWork, 0) < 0) {
       this->addMatrix(thisFact, A^B*C, otherFact);
       return 0;
     }
 
+    if (tripleProductFixed(B.numRows, numRows, numCols, data, A.data, B.data, C.data,
+			   matrixWork, thisFact, otherFact) == true)
+      return 0;
+
     // zero out the work area
     double *matrixWorkPtr = matrixWork;
     for (int l=0; l<sizeWork; l++)
@@ -1126,6 +1172,32 @@ Matrix::addMatrixTripleProduct(double thisFact,
 
 
 
+
+// to perform this = thisFact * this + sum of otherFacts[i] * T[i]' * B[i] * T[i]
+// over the numProducts points of an element, e.g. the integration points;
+// the same as addMatrixTripleProduct() point by point
+int
+Matrix::addMatrixTripleProducts(double thisFact,
+				const Matrix **T,
+				const Matrix **B,
+				const double *otherFacts,
+				int numProducts)
+{
+    if (thisFact == 0.0)
+      this->Zero();
+    else if (thisFact != 1.0)
+      *this *= thisFact;
+
+    for (int i=0; i<numProducts; i++) {
+      if (otherFacts[i] == 0.0)
+	continue;
+      if (this->addMatrixTripleProduct(1.0, *T[i], *B[i], otherFacts[i]) < 0)
+	return -1;
+    }
+
+    return 0;
+}
+
 //
 // OVERLOADED OPERATOR () to CONSTRUCT A NEW MATRIX
 //
@@ -1175,12 +1247,13 @@ Matrix::operator=(const Matrix &other)
       opserr << "Matrix::operator=() - matrix dimensions do not match\n";
 #endif
 
-      if (this->data != 0)
-	  delete [] this->data;
+      if (this->data != 0 && fromFree == 0)
+	  DataPool::release(this->data);
       
       int theSize = other.numCols*other.numRows;
       
-      data = new (nothrow) double[theSize];
+      data = DataPool::allocate(theSize);
+      fromFree = 0;
       
       this->dataSize = theSize;
       this->numCols = other.numCols;
@@ -1197,6 +1270,35 @@ Matrix::operator=(const Matrix &other)
   return *this;
 }
 
+#ifdef OPS_RVALUE_REFS
+// as operator=(const Matrix &), but when the data would have to be
+// reallocated the data of the temporary is taken instead. When the sizes
+// agree the data is copied, so that the storage of this does not move.
+Matrix &
+Matrix::operator=(Matrix &&other)
+{
+  if (this == &other) 
+    return *this;
+
+  if ((numCols == other.numCols && numRows == other.numRows) ||
+      fromFree != 0 || other.fromFree != 0)
+    return *this = (const Matrix &)other;
+
+  if (data != 0)
+    DataPool::release(data);
+  numRows = other.numRows;
+  numCols = other.numCols;
+  dataSize = other.dataSize;
+  data = other.data;
+  other.numRows = 0;
+  other.numCols = 0;
+  other.dataSize = 0;
+  other.data = 0;
+
+  return *this;
+}
+#endif
+
 
 
 
@@ -1748,6 +1850,65 @@ Matrix operator*(double a, const Matrix &V)
   return V * a;
 }
 
+#ifdef OPS_RVALUE_REFS
+// the operators on a temporary, other than one referring to data it does
+// not own, do the work in place in the temporary and pass it on
+
+Matrix operator+(Matrix &&A, const Matrix &B)
+{
+  if (A.fromFree != 0)
+    return (const Matrix &)A + B;
+  A.addMatrix(1.0, B, 1.0);
+  return std::move(A);
+}
+
+Matrix operator+(const Matrix &A, Matrix &&B)
+{
+  if (B.fromFree != 0)
+    return A + (const Matrix &)B;
+  B.addMatrix(1.0, A, 1.0);
+  return std::move(B);
+}
+
+Matrix operator+(Matrix &&A, Matrix &&B)
+{
+  return std::move(A) + (const Matrix &)B;
+}
+
+Matrix operator-(Matrix &&A, const Matrix &B)
+{
+  if (A.fromFree != 0)
+    return (const Matrix &)A - B;
+  A.addMatrix(1.0, B, -1.0);
+  return std::move(A);
+}
+
+Matrix operator*(Matrix &&M, double fact)
+{
+  if (M.fromFree != 0)
+    return (const Matrix &)M * fact;
+  M *= fact;
+  return std::move(M);
+}
+
+Matrix operator*(double fact, Matrix &&M)
+{
+  return std::move(M) * fact;
+}
+
+Matrix operator/(Matrix &&M, double fact)
+{
+  if (M.fromFree != 0)
+    return (const Matrix &)M / fact;
+  if (fact == 0.0) {
+    opserr << "Matrix::operator/(const double &fact): ERROR divide-by-zero\n";
+    exit(0);
+  }
+  M /= fact;
+  return std::move(M);
+}
+#endif
+
 
 
 
@@ -53,6 +53,9 @@ class Matrix
     Matrix(int nrows, int ncols);
     Matrix(double *data, int nrows, int ncols);    
     Matrix(const Matrix &M);    
+#ifdef OPS_RVALUE_REFS
+    Matrix(Matrix &&M);
+#endif
     ~Matrix();
 
     // utility methods
@@ -75,6 +78,7 @@ class Matrix
     int addMatrixTransposeProduct(double factThis, const Matrix &A, const Matrix &B, double factOther); // A'B
     int addMatrixTripleProduct(double factThis, const Matrix &A, const Matrix &B, double factOther); // A'BA
     int addMatrixTripleProduct(double factThis, const Matrix &A, const Matrix &B, const Matrix &C, double otherFact); //A'BC
+    int addMatrixTripleProducts(double factThis, const Matrix **T, const Matrix **B, const double *otherFacts, int numProducts); // sum of T'BT
     
     // overloaded operators 
     inline double &operator()(int row, int col);
@@ -82,6 +86,9 @@ class Matrix
     Matrix operator()(const ID &rows, const ID & cols) const;
     
     Matrix &operator=(const Matrix &M);
+#ifdef OPS_RVALUE_REFS
+    Matrix &operator=(Matrix &&M);
+#endif
     
     // matrix operations which will preserve the derived type and
     // which can be implemented efficiently without many constructor calls.
@@ -132,14 +139,27 @@ class Matrix
     friend OPS_Stream &operator<<(OPS_Stream &s, const Matrix &M);
     //    friend istream &operator>>(istream &s, Matrix &M);    
     friend Matrix operator*(double a, const Matrix &M);
+#ifdef OPS_RVALUE_REFS
+    // on a temporary these work in its storage
+    friend Matrix operator+(Matrix &&A, const Matrix &B);
+    friend Matrix operator+(const Matrix &A, Matrix &&B);
+    friend Matrix operator+(Matrix &&A, Matrix &&B);
+    friend Matrix operator-(Matrix &&A, const Matrix &B);
+    friend Matrix operator*(Matrix &&M, double fact);
+    friend Matrix operator*(double fact, Matrix &&M);
+    friend Matrix operator/(Matrix &&M, double fact);
+#endif
     
     
     friend class Vector;    
     friend class Message;
+    friend class Archive;
     friend class UDP_Socket;
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;
+    friend class SharedMemoryChannel;
+    friend class MultiplexedChannel;
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
@@ -148,10 +168,12 @@ class Matrix
 
   private:
     static double MATRIX_NOT_VALID_ENTRY;
-    static double *matrixWork;
-    static int *intWork;
-    static int sizeDoubleWork;
-    static int sizeIntWork;
+    static int setWorkSize(int numDouble, int numInt);
+
+    static OPS_THREAD_LOCAL double *matrixWork;
+    static OPS_THREAD_LOCAL int *intWork;
+    static OPS_THREAD_LOCAL int sizeDoubleWork;
+    static OPS_THREAD_LOCAL int sizeIntWork;
 
     int numRows;
     int numCols;
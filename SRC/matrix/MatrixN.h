@@ -0,0 +1,378 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/MatrixN.h,v $
+
+#ifndef MatrixN_h
+#define MatrixN_h
+
+// Created: 10/26
+//
+// Description: This file contains the class templates MatrixN<R,C> and
+// VectorN<N>, matrices and vectors whose dimensions are fixed at compile
+// time. The data is held in the object itself, so that an element can
+// keep them on the stack or as members without any heap allocation, and
+// with the sizes known the compiler can unroll and vectorize the loops.
+// As in Matrix the data is stored by column. They are meant for the small
+// dense operations of element kernels; the results are copied to or added
+// into the Matrix and Vector objects the element returns with copyTo()
+// and addTo(). Solve() and Invert() use Gauss elimination with partial
+// pivoting in storage on the stack, not the LAPACK work areas of Matrix.
+
+#include <Matrix.h>
+#include <Vector.h>
+#include <math.h>
+
+template <int N> class VectorN;
+
+template <int R, int C>
+class MatrixN
+{
+  public:
+    MatrixN() {this->Zero();}
+    MatrixN(const Matrix &M) {*this = M;}
+
+    inline int noRows(void) const {return R;}
+    inline int noCols(void) const {return C;}
+
+    inline void Zero(void) {
+      for (int i=0; i<R*C; i++)
+	values[i] = 0.0;
+    }
+
+    inline double operator()(int row, int col) const {return values[col*R+row];}
+    inline double &operator()(int row, int col) {return values[col*R+row];}
+
+    MatrixN &operator=(const Matrix &M) {
+      if (M.noRows() != R || M.noCols() != C) {
+	opserr << "MatrixN::operator=() - Matrix of size " << M.noRows() << " x " << M.noCols();
+	opserr << " is not " << R << " x " << C << endln;
+	return *this;
+      }
+      for (int j=0; j<C; j++)
+	for (int i=0; i<R; i++)
+	  values[j*R+i] = M(i,j);
+      return *this;
+    }
+
+    MatrixN &operator+=(const MatrixN &other) {
+      for (int i=0; i<R*C; i++)
+	values[i] += other.values[i];
+      return *this;
+    }
+
+    MatrixN &operator-=(const MatrixN &other) {
+      for (int i=0; i<R*C; i++)
+	values[i] -= other.values[i];
+      return *this;
+    }
+
+    MatrixN &operator*=(double fact) {
+      for (int i=0; i<R*C; i++)
+	values[i] *= fact;
+      return *this;
+    }
+
+    // this = thisFact * this + otherFact * other
+    void addMatrix(double thisFact, const MatrixN &other, double otherFact) {
+      for (int i=0; i<R*C; i++)
+	values[i] = thisFact*values[i] + otherFact*other.values[i];
+    }
+
+    // this = thisFact * this + otherFact * A * B
+    template <int K>
+    void addMatrixProduct(double thisFact, const MatrixN<R,K> &A, const MatrixN<K,C> &B,
+			  double otherFact) {
+      if (thisFact == 0.0)
+	this->Zero();
+      else if (thisFact != 1.0)
+	*this *= thisFact;
+      for (int j=0; j<C; j++) {
+	double *thisCol = &values[j*R];
+	for (int k=0; k<K; k++) {
+	  double bkj = otherFact*B.values[j*K+k];
+	  const double *aCol = &A.values[k*R];
+	  for (int i=0; i<R; i++)
+	    thisCol[i] += aCol[i]*bkj;
+	}
+      }
+    }
+
+    // this = thisFact * this + otherFact * A^T * B
+    template <int K>
+    void addMatrixTransposeProduct(double thisFact, const MatrixN<K,R> &A, const MatrixN<K,C> &B,
+				   double otherFact) {
+      for (int j=0; j<C; j++) {
+	const double *bCol = &B.values[j*K];
+	for (int i=0; i<R; i++) {
+	  const double *aCol = &A.values[i*K];
+	  double sum = 0.0;
+	  for (int k=0; k<K; k++)
+	    sum += aCol[k]*bCol[k];
+	  values[j*R+i] = thisFact*values[j*R+i] + otherFact*sum;
+	}
+      }
+    }
+
+    // this = thisFact * this + otherFact * T^T * B * T, for square this
+    template <int K>
+    void addMatrixTripleProduct(double thisFact, const MatrixN<K,R> &T, const MatrixN<K,K> &B,
+				double otherFact) {
+      MatrixN<K,C> BT;
+      BT.addMatrixProduct(0.0, B, T, 1.0);
+      this->addMatrixTransposeProduct(thisFact, T, BT, otherFact);
+    }
+
+    template <int K>
+    MatrixN<R,K> operator*(const MatrixN<C,K> &B) const {
+      MatrixN<R,K> result;
+      result.addMatrixProduct(0.0, *this, B, 1.0);
+      return result;
+    }
+
+    VectorN<R> operator*(const VectorN<C> &V) const {
+      VectorN<R> result;
+      result.addMatrixVector(0.0, *this, V, 1.0);
+      return result;
+    }
+
+    // solves this * x = b for square this, returns -1 if singular
+    int Solve(const VectorN<R> &b, VectorN<R> &x) const {
+      MatrixN<R,1> B;
+      MatrixN<R,1> X;
+      for (int i=0; i<R; i++)
+	B.values[i] = b.values[i];
+      int res = this->Solve(B, X);
+      for (int i=0; i<R; i++)
+	x.values[i] = X.values[i];
+      return res;
+    }
+
+    template <int K>
+    int Solve(const MatrixN<R,K> &B, MatrixN<R,K> &X) const {
+      double A[R*R];
+      for (int i=0; i<R*R; i++)
+	A[i] = values[i];
+      X = B;
+
+      for (int k=0; k<R; k++) {
+	// pivot on the largest entry left in column k
+	int p = k;
+	double maxA = fabs(A[k*R+k]);
+	for (int i=k+1; i<R; i++)
+	  if (fabs(A[k*R+i]) > maxA) {
+	    maxA = fabs(A[k*R+i]);
+	    p = i;
+	  }
+	if (maxA == 0.0)
+	  return -1;
+	if (p != k) {
+	  for (int j=0; j<R; j++) {
+	    double tmp = A[j*R+k]; A[j*R+k] = A[j*R+p]; A[j*R+p] = tmp;
+	  }
+	  for (int j=0; j<K; j++) {
+	    double tmp = X.values[j*R+k]; X.values[j*R+k] = X.values[j*R+p]; X.values[j*R+p] = tmp;
+	  }
+	}
+
+	double invPivot = 1.0/A[k*R+k];
+	for (int i=k+1; i<R; i++) {
+	  double factor = A[k*R+i]*invPivot;
+	  if (factor == 0.0)
+	    continue;
+	  for (int j=k+1; j<R; j++)
+	    A[j*R+i] -= factor*A[j*R+k];
+	  for (int j=0; j<K; j++)
+	    X.values[j*R+i] -= factor*X.values[j*R+k];
+	}
+      }
+
+      // back substitution
+      for (int j=0; j<K; j++) {
+	double *x = &X.values[j*R];
+	for (int i=R-1; i>=0; i--) {
+	  double sum = x[i];
+	  for (int l=i+1; l<R; l++)
+	    sum -= A[l*R+i]*x[l];
+	  x[i] = sum/A[i*R+i];
+	}
+      }
+
+      return 0;
+    }
+
+    // inverse of square this, returns -1 if singular
+    int Invert(MatrixN &theInverse) const {
+      MatrixN I;
+      for (int i=0; i<R; i++)
+	I.values[i*R+i] = 1.0;
+      return this->Solve(I, theInverse);
+    }
+
+    // M = this, M must be R x C
+    int copyTo(Matrix &M) const {
+      if (M.noRows() != R || M.noCols() != C) {
+	opserr << "MatrixN::copyTo() - Matrix of size " << M.noRows() << " x " << M.noCols();
+	opserr << " is not " << R << " x " << C << endln;
+	return -1;
+      }
+      for (int j=0; j<C; j++)
+	for (int i=0; i<R; i++)
+	  M(i,j) = values[j*R+i];
+      return 0;
+    }
+
+    // M += fact * this, M must be R x C
+    int addTo(Matrix &M, double fact = 1.0) const {
+      if (M.noRows() != R || M.noCols() != C) {
+	opserr << "MatrixN::addTo() - Matrix of size " << M.noRows() << " x " << M.noCols();
+	opserr << " is not " << R << " x " << C << endln;
+	return -1;
+      }
+      for (int j=0; j<C; j++)
+	for (int i=0; i<R; i++)
+	  M(i,j) += fact*values[j*R+i];
+      return 0;
+    }
+
+    double values[R*C];
+};
+
+
+template <int N>
+class VectorN
+{
+  public:
+    VectorN() {this->Zero();}
+    VectorN(const Vector &V) {*this = V;}
+
+    inline int Size(void) const {return N;}
+
+    inline void Zero(void) {
+      for (int i=0; i<N; i++)
+	values[i] = 0.0;
+    }
+
+    inline double operator()(int i) const {return values[i];}
+    inline double &operator()(int i) {return values[i];}
+
+    VectorN &operator=(const Vector &V) {
+      if (V.Size() != N) {
+	opserr << "VectorN::operator=() - Vector of size " << V.Size() << " is not " << N << endln;
+	return *this;
+      }
+      for (int i=0; i<N; i++)
+	values[i] = V(i);
+      return *this;
+    }
+
+    VectorN &operator+=(const VectorN &other) {
+      for (int i=0; i<N; i++)
+	values[i] += other.values[i];
+      return *this;
+    }
+
+    VectorN &operator-=(const VectorN &other) {
+      for (int i=0; i<N; i++)
+	values[i] -= other.values[i];
+      return *this;
+    }
+
+    VectorN &operator*=(double fact) {
+      for (int i=0; i<N; i++)
+	values[i] *= fact;
+      return *this;
+    }
+
+    // dot product
+    double operator^(const VectorN &other) const {
+      double sum = 0.0;
+      for (int i=0; i<N; i++)
+	sum += values[i]*other.values[i];
+      return sum;
+    }
+
+    double Norm(void) const {
+      return sqrt(*this ^ *this);
+    }
+
+    // this = thisFact * this + otherFact * other
+    void addVector(double thisFact, const VectorN &other, double otherFact) {
+      for (int i=0; i<N; i++)
+	values[i] = thisFact*values[i] + otherFact*other.values[i];
+    }
+
+    // this = thisFact * this + otherFact * m * v
+    template <int C>
+    void addMatrixVector(double thisFact, const MatrixN<N,C> &m, const VectorN<C> &v,
+			 double otherFact) {
+      if (thisFact == 0.0)
+	this->Zero();
+      else if (thisFact != 1.0)
+	*this *= thisFact;
+      for (int j=0; j<C; j++) {
+	double vj = otherFact*v.values[j];
+	const double *mCol = &m.values[j*N];
+	for (int i=0; i<N; i++)
+	  values[i] += mCol[i]*vj;
+      }
+    }
+
+    // this = thisFact * this + otherFact * m^T * v
+    template <int R>
+    void addMatrixTransposeVector(double thisFact, const MatrixN<R,N> &m, const VectorN<R> &v,
+				  double otherFact) {
+      for (int i=0; i<N; i++) {
+	const double *mCol = &m.values[i*R];
+	double sum = 0.0;
+	for (int k=0; k<R; k++)
+	  sum += mCol[k]*v.values[k];
+	values[i] = thisFact*values[i] + otherFact*sum;
+      }
+    }
+
+    // V = this, V must be of size N
+    int copyTo(Vector &V) const {
+      if (V.Size() != N) {
+	opserr << "VectorN::copyTo() - Vector of size " << V.Size() << " is not " << N << endln;
+	return -1;
+      }
+      for (int i=0; i<N; i++)
+	V(i) = values[i];
+      return 0;
+    }
+
+    // V += fact * this, V must be of size N
+    int addTo(Vector &V, double fact = 1.0) const {
+      if (V.Size() != N) {
+	opserr << "VectorN::addTo() - Vector of size " << V.Size() << " is not " << N << endln;
+	return -1;
+      }
+      for (int i=0; i<N; i++)
+	V(i) += fact*values[i];
+      return 0;
+    }
+
+    double values[N];
+};
+
+#endif
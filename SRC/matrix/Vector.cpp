@@ -34,7 +34,11 @@
 #include "Vector.h"
 #include "Matrix.h"
 #include "ID.h"
+#include <DataPool.h>
 #include <iostream>
+#ifdef OPS_RVALUE_REFS
+#include <utility>
+#endif
 using std::nothrow;
 
 #include <math.h>
@@ -66,7 +70,7 @@ Vector::Vector(int size)
   // get some space for the vector
   //  theData = (double *)malloc(size*sizeof(double));
   if (size > 0) {
-    theData = new (nothrow) double [size];
+    theData = DataPool::allocate(size);
 
     if (theData == 0) {
       opserr << "Vector::Vector(int) - out of memory creating vector of size " << size << endln;
@@ -97,7 +101,7 @@ Vector::Vector(const Vector &other)
 : sz(other.sz),theData(0),fromFree(0)
 {
   if (sz != 0) {
-    theData = new (nothrow) double [other.sz];    
+    theData = DataPool::allocate(other.sz);    
     
     if (theData == 0) {
       opserr << "Vector::Vector(int) - out of memory creating vector of size " << sz << endln;
@@ -108,6 +112,33 @@ Vector::Vector(const Vector &other)
     theData[i] = other.theData[i];
 }	
 
+#ifdef OPS_RVALUE_REFS
+// Vector(Vector &&):
+//	takes the data of a temporary, unless the temporary only refers to
+//	data it does not own, which is copied as by the copy constructor
+
+Vector::Vector(Vector &&other)
+: sz(other.sz),theData(other.theData),fromFree(0)
+{
+  if (other.fromFree != 0) {
+    theData = 0;
+    if (sz != 0) {
+      theData = DataPool::allocate(sz);
+      if (theData == 0) {
+	opserr << "Vector::Vector(int) - out of memory creating vector of size " << sz << endln;
+	sz = 0;
+      }
+    }
+    for (int i=0; i<sz; i++)
+      theData[i] = other.theData[i];
+    return;
+  }
+
+  other.sz = 0;
+  other.theData = 0;
+}
+#endif
+
 
 // ~Vector():
 // 	destructor, deletes the [] data
@@ -115,14 +146,14 @@ Vector::Vector(const Vector &other)
 Vector::~Vector()
 {
   if (theData != 0 && fromFree == 0) 
-    delete [] theData;
+    DataPool::release(theData);
 }
 
 
 int 
 Vector::setData(double *newData, int size){
   if (theData != 0 && fromFree == 0) 
-    delete [] theData;      
+    DataPool::release(theData);      
   sz = size;
   theData = newData;
   fromFree = 1;
@@ -151,13 +182,13 @@ Vector::resize(int newSize){
 
     // delete the old array
     if (theData != 0 && fromFree == 0) 
-	delete [] theData;
+	DataPool::release(theData);
     sz = 0;
     fromFree = 0;
     
     // create new memory
     // theData = (double *)malloc(newSize*sizeof(double));    
-    theData = new (nothrow) double[newSize];
+    theData = DataPool::allocate(newSize);
     if (theData == 0) {
       opserr << "Vector::resize() - out of memory for size " << newSize << endln;
       sz = 0;
@@ -595,7 +626,18 @@ Vector::pNorm(int p) const
 {
   double value = 0;
   
-  if (p>0) {
+  // the common norms without pow()
+  if (p == 2) {
+    for (int i=0; i<sz; i++) {
+      double data = theData[i];
+      value += data*data;
+    }
+    return sqrt(value);
+  } else if (p == 1) {
+    for (int i=0; i<sz; i++)
+      value += fabs(theData[i]);
+    return value;
+  } else if (p>0) {
     for (int i=0; i<sz; i++) {
       double data = fabs(theData[i]);
       value += pow(data,p);
@@ -623,7 +665,7 @@ Vector::operator[](int x)
 #endif
   
   if (x >= sz) {
-    double *dataNew = new (nothrow) double[x+1];
+    double *dataNew = DataPool::allocate(x+1);
     for (int i=0; i<sz; i++)
       dataNew[i] = theData[i];
     for (int j=sz; j<x; j++)
@@ -631,9 +673,10 @@ Vector::operator[](int x)
     
     if (fromFree == 0)
       if (theData != 0)
-	delete [] theData;
+	DataPool::release(theData);
 
     theData = dataNew;
+    fromFree = 0;
     sz = x+1;
   }
 
@@ -711,12 +754,13 @@ Vector::operator=(const Vector &V)
 #endif
 
 	  // Check that we are not deleting an empty Vector
-	  if (this->theData != 0) delete [] this->theData;
+	  if (this->theData != 0 && fromFree == 0) DataPool::release(this->theData);
 
 	  this->sz = V.sz;
 	  
 	  // Check that we are not creating an empty Vector
-	  theData = (sz != 0) ? new (nothrow) double[sz] : 0;
+	  theData = (sz != 0) ? DataPool::allocate(sz) : 0;
+	  fromFree = 0;
       }
 
 
@@ -728,6 +772,32 @@ Vector::operator=(const Vector &V)
   return *this;
 }
 
+#ifdef OPS_RVALUE_REFS
+// Vector &operator=(Vector &&V):
+//	as operator=(const Vector &), but when the data would have to be
+//	reallocated the data of the temporary is taken instead. When the sizes
+//	agree the data is copied, so that the storage of this does not move.
+
+Vector &
+Vector::operator=(Vector &&V)
+{
+  if (this == &V)
+    return *this;
+
+  if (sz == V.sz || fromFree != 0 || V.fromFree != 0)
+    return *this = (const Vector &)V;
+
+  if (theData != 0)
+    DataPool::release(theData);
+  sz = V.sz;
+  theData = V.theData;
+  V.sz = 0;
+  V.theData = 0;
+
+  return *this;
+}
+#endif
+
 
 // Vector &operator+=(double fact):
 //	The += operator adds fact to each element of the vector, data[i] = data[i]+fact.
@@ -1095,6 +1165,63 @@ Vector operator*(double a, const Vector &V)
   return V * a;
 }
 
+#ifdef OPS_RVALUE_REFS
+// the operators on a temporary, other than one referring to data it does
+// not own, do the work in place in the temporary and pass it on
+
+Vector operator+(Vector &&a, const Vector &b)
+{
+  if (a.fromFree != 0)
+    return (const Vector &)a + b;
+  a += b;
+  return std::move(a);
+}
+
+Vector operator+(const Vector &a, Vector &&b)
+{
+  if (b.fromFree != 0)
+    return a + (const Vector &)b;
+  b += a;
+  return std::move(b);
+}
+
+Vector operator+(Vector &&a, Vector &&b)
+{
+  return std::move(a) + (const Vector &)b;
+}
+
+Vector operator-(Vector &&a, const Vector &b)
+{
+  if (a.fromFree != 0)
+    return (const Vector &)a - b;
+  a -= b;
+  return std::move(a);
+}
+
+Vector operator*(Vector &&V, double fact)
+{
+  if (V.fromFree != 0)
+    return (const Vector &)V * fact;
+  V *= fact;
+  return std::move(V);
+}
+
+Vector operator*(double fact, Vector &&V)
+{
+  return std::move(V) * fact;
+}
+
+Vector operator/(Vector &&V, double fact)
+{
+  if (V.fromFree != 0)
+    return (const Vector &)V / fact;
+  if (fact == 0.0) 
+    opserr << "Vector::operator/(double fact) - divide-by-zero error coming\n";
+  V /= fact;
+  return std::move(V);
+}
+#endif
+
 
 int
 Vector::Assemble(const Vector &V, int init_pos, double fact) 
@@ -48,6 +48,9 @@ class Vector
     Vector(int);
     Vector(const Vector &);    
     Vector(double *data, int size);
+#ifdef OPS_RVALUE_REFS
+    Vector(Vector &&);
+#endif
     ~Vector();
 
     // utility methods
@@ -72,6 +75,9 @@ class Vector
     double &operator[](int x);
     Vector operator()(const ID &rows) const;
     Vector &operator=(const Vector  &V);
+#ifdef OPS_RVALUE_REFS
+    Vector &operator=(Vector &&V);
+#endif
     
     Vector &operator+=(double fact);
     Vector &operator-=(double fact);
@@ -106,14 +112,28 @@ class Vector
     friend OPS_Stream &operator<<(OPS_Stream &s, const Vector &V);
     // friend istream &operator>>(istream &s, Vector &V);    
     friend Vector operator*(double a, const Vector &V);
+#ifdef OPS_RVALUE_REFS
+    // on a temporary these work in its storage, so that a chain such as
+    // a*x + b*y - z allocates only for the products
+    friend Vector operator+(Vector &&a, const Vector &b);
+    friend Vector operator+(const Vector &a, Vector &&b);
+    friend Vector operator+(Vector &&a, Vector &&b);
+    friend Vector operator-(Vector &&a, const Vector &b);
+    friend Vector operator*(Vector &&V, double fact);
+    friend Vector operator*(double fact, Vector &&V);
+    friend Vector operator/(Vector &&V, double fact);
+#endif
     
     friend class Message;
+    friend class Archive;
     friend class SystemOfEqn;
     friend class Matrix;
     friend class UDP_Socket;
     friend class TCP_Socket;
     friend class TCP_SocketSSL;
     friend class TCP_SocketNoDelay;    
+    friend class SharedMemoryChannel;
+    friend class MultiplexedChannel;
     friend class MPI_Channel;
     friend class MySqlDatastore;
     friend class BerkeleyDbDatastore;
@@ -0,0 +1,161 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/Workspace.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of Workspace.
+
+#include <Workspace.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <OPS_Globals.h>
+#include <stdlib.h>
+
+#define WORKSPACE_MATRIX 0
+#define WORKSPACE_VECTOR 1
+#define WORKSPACE_DOUBLES 2
+
+struct WorkspaceEntry {
+  const void *key;
+  int type;
+  int size1, size2;
+  void *data;
+  WorkspaceEntry *next;
+};
+
+// each thread has its own list of entries; the entry last found is moved
+// to the front, so the lookup is normally satisfied by the first few
+static OPS_THREAD_LOCAL WorkspaceEntry *theEntries = 0;
+
+static WorkspaceEntry *
+findEntry(const void *key, int type, int size1, int size2)
+{
+  WorkspaceEntry *prev = 0;
+  WorkspaceEntry *entry = theEntries;
+  while (entry != 0) {
+    if (entry->key == key && entry->type == type && 
+	(type == WORKSPACE_DOUBLES || 
+	 (entry->size1 == size1 && entry->size2 == size2))) {
+      if (prev != 0) {
+	prev->next = entry->next;
+	entry->next = theEntries;
+	theEntries = entry;
+      }
+      return entry;
+    }
+    prev = entry;
+    entry = entry->next;
+  }
+  return 0;
+}
+
+static WorkspaceEntry *
+addEntry(const void *key, int type, int size1, int size2, void *data)
+{
+  WorkspaceEntry *entry = new WorkspaceEntry;
+  entry->key = key;
+  entry->type = type;
+  entry->size1 = size1;
+  entry->size2 = size2;
+  entry->data = data;
+  entry->next = theEntries;
+  theEntries = entry;
+  return entry;
+}
+
+Matrix &
+Workspace::getMatrix(const void *key, int noRows, int noCols)
+{
+  WorkspaceEntry *entry = findEntry(key, WORKSPACE_MATRIX, noRows, noCols);
+  if (entry == 0) {
+    Matrix *theMatrix = new Matrix(noRows, noCols);
+    if (theMatrix == 0 || theMatrix->noRows() != noRows) {
+      opserr << "Workspace::getMatrix() - out of memory for Matrix of size ";
+      opserr << noRows << " x " << noCols << endln;
+      exit(-1);
+    }
+    entry = addEntry(key, WORKSPACE_MATRIX, noRows, noCols, theMatrix);
+  }
+
+  return *((Matrix *)entry->data);
+}
+
+Vector &
+Workspace::getVector(const void *key, int size)
+{
+  WorkspaceEntry *entry = findEntry(key, WORKSPACE_VECTOR, size, 1);
+  if (entry == 0) {
+    Vector *theVector = new Vector(size);
+    if (theVector == 0 || theVector->Size() != size) {
+      opserr << "Workspace::getVector() - out of memory for Vector of size ";
+      opserr << size << endln;
+      exit(-1);
+    }
+    entry = addEntry(key, WORKSPACE_VECTOR, size, 1, theVector);
+  }
+
+  return *((Vector *)entry->data);
+}
+
+double *
+Workspace::getDoubles(const void *key, int size)
+{
+  if (size < 1)
+    size = 1;
+
+  // arrays are only identified by key, they are enlarged when needed
+  WorkspaceEntry *entry = findEntry(key, WORKSPACE_DOUBLES, size, 1);
+  if (entry != 0 && entry->size1 < size) {
+    delete [] (double *)entry->data;
+    entry->data = new double[size];
+    entry->size1 = size;
+  } else if (entry == 0)
+    entry = addEntry(key, WORKSPACE_DOUBLES, size, 1, new double[size]);
+
+  if (entry->data == 0) {
+    opserr << "Workspace::getDoubles() - out of memory for array of size ";
+    opserr << size << endln;
+    exit(-1);
+  }
+
+  return (double *)entry->data;
+}
+
+void
+Workspace::clear(void)
+{
+  WorkspaceEntry *entry = theEntries;
+  while (entry != 0) {
+    WorkspaceEntry *next = entry->next;
+    if (entry->type == WORKSPACE_MATRIX)
+      delete (Matrix *)entry->data;
+    else if (entry->type == WORKSPACE_VECTOR)
+      delete (Vector *)entry->data;
+    else
+      delete [] (double *)entry->data;
+    delete entry;
+    entry = next;
+  }
+  theEntries = 0;
+}
@@ -0,0 +1,59 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/matrix/Workspace.h,v $
+
+#ifndef Workspace_h
+#define Workspace_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for Workspace.
+// Workspace hands out scratch Matrix, Vector and double storage that is
+// private to the calling thread. It replaces the class wide static
+// matrices and arrays that elements, sections and FE_Elements use to
+// return their results, which prevented them being invoked concurrently.
+//
+// Storage is identified by a key, the address of any object unique to the
+// caller (typically a file static), and for Matrix and Vector objects also
+// by size. The storage is created the first time it is asked for by a
+// thread and is reused by that thread on subsequent calls, so that as with
+// the old static objects the contents are only valid until the same caller
+// asks for it again in the same thread.
+
+#include <OPS_Globals.h>
+
+class Matrix;
+class Vector;
+
+class Workspace
+{
+  public:
+    static Matrix &getMatrix(const void *key, int noRows, int noCols);
+    static Vector &getVector(const void *key, int size);
+    static double *getDoubles(const void *key, int size);
+
+    // frees the storage of the calling thread
+    static void clear(void);
+};
+
+#endif
@@ -0,0 +1,536 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/modelbuilder/EmbeddedModelBuilder.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// EmbeddedModelBuilder.
+
+// What: "@(#) EmbeddedModelBuilder.cpp, revA"
+
+#include <EmbeddedModelBuilder.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Element.h>
+#include <SP_Constraint.h>
+#include <MP_Constraint.h>
+#include <NodalLoad.h>
+#include <LoadPattern.h>
+#include <LinearSeries.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <ArrayOfTaggedObjects.h>
+
+#include <UniaxialMaterial.h>
+#include <Truss.h>
+#include <ElasticBeam2d.h>
+#include <LinearCrdTransf2d.h>
+
+#include <StaticAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
+#include <AnalysisModel.h>
+#include <TransformationConstraintHandler.h>
+#include <DOF_Numberer.h>
+#include <RCM.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectSolver.h>
+#include <FullGenEigenSOE.h>
+#include <FullGenEigenSolver.h>
+#include <CTestNormDispIncr.h>
+#include <Linear.h>
+#include <NewtonRaphson.h>
+#include <LoadControl.h>
+#include <Newmark.h>
+
+EmbeddedModelBuilder::EmbeddedModelBuilder(Domain &theDomain, int NDM, int NDF)
+  :ModelBuilder(theDomain), ndm(NDM), ndf(NDF),
+   theUniaxialMaterials(0), theTransf2d(0), numLoads(0),
+   theStaticAnalysis(0), theTransientAnalysis(0),
+   theAnalysisModel(0), theAlgorithm(0), theTransientIntegrator(0),
+   eigenSOEset(false)
+{
+  theUniaxialMaterials = new ArrayOfTaggedObjects(32);
+}
+
+EmbeddedModelBuilder::~EmbeddedModelBuilder()
+{
+  this->clearAnalysis();
+
+  if (theUniaxialMaterials != 0) {
+    theUniaxialMaterials->clearAll();
+    delete theUniaxialMaterials;
+  }
+  if (theTransf2d != 0)
+    delete theTransf2d;
+}
+
+int
+EmbeddedModelBuilder::buildFE_Model(void)
+{
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::getNDM(void) const
+{
+  return ndm;
+}
+
+int
+EmbeddedModelBuilder::getNDF(void) const
+{
+  return ndf;
+}
+
+int
+EmbeddedModelBuilder::addNode(int tag, const double *crds)
+{
+  Node *theNode = 0;
+  if (ndm == 1)
+    theNode = new Node(tag, ndf, crds[0]);
+  else if (ndm == 2)
+    theNode = new Node(tag, ndf, crds[0], crds[1]);
+  else if (ndm == 3)
+    theNode = new Node(tag, ndf, crds[0], crds[1], crds[2]);
+  else {
+    opserr << "EmbeddedModelBuilder::addNode() - ndm " << ndm << " is not 1, 2 or 3\n";
+    return -1;
+  }
+
+  Domain *theDomain = this->getDomainPtr();
+  if (theDomain->addNode(theNode) == false) {
+    opserr << "EmbeddedModelBuilder::addNode() - could not add node " << tag << endln;
+    delete theNode;
+    return -2;
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::setNodeMass(int nodeTag, const double *mass)
+{
+  Node *theNode = this->getDomainPtr()->getNode(nodeTag);
+  if (theNode == 0) {
+    opserr << "EmbeddedModelBuilder::setNodeMass() - no node " << nodeTag << endln;
+    return -1;
+  }
+
+  Matrix theMass(ndf, ndf);
+  for (int i=0; i<ndf; i++)
+    theMass(i,i) = mass[i];
+
+  return theNode->setMass(theMass);
+}
+
+int
+EmbeddedModelBuilder::fix(int nodeTag, const int *fixity)
+{
+  Domain *theDomain = this->getDomainPtr();
+  if (theDomain->getNode(nodeTag) == 0) {
+    opserr << "EmbeddedModelBuilder::fix() - no node " << nodeTag << endln;
+    return -1;
+  }
+
+  for (int i=0; i<ndf; i++) {
+    if (fixity[i] == 0)
+      continue;
+    SP_Constraint *theSP = new SP_Constraint(nodeTag, i, 0.0, true);
+    if (theDomain->addSP_Constraint(theSP) == false) {
+      opserr << "EmbeddedModelBuilder::fix() - could not fix dof " << i+1 << " of node " << nodeTag << endln;
+      delete theSP;
+      return -2;
+    }
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::equalDOF(int retainedNode, int constrainedNode, const int *dofs, int numDOF)
+{
+  ID dofIDs(numDOF);
+  Matrix Ccr(numDOF, numDOF);
+  for (int i=0; i<numDOF; i++) {
+    if (dofs[i] < 0 || dofs[i] >= ndf) {
+      opserr << "EmbeddedModelBuilder::equalDOF() - invalid dof " << dofs[i]+1 << endln;
+      return -1;
+    }
+    dofIDs(i) = dofs[i];
+    Ccr(i,i) = 1.0;
+  }
+
+  MP_Constraint *theMP = new MP_Constraint(retainedNode, constrainedNode, Ccr, dofIDs, dofIDs);
+  if (this->getDomainPtr()->addMP_Constraint(theMP) == false) {
+    opserr << "EmbeddedModelBuilder::equalDOF() - could not add constraint between nodes ";
+    opserr << retainedNode << " and " << constrainedNode << endln;
+    delete theMP;
+    return -2;
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::addUniaxialMaterial(UniaxialMaterial *theMaterial)
+{
+  if (theUniaxialMaterials->addComponent(theMaterial) == false) {
+    opserr << "EmbeddedModelBuilder::addUniaxialMaterial() - could not add material ";
+    opserr << theMaterial->getTag() << endln;
+    return -1;
+  }
+
+  return 0;
+}
+
+UniaxialMaterial *
+EmbeddedModelBuilder::getUniaxialMaterial(int tag)
+{
+  TaggedObject *theMaterial = theUniaxialMaterials->getComponentPtr(tag);
+  if (theMaterial == 0)
+    return 0;
+
+  return (UniaxialMaterial *)theMaterial;
+}
+
+int
+EmbeddedModelBuilder::addTruss(int tag, int iNode, int jNode, int matTag, double A)
+{
+  UniaxialMaterial *theMaterial = this->getUniaxialMaterial(matTag);
+  if (theMaterial == 0) {
+    opserr << "EmbeddedModelBuilder::addTruss() - no material " << matTag << endln;
+    return -1;
+  }
+
+  return this->addElement(new Truss(tag, ndm, iNode, jNode, *theMaterial, A));
+}
+
+int
+EmbeddedModelBuilder::addElasticBeam2d(int tag, int iNode, int jNode, double A, double E, double I)
+{
+  if (ndm != 2 || ndf != 3) {
+    opserr << "EmbeddedModelBuilder::addElasticBeam2d() - model is not ndm 2, ndf 3\n";
+    return -1;
+  }
+
+  // the element keeps a copy of the transformation
+  if (theTransf2d == 0)
+    theTransf2d = new LinearCrdTransf2d(0);
+
+  return this->addElement(new ElasticBeam2d(tag, A, E, I, iNode, jNode, *theTransf2d));
+}
+
+int
+EmbeddedModelBuilder::addElement(Element *theElement)
+{
+  if (this->getDomainPtr()->addElement(theElement) == false) {
+    opserr << "EmbeddedModelBuilder::addElement() - could not add element ";
+    opserr << theElement->getTag() << endln;
+    delete theElement;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::addLoadPattern(int tag, TimeSeries *theSeries)
+{
+  if (theSeries == 0)
+    theSeries = new LinearSeries();
+
+  LoadPattern *thePattern = new LoadPattern(tag);
+  thePattern->setTimeSeries(theSeries);
+
+  if (this->getDomainPtr()->addLoadPattern(thePattern) == false) {
+    opserr << "EmbeddedModelBuilder::addLoadPattern() - could not add pattern " << tag << endln;
+    delete thePattern;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::addNodalLoad(int nodeTag, const double *values, int patternTag)
+{
+  Vector theValues(ndf);
+  for (int i=0; i<ndf; i++)
+    theValues(i) = values[i];
+
+  NodalLoad *theLoad = new NodalLoad(numLoads++, nodeTag, theValues);
+  if (this->getDomainPtr()->addNodalLoad(theLoad, patternTag) == false) {
+    opserr << "EmbeddedModelBuilder::addNodalLoad() - could not add load at node ";
+    opserr << nodeTag << " to pattern " << patternTag << endln;
+    delete theLoad;
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::setLoadConstant(void)
+{
+  Domain *theDomain = this->getDomainPtr();
+  theDomain->setLoadConstant();
+  theDomain->setCurrentTime(0.0);
+  theDomain->setCommittedTime(0.0);
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::clearModel(void)
+{
+  // the analysis refers to the components of the model
+  this->clearAnalysis();
+
+  this->getDomainPtr()->clearAll();
+  theUniaxialMaterials->clearAll();
+  numLoads = 0;
+
+  return 0;
+}
+
+void
+EmbeddedModelBuilder::clearAnalysis(void)
+{
+  if (theStaticAnalysis != 0) {
+    theStaticAnalysis->clearAll();
+    delete theStaticAnalysis;
+  }
+  if (theTransientAnalysis != 0) {
+    theTransientAnalysis->clearAll();
+    delete theTransientAnalysis;
+  }
+
+  theStaticAnalysis = 0;
+  theTransientAnalysis = 0;
+  theAnalysisModel = 0;
+  theAlgorithm = 0;
+  theTransientIntegrator = 0;
+  eigenSOEset = false;
+}
+
+int
+EmbeddedModelBuilder::setStaticAnalysis(int numIncr, bool linear, double tol, int maxIter)
+{
+  if (numIncr < 1) {
+    opserr << "EmbeddedModelBuilder::setStaticAnalysis() - numIncr must be at least 1\n";
+    return -1;
+  }
+
+  this->clearAnalysis();
+
+  theAnalysisModel = new AnalysisModel();
+  ConstraintHandler *theHandler = new TransformationConstraintHandler();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*(new RCM(false)));
+  LinearSOE *theSOE = new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+  ConvergenceTest *theTest = new CTestNormDispIncr(tol, maxIter, 0);
+  if (linear == true)
+    theAlgorithm = new Linear();
+  else
+    theAlgorithm = new NewtonRaphson(*theTest);
+
+  double dLambda = 1.0/numIncr;
+  StaticIntegrator *theIntegrator = new LoadControl(dLambda, 1, dLambda, dLambda);
+
+  theStaticAnalysis = new StaticAnalysis(*(this->getDomainPtr()), *theHandler, *theNumberer,
+					 *theAnalysisModel, *theAlgorithm, *theSOE,
+					 *theIntegrator, theTest);
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::setTransientAnalysis(double gamma, double beta, bool linear,
+					   double tol, int maxIter)
+{
+  this->clearAnalysis();
+
+  theAnalysisModel = new AnalysisModel();
+  ConstraintHandler *theHandler = new TransformationConstraintHandler();
+  DOF_Numberer *theNumberer = new DOF_Numberer(*(new RCM(false)));
+  LinearSOE *theSOE = new ProfileSPDLinSOE(*(new ProfileSPDLinDirectSolver()));
+  ConvergenceTest *theTest = new CTestNormDispIncr(tol, maxIter, 0);
+  if (linear == true)
+    theAlgorithm = new Linear();
+  else
+    theAlgorithm = new NewtonRaphson(*theTest);
+
+  theTransientIntegrator = new Newmark(gamma, beta);
+
+  theTransientAnalysis = new DirectIntegrationAnalysis(*(this->getDomainPtr()), *theHandler, 
+						       *theNumberer, *theAnalysisModel,
+						       *theAlgorithm, *theSOE,
+						       *theTransientIntegrator, theTest);
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::analyze(int numSteps, double dT)
+{
+  if (theTransientAnalysis != 0) {
+    if (dT <= 0.0) {
+      opserr << "EmbeddedModelBuilder::analyze() - a transient analysis needs a dT > 0\n";
+      return -1;
+    }
+    return theTransientAnalysis->analyze(numSteps, dT);
+  }
+
+  if (theStaticAnalysis == 0)
+    this->setStaticAnalysis();
+
+  return theStaticAnalysis->analyze(numSteps);
+}
+
+int
+EmbeddedModelBuilder::eigen(int numModes, double *eigenvalues)
+{
+  if (theStaticAnalysis == 0 && theTransientAnalysis == 0)
+    this->setStaticAnalysis();
+
+  int result = 0;
+  if (theTransientAnalysis != 0) {
+    if (eigenSOEset == false)
+      theTransientAnalysis->setEigenSOE(*(new FullGenEigenSOE(*(new FullGenEigenSolver()), *theAnalysisModel)));
+    eigenSOEset = true;
+    result = theTransientAnalysis->eigen(numModes);
+  } else {
+    if (eigenSOEset == false)
+      theStaticAnalysis->setEigenSOE(*(new FullGenEigenSOE(*(new FullGenEigenSolver()), *theAnalysisModel)));
+    eigenSOEset = true;
+    result = theStaticAnalysis->eigen(numModes);
+  }
+
+  if (result < 0) {
+    opserr << "EmbeddedModelBuilder::eigen() - eigen analysis failed\n";
+    return result;
+  }
+
+  if (eigenvalues != 0) {
+    const Vector &theValues = this->getDomainPtr()->getEigenvalues();
+    for (int i=0; i<numModes && i<theValues.Size(); i++)
+      eigenvalues[i] = theValues(i);
+  }
+
+  return 0;
+}
+
+int
+EmbeddedModelBuilder::reset(void)
+{
+  this->getDomainPtr()->revertToStart();
+
+  if (theTransientIntegrator != 0)
+    theTransientIntegrator->revertToStart();
+
+  // the algorithm drops any tangent kept from before the reset
+  if (theAlgorithm != 0)
+    theAlgorithm->domainChanged();
+
+  return 0;
+}
+
+double
+EmbeddedModelBuilder::getTime(void)
+{
+  return this->getDomainPtr()->getCurrentTime();
+}
+
+int
+EmbeddedModelBuilder::getNodeResponse(int nodeTag, NodeResponseType type, double *values)
+{
+  const Vector *theResponse = this->getDomainPtr()->getNodeResponse(nodeTag, type);
+  if (theResponse == 0) {
+    opserr << "EmbeddedModelBuilder::getNodeResponse() - no response for node " << nodeTag << endln;
+    return -1;
+  }
+
+  int size = theResponse->Size();
+  for (int i=0; i<size; i++)
+    values[i] = (*theResponse)(i);
+
+  return size;
+}
+
+int
+EmbeddedModelBuilder::getNodeDisp(int nodeTag, double *values)
+{
+  return this->getNodeResponse(nodeTag, Disp, values);
+}
+
+int
+EmbeddedModelBuilder::getNodeEigenvector(int nodeTag, int mode, double *values)
+{
+  Node *theNode = this->getDomainPtr()->getNode(nodeTag);
+  if (theNode == 0) {
+    opserr << "EmbeddedModelBuilder::getNodeEigenvector() - no node " << nodeTag << endln;
+    return -1;
+  }
+
+  const Matrix &theEigenvectors = theNode->getEigenvectors();
+  if (mode < 1 || mode > theEigenvectors.noCols()) {
+    opserr << "EmbeddedModelBuilder::getNodeEigenvector() - no mode " << mode << " at node " << nodeTag << endln;
+    return -2;
+  }
+
+  int size = theEigenvectors.noRows();
+  for (int i=0; i<size; i++)
+    values[i] = theEigenvectors(i, mode-1);
+
+  return size;
+}
+
+int
+EmbeddedModelBuilder::calculateReactions(void)
+{
+  return this->getDomainPtr()->calculateNodalReactions(0);
+}
+
+int
+EmbeddedModelBuilder::getElementResponse(int eleTag, const char **argv, int argc,
+					 double *values, int maxSize)
+{
+  const Vector *theResponse = this->getDomainPtr()->getElementResponse(eleTag, argv, argc);
+  if (theResponse == 0) {
+    opserr << "EmbeddedModelBuilder::getElementResponse() - no response for element " << eleTag << endln;
+    return -1;
+  }
+
+  int size = theResponse->Size();
+  if (size > maxSize) {
+    opserr << "EmbeddedModelBuilder::getElementResponse() - response of element " << eleTag;
+    opserr << " has " << size << " values, more than " << maxSize << endln;
+    return -2;
+  }
+
+  for (int i=0; i<size; i++)
+    values[i] = (*theResponse)(i);
+
+  return size;
+}
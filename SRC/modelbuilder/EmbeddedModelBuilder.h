@@ -0,0 +1,135 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/modelbuilder/EmbeddedModelBuilder.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// EmbeddedModelBuilder. An EmbeddedModelBuilder lets a C++ program build a
+// model in a Domain, analyze it and read the results from memory, without
+// an interpreter and without formatting or parsing any commands. It is
+// meant for programs calling OpenSees many times on small models, linked
+// against the libOpenSees library.
+//
+// The nodes, constraints, materials, elements and loads are created by
+// the methods below; any other Element or component can be constructed by
+// the caller and added with addElement() or through the Domain. Static
+// analyses use LoadControl, transient analyses Newmark, both with a
+// Transformation handler, RCM numbering and a ProfileSPD system, and a
+// Linear or NewtonRaphson algorithm. The results are copied into arrays
+// given by the caller. All methods return 0 if successful and a negative
+// number otherwise.
+//
+// clearModel() removes the model and the analysis so that the next model
+// can be built in the same Domain; reset() reverts the model to its
+// start to be analyzed again, e.g. with other loads.
+
+// What: "@(#) EmbeddedModelBuilder.h, revA"
+
+#ifndef EmbeddedModelBuilder_h
+#define EmbeddedModelBuilder_h
+
+#include <ModelBuilder.h>
+#include <OPS_Globals.h>
+
+class Element;
+class UniaxialMaterial;
+class TimeSeries;
+class TaggedObjectStorage;
+class CrdTransf;
+class StaticAnalysis;
+class DirectIntegrationAnalysis;
+class AnalysisModel;
+class EquiSolnAlgo;
+class TransientIntegrator;
+
+class EmbeddedModelBuilder : public ModelBuilder
+{
+  public:
+    EmbeddedModelBuilder(Domain &theDomain, int ndm, int ndf);
+    ~EmbeddedModelBuilder();
+
+    // the model is built by the methods below, nothing is done here
+    int buildFE_Model(void);
+
+    int getNDM(void) const;
+    int getNDF(void) const;
+
+    // the model, crds of size ndm, fixity and values of size ndf
+    int addNode(int tag, const double *crds);
+    int setNodeMass(int nodeTag, const double *mass);
+    int fix(int nodeTag, const int *fixity);
+    int equalDOF(int retainedNode, int constrainedNode, const int *dofs, int numDOF);
+
+    // the materials are kept by the builder, the elements use copies
+    int addUniaxialMaterial(UniaxialMaterial *theMaterial);
+    UniaxialMaterial *getUniaxialMaterial(int tag);
+
+    int addTruss(int tag, int iNode, int jNode, int matTag, double A);
+    int addElasticBeam2d(int tag, int iNode, int jNode, double A, double E, double I);
+    int addElement(Element *theElement);
+
+    // a pattern with a LinearSeries if theSeries is 0
+    int addLoadPattern(int tag, TimeSeries *theSeries = 0);
+    int addNodalLoad(int nodeTag, const double *values, int patternTag);
+    int setLoadConstant(void);
+
+    int clearModel(void);
+
+    // the analysis
+    int setStaticAnalysis(int numIncr = 1, bool linear = false,
+			  double tol = 1.0e-8, int maxIter = 25);
+    int setTransientAnalysis(double gamma = 0.5, double beta = 0.25, bool linear = false,
+			     double tol = 1.0e-8, int maxIter = 25);
+    int analyze(int numSteps = 1, double dT = 0.0);
+    int eigen(int numModes, double *eigenvalues);
+    int reset(void);
+
+    // the results, the number of values copied is returned
+    double getTime(void);
+    int getNodeResponse(int nodeTag, NodeResponseType type, double *values);
+    int getNodeDisp(int nodeTag, double *values);
+    int getNodeEigenvector(int nodeTag, int mode, double *values);
+    int calculateReactions(void);
+    int getElementResponse(int eleTag, const char **argv, int argc,
+			   double *values, int maxSize);
+
+  protected:
+
+  private:
+    void clearAnalysis(void);
+
+    int ndm, ndf;
+    TaggedObjectStorage *theUniaxialMaterials;
+    CrdTransf *theTransf2d;
+    int numLoads;
+
+    StaticAnalysis *theStaticAnalysis;
+    DirectIntegrationAnalysis *theTransientAnalysis;
+    AnalysisModel *theAnalysisModel;
+    EquiSolnAlgo *theAlgorithm;
+    TransientIntegrator *theTransientIntegrator;
+    bool eigenSOEset;
+};
+
+#endif
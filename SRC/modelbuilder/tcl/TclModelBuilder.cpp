@@ -39,6 +39,8 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdio.h>
+#include <vector>
 
 #include <Matrix.h>
 #include <Vector.h>
@@ -110,6 +112,7 @@
 #endif
 #include <HystereticBackbone.h>
 #include <BeamIntegration.h>
+#include <SectionAnalysis.h>
 
 ////////////////////// gnp adding damping 
 #include <Element.h>
@@ -154,6 +157,18 @@ int
 TclCommand_addElement(ClientData clientData, Tcl_Interp *interp,  int argc, 
 		      TCL_Char **argv);
 
+int
+TclCommand_addNodes(ClientData clientData, Tcl_Interp *interp, int argc, 
+		    TCL_Char **argv);
+
+int
+TclCommand_addElements(ClientData clientData, Tcl_Interp *interp, int argc, 
+		       TCL_Char **argv);
+
+int
+TclCommand_addHomogeneousBCs(ClientData clientData, Tcl_Interp *interp, int argc, 
+			     TCL_Char **argv);
+
 int
 TclCommand_PFEM2D(ClientData clientData, Tcl_Interp *interp,  int argc, 
                   TCL_Char **argv);
@@ -389,6 +404,10 @@ TclCommand_addElementRayleigh(ClientData clientData,
 			      TCL_Char **argv);
 ///////////////////////////////////////////////////////////////
 
+int
+TclCommand_sectionAnalysis(ClientData clientData, Tcl_Interp *interp,
+			   int argc, TCL_Char **argv);
+
 
 
 // REMO
@@ -463,6 +482,15 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
   Tcl_CreateCommand(interp, "element", TclCommand_addElement,
 		    (ClientData)NULL, NULL);
 
+  Tcl_CreateCommand(interp, "nodes", TclCommand_addNodes,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateCommand(interp, "elements", TclCommand_addElements,
+		    (ClientData)NULL, NULL);
+
+  Tcl_CreateCommand(interp, "fixes", TclCommand_addHomogeneousBCs,
+		    (ClientData)NULL, NULL);
+
   Tcl_CreateCommand(interp, "PFEM2D", TclCommand_PFEM2D,
 		    (ClientData)NULL, NULL);
 
@@ -644,6 +672,9 @@ TclModelBuilder::TclModelBuilder(Domain &theDomain, Tcl_Interp *interp, int NDM,
 		    (ClientData)NULL, NULL);
   /////////////////////////////////////////////////////////////////////
 
+  Tcl_CreateCommand(interp, "sectionAnalysis", TclCommand_sectionAnalysis,
+		    (ClientData)NULL, NULL);
+
   // set the static pointers in this file
   theTclBuilder = this;
   theTclDomain = &theDomain;
@@ -712,6 +743,9 @@ TclModelBuilder::~TclModelBuilder()
   Tcl_DeleteCommand(theInterp, "updateParameter");
   Tcl_DeleteCommand(theInterp, "node");
   Tcl_DeleteCommand(theInterp, "element");
+  Tcl_DeleteCommand(theInterp, "nodes");
+  Tcl_DeleteCommand(theInterp, "elements");
+  Tcl_DeleteCommand(theInterp, "fixes");
   Tcl_DeleteCommand(theInterp, "PFEM2D");
   Tcl_DeleteCommand(theInterp, "PFEM3D");
   Tcl_DeleteCommand(theInterp, "mesh");
@@ -762,6 +796,7 @@ TclModelBuilder::~TclModelBuilder()
   Tcl_DeleteCommand(theInterp, "damageModel");
 
   Tcl_DeleteCommand(theInterp, "loadPackage");
+  Tcl_DeleteCommand(theInterp, "sectionAnalysis");
 }
 
 
@@ -1261,6 +1296,257 @@ TclCommand_addNode(ClientData clientData, Tcl_Interp *interp, int argc,
 
 
 
+//
+// the bulk commands nodes, elements & fixes take a table of numbers, one
+// row for each node, element or fixed node, from a file or a Tcl list:
+//   nodes ?-ndf ndf? -file fileName | {tag crds ...}
+//   elements eleType numNodes -file fileName | {tag nodes ...} ?-args eleArgs ...?
+//   fixes ?-ndf ndf? -file fileName | {nodeTag fixities ...}
+// the table is parsed once and the components added to the Domain together
+//
+
+// the numbers of the table, from the file after -file or the list at
+// argv[loc], with rows of rowSize
+static int
+getBulkTable(Tcl_Interp *interp, TCL_Char **argv, int argc, int &loc,
+	     int rowSize, const char *command, std::vector<double> &table)
+{
+  if (loc >= argc) {
+    opserr << "WARNING " << command << " - no table given\n";
+    return -1;
+  }
+
+  if (strcmp(argv[loc], "-file") == 0) {
+    if (loc+1 >= argc) {
+      opserr << "WARNING " << command << " -file - no file name given\n";
+      return -1;
+    }
+    FILE *theFile = fopen(argv[loc+1], "r");
+    if (theFile == 0) {
+      opserr << "WARNING " << command << " - could not open file " << argv[loc+1] << endln;
+      return -1;
+    }
+
+    // numbers separated by white space, lines starting with # skipped
+    char line[1024];
+    while (fgets(line, 1024, theFile) != 0) {
+      char *pos = line;
+      while (*pos == ' ' || *pos == '\t')
+	pos++;
+      if (*pos == '#')
+	continue;
+      char *end;
+      double value = strtod(pos, &end);
+      while (end != pos) {
+	table.push_back(value);
+	pos = end;
+	value = strtod(pos, &end);
+      }
+    }
+    fclose(theFile);
+    loc += 2;
+
+  } else {
+    int listArgc;
+    TCL_Char **listArgv;
+    if (Tcl_SplitList(interp, argv[loc], &listArgc, &listArgv) != TCL_OK) {
+      opserr << "WARNING " << command << " - table is not a list\n";
+      return -1;
+    }
+    table.reserve(listArgc);
+    for (int i=0; i<listArgc; i++) {
+      double value;
+      if (Tcl_GetDouble(interp, listArgv[i], &value) != TCL_OK) {
+	opserr << "WARNING " << command << " - invalid value " << listArgv[i] << endln;
+	Tcl_Free((char *)listArgv);
+	return -1;
+      }
+      table.push_back(value);
+    }
+    Tcl_Free((char *)listArgv);
+    loc++;
+  }
+
+  if (table.size() % rowSize != 0) {
+    opserr << "WARNING " << command << " - the table has " << (int)table.size();
+    opserr << " values, not a multiple of the " << rowSize << " in a row\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+TclCommand_addNodes(ClientData clientData, Tcl_Interp *interp, int argc, 
+		    TCL_Char **argv)
+{
+  // ensure the destructor has not been called - 
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  int ndm = theTclBuilder->getNDM();
+  int ndf = theTclBuilder->getNDF();
+
+  int loc = 1;
+  if (loc < argc && strcmp(argv[loc], "-ndf") == 0) {
+    if (loc+1 >= argc || Tcl_GetInt(interp, argv[loc+1], &ndf) != TCL_OK) {
+      opserr << "WARNING nodes - invalid ndf\n";
+      return TCL_ERROR;
+    }
+    loc += 2;
+  }
+
+  std::vector<double> table;
+  if (getBulkTable(interp, argv, argc, loc, 1+ndm, "nodes", table) < 0) {
+    opserr << "Want: nodes <-ndf ndf?> -file fileName? | {nodeTag? [ndm coordinates?] ...}\n";
+    return TCL_ERROR;
+  }
+
+  int numNodes = table.size()/(1+ndm);
+  Node **theNodes = new Node *[numNodes > 0 ? numNodes : 1];
+  for (int i=0; i<numNodes; i++) {
+    const double *row = &table[i*(1+ndm)];
+    int nodeId = (int)row[0];
+    if (ndm == 1)
+      theNodes[i] = new Node(nodeId, ndf, row[1]);
+    else if (ndm == 2)
+      theNodes[i] = new Node(nodeId, ndf, row[1], row[2]);
+    else
+      theNodes[i] = new Node(nodeId, ndf, row[1], row[2], row[3]);
+  }
+
+  int numAdded = theTclDomain->addNodes(theNodes, numNodes);
+  for (int i=numAdded; i<numNodes; i++)
+    delete theNodes[i];
+  delete [] theNodes;
+
+  if (numAdded < numNodes) {
+    opserr << "WARNING nodes - failed to add nodes to the domain, " << numAdded;
+    opserr << " of " << numNodes << " added\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
+extern int 
+TclModelBuilderElementCommand(ClientData clientData, 
+			      Tcl_Interp *interp, int argc,    
+			      TCL_Char **argv, 
+			      Domain *theDomain, TclModelBuilder *theTclBuilder);
+
+int
+TclCommand_addElements(ClientData clientData, Tcl_Interp *interp, int argc, 
+		       TCL_Char **argv)
+{
+  // ensure the destructor has not been called - 
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  int numEleNodes = 0;
+  if (argc < 4 || Tcl_GetInt(interp, argv[2], &numEleNodes) != TCL_OK || numEleNodes < 1) {
+    opserr << "WARNING elements - invalid numNodes\n";
+    opserr << "Want: elements eleType? numNodes? -file fileName? | {eleTag? nodeTags? ...} <-args eleArgs?>\n";
+    return TCL_ERROR;
+  }
+
+  int loc = 3;
+  std::vector<double> table;
+  if (getBulkTable(interp, argv, argc, loc, 1+numEleNodes, "elements", table) < 0) {
+    opserr << "Want: elements eleType? numNodes? -file fileName? | {eleTag? nodeTags? ...} <-args eleArgs?>\n";
+    return TCL_ERROR;
+  }
+
+  int numArgs = 0;
+  if (loc < argc && strcmp(argv[loc], "-args") == 0)
+    numArgs = argc-loc-1;
+
+  // each row becomes the arguments of the element command, given to the
+  // element parser directly instead of going through the interpreter
+  int eleArgc = 3+numEleNodes+numArgs;
+  TCL_Char **eleArgv = new TCL_Char *[eleArgc+1];
+  char *numbers = new char[(1+numEleNodes)*16];
+  eleArgv[0] = "element";
+  eleArgv[1] = argv[1];
+  for (int j=0; j<=numEleNodes; j++)
+    eleArgv[2+j] = &numbers[j*16];
+  for (int j=0; j<numArgs; j++)
+    eleArgv[3+numEleNodes+j] = argv[loc+1+j];
+  eleArgv[eleArgc] = 0;
+
+  int numElements = table.size()/(1+numEleNodes);
+  int result = TCL_OK;
+  for (int i=0; i<numElements && result == TCL_OK; i++) {
+    const double *row = &table[i*(1+numEleNodes)];
+    for (int j=0; j<=numEleNodes; j++)
+      sprintf(&numbers[j*16], "%d", (int)row[j]);
+    result = TclModelBuilderElementCommand(clientData, interp, eleArgc, eleArgv,
+					   theTclDomain, theTclBuilder);
+  }
+
+  delete [] numbers;
+  delete [] eleArgv;
+
+  return result;
+}
+
+int
+TclCommand_addHomogeneousBCs(ClientData clientData, Tcl_Interp *interp, int argc, 
+			     TCL_Char **argv)
+{
+  // ensure the destructor has not been called - 
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  int ndf = theTclBuilder->getNDF();
+
+  int loc = 1;
+  if (loc < argc && strcmp(argv[loc], "-ndf") == 0) {
+    if (loc+1 >= argc || Tcl_GetInt(interp, argv[loc+1], &ndf) != TCL_OK) {
+      opserr << "WARNING fixes - invalid ndf\n";
+      return TCL_ERROR;
+    }
+    loc += 2;
+  }
+
+  std::vector<double> table;
+  if (getBulkTable(interp, argv, argc, loc, 1+ndf, "fixes", table) < 0) {
+    opserr << "Want: fixes <-ndf ndf?> -file fileName? | {nodeTag? [ndf fixities?] ...}\n";
+    return TCL_ERROR;
+  }
+
+  int numFixed = table.size()/(1+ndf);
+  std::vector<SP_Constraint *> theSPs;
+  for (int i=0; i<numFixed; i++) {
+    const double *row = &table[i*(1+ndf)];
+    for (int j=0; j<ndf; j++)
+      if (row[1+j] != 0.0)
+	theSPs.push_back(new SP_Constraint((int)row[0], j, 0.0, true));
+  }
+
+  // as fix, a dof already constrained is skipped with a warning
+  int numSPs = theSPs.size();
+  int numAdded = 0;
+  while (numAdded < numSPs) {
+    numAdded += theTclDomain->addSP_Constraints(&theSPs[numAdded], numSPs-numAdded);
+    if (numAdded < numSPs) {
+      opserr << "WARNING could not add SP_Constraint to domain using fixes command - node may already be constrained\n";
+      delete theSPs[numAdded];
+      theSPs[numAdded] = 0;
+      numAdded++;
+    }
+  }
+
+  return TCL_OK;
+}
+
+
 /////////////////////////////   gnp adding element damping 
 int 
 TclCommand_addElementRayleigh(ClientData clientData, 
@@ -1332,6 +1618,156 @@ TclCommand_addElementRayleigh(ClientData clientData,
 /////////////////////////////   gnp adding element damping 
 
 
+// sectionAnalysis momentCurvature|interaction maxCurvature? numSteps?
+//   -section tag1? tag2? ... -P P1? P2? ... <-axis z|y> <-tol tol?> <-maxIter n?>
+// runs the analyses of all the sections under all the axial forces on the
+// threads set with the threads command; momentCurvature returns one list
+// {kappa M kappa M ...} for each section and P, interaction one list
+// {Mmax(P1) Mmax(P2) ...} for each section
+int
+TclCommand_sectionAnalysis(ClientData clientData, Tcl_Interp *interp,
+			   int argc, TCL_Char **argv)
+{
+  if (theTclBuilder == 0) {
+    opserr << "WARNING builder has been destroyed" << endln;
+    return TCL_ERROR;
+  }
+
+  if (argc < 8) {
+    opserr << "WARNING insufficient arguments\n";
+    printCommand(argc, argv);
+    opserr << "Want: sectionAnalysis momentCurvature|interaction maxCurvature? numSteps? -section tags? -P values? <-axis z|y> <-tol tol?> <-maxIter n?>\n";
+    return TCL_ERROR;
+  }
+
+  bool interaction = false;
+  if (strcmp(argv[1],"interaction") == 0 || strcmp(argv[1],"PM") == 0)
+    interaction = true;
+  else if (strcmp(argv[1],"momentCurvature") != 0) {
+    opserr << "WARNING sectionAnalysis - unknown analysis " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+
+  double maxCurvature;
+  int numSteps;
+  if (Tcl_GetDouble(interp, argv[2], &maxCurvature) != TCL_OK) {
+    opserr << "WARNING sectionAnalysis - invalid maxCurvature " << argv[2] << endln;
+    return TCL_ERROR;
+  }
+  if (Tcl_GetInt(interp, argv[3], &numSteps) != TCL_OK || numSteps < 1) {
+    opserr << "WARNING sectionAnalysis - invalid numSteps " << argv[3] << endln;
+    return TCL_ERROR;
+  }
+
+  int axis = SECTION_RESPONSE_MZ;
+  double tol = 1.0e-12;
+  int maxIter = 25;
+  ID sectionTags(0, 8);
+  int numSections = 0;
+  Vector P(argc);
+  int numP = 0;
+
+  int loc = 4;
+  while (loc < argc) {
+    if (strcmp(argv[loc],"-section") == 0 || strcmp(argv[loc],"-sections") == 0) {
+      loc++;
+      int tag;
+      while (loc < argc && Tcl_GetInt(interp, argv[loc], &tag) == TCL_OK) {
+	sectionTags[numSections++] = tag;
+	loc++;
+      }
+    }
+    else if (strcmp(argv[loc],"-P") == 0) {
+      loc++;
+      double value;
+      while (loc < argc && Tcl_GetDouble(interp, argv[loc], &value) == TCL_OK) {
+	P(numP++) = value;
+	loc++;
+      }
+    }
+    else if (strcmp(argv[loc],"-axis") == 0 && loc+1 < argc) {
+      if (strcmp(argv[loc+1],"y") == 0 || strcmp(argv[loc+1],"Y") == 0)
+	axis = SECTION_RESPONSE_MY;
+      loc += 2;
+    }
+    else if (strcmp(argv[loc],"-tol") == 0 && loc+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &tol) != TCL_OK) {
+	opserr << "WARNING sectionAnalysis - invalid tol " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      loc += 2;
+    }
+    else if (strcmp(argv[loc],"-maxIter") == 0 && loc+1 < argc) {
+      if (Tcl_GetInt(interp, argv[loc+1], &maxIter) != TCL_OK) {
+	opserr << "WARNING sectionAnalysis - invalid maxIter " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      loc += 2;
+    }
+    else {
+      opserr << "WARNING sectionAnalysis - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  // the failed reads at the end of the -section and -P lists left a message
+  Tcl_ResetResult(interp);
+
+  if (numSections == 0 || numP == 0) {
+    opserr << "WARNING sectionAnalysis - want at least one -section tag and one -P value\n";
+    return TCL_ERROR;
+  }
+
+  SectionForceDeformation **theSections = new SectionForceDeformation *[numSections];
+  for (int i = 0; i < numSections; i++) {
+    theSections[i] = theTclBuilder->getSection(sectionTags(i));
+    if (theSections[i] == 0) {
+      opserr << "WARNING sectionAnalysis - no section with tag " << sectionTags(i) << endln;
+      delete [] theSections;
+      return TCL_ERROR;
+    }
+  }
+
+  Vector theP(&P(0), numP);
+  SectionAnalysis theAnalysis(maxCurvature, numSteps, axis, tol, maxIter);
+
+  char buffer[80];
+  int res;
+  if (interaction) {
+    Matrix Mmax;
+    res = theAnalysis.interaction(theSections, numSections, theP, Mmax);
+    for (int i = 0; i < numSections && res == 0; i++) {
+      Tcl_AppendResult(interp, "{", NULL);
+      for (int j = 0; j < numP; j++) {
+	sprintf(buffer, "%.10e ", Mmax(i,j));
+	Tcl_AppendResult(interp, buffer, NULL);
+      }
+      Tcl_AppendResult(interp, "} ", NULL);
+    }
+  } else {
+    Matrix kappa, M;
+    ID numPoints;
+    res = theAnalysis.momentCurvature(theSections, numSections, theP, kappa, M, numPoints);
+    for (int i = 0; i < numSections*numP && res == 0; i++) {
+      Tcl_AppendResult(interp, "{", NULL);
+      for (int j = 0; j < numPoints(i); j++) {
+	sprintf(buffer, "%.10e %.10e ", kappa(i,j), M(i,j));
+	Tcl_AppendResult(interp, buffer, NULL);
+      }
+      Tcl_AppendResult(interp, "} ", NULL);
+    }
+  }
+
+  delete [] theSections;
+
+  if (res < 0) {
+    opserr << "WARNING sectionAnalysis - failed to analyse the sections\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
 // the function for creating ne material objects and patterns is in a seperate file.
 // this allows new material and patternobjects to be added without touching this file.
 // does so at the expense of an extra procedure call.
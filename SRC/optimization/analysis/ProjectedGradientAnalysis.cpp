@@ -0,0 +1,361 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+**   Optimization module developed by:                                **
+**   Quan Gu  (qgu@ucsd.edu)                                          **
+**   Joel Conte (jpconte@ucsd.edu)                                    **
+**   Philip Gill (pgill@ucsd.edu)                                     **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/optimization/analysis/ProjectedGradientAnalysis.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for
+// ProjectedGradientAnalysis.
+//
+// What: "@(#) ProjectedGradientAnalysis.cpp, revA"
+
+#include <ProjectedGradientAnalysis.h>
+#include <DesignVariable.h>
+#include <ObjectiveFunction.h>
+#include <ConstraintFunction.h>
+#include <Matrix.h>
+#include <Domain.h>
+#include <StaticAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
+#include <EquiSolnAlgo.h>
+#include <TransientIntegrator.h>
+#include <OPS_Globals.h>
+
+#include <fstream>
+#include <string.h>
+using std::ofstream;
+using std::ios;
+
+// sufficient decrease and maximum number of halvings of the line search
+static const double armijoFactor = 1.0e-4;
+static const int maxNumberOfHalvings = 30;
+
+
+ProjectedGradientAnalysis::ProjectedGradientAnalysis(OptimizationDomain *passedOptimizationDomain,
+						     Domain *passedStructuralDomain,
+						     StaticAnalysis *theAnalysis, int nSteps,
+						     int passedMaxNumberOfIterations, double passedTolerance,
+						     double passedPenalty, const char *passedFileNamePrint)
+:theOptimizationDomain(passedOptimizationDomain), theStructuralDomain(passedStructuralDomain),
+ theStaticAnalysis(theAnalysis), theTransientAnalysis(0),
+ theObjectiveFunction(0), theConstraintFunction(0),
+ numSteps(nSteps), dt(0.0), maxNumberOfIterations(passedMaxNumberOfIterations),
+ tolerance(passedTolerance), penalty(passedPenalty), n(0),
+ numberOfSteps(0), numberOfEvaluations(0)
+{
+	strcpy(fileNamePrint, "");
+	if (passedFileNamePrint != 0)
+		strncpy(fileNamePrint, passedFileNamePrint, 255);
+	fileNamePrint[255] = '\0';
+}
+
+
+ProjectedGradientAnalysis::ProjectedGradientAnalysis(OptimizationDomain *passedOptimizationDomain,
+						     Domain *passedStructuralDomain,
+						     DirectIntegrationAnalysis *theAnalysis, int nSteps, double passedDt,
+						     int passedMaxNumberOfIterations, double passedTolerance,
+						     double passedPenalty, const char *passedFileNamePrint)
+:theOptimizationDomain(passedOptimizationDomain), theStructuralDomain(passedStructuralDomain),
+ theStaticAnalysis(0), theTransientAnalysis(theAnalysis),
+ theObjectiveFunction(0), theConstraintFunction(0),
+ numSteps(nSteps), dt(passedDt), maxNumberOfIterations(passedMaxNumberOfIterations),
+ tolerance(passedTolerance), penalty(passedPenalty), n(0),
+ numberOfSteps(0), numberOfEvaluations(0)
+{
+	strcpy(fileNamePrint, "");
+	if (passedFileNamePrint != 0)
+		strncpy(fileNamePrint, passedFileNamePrint, 255);
+	fileNamePrint[255] = '\0';
+}
+
+
+ProjectedGradientAnalysis::~ProjectedGradientAnalysis()
+{
+
+}
+
+
+int
+ProjectedGradientAnalysis::initialize(void)
+{
+	theObjectiveFunction = theOptimizationDomain->getObjectiveFunctionPtr(1);
+	theConstraintFunction = theOptimizationDomain->getConstraintFunctionPtr(1);
+
+	if (theObjectiveFunction == 0) {
+		opserr << "ProjectedGradientAnalysis::initialize() - no objective function with tag 1" << endln;
+		return -1;
+	}
+	if (!theObjectiveFunction->isGradientProvided() ||
+	    (theConstraintFunction != 0 && !theConstraintFunction->isGradientProvided())) {
+		opserr << "ProjectedGradientAnalysis::initialize() - the gradients of the objective "
+		       << "and constraint functions must be provided" << endln;
+		return -1;
+	}
+
+	n = theOptimizationDomain->getNumberOfDesignVariables();
+	if (n < 1) {
+		opserr << "ProjectedGradientAnalysis::initialize() - no design variables" << endln;
+		return -1;
+	}
+
+	// the design variables are scaled as in SNOPTAnalysis, x/x_0
+	scales.resize(n);
+	xlow.resize(n);
+	xupp.resize(n);
+	x.resize(n);
+	unScaledX.resize(n);
+
+	for (int i=0; i<n; i++) {
+		DesignVariable *theDesignVariable = theOptimizationDomain->getDesignVariablePtr(i+1);
+		if (theDesignVariable == 0) {
+			opserr << "ProjectedGradientAnalysis::initialize() - design variable "
+			       << i+1 << " not found" << endln;
+			return -1;
+		}
+		scales(i) = theDesignVariable->getScale();
+		x(i)      = theDesignVariable->getValue() / scales(i);
+		xlow(i)   = theDesignVariable->getLowerBound() / scales(i);
+		xupp(i)   = theDesignVariable->getUpperBound() / scales(i);
+	}
+
+	this->project(x);
+
+	return 0;
+}
+
+
+void
+ProjectedGradientAnalysis::project(Vector &scaledX)
+{
+	for (int i=0; i<n; i++) {
+		if (scaledX(i) < xlow(i))
+			scaledX(i) = xlow(i);
+		else if (scaledX(i) > xupp(i))
+			scaledX(i) = xupp(i);
+	}
+}
+
+
+int
+ProjectedGradientAnalysis::runAnalysis(void)
+{
+	// the analysis keeps its numberer and system of equations, only the
+	// state of the Domain goes back to the start
+	if (theStructuralDomain->revertToStart() != 0) {
+		opserr << "ProjectedGradientAnalysis::runAnalysis() - error in resetting Domain" << endln;
+		return -1;
+	}
+
+	int result = 0;
+	if (theStaticAnalysis != 0) {
+		EquiSolnAlgo *theAlgorithm = theStaticAnalysis->getAlgorithm();
+		if (theAlgorithm != 0)
+			theAlgorithm->domainChanged();
+		result = theStaticAnalysis->analyze(numSteps);
+
+	} else if (theTransientAnalysis != 0) {
+		TransientIntegrator *theIntegrator = theTransientAnalysis->getIntegrator();
+		if (theIntegrator != 0)
+			theIntegrator->revertToStart();
+		EquiSolnAlgo *theAlgorithm = theTransientAnalysis->getAlgorithm();
+		if (theAlgorithm != 0)
+			theAlgorithm->domainChanged();
+		result = theTransientAnalysis->analyze(numSteps, dt);
+	}
+
+	if (result < 0) {
+		opserr << "ProjectedGradientAnalysis::runAnalysis() - analysis failed" << endln;
+		return -1;
+	}
+
+	return 0;
+}
+
+
+int
+ProjectedGradientAnalysis::evaluate(const Vector &scaledX, double &merit, Vector *gradient)
+{
+	// 1. --- set the design, through the Parameters of the positioners
+	for (int i=0; i<n; i++) {
+		DesignVariable *theDesignVariable = theOptimizationDomain->getDesignVariablePtr(i+1);
+		theDesignVariable->update(scaledX(i)*scales(i));
+	}
+
+	// 2. --- response and DDM sensitivities of the model already built
+	if (theStaticAnalysis != 0 || theTransientAnalysis != 0)
+		if (this->runAnalysis() < 0)
+			return -1;
+
+	numberOfEvaluations++;
+
+	// 3. --- objective and constraints, the constraints in a quadratic penalty
+	theObjectiveFunction->update();
+	if (theConstraintFunction != 0)
+		theConstraintFunction->update();
+
+	merit = theObjectiveFunction->getValue();
+	Vector *objGradient = theObjectiveFunction->getGradientPtr();
+	for (int i=0; i<n; i++)
+		(*gradient)(i) = (*objGradient)(i)*scales(i);   // du/dSita, instead of du/dx
+
+	if (theConstraintFunction != 0) {
+		int numCons = theConstraintFunction->getNumOfConstraintFunctions();
+		Vector *values = theConstraintFunction->getValuePtr();
+		Vector *lowerBound = theConstraintFunction->getLowerBoundPtr();
+		Vector *upperBound = theConstraintFunction->getUpperBoundPtr();
+		Matrix *conGradient = theConstraintFunction->getGradientPtr();
+
+		for (int j=0; j<numCons; j++) {
+			double c = (*values)(j);
+			double violation = 0.0;
+			if (upperBound != 0 && c > (*upperBound)(j))
+				violation = c - (*upperBound)(j);
+			else if (lowerBound != 0 && c < (*lowerBound)(j))
+				violation = c - (*lowerBound)(j);
+
+			if (violation != 0.0) {
+				merit += penalty*violation*violation;
+				for (int k=0; k<n; k++)
+					(*gradient)(k) += 2.0*penalty*violation*(*conGradient)(j,k)*scales(k);
+			}
+		}
+	}
+
+	return 0;
+}
+
+
+int
+ProjectedGradientAnalysis::runOptAnalysis(void)
+{
+	opserr << "ProjectedGradientAnalysis is running ... " << endln;
+
+	if (this->initialize() < 0)
+		return -1;
+
+	Vector g(n), gTrial(n), xTrial(n), step(n);
+	double merit, meritTrial;
+
+	if (this->evaluate(x, merit, &g) < 0) {
+		opserr << "ProjectedGradientAnalysis::runOptAnalysis() - failed at the initial design" << endln;
+		return -1;
+	}
+
+	double alpha = 1.0;
+	bool atCurrent = true;     // the model holds the response of x
+	int result = 1;           // not converged
+
+	for (numberOfSteps=0; numberOfSteps<maxNumberOfIterations; numberOfSteps++) {
+
+		// ---- stationarity measure, the projected steepest descent step
+		xTrial = x;
+		xTrial.addVector(1.0, g, -1.0);
+		this->project(xTrial);
+		xTrial.addVector(1.0, x, -1.0);
+		double stationarity = xTrial.Norm();
+
+		opserr << "ProjectedGradientAnalysis -- iteration " << numberOfSteps
+		       << ", merit function " << merit << ", stationarity " << stationarity << endln;
+
+		if (stationarity < tolerance) {
+			result = 0;
+			break;
+		}
+
+		// ---- Armijo backtracking along the projected path
+		bool accepted = false;
+		for (int k=0; k<maxNumberOfHalvings; k++) {
+			xTrial = x;
+			xTrial.addVector(1.0, g, -alpha);
+			this->project(xTrial);
+
+			step = xTrial;
+			step.addVector(1.0, x, -1.0);
+
+			atCurrent = false;
+			if (this->evaluate(xTrial, meritTrial, &gTrial) == 0 &&
+			    meritTrial <= merit + armijoFactor*(g^step)) {
+				accepted = true;
+				break;
+			}
+			alpha *= 0.5;
+		}
+
+		if (accepted == false) {
+			opserr << "ProjectedGradientAnalysis::runOptAnalysis() - line search failed" << endln;
+			break;
+		}
+
+		x = xTrial;
+		g = gTrial;
+		merit = meritTrial;
+		atCurrent = true;
+		alpha *= 2.0;
+	}
+
+	if (numberOfSteps == maxNumberOfIterations)
+		opserr << "ProjectedGradientAnalysis::runOptAnalysis() - maximum number of iterations reached" << endln;
+
+	// leave the model at the last accepted design
+	if (atCurrent == false)
+		this->evaluate(x, merit, &g);
+
+	if (strcmp(fileNamePrint, "") != 0) {
+		ofstream outputFile(fileNamePrint, ios::out);
+		outputFile.setf(ios::scientific, ios::floatfield);
+		outputFile << "The Minimum point X is found as followings:" << endln;
+		for (int i=0; i<n; i++)
+			outputFile << x(i)*scales(i) << endln;  //scale back
+		outputFile.close();
+	}
+
+	return result;
+}
+
+
+const Vector &
+ProjectedGradientAnalysis::getUnScaledX(void)
+{
+	for (int i=0; i<n; i++)
+		unScaledX(i) = x(i)*scales(i);
+
+	return unScaledX;
+}
+
+
+int
+ProjectedGradientAnalysis::getNumberOfSteps(void)
+{
+	return numberOfSteps;
+}
+
+
+int
+ProjectedGradientAnalysis::getNumberOfEvaluations(void)
+{
+	return numberOfEvaluations;
+}
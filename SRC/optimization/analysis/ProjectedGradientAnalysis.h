@@ -0,0 +1,111 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+**   Optimization module developed by:                                **
+**   Quan Gu  (qgu@ucsd.edu)                                          **
+**   Joel Conte (jpconte@ucsd.edu)                                    **
+**   Philip Gill (pgill@ucsd.edu)                                     **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/optimization/analysis/ProjectedGradientAnalysis.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// ProjectedGradientAnalysis, a gradient based optimization driver that
+// works on the model already built in the Domain. The Domain, the
+// analysis and with them the numbering and the structure of the system
+// of equations are kept over all the design iterations: a new design
+// is set through the Parameters of the design variable positioners, the
+// Domain is reverted to its start and the given static or transient
+// analysis is run again, the sensitivity integrator computing the DDM
+// gradients along the way. The design variables are bounded, the
+// constraint functions enter through a quadratic penalty, and the step
+// is a projected steepest descent step with an Armijo backtracking line
+// search. The objective and constraint functions are evaluated as for
+// SNOPTAnalysis, with their gradients required.
+//
+// What: "@(#) ProjectedGradientAnalysis.h, revA"
+
+#ifndef ProjectedGradientAnalysis_h
+#define ProjectedGradientAnalysis_h
+
+#include <OptimizationDomain.h>
+#include <Vector.h>
+
+class Domain;
+class StaticAnalysis;
+class DirectIntegrationAnalysis;
+class ObjectiveFunction;
+class ConstraintFunction;
+
+class ProjectedGradientAnalysis
+{
+public:
+	ProjectedGradientAnalysis(OptimizationDomain *passedOptimizationDomain,
+				  Domain *passedStructuralDomain,
+				  StaticAnalysis *theAnalysis, int numSteps,
+				  int maxNumberOfIterations, double tolerance,
+				  double penalty, const char *fileNamePrint);
+	ProjectedGradientAnalysis(OptimizationDomain *passedOptimizationDomain,
+				  Domain *passedStructuralDomain,
+				  DirectIntegrationAnalysis *theAnalysis, int numSteps, double dt,
+				  int maxNumberOfIterations, double tolerance,
+				  double penalty, const char *fileNamePrint);
+	~ProjectedGradientAnalysis();
+
+	int runOptAnalysis(void);
+
+	const Vector &getUnScaledX(void);
+	int getNumberOfSteps(void);
+	int getNumberOfEvaluations(void);
+
+private:
+	int initialize(void);
+	int evaluate(const Vector &scaledX, double &merit, Vector *gradient);
+	int runAnalysis(void);
+	void project(Vector &scaledX);
+
+	OptimizationDomain *theOptimizationDomain;
+	Domain *theStructuralDomain;
+	StaticAnalysis *theStaticAnalysis;
+	DirectIntegrationAnalysis *theTransientAnalysis;
+	ObjectiveFunction *theObjectiveFunction;
+	ConstraintFunction *theConstraintFunction;
+
+	int numSteps;
+	double dt;
+	int maxNumberOfIterations;
+	double tolerance;
+	double penalty;
+	char fileNamePrint[256];
+
+	int n;
+	Vector scales;
+	Vector xlow;
+	Vector xupp;
+	Vector x;
+	Vector unScaledX;
+
+	int numberOfSteps;
+	int numberOfEvaluations;
+};
+
+#endif
@@ -60,6 +60,9 @@ using std::setiosflags;
 #include <DesignVariablePositioner.h>
 #include <ConstraintFunction.h>
 #include <ObjectiveFunction.h>
+#include <ProjectedGradientAnalysis.h>
+#include <StaticAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
 
 #ifdef _HAVESNOPT
 SNOPTAnalysis * theSNOPTAnalysis=0;
@@ -68,12 +71,17 @@ SNOPTAnalysis * theSNOPTAnalysis=0;
 static Domain *theStructuralDomain = 0;
 OptimizationDomain *theOptimizationDomain = 0;
 
+// the analysis of the model, for the projected gradient analysis
+extern StaticAnalysis *theStaticAnalysis;
+extern DirectIntegrationAnalysis *theTransientAnalysis;
+
  
 int TclOptimizationModelBuilder_addDesignVariable(ClientData clientData,Tcl_Interp *interp,int argc,TCL_Char **argv);
 int TclOptimizationModelBuilder_addDesignVariablePositioner(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int TclOptimizationModelBuilder_addObjectiveFunction(ClientData clientData,Tcl_Interp *interp,int argc,TCL_Char **argv);
 int TclOptimizationModelBuilder_addConstraintFunction(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int TclOptimizationModelBuilder_runSNOPTAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+int TclOptimizationModelBuilder_runProjectedGradientAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
 
  
@@ -94,6 +102,7 @@ TclOptimizationBuilder::TclOptimizationBuilder( Domain &passedSructuralDomain, T
    Tcl_CreateCommand(interp, "constraintFunction", (Tcl_CmdProc *)TclOptimizationModelBuilder_addConstraintFunction,(ClientData)NULL, NULL);
    Tcl_CreateCommand(interp, "objectiveFunction", (Tcl_CmdProc *)TclOptimizationModelBuilder_addObjectiveFunction,(ClientData)NULL, NULL);
    Tcl_CreateCommand(interp, "runSNOPTAnalysis", (Tcl_CmdProc *)TclOptimizationModelBuilder_runSNOPTAnalysis,(ClientData)NULL, NULL); 
+   Tcl_CreateCommand(interp, "runProjectedGradientAnalysis", (Tcl_CmdProc *)TclOptimizationModelBuilder_runProjectedGradientAnalysis,(ClientData)NULL, NULL); 
  
  
   
@@ -122,6 +131,7 @@ TclOptimizationBuilder::~TclOptimizationBuilder()
   Tcl_DeleteCommand(theInterp, "constraintFunction");
   Tcl_DeleteCommand(theInterp, "objectiveFunction");
   Tcl_DeleteCommand(theInterp, "runSNOPTAnalysis");
+  Tcl_DeleteCommand(theInterp, "runProjectedGradientAnalysis");
   
 
 
@@ -1059,4 +1069,98 @@ TclOptimizationModelBuilder_runSNOPTAnalysis(ClientData clientData,Tcl_Interp *i
 }
 
 
- 	
\ No newline at end of file
+ 	
+
+
+
+// command: runProjectedGradientAnalysis -numSteps 10 <-dt 0.01> -maxNumIter 100 -tol 1.0e-6 -penalty 1.0e3 -printOptPointX OptX.out
+// the model, its analysis and sensitivity algorithm are defined before, and
+// are reused for every design
+int 
+TclOptimizationModelBuilder_runProjectedGradientAnalysis(ClientData clientData,Tcl_Interp *interp,int argc,TCL_Char **argv)
+{
+	int maxNumberOfIterations = 100;
+	int numSteps = 1;
+	double dt = 0.0;
+	double tolerance = 1.0e-6;
+	double penalty = 1.0e3;
+	const char *fileNamePrint = 0;
+
+	int argvCounter = 1;
+	while (argc > argvCounter) {
+		if ((strcmp(argv[argvCounter],"-maxNumIter") == 0)||(strcmp(argv[argvCounter],"-maxnumiter") == 0)) {
+			if (argc < argvCounter+2 || Tcl_GetInt(interp, argv[argvCounter+1], &maxNumberOfIterations) != TCL_OK) {
+				opserr << "ERROR: invalid input: maxNumberOfIterations \n";
+				return TCL_ERROR;
+			}
+			argvCounter += 2;
+		}
+		else if (strcmp(argv[argvCounter],"-numSteps") == 0) {
+			if (argc < argvCounter+2 || Tcl_GetInt(interp, argv[argvCounter+1], &numSteps) != TCL_OK) {
+				opserr << "ERROR: invalid input: numSteps \n";
+				return TCL_ERROR;
+			}
+			argvCounter += 2;
+		}
+		else if (strcmp(argv[argvCounter],"-dt") == 0) {
+			if (argc < argvCounter+2 || Tcl_GetDouble(interp, argv[argvCounter+1], &dt) != TCL_OK) {
+				opserr << "ERROR: invalid input: dt \n";
+				return TCL_ERROR;
+			}
+			argvCounter += 2;
+		}
+		else if (strcmp(argv[argvCounter],"-tol") == 0) {
+			if (argc < argvCounter+2 || Tcl_GetDouble(interp, argv[argvCounter+1], &tolerance) != TCL_OK) {
+				opserr << "ERROR: invalid input: tol \n";
+				return TCL_ERROR;
+			}
+			argvCounter += 2;
+		}
+		else if (strcmp(argv[argvCounter],"-penalty") == 0) {
+			if (argc < argvCounter+2 || Tcl_GetDouble(interp, argv[argvCounter+1], &penalty) != TCL_OK) {
+				opserr << "ERROR: invalid input: penalty \n";
+				return TCL_ERROR;
+			}
+			argvCounter += 2;
+		}
+		else if ((strcmp(argv[argvCounter],"-printOptPointX") == 0)||(strcmp(argv[argvCounter],"-printoptpointx") == 0)) {
+			if (argc < argvCounter+2) {
+				opserr << "ERROR: invalid input: printOptPointX \n";
+				return TCL_ERROR;
+			}
+			fileNamePrint = argv[argvCounter+1];
+			argvCounter += 2;
+		}
+		else {
+			opserr<<"warning: unknown command: "<<argv[argvCounter]<<endln;
+			argvCounter++;
+		}
+	}
+
+	ProjectedGradientAnalysis *theAnalysis = 0;
+	if (theStaticAnalysis != 0)
+		theAnalysis = new ProjectedGradientAnalysis(theOptimizationDomain, theStructuralDomain,
+							    theStaticAnalysis, numSteps,
+							    maxNumberOfIterations, tolerance, penalty, fileNamePrint);
+	else if (theTransientAnalysis != 0) {
+		if (dt <= 0.0) {
+			opserr << "ERROR: runProjectedGradientAnalysis - a transient analysis needs -dt" << endln;
+			return TCL_ERROR;
+		}
+		theAnalysis = new ProjectedGradientAnalysis(theOptimizationDomain, theStructuralDomain,
+							    theTransientAnalysis, numSteps, dt,
+							    maxNumberOfIterations, tolerance, penalty, fileNamePrint);
+	}
+	else {
+		opserr << "ERROR: runProjectedGradientAnalysis - no analysis has been defined" << endln;
+		return TCL_ERROR;
+	}
+
+	int result = theAnalysis->runOptAnalysis();
+	delete theAnalysis;
+
+	if (result < 0)
+		return TCL_ERROR;
+
+	return TCL_OK;
+}
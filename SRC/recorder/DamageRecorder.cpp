@@ -187,49 +187,55 @@ int
 DamageRecorder::record(int commitTag, double timeStamp)
 {
   int result = 0;
+
+  // the damage models are advanced at every commit, as the damage of the
+  // cumulative models depends on the whole history; deltaT only sets how
+  // often the damage indices are written
+  static Vector DamageInformation(3);
+  double maxDamage = 0.0;
+
+  // get the responses and update the damage models
+  for (int i=0; i< numSec; i++) {
+    DamageInformation.Zero();
+    for ( int j=0 ; j<2 ; j++) {
+      if ( theResponses[i+numSec*j] == 0) {
+	DamageInformation(j) = 0.0;
+      } else {
+	if ( theResponses[i+numSec*j]->getResponse() < 0) {
+	  DamageInformation(j) = 0.0;
+	} else {
+	  // ask the element for the reponse
+	  Information &eleinfo = theResponses[i+numSec*j]->getInformation();
+	  const Vector &infovector = eleinfo.getData();
+	  DamageInformation(j) = infovector(dofID);
+	}
+      }
+    }
+    DamageInformation(2) = 0.0;
+    theDamageModels[i]->setTrial(DamageInformation);
+    theDamageModels[i]->commitState();
+    double Damageindex = theDamageModels[i]->getDamage();
+    if (Damageindex > maxDamage)
+      maxDamage = Damageindex;
+
+    (*data)(i + (echoTimeFlag == true ? 1 : 0)) = Damageindex;
+  }
+
+  // report to the domain damage state
+  theDomain->updateDamageIndex(maxDamage);
+
   if (deltaT == 0.0 || timeStamp >= nextTimeStampToRecord) {
     
     if (deltaT != 0.0) 
       nextTimeStampToRecord = timeStamp + deltaT;
     
     // print out the pseudo time if requested
-    int counter = 0;
     if (echoTimeFlag == true) {
-      (*data)(counter++) = timeStamp;
+      (*data)(0) = timeStamp;
     }
-    
-    Vector DamageInformation(3);
-    // get the responses and write to file if file or opserr specified
-    // for each element do a getResponse() & print the result
-    for (int i=0; i< numSec; i++) {
-      DamageInformation.Zero();
-      for ( int j=0 ; j<2 ; j++) {
-	if ( theResponses[i+numSec*j] == 0) {
-	  DamageInformation(j) = 0.0;
-	} else {
-	  if ( theResponses[i+numSec*j]->getResponse() < 0) {
-	    DamageInformation(j) = 0.0;
-	  } else {
-	    // ask the element for the reponse
-	    Information &eleinfo = theResponses[i+numSec*j]->getInformation();
-	    const Vector &infovector = eleinfo.getData();
-	    DamageInformation(j) = infovector(dofID);
-	  }
-	}
-      }
-      DamageInformation(2) = 0.0;
-      theDamageModels[i]->setTrial(DamageInformation);
-      theDamageModels[i]->commitState();
-      double Damageindex = theDamageModels[i]->getDamage();
-      
-      // print results to file or stderr depending on whether
-      // a file was opened
-
-      (*data)(counter++) = Damageindex;      
-    }
-  }
 
-  theOutput->write(*data);
+    theOutput->write(*data);
+  }
 
   // succesfull completion - return 0
   return result;
@@ -245,6 +251,12 @@ DamageRecorder::playback(int commitTag)
 int
 DamageRecorder::restart(void)
 {
+  // the domain is back at its start, and so are the damage models
+  for (int i=0; i<numSec; i++)
+    theDamageModels[i]->revertToStart();
+
+  nextTimeStampToRecord = 0.0;
+
   return 0;
 }
 
@@ -39,9 +39,12 @@
 #include <Domain.h>
 #include <FE_Datastore.h>
 
-DatastoreRecorder::DatastoreRecorder(FE_Datastore &theDb)
-:Recorder(RECORDER_TAGS_DatastoreRecorder), theDatastore(&theDb)
+DatastoreRecorder::DatastoreRecorder(FE_Datastore &theDb, int nCommits)
+:Recorder(RECORDER_TAGS_DatastoreRecorder), theDatastore(&theDb),
+ numCommits(nCommits), numSinceCommit(0)
 {
+    if (numCommits < 1)
+      numCommits = 1;
     
 }
 
@@ -55,6 +58,11 @@ DatastoreRecorder::~DatastoreRecorder()
 int 
 DatastoreRecorder::record(int commitTag, double timeStamp)
 {
+    numSinceCommit++;
+    if (numSinceCommit < numCommits)
+      return 0;
+
+    numSinceCommit = 0;
     return theDatastore->commitState(commitTag);
 }
 
@@ -47,7 +47,7 @@ class FE_Datastore;
 class DatastoreRecorder: public Recorder
 {
   public:
-    DatastoreRecorder(FE_Datastore &theDatastore);
+    DatastoreRecorder(FE_Datastore &theDatastore, int numCommits = 1);
     ~DatastoreRecorder();
     int record(int commitTag, double timeStamp);
     int playback(int commitTag);
@@ -57,6 +57,8 @@ class DatastoreRecorder: public Recorder
     
   private:	
     FE_Datastore *theDatastore;
+    int numCommits;         // commitState() is invoked every numCommits
+    int numSinceCommit;
 };
 
 
@@ -221,6 +221,17 @@ ElementRecorder::setDomain(Domain &theDom)
   return 0;
 }
 
+size_t
+ElementRecorder::getNumBytes(void)
+{
+  size_t numBytes = 0;
+  if (data != 0)
+    numBytes += data->Size()*sizeof(double);
+  if (theOutputHandler != 0)
+    numBytes += theOutputHandler->getNumBytes();
+  return numBytes;
+}
+
 int
 ElementRecorder::sendSelf(int commitTag, Channel &theChannel)
 {
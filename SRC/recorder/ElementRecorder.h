@@ -67,6 +67,7 @@ class ElementRecorder: public Recorder
     int restart(void);    
 
     int setDomain(Domain &theDomain);
+    size_t getNumBytes(void);
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
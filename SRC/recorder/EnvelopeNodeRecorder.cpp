@@ -266,15 +266,16 @@ EnvelopeNodeRecorder::record(int commitTag, double timeStamp)
 
     //
     // if need nodal reactions get the domain to calculate them
-    // before we iterate over the nodes
+    // before we iterate over the nodes, for only the recorded nodes
+    // when these are given
     //
 
-    if (dataFlag == 7)
-      theDomain->calculateNodalReactions(0);
-    else if (dataFlag == 8)
-      theDomain->calculateNodalReactions(1);
-    if (dataFlag == 9)
-      theDomain->calculateNodalReactions(2);
+    if (dataFlag == 7 || dataFlag == 8 || dataFlag == 9) {
+      if (theNodalTags != 0)
+	theDomain->calculateNodalReactions(dataFlag-7, *theNodalTags);
+      else
+	theDomain->calculateNodalReactions(dataFlag-7);
+    }
 
     
     for (int i=0; i<numValidNodes; i++) {
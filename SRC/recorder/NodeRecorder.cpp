@@ -36,6 +36,7 @@
 #include <Matrix.h>
 #include <FE_Datastore.h>
 #include <FEM_ObjectBroker.h>
+#include <classTags.h>
 
 #include <string.h>
 #include <stdlib.h>
@@ -243,15 +244,16 @@ NodeRecorder::record(int commitTag, double timeStamp)
 
     //
     // if need nodal reactions get the domain to calculate them
-    // before we iterate over the nodes
+    // before we iterate over the nodes, for only the recorded nodes
+    // when these are given
     //
 
-    if (dataFlag == 7)
-      theDomain->calculateNodalReactions(0);
-    else if (dataFlag == 8)
-      theDomain->calculateNodalReactions(1);
-    if (dataFlag == 9)
-      theDomain->calculateNodalReactions(2);
+    if (dataFlag == 7 || dataFlag == 8 || dataFlag == 9) {
+      if (theNodalTags != 0)
+	theDomain->calculateNodalReactions(dataFlag-7, *theNodalTags);
+      else
+	theDomain->calculateNodalReactions(dataFlag-7);
+    }
 
     //
     // add time information if requested
@@ -783,6 +785,15 @@ NodeRecorder::domainChanged(void)
   return 0;
 }
 
+size_t
+NodeRecorder::getNumBytes(void)
+{
+  size_t numBytes = response.Size()*sizeof(double);
+  if (theOutputHandler != 0)
+    numBytes += theOutputHandler->getNumBytes();
+  return numBytes;
+}
+
 int
 NodeRecorder::initialize(void)
 {
@@ -946,7 +957,10 @@ NodeRecorder::initialize(void)
   sprintf(nodeCrdData,"coord");
 
   if (echoTimeFlag == true) {
-    if (theNodalTags != 0 && addColumnInfo == 1) {
+    if ((theNodalTags != 0 && addColumnInfo == 1) || 
+	theOutputHandler->getClassTag() == OPS_STREAM_TAGS_ColumnarFileStream ||
+	theOutputHandler->getClassTag() == OPS_STREAM_TAGS_H5FileStream ||
+	theOutputHandler->getClassTag() == OPS_STREAM_TAGS_ReductionStream) {
       theOutputHandler->tag("TimeOutput");
       theOutputHandler->tag("ResponseType", "time");
       theOutputHandler->endTag();
@@ -65,6 +65,7 @@ class NodeRecorder: public Recorder
 
     int domainChanged(void);    
     int setDomain(Domain &theDomain);
+    size_t getNumBytes(void);
     int sendSelf(int commitTag, Channel &theChannel);  
     int recvSelf(int commitTag, Channel &theChannel, 
 		 FEM_ObjectBroker &theBroker);
@@ -36,6 +36,18 @@
 #include <classTags.h>
 #include <NodeIter.h>
 #include <BackgroundMesh.h>
+#include <string.h>
+
+#ifdef _ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
+// bytes of the blocks compressed separately in a compressed array
+#define PVD_COMPRESS_BLOCK 32768
 
 extern BackgroundMesh& OPS_GetBackgroundMesh();
 
@@ -58,6 +70,8 @@ void* OPS_PVDRecorder()
     numdata = OPS_GetNumRemainingInputArgs();
     int indent=2;
     int precision = 10;
+    bool binary = false;
+    bool compress = false;
     PVDRecorder::NodeData nodedata;
     std::vector<PVDRecorder::EleData> eledata;
     while(numdata > 0) {
@@ -94,6 +108,16 @@ void* OPS_PVDRecorder()
 	    }
 	    numdata = 1;
 	    if(OPS_GetIntInput(&numdata,&precision) < 0) return 0;
+	} else if(type=="-binary") {
+	    binary = true;
+	} else if(type=="-compress") {
+#ifdef _ZLIB
+	    binary = true;
+	    compress = true;
+#else
+	    opserr<<"WARNING: zlib is not available, -compress writes raw binary data\n";
+	    binary = true;
+#endif
 	} else if(type=="eleResponse") {
 	    numdata = OPS_GetNumRemainingInputArgs();
 	    if(numdata < 1) {
@@ -112,16 +136,30 @@ void* OPS_PVDRecorder()
     }
 
     // create recorder
-    return new PVDRecorder(name,nodedata,eledata,indent,precision);
+    return new PVDRecorder(name,nodedata,eledata,indent,precision,binary,compress);
 }
 
 PVDRecorder::PVDRecorder(const char *name, const NodeData& ndata,
-			 const std::vector<EleData>& edata, int ind, int pre)
+			 const std::vector<EleData>& edata, int ind, int pre,
+			 bool bin, bool comp)
     :Recorder(RECORDER_TAGS_PVDRecorder), indentsize(ind), precision(pre),
      indentlevel(0), filename(name),
      timestep(), timeparts(), theFile(), quota('\"'), parts(),
-     nodedata(ndata), eledata(edata), theDomain(0), partnum()
+     nodedata(ndata), eledata(edata), theDomain(0), partnum(),
+     binary(bin), compress(comp), intArray(false), newTuple(true),
+     topologyArray(false), arrayName(), arrayData(), appended(),
+     currentPart(0), meshCached(false), pieceMesh(), topology(),
+     pieceSection(PIECE_POINTS), pieceArrays(),
+     numProcesses(1), processID(0)
 {
+#ifdef _PARALLEL_INTERPRETERS
+    int flag = 0;
+    MPI_Initialized(&flag);
+    if (flag != 0) {
+	MPI_Comm_size(MPI_COMM_WORLD, &numProcesses);
+	MPI_Comm_rank(MPI_COMM_WORLD, &processID);
+    }
+#endif
 }
 
 PVDRecorder::~PVDRecorder()
@@ -167,6 +205,11 @@ PVDRecorder::setDomain(Domain& domain)
 int
 PVDRecorder::pvd()
 {
+    // the pieces of the other processes are in the pvtu files of process 0
+    if (processID != 0) {
+	return 0;
+    }
+
     // open pvd file
     theFile.close();
     std::string pvdname = filename+".pvd";
@@ -201,7 +244,7 @@ PVDRecorder::pvd()
 	    theFile<<" group="<<quota<<quota;
 	    theFile<<" part="<<quota<<partno(j)<<quota;
 	    theFile<<" file="<<quota<<filename.c_str()<<'/'<<filename.c_str()<<"_T"<<t<<"_P";
-	    theFile<<partno(j)<<".vtu"<<quota;
+	    theFile<<partno(j)<<(numProcesses>1 ? ".pvtu" : ".vtu")<<quota;
 	    theFile<<"/>\n";
 	}
     }
@@ -240,12 +283,42 @@ PVDRecorder::vtu()
     // get parts
     this->getParts();
 
+#ifdef _PARALLEL_INTERPRETERS
+    if (numProcesses > 1) {
+	// nodendf and the parts of all processes, so that the part numbers
+	// agree and each process writes a piece of every part, empty or not
+	int ndf = nodendf;
+	MPI_Allreduce(&ndf, &nodendf, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+	int numLocal = (int)parts.size();
+	std::vector<int> numAll(numProcesses), displs(numProcesses);
+	MPI_Allgather(&numLocal, 1, MPI_INT, &numAll[0], 1, MPI_INT, MPI_COMM_WORLD);
+	int numTotal = 0;
+	for (int i=0; i<numProcesses; i++) {
+	    displs[i] = numTotal;
+	    numTotal += numAll[i];
+	}
+	std::vector<int> local(numLocal+1), all(numTotal+1);
+	int loc = 0;
+	for(std::map<int,ID>::iterator it=parts.begin(); it!=parts.end(); it++) {
+	    local[loc++] = it->first;
+	}
+	MPI_Allgatherv(&local[0], numLocal, MPI_INT, &all[0], &numAll[0], &displs[0],
+		       MPI_INT, MPI_COMM_WORLD);
+	for (int i=0; i<numTotal; i++) {
+	    parts[all[i]];
+	}
+    }
+#endif
+
     // part 0
     ID partno(0, (int)parts.size()+2);
     partno[0] = 0;
     if (this->savePart0(nodendf) < 0) {
 	return -1;
     }
+    if (this->pvtu(0) < 0) {
+	return -1;
+    }
     
     // particle part
     BackgroundMesh& background = OPS_GetBackgroundMesh();
@@ -254,6 +327,9 @@ PVDRecorder::vtu()
 	if (this->savePartParticle(nodendf) < 0) {
 	    return -1;
 	}
+	if (this->pvtu(1) < 0) {
+	    return -1;
+	}
     }
 
     // save other parts
@@ -266,6 +342,7 @@ PVDRecorder::vtu()
 	int no = partno.Size();
 	partno[no] = no;
 	if(this->savePart(no,it->first,nodendf) < 0) return -1;
+	if(this->pvtu(no) < 0) return -1;
     }
 
     
@@ -312,8 +389,8 @@ PVDRecorder::savePart0(int nodendf)
     
     // open file
     theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
+    std::string vtuname = this->pieceName(stime, spart, processID);
+    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out|std::ios::binary);
     if(theFile.fail()) {
 	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
 	return -1;
@@ -322,11 +399,7 @@ PVDRecorder::savePart0(int nodendf)
     theFile << std::scientific;
 
     // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
+    this->vtuHeader("UnstructuredGrid");
     this->incrLevel();
     this->indent();
     theFile<<"<UnstructuredGrid>\n";
@@ -353,6 +426,13 @@ PVDRecorder::savePart0(int nodendf)
 	}
     }
 
+    // binary topology of the last record is reused if the nodes are unchanged
+    ID nodetags((int)nodes.size());
+    for(int i=0; i<(int)nodes.size(); i++) {
+	nodetags(i) = nodes[i]->getTag();
+    }
+    this->setPiece(0, ID(), nodetags);
+
     // Piece
     this->incrLevel();
     this->indent();
@@ -363,34 +443,27 @@ PVDRecorder::savePart0(int nodendf)
     this->incrLevel();
     this->indent();
     theFile<<"<Points>\n";
+    pieceSection = PIECE_POINTS;
 
     // points header
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    this->startArray("Float32", "Points", 3);
 
     // points coordinates
-    this->incrLevel();
     for(int i=0; i<(int)nodes.size(); i++) {
 	const Vector& crds = nodes[i]->getCrds();
-	this->indent();
 	for(int j=0; j<3; j++) {
 	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
+		this->arrayValue(crds(j));
 	    } else {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
 	}
-	theFile<<std::endl;
+	this->endTuple();
     }
 
     // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->endArray();
     this->decrLevel();
     this->indent();
     theFile<<"</Points>\n";
@@ -398,45 +471,31 @@ PVDRecorder::savePart0(int nodendf)
     // cells
     this->indent();
     theFile<<"<Cells>\n";
+    pieceSection = PIECE_CELLS;
 
     // connectivity
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
+    if (this->startArray("Int32", "connectivity", 0, true)) {
+	for(int i=0; i<(int)nodes.size(); i++) {
+	    this->arrayValue(i);
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<(int)nodes.size()<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    if (this->startArray("Int32", "offsets", 0, true)) {
+	this->arrayValue((int)nodes.size());
+	this->endTuple();
+	this->endArray();
+    }
 
     // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<VTK_POLY_VERTEX<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    if (this->startArray("Int32", "types", 0, true)) {
+	this->arrayValue(VTK_POLY_VERTEX);
+	this->endTuple();
+	this->endArray();
+    }
 
     // cells footer
     this->decrLevel();
@@ -446,245 +505,173 @@ PVDRecorder::savePart0(int nodendf)
     // point data
     this->indent();
     theFile<<"<PointData>\n";
+    pieceSection = PIECE_POINT_DATA;
 
     // node tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)nodes.size(); i++) {
-	this->indent();
-	theFile<<nodes[i]->getTag()<<std::endl;
+    if (this->startArray("Int32", "NodeTag", 0, true)) {
+	for(int i=0; i<(int)nodes.size(); i++) {
+	    this->arrayValue(nodes[i]->getTag());
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // node velocity
     if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Velocity", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Vector& vel = nodes[i]->getTrialVel();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node displacement
     if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Displacement", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Vector& vel = nodes[i]->getTrialDisp();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node incr displacement
     if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "IncrDisplacement", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Vector& vel = nodes[i]->getIncrDisp();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node acceleration
     if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Acceleration", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Vector& vel = nodes[i]->getTrialAccel();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node pressure
     if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Pressure", 0);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    double pressure = 0.0;
 	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(nodes[i]->getTag());
 	    if(thePC != 0) {
 		pressure = thePC->getPressure();
 	    }
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	    this->arrayValue(pressure);
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node reaction
     if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Reaction", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Vector& vel = nodes[i]->getReaction();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
     
     // node unbalanced load
     if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "UnbalancedLoad", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Vector& vel = nodes[i]->getUnbalancedLoad();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node mass
     if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "NodeMass", nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Matrix& mat = nodes[i]->getMass();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < mat.noRows()) {
-		    theFile<<mat(j,j)<<' ';
+		    this->arrayValue(mat(j,j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node eigen vector
     for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	std::stringstream ename;
+	ename << "EigenVector"<<k+1;
+	this->startArray("Float32", ename.str(), nodendf);
 	for(int i=0; i<(int)nodes.size(); i++) {
 	    const Matrix& eigens = nodes[i]->getEigenvectors();
 	    if(k >= eigens.noCols()) {
 		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
 		return -1;
 	    }
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < eigens.noRows()) {
-		    theFile<<eigens(j,k)<<' ';
+		    this->arrayValue(eigens(j,k));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // point data footer
@@ -695,19 +682,15 @@ PVDRecorder::savePart0(int nodendf)
     // cell data
     this->indent();
     theFile<<"<CellData>\n";
+    pieceSection = PIECE_CELL_DATA;
 
     // element tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<0<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    if (this->startArray("Int32", "ElementTag", 0, true)) {
+	this->arrayValue(0);
+	this->endTuple();
+	this->endArray();
+    }
 
     // cell data footer
     this->decrLevel();
@@ -722,6 +705,7 @@ PVDRecorder::savePart0(int nodendf)
     this->decrLevel();
     this->indent();
     theFile<<"</UnstructuredGrid>\n";
+    this->writeAppended();
 
     this->decrLevel();
     this->indent();
@@ -750,8 +734,8 @@ PVDRecorder::savePartParticle(int nodendf)
     
     // open file
     theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
+    std::string vtuname = this->pieceName(stime, spart, processID);
+    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out|std::ios::binary);
     if(theFile.fail()) {
 	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
 	return -1;
@@ -760,11 +744,7 @@ PVDRecorder::savePartParticle(int nodendf)
     theFile << std::scientific;
 
     // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
+    this->vtuHeader("UnstructuredGrid");
     this->incrLevel();
     this->indent();
     theFile<<"<UnstructuredGrid>\n";
@@ -782,6 +762,11 @@ PVDRecorder::savePartParticle(int nodendf)
 	}
     }
 
+    // binary topology of the last record is reused if the count is unchanged
+    ID numparticles(1);
+    numparticles(0) = (int)particles.size();
+    this->setPiece(1, ID(), numparticles);
+
     // Piece
     this->incrLevel();
     this->indent();
@@ -792,34 +777,27 @@ PVDRecorder::savePartParticle(int nodendf)
     this->incrLevel();
     this->indent();
     theFile<<"<Points>\n";
+    pieceSection = PIECE_POINTS;
 
     // points header
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    this->startArray("Float32", "Points", 3);
 
     // points coordinates
-    this->incrLevel();
     for(int i=0; i<(int)particles.size(); i++) {
 	const Vector& crds = particles[i]->getCrds();
-	this->indent();
 	for(int j=0; j<3; j++) {
 	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
+		this->arrayValue(crds(j));
 	    } else {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
 	}
-	theFile<<std::endl;
+	this->endTuple();
     }
 
     // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->endArray();
     this->decrLevel();
     this->indent();
     theFile<<"</Points>\n";
@@ -827,45 +805,31 @@ PVDRecorder::savePartParticle(int nodendf)
     // cells
     this->indent();
     theFile<<"<Cells>\n";
+    pieceSection = PIECE_CELLS;
 
     // connectivity
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
+    if (this->startArray("Int32", "connectivity", 0, true)) {
+	for(int i=0; i<(int)particles.size(); i++) {
+	    this->arrayValue(i);
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<(int)particles.size()<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    if (this->startArray("Int32", "offsets", 0, true)) {
+	this->arrayValue((int)particles.size());
+	this->endTuple();
+	this->endArray();
+    }
 
     // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<VTK_POLY_VERTEX<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    if (this->startArray("Int32", "types", 0, true)) {
+	this->arrayValue(VTK_POLY_VERTEX);
+	this->endTuple();
+	this->endArray();
+    }
 
     // cells footer
     this->decrLevel();
@@ -875,202 +839,130 @@ PVDRecorder::savePartParticle(int nodendf)
     // point data
     this->indent();
     theFile<<"<PointData>\n";
+    pieceSection = PIECE_POINT_DATA;
 
     // node tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<(int)particles.size(); i++) {
-	this->indent();
-	theFile<<i<<std::endl;
+    if (this->startArray("Int32", "NodeTag", 0, true)) {
+	for(int i=0; i<(int)particles.size(); i++) {
+	    this->arrayValue(i);
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // node velocity
     if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Velocity", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
 	    const Vector& vel = particles[i]->getVel();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node displacement
     if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Displacement", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node incr displacement
     if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "IncrDisplacement", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node acceleration
     if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Acceleration", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node pressure
     if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Pressure", 0);
 	for(int i=0; i<(int)particles.size(); i++) {
 	    double pressure = particles[i]->getPressure();
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	    this->arrayValue(pressure);
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node reaction
     if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Reaction", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
     
     // node unbalanced load
     if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "UnbalancedLoad", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node mass
     if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "NodeMass", nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node eigen vector
     for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	std::stringstream ename;
+	ename << "EigenVector"<<k+1;
+	this->startArray("Float32", ename.str(), nodendf);
 	for(int i=0; i<(int)particles.size(); i++) {
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // point data footer
@@ -1081,19 +973,15 @@ PVDRecorder::savePartParticle(int nodendf)
     // cell data
     this->indent();
     theFile<<"<CellData>\n";
+    pieceSection = PIECE_CELL_DATA;
 
     // element tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    this->indent();
-    theFile<<0<<std::endl;
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    if (this->startArray("Int32", "ElementTag", 0, true)) {
+	this->arrayValue(0);
+	this->endTuple();
+	this->endArray();
+    }
 
     // cell data footer
     this->decrLevel();
@@ -1108,6 +996,7 @@ PVDRecorder::savePartParticle(int nodendf)
     this->decrLevel();
     this->indent();
     theFile<<"</UnstructuredGrid>\n";
+    this->writeAppended();
 
     this->decrLevel();
     this->indent();
@@ -1136,8 +1025,8 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     
     // open file
     theFile.close();
-    std::string vtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".vtu";
-    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out);
+    std::string vtuname = this->pieceName(stime, spart, processID);
+    theFile.open(vtuname.c_str(), std::ios::trunc|std::ios::out|std::ios::binary);
     if(theFile.fail()) {
 	opserr<<"WARNING: Failed to open file "<<vtuname.c_str()<<"\n";
 	return -1;
@@ -1146,11 +1035,7 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     theFile << std::scientific;
 
     // header
-    theFile<<"<VTKFile type="<<quota<<"UnstructuredGrid"<<quota;
-    theFile<<" version="<<quota<<"1.0"<<quota;
-    theFile<<" byte_order="<<quota<<"LittleEndian"<<quota;
-    theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
-    theFile<<">\n";
+    this->vtuHeader("UnstructuredGrid");
     this->incrLevel();
     this->indent();
     theFile<<"<UnstructuredGrid>\n";
@@ -1181,6 +1066,9 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
 	}
     }
 
+    // binary topology of the last record is reused if the mesh is unchanged
+    this->setPiece(partno, eletags, ndtags);
+
     // Piece
     this->incrLevel();
     this->indent();
@@ -1191,17 +1079,13 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     this->incrLevel();
     this->indent();
     theFile<<"<Points>\n";
+    pieceSection = PIECE_POINTS;
 
     // points header
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-    theFile<<" Name="<<quota<<"Points"<<quota;
-    theFile<<" NumberOfComponents="<<quota<<3<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+    this->startArray("Float32", "Points", 3);
 
     // points coordinates
-    this->incrLevel();
     std::vector<Node*> nodes(ndtags.Size());
     for(int i=0; i<ndtags.Size(); i++) {
 	nodes[i] = theDomain->getNode(ndtags(i));
@@ -1210,21 +1094,18 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
 	    return -1;
 	}
 	const Vector& crds = nodes[i]->getCrds();
-	this->indent();
 	for(int j=0; j<3; j++) {
 	    if(j < crds.Size()) {
-		theFile<<crds(j)<<' ';
+		this->arrayValue(crds(j));
 	    } else {
-		theFile<<0.0<<' ';
+		this->arrayValue(0.0);
 	    }
 	}
-	theFile<<std::endl;
+	this->endTuple();
     }
 
     // points footer
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
+    this->endArray();
     this->decrLevel();
     this->indent();
     theFile<<"</Points>\n";
@@ -1232,60 +1113,45 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     // cells
     this->indent();
     theFile<<"<Cells>\n";
+    pieceSection = PIECE_CELLS;
 
     // connectivity
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"connectivity"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<eletags.Size(); i++) {
-	const ID& elenodes = eles[i]->getExternalNodes();
-	this->indent();
-	for(int j=0; j<numelenodes; j++) {
-	    theFile<<ndtags.getLocationOrdered(elenodes(j*increlenodes))<<' ';
+    if (this->startArray("Int32", "connectivity", 0, true)) {
+	for(int i=0; i<eletags.Size(); i++) {
+	    const ID& elenodes = eles[i]->getExternalNodes();
+	    for(int j=0; j<numelenodes; j++) {
+		this->arrayValue(ndtags.getLocationOrdered(elenodes(j*increlenodes)));
+	    }
+	    this->endTuple();
 	}
-	theFile<<std::endl;
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // offsets
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"offsets"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    int offset = numelenodes;
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<offset<<std::endl;
-	offset += numelenodes;
+    if (this->startArray("Int32", "offsets", 0, true)) {
+	int offset = numelenodes;
+	for(int i=0; i<eletags.Size(); i++) {
+	    this->arrayValue(offset);
+	    this->endTuple();
+	    offset += numelenodes;
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // types
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"types"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    int type = vtktypes[ctag];
-    if (type == 0) {
-	opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
-	return -1;
-    }
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<type<<std::endl;
+    if (this->startArray("Int32", "types", 0, true)) {
+	int type = vtktypes[ctag];
+	if (type == 0) {
+	    opserr<<"WARNING: the element type cannot be assigned a VTK type\n";
+	    return -1;
+	}
+	for(int i=0; i<eletags.Size(); i++) {
+	    this->arrayValue(type);
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // cells footer
     this->decrLevel();
@@ -1295,245 +1161,173 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     // point data
     this->indent();
     theFile<<"<PointData>\n";
+    pieceSection = PIECE_POINT_DATA;
 
     // node tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"NodeTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<ndtags.Size(); i++) {
-	this->indent();
-	theFile<<ndtags(i)<<std::endl;
+    if (this->startArray("Int32", "NodeTag", 0, true)) {
+	for(int i=0; i<ndtags.Size(); i++) {
+	    this->arrayValue(ndtags(i));
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // node velocity
     if(nodedata.vel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Velocity"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Velocity", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Vector& vel = nodes[i]->getTrialVel();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node displacement
     if(nodedata.disp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Displacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Displacement", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Vector& vel = nodes[i]->getTrialDisp();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node incr displacement
     if(nodedata.incrdisp) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"IncrDisplacement"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "IncrDisplacement", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Vector& vel = nodes[i]->getIncrDisp();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node acceleration
     if(nodedata.accel) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Acceleration"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Acceleration", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Vector& vel = nodes[i]->getTrialAccel();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node pressure
     if(nodedata.pressure) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Pressure"<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Pressure", 0);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    double pressure = 0.0;
 	    Pressure_Constraint* thePC = theDomain->getPressure_Constraint(ndtags(i));
 	    if(thePC != 0) {
 		pressure = thePC->getPressure();
 	    }
-	    this->indent();
-	    theFile<<pressure<<std::endl;
+	    this->arrayValue(pressure);
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node reaction
     if(nodedata.reaction) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"Reaction"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "Reaction", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Vector& vel = nodes[i]->getReaction();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
     
     // node unbalanced load
     if(nodedata.unbalanced) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"UnbalancedLoad"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "UnbalancedLoad", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Vector& vel = nodes[i]->getUnbalancedLoad();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < vel.Size()) {
-		    theFile<<vel(j)<<' ';
+		    this->arrayValue(vel(j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node mass
     if(nodedata.mass) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"NodeMass"<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", "NodeMass", nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Matrix& mat = nodes[i]->getMass();
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < mat.noRows()) {
-		    theFile<<mat(j,j)<<' ';
+		    this->arrayValue(mat(j,j));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // node eigen vector
     for(int k=0; k<nodedata.numeigen; k++) {
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<"EigenVector"<<k+1<<quota;
-	theFile<<" NumberOfComponents="<<quota<<nodendf<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	std::stringstream ename;
+	ename << "EigenVector"<<k+1;
+	this->startArray("Float32", ename.str(), nodendf);
 	for(int i=0; i<ndtags.Size(); i++) {
 	    const Matrix& eigens = nodes[i]->getEigenvectors();
 	    if(k >= eigens.noCols()) {
 		opserr<<"WARNING: eigenvector "<<k+1<<" is too large\n";
 		return -1;
 	    }
-	    this->indent();
 	    for(int j=0; j<nodendf; j++) {
 		if(j < eigens.noRows()) {
-		    theFile<<eigens(j,k)<<' ';
+		    this->arrayValue(eigens(j,k));
 		} else {
-		    theFile<<0.0<<' ';
+		    this->arrayValue(0.0);
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // point data footer
@@ -1544,21 +1338,17 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     // cell data
     this->indent();
     theFile<<"<CellData>\n";
+    pieceSection = PIECE_CELL_DATA;
 
     // element tags
     this->incrLevel();
-    this->indent();
-    theFile<<"<DataArray type="<<quota<<"Int32"<<quota;
-    theFile<<" Name="<<quota<<"ElementTag"<<quota;
-    theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-    this->incrLevel();
-    for(int i=0; i<eletags.Size(); i++) {
-	this->indent();
-	theFile<<eletags(i)<<std::endl;
+    if (this->startArray("Int32", "ElementTag", 0, true)) {
+	for(int i=0; i<eletags.Size(); i++) {
+	    this->arrayValue(eletags(i));
+	    this->endTuple();
+	}
+	this->endArray();
     }
-    this->decrLevel();
-    this->indent();
-    theFile<<"</DataArray>\n";
 
     // element response
     for(int i=0; i<(int)eledata.size(); i++) {
@@ -1578,35 +1368,27 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
 	if(eressize == 0) continue;
 
 	// save data
-	this->indent();
-	theFile<<"<DataArray type="<<quota<<"Float32"<<quota;
-	theFile<<" Name="<<quota<<eles[0]->getClassType();
+	std::string ename = eles[0]->getClassType();
 	for(int j=0; j<argc; j++) {
-	    theFile<<argv[j];
+	    ename += argv[j];
 	}
-	theFile<<quota;
-	theFile<<" NumberOfComponents="<<quota<<eressize<<quota;
-	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
-	this->incrLevel();
+	this->startArray("Float32", ename, eressize);
 	for(int j=0; j<eletags.Size(); j++) {
 	    data=theDomain->getElementResponse(eletags(j),&(argv[0]),argc);
 	    if(data==0) {
 		opserr<<"WARNING: can't get response for element "<<eletags(j)<<"\n";
 		return -1;
 	    }
-	    this->indent();
 	    for(int k=0; k<eressize; k++) {
 		if (k>=data->Size()) {
-		    theFile<<0.0<<" ";
+		    this->arrayValue(0.0);
 		} else {
-		    theFile<<(*data)(k)<<" ";
+		    this->arrayValue((*data)(k));
 		}
 	    }
-	    theFile<<std::endl;
+	    this->endTuple();
 	}
-	this->decrLevel();
-	this->indent();
-	theFile<<"</DataArray>\n";
+	this->endArray();
     }
 
     // cell data footer
@@ -1622,6 +1404,301 @@ PVDRecorder::savePart(int partno, int ctag, int nodendf)
     this->decrLevel();
     this->indent();
     theFile<<"</UnstructuredGrid>\n";
+    this->writeAppended();
+
+    this->decrLevel();
+    this->indent();
+    theFile<<"</VTKFile>\n";
+
+    theFile.close();
+
+    return 0;
+}
+
+void
+PVDRecorder::vtuHeader(const char* type)
+{
+    int one = 1;
+    const char* order = *(char*)&one == 1 ? "LittleEndian" : "BigEndian";
+
+    theFile<<"<VTKFile type="<<quota<<type<<quota;
+    theFile<<" version="<<quota<<"1.0"<<quota;
+    theFile<<" byte_order="<<quota<<order<<quota;
+    if (binary) {
+	theFile<<" header_type="<<quota<<"UInt32"<<quota;
+    }
+    if (!binary || compress) {
+	theFile<<" compressor="<<quota<<"vtkZLibDataCompressor"<<quota;
+    }
+    theFile<<">\n";
+}
+
+void
+PVDRecorder::setPiece(int partno, const ID& eletags, const ID& ndtags)
+{
+    appended.clear();
+    pieceArrays.clear();
+    pieceSection = PIECE_POINTS;
+    currentPart = partno;
+
+    if (!binary) {
+	meshCached = false;
+	return;
+    }
+
+    // the topology arrays of the last record can be copied only if the
+    // piece has the same elements and nodes
+    std::map<int,std::pair<ID,ID> >::iterator it = pieceMesh.find(partno);
+    if (it != pieceMesh.end() &&
+	it->second.first.Size() == eletags.Size() &&
+	it->second.second.Size() == ndtags.Size() &&
+	(eletags.Size() == 0 || it->second.first == eletags) &&
+	(ndtags.Size() == 0 || it->second.second == ndtags)) {
+	meshCached = true;
+	return;
+    }
+
+    meshCached = false;
+    pieceMesh[partno] = std::pair<ID,ID>(eletags, ndtags);
+}
+
+bool
+PVDRecorder::startArray(const char* type, const std::string& name,
+			int numComp, bool topologyArr)
+{
+    PieceArray info;
+    info.section = pieceSection;
+    info.numComp = numComp;
+    info.type = type;
+    info.name = name;
+    pieceArrays.push_back(info);
+
+    this->indent();
+    theFile<<"<DataArray type="<<quota<<type<<quota;
+    theFile<<" Name="<<quota<<name<<quota;
+    if (numComp > 0) {
+	theFile<<" NumberOfComponents="<<quota<<numComp<<quota;
+    }
+
+    intArray = strcmp(type, "Int32") == 0;
+    newTuple = true;
+    topologyArray = topologyArr;
+    arrayName = name;
+
+    if (!binary) {
+	theFile<<" format="<<quota<<"ascii"<<quota<<">\n";
+	this->incrLevel();
+	return true;
+    }
+
+    theFile<<" format="<<quota<<"appended"<<quota;
+    theFile<<" offset="<<quota<<appended.size()<<quota<<"/>\n";
+
+    // copy the block of the last record
+    if (topologyArray && meshCached) {
+	std::map<std::pair<int,std::string>,std::string>::iterator it =
+	    topology.find(std::make_pair(currentPart, name));
+	if (it != topology.end()) {
+	    appended += it->second;
+	    return false;
+	}
+    }
+
+    arrayData.clear();
+    return true;
+}
+
+void
+PVDRecorder::arrayValue(double value)
+{
+    if (!binary) {
+	if (newTuple) {
+	    this->indent();
+	    newTuple = false;
+	}
+	if (intArray) {
+	    theFile<<(int)value<<' ';
+	} else {
+	    theFile<<value<<' ';
+	}
+	return;
+    }
+
+    if (intArray) {
+	int data = (int)value;
+	const char* bytes = (const char*)&data;
+	arrayData.insert(arrayData.end(), bytes, bytes+sizeof(int));
+    } else {
+	float data = (float)value;
+	const char* bytes = (const char*)&data;
+	arrayData.insert(arrayData.end(), bytes, bytes+sizeof(float));
+    }
+}
+
+void
+PVDRecorder::endTuple()
+{
+    newTuple = true;
+    if (!binary) {
+	theFile<<std::endl;
+    }
+}
+
+void
+PVDRecorder::endArray()
+{
+    if (!binary) {
+	this->decrLevel();
+	this->indent();
+	theFile<<"</DataArray>\n";
+	return;
+    }
+
+    // the block is the byte count followed by the data or, compressed,
+    // the number of blocks, the block size, the size of the last block and
+    // the compressed size of each block followed by the compressed blocks
+    std::string block;
+    unsigned int numBytes = (unsigned int)arrayData.size();
+    const char* data = numBytes > 0 ? &arrayData[0] : 0;
+#ifdef _ZLIB
+    if (compress) {
+	unsigned int numBlocks = (numBytes+PVD_COMPRESS_BLOCK-1)/PVD_COMPRESS_BLOCK;
+	std::vector<unsigned int> header(numBlocks+3);
+	header[0] = numBlocks;
+	header[1] = PVD_COMPRESS_BLOCK;
+	header[2] = numBytes - (numBlocks > 0 ? (numBlocks-1)*PVD_COMPRESS_BLOCK : 0);
+	std::string blocks;
+	std::vector<Bytef> buffer(compressBound(PVD_COMPRESS_BLOCK));
+	for (unsigned int i=0; i<numBlocks; i++) {
+	    uLong size = i+1 < numBlocks ? PVD_COMPRESS_BLOCK : header[2];
+	    uLongf compSize = (uLongf)buffer.size();
+	    if (compress2(&buffer[0], &compSize, (const Bytef*)data+i*PVD_COMPRESS_BLOCK,
+			  size, Z_DEFAULT_COMPRESSION) != Z_OK) {
+		opserr<<"WARNING: failed to compress "<<arrayName.c_str()<<" -- PVDRecorder\n";
+		compSize = 0;
+	    }
+	    header[i+3] = (unsigned int)compSize;
+	    blocks.append((const char*)&buffer[0], compSize);
+	}
+	block.append((const char*)&header[0], header.size()*sizeof(unsigned int));
+	block += blocks;
+    } else
+#endif
+    {
+	block.append((const char*)&numBytes, sizeof(unsigned int));
+	if (numBytes > 0) {
+	    block.append(data, numBytes);
+	}
+    }
+
+    appended += block;
+    if (topologyArray) {
+	topology[std::make_pair(currentPart, arrayName)] = block;
+    }
+}
+
+void
+PVDRecorder::writeAppended()
+{
+    if (!binary) {
+	return;
+    }
+
+    this->indent();
+    theFile<<"<AppendedData encoding="<<quota<<"raw"<<quota<<">\n";
+    this->indent();
+    theFile<<'_';
+    theFile.write(appended.data(), appended.size());
+    theFile<<"\n";
+    this->indent();
+    theFile<<"</AppendedData>\n";
+    appended.clear();
+}
+
+std::string
+PVDRecorder::pieceName(const std::string& stime, const std::string& spart, int rank)
+{
+    std::string name = filename+'/'+filename+"_T"+stime+"_P"+spart;
+    if (numProcesses > 1) {
+	std::stringstream ss;
+	ss << rank;
+	name += "_R"+ss.str();
+    }
+    return name+".vtu";
+}
+
+int
+PVDRecorder::pvtu(int partno)
+{
+    if (numProcesses < 2 || processID != 0) {
+	return 0;
+    }
+
+    // get time and part
+    std::stringstream ss;
+    ss.precision(precision);
+    ss << std::scientific;
+    ss << partno << ' ' << timestep.back();
+    std::string stime, spart;
+    ss >> spart >> stime;
+
+    // open file
+    theFile.close();
+    std::string pvtuname = filename+'/'+filename+"_T"+stime+"_P"+spart+".pvtu";
+    theFile.open(pvtuname.c_str(), std::ios::trunc|std::ios::out);
+    if(theFile.fail()) {
+	opserr<<"WARNING: Failed to open file "<<pvtuname.c_str()<<"\n";
+	return -1;
+    }
+
+    // header
+    bool bin = binary;
+    binary = false;
+    this->vtuHeader("PUnstructuredGrid");
+    binary = bin;
+    this->incrLevel();
+    this->indent();
+    theFile<<"<PUnstructuredGrid GhostLevel="<<quota<<0<<quota<<">\n";
+
+    // the arrays of the piece of this process
+    const char* sections[] = {"PPoints", "", "PPointData", "PCellData"};
+    this->incrLevel();
+    for (int sec=PIECE_POINTS; sec<=PIECE_CELL_DATA; sec++) {
+	if (sec == PIECE_CELLS) continue;
+	this->indent();
+	theFile<<'<'<<sections[sec]<<">\n";
+	this->incrLevel();
+	for (int i=0; i<(int)pieceArrays.size(); i++) {
+	    const PieceArray& info = pieceArrays[i];
+	    if (info.section != sec) continue;
+	    this->indent();
+	    theFile<<"<PDataArray type="<<quota<<info.type.c_str()<<quota;
+	    if (sec != PIECE_POINTS) {
+		theFile<<" Name="<<quota<<info.name.c_str()<<quota;
+	    }
+	    if (info.numComp > 0) {
+		theFile<<" NumberOfComponents="<<quota<<info.numComp<<quota;
+	    }
+	    theFile<<"/>\n";
+	}
+	this->decrLevel();
+	this->indent();
+	theFile<<"</"<<sections[sec]<<">\n";
+    }
+
+    // pieces, relative to the pvtu file
+    for (int i=0; i<numProcesses; i++) {
+	std::stringstream rs;
+	rs << i;
+	this->indent();
+	theFile<<"<Piece Source="<<quota<<filename.c_str()<<"_T"<<stime.c_str();
+	theFile<<"_P"<<spart.c_str()<<"_R"<<rs.str().c_str()<<".vtu"<<quota<<"/>\n";
+    }
+
+    // footer
+    this->decrLevel();
+    this->indent();
+    theFile<<"</PUnstructuredGrid>\n";
 
     this->decrLevel();
     this->indent();
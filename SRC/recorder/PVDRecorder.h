@@ -28,6 +28,13 @@
 //
 // Description: This file contains the class definition for 
 // PVDRecorder. A PVDRecorder is used to store all responses in pvd format.
+//
+// With binary the data arrays are written raw, or zlib compressed with
+// compress, to the appended data section of the vtu files, and the
+// topology arrays of a part whose mesh is unchanged since the last record
+// are copied from that record instead of being built again. In parallel
+// each process writes its own piece of every part and process 0 writes
+// the pvtu files collecting them.
 
 
 #include <string>
@@ -54,7 +61,8 @@ public:
     
 public:
     PVDRecorder(const char *filename, const NodeData& ndata,
-		const std::vector<EleData>& edata, int ind=2, int pre=10);
+		const std::vector<EleData>& edata, int ind=2, int pre=10,
+		bool bin=false, bool comp=false);
     ~PVDRecorder();
 
     int record(int commitTag, double timeStamp);
@@ -78,6 +86,19 @@ private:
     virtual int savePart(int partno, int ctag, int ndf);
     virtual int savePart0(int ndf);
     virtual int savePartParticle(int ndf);
+
+    // data arrays, returns false if a topology array was copied
+    virtual bool startArray(const char* type, const std::string& name,
+			    int numComp, bool topology=false);
+    virtual void arrayValue(double value);
+    virtual void endTuple();
+    virtual void endArray();
+    virtual void vtuHeader(const char* type);
+    virtual void writeAppended();
+    virtual void setPiece(int partno, const ID& eletags, const ID& ndtags);
+    virtual std::string pieceName(const std::string& stime,
+				  const std::string& spart, int rank);
+    virtual int pvtu(int partno);
     
 private:
     int indentsize, precision, indentlevel;
@@ -92,6 +113,29 @@ private:
     Domain* theDomain;
     std::map<int,int> partnum;
 
+    // binary appended data
+    bool binary, compress;
+    bool intArray, newTuple, topologyArray;
+    std::string arrayName;
+    std::vector<char> arrayData;
+    std::string appended;
+
+    // topology of the last record of each part
+    int currentPart;
+    bool meshCached;
+    std::map<int,std::pair<ID,ID> > pieceMesh;
+    std::map<std::pair<int,std::string>,std::string> topology;
+
+    // arrays of the last piece, declared in the pvtu file
+    enum {PIECE_POINTS, PIECE_CELLS, PIECE_POINT_DATA, PIECE_CELL_DATA};
+    struct PieceArray {
+	int section, numComp;
+	std::string type, name;
+    };
+    int pieceSection;
+    std::vector<PieceArray> pieceArrays;
+    int numProcesses, processID;
+
 public:
     enum VtkType {
 	VTK_VERTEX=1,VTK_POLY_VERTEX=2,VTK_LINE=3,VTK_POLY_LINE=4,
@@ -39,6 +39,7 @@
 class Domain;
 #include <MovableObject.h>
 #include <TaggedObject.h>
+#include <stddef.h>
 
 
 class Recorder: public MovableObject, public TaggedObject
@@ -58,6 +59,9 @@ class Recorder: public MovableObject, public TaggedObject
 
     virtual void Print(OPS_Stream &s, int flag); 
 
+    // the bytes held by the recorder for its response and output buffers
+    virtual size_t getNumBytes(void) {return 0;}
+
   protected:
     
   private:	
@@ -78,6 +78,15 @@ int RemoveRecorder::numRemNodes = 0;
 Element** RemoveRecorder::remEles = 0;
 Node** RemoveRecorder::remNodes = 0;
 
+// the removed elements are made inactive and left in the domain; they are
+// taken out of it all at once, with one change of the domain, when they are
+// more than compactFraction of the elements in the domain, or as soon as a
+// node is removed: a node left without elements has no mass, which explicit
+// integrators and eigen analyses cannot handle
+double RemoveRecorder::compactFraction = 0.25;
+int RemoveRecorder::numCompactedEles = 0;
+int RemoveRecorder::numCompactedNodes = 0;
+
 
 char* RemoveRecorder::fileName = 0;
 // new
@@ -284,14 +293,15 @@ RemoveRecorder::~RemoveRecorder()
 {
   numRecs--;
 
-  // if last recorder to be deleted, check if any elements or nodes had been "removed" and destroy them
+  // if last recorder to be deleted, destroy the "removed" elements and
+  // nodes taken out of the domain; the inactive ones are still owned by it
   if (numRecs == 0) {
    
-    for (int i=0; i<numRemEles; i++)
+    for (int i=0; i<numCompactedEles; i++)
 		if (remEles[i] != 0)
           delete remEles[i];
  
-    for (int i=0; i<numRemNodes; i++)
+    for (int i=0; i<numCompactedNodes; i++)
 		if (remNodes[i] != 0)
            delete remNodes[i];
  
@@ -303,6 +313,8 @@ RemoveRecorder::~RemoveRecorder()
  
     numRemEles = 0;
     numRemNodes = 0;
+    numCompactedEles = 0;
+    numCompactedNodes = 0;
     remEles = 0;
     remNodes = 0;
 
@@ -453,8 +465,12 @@ RemoveRecorder::record(int commitTag, double timeStamp)
       }
     }
     
-    
-    
+    // take the inactive elements and nodes out of the domain if too many,
+    // at once if a node was removed
+    int numInactive = numRemEles - numCompactedEles;
+    if (numRemNodes > numCompactedNodes ||
+	(numInactive > 0 && numInactive >= compactFraction*theDomain->getNumElements()))
+      this->compact();
     
     if (fileName != 0) {
       //		theFile << " \n";
@@ -465,6 +481,53 @@ RemoveRecorder::record(int commitTag, double timeStamp)
   // succesfull completion - return 0
   return result;
 }
+// removes the elements and nodes eliminated since the last compact() from
+// the domain, with the constraints on the nodes, as a domain change for
+// all of them; they are kept until the last RemoveRecorder is destroyed
+
+int
+RemoveRecorder::compact(void)
+{
+  for (int i=numCompactedEles; i<numRemEles; i++)
+    theDomain->removeElement(remEles[i]->getTag());
+  numCompactedEles = numRemEles;
+
+  for (int i=numCompactedNodes; i<numRemNodes; i++) {
+    int theNodeTag = remNodes[i]->getTag();
+
+    // sp constraints of the load patterns
+    LoadPatternIter &theLoadPatterns = theDomain->getLoadPatterns();
+    LoadPattern *thePattern;
+    while ((thePattern = theLoadPatterns()) != 0) {
+      SP_ConstraintIter &theSPs = thePattern->getSPs();
+      SP_Constraint *theSP;
+      while ((theSP = theSPs()) != 0) {
+	if (theSP->getNodeTag() == theNodeTag) {
+	  SP_Constraint *theSPConstraint = thePattern->removeSP_Constraint(theSP->getTag());
+	  if (theSPConstraint != 0)
+	    delete theSPConstraint;
+	}
+      }
+    }
+
+    // and those of the domain (support fixity)
+    SP_ConstraintIter &theSPs = theDomain->getSPs();
+    SP_Constraint *theSP;
+    while ((theSP = theSPs()) != 0) {
+      if (theSP->getNodeTag() == theNodeTag) {
+	SP_Constraint *theSPConstraint = theDomain->removeSP_Constraint(theSP->getTag());
+	if (theSPConstraint != 0)
+	  delete theSPConstraint;
+      }
+    }
+
+    theDomain->removeNode(theNodeTag);
+  }
+  numCompactedNodes = numRemNodes;
+
+  return 0;
+}
+
 int 
 RemoveRecorder::playback(int commitTag)
 {
@@ -596,8 +659,10 @@ RemoveRecorder::elimElem(int theEleTag, double timeStamp)
   opserr << "RemoveRecorder::elimElem() remving ele: " << theEleTag << " at timeStamp: " << timeStamp << endln;;
 #endif
 
-  Element *theEle = theDomain->removeElement(theEleTag);
-  if (theEle != 0) {
+  // the element is not removed from the domain but made inactive, so that
+  // the analysis goes on without forming its model and system again
+  Element *theEle = theDomain->getElement(theEleTag);
+  if (theEle != 0 && theEle->isActive() == true) {
     // we also have to remove any elemental loads from the domain
     LoadPatternIter &theLoadPatterns = theDomain->getLoadPatterns();
     LoadPattern *thePattern;
@@ -626,10 +691,9 @@ RemoveRecorder::elimElem(int theEleTag, double timeStamp)
       }
     }
 
-    // finally invoke the destructor on the element 
-    //	delete theEle;
-    /////////////// M.Talaat : Avoid recorder trouble at element removal and just set it to zero after removing it from the domain!
+    // finally set the element to zero and take it out of the analysis
     theEle->revertToStart();
+    theEle->setActive(false);
 
     RemoveRecorder::remEleList[RemoveRecorder::numRemEles] = theEle->getTag();
 
@@ -661,10 +725,13 @@ RemoveRecorder::elimElem(int theEleTag, double timeStamp)
 int
 RemoveRecorder::elimNode(int theNodeTag, double timeStamp)
 {  
-  // remove from domain but do not delete yet!
-  Node *theNode = theDomain->removeNode(theNodeTag);
+  // the node stays in the domain, connected to its inactive elements, until
+  // the compact() at the end of record(); its loads and mass are removed
+  Node *theNode = theDomain->getNode(theNodeTag);
+  if (theNode == 0)
+    return 0;
   
-  // go through all load patterns and remove associated loads and constraints
+  // go through all load patterns and remove associated loads
   LoadPatternIter &theLoadPatterns = theDomain->getLoadPatterns();
   LoadPattern *thePattern;
   
@@ -705,68 +772,12 @@ RemoveRecorder::elimNode(int theNodeTag, double timeStamp)
     //			}	
     //		}
     
-    // follow with sp constraints
-    SP_ConstraintIter &theSPs = thePattern->getSPs();
-    SP_Constraint *theSP;
-    
-    while ((theSP = theSPs()) != 0) {
-      
-      int spNode = theSP->getNodeTag();
-      if (spNode == theNodeTag) {
-//				theSPTags[cnt] = theSP->getTag();
-//				cnt++;
-#ifdef MMTDEBUG
-	opserr<<"identified SP_Constraint "<<theSP->getTag()<<" acting on node "<<spNode<<endln;
-#endif
-	SP_Constraint *theSPConstraint = thePattern->removeSP_Constraint(theSP->getTag());
-	if (theSPConstraint != 0) {
-#ifdef MMTDEBUG
-	  opserr<<"deleting SP_Constraint "<<theSP->getTag()<<endln;
-#endif
-	  delete theSPConstraint;
-	}	
-      }
-    }
   }
   
-  
-  // we also have to remove any sp constraints from the domain that do not belong to load patterns (support fixity)
-  SP_ConstraintIter &theSPs = theDomain->getSPs();
-  SP_Constraint *theSP;
-  
-  //	  ID theSPTags(0,12); 
-  //	  int cnt=0;
-  while ((theSP = theSPs()) != 0) {
-    
-    int spNode = theSP->getNodeTag();
-    if (spNode == theNodeTag) {
-      //				theSPTags[cnt] = theSP->getTag();
-      //				cnt++;
-#ifdef MMTDEBUG
-      opserr<<"identified SP_Constraint "<<theSP->getTag()<<" acting on node "<<spNode<<endln;
-#endif
-      SP_Constraint *theSPConstraint = theDomain->removeSP_Constraint(theSP->getTag());
-      if (theSPConstraint != 0) {
-#ifdef MMTDEBUG
-	opserr<<"deleting SP_Constraint "<<theSP->getTag()<<endln;
-#endif
-	delete theSPConstraint;
-      }	
-    }
-  }
-  
-  //		for (int i=0; i<cnt; i++) {
-  //		  SP_Constraint *theSPconstraint = theDomain->removeSP_Constraint(theSPTags[i]);
-  //		  if (theSPconstraint != 0) {
-  //		    delete theSPconstraint;
-  //		  }	
-  //		}
-  
-  if (theNode != 0) {
-    // delete theNode;
-    /////////////////// M.Talaat : Again, avoid recorder trouble
-    theNode->revertToStart();
-  }
+  // without its elements the node carries no mass; its response is kept
+  Matrix theNodalMass(theNode->getMass());
+  theNodalMass.Zero();
+  theNode->setMass(theNodalMass);
   
   RemoveRecorder::remNodeList[numRemNodes] = theNode->getTag();
   //  RemoveRecorder::remNodes[numRemNodes] = theNode;
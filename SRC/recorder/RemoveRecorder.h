@@ -92,6 +92,8 @@ class RemoveRecorder: public Recorder
    int elimNode(int theDeadNodeTag, double timeStamp = 0);
    int elimSlaves(double timeStamp = 0);
    int updateNodalMasses(int theEleTag, double theEleMass);
+   int compact(void);
+   static void setCompactFraction(double fraction) {compactFraction = fraction;}
    
    static int numRecs;
    static ID remEleList;
@@ -100,6 +102,9 @@ class RemoveRecorder: public Recorder
    static int numRemNodes;
    static Element** remEles;
    static Node** remNodes;
+   static double compactFraction;
+   static int numCompactedEles;
+   static int numCompactedNodes;
    
  protected:
    
@@ -73,6 +73,13 @@ extern void* OPS_PVDRecorder();
  #include <DataFileStreamAdd.h>
  #include <XmlFileStream.h>
  #include <BinaryFileStream.h>
+ #include <ColumnarFileStream.h>
+ #include <ReductionStream.h>
+ #include <AsyncStream.h>
+ #include <ServerStream.h>
+#ifdef _HDF5
+ #include <H5FileStream.h>
+#endif
  #include <DatabaseStream.h>
  #include <DummyStream.h>
  #include <TCP_Stream.h>
@@ -102,7 +109,7 @@ extern void* OPS_PVDRecorder();
 
  static ExternalRecorderCommand *theExternalRecorderCommands = NULL;
 
-enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, DATA_STREAM_ADD};
+enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BINARY_STREAM, DATA_STREAM_CSV, TCP_STREAM, DATA_STREAM_ADD, COLUMNAR_STREAM, HDF5_STREAM, SERVER_STREAM};
 
 
  #include <EquiSolnAlgo.h>
@@ -126,6 +133,94 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
  extern FE_Datastore *theDatabase;
  extern FEM_ObjectBroker theBroker;
 
+ //
+ // parses -reduce type <args>, adding the reduction to types & parameters,
+ // loc is moved past the arguments
+ //
+ static int
+ TclAddRecorderReduction(Tcl_Interp *interp, int argc, TCL_Char **argv, int &loc,
+			 std::vector<int> &types, std::vector<Vector> &parameters)
+ {
+   if (loc+1 >= argc) {
+     opserr << "WARNING recorder -reduce type? - no type given\n";
+     return TCL_ERROR;
+   }
+
+   TCL_Char *type = argv[loc+1];
+   loc += 2;
+
+   int numArgs = 0;
+   int theType = -1;
+   if (strcmp(type,"rms") == 0)
+     theType = REDUCE_RMS;
+   else if (strcmp(type,"peak") == 0)
+     theType = REDUCE_PEAK;
+   else if (strcmp(type,"cumulative") == 0)
+     theType = REDUCE_CUMULATIVE;
+   else if (strcmp(type,"plastic") == 0) {
+     theType = REDUCE_PLASTIC;
+     numArgs = 1;
+   } else if (strcmp(type,"rainflow") == 0) {
+     theType = REDUCE_RAINFLOW;
+     numArgs = 2;
+   } else if (strcmp(type,"spectrum") == 0 || strcmp(type,"percentile") == 0) {
+     // spectrum damping numPeriods T1 T2 .., percentile numP p1 p2 ..
+     int offset = (strcmp(type,"spectrum") == 0) ? 1 : 0;
+     theType = (offset == 1) ? REDUCE_SPECTRUM : REDUCE_PERCENTILE;
+     int num;
+     if (loc+offset >= argc || Tcl_GetInt(interp, argv[loc+offset], &num) != TCL_OK || num < 1) {
+       opserr << "WARNING recorder -reduce " << type << " - invalid number of values\n";
+       return TCL_ERROR;
+     }
+     Vector data(num+offset);
+     if (offset == 1 && Tcl_GetDouble(interp, argv[loc], &data(0)) != TCL_OK) {
+       opserr << "WARNING recorder -reduce spectrum - invalid damping " << argv[loc] << endln;
+       return TCL_ERROR;
+     }
+     loc += offset+1;
+     for (int i=0; i<num; i++, loc++)
+       if (loc >= argc || Tcl_GetDouble(interp, argv[loc], &data(i+offset)) != TCL_OK) {
+	 opserr << "WARNING recorder -reduce " << type << " - " << num << " values needed\n";
+	 return TCL_ERROR;
+       }
+     types.push_back(theType);
+     parameters.push_back(data);
+     return TCL_OK;
+   } else {
+     opserr << "WARNING recorder -reduce " << type << " - unknown type, want rms, peak, ";
+     opserr << "spectrum, cumulative, plastic, rainflow or percentile\n";
+     return TCL_ERROR;
+   }
+
+   Vector data(numArgs);
+   for (int i=0; i<numArgs; i++, loc++)
+     if (loc >= argc || Tcl_GetDouble(interp, argv[loc], &data(i)) != TCL_OK) {
+       opserr << "WARNING recorder -reduce " << type << " - " << numArgs << " values needed\n";
+       return TCL_ERROR;
+     }
+   types.push_back(theType);
+   parameters.push_back(data);
+
+   return TCL_OK;
+ }
+
+ //
+ // wraps the stream of a recorder in a ReductionStream if any -reduce
+ //
+ static OPS_Stream *
+ TclReduceRecorderStream(OPS_Stream *theStream, bool echoTime,
+			 std::vector<int> &types, std::vector<Vector> &parameters)
+ {
+   if (types.empty())
+     return theStream;
+
+   ReductionStream *theReduction = new ReductionStream(theStream, echoTime);
+   for (unsigned int i=0; i<types.size(); i++)
+     theReduction->addReduction(types[i], parameters[i]);
+
+   return theReduction;
+ }
+
  int
  TclCreateRecorder(ClientData clientData, Tcl_Interp *interp, int argc,
 		   TCL_Char **argv, Domain &theDomain, Recorder **theRecorder)
@@ -159,6 +254,12 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
        int flags = 0;
        int eleData = 0;
        outputMode eMode = STANDARD_STREAM; 
+       std::vector<int> reduceTypes;
+       std::vector<Vector> reduceParameters;
+       int queueDepth = 0;
+       int serverPort = 0;
+       bool compressColumns = false;
+       double columnTolerance = 0.0;
        ID *eleIDs = 0;
        int precision = 6;
        const char *inetAddr = 0;
@@ -412,6 +513,67 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   loc += 2;
 	 }	    
 
+	 else if ((strcmp(argv[loc],"-columnar") == 0)) {
+	   fileName = argv[loc+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   loc += 2;
+	 }	    
+
+	 else if ((strcmp(argv[loc],"-compress") == 0)) {
+	   // columnar data compressed, to within -tolerance if given
+	   compressColumns = true;
+	   loc++;
+	 }
+
+	 else if ((strcmp(argv[loc],"-tolerance") == 0)) {
+	   if (loc+1 >= argc || Tcl_GetDouble(interp, argv[loc+1], &columnTolerance) != TCL_OK
+	       || columnTolerance < 0.0) {
+	     opserr << "WARNING recorder -tolerance tol? - invalid tolerance\n";
+	     return TCL_ERROR;
+	   }
+	   compressColumns = true;
+	   loc += 2;
+	 }
+
+	 else if ((strcmp(argv[loc],"-server") == 0)) {
+	   // publish to the ResultServer on a port as topic fileName
+	   if (loc+2 >= argc || Tcl_GetInt(interp, argv[loc+1], &serverPort) != TCL_OK) {
+	     opserr << "WARNING recorder -server port? topic? - invalid port\n";
+	     return TCL_ERROR;
+	   }
+	   fileName = argv[loc+2];
+	   eMode = SERVER_STREAM;
+	   loc += 3;
+	 }
+
+	 else if ((strcmp(argv[loc],"-async") == 0)) {
+	   // the rows are written by a writer thread, queueDepth rows queued
+	   queueDepth = 16;
+	   if (loc+1 < argc && Tcl_GetInt(interp, argv[loc+1], &queueDepth) == TCL_OK)
+	     loc += 2;
+	   else {
+	     queueDepth = 16;
+	     loc++;
+	   }
+	 }
+
+	 else if ((strcmp(argv[loc],"-reduce") == 0)) {
+	   if (TclAddRecorderReduction(interp, argc, argv, loc, reduceTypes, reduceParameters) != TCL_OK)
+	     return TCL_ERROR;
+	 }
+
+#ifdef _HDF5
+	 else if ((strcmp(argv[loc],"-hdf5") == 0)) {
+	   fileName = argv[loc+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = HDF5_STREAM;
+	   loc += 2;
+	 }	    
+#endif
+
 	 else {
 	   // first unknown string then is assumed to start 
 	   // element response request starts
@@ -445,11 +607,23 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM && fileName != 0) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM && fileName != 0) {
+	 theOutputStream = new ColumnarFileStream(fileName, OVERWRITE,
+						  compressColumns, columnTolerance);
+#ifdef _HDF5
+       } else if (eMode == HDF5_STREAM && fileName != 0) {
+	 theOutputStream = new H5FileStream(fileName);
+#endif
+       } else if (eMode == SERVER_STREAM && fileName != 0) {
+	 theOutputStream = new ServerStream(serverPort, fileName);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
        } else 
 	 theOutputStream = new StandardStream();
 
+       theOutputStream = TclReduceRecorderStream(theOutputStream, echoTime, reduceTypes, reduceParameters);
+       if (queueDepth > 0)
+	 theOutputStream = new AsyncStream(theOutputStream, queueDepth);
        theOutputStream->setPrecision(precision);
 
        if (strcmp(argv[1],"Element") == 0) {
@@ -729,6 +903,16 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   loc++;
 	 }
 
+	 else if ((strcmp(argv[loc],"-compact") == 0)) {
+	   double fraction;
+	   if (argc < loc+2 || Tcl_GetDouble(interp, argv[loc+1], &fraction) != TCL_OK) {
+	     opserr << "WARNING recorder Collapse -compact fraction? - invalid fraction\n";
+	     return TCL_ERROR;
+	   }
+	   RemoveRecorder::setCompactFraction(fraction);
+	   loc += 2;
+	 }
+
 	 else if ((strcmp(argv[loc],"-ele") == 0) ||
 		  (strcmp(argv[loc],"-eles") == 0) ||
 		  (strcmp(argv[loc],"-element") == 0)) {
@@ -1055,6 +1239,12 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
        TCL_Char *responseID = 0;
 
        outputMode eMode = STANDARD_STREAM;
+       std::vector<int> reduceTypes;
+       std::vector<Vector> reduceParameters;
+       int queueDepth = 0;
+       int serverPort = 0;
+       bool compressColumns = false;
+       double columnTolerance = 0.0;
 
        int pos = 2;
 
@@ -1175,6 +1365,67 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos += 2;
 	 }	    
 
+	 else if ((strcmp(argv[pos],"-columnar") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   pos += 2;
+	 }	    
+
+	 else if ((strcmp(argv[pos],"-compress") == 0)) {
+	   // columnar data compressed, to within -tolerance if given
+	   compressColumns = true;
+	   pos++;
+	 }
+
+	 else if ((strcmp(argv[pos],"-tolerance") == 0)) {
+	   if (pos+1 >= argc || Tcl_GetDouble(interp, argv[pos+1], &columnTolerance) != TCL_OK
+	       || columnTolerance < 0.0) {
+	     opserr << "WARNING recorder -tolerance tol? - invalid tolerance\n";
+	     return TCL_ERROR;
+	   }
+	   compressColumns = true;
+	   pos += 2;
+	 }
+
+	 else if ((strcmp(argv[pos],"-server") == 0)) {
+	   // publish to the ResultServer on a port as topic fileName
+	   if (pos+2 >= argc || Tcl_GetInt(interp, argv[pos+1], &serverPort) != TCL_OK) {
+	     opserr << "WARNING recorder -server port? topic? - invalid port\n";
+	     return TCL_ERROR;
+	   }
+	   fileName = argv[pos+2];
+	   eMode = SERVER_STREAM;
+	   pos += 3;
+	 }
+
+	 else if ((strcmp(argv[pos],"-async") == 0)) {
+	   // the rows are written by a writer thread, queueDepth rows queued
+	   queueDepth = 16;
+	   if (pos+1 < argc && Tcl_GetInt(interp, argv[pos+1], &queueDepth) == TCL_OK)
+	     pos += 2;
+	   else {
+	     queueDepth = 16;
+	     pos++;
+	   }
+	 }
+
+	 else if ((strcmp(argv[pos],"-reduce") == 0)) {
+	   if (TclAddRecorderReduction(interp, argc, argv, pos, reduceTypes, reduceParameters) != TCL_OK)
+	     return TCL_ERROR;
+	 }
+
+#ifdef _HDF5
+	 else if ((strcmp(argv[pos],"-hdf5") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = HDF5_STREAM;
+	   pos += 2;
+	 }	    
+#endif
+
 
 	 else if (strcmp(argv[pos],"-dT") == 0) {
 	   pos ++;
@@ -1349,12 +1600,24 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM && fileName != 0) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM && fileName != 0) {
+	 theOutputStream = new ColumnarFileStream(fileName, OVERWRITE,
+						  compressColumns, columnTolerance);
+#ifdef _HDF5
+       } else if (eMode == HDF5_STREAM && fileName != 0) {
+	 theOutputStream = new H5FileStream(fileName);
+#endif
+       } else if (eMode == SERVER_STREAM && fileName != 0) {
+	 theOutputStream = new ServerStream(serverPort, fileName);
        } else if (eMode == TCP_STREAM && inetAddr != 0) {
 	 theOutputStream = new TCP_Stream(inetPort, inetAddr);
        } else {
 	 theOutputStream = new StandardStream();
        }
 
+       theOutputStream = TclReduceRecorderStream(theOutputStream, echoTimeFlag, reduceTypes, reduceParameters);
+       if (queueDepth > 0)
+	 theOutputStream = new AsyncStream(theOutputStream, queueDepth);
        theOutputStream->setPrecision(precision);
 
        if (theTimeSeries != 0 && theTimeSeriesID.Size() < theDofs.Size()) {
@@ -1422,6 +1685,12 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
      else if ((strcmp(argv[1],"Drift") == 0) || (strcmp(argv[1],"EnvelopeDrift") == 0)) {
 
        outputMode eMode = STANDARD_STREAM;       // enum found in DataOutputFileHandler.h
+       std::vector<int> reduceTypes;
+       std::vector<Vector> reduceParameters;
+       int queueDepth = 0;
+       int serverPort = 0;
+       bool compressColumns = false;
+       double columnTolerance = 0.0;
 
        bool echoTimeFlag = false;
        ID iNodes(0,16);
@@ -1481,6 +1750,67 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	   pos += 2;
 	 }	    
 
+	 else if ((strcmp(argv[pos],"-columnar") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = COLUMNAR_STREAM;
+	   pos += 2;
+	 }	    
+
+	 else if ((strcmp(argv[pos],"-compress") == 0)) {
+	   // columnar data compressed, to within -tolerance if given
+	   compressColumns = true;
+	   pos++;
+	 }
+
+	 else if ((strcmp(argv[pos],"-tolerance") == 0)) {
+	   if (pos+1 >= argc || Tcl_GetDouble(interp, argv[pos+1], &columnTolerance) != TCL_OK
+	       || columnTolerance < 0.0) {
+	     opserr << "WARNING recorder -tolerance tol? - invalid tolerance\n";
+	     return TCL_ERROR;
+	   }
+	   compressColumns = true;
+	   pos += 2;
+	 }
+
+	 else if ((strcmp(argv[pos],"-server") == 0)) {
+	   // publish to the ResultServer on a port as topic fileName
+	   if (pos+2 >= argc || Tcl_GetInt(interp, argv[pos+1], &serverPort) != TCL_OK) {
+	     opserr << "WARNING recorder -server port? topic? - invalid port\n";
+	     return TCL_ERROR;
+	   }
+	   fileName = argv[pos+2];
+	   eMode = SERVER_STREAM;
+	   pos += 3;
+	 }
+
+	 else if ((strcmp(argv[pos],"-async") == 0)) {
+	   // the rows are written by a writer thread, queueDepth rows queued
+	   queueDepth = 16;
+	   if (pos+1 < argc && Tcl_GetInt(interp, argv[pos+1], &queueDepth) == TCL_OK)
+	     pos += 2;
+	   else {
+	     queueDepth = 16;
+	     pos++;
+	   }
+	 }
+
+	 else if ((strcmp(argv[pos],"-reduce") == 0)) {
+	   if (TclAddRecorderReduction(interp, argc, argv, pos, reduceTypes, reduceParameters) != TCL_OK)
+	     return TCL_ERROR;
+	 }
+
+#ifdef _HDF5
+	 else if ((strcmp(argv[pos],"-hdf5") == 0)) {
+	   fileName = argv[pos+1];
+	   const char *pwd = getInterpPWD(interp);
+	   simulationInfo.addOutputFile(fileName, pwd);
+	   eMode = HDF5_STREAM;
+	   pos += 2;
+	 }	    
+#endif
+
 	 else if ((strcmp(argv[pos],"-nees") == 0) || (strcmp(argv[pos],"-xml") == 0)) {
 	   // allow user to specify load pattern other than current
 	   fileName = argv[pos+1];
@@ -1588,9 +1918,22 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
 	 theOutputStream = new DatabaseStream(theDatabase, tableName);
        } else if (eMode == BINARY_STREAM) {
 	 theOutputStream = new BinaryFileStream(fileName);
+       } else if (eMode == COLUMNAR_STREAM) {
+	 theOutputStream = new ColumnarFileStream(fileName, OVERWRITE,
+						  compressColumns, columnTolerance);
+#ifdef _HDF5
+       } else if (eMode == HDF5_STREAM) {
+	 theOutputStream = new H5FileStream(fileName);
+#endif
+       } else if (eMode == SERVER_STREAM) {
+	 theOutputStream = new ServerStream(serverPort, fileName);
        } else
 	 theOutputStream = new StandardStream();
 
+       theOutputStream = TclReduceRecorderStream(theOutputStream, echoTimeFlag, reduceTypes, reduceParameters);
+       if (queueDepth > 0)
+	 theOutputStream = new AsyncStream(theOutputStream, queueDepth);
+
        // Subtract one from dof and perpDirn for C indexing
        if (strcmp(argv[1],"Drift") == 0) 
 	 (*theRecorder) = new DriftRecorder(iNodes, jNodes, dof-1, perpDirn-1,
@@ -1609,9 +1952,10 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
      int wipeFlag = 0;
      double dT = 0.0;
      int saveToFile = 0;
+     const char *videoFileName = 0;
 
 	 if (argc < 7) {
-	     opserr << "WARNING recorder display title xLoc yLoc pixelsX pixelsY <-wipe> <-dT deltaT?> <-file fileName?>";
+	     opserr << "WARNING recorder display title xLoc yLoc pixelsX pixelsY <-wipe> <-dT deltaT?> <-file fileName?> <-offscreen videoFile?>";
 	     return TCL_ERROR;
 	 }    
 	 if (Tcl_GetInt(interp, argv[3], &xLoc) != TCL_OK)	
@@ -1642,8 +1986,17 @@ enum outputMode  {STANDARD_STREAM, DATA_STREAM, XML_STREAM, DATABASE_STREAM, BIN
          saveToFile = 1;
          pos+=2;
        }
+       // render off screen, the frames to a PPM stream file
+       else if (strcmp(argv[pos],"-offscreen") == 0 && pos+1 < argc) {
+         videoFileName = argv[pos+1];
+         pos+=2;
+       }
+       else
+         pos++;
      }
-     if (!saveToFile)
+     if (videoFileName != 0)
+	   (*theRecorder) = new TclFeViewer(width, height, videoFileName, theDomain, wipeFlag, interp, dT);
+     else if (!saveToFile)
 	   (*theRecorder) = new TclFeViewer(argv[2], xLoc, yLoc, width, height, theDomain, wipeFlag, interp, dT);
      else
 	   (*theRecorder) = new TclFeViewer(argv[2], xLoc, yLoc, width, height, fileName, theDomain, interp, dT);
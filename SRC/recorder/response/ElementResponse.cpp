@@ -29,45 +29,81 @@
 
 #include <ElementResponse.h>
 #include <Element.h>
+#include <ID.h>
+#include <Vector.h>
+#include <Matrix.h>
+
+// the sharing is private to each thread, as are the domains recording
+OPS_THREAD_LOCAL bool ElementResponse::sharing = false;
+OPS_THREAD_LOCAL std::map<ElementResponse::SharedKey, ElementResponse *> *ElementResponse::sharedResponses = 0;
+
+bool
+ElementResponse::SharedKey::operator<(const SharedKey &other) const
+{
+  if (theElement != other.theElement)
+    return theElement < other.theElement;
+  if (responseID != other.responseID)
+    return responseID < other.responseID;
+  if (type != other.type)
+    return type < other.type;
+  return size < other.size;
+}
+
+void
+ElementResponse::startSharing(void)
+{
+  if (sharedResponses == 0)
+    sharedResponses = new std::map<SharedKey, ElementResponse *>;
+  sharedResponses->clear();
+  sharing = true;
+}
+
+void
+ElementResponse::stopSharing(void)
+{
+  if (sharedResponses != 0)
+    sharedResponses->clear();
+  sharing = false;
+}
 
 ElementResponse::ElementResponse(Element *ele, int id):
-Response(), theElement(ele), responseID(id)
+Response(), theElement(ele), responseID(id), result(0)
 {
 
 }
 
 ElementResponse::ElementResponse(Element *ele, int id, int val):
-Response(val), theElement(ele), responseID(id)
+Response(val), theElement(ele), responseID(id), result(0)
 {
 
 }
 
 ElementResponse::ElementResponse(Element *ele, int id, double val):
-Response(val), theElement(ele), responseID(id)
+Response(val), theElement(ele), responseID(id), result(0)
 {
 
 }
 
 ElementResponse::ElementResponse(Element *ele, int id, const ID &val):
-Response(val), theElement(ele), responseID(id)
+Response(val), theElement(ele), responseID(id), result(0)
 {
 
 }
 
 ElementResponse::ElementResponse(Element *ele, int id, const Vector &val):
-Response(val), theElement(ele), responseID(id)
+Response(val), theElement(ele), responseID(id), result(0)
 {
 
 }
 
 ElementResponse::ElementResponse(Element *ele, int id, const Matrix &val):
-Response(val), theElement(ele), responseID(id)
+Response(val), theElement(ele), responseID(id), result(0)
 {
 
 }
 
 ElementResponse::ElementResponse(Element *ele, int id, const Vector &val1, const ID &val2)
- :Response(val1, val2), theElement(ele), responseID(id)
+ :Response(val1, val2), theElement(ele), responseID(id), result(0)
 {
 
 }
@@ -80,7 +116,41 @@ ElementResponse::~ElementResponse()
 int
 ElementResponse::getResponse(void)
 {
-  return theElement->getResponse(responseID, myInfo);
+  if (sharing == false)
+    return theElement->getResponse(responseID, myInfo);
+
+  SharedKey key;
+  key.theElement = theElement;
+  key.responseID = responseID;
+  key.type = myInfo.theType;
+  key.size = 0;
+  if (myInfo.theVector != 0)
+    key.size = myInfo.theVector->Size();
+  else if (myInfo.theMatrix != 0)
+    key.size = myInfo.theMatrix->noRows()*myInfo.theMatrix->noCols();
+  else if (myInfo.theID != 0)
+    key.size = myInfo.theID->Size();
+
+  std::map<SharedKey, ElementResponse *>::iterator it = sharedResponses->find(key);
+  if (it == sharedResponses->end()) {
+    result = theElement->getResponse(responseID, myInfo);
+    (*sharedResponses)[key] = this;
+    return result;
+  }
+
+  // computed already for another recorder
+  Information &theInfo = it->second->myInfo;
+  myInfo.theType = theInfo.theType;
+  myInfo.theInt = theInfo.theInt;
+  myInfo.theDouble = theInfo.theDouble;
+  if (theInfo.theID != 0)
+    myInfo.setID(*theInfo.theID);
+  if (theInfo.theVector != 0)
+    myInfo.setVector(*theInfo.theVector);
+  if (theInfo.theMatrix != 0)
+    myInfo.setMatrix(*theInfo.theMatrix);
+
+  return it->second->result;
 }
 
 int
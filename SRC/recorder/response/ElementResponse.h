@@ -26,12 +26,18 @@
 // Created: Oct 2000
 //
 // Description: This file contains the ElementResponse class interface
+//
+// While the recorders of a Domain record, between startSharing() and
+// stopSharing(), the response of an element for a responseID is obtained
+// from the element only once; the ElementResponse objects of the other
+// recorders asking for the same response copy it from the first.
 
 #ifndef ElementResponse_h
 #define ElementResponse_h
 
 #include <Response.h>
 #include <Information.h>
+#include <map>
 
 class Element;
 
@@ -55,9 +61,24 @@ public:
 	int getResponse(void);
 	int getResponseSensitivity(int gradNumber);
 
+	static void startSharing(void);
+	static void stopSharing(void);
+
 private:
 	Element *theElement;
 	int responseID;
+	int result;        // of the last call to the element
+
+	// element, responseID, type & size of the data
+	struct SharedKey {
+	  Element *theElement;
+	  int responseID;
+	  int type;
+	  int size;
+	  bool operator<(const SharedKey &other) const;
+	};
+	static OPS_THREAD_LOCAL bool sharing;
+	static OPS_THREAD_LOCAL std::map<SharedKey, ElementResponse *> *sharedResponses;
 };
 
 #endif
@@ -44,6 +44,10 @@
 #include <Matrix.h>
 #include <MatrixOperations.h>
 
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -80,6 +84,14 @@ theOpenSeesDomain(passedOpenSeesDomain)
 	printFlag = passedPrintFlag;
 	strcpy(fileName,passedFileName);
 	analysisTypeTag = passedAnalysisTypeTag;
+	batchSize = 0;
+}
+
+
+void
+ImportanceSamplingAnalysis::setBatchSize(int passedBatchSize)
+{
+	batchSize = passedBatchSize;
 }
 
 
@@ -95,6 +107,14 @@ ImportanceSamplingAnalysis::~ImportanceSamplingAnalysis()
 int 
 ImportanceSamplingAnalysis::analyze(void)
 {
+	// the restart file and the g-function values of each sample are
+	// written by the serial loop
+	if (batchSize > 0) {
+		if (analysisTypeTag != 3 && printFlag != 2)
+			return this->analyzeParallel();
+		opserr << "WARNING ImportanceSamplingAnalysis::analyze() - samples are evaluated in turn" << endln
+		       << " with saveGvalues or the restart file" << endln;
+	}
 
 	// Alert the user that the simulation analysis has started
 	opserr << "ImportanceSampling Analysis is running ... " << endln;
@@ -112,7 +132,6 @@ ImportanceSamplingAnalysis::analyze(void)
 	Vector z(numRV);
 	Vector u(numRV);
 	Vector randomArray(numRV);
-	static NormalRV aStdNormRV(1,0.0,1.0);
 	bool failureHasOccured = false;
 
 	det_covariance = pow(samplingStdv, numRV);
@@ -163,31 +182,11 @@ ImportanceSamplingAnalysis::analyze(void)
 	}
 
     
-    // get starting x values from parameter directly
-    for (int j = 0; j < numRV; j++) {
-        RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
-        int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
-        Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
-        
-        double rvVal = theRV->getStartValue();
-        if (analysisTypeTag == 2) {
-            rvVal = theRV->getMean();
-            opserr << "NOTE: The startPoint is set to the Mean due to the selected sampling analysis type." << endln;
-        }
-        x(j) = rvVal;
-        
-        // now we should update the parameter value
-        theParam->update(rvVal);
-    }
-    
 	// Transform start point into standard normal space
 	Vector startPointY(numRV);
-	result = theProbabilityTransformation->transform_x_to_u(startPointY);
-	if (result < 0) {
-	    opserr << "ImportanceSamplingAnalysis::analyze() - could not " << endln
-		   << " transform x to u. " << endln;
-	    return -1;
-    }
+	if (this->getStartPoint(x, startPointY) < 0)
+		return -1;
+
 
     
 	// Initial declarations
@@ -476,139 +475,440 @@ ImportanceSamplingAnalysis::analyze(void)
 	opserr << endln;
 
 
-	if (analysisTypeTag != 3) {
+	if (analysisTypeTag != 3)
+		this->printResults(resultsOutputFile, k, q_bar, cov_of_q_bar, responseStdv,
+				   responseCorrelation, failureHasOccured);
 
-		if (!failureHasOccured) {
-			opserr << "WARNING: Failure did not occur for any of the limit-state functions. " << endln;
-		}
 
-		LimitStateFunctionIter &lsfIter = theReliabilityDomain->getLimitStateFunctions();
-		LimitStateFunction *theLimitStateFunction;
-		for (int lsf = 0; lsf < numLsf; lsf++ ) {
-		//while ((theLimitStateFunction = lsfIter()) != 0) {
-            theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
-            int lsfTag = theLimitStateFunction->getTag();
+	// Print summary of results to screen 
+	opserr << "ImportanceSampling Analysis completed." << endln;
 
-			if ( q_bar(lsf) == 0.0 ) {
+	// Clean up
+	resultsOutputFile.close();
 
-				resultsOutputFile << "#######################################################################" << endln;
-				resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
-					<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
-				resultsOutputFile << "#                                                                     #" << endln;
-				resultsOutputFile << "#  Failure did not occur, or zero response!                           #" << endln;
-				resultsOutputFile << "#                                                                     #" << endln;
-				resultsOutputFile << "#######################################################################" << endln << endln << endln;
+	return 0;
+}
+
+
+
+// The samples are taken in rounds. In a round each process of OpenSeesMP,
+// which has built its own copy of the model, evaluates up to batchSize
+// samples drawn from its own random number stream (seeded with 1+pid), and
+// the sums of the processes are then added in the order of the processes
+// on each of them, so that all stop after the same round and the estimates
+// depend only on the number of processes and the batch size. Without MPI
+// there is one process and the rounds only set how often convergence is
+// checked.
+int 
+ImportanceSamplingAnalysis::analyzeParallel(void)
+{
+	int myPID = 0;
+	int np = 1;
+#ifdef _PARALLEL_INTERPRETERS
+	int mpiInitialized = 0;
+	MPI_Initialized(&mpiInitialized);
+	if (mpiInitialized) {
+		MPI_Comm_rank(MPI_COMM_WORLD, &myPID);
+		MPI_Comm_size(MPI_COMM_WORLD, &np);
+	}
+#endif
+
+	if (myPID == 0)
+		opserr << "ImportanceSampling Analysis is running on " << np
+		       << " processes, " << batchSize << " samples each per round ... " << endln;
+
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	Vector x(numRV);
+	Vector u(numRV);
+	Vector startPointY(numRV);
+	if (this->getStartPoint(x, startPointY) < 0)
+		return -1;
+
+	static const double twopi = 2.0*acos(-1.0);
+	double factor1 = 1.0 / ( pow(twopi,0.5*numRV));
+	double factor2 = factor1 / sqrt(pow(samplingStdv, numRV));
+
+	// the sums of a round: the number of samples, whether failure occured,
+	// then the sums of q and q*q, and the sums of g_i*g_j for the response
+	// correlation
+	int sizeSums = 2 + 2*numLsf + numLsf*numLsf;
+	double *mySums = new double[sizeSums];
+	double *allSums = new double[np*sizeSums];
+	double *sums = new double[sizeSums];
+	for (int i=0; i<sizeSums; i++)
+		sums[i] = 0.0;
+	double *sum_q = &sums[2];
+	double *sum_q_squared = &sums[2+numLsf];
+	double *crossSums = &sums[2+2*numLsf];
+
+	Vector g(numLsf);
+	Vector q_bar(numLsf);
+	Vector cov_of_q_bar(numLsf);
+	Vector responseStdv(numLsf);
+	Matrix responseCorrelation(numLsf,numLsf);
+
+	bool isFirstSimulation = true;
+	long int k = 0;
+	double govCov = 999.0;
+	bool failureHasOccured = false;
+
+	while ( (k < numberOfSimulations && govCov > targetCOV) || k < 2 ) {
+
+		// the samples of this process in the round
+		long int remaining = numberOfSimulations - k;
+		if (remaining < 2-k)
+			remaining = 2-k;
+		long int numSamples = remaining - (long int)myPID*batchSize;
+		if (numSamples > batchSize)
+			numSamples = batchSize;
+
+		for (int i=0; i<sizeSums; i++)
+			mySums[i] = 0.0;
+
+		for (long int n = 0; n < numSamples; n++) {
+			int result;
+			if (isFirstSimulation)
+				result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV, 1+myPID);
+			else
+				result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+			isFirstSimulation = false;
+			if (result < 0) {
+				opserr << "ImportanceSamplingAnalysis::analyzeParallel() - could not generate" << endln
+					<< " random numbers for simulation." << endln;
+				delete [] mySums; delete [] allSums; delete [] sums;
+				return -1;
 			}
-			else {
+			const Vector &randomArray = theRandomNumberGenerator->getGeneratedNumbers();
 
-				// Some declarations
-				double beta_sim, pf_sim, cov_sim;
-				int num_sim;
+			u = startPointY;
+			u.addVector(1.0, randomArray, samplingStdv);
 
+			if (theProbabilityTransformation->transform_u_to_x(u, x) < 0) {
+				opserr << "ImportanceSamplingAnalysis::analyzeParallel() - could not transform u to x. " << endln;
+				delete [] mySums; delete [] allSums; delete [] sums;
+				return -1;
+			}
 
-				// Set tag of "active" limit-state function
-				theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
+			for (int j = 0; j < numRV; j++) {
+				int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+				Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+				theParam->update( x(j) );
+			}
 
+			if (theGFunEvaluator->setVariables() < 0) {
+				opserr << "ImportanceSamplingAnalysis::analyzeParallel() - " << endln
+					<< " could not set variables in namespace. " << endln;
+				delete [] mySums; delete [] allSums; delete [] sums;
+				return -1;
+			}
 
-				// Store results
-				if (analysisTypeTag == 1) {
-					beta_sim = -aStdNormRV.getInverseCDFvalue(q_bar(lsf));
-					pf_sim	 = q_bar(lsf);
-					cov_sim	 = cov_of_q_bar(lsf);
-					num_sim  = k;
-					// Use a recorder -- MHS 10/7/2011
-					/*
-					theLimitStateFunction->setSIM_beta(beta_sim);
-					theLimitStateFunction->setSIM_pfsim(pf_sim);
-					theLimitStateFunction->setSIM_pfcov(cov_sim);
-					theLimitStateFunction->setSIM_numsim(num_sim);
-					*/
-				}
+			bool FEconvergence = true;
+			if (theGFunEvaluator->runAnalysis() < 0) {
+				opserr << "ERROR ImportanceSamplingAnalysis -- error running analysis" << endln;
+				FEconvergence = false;
+			}
 
+			// the ratio of the joint distributions at the u-point
+			double phi = factor1 * exp( -0.5 * (u ^ u) );
+			double temp2 = 0.0;
+			for (int i = 0; i < numRV; i++) {
+				double uy = u(i)-startPointY(i);
+				temp2 += uy*uy;
+			}
+			temp2 /= samplingStdv*samplingStdv;
+			double h = factor2 * exp( -0.5 * temp2 );
 
-				// Print results to the output file
+			mySums[0] += 1.0;
+			for (int lsf = 0; lsf < numLsf; lsf++ ) {
+				LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+				theReliabilityDomain->setTagOfActiveLimitStateFunction(theLimitStateFunction->getTag());
+				theGFunEvaluator->setExpression(theLimitStateFunction->getExpression());
+
+				double gFunctionValue = theGFunEvaluator->evaluateExpression();
+				if (!FEconvergence)
+					gFunctionValue = -1.0;
+				g(lsf) = gFunctionValue;
+
+				double q;
 				if (analysisTypeTag == 1) {
-					resultsOutputFile << "#######################################################################" << endln;
-					resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
-						<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#  Reliability index beta: ............................ " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<beta_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Estimated probability of failure pf_sim: ........... " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<pf_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Number of simulations: ............................. " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<num_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Coefficient of variation (of pf): .................. " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<cov_sim 
-						<< "  #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#######################################################################" << endln << endln << endln;
+					q = (gFunctionValue < 0.0) ? phi / h : 0.0;
+					if (gFunctionValue < 0.0)
+						mySums[1] = 1.0;
 				}
 				else {
-					resultsOutputFile << "#######################################################################" << endln;
-					resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
-						<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#  Estimated mean: .................................... " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<q_bar(lsf) 
-						<< "  #" << endln;
-					resultsOutputFile << "#  Estimated standard deviation: ...................... " 
-						<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<responseStdv(lsf) 
-						<< "  #" << endln;
-					resultsOutputFile << "#                                                                     #" << endln;
-					resultsOutputFile << "#######################################################################" << endln << endln << endln;
+					q = gFunctionValue;
+					mySums[1] = 1.0;
 				}
+				mySums[2+lsf] += q;
+				mySums[2+numLsf+lsf] += q*q;
 			}
+
+			if (analysisTypeTag == 2)
+				for (int i = 0; i < numLsf; i++)
+					for (int j = i+1; j < numLsf; j++)
+						mySums[2+2*numLsf+i*numLsf+j] += g(i)*g(j);
 		}
 
-		if (analysisTypeTag == 2) {
-			resultsOutputFile << "#######################################################################" << endln;
-			resultsOutputFile << "#  RESPONSE CORRELATION COEFFICIENTS                                  #" << endln;
-			resultsOutputFile << "#                                                                     #" << endln;
-			if (numLsf <= 1) {
-				resultsOutputFile << "#  Only one limit-state function!                                     #" << endln;
+		// add the sums of the processes in the order of the processes
+#ifdef _PARALLEL_INTERPRETERS
+		if (np > 1)
+			MPI_Allgather(mySums, sizeSums, MPI_DOUBLE, allSums, sizeSums, MPI_DOUBLE, MPI_COMM_WORLD);
+		else
+#endif
+		for (int i=0; i<sizeSums; i++)
+			allSums[i] = mySums[i];
+
+		for (int p=0; p<np; p++) {
+			double *theSums = &allSums[p*sizeSums];
+			sums[0] += theSums[0];
+			if (theSums[1] != 0.0)
+				sums[1] = 1.0;
+			for (int i=2; i<sizeSums; i++)
+				sums[i] += theSums[i];
+		}
+
+		k = (long int)sums[0];
+		failureHasOccured = (sums[1] != 0.0);
+
+		// estimates after the round
+		for (int lsf = 0; lsf < numLsf; lsf++) {
+			if (sum_q[lsf] > 0.0) {
+				q_bar(lsf) = sum_q[lsf]/k;
+				double variance_of_q_bar = ( sum_q_squared[lsf]/k - q_bar(lsf)*q_bar(lsf) ) / k;
+				if (variance_of_q_bar < 0.0)
+					variance_of_q_bar = 0.0;
+				cov_of_q_bar(lsf) = sqrt(variance_of_q_bar) / q_bar(lsf);
+
+				if (analysisTypeTag == 2) {
+					double responseVariance = 1.0;
+					if (k > 1)
+						responseVariance = ( sum_q_squared[lsf] - sum_q[lsf]/k * sum_q[lsf] ) / (k-1);
+					if (responseVariance > 0.0)
+						responseStdv(lsf) = sqrt(responseVariance);
+				}
 			}
-			else {
-				resultsOutputFile << "#   gFun   gFun     Correlation                                       #" << endln;
-				resultsOutputFile.setf(ios::fixed, ios::floatfield);
-
-				LimitStateFunctionIter lsfIterI = theReliabilityDomain->getLimitStateFunctions();
-				LimitStateFunctionIter lsfIterJ = theReliabilityDomain->getLimitStateFunctions();
-				LimitStateFunction *lsfI, *lsfJ;
-				for (int i = 0; i < numLsf; i++) {
-				//while ((lsfI = lsfIterI()) != 0) {
-                    lsfI = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(i);
-                    int iTag = lsfI->getTag();
-
-                    for (int j=i+1; j < numLsf; j++) {
-                    //while ((lsfJ = lsfIterJ()) != 0) {
-                        lsfJ = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(j);
-                        int jTag = lsfJ->getTag();
-
-                        resultsOutputFile << "#    " <<setw(3)<< iTag <<"    "<<setw(3)<< jTag <<"     ";
-                        if (responseCorrelation(i,j)<0.0) { resultsOutputFile << "-"; }
-                        else { resultsOutputFile << " "; }
-                        resultsOutputFile <<setprecision(7)<<setw(11)<<fabs(responseCorrelation(i,j));
-                        resultsOutputFile << "                                      #" << endln;
-                    }
+		}
+
+		if (analysisTypeTag == 2) {
+			for (int i=0; i<numLsf; i++) {
+				for (int j=i+1; j<numLsf; j++) {
+					double denumerator = (sum_q_squared[i]-sum_q[i]/k*sum_q[i])*(sum_q_squared[j]-sum_q[j]/k*sum_q[j]);
+					if (denumerator <= 0.0)
+						responseCorrelation(i,j) = 0.0;
+					else
+						responseCorrelation(i,j) = (crossSums[i*numLsf+j]-sum_q[i]/k*sum_q[j]) / sqrt(denumerator);
 				}
 			}
-			resultsOutputFile << "#                                                                     #" << endln;
-			resultsOutputFile << "#######################################################################" << endln << endln << endln;
 		}
 
+		govCov = 999.0;
+		if (failureHasOccured) {
+			govCov = 0.0;
+			for (int lsf=0; lsf<numLsf; lsf++)
+				if (cov_of_q_bar(lsf) > govCov)
+					govCov = cov_of_q_bar(lsf);
+			if (govCov == 0.0)
+				govCov = 999.0;
+		}
+
+		// Keep the user posted
+		if (printFlag == 1 && myPID == 0) {
+			char myString[80];
+			sprintf(myString,"%li",k);
+			opserr << "Samples: " << myString << endln;
+			for (int lsf = 0; lsf < numLsf; lsf++) {
+				int lsfTag = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf)->getTag();
+				sprintf(myString," GFun #%d, estimate:%15.10f, cov:%15.10f",lsfTag,q_bar(lsf),cov_of_q_bar(lsf));
+				opserr << myString << endln;
+			}
+		}
 	}
 
+	if (myPID == 0) {
+		ofstream resultsOutputFile( fileName, ios::out );
+		this->printResults(resultsOutputFile, k, q_bar, cov_of_q_bar, responseStdv,
+				   responseCorrelation, failureHasOccured);
+		resultsOutputFile.close();
 
-	// Print summary of results to screen 
-	opserr << "ImportanceSampling Analysis completed." << endln;
+		opserr << "ImportanceSampling Analysis completed." << endln;
+	}
 
-	// Clean up
-	resultsOutputFile.close();
+	delete [] mySums;
+	delete [] allSums;
+	delete [] sums;
+
+	return 0;
+}
+
+
+// sets the parameters to the start point of the sampling, the mean for
+// response statistics, and transforms it into standard normal space
+int
+ImportanceSamplingAnalysis::getStartPoint(Vector &x, Vector &startPointY)
+{
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+
+    // get starting x values from parameter directly
+    for (int j = 0; j < numRV; j++) {
+        RandomVariable *theRV = theReliabilityDomain->getRandomVariablePtrFromIndex(j);
+        int param_indx = theReliabilityDomain->getParameterIndexFromRandomVariableIndex(j);
+        Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(param_indx);
+        
+        double rvVal = theRV->getStartValue();
+        if (analysisTypeTag == 2) {
+            rvVal = theRV->getMean();
+            opserr << "NOTE: The startPoint is set to the Mean due to the selected sampling analysis type." << endln;
+        }
+        x(j) = rvVal;
+        
+        // now we should update the parameter value
+        theParam->update(rvVal);
+    }
+    
+	// Transform start point into standard normal space
+	int result = theProbabilityTransformation->transform_x_to_u(startPointY);
+	if (result < 0) {
+	    opserr << "ImportanceSamplingAnalysis::getStartPoint() - could not " << endln
+		   << " transform x to u. " << endln;
+	    return -1;
+    }
 
 	return 0;
 }
 
+
+// prints the estimates of the limit-state functions after k samples to
+// the results file
+void
+ImportanceSamplingAnalysis::printResults(ofstream &resultsOutputFile, long int k,
+					 const Vector &q_bar, const Vector &cov_of_q_bar,
+					 const Vector &responseStdv, const Matrix &responseCorrelation,
+					 bool failureHasOccured)
+{
+	static NormalRV aStdNormRV(1,0.0,1.0);
+	int numLsf = theReliabilityDomain->getNumberOfLimitStateFunctions();
+
+	if (!failureHasOccured) {
+		opserr << "WARNING: Failure did not occur for any of the limit-state functions. " << endln;
+	}
+
+	LimitStateFunction *theLimitStateFunction;
+	for (int lsf = 0; lsf < numLsf; lsf++ ) {
+	//while ((theLimitStateFunction = lsfIter()) != 0) {
+        theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(lsf);
+        int lsfTag = theLimitStateFunction->getTag();
+
+		if ( q_bar(lsf) == 0.0 ) {
+
+			resultsOutputFile << "#######################################################################" << endln;
+			resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
+				<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
+			resultsOutputFile << "#                                                                     #" << endln;
+			resultsOutputFile << "#  Failure did not occur, or zero response!                           #" << endln;
+			resultsOutputFile << "#                                                                     #" << endln;
+			resultsOutputFile << "#######################################################################" << endln << endln << endln;
+		}
+		else {
+
+			// Some declarations
+			double beta_sim, pf_sim, cov_sim;
+			int num_sim;
+
+
+			// Set tag of "active" limit-state function
+			theReliabilityDomain->setTagOfActiveLimitStateFunction(lsfTag);
+
+
+			// Store results
+			if (analysisTypeTag == 1) {
+				beta_sim = -aStdNormRV.getInverseCDFvalue(q_bar(lsf));
+				pf_sim	 = q_bar(lsf);
+				cov_sim	 = cov_of_q_bar(lsf);
+				num_sim  = k;
+				// Use a recorder -- MHS 10/7/2011
+				/*
+				theLimitStateFunction->setSIM_beta(beta_sim);
+				theLimitStateFunction->setSIM_pfsim(pf_sim);
+				theLimitStateFunction->setSIM_pfcov(cov_sim);
+				theLimitStateFunction->setSIM_numsim(num_sim);
+				*/
+			}
+
+
+			// Print results to the output file
+			if (analysisTypeTag == 1) {
+				resultsOutputFile << "#######################################################################" << endln;
+				resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
+					<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
+				resultsOutputFile << "#                                                                     #" << endln;
+				resultsOutputFile << "#  Reliability index beta: ............................ " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<beta_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Estimated probability of failure pf_sim: ........... " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<pf_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Number of simulations: ............................. " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<num_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Coefficient of variation (of pf): .................. " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<cov_sim 
+					<< "  #" << endln;
+				resultsOutputFile << "#                                                                     #" << endln;
+				resultsOutputFile << "#######################################################################" << endln << endln << endln;
+			}
+			else {
+				resultsOutputFile << "#######################################################################" << endln;
+				resultsOutputFile << "#  SAMPLING ANALYSIS RESULTS, LIMIT-STATE FUNCTION NUMBER   "
+					<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsfTag <<"      #" << endln;
+				resultsOutputFile << "#                                                                     #" << endln;
+				resultsOutputFile << "#  Estimated mean: .................................... " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<q_bar(lsf) 
+					<< "  #" << endln;
+				resultsOutputFile << "#  Estimated standard deviation: ...................... " 
+					<<setiosflags(ios::left)<<setprecision(5)<<setw(12)<<responseStdv(lsf) 
+					<< "  #" << endln;
+				resultsOutputFile << "#                                                                     #" << endln;
+				resultsOutputFile << "#######################################################################" << endln << endln << endln;
+			}
+		}
+	}
+
+	if (analysisTypeTag == 2) {
+		resultsOutputFile << "#######################################################################" << endln;
+		resultsOutputFile << "#  RESPONSE CORRELATION COEFFICIENTS                                  #" << endln;
+		resultsOutputFile << "#                                                                     #" << endln;
+		if (numLsf <= 1) {
+			resultsOutputFile << "#  Only one limit-state function!                                     #" << endln;
+		}
+		else {
+			resultsOutputFile << "#   gFun   gFun     Correlation                                       #" << endln;
+			resultsOutputFile.setf(ios::fixed, ios::floatfield);
+
+			LimitStateFunctionIter lsfIterI = theReliabilityDomain->getLimitStateFunctions();
+			LimitStateFunctionIter lsfIterJ = theReliabilityDomain->getLimitStateFunctions();
+			LimitStateFunction *lsfI, *lsfJ;
+			for (int i = 0; i < numLsf; i++) {
+			//while ((lsfI = lsfIterI()) != 0) {
+                lsfI = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(i);
+                int iTag = lsfI->getTag();
+
+                for (int j=i+1; j < numLsf; j++) {
+                //while ((lsfJ = lsfIterJ()) != 0) {
+                    lsfJ = theReliabilityDomain->getLimitStateFunctionPtrFromIndex(j);
+                    int jTag = lsfJ->getTag();
+
+                    resultsOutputFile << "#    " <<setw(3)<< iTag <<"    "<<setw(3)<< jTag <<"     ";
+                    if (responseCorrelation(i,j)<0.0) { resultsOutputFile << "-"; }
+                    else { resultsOutputFile << " "; }
+                    resultsOutputFile <<setprecision(7)<<setw(11)<<fabs(responseCorrelation(i,j));
+                    resultsOutputFile << "                                      #" << endln;
+                }
+			}
+		}
+		resultsOutputFile << "#                                                                     #" << endln;
+		resultsOutputFile << "#######################################################################" << endln << endln << endln;
+	}
+
+}
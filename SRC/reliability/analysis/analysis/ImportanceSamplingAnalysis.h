@@ -65,6 +65,10 @@ public:
 	
 	int analyze(void);
 
+	// samples per process and round of the sampling across the processes
+	// of OpenSeesMP, 0 to take the samples in turn
+	void setBatchSize(int batchSize);
+
 protected:
 	
 private:
@@ -80,6 +84,14 @@ private:
 	int printFlag;
 	char fileName[256];
 	int analysisTypeTag;
+	int batchSize;
+
+	int analyzeParallel(void);
+	int getStartPoint(Vector &x, Vector &startPointY);
+	void printResults(ofstream &resultsOutputFile, long int k,
+			  const Vector &q_bar, const Vector &cov_of_q_bar,
+			  const Vector &responseStdv, const Matrix &responseCorrelation,
+			  bool failureHasOccured);
 };
 
 #endif
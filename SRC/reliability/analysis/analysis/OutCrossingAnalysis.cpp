@@ -43,6 +43,7 @@
 #include <string.h>
 #include <NormalRV.h>
 #include <LimitStateFunctionIter.h>
+#include <LimitStateFunction.h>
 
 #include <fstream>
 #include <iomanip>
@@ -53,6 +54,10 @@ using std::setw;
 using std::setprecision;
 using std::setiosflags;
 
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 OutCrossingAnalysis::OutCrossingAnalysis(
 				ReliabilityDomain *theRelDom,
 				FunctionEvaluator *theGFunEval,
@@ -83,6 +88,7 @@ OutCrossingAnalysis::OutCrossingAnalysis(
 
 	integralTolerance = p_integralTolerance; // default value. 
 	useFirstDesignPt = p_useFirstDesignPt; // default 
+	parallel = false;
 }
 
 OutCrossingAnalysis::~OutCrossingAnalysis()
@@ -99,18 +105,8 @@ OutCrossingAnalysis::analyze(void)
 
 	// Declare variables used in this method
 	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
-	static NormalRV aStdNormRV(1,0.0,1.0);
-	int numVel, i, j, k, kk, nodeNumber, dofNumber; 
-	double dgduValue, accuSum;
-	Vector uStar2(numRV);
-	Vector alpha(numRV), alpha2(numRV), alpha_k(numRV), alpha_kk(numRV);
-	double beta1, beta2;
-	double pf1, pf2;
-//	int n_2;
-//	double a, b, integral, h, fa, fb, sum_fx2j, sum_fx2j_1, Pmn1;
-//	double a, b, c, integral, fa, fb, fc;
-	double a, Pmn1;
-	char string[500];
+	int i, j, k, kk; 
+	Vector alpha_k(numRV), alpha_kk(numRV);
 
 
 	// Determine number of points
@@ -127,12 +123,31 @@ OutCrossingAnalysis::analyze(void)
 	Vector ED(numPoints);
 	Vector pf(numPoints);
 	Vector beta(numPoints);
+	Vector status(numPoints);
 	Matrix Pmn2(numPoints,numPoints);
 	Matrix allAlphas(numRV,numPoints);
 
 
-	// Open output file and start writing to it
-	ofstream outputFile( fileName, ios::out );
+	// With the parallel option each process of OpenSeesMP evaluates every
+	// np-th time point on its own copy of the model
+	int myPID = 0;
+	int np = 1;
+#ifdef _PARALLEL_INTERPRETERS
+	if (parallel) {
+		int mpiInitialized = 0;
+		MPI_Initialized(&mpiInitialized);
+		if (mpiInitialized) {
+			MPI_Comm_rank(MPI_COMM_WORLD, &myPID);
+			MPI_Comm_size(MPI_COMM_WORLD, &np);
+		}
+	}
+#endif
+
+
+	// Open output file and start writing to it, process 0 writes it
+	ofstream outputFile;
+	if (myPID == 0)
+		outputFile.open( fileName, ios::out );
 
 
 	// Loop over number of limit-state functions and perform analysis
@@ -152,6 +167,11 @@ OutCrossingAnalysis::analyze(void)
 		outputFile << "#  OUT-CROSSING RESULTS, LIMIT-STATE FUNCTION NUMBER      "
 			<<setiosflags(ios::left)<<setprecision(1)<<setw(4)<<lsf <<"        #" << endln;
 		outputFile << "#                                                                     #" << endln;
+		outputFile << "#         Reliability    Estimated         Mean         Duration      #" << endln;
+		outputFile << "#           index         failure       out-crossing    of single     #" << endln;
+		outputFile << "#  Time      beta        probability       rate         excursion     #" << endln;
+		outputFile << "#                                                                     #" << endln;
+		outputFile.flush();
 
 
 
@@ -161,242 +181,65 @@ OutCrossingAnalysis::analyze(void)
 
 		// Loop over the intervals where probabilities are to be computed
 		bool oneFailed = false;
-		bool DSPTfailed;
-		for (i=1; i<=numPoints; i++) {
-
-			// First assume that we find the design point(s)
-			DSPTfailed = false;
-
-			// Set 'nsteps' in the GFunEvaluator 
-			theGFunEvaluator->setNsteps(stepsToStart+(i-1)*sampleFreq);
-
-
-			// Inform the user
-			char printTime[23];
-			sprintf(printTime, "%14.8f", ((stepsToStart+(i-1)*sampleFreq)*dt) );
-			if (analysisType == 1) {
-				strcpy(string,theLimitStateFunction->getExpression());
-				opserr << " ...evaluating -G1=" << string << " at time " << printTime << " ..." << endln;
-			}
-			else {
-				opserr << " ...evaluating performance function at time " << printTime << " ..." << endln;
-			}
-
-
-			// Find the design point for the original limit-state function
-			if (theFindDesignPointAlgorithm->findDesignPoint() < 0){
-				opserr << "OutCrossingAnalysis::analyze() - failed while finding the" << endln
-					<< " design point for limit-state function number " << lsf << "." << endln;
-				DSPTfailed = true;
-				oneFailed = true;
-			}
-
-
-			// Start writing to output file
-			if (i==1) {
-				outputFile << "#         Reliability    Estimated         Mean         Duration      #" << endln;
-				outputFile << "#           index         failure       out-crossing    of single     #" << endln;
-				outputFile << "#  Time      beta        probability       rate         excursion     #" << endln;
-				outputFile << "#                                                                     #" << endln;
-				outputFile.flush();
+		Vector alpha(numRV);
+		nu.Zero();
+		ED.Zero();
+		pf.Zero();
+		beta.Zero();
+		status.Zero();
+		allAlphas.Zero();
+
+		if (np == 1) {
+			// the results of each point are printed as soon as they are known
+			for (i=1; i<=numPoints; i++) {
+				status(i-1) = this->evaluateTimePoint(i, theLimitStateFunction, alpha,
+								      beta(i-1), pf(i-1), nu(i-1), ED(i-1));
+				for (j=0; j<numRV; j++)
+					allAlphas(j,i-1) = alpha(j);
+				this->printTimePoint(outputFile, i, status(i-1), beta(i-1), pf(i-1), nu(i-1), ED(i-1));
 			}
-
-			if (!DSPTfailed) {
-
-
-				// Get results from the "find design point algorithm"
-				const Vector &uStar = theFindDesignPointAlgorithm->get_u();
-				alpha = theFindDesignPointAlgorithm->get_alpha();
-
-
-				// Put all alphas into rows in a matrix
-				for (j=0; j<alpha.Size(); j++) {
+		}
+		else {
+			for (i=1+myPID; i<=numPoints; i+=np) {
+				status(i-1) = this->evaluateTimePoint(i, theLimitStateFunction, alpha,
+								      beta(i-1), pf(i-1), nu(i-1), ED(i-1));
+				for (j=0; j<numRV; j++)
 					allAlphas(j,i-1) = alpha(j);
-				}
-
-		
-				// Postprocessing (note that g = -g1)
-				beta(i-1) = alpha ^ uStar;
-				pf(i-1) = 1.0 - aStdNormRV.getCDFvalue(beta(i-1));
-				beta1 = -beta(i-1);
-				pf1 = 1.0 - pf(i-1);
-
-
-				if (analysisType == 1) {
-
-				//  ====== possible options: using first design point as the beginning of this second search.. 
-					if (useFirstDesignPt) {
-
-						Vector xStar = theFindDesignPointAlgorithm->get_x();
-                        // KRM -- parameters now handle all values
-						//theFindDesignPointAlgorithm->setStartPt(&xStar);
-						
-					}
-					
-				 // ============ by default,start from origin of the standard normal space ====================	
-
-
-					// Get the 'dgdu' vector from the sensitivity evaluator
-					// (The returned matrix containes 'node#' 'dir#' 'dgdu' in rows)
-					
-					// This should be retooled -- MHS 10/7/2011
-					//const Matrix &DgDdispl = theGradGEvaluator->getDgDdispl();
-					Matrix DgDdispl(5,5); // So that it compiles
-
-
-					// Add extra term to limit-state function
-					// (should add an alternative option where user give additional limit-state functions)
-					// (... because this works only when g is linear in u)
-					numVel = DgDdispl.noRows();
-					accuSum = 0.0;
-
-					char expressionPtr[200];
-
-					for (j=0; j<numVel; j++) {
-
-						nodeNumber = (int)DgDdispl(j,0);
-						dofNumber = (int)DgDdispl(j,1);
-						dgduValue = DgDdispl(j,2);
-
-						char expression[200];
-						sprintf(expression,"+(%20.14e)*(%20.14e)*\\$ud(%d,%d)",littleDeltaT, dgduValue, nodeNumber, dofNumber);
-						strcpy(expressionPtr,expression);
-
-						// Add it to the limit-state function
-						// There's a better way to do this -- MHS 10/7/2011
-						//theLimitStateFunction->addExpression(expressionPtr);
-					}
-
-					// Inform the user
-					strcpy(string,theLimitStateFunction->getExpression());
-					opserr << " ...evaluating G2=" << string << endln;
-
-
-					// Find the design point for the edited limit-state function
-					if (theFindDesignPointAlgorithm->findDesignPoint() < 0) {
-						opserr << "OutCrossingAnalysis::analyze() - failed while finding the" << endln
-							<< " design point for limit-state function number " << lsf << "." << endln;
-						DSPTfailed = true;
-						oneFailed = true;
-					}
-
-
-					// Zero out the added expression in the limit-state function
-					// There's a better way to do this -- MHS 10/7/2011
-					//theLimitStateFunction->removeAddedExpression();
-
-
-					if (!DSPTfailed) {
-
-						// Get results from the "find design point algorithm"
-						uStar2 = theFindDesignPointAlgorithm->get_u();
-						alpha2 = theFindDesignPointAlgorithm->get_alpha();
-
-
-						// Postprocessing (remember; here is an assumption that the mean point is in the safe domain)
-						beta2 = (alpha2 ^ uStar2);  /////// ??????????????????????????
-						pf2 = 1.0 - aStdNormRV.getCDFvalue(beta2);
-					}
-					else {
-						outputFile << "#  Second limit-state function did not converge.                      #" << endln;
-						
-						// NOTE - need to provide a value for beta2 or initialize in declaration
-					}
-				
-					// Post-processing to find parallel system probability
-					// use CorrelatedStandardNormal class
-					CorrelatedStandardNormal phi2(0.0);
-					phi2.setCorrelation( alpha ^ alpha2 );
-					Pmn1 = phi2.getCDF(-beta1,-beta2);
-					
-					a = -(alpha ^ alpha2);	// Interval start  ??????????????????????
-					/*
-					c = 0.0;				// Interval end
-					b = (c+a)/2.0;
-					fa = functionToIntegrate(a,beta1,beta2);
-					fb = functionToIntegrate(b,beta1,beta2);
-					fc = functionToIntegrate(c,beta1,beta2);
-					integral = this->getAdaptiveIntegralValue(integralTolerance,a,c,fa,fb,fc,beta1,beta2);
-					Pmn1 = aStdNormRV.getCDFvalue(-beta1)*aStdNormRV.getCDFvalue(-beta2) - integral;
-					*/
-				
-				}
-				else {
-					// Use Heonsang's method to find new alpha and beta
-					beta2 = -beta1;
-					alpha2(0) = alpha(0) - littleDeltaT/Dt * ( alpha(0)-0.0 );
-					for (j=1; j<alpha.Size(); j++) {
-						alpha2(j) = alpha(j) - littleDeltaT/Dt * ( alpha(j)-alpha(j-1) );
-					}
-					
-					// Post-processing to find parallel system probability
-					a = -1.0*(alpha ^ alpha2)/alpha2.Norm();  
-				
-					double pi = acos(-1.0);
-					Pmn1 = 1.0/(2.0*pi) * exp(-beta2*beta2*0.5) * (asin(a) + pi/2.0);
-
-				}
-
-
-				// POST-PROCESSING
-
-				// Mean out-crossing rate
-				if (Pmn1<1.0e-10) {
-					opserr << "WARNING: Zero or negative parallel probability: " << endln
-						<< " The correlation is probably too high! " << endln;
-				}
-				nu(i-1) = Pmn1 / littleDeltaT;
-				
-				opserr<<"nu(i-1) is:" <<nu(i-1)<<endln;
-
-				// Duration of single excursion
-				if (fabs(nu(i-1))<1.0e-9) {
-					ED(i-1) = 999999.0;
-				}
-				else {
-					ED(i-1) = pf(i-1)/nu(i-1);
-				}
-
-				
-				// Print the results to file right away...
-				outputFile.setf( ios::fixed, ios::floatfield );
-
-				outputFile << "#  " <<setprecision(2)<<setw(9)<<((stepsToStart+(i-1)*sampleFreq)*dt);
-				
-				if (beta(i-1)<0.0) { outputFile << "-"; }
-				else { outputFile << " "; }
-				outputFile <<setprecision(7)<<setw(11)<<fabs(beta(i-1));
-				
-				outputFile.setf( ios::scientific, ios::floatfield );
-				if (pf(i-1)<0.0) { outputFile << "-"; }
-				else { outputFile << " "; }
-				outputFile <<setprecision(4)<<setw(16)<<fabs(pf(i-1));
-				
-				if (nu(i-1)<0.0) { outputFile << "-"; }
-				else { outputFile << " "; }
-				outputFile <<setprecision(5)<<setw(13)<<fabs(nu(i-1));
-				
-				if (ED(i-1)<0.0) { outputFile << "-"; }
-				else { outputFile << " "; }
-				outputFile <<setprecision(3)<<setw(10)<<fabs(ED(i-1));
-				
-				outputFile.setf( ios::fixed, ios::floatfield );
-				outputFile<<"    #" << endln;
-				outputFile.flush();
-
-
-				// Inform the user
-				char mystring[400];
-				sprintf(mystring, " ... beta(G1)=%16.8f, beta(G2)=%16.8f, rate=%16.8e, rho=%16.8e",beta1,beta2,nu(i-1),a);
-				opserr << mystring << endln;
+			}
 
+#ifdef _PARALLEL_INTERPRETERS
+			// the points of the other processes are zero, the sums are the results
+			int numValues = (5+numRV)*numPoints;
+			Vector myValues(numValues);
+			Vector allValues(numValues);
+			for (i=0; i<numPoints; i++) {
+				myValues(i) = status(i);
+				myValues(numPoints+i) = beta(i);
+				myValues(2*numPoints+i) = pf(i);
+				myValues(3*numPoints+i) = nu(i);
+				myValues(4*numPoints+i) = ED(i);
+				for (j=0; j<numRV; j++)
+					myValues((5+j)*numPoints+i) = allAlphas(j,i);
 			}
-			else {
-				outputFile << "#  First limit-state function did not converge.                       #" << endln;
+			MPI_Allreduce(&myValues(0), &allValues(0), numValues, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+			for (i=0; i<numPoints; i++) {
+				status(i) = allValues(i);
+				beta(i) = allValues(numPoints+i);
+				pf(i) = allValues(2*numPoints+i);
+				nu(i) = allValues(3*numPoints+i);
+				ED(i) = allValues(4*numPoints+i);
+				for (j=0; j<numRV; j++)
+					allAlphas(j,i) = allValues((5+j)*numPoints+i);
 			}
+#endif
 
+			for (i=1; i<=numPoints; i++)
+				this->printTimePoint(outputFile, i, status(i-1), beta(i-1), pf(i-1), nu(i-1), ED(i-1));
+		}
 
-		} // Done looping over points on the time axis
+		for (i=0; i<numPoints; i++)
+			if (status(i) != 0.0)
+				oneFailed = true;
 
 
 		if (!oneFailed) {
@@ -430,7 +273,7 @@ OutCrossingAnalysis::analyze(void)
 			for (k=0; k<pf.Size(); k++) {
 				for (kk=0; kk<pf.Size(); kk++) {
 					// Extract alpha vectors
-					for (j=0; j<alpha.Size(); j++) {
+					for (j=0; j<numRV; j++) {
 						alpha_k(j) = allAlphas(j,k);
 						alpha_kk(j) = allAlphas(j,kk);
 					}
@@ -510,6 +353,252 @@ OutCrossingAnalysis::analyze(void)
 }
 
 
+void
+OutCrossingAnalysis::setParallel(bool flag)
+{
+	parallel = flag;
+}
+
+
+// finds the design point(s) at the i-th point on the time axis and the results
+// there; returns 0, 1 if the first and 2 if the second design point search failed
+int
+OutCrossingAnalysis::evaluateTimePoint(int i, LimitStateFunction *theLimitStateFunction,
+				       Vector &alpha, double &beta, double &pf, double &nu, double &ED)
+{
+	int numRV = theReliabilityDomain->getNumberOfRandomVariables();
+	static NormalRV aStdNormRV(1,0.0,1.0);
+	int numVel, j, nodeNumber, dofNumber; 
+	double dgduValue, accuSum;
+	Vector uStar2(numRV);
+	Vector alpha2(numRV);
+	double beta1, beta2 = 0.0;
+	double pf1, pf2;
+	double a, Pmn1;
+	char string[500];
+	int lsf = theLimitStateFunction->getTag();
+	int result = 0;
+
+	double dt = theGFunEvaluator->getDt();  // integration time step
+	double Dt = dt*impulseFreq;              // time between impuses.
+
+	// Set 'nsteps' in the GFunEvaluator 
+	theGFunEvaluator->setNsteps(stepsToStart+(i-1)*sampleFreq);
+
+
+	// Inform the user
+	char printTime[23];
+	sprintf(printTime, "%14.8f", ((stepsToStart+(i-1)*sampleFreq)*dt) );
+	if (analysisType == 1) {
+		strcpy(string,theLimitStateFunction->getExpression());
+		opserr << " ...evaluating -G1=" << string << " at time " << printTime << " ..." << endln;
+	}
+	else {
+		opserr << " ...evaluating performance function at time " << printTime << " ..." << endln;
+	}
+
+
+	// Find the design point for the original limit-state function
+	if (theFindDesignPointAlgorithm->findDesignPoint() < 0){
+		opserr << "OutCrossingAnalysis::analyze() - failed while finding the" << endln
+			<< " design point for limit-state function number " << lsf << "." << endln;
+		alpha.Zero();
+		return 1;
+	}
+
+
+	// Get results from the "find design point algorithm"
+	const Vector &uStar = theFindDesignPointAlgorithm->get_u();
+	alpha = theFindDesignPointAlgorithm->get_alpha();
+
+
+	// Postprocessing (note that g = -g1)
+	beta = alpha ^ uStar;
+	pf = 1.0 - aStdNormRV.getCDFvalue(beta);
+	beta1 = -beta;
+	pf1 = 1.0 - pf;
+
+
+	if (analysisType == 1) {
+
+	//  ====== possible options: using first design point as the beginning of this second search.. 
+		if (useFirstDesignPt) {
+
+			Vector xStar = theFindDesignPointAlgorithm->get_x();
+            // KRM -- parameters now handle all values
+			//theFindDesignPointAlgorithm->setStartPt(&xStar);
+			
+		}
+		
+	 // ============ by default,start from origin of the standard normal space ====================	
+
+
+		// Get the 'dgdu' vector from the sensitivity evaluator
+		// (The returned matrix containes 'node#' 'dir#' 'dgdu' in rows)
+		
+		// This should be retooled -- MHS 10/7/2011
+		//const Matrix &DgDdispl = theGradGEvaluator->getDgDdispl();
+		Matrix DgDdispl(5,5); // So that it compiles
+
+
+		// Add extra term to limit-state function
+		// (should add an alternative option where user give additional limit-state functions)
+		// (... because this works only when g is linear in u)
+		numVel = DgDdispl.noRows();
+		accuSum = 0.0;
+
+		char expressionPtr[200];
+
+		for (j=0; j<numVel; j++) {
+
+			nodeNumber = (int)DgDdispl(j,0);
+			dofNumber = (int)DgDdispl(j,1);
+			dgduValue = DgDdispl(j,2);
+
+			char expression[200];
+			sprintf(expression,"+(%20.14e)*(%20.14e)*\\$ud(%d,%d)",littleDeltaT, dgduValue, nodeNumber, dofNumber);
+			strcpy(expressionPtr,expression);
+
+			// Add it to the limit-state function
+			// There's a better way to do this -- MHS 10/7/2011
+			//theLimitStateFunction->addExpression(expressionPtr);
+		}
+
+		// Inform the user
+		strcpy(string,theLimitStateFunction->getExpression());
+		opserr << " ...evaluating G2=" << string << endln;
+
+
+		// Find the design point for the edited limit-state function
+		if (theFindDesignPointAlgorithm->findDesignPoint() < 0) {
+			opserr << "OutCrossingAnalysis::analyze() - failed while finding the" << endln
+				<< " design point for limit-state function number " << lsf << "." << endln;
+			result = 2;
+		}
+
+
+		// Zero out the added expression in the limit-state function
+		// There's a better way to do this -- MHS 10/7/2011
+		//theLimitStateFunction->removeAddedExpression();
+
+
+		if (result == 0) {
+
+			// Get results from the "find design point algorithm"
+			uStar2 = theFindDesignPointAlgorithm->get_u();
+			alpha2 = theFindDesignPointAlgorithm->get_alpha();
+
+
+			// Postprocessing (remember; here is an assumption that the mean point is in the safe domain)
+			beta2 = (alpha2 ^ uStar2);  /////// ??????????????????????????
+			pf2 = 1.0 - aStdNormRV.getCDFvalue(beta2);
+		}
+	
+		// Post-processing to find parallel system probability
+		// use CorrelatedStandardNormal class
+		CorrelatedStandardNormal phi2(0.0);
+		phi2.setCorrelation( alpha ^ alpha2 );
+		Pmn1 = phi2.getCDF(-beta1,-beta2);
+		
+		a = -(alpha ^ alpha2);	// Interval start  ??????????????????????
+		/*
+		c = 0.0;				// Interval end
+		b = (c+a)/2.0;
+		fa = functionToIntegrate(a,beta1,beta2);
+		fb = functionToIntegrate(b,beta1,beta2);
+		fc = functionToIntegrate(c,beta1,beta2);
+		integral = this->getAdaptiveIntegralValue(integralTolerance,a,c,fa,fb,fc,beta1,beta2);
+		Pmn1 = aStdNormRV.getCDFvalue(-beta1)*aStdNormRV.getCDFvalue(-beta2) - integral;
+		*/
+	
+	}
+	else {
+		// Use Heonsang's method to find new alpha and beta
+		beta2 = -beta1;
+		alpha2(0) = alpha(0) - littleDeltaT/Dt * ( alpha(0)-0.0 );
+		for (j=1; j<alpha.Size(); j++) {
+			alpha2(j) = alpha(j) - littleDeltaT/Dt * ( alpha(j)-alpha(j-1) );
+		}
+		
+		// Post-processing to find parallel system probability
+		a = -1.0*(alpha ^ alpha2)/alpha2.Norm();  
+	
+		double pi = acos(-1.0);
+		Pmn1 = 1.0/(2.0*pi) * exp(-beta2*beta2*0.5) * (asin(a) + pi/2.0);
+
+	}
+
+
+	// POST-PROCESSING
+
+	// Mean out-crossing rate
+	if (Pmn1<1.0e-10) {
+		opserr << "WARNING: Zero or negative parallel probability: " << endln
+			<< " The correlation is probably too high! " << endln;
+	}
+	nu = Pmn1 / littleDeltaT;
+	
+	opserr<<"nu(i-1) is:" <<nu<<endln;
+
+	// Duration of single excursion
+	if (fabs(nu)<1.0e-9) {
+		ED = 999999.0;
+	}
+	else {
+		ED = pf/nu;
+	}
+
+
+	// Inform the user
+	char mystring[400];
+	sprintf(mystring, " ... beta(G1)=%16.8f, beta(G2)=%16.8f, rate=%16.8e, rho=%16.8e",beta1,beta2,nu,a);
+	opserr << mystring << endln;
+
+	return result;
+}
+
+
+void
+OutCrossingAnalysis::printTimePoint(ofstream &outputFile, int i, double status,
+				    double beta, double pf, double nu, double ED)
+{
+	if (status == 1.0) {
+		outputFile << "#  First limit-state function did not converge.                       #" << endln;
+		return;
+	}
+	if (status == 2.0)
+		outputFile << "#  Second limit-state function did not converge.                      #" << endln;
+
+	double dt = theGFunEvaluator->getDt();
+
+	// Print the results to file right away...
+	outputFile.setf( ios::fixed, ios::floatfield );
+
+	outputFile << "#  " <<setprecision(2)<<setw(9)<<((stepsToStart+(i-1)*sampleFreq)*dt);
+	
+	if (beta<0.0) { outputFile << "-"; }
+	else { outputFile << " "; }
+	outputFile <<setprecision(7)<<setw(11)<<fabs(beta);
+	
+	outputFile.setf( ios::scientific, ios::floatfield );
+	if (pf<0.0) { outputFile << "-"; }
+	else { outputFile << " "; }
+	outputFile <<setprecision(4)<<setw(16)<<fabs(pf);
+	
+	if (nu<0.0) { outputFile << "-"; }
+	else { outputFile << " "; }
+	outputFile <<setprecision(5)<<setw(13)<<fabs(nu);
+	
+	if (ED<0.0) { outputFile << "-"; }
+	else { outputFile << " "; }
+	outputFile <<setprecision(3)<<setw(10)<<fabs(ED);
+	
+	outputFile.setf( ios::fixed, ios::floatfield );
+	outputFile<<"    #" << endln;
+	outputFile.flush();
+}
+
+
 /*
 //Quan & Michele January '06
 double 
@@ -40,6 +40,7 @@
 #include <GradientEvaluator.h>
 #include <FindDesignPointAlgorithm.h>
 #include <ReliabilityAnalysis.h>
+#include <LimitStateFunction.h>
 #include <tcl.h>
 
 #include <fstream>
@@ -66,10 +67,17 @@ public:
   ~OutCrossingAnalysis();
   
   int analyze(void);
+
+  // share the time points among the OpenSeesMP processes
+  void setParallel(bool flag);
   
  protected:
   
  private:
+  int evaluateTimePoint(int i, LimitStateFunction *theLimitStateFunction,
+			Vector &alpha, double &beta, double &pf, double &nu, double &ED);
+  void printTimePoint(ofstream &outputFile, int i, double status,
+		      double beta, double pf, double nu, double ED);
   
   ReliabilityDomain *theReliabilityDomain;
   FunctionEvaluator *theGFunEvaluator;
@@ -92,6 +100,7 @@ public:
   int impulseFreq;
   
   bool useFirstDesignPt;
+  bool parallel;
 };
 
 #endif
@@ -247,51 +247,99 @@ MVNcdf::MVNcdffunc(const Vector &allbeta, const Matrix &rhoin, double modifier)
 		Matrix C = theMat.getLowerCholesky();
 		double alph = uRV.getInverseCDFvalue(ci/100.0);
 
-		double intsum = 0, varsum = 0, q; 
-		long int N = 0;
-		
+		// inverse of the diagonal of the Cholesky factor
+		Vector Cinv(m);
+		for (i = 0; i < m; i++)
+			Cinv(i) = 1.0/C(i,i);
+
 		// d is always zero for integration from -infinity to beta
 		// so f = e in Genz
-		Vector d(m); Vector e(m); Vector f(m);
-		d(1-1) = 0.0;
-		e(1-1) = uRV.getCDFvalue(x(1-1) / C(1-1,1-1));
-		f(1-1) = e(1-1)-d(1-1);
-		
-		// initialize random number generator
+		double e1 = uRV.getCDFvalue(x(1-1) * Cinv(1-1));
+
+		// The points are a randomized Richtmyer lattice rule, as in Genz's
+		// QSIMVN: point k of shift s has the coordinates
+		// |2 frac(k sqrt(p_j) + shift_sj) - 1| for the first m-1 primes p_j.
+		// Each shift gives an independent estimate, and the spread of these
+		// bounds the error, which falls about as 1/N rather than the
+		// 1/sqrt(N) of independent samples.
+		const int numShifts = 12;
+		Vector q(m-1);
+		int p = 1;
+		for (j = 0; j < m-1; j++) {
+			bool isPrime = false;
+			while (!isPrime) {
+				p++;
+				isPrime = true;
+				for (int k = 2; k*k <= p; k++)
+					if (p % k == 0) {
+						isPrime = false;
+						break;
+					}
+			}
+			q(j) = sqrt((double)p);
+			q(j) -= floor(q(j));
+		}
+
+		// random shifts
 		RandomNumberGenerator *theRandomNumberGenerator = new CStdLibRandGenerator();
-		result = theRandomNumberGenerator->generate_nIndependentUniformNumbers(m-1,0,1,time(NULL));
+		result = theRandomNumberGenerator->generate_nIndependentUniformNumbers(numShifts*(m-1),0,1,time(NULL));
 		if (result < 0) {
 			opserr << "SystemAnalysis::MVNcdf() - could not generate random numbers for simulation." << endln;
 		}
-		Vector w(m-1);
+		Vector shifts = theRandomNumberGenerator->getGeneratedNumbers();
+		delete theRandomNumberGenerator;
+
+		double shiftSums[numShifts];
+		for (int s = 0; s < numShifts; s++)
+			shiftSums[s] = 0.0;
 
-		// simulate
+		// simulate, doubling the points of each shift until the error
+		// estimate or the number of points is reached
 		Vector y(m);
+		double intmean = 0.0;
 		double err = 2.0 * errMax;
-		while ( (err > errMax || N < 5) && (N < Nmax) ) {
-			result = theRandomNumberGenerator->generate_nIndependentUniformNumbers(m-1,0,1);
-			w = theRandomNumberGenerator->getGeneratedNumbers();
-
-			for (i = 2; i <= m; i++) {
-				y(i-1-1) = uRV.getInverseCDFvalue(d(i-1-1) + w(i-1-1) * (e(i-1-1)-d(i-1-1)) );
-				q = 0.0;
-				for (j = 1; j <= i-1; j++)
-					q += C(i-1,j-1)*y(j-1);
-					
-				d(i-1) = 0.0;
-				e(i-1) = uRV.getCDFvalue( (x(i-1) - q)/C(i-1,i-1) );
-				f(i-1) = (e(i-1)-d(i-1)) * f(i-1-1);
+		long int N = 0;
+		long int numPoints = 0;
+		long int numNew = 25;
+		while ( err > errMax && N < Nmax ) {
+			for (int s = 0; s < numShifts; s++) {
+				double *shift = &shifts(s*(m-1));
+				for (long int k = numPoints+1; k <= numPoints+numNew; k++) {
+					double e = e1;
+					double f = e1;
+					for (i = 2; i <= m; i++) {
+						double w = k*q(i-1-1) + shift[i-1-1];
+						w = fabs(2.0*(w - floor(w)) - 1.0);
+						y(i-1-1) = uRV.getInverseCDFvalue( w * e );
+						double qi = 0.0;
+						for (j = 1; j <= i-1; j++)
+							qi += C(i-1,j-1)*y(j-1);
+						e = uRV.getCDFvalue( (x(i-1) - qi)*Cinv(i-1) );
+						f *= e;
+					}
+					shiftSums[s] += f;
+				}
 			}
+			numPoints += numNew;
+			N += numShifts*numNew;
+			numNew = numPoints;
+			if (numNew > (Nmax-N)/numShifts)
+				numNew = (Nmax-N)/numShifts;
+			if (numNew < 1)
+				numNew = 1;
+
+			intmean = 0.0;
+			for (int s = 0; s < numShifts; s++)
+				intmean += shiftSums[s]/numPoints;
+			intmean /= numShifts;
 
-			N++;
-			intsum += f(m-1);
-			varsum += f(m-1)*f(m-1);
-			err = alph*sqrt( (varsum/N - pow(intsum/N,2))/N );
+			double varsum = 0.0;
+			for (int s = 0; s < numShifts; s++)
+				varsum += pow(shiftSums[s]/numPoints - intmean, 2);
+			err = alph*sqrt( varsum/(numShifts*(numShifts-1)) );
 			//opserr << "#" << N << " has err = " << err << " with alpha=" << alph << endln;
 		}
 
-		delete theRandomNumberGenerator;
-		
-		return intsum/N;
+		return intmean;
 	}
 }
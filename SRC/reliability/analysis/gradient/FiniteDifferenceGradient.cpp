@@ -39,13 +39,17 @@
 #include <LimitStateFunction.h>
 #include <string.h>
 
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 
 FiniteDifferenceGradient::FiniteDifferenceGradient(FunctionEvaluator *passedGFunEvaluator,
 						   ReliabilityDomain *passedReliabilityDomain,
 						   Domain *passedOpenSeesDomain)
 
 :GradientEvaluator(passedReliabilityDomain, passedGFunEvaluator), 
-theOpenSeesDomain(passedOpenSeesDomain)
+theOpenSeesDomain(passedOpenSeesDomain), parallel(false)
 {
 	
 	int nparam = theOpenSeesDomain->getNumParameters();
@@ -87,69 +91,132 @@ FiniteDifferenceGradient::computeGradient(double g)
 	// get parameters created in the domain
 	int nparam = theOpenSeesDomain->getNumParameters();
 
-    
-	// now loop through to create gradient vector
-	// note this is a for loop because there may be some conflict from a nested iterator already 
-	// called at a higher level.
-	for (int i = 0; i < nparam; i++) {
-		// get parameter tag
-		Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
-		int tag = theParam->getTag();
-		double result = 0;
-
-		// check for analytic gradient first
-		const char *gradExpression = theLimitStateFunction->getGradientExpression(tag);
-		if (gradExpression != 0) {
-            theFunctionEvaluator->setExpression(gradExpression);
-
-			if (theFunctionEvaluator->setVariables() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
+	int myPID = 0;
+	int np = 1;
+#ifdef _PARALLEL_INTERPRETERS
+	if (parallel) {
+		int mpiInitialized = 0;
+		MPI_Initialized(&mpiInitialized);
+		if (mpiInitialized) {
+			MPI_Comm_rank(MPI_COMM_WORLD, &myPID);
+			MPI_Comm_size(MPI_COMM_WORLD, &np);
+		}
+	}
+#endif
+
+	if (np == 1) {
+		// now loop through to create gradient vector
+		// note this is a for loop because there may be some conflict from a nested iterator already 
+		// called at a higher level.
+		for (int i = 0; i < nparam; i++) {
+			if (this->computeComponent(i, g, lsfExpression) < 0)
 				return -1;
-			}
-			
-			result = theFunctionEvaluator->evaluateExpression();
+		}
+		return 0;
+	}
 
-			// Reset limit state function in evaluator -- subsequent calls could receive gradient expression
-			theFunctionEvaluator->setExpression(lsfExpression);
+	// each process of OpenSeesMP perturbs its own copy of the model for
+	// every np-th parameter, and the components are then gathered on all
+	// of them; a process that fails still takes part in the sum so that
+	// none of them is left waiting
+	double failed = 0.0;
+	for (int i = myPID; i < nparam; i += np) {
+		if (this->computeComponent(i, g, lsfExpression) < 0) {
+			failed = 1.0;
+			break;
+		}
+	}
+
+#ifdef _PARALLEL_INTERPRETERS
+	Vector mySums(nparam+1);
+	for (int i = myPID; i < nparam; i += np)
+		mySums(i) = (*grad_g)(i);
+	mySums(nparam) = failed;
+	Vector allSums(nparam+1);
+	MPI_Allreduce(&mySums(0), &allSums(0), nparam+1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+	for (int i = 0; i < nparam; i++)
+		(*grad_g)(i) = allSums(i);
+	failed = allSums(nparam);
+#endif
+
+	if (failed != 0.0) {
+		opserr << "ERROR FiniteDifferenceGradient -- a process failed to compute its gradient components" << endln;
+		return -1;
+	}
+
+	return 0;
+	
+}
+
+
+void
+FiniteDifferenceGradient::setParallel(bool flag)
+{
+	parallel = flag;
+}
+
+
+int
+FiniteDifferenceGradient::computeComponent(int i, double g, const char *lsfExpression)
+{
+	int lsf = theReliabilityDomain->getTagOfActiveLimitStateFunction();
+	LimitStateFunction *theLimitStateFunction = theReliabilityDomain->getLimitStateFunctionPtr(lsf);
+
+	// get parameter tag
+	Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
+	int tag = theParam->getTag();
+	double result = 0;
+
+	// check for analytic gradient first
+	const char *gradExpression = theLimitStateFunction->getGradientExpression(tag);
+	if (gradExpression != 0) {
+            theFunctionEvaluator->setExpression(gradExpression);
+
+		if (theFunctionEvaluator->setVariables() < 0) {
+			opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
+			return -1;
 		}
 		
-		// if no analytic gradient automatically do finite differences
-		else {
-			// use parameter defined perturbation
-			double h = theParam->getPerturbation();
+		result = theFunctionEvaluator->evaluateExpression();
+
+		// Reset limit state function in evaluator -- subsequent calls could receive gradient expression
+		theFunctionEvaluator->setExpression(lsfExpression);
+	}
+	
+	// if no analytic gradient automatically do finite differences
+	else {
+		// use parameter defined perturbation
+		double h = theParam->getPerturbation();
             double original = theParam->getValue();
             theParam->update(original+h);
 
-			// set perturbed values in the variable namespace
-			if (theFunctionEvaluator->setVariables() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
-				return -1;
-			}
-			
-			// run analysis
-			if (theFunctionEvaluator->runAnalysis() < 0) {
-				opserr << "ERROR FiniteDifferenceGradient -- error running analysis" << endln;
-				return -1;
-			}
-			
+		// set perturbed values in the variable namespace
+		if (theFunctionEvaluator->setVariables() < 0) {
+			opserr << "ERROR FiniteDifferenceGradient -- error setting variables in namespace" << endln;
+			return -1;
+		}
+		
+		// run analysis
+		if (theFunctionEvaluator->runAnalysis() < 0) {
+			opserr << "ERROR FiniteDifferenceGradient -- error running analysis" << endln;
+			return -1;
+		}
+		
             // evaluate LSF and obtain result
-			theFunctionEvaluator->setExpression(lsfExpression);
-			
-			// Add gradient contribution
-			double g_perturbed = theFunctionEvaluator->evaluateExpression();
-			result = (g_perturbed-g)/h;
+		theFunctionEvaluator->setExpression(lsfExpression);
+		
+		// Add gradient contribution
+		double g_perturbed = theFunctionEvaluator->evaluateExpression();
+		result = (g_perturbed-g)/h;
             
             // return values to previous state
-			theParam->update(original);
+		theParam->update(original);
 
-			//opserr << "g_pert " << g_perturbed << ", g0 = " << g << endln;
-		}
-		
-		(*grad_g)(i) = result;
-		
+		//opserr << "g_pert " << g_perturbed << ", g0 = " << g << endln;
 	}
+	
+	(*grad_g)(i) = result;
 
 	return 0;
-	
 }
 
@@ -52,12 +52,18 @@ public:
 	
 	int		computeGradient(double gFunValue);
 	const Vector &getGradient();
+
+	// share the perturbed analyses among the OpenSeesMP processes
+	void	setParallel(bool flag);
 	
 protected:
 	
 private:
+	int		computeComponent(int i, double gFunValue, const char *lsfExpression);
+
 	Domain *theOpenSeesDomain;
 	Vector *grad_g;
+	bool parallel;
 	
 };
 
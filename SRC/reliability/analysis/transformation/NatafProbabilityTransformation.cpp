@@ -254,36 +254,39 @@ NatafProbabilityTransformation::getJacobian_u_to_x(const Vector &u, Matrix &Jux)
   char UPLO = 'L';
   char TRANS = 'N';
   char DIAG = 'N';
-  int NRHS = 1;
+  int NRHS = nrv;
   int N = nrv;
   int LDA = nrv;
   int LDB = nrv;
   int INFO;
   
   // Do Jux = inv(L) * Jzx
-  // by solving lower triangular system for each RHS
+  // by solving the lower triangular system for all the RHS at once
+  double *B = new double[nrv*nrv];
   for (int j = 0; j < nrv; j++) {
-
     for (int i = 0; i < nrv; i++)
-      lapackB[i] = 0.0;
-    
-    lapackB[j] = Jzx(j);
+      B[j*nrv+i] = 0.0;
+    B[j*nrv+j] = Jzx(j);
+  }
 
 #ifdef _WIN32
-    DTRTRS(&UPLO, &TRANS, &DIAG, &N, &NRHS, lapackA, &LDA, lapackB, &LDB, &INFO);
+  DTRTRS(&UPLO, &TRANS, &DIAG, &N, &NRHS, lapackA, &LDA, B, &LDB, &INFO);
 #else
-    dtrtrs_(&UPLO, &TRANS, &DIAG, &N, &NRHS, lapackA, &LDA, lapackB, &LDB, &INFO);
+  dtrtrs_(&UPLO, &TRANS, &DIAG, &N, &NRHS, lapackA, &LDA, B, &LDB, &INFO);
 #endif
     
-    if (INFO != 0) {
-      opserr << "NatafProbabilityTransformation::transform_x_to_u -- error code "
-	     << INFO << " returned from LAPACK DTRTRS" << endln;
-      return INFO;
-    }
+  if (INFO != 0) {
+    opserr << "NatafProbabilityTransformation::transform_x_to_u -- error code "
+	   << INFO << " returned from LAPACK DTRTRS" << endln;
+    delete [] B;
+    return INFO;
+  }
     
+  for (int j = 0; j < nrv; j++)
     for (int i = 0; i < nrv; i++)
-      Jux(i,j) = lapackB[i];
-  }
+      Jux(i,j) = B[j*nrv+i];
+
+  delete [] B;
 
   return 0;
 }
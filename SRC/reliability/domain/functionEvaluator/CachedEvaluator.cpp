@@ -0,0 +1,237 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/domain/functionEvaluator/CachedEvaluator.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of CachedEvaluator.
+//
+// What: "@(#) CachedEvaluator.cpp, revA"
+
+#include <CachedEvaluator.h>
+#include <Domain.h>
+#include <Parameter.h>
+
+#include <math.h>
+
+
+CachedEvaluator::CachedEvaluator(FunctionEvaluator *passedEvaluator,
+				 Domain *passedOpenSeesDomain, double passedTol)
+  :FunctionEvaluator(), theEvaluator(passedEvaluator),
+   theOpenSeesDomain(passedOpenSeesDomain), tol(passedTol),
+   currentEntry(-1), analyzedEntry(-1)
+{
+
+}
+
+
+CachedEvaluator::~CachedEvaluator()
+{
+	if (theEvaluator != 0)
+		delete theEvaluator;
+}
+
+
+int
+CachedEvaluator::setVariables(void)
+{
+	// a new point, until runAnalysis() says otherwise
+	currentEntry = -1;
+
+	return theEvaluator->setVariables();
+}
+
+
+int
+CachedEvaluator::setExpression(const char *passedExpression)
+{
+	theExpression = passedExpression;
+
+	return theEvaluator->setExpression(passedExpression);
+}
+
+
+int
+CachedEvaluator::addToExpression(const char *in)
+{
+	theExpression += in;
+
+	return theEvaluator->addToExpression(in);
+}
+
+
+double
+CachedEvaluator::evaluateExpression(void)
+{
+	this->incrementEvaluations();
+
+	if (currentEntry < 0)
+		return theEvaluator->evaluateExpression();
+
+	std::map<std::string, double> &theValues = theEntries[currentEntry].values;
+	std::map<std::string, double>::iterator it = theValues.find(theExpression);
+	if (it != theValues.end())
+		return it->second;
+
+	// an expression not evaluated at this point yet, the skipped
+	// analysis is needed after all
+	if (currentEntry != analyzedEntry) {
+		if (theEvaluator->runAnalysis() < 0) {
+			opserr << "ERROR CachedEvaluator -- error running analysis" << endln;
+			currentEntry = -1;
+			analyzedEntry = -1;
+			return -1;
+		}
+		analyzedEntry = currentEntry;
+	}
+
+	double value = theEvaluator->evaluateExpression();
+	theValues[theExpression] = value;
+
+	return value;
+}
+
+
+int
+CachedEvaluator::runAnalysis(void)
+{
+	static Vector x;
+	this->getPoint(x);
+
+	currentEntry = this->findPoint(x);
+	if (currentEntry >= 0)
+		return 0;
+
+	if (theEvaluator->runAnalysis() < 0) {
+		analyzedEntry = -1;
+		return -1;
+	}
+
+	Entry theEntry;
+	theEntry.x = x;
+	theEntries.push_back(theEntry);
+
+	currentEntry = theEntries.size()-1;
+	analyzedEntry = currentEntry;
+
+	return 0;
+}
+
+
+// the values of the explicit parameters, the implicit ones follow from
+// the analysis
+int
+CachedEvaluator::getPoint(Vector &x)
+{
+	int nparam = theOpenSeesDomain->getNumParameters();
+	if (x.Size() != nparam)
+		x.resize(nparam);
+
+	for (int i = 0; i < nparam; i++) {
+		Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
+		if (theParam->isImplicit())
+			x(i) = 0.0;
+		else
+			x(i) = theParam->getValue();
+	}
+
+	return 0;
+}
+
+
+// the most recent entry within the tolerance of x, relative to the size
+// of each component, or -1
+int
+CachedEvaluator::findPoint(const Vector &x)
+{
+	int n = x.Size();
+
+	for (int k = theEntries.size()-1; k >= 0; k--) {
+		const Vector &y = theEntries[k].x;
+		if (y.Size() != n)
+			continue;
+
+		bool found = true;
+		for (int i = 0; i < n; i++) {
+			double scale = fabs(y(i));
+			if (scale < 1.0)
+				scale = 1.0;
+			if (fabs(x(i)-y(i)) > tol*scale) {
+				found = false;
+				break;
+			}
+		}
+
+		if (found)
+			return k;
+	}
+
+	return -1;
+}
+
+
+int
+CachedEvaluator::setResponseVariable(const char *label, int lsfTag,
+				     int rvTag, double value)
+{
+	return theEvaluator->setResponseVariable(label, lsfTag, rvTag, value);
+}
+
+
+int
+CachedEvaluator::setResponseVariable(const char *label, int lsfTag, double value)
+{
+	return theEvaluator->setResponseVariable(label, lsfTag, value);
+}
+
+
+double
+CachedEvaluator::getResponseVariable(const char *label, int lsfTag, int rvTag)
+{
+	return theEvaluator->getResponseVariable(label, lsfTag, rvTag);
+}
+
+
+double
+CachedEvaluator::getResponseVariable(const char *label, int lsfTag)
+{
+	return theEvaluator->getResponseVariable(label, lsfTag);
+}
+
+
+void
+CachedEvaluator::setNsteps(int nsteps)
+{
+	theEvaluator->setNsteps(nsteps);
+}
+
+
+double
+CachedEvaluator::getDt()
+{
+	return theEvaluator->getDt();
+}
@@ -0,0 +1,102 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/domain/functionEvaluator/CachedEvaluator.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for CachedEvaluator.
+// CachedEvaluator wraps another FunctionEvaluator and remembers the
+// limit-state values of each point it has run the analysis for. A point
+// is the vector of the values of the explicit parameters of the domain;
+// when runAnalysis() is asked for a point within the tolerance of one
+// already analyzed the analysis is skipped and evaluateExpression()
+// returns the values found there, running the analysis after all only
+// for an expression not yet evaluated at that point. Expressions
+// evaluated without a preceding runAnalysis(), as for the gradient
+// expressions and the implicit parameters, are passed on uncached.
+//
+// What: "@(#) CachedEvaluator.h, revA"
+
+#ifndef CachedEvaluator_h
+#define CachedEvaluator_h
+
+#include <FunctionEvaluator.h>
+#include <Vector.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Domain;
+
+class CachedEvaluator : public FunctionEvaluator
+{
+ public:
+	CachedEvaluator(FunctionEvaluator *theEvaluator,
+			Domain *passedOpenSeesDomain, double tol);
+	~CachedEvaluator();
+
+	int setVariables(void);
+	int setExpression(const char *expression);
+	int addToExpression(const char *expression);
+
+	double evaluateExpression(void);
+	int runAnalysis(void);
+
+	int setResponseVariable(const char *label, int lsfTag,
+				int rvTag, double value);
+	int setResponseVariable(const char *label, int lsfTag, double value);
+	double getResponseVariable(const char *label, int lsfTag, int rvTag);
+	double getResponseVariable(const char *label, int lsfTag);
+
+	void setNsteps(int nsteps);
+	double getDt();
+
+ protected:
+
+ private:
+	int getPoint(Vector &x);
+	int findPoint(const Vector &x);
+
+	struct Entry {
+	  Vector x;
+	  std::map<std::string, double> values;
+	};
+
+	FunctionEvaluator *theEvaluator;
+	Domain *theOpenSeesDomain;
+	double tol;
+
+	std::vector<Entry> theEntries;
+	std::string theExpression;
+
+	// the entry of the last runAnalysis(), and the one whose analysis
+	// the domain holds, or -1
+	int currentEntry;
+	int analyzedEntry;
+};
+
+#endif
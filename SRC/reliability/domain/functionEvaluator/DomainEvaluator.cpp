@@ -0,0 +1,485 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/domain/functionEvaluator/DomainEvaluator.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of DomainEvaluator.
+//
+// What: "@(#) DomainEvaluator.cpp, revA"
+
+#include <DomainEvaluator.h>
+#include <ReliabilityDomain.h>
+#include <Domain.h>
+#include <Node.h>
+#include <Parameter.h>
+#include <Vector.h>
+#include <StaticAnalysis.h>
+#include <DirectIntegrationAnalysis.h>
+#include <TransientIntegrator.h>
+#include <EquiSolnAlgo.h>
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+
+// the instructions of a compiled expression, evaluated on a stack
+enum {
+  EXPR_CONST, EXPR_PAR, EXPR_DISP, EXPR_VEL, EXPR_ACCEL,
+  EXPR_ADD, EXPR_SUB, EXPR_MUL, EXPR_DIV, EXPR_POW, EXPR_NEG,
+  EXPR_ABS, EXPR_SQRT, EXPR_EXP, EXPR_LOG, EXPR_MIN, EXPR_MAX
+};
+
+// a recursive descent compiler of the Tcl form of the limit-state
+// expressions into DomainEvaluator::Program
+class ExpressionCompiler
+{
+ public:
+  ExpressionCompiler(const char *theExpression, DomainEvaluator::Program &theProgram)
+    :s(theExpression), p(theExpression), program(theProgram), ok(true) {}
+
+  bool compile(void) {
+    this->expr();
+    this->skip();
+    if (ok && *p != '\0')
+      this->error("unexpected characters");
+    return ok;
+  }
+
+ private:
+  const char *s;
+  const char *p;
+  DomainEvaluator::Program &program;
+  bool ok;
+
+  void error(const char *msg) {
+    if (ok)
+      opserr << "DomainEvaluator - " << msg << " at position " << (int)(p-s)
+	     << " of expression \"" << s << "\"\n";
+    ok = false;
+  }
+
+  void skip(void) {
+    while (isspace(*p))
+      p++;
+  }
+
+  bool accept(const char *token) {
+    this->skip();
+    int n = strlen(token);
+    if (strncmp(p, token, n) == 0) {
+      p += n;
+      return true;
+    }
+    return false;
+  }
+
+  void emit(int op, int tag = 0, int dof = 0, double value = 0.0) {
+    DomainEvaluator::Instruction theInstruction;
+    theInstruction.op = op;
+    theInstruction.tag = tag;
+    theInstruction.dof = dof;
+    theInstruction.value = value;
+    program.push_back(theInstruction);
+  }
+
+  int integer(void) {
+    this->skip();
+    char *end;
+    long value = strtol(p, &end, 10);
+    if (end == p)
+      this->error("integer expected");
+    p = end;
+    return (int)value;
+  }
+
+  void expr(void) {
+    this->term();
+    while (ok) {
+      if (this->accept("+")) {
+	this->term();
+	this->emit(EXPR_ADD);
+      } else if (this->accept("-")) {
+	this->term();
+	this->emit(EXPR_SUB);
+      } else
+	break;
+    }
+  }
+
+  void term(void) {
+    this->unary();
+    while (ok) {
+      if (this->accept("*")) {
+	this->unary();
+	this->emit(EXPR_MUL);
+      } else if (this->accept("/")) {
+	this->unary();
+	this->emit(EXPR_DIV);
+      } else
+	break;
+    }
+  }
+
+  void unary(void) {
+    if (this->accept("-")) {
+      this->unary();
+      this->emit(EXPR_NEG);
+    } else if (this->accept("+"))
+      this->unary();
+    else
+      this->power();
+  }
+
+  // ** is right associative and binds tighter than unary minus on its left
+  void power(void) {
+    this->primary();
+    this->skip();
+    if (ok && strncmp(p, "**", 2) == 0) {
+      p += 2;
+      this->unary();
+      this->emit(EXPR_POW);
+    }
+  }
+
+  void primary(void) {
+    this->skip();
+    if (!ok)
+      return;
+
+    if (*p == '(') {
+      p++;
+      this->expr();
+      if (!this->accept(")"))
+	this->error("')' expected");
+
+    } else if (isdigit(*p) || *p == '.') {
+      char *end;
+      double value = strtod(p, &end);
+      p = end;
+      this->emit(EXPR_CONST, 0, 0, value);
+
+    } else if (this->accept("$par(")) {
+      int tag = this->integer();
+      if (!this->accept(")"))
+	this->error("')' expected");
+      this->emit(EXPR_PAR, tag);
+
+    } else if (this->accept("[")) {
+      int op;
+      if (this->accept("nodeDisp"))
+	op = EXPR_DISP;
+      else if (this->accept("nodeVel"))
+	op = EXPR_VEL;
+      else if (this->accept("nodeAccel"))
+	op = EXPR_ACCEL;
+      else {
+	this->error("only the nodeDisp, nodeVel and nodeAccel commands are supported");
+	return;
+      }
+      int tag = this->integer();
+      int dof = this->integer();
+      if (!this->accept("]"))
+	this->error("']' expected");
+      this->emit(op, tag, dof-1);
+
+    } else if (isalpha(*p)) {
+      const char *name = p;
+      while (isalnum(*p))
+	p++;
+      int n = p-name;
+      int op, numArgs = 1;
+      if (n == 3 && strncmp(name, "abs", 3) == 0)
+	op = EXPR_ABS;
+      else if (n == 4 && strncmp(name, "sqrt", 4) == 0)
+	op = EXPR_SQRT;
+      else if (n == 3 && strncmp(name, "exp", 3) == 0)
+	op = EXPR_EXP;
+      else if (n == 3 && strncmp(name, "log", 3) == 0)
+	op = EXPR_LOG;
+      else if (n == 3 && strncmp(name, "pow", 3) == 0) {
+	op = EXPR_POW; numArgs = 2;
+      } else if (n == 3 && strncmp(name, "min", 3) == 0) {
+	op = EXPR_MIN; numArgs = 2;
+      } else if (n == 3 && strncmp(name, "max", 3) == 0) {
+	op = EXPR_MAX; numArgs = 2;
+      } else {
+	p = name;
+	this->error("unknown function");
+	return;
+      }
+      if (!this->accept("("))
+	this->error("'(' expected");
+      this->expr();
+      for (int i=1; i<numArgs; i++) {
+	if (!this->accept(","))
+	  this->error("',' expected");
+	this->expr();
+      }
+      if (!this->accept(")"))
+	this->error("')' expected");
+      this->emit(op);
+
+    } else
+      this->error("operand expected");
+  }
+};
+
+
+DomainEvaluator::DomainEvaluator(ReliabilityDomain *passedReliabilityDomain,
+				 Domain *passedOpenSeesDomain,
+				 StaticAnalysis *theAnalysis, int n)
+  :FunctionEvaluator(), theReliabilityDomain(passedReliabilityDomain),
+   theOpenSeesDomain(passedOpenSeesDomain),
+   theStaticAnalysis(theAnalysis), theTransientAnalysis(0), numSteps(n), dt(0.0),
+   theProgram(0), current_val(0.0)
+{
+
+}
+
+
+DomainEvaluator::DomainEvaluator(ReliabilityDomain *passedReliabilityDomain,
+				 Domain *passedOpenSeesDomain,
+				 DirectIntegrationAnalysis *theAnalysis, int n, double deltaT)
+  :FunctionEvaluator(), theReliabilityDomain(passedReliabilityDomain),
+   theOpenSeesDomain(passedOpenSeesDomain),
+   theStaticAnalysis(0), theTransientAnalysis(theAnalysis), numSteps(n), dt(deltaT),
+   theProgram(0), current_val(0.0)
+{
+
+}
+
+
+DomainEvaluator::~DomainEvaluator()
+{
+
+}
+
+
+// the parameters are set by the reliability analysis and are read from
+// the domain by the compiled expressions, nothing to pass on
+int
+DomainEvaluator::setVariables(void)
+{
+    return 0;
+}
+
+
+int
+DomainEvaluator::setExpression(const char *passedExpression)
+{
+    std::string theKey(passedExpression);
+
+    std::map<std::string, Program>::iterator it = thePrograms.find(theKey);
+    if (it != thePrograms.end()) {
+        theProgram = &(it->second);
+        return 0;
+    }
+
+    Program newProgram;
+    ExpressionCompiler theCompiler(passedExpression, newProgram);
+    if (theCompiler.compile() == false) {
+        theProgram = 0;
+        return -1;
+    }
+
+    theProgram = &(thePrograms[theKey] = newProgram);
+    return 0;
+}
+
+
+int
+DomainEvaluator::addToExpression(const char *in)
+{
+    return 0;
+}
+
+
+double
+DomainEvaluator::evaluateExpression(void)
+{
+    if (theProgram == 0) {
+        opserr << "DomainEvaluator::evaluateExpression -- must set a valid expression before trying ";
+        opserr << "to evaluate" << endln;
+        return -1;
+    }
+
+    int numInstructions = theProgram->size();
+    if ((int)theStack.size() < numInstructions)
+        theStack.resize(numInstructions);
+    double *stack = &theStack[0];
+    int top = 0;
+
+    for (int i=0; i<numInstructions; i++) {
+        const Instruction &theInstruction = (*theProgram)[i];
+        switch (theInstruction.op) {
+        case EXPR_CONST:
+            stack[top++] = theInstruction.value;
+            break;
+        case EXPR_PAR: {
+            Parameter *theParam = theOpenSeesDomain->getParameter(theInstruction.tag);
+            if (theParam == 0) {
+                opserr << "DomainEvaluator::evaluateExpression -- parameter " << theInstruction.tag
+                       << " not found" << endln;
+                return -1;
+            }
+            stack[top++] = theParam->getValue();
+            break;
+        }
+        case EXPR_DISP:
+        case EXPR_VEL:
+        case EXPR_ACCEL: {
+            Node *theNode = theOpenSeesDomain->getNode(theInstruction.tag);
+            if (theNode == 0) {
+                opserr << "DomainEvaluator::evaluateExpression -- node " << theInstruction.tag
+                       << " not found" << endln;
+                return -1;
+            }
+            const Vector &response = (theInstruction.op == EXPR_DISP) ? theNode->getTrialDisp() :
+                (theInstruction.op == EXPR_VEL) ? theNode->getTrialVel() : theNode->getTrialAccel();
+            int dof = theInstruction.dof;
+            if (dof < 0 || dof >= response.Size()) {
+                opserr << "DomainEvaluator::evaluateExpression -- invalid dof " << dof+1
+                       << " of node " << theInstruction.tag << endln;
+                return -1;
+            }
+            stack[top++] = response(dof);
+            break;
+        }
+        case EXPR_ADD: top--; stack[top-1] += stack[top]; break;
+        case EXPR_SUB: top--; stack[top-1] -= stack[top]; break;
+        case EXPR_MUL: top--; stack[top-1] *= stack[top]; break;
+        case EXPR_DIV: top--; stack[top-1] /= stack[top]; break;
+        case EXPR_POW: top--; stack[top-1] = pow(stack[top-1], stack[top]); break;
+        case EXPR_MIN: top--; if (stack[top] < stack[top-1]) stack[top-1] = stack[top]; break;
+        case EXPR_MAX: top--; if (stack[top] > stack[top-1]) stack[top-1] = stack[top]; break;
+        case EXPR_NEG: stack[top-1] = -stack[top-1]; break;
+        case EXPR_ABS: stack[top-1] = fabs(stack[top-1]); break;
+        case EXPR_SQRT: stack[top-1] = sqrt(stack[top-1]); break;
+        case EXPR_EXP: stack[top-1] = exp(stack[top-1]); break;
+        case EXPR_LOG: stack[top-1] = log(stack[top-1]); break;
+        }
+    }
+
+    current_val = stack[0];
+
+    this->incrementEvaluations();
+    return current_val;
+}
+
+
+int
+DomainEvaluator::runAnalysis(void)
+{
+    if (theOpenSeesDomain->revertToStart() != 0) {
+        opserr << "ERROR DomainEvaluator -- error in resetting Domain" << endln;
+        return -1;
+    }
+
+    int result = 0;
+    if (theStaticAnalysis != 0) {
+        EquiSolnAlgo *theAlgorithm = theStaticAnalysis->getAlgorithm();
+        if (theAlgorithm != 0)
+            theAlgorithm->domainChanged();
+        result = theStaticAnalysis->analyze(numSteps);
+
+    } else if (theTransientAnalysis != 0) {
+        TransientIntegrator *theIntegrator = theTransientAnalysis->getIntegrator();
+        if (theIntegrator != 0)
+            theIntegrator->revertToStart();
+        EquiSolnAlgo *theAlgorithm = theTransientAnalysis->getAlgorithm();
+        if (theAlgorithm != 0)
+            theAlgorithm->domainChanged();
+        result = theTransientAnalysis->analyze(numSteps, dt);
+    }
+
+    if (result < 0) {
+        opserr << "ERROR DomainEvaluator -- analysis failed" << endln;
+        return -1;
+    }
+
+    // the implicit parameters take the values of the analysis
+    int nparam = theOpenSeesDomain->getNumParameters();
+    for (int i = 0; i < nparam; i++) {
+        Parameter *theParam = theOpenSeesDomain->getParameterFromIndex(i);
+        if (theParam->isImplicit())
+            theParam->update(0.0);
+    }
+
+    return 0;
+}
+
+
+int
+DomainEvaluator::setResponseVariable(const char *label, int lsfTag,
+				     int rvTag, double value)
+{
+    char theIndex[80];
+    sprintf(theIndex, "(%d,%d)", lsfTag, rvTag);
+    theResponseVariables[std::string(label) + theIndex] = value;
+    return 0;
+}
+
+
+int
+DomainEvaluator::setResponseVariable(const char *label, int lsfTag, double value)
+{
+    char theIndex[80];
+    sprintf(theIndex, "(%d)", lsfTag);
+    theResponseVariables[std::string(label) + theIndex] = value;
+    return 0;
+}
+
+
+double
+DomainEvaluator::getResponseVariable(const char *label, int lsfTag, int rvTag)
+{
+    char theIndex[80];
+    sprintf(theIndex, "(%d,%d)", lsfTag, rvTag);
+    std::map<std::string, double>::iterator it = theResponseVariables.find(std::string(label) + theIndex);
+    if (it == theResponseVariables.end()) {
+        opserr << "ERROR DomainEvaluator -- error in getResponseVariable for object with tag " << rvTag << endln;
+        return -1;
+    }
+    return it->second;
+}
+
+
+double
+DomainEvaluator::getResponseVariable(const char *label, int lsfTag)
+{
+    char theIndex[80];
+    sprintf(theIndex, "(%d)", lsfTag);
+    std::map<std::string, double>::iterator it = theResponseVariables.find(std::string(label) + theIndex);
+    if (it == theResponseVariables.end()) {
+        opserr << "ERROR DomainEvaluator -- error in getResponseVariable for object with tag " << lsfTag << endln;
+        return -1;
+    }
+    return it->second;
+}
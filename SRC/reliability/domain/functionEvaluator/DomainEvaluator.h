@@ -0,0 +1,110 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 2001, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** Reliability module developed by:                                   **
+**   Terje Haukaas (haukaas@ce.berkeley.edu)                          **
+**   Armen Der Kiureghian (adk@ce.berkeley.edu)                       **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/reliability/domain/functionEvaluator/DomainEvaluator.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for DomainEvaluator.
+// DomainEvaluator is a FunctionEvaluator that works on the Domain without
+// the interpreter: the parameters the random variables are mapped to are
+// already set by the reliability analysis, runAnalysis() reverts the
+// domain to its start and runs a given static or transient analysis, and
+// the limit-state expressions are compiled once into a program that reads
+// the parameter values and the nodal responses directly. The expressions
+// take the Tcl form of numbers, + - * / ** and parentheses, the functions
+// abs, sqrt, exp, log, pow, min and max, $par(tag) and the commands
+// [nodeDisp tag dof], [nodeVel tag dof] and [nodeAccel tag dof].
+//
+// What: "@(#) DomainEvaluator.h, revA"
+
+#ifndef DomainEvaluator_h
+#define DomainEvaluator_h
+
+#include <FunctionEvaluator.h>
+#include <map>
+#include <string>
+#include <vector>
+
+class Domain;
+class ReliabilityDomain;
+class StaticAnalysis;
+class DirectIntegrationAnalysis;
+
+class DomainEvaluator : public FunctionEvaluator
+{
+ public:
+	DomainEvaluator(ReliabilityDomain *passedReliabilityDomain,
+			Domain *passedOpenSeesDomain,
+			StaticAnalysis *theAnalysis, int numSteps);
+	DomainEvaluator(ReliabilityDomain *passedReliabilityDomain,
+			Domain *passedOpenSeesDomain,
+			DirectIntegrationAnalysis *theAnalysis, int numSteps, double dt);
+	~DomainEvaluator();
+
+	int setVariables(void);
+	int setExpression(const char *expression);
+	int addToExpression(const char *expression);
+
+	double evaluateExpression(void);
+	int runAnalysis(void);
+
+	int setResponseVariable(const char *label, int lsfTag,
+				int rvTag, double value);
+	int setResponseVariable(const char *label, int lsfTag, double value);
+	double getResponseVariable(const char *label, int lsfTag, int rvTag);
+	double getResponseVariable(const char *label, int lsfTag);
+
+	// an instruction of a compiled expression, see DomainEvaluator.cpp
+	struct Instruction {
+	  int op;
+	  int tag;
+	  int dof;
+	  double value;
+	};
+	typedef std::vector<Instruction> Program;
+
+ protected:
+
+ private:
+	ReliabilityDomain *theReliabilityDomain;
+	Domain *theOpenSeesDomain;
+	StaticAnalysis *theStaticAnalysis;
+	DirectIntegrationAnalysis *theTransientAnalysis;
+	int numSteps;
+	double dt;
+
+	// the expressions compiled so far, and the current one
+	std::map<std::string, Program> thePrograms;
+	Program *theProgram;
+	std::vector<double> theStack;
+
+	std::map<std::string, double> theResponseVariables;
+
+	double current_val;
+};
+
+#endif
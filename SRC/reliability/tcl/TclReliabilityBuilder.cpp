@@ -85,6 +85,8 @@ using std::setiosflags;
 #include <GradientEvaluator.h>
 #include <HessianEvaluator.h>
 #include <TclEvaluator.h>
+#include <DomainEvaluator.h>
+#include <CachedEvaluator.h>
 #include <ImplicitGradient.h>
 #include <FiniteDifferenceGradient.h>
 #include <FiniteDifferenceHessian.h>
@@ -191,6 +193,10 @@ using std::setiosflags;
 //extern SensitivityAlgorithm *theSensitivityAlgorithm;
 extern Integrator *theSensitivityAlgorithm;
 
+// the analysis of the model, for the Domain function evaluator
+extern StaticAnalysis *theStaticAnalysis;
+extern DirectIntegrationAnalysis *theTransientAnalysis;
+
 /////////////////////////////////////////////////////////
 /////S Modified by K Fujimura /////////////////////////////
 /////////////////////////////////////////////////////////
@@ -2971,6 +2977,23 @@ TclReliabilityModelBuilder_addStepSizeRule(ClientData clientData, Tcl_Interp *in
 int 
 TclReliabilityModelBuilder_addFunctionEvaluator(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
+	// functionEvaluator Cache <tol>
+	// wraps the function evaluator already defined, so it must come
+	// before the gradient evaluator and the analyses that use it
+	if (argc > 1 && strcmp(argv[1],"Cache") == 0) {
+		double tol = 1.0e-10;
+		if (argc > 2 && Tcl_GetDouble(interp, argv[2], &tol) != TCL_OK) {
+			opserr << "ERROR: invalid input: tol for Cache function evaluator \n";
+			return TCL_ERROR;
+		}
+		if (theFunctionEvaluator == 0) {
+			opserr << "ERROR: the function evaluator must be defined before the Cache." << endln;
+			return TCL_ERROR;
+		}
+		theFunctionEvaluator = new CachedEvaluator(theFunctionEvaluator, theStructuralDomain, tol);
+		return TCL_OK;
+	}
+
 	// In case this is a replacement
 	if (theFunctionEvaluator != 0) {
 		delete theFunctionEvaluator;
@@ -3004,6 +3027,52 @@ TclReliabilityModelBuilder_addFunctionEvaluator(ClientData clientData, Tcl_Inter
 			return TCL_ERROR;
 		}
 	}
+	else if (strcmp(argv[1],"Domain") == 0) {
+
+		// functionEvaluator Domain -steps <numSteps> <-dt dt>
+		// runs the analysis already defined on the model and evaluates
+		// the limit-state expressions without the interpreter
+
+		int numSteps = 1;
+		double dt = 0.0;
+		int argi = 2;
+		while (argi < argc) {
+			if (strcmp(argv[argi],"-steps") == 0 && argi+1 < argc) {
+				if (Tcl_GetInt(interp, argv[argi+1], &numSteps) != TCL_OK || numSteps < 1) {
+					opserr << "ERROR: invalid input: numSteps for Domain function evaluator \n";
+					return TCL_ERROR;
+				}
+				argi += 2;
+			}
+			else if (strcmp(argv[argi],"-dt") == 0 && argi+1 < argc) {
+				if (Tcl_GetDouble(interp, argv[argi+1], &dt) != TCL_OK) {
+					opserr << "ERROR: invalid input: dt for Domain function evaluator \n";
+					return TCL_ERROR;
+				}
+				argi += 2;
+			}
+			else {
+				opserr << "ERROR: Wrong input to Domain function evaluator." << endln;
+				return TCL_ERROR;
+			}
+		}
+
+		if (theTransientAnalysis != 0) {
+			if (dt <= 0.0) {
+				opserr << "ERROR: Domain function evaluator needs -dt for a transient analysis." << endln;
+				return TCL_ERROR;
+			}
+			theFunctionEvaluator = new DomainEvaluator(theReliabilityDomain, theStructuralDomain,
+								   theTransientAnalysis, numSteps, dt);
+		}
+		else if (theStaticAnalysis != 0)
+			theFunctionEvaluator = new DomainEvaluator(theReliabilityDomain, theStructuralDomain,
+								   theStaticAnalysis, numSteps);
+		else {
+			opserr << "ERROR: the analysis must be defined before the Domain function evaluator." << endln;
+			return TCL_ERROR;
+		}
+	}
 
 /////////////////////////////////////////
 ////////S modified by K Fujimura 10/10/2004
@@ -3070,6 +3139,7 @@ TclReliabilityModelBuilder_addGradientEvaluator(ClientData clientData, Tcl_Inter
 
 		double perturbationFactor = 1000.0;
 		bool doGradientCheck = false;
+		bool parallel = false;
 
 		// Check that the necessary ingredients are present
 		if (theFunctionEvaluator == 0 ) {
@@ -3077,46 +3147,38 @@ TclReliabilityModelBuilder_addGradientEvaluator(ClientData clientData, Tcl_Inter
 			return TCL_ERROR;
 		}
 
-		// Possibly read perturbation factor
-		if (argc>2) {
-			int numExtras;
-			if (argc==3 || argc==4) {
-				numExtras = 1;
-			}
-			else if (argc==5) {
-				numExtras = 2;
-			}
-			else {
-				opserr << "ERROR: Wrong number of arguments to FiniteDifferenceGradient. " << endln;
-				return TCL_ERROR;
-			}
+		// Possibly read perturbation factor, gradient check and parallel flags
+		int counter = 2;
+		while (counter < argc) {
 
-			int counter = 2;
-
-			for (int i=1; i<=numExtras; i++) {
-
-				if (strcmp(argv[counter],"-pert") == 0) {
-					counter ++;
+			if (strcmp(argv[counter],"-pert") == 0 && counter+1 < argc) {
+				counter ++;
 
-					if (Tcl_GetDouble(interp, argv[counter], &perturbationFactor) != TCL_OK) {
-						opserr << "ERROR: invalid input: perturbationFactor \n";
-						return TCL_ERROR;
-					}
-					counter++;
-				}
-				else if (strcmp(argv[counter],"-check") == 0) {
-					counter++;
-					doGradientCheck = true;
-				}
-				else {
-					opserr << "ERROR: Error in input to FiniteDifferenceGradient. " << endln;
+				if (Tcl_GetDouble(interp, argv[counter], &perturbationFactor) != TCL_OK) {
+					opserr << "ERROR: invalid input: perturbationFactor \n";
 					return TCL_ERROR;
 				}
+				counter++;
+			}
+			else if (strcmp(argv[counter],"-check") == 0) {
+				counter++;
+				doGradientCheck = true;
+			}
+			else if (strcmp(argv[counter],"-parallel") == 0) {
+				counter++;
+				parallel = true;
+			}
+			else {
+				opserr << "ERROR: Error in input to FiniteDifferenceGradient. " << endln;
+				return TCL_ERROR;
 			}
 		}
 
-		theGradientEvaluator = new FiniteDifferenceGradient(theFunctionEvaluator, theReliabilityDomain, 
-								    theStructuralDomain);
+		FiniteDifferenceGradient *theFDGradient = 
+			new FiniteDifferenceGradient(theFunctionEvaluator, theReliabilityDomain, 
+						     theStructuralDomain);
+		theFDGradient->setParallel(parallel);
+		theGradientEvaluator = theFDGradient;
 	}
 
 	else if (strcmp(argv[1],"OpenSees") == 0 || strcmp(argv[1],"Implicit") == 0) {
@@ -4129,8 +4191,12 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	//     -print 1   (print to screen)
 	//     -print 2   (print to restart file)
 	//
+	//     -batch 0   (samples in turn) ......... this is the default
+	//     -batch n   (n samples per process and round, across the
+	//                 processes of OpenSeesMP)
+	//
 
-	if (argc!=2 && argc!=4 && argc!=6 && argc!=8 && argc!=10 && argc!=12) {
+	if (argc!=2 && argc!=4 && argc!=6 && argc!=8 && argc!=10 && argc!=12 && argc!=14) {
 		opserr << "ERROR: Wrong number of arguments to Sampling analysis" << endln;
 		return TCL_ERROR;
 	}
@@ -4142,6 +4208,7 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 	double samplingVariance	= 1.0;
 	int printFlag			= 0;
 	int analysisTypeTag		= 1;
+	int batchSize			= 0;
 
 
 	for (int i=2; i<argc; i=i+2) {
@@ -4211,6 +4278,13 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 				return TCL_ERROR;
 			}
 		}
+		else if (strcmp(argv[i],"-batch") == 0) {
+			// GET INPUT PARAMETER (integer)
+			if (Tcl_GetInt(interp, argv[i+1], &batchSize) != TCL_OK || batchSize < 0) {
+				opserr << "ERROR: invalid input: batchSize \n";
+				return TCL_ERROR;
+			}
+		}
 		else {
 			opserr << "ERROR: invalid input to sampling analysis. " << endln;
 			return TCL_ERROR;
@@ -4241,6 +4315,8 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 		return TCL_ERROR;
 	}
 
+	theImportanceSamplingAnalysis->setBatchSize(batchSize);
+
 	// Now run analysis
 	theImportanceSamplingAnalysis->analyze();
 
@@ -4256,6 +4332,7 @@ TclReliabilityModelBuilder_runImportanceSamplingAnalysis(ClientData clientData,
 // command "runOutCrossingAnalysis  filename?  -results stepsToStart?  stepsToEnd?  samplefreq? impulseFreq?   -littleDt dt? -analysisType 
 // option for analysisType 1:   -twoSearches   <-integralTolerance  tol? -useFirstDesignPoint>
 //            analysisType 2:    -Koo
+// <-parallel> shares the time points among the processes of OpenSeesMP
 //                                       
 int 
 TclReliabilityModelBuilder_runOutCrossingAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
@@ -4294,6 +4371,7 @@ TclReliabilityModelBuilder_runOutCrossingAnalysis(ClientData clientData, Tcl_Int
 
 	double integralTolerance=1.e-10;
 	bool useFirstDesignPt = false;
+	bool parallel = false;
 
 
 
@@ -4362,6 +4440,10 @@ TclReliabilityModelBuilder_runOutCrossingAnalysis(ClientData clientData, Tcl_Int
 			 }
 
 		}
+		else if (strcmp(argv[argvCounter],"-parallel") == 0) {
+			argvCounter++;
+			parallel = true;
+		}
 		else {
 			opserr << "ERROR: Invalid input to theOutCrossingAnalysis." << endln;
 			return TCL_ERROR;
@@ -4389,6 +4471,7 @@ TclReliabilityModelBuilder_runOutCrossingAnalysis(ClientData clientData, Tcl_Int
 		opserr << "ERROR: could not create theOutCrossingAnalysis \n";
 		return TCL_ERROR;
 	}
+	theOutCrossingAnalysis->setParallel(parallel);
 
 	// Now run analysis
 	theOutCrossingAnalysis->analyze();
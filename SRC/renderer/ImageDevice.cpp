@@ -0,0 +1,279 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/renderer/ImageDevice.cpp,v $
+                                                                        
+// Created: 10/26
+//
+// Description: This file contains the implementation of ImageDevice.
+//
+// What: "@(#) ImageDevice.cpp, revA"
+
+#include <ImageDevice.h>
+#include <OPS_Globals.h>
+#include <math.h>
+
+ImageDevice::ImageDevice()
+  :width(0), height(0), pixels(0),
+   red(0.0), green(0.0), blue(0.0), mode(0), numPoints(0)
+{
+
+}
+
+ImageDevice::~ImageDevice()
+{
+  if (pixels != 0)
+    delete [] pixels;
+}
+
+void
+ImageDevice::WINOPEN(const char *title, int xLoc, int yLoc, int w, int h)
+{
+  if (pixels != 0)
+    delete [] pixels;
+  pixels = 0;
+  width = 0;
+  height = 0;
+
+  if (w < 1 || h < 1) {
+    opserr << "ImageDevice::WINOPEN() - invalid size " << w << " x " << h << endln;
+    return;
+  }
+
+  pixels = new unsigned char[3*w*h];
+  width = w;
+  height = h;
+  this->CLEAR();
+}
+
+void
+ImageDevice::CLEAR()
+{
+  for (int i=0; i<3*width*height; i++)
+    pixels[i] = 255;
+}
+
+int
+ImageDevice::GetWidth()
+{
+  return width;
+}
+
+int
+ImageDevice::GetHeight()
+{
+  return height;
+}
+
+void
+ImageDevice::C3F(float r, float g, float b)
+{
+  red = r;
+  green = g;
+  blue = b;
+}
+
+void
+ImageDevice::V2F(float x, float y)
+{
+  if (mode == 1 || mode == 2) {
+    if (numPoints == IMAGE_DEVICE_MAX_POINTS) {
+      opserr << "ImageDevice::V2F() - maximum number of points exceeded\n";
+      return;
+    }
+    xPts[numPoints] = x;
+    yPts[numPoints] = y;
+    rgbPts[3*numPoints] = red;
+    rgbPts[3*numPoints+1] = green;
+    rgbPts[3*numPoints+2] = blue;
+    numPoints++;
+  } else
+    this->setPixel((int)x, (int)y, red, green, blue);
+}
+
+void
+ImageDevice::setPixel(int x, int y, float r, float g, float b)
+{
+  // the device y goes up, the rows of the image down
+  if (x < 0 || x >= width || y < 0 || y >= height)
+    return;
+
+  unsigned char *pixel = &pixels[3*((height-1-y)*width + x)];
+  pixel[0] = (unsigned char)(255.0*(r < 0.0 ? 0.0 : (r > 1.0 ? 1.0 : r)) + 0.5);
+  pixel[1] = (unsigned char)(255.0*(g < 0.0 ? 0.0 : (g > 1.0 ? 1.0 : g)) + 0.5);
+  pixel[2] = (unsigned char)(255.0*(b < 0.0 ? 0.0 : (b > 1.0 ? 1.0 : b)) + 0.5);
+}
+
+void
+ImageDevice::drawSegment(int i, int j)
+{
+  // DDA from point i to j, the colors interpolated along the segment
+  float dx = xPts[j] - xPts[i];
+  float dy = yPts[j] - yPts[i];
+  int numSteps = (int)(fabs(dx) > fabs(dy) ? fabs(dx) : fabs(dy)) + 1;
+
+  const float *rgbI = &rgbPts[3*i];
+  const float *rgbJ = &rgbPts[3*j];
+  for (int k=0; k<=numSteps; k++) {
+    float t = (float)k/numSteps;
+    this->setPixel((int)floor(xPts[i] + t*dx + 0.5), (int)floor(yPts[i] + t*dy + 0.5),
+		   rgbI[0] + t*(rgbJ[0]-rgbI[0]),
+		   rgbI[1] + t*(rgbJ[1]-rgbI[1]),
+		   rgbI[2] + t*(rgbJ[2]-rgbI[2]));
+  }
+}
+
+void
+ImageDevice::fillPolygon(void)
+{
+  // even-odd scan line fill in the current color
+  float yMin = yPts[0];
+  float yMax = yPts[0];
+  for (int i=1; i<numPoints; i++) {
+    if (yPts[i] < yMin) yMin = yPts[i];
+    if (yPts[i] > yMax) yMax = yPts[i];
+  }
+
+  int y0 = (int)ceil(yMin);
+  int y1 = (int)floor(yMax);
+  if (y0 < 0) y0 = 0;
+  if (y1 > height-1) y1 = height-1;
+
+  float xCross[IMAGE_DEVICE_MAX_POINTS];
+  for (int y=y0; y<=y1; y++) {
+    float yc = y + 0.5;
+    int numCross = 0;
+    for (int i=0; i<numPoints; i++) {
+      int j = (i+1)%numPoints;
+      float ya = yPts[i];
+      float yb = yPts[j];
+      if ((ya <= yc && yb > yc) || (yb <= yc && ya > yc)) {
+	float x = xPts[i] + (yc-ya)/(yb-ya)*(xPts[j]-xPts[i]);
+	int k = numCross++;
+	while (k > 0 && xCross[k-1] > x) {
+	  xCross[k] = xCross[k-1];
+	  k--;
+	}
+	xCross[k] = x;
+      }
+    }
+
+    for (int k=0; k+1<numCross; k+=2)
+      for (int x=(int)ceil(xCross[k]); x<=(int)floor(xCross[k+1]); x++)
+	this->setPixel(x, y, red, green, blue);
+  }
+}
+
+void
+ImageDevice::BGNPOLYGON()
+{
+  numPoints = 0;
+  mode = 1;
+}
+
+void
+ImageDevice::ENDPOLYGON()
+{
+  mode = 0;
+  if (numPoints > 2)
+    this->fillPolygon();
+}
+
+void
+ImageDevice::BGNCLOSEDLINE()
+{
+  numPoints = 0;
+  mode = 2;
+}
+
+void
+ImageDevice::ENDCLOSEDLINE()
+{
+  mode = 0;
+  if (numPoints == 1)
+    this->setPixel((int)xPts[0], (int)yPts[0], rgbPts[0], rgbPts[1], rgbPts[2]);
+  else if (numPoints == 2)
+    this->drawSegment(0, 1);
+  else
+    for (int i=0; i<numPoints; i++)
+      this->drawSegment(i, (i+1)%numPoints);
+}
+
+void
+ImageDevice::BGNPOINT()
+{
+  mode = 0;
+}
+
+void
+ImageDevice::ENDPOINT()
+{
+
+}
+
+void
+ImageDevice::drawText(float x, float y, char *text, int length)
+{
+
+}
+
+void
+ImageDevice::STARTIMAGE()
+{
+
+}
+
+void
+ImageDevice::ENDIMAGE()
+{
+
+}
+
+int
+ImageDevice::writeImage(FILE *theFile)
+{
+  if (pixels == 0 || theFile == 0)
+    return -1;
+
+  fprintf(theFile, "P6\n%d %d\n255\n", width, height);
+  if (fwrite(pixels, 3, width*height, theFile) != (size_t)(width*height)) {
+    opserr << "ImageDevice::writeImage() - failed to write the image\n";
+    return -1;
+  }
+
+  return 0;
+}
+
+int
+ImageDevice::writeImage(const char *fileName)
+{
+  FILE *theFile = fopen(fileName, "wb");
+  if (theFile == 0) {
+    opserr << "ImageDevice::writeImage() - could not open file: " << fileName << endln;
+    return -1;
+  }
+
+  int res = this->writeImage(theFile);
+  fclose(theFile);
+
+  return res;
+}
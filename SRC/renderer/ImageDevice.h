@@ -0,0 +1,97 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/renderer/ImageDevice.h,v $
+                                                                        
+// Created: 10/26
+//
+// Description: This file contains the class definition for ImageDevice.
+// ImageDevice is a Device that draws into an RGB frame buffer in memory
+// instead of a window, so the software pipeline of X11Renderer (View,
+// Projection, Clipping, Viewport and ScanLineConverter) can render without
+// a display. The buffer is written as a binary PPM image; writing one PPM
+// after the other to the same file gives a PPM stream, which the usual
+// video encoders read directly (e.g. ffmpeg -f image2pipe -c:v ppm). Text
+// is not drawn, there being no font off screen.
+//
+// What: "@(#) ImageDevice.h, revA"
+
+#ifndef ImageDevice_H
+#define ImageDevice_H
+
+#include <Device.h>
+#include <stdio.h>
+
+#define IMAGE_DEVICE_MAX_POINTS 64
+
+class ImageDevice: public Device
+{
+ public:
+  ImageDevice();
+  ~ImageDevice();
+
+  virtual void V2F(float x, float y);
+  virtual void C3F(float r, float g, float b);
+
+  virtual int GetWidth();
+  virtual int GetHeight();
+
+  virtual void BGNPOLYGON();
+  virtual void ENDPOLYGON();
+
+  virtual void BGNCLOSEDLINE();
+  virtual void ENDCLOSEDLINE();
+
+  virtual void BGNPOINT();
+  virtual void ENDPOINT();
+
+  virtual void drawText(float x, float y, char *text, int length);
+
+  virtual void STARTIMAGE();
+  virtual void ENDIMAGE();
+
+  // allocates the frame buffer, the title and location are ignored
+  virtual void WINOPEN(const char *title, int xLoc, int yLoc, int width, int height);
+
+  // sets the frame buffer to white
+  virtual void CLEAR();
+
+  // write the frame buffer as a binary PPM image
+  int writeImage(FILE *theFile);
+  int writeImage(const char *fileName);
+
+ private:
+  void setPixel(int x, int y, float r, float g, float b);
+  void drawSegment(int i, int j);
+  void fillPolygon(void);
+
+  int width, height;
+  unsigned char *pixels;   // rows top to bottom, 3 bytes a pixel
+
+  float red, green, blue;  // the current color
+  int mode;                // 1 polygon, 2 closed line, otherwise points
+  int numPoints;
+  float xPts[IMAGE_DEVICE_MAX_POINTS], yPts[IMAGE_DEVICE_MAX_POINTS];
+  float rgbPts[3*IMAGE_DEVICE_MAX_POINTS];
+};
+
+#endif
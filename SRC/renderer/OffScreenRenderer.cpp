@@ -0,0 +1,620 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/renderer/OffScreenRenderer.cpp,v $
+                                                                        
+// Created: 10/26
+//
+// Description: This file contains the implementation of OffScreenRenderer.
+//
+// What: "@(#) OffScreenRenderer.cpp, revA"
+
+#include <OffScreenRenderer.h>
+#include <ColorMap.h>
+#include <string.h>
+
+#include <db.H>
+
+#include <Matrix.h>
+#include <Vector.h>
+#include <View.h>
+#include <Projection.h>
+#include <Viewport.h>
+#include <Clipping.h>
+#include <ImageDevice.h>
+#include <Scan.h>
+
+#define OFFSCREEN_POINT   1
+#define OFFSCREEN_LINE    2
+#define OFFSCREEN_POLYGON 3
+
+#define WIRE_MODE 1
+#define FILL_MODE 0
+
+// a frame: the view and the primitives, each stored as its type, its
+// number of points and x y z r g b for each point
+class OffScreenFrame
+{
+ public:
+  OffScreenFrame() :data(0), size(0), maxSize(0) {}
+  ~OffScreenFrame() {if (data != 0) delete [] data;}
+
+  void add(float value) {
+    if (size == maxSize) {
+      int newSize = (maxSize == 0) ? 1024 : 2*maxSize;
+      float *newData = new float[newSize];
+      for (int i=0; i<size; i++)
+	newData[i] = data[i];
+      if (data != 0)
+	delete [] data;
+      data = newData;
+      maxSize = newSize;
+    }
+    data[size++] = value;
+  }
+
+  float view[22];
+  int projectionMode, fillMode;
+  bool clear;
+
+  float *data;
+  int size, maxSize;
+};
+
+#ifndef _WIN32
+extern "C" void *
+offScreenRenderer(void *theRenderer)
+{
+  ((OffScreenRenderer *)theRenderer)->drainFrames();
+  return 0;
+}
+#endif
+
+OffScreenRenderer::OffScreenRenderer(int width, int height, ColorMap &_theMap,
+				     const char *videoFileName, int depth)
+  :Renderer(_theMap),
+   projectionMode(PERSPECTIVE_MODE), fillMode(FILL_MODE), clearNext(false),
+   queueDepth(depth), theFrames(0), currentFrame(0),
+   fillFrame(0), drainFrame(0), numFull(0), finished(false), threaded(false),
+   theVideo(0)
+{
+  if (queueDepth < 1)
+    queueDepth = 1;
+
+  vrp[0] = 0.0; vrp[1] = 0.0; vrp[2] = 0.0;
+  vpn[0] = 0.0; vpn[1] = 0.0; vpn[2] = 1.0;
+  vuv[0] = 0.0; vuv[1] = 1.0; vuv[2] = 0.0;
+  cop[0] = 0.0; cop[1] = 0.0; cop[2] = 100.0;
+  vpwindow[0] = -1.0; vpwindow[1] = 1.0; vpwindow[2] = -1.0; vpwindow[3] = 1.0;
+  planedist[0] = 1.0; planedist[1] = 1.0;
+  portwindow[0] = -1.0; portwindow[1] = 1.0; portwindow[2] = -1.0; portwindow[3] = 1.0;
+
+  theView = new View;
+  theProjection = new Projection;
+  theClipping = new Clipping;
+  theViewport = new Viewport;
+  theScan = new ScanLineConverter;
+  theDevice = new ImageDevice;
+
+  theScan->setDevice(*theDevice);
+  theScan->setProjection(*theProjection);
+  theViewport->setDevice(*theDevice);
+
+  theDevice->WINOPEN("", 0, 0, width, height);
+
+  if (videoFileName != 0) {
+    theVideo = fopen(videoFileName, "wb");
+    if (theVideo == 0)
+      opserr << "WARNING - OffScreenRenderer::OffScreenRenderer() - could not open file: " << videoFileName << endln;
+  }
+}
+
+OffScreenRenderer::~OffScreenRenderer()
+{
+  this->stop();
+
+  if (currentFrame != 0)
+    delete currentFrame;
+
+  delete theView;
+  delete theProjection;
+  delete theClipping;
+  delete theViewport;
+  delete theScan;
+  delete theDevice;
+
+  if (theVideo != 0)
+    fclose(theVideo);
+}
+
+void
+OffScreenRenderer::start(void)
+{
+  theFrames = new OffScreenFrame *[queueDepth];
+  for (int i=0; i<queueDepth; i++)
+    theFrames[i] = new OffScreenFrame;
+
+  fillFrame = 0;
+  drainFrame = 0;
+  numFull = 0;
+  finished = false;
+  threaded = false;
+
+#ifndef _WIN32
+  pthread_mutex_init(&lock, 0);
+  pthread_cond_init(&frameFull, 0);
+  pthread_cond_init(&frameFree, 0);
+  if (pthread_create(&renderer, 0, offScreenRenderer, (void *)this) == 0)
+    threaded = true;
+  else {
+    opserr << "WARNING - OffScreenRenderer - could not start a render thread, rendering synchronously\n";
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&frameFull);
+    pthread_cond_destroy(&frameFree);
+  }
+#endif
+}
+
+void
+OffScreenRenderer::stop(void)
+{
+  if (theFrames == 0)
+    return;
+
+#ifndef _WIN32
+  if (threaded == true) {
+    // the render thread renders the frames left in the queue before it exits
+    pthread_mutex_lock(&lock);
+    finished = true;
+    pthread_cond_signal(&frameFull);
+    pthread_mutex_unlock(&lock);
+
+    pthread_join(renderer, 0);
+    pthread_mutex_destroy(&lock);
+    pthread_cond_destroy(&frameFull);
+    pthread_cond_destroy(&frameFree);
+    threaded = false;
+  }
+#endif
+
+  for (int i=0; i<queueDepth; i++)
+    delete theFrames[i];
+  delete [] theFrames;
+  theFrames = 0;
+}
+
+int
+OffScreenRenderer::flush(void)
+{
+#ifndef _WIN32
+  if (threaded == true) {
+    pthread_mutex_lock(&lock);
+    while (numFull != 0)
+      pthread_cond_wait(&frameFree, &lock);
+    pthread_mutex_unlock(&lock);
+  }
+#endif
+
+  return 0;
+}
+
+void
+OffScreenRenderer::drainFrames(void)
+{
+#ifndef _WIN32
+  pthread_mutex_lock(&lock);
+  while (true) {
+    while (numFull == 0 && finished == false)
+      pthread_cond_wait(&frameFull, &lock);
+    if (numFull == 0)
+      break;
+
+    int frame = drainFrame;
+    pthread_mutex_unlock(&lock);
+
+    this->renderFrame(*theFrames[frame]);
+
+    pthread_mutex_lock(&lock);
+    drainFrame = (drainFrame+1)%queueDepth;
+    numFull--;
+    pthread_cond_signal(&frameFree);
+  }
+  pthread_mutex_unlock(&lock);
+#endif
+}
+
+int
+OffScreenRenderer::clearImage(void)
+{
+  clearNext = true;
+  return 0;
+}
+
+int
+OffScreenRenderer::saveImage(const char *imageName)
+{
+  this->flush();
+  return theDevice->writeImage(imageName);
+}
+
+int
+OffScreenRenderer::startImage(void)
+{
+  if (theFrames == 0)
+    this->start();
+
+  // the frame being filled is not in the ring until doneImage()
+  if (currentFrame == 0)
+    currentFrame = new OffScreenFrame;
+  currentFrame->size = 0;
+
+  float *view = currentFrame->view;
+  for (int i=0; i<3; i++) {
+    view[i] = vrp[i];
+    view[3+i] = vpn[i];
+    view[6+i] = vuv[i];
+    view[9+i] = cop[i];
+  }
+  for (int i=0; i<4; i++) {
+    view[12+i] = vpwindow[i];
+    view[16+i] = portwindow[i];
+  }
+  view[20] = planedist[0];
+  view[21] = planedist[1];
+  currentFrame->projectionMode = projectionMode;
+  currentFrame->fillMode = fillMode;
+  currentFrame->clear = clearNext;
+  clearNext = false;
+
+  return 0;
+}
+
+int
+OffScreenRenderer::doneImage(void)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  if (threaded == false) {
+    this->renderFrame(*currentFrame);
+    return 0;
+  }
+
+#ifndef _WIN32
+  // wait for a free frame, the render thread does not touch the free frames
+  pthread_mutex_lock(&lock);
+  while (numFull == queueDepth)
+    pthread_cond_wait(&frameFree, &lock);
+  pthread_mutex_unlock(&lock);
+
+  // swap the filled frame into the ring, keeping the storage of the old one
+  OffScreenFrame *theFrame = theFrames[fillFrame];
+  theFrames[fillFrame] = currentFrame;
+  currentFrame = theFrame;
+
+  pthread_mutex_lock(&lock);
+  fillFrame = (fillFrame+1)%queueDepth;
+  numFull++;
+  pthread_cond_signal(&frameFull);
+  pthread_mutex_unlock(&lock);
+#endif
+
+  return 0;
+}
+
+int
+OffScreenRenderer::addPoint(const Vector &pos, float r, float g, float b)
+{
+  OffScreenFrame &theFrame = *currentFrame;
+  int size = pos.Size();
+  theFrame.add(size > 0 ? pos(0) : 0.0);
+  theFrame.add(size > 1 ? pos(1) : 0.0);
+  theFrame.add(size > 2 ? pos(2) : 0.0);
+  theFrame.add(r);
+  theFrame.add(g);
+  theFrame.add(b);
+  return 0;
+}
+
+int
+OffScreenRenderer::drawPoint(const Vector &pos1, float V1, int tag, int mode, int numPixels)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  currentFrame->add(OFFSCREEN_POINT);
+  currentFrame->add(1);
+  return this->addPoint(pos1, theMap->getRed(V1), theMap->getGreen(V1), theMap->getBlue(V1));
+}
+
+int
+OffScreenRenderer::drawPoint(const Vector &pos1, const Vector &rgb, int tag, int mode, int numPixels)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  currentFrame->add(OFFSCREEN_POINT);
+  currentFrame->add(1);
+  return this->addPoint(pos1, rgb(0), rgb(1), rgb(2));
+}
+
+int
+OffScreenRenderer::drawLine(const Vector &pos1, const Vector &pos2,
+			    float V1, float V2, int tag, int mode, int width, int style)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  currentFrame->add(OFFSCREEN_LINE);
+  currentFrame->add(2);
+  this->addPoint(pos1, theMap->getRed(V1), theMap->getGreen(V1), theMap->getBlue(V1));
+  return this->addPoint(pos2, theMap->getRed(V2), theMap->getGreen(V2), theMap->getBlue(V2));
+}
+
+int
+OffScreenRenderer::drawLine(const Vector &pos1, const Vector &pos2,
+			    const Vector &rgb1, const Vector &rgb2,
+			    int tag, int mode, int width, int style)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  currentFrame->add(OFFSCREEN_LINE);
+  currentFrame->add(2);
+  this->addPoint(pos1, rgb1(0), rgb1(1), rgb1(2));
+  return this->addPoint(pos2, rgb2(0), rgb2(1), rgb2(2));
+}
+
+int
+OffScreenRenderer::drawPolygon(const Matrix &pos, const Vector &data, int tag, int mode)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  OffScreenFrame &theFrame = *currentFrame;
+  int numRows = pos.noRows();
+  theFrame.add(OFFSCREEN_POLYGON);
+  theFrame.add(numRows);
+  for (int i=0; i<numRows; i++) {
+    float value = data(i);
+    theFrame.add(pos(i,0));
+    theFrame.add(pos(i,1));
+    theFrame.add(pos(i,2));
+    theFrame.add(theMap->getRed(value));
+    theFrame.add(theMap->getGreen(value));
+    theFrame.add(theMap->getBlue(value));
+  }
+
+  return 0;
+}
+
+int
+OffScreenRenderer::drawPolygon(const Matrix &pos, const Matrix &data, int tag, int mode)
+{
+  if (currentFrame == 0)
+    return -1;
+
+  OffScreenFrame &theFrame = *currentFrame;
+  int numRows = pos.noRows();
+  theFrame.add(OFFSCREEN_POLYGON);
+  theFrame.add(numRows);
+  for (int i=0; i<numRows; i++) {
+    theFrame.add(pos(i,0));
+    theFrame.add(pos(i,1));
+    theFrame.add(pos(i,2));
+    theFrame.add(data(i,0));
+    theFrame.add(data(i,1));
+    theFrame.add(data(i,2));
+  }
+
+  return 0;
+}
+
+int
+OffScreenRenderer::drawText(const Vector &pos, char *text, int length,
+			    char horizontalJustify, char verticalJustify)
+{
+  // no font to draw with off screen
+  return 0;
+}
+
+void
+OffScreenRenderer::renderFrame(OffScreenFrame &theFrame)
+{
+  const float *view = theFrame.view;
+  for (int i=0; i<3; i++) {
+    theView->vrp[i] = view[i];
+    theView->vpn[i] = view[3+i];
+    theView->vuv[i] = view[6+i];
+    theProjection->cop[i] = view[9+i];
+  }
+  for (int i=0; i<4; i++) {
+    theProjection->vpwindow[i] = view[12+i];
+    theViewport->portwindow[i] = view[16+i];
+  }
+  theProjection->planedist[0] = view[20];
+  theProjection->planedist[2] = view[21];
+  theProjection->projection_mode = theFrame.projectionMode;
+  theScan->setFillMode(theFrame.fillMode);
+
+  theView->update();
+  theProjection->update();
+  theClipping->update();
+  theViewport->update();
+  theScan->update();
+
+  if (theFrame.clear == true)
+    theDevice->CLEAR();
+
+  const float *data = theFrame.data;
+  int loc = 0;
+  while (loc < theFrame.size) {
+    int type = (int)data[loc];
+    int numPoints = (int)data[loc+1];
+    loc += 2;
+
+    if (type == OFFSCREEN_POINT) {
+      MYPOINT *point = new MYPOINT(1, data[loc], data[loc+1], data[loc+2]);
+      MYPOINT *res = theView->transformP(point);
+      res = theProjection->transformP(res);
+      res = theClipping->transformP(res);
+      res = theViewport->transformP(res);
+      if (res != 0) {
+	theDevice->BGNPOINT();
+	theDevice->C3F(data[loc+3], data[loc+4], data[loc+5]);
+	theDevice->V2F(res->p[0], res->p[1]);
+	theDevice->ENDPOINT();
+	delete res;
+      }
+    } else {
+      FACE *theFace = new FACE();
+      for (int i=0; i<numPoints; i++) {
+	const float *pt = &data[loc+6*i];
+	MYPOINT *point = new MYPOINT(i+1, pt[0], pt[1], pt[2]);
+	point->r = pt[3];
+	point->g = pt[4];
+	point->b = pt[5];
+	theFace->AddPoint(*point);
+      }
+
+      FACE &res1 = theView->transform(*theFace);
+      FACE &res2 = theProjection->transform(res1);
+      FACE &res3 = theClipping->transform(res2);
+      FACE &res4 = theViewport->transform(res3);
+      if (type == OFFSCREEN_LINE)
+	theScan->scanLine(res4);
+      else
+	theScan->scanPolygon(res4);
+    }
+
+    loc += 6*numPoints;
+  }
+
+  if (theVideo != 0) {
+    theDevice->writeImage(theVideo);
+    fflush(theVideo);
+  }
+}
+
+int
+OffScreenRenderer::setVRP(float x, float y, float z)
+{
+  vrp[0] = x;
+  vrp[1] = y;
+  vrp[2] = z;
+  return 0;
+}
+
+int
+OffScreenRenderer::setVPN(float x, float y, float z)
+{
+  vpn[0] = x;
+  vpn[1] = y;
+  vpn[2] = z;
+  return 0;
+}
+
+int
+OffScreenRenderer::setVUP(float x, float y, float z)
+{
+  vuv[0] = x;
+  vuv[1] = y;
+  vuv[2] = z;
+  return 0;
+}
+
+int
+OffScreenRenderer::setViewWindow(float umin, float umax, float vmin, float vmax)
+{
+  if (umin > umax || vmin > vmax) {
+    opserr << "OffScreenRenderer::setViewWindow() - invalid window ";
+    opserr << umin << " "<< umax << " "<< vmin << " "<< vmax << endln;
+    return -1;
+  }
+
+  vpwindow[0] = umin;
+  vpwindow[1] = umax;
+  vpwindow[2] = vmin;
+  vpwindow[3] = vmax;
+  return 0;
+}
+
+int
+OffScreenRenderer::setPlaneDist(float anear, float afar)
+{
+  if ((anear < 0.0) || (afar < 0.0)) {
+    opserr << "OffScreenRenderer::setPlaneDist() - invalid planes";
+    opserr << anear << " " << afar << endln;
+    return -1;
+  }
+
+  planedist[0] = anear;
+  planedist[1] = afar;
+  return 0;
+}
+
+int
+OffScreenRenderer::setProjectionMode(const char *newMode)
+{
+  if ((strcmp(newMode, "parallel") == 0) || (strcmp(newMode, "Parallel") == 0))
+    projectionMode = PARALLEL_MODE;
+  else if ((strcmp(newMode, "perspective") == 0) || (strcmp(newMode, "Perspective") == 0))
+    projectionMode = PERSPECTIVE_MODE;
+  return 0;
+}
+
+int
+OffScreenRenderer::setFillMode(const char *newMode)
+{
+  if ((strcmp(newMode, "wire") == 0) || (strcmp(newMode, "Wire") == 0))
+    fillMode = WIRE_MODE;
+  else if ((strcmp(newMode, "fill") == 0) || (strcmp(newMode, "Fill") == 0))
+    fillMode = FILL_MODE;
+  return 0;
+}
+
+int
+OffScreenRenderer::setPRP(float u, float v, float n)
+{
+  cop[0] = u;
+  cop[1] = v;
+  cop[2] = n;
+  return 0;
+}
+
+int
+OffScreenRenderer::setPortWindow(float left, float right,
+				 float bottom, float top)
+{
+  if (left < -1 || right > 1 || bottom < -1 || top > 1
+      || left > right || bottom > top) {
+    opserr << "OffScreenRenderer::setPortWindow() - bounds invalid ";
+    opserr << left << " "<< right << " "<< bottom << " "<< top << endln;
+    return -1;
+  }
+
+  portwindow[0] = left;
+  portwindow[1] = right;
+  portwindow[2] = bottom;
+  portwindow[3] = top;
+  return 0;
+}
@@ -0,0 +1,141 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+                                                                        
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/renderer/OffScreenRenderer.h,v $
+                                                                        
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// OffScreenRenderer. OffScreenRenderer is a Renderer for batch runs, it
+// needs no display and does not hold up the analysis. The draw methods
+// invoked by displaySelf() of the elements and nodes only copy the
+// primitives, their points and colors, into a frame; doneImage() queues
+// the frame, a snapshot of the committed state of the model, for a render
+// thread (pthreads, not on _WIN32) and returns. The render thread passes
+// the frames in order through the software pipeline of X11Renderer into an
+// ImageDevice and appends each image to a PPM stream file, the frames of
+// an animation. doneImage() blocks only when the queue of queueDepth
+// frames is full. The view set when startImage() is called is kept with
+// each frame.
+//
+// What: "@(#) OffScreenRenderer.h, revA"
+
+#ifndef OffScreenRenderer_h
+#define OffScreenRenderer_h
+
+#include <Renderer.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+class View;
+class Projection;
+class Clipping;
+class Viewport;
+class ScanLineConverter;
+class ImageDevice;
+class OffScreenFrame;
+
+class OffScreenRenderer : public Renderer
+{
+ public:
+    OffScreenRenderer(int width, int height, ColorMap &theMap,
+		      const char *videoFileName, int queueDepth = 4);
+    virtual ~OffScreenRenderer();
+
+    virtual int clearImage(void);
+    virtual int saveImage(const char *imageName);
+    virtual int startImage(void);
+    virtual int doneImage(void);
+
+    // waits for the frames in the queue to be rendered
+    int flush(void);
+
+    virtual int drawPoint(const Vector &, float V1, int tag = 0, int mode = 0, int width = 1);
+    virtual int drawPoint(const Vector &, const Vector &rgb1, int tag = 0, int mode = 0, int width = 1);
+
+    virtual int drawLine(const Vector &, const Vector &,
+			 float V1, float V2, int tag = 0, int mode = 0, int width = 1, int style = 1);
+    virtual int drawLine(const Vector &end1, const Vector &end2,
+			 const Vector &rgb1, const Vector &rgb2,
+			 int tag = 0, int mode = 0, int width = 1, int style = 1);
+
+    virtual int drawPolygon(const Matrix &points, const Vector &values, int tag = 0, int mode = 0);
+    virtual int drawPolygon(const Matrix &points, const Matrix &rgbValues, int tag = 0, int mode = 0);
+
+    virtual int drawText(const Vector &posGlobal, char *string, int length,
+			 char horizontalJustify = 'l', char verticalJustify = 'b');
+
+    virtual int setVRP(float x, float y, float z);
+    virtual int setVPN(float x, float y, float z);
+    virtual int setVUP(float x, float y, float z);
+    virtual int setViewWindow(float, float, float, float);
+    virtual int setPlaneDist(float, float);
+    virtual int setProjectionMode(const char *mode);
+    virtual int setFillMode(const char *);
+    virtual int setPRP(float u, float v, float n);
+    virtual int setPortWindow(float, float, float, float);
+
+    // called by the render thread
+    void drainFrames(void);
+
+ private:
+    void start(void);
+    void stop(void);
+    int addPoint(const Vector &pos, float r, float g, float b);
+    void renderFrame(OffScreenFrame &theFrame);
+
+    // the view of the next frame, as in X11Renderer
+    float vrp[3], vpn[3], vuv[3], cop[3];
+    float vpwindow[4], planedist[2], portwindow[4];
+    int projectionMode, fillMode;
+    bool clearNext;
+
+    // ring of frames, numFull of them from drainFrame waiting to be rendered
+    int queueDepth;
+    OffScreenFrame **theFrames;
+    OffScreenFrame *currentFrame;
+    int fillFrame;
+    int drainFrame;
+    int numFull;
+    bool finished;
+    bool threaded;
+#ifndef _WIN32
+    pthread_t renderer;
+    pthread_mutex_t lock;
+    pthread_cond_t frameFull;
+    pthread_cond_t frameFree;
+#endif
+
+    // the pipeline, used by the render thread only
+    View *theView;
+    Projection *theProjection;
+    Clipping *theClipping;
+    Viewport *theViewport;
+    ScanLineConverter *theScan;
+    ImageDevice *theDevice;
+    FILE *theVideo;
+};
+
+#endif
@@ -294,12 +294,13 @@ ScanLineConverter::DrawWire(FACE &face)
 }
   
 
-LIST<EDGE> FaceEdges(ORDER_DECREASING);
-LIST<EDGE> ActiveEdges(ORDER_INCREASING);
-  
 void
 ScanLineConverter::DrawFill(FACE &face)
 {
+  // the edge lists are local so converters can scan on different threads
+  LIST<EDGE> FaceEdges(ORDER_DECREASING);
+  LIST<EDGE> ActiveEdges(ORDER_INCREASING);
+
 //  MYPOINT *point;
   int y1, y2, cnt, slope;
   int Ymax, Ymin, Pixel, xleft, xright, dX;
@@ -344,9 +345,10 @@ ScanLineConverter::DrawFill(FACE &face)
      // for each edge on active list increment the attributes & check 
      // if it should still be there
      FOR_EACH(Edge, ActiveEdges) {  
-       if (Edge->edge_YBot() > ScanLine)  
+       if (Edge->edge_YBot() > ScanLine) {
 	 Edge = ActiveEdges.RemoveCurrent();
-       else
+	 delete Edge;
+       } else
 	 Edge->INCREMENT(); 
      }	
 
@@ -52,13 +52,13 @@ View::update(void)
     v[i] = vuv[i];
   }
    
-  if (n.Normalize() != 0) {
+  if (n.Normalize() == 0) {
     opserr << "View::update() - VPN cannot have zero length\n";
     return -1;
   }
 
   u = v % n;
-  if (u.Normalize() != 0) {
+  if (u.Normalize() == 0) {
     opserr << "View::update() - VUV X VPN cannot have zero length\n";
     return -1;
   }
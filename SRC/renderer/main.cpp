@@ -34,9 +34,9 @@ using std::cin;
 StandardStream sserr;
 OPS_Stream *opserrPtr  = &sserr;
 
-double        ops_Dt = 0;
-Domain       *ops_TheActiveDomain = 0;
-Element      *ops_TheActiveElement = 0;
+OPS_THREAD_LOCAL double        ops_Dt = 0;
+OPS_THREAD_LOCAL Domain       *ops_TheActiveDomain = 0;
+OPS_THREAD_LOCAL Element      *ops_TheActiveElement = 0;
 
 #include <OpenGLRenderer.h>
 #include <PlainMap.h>
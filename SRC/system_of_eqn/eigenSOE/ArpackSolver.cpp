@@ -65,8 +65,9 @@ static int sizeWork = 0;
 ArpackSolver::ArpackSolver()
 :EigenSolver(EigenSOLVER_TAGS_ArpackSolver),
  theSOE(0), numModesMax(0), numMode(0), size(0),
- eigenvalues(0), eigenvectors(0), 
- v(0), workl(0), workd(0), resid(0), select(0)
+ eigenvalues(0), eigenvectors(0), sizeEigenvectors(0),
+ v(0), workl(0), workd(0), resid(0), select(0),
+ sizeWorkspace(0), ncvWorkspace(0)
 {
   // do nothing here.    
 }
@@ -145,9 +146,6 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
     return -1;
   }
   
-  // set up the space for ARPACK functions.
-  // this is done each time method is called!! .. this needs to be cleaned up
-  
   int n = size;
   int nev = numModes;
   int ncv = getNCV(n, nev);
@@ -156,23 +154,19 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 
   int processID = theArpackSOE->processID;
   
-  // set up the space for ARPACK functions.
-  // this is done each time method is called!! .. this needs to be cleaned up
-  if (numModes > numModesMax) {
+  // the ARPACK workspace is kept between calls; it is only reallocated
+  // when the number of equations or the size of the Lanczos basis changes
+  if (n != sizeWorkspace || ncv != ncvWorkspace) {
     
     if (v != 0) delete [] v;
     if (workl != 0) delete [] workl;
     if (workd != 0) delete [] workd;
-    if (eigenvalues != 0) delete [] eigenvalues;
-    if (eigenvectors != 0) delete [] eigenvectors;
     if (resid != 0) delete [] resid;
     if (select != 0) delete [] select;
     
     v = new double[ldv * ncv];
     workl = new double[lworkl + 1];
     workd = new double[3 * n + 1];
-    eigenvalues = new double[nev];
-    eigenvectors = new double[n * nev];
     resid = new double[n];
     select = new logical[ncv];
 
@@ -183,8 +177,49 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 
     for (int i=0; i<ldv*ncv; i++)
       v[i] = 0;
-    
-    numModesMax = numModes;
+
+    sizeWorkspace = n;
+    ncvWorkspace = ncv;
+  }
+
+  if (numModes > numModesMax || n*numModesMax > sizeEigenvectors) {
+
+    // keep the previous eigenvectors, they give the starting vector below
+    double *oldEigenvectors = eigenvectors;
+    int numOld = (n*numMode <= sizeEigenvectors) ? numMode : 0;
+
+    if (numModes > numModesMax)
+      numModesMax = numModes;
+
+    if (eigenvalues != 0) delete [] eigenvalues;
+    eigenvalues = new double[numModesMax];
+    eigenvectors = new double[n * numModesMax];
+    sizeEigenvectors = n * numModesMax;
+
+    if (oldEigenvectors != 0) {
+      for (int i=0; i<n*numOld; i++)
+	eigenvectors[i] = oldEigenvectors[i];
+      delete [] oldEigenvectors;
+    }
+    numMode = numOld;
+  }
+
+  // start the Lanczos process from the sum of the last eigenvectors found
+  // (if the system has not changed size since); when the model has only
+  // changed a little, as when frequencies are tracked along an analysis,
+  // this needs far fewer restarts than a random starting vector
+  int info = 0;
+  if (numMode > 0 && n*numMode <= sizeEigenvectors) {
+    double norm = 0.0;
+    for (int i=0; i<n; i++) {
+      double sum = 0.0;
+      for (int j=0; j<numMode; j++)
+	sum += eigenvectors[j*n+i];
+      resid[i] = sum;
+      norm += sum*sum;
+    }
+    if (norm > 0.0)
+      info = 1;
   }
 
   static char which[3];
@@ -200,7 +235,6 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
   
   // some more variables
   double tol = 0.0;
-  int info = 0;
   int maxitr = 1000;
   int mode = 3;
   
@@ -343,8 +377,7 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
       opserr << "unrecognised return value\n";
     }
     
-    eigenvalues = 0;
-    eigenvectors = 0;
+    numMode = 0;
     
     return info;
   } else {
@@ -376,6 +409,7 @@ ArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 #endif
       if (info != 0) {
 	opserr << "ArpackSolver::Error with dseupd_" << info;
+	numMode = 0;
 	switch(info) {
 	  
 	case -1: 
@@ -594,6 +628,16 @@ ArpackSolver::getEigenvector(int mode)
 }
 
 
+const double *
+ArpackSolver::getEigenvectors(int &numEqn)
+{
+  numEqn = size;
+  if (numMode == 0)
+    return 0;
+  return eigenvectors;
+}
+
+
 double
 ArpackSolver::getEigenvalue(int mode)
 {
@@ -614,13 +658,18 @@ ArpackSolver::getEigenvalue(int mode)
 int
 ArpackSolver::setSize()
 {
+  // eigenvectors of a different sized system are no use as a start
+  if (theArpackSOE->Msize != size)
+    numMode = 0;
+
   size = theArpackSOE->Msize;
 
-  if (sizeWork < size)
+  if (sizeWork < size) {
     if (workArea != 0)
       delete [] workArea;
-
-  workArea = new double[size];
+    workArea = new double[size];
+    sizeWork = size;
+  }
   
   return 0;
 }
@@ -62,6 +62,7 @@ class ArpackSolver : public EigenSolver
     
     const Vector &getEigenvector(int mode);
     double getEigenvalue(int mode);
+    const double *getEigenvectors(int &numEqn);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
@@ -77,6 +78,7 @@ class ArpackSolver : public EigenSolver
     int size;
     double *eigenvalues;
     double *eigenvectors;
+    int sizeEigenvectors;
     Vector theVector;
 
     double shift;
@@ -88,6 +90,7 @@ class ArpackSolver : public EigenSolver
     int iparam[11];
     int ipntr[11];
     logical *select;
+    int sizeWorkspace, ncvWorkspace;
     
     void myMv(int n, double *v, double *result);
     void myCopy(int n, double *v, double *result);
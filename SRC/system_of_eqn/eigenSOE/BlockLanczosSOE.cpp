@@ -0,0 +1,280 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSOE.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for BlockLanczosSOE.
+
+// What: "@(#) BlockLanczosSOE.C, revA"
+
+#include <BlockLanczosSOE.h>
+#include <BlockLanczosSolver.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <LinearSOE.h>
+
+BlockLanczosSOE::BlockLanczosSOE(double s, int blockSize)
+:EigenSOE(EigenSOE_TAGS_BlockLanczosSOE),
+ size(0), nnz(0), rowStartA(0), colA(0), M(0), Asize(0),
+ shift(s), theModel(0), theSOE(0)
+{
+  BlockLanczosSolver *theSolvr = new BlockLanczosSolver(blockSize);
+  this->setSolver(*theSolvr);
+  theSolvr->setEigenSOE(*this);
+}
+
+
+BlockLanczosSOE::~BlockLanczosSOE()
+{
+  if (rowStartA != 0) delete [] rowStartA;
+  if (colA != 0) delete [] colA;
+  if (M != 0) delete [] M;
+}
+
+
+int
+BlockLanczosSOE::getNumEqn(void) const
+{
+  return size;
+}
+
+
+int
+BlockLanczosSOE::setSize(Graph &theGraph)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING BlockLanczosSOE::setSize() - no LinearSOE set\n";
+    return -1;
+  }
+
+  // the LinearSOE has had setSize() called by the analysis, here the
+  // row compressed pattern for M is formed from the same graph
+  int result = 0;
+  size = theGraph.getNumVertex();
+
+  Vertex *theVertex;
+  int newNNZ = 0;
+  VertexIter &theVertices = theGraph.getVertices();
+  while ((theVertex = theVertices()) != 0) {
+    const ID &theAdjacency = theVertex->getAdjacency();
+    newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+  }
+  nnz = newNNZ;
+
+  if (newNNZ > Asize) {
+    if (colA != 0) delete [] colA;
+    if (M != 0) delete [] M;
+
+    colA = new int[newNNZ];
+    M = new double[newNNZ];
+    Asize = newNNZ;
+  }
+
+  if (rowStartA != 0) delete [] rowStartA;
+  rowStartA = new int[size+1];
+
+  for (int i=0; i<nnz; i++)
+    M[i] = 0.0;
+
+  // fill in rowStartA and colA, the columns of each row in order
+  rowStartA[0] = 0;
+  int lastLoc = 0;
+  for (int a=0; a<size; a++) {
+
+    theVertex = theGraph.getVertexPtr(a);
+    if (theVertex == 0) {
+      opserr << "WARNING BlockLanczosSOE::setSize() - vertex " << a;
+      opserr << " not in graph! - size set to 0\n";
+      size = 0;
+      return -1;
+    }
+
+    int startLoc = lastLoc;
+    colA[lastLoc++] = theVertex->getTag();
+    const ID &theAdjacency = theVertex->getAdjacency();
+    int idSize = theAdjacency.Size();
+    for (int i=0; i<idSize; i++) {
+      int col = theAdjacency(i);
+      int j = lastLoc;
+      while (j > startLoc && colA[j-1] > col) {
+	colA[j] = colA[j-1];
+	j--;
+      }
+      colA[j] = col;
+      lastLoc++;
+    }
+    rowStartA[a+1] = lastLoc;
+  }
+
+  EigenSolver *theSolvr = this->getSolver();
+  int solverOK = theSolvr->setSize();
+  if (solverOK < 0) {
+    opserr << "WARNING BlockLanczosSOE::setSize() - solver failed setSize()\n";
+    return solverOK;
+  }
+
+  return result;
+}
+
+
+int
+BlockLanczosSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::addA() - no SOE set\n";
+    return -1;
+  }
+
+  if (fact == 0.0)  return 0;
+
+  return theSOE->addA(m, id, fact);
+}
+
+
+int
+BlockLanczosSOE::addM(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::addM() - no SOE set\n";
+    return -1;
+  }
+
+  if (fact == 0.0)  return 0;
+
+  if (shift != 0.0)
+    if (theSOE->addA(m, id, -shift*fact) < 0)
+      return -1;
+
+  int idSize = id.Size();
+  if (idSize != m.noRows() && idSize != m.noCols()) {
+    opserr << "BlockLanczosSOE::addM() - Matrix and ID not of similar sizes\n";
+    return -1;
+  }
+
+  for (int i=0; i<idSize; i++) {
+    int row = id(i);
+    if (row < size && row >= 0) {
+      int startRowLoc = rowStartA[row];
+      int endRowLoc = rowStartA[row+1];
+      for (int j=0; j<idSize; j++) {
+	int col = id(j);
+	if (col < size && col >= 0 && m(i,j) != 0.0) {
+	  // binary search, the columns of a row are in order
+	  int lo = startRowLoc;
+	  int hi = endRowLoc-1;
+	  while (lo <= hi) {
+	    int mid = (lo+hi)/2;
+	    if (colA[mid] < col)
+	      lo = mid+1;
+	    else if (colA[mid] > col)
+	      hi = mid-1;
+	    else {
+	      M[mid] += fact * m(i,j);
+	      break;
+	    }
+	  }
+	}
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+void
+BlockLanczosSOE::zeroA(void)
+{
+  if (theSOE == 0) {
+    opserr << "BlockLanczosSOE::zeroA() - no SOE set\n";
+    return;
+  }
+  theSOE->zeroA();
+}
+
+
+void
+BlockLanczosSOE::zeroM(void)
+{
+  for (int i=0; i<nnz; i++)
+    M[i] = 0.0;
+}
+
+
+double
+BlockLanczosSOE::getShift(void)
+{
+  return shift;
+}
+
+
+void
+BlockLanczosSOE::formMX(int numCol, const double *X, double *Y)
+{
+  for (int c=0; c<numCol; c++) {
+    const double *x = &X[c*size];
+    double *y = &Y[c*size];
+    for (int i=0; i<size; i++) {
+      double sum = 0.0;
+      for (int k=rowStartA[i]; k<rowStartA[i+1]; k++)
+	sum += M[k]*x[colA[k]];
+      y[i] = sum;
+    }
+  }
+}
+
+
+int
+BlockLanczosSOE::setLinks(AnalysisModel &theAnalysisModel)
+{
+  theModel = &theAnalysisModel;
+  return 0;
+}
+
+
+int
+BlockLanczosSOE::setLinearSOE(LinearSOE &theLinearSOE)
+{
+  theSOE = &theLinearSOE;
+  return 0;
+}
+
+
+int
+BlockLanczosSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+BlockLanczosSOE::recvSelf(int commitTag, Channel &theChannel,
+			  FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
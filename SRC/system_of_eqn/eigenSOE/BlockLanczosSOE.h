@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSOE.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// BlockLanczosSOE. BlockLanczosSOE is a subclass of EigenSOE for the
+// many modes of a large model. Like ArpackSOE it uses the LinearSOE of
+// the analysis, which is left holding K - shift M, so that only the
+// sparse factorization of that SOE is ever needed; M is kept in row
+// compressed storage over the pattern of the DOF graph. The
+// BlockLanczosSolver iterates on blocks of vectors at a time.
+
+// What: "@(#) BlockLanczosSOE.h, revA"
+
+#ifndef BlockLanczosSOE_h
+#define BlockLanczosSOE_h
+
+#include <EigenSOE.h>
+
+class AnalysisModel;
+class BlockLanczosSolver;
+class LinearSOE;
+
+class BlockLanczosSOE : public EigenSOE
+{
+  public:
+    BlockLanczosSOE(double shift = 0.0, int blockSize = 0);
+    ~BlockLanczosSOE();
+
+    int setLinks(AnalysisModel &theModel);
+    int setLinearSOE(LinearSOE &theSOE);
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addM(const Matrix &, const ID &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroM(void);
+
+    double getShift(void);
+
+    // Y = M X for the numCol columns of X, both stored by column
+    void formMX(int numCol, const double *X, double *Y);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    friend class BlockLanczosSolver;
+
+  protected:
+
+  private:
+    int size;
+    int nnz;
+    int *rowStartA;
+    int *colA;
+    double *M;
+    int Asize;
+
+    double shift;
+    AnalysisModel *theModel;
+    LinearSOE *theSOE;
+};
+
+#endif
@@ -0,0 +1,592 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for BlockLanczosSolver.
+
+// What: "@(#) BlockLanczosSolver.C, revA"
+
+#include <BlockLanczosSolver.h>
+#include <BlockLanczosSOE.h>
+#include <LinearSOE.h>
+#include <Matrix.h>
+#include <math.h>
+#include <float.h>
+
+#ifdef _WIN32
+extern "C" int DGEMM(char *transA, char *transB, int *M, int *N, int *K,
+		     double *alpha, double *A, int *LDA, double *B, int *LDB,
+		     double *beta, double *C, int *LDC);
+
+extern "C" int DSYEV(char *jobz, char *uplo, int *n, double *a, int *lda,
+		     double *w, double *work, int *lwork, int *info);
+#else
+extern "C" int dgemm_(char *transA, char *transB, int *M, int *N, int *K,
+		      double *alpha, double *A, int *LDA, double *B, int *LDB,
+		      double *beta, double *C, int *LDC);
+
+extern "C" int dsyev_(char *jobz, char *uplo, int *n, double *a, int *lda,
+		      double *w, double *work, int *lwork, int *info);
+#endif
+
+// C = alpha op(A) op(B) + beta C
+static void
+gemm(char transA, char transB, int m, int n, int k, double alpha,
+     double *A, int ldA, double *B, int ldB, double beta, double *C, int ldC)
+{
+  if (m <= 0 || n <= 0)
+    return;
+  if (k <= 0) {
+    for (int j=0; j<n; j++)
+      for (int i=0; i<m; i++)
+	C[j*ldC+i] *= beta;
+    return;
+  }
+#ifdef _WIN32
+  DGEMM(&transA, &transB, &m, &n, &k, &alpha, A, &ldA, B, &ldB, &beta, C, &ldC);
+#else
+  dgemm_(&transA, &transB, &m, &n, &k, &alpha, A, &ldA, B, &ldB, &beta, C, &ldC);
+#endif
+}
+
+
+BlockLanczosSolver::BlockLanczosSolver(int bs, double t, int maxR)
+:EigenSolver(EigenSOLVER_TAGS_BlockLanczosSolver),
+ theLanczosSOE(0), blockSize(bs), tol(t), maxRestart(maxR),
+ size(0), numMode(0), eigenvalues(0), eigenvectors(0), sizeEigenvectors(0),
+ maxBasis(0), V(0), T(0), W(0), MW(0), H(0), sizeV(0), sizeT(0), sizeW(0),
+ seed(1)
+{
+
+}
+
+
+BlockLanczosSolver::~BlockLanczosSolver()
+{
+  if (eigenvalues != 0) delete [] eigenvalues;
+  if (eigenvectors != 0) delete [] eigenvectors;
+  if (V != 0) delete [] V;
+  if (T != 0) delete [] T;
+  if (W != 0) delete [] W;
+  if (MW != 0) delete [] MW;
+  if (H != 0) delete [] H;
+}
+
+
+double
+BlockLanczosSolver::nextRandom(void)
+{
+  seed = seed*1103515245 + 12345;
+  return ((seed/65536) % 32768)/16383.5 - 1.0;
+}
+
+
+// X = (K - shift M)^-1 M X for the numCol columns of X
+int
+BlockLanczosSolver::applyOperator(int numCol, double *X)
+{
+  LinearSOE *theSOE = theLanczosSOE->theSOE;
+  int n = size;
+
+  theLanczosSOE->formMX(numCol, X, MW);
+  Matrix B(MW, n, numCol);
+  if (theSOE->setBlockB(B) < 0 || theSOE->solveBlock() < 0) {
+    opserr << "WARNING BlockLanczosSolver::solve() - the LinearSOE failed to solve\n";
+    return -1;
+  }
+
+  const Matrix &theX = theSOE->getBlockX();
+  for (int j=0; j<numCol; j++)
+    for (int i=0; i<n; i++)
+      X[j*n+i] = theX(i,j);
+
+  return 0;
+}
+
+
+// the numCol vectors in W, the operator applied to the columns act to
+// cur of V, are M-orthogonalized against the cur columns of V and each
+// other and appended to V as columns cur to cur+numCol; the coefficients
+// go into T, which is kept symmetric
+int
+BlockLanczosSolver::extendBasis(int numCol, int act, int cur)
+{
+  int n = size;
+  int ldT = maxBasis;
+
+  // the M-norms before the projection, to tell a column that is lost in it
+  theLanczosSOE->formMX(numCol, W, MW);
+  double norm0[64];
+  double *normW = (numCol <= 64) ? norm0 : new double[numCol];
+  for (int c=0; c<numCol; c++) {
+    double sum = 0.0;
+    for (int i=0; i<n; i++)
+      sum += W[c*n+i]*MW[c*n+i];
+    normW[c] = sqrt(fabs(sum));
+  }
+
+  // two passes of block Gram-Schmidt against the basis, in matrix products
+  for (int c=0; c<numCol; c++)
+    for (int j=0; j<cur; j++)
+      T[(act+c)*ldT+j] = 0.0;
+
+  for (int pass=0; pass<2 && cur > 0; pass++) {
+    if (pass > 0)
+      theLanczosSOE->formMX(numCol, W, MW);
+    gemm('T', 'N', cur, numCol, n, 1.0, V, n, MW, n, 0.0, H, cur);
+    gemm('N', 'N', n, numCol, cur, -1.0, V, n, H, cur, 1.0, W, n);
+    for (int c=0; c<numCol; c++)
+      for (int j=0; j<cur; j++)
+	T[(act+c)*ldT+j] += H[c*cur+j];
+  }
+
+  // T is symmetric; in the diagonal block the two halves are averaged
+  for (int c=0; c<numCol; c++) {
+    int col = act+c;
+    for (int j=0; j<act; j++)
+      T[j*ldT+col] = T[col*ldT+j];
+    for (int j=act; j<col; j++) {
+      double value = 0.5*(T[col*ldT+j] + T[j*ldT+col]);
+      T[col*ldT+j] = value;
+      T[j*ldT+col] = value;
+    }
+  }
+
+  // then the columns one at a time against those already appended; a
+  // column that vanishes means the block found an invariant subspace, it
+  // is replaced by a random vector outside the basis with no coupling
+  for (int c=0; c<numCol; c++) {
+    double *w = &W[c*n];
+    int col = cur+c;
+    if (col >= maxBasis)
+      break;
+
+    for (int i=0; i<numCol; i++)
+      T[(act+c)*ldT+cur+i] = 0.0;
+
+    for (int pass=0; pass<2; pass++) {
+      theLanczosSOE->formMX(1, w, MW);
+      for (int i=0; i<c; i++) {
+	double *q = &V[(cur+i)*n];
+	double h = 0.0;
+	for (int k=0; k<n; k++)
+	  h += q[k]*MW[k];
+	for (int k=0; k<n; k++)
+	  w[k] -= h*q[k];
+	T[(act+c)*ldT+cur+i] += h;
+      }
+    }
+
+    theLanczosSOE->formMX(1, w, MW);
+    double norm = 0.0;
+    for (int k=0; k<n; k++)
+      norm += w[k]*MW[k];
+    norm = sqrt(fabs(norm));
+
+    if (norm <= 1.0e-10*normW[c] || normW[c] == 0.0) {
+      for (int k=0; k<n; k++)
+	w[k] = this->nextRandom();
+      for (int pass=0; pass<2; pass++) {
+	theLanczosSOE->formMX(1, w, MW);
+	gemm('T', 'N', col, 1, n, 1.0, V, n, MW, n, 0.0, H, col);
+	gemm('N', 'N', n, 1, col, -1.0, V, n, H, col, 1.0, w, n);
+      }
+      theLanczosSOE->formMX(1, w, MW);
+      double normR = 0.0;
+      for (int k=0; k<n; k++)
+	normR += w[k]*MW[k];
+      normR = sqrt(fabs(normR));
+      // with no room left outside the basis the column stays zero
+      double scale = (normR > 1.0e-8) ? 1.0/normR : 0.0;
+      for (int k=0; k<n; k++)
+	w[k] *= scale;
+      norm = 0.0;
+    } else {
+      for (int k=0; k<n; k++)
+	w[k] /= norm;
+    }
+
+    T[(act+c)*ldT+col] = norm;
+    for (int i=0; i<=c; i++)
+      T[(cur+i)*ldT+act+c] = T[(act+c)*ldT+cur+i];
+
+    double *v = &V[col*n];
+    for (int k=0; k<n; k++)
+      v[k] = w[k];
+  }
+
+  if (normW != norm0)
+    delete [] normW;
+
+  return 0;
+}
+
+
+int
+BlockLanczosSolver::solve(int numModes, bool generalized, bool findSmallest)
+{
+  if (generalized == false || findSmallest == false) {
+    opserr << "BlockLanczosSolver::solve() - only the generalized problem for the";
+    opserr << " eigenvalues closest to the shift is solved\n";
+    return -1;
+  }
+
+  if (theLanczosSOE == 0 || theLanczosSOE->theSOE == 0) {
+    opserr << "BlockLanczosSolver::solve() - no LinearSOE set\n";
+    return -1;
+  }
+
+  int n = size;
+  int nev = numModes;
+  if (nev <= 0 || nev >= n) {
+    opserr << "BlockLanczosSolver::solve() - numModes " << nev;
+    opserr << " must be positive and less than the number of equations " << n << endln;
+    return -1;
+  }
+
+  // the block size, and the size of the basis at which it is restarted
+  int p = blockSize;
+  if (p <= 0)
+    p = (nev < 8) ? nev : 8;
+  if (p > n - nev)
+    p = n - nev;
+  if (p > 64)
+    p = 64;
+
+  int m = nev/4;
+  if (m < 3*p)
+    m = 3*p;
+  m += nev;
+  if (m > n)
+    m = n;
+
+  maxBasis = m + 2*p;
+  if (n*maxBasis > sizeV) {
+    if (V != 0) delete [] V;
+    V = new double[n*maxBasis];
+    sizeV = n*maxBasis;
+  }
+  if (maxBasis*maxBasis > sizeT) {
+    if (T != 0) delete [] T;
+    if (H != 0) delete [] H;
+    T = new double[maxBasis*maxBasis];
+    H = new double[maxBasis*64];
+    sizeT = maxBasis*maxBasis;
+  }
+  if (n*p > sizeW) {
+    if (W != 0) delete [] W;
+    if (MW != 0) delete [] MW;
+    W = new double[n*p];
+    MW = new double[n*p];
+    sizeW = n*p;
+  }
+  int ldT = maxBasis;
+
+  // the starting block: the eigenvectors of the last solve if the system
+  // has not changed size since, summed into the columns of the block,
+  // otherwise random; (K - shift M)^-1 M is applied once so that the basis
+  // has nothing in the directions M does not see
+  seed = 1;
+  for (int c=0; c<p; c++) {
+    double *w = &W[c*n];
+    if (numMode > 0 && n*numMode <= sizeEigenvectors) {
+      for (int i=0; i<n; i++)
+	w[i] = 0.0;
+      for (int j=c; j<numMode; j+=p)
+	for (int i=0; i<n; i++)
+	  w[i] += eigenvectors[j*n+i];
+    } else {
+      for (int i=0; i<n; i++)
+	w[i] = this->nextRandom();
+    }
+  }
+  if (this->applyOperator(p, W) < 0)
+    return -2;
+  this->extendBasis(p, 0, 0);
+  for (int i=0; i<maxBasis*maxBasis; i++)
+    T[i] = 0.0;
+
+  int act = 0;
+  int cur = p;
+
+  // the basis may pass m by up to a block before the Ritz pairs are found
+  double *S = new double[maxBasis*maxBasis];
+  double *theta = new double[maxBasis];
+  double *resid = new double[maxBasis];
+  int *order = new int[maxBasis];
+  int lwork = 34*maxBasis;
+  double *work = new double[lwork];
+  int r = 0;
+  int numConverged = 0;
+  int result = 0;
+
+  for (int restart = 0; ; restart++) {
+
+    // extend the basis a block at a time up to m columns
+    while (act < m) {
+      int b = cur - act;
+      for (int i=0; i<n*b; i++)
+	W[i] = V[act*n+i];
+      if (this->applyOperator(b, W) < 0) {
+	result = -2;
+	break;
+      }
+      this->extendBasis(b, act, cur);
+      act = cur;
+      cur += b;
+    }
+    if (result < 0)
+      break;
+
+    // the Ritz pairs of the projected matrix
+    r = act;
+    for (int j=0; j<r; j++)
+      for (int i=0; i<r; i++)
+	S[j*r+i] = T[j*ldT+i];
+
+    char jobz = 'V';
+    char uplo = 'U';
+    int info = 0;
+#ifdef _WIN32
+    DSYEV(&jobz, &uplo, &r, S, &r, theta, work, &lwork, &info);
+#else
+    dsyev_(&jobz, &uplo, &r, S, &r, theta, work, &lwork, &info);
+#endif
+    if (info != 0) {
+      opserr << "WARNING BlockLanczosSolver::solve() - dsyev failed with info " << info << endln;
+      result = -3;
+      break;
+    }
+
+    // largest |theta| first, those are the eigenvalues closest to the shift
+    for (int i=0; i<r; i++)
+      order[i] = i;
+    for (int i=1; i<r; i++) {
+      int k = order[i];
+      int j = i;
+      while (j > 0 && fabs(theta[order[j-1]]) < fabs(theta[k])) {
+	order[j] = order[j-1];
+	j--;
+      }
+      order[j] = k;
+    }
+
+    // the residual of a Ritz pair is the coupling of its vector to the
+    // block outside the basis
+    numConverged = 0;
+    for (int i=0; i<nev; i++) {
+      int k = order[i];
+      double sum = 0.0;
+      for (int a=r; a<cur; a++) {
+	double value = 0.0;
+	for (int j=0; j<r; j++)
+	  value += T[j*ldT+a]*S[k*r+j];
+	sum += value*value;
+      }
+      resid[i] = sqrt(sum);
+      if (resid[i] <= tol*fabs(theta[k]))
+	numConverged++;
+    }
+
+    if (numConverged == nev)
+      break;
+
+    // thick restart from the wanted Ritz vectors and half of the others
+    int k = nev + (m - nev)/2;
+    if (k > m - p)
+      k = m - p;
+    if (restart >= maxRestart || k < nev) {
+      opserr << "WARNING BlockLanczosSolver::solve() - only " << numConverged << " of ";
+      opserr << nev << " modes converged after " << restart << " restarts\n";
+      break;
+    }
+
+    int b = cur - r;
+    double *Ssel = new double[r*k];
+    for (int i=0; i<k; i++)
+      for (int j=0; j<r; j++)
+	Ssel[i*r+j] = S[order[i]*r+j];
+
+    double *Y = new double[n*k];
+    gemm('N', 'N', n, k, r, 1.0, V, n, Ssel, r, 0.0, Y, n);
+    double *C = new double[b*k];
+    for (int i=0; i<k; i++)
+      for (int a=0; a<b; a++) {
+	double value = 0.0;
+	for (int j=0; j<r; j++)
+	  value += T[j*ldT+r+a]*Ssel[i*r+j];
+	C[i*b+a] = value;
+      }
+
+    for (int i=0; i<n*b; i++)
+      V[k*n+i] = V[r*n+i];
+    for (int i=0; i<n*k; i++)
+      V[i] = Y[i];
+
+    for (int i=0; i<maxBasis*maxBasis; i++)
+      T[i] = 0.0;
+    for (int i=0; i<k; i++) {
+      T[i*ldT+i] = theta[order[i]];
+      for (int a=0; a<b; a++) {
+	T[i*ldT+k+a] = C[i*b+a];
+	T[(k+a)*ldT+i] = C[i*b+a];
+      }
+    }
+
+    delete [] Ssel;
+    delete [] Y;
+    delete [] C;
+
+    act = k;
+    cur = k + b;
+  }
+
+  if (result == 0) {
+
+    // the eigenvalues shift + 1/theta in ascending order, and their vectors
+    if (nev > numMode || n*nev > sizeEigenvectors) {
+      if (eigenvalues != 0) delete [] eigenvalues;
+      if (eigenvectors != 0) delete [] eigenvectors;
+      eigenvalues = new double[nev];
+      eigenvectors = new double[n*nev];
+      sizeEigenvectors = n*nev;
+    }
+
+    double shift = theLanczosSOE->shift;
+    for (int i=0; i<nev; i++) {
+      double value = theta[order[i]];
+      if (fabs(value) < DBL_MIN) {
+	opserr << "WARNING BlockLanczosSolver::solve() - fewer than " << nev;
+	opserr << " modes with a finite eigenvalue\n";
+	result = -3;
+	break;
+      }
+      eigenvalues[i] = shift + 1.0/value;
+    }
+
+    if (result == 0) {
+      for (int i=1; i<nev; i++) {
+	double value = eigenvalues[i];
+	int k = order[i];
+	int j = i;
+	while (j > 0 && eigenvalues[j-1] > value) {
+	  eigenvalues[j] = eigenvalues[j-1];
+	  order[j] = order[j-1];
+	  j--;
+	}
+	eigenvalues[j] = value;
+	order[j] = k;
+      }
+
+      double *Ssel = new double[r*nev];
+      for (int i=0; i<nev; i++)
+	for (int j=0; j<r; j++)
+	  Ssel[i*r+j] = S[order[i]*r+j];
+      gemm('N', 'N', n, nev, r, 1.0, V, n, Ssel, r, 0.0, eigenvectors, n);
+      delete [] Ssel;
+    }
+  }
+
+  delete [] S;
+  delete [] theta;
+  delete [] resid;
+  delete [] order;
+  delete [] work;
+
+  numMode = (result == 0) ? nev : 0;
+  return result;
+}
+
+
+int
+BlockLanczosSolver::setEigenSOE(BlockLanczosSOE &theSOE)
+{
+  theLanczosSOE = &theSOE;
+  return 0;
+}
+
+
+const Vector &
+BlockLanczosSolver::getEigenvector(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "BlockLanczosSolver::getEigenvector() - mode " << mode << " is out of range\n";
+    theVector.resize(size);
+    theVector.Zero();
+    return theVector;
+  }
+
+  theVector.setData(&eigenvectors[(mode-1)*size], size);
+  return theVector;
+}
+
+
+double
+BlockLanczosSolver::getEigenvalue(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "BlockLanczosSolver::getEigenvalue() - mode " << mode << " is out of range\n";
+    return -1.0;
+  }
+
+  return eigenvalues[mode-1];
+}
+
+
+const double *
+BlockLanczosSolver::getEigenvectors(int &numEqn)
+{
+  numEqn = size;
+  if (numMode == 0)
+    return 0;
+  return eigenvectors;
+}
+
+
+int
+BlockLanczosSolver::setSize(void)
+{
+  // eigenvectors of a different sized system are no use as a start
+  if (theLanczosSOE->size != size)
+    numMode = 0;
+
+  size = theLanczosSOE->size;
+  return 0;
+}
+
+
+int
+BlockLanczosSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+BlockLanczosSolver::recvSelf(int commitTag, Channel &theChannel,
+			     FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
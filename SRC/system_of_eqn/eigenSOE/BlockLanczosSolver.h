@@ -0,0 +1,94 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/BlockLanczosSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// BlockLanczosSolver, the solver of a BlockLanczosSOE. It is a shift and
+// invert block Lanczos method with full reorthogonalization and thick
+// restarts: the operator (K - shift M)^-1 M is applied to blockSize
+// vectors at a time through the block solve of the LinearSOE, so that
+// each pass over the factors serves the whole block, and the basis is
+// kept M-orthogonal with matrix-matrix products. After each sweep the
+// Ritz pairs are found from the dense projected matrix; the wanted ones
+// and half of the others are kept to restart until the numModes
+// eigenvalues closest to the shift have converged. The eigenvectors are
+// M-orthonormal and held in one array, see getEigenvectors().
+
+// What: "@(#) BlockLanczosSolver.h, revA"
+
+#ifndef BlockLanczosSolver_h
+#define BlockLanczosSolver_h
+
+#include <EigenSolver.h>
+#include <BlockLanczosSOE.h>
+
+class BlockLanczosSolver : public EigenSolver
+{
+  public:
+    BlockLanczosSolver(int blockSize = 0, double tol = 1.0e-10, int maxRestart = 100);
+    ~BlockLanczosSolver();
+
+    int solve(int numMode, bool generalized, bool findSmallest = true);
+    int setSize(void);
+    int setEigenSOE(BlockLanczosSOE &theSOE);
+
+    const Vector &getEigenvector(int mode);
+    double getEigenvalue(int mode);
+    const double *getEigenvectors(int &numEqn);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int applyOperator(int numCol, double *X);
+    int extendBasis(int numCol, int act, int cur);
+    double nextRandom(void);
+
+    BlockLanczosSOE *theLanczosSOE;
+    int blockSize;
+    double tol;
+    int maxRestart;
+
+    int size;
+    int numMode;
+    double *eigenvalues;
+    double *eigenvectors;
+    int sizeEigenvectors;
+    Vector theVector;
+
+    int maxBasis;         // columns of the basis V, and rows of T
+    double *V;
+    double *T;
+    double *W;
+    double *MW;
+    double *H;
+    int sizeV, sizeT, sizeW;
+    unsigned int seed;
+};
+
+#endif
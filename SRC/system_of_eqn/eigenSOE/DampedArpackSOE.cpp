@@ -0,0 +1,365 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/DampedArpackSOE.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for DampedArpackSOE.
+
+// What: "@(#) DampedArpackSOE.C, revA"
+
+#include <DampedArpackSOE.h>
+#include <DampedArpackSolver.h>
+#include <Matrix.h>
+#include <ID.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <FE_EleIter.h>
+#include <FE_Element.h>
+#include <DOF_GrpIter.h>
+#include <DOF_Group.h>
+#include <LinearSOE.h>
+
+DampedArpackSOE::DampedArpackSOE(double s)
+:EigenSOE(EigenSOE_TAGS_DampedArpackSOE),
+ size(0), nnz(0), rowStartA(0), colA(0), M(0), C(0), Asize(0),
+ shift(s), formedC(false), theModel(0), theSOE(0)
+{
+  DampedArpackSolver *theSolvr = new DampedArpackSolver();
+  this->setSolver(*theSolvr);
+  theSolvr->setEigenSOE(*this);
+}
+
+
+DampedArpackSOE::~DampedArpackSOE()
+{
+  if (rowStartA != 0) delete [] rowStartA;
+  if (colA != 0) delete [] colA;
+  if (M != 0) delete [] M;
+  if (C != 0) delete [] C;
+}
+
+
+int
+DampedArpackSOE::getNumEqn(void) const
+{
+  return size;
+}
+
+
+int
+DampedArpackSOE::setSize(Graph &theGraph)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING DampedArpackSOE::setSize() - no LinearSOE set\n";
+    return -1;
+  }
+
+  // the LinearSOE has had setSize() called by the analysis, here the
+  // row compressed pattern for M and C is formed from the same graph
+  int result = 0;
+  size = theGraph.getNumVertex();
+
+  Vertex *theVertex;
+  int newNNZ = 0;
+  VertexIter &theVertices = theGraph.getVertices();
+  while ((theVertex = theVertices()) != 0) {
+    const ID &theAdjacency = theVertex->getAdjacency();
+    newNNZ += theAdjacency.Size() +1; // the +1 is for the diag entry
+  }
+  nnz = newNNZ;
+
+  if (newNNZ > Asize) {
+    if (colA != 0) delete [] colA;
+    if (M != 0) delete [] M;
+    if (C != 0) delete [] C;
+
+    colA = new int[newNNZ];
+    M = new double[newNNZ];
+    C = new double[newNNZ];
+    Asize = newNNZ;
+  }
+
+  if (rowStartA != 0) delete [] rowStartA;
+  rowStartA = new int[size+1];
+
+  for (int i=0; i<nnz; i++) {
+    M[i] = 0.0;
+    C[i] = 0.0;
+  }
+
+  // fill in rowStartA and colA, the columns of each row in order
+  rowStartA[0] = 0;
+  int lastLoc = 0;
+  for (int a=0; a<size; a++) {
+
+    theVertex = theGraph.getVertexPtr(a);
+    if (theVertex == 0) {
+      opserr << "WARNING DampedArpackSOE::setSize() - vertex " << a;
+      opserr << " not in graph! - size set to 0\n";
+      size = 0;
+      return -1;
+    }
+
+    int startLoc = lastLoc;
+    colA[lastLoc++] = theVertex->getTag();
+    const ID &theAdjacency = theVertex->getAdjacency();
+    int idSize = theAdjacency.Size();
+    for (int i=0; i<idSize; i++) {
+      int col = theAdjacency(i);
+      int j = lastLoc;
+      while (j > startLoc && colA[j-1] > col) {
+	colA[j] = colA[j-1];
+	j--;
+      }
+      colA[j] = col;
+      lastLoc++;
+    }
+    rowStartA[a+1] = lastLoc;
+  }
+
+  EigenSolver *theSolvr = this->getSolver();
+  int solverOK = theSolvr->setSize();
+  if (solverOK < 0) {
+    opserr << "WARNING DampedArpackSOE::setSize() - solver failed setSize()\n";
+    return solverOK;
+  }
+
+  return result;
+}
+
+
+int
+DampedArpackSOE::addMatrix(double *V, const Matrix &m, const ID &id, double fact)
+{
+  int idSize = id.Size();
+  if (idSize != m.noRows() && idSize != m.noCols()) {
+    opserr << "DampedArpackSOE::addMatrix() - Matrix and ID not of similar sizes\n";
+    return -1;
+  }
+
+  for (int i=0; i<idSize; i++) {
+    int row = id(i);
+    if (row < size && row >= 0) {
+      int startRowLoc = rowStartA[row];
+      int endRowLoc = rowStartA[row+1];
+      for (int j=0; j<idSize; j++) {
+	int col = id(j);
+	if (col < size && col >= 0) {
+	  // binary search, the columns of a row are in order
+	  int lo = startRowLoc;
+	  int hi = endRowLoc-1;
+	  while (lo <= hi) {
+	    int mid = (lo+hi)/2;
+	    if (colA[mid] < col)
+	      lo = mid+1;
+	    else if (colA[mid] > col)
+	      hi = mid-1;
+	    else {
+	      V[mid] += fact * m(i,j);
+	      break;
+	    }
+	  }
+	}
+      }
+    }
+  }
+
+  return 0;
+}
+
+
+int
+DampedArpackSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "DampedArpackSOE::addA() - no SOE set\n";
+    return -1;
+  }
+
+  if (fact == 0.0)  return 0;
+
+  return theSOE->addA(m, id, fact);
+}
+
+
+int
+DampedArpackSOE::addM(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "DampedArpackSOE::addM() - no SOE set\n";
+    return -1;
+  }
+
+  if (fact == 0.0)  return 0;
+
+  if (shift != 0.0)
+    if (theSOE->addA(m, id, shift*shift*fact) < 0)
+      return -1;
+
+  return this->addMatrix(M, m, id, fact);
+}
+
+
+int
+DampedArpackSOE::addC(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0) {
+    opserr << "DampedArpackSOE::addC() - no SOE set\n";
+    return -1;
+  }
+
+  if (fact == 0.0)  return 0;
+
+  if (shift != 0.0)
+    if (theSOE->addA(m, id, shift*fact) < 0)
+      return -1;
+
+  return this->addMatrix(C, m, id, fact);
+}
+
+
+void
+DampedArpackSOE::zeroA(void)
+{
+  if (theSOE == 0) {
+    opserr << "DampedArpackSOE::zeroA() - no SOE set\n";
+    return;
+  }
+  theSOE->zeroA();
+
+  // C is formed again with A
+  this->zeroC();
+  formedC = false;
+}
+
+
+void
+DampedArpackSOE::zeroM(void)
+{
+  for (int i=0; i<nnz; i++)
+    M[i] = 0.0;
+}
+
+
+void
+DampedArpackSOE::zeroC(void)
+{
+  for (int i=0; i<nnz; i++)
+    C[i] = 0.0;
+}
+
+
+int
+DampedArpackSOE::formC(void)
+{
+  // once per A, as the shifted C is also added to the LinearSOE
+  if (formedC == true)
+    return 0;
+
+  // the eigen analyses assemble only K and M, so C is formed here from
+  // the damping matrices of the elements and nodes
+  if (theModel == 0) {
+    opserr << "DampedArpackSOE::formC() - no AnalysisModel set\n";
+    return -1;
+  }
+
+  this->zeroC();
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel->getFEs();
+  while ((elePtr = theEles()) != 0) {
+    elePtr->zeroTangent();
+    elePtr->addCtoTang(1.0);
+    if (this->addC(elePtr->getTangent(0), elePtr->getID()) < 0) {
+      opserr << "WARNING DampedArpackSOE::formC() - failed in addC for ID ";
+      opserr << elePtr->getID();
+      return -1;
+    }
+  }
+
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDofs = theModel->getDOFs();
+  while ((dofPtr = theDofs()) != 0) {
+    dofPtr->zeroTangent();
+    dofPtr->addCtoTang(1.0);
+    if (this->addC(dofPtr->getTangent(0), dofPtr->getID()) < 0) {
+      opserr << "WARNING DampedArpackSOE::formC() - failed in addC for ID ";
+      opserr << dofPtr->getID();
+      return -1;
+    }
+  }
+
+  formedC = true;
+  return 0;
+}
+
+
+double
+DampedArpackSOE::getShift(void)
+{
+  return shift;
+}
+
+
+double
+DampedArpackSOE::getDampingRatio(int mode)
+{
+  DampedArpackSolver *theSolvr = (DampedArpackSolver *)this->getSolver();
+  if (theSolvr == 0)
+    return 0.0;
+  return theSolvr->getDampingRatio(mode);
+}
+
+
+int
+DampedArpackSOE::setLinks(AnalysisModel &theAnalysisModel)
+{
+  theModel = &theAnalysisModel;
+  return 0;
+}
+
+
+int
+DampedArpackSOE::setLinearSOE(LinearSOE &theLinearSOE)
+{
+  theSOE = &theLinearSOE;
+  return 0;
+}
+
+
+int
+DampedArpackSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+DampedArpackSOE::recvSelf(int commitTag, Channel &theChannel,
+			  FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,91 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/DampedArpackSOE.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// DampedArpackSOE. DampedArpackSOE is a subclass of EigenSOE for the
+// quadratic eigenvalue problem (lambda^2 M + lambda C + K) x = 0 of a
+// model with non-classical damping. Like ArpackSOE it uses the LinearSOE
+// of the analysis for K, so that only the sparse factorization of that
+// SOE is ever needed; M and C are kept in row compressed storage over the
+// pattern of the DOF graph. The shift s is on lambda: the LinearSOE is
+// left holding K + s C + s^2 M.
+
+// What: "@(#) DampedArpackSOE.h, revA"
+
+#ifndef DampedArpackSOE_h
+#define DampedArpackSOE_h
+
+#include <EigenSOE.h>
+
+class AnalysisModel;
+class DampedArpackSolver;
+class LinearSOE;
+
+class DampedArpackSOE : public EigenSOE
+{
+  public:
+    DampedArpackSOE(double shift = 0.0);
+    ~DampedArpackSOE();
+
+    int setLinks(AnalysisModel &theModel);
+    int setLinearSOE(LinearSOE &theSOE);
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addM(const Matrix &, const ID &, double fact = 1.0);
+    int addC(const Matrix &, const ID &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroM(void);
+    void zeroC(void);
+
+    double getShift(void);
+    double getDampingRatio(int mode);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    friend class DampedArpackSolver;
+
+  protected:
+
+  private:
+    int addMatrix(double *V, const Matrix &m, const ID &id, double fact);
+    int formC(void);
+
+    int size, nnz;
+    int *rowStartA, *colA;
+    double *M, *C;
+    int Asize;
+    double shift;
+    bool formedC;
+    AnalysisModel *theModel;
+    LinearSOE *theSOE;
+};
+
+#endif
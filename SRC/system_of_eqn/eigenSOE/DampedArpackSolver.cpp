@@ -0,0 +1,459 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/DampedArpackSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for DampedArpackSolver.
+
+// What: "@(#) DampedArpackSolver.C, revA"
+
+#include <math.h>
+#include <string.h>
+#include <DampedArpackSolver.h>
+#include <DampedArpackSOE.h>
+#include <LinearSOE.h>
+#include <f2c.h>
+
+#ifdef _WIN32
+
+extern "C" int DNAUPD(int *ido, char *bmat, int *n, char *which, int *nev,
+		      double *tol, double *resid, int *ncv, double *v, int *ldv,
+		      int *iparam, int *ipntr, double *workd, double *workl,
+		      int *lworkl, int *info);
+
+extern "C" int DNEUPD(int *rvec, char *howmny, logical *select,
+		      double *dr, double *di, double *z, int *ldz,
+		      double *sigmar, double *sigmai, double *workev,
+		      char *bmat, int *n, char *which, int *nev,
+		      double *tol, double *resid, int *ncv, double *v, int *ldv,
+		      int *iparam, int *ipntr, double *workd, double *workl,
+		      int *lworkl, int *info);
+
+#else
+
+extern "C" int dnaupd_(int *ido, char *bmat, int *n, char *which, int *nev,
+		       double *tol, double *resid, int *ncv, double *v, int *ldv,
+		       int *iparam, int *ipntr, double *workd, double *workl,
+		       int *lworkl, int *info);
+
+extern "C" int dneupd_(int *rvec, char *howmny, logical *select,
+		       double *dr, double *di, double *z, int *ldz,
+		       double *sigmar, double *sigmai, double *workev,
+		       char *bmat, int *n, char *which, int *nev,
+		       double *tol, double *resid, int *ncv, double *v, int *ldv,
+		       int *iparam, int *ipntr, double *workd, double *workl,
+		       int *lworkl, int *info);
+
+#endif
+
+
+DampedArpackSolver::DampedArpackSolver()
+:EigenSolver(EigenSOLVER_TAGS_DampedArpackSolver),
+ theSOE(0), size(0), numMode(0),
+ eigenvalues(0), dampingRatios(0), eigenvectors(0),
+ sizeWorkspace(0), ncvWorkspace(0), nevWorkspace(0),
+ v(0), workl(0), workd(0), resid(0), workev(0), dr(0), di(0), z(0),
+ work(0), select(0)
+{
+
+}
+
+
+DampedArpackSolver::~DampedArpackSolver()
+{
+  this->freeWorkspace();
+
+  if (eigenvalues != 0) delete [] eigenvalues;
+  if (dampingRatios != 0) delete [] dampingRatios;
+  if (eigenvectors != 0) delete [] eigenvectors;
+}
+
+
+void
+DampedArpackSolver::freeWorkspace(void)
+{
+  if (v != 0) delete [] v;
+  if (workl != 0) delete [] workl;
+  if (workd != 0) delete [] workd;
+  if (resid != 0) delete [] resid;
+  if (workev != 0) delete [] workev;
+  if (dr != 0) delete [] dr;
+  if (di != 0) delete [] di;
+  if (z != 0) delete [] z;
+  if (work != 0) delete [] work;
+  if (select != 0) delete [] select;
+
+  v = 0; workl = 0; workd = 0; resid = 0; workev = 0;
+  dr = 0; di = 0; z = 0; work = 0; select = 0;
+  sizeWorkspace = 0;
+  ncvWorkspace = 0;
+  nevWorkspace = 0;
+}
+
+
+void
+DampedArpackSolver::multiply(const double *V, const double *x, double *y)
+{
+  int n = theSOE->size;
+  const int *rowStart = theSOE->rowStartA;
+  const int *col = theSOE->colA;
+
+  for (int i=0; i<n; i++) {
+    double sum = 0.0;
+    for (int k=rowStart[i]; k<rowStart[i+1]; k++)
+      sum += V[k]*x[col[k]];
+    y[i] = sum;
+  }
+}
+
+
+void
+DampedArpackSolver::applyOP(const double *w, double *result)
+{
+  // [u; v] = inv(A - s B) B [p; q]:
+  //   (K + s C + s^2 M) u = -(M (q + s p) + C p),  v = p + s u
+  int n = size;
+  double s = theSOE->shift;
+  const double *p = w;
+  const double *q = &w[n];
+
+  double *y = work;
+  double *tmp = &work[n];
+
+  for (int i=0; i<n; i++)
+    tmp[i] = q[i] + s*p[i];
+  this->multiply(theSOE->M, tmp, y);
+  this->multiply(theSOE->C, p, tmp);
+  for (int i=0; i<n; i++)
+    y[i] += tmp[i];
+
+  LinearSOE *theLinearSOE = theSOE->theSOE;
+  Vector theB(y, n);
+  theLinearSOE->setB(theB, -1.0);
+  theLinearSOE->solve();
+  const Vector &X = theLinearSOE->getX();
+
+  for (int i=0; i<n; i++) {
+    result[i] = X(i);
+    result[n+i] = p[i] + s*X(i);
+  }
+}
+
+
+int
+DampedArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
+{
+  if (generalized == false) {
+    opserr << "DampedArpackSolver::solve() - only solves generalized problem\n";
+    return -1;
+  }
+
+  if (theSOE == 0 || theSOE->theSOE == 0) {
+    opserr << "DampedArpackSolver::solve() - no EigenSOE or LinearSOE set\n";
+    return -1;
+  }
+
+  numMode = 0;
+  int n = size;
+  if (n == 0 || numModes < 1)
+    return 0;
+
+  if (theSOE->formC() < 0) {
+    opserr << "DampedArpackSolver::solve() - failed to form C\n";
+    return -1;
+  }
+
+  // each mode is a conjugate pair of eigenvalues of the 2n system
+  int N = 2*n;
+  int nev = 2*numModes;
+  if (nev > N-2) {
+    opserr << "DampedArpackSolver::solve() - " << numModes;
+    opserr << " modes asked for, at most " << (N-2)/2 << " can be found\n";
+    return -1;
+  }
+  int ncv = 2*nev+1;
+  if (ncv > N)
+    ncv = N;
+  int ldv = N;
+  int lworkl = 3*ncv*ncv + 6*ncv;
+
+  if (N != sizeWorkspace || ncv != ncvWorkspace || nev != nevWorkspace) {
+    this->freeWorkspace();
+
+    v = new double[ldv*ncv];
+    workl = new double[lworkl];
+    workd = new double[3*N];
+    resid = new double[N];
+    workev = new double[3*ncv];
+    dr = new double[nev+1];
+    di = new double[nev+1];
+    z = new double[N*(nev+1)];
+    work = new double[N];
+    select = new logical[ncv];
+
+    sizeWorkspace = N;
+    ncvWorkspace = ncv;
+    nevWorkspace = nev;
+  }
+
+  static char which[3];
+  if (findSmallest == true)
+    strcpy(which, "LM");
+  else
+    strcpy(which, "SM");
+
+  char bmat = 'I';
+  char howmny = 'A';
+  double tol = 0.0;
+  int info = 0;
+  int ido = 0;
+
+  iparam[0] = 1;
+  iparam[2] = 1000;
+  iparam[6] = 1;
+
+  while (1) {
+#ifdef _WIN32
+    DNAUPD(&ido, &bmat, &N, which, &nev, &tol, resid, &ncv, v, &ldv,
+	   iparam, ipntr, workd, workl, &lworkl, &info);
+#else
+    dnaupd_(&ido, &bmat, &N, which, &nev, &tol, resid, &ncv, v, &ldv,
+	    iparam, ipntr, workd, workl, &lworkl, &info);
+#endif
+
+    if (ido == -1 || ido == 1) {
+      this->applyOP(&workd[ipntr[0]-1], &workd[ipntr[1]-1]);
+      continue;
+    }
+    break;
+  }
+
+  if (info < 0) {
+    opserr << "DampedArpackSolver::solve() - error with dnaupd, info = " << info << endln;
+    return info;
+  } else if (info == 1) {
+    opserr << "DampedArpackSolver::solve() - maximum number of iterations reached\n";
+  } else if (info == 3) {
+    opserr << "DampedArpackSolver::solve() - no shifts could be applied, try more modes\n";
+  }
+
+  int rvec = 1;
+  double sigmar = 0.0;
+  double sigmai = 0.0;
+#ifdef _WIN32
+  DNEUPD(&rvec, &howmny, select, dr, di, z, &N, &sigmar, &sigmai, workev,
+	 &bmat, &N, which, &nev, &tol, resid, &ncv, v, &ldv,
+	 iparam, ipntr, workd, workl, &lworkl, &info);
+#else
+  dneupd_(&rvec, &howmny, select, dr, di, z, &N, &sigmar, &sigmai, workev,
+	  &bmat, &N, which, &nev, &tol, resid, &ncv, v, &ldv,
+	  iparam, ipntr, workd, workl, &lworkl, &info);
+#endif
+
+  if (info != 0) {
+    opserr << "DampedArpackSolver::solve() - error with dneupd, info = " << info << endln;
+    return -1;
+  }
+
+  // the eigenvalues of the operator are mu = 1/(lambda - s); a complex
+  // pair is stored as the real and imaginary parts in columns j, j+1 of z
+  int nconv = iparam[4];
+  double s = theSOE->shift;
+
+  int numFound = 0;
+  int *first = new int[nconv];
+  double *lambdaR = new double[nconv];
+  double *lambdaI = new double[nconv];
+  double *mag = new double[nconv];
+
+  for (int j=0; j<nconv; j++) {
+    double mu2 = dr[j]*dr[j] + di[j]*di[j];
+    if (mu2 == 0.0)
+      continue;
+    first[numFound] = j;
+    lambdaR[numFound] = s + dr[j]/mu2;
+    lambdaI[numFound] = -di[j]/mu2;
+    mag[numFound] = sqrt(lambdaR[numFound]*lambdaR[numFound] +
+			 lambdaI[numFound]*lambdaI[numFound]);
+    numFound++;
+    if (di[j] != 0.0)
+      j++; // skip the conjugate
+  }
+
+  // order by frequency
+  for (int i=1; i<numFound; i++) {
+    for (int j=i; j>0 && mag[j] < mag[j-1]; j--) {
+      double tmp;
+      int itmp;
+      itmp = first[j]; first[j] = first[j-1]; first[j-1] = itmp;
+      tmp = lambdaR[j]; lambdaR[j] = lambdaR[j-1]; lambdaR[j-1] = tmp;
+      tmp = lambdaI[j]; lambdaI[j] = lambdaI[j-1]; lambdaI[j-1] = tmp;
+      tmp = mag[j]; mag[j] = mag[j-1]; mag[j-1] = tmp;
+    }
+  }
+
+  if (numFound < numModes) {
+    opserr << "DampedArpackSolver::solve() - only " << numFound;
+    opserr << " of " << numModes << " modes found\n";
+  } else
+    numFound = numModes;
+
+  if (eigenvalues != 0) delete [] eigenvalues;
+  if (dampingRatios != 0) delete [] dampingRatios;
+  if (eigenvectors != 0) delete [] eigenvectors;
+  eigenvalues = new double[numFound];
+  dampingRatios = new double[numFound];
+  eigenvectors = new double[n*numFound];
+
+  for (int m=0; m<numFound; m++) {
+    int j = first[m];
+    const double *xr = &z[j*N];
+    const double *xi = (di[j] != 0.0) ? &z[(j+1)*N] : 0;
+    double *phi = &eigenvectors[m*n];
+
+    eigenvalues[m] = mag[m]*mag[m];
+    dampingRatios[m] = (mag[m] > 0.0) ? -lambdaR[m]/mag[m] : 0.0;
+
+    // rotate the largest component onto the real axis, keep the real part
+    double c = 1.0;
+    double sn = 0.0;
+    if (xi != 0) {
+      int kMax = 0;
+      double max = 0.0;
+      for (int k=0; k<n; k++) {
+	double a = xr[k]*xr[k] + xi[k]*xi[k];
+	if (a > max) {
+	  max = a;
+	  kMax = k;
+	}
+      }
+      if (max > 0.0) {
+	double a = sqrt(max);
+	c = xr[kMax]/a;
+	sn = xi[kMax]/a;
+      }
+    }
+    for (int k=0; k<n; k++)
+      phi[k] = (xi != 0) ? c*xr[k] + sn*xi[k] : xr[k];
+
+    // unit generalized mass, or unit largest component if massless
+    this->multiply(theSOE->M, phi, work);
+    double mass = 0.0;
+    for (int k=0; k<n; k++)
+      mass += phi[k]*work[k];
+    double scale = 0.0;
+    if (mass > 0.0)
+      scale = 1.0/sqrt(mass);
+    else {
+      for (int k=0; k<n; k++)
+	if (fabs(phi[k]) > scale)
+	  scale = fabs(phi[k]);
+      if (scale > 0.0)
+	scale = 1.0/scale;
+    }
+    for (int k=0; k<n; k++)
+      phi[k] *= scale;
+  }
+
+  delete [] first;
+  delete [] lambdaR;
+  delete [] lambdaI;
+  delete [] mag;
+
+  numMode = numFound;
+  return 0;
+}
+
+
+int
+DampedArpackSolver::setEigenSOE(DampedArpackSOE &theEigenSOE)
+{
+  theSOE = &theEigenSOE;
+  return 0;
+}
+
+
+int
+DampedArpackSolver::setSize(void)
+{
+  size = theSOE->size;
+  numMode = 0;
+  return 0;
+}
+
+
+const Vector &
+DampedArpackSolver::getEigenvector(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "DampedArpackSolver::getEigenvector() - mode " << mode;
+    opserr << " is out of range (1 - " << numMode << ")\n";
+    static Vector errVector;
+    errVector.resize(size);
+    errVector.Zero();
+    return errVector;
+  }
+
+  theVector.setData(&eigenvectors[(mode-1)*size], size);
+  return theVector;
+}
+
+
+double
+DampedArpackSolver::getEigenvalue(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "DampedArpackSolver::getEigenvalue() - mode " << mode;
+    opserr << " is out of range (1 - " << numMode << ")\n";
+    return -1.0;
+  }
+  return eigenvalues[mode-1];
+}
+
+
+double
+DampedArpackSolver::getDampingRatio(int mode)
+{
+  if (mode <= 0 || mode > numMode) {
+    opserr << "DampedArpackSolver::getDampingRatio() - mode " << mode;
+    opserr << " is out of range (1 - " << numMode << ")\n";
+    return 0.0;
+  }
+  return dampingRatios[mode-1];
+}
+
+
+int
+DampedArpackSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+DampedArpackSolver::recvSelf(int commitTag, Channel &theChannel,
+			     FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
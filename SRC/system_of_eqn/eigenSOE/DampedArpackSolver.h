@@ -0,0 +1,95 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/eigenSOE/DampedArpackSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// DampedArpackSolver, the solver for the DampedArpackSOE. The quadratic
+// problem is linearized with z = [x; lambda x] into A z = lambda B z,
+// A = [0 I; -K -C] and B = [I 0; 0 M], and the ARPACK implicitly restarted
+// Arnoldi method (dnaupd) finds the largest eigenvalues of the shift-invert
+// operator inv(A - s B) B. Applying the operator needs only a solve with
+// K + s C + s^2 M in the LinearSOE, factored once, and products with the
+// sparse M and C, so no dense matrix of the 2n system is ever formed.
+//
+// Each underdamped mode is a complex conjugate pair of eigenvalues; the
+// mode is returned once, with getEigenvalue() giving |lambda|^2, the square
+// of the undamped circular frequency as for the other eigen solvers, and
+// getDampingRatio() -Re(lambda)/|lambda|. The eigenvector is the real
+// part of x after rotating its largest component onto the real axis,
+// scaled to unit generalized mass.
+
+// What: "@(#) DampedArpackSolver.h, revA"
+
+#ifndef DampedArpackSolver_h
+#define DampedArpackSolver_h
+
+#include <EigenSolver.h>
+#include <DampedArpackSOE.h>
+#include <Vector.h>
+
+class DampedArpackSolver : public EigenSolver
+{
+  public:
+    DampedArpackSolver();
+    ~DampedArpackSolver();
+
+    int solve(int numMode, bool generalized, bool findSmallest = true);
+    int setSize(void);
+    int setEigenSOE(DampedArpackSOE &theSOE);
+
+    const Vector &getEigenvector(int mode);
+    double getEigenvalue(int mode);
+    double getDampingRatio(int mode);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    void applyOP(const double *w, double *result);
+    void multiply(const double *V, const double *x, double *y);
+    void freeWorkspace(void);
+
+    DampedArpackSOE *theSOE;
+    int size;
+    int numMode;
+    double *eigenvalues;      // |lambda|^2 of each mode
+    double *dampingRatios;
+    double *eigenvectors;
+    Vector theVector;
+
+    // ARPACK workspace
+    int sizeWorkspace, ncvWorkspace, nevWorkspace;
+    double *v, *workl, *workd, *resid, *workev;
+    double *dr, *di, *z;
+    double *work;
+    long int *select;     // logical of f2c.h, not included here for its min/max
+    int iparam[11];
+    int ipntr[14];
+};
+
+#endif
@@ -70,6 +70,11 @@ EigenSOE::getEigenvalue(int mode) {
     return theSolver->getEigenvalue(mode);
 }
 
+const double *
+EigenSOE::getEigenvectors(int &numEqn) {
+    return theSolver->getEigenvectors(numEqn);
+}
+
 
 int 
 EigenSOE::setLinks(AnalysisModel &theModel)
@@ -56,6 +56,10 @@ class EigenSOE : public MovableObject
      // methods to get the eigenvectors and eigenvalues
      virtual const Vector &getEigenvector(int mode);
      virtual double getEigenvalue(int mode);          
+
+     // the eigenvectors of all the modes found, by column in one array
+     // of numEqn rows; 0 if the solver does not hold them that way
+     virtual const double *getEigenvectors(int &numEqn);
      
   protected:
      virtual int setSolver(EigenSolver &newSolver);
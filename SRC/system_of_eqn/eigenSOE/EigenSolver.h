@@ -33,6 +33,7 @@ class EigenSolver : public MovableObject
      virtual int solve(int numModes, bool generalized, bool findSmallest = true) =0;     
      virtual const Vector &getEigenvector(int mode) = 0;
      virtual double getEigenvalue(int mode) = 0;     
+     virtual const double *getEigenvectors(int &numEqn) {numEqn = 0; return 0;}
 
      virtual int setSize() = 0;
      
@@ -20,6 +20,7 @@
 #include <FEM_ObjectBroker.h>
 #include <AnalysisModel.h>
 #include <Vector.h>
+#include <string.h>
 
 SymArpackSOE::SymArpackSOE(SymArpackSolver &the_Solver, AnalysisModel &aModel,
 			 double theShift)
@@ -63,7 +64,7 @@ SymArpackSOE::getNumEqn(void) const
 extern "C" int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE, 
 				int **xblkMY, int **invpMY, int **rowblksMY, 
 				OFFDBLK ***begblkMY, OFFDBLK **firstMY, 
-				double ***penvMY, double **diagMY);
+				double ***penvMY, double **diagMY, int *delayed);
 				
 int 
 SymArpackSOE::setSize(Graph &theGraph)
@@ -157,7 +158,7 @@ SymArpackSOE::setSize(Graph &theGraph)
 // call "C" function to form elimination tree and do the symbolic factorization.
 //    nblks = symFactorization(rowStartA, colA, size, LSPARSE);
     nblks = symFactorization(rowStartA, colA, size, LSPARSE,
-			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag, 0);
 
     // invoke setSize() on the Solver
     EigenSolver *theSolvr = this->getSolver();
@@ -314,6 +315,25 @@ SymArpackSOE::getShift(void)
 void 
 SymArpackSOE::zeroA(void)
 {
+    // the factorization is done in place, so the values must be cleared
+    // before A is assembled again
+    if (size > 0 && diag != 0) {
+	memset(diag, 0, size*sizeof(double));
+
+	int profileSize = penv[size] - penv[0];
+	memset(penv[0], 0, profileSize*sizeof(double));
+
+	OFFDBLK *blkPtr = first;
+	int rLen = 0;
+	while (1) {
+	    if (blkPtr->beg == size)  break;
+	    rLen = xblk[rowblks[blkPtr->beg]+1] - blkPtr->beg;
+	    memset(blkPtr->nz, 0, rLen*sizeof(double));
+
+	    blkPtr = blkPtr->next;
+	}
+    }
+
     factored = false;
 }
 	
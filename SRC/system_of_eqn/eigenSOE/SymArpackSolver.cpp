@@ -66,7 +66,9 @@ extern "C" int dseupd_(bool *rvec, char *howmny, logical *select, double *d, dou
 
 SymArpackSolver::SymArpackSolver(int numE)
 :EigenSolver(EigenSOLVER_TAGS_SymArpackSolver),
- theSOE(0), factored(false), theNev(numE), value(0), eigenV(0)
+ theSOE(0), theNev(numE), value(0), vector(0), eigenV(0),
+ sizeWorkspace(0), ncvWorkspace(0), numConverged(0),
+ workl(0), workd(0), resid(0), select(0)
 {
     // nothing to do.
 }
@@ -82,6 +84,18 @@ SymArpackSolver::~SymArpackSolver()
 
     if (eigenV !=0)
         delete eigenV;
+
+    if (workl != 0)
+        delete [] workl;
+    if (workd != 0)
+        delete [] workd;
+    if (resid != 0)
+        delete [] resid;
+#ifndef _WIN32
+    // cannot invoke the destructor on select .. causes seg in windows!!!
+    if (select != 0)
+        delete [] select;
+#endif
 }
 
 
@@ -122,8 +136,9 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
     if (n == 0)
 	return 0;
 
-//	timer (FACTOR);
-	if (factored == false) {
+    // the symbolic factorization is done by the SOE in setSize(), the
+    // numerical one only when A has been zeroed since the last solve
+    if (theSOE->factored == false) {
 
 	   //factor the matrix
 	   //call the "C" function to do the numerical factorization.
@@ -133,7 +148,7 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 		  opserr << "In SymArpackSolver: error in factorization.\n";
 		  return -1;
 	   }
-	   factored = true;
+	   theSOE->factored = true;
 	}
 
 
@@ -141,16 +156,54 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 
     int ncv = getNCV(n, nev);
 
-    // set up the space for ARPACK functions.
+    // set up the space for ARPACK functions; it is kept between calls and
+    // only reallocated when n or the size of the Lanczos basis changes
     int ldv = n;
-    
-    double *v = new double[ldv * ncv];
-    double *workl = new double[ncv * (ncv+8)];
-    double *workd = new double[3 * n];
-    double *d = new double[ncv * 2];
-    double *resid = new double[n];
+    int lworkl = ncv*ncv + 8*ncv;
+
+    if (n != sizeWorkspace || ncv != ncvWorkspace) {
+	if (vector != 0) delete [] vector;
+	if (value != 0) delete [] value;
+	if (workl != 0) delete [] workl;
+	if (workd != 0) delete [] workd;
+	if (resid != 0) delete [] resid;
+#ifndef _WIN32
+	if (select != 0) delete [] select;
+#endif
+
+	vector = new double[ldv * ncv];
+	value = new double[ncv * 2];
+	workl = new double[lworkl];
+	workd = new double[3 * n];
+	resid = new double[n];
+	select = new logical[ncv];
+
+	// the old eigenvectors went with the old workspace
+	numConverged = 0;
+
+	sizeWorkspace = n;
+	ncvWorkspace = ncv;
+    }
+    double *v = vector;
+    double *d = value;
+
+    // start the Lanczos process from the sum of the eigenvectors of the
+    // last solve, which are still in the first columns of v; for a model
+    // that has changed little since, far fewer restarts are needed
+    int info = 0;
+    if (numConverged > 0) {
+	double norm = 0.0;
+	for (int i=0; i<n; i++) {
+	    double sum = 0.0;
+	    for (int j=0; j<numConverged; j++)
+		sum += v[j*n+i];
+	    resid[i] = sum;
+	    norm += sum*sum;
+	}
+	if (norm > 0.0)
+	    info = 1;
+    }
 	
-//    char *which = new char[2];
     char bmat = 'G';
 
     static char which[3];
@@ -160,14 +213,9 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
     strcpy(which, "SM");
     }    
 
-    int *iparam = new int[11];
-    int *iwork = new int[n];
-
-    int lworkl = ncv*ncv + 8*ncv;
-    int maxitr, mode, nconv;
+    int maxitr, mode;
 
     double tol = 0.0;
-    int info = 0;
     maxitr = 1000;
     mode = 3;
 
@@ -176,12 +224,10 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 
     bool rvec = true;
     char howmy = 'A';
-    logical *select = new logical[ncv];
 
     iparam[0] = 1;
     int ido = 0;
-    int *ipntr = new int[11];
-    int ierr = 0;
+    numConverged = 0;
     unsigned int sizeWhich =2;
     unsigned int sizeBmat =1;
     unsigned int sizeHowmany =1;
@@ -249,25 +295,9 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 	}
     }
 
-    value = d;
-    vector = v;
+    theNev = numModes;
+    numConverged = numModes;
 
-    theSOE->factored = true;
-
-    delete [] workl;
-    delete [] workd;
-    delete [] resid;
-    delete [] iparam;
-    delete [] iwork;
-#ifdef _WIN32
-    // cannot invoke the destructor on select .. causes seg in windows!!!
-#else
-    delete [] select;
-#endif    
-
-    delete [] ipntr;
-
-    
     return 0;
 }
 
@@ -275,8 +305,9 @@ SymArpackSolver::solve(int numModes, bool generalized, bool findSmallest)
 int
 SymArpackSolver::setSize()
 {
-    // nothing to do
-    // if iPiv not big enough, free it and get one large enough
+    // a new ordering, so the eigenvectors of the last solve are no use
+    numConverged = 0;
+
     int size = theSOE->size;    
     
     if (eigenV == 0 || eigenV->Size() != size) {
@@ -41,12 +41,18 @@ class SymArpackSolver : public EigenSolver
 
   private:
     SymArpackSOE *theSOE;
-    bool factored;
 
     int theNev;
     double *value;
     double *vector;
     Vector *eigenV;
+
+    // ARPACK workspace, kept between solves
+    int sizeWorkspace, ncvWorkspace;
+    int numConverged;     // eigenvectors of the last solve still in vector
+    double *workl, *workd, *resid;
+    long int *select;     // logical of f2c.h, not included here for its min/max
+    int iparam[11], ipntr[11];
     
     void myMv(int n, double *v, double *result);
     void myCopy(int n, double *v, double *result);
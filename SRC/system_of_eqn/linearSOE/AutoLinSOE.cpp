@@ -0,0 +1,659 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/AutoLinSOE.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for AutoLinSOE.
+//
+// What: "@(#) AutoLinSOE.cpp, revA"
+
+#include <AutoLinSOE.h>
+#include <BandSPDLinSOE.h>
+#include <BandSPDLinLapackSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinSupernodeSolver.h>
+#include <SymSparseLinSOE.h>
+#include <SymSparseLinSolver.h>
+#include <BandGenLinSOE.h>
+#include <BandGenLinLapackSolver.h>
+#include <UmfpackGenLinSOE.h>
+#include <UmfpackGenLinSolver.h>
+#ifdef _PARDISO
+#include <PardisoSOE.h>
+#include <PardisoSolver.h>
+#endif
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Element.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <ID.h>
+#include <ThreadPool.h>
+#include <elementAPI.h>
+#include <math.h>
+#include <string.h>
+
+// the systems to choose from
+#define AUTO_NONE        0
+#define AUTO_BANDSPD     1
+#define AUTO_PROFILESPD  2
+#define AUTO_SPARSESYM   3
+#define AUTO_BANDGEN     4
+#define AUTO_UMFPACK     5
+#define AUTO_PARDISO_SPD 6
+#define AUTO_PARDISO_SYM 7
+#define AUTO_PARDISO_GEN 8
+#define AUTO_NUM_TYPES   9
+
+static const char *autoNames[] = {"none", "BandSPD", "ProfileSPD", "SparseSYM",
+				  "BandGeneral", "UmfPack", "Pardiso -spd",
+				  "Pardiso -symmetric", "Pardiso"};
+
+void* OPS_AutoLinSOE()
+{
+    // system Auto <-symmetric|-unsymmetric> <-trial> <-quiet>
+    int symmetry = AUTO_SOE_DETECT;
+    bool trial = false;
+    bool verbose = true;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *opt = OPS_GetString();
+	if (strcmp(opt, "-symmetric") == 0)
+	    symmetry = AUTO_SOE_SYMMETRIC;
+	else if (strcmp(opt, "-unsymmetric") == 0)
+	    symmetry = AUTO_SOE_UNSYMMETRIC;
+	else if (strcmp(opt, "-trial") == 0)
+	    trial = true;
+	else if (strcmp(opt, "-quiet") == 0)
+	    verbose = false;
+    }
+
+    return new AutoLinSOE(symmetry, trial, verbose);
+}
+
+AutoLinSOE::AutoLinSOE(int sym, bool tri, bool verb)
+  :LinearSOE(LinSOE_TAGS_AutoLinSOE),
+   theSOE(0), trialSOE(0), type(AUTO_NONE), trialType(AUTO_NONE),
+   symmetry(sym), trial(tri), verbose(verb),
+   lastTrialType(AUTO_NONE), lastTrialRunnerUp(AUTO_NONE),
+   lastTrialWinner(AUTO_NONE)
+{
+
+}
+
+AutoLinSOE::~AutoLinSOE()
+{
+  if (theSOE != 0)
+    delete theSOE;
+  if (trialSOE != 0)
+    delete trialSOE;
+}
+
+int
+AutoLinSOE::solve(void)
+{
+  if (theSOE == 0)
+    return -1;
+
+  if (trialSOE == 0)
+    return theSOE->solve();
+
+  // the trial: both solve the system assembled, the faster is kept
+  double t0 = ThreadPool::getTime();
+  int result = theSOE->solve();
+  double t1 = ThreadPool::getTime();
+  int trialResult = trialSOE->solve();
+  double t2 = ThreadPool::getTime();
+
+  if (verbose)
+    opserr << "system Auto - trial solve " << autoNames[type] << " "
+	   << t1-t0 << " sec, " << autoNames[trialType] << " " << t2-t1
+	   << " sec\n";
+
+  lastTrialType = type;
+  lastTrialRunnerUp = trialType;
+
+  if (trialResult == 0 && (result != 0 || t2-t1 < t1-t0)) {
+    delete theSOE;
+    theSOE = trialSOE;
+    type = trialType;
+    result = trialResult;
+  } else
+    delete trialSOE;
+
+  trialSOE = 0;
+  trialType = AUTO_NONE;
+  lastTrialWinner = type;
+
+  return result;
+}
+
+int
+AutoLinSOE::setLinks(AnalysisModel &theModel)
+{
+  this->LinearSOE::setLinks(theModel);
+  if (theSOE != 0)
+    theSOE->setLinks(theModel);
+  if (trialSOE != 0)
+    trialSOE->setLinks(theModel);
+  return 0;
+}
+
+int
+AutoLinSOE::setSize(Graph &theGraph)
+{
+  // the number of equations, the nonzeros below the diagonal, the
+  // bandwidth and the profile (the diagonal and the column heights)
+  int n = theGraph.getNumVertex();
+  double nnzL = 0.0;
+  double profile = 0.0;
+  int band = 0;
+
+  Vertex *vertexPtr;
+  VertexIter &theVertices = theGraph.getVertices();
+  while ((vertexPtr = theVertices()) != 0) {
+    int i = vertexPtr->getTag();
+    const ID &theAdjacency = vertexPtr->getAdjacency();
+    int minJ = i;
+    for (int k=0; k<theAdjacency.Size(); k++) {
+      int j = theAdjacency(k);
+      if (j < i) {
+	nnzL += 1.0;
+	if (j < minJ)
+	  minJ = j;
+	if (i-j > band)
+	  band = i-j;
+      }
+    }
+    profile += i - minJ + 1;
+  }
+
+  // the fill of a sparse factorization with a fill reducing ordering: the
+  // nonzeros times the cube root of the size, what nested dissection gives
+  // on three dimensional meshes, it can not be more than the profile
+  double fill = (nnzL + n)*cbrt((double)n);
+  if (fill < 2.0*(nnzL + n))
+    fill = 2.0*(nnzL + n);
+  if (fill > profile)
+    fill = profile;
+
+  bool symmetric = (symmetry == AUTO_SOE_SYMMETRIC) ||
+    (symmetry == AUTO_SOE_DETECT && this->isSymmetric());
+  bool definite = symmetric && !this->hasMultipliers();
+
+  // the storage for the factorization of each candidate, weighted for the
+  // work per entry: the band solvers are the simplest, the sparse ones
+  // have the most overhead
+  double storage[AUTO_NUM_TYPES];
+  double cost[AUTO_NUM_TYPES];
+  for (int i=0; i<AUTO_NUM_TYPES; i++)
+    cost[i] = -1.0;
+  if (definite) {
+    storage[AUTO_BANDSPD] = (double)n*(band+1);
+    storage[AUTO_PROFILESPD] = profile;
+    storage[AUTO_SPARSESYM] = fill;
+    cost[AUTO_BANDSPD] = 0.8*storage[AUTO_BANDSPD];
+    cost[AUTO_PROFILESPD] = storage[AUTO_PROFILESPD];
+    cost[AUTO_SPARSESYM] = 2.0*storage[AUTO_SPARSESYM];
+  } else {
+    storage[AUTO_BANDGEN] = (double)n*(3*band+1);
+    storage[AUTO_UMFPACK] = 2.0*fill;
+    cost[AUTO_BANDGEN] = 0.8*storage[AUTO_BANDGEN];
+    cost[AUTO_UMFPACK] = 2.0*storage[AUTO_UMFPACK];
+  }
+
+#ifdef _PARDISO
+  // PARDISO, when built in, takes the place of the other sparse solvers: it
+  // factors on all the threads with dense supernodal kernels, so its work
+  // per entry is taken as that of the profile solver
+  if (definite) {
+    storage[AUTO_PARDISO_SPD] = fill;
+    cost[AUTO_PARDISO_SPD] = storage[AUTO_PARDISO_SPD];
+    cost[AUTO_SPARSESYM] = -1.0;
+  } else {
+    int pardisoType = symmetric ? AUTO_PARDISO_SYM : AUTO_PARDISO_GEN;
+    storage[pardisoType] = symmetric ? fill : 2.0*fill;
+    cost[pardisoType] = storage[pardisoType];
+    cost[AUTO_UMFPACK] = -1.0;
+  }
+#endif
+
+  // small systems go to the band solvers, whatever the estimates
+  if (n < 50) {
+    if (definite)
+      cost[AUTO_BANDSPD] = 0.0;
+    else
+      cost[AUTO_BANDGEN] = 0.0;
+  }
+
+  int newType = AUTO_NONE;
+  int runnerUp = AUTO_NONE;
+  for (int i=1; i<AUTO_NUM_TYPES; i++) {
+    if (cost[i] < 0.0)
+      continue;
+    if (newType == AUTO_NONE || cost[i] < cost[newType]) {
+      runnerUp = newType;
+      newType = i;
+    } else if (runnerUp == AUTO_NONE || cost[i] < cost[runnerUp])
+      runnerUp = i;
+  }
+
+  // a trial made before for the same two is not made again
+  bool doTrial = trial && runnerUp != AUTO_NONE;
+  if (doTrial && newType == lastTrialType && runnerUp == lastTrialRunnerUp) {
+    newType = lastTrialWinner;
+    doTrial = false;
+  }
+
+  if (verbose) {
+    opserr << "system Auto - " << n << " equations, bandwidth " << band
+	   << ", profile " << profile << ", " << nnzL << " nonzeros below the diagonal, "
+	   << (symmetric ? (definite ? "symmetric positive definite" : "symmetric indefinite") : "unsymmetric")
+	   << ": " << autoNames[newType] << ", about "
+	   << storage[newType]*sizeof(double)/1048576.0 << " MB for A\n";
+  }
+
+  if (trialSOE != 0) {
+    delete trialSOE;
+    trialSOE = 0;
+    trialType = AUTO_NONE;
+  }
+
+  if (newType != type || theSOE == 0) {
+    if (theSOE != 0)
+      delete theSOE;
+    theSOE = this->createSOE(newType);
+    type = newType;
+  }
+  if (theSOE == 0) {
+    opserr << "WARNING AutoLinSOE::setSize() - failed to create the system\n";
+    type = AUTO_NONE;
+    return -1;
+  }
+
+  int result = theSOE->setSize(theGraph);
+
+  if (doTrial && result == 0) {
+    trialSOE = this->createSOE(runnerUp);
+    if (trialSOE != 0) {
+      trialType = runnerUp;
+      if (trialSOE->setSize(theGraph) < 0) {
+	delete trialSOE;
+	trialSOE = 0;
+	trialType = AUTO_NONE;
+      }
+    }
+  }
+
+  return result;
+}
+
+LinearSOE *
+AutoLinSOE::createSOE(int theType)
+{
+  LinearSOE *newSOE = 0;
+  switch (theType) {
+  case AUTO_BANDSPD:
+    newSOE = new BandSPDLinSOE(*(new BandSPDLinLapackSolver()));
+    break;
+  case AUTO_PROFILESPD:
+    newSOE = new ProfileSPDLinSOE(*(new ProfileSPDLinSupernodeSolver()));
+    break;
+  case AUTO_SPARSESYM:
+    newSOE = new SymSparseLinSOE(*(new SymSparseLinSolver()), 1);
+    break;
+  case AUTO_BANDGEN:
+    newSOE = new BandGenLinSOE(*(new BandGenLinLapackSolver()));
+    break;
+  case AUTO_UMFPACK:
+    newSOE = new UmfpackGenLinSOE(*(new UmfpackGenLinSolver()));
+    break;
+#ifdef _PARDISO
+  case AUTO_PARDISO_SPD:
+    newSOE = new PardisoSOE(*(new PardisoSolver()), PARDISO_SPD);
+    break;
+  case AUTO_PARDISO_SYM:
+    newSOE = new PardisoSOE(*(new PardisoSolver()), PARDISO_SYMMETRIC);
+    break;
+  case AUTO_PARDISO_GEN:
+    newSOE = new PardisoSOE(*(new PardisoSolver()), PARDISO_UNSYMMETRIC);
+    break;
+#endif
+  default:
+    return 0;
+  }
+
+  if (theModel != 0)
+    newSOE->setLinks(*theModel);
+
+  return newSOE;
+}
+
+bool
+AutoLinSOE::isSymmetric(void)
+{
+  // without the elements the system can not be taken as symmetric
+  if (theModel == 0)
+    return false;
+
+  FE_Element *elePtr;
+  FE_EleIter &theEles = theModel->getFEs();
+  while ((elePtr = theEles()) != 0) {
+    Element *theEle = elePtr->getElement();
+    if (theEle == 0)
+      continue;
+
+    const Matrix &K = theEle->getTangentStiff();
+    int m = K.noRows();
+    double maxK = 0.0;
+    for (int i=0; i<m; i++)
+      for (int j=0; j<m; j++)
+	if (fabs(K(i,j)) > maxK)
+	  maxK = fabs(K(i,j));
+    double tol = 1.0e-8*maxK;
+    for (int i=0; i<m; i++)
+      for (int j=i+1; j<m; j++)
+	if (fabs(K(i,j) - K(j,i)) > tol)
+	  return false;
+  }
+
+  return true;
+}
+
+bool
+AutoLinSOE::hasMultipliers(void)
+{
+  if (theModel == 0)
+    return false;
+
+  // the Lagrange multipliers are the DOF_Groups without a node
+  DOF_Group *dofPtr;
+  DOF_GrpIter &theDOFs = theModel->getDOFs();
+  while ((dofPtr = theDOFs()) != 0)
+    if (dofPtr->getNodeTag() == -1 && dofPtr->getNumDOF() > 0)
+      return true;
+
+  return false;
+}
+
+int
+AutoLinSOE::getNumEqn(void) const
+{
+  if (theSOE == 0)
+    return 0;
+  return theSOE->getNumEqn();
+}
+
+int
+AutoLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->addA(m, id, fact);
+  return theSOE->addA(m, id, fact);
+}
+
+int
+AutoLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->addB(v, id, fact);
+  return theSOE->addB(v, id, fact);
+}
+
+int
+AutoLinSOE::setB(const Vector &v, double fact)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->setB(v, fact);
+  return theSOE->setB(v, fact);
+}
+
+int
+AutoLinSOE::addA(const Matrix &m)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->addA(m);
+  return theSOE->addA(m);
+}
+
+int
+AutoLinSOE::addColA(const Vector &col, int colIndex, double fact)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->addColA(col, colIndex, fact);
+  return theSOE->addColA(col, colIndex, fact);
+}
+
+void
+AutoLinSOE::zeroA(void)
+{
+  if (theSOE != 0)
+    theSOE->zeroA();
+  if (trialSOE != 0)
+    trialSOE->zeroA();
+}
+
+void
+AutoLinSOE::zeroB(void)
+{
+  if (theSOE != 0)
+    theSOE->zeroB();
+  if (trialSOE != 0)
+    trialSOE->zeroB();
+}
+
+int
+AutoLinSOE::formAp(const Vector &p, Vector &Ap)
+{
+  if (theSOE == 0)
+    return -1;
+  return theSOE->formAp(p, Ap);
+}
+
+const Vector &
+AutoLinSOE::getX(void)
+{
+  static Vector empty;
+  if (theSOE == 0)
+    return empty;
+  return theSOE->getX();
+}
+
+const Vector &
+AutoLinSOE::getB(void)
+{
+  static Vector empty;
+  if (theSOE == 0)
+    return empty;
+  return theSOE->getB();
+}
+
+const Matrix *
+AutoLinSOE::getA(void)
+{
+  if (theSOE == 0)
+    return 0;
+  return theSOE->getA();
+}
+
+double
+AutoLinSOE::getDeterminant(void)
+{
+  if (theSOE == 0)
+    return 0.0;
+  return theSOE->getDeterminant();
+}
+
+double
+AutoLinSOE::normRHS(void)
+{
+  if (theSOE == 0)
+    return 0.0;
+  return theSOE->normRHS();
+}
+
+void
+AutoLinSOE::setX(int loc, double value)
+{
+  if (theSOE != 0)
+    theSOE->setX(loc, value);
+  if (trialSOE != 0)
+    trialSOE->setX(loc, value);
+}
+
+void
+AutoLinSOE::setX(const Vector &X)
+{
+  if (theSOE != 0)
+    theSOE->setX(X);
+  if (trialSOE != 0)
+    trialSOE->setX(X);
+}
+
+int
+AutoLinSOE::setBlockB(const Matrix &B, double fact)
+{
+  if (theSOE == 0)
+    return -1;
+  return theSOE->setBlockB(B, fact);
+}
+
+int
+AutoLinSOE::solveBlock(void)
+{
+  if (theSOE == 0)
+    return -1;
+
+  // a trial pending is given up, the block solve keeps the choice
+  if (trialSOE != 0) {
+    delete trialSOE;
+    trialSOE = 0;
+    trialType = AUTO_NONE;
+  }
+
+  return theSOE->solveBlock();
+}
+
+const Matrix &
+AutoLinSOE::getBlockX(void)
+{
+  if (theSOE == 0)
+    return this->LinearSOE::getBlockX();
+  return theSOE->getBlockX();
+}
+
+int
+AutoLinSOE::saveA(void)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->saveA();
+  return theSOE->saveA();
+}
+
+int
+AutoLinSOE::restoreA(void)
+{
+  if (theSOE == 0)
+    return -1;
+  if (trialSOE != 0)
+    trialSOE->restoreA();
+  return theSOE->restoreA();
+}
+
+int
+AutoLinSOE::domainChanged(void)
+{
+  if (theSOE == 0)
+    return 0;
+  if (trialSOE != 0)
+    trialSOE->domainChanged();
+  return theSOE->domainChanged();
+}
+
+size_t
+AutoLinSOE::getNumBytes(void)
+{
+  size_t numBytes = 0;
+  if (theSOE != 0)
+    numBytes += theSOE->getNumBytes();
+  if (trialSOE != 0)
+    numBytes += trialSOE->getNumBytes();
+  return numBytes;
+}
+
+LinearSOESolver *
+AutoLinSOE::getSolver(void)
+{
+  if (theSOE == 0)
+    return 0;
+  return theSOE->getSolver();
+}
+
+int
+AutoLinSOE::setLowRankUpdate(const double *U, const double *d, int numCols)
+{
+  if (theSOE == 0)
+    return (numCols <= 0) ? 0 : -1;
+  if (trialSOE != 0)
+    trialSOE->setLowRankUpdate(U, d, numCols);
+  return theSOE->setLowRankUpdate(U, d, numCols);
+}
+
+const char *
+AutoLinSOE::getChoice(void) const
+{
+  return autoNames[type];
+}
+
+int
+AutoLinSOE::sendSelf(int commitTag, Channel &theChannel)
+{
+  opserr << "WARNING AutoLinSOE::sendSelf() - not implemented, use the system chosen\n";
+  return -1;
+}
+
+int
+AutoLinSOE::recvSelf(int commitTag, Channel &theChannel,
+		     FEM_ObjectBroker &theBroker)
+{
+  opserr << "WARNING AutoLinSOE::recvSelf() - not implemented, use the system chosen\n";
+  return -1;
+}
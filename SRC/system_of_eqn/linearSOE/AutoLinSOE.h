@@ -0,0 +1,120 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/AutoLinSOE.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for AutoLinSOE.
+// AutoLinSOE picks the system of equations and solver when it is sized,
+// that is after the constraint handler and numberer, from the DOF graph:
+// the number of equations, the bandwidth, the profile and the nonzeros
+// of A. A is taken as symmetric if the tangents of all the elements are,
+// or as the user says, and as indefinite if there are Lagrange multipliers.
+// Symmetric positive definite systems go to BandSPD, ProfileSPD or
+// SparseSYM, the others to BandGeneral or UmfPack, whichever needs the
+// least storage for the factorization; built with _PARDISO, Pardiso
+// replaces SparseSYM and UmfPack. The band and profile storage follow
+// from the numbering, the fill of the sparse solvers, which order the
+// equations themselves, is estimated. With the trial option the
+// first solve after sizing is done with the best two and the faster kept.
+// The choice and the storage expected for A are printed. All the other
+// methods are those of the system chosen.
+//
+// What: "@(#) AutoLinSOE.h, revA"
+
+#ifndef AutoLinSOE_h
+#define AutoLinSOE_h
+
+#include <LinearSOE.h>
+
+#define AUTO_SOE_DETECT       0
+#define AUTO_SOE_SYMMETRIC    1
+#define AUTO_SOE_UNSYMMETRIC  2
+
+class AutoLinSOE : public LinearSOE
+{
+  public:
+    AutoLinSOE(int symmetry = AUTO_SOE_DETECT, bool trial = false,
+	       bool verbose = true);
+    ~AutoLinSOE();
+
+    int solve(void);
+    int setLinks(AnalysisModel &theModel);
+    int setSize(Graph &theGraph);
+    int getNumEqn(void) const;
+
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+    int addA(const Matrix &);
+    int addColA(const Vector &col, int colIndex, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroB(void);
+
+    int formAp(const Vector &p, Vector &Ap);
+
+    const Vector &getX(void);
+    const Vector &getB(void);
+    const Matrix *getA(void);
+    double getDeterminant(void);
+    double normRHS(void);
+
+    void setX(int loc, double value);
+    void setX(const Vector &X);
+
+    int setBlockB(const Matrix &B, double fact = 1.0);
+    int solveBlock(void);
+    const Matrix &getBlockX(void);
+
+    int saveA(void);
+    int restoreA(void);
+    int domainChanged(void);
+    size_t getNumBytes(void);
+    LinearSOESolver *getSolver(void);
+    int setLowRankUpdate(const double *U, const double *d, int numCols);
+
+    // the system chosen, "none" before the first setSize()
+    const char *getChoice(void) const;
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  private:
+    bool isSymmetric(void);
+    bool hasMultipliers(void);
+    LinearSOE *createSOE(int type);
+
+    LinearSOE *theSOE;       // the system chosen
+    LinearSOE *trialSOE;     // the runner up until the trial solve
+    int type, trialType;
+    int symmetry;
+    bool trial, verbose;
+
+    // the outcome of the last trial, a system sized again with the same
+    // two candidates does not repeat it
+    int lastTrialType, lastTrialRunnerUp, lastTrialWinner;
+};
+
+#endif
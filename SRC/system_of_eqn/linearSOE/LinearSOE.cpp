@@ -32,15 +32,46 @@
 
 #include<LinearSOE.h>
 #include<LinearSOESolver.h>
+#include <Profiler.h>
+#include <ThreadPool.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <math.h>
+#include <string.h>
+#include <new>
+
+#ifdef _WIN32
+extern "C" int DGEMM(char *transA, char *transB, int *M, int *N, int *K,
+		     double *alpha, double *A, int *LDA, double *B, int *LDB,
+		     double *beta, double *C, int *LDC);
+extern "C" int DGETRF(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+extern "C" int DGETRS(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
+		      int *iPiv, double *B, int *LDB, int *INFO);
+#else
+extern "C" int dgemm_(char *transA, char *transB, int *M, int *N, int *K,
+		      double *alpha, double *A, int *LDA, double *B, int *LDB,
+		      double *beta, double *C, int *LDC);
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA, int *iPiv, int *INFO);
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
+		       int *iPiv, double *B, int *LDB, int *INFO);
+#endif
 
 LinearSOE::LinearSOE(LinearSOESolver &theLinearSOESolver, int classtag)
-    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver)
+    :MovableObject(classtag), theModel(0), theSolver(&theLinearSOESolver),
+     blockB(0), blockX(0), normB(0.0), normX(0.0), BdotX(0.0),
+     baseA(0), sizeBaseA(0),
+     lowRankU(0), lowRankD(0), lowRankZ(0), lowRankS(0), lowRankPivot(0),
+     numLowRank(0), sizeLowRankZ(0), sizeLowRankD(0), formedLowRank(false)
 {
 
 }
 
 LinearSOE::LinearSOE(int classtag)
-:MovableObject(classtag), theModel(0), theSolver(0)
+:MovableObject(classtag), theModel(0), theSolver(0),
+ blockB(0), blockX(0), normB(0.0), normX(0.0), BdotX(0.0),
+ baseA(0), sizeBaseA(0),
+ lowRankU(0), lowRankD(0), lowRankZ(0), lowRankS(0), lowRankPivot(0),
+ numLowRank(0), sizeLowRankZ(0), sizeLowRankD(0), formedLowRank(false)
 {
 
 }
@@ -50,15 +81,460 @@ LinearSOE::~LinearSOE()
 {
   if (theSolver != 0)
     delete theSolver;
+
+  if (blockB != 0)
+    delete blockB;
+  if (blockX != 0)
+    delete blockX;
+  if (baseA != 0)
+    delete [] baseA;
+  if (lowRankD != 0)
+    delete [] lowRankD;
+  if (lowRankZ != 0)
+    delete [] lowRankZ;
+  if (lowRankS != 0)
+    delete [] lowRankS;
+  if (lowRankPivot != 0)
+    delete [] lowRankPivot;
 }
 
 int 
 LinearSOE::solve(void)
 {
-  if (theSolver != 0)
-    return (theSolver->solve());
-  else 
+  if (theSolver != 0) {
+    Profiler::begin(PROFILE_SOLVE);
+    int result = theSolver->solve();
+    if (result >= 0 && numLowRank > 0)
+      result = this->solveLowRank();
+    Profiler::end(PROFILE_SOLVE);
+    return result;
+  } else 
+    return -1;
+}
+
+int
+LinearSOE::setLowRankUpdate(const double *U, const double *d, int numCols)
+{
+  if (U == 0 || d == 0 || numCols <= 0) {
+    numLowRank = 0;
+    lowRankU = 0;
+    formedLowRank = false;
+    return 0;
+  }
+
+  if (numCols > sizeLowRankD) {
+    if (lowRankD != 0) delete [] lowRankD;
+    if (lowRankS != 0) delete [] lowRankS;
+    if (lowRankPivot != 0) delete [] lowRankPivot;
+    lowRankD = new double[numCols];
+    lowRankS = new double[numCols*numCols];
+    lowRankPivot = new int[numCols];
+    sizeLowRankD = numCols;
+  }
+
+  for (int i=0; i<numCols; i++)
+    lowRankD[i] = d[i];
+  lowRankU = U;
+  numLowRank = numCols;
+  formedLowRank = false;
+
+  return 0;
+}
+
+// X, A^-1 B on entry, is corrected for the low rank update:
+// (A + U D U^T)^-1 = A^-1 - A^-1 U (I + D U^T A^-1 U)^-1 D U^T A^-1
+int
+LinearSOE::solveLowRank(void)
+{
+  int n = this->getNumEqn();
+  int m = numLowRank;
+  if (n == 0)
+    return 0;
+
+  if (formedLowRank == false) {
+
+    // A^-1 U with the factorization of the solve just done; the B and X
+    // of that solve are kept aside meanwhile
+    if (n*m > sizeLowRankZ) {
+      if (lowRankZ != 0) delete [] lowRankZ;
+      lowRankZ = new (std::nothrow) double[n*m];
+      if (lowRankZ == 0) {
+	opserr << "WARNING LinearSOE::solve() - out of memory for the low rank update\n";
+	sizeLowRankZ = 0;
+	return -1;
+      }
+      sizeLowRankZ = n*m;
+    }
+
+    Vector b(this->getB());
+    Vector x(this->getX());
+
+    memcpy(lowRankZ, lowRankU, n*m*sizeof(double));
+    if (theSolver->solveMultiple(m, lowRankZ) != 0) {
+      Vector u(n);
+      for (int j=0; j<m; j++) {
+	double *z = &lowRankZ[j*n];
+	for (int i=0; i<n; i++)
+	  u(i) = z[i];
+	this->setB(u);
+	if (theSolver->solve() < 0) {
+	  opserr << "WARNING LinearSOE::solve() - failed to solve for the low rank update\n";
+	  return -1;
+	}
+	const Vector &xj = this->getX();
+	for (int i=0; i<n; i++)
+	  z[i] = xj(i);
+      }
+    }
+
+    this->setB(b);
+    this->setX(x);
+
+    // S = I + D U^T Z, in LU factors
+    char charT = 'T';
+    char charN = 'N';
+    double one = 1.0;
+    double zero = 0.0;
+#ifdef _WIN32
+    DGEMM(&charT, &charN, &m, &m, &n, &one, (double *)lowRankU, &n, lowRankZ, &n,
+	  &zero, lowRankS, &m);
+#else
+    dgemm_(&charT, &charN, &m, &m, &n, &one, (double *)lowRankU, &n, lowRankZ, &n,
+	   &zero, lowRankS, &m);
+#endif
+    for (int j=0; j<m; j++) {
+      for (int i=0; i<m; i++)
+	lowRankS[j*m+i] *= lowRankD[i];
+      lowRankS[j*m+j] += 1.0;
+    }
+
+    int info = 0;
+#ifdef _WIN32
+    DGETRF(&m, &m, lowRankS, &m, lowRankPivot, &info);
+#else
+    dgetrf_(&m, &m, lowRankS, &m, lowRankPivot, &info);
+#endif
+    if (info != 0) {
+      opserr << "WARNING LinearSOE::solve() - the low rank update is singular\n";
+      return -1;
+    }
+
+    formedLowRank = true;
+  }
+
+  Vector x(this->getX());
+  this->applyLowRank(&x(0), 1);
+  this->setX(x);
+
+  return 0;
+}
+
+void
+LinearSOE::applyLowRank(double *X, int numRHS)
+{
+  int n = this->getNumEqn();
+  int m = numLowRank;
+
+  // W = D U^T X, W = S^-1 W, X = X - Z W
+  double *W = new double[m*numRHS];
+  char charT = 'T';
+  char charN = 'N';
+  double one = 1.0;
+  double minusOne = -1.0;
+  double zero = 0.0;
+  int info = 0;
+#ifdef _WIN32
+  DGEMM(&charT, &charN, &m, &numRHS, &n, &one, (double *)lowRankU, &n, X, &n,
+	&zero, W, &m);
+#else
+  dgemm_(&charT, &charN, &m, &numRHS, &n, &one, (double *)lowRankU, &n, X, &n,
+	 &zero, W, &m);
+#endif
+  for (int j=0; j<numRHS; j++)
+    for (int i=0; i<m; i++)
+      W[j*m+i] *= lowRankD[i];
+#ifdef _WIN32
+  DGETRS(&charN, &m, &numRHS, lowRankS, &m, lowRankPivot, W, &m, &info);
+  DGEMM(&charN, &charN, &n, &numRHS, &m, &minusOne, lowRankZ, &n, W, &m,
+	&one, X, &n);
+#else
+  dgetrs_(&charN, &m, &numRHS, lowRankS, &m, lowRankPivot, W, &m, &info);
+  dgemm_(&charN, &charN, &n, &numRHS, &m, &minusOne, lowRankZ, &n, W, &m,
+	 &one, X, &n);
+#endif
+  delete [] W;
+}
+
+int
+LinearSOE::setBlockB(const Matrix &B, double fact)
+{
+  int n = this->getNumEqn();
+  if (B.noRows() != n) {
+    opserr << "WARNING LinearSOE::setBlockB() - " << B.noRows();
+    opserr << " rows, system has " << n << " equations\n";
+    return -1;
+  }
+
+  int numRHS = B.noCols();
+  if (blockB == 0 || blockB->noCols() != numRHS || blockB->noRows() != n) {
+    if (blockB != 0) delete blockB;
+    if (blockX != 0) delete blockX;
+    blockB = new Matrix(n, numRHS);
+    blockX = new Matrix(n, numRHS);
+  }
+
+  blockB->addMatrix(0.0, B, fact);
+  return 0;
+}
+
+int
+LinearSOE::solveBlock(void)
+{
+  if (blockB == 0 || theSolver == 0)
+    return -1;
+
+  int n = blockB->noRows();
+  int numRHS = blockB->noCols();
+  if (n != this->getNumEqn()) {
+    opserr << "WARNING LinearSOE::solveBlock() - size of the system changed since setBlockB()\n";
+    return -1;
+  }
+  if (numRHS == 0 || n == 0)
+    return 0;
+
+  // the first column through solve(), which factors A if needed
+  static Vector b;
+  b.resize(n);
+  for (int i=0; i<n; i++)
+    b(i) = (*blockB)(i,0);
+  this->setB(b);
+  int result = this->solve();
+  if (result < 0)
+    return result;
+  const Vector &x = this->getX();
+  for (int i=0; i<n; i++)
+    (*blockX)(i,0) = x(i);
+
+  if (numRHS == 1)
+    return 0;
+
+  // the others at once with the factorization just used
+  Profiler::begin(PROFILE_SOLVE);
+  double *BX = new double[n*(numRHS-1)];
+  for (int j=1; j<numRHS; j++)
+    for (int i=0; i<n; i++)
+      BX[(j-1)*n+i] = (*blockB)(i,j);
+  result = theSolver->solveMultiple(numRHS-1, BX);
+  if (result == 0 && numLowRank > 0)
+    this->applyLowRank(BX, numRHS-1);
+  if (result == 0)
+    for (int j=1; j<numRHS; j++)
+      for (int i=0; i<n; i++)
+	(*blockX)(i,j) = BX[(j-1)*n+i];
+  delete [] BX;
+  Profiler::end(PROFILE_SOLVE);
+
+  if (result == 0)
+    return 0;
+
+  // no multiple right hand side substitution, one column at a time
+  for (int j=1; j<numRHS; j++) {
+    for (int i=0; i<n; i++)
+      b(i) = (*blockB)(i,j);
+    this->setB(b);
+    result = this->solve();
+    if (result < 0)
+      return result;
+    const Vector &xj = this->getX();
+    for (int i=0; i<n; i++)
+      (*blockX)(i,j) = xj(i);
+  }
+
+  return 0;
+}
+
+int
+LinearSOE::saveA(void)
+{
+  return -1;
+}
+
+int
+LinearSOE::restoreA(void)
+{
+  return -1;
+}
+
+int
+LinearSOE::domainChanged(void)
+{
+  this->clearBaseA();
+  return 0;
+}
+
+size_t
+LinearSOE::getNumBytes(void)
+{
+  return (2*(size_t)this->getNumEqn() + sizeBaseA)*sizeof(double);
+}
+
+int
+LinearSOE::copyToBaseA(const double *A, int n)
+{
+  if (A == 0 || n <= 0)
     return -1;
+
+  if (n != sizeBaseA) {
+    if (baseA != 0)
+      delete [] baseA;
+    baseA = new (std::nothrow) double[n];
+    if (baseA == 0) {
+      sizeBaseA = 0;
+      return -1;
+    }
+    sizeBaseA = n;
+  }
+
+  memcpy(baseA, A, n*sizeof(double));
+  return 0;
+}
+
+int
+LinearSOE::copyFromBaseA(double *A, int n)
+{
+  if (baseA == 0 || A == 0 || n != sizeBaseA)
+    return -1;
+
+  memcpy(A, baseA, n*sizeof(double));
+  return 0;
+}
+
+void
+LinearSOE::clearBaseA(void)
+{
+  if (baseA != 0)
+    delete [] baseA;
+  baseA = 0;
+  sizeBaseA = 0;
+}
+
+const Matrix &
+LinearSOE::getBlockX(void)
+{
+  static Matrix empty;
+  if (blockX == 0)
+    return empty;
+  return *blockX;
+}
+
+// adds value to sum with the error of the addition kept in comp
+// (Neumaier), the sum is sum + comp once all the values are added
+static inline void
+addCompensated(double &sum, double &comp, double value)
+{
+  double t = sum + value;
+  if (fabs(sum) >= fabs(value))
+    comp += (sum - t) + value;
+  else
+    comp += (value - t) + sum;
+  sum = t;
+}
+
+int
+LinearSOE::formNorms(int normType)
+{
+  const Vector &b = this->getB();
+  const Vector &x = this->getX();
+  int size = b.Size();
+  if (x.Size() != size) {
+    opserr << "WARNING LinearSOE::formNorms() - B and X not of same size\n";
+    normB = b.pNorm(normType);
+    normX = x.pNorm(normType);
+    BdotX = 0.0;
+    return -1;
+  }
+
+  double sumB = 0.0;
+  double sumX = 0.0;
+  double dot = 0.0;
+
+  if (ThreadPool::isReproducible() == true && normType > 0) {
+    // the sums compensated, about ten times the cost of the plain ones
+    double compB = 0.0;
+    double compX = 0.0;
+    double compDot = 0.0;
+    for (int i=0; i<size; i++) {
+      double bi = b(i);
+      double xi = x(i);
+      if (normType == 2) {
+	addCompensated(sumB, compB, bi*bi);
+	addCompensated(sumX, compX, xi*xi);
+      } else if (normType == 1) {
+	addCompensated(sumB, compB, fabs(bi));
+	addCompensated(sumX, compX, fabs(xi));
+      } else {
+	addCompensated(sumB, compB, pow(fabs(bi), normType));
+	addCompensated(sumX, compX, pow(fabs(xi), normType));
+      }
+      addCompensated(dot, compDot, bi*xi);
+    }
+    sumB += compB;
+    sumX += compX;
+    dot += compDot;
+    if (normType == 2) {
+      sumB = sqrt(sumB);
+      sumX = sqrt(sumX);
+    } else if (normType != 1) {
+      sumB = pow(sumB, 1.0/normType);
+      sumX = pow(sumX, 1.0/normType);
+    }
+  }
+  else if (normType == 2) {
+    for (int i=0; i<size; i++) {
+      double bi = b(i);
+      double xi = x(i);
+      sumB += bi*bi;
+      sumX += xi*xi;
+      dot += bi*xi;
+    }
+    sumB = sqrt(sumB);
+    sumX = sqrt(sumX);
+  } 
+  else if (normType == 1) {
+    for (int i=0; i<size; i++) {
+      double bi = b(i);
+      double xi = x(i);
+      sumB += fabs(bi);
+      sumX += fabs(xi);
+      dot += bi*xi;
+    }
+  } 
+  else if (normType > 0) {
+    for (int i=0; i<size; i++) {
+      double bi = b(i);
+      double xi = x(i);
+      sumB += pow(fabs(bi), normType);
+      sumX += pow(fabs(xi), normType);
+      dot += bi*xi;
+    }
+    sumB = pow(sumB, 1.0/normType);
+    sumX = pow(sumX, 1.0/normType);
+  } 
+  else {
+    for (int i=0; i<size; i++) {
+      double bi = fabs(b(i));
+      double xi = fabs(x(i));
+      if (bi > sumB) sumB = bi;
+      if (xi > sumX) sumX = xi;
+      dot += b(i)*x(i);
+    }
+  }
+
+  normB = sumB;
+  normX = sumX;
+  BdotX = dot;
+
+  return 0;
 }
 
 int
@@ -40,6 +40,7 @@
 // What: "@(#) LinearSOE.h, revA"
 
 #include <MovableObject.h>
+#include <stddef.h>
 
 class LinearSOESolver;
 class Graph;
@@ -82,15 +83,75 @@ class LinearSOE : public MovableObject
 
     virtual void setX(int loc, double value) =0;
     virtual void setX(const Vector &X) =0;
+
+    // a block of right hand sides: setBlockB() followed by solveBlock()
+    // solves A X = B for every column of B, the solutions in getBlockX();
+    // the first column goes through solve(), the others through a single
+    // multiple right hand side substitution where the solver offers one
+    virtual int setBlockB(const Matrix &B, double fact = 1.0);
+    virtual int solveBlock(void);
+    virtual const Matrix &getBlockX(void);
+
+    // the norms of B and X and their dot product formed in one pass over
+    // the two vectors, normType as in Vector::pNorm() with 0 the max
+    // norm; the values are kept for the getters until formed again
+    int formNorms(int normType = 2);
+    double getNormB(void) const {return normB;}
+    double getNormX(void) const {return normX;}
+    double getBdotX(void) const {return BdotX;}
+
+    // a base for A: saveA() keeps the values of A formed so far and
+    // restoreA() sets A back to them, as zeroA() would set it to zero;
+    // both return -1 if the system does not keep a base or, for
+    // restoreA(), if none was kept since the system was last sized
+    virtual int saveA(void);
+    virtual int restoreA(void);
+
+    // invoked by the analysis in place of setSize() when the FE_Elements
+    // are built again for a change to the domain that leaves the numbering
+    // and the sparsity of the system unchanged; drops the base for A and,
+    // in the subclasses, anything formed for the old FE_Elements
+    virtual int domainChanged(void);
+
+    // the bytes held by the system for A, B and X and the base for A; the
+    // default counts B, X and the base only
+    virtual size_t getNumBytes(void);
+
+    // a low rank update of A: with the numCols columns of U (numEqn rows,
+    // stored by column) and the factors d set, solve() and solveBlock()
+    // solve (A + U diag(d) U^T) X = B through the Sherman-Morrison-Woodbury
+    // identity, so that A keeps its sparsity; A^-1 U is formed at the
+    // first solve after each call, which is made again whenever A is. U
+    // is not copied and must stay valid while set, numCols 0 removes the
+    // update. Returns -1 if the system cannot apply one.
+    virtual int setLowRankUpdate(const double *U, const double *d, int numCols);
     
-    LinearSOESolver *getSolver(void);
+    virtual LinearSOESolver *getSolver(void);
     
   protected:
     int setSolver(LinearSOESolver &newSolver);	        
+    int copyToBaseA(const double *A, int n);
+    int copyFromBaseA(double *A, int n);
+    void clearBaseA(void);
     AnalysisModel* theModel;
     
   private:
+    int solveLowRank(void);
+    void applyLowRank(double *X, int numRHS);
+
     LinearSOESolver *theSolver;    
+    Matrix *blockB, *blockX;
+    double normB, normX, BdotX;
+    double *baseA;
+    int sizeBaseA;
+
+    const double *lowRankU;
+    double *lowRankD;
+    double *lowRankZ;        // A^-1 U
+    double *lowRankS;        // I + diag(d) U^T A^-1 U, factored
+    int *lowRankPivot;
+    int numLowRank, sizeLowRankZ, sizeLowRankD;
+    bool formedLowRank;
 };
 
 
@@ -38,6 +38,7 @@
 #define LinearSOESolver_h
 
 #include <MovableObject.h>
+#include <stddef.h>
 class LinearSOE;
 
 class LinearSOESolver : public MovableObject
@@ -49,6 +50,20 @@ class LinearSOESolver : public MovableObject
     virtual int solve(void) = 0;
     virtual int setSize(void) = 0;
     virtual double getDeterminant(void) {return 1.0;};
+
+    // numRHS right hand sides in BX, column after column, replaced by the
+    // solutions, using the factorization of the last solve(); -1 if the
+    // solver has no such substitution
+    virtual int solveMultiple(int numRHS, double *BX) {return -1;};
+
+    // the relative residual tolerance of an iterative solver, |B - AX| <=
+    // tol |B|, for the solves that follow; -1 and 0.0 for a direct solver
+    virtual int setTolerance(double tol) {return -1;};
+    virtual double getTolerance(void) {return 0.0;};
+
+    // the bytes held by the solver beyond the system, e.g. the fill of
+    // the factors of a sparse direct solver; 0 if it keeps none
+    virtual size_t getNumBytes(void) {return 0;};
     
   protected:
     
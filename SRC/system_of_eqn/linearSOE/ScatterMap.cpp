@@ -0,0 +1,164 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/ScatterMap.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for ScatterMap.
+//
+// What: "@(#) ScatterMap.C, revA"
+
+#include <ScatterMap.h>
+#include <AnalysisModel.h>
+#include <FE_Element.h>
+#include <FE_EleIter.h>
+#include <ID.h>
+#include <new>
+
+using std::nothrow;
+
+ScatterMap::ScatterMap()
+  :numFE(0), next(0), locStart(0), dofs(0), dofStart(0), loc(0)
+{
+
+}
+
+ScatterMap::~ScatterMap()
+{
+  this->clear();
+}
+
+int
+ScatterMap::form(AnalysisModel *theModel, int size, const int *start,
+		 const int *index, bool byRow, bool triangle)
+{
+  this->clear();
+
+  if (theModel == 0 || size == 0 || start == 0 || index == 0)
+    return 0;
+
+  // first determine the space needed
+  int numElements = 0;
+  int numDOF = 0;
+  int numLoc = 0;
+  FE_Element *elePtr;
+  FE_EleIter &theEles1 = theModel->getFEs();
+  while ((elePtr = theEles1()) != 0) {
+    int idSize = elePtr->getID().Size();
+    numElements++;
+    numDOF += idSize;
+    numLoc += idSize*idSize;
+  }
+
+  if (numElements == 0)
+    return 0;
+
+  locStart = new (nothrow) int[numElements+1];
+  dofStart = new (nothrow) int[numElements+1];
+  dofs = new (nothrow) int[numDOF];
+  loc = new (nothrow) int[numLoc];
+
+  if (locStart == 0 || dofStart == 0 || dofs == 0 || loc == 0) {
+    this->clear();
+    return -1;
+  }
+
+  // now fill in the locations, by binary search of the indices of the
+  // column (row) of each entry
+  locStart[0] = 0;
+  dofStart[0] = 0;
+  int locCount = 0;
+  int dofCount = 0;
+  FE_EleIter &theEles2 = theModel->getFEs();
+  while ((elePtr = theEles2()) != 0) {
+    const ID &id = elePtr->getID();
+    int idSize = id.Size();
+    for (int i=0; i<idSize; i++) {
+      int col = id(i);
+      dofs[dofCount++] = col;
+      for (int j=0; j<idSize; j++) {
+	int row = id(j);
+	int outer = (byRow == true) ? row : col;
+	int inner = (byRow == true) ? col : row;
+	int theLoc = -1;
+	if (outer >= 0 && outer < size && inner >= 0 && inner < size &&
+	    (triangle == false || inner >= outer)) {
+	  int lo = start[outer];
+	  int hi = start[outer+1]-1;
+	  while (lo <= hi) {
+	    int mid = (lo + hi)/2;
+	    int innerMid = index[mid];
+	    if (innerMid == inner) {
+	      theLoc = mid;
+	      break;
+	    } else if (innerMid < inner)
+	      lo = mid+1;
+	    else
+	      hi = mid-1;
+	  }
+	}
+	loc[locCount++] = theLoc;
+      }
+    }
+    numFE++;
+    locStart[numFE] = locCount;
+    dofStart[numFE] = dofCount;
+  }
+
+  return 0;
+}
+
+void
+ScatterMap::clear(void)
+{
+  if (locStart != 0) delete [] locStart;
+  if (dofStart != 0) delete [] dofStart;
+  if (dofs != 0) delete [] dofs;
+  if (loc != 0) delete [] loc;
+
+  locStart = 0;
+  dofStart = 0;
+  dofs = 0;
+  loc = 0;
+  numFE = 0;
+  next = 0;
+}
+
+const int *
+ScatterMap::find(const ID &id)
+{
+  int idSize = id.Size();
+  for (int fe=next; fe<numFE; fe++) {
+    int first = dofStart[fe];
+    if (dofStart[fe+1] - first != idSize)
+      continue;
+    int i = 0;
+    while (i < idSize && dofs[first+i] == id(i))
+      i++;
+    if (i == idSize) {
+      next = fe+1;
+      return &loc[locStart[fe]];
+    }
+  }
+  return 0;
+}
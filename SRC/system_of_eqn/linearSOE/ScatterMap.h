@@ -0,0 +1,81 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/ScatterMap.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for ScatterMap.
+// A ScatterMap gives, for each FE_Element of an AnalysisModel, the location
+// in the compressed storage of a sparse A of every entry of the element
+// matrix, so that the addA() of the LinearSOE does not have to search the
+// storage. The entries of an FE_Element with ID id are in the order
+// (id(0),id(0)), (id(1),id(0)), ..., (id(n-1),id(n-1)), row then column,
+// i.e. as m(j,i) with j running fastest; -1 if an entry is not stored.
+// The storage is compressed by column, or by row, with the indices of
+// each column (row) in order, and may hold only the entries with a row
+// (column) index not less than the column (row) index.
+//
+// The map is looked up with the ID given to addA(): the FE_Elements are
+// added in the order of the map, some may be skipped, e.g. those with a
+// tangent kept by the LinearSOE, so the search starts after the one last
+// found and goes on to the end of the map.
+//
+// What: "@(#) ScatterMap.h, revA"
+
+#ifndef ScatterMap_h
+#define ScatterMap_h
+
+class AnalysisModel;
+class ID;
+
+class ScatterMap
+{
+  public:
+    ScatterMap();
+    ~ScatterMap();
+
+    // forms the map for the FE_Elements of theModel, empty if there is no
+    // model; start and index are those of the compressed storage of the
+    // size equations. Returns -1 if out of memory, the map is then empty,
+    // which is not an error as addA() can still search the storage
+    int form(AnalysisModel *theModel, int size, const int *start,
+	     const int *index, bool byRow = false, bool triangle = false);
+    void clear(void);
+
+    // the locations of the entries for the FE_Element with ID id, 0 if
+    // it is not in the map
+    const int *find(const ID &id);
+
+    // the next find() starts from the first FE_Element, as A is zeroed
+    void restart(void) {next = 0;}
+
+  private:
+    int numFE;           // number of FE_Elements in the map
+    int next;            // first FE_Element find() looks for id at
+    int *locStart;       // start of each FE_Element's entries (numFE+1)
+    int *dofs;           // copy of the FE_Element IDs used to build the map
+    int *dofStart;       // start of each FE_Element's ID in dofs (numFE+1)
+    int *loc;            // location in A, -1 if entry not stored
+};
+
+#endif
@@ -36,12 +36,37 @@
 // What: "@(#) BandGenLinLapackSolver.h, revA"
 
 #include <BandGenLinLapackSolver.h>
+#include <BandGenLinMixedSolver.h>
 #include <BandGenLinSOE.h>
+#include <elementAPI.h>
 #include <math.h>
+#include <string.h>
 
 void* OPS_BandGenLinLapack()
 {
-    BandGenLinSolver *theSolver = new BandGenLinLapackSolver();
+    // system BandGeneral <-mixed <-maxRefine n?> <-tol tol?>>
+    BandGenLinSolver *theSolver = 0;
+    if (OPS_GetNumRemainingInputArgs() > 0 && strcmp(OPS_GetString(), "-mixed") == 0) {
+	int maxRefine = 10;
+	double tol = 1.0e-14;
+	int numdata = 1;
+	while (OPS_GetNumRemainingInputArgs() > 1) {
+	    const char *option = OPS_GetString();
+	    if (strcmp(option, "-maxRefine") == 0) {
+		if (OPS_GetIntInput(&numdata, &maxRefine) < 0) {
+		    opserr << "WARNING system BandGeneral -mixed - invalid -maxRefine\n";
+		    return 0;
+		}
+	    } else if (strcmp(option, "-tol") == 0) {
+		if (OPS_GetDoubleInput(&numdata, &tol) < 0) {
+		    opserr << "WARNING system BandGeneral -mixed - invalid -tol\n";
+		    return 0;
+		}
+	    }
+	}
+	theSolver = new BandGenLinMixedSolver(maxRefine, tol);
+    } else
+	theSolver = new BandGenLinLapackSolver();
     BandGenLinSOE *theSOE = new BandGenLinSOE(*theSolver);
     return theSOE;
 }
@@ -153,6 +178,37 @@ BandGenLinLapackSolver::solve(void)
     
 
 
+int
+BandGenLinLapackSolver::solveMultiple(int numRHS, double *BX)
+{
+    // substitution with the factors of the last solve(); a distributed
+    // system only has the factors on P0
+    if (theSOE == 0 || theSOE->factored == false ||
+	theSOE->getClassTag() != LinSOE_TAGS_BandGenLinSOE)
+	return -1;
+
+    int n = theSOE->size;
+    int kl = theSOE->numSubD;
+    int ku = theSOE->numSuperD;
+    int ldA = 2*kl + ku +1;
+    int ldB = n;
+    int info;
+    char trans[] = "N";
+
+#ifdef _WIN32
+    DGBTRS(trans, &n,&kl,&ku,&numRHS,theSOE->A,&ldA,iPiv,BX,&ldB,&info);
+#else
+    dgbtrs_(trans,&n,&kl,&ku,&numRHS,theSOE->A,&ldA,iPiv,BX,&ldB,&info);
+#endif
+
+    if (info != 0) {
+	opserr << "WARNING BandGenLinLapackSolver::solveMultiple() - OpenSees code error\n";
+	return -1;
+    }
+    return 0;
+}
+
+
 int
 BandGenLinLapackSolver::setSize()
 {
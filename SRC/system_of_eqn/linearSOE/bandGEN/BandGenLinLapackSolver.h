@@ -47,6 +47,7 @@ class BandGenLinLapackSolver : public BandGenLinSolver
     ~BandGenLinLapackSolver();
 
     int solve(void);
+    int solveMultiple(int numRHS, double *BX);
     int setSize(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -0,0 +1,357 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandGEN/BandGenLinMixedSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for
+// BandGenLinMixedSolver.
+
+// What: "@(#) BandGenLinMixedSolver.C, revA"
+
+#include <BandGenLinMixedSolver.h>
+#include <BandGenLinSOE.h>
+#include <math.h>
+#include <float.h>
+
+#ifdef _WIN32
+
+extern "C" int SGBTRF(int *M, int *N, int *KL, int *KU, float *A, int *LDA,
+			       int *iPiv, int *INFO);
+
+extern "C" int SGBTRS(char *TRANS, int *N, int *KL, int *KU, int *NRHS,
+			       float *A, int *LDA, int *iPiv,
+			       float *B, int *LDB, int *INFO);
+
+extern "C" int DGBTRF(int *M, int *N, int *KL, int *KU, double *A, int *LDA,
+			       int *iPiv, int *INFO);
+
+extern "C" int DGBTRS(char *TRANS, int *N, int *KL, int *KU, int *NRHS,
+			       double *A, int *LDA, int *iPiv,
+			       double *B, int *LDB, int *INFO);
+
+#else
+
+extern "C" int sgbtrf_(int *M, int *N, int *KL, int *KU, float *A, int *LDA,
+		       int *iPiv, int *INFO);
+
+extern "C" int sgbtrs_(char *TRANS, int *N, int *KL, int *KU, int *NRHS,
+		       float *A, int *LDA, int *iPiv, float *B, int *LDB,
+		       int *INFO);
+
+extern "C" int dgbtrf_(int *M, int *N, int *KL, int *KU, double *A, int *LDA,
+		       int *iPiv, int *INFO);
+
+extern "C" int dgbtrs_(char *TRANS, int *N, int *KL, int *KU, int *NRHS,
+		       double *A, int *LDA, int *iPiv, double *B, int *LDB,
+		       int *INFO);
+#endif
+
+BandGenLinMixedSolver::BandGenLinMixedSolver(int maxR, double t)
+:BandGenLinSolver(SOLVER_TAGS_BandGenLinMixedSolver),
+ maxRefine(maxR), tol(t),
+ iPiv(0), iPivSize(0), AF(0), AD(0), sizeA(0),
+ workF(0), R(0), sizeWork(0),
+ useDouble(false), normA(0.0), numRefine(0)
+{
+  if (maxRefine < 1)
+    maxRefine = 1;
+}
+
+BandGenLinMixedSolver::~BandGenLinMixedSolver()
+{
+  if (iPiv != 0) delete [] iPiv;
+  if (AF != 0) delete [] AF;
+  if (AD != 0) delete [] AD;
+  if (workF != 0) delete [] workF;
+  if (R != 0) delete [] R;
+}
+
+
+int
+BandGenLinMixedSolver::setSize()
+{
+  int n = theSOE->size;
+  int ldA = 2*theSOE->numSubD + theSOE->numSuperD + 1;
+
+  if (iPivSize < n) {
+    if (iPiv != 0) delete [] iPiv;
+    iPiv = new int[n];
+    iPivSize = n;
+  }
+
+  if (sizeWork < n) {
+    if (workF != 0) delete [] workF;
+    if (R != 0) delete [] R;
+    workF = new float[n];
+    R = new double[n];
+    sizeWork = n;
+  }
+
+  if (sizeA < n*ldA) {
+    if (AF != 0) delete [] AF;
+    if (AD != 0) delete [] AD;
+    AF = new float[n*ldA];
+    AD = 0;
+    sizeA = n*ldA;
+  }
+
+  useDouble = false;
+  return 0;
+}
+
+
+int
+BandGenLinMixedSolver::factorDouble(void)
+{
+  int n = theSOE->size;
+  int kl = theSOE->numSubD;
+  int ku = theSOE->numSuperD;
+  int ldA = 2*kl + ku + 1;
+  int info = 0;
+
+  if (AD == 0)
+    AD = new double[sizeA];
+
+  double *A = theSOE->A;
+  for (int k=0; k<n*ldA; k++)
+    AD[k] = A[k];
+
+#ifdef _WIN32
+  DGBTRF(&n, &n, &kl, &ku, AD, &ldA, iPiv, &info);
+#else
+  dgbtrf_(&n, &n, &kl, &ku, AD, &ldA, iPiv, &info);
+#endif
+
+  if (info != 0) {
+    // iPiv no longer goes with the single precision factors
+    theSOE->factored = false;
+    if (info > 0) {
+      opserr << "WARNING BandGenLinMixedSolver::solve() -";
+      opserr << "factorization failed, matrix singular U(i,i) = 0, i= " << info << endln;
+      return -info;
+    } else {
+      opserr << "WARNING BandGenLinMixedSolver::solve() - OpenSees code error\n";
+      return info;
+    }
+  }
+
+  useDouble = true;
+  return 0;
+}
+
+
+void
+BandGenLinMixedSolver::formResidual(void)
+{
+  // R = B - A X with the double precision A
+  int n = theSOE->size;
+  int kl = theSOE->numSubD;
+  int ku = theSOE->numSuperD;
+  int ldA = 2*kl + ku + 1;
+  double *A = theSOE->A;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+
+  for (int i=0; i<n; i++)
+    R[i] = B[i];
+
+  for (int j=0; j<n; j++) {
+    double xj = X[j];
+    if (xj == 0.0)
+      continue;
+    int iStart = (j-ku > 0) ? j-ku : 0;
+    int iEnd = (j+kl < n-1) ? j+kl : n-1;
+    const double *colPtr = A + j*ldA + kl + ku - j;
+    for (int i=iStart; i<=iEnd; i++)
+      R[i] -= colPtr[i]*xj;
+  }
+}
+
+
+int
+BandGenLinMixedSolver::solve(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING BandGenLinMixedSolver::solve(void)- ";
+    opserr << " No LinearSOE object has been set\n";
+    return -1;
+  }
+
+  int n = theSOE->size;    
+  if (iPivSize < n) {
+    opserr << "WARNING BandGenLinMixedSolver::solve(void)- ";
+    opserr << " iPiv not large enough - has setSize() been called?\n";
+    return -1;
+  }	    
+
+  if (n == 0)
+    return 0;
+
+  int kl = theSOE->numSubD;
+  int ku = theSOE->numSuperD;
+  int ldA = 2*kl + ku + 1;
+  int nrhs = 1;
+  int info = 0;
+  double *A = theSOE->A;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  char trans[] = "N";
+
+  numRefine = 0;
+
+  if (theSOE->factored == false) {
+
+    // the single precision copy, unless A does not fit in a float
+    useDouble = false;
+    bool fits = true;
+    for (int k=0; k<n*ldA && fits == true; k++) {
+      if (fabs(A[k]) > FLT_MAX)
+	fits = false;
+      AF[k] = (float)A[k];
+    }
+
+    // infinity norm of A for the convergence test
+    normA = 0.0;
+    for (int i=0; i<n; i++) {
+      int jStart = (i-kl > 0) ? i-kl : 0;
+      int jEnd = (i+ku < n-1) ? i+ku : n-1;
+      double rowSum = 0.0;
+      for (int j=jStart; j<=jEnd; j++)
+	rowSum += fabs(A[j*ldA + kl + ku + i - j]);
+      if (rowSum > normA)
+	normA = rowSum;
+    }
+
+    if (fits == true) {
+#ifdef _WIN32
+      SGBTRF(&n, &n, &kl, &ku, AF, &ldA, iPiv, &info);
+#else
+      sgbtrf_(&n, &n, &kl, &ku, AF, &ldA, iPiv, &info);
+#endif
+    }
+
+    if (fits == false || info != 0) {
+      int res = this->factorDouble();
+      if (res != 0)
+	return res;
+    }
+
+    theSOE->factored = true;
+  }
+
+  if (useDouble == true) {
+    for (int i=0; i<n; i++)
+      X[i] = B[i];
+#ifdef _WIN32
+    DGBTRS(trans, &n, &kl, &ku, &nrhs, AD, &ldA, iPiv, X, &n, &info);
+#else
+    dgbtrs_(trans, &n, &kl, &ku, &nrhs, AD, &ldA, iPiv, X, &n, &info);
+#endif
+    return 0;
+  }
+
+  //
+  // iterative refinement: X += A_s^-1 (B - A X), starting from X = 0
+  //
+
+  double normB = 0.0;
+  for (int i=0; i<n; i++) {
+    X[i] = 0.0;
+    R[i] = B[i];
+    if (fabs(B[i]) > normB)
+      normB = fabs(B[i]);
+  }
+
+  if (normB == 0.0)
+    return 0;
+
+  double lastNormR = 0.0;
+  bool converged = false;
+  for (int iter=0; iter<maxRefine; iter++) {
+
+    for (int i=0; i<n; i++)
+      workF[i] = (float)R[i];
+
+#ifdef _WIN32
+    SGBTRS(trans, &n, &kl, &ku, &nrhs, AF, &ldA, iPiv, workF, &n, &info);
+#else
+    sgbtrs_(trans, &n, &kl, &ku, &nrhs, AF, &ldA, iPiv, workF, &n, &info);
+#endif
+
+    double normX = 0.0;
+    for (int i=0; i<n; i++) {
+      X[i] += workF[i];
+      if (fabs(X[i]) > normX)
+	normX = fabs(X[i]);
+    }
+    numRefine++;
+
+    this->formResidual();
+    double normR = 0.0;
+    for (int i=0; i<n; i++)
+      if (fabs(R[i]) > normR)
+	normR = fabs(R[i]);
+
+    if (normR <= tol*(normA*normX + normB)) {
+      converged = true;
+      break;
+    }
+
+    // the single precision factors are not good enough for this A
+    if (iter > 0 && normR >= 0.5*lastNormR)
+      break;
+    lastNormR = normR;
+  }
+
+  if (converged == false) {
+    int res = this->factorDouble();
+    if (res != 0)
+      return res;
+    for (int i=0; i<n; i++)
+      X[i] = B[i];
+#ifdef _WIN32
+    DGBTRS(trans, &n, &kl, &ku, &nrhs, AD, &ldA, iPiv, X, &n, &info);
+#else
+    dgbtrs_(trans, &n, &kl, &ku, &nrhs, AD, &ldA, iPiv, X, &n, &info);
+#endif
+  }
+
+  return 0;
+}
+
+
+int    
+BandGenLinMixedSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+int
+BandGenLinMixedSolver::recvSelf(int commitTag,
+				Channel &theChannel, 
+				FEM_ObjectBroker &theBroker)
+{
+  // nothing to do
+  return 0;
+}
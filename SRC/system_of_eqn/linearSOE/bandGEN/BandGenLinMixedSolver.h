@@ -0,0 +1,83 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandGEN/BandGenLinMixedSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// BandGenLinMixedSolver. It solves the BandGenLinSOE with a single
+// precision LU factorization of A (Lapack sgbtrf) and recovers the double
+// precision solution by iterative refinement, the residuals being formed
+// with the double precision A, which the solver leaves untouched. When the
+// refinement does not converge in maxRefine steps, or A cannot be factored
+// in single precision, A is factored in double precision instead and that
+// factorization is used until A changes. Solves reusing the factorization
+// (ModifiedNewton, KrylovNewton, linear transient steps) only cost the
+// refinement steps.
+
+// What: "@(#) BandGenLinMixedSolver.h, revA"
+
+#ifndef BandGenLinMixedSolver_h
+#define BandGenLinMixedSolver_h
+
+#include <BandGenLinSolver.h>
+
+class BandGenLinMixedSolver : public BandGenLinSolver
+{
+  public:
+    BandGenLinMixedSolver(int maxRefine = 10, double tol = 1.0e-14);
+    ~BandGenLinMixedSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int getNumRefinements(void) const {return numRefine;}
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
+    
+  protected:
+
+  private:
+    int factorDouble(void);
+    void formResidual(void);
+
+    int maxRefine;
+    double tol;        // on |r| / (|A| |x| + |b|), infinity norms
+
+    int *iPiv;
+    int iPivSize;
+    float *AF;         // single precision factors
+    double *AD;        // double precision factors, only if needed
+    int sizeA;
+    float *workF;
+    double *R;
+    int sizeWork;
+
+    bool useDouble;    // current A factored in double precision
+    double normA;
+    int numRefine;
+};
+
+#endif
@@ -120,6 +120,12 @@ BandGenLinSOE::getNumEqn(void) const
 {
     return size;
 }
+
+size_t
+BandGenLinSOE::getNumBytes(void)
+{
+    return Asize*sizeof(double) + this->LinearSOE::getNumBytes();
+}
     
 BandGenLinSOE::~BandGenLinSOE()
 {
@@ -135,6 +141,8 @@ BandGenLinSOE::~BandGenLinSOE()
 int 
 BandGenLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
+
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
@@ -460,6 +468,19 @@ BandGenLinSOE::zeroA(void)
     
     factored = false;
 }
+
+int
+BandGenLinSOE::saveA(void)
+{
+    return this->copyToBaseA(A, Asize);
+}
+
+int
+BandGenLinSOE::restoreA(void)
+{
+    factored = false;
+    return this->copyFromBaseA(A, Asize);
+}
 	
 void 
 BandGenLinSOE::zeroB(void)
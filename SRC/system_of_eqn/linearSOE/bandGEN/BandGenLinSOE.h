@@ -63,6 +63,9 @@ class BandGenLinSOE : public LinearSOE
 
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual size_t getNumBytes(void);
 
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);
@@ -76,6 +79,7 @@ class BandGenLinSOE : public LinearSOE
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
     friend class BandGenLinLapackSolver;
+    friend class BandGenLinMixedSolver;
 
   protected:
     int size, numSuperD, numSubD;    
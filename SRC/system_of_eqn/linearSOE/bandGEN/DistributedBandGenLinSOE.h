@@ -55,6 +55,8 @@ class DistributedBandGenLinSOE : public BandGenLinSOE
     void zeroB(void);
     const Vector &getB(void);
     int solve(void);
+    // the solve is not the one of LinearSOE, no low rank update
+    int setLowRankUpdate(const double *U, const double *d, int numCols) {return -1;}
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
@@ -32,12 +32,27 @@
 
 #include <BandSPDLinLapackSolver.h>
 #include <BandSPDLinSOE.h>
+#include <BandSPDLinThreadSolver.h>
+#include <elementAPI.h>
 //#include <f2c.h>
 #include <math.h>
+#include <string.h>
 
 void* OPS_BandSPDLinLapack()
 {
-    BandSPDLinSolver *theSolver = new BandSPDLinLapackSolver();
+    // system BandSPD <-thread blockSize?>
+    BandSPDLinSolver *theSolver = 0;
+    if (OPS_GetNumRemainingInputArgs() > 0 && strcmp(OPS_GetString(), "-thread") == 0) {
+	int blockSize = 32;
+	int numdata = 1;
+	if (OPS_GetNumRemainingInputArgs() > 0 &&
+	    OPS_GetIntInput(&numdata, &blockSize) < 0) {
+	    opserr << "WARNING system BandSPD -thread <blockSize?> - invalid blockSize\n";
+	    return 0;
+	}
+	theSolver = new BandSPDLinThreadSolver(blockSize);
+    } else
+	theSolver = new BandSPDLinLapackSolver();
     BandSPDLinSOE *theSOE = new BandSPDLinSOE(*theSolver);
     return theSOE;
 }
@@ -138,6 +153,37 @@ BandSPDLinLapackSolver::solve(void)
     
 
 
+int
+BandSPDLinLapackSolver::solveMultiple(int numRHS, double *BX)
+{
+    // substitution with the factors of the last solve(); a distributed
+    // system only has the factors on P0
+    if (theSOE == 0 || theSOE->factored == false ||
+	theSOE->getClassTag() != LinSOE_TAGS_BandSPDLinSOE)
+	return -1;
+
+    int n = theSOE->size;
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    int ldB = n;
+    int info;
+    char uplo[] = "U";
+
+#ifdef _WIN32
+    DPBTRS(uplo, &n,&kd,&numRHS,theSOE->A,&ldA,BX,&ldB,&info);
+#else
+    dpbtrs_(uplo,&n,&kd,&numRHS,theSOE->A,&ldA,BX,&ldB,&info);
+#endif
+
+    if (info != 0) {
+	opserr << "WARNING BandSPDLinLapackSolver::solveMultiple() - the LAPACK";
+	opserr << " routines returned " << info << endln;
+	return -1;
+    }
+    return 0;
+}
+
+
 int
 BandSPDLinLapackSolver::setSize()
 {
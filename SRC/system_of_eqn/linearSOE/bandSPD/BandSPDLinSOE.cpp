@@ -146,9 +146,17 @@ BandSPDLinSOE::getNumEqn(void) const
     return size;
 }
 
+size_t
+BandSPDLinSOE::getNumBytes(void)
+{
+    return Asize*sizeof(double) + this->LinearSOE::getNumBytes();
+}
+
 int 
 BandSPDLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
+
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
@@ -414,6 +422,19 @@ BandSPDLinSOE::zeroA(void)
     
     factored = false;
 }
+
+int
+BandSPDLinSOE::saveA(void)
+{
+    return this->copyToBaseA(A, Asize);
+}
+
+int
+BandSPDLinSOE::restoreA(void)
+{
+    factored = false;
+    return this->copyFromBaseA(A, Asize);
+}
 	
 void 
 BandSPDLinSOE::zeroB(void)
@@ -65,6 +65,9 @@ class BandSPDLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual size_t getNumBytes(void);
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);    
@@ -18,8 +18,8 @@
 **                                                                    **
 ** ****************************************************************** */
                                                                         
-// $Revision: 1.2 $
-// $Date: 2003-02-14 23:02:01 $
+// $Revision: 1.3 $
+// $Date: 2026-10-14 00:00:00 $
 // $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.cpp,v $
                                                                         
                                                                         
@@ -27,56 +27,33 @@
 //
 // Written: fmk 
 // Created: Mar, 1998
-// Revision: A
+// Revision: B
 //
 // Description: This file contains the class definition for 
 // BandSPDLinThreadSolver. It solves the BandSPDLinSOE object by calling
 // Thread routines.
 //
+// Revision B (10/26): the solaris threads are replaced by OpenMP loops run
+// on the threads set with the threads command (see ThreadPool).
+//
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
 #include <BandSPDLinThreadSolver.h>
 #include <BandSPDLinSOE.h>
-#include <f2c.h>
+#include <ThreadPool.h>
 #include <math.h>
-#include <thread.h>
-
-// global data that will be needed by the threads
-struct thread_control_block {
-  mutex_t start_mutex;
-  mutex_t end_mutex;
-  mutex_t startBlock_mutex;
-  mutex_t endBlock_mutex;
-
-  cond_t start_cond;
-  cond_t end_cond;
-  cond_t startBlock_cond;
-  cond_t endBlock_cond;
-
-  double *A,*X,*B;
-  int n, kd;
-  int blockSize, currentBlock;
-  int workToDo;
-  int info;
-  int threadID;
-  int numThreads;
-  int threadsDone;
-  int threadsDoneBlock;
-} TCB_BandSPDLinThreadSolver;
-
 
 BandSPDLinThreadSolver::BandSPDLinThreadSolver()
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(1), 
- running(false), blockSize(1)
+:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), blockSize(32)
 {
   
 }
 
-BandSPDLinThreadSolver::BandSPDLinThreadSolver(int numProcessors, int blckSize)
-:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), NP(numProcessors),
- running(false), blockSize(blckSize)
+BandSPDLinThreadSolver::BandSPDLinThreadSolver(int blckSize)
+:BandSPDLinSolver(SOLVER_TAGS_BandSPDLinThreadSolver), blockSize(blckSize)
 {
-
+  if (blockSize < 1)
+    blockSize = 1;
 }
 
 BandSPDLinThreadSolver::~BandSPDLinThreadSolver()
@@ -85,26 +62,23 @@ BandSPDLinThreadSolver::~BandSPDLinThreadSolver()
 }
 
 
-extern "C" int dpbsv_(char *UPLO, int *N, int *KD, int *NRHS, 
-		      double *A, int *LDA, double *B, int *LDB, 
-		      int *INFO);
-
-extern "C" int dpbtrf_(char *UPLO, int *N, int *KD, double *A, 
-		       int *LDA, int *INFO);
-
+#ifdef _WIN32
+extern "C" int  DPBTRS(char *UPLO,
+			       int *N, int *KD, int *NRHS, 
+			       double *A, int *LDA, double *B, int *LDB, 
+			       int *INFO);
+#else
 extern "C" int dpbtrs_(char *UPLO, int *N, int *KD, int *NRHS, 
 		       double *A, int *LDA, double *B, int *LDB, 
 		       int *INFO);
-		       
-
-void *BandSPDLinThreadSolver_Worker(void *arg);
+#endif
 
 
 int
 BandSPDLinThreadSolver::solve(void)
 {
     if (theSOE == 0) {
-	opserr << "BandSPDLinThreadSolver::solve(void)- ";
+	opserr << "WARNING BandSPDLinThreadSolver::solve(void)- ";
 	opserr << " No LinearSOE object has been set\n";
 	return -1;
     }
@@ -124,76 +98,125 @@ BandSPDLinThreadSolver::solve(void)
 	*(Xptr++) = *(Bptr++);
     Xptr = theSOE->X;
 
-    // now solve AX = Y
+    // factor A = U^t U in the LAPACK upper band storage, i.e. the same as dpbtrf
     if (theSOE->factored == false) {
+      if (this->factor() < 0)
+	return -2;
+    }
 
-      // start threads running
-      if (running == false) {
-	mutex_init(&TCB_BandSPDLinThreadSolver.start_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.end_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.startBlock_mutex, USYNC_THREAD, 0);
-	mutex_init(&TCB_BandSPDLinThreadSolver.endBlock_mutex, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.start_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.end_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.startBlock_cond, USYNC_THREAD, 0);
-	cond_init(&TCB_BandSPDLinThreadSolver.endBlock_cond, USYNC_THREAD, 0);
-	TCB_BandSPDLinThreadSolver.workToDo = 0;
-        
-	// Create the threads - Bound daemon threads
-	for (int j = 0; j < NP; j++) 
-	  thr_create(NULL,0, BandSPDLinThreadSolver_Worker, NULL, 
-		     THR_BOUND|THR_DAEMON, NULL);
-
-        running = true;
-      }
-      
-  
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex); 
-        // assign the global variables the threads will need
-        TCB_BandSPDLinThreadSolver.A = Aptr;
-	TCB_BandSPDLinThreadSolver.X = Xptr;
-	TCB_BandSPDLinThreadSolver.B = Bptr;
-	TCB_BandSPDLinThreadSolver.n = n;
-	TCB_BandSPDLinThreadSolver.kd = kd;
-	TCB_BandSPDLinThreadSolver.info = 0;
-        TCB_BandSPDLinThreadSolver.workToDo = NP;
-        TCB_BandSPDLinThreadSolver.blockSize = blockSize;
-        TCB_BandSPDLinThreadSolver.currentBlock = -1;
-	TCB_BandSPDLinThreadSolver.threadID = 0;
-	TCB_BandSPDLinThreadSolver.numThreads = NP;
-        TCB_BandSPDLinThreadSolver.threadsDone = 0;
-        TCB_BandSPDLinThreadSolver.threadsDoneBlock = NP;
+    // solve using factored matrix
+    char uplo[] = "U";
+#ifdef _WIN32
+    DPBTRS(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#else
+    dpbtrs_(uplo,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+#endif
 
-        // wake up the threads
-        cond_broadcast(&TCB_BandSPDLinThreadSolver.start_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex); 
+    // check if successfull
+    if (info != 0) {
+	opserr << "WARNING BandSPDLinThreadSolver::solve() - the LAPACK";
+	opserr << " routines returned " << info << endln;
+	return -info;
+    }
 
-      // yield the LWP
-      thr_yield();
- 
-      // wait for all the threads to finish
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
+    theSOE->factored = true;
+    return 0;
+}
 
-         while (TCB_BandSPDLinThreadSolver.threadsDone < NP) 
-           cond_wait(&TCB_BandSPDLinThreadSolver.end_cond, &TCB_BandSPDLinThreadSolver.end_mutex);
 
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    }
+// a(i,j), j-kd <= i <= j, is stored at A[j*ldA + kd + i - j]; a block row
+// of blockSize rows is done at a time: the diagonal block is factored, the
+// threads then form the rows of U to the right of it, one column each, and
+// finally apply the block row to the columns below it, again one column each.
+int
+BandSPDLinThreadSolver::factor(void)
+{
+    int n = theSOE->size;
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    double *A = theSOE->A;
+#ifdef _OPENMP
+    int numThreads = ThreadPool::getNumThreads();
+#endif
+
+    for (int k0=0; k0<n; k0+=blockSize) {
+
+      int k1 = k0 + blockSize - 1;
+      if (k1 >= n)
+	k1 = n-1;
+
+      // factor the diagonal block
+      for (int j=k0; j<=k1; j++) {
+	double *colj = A + j*ldA + kd - j;
+	int iTop = (j-kd > k0) ? j-kd : k0;
+	for (int i=iTop; i<j; i++) {
+	  double *coli = A + i*ldA + kd - i;
+	  double tmp = colj[i];
+	  for (int p=iTop; p<i; p++)
+	    tmp -= coli[p] * colj[p];
+	  colj[i] = tmp / coli[i];
+	}
+	double ajj = colj[j];
+	for (int p=iTop; p<j; p++)
+	  ajj -= colj[p] * colj[p];
+	if (ajj <= 0.0) {
+	  opserr << "WARNING BandSPDLinThreadSolver::solve() - ";
+	  opserr << " matrix is not positive definite, aii <= 0 (i, aii): (";
+	  opserr << j << ", " << ajj << ")\n";
+	  return -2;
+	}
+	colj[j] = sqrt(ajj);
+      }
 
-    // solve using factored matrix
-    dpbtrs_("U",&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
-    
+      int lastCol = k1 + kd;
+      if (lastCol >= n)
+	lastCol = n-1;
+      int numCols = lastCol - k1;
+      if (numCols <= 0)
+	continue;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(numThreads) if (numThreads > 1 && numCols > 32)
+#endif
+      {
+	// the rows k0 through k1 of U to the right of the diagonal block
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 8)
+#endif
+	for (int j=k1+1; j<=lastCol; j++) {
+	  double *colj = A + j*ldA + kd - j;
+	  int iTop = (j-kd > k0) ? j-kd : k0;
+	  for (int i=iTop; i<=k1; i++) {
+	    double *coli = A + i*ldA + kd - i;
+	    double tmp = colj[i];
+	    for (int p=iTop; p<i; p++)
+	      tmp -= coli[p] * colj[p];
+	    colj[i] = tmp / coli[i];
+	  }
+	}
 
-    // check if successfull
-    if (info != 0)
-	return info;
+	// update the part of the trailing matrix the block row reaches
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 8)
+#endif
+	for (int j=k1+1; j<=lastCol; j++) {
+	  double *colj = A + j*ldA + kd - j;
+	  int pTop = (j-kd > k0) ? j-kd : k0;
+	  for (int i=k1+1; i<=j; i++) {
+	    double *coli = A + i*ldA + kd - i;
+	    double tmp = 0.0;
+	    for (int p=pTop; p<=k1; p++)
+	      tmp += coli[p] * colj[p];
+	    colj[i] -= tmp;
+	  }
+	}
+      }
+    }
 
-    theSOE->factored = true;
     return 0;
 }
     
 
-
 int
 BandSPDLinThreadSolver::setSize()
 {
@@ -203,120 +226,16 @@ BandSPDLinThreadSolver::setSize()
 
 
 int
-BandSPDLinThreadSolver::sendSelf(Channel &theChannel, 
-				 FEM_ObjectBroker &theBroker)
+BandSPDLinThreadSolver::sendSelf(int commitTag, Channel &theChannel)
 {
     // nothing to do
     return 0;
 }
 
 int
-BandSPDLinThreadSolver::recvSelf(Channel &theChannel, 
+BandSPDLinThreadSolver::recvSelf(int commitTag, Channel &theChannel, 
 				 FEM_ObjectBroker &theBroker)
 {
     // nothing to do
     return 0;
 }
-
-
-
-
-// Thread routine called from thr_create() as a Bound Daemon Thread
-void *BandSPDLinThreadSolver_Worker(void *arg)
-{
-  // Do this loop forever - or until all the Non-Daemon threads have exited
-  while(true)
-    {
-
-      // Wait for some work to do
-      mutex_lock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-        while (TCB_BandSPDLinThreadSolver.workToDo == 0)
-          cond_wait(&TCB_BandSPDLinThreadSolver.start_cond, &TCB_BandSPDLinThreadSolver.start_mutex);
-
-        TCB_BandSPDLinThreadSolver.workToDo--;
-
-        // get an id;
-	int myID = TCB_BandSPDLinThreadSolver.threadID++;
-
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.start_mutex);
-
-      // do some initialisation for the factorization
-      int currentBlock =0;
-      int n = TCB_BandSPDLinThreadSolver.n;
-      int kd = TCB_BandSPDLinThreadSolver.kd;
-      int blckSize = TCB_BandSPDLinThreadSolver.blockSize;
-      double *Aptr = TCB_BandSPDLinThreadSolver.A;
-      double *Bptr = TCB_BandSPDLinThreadSolver.B;
-      double *Xptr = TCB_BandSPDLinThreadSolver.X;
-      int numThreads = TCB_BandSPDLinThreadSolver.numThreads;
-    
-      int nBlocks = n/blckSize;
-
-      for (int i=0; i<nBlocks; i++) {
-        int currentDiagThread = i%numThreads;
-        if (myID == currentDiagThread) {
-
-	  // wait till last block row is done
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-            while(TCB_BandSPDLinThreadSolver.threadsDoneBlock < numThreads)
-	      cond_wait(&TCB_BandSPDLinThreadSolver.endBlock_cond, &TCB_BandSPDLinThreadSolver.endBlock_mutex);
-
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock = 0;
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);        
-
-          // FACTOR DIAG BLOCK
-       
-          // allow other threads to now proceed
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.currentBlock = i;
-
-            cond_broadcast(&TCB_BandSPDLinThreadSolver.startBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);        
-
-          
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                   
-	}
-        else {
-
-          // wait till diag i is done 
-          mutex_lock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-             while (TCB_BandSPDLinThreadSolver.currentBlock < i)
-                cond_wait(&TCB_BandSPDLinThreadSolver.startBlock_cond, 
-			  &TCB_BandSPDLinThreadSolver.startBlock_mutex); 
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.startBlock_mutex);
-
-          // FACTOR REST OF BLOCK ROW BELONGING TO THREAD
-
-          // mark that the thread has finished with row
-          mutex_lock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);
-	    TCB_BandSPDLinThreadSolver.threadsDoneBlock++;
-
-            cond_signal(&TCB_BandSPDLinThreadSolver.endBlock_cond);
-          mutex_unlock(&TCB_BandSPDLinThreadSolver.endBlock_mutex);                             
-	}
-      }
-
-      // signal the main thread that this thread is done with the work
-      mutex_lock(&TCB_BandSPDLinThreadSolver.end_mutex);
-         TCB_BandSPDLinThreadSolver.threadsDone++;
-
-         cond_signal(&TCB_BandSPDLinThreadSolver.end_cond);
-      mutex_unlock(&TCB_BandSPDLinThreadSolver.end_mutex);
-    } 
-  return NULL;
-}
-
-
-
-
-
-
-
@@ -18,8 +18,8 @@
 **                                                                    **
 ** ****************************************************************** */
                                                                         
-// $Revision: 1.1.1.1 $
-// $Date: 2000-09-15 08:23:29 $
+// $Revision: 1.2 $
+// $Date: 2026-10-14 00:00:00 $
 // $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/bandSPD/BandSPDLinThreadSolver.h,v $
                                                                         
                                                                         
@@ -30,8 +30,9 @@
 // Revision: A
 //
 // Description: This file contains the class definition for 
-// BandSPDLinThreadSolver. It solves the BandSPDLinSOE in parallel
-// using solaris threads.
+// BandSPDLinThreadSolver. It solves the BandSPDLinSOE in parallel,
+// factoring it a block row at a time with the threads set with the threads
+// command, and then uses LAPACK dpbtrs for the substitution.
 //
 // What: "@(#) BandSPDLinThreadSolver.h, revA"
 
@@ -44,20 +45,21 @@ class BandSPDLinThreadSolver : public BandSPDLinSolver
 {
   public:
     BandSPDLinThreadSolver();    
-    BandSPDLinThreadSolver(int numProcessors, int blockSize);        
+    BandSPDLinThreadSolver(int blockSize);        
     ~BandSPDLinThreadSolver();
 
     int solve(void);
     int setSize(void);
     
-    int sendSelf(Channel &theChannel, FEM_ObjectBroker &theBroker);
-    int recvSelf(Channel &theChannel, FEM_ObjectBroker &theBroker);    
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, 
+		 FEM_ObjectBroker &theBroker);
     
   protected:
 
   private:
-    int NP;
-    int running;
+    int factor(void);
+
     int blockSize;
 };
 
@@ -106,6 +106,12 @@ DiagonalSOE::getNumEqn(void) const
   return size;
 }
 
+size_t
+DiagonalSOE::getNumBytes(void)
+{
+  return size*sizeof(double) + this->LinearSOE::getNumBytes();
+}
+
 int 
 DiagonalSOE::setSize(Graph &theGraph)
 {
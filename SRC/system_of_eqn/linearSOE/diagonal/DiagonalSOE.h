@@ -48,6 +48,7 @@ class DiagonalSOE : public LinearSOE
     ~DiagonalSOE();
 
     int getNumEqn(void) const;
+    size_t getNumBytes(void);
     int setSize(Graph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, double fact = 1.0);    
@@ -46,13 +46,18 @@
 #include <FE_EleIter.h>
 #include <DOF_GrpIter.h>
 
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 
 DistributedDiagonalSOE::DistributedDiagonalSOE(DistributedDiagonalSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_DistributedDiagonalSOE),
  size(0), A(0), B(0), X(0), vectX(0), vectB(0), isAfactored(false),
  processID(0), numProcesses(0),
  numChannels(0), theChannels(0), localCol(0), 
- myDOFs(0,32), myDOFsShared(0,16), numShared(0), dataShared(0), vectShared(0), theModel(0)
+ myDOFs(0,32), myDOFsShared(0,16), numShared(0), dataShared(0), vectShared(0), theModel(0),
+ numNeighbors(-1), neighbors(0), neighborStart(0), haloLocs(0), haloSend(0), haloRecv(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -62,7 +67,8 @@ DistributedDiagonalSOE::DistributedDiagonalSOE()
  size(0), A(0), B(0), X(0), vectX(0), vectB(0), isAfactored(false),
  processID(0), numProcesses(0),
  numChannels(0), theChannels(0), localCol(0), 
- myDOFs(0,32), myDOFsShared(0,16), numShared(0), dataShared(0), vectShared(0), theModel(0)
+ myDOFs(0,32), myDOFsShared(0,16), numShared(0), dataShared(0), vectShared(0), theModel(0),
+ numNeighbors(-1), neighbors(0), neighborStart(0), haloLocs(0), haloSend(0), haloRecv(0)
 {
 
 }
@@ -78,6 +84,12 @@ DistributedDiagonalSOE::~DistributedDiagonalSOE()
   if (vectB != 0) delete vectB;    
   if (vectShared != 0) delete vectShared;    
 
+  if (neighbors != 0) delete [] neighbors;
+  if (neighborStart != 0) delete [] neighborStart;
+  if (haloLocs != 0) delete [] haloLocs;
+  if (haloSend != 0) delete [] haloSend;
+  if (haloRecv != 0) delete [] haloRecv;
+
   if (theChannels != 0)
     delete [] theChannels;
 }
@@ -103,10 +115,13 @@ DistributedDiagonalSOE::setSize(Graph &theGraph)
   myDOFs.resize(size);
 
   int count = 0;
+  bool isOrdered = true;
   Vertex *theVertex;
   VertexIter &theVertices = theGraph.getVertices();
   while ((theVertex = theVertices()) != 0) {
     int vertexTag = theVertex->getTag();
+    if (count > 0 && vertexTag <= myDOFs(count-1))
+      isOrdered = false;
     myDOFs(count) = vertexTag;
     count++;
   }
@@ -114,7 +129,35 @@ DistributedDiagonalSOE::setSize(Graph &theGraph)
   static ID otherSize(1);
   ID otherDOFS(0, size/10);
 
-  if (processID != 0) {
+  //
+  // without channels, i.e. in OpenSeesMP, each process only exchanges with
+  // the processes it shares dofs with
+  //
+
+  bool useHalo = false;
+#ifdef _PARALLEL_INTERPRETERS
+  if (numChannels == 0) {
+    int mpiInitialized = 0;
+    MPI_Initialized(&mpiInitialized);
+    if (mpiInitialized) {
+      int np = 1;
+      MPI_Comm_size(MPI_COMM_WORLD, &np);
+      useHalo = (np > 1);
+    }
+  }
+#endif
+
+  numNeighbors = -1;
+
+  if (useHalo) {
+
+    numShared = 0;
+    if (this->setHalo() < 0) {
+      opserr << "WARNING DistributedDiagonalSOE::setSize - failed to find the shared dofs\n";
+      return -1;
+    }
+
+  } else if (processID != 0) {
 
     //
     // each process send it's local and receives all other processes IDs (remote IDs).
@@ -249,6 +292,7 @@ DistributedDiagonalSOE::setSize(Graph &theGraph)
   if (dataShared != 0) delete [] dataShared; dataShared = 0;
   if (vectX != 0) delete vectX; vectX = 0;
   if (vectB != 0) delete vectB; vectB = 0;
+  if (vectShared != 0) delete vectShared; vectShared = 0;
 
   A = new double[size];
   B = new double[size];
@@ -298,7 +342,7 @@ DistributedDiagonalSOE::setSize(Graph &theGraph)
 	for (int i=0; i<theID.Size(); i++) {
 	  int dof = theID(i);
 	  if (dof >= 0) {
-	    int newDOF = myDOFs.getLocation(dof);
+	    int newDOF = isOrdered ? myDOFs.getLocationOrdered(dof) : myDOFs.getLocation(dof);
 	    dofPtr->setID(i, newDOF);
 	  }
 	}   
@@ -658,3 +702,191 @@ DistributedDiagonalSOE::setAnalysisModel(AnalysisModel &theAnalysisModel)
   theModel = &theAnalysisModel;
   return 0;
 }
+
+
+bool
+DistributedDiagonalSOE::usesHalo(void) const
+{
+  return (numNeighbors >= 0);
+}
+
+
+#ifdef _PARALLEL_INTERPRETERS
+// triples ordered by their first two ints: (dof, process, equation) in the
+// directory and (neighbour, dof, equation) in the halo
+static int
+compareHaloEntries(const void *a, const void *b)
+{
+  const int *entryA = (const int *)a;
+  const int *entryB = (const int *)b;
+  if (entryA[0] != entryB[0])
+    return (entryA[0] < entryB[0]) ? -1 : 1;
+  if (entryA[1] != entryB[1])
+    return (entryA[1] < entryB[1]) ? -1 : 1;
+  return 0;
+}
+#endif
+
+
+// int setHalo(void)
+// Finds the processes this one shares dofs with without any process seeing all
+// the dofs: each dof, with its local equation, is sent to a directory on process
+// dof % np, which tells every holder of a dof held by several processes who the
+// others are. The entries shared with each neighbour are kept in the order of
+// their dofs, the same order the neighbour keeps them in, so solve() can send
+// and receive them without any tags.
+
+int
+DistributedDiagonalSOE::setHalo(void)
+{
+#ifdef _PARALLEL_INTERPRETERS
+  int np = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &np);
+
+  if (neighbors != 0) delete [] neighbors; neighbors = 0;
+  if (neighborStart != 0) delete [] neighborStart; neighborStart = 0;
+  if (haloLocs != 0) delete [] haloLocs; haloLocs = 0;
+  if (haloSend != 0) delete [] haloSend; haloSend = 0;
+  if (haloRecv != 0) delete [] haloRecv; haloRecv = 0;
+  numNeighbors = 0;
+
+  int *counts = new int[5*np];
+  int *sendCounts = counts;
+  int *sendDispls = counts + np;
+  int *recvCounts = counts + 2*np;
+  int *recvDispls = counts + 3*np;
+  int *position = counts + 4*np;
+
+  //
+  // send each dof and its local equation to its directory
+  //
+
+  for (int p=0; p<np; p++)
+    sendCounts[p] = 0;
+  for (int i=0; i<size; i++)
+    sendCounts[myDOFs(i) % np] += 2;
+
+  MPI_Alltoall(sendCounts, 1, MPI_INT, recvCounts, 1, MPI_INT, MPI_COMM_WORLD);
+
+  int numSend = 0;
+  int numRecv = 0;
+  for (int p=0; p<np; p++) {
+    sendDispls[p] = numSend;
+    position[p] = numSend;
+    numSend += sendCounts[p];
+    recvDispls[p] = numRecv;
+    numRecv += recvCounts[p];
+  }
+
+  int *sendData = new int[numSend+1];
+  for (int i=0; i<size; i++) {
+    int p = myDOFs(i) % np;
+    sendData[position[p]++] = myDOFs(i);
+    sendData[position[p]++] = i;
+  }
+
+  int *recvData = new int[numRecv+1];
+  MPI_Alltoallv(sendData, sendCounts, sendDispls, MPI_INT,
+		recvData, recvCounts, recvDispls, MPI_INT, MPI_COMM_WORLD);
+
+  int numEntries = numRecv/2;
+  int *entries = new int[3*numEntries+1];
+  for (int p=0; p<np; p++) {
+    for (int k=recvDispls[p]; k<recvDispls[p]+recvCounts[p]; k+=2) {
+      int *entry = entries + 3*(k/2);
+      entry[0] = recvData[k];
+      entry[1] = p;
+      entry[2] = recvData[k+1];
+    }
+  }
+  qsort(entries, numEntries, 3*sizeof(int), compareHaloEntries);
+
+  //
+  // tell each holder of a dof held by m processes about the m-1 others
+  //
+
+  for (int p=0; p<np; p++)
+    sendCounts[p] = 0;
+  for (int first=0; first<numEntries; ) {
+    int last = first+1;
+    while (last < numEntries && entries[3*last] == entries[3*first])
+      last++;
+    for (int j=first; j<last; j++)
+      sendCounts[entries[3*j+1]] += 3*(last-first-1);
+    first = last;
+  }
+
+  MPI_Alltoall(sendCounts, 1, MPI_INT, recvCounts, 1, MPI_INT, MPI_COMM_WORLD);
+
+  numSend = 0;
+  numRecv = 0;
+  for (int p=0; p<np; p++) {
+    sendDispls[p] = numSend;
+    position[p] = numSend;
+    numSend += sendCounts[p];
+    recvDispls[p] = numRecv;
+    numRecv += recvCounts[p];
+  }
+
+  delete [] sendData;
+  sendData = new int[numSend+1];
+  for (int first=0; first<numEntries; ) {
+    int last = first+1;
+    while (last < numEntries && entries[3*last] == entries[3*first])
+      last++;
+    for (int j=first; j<last; j++) {
+      int p = entries[3*j+1];
+      for (int l=first; l<last; l++) {
+	if (l != j) {
+	  sendData[position[p]++] = entries[3*l+1];
+	  sendData[position[p]++] = entries[3*j];
+	  sendData[position[p]++] = entries[3*j+2];
+	}
+      }
+    }
+    first = last;
+  }
+
+  delete [] recvData;
+  recvData = new int[numRecv+1];
+  MPI_Alltoallv(sendData, sendCounts, sendDispls, MPI_INT,
+		recvData, recvCounts, recvDispls, MPI_INT, MPI_COMM_WORLD);
+
+  //
+  // group the shared entries by neighbour, in the order of their dofs
+  //
+
+  int numHalo = numRecv/3;
+  qsort(recvData, numHalo, 3*sizeof(int), compareHaloEntries);
+
+  for (int k=0; k<numHalo; k++)
+    if (k == 0 || recvData[3*k] != recvData[3*k-3])
+      numNeighbors++;
+
+  neighbors = new int[numNeighbors+1];
+  neighborStart = new int[numNeighbors+1];
+  haloLocs = new int[numHalo+1];
+  haloSend = new double[2*numHalo+1];
+  haloRecv = new double[2*numHalo+1];
+
+  int numFound = 0;
+  for (int k=0; k<numHalo; k++) {
+    if (k == 0 || recvData[3*k] != recvData[3*k-3]) {
+      neighbors[numFound] = recvData[3*k];
+      neighborStart[numFound] = k;
+      numFound++;
+    }
+    haloLocs[k] = recvData[3*k+2];
+  }
+  neighborStart[numNeighbors] = numHalo;
+
+  delete [] counts;
+  delete [] sendData;
+  delete [] recvData;
+  delete [] entries;
+
+  return 0;
+#else
+  return -1;
+#endif
+}
@@ -27,7 +27,9 @@
 //
 // Description: This file contains the class definition for DistributedDiagonalSOE
 // DistributedDiagonalSOE is a subclass of LinearSOE. It stores a diagonal system
-// of equation, i.e. just the diagonal
+// of equation, i.e. just the diagonal. In OpenSeesMP, where there are no channels,
+// the processes sharing a dof are found through a directory and the shared
+// A and B entries are summed by an exchange with the neighbouring processes only.
 
 // What: "@(#) DistributedDiagonalSOE.h, revA"
 
@@ -72,11 +74,13 @@ class DistributedDiagonalSOE : public LinearSOE
     int setChannels(int nChannels, Channel **theC);
 
     int setAnalysisModel(AnalysisModel &theModel);
+    bool usesHalo(void) const;
 
     friend class DistributedDiagonalSolver;
     
   protected:
-    
+    int setHalo(void);
+
   private:
     int size;
     double *A, *B, *X;
@@ -96,6 +100,15 @@ class DistributedDiagonalSOE : public LinearSOE
     double *dataShared;
     Vector *vectShared;
     AnalysisModel *theModel;
+
+    // the halo exchange of OpenSeesMP: the entries shared with neighbour i, in
+    // the order of their dofs, are haloLocs[neighborStart[i]] to [neighborStart[i+1]-1]
+    int numNeighbors;        // -1 if the shared entries go through P0
+    int *neighbors;          // MPI rank of each neighbour
+    int *neighborStart;
+    int *haloLocs;           // local equation of each shared entry
+    double *haloSend;        // A & B of each shared entry
+    double *haloRecv;
 };
 
 
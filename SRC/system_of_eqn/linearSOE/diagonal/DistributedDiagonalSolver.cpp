@@ -31,6 +31,10 @@
 #include <DistributedDiagonalSOE.h>
 #include <Channel.h>
 
+#ifdef _PARALLEL_INTERPRETERS
+#include <mpi.h>
+#endif
+
 DistributedDiagonalSolver::DistributedDiagonalSolver(int classTag)
 :LinearSOESolver(classTag),
  theSOE(0), minDiagTol(0.0)
@@ -84,6 +88,50 @@ DistributedDiagonalSolver::solve(void)
   double *dataShared = theSOE->dataShared;
   Vector *vectShared = theSOE->vectShared;
 
+  //
+  // in OpenSeesMP add the neighbours' contributions to the shared entries
+  //
+
+  if (theSOE->usesHalo()) {
+#ifdef _PARALLEL_INTERPRETERS
+    int numNeighbors = theSOE->numNeighbors;
+    int *neighbors = theSOE->neighbors;
+    int *neighborStart = theSOE->neighborStart;
+    int *haloLocs = theSOE->haloLocs;
+    double *haloSend = theSOE->haloSend;
+    double *haloRecv = theSOE->haloRecv;
+    int numHalo = neighborStart[numNeighbors];
+
+    for (int k=0; k<numHalo; k++) {
+      haloSend[2*k] = A[haloLocs[k]];
+      haloSend[2*k+1] = B[haloLocs[k]];
+    }
+
+    MPI_Request *requests = new MPI_Request[2*numNeighbors+1];
+    for (int i=0; i<numNeighbors; i++) {
+      int start = 2*neighborStart[i];
+      int count = 2*(neighborStart[i+1]-neighborStart[i]);
+      MPI_Irecv(haloRecv+start, count, MPI_DOUBLE, neighbors[i], 0, MPI_COMM_WORLD, &requests[i]);
+      MPI_Isend(haloSend+start, count, MPI_DOUBLE, neighbors[i], 0, MPI_COMM_WORLD, &requests[numNeighbors+i]);
+    }
+    MPI_Waitall(2*numNeighbors, requests, MPI_STATUSES_IGNORE);
+    delete [] requests;
+
+    for (int k=0; k<numHalo; k++) {
+      A[haloLocs[k]] += haloRecv[2*k];
+      B[haloLocs[k]] += haloRecv[2*k+1];
+    }
+
+    for (int i=0; i<size; i++) {
+      X[i] = B[i]/A[i];
+    }
+
+    return 0;
+#else
+    return -1;
+#endif
+  }
+
   //
   // first copy A & B contributions to sharedData
   //
@@ -139,6 +139,35 @@ FullGenLinLapackSolver::solve(void)
 }
 
 
+int
+FullGenLinLapackSolver::solveMultiple(int numRHS, double *BX)
+{
+    // substitution with the factors of the last solve()
+    if (theSOE == 0 || theSOE->factored == false ||
+	theSOE->getClassTag() != LinSOE_TAGS_FullGenLinSOE)
+	return -1;
+
+    int n = theSOE->size;
+    int ldA = n;
+    int ldB = n;
+    int info;
+    char trans[] = "N";
+
+#ifdef _WIN32
+    DGETRS(trans, &n,&numRHS,theSOE->A,&ldA,iPiv,BX,&ldB,&info);
+#else
+    dgetrs_(trans, &n,&numRHS,theSOE->A,&ldA,iPiv,BX,&ldB,&info);
+#endif
+
+    if (info != 0) {
+	opserr << "WARNING FullGenLinLapackSolver::solveMultiple()";
+	opserr << " - lapack solver failed - " << info << " returned\n";
+	return -1;
+    }
+    return 0;
+}
+
+
 int
 FullGenLinLapackSolver::setSize()
 {
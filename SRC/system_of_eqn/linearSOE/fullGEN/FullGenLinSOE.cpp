@@ -129,9 +129,17 @@ FullGenLinSOE::getNumEqn(void) const
     return size;
 }
 
+size_t
+FullGenLinSOE::getNumBytes(void)
+{
+    return Asize*sizeof(double) + this->LinearSOE::getNumBytes();
+}
+
 int 
 FullGenLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
+
     int result = 0;
     int oldSize = size;
     size = theGraph.getNumVertex();
@@ -379,6 +387,19 @@ FullGenLinSOE::zeroA(void)
 
     factored = false;
 }
+
+int
+FullGenLinSOE::saveA(void)
+{
+    return this->copyToBaseA(A, size*size);
+}
+
+int
+FullGenLinSOE::restoreA(void)
+{
+    factored = false;
+    return this->copyFromBaseA(A, size*size);
+}
 	
 void 
 FullGenLinSOE::zeroB(void)
@@ -61,6 +61,9 @@ class FullGenLinSOE : public LinearSOE
     
     void zeroA(void);
     void zeroB(void);
+    int saveA(void);
+    int restoreA(void);
+    size_t getNumBytes(void);
     
     int formAp(const Vector &p, Vector &Ap);
 
@@ -87,6 +87,9 @@ MumpsParallelSOE::setSize(Graph &theGraph)
   int newNNZ = 0;
   size = theGraph.getNumVertex();
   int mySize = size;
+
+  // any existing scatter map is no longer valid
+  theScatter.clear();
   //opserr << "MumpsParallelSOE: size : " << size << endln;
 
   VertexIter &theVertices = theGraph.getVertices();
@@ -299,6 +302,10 @@ MumpsParallelSOE::setSize(Graph &theGraph)
       colA[count++] = i;
   }
 
+  // build the scatter map for the local FE_Elements; each process assembles
+  // its own triplets, which MUMPS sums as distributed assembled input
+  this->formScatter();
+
   LinearSOESolver *theSolvr = this->getSolver();
 
   int solverOK = theSolvr->setSize();
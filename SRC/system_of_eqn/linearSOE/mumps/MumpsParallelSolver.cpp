@@ -37,6 +37,7 @@
 #define ICNTL(I) icntl[(I)-1] /* macro s.t. indices match documentation */
 
 #include <mpi.h>
+#include <string.h>
 
 MumpsParallelSolver::MumpsParallelSolver(int ICNTL7, int ICNTL14)
   :LinearSOESolver(SOLVER_TAGS_MumpsParallelSolver),
@@ -44,6 +45,9 @@ MumpsParallelSolver::MumpsParallelSolver(int ICNTL7, int ICNTL14)
 {
   icntl7 = ICNTL7;
   icntl14 = ICNTL14;
+  icntl22 = 0;
+  icntl23 = 0;
+  oocTmpDir[0] = '\0';
   init = false;
 }
 
@@ -53,6 +57,9 @@ MumpsParallelSolver::MumpsParallelSolver(int mpi_comm, int ICNTL7, int ICNTL14)
 {
   icntl14 = ICNTL14;
   icntl7 = ICNTL7;
+  icntl22 = 0;
+  icntl23 = 0;
+  oocTmpDir[0] = '\0';
   init = false;
 }
 
@@ -84,6 +91,12 @@ MumpsParallelSolver::solve(void)
 
   id.ICNTL(14)=icntl14; 
   id.ICNTL(7)=icntl7; 
+
+  // out-of-core factors
+  id.ICNTL(22)=icntl22;
+  id.ICNTL(23)=icntl23;
+  if (oocTmpDir[0] != '\0')
+    strcpy(id.ooc_tmpdir, oocTmpDir);
   
   // increment row and col A values by 1 for mumps fortran indexing
   for (int i=0; i<nnz; i++) {
@@ -201,6 +214,12 @@ MumpsParallelSolver::setSize()
 
   id.ICNTL(14)=icntl14; 
   id.ICNTL(7)=icntl7; 
+
+  // out-of-core factors
+  id.ICNTL(22)=icntl22;
+  id.ICNTL(23)=icntl23;
+  if (oocTmpDir[0] != '\0')
+    strcpy(id.ooc_tmpdir, oocTmpDir);
   
   int nnz = theMumpsSOE->nnz;
   int *colA = theMumpsSOE->colA;
@@ -243,10 +262,12 @@ int
 MumpsParallelSolver::sendSelf(int cTag, Channel &theChannel)
 {
   // nothing to do
-  ID icntlData(2);
+  ID icntlData(4);
 
   icntlData(0) = icntl7;  
   icntlData(1) = icntl14;
+  icntlData(2) = icntl22;
+  icntlData(3) = icntl23;
   theChannel.sendID(0, cTag, icntlData);
 
   return 0;
@@ -258,12 +279,36 @@ MumpsParallelSolver::recvSelf(int ctag,
 		      FEM_ObjectBroker &theBroker)
 {
   // nothing to do
-  ID icntlData(2);
+  ID icntlData(4);
 
   theChannel.recvID(0, ctag, icntlData);
 
   icntl7 = icntlData(0);
   icntl14 = icntlData(1);
+  icntl22 = icntlData(2);
+  icntl23 = icntlData(3);
+  return 0;
+}
+
+// int setOutOfCore(const char *tmpDir, int maxMemory)
+// Has MUMPS write the factors to files in tmpDir, or in the directory of the
+// MUMPS_OOC_TMPDIR environment variable if tmpDir is 0, keeping only the working
+// memory in RAM, at most maxMemory MB on each process if maxMemory > 0. The
+// directory is not sent in sendSelf(), remote processes use the environment's.
+
+int
+MumpsParallelSolver::setOutOfCore(const char *tmpDir, int maxMemory)
+{
+  icntl22 = 1;
+  icntl23 = maxMemory;
+  oocTmpDir[0] = '\0';
+  if (tmpDir != 0) {
+    if (strlen(tmpDir) >= sizeof(oocTmpDir)) {
+      opserr << "WARNING MumpsParallelSolver::setOutOfCore() - directory name " << tmpDir << " too long\n";
+      return -1;
+    }
+    strcpy(oocTmpDir, tmpDir);
+  }
   return 0;
 }
 
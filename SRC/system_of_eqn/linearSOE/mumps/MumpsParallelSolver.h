@@ -71,6 +71,7 @@ class MumpsParallelSolver : public LinearSOESolver
   int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
 
   int setLinearSOE(MumpsParallelSOE &theSOE);
+  int setOutOfCore(const char *tmpDir = 0, int maxMemory = 0);
 
  protected:
 
@@ -82,6 +83,9 @@ class MumpsParallelSolver : public LinearSOESolver
   int np;
   int icntl14;
   int icntl7;
+  int icntl22;              // 1 to keep the factors out-of-core
+  int icntl23;              // working memory of each process in MB, 0 for MUMPS's estimate
+  char oocTmpDir[256];      // where the factors go, MUMPS_OOC_TMPDIR if empty
 
   DMUMPS_STRUC_C id;
 };
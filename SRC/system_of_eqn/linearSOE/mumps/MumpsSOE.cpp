@@ -115,6 +115,9 @@ MumpsSOE::setSize(Graph &theGraph)
   int result = 0;
   int oldSize = size;
   size = theGraph.getNumVertex();
+
+  // any existing scatter map is no longer valid
+  theScatter.clear();
   
   // fist itearte through the vertices of the graph to get nnz
   Vertex *theVertex;
@@ -278,6 +281,9 @@ MumpsSOE::setSize(Graph &theGraph)
   for (int i=0; i<size; i++)
     for (int k=colStartA[i]; k<colStartA[i+1]; k++)
       colA[count++] = i;
+
+  // build the scatter map for the FE_Elements of the model
+  this->formScatter();
   
   // invoke setSize() on the Solver    
   LinearSOESolver *the_Solver = this->getSolver();
@@ -307,6 +313,27 @@ MumpsSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
 
+    // if id is that of an FE_Element in the scatter map use it
+    const int *locPtr = theScatter.find(id);
+    if (locPtr != 0) {
+      if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *locPtr++;
+	    if (loc >= 0)
+	      A[loc] += m(j,i);
+	  }
+      } else {
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *locPtr++;
+	    if (loc >= 0)
+	      A[loc] += fact * m(j,i);
+	  }
+      }
+      return 0;
+    }
+
     if (matType != 0) {
 
       if (fact == 1.0) { // do not need to multiply 
@@ -474,6 +501,15 @@ MumpsSOE::zeroA(void)
 	*Aptr++ = 0;
 
     factored = false;
+    theScatter.restart();
+}
+
+int
+MumpsSOE::domainChanged(void)
+{
+    // the sparsity is unchanged but the FE_Elements are new
+    this->formScatter();
+    return this->LinearSOE::domainChanged();
 }
 	
 void 
@@ -530,6 +566,16 @@ MumpsSOE::normRHS(void)
     
 }    
 
+// int formScatter(void)
+//	forms the scatter map for the FE_Elements of the model, rowA holds
+//	the lower triangle only if A is symmetric.
+
+int
+MumpsSOE::formScatter(void)
+{
+    return theScatter.form(theModel, size, colStartA, rowA, false, matType != 0);
+}
+
 int 
 MumpsSOE::sendSelf(int cTag, Channel &theChannel)
 {
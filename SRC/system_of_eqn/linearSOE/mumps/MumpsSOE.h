@@ -45,6 +45,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 class MumpsSolver;
 class MumpsParallelSolver;
@@ -67,6 +68,7 @@ class MumpsSOE : public LinearSOE
     virtual int setB(const Vector &, double fact = 1.0);        
     
     virtual void zeroA(void);
+    virtual int domainChanged(void);
     virtual void zeroB(void);
     
     virtual const Vector &getX(void);
@@ -94,6 +96,9 @@ class MumpsSOE : public LinearSOE
     bool factored;
     int matType;
 
+    int formScatter(void);
+    ScatterMap theScatter;  // built in setSize(), so that addA() does not search rowA
+
   private:
 };
 
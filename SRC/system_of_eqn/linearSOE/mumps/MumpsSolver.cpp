@@ -36,11 +36,13 @@
 #define ICNTL(I) icntl[(I)-1] /* macro s.t. indices match documentation */
 
 #include <mpi.h>
+#include <string.h>
 
 MumpsSolver::MumpsSolver(int ICNTL7, int ICNTL14)
   :LinearSOESolver(SOLVER_TAGS_MumpsSolver),
-   theMumpsSOE(0)
+   theMumpsSOE(0), icntl14(ICNTL14), icntl7(ICNTL7), icntl22(0), icntl23(0)
 {
+  oocTmpDir[0] = '\0';
   init = false;
   id.job=-1; 
   id.par=1; 
@@ -98,6 +100,15 @@ MumpsSolver::solve(void)
 
     // No outputs 
     id.ICNTL(1)=-1; id.ICNTL(2)=-1; id.ICNTL(3)=-1; id.ICNTL(4)=0;
+
+    // the options, reset to MUMPS's defaults when the instance was initialized
+    id.ICNTL(14)=icntl14;
+    id.ICNTL(7)=icntl7;
+    id.ICNTL(22)=icntl22;
+    id.ICNTL(23)=icntl23;
+    if (oocTmpDir[0] != '\0')
+      strcpy(id.ooc_tmpdir, oocTmpDir);
+
     // Call the MUMPS package to factor & solve the system
     id.job = 5;
     dmumps_c(&id);
@@ -190,7 +201,16 @@ MumpsSolver::setSize()
   
   // No outputs 
   id.ICNTL(1)=-1; id.ICNTL(2)=-1; id.ICNTL(3)=-1; id.ICNTL(4)=0;
-  // Call the MUMPS package to factor & solve the system
+
+  // the options, reset to MUMPS's defaults when the instance was initialized
+  id.ICNTL(14)=icntl14;
+  id.ICNTL(7)=icntl7;
+  id.ICNTL(22)=icntl22;
+  id.ICNTL(23)=icntl23;
+  if (oocTmpDir[0] != '\0')
+    strcpy(id.ooc_tmpdir, oocTmpDir);
+
+  // Call the MUMPS package to analyze the system
   id.job = 1;
   dmumps_c(&id);
 
@@ -225,6 +245,27 @@ MumpsSolver::recvSelf(int ctag,
   return 0;
 }
 
+// int setOutOfCore(const char *tmpDir, int maxMemory)
+// Has MUMPS write the factors to files in tmpDir, or in the directory of the
+// MUMPS_OOC_TMPDIR environment variable if tmpDir is 0, keeping only the working
+// memory in RAM, at most maxMemory MB if maxMemory > 0.
+
+int
+MumpsSolver::setOutOfCore(const char *tmpDir, int maxMemory)
+{
+  icntl22 = 1;
+  icntl23 = maxMemory;
+  oocTmpDir[0] = '\0';
+  if (tmpDir != 0) {
+    if (strlen(tmpDir) >= sizeof(oocTmpDir)) {
+      opserr << "WARNING MumpsSolver::setOutOfCore() - directory name " << tmpDir << " too long\n";
+      return -1;
+    }
+    strcpy(oocTmpDir, tmpDir);
+  }
+  return 0;
+}
+
 int 
 MumpsSolver::setLinearSOE(MumpsSOE &theSOE)
 {
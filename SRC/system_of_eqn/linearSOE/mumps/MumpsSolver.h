@@ -70,6 +70,7 @@ class MumpsSolver : public LinearSOESolver
   int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
 
   int setLinearSOE(MumpsSOE &theSOE);
+  int setOutOfCore(const char *tmpDir = 0, int maxMemory = 0);
 
  protected:
 
@@ -79,6 +80,9 @@ class MumpsSolver : public LinearSOESolver
   bool init;
   int icntl14;
   int icntl7;
+  int icntl22;              // 1 to keep the factors out-of-core
+  int icntl23;              // working memory of each process in MB, 0 for MUMPS's estimate
+  char oocTmpDir[256];      // where the factors go, MUMPS_OOC_TMPDIR if empty
 };
 
 #endif
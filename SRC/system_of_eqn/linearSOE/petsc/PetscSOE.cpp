@@ -45,7 +45,9 @@ PetscSOE::PetscSOE(PetscSolver &theSOESolver, int bs)
 :LinearSOE(theSOESolver, LinSOE_TAGS_PetscSOE),
  isFactored(0),size(0), processID(0), numProcesses(0), B(0), X(0), 
  indices(0), vectX(0), vectB(0), A(0), x(0), b(0), blockSize(bs),
- numChannels(0), theChannels(0), localCol(0)
+ numChannels(0), theChannels(0), localCol(0),
+ nnz(0), rowStartA(0), colA(0), valA(0),
+ rowsWork(0), valuesWork(0), sizeWork(0)
 {
   theSOESolver.setLinearSOE(*this);
 }
@@ -78,6 +80,14 @@ PetscSOE::~PetscSOE()
   if (A != 0) MatDestroy(A);
   if (b != 0) VecDestroy(b);
   if (x != 0) VecDestroy(x);
+
+  // the matrix used these
+  if (rowStartA != 0) delete [] rowStartA;
+  if (colA != 0) delete [] colA;
+  if (valA != 0) delete [] valA;
+
+  if (rowsWork != 0) delete [] rowsWork;
+  if (valuesWork != 0) delete [] valuesWork;
 }
 
 
@@ -148,6 +158,19 @@ PetscSOE::setSize(Graph &theGraph)
     if (A != 0) MatDestroy(A);
     if (b != 0) VecDestroy(b);
     if (x != 0) VecDestroy(x);
+    A = 0;
+    b = 0;
+    x = 0;
+
+    // and the storage the old matrix was built on
+    if (rowStartA != 0) delete [] rowStartA;
+    if (colA != 0) delete [] colA;
+    if (valA != 0) delete [] valA;
+    rowStartA = 0;
+    colA = 0;
+    valA = 0;
+    nnz = 0;
+    theScatter.clear();
     
     //
     // now we create the opensees vector objects
@@ -219,7 +242,39 @@ PetscSOE::setSize(Graph &theGraph)
       //      ierr = PetscOptionsGetInt(PETSC_NULL, "-n", &size, &flg); CHKERRQ(ierr);
       
       if (blockSize == 1) {
-	ierr = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 0, rowA, &A); CHKERRQ(ierr);
+
+	// our own row compressed storage, columns sorted in each row
+	rowStartA = new int[size+1];
+	colA = new int[NNZ];
+	valA = new double[NNZ];
+	rowStartA[0] = 0;
+	for (int a=0; a<size; a++) {
+	  Vertex *theVertex = theGraph.getVertexPtr(a);
+	  const ID &theAdjacency = theVertex->getAdjacency();
+	  int idSize = theAdjacency.Size();
+	  int start = rowStartA[a];
+	  int last = start;
+	  colA[last++] = a;
+	  for (int i=0; i<idSize; i++) {
+	    int col = theAdjacency(i);
+	    int k = last;
+	    while (k > start && colA[k-1] > col) {
+	      colA[k] = colA[k-1];
+	      k--;
+	    }
+	    colA[k] = col;
+	    last++;
+	  }
+	  rowStartA[a+1] = last;
+	}
+	nnz = NNZ;
+	for (int k=0; k<nnz; k++)
+	  valA[k] = 0.0;
+
+	ierr = MatCreateSeqAIJWithArrays(PETSC_COMM_SELF, size, size, rowStartA, colA, valA, &A); CHKERRQ(ierr);
+
+	theScatter.form(theModel, size, rowStartA, colA, true);
+
       } else {
 	ierr = MatCreateSeqBAIJ(PETSC_COMM_SELF, blockSize, size,size, 0, rowA, &A); CHKERRQ(ierr);
       }
@@ -286,25 +341,68 @@ PetscSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
     
-    int n = id.Size();
-    int row;
-    int col;
-    double value;
-    for (int i=0; i<n; i++) {
-      row = id(i);
-      if (row >= 0) {
-	for (int j=0; j<n; j++) {
-	  col = id(j);
-	  if (col >= 0) {
-	    value = m(i,j)*fact;
-	    int ierr = MatSetValues(A,1,&row,1,&col,&value,ADD_VALUES); 
-	    if (ierr) opserr << processID << " " << row << " " << col << endln; 
-	    CHKERRQ(ierr); 
+    if (valA != 0) {
+
+      // if id is that of an FE_Element in the scatter map use it
+      const int *locPtr = theScatter.find(id);
+      if (locPtr != 0) {
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *locPtr++;
+	    if (loc >= 0)
+	      valA[loc] += m(j,i)*fact;
 	  }
+	return 0;
+      }
+
+      // otherwise search the rows
+      for (int i=0; i<idSize; i++) {
+	int row = id(i);
+	if (row < 0 || row >= size)
+	  continue;
+	for (int j=0; j<idSize; j++) {
+	  int col = id(j);
+	  if (col < 0 || col >= size)
+	    continue;
+	  for (int k=rowStartA[row]; k<rowStartA[row+1]; k++)
+	    if (colA[k] == col) {
+	      valA[k] += m(i,j)*fact;
+	      break;
+	    }
 	}
       }
+      return 0;
+    }
+
+    return this->addValues(m, id, fact);
+}
+
+
+int
+PetscSOE::addValues(const Matrix &m, const ID &id, double fact)
+{
+    // the whole element in one MatSetValues call; PETSc ignores the
+    // negative (constrained) rows and columns and stashes the entries
+    // of rows owned by other processes until the assembly
+    int n = id.Size();
+    if (n > sizeWork) {
+      if (rowsWork != 0) delete [] rowsWork;
+      if (valuesWork != 0) delete [] valuesWork;
+      rowsWork = new int[n];
+      valuesWork = new double[n*n];
+      sizeWork = n;
+    }
+
+    for (int i=0; i<n; i++) {
+      rowsWork[i] = id(i);
+      for (int j=0; j<n; j++)
+	valuesWork[i*n+j] = m(i,j)*fact;
     }
 
+    int ierr = MatSetValues(A, n, rowsWork, n, rowsWork, valuesWork, ADD_VALUES); 
+    if (ierr) opserr << processID << " PetscSOE::addA() - MatSetValues failed\n"; 
+    CHKERRQ(ierr); 
+
     return 0;
 }
 
@@ -381,6 +479,16 @@ PetscSOE::zeroA(void)
 {
   isFactored = 0;
   MatZeroEntries(A);
+  theScatter.restart();
+}
+
+int
+PetscSOE::domainChanged(void)
+{
+  // the sparsity is unchanged but the FE_Elements are new, the map is
+  // empty unless A is built on our own storage
+  theScatter.form(theModel, size, rowStartA, colA, true);
+  return this->LinearSOE::domainChanged();
 }
 	
 void 
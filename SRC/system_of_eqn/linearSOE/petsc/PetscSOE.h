@@ -39,6 +39,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 //extern "C" {
 #include <petscksp.h>
@@ -61,6 +62,7 @@ class PetscSOE : public LinearSOE
     int setB(const Vector &, double fact = 1.0);        
 
     void zeroA(void);
+    int domainChanged(void);
     void zeroB(void);
 
     const Vector &getX(void);
@@ -103,6 +105,22 @@ class PetscSOE : public LinearSOE
     ID **localCol;
 
     int startRow, endRow;
+
+    int addValues(const Matrix &m, const ID &id, double fact);
+
+    // on a single process with blockSize 1 the matrix is built on our own
+    // row compressed storage (MatCreateSeqAIJWithArrays) and addA() adds
+    // into it directly; setSize() maps, for each FE_Element of the
+    // AnalysisModel, every entry of the element matrix to its location
+    int nnz;
+    int *rowStartA, *colA;
+    double *valA;
+    ScatterMap theScatter;
+
+    // otherwise addA() passes an element to MatSetValues in one call
+    int *rowsWork;
+    double *valuesWork;
+    int sizeWork;
 };
 
 
@@ -139,6 +139,8 @@ PetscSolver::solve(void)
   Vec &x = theSOE->x;
   Vec &b = theSOE->b;
 
+  // the relative tolerance may have been changed by setTolerance()
+  ierr = KSPSetTolerances(ksp, rTol, aTol, dTol, maxIts); CHKERRQ(ierr);
   ierr = KSPSolve(ksp, b, x); CHKERRQ(ierr); 
   theSOE->isFactored = 1;
 
@@ -220,6 +222,25 @@ PetscSolver::setSize()
 }
 
 
+int
+PetscSolver::setTolerance(double tol)
+{
+  rTol = tol;
+  return 0;
+}
+
+
+double
+PetscSolver::getTolerance(void)
+{
+  // the KSP default
+  if (rTol == PETSC_DEFAULT)
+    return 1.0e-5;
+
+  return rTol;
+}
+
+
 int 
 PetscSolver::setLinearSOE(PetscSOE &theSys)
 {
@@ -55,6 +55,8 @@ class PetscSolver : public LinearSOESolver
     int solve(void);
     int setSize(void);
     virtual int setLinearSOE(PetscSOE &theSOE);
+    int setTolerance(double tol);
+    double getTolerance(void);
     
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, 
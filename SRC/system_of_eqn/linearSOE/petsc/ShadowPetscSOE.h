@@ -56,6 +56,10 @@ class ShadowPetscSOE : public LinearSOE
 
     int solve(void);    
 
+    // the solve is not the one of LinearSOE, no low rank update
+
+    int setLowRankUpdate(const double *U, const double *d, int numCols) {return -1;}
+
     int getNumEqn(void) const;
     int setSize(Graph &theGraph);
     
@@ -54,6 +54,8 @@ class DistributedProfileSPDLinSOE : public ProfileSPDLinSOE
     void zeroB(void);
     int setSize(Graph &theGraph);
     int solve(void);
+    // the solve is not the one of LinearSOE, no low rank update
+    int setLowRankUpdate(const double *U, const double *d, int numCols) {return -1;}
     const Vector &getB(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
@@ -58,6 +58,12 @@ ProfileSPDLinDirectSolver::ProfileSPDLinDirectSolver(double tol)
 
 }
 
+ProfileSPDLinDirectSolver::ProfileSPDLinDirectSolver(int classTag, double tol)
+:ProfileSPDLinSolver(classTag),
+ minDiagTol(tol), size(0), RowTop(0), topRowPtr(0), invD(0)
+{
+
+}
     
 ProfileSPDLinDirectSolver::~ProfileSPDLinDirectSolver()
 {
@@ -60,6 +60,8 @@ class ProfileSPDLinDirectSolver : public ProfileSPDLinSolver
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
     
   protected:
+    ProfileSPDLinDirectSolver(int classTag, double tol);
+
     double minDiagTol;
     int size;
     int *RowTop;
@@ -18,8 +18,8 @@
 **                                                                    **
 ** ****************************************************************** */
                                                                         
-// $Revision: 1.1.1.1 $
-// $Date: 2000-09-15 08:23:30 $
+// $Revision: 1.2 $
+// $Date: 2026-10-14 00:00:00 $
 // $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h,v $
                                                                         
                                                                         
@@ -32,7 +32,8 @@
 // Description: This file contains the class definition for 
 // ProfileSPDLinDirectThreadSolver. ProfileSPDLinDirectThreadSolver is a subclass 
 // of LinearSOESOlver. It solves a ProfileSPDLinSOE object using
-// the LDL^t factorization.
+// the LDL^t factorization. The block rows of the factorization are formed
+// by the threads set with the threads command.
 
 // What: "@(#) ProfileSPDLinDirectThreadSolver.h, revA"
 
@@ -46,7 +47,7 @@ class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinSolver
 {
   public:
     ProfileSPDLinDirectThreadSolver();      
-    ProfileSPDLinDirectThreadSolver(int numProcessors, int blockSize, double tol);    
+    ProfileSPDLinDirectThreadSolver(int blockSize, double tol = 1.0e-12);    
     virtual ~ProfileSPDLinDirectThreadSolver();
 
     virtual int solve(void);        
@@ -59,9 +60,6 @@ class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinSolver
 		 FEM_ObjectBroker &theBroker);
 
   protected:
-    int NP;
-    int running;
-    
     double minDiagTol;
     int blockSize;
     int maxColHeight;
@@ -40,6 +40,13 @@
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
 
+#include <string.h>
+#include <stdio.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <iostream>
 using std::nothrow;
 
@@ -48,7 +55,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver)
 :LinearSOE(the_Solver, LinSOE_TAGS_ProfileSPDLinSOE),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), scratchDir(0), mappedSize(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -58,7 +65,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int classTag)
 :LinearSOE(classTag),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), scratchDir(0), mappedSize(0)
 {
 
 }
@@ -68,7 +75,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(ProfileSPDLinSolver &the_Solver, int classTag
 :LinearSOE(the_Solver, classTag),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0) 
+ numInt(0), scratchDir(0), mappedSize(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -79,7 +86,7 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int N, int *iLoc,
 :LinearSOE(the_Solver, LinSOE_TAGS_ProfileSPDLinSOE),
  size(0), profileSize(0), A(0), B(0), X(0), vectX(0), vectB(0),
  iDiagLoc(0), Asize(0), Bsize(0), isAfactored(false), isAcondensed(false),
- numInt(0)
+ numInt(0), scratchDir(0), mappedSize(0)
 {
     size = N;
     profileSize = iLoc[N-1];
@@ -133,7 +140,8 @@ ProfileSPDLinSOE::ProfileSPDLinSOE(int N, int *iLoc,
     
 ProfileSPDLinSOE::~ProfileSPDLinSOE()
 {
-    if (A != 0) delete [] A;
+    this->deleteA();
+    if (scratchDir != 0) delete [] scratchDir;
     if (B != 0) delete [] B;
     if (X != 0) delete [] X;
     if (iDiagLoc != 0) delete [] iDiagLoc;
@@ -142,15 +150,104 @@ ProfileSPDLinSOE::~ProfileSPDLinSOE()
 }
 
 
+// int setScratchDirectory(const char *dirName)
+// Out-of-core storage of A for nodes short of memory: from the next setSize() on,
+// A is mapped onto a scratch file in dirName, so that the parts of the skyline the
+// factorization is not working on are paged out to that file rather than the
+// machine swapping; the blocked and supernodal solvers sweep A in order, which
+// suits the paging.
+
+int
+ProfileSPDLinSOE::setScratchDirectory(const char *dirName)
+{
+#ifdef _WIN32
+    opserr << "WARNING ProfileSPDLinSOE::setScratchDirectory() - not available on Windows\n";
+    return -1;
+#else
+    if (scratchDir != 0)
+	delete [] scratchDir;
+    scratchDir = 0;
+    if (dirName != 0) {
+	scratchDir = new char[strlen(dirName)+1];
+	strcpy(scratchDir, dirName);
+    }
+    return 0;
+#endif
+}
+
+
+double *
+ProfileSPDLinSOE::newA(int n)
+{
+#ifndef _WIN32
+    if (scratchDir != 0) {
+	size_t numBytes = (size_t)n*sizeof(double);
+	char *fileName = new char[strlen(scratchDir)+32];
+	sprintf(fileName, "%s/ProfileSPD_XXXXXX", scratchDir);
+	int fd = mkstemp(fileName);
+	if (fd < 0) {
+	    opserr << "WARNING ProfileSPDLinSOE::setSize() - could not create a scratch file in ";
+	    opserr << scratchDir << endln;
+	    delete [] fileName;
+	    return 0;
+	}
+	// the file itself goes once A is unmapped
+	unlink(fileName);
+	delete [] fileName;
+
+	void *data = MAP_FAILED;
+	if (ftruncate(fd, numBytes) == 0)
+	    data = mmap(0, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED) {
+	    opserr << "WARNING ProfileSPDLinSOE::setSize() - could not map " << (double)numBytes;
+	    opserr << " bytes onto a scratch file in " << scratchDir << endln;
+	    return 0;
+	}
+	mappedSize = numBytes;
+	return (double *)data;
+    }
+#endif
+    return new (nothrow) double[n];
+}
+
+
+void
+ProfileSPDLinSOE::deleteA(void)
+{
+    if (A == 0)
+	return;
+#ifndef _WIN32
+    if (mappedSize != 0) {
+	munmap(A, mappedSize);
+	mappedSize = 0;
+	A = 0;
+	return;
+    }
+#endif
+    delete [] A;
+    A = 0;
+}
+
+
 int 
 ProfileSPDLinSOE::getNumEqn(void) const
 {
     return size;
 }
 
+size_t
+ProfileSPDLinSOE::getNumBytes(void)
+{
+    return Asize*sizeof(double) + (size+1)*sizeof(int) +
+	this->LinearSOE::getNumBytes();
+}
+
 int 
 ProfileSPDLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
+
     int oldSize = size;
     int result = 0;
     size = theGraph.getNumVertex();
@@ -215,11 +312,10 @@ ProfileSPDLinSOE::setSize(Graph &theGraph)
     if (profileSize > Asize) { 
 
 	// delete old space
-	if (A != 0)
-	    delete [] A;
+	this->deleteA();
 	
 	// get new space
-	A = new (nothrow) double[profileSize];
+	A = this->newA(profileSize);
 	
         if (A == 0) {
             opserr << "ProfileSPDLinSOE::ProfileSPDLinSOE :";
@@ -492,6 +588,19 @@ ProfileSPDLinSOE::zeroA(void)
     
     isAfactored = false;
 }
+
+int
+ProfileSPDLinSOE::saveA(void)
+{
+    return this->copyToBaseA(A, Asize);
+}
+
+int
+ProfileSPDLinSOE::restoreA(void)
+{
+    isAfactored = false;
+    return this->copyFromBaseA(A, Asize);
+}
 	
 void 
 ProfileSPDLinSOE::zeroB(void)
@@ -59,6 +59,9 @@ class ProfileSPDLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual size_t getNumBytes(void);
 
     virtual void setX(int loc, double value);
     virtual void setX(const Vector &x);
@@ -68,11 +71,13 @@ class ProfileSPDLinSOE : public LinearSOE
     virtual double normRHS(void);
 
     virtual int setProfileSPDSolver(ProfileSPDLinSolver &newSolver);    
+    int setScratchDirectory(const char *dirName);
     virtual int sendSelf(int commitTag, Channel &theChannel);
     virtual int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
 
     friend class ProfileSPDLinSolver;    
     friend class ProfileSPDLinDirectSolver;
+    friend class ProfileSPDLinSupernodeSolver;
     friend class ProfileSPDLinDirectBlockSolver;
     friend class ProfileSPDLinDirectThreadSolver;    
     friend class ProfileSPDLinDirectSkypackSolver;    
@@ -90,6 +95,11 @@ class ProfileSPDLinSOE : public LinearSOE
     int numInt;
     
   private:
+    double *newA(int n);
+    void deleteA(void);
+
+    char *scratchDir;         // A is mapped onto a file there if set
+    size_t mappedSize;        // bytes of the mapping, 0 if A is on the heap
 };
 
 
@@ -0,0 +1,449 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSupernodeSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for
+// ProfileSPDLinSupernodeSolver.
+
+// What: "@(#) ProfileSPDLinSupernodeSolver.C, revA"
+
+#include <ProfileSPDLinSupernodeSolver.h>
+#include <ProfileSPDLinSOE.h>
+#include <ProfileSPDLinDirectThreadSolver.h>
+#include <elementAPI.h>
+#include <math.h>
+#include <string.h>
+
+// panels narrower than this are factored column by column
+#define PANEL_MIN_WIDTH 4
+// rows of the columns above a panel are eliminated this many at a time
+#define PANEL_BLOCK_ROWS 64
+
+#ifdef _WIN32
+extern "C" int DGEMM(char *transA, char *transB, int *M, int *N, int *K,
+		     double *alpha, double *A, int *LDA, double *B, int *LDB,
+		     double *beta, double *C, int *LDC);
+
+extern "C" int DTRSM(char *side, char *uplo, char *transA, char *diag,
+		     int *M, int *N, double *alpha, double *A, int *LDA,
+		     double *B, int *LDB);
+#else
+extern "C" int dgemm_(char *transA, char *transB, int *M, int *N, int *K,
+		      double *alpha, double *A, int *LDA, double *B, int *LDB,
+		      double *beta, double *C, int *LDC);
+
+extern "C" int dtrsm_(char *side, char *uplo, char *transA, char *diag,
+		      int *M, int *N, double *alpha, double *A, int *LDA,
+		      double *B, int *LDB);
+#endif
+
+void* OPS_ProfileSPDLinSupernodeSolver()
+{
+    // system ProfileSPD <-column> <-thread blockSize?> <-oocDir dir>, -column for
+    // the column by column factorization, -thread for the threaded one, -oocDir
+    // to keep the skyline in a scratch file there
+    ProfileSPDLinSolver *theSolver = 0;
+    const char *scratchDir = 0;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *option = OPS_GetString();
+
+	if (strcmp(option, "-column") == 0 && theSolver == 0)
+	    theSolver = new ProfileSPDLinDirectSolver();
+	else if (strcmp(option, "-thread") == 0 && theSolver == 0) {
+	    int blockSize = 16;
+	    int numdata = 1;
+	    if (OPS_GetNumRemainingInputArgs() > 0) {
+		const char *next = OPS_GetString();
+		OPS_ResetCurrentInputArg(-1);
+		if (next[0] != '-' && OPS_GetIntInput(&numdata, &blockSize) < 0) {
+		    opserr << "WARNING system ProfileSPD -thread <blockSize?> - invalid blockSize\n";
+		    return 0;
+		}
+	    }
+	    theSolver = new ProfileSPDLinDirectThreadSolver(blockSize);
+	} else if (strcmp(option, "-oocDir") == 0 && OPS_GetNumRemainingInputArgs() > 0)
+	    scratchDir = OPS_GetString();
+    }
+    if (theSolver == 0)
+	theSolver = new ProfileSPDLinSupernodeSolver();
+
+    ProfileSPDLinSOE *theSOE = new ProfileSPDLinSOE(*theSolver);
+    if (scratchDir != 0 && theSOE->setScratchDirectory(scratchDir) < 0) {
+	delete theSOE;
+	return 0;
+    }
+    return theSOE;
+}
+
+
+ProfileSPDLinSupernodeSolver::ProfileSPDLinSupernodeSolver(double tol, int maxWidth)
+:ProfileSPDLinDirectSolver(SOLVER_TAGS_ProfileSPDLinSupernodeSolver, tol),
+ maxPanelWidth(maxWidth), numPanels(0), panelStart(0), panelTop(0),
+ work(0), sizeWork(0)
+{
+  if (maxPanelWidth < 1)
+    maxPanelWidth = 1;
+}
+
+
+ProfileSPDLinSupernodeSolver::~ProfileSPDLinSupernodeSolver()
+{
+  if (panelStart != 0) delete [] panelStart;
+  if (panelTop != 0) delete [] panelTop;
+  if (work != 0) delete [] work;
+}
+
+
+int
+ProfileSPDLinSupernodeSolver::setSize(void)
+{
+  int result = this->ProfileSPDLinDirectSolver::setSize();
+  if (result < 0 || theSOE == 0)
+    return result;
+
+  if (panelStart != 0) delete [] panelStart;
+  if (panelTop != 0) delete [] panelTop;
+  if (work != 0) delete [] work;
+  panelStart = 0;
+  panelTop = 0;
+  work = 0;
+  sizeWork = 0;
+  numPanels = 0;
+
+  size = theSOE->size;
+  if (size == 0)
+    return 0;
+
+  panelStart = new int[size+1];
+  panelTop = new int[size];
+
+  //
+  // group adjacent columns into panels; a column is added to a panel as
+  // long as the zeros the panel would hold above the tops of its columns
+  // are no more than a quarter of the profile entries in the panel
+  //
+
+  int firstCol = 0;
+  while (firstCol < size) {
+    int top = RowTop[firstCol];
+    double numStored = firstCol - top + 1;
+    int lastCol = firstCol;
+
+    while (lastCol+1 < size && lastCol+1-firstCol < maxPanelWidth) {
+      int nextCol = lastCol+1;
+      int nextTop = RowTop[nextCol];
+      if (nextTop > top)
+	nextTop = top;
+      double width = nextCol - firstCol + 1;
+      double nextStored = numStored + nextCol - RowTop[nextCol] + 1;
+      double nextDense = width*(firstCol - nextTop + 1) + width*(width-1)/2;
+      if (4.0*nextDense > 5.0*nextStored)
+	break;
+      lastCol = nextCol;
+      top = nextTop;
+      numStored = nextStored;
+    }
+
+    panelStart[numPanels] = firstCol;
+    panelTop[numPanels] = top;
+    numPanels++;
+
+    // work area: the panel, the scaled rows above it & a block of U above it
+    int width = lastCol - firstCol + 1;
+    if (width >= PANEL_MIN_WIDTH) {
+      int numAbove = firstCol - top;
+      int blockRows = (numAbove < PANEL_BLOCK_ROWS) ? numAbove : PANEL_BLOCK_ROWS;
+      int sizePanel = (lastCol-top+1)*width + numAbove*width + numAbove*blockRows;
+      if (sizePanel > sizeWork)
+	sizeWork = sizePanel;
+    }
+
+    firstCol = lastCol+1;
+  }
+  panelStart[numPanels] = size;
+
+  if (sizeWork != 0) {
+    work = new double[sizeWork];
+    if (work == 0) {
+      opserr << "WARNING ProfileSPDLinSupernodeSolver::setSize() - ";
+      opserr << " ran out of memory for a work area of size " << sizeWork << endln;
+      sizeWork = 0;
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+int
+ProfileSPDLinSupernodeSolver::solve(void)
+{
+  // check for quick returns
+  if (theSOE == 0) {
+    opserr << "ProfileSPDLinSupernodeSolver::solve(void): ";
+    opserr << " - No ProfileSPDSOE has been assigned\n";
+    return -1;
+  }
+
+  if (theSOE->size == 0)
+    return 0;
+
+  if (theSOE->isAfactored == false) {
+
+    // factor the panels in turn into U^t D U, storing D^-1 in invD
+    for (int i=0; i<numPanels; i++) {
+      int firstCol = panelStart[i];
+      int lastCol = panelStart[i+1]-1;
+
+      if (lastCol-firstCol+1 >= PANEL_MIN_WIDTH) {
+	if (this->factorPanel(firstCol, lastCol, panelTop[i]) < 0)
+	  return -2;
+      } else {
+	for (int j=firstCol; j<=lastCol; j++)
+	  if (this->factorColumn(j) < 0)
+	    return -2;
+      }
+    }
+
+    theSOE->isAfactored = true;
+    theSOE->numInt = 0;
+  }
+
+  // the forward & back substitution
+  return this->ProfileSPDLinDirectSolver::solve();
+}
+
+
+int
+ProfileSPDLinSupernodeSolver::factorColumn(int i)
+{
+  int rowitop = RowTop[i];
+  double *ajiPtr = topRowPtr[i];
+
+  for (int j=rowitop; j<i; j++) {
+    double tmp = *ajiPtr;
+    int rowjtop = RowTop[j];
+    double *akjPtr, *akiPtr;
+
+    if (rowitop > rowjtop) {
+      akjPtr = topRowPtr[j] + (rowitop-rowjtop);
+      akiPtr = topRowPtr[i];
+      for (int k=rowitop; k<j; k++)
+	tmp -= *akjPtr++ * *akiPtr++ ;
+    } else {
+      akjPtr = topRowPtr[j];
+      akiPtr = topRowPtr[i] + (rowjtop-rowitop);
+      for (int k=rowjtop; k<j; k++)
+	tmp -= *akjPtr++ * *akiPtr++ ;
+    }
+
+    *ajiPtr++ = tmp;
+  }
+
+  // now form i'th col of [U] and determine [dii]
+  double aii = theSOE->A[theSOE->iDiagLoc[i] -1]; // FORTRAN ARRAY INDEXING
+  ajiPtr = topRowPtr[i];
+
+  for (int jj=rowitop; jj<i; jj++) {
+    double aji = *ajiPtr;
+    double lij = aji * invD[jj];
+    *ajiPtr++ = lij;
+    aii = aii - lij*aji;
+  }
+
+  // check that the diag > the tolerance specified
+  if (aii == 0.0) {
+    opserr << "ProfileSPDLinSupernodeSolver::solve() - ";
+    opserr << " aii < 0 (i, aii): (" << i << ", " << aii << ")\n";
+    return -2;
+  }
+  if (fabs(aii) <= minDiagTol) {
+    opserr << "ProfileSPDLinSupernodeSolver::solve() - ";
+    opserr << " aii < minDiagTol (i, aii): (" << i;
+    opserr << ", " << aii << ")\n";
+    return -2;
+  }
+  invD[i] = 1.0/aii;
+
+  return 0;
+}
+
+
+int
+ProfileSPDLinSupernodeSolver::factorPanel(int firstCol, int lastCol, int topRow)
+{
+  //
+  // the panel holds rows topRow to lastCol of columns firstCol to lastCol;
+  // the numAbove rows above firstCol are those of the columns already
+  // factored that the panel depends on
+  //
+
+  int width = lastCol - firstCol + 1;
+  int numAbove = firstCol - topRow;
+  int numRows = lastCol - topRow + 1;
+
+  double *W = work;
+  double *UW = W + numRows*width;
+  double *E = UW + numAbove*width;
+
+  double one = 1.0;
+  double minusOne = -1.0;
+  char charN = 'N';
+  char charT = 'T';
+  char charL = 'L';
+  char charU = 'U';
+
+  // copy the panel into W (columns of numRows, zero above the tops)
+  for (int j=0; j<width; j++) {
+    int col = firstCol + j;
+    int rowTop = RowTop[col];
+    double *Wj = W + j*numRows;
+    for (int r=0; r<rowTop-topRow; r++)
+      Wj[r] = 0.0;
+    double *aPtr = topRowPtr[col];
+    for (int r=rowTop-topRow; r<=col-topRow; r++)
+      Wj[r] = *aPtr++;
+    for (int r=col-topRow+1; r<numRows; r++)
+      Wj[r] = 0.0;
+  }
+
+  //
+  // solve U(above,above)^t G = A(above,panel), a block of rows at a time:
+  // the block is first updated with the rows already solved (dgemm), then
+  // solved with the unit upper triangle of U in the block (dtrsm)
+  //
+
+  for (int row0=topRow; row0<firstCol; row0+=PANEL_BLOCK_ROWS) {
+    int row1 = row0 + PANEL_BLOCK_ROWS;
+    if (row1 > firstCol)
+      row1 = firstCol;
+    int numBlock = row1 - row0;
+    int ldE = row1 - topRow;
+    int numDone = row0 - topRow;
+
+    // E = U(topRow:row1-1, row0:row1-1)
+    for (int k=row0; k<row1; k++) {
+      double *Ek = E + (k-row0)*ldE;
+      int rowTop = RowTop[k];
+      int start = (rowTop > topRow) ? rowTop : topRow;
+      for (int r=0; r<start-topRow; r++)
+	Ek[r] = 0.0;
+      double *uPtr = topRowPtr[k] + (start-rowTop);
+      for (int r=start-topRow; r<k-topRow; r++)
+	Ek[r] = *uPtr++;
+      for (int r=k-topRow; r<ldE; r++)
+	Ek[r] = 0.0;
+    }
+
+    if (numDone > 0) {
+#ifdef _WIN32
+      DGEMM(&charT, &charN, &numBlock, &width, &numDone, &minusOne, E, &ldE,
+	    W, &numRows, &one, W+numDone, &numRows);
+#else
+      dgemm_(&charT, &charN, &numBlock, &width, &numDone, &minusOne, E, &ldE,
+	     W, &numRows, &one, W+numDone, &numRows);
+#endif
+    }
+
+#ifdef _WIN32
+    DTRSM(&charL, &charU, &charT, &charU, &numBlock, &width, &one, E+numDone, &ldE,
+	  W+numDone, &numRows);
+#else
+    dtrsm_(&charL, &charU, &charT, &charU, &numBlock, &width, &one, E+numDone, &ldE,
+	   W+numDone, &numRows);
+#endif
+  }
+
+  // U(above,panel) = D^-1 G and the panel update A -= U^t G
+  if (numAbove > 0) {
+    for (int j=0; j<width; j++) {
+      double *Wj = W + j*numRows;
+      double *UWj = UW + j*numAbove;
+      for (int r=0; r<numAbove; r++)
+	UWj[r] = Wj[r] * invD[topRow+r];
+    }
+
+#ifdef _WIN32
+    DGEMM(&charT, &charN, &width, &width, &numAbove, &minusOne, UW, &numAbove,
+	  W, &numRows, &one, W+numAbove, &numRows);
+#else
+    dgemm_(&charT, &charN, &width, &width, &numAbove, &minusOne, UW, &numAbove,
+	   W, &numRows, &one, W+numAbove, &numRows);
+#endif
+  }
+
+  // factor the dense diagonal block of the panel
+  for (int j=0; j<width; j++) {
+    double *Wj = W + j*numRows + numAbove;
+
+    for (int r=0; r<j; r++) {
+      double *Wr = W + r*numRows + numAbove;
+      double tmp = Wj[r];
+      for (int k=0; k<r; k++)
+	tmp -= Wr[k] * Wj[k];
+      Wj[r] = tmp;
+    }
+
+    double ajj = Wj[j];
+    for (int r=0; r<j; r++) {
+      double arj = Wj[r];
+      double lrj = arj * invD[firstCol+r];
+      Wj[r] = lrj;
+      ajj -= lrj*arj;
+    }
+
+    // check that the diag > the tolerance specified
+    int i = firstCol + j;
+    if (ajj == 0.0) {
+      opserr << "ProfileSPDLinSupernodeSolver::solve() - ";
+      opserr << " aii < 0 (i, aii): (" << i << ", " << ajj << ")\n";
+      return -2;
+    }
+    if (fabs(ajj) <= minDiagTol) {
+      opserr << "ProfileSPDLinSupernodeSolver::solve() - ";
+      opserr << " aii < minDiagTol (i, aii): (" << i;
+      opserr << ", " << ajj << ")\n";
+      return -2;
+    }
+    invD[i] = 1.0/ajj;
+  }
+
+  // copy U back into the profile, the diagonal is left as is
+  for (int j=0; j<width; j++) {
+    int col = firstCol + j;
+    int rowTop = RowTop[col];
+    double *aPtr = topRowPtr[col];
+    double *UWj = UW + j*numAbove;
+    double *Wj = W + j*numRows;
+    int r = rowTop;
+    for ( ; r<firstCol; r++)
+      *aPtr++ = UWj[r-topRow];
+    for ( ; r<col; r++)
+      *aPtr++ = Wj[r-topRow];
+  }
+
+  return 0;
+}
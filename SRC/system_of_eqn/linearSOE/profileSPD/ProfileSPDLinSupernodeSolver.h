@@ -0,0 +1,68 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSupernodeSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// ProfileSPDLinSupernodeSolver. ProfileSPDLinSupernodeSolver is a subclass
+// of ProfileSPDLinDirectSolver. It factors the ProfileSPDLinSOE into
+// U^t D U in place, like ProfileSPDLinDirectSolver, but groups adjacent
+// columns with (nearly) the same top row into panels. A panel is copied
+// into a dense work array, where the updates from the columns above it are
+// applied with the level 3 BLAS routines dtrsm and dgemm, and factored
+// before being copied back into the profile. As the profile is preserved by
+// the factorization, the zeros a panel picks up from columns with a lower
+// top row stay zero. Narrow panels are factored column by column.
+
+// What: "@(#) ProfileSPDLinSupernodeSolver.h, revA"
+
+#ifndef ProfileSPDLinSupernodeSolver_h
+#define ProfileSPDLinSupernodeSolver_h
+
+#include <ProfileSPDLinDirectSolver.h>
+
+class ProfileSPDLinSupernodeSolver : public ProfileSPDLinDirectSolver
+{
+  public:
+    ProfileSPDLinSupernodeSolver(double tol=1.0e-12, int maxPanelWidth = 64);
+    ~ProfileSPDLinSupernodeSolver();
+
+    int solve(void);
+    int setSize(void);
+
+  protected:
+
+  private:
+    int factorColumn(int i);
+    int factorPanel(int firstCol, int lastCol, int topRow);
+
+    int maxPanelWidth;
+    int numPanels;
+    int *panelStart;   // first column of each panel, panelStart[numPanels] = size
+    int *panelTop;     // lowest top row of the columns in each panel
+    double *work;      // dense panel, scaled rows above it & block of U above it
+    int sizeWork;
+};
+
+#endif
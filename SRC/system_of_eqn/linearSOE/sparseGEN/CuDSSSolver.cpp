@@ -0,0 +1,243 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/CuDSSSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for CuDSSSolver.
+
+// What: "@(#) CuDSSSolver.C, revA"
+
+#include <CuDSSSolver.h>
+#include <SparseGenRowLinSOE.h>
+#include <elementAPI.h>
+#include <string.h>
+
+void* OPS_CuDSSSolver()
+{
+    // system CuDSS <-spd> <-device id?>
+    bool spd = false;
+    int device = 0;
+    int numdata = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *option = OPS_GetString();
+	if (strcmp(option, "-spd") == 0)
+	    spd = true;
+	else if (strcmp(option, "-device") == 0) {
+	    if (OPS_GetIntInput(&numdata, &device) < 0) {
+		opserr << "WARNING system CuDSS - invalid -device\n";
+		return 0;
+	    }
+	}
+    }
+
+    SparseGenRowLinSolver *theSolver = new CuDSSSolver(spd, device);
+    return new SparseGenRowLinSOE(*theSolver);
+}
+
+
+CuDSSSolver::CuDSSSolver(bool symmPD, int dev)
+:SparseGenRowLinSolver(SOLVER_TAGS_CuDSSSolver),
+ spd(symmPD), device(dev), size(0), nnz(0),
+ analysed(false), factoredOnce(false),
+ dRowStart(0), dCol(0), dA(0), dB(0), dX(0),
+ haveHandle(false), haveMatrices(false)
+{
+
+}
+
+
+CuDSSSolver::~CuDSSSolver()
+{
+  this->freeDevice();
+
+  if (haveHandle == true) {
+    cudssDataDestroy(handle, data);
+    cudssConfigDestroy(config);
+    cudssDestroy(handle);
+  }
+}
+
+
+void
+CuDSSSolver::freeDevice(void)
+{
+  if (haveMatrices == true) {
+    cudssMatrixDestroy(matA);
+    cudssMatrixDestroy(matB);
+    cudssMatrixDestroy(matX);
+    haveMatrices = false;
+  }
+
+  if (dRowStart != 0) cudaFree(dRowStart);
+  if (dCol != 0) cudaFree(dCol);
+  if (dA != 0) cudaFree(dA);
+  if (dB != 0) cudaFree(dB);
+  if (dX != 0) cudaFree(dX);
+  dRowStart = 0;
+  dCol = 0;
+  dA = 0;
+  dB = 0;
+  dX = 0;
+
+  analysed = false;
+  factoredOnce = false;
+}
+
+
+int
+CuDSSSolver::setSize(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING CuDSSSolver::setSize() - no SOE set\n";
+    return -1;
+  }
+
+  if (haveHandle == false) {
+    if (cudaSetDevice(device) != cudaSuccess) {
+      opserr << "WARNING CuDSSSolver::setSize() - could not use device " << device << endln;
+      return -1;
+    }
+    if (cudssCreate(&handle) != CUDSS_STATUS_SUCCESS ||
+	cudssConfigCreate(&config) != CUDSS_STATUS_SUCCESS ||
+	cudssDataCreate(handle, &data) != CUDSS_STATUS_SUCCESS) {
+      opserr << "WARNING CuDSSSolver::setSize() - failed to initialise cuDSS\n";
+      return -1;
+    }
+    haveHandle = true;
+  } else {
+    // a new pattern needs a new analysis, so start with fresh solver data
+    cudssDataDestroy(handle, data);
+    cudssDataCreate(handle, &data);
+  }
+
+  this->freeDevice();
+
+  size = theSOE->size;
+  nnz = theSOE->nnz;
+  if (size == 0)
+    return 0;
+
+  // the pattern goes to the device once
+  if (cudaMalloc((void **)&dRowStart, (size+1)*sizeof(int)) != cudaSuccess ||
+      cudaMalloc((void **)&dCol, nnz*sizeof(int)) != cudaSuccess ||
+      cudaMalloc((void **)&dA, nnz*sizeof(double)) != cudaSuccess ||
+      cudaMalloc((void **)&dB, size*sizeof(double)) != cudaSuccess ||
+      cudaMalloc((void **)&dX, size*sizeof(double)) != cudaSuccess) {
+    opserr << "WARNING CuDSSSolver::setSize() - out of device memory, size ";
+    opserr << size << " nnz " << nnz << endln;
+    this->freeDevice();
+    return -1;
+  }
+
+  cudaMemcpy(dRowStart, theSOE->rowStartA, (size+1)*sizeof(int), cudaMemcpyHostToDevice);
+  cudaMemcpy(dCol, theSOE->colA, nnz*sizeof(int), cudaMemcpyHostToDevice);
+
+  cudssMatrixType_t mtype = (spd == true) ? CUDSS_MTYPE_SPD : CUDSS_MTYPE_GENERAL;
+  if (cudssMatrixCreateCsr(&matA, size, size, nnz, dRowStart, NULL, dCol, dA,
+			   CUDA_R_32I, CUDA_R_64F, mtype, CUDSS_MVIEW_FULL,
+			   CUDSS_BASE_ZERO) != CUDSS_STATUS_SUCCESS ||
+      cudssMatrixCreateDn(&matB, size, 1, size, dB, CUDA_R_64F,
+			  CUDSS_LAYOUT_COL_MAJOR) != CUDSS_STATUS_SUCCESS ||
+      cudssMatrixCreateDn(&matX, size, 1, size, dX, CUDA_R_64F,
+			  CUDSS_LAYOUT_COL_MAJOR) != CUDSS_STATUS_SUCCESS) {
+    opserr << "WARNING CuDSSSolver::setSize() - failed to create the cuDSS matrices\n";
+    this->freeDevice();
+    return -1;
+  }
+  haveMatrices = true;
+
+  return 0;
+}
+
+
+int
+CuDSSSolver::solve(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING CuDSSSolver::solve() - no SOE set\n";
+    return -1;
+  }
+
+  if (size == 0)
+    return 0;
+
+  if (haveMatrices == false) {
+    opserr << "WARNING CuDSSSolver::solve() - setSize() failed or not called\n";
+    return -1;
+  }
+
+  cudssStatus_t status = CUDSS_STATUS_SUCCESS;
+
+  // only the values of A move when A has changed
+  if (theSOE->factored == false) {
+    cudaMemcpy(dA, theSOE->A, nnz*sizeof(double), cudaMemcpyHostToDevice);
+
+    if (analysed == false) {
+      status = cudssExecute(handle, CUDSS_PHASE_ANALYSIS, config, data, matA, matX, matB);
+      if (status != CUDSS_STATUS_SUCCESS) {
+	opserr << "WARNING CuDSSSolver::solve() - analysis failed, status " << (int)status << endln;
+	return -1;
+      }
+      analysed = true;
+    }
+
+    cudssPhase_t phase = (factoredOnce == true) ? CUDSS_PHASE_REFACTORIZATION
+                                                : CUDSS_PHASE_FACTORIZATION;
+    status = cudssExecute(handle, phase, config, data, matA, matX, matB);
+    if (status != CUDSS_STATUS_SUCCESS) {
+      opserr << "WARNING CuDSSSolver::solve() - factorization failed, status " << (int)status << endln;
+      return -2;
+    }
+    factoredOnce = true;
+  }
+
+  cudaMemcpy(dB, theSOE->B, size*sizeof(double), cudaMemcpyHostToDevice);
+  status = cudssExecute(handle, CUDSS_PHASE_SOLVE, config, data, matA, matX, matB);
+  if (status != CUDSS_STATUS_SUCCESS) {
+    opserr << "WARNING CuDSSSolver::solve() - solve failed, status " << (int)status << endln;
+    return -3;
+  }
+  cudaMemcpy(theSOE->X, dX, size*sizeof(double), cudaMemcpyDeviceToHost);
+
+  theSOE->factored = true;
+  return 0;
+}
+
+
+int
+CuDSSSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  // nothing to do
+  return 0;
+}
+
+
+int
+CuDSSSolver::recvSelf(int commitTag, Channel &theChannel,
+		      FEM_ObjectBroker &theBroker)
+{
+  // nothing to do
+  return 0;
+}
@@ -0,0 +1,79 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/CuDSSSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for CuDSSSolver.
+// CuDSSSolver is a subclass of SparseGenRowLinSolver. It solves the
+// SparseGenRowLinSOE on a GPU with NVIDIA's cuDSS direct sparse solver.
+// The row pointers and column indices of A are copied to the device, and
+// the symbolic analysis done, only in setSize(), i.e. when the pattern
+// changes; a solve with a new A copies the values of A and refactors on
+// the device reusing the analysis, and every solve copies B down and X
+// back. It is built when _CUDSS is defined.
+
+// What: "@(#) CuDSSSolver.h, revA"
+
+#ifndef CuDSSSolver_h
+#define CuDSSSolver_h
+
+#include <SparseGenRowLinSolver.h>
+#include <cuda_runtime.h>
+#include <cudss.h>
+
+class CuDSSSolver : public SparseGenRowLinSolver
+{
+  public:
+    CuDSSSolver(bool spd = false, int device = 0);
+    ~CuDSSSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    void freeDevice(void);
+
+    bool spd;
+    int device;
+    int size, nnz;
+    bool analysed, factoredOnce;
+
+    // device copies of the SOE arrays
+    int *dRowStart, *dCol;
+    double *dA, *dB, *dX;
+
+    cudssHandle_t handle;
+    cudssConfig_t config;
+    cudssData_t data;
+    cudssMatrix_t matA, matB, matX;
+    bool haveHandle, haveMatrices;
+};
+
+#endif
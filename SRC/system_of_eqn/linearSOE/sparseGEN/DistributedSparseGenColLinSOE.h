@@ -56,6 +56,8 @@ class DistributedSparseGenColLinSOE : public SparseGenColLinSOE
     const Vector &getB(void);
     void zeroB(void);
     int solve(void);
+    // the solve is not the one of LinearSOE, no low rank update
+    int setLowRankUpdate(const double *U, const double *d, int numCols) {return -1;}
 
 
     int sendSelf(int commitTag, Channel &theChannel);
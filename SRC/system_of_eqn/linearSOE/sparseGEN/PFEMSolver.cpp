@@ -40,8 +40,9 @@ void* OPS_PFEMSolver()
     return new PFEMLinSOE(*theSolver);
 }
 
-PFEMSolver::PFEMSolver()
-    :LinearSOESolver(SOLVER_TAGS_PFEMSolver), theSOE(0), Msym(0), Mnum(0)
+PFEMSolver::PFEMSolver(bool p, double t, int m)
+    :LinearSOESolver(SOLVER_TAGS_PFEMSolver), theSOE(0), Msym(0), Mnum(0),
+     pcg(p), direct(false), tol(t), maxIter(m), Ssym(0), Snum(0), lastP()
 {
 }
 
@@ -53,6 +54,12 @@ PFEMSolver::~PFEMSolver()
     if(Mnum != 0) {
         cs_nfree(Mnum);
     }
+    if(Ssym != 0) {
+        cs_sfree(Ssym);
+    }
+    if(Snum != 0) {
+        cs_nfree(Snum);
+    }
 }
 
 int
@@ -243,7 +250,11 @@ PFEMSolver::solve()
             S = L;
 
             // solve
-            cs_lusol(3, S, deltaP_ptr, 1e-6);  
+            if(pcg) {
+                this->solvePressure(S, deltaP_ptr);
+            } else {
+                cs_lusol(3, S, deltaP_ptr, 1e-6);  
+            }
 
         } else {
             cs* S1 = cs_add(S, L, 1.0, 1.0);
@@ -251,7 +262,11 @@ PFEMSolver::solve()
             S = S1;
 
             // solve
-            cs_lusol(3, S, deltaP_ptr, 1e-6);  
+            if(pcg) {
+                this->solvePressure(S, deltaP_ptr);
+            } else {
+                cs_lusol(3, S, deltaP_ptr, 1e-6);  
+            }
             cs_spfree(S);
         }
     }
@@ -353,8 +368,151 @@ PFEMSolver::solve()
     return 0;
 }
 
+int
+PFEMSolver::solvePressure(cs* S, double* deltaP)
+{
+    int n = S->n;
+    if(n == 0) return 0;
+
+    // not symmetric positive definite
+    if(direct) {
+        cs_lusol(3, S, deltaP, 1e-6);
+        return 0;
+    }
+
+    // factor S after the mesh has changed
+    if(Snum == 0) {
+        if(this->factorPressure(S) < 0) {
+            direct = true;
+            cs_lusol(3, S, deltaP, 1e-6);
+            return 0;
+        }
+    }
+
+    // r = b - S*x, warm started from the previous pressure
+    Vector b(deltaP, n);
+    Vector x(n), r(b), z(n), d(n), q(n);
+    double normb = b.Norm();
+    if(normb == 0.0) {
+        lastP = x;
+        return 0;
+    }
+    if(lastP.Size() == n) {
+        q.Zero();
+        cs_gaxpy(S, &lastP(0), &q(0));
+        q -= b;
+        if(q.Norm() < normb) {
+            x = lastP;
+            r.addVector(0.0, q, -1.0);
+        }
+    }
+
+    // preconditioned conjugate gradient
+    bool converged = false;
+    double rz = 0.0;
+    for(int iter=0; iter<maxIter; iter++) {
+        if(r.Norm() <= tol*normb) {
+            converged = true;
+            break;
+        }
+
+        // z = S0^{-1}*r
+        cs_ipvec(Ssym->pinv, &r(0), &q(0), n);
+        cs_lsolve(Snum->L, &q(0));
+        cs_ltsolve(Snum->L, &q(0));
+        cs_pvec(Ssym->pinv, &q(0), &z(0), n);
+
+        double rz1 = r^z;
+        if(iter == 0) {
+            d = z;
+        } else {
+            d.addVector(rz1/rz, z, 1.0);
+        }
+        rz = rz1;
+
+        // q = S*d
+        q.Zero();
+        cs_gaxpy(S, &d(0), &q(0));
+        double dq = d^q;
+        if(dq <= 0.0) break;
+
+        double alpha = rz/dq;
+        x.addVector(1.0, d, alpha);
+        r.addVector(1.0, q, -alpha);
+    }
+
+    // factor S again and solve directly
+    if(!converged && r.Norm() > tol*normb) {
+        if(this->factorPressure(S) < 0) {
+            direct = true;
+            cs_lusol(3, S, deltaP, 1e-6);
+            return 0;
+        }
+        cs_ipvec(Ssym->pinv, &b(0), &q(0), n);
+        cs_lsolve(Snum->L, &q(0));
+        cs_ltsolve(Snum->L, &q(0));
+        cs_pvec(Ssym->pinv, &q(0), &x(0), n);
+    }
+
+    for(int i=0; i<n; i++) {
+        deltaP[i] = x(i);
+    }
+    lastP = x;
+
+    return 0;
+}
+
+int
+PFEMSolver::factorPressure(cs* S)
+{
+    if(Ssym != 0) {
+        cs_sfree(Ssym);
+        Ssym = 0;
+    }
+    if(Snum != 0) {
+        cs_nfree(Snum);
+        Snum = 0;
+    }
+
+    // check if S is symmetric
+    cs* St = cs_transpose(S, 1);
+    if(St == 0) return -1;
+    cs* D = cs_add(S, St, 1.0, -1.0);
+    cs_spfree(St);
+    if(D == 0) return -1;
+    double normD = cs_norm(D);
+    cs_spfree(D);
+    if(normD > 1e-10*cs_norm(S)) {
+        return -1;
+    }
+
+    // Cholesky factorization
+    Ssym = cs_schol(1, S);
+    if(Ssym == 0) return -1;
+    Snum = cs_chol(S, Ssym);
+    if(Snum == 0) {
+        cs_sfree(Ssym);
+        Ssym = 0;
+        return -1;
+    }
+
+    return 0;
+}
+
 int PFEMSolver::setSize()
 {
+    // the pressure equation is factored again
+    if(Ssym != 0) {
+        cs_sfree(Ssym);
+        Ssym = 0;
+    }
+    if(Snum != 0) {
+        cs_nfree(Snum);
+        Snum = 0;
+    }
+    direct = false;
+    lastP.resize(0);
+
     cs* M = theSOE->M;
     if(M->n > 0) {
         if(Msym != 0) {
@@ -36,9 +36,19 @@
 // object. It obtains the solution by making calls on the
 // The PFEMSolver uses Fractional Step Method to solve PFEM equations. 
 //
+// With pcg the pressure equation S*p = r is solved with the conjugate
+// gradient method, warm started from the previous pressure solution and
+// preconditioned by a Cholesky factorization of S. The factorization is
+// kept until the mesh changes (setSize), so while the mesh is not
+// remeshed S is not factored again, unless the conjugate gradient
+// method fails to converge in maxIter iterations, in which case S is
+// factored again and the pressure is solved directly. If S is not
+// symmetric positive definite it is solved with LU as without pcg.
+//
 // What: "@(#) PFEMSolver.h, revA"
 
 #include <LinearSOESolver.h>
+#include <Vector.h>
 extern "C" {
 #include <cs.h>
 }
@@ -48,7 +58,7 @@ class PFEMLinSOE;
 class PFEMSolver : public LinearSOESolver
 {
 public:
-    PFEMSolver();
+    PFEMSolver(bool pcg = false, double tol = 1e-12, int maxIter = 50);
     virtual ~PFEMSolver();
 
     virtual int solve();
@@ -59,10 +69,21 @@ public:
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);  
 
 private:
+
+    int solvePressure(cs* S, double* deltaP);
+    int factorPressure(cs* S);
     
     PFEMLinSOE* theSOE;
     css* Msym;
     csn* Mnum;
+
+    // pressure equation
+    bool pcg, direct;
+    double tol;
+    int maxIter;
+    css* Ssym;
+    csn* Snum;
+    Vector lastP;
 };
 
 #endif
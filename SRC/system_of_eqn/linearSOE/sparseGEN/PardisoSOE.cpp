@@ -0,0 +1,479 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/PardisoSOE.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for PardisoSOE.
+
+// What: "@(#) PardisoSOE.C, revA"
+
+#include <PardisoSOE.h>
+#include <PardisoSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+#include <math.h>
+#include <stdlib.h>
+
+#include <iostream>
+using std::nothrow;
+
+PardisoSOE::PardisoSOE(PardisoSolver &the_Solver, int _matType)
+:LinearSOE(the_Solver, LinSOE_TAGS_PardisoSOE),
+ size(0), nnz(0), A(0), B(0), X(0), colA(0), rowStartA(0),
+ vectX(0), vectB(0), Asize(0), Bsize(0), factored(false), matType(_matType)
+{
+  if (matType != PARDISO_UNSYMMETRIC && matType != PARDISO_SPD &&
+      matType != PARDISO_SYMMETRIC) {
+    opserr << "WARNING PardisoSOE::PardisoSOE() - unknown matrix type " << matType;
+    opserr << ", A taken as unsymmetric\n";
+    matType = PARDISO_UNSYMMETRIC;
+  }
+  the_Solver.setLinearSOE(*this);
+}
+
+
+PardisoSOE::~PardisoSOE()
+{
+  if (A != 0) delete [] A;
+  if (B != 0) delete [] B;
+  if (X != 0) delete [] X;
+  if (colA != 0) delete [] colA;
+  if (rowStartA != 0) delete [] rowStartA;
+  if (vectX != 0) delete vectX;    
+  if (vectB != 0) delete vectB;
+}
+
+
+int
+PardisoSOE::getNumEqn(void) const
+{
+  return size;
+}
+
+
+int 
+PardisoSOE::setSize(Graph &theGraph)
+{
+  int result = 0;
+  int oldSize = size;
+  size = theGraph.getNumVertex();
+
+  // any existing scatter map is no longer valid
+  theScatter.clear();
+
+  // the number of coefficients stored: each row holds its diagonal and, if
+  // A is symmetric, only the columns to the right of it
+  int newNNZ = 0;
+  Vertex *theVertex;
+  VertexIter &theVertices = theGraph.getVertices();
+  while ((theVertex = theVertices()) != 0) {
+    int row = theVertex->getTag();
+    const ID &theAdjacency = theVertex->getAdjacency();
+    newNNZ++;
+    for (int i=0; i<theAdjacency.Size(); i++)
+      if (matType == PARDISO_UNSYMMETRIC || theAdjacency(i) > row)
+	newNNZ++;
+  }
+  nnz = newNNZ;
+
+  if (newNNZ > Asize) { // we have to get more space for A and colA
+    if (A != 0) delete [] A;
+    if (colA != 0) delete [] colA;
+    
+    A = new (nothrow) double[newNNZ];
+    colA = new (nothrow) int[newNNZ];
+    
+    if (A == 0 || colA == 0) {
+      opserr << "WARNING PardisoSOE::setSize() - ";
+      opserr << " ran out of memory for A and colA with nnz = " << newNNZ << endln;
+      size = 0; Asize = 0; nnz = 0;
+      return -1;
+    } 
+    Asize = newNNZ;
+  }
+  
+  // zero the matrix
+  for (int i=0; i<nnz; i++)
+    A[i] = 0;
+  
+  factored = false;
+  
+  if (size > Bsize) { // we have to get space for the vectors
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (rowStartA != 0) delete [] rowStartA;
+    
+    B = new (nothrow) double[size];
+    X = new (nothrow) double[size];
+    rowStartA = new (nothrow) int[size+1]; 
+    
+    if (B == 0 || X == 0 || rowStartA == 0) {
+      opserr << "WARNING PardisoSOE::setSize() - ";
+      opserr << " ran out of memory for vectors (size) (" << size << ")\n";
+      size = 0; Bsize = 0;
+      return -1;
+    }
+    Bsize = size;
+  }
+  
+  // zero the vectors
+  for (int j=0; j<size; j++) {
+    B[j] = 0;
+    X[j] = 0;
+  }
+  
+  // create new Vectors objects
+  if (size != oldSize) {
+    if (vectX != 0)
+      delete vectX;
+    if (vectB != 0)
+      delete vectB;
+    vectX = new Vector(X,size);
+    vectB = new Vector(B,size);	
+  }
+  
+  // fill in rowStartA and colA, the columns of each row in order
+  if (size != 0) {
+    rowStartA[0] = 0;
+    int lastLoc = 0;
+    for (int a=0; a<size; a++) {
+      theVertex = theGraph.getVertexPtr(a);
+      if (theVertex == 0) {
+	opserr << "WARNING PardisoSOE::setSize() - vertex " << a;
+	opserr << " not in graph! - size set to 0\n";
+	size = 0;
+	return -1;
+      }
+
+      int startLoc = lastLoc;
+      colA[lastLoc++] = a;
+      const ID &theAdjacency = theVertex->getAdjacency();
+      for (int i=0; i<theAdjacency.Size(); i++) {
+	int col = theAdjacency(i);
+	if (matType == PARDISO_UNSYMMETRIC || col > a)
+	  colA[lastLoc++] = col;
+      }
+
+      // the rows are short, an insertion sort puts them in order
+      for (int i=startLoc+1; i<lastLoc; i++) {
+	int col = colA[i];
+	int j = i-1;
+	while (j >= startLoc && colA[j] > col) {
+	  colA[j+1] = colA[j];
+	  j--;
+	}
+	colA[j+1] = col;
+      }
+
+      rowStartA[a+1] = lastLoc;
+    }
+  }
+
+  // build the scatter map for the FE_Elements of the model
+  this->formScatter();
+  
+  // invoke setSize() on the Solver    
+  LinearSOESolver *the_Solver = this->getSolver();
+  int solverOK = the_Solver->setSize();
+  if (solverOK < 0) {
+    opserr << "WARNING PardisoSOE::setSize() - solver failed setSize()\n";
+    return solverOK;
+  }    
+  
+  return result;
+}
+
+
+// int locate(int row, int col)
+// The location in A of the coefficient (row,col), -1 if it is not stored,
+// which for a symmetric A includes the whole of the lower triangle.
+
+int
+PardisoSOE::locate(int row, int col) const
+{
+  if (row < 0 || row >= size || col < 0 || col >= size)
+    return -1;
+  if (matType != PARDISO_UNSYMMETRIC && col < row)
+    return -1;
+
+  int lo = rowStartA[row];
+  int hi = rowStartA[row+1]-1;
+  while (lo <= hi) {
+    int mid = (lo + hi)/2;
+    int colMid = colA[mid];
+    if (colMid == col)
+      return mid;
+    else if (colMid < col)
+      lo = mid+1;
+    else
+      hi = mid-1;
+  }
+  return -1;
+}
+
+
+int 
+PardisoSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  
+    return 0;
+
+  int idSize = id.Size();
+    
+  // check that m and id are of similar size
+  if (idSize != m.noRows() && idSize != m.noCols()) {
+    opserr << "PardisoSOE::addA() - Matrix and ID not of similar sizes\n";
+    return -1;
+  }
+
+  // if id is that of an FE_Element in the scatter map use it
+  const int *locPtr = theScatter.find(id);
+  if (locPtr != 0) {
+    if (fact == 1.0) { // do not need to multiply 
+      for (int i=0; i<idSize; i++)
+	for (int j=0; j<idSize; j++) {
+	  int loc = *locPtr++;
+	  if (loc >= 0)
+	    A[loc] += m(j,i);
+	}
+    } else {
+      for (int i=0; i<idSize; i++)
+	for (int j=0; j<idSize; j++) {
+	  int loc = *locPtr++;
+	  if (loc >= 0)
+	    A[loc] += fact * m(j,i);
+	}
+    }
+    return 0;
+  }
+
+  for (int i=0; i<idSize; i++) {
+    int col = id(i);
+    for (int j=0; j<idSize; j++) {
+      int loc = this->locate(id(j), col);
+      if (loc >= 0)
+	A[loc] += fact * m(j,i);
+    }
+  }
+  return 0;
+}
+
+    
+int 
+PardisoSOE::addB(const Vector &v, const ID &id, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  return 0;
+
+  int idSize = id.Size();    
+  // check that m and id are of similar size
+  if (idSize != v.Size() ) {
+    opserr << "PardisoSOE::addB() - Vector and ID not of similar sizes\n";
+    return -1;
+  }    
+
+  if (fact == 1.0) { // do not need to multiply if fact == 1.0
+    for (int i=0; i<idSize; i++) {
+      int pos = id(i);
+      if (pos <size && pos >= 0)
+	B[pos] += v(i);
+    }
+  } else if (fact == -1.0) { // do not need to multiply if fact == -1.0
+    for (int i=0; i<idSize; i++) {
+      int pos = id(i);
+      if (pos <size && pos >= 0)
+	B[pos] -= v(i);
+    }
+  } else {
+    for (int i=0; i<idSize; i++) {
+      int pos = id(i);
+      if (pos <size && pos >= 0)
+	B[pos] += v(i) * fact;
+    }
+  }	
+
+  return 0;
+}
+
+
+int
+PardisoSOE::setB(const Vector &v, double fact)
+{
+  // check for a quick return 
+  if (fact == 0.0)  return 0;
+
+  if (v.Size() != size) {
+    opserr << "WARNING PardisoSOE::setB() -";
+    opserr << " incomptable sizes " << size << " and " << v.Size() << endln;
+    return -1;
+  }
+    
+  if (fact == 1.0) { // do not need to multiply if fact == 1.0
+    for (int i=0; i<size; i++)
+      B[i] = v(i);
+  } else if (fact == -1.0) {
+    for (int i=0; i<size; i++)
+      B[i] = -v(i);
+  } else {
+    for (int i=0; i<size; i++)
+      B[i] = v(i) * fact;
+  }	
+  return 0;
+}
+
+
+void 
+PardisoSOE::zeroA(void)
+{
+  double *Aptr = A;
+  for (int i=0; i<nnz; i++)
+    *Aptr++ = 0;
+
+  factored = false;
+  theScatter.restart();
+}
+
+int
+PardisoSOE::domainChanged(void)
+{
+  // the sparsity is unchanged but the FE_Elements are new
+  this->formScatter();
+  return this->LinearSOE::domainChanged();
+}
+
+	
+void 
+PardisoSOE::zeroB(void)
+{
+  double *Bptr = B;
+  for (int i=0; i<size; i++)
+    *Bptr++ = 0;
+}
+
+
+size_t
+PardisoSOE::getNumBytes(void)
+{
+  return Asize*(sizeof(double) + sizeof(int)) + (Bsize+1)*sizeof(int) +
+    this->LinearSOE::getNumBytes();
+}
+
+
+void 
+PardisoSOE::setX(int loc, double value)
+{
+  if (loc < size && loc >=0)
+    X[loc] = value;
+}
+
+
+void 
+PardisoSOE::setX(const Vector &x)
+{
+  if (x.Size() == size && vectX != 0)
+    *vectX = x;
+}
+
+
+const Vector &
+PardisoSOE::getX(void)
+{
+  if (vectX == 0) {
+    opserr << "FATAL PardisoSOE::getX - vectX == 0";
+    exit(-1);
+  }
+  return *vectX;
+}
+
+
+const Vector &
+PardisoSOE::getB(void)
+{
+  if (vectB == 0) {
+    opserr << "FATAL PardisoSOE::getB - vectB == 0";
+    exit(-1);
+  }        
+  return *vectB;
+}
+
+
+double 
+PardisoSOE::normRHS(void)
+{
+  double norm =0.0;
+  for (int i=0; i<size; i++) {
+    double Yi = B[i];
+    norm += Yi*Yi;
+  }
+  return sqrt(norm);
+}    
+
+
+int
+PardisoSOE::setPardisoSolver(PardisoSolver &newSolver)
+{
+  newSolver.setLinearSOE(*this);
+  
+  if (size != 0) {
+    int solverOK = newSolver.setSize();
+    if (solverOK < 0) {
+      opserr << "WARNING PardisoSOE::setPardisoSolver() - the new solver failed setSize()\n";
+      return solverOK;
+    }
+  }
+  
+  return this->LinearSOE::setSolver(newSolver);
+}
+
+
+// int formScatter(void)
+//	forms the scatter map for the FE_Elements of the model, colA holds
+//	the upper triangle only if A is symmetric.
+
+int
+PardisoSOE::formScatter(void)
+{
+  return theScatter.form(theModel, size, rowStartA, colA, true,
+			 matType != PARDISO_UNSYMMETRIC);
+}
+
+
+int 
+PardisoSOE::sendSelf(int cTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int 
+PardisoSOE::recvSelf(int cTag, Channel &theChannel, 
+		     FEM_ObjectBroker &theBroker)  
+{
+  return 0;
+}
@@ -0,0 +1,102 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/PardisoSOE.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for PardisoSOE.
+// PardisoSOE is a subclass of LinearSOE. It stores A in the compressed row
+// form the PARDISO solver of the Intel MKL takes: zero based, the columns
+// of each row in order with the diagonal always stored, all of A if it is
+// unsymmetric and its upper triangle if it is symmetric. A is assembled
+// through a scatter map built in setSize(), which gives for each
+// FE_Element the location in A of each entry of its matrix.
+//
+// matrix types (matType), those of PARDISO: 11 real unsymmetric
+//                                           2 real symmetric positive definite
+//                                          -2 real symmetric indefinite
+//
+// What: "@(#) PardisoSOE.h, revA"
+
+#ifndef PardisoSOE_h
+#define PardisoSOE_h
+
+#include <LinearSOE.h>
+#include <Vector.h>
+#include <ScatterMap.h>
+
+#define PARDISO_UNSYMMETRIC  11
+#define PARDISO_SPD           2
+#define PARDISO_SYMMETRIC    -2
+
+class PardisoSolver;
+
+class PardisoSOE : public LinearSOE
+{
+  public:
+    PardisoSOE(PardisoSolver &theSolver, int matType = PARDISO_UNSYMMETRIC);
+    ~PardisoSOE();
+
+    int getNumEqn(void) const;
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);    
+    int setB(const Vector &, double fact = 1.0);        
+    
+    void zeroA(void);
+    int domainChanged(void);
+    void zeroB(void);
+    size_t getNumBytes(void);
+    
+    const Vector &getX(void);
+    const Vector &getB(void);    
+    double normRHS(void);
+
+    void setX(int loc, double value);        
+    void setX(const Vector &x);        
+    int setPardisoSolver(PardisoSolver &newSolver);    
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
+
+    friend class PardisoSolver;
+
+  protected:
+    int size;            // order of A
+    int nnz;             // number of non-zeros in A
+    double *A, *B, *X;   // 1d arrays containing coefficients of A, B and X
+    int *colA, *rowStartA; // the column of each coefficient, the start of each row
+    Vector *vectX;
+    Vector *vectB;    
+    int Asize, Bsize;    // size of the 1d arrays holding A and B
+    bool factored;
+    int matType;
+
+    int locate(int row, int col) const;
+    int formScatter(void);
+    ScatterMap theScatter;  // built in setSize(), so that addA() does not search colA
+
+  private:
+};
+
+#endif
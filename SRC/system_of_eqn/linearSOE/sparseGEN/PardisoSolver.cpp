@@ -0,0 +1,210 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/PardisoSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for PardisoSolver.
+
+// What: "@(#) PardisoSolver.C, revA"
+
+#include <PardisoSolver.h>
+#include <PardisoSOE.h>
+#include <elementAPI.h>
+#include <string.h>
+
+void* OPS_PardisoSolver()
+{
+    // system Pardiso <-spd|-symmetric|-unsymmetric> <-refine maxSteps?>
+    int matType = PARDISO_UNSYMMETRIC;
+    int maxRefine = 2;
+    int numdata = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *option = OPS_GetString();
+	if (strcmp(option, "-spd") == 0)
+	    matType = PARDISO_SPD;
+	else if (strcmp(option, "-symmetric") == 0)
+	    matType = PARDISO_SYMMETRIC;
+	else if (strcmp(option, "-unsymmetric") == 0)
+	    matType = PARDISO_UNSYMMETRIC;
+	else if (strcmp(option, "-refine") == 0) {
+	    if (OPS_GetIntInput(&numdata, &maxRefine) < 0) {
+		opserr << "WARNING system Pardiso - invalid -refine\n";
+		return 0;
+	    }
+	}
+    }
+
+    PardisoSolver *theSolver = new PardisoSolver(maxRefine);
+    return new PardisoSOE(*theSolver, matType);
+}
+
+
+PardisoSolver::PardisoSolver(int refine)
+:LinearSOESolver(SOLVER_TAGS_PardisoSolver),
+ theSOE(0), maxRefine(refine), analysed(false), mtype(PARDISO_UNSYMMETRIC), n(0)
+{
+  for (int i=0; i<64; i++) {
+    pt[i] = 0;
+    iparm[i] = 0;
+  }
+}
+
+
+PardisoSolver::~PardisoSolver()
+{
+  this->release();
+}
+
+
+int
+PardisoSolver::callPardiso(MKL_INT phase, double *b, double *x)
+{
+  MKL_INT maxfct = 1;   // one factorization held
+  MKL_INT mnum = 1;
+  MKL_INT nrhs = 1;
+  MKL_INT msglvl = 0;
+  MKL_INT error = 0;
+  MKL_INT idum = 0;
+  double ddum = 0.0;
+
+  pardiso(pt, &maxfct, &mnum, &mtype, &phase, &n, theSOE->A,
+	  (MKL_INT *)theSOE->rowStartA, (MKL_INT *)theSOE->colA, &idum, &nrhs,
+	  iparm, &msglvl, (b != 0) ? b : &ddum, (x != 0) ? x : &ddum, &error);
+
+  return error;
+}
+
+
+void
+PardisoSolver::release(void)
+{
+  // frees all PARDISO holds, the factors and the symbolic factorization
+  if (analysed == true)
+    this->callPardiso(-1, 0, 0);
+  analysed = false;
+}
+
+
+int
+PardisoSolver::setSize(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING PardisoSolver::setSize() - no SOE set\n";
+    return -1;
+  }
+
+  this->release();
+
+  n = theSOE->size;
+  if (n == 0)
+    return 0;
+
+  mtype = theSOE->matType;
+  for (int i=0; i<64; i++) {
+    pt[i] = 0;
+    iparm[i] = 0;
+  }
+  pardisoinit(pt, &mtype, iparm);
+  iparm[7] = maxRefine;     // maximum number of iterative refinement steps
+  iparm[34] = 1;            // zero based indices
+
+  // the ordering and symbolic factorization, kept until the pattern changes
+  MKL_INT error = this->callPardiso(11, 0, 0);
+  if (error != 0) {
+    opserr << "WARNING PardisoSolver::setSize() - analysis failed, error " << (int)error << endln;
+    this->callPardiso(-1, 0, 0);
+    return -1;
+  }
+  analysed = true;
+
+  return 0;
+}
+
+
+int
+PardisoSolver::solve(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING PardisoSolver::solve() - no SOE set\n";
+    return -1;
+  }
+
+  if (n == 0)
+    return 0;
+
+  if (analysed == false) {
+    opserr << "WARNING PardisoSolver::solve() - setSize() failed or not called\n";
+    return -1;
+  }
+
+  MKL_INT error = 0;
+
+  // the numerical factorization only when A has changed
+  if (theSOE->factored == false) {
+    error = this->callPardiso(22, 0, 0);
+    if (error != 0) {
+      opserr << "WARNING PardisoSolver::solve() - factorization failed, error " << (int)error;
+      if (error == -4)
+	opserr << ", zero pivot: A is singular or, with -spd, not positive definite\n";
+      else
+	opserr << endln;
+      return -2;
+    }
+    theSOE->factored = true;
+  }
+
+  error = this->callPardiso(33, theSOE->B, theSOE->X);
+  if (error != 0) {
+    opserr << "WARNING PardisoSolver::solve() - solve failed, error " << (int)error << endln;
+    return -3;
+  }
+
+  return 0;
+}
+
+
+int
+PardisoSolver::setLinearSOE(PardisoSOE &theLinearSOE)
+{
+  theSOE = &theLinearSOE;
+  return 0;
+}
+
+
+int
+PardisoSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  // nothing to do
+  return 0;
+}
+
+
+int
+PardisoSolver::recvSelf(int commitTag, Channel &theChannel,
+			FEM_ObjectBroker &theBroker)
+{
+  // nothing to do
+  return 0;
+}
@@ -0,0 +1,78 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/PardisoSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for PardisoSolver.
+// PardisoSolver is a subclass of LinearSOESolver. It solves a PardisoSOE
+// with PARDISO, the shared memory parallel sparse direct solver of the
+// Intel MKL, on the threads the BLAS of the MKL is given (see ThreadPool).
+// The fill reducing ordering and the symbolic factorization are done in
+// setSize(), i.e. only when the pattern of A changes; a solve with a new A
+// does the numerical factorization reusing them, and every solve the
+// substitutions, with up to maxRefine steps of iterative refinement. It
+// is built when _PARDISO is defined.
+
+// What: "@(#) PardisoSolver.h, revA"
+
+#ifndef PardisoSolver_h
+#define PardisoSolver_h
+
+#include <LinearSOESolver.h>
+#include <mkl_pardiso.h>
+
+class PardisoSOE;
+
+class PardisoSolver : public LinearSOESolver
+{
+  public:
+    PardisoSolver(int maxRefine = 2);
+    ~PardisoSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setLinearSOE(PardisoSOE &theSOE);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int callPardiso(MKL_INT phase, double *b, double *x);
+    void release(void);
+
+    PardisoSOE *theSOE;
+    int maxRefine;
+    bool analysed;       // the symbolic factorization of the pattern is held
+
+    void *pt[64];        // PARDISO's internal memory
+    MKL_INT iparm[64];
+    MKL_INT mtype;
+    MKL_INT n;
+};
+
+#endif
@@ -0,0 +1,645 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseBlockRowKrylovSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of
+// SparseBlockRowKrylovSolver.
+
+// What: "@(#) SparseBlockRowKrylovSolver.cpp, revA"
+
+#include <SparseBlockRowKrylovSolver.h>
+#include <SparseBlockRowLinSOE.h>
+#include <elementAPI.h>
+#include <math.h>
+#include <string.h>
+#include <algorithm>
+
+void* OPS_SparseBlockRowKrylovSolver()
+{
+    // system BlockKrylov <-cg|-bicgstab> <-pc none|jacobi|blockJacobi|up>
+    //   <-tol tol?> <-maxIter n?>
+    int method = -1;
+    int pcType = KRYLOV_PC_BLOCKJACOBI;
+    double tol = 1.0e-8;
+    int maxIter = 1000;
+    int numdata = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *option = OPS_GetString();
+	if (strcmp(option, "-cg") == 0 || strcmp(option, "-pcg") == 0)
+	    method = KRYLOV_CG;
+	else if (strcmp(option, "-bicgstab") == 0)
+	    method = KRYLOV_BICGSTAB;
+	else if (strcmp(option, "-pc") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char *pc = OPS_GetString();
+	    if (strcmp(pc, "none") == 0)
+		pcType = KRYLOV_PC_NONE;
+	    else if (strcmp(pc, "jacobi") == 0)
+		pcType = KRYLOV_PC_JACOBI;
+	    else if (strcmp(pc, "blockJacobi") == 0)
+		pcType = KRYLOV_PC_BLOCKJACOBI;
+	    else if (strcmp(pc, "up") == 0 || strcmp(pc, "UP") == 0)
+		pcType = KRYLOV_PC_UP;
+	    else {
+		opserr << "WARNING system BlockKrylov - unknown preconditioner " << pc << endln;
+		return 0;
+	    }
+	} else if (strcmp(option, "-tol") == 0) {
+	    if (OPS_GetDoubleInput(&numdata, &tol) < 0) {
+		opserr << "WARNING system BlockKrylov - invalid -tol\n";
+		return 0;
+	    }
+	} else if (strcmp(option, "-maxIter") == 0) {
+	    if (OPS_GetIntInput(&numdata, &maxIter) < 0) {
+		opserr << "WARNING system BlockKrylov - invalid -maxIter\n";
+		return 0;
+	    }
+	}
+    }
+
+    // the u-p preconditioner is not symmetric, CG is not used with it
+    // unless asked for
+    if (method < 0)
+	method = (pcType == KRYLOV_PC_UP) ? KRYLOV_BICGSTAB : KRYLOV_CG;
+
+    SparseBlockRowKrylovSolver *theSolver =
+	new SparseBlockRowKrylovSolver(method, pcType, tol, maxIter);
+    return new SparseBlockRowLinSOE(*theSolver);
+}
+
+
+SparseBlockRowKrylovSolver::SparseBlockRowKrylovSolver(int meth, int pc,
+						       double t, int maxI)
+:LinearSOESolver(SOLVER_TAGS_SparseBlockRowKrylovSolver),
+ theSOE(0), method(meth), pcType(pc), tol(t), maxIter(maxI),
+ size(0), M(0), startM(0), invS(0), work(0), numIter(0)
+{
+  if (maxIter < 1)
+    maxIter = 1;
+}
+
+
+SparseBlockRowKrylovSolver::~SparseBlockRowKrylovSolver()
+{
+  if (M != 0) delete [] M;
+  if (startM != 0) delete [] startM;
+  if (invS != 0) delete [] invS;
+  if (work != 0) delete [] work;
+}
+
+
+int
+SparseBlockRowKrylovSolver::setLinearSOE(SparseBlockRowLinSOE &theLinearSOE)
+{
+  theSOE = &theLinearSOE;
+  return 0;
+}
+
+
+int
+SparseBlockRowKrylovSolver::setSize(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING SparseBlockRowKrylovSolver::setSize() - no SOE set\n";
+    return -1;
+  }
+
+  if (M != 0) delete [] M;
+  if (startM != 0) delete [] startM;
+  if (invS != 0) delete [] invS;
+  if (work != 0) delete [] work;
+  M = 0;
+  startM = 0;
+  invS = 0;
+  work = 0;
+
+  size = theSOE->size;
+  if (size == 0)
+    return 0;
+
+  int numBlocks = theSOE->numBlocks;
+  int *blockStart = theSOE->blockStart;
+
+  if (pcType == KRYLOV_PC_JACOBI)
+    M = new double[size];
+  else if (pcType == KRYLOV_PC_BLOCKJACOBI) {
+    startM = new int[numBlocks+1];
+    startM[0] = 0;
+    for (int I=0; I<numBlocks; I++) {
+      int n = blockStart[I+1] - blockStart[I];
+      startM[I+1] = startM[I] + n*n;
+    }
+    M = new double[startM[numBlocks]];
+  } else if (pcType == KRYLOV_PC_UP) {
+    // the blocks hold the displacement dofs of the nodes only
+    int *pressureEqn = theSOE->pressureEqn;
+    startM = new int[numBlocks+1];
+    startM[0] = 0;
+    for (int I=0; I<numBlocks; I++) {
+      int n = 0;
+      for (int i=blockStart[I]; i<blockStart[I+1]; i++)
+	if (pressureEqn[i] == 0)
+	  n++;
+      startM[I+1] = startM[I] + n*n;
+    }
+    M = new double[startM[numBlocks]+1];
+    invS = new double[size];
+  }
+
+  if (method == KRYLOV_CG)
+    work = new double[4*size];
+  else
+    work = new double[8*size];
+
+  return 0;
+}
+
+
+int
+SparseBlockRowKrylovSolver::solve(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING SparseBlockRowKrylovSolver::solve() - no SOE set\n";
+    return -1;
+  }
+
+  if (size == 0)
+    return 0;
+
+  if (theSOE->factored == false)
+    if (this->formPreconditioner() < 0)
+      return -1;
+
+  int result = 0;
+  if (method == KRYLOV_CG)
+    result = this->solveCG();
+  else
+    result = this->solveBiCGStab();
+
+  if (result < 0) {
+    opserr << "WARNING SparseBlockRowKrylovSolver::solve() - failed to converge in ";
+    opserr << numIter << " iterations\n";
+    return -3;
+  }
+
+  theSOE->factored = true;
+  return 0;
+}
+
+
+// inverts the n x n row-major block Mb in place by Gauss-Jordan with
+// partial pivoting, returns -1 if the block is singular
+static int
+invertBlock(double *Mb, int n, int *piv)
+{
+  for (int c=0; c<n; c++) {
+    int p = c;
+    for (int r=c+1; r<n; r++)
+      if (fabs(Mb[r*n+c]) > fabs(Mb[p*n+c]))
+	p = r;
+    if (Mb[p*n+c] == 0.0)
+      return -1;
+    piv[c] = p;
+    if (p != c)
+      for (int j=0; j<n; j++) {
+	double tmp = Mb[c*n+j]; Mb[c*n+j] = Mb[p*n+j]; Mb[p*n+j] = tmp;
+      }
+    double invPivot = 1.0/Mb[c*n+c];
+    Mb[c*n+c] = 1.0;
+    for (int j=0; j<n; j++)
+      Mb[c*n+j] *= invPivot;
+    for (int r=0; r<n; r++)
+      if (r != c) {
+	double f = Mb[r*n+c];
+	Mb[r*n+c] = 0.0;
+	for (int j=0; j<n; j++)
+	  Mb[r*n+j] -= f*Mb[c*n+j];
+      }
+  }
+
+  // undo the row interchanges as column interchanges
+  for (int c=n-1; c>=0; c--)
+    if (piv[c] != c)
+      for (int r=0; r<n; r++) {
+	double tmp = Mb[r*n+c]; Mb[r*n+c] = Mb[r*n+piv[c]]; Mb[r*n+piv[c]] = tmp;
+      }
+
+  return 0;
+}
+
+
+int
+SparseBlockRowKrylovSolver::formPreconditioner(void)
+{
+  double *A = theSOE->A;
+  int numBlocks = theSOE->numBlocks;
+  int *blockStart = theSOE->blockStart;
+  int *valStart = theSOE->valStart;
+  int *diagBlock = theSOE->diagBlock;
+
+  if (pcType == KRYLOV_PC_JACOBI) {
+
+    for (int I=0; I<numBlocks; I++) {
+      int n = blockStart[I+1] - blockStart[I];
+      const double *Ab = A + valStart[diagBlock[I]];
+      for (int i=0; i<n; i++) {
+	double aii = Ab[i*n+i];
+	M[blockStart[I]+i] = (aii != 0.0) ? 1.0/aii : 1.0;
+      }
+    }
+
+  } else if (pcType == KRYLOV_PC_BLOCKJACOBI) {
+
+    // each diagonal block is inverted in place by Gauss-Jordan with
+    // partial pivoting; a singular block is replaced by its inverted
+    // diagonal
+    int maxN = 0;
+    for (int I=0; I<numBlocks; I++)
+      if (blockStart[I+1] - blockStart[I] > maxN)
+	maxN = blockStart[I+1] - blockStart[I];
+    int *piv = new int[maxN];
+
+    for (int I=0; I<numBlocks; I++) {
+      int n = blockStart[I+1] - blockStart[I];
+      const double *Ab = A + valStart[diagBlock[I]];
+      double *Mb = M + startM[I];
+      for (int i=0; i<n*n; i++)
+	Mb[i] = Ab[i];
+
+      if (invertBlock(Mb, n, piv) < 0) {
+	for (int i=0; i<n*n; i++)
+	  Mb[i] = 0.0;
+	for (int i=0; i<n; i++) {
+	  double aii = Ab[i*n+i];
+	  Mb[i*n+i] = (aii != 0.0) ? 1.0/aii : 1.0;
+	}
+      }
+    }
+    delete [] piv;
+
+  } else if (pcType == KRYLOV_PC_UP) {
+
+    int *rowStart = theSOE->rowStart;
+    int *colBlock = theSOE->colBlock;
+    int *pressureEqn = theSOE->pressureEqn;
+
+    int maxN = 0;
+    for (int I=0; I<numBlocks; I++)
+      if (blockStart[I+1] - blockStart[I] > maxN)
+	maxN = blockStart[I+1] - blockStart[I];
+    int *piv = new int[2*maxN];
+    int *loc = piv + maxN;
+
+    // the displacement dofs of each node block, inverted as for block
+    // Jacobi
+    for (int I=0; I<numBlocks; I++) {
+      int i0 = blockStart[I];
+      int n = blockStart[I+1] - i0;
+      int nu = 0;
+      for (int i=0; i<n; i++)
+	if (pressureEqn[i0+i] == 0)
+	  loc[nu++] = i;
+      const double *Ab = A + valStart[diagBlock[I]];
+      double *Mb = M + startM[I];
+      for (int i=0; i<nu; i++)
+	for (int j=0; j<nu; j++)
+	  Mb[i*nu+j] = Ab[loc[i]*n+loc[j]];
+
+      if (invertBlock(Mb, nu, piv) < 0) {
+	for (int i=0; i<nu*nu; i++)
+	  Mb[i] = 0.0;
+	for (int i=0; i<nu; i++) {
+	  double aii = Ab[loc[i]*n+loc[i]];
+	  Mb[i*nu+i] = (aii != 0.0) ? 1.0/aii : 1.0;
+	}
+      }
+    }
+
+    // the diagonal of the Schur complement S = App - Apu diag(Auu)^-1 Aup,
+    // the Aup terms taken from the transposed blocks of the block row
+    // of each coupled block
+    for (int I=0; I<numBlocks; I++) {
+      int i0 = blockStart[I];
+      int n = blockStart[I+1] - i0;
+      for (int i=0; i<n; i++) {
+	if (pressureEqn[i0+i] == 0)
+	  continue;
+	double sii = A[valStart[diagBlock[I]] + i*n+i];
+	for (int k=rowStart[I]; k<rowStart[I+1]; k++) {
+	  int J = colBlock[k];
+	  int j0 = blockStart[J];
+	  int nJ = blockStart[J+1] - j0;
+	  int *kJI = std::lower_bound(colBlock+rowStart[J], colBlock+rowStart[J+1], I);
+	  if (kJI == colBlock+rowStart[J+1] || *kJI != I)
+	    continue;
+	  const double *AIJ = A + valStart[k];
+	  const double *AJI = A + valStart[kJI-colBlock];
+	  const double *AJJ = A + valStart[diagBlock[J]];
+	  for (int j=0; j<nJ; j++) {
+	    double ajj = AJJ[j*nJ+j];
+	    if (pressureEqn[j0+j] == 0 && ajj != 0.0)
+	      sii -= AIJ[i*nJ+j]*AJI[j*n+i]/ajj;
+	  }
+	}
+	invS[i0+i] = (sii != 0.0) ? 1.0/sii : 1.0;
+      }
+    }
+    delete [] piv;
+  }
+
+  return 0;
+}
+
+
+void
+SparseBlockRowKrylovSolver::applyPreconditioner(const double *r, double *z)
+{
+  switch (pcType) {
+  case KRYLOV_PC_JACOBI:
+    for (int i=0; i<size; i++)
+      z[i] = M[i]*r[i];
+    break;
+
+  case KRYLOV_PC_BLOCKJACOBI: {
+    int numBlocks = theSOE->numBlocks;
+    int *blockStart = theSOE->blockStart;
+    for (int I=0; I<numBlocks; I++) {
+      int i0 = blockStart[I];
+      int n = blockStart[I+1] - i0;
+      const double *Mb = M + startM[I];
+      for (int i=0; i<n; i++) {
+	double tmp = 0.0;
+	for (int j=0; j<n; j++)
+	  tmp += Mb[i*n+j]*r[i0+j];
+	z[i0+i] = tmp;
+      }
+    }
+    break;
+  }
+
+  case KRYLOV_PC_UP: {
+    // block lower triangular: zu = Auu^-1 ru, zp = S^-1 (rp - Apu zu)
+    int numBlocks = theSOE->numBlocks;
+    int *blockStart = theSOE->blockStart;
+    int *rowStart = theSOE->rowStart;
+    int *colBlock = theSOE->colBlock;
+    int *valStart = theSOE->valStart;
+    int *pressureEqn = theSOE->pressureEqn;
+    double *A = theSOE->A;
+
+    for (int I=0; I<numBlocks; I++) {
+      int i0 = blockStart[I];
+      int n = blockStart[I+1] - i0;
+      const double *Mb = M + startM[I];
+      int nu = 0;
+      for (int i=0; i<n; i++)
+	if (pressureEqn[i0+i] == 0)
+	  nu++;
+      for (int i=0, ii=0; i<n; i++) {
+	z[i0+i] = 0.0;
+	if (pressureEqn[i0+i] != 0)
+	  continue;
+	double tmp = 0.0;
+	for (int j=0, jj=0; j<n; j++)
+	  if (pressureEqn[i0+j] == 0)
+	    tmp += Mb[ii*nu+(jj++)]*r[i0+j];
+	z[i0+i] = tmp;
+	ii++;
+      }
+    }
+
+    for (int I=0; I<numBlocks; I++) {
+      int i0 = blockStart[I];
+      int n = blockStart[I+1] - i0;
+      for (int i=0; i<n; i++) {
+	if (pressureEqn[i0+i] == 0)
+	  continue;
+	double tmp = r[i0+i];
+	for (int k=rowStart[I]; k<rowStart[I+1]; k++) {
+	  int J = colBlock[k];
+	  int j0 = blockStart[J];
+	  int nJ = blockStart[J+1] - j0;
+	  const double *AIJ = A + valStart[k] + i*nJ;
+	  for (int j=0; j<nJ; j++)
+	    if (pressureEqn[j0+j] == 0)
+	      tmp -= AIJ[j]*z[j0+j];
+	}
+	z[i0+i] = invS[i0+i]*tmp;
+      }
+    }
+    break;
+  }
+
+  default:
+    for (int i=0; i<size; i++)
+      z[i] = r[i];
+  }
+}
+
+
+static double
+dotProduct(const double *a, const double *b, int n)
+{
+  double sum = 0.0;
+  for (int i=0; i<n; i++)
+    sum += a[i]*b[i];
+  return sum;
+}
+
+
+int
+SparseBlockRowKrylovSolver::solveCG(void)
+{
+  int n = size;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  double *r = work;
+  double *z = work + n;
+  double *p = work + 2*n;
+  double *q = work + 3*n;
+
+  numIter = 0;
+  double normB = sqrt(dotProduct(B, B, n));
+  if (normB == 0.0) {
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+    return 0;
+  }
+  double normStop = tol*normB;
+
+  // start from the last solution unless it is worse than starting from 0
+  theSOE->formAx(X, r);
+  for (int i=0; i<n; i++)
+    r[i] = B[i] - r[i];
+  double normR = sqrt(dotProduct(r, r, n));
+  if (normR > normB) {
+    for (int i=0; i<n; i++) {
+      X[i] = 0.0;
+      r[i] = B[i];
+    }
+    normR = normB;
+  }
+  if (normR <= normStop)
+    return 0;
+
+  this->applyPreconditioner(r, z);
+  for (int i=0; i<n; i++)
+    p[i] = z[i];
+  double rz = dotProduct(r, z, n);
+
+  while (numIter < maxIter) {
+    numIter++;
+    theSOE->formAx(p, q);
+    double pq = dotProduct(p, q, n);
+    if (pq <= 0.0)
+      return -2;
+
+    double alpha = rz/pq;
+    for (int i=0; i<n; i++) {
+      X[i] += alpha*p[i];
+      r[i] -= alpha*q[i];
+    }
+    normR = sqrt(dotProduct(r, r, n));
+    if (normR <= normStop)
+      return 0;
+
+    this->applyPreconditioner(r, z);
+    double rzNew = dotProduct(r, z, n);
+    double beta = rzNew/rz;
+    rz = rzNew;
+    for (int i=0; i<n; i++)
+      p[i] = z[i] + beta*p[i];
+  }
+
+  return -1;
+}
+
+
+int
+SparseBlockRowKrylovSolver::solveBiCGStab(void)
+{
+  int n = size;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  double *r = work;
+  double *rHat = work + n;
+  double *p = work + 2*n;
+  double *v = work + 3*n;
+  double *s = work + 4*n;
+  double *t = work + 5*n;
+  double *pHat = work + 6*n;
+  double *sHat = work + 7*n;
+
+  numIter = 0;
+  double normB = sqrt(dotProduct(B, B, n));
+  if (normB == 0.0) {
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+    return 0;
+  }
+  double normStop = tol*normB;
+
+  theSOE->formAx(X, r);
+  for (int i=0; i<n; i++)
+    r[i] = B[i] - r[i];
+  double normR = sqrt(dotProduct(r, r, n));
+  if (normR > normB) {
+    for (int i=0; i<n; i++) {
+      X[i] = 0.0;
+      r[i] = B[i];
+    }
+    normR = normB;
+  }
+  if (normR <= normStop)
+    return 0;
+
+  for (int i=0; i<n; i++) {
+    rHat[i] = r[i];
+    p[i] = 0.0;
+    v[i] = 0.0;
+  }
+  double rho = 1.0, alpha = 1.0, omega = 1.0;
+
+  while (numIter < maxIter) {
+    numIter++;
+    double rhoNew = dotProduct(rHat, r, n);
+    if (rhoNew == 0.0)
+      return -2;
+
+    double beta = (rhoNew/rho)*(alpha/omega);
+    for (int i=0; i<n; i++)
+      p[i] = r[i] + beta*(p[i] - omega*v[i]);
+
+    this->applyPreconditioner(p, pHat);
+    theSOE->formAx(pHat, v);
+    double rHatv = dotProduct(rHat, v, n);
+    if (rHatv == 0.0)
+      return -2;
+    alpha = rhoNew/rHatv;
+
+    for (int i=0; i<n; i++)
+      s[i] = r[i] - alpha*v[i];
+    double normS = sqrt(dotProduct(s, s, n));
+    if (normS <= normStop) {
+      for (int i=0; i<n; i++)
+	X[i] += alpha*pHat[i];
+      return 0;
+    }
+
+    this->applyPreconditioner(s, sHat);
+    theSOE->formAx(sHat, t);
+    double tt = dotProduct(t, t, n);
+    omega = (tt != 0.0) ? dotProduct(t, s, n)/tt : 0.0;
+
+    for (int i=0; i<n; i++) {
+      X[i] += alpha*pHat[i] + omega*sHat[i];
+      r[i] = s[i] - omega*t[i];
+    }
+    normR = sqrt(dotProduct(r, r, n));
+    if (normR <= normStop)
+      return 0;
+    if (omega == 0.0)
+      return -2;
+
+    rho = rhoNew;
+  }
+
+  return -1;
+}
+
+
+int
+SparseBlockRowKrylovSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  return 0;
+}
+
+
+int
+SparseBlockRowKrylovSolver::recvSelf(int commitTag, Channel &theChannel,
+				     FEM_ObjectBroker &theBroker)
+{
+  return 0;
+}
@@ -0,0 +1,91 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseBlockRowKrylovSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// SparseBlockRowKrylovSolver. It solves the SparseBlockRowLinSOE with
+// preconditioned conjugate gradients or BiCGStab working on the node
+// blocks of the SOE. The preconditioner is Jacobi or block Jacobi, the
+// latter the inverses of the diagonal node blocks of A. For the coupled
+// displacement - pore pressure systems of the u-p elements there is the u-p
+// preconditioner, a block lower triangular one: the displacement part is
+// block Jacobi on the displacement dofs of each node, the pressure part the
+// inverted diagonal of the Schur complement App - Apu diag(Auu)^-1 Aup. As
+// for SparseGenRowKrylovSolver each solve starts from the X of the last one.
+
+// What: "@(#) SparseBlockRowKrylovSolver.h, revA"
+
+#ifndef SparseBlockRowKrylovSolver_h
+#define SparseBlockRowKrylovSolver_h
+
+#include <LinearSOESolver.h>
+#include <SparseGenRowKrylovSolver.h>
+
+class SparseBlockRowLinSOE;
+
+class SparseBlockRowKrylovSolver : public LinearSOESolver
+{
+  public:
+    SparseBlockRowKrylovSolver(int method = KRYLOV_CG,
+			       int preconditioner = KRYLOV_PC_BLOCKJACOBI,
+			       double tol = 1.0e-8, int maxIter = 1000);
+    ~SparseBlockRowKrylovSolver();
+
+    int solve(void);
+    int setSize(void);
+    int setLinearSOE(SparseBlockRowLinSOE &theSOE);
+
+    int setTolerance(double newTol) {tol = newTol; return 0;}
+    double getTolerance(void) {return tol;}
+    int getNumIterations(void) const {return numIter;}
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int formPreconditioner(void);
+    void applyPreconditioner(const double *r, double *z);
+
+    int solveCG(void);
+    int solveBiCGStab(void);
+
+    SparseBlockRowLinSOE *theSOE;
+
+    int method, pcType;
+    double tol;
+    int maxIter;
+
+    int size;
+    double *M;         // Jacobi: 1/aii, block Jacobi: inverted diagonal blocks
+    int *startM;       // block Jacobi: location of each block in M
+    double *invS;      // u-p: inverted diagonal of the Schur complement
+    double *work;      // work vectors for the methods
+    int numIter;
+};
+
+#endif
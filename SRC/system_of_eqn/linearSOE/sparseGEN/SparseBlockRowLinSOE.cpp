@@ -0,0 +1,471 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseBlockRowLinSOE.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for SparseBlockRowLinSOE
+
+#include <SparseBlockRowLinSOE.h>
+#include <SparseBlockRowKrylovSolver.h>
+#include <Matrix.h>
+#include <Graph.h>
+#include <Vertex.h>
+#include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
+#include <Node.h>
+#include <ThreadPool.h>
+#include <math.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <vector>
+
+#include <Channel.h>
+#include <FEM_ObjectBroker.h>
+
+SparseBlockRowLinSOE::SparseBlockRowLinSOE(SparseBlockRowKrylovSolver &the_Solver)
+:LinearSOE(the_Solver, LinSOE_TAGS_SparseBlockRowLinSOE),
+ size(0), numBlocks(0), nnzBlocks(0),
+ blockStart(0), blockOf(0), rowStart(0), colBlock(0), valStart(0), diagBlock(0),
+ pressureEqn(0), numPressureEqn(0),
+ A(0), B(0), X(0), vectX(0), vectB(0),
+ Asize(0), Bsize(0),
+ factored(false)
+{
+    the_Solver.setLinearSOE(*this);
+}
+
+
+SparseBlockRowLinSOE::~SparseBlockRowLinSOE()
+{
+    if (blockStart != 0) delete [] blockStart;
+    if (blockOf != 0) delete [] blockOf;
+    if (rowStart != 0) delete [] rowStart;
+    if (colBlock != 0) delete [] colBlock;
+    if (valStart != 0) delete [] valStart;
+    if (diagBlock != 0) delete [] diagBlock;
+    if (pressureEqn != 0) delete [] pressureEqn;
+    if (A != 0) delete [] A;
+    if (B != 0) delete [] B;
+    if (X != 0) delete [] X;
+    if (vectX != 0) delete vectX;
+    if (vectB != 0) delete vectB;
+}
+
+
+int
+SparseBlockRowLinSOE::getNumEqn(void) const
+{
+    return size;
+}
+
+size_t
+SparseBlockRowLinSOE::getNumBytes(void)
+{
+    return Asize*sizeof(double) +
+	(3*(size+1) + 2*(numBlocks+1) + 2*(nnzBlocks+1))*sizeof(int) +
+	this->LinearSOE::getNumBytes();
+}
+
+
+int
+SparseBlockRowLinSOE::setSize(Graph &theGraph)
+{
+    int oldSize = size;
+    size = theGraph.getNumVertex();
+
+    if (blockStart != 0) delete [] blockStart;
+    if (blockOf != 0) delete [] blockOf;
+    if (rowStart != 0) delete [] rowStart;
+    if (colBlock != 0) delete [] colBlock;
+    if (valStart != 0) delete [] valStart;
+    if (diagBlock != 0) delete [] diagBlock;
+    if (pressureEqn != 0) delete [] pressureEqn;
+    blockStart = 0; blockOf = 0; rowStart = 0;
+    colBlock = 0; valStart = 0; diagBlock = 0;
+    pressureEqn = 0;
+    numBlocks = 0;
+    nnzBlocks = 0;
+    numPressureEqn = 0;
+
+    // mark the equations starting a block: 1 for the first equation of a
+    // run of consecutive equations of a DOF_Group, 2 for the others of
+    // the run, 0 for those in no run (each a block of its own)
+    blockOf = new int[size+1];
+    pressureEqn = new int[size+1];
+    for (int i=0; i<size; i++) {
+	blockOf[i] = 0;
+	pressureEqn[i] = 0;
+    }
+
+    if (theModel != 0) {
+	DOF_Group *dofPtr;
+	DOF_GrpIter &theDOFs = theModel->getDOFs();
+	std::vector<int> eqns;
+	while ((dofPtr = theDOFs()) != 0) {
+	    const ID &theID = dofPtr->getID();
+
+	    // the last dof of a node of a u-p element, e.g. BrickUP or
+	    // FourNodeQuadUP, is the pore pressure
+	    Node *theNode = dofPtr->getResponseNode();
+	    int numDOF = theID.Size();
+	    if (theNode != 0 && numDOF == theNode->getCrds().Size()+1) {
+		int eqn = theID(numDOF-1);
+		if (eqn >= 0 && eqn < size) {
+		    pressureEqn[eqn] = 1;
+		    numPressureEqn++;
+		}
+	    }
+
+	    eqns.clear();
+	    for (int i=0; i<theID.Size(); i++)
+		if (theID(i) >= 0 && theID(i) < size)
+		    eqns.push_back(theID(i));
+	    std::sort(eqns.begin(), eqns.end());
+	    for (int i=0; i<(int)eqns.size(); i++)
+		blockOf[eqns[i]] = (i > 0 && eqns[i] == eqns[i-1]+1) ? 2 : 1;
+	}
+    }
+
+    blockStart = new int[size+1];
+    for (int i=0; i<size; i++) {
+	if (blockOf[i] != 2 || i == 0)
+	    blockStart[numBlocks++] = i;
+	blockOf[i] = numBlocks-1;
+    }
+    blockStart[numBlocks] = size;
+
+    // the block graph: block I is coupled to the blocks of the equations
+    // adjacent to any of its equations
+    rowStart = new int[numBlocks+1];
+    diagBlock = new int[numBlocks+1];
+    std::vector<int> cols;
+    std::vector<int> marker(numBlocks, -1);
+    cols.reserve(8*numBlocks);
+    rowStart[0] = 0;
+    for (int I=0; I<numBlocks; I++) {
+	int first = (int)cols.size();
+	marker[I] = I;
+	cols.push_back(I);
+	for (int a=blockStart[I]; a<blockStart[I+1]; a++) {
+	    Vertex *theVertex = theGraph.getVertexPtr(a);
+	    if (theVertex == 0) {
+		opserr << "WARNING:SparseBlockRowLinSOE::setSize :";
+		opserr << " vertex " << a << " not in graph! - size set to 0\n";
+		size = 0;
+		numBlocks = 0;
+		return -1;
+	    }
+	    const ID &theAdjacency = theVertex->getAdjacency();
+	    for (int i=0; i<theAdjacency.Size(); i++) {
+		int eqn = theAdjacency(i);
+		if (eqn < 0 || eqn >= size)
+		    continue;
+		int J = blockOf[eqn];
+		if (marker[J] != I) {
+		    marker[J] = I;
+		    cols.push_back(J);
+		}
+	    }
+	}
+	std::sort(cols.begin()+first, cols.end());
+	rowStart[I+1] = (int)cols.size();
+    }
+    nnzBlocks = (int)cols.size();
+
+    colBlock = new int[nnzBlocks+1];
+    valStart = new int[nnzBlocks+1];
+    int newAsize = 0;
+    for (int I=0; I<numBlocks; I++) {
+	int nI = blockStart[I+1] - blockStart[I];
+	for (int k=rowStart[I]; k<rowStart[I+1]; k++) {
+	    int J = cols[k];
+	    colBlock[k] = J;
+	    valStart[k] = newAsize;
+	    newAsize += nI*(blockStart[J+1] - blockStart[J]);
+	    if (J == I)
+		diagBlock[I] = k;
+	}
+    }
+    valStart[nnzBlocks] = newAsize;
+
+    if (newAsize > Asize) {
+	if (A != 0)
+	    delete [] A;
+	A = new double[newAsize];
+	Asize = newAsize;
+    }
+    // zero the matrix, block row by block row by the threads that use
+    // them if pinned
+    std::vector<int> blockRowStart(numBlocks+1);
+    for (int I=0; I<=numBlocks; I++)
+	blockRowStart[I] = valStart[rowStart[I]];
+    ThreadPool::placeRows(A, &blockRowStart[0], numBlocks);
+    for (int i=newAsize; i<Asize; i++)
+	A[i] = 0;
+
+    factored = false;
+
+    if (size > Bsize) {
+	if (B != 0) delete [] B;
+	if (X != 0) delete [] X;
+	B = new double[size];
+	X = new double[size];
+	Bsize = size;
+    }
+    ThreadPool::placeVector(B, size);
+    ThreadPool::placeVector(X, size);
+
+    if (size != oldSize || vectX == 0) {
+	if (vectX != 0)
+	    delete vectX;
+	if (vectB != 0)
+	    delete vectB;
+	vectX = new Vector(X,size);
+	vectB = new Vector(B,size);
+    }
+
+    // invoke setSize() on the Solver
+    LinearSOESolver *the_Solver = this->getSolver();
+    int solverOK = the_Solver->setSize();
+    if (solverOK < 0) {
+	opserr << "WARNING:SparseBlockRowLinSOE::setSize :";
+	opserr << " solver failed setSize()\n";
+	return solverOK;
+    }
+    return 0;
+}
+
+
+int
+SparseBlockRowLinSOE::addA(const Matrix &m, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    int idSize = id.Size();
+
+    // check that m and id are of similar size
+    if (idSize != m.noRows() && idSize != m.noCols()) {
+	opserr << "SparseBlockRowLinSOE::addA() ";
+	opserr << " - Matrix and ID not of similar sizes\n";
+	return -1;
+    }
+
+    for (int i=0; i<idSize; i++) {
+	int row = id(i);
+	if (row < 0 || row >= size)
+	    continue;
+	int I = blockOf[row];
+	int r = row - blockStart[I];
+
+	// the dofs of a node follow one another in id, so the block found
+	// for one column is mostly that of the next
+	int lastJ = -1;
+	int k = -1;
+	for (int j=0; j<idSize; j++) {
+	    int col = id(j);
+	    if (col < 0 || col >= size)
+		continue;
+	    int J = blockOf[col];
+	    if (J != lastJ) {
+		int *first = colBlock + rowStart[I];
+		int *last = colBlock + rowStart[I+1];
+		int *loc = std::lower_bound(first, last, J);
+		if (loc == last || *loc != J) {
+		    opserr << "SparseBlockRowLinSOE::addA() - equation " << col;
+		    opserr << " not in the pattern of row " << row << endln;
+		    lastJ = -1;
+		    continue;
+		}
+		k = (int)(loc - colBlock);
+		lastJ = J;
+	    }
+	    int nJ = blockStart[J+1] - blockStart[J];
+	    A[valStart[k] + r*nJ + col - blockStart[J]] += fact*m(i,j);
+	}
+    }
+
+    return 0;
+}
+
+
+int
+SparseBlockRowLinSOE::addB(const Vector &v, const ID &id, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    int idSize = id.Size();
+    if (idSize != v.Size() ) {
+	opserr << "SparseBlockRowLinSOE::addB() ";
+	opserr << " - Vector and ID not of similar sizes\n";
+	return -1;
+    }
+
+    for (int i=0; i<idSize; i++) {
+	int pos = id(i);
+	if (pos < size && pos >= 0)
+	    B[pos] += v(i) * fact;
+    }
+
+    return 0;
+}
+
+
+int
+SparseBlockRowLinSOE::setB(const Vector &v, double fact)
+{
+    // check for a quick return
+    if (fact == 0.0)  return 0;
+
+    if (v.Size() != size) {
+	opserr << "WARNING SparseBlockRowLinSOE::setB() -";
+	opserr << " incompatible sizes " << size << " and " << v.Size() << endln;
+	return -1;
+    }
+
+    for (int i=0; i<size; i++)
+	B[i] = v(i) * fact;
+
+    return 0;
+}
+
+
+void
+SparseBlockRowLinSOE::zeroA(void)
+{
+    for (int i=0; i<Asize; i++)
+	A[i] = 0;
+
+    factored = false;
+}
+
+
+void
+SparseBlockRowLinSOE::zeroB(void)
+{
+    for (int i=0; i<size; i++)
+	B[i] = 0;
+}
+
+
+void
+SparseBlockRowLinSOE::setX(int loc, double value)
+{
+    if (loc < size && loc >=0)
+	X[loc] = value;
+}
+
+
+void
+SparseBlockRowLinSOE::setX(const Vector &x)
+{
+    if (x.Size() == size && vectX != 0)
+	*vectX = x;
+}
+
+
+const Vector &
+SparseBlockRowLinSOE::getX(void)
+{
+    if (vectX == 0) {
+	opserr << "FATAL SparseBlockRowLinSOE::getX - vectX == 0";
+	exit(-1);
+    }
+    return *vectX;
+}
+
+
+const Vector &
+SparseBlockRowLinSOE::getB(void)
+{
+    if (vectB == 0) {
+	opserr << "FATAL SparseBlockRowLinSOE::getB - vectB == 0";
+	exit(-1);
+    }
+    return *vectB;
+}
+
+
+double
+SparseBlockRowLinSOE::normRHS(void)
+{
+    double norm =0.0;
+    for (int i=0; i<size; i++) {
+	double Yi = B[i];
+	norm += Yi*Yi;
+    }
+    return sqrt(norm);
+}
+
+
+// y = A x, one block row at a time; each block is a small dense
+// matrix-vector product on contiguous data
+void
+SparseBlockRowLinSOE::formAx(const double *x, double *y)
+{
+#ifdef _OPENMP
+    int numThreads = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(static) num_threads(numThreads) if (numThreads > 1 && size > 5000)
+#endif
+    for (int I=0; I<numBlocks; I++) {
+	int i0 = blockStart[I];
+	int nI = blockStart[I+1] - i0;
+	double *yI = y + i0;
+	for (int r=0; r<nI; r++)
+	    yI[r] = 0.0;
+
+	for (int k=rowStart[I]; k<rowStart[I+1]; k++) {
+	    int J = colBlock[k];
+	    int j0 = blockStart[J];
+	    int nJ = blockStart[J+1] - j0;
+	    const double *Ablock = A + valStart[k];
+	    const double *xJ = x + j0;
+	    for (int r=0; r<nI; r++) {
+		double tmp = 0.0;
+		const double *Arow = Ablock + r*nJ;
+		for (int c=0; c<nJ; c++)
+		    tmp += Arow[c]*xJ[c];
+		yI[r] += tmp;
+	    }
+	}
+    }
+}
+
+
+int
+SparseBlockRowLinSOE::sendSelf(int cTag, Channel &theChannel)
+{
+    return 0;
+}
+
+
+int
+SparseBlockRowLinSOE::recvSelf(int cTag, Channel &theChannel,
+			       FEM_ObjectBroker &theBroker)
+{
+    return 0;
+}
@@ -0,0 +1,103 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseBlockRowLinSOE.h,v $
+
+#ifndef SparseBlockRowLinSOE_h
+#define SparseBlockRowLinSOE_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// SparseBlockRowLinSOE. SparseBlockRowLinSOE is a subclass of LinearSOE.
+// It stores the matrix A of Ax=b by node blocks: the equations of A are
+// grouped into blocks of consecutive equations, one for the free dofs of
+// each DOF_Group of the AnalysisModel, and A is stored in block row
+// compressed form, each nonzero block as a dense row-major array. Only one
+// column index and one offset are kept per block, instead of one column
+// index per coefficient. Equations that belong to no DOF_Group, or that are
+// not numbered consecutively within their DOF_Group, form blocks of their
+// own. The pore pressure equations of the nodes of u-p elements, the
+// last dof of a node with one dof more than its number of coordinates, are
+// marked for the u-p preconditioner of SparseBlockRowKrylovSolver.
+//
+// What: "@(#) SparseBlockRowLinSOE.h, revA"
+
+#include <LinearSOE.h>
+#include <Vector.h>
+
+class SparseBlockRowKrylovSolver;
+
+class SparseBlockRowLinSOE : public LinearSOE
+{
+  public:
+    SparseBlockRowLinSOE(SparseBlockRowKrylovSolver &theSolver);
+
+    ~SparseBlockRowLinSOE();
+
+    int getNumEqn(void) const;
+    size_t getNumBytes(void);
+    int setSize(Graph &theGraph);
+    int addA(const Matrix &, const ID &, double fact = 1.0);
+    int addB(const Vector &, const ID &, double fact = 1.0);
+    int setB(const Vector &, double fact = 1.0);
+
+    void zeroA(void);
+    void zeroB(void);
+
+    const Vector &getX(void);
+    const Vector &getB(void);
+    double normRHS(void);
+
+    void setX(int loc, double value);
+    void setX(const Vector &x);
+
+    void formAx(const double *x, double *y);
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);
+
+    friend class SparseBlockRowKrylovSolver;
+
+  protected:
+
+  private:
+    int size;            // order of A
+    int numBlocks;       // number of block rows
+    int nnzBlocks;       // number of nonzero blocks
+    int *blockStart;     // first equation of each block, numBlocks+1
+    int *blockOf;        // block of each equation
+    int *rowStart;       // first nonzero block of each block row, numBlocks+1
+    int *colBlock;       // block column of each nonzero block
+    int *valStart;       // location in A of each nonzero block, nnzBlocks+1
+    int *diagBlock;      // the diagonal block of each block row
+    int *pressureEqn;    // 1 for a pore pressure equation, 0 otherwise
+    int numPressureEqn;
+    double *A, *B, *X;
+    Vector *vectX;
+    Vector *vectB;
+    int Asize, Bsize;
+    bool factored;
+};
+
+
+#endif
@@ -50,7 +50,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternStamp(0)
 {
     the_Solver.setLinearSOE(*this);
 }
@@ -61,7 +61,7 @@ SparseGenColLinSOE::SparseGenColLinSOE()
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternStamp(0)
 {
 
 }
@@ -71,7 +71,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int classTag)
  size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternStamp(0)
 {
 
 }
@@ -82,7 +82,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(SparseGenColLinSolver &the_Solver, int cl
    size(0), nnz(0), A(0), B(0), X(0), rowA(0), colStartA(0),
    vectX(0), vectB(0),
    Asize(0), Bsize(0),
-   factored(false)
+   factored(false), patternStamp(0)
 {
   //    the_Solver.setLinearSOE(*this);
 }
@@ -95,7 +95,7 @@ SparseGenColLinSOE::SparseGenColLinSOE(int N, int NNZ, int *ColStartA, int *RowA
  rowA(RowA), colStartA(ColStartA), 
  vectX(0), vectB(0),
  Asize(0), Bsize(0),
- factored(false)
+ factored(false), patternStamp(0)
 {
 
     A = new (nothrow) double[NNZ];
@@ -160,14 +160,26 @@ SparseGenColLinSOE::getNumEqn(void) const
     return size;
 }
 
+size_t
+SparseGenColLinSOE::getNumBytes(void)
+{
+    return Asize*(sizeof(double)+sizeof(int)) + (size+1)*sizeof(int) +
+	this->LinearSOE::getNumBytes();
+}
+
 int 
 SparseGenColLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
 
     int result = 0;
     int oldSize = size;
+    int oldNNZ = nnz;
     size = theGraph.getNumVertex();
 
+    // any existing scatter map is no longer valid
+    theScatter.clear();
+
     // fist itearte through the vertices of the graph to get nnz
     Vertex *theVertex;
     int newNNZ = 0;
@@ -245,6 +257,21 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	vectB = new Vector(B,size);	
     }
 
+    // keep the old structure if it may be unchanged, so it can be
+    // checked whether the solver can keep its symbolic factorization
+    int *oldRowA = 0;
+    int *oldColStartA = 0;
+    if (size == oldSize && nnz == oldNNZ && size != 0 && result == 0) {
+      oldRowA = new (nothrow) int[nnz];
+      oldColStartA = new (nothrow) int[size+1];
+      if (oldRowA != 0 && oldColStartA != 0) {
+	for (int i=0; i<nnz; i++)
+	  oldRowA[i] = rowA[i];
+	for (int i=0; i<=size; i++)
+	  oldColStartA[i] = colStartA[i];
+      }
+    }
+
     // fill in colStartA and rowA
     if (size != 0) {
       colStartA[0] = 0;
@@ -257,6 +284,11 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
 	  opserr << "WARNING:SparseGenColLinSOE::setSize :";
 	  opserr << " vertex " << a << " not in graph! - size set to 0\n";
 	  size = 0;
+	  patternStamp++;
+	  if (oldRowA != 0)
+	    delete [] oldRowA;
+	  if (oldColStartA != 0)
+	    delete [] oldColStartA;
 	  return -1;
 	}
 
@@ -291,6 +323,24 @@ SparseGenColLinSOE::setSize(Graph &theGraph)
       }
     }
 
+    bool samePattern = (oldRowA != 0 && oldColStartA != 0);
+    for (int i=0; i<=size && samePattern == true; i++)
+      if (oldColStartA[i] != colStartA[i])
+	samePattern = false;
+    for (int i=0; i<nnz && samePattern == true; i++)
+      if (oldRowA[i] != rowA[i])
+	samePattern = false;
+
+    if (oldRowA != 0)
+      delete [] oldRowA;
+    if (oldColStartA != 0)
+      delete [] oldColStartA;
+
+    if (samePattern == false)
+      patternStamp++;
+
+    // build the scatter map for the FE_Elements of the model
+    theScatter.form(theModel, size, colStartA, rowA);
     
     // invoke setSize() on the Solver    
     LinearSOESolver *the_Solver = this->getSolver();
@@ -320,6 +370,27 @@ SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 	return -1;
     }
     
+    // if id is that of an FE_Element in the scatter map use it
+    const int *locPtr = theScatter.find(id);
+    if (locPtr != 0) {
+      if (fact == 1.0) { // do not need to multiply 
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *locPtr++;
+	    if (loc >= 0)
+	      A[loc] += m(j,i);
+	  }
+      } else {
+	for (int i=0; i<idSize; i++)
+	  for (int j=0; j<idSize; j++) {
+	    int loc = *locPtr++;
+	    if (loc >= 0)
+	      A[loc] += fact * m(j,i);
+	  }
+      }
+      return 0;
+    }
+
     if (fact == 1.0) { // do not need to multiply 
       for (int i=0; i<idSize; i++) {
 	int col = id(i);
@@ -438,6 +509,29 @@ SparseGenColLinSOE::zeroA(void)
 	*Aptr++ = 0;
 
     factored = false;
+    theScatter.restart();
+}
+
+int
+SparseGenColLinSOE::saveA(void)
+{
+    return this->copyToBaseA(A, Asize);
+}
+
+int
+SparseGenColLinSOE::restoreA(void)
+{
+    factored = false;
+    theScatter.restart();
+    return this->copyFromBaseA(A, Asize);
+}
+
+int
+SparseGenColLinSOE::domainChanged(void)
+{
+    // the sparsity is unchanged but the FE_Elements are new
+    theScatter.form(theModel, size, colStartA, rowA);
+    return this->LinearSOE::domainChanged();
 }
 	
 void 
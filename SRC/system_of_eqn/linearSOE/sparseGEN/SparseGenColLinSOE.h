@@ -38,6 +38,7 @@
 
 #include <LinearSOE.h>
 #include <Vector.h>
+#include <ScatterMap.h>
 
 class SparseGenColLinSolver;
 
@@ -61,6 +62,10 @@ class SparseGenColLinSOE : public LinearSOE
     
     virtual void zeroA(void);
     virtual void zeroB(void);
+    virtual int saveA(void);
+    virtual int restoreA(void);
+    virtual int domainChanged(void);
+    virtual size_t getNumBytes(void);
     
     virtual const Vector &getX(void);
     virtual const Vector &getB(void);    
@@ -96,9 +101,10 @@ class SparseGenColLinSOE : public LinearSOE
     Vector *vectB;    
     int Asize, Bsize;    // size of the 1d array holding A
     bool factored;
+    int patternStamp;    // changed by setSize() only if rowA or colStartA change
     
   private:
-
+    ScatterMap theScatter;  // built in setSize(), so that addA() does not search rowA
 };
 
 
@@ -0,0 +1,616 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMG.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for SparseGenRowAMG.
+
+// What: "@(#) SparseGenRowAMG.C, revA"
+
+#include <SparseGenRowAMG.h>
+#include <OPS_Globals.h>
+#include <math.h>
+
+#ifdef _WIN32
+extern "C" int  DGETRF(int *M, int *N, double *A, int *LDA,
+			      int *iPiv, int *INFO);
+
+extern "C" int  DGETRS(char *TRANS, unsigned int sizeT,
+			       int *N, int *NRHS, double *A, int *LDA,
+			       int *iPiv, double *B, int *LDB, int *INFO);
+#else
+extern "C" int dgetrf_(int *M, int *N, double *A, int *LDA,
+		       int *iPiv, int *INFO);
+
+extern "C" int dgetrs_(char *TRANS, int *N, int *NRHS, double *A, int *LDA,
+		       int *iPiv, double *B, int *LDB, int *INFO);
+#endif
+
+// the coarsest matrix is factored densely up to this size, beyond that it
+// is smoothed
+#define AMG_MAX_DENSE 3000
+
+// C = A B, A being nA x ?, B ? x ncB, all in row compressed storage
+static void
+multiply(int nA, const int *rsA, const int *cA, const double *vA,
+	 const int *rsB, const int *cB, const double *vB, int ncB,
+	 std::vector<int> &rsC, std::vector<int> &cC, std::vector<double> &vC)
+{
+  std::vector<int> marker(ncB, -1);
+  std::vector<double> acc(ncB, 0.0);
+  rsC.assign(nA+1, 0);
+  cC.clear();
+  vC.clear();
+
+  for (int i=0; i<nA; i++) {
+    int rowStart = (int)cC.size();
+    for (int p=rsA[i]; p<rsA[i+1]; p++) {
+      int j = cA[p];
+      double aij = vA[p];
+      for (int q=rsB[j]; q<rsB[j+1]; q++) {
+	int k = cB[q];
+	if (marker[k] < rowStart) {
+	  marker[k] = (int)cC.size();
+	  cC.push_back(k);
+	  acc[k] = 0.0;
+	}
+	acc[k] += aij*vB[q];
+      }
+    }
+    for (int q=rowStart; q<(int)cC.size(); q++)
+      vC.push_back(acc[cC[q]]);
+    rsC[i+1] = (int)cC.size();
+  }
+}
+
+// T = A^t, A being nA x ncA
+static void
+transpose(int nA, int ncA, const int *rsA, const int *cA, const double *vA,
+	  std::vector<int> &rsT, std::vector<int> &cT, std::vector<double> &vT)
+{
+  int nnz = rsA[nA];
+  rsT.assign(ncA+1, 0);
+  cT.resize(nnz);
+  vT.resize(nnz);
+
+  for (int p=0; p<nnz; p++)
+    rsT[cA[p]+1]++;
+  for (int j=0; j<ncA; j++)
+    rsT[j+1] += rsT[j];
+
+  std::vector<int> next(rsT.begin(), rsT.end()-1);
+  for (int i=0; i<nA; i++)
+    for (int p=rsA[i]; p<rsA[i+1]; p++) {
+      int loc = next[cA[p]]++;
+      cT[loc] = i;
+      vT[loc] = vA[p];
+    }
+}
+
+
+SparseGenRowAMG::SparseGenRowAMG(int maxL, int cSize, double th, int nSweeps)
+:maxLevels(maxL), coarseSize(cSize), theta(th), numSweeps(nSweeps)
+{
+  if (maxLevels < 1)
+    maxLevels = 1;
+  if (numSweeps < 1)
+    numSweeps = 1;
+}
+
+
+SparseGenRowAMG::~SparseGenRowAMG()
+{
+  this->clear();
+}
+
+
+void
+SparseGenRowAMG::clear(void)
+{
+  for (int l=0; l<(int)levels.size(); l++)
+    delete levels[l];
+  levels.clear();
+  coarseLU.clear();
+  coarsePiv.clear();
+}
+
+
+int
+SparseGenRowAMG::setup(int n, const int *rowStart, const int *col,
+		       const double *A, const int *nodeOf0, int numNodes0,
+		       const double *nullSpace, int numNull)
+{
+  this->clear();
+
+  Level *fine = new Level;
+  fine->n = n;
+  fine->rowStart = rowStart;
+  fine->col = col;
+  fine->val = A;
+  levels.push_back(fine);
+
+  std::vector<int> nodeOf(nodeOf0, nodeOf0+n);
+  int numNodes = numNodes0;
+  int k = (numNull > 0) ? numNull : 1;
+  std::vector<double> B;
+  if (numNull > 0)
+    B.assign(nullSpace, nullSpace + n*numNull);
+  else
+    B.assign(n, 1.0);
+
+  while (true) {
+
+    Level &F = *levels.back();
+    int nF = F.n;
+    const int *rs = F.rowStart;
+    const int *cl = F.col;
+    const double *va = F.val;
+
+    F.invDiag.assign(nF, 1.0);
+    for (int i=0; i<nF; i++)
+      for (int p=rs[i]; p<rs[i+1]; p++)
+	if (cl[p] == i && va[p] != 0.0)
+	  F.invDiag[i] = 1.0/va[p];
+    F.x.assign(nF, 0.0);
+    F.b.assign(nF, 0.0);
+    F.r.assign(nF, 0.0);
+
+    if (nF <= coarseSize || (int)levels.size() >= maxLevels)
+      break;
+
+    //
+    // strength of the coupling between nodes, from the Frobenius norms of
+    // the blocks of A: J is a strong neighbour of I if
+    // |A_IJ| >= theta sqrt(|A_II| |A_JJ|)
+    //
+
+    std::vector<double> normII(numNodes, 0.0);
+    for (int i=0; i<nF; i++)
+      for (int p=rs[i]; p<rs[i+1]; p++)
+	if (nodeOf[cl[p]] == nodeOf[i])
+	  normII[nodeOf[i]] += va[p]*va[p];
+    for (int I=0; I<numNodes; I++)
+      normII[I] = sqrt(normII[I]);
+
+    std::vector<int> nodeStart(numNodes+1, 0), nodeEqn(nF);
+    for (int i=0; i<nF; i++)
+      nodeStart[nodeOf[i]+1]++;
+    for (int I=0; I<numNodes; I++)
+      nodeStart[I+1] += nodeStart[I];
+    {
+      std::vector<int> next(nodeStart.begin(), nodeStart.end()-1);
+      for (int i=0; i<nF; i++)
+	nodeEqn[next[nodeOf[i]]++] = i;
+    }
+
+    std::vector<int> gStart(numNodes+1, 0), gAdj;
+    std::vector<double> gStr;
+    {
+      std::vector<int> mark(numNodes, -1);
+      std::vector<double> w(numNodes, 0.0);
+      std::vector<int> touched;
+      for (int I=0; I<numNodes; I++) {
+	touched.clear();
+	for (int e=nodeStart[I]; e<nodeStart[I+1]; e++) {
+	  int i = nodeEqn[e];
+	  for (int p=rs[i]; p<rs[i+1]; p++) {
+	    int J = nodeOf[cl[p]];
+	    if (J == I)
+	      continue;
+	    if (mark[J] != I) {
+	      mark[J] = I;
+	      w[J] = 0.0;
+	      touched.push_back(J);
+	    }
+	    w[J] += va[p]*va[p];
+	  }
+	}
+	for (int t=0; t<(int)touched.size(); t++) {
+	  int J = touched[t];
+	  double sIJ = sqrt(w[J]);
+	  if (sIJ > 0.0 && sIJ >= theta*sqrt(normII[I]*normII[J])) {
+	    gAdj.push_back(J);
+	    gStr.push_back(sIJ);
+	  }
+	}
+	gStart[I+1] = (int)gAdj.size();
+      }
+    }
+
+    //
+    // aggregation: first whole neighbourhoods, then the nodes left join
+    // the aggregate they are most strongly coupled to, then what remains
+    // forms new aggregates with its unaggregated neighbours
+    //
+
+    std::vector<int> agg(numNodes, -1);
+    int numAgg = 0;
+    for (int I=0; I<numNodes; I++) {
+      if (agg[I] >= 0 || gStart[I+1] == gStart[I])
+	continue;
+      bool free = true;
+      for (int q=gStart[I]; q<gStart[I+1] && free; q++)
+	if (agg[gAdj[q]] >= 0)
+	  free = false;
+      if (free == false)
+	continue;
+      agg[I] = numAgg;
+      for (int q=gStart[I]; q<gStart[I+1]; q++)
+	agg[gAdj[q]] = numAgg;
+      numAgg++;
+    }
+
+    std::vector<int> joined(agg);
+    for (int I=0; I<numNodes; I++) {
+      if (agg[I] >= 0)
+	continue;
+      double best = 0.0;
+      for (int q=gStart[I]; q<gStart[I+1]; q++)
+	if (agg[gAdj[q]] >= 0 && gStr[q] > best) {
+	  best = gStr[q];
+	  joined[I] = agg[gAdj[q]];
+	}
+    }
+    agg = joined;
+
+    for (int I=0; I<numNodes; I++) {
+      if (agg[I] >= 0)
+	continue;
+      agg[I] = numAgg;
+      for (int q=gStart[I]; q<gStart[I+1]; q++)
+	if (agg[gAdj[q]] < 0)
+	  agg[gAdj[q]] = numAgg;
+      numAgg++;
+    }
+
+    if (numAgg >= numNodes)
+      break;
+
+    //
+    // tentative prolongator: the near null space restricted to each
+    // aggregate is orthonormalized, B_a = Q_a R_a, by modified Gram-Schmidt,
+    // dropping the dependent vectors; Q_a gives the columns of P for the
+    // aggregate and R_a the coarse near null space
+    //
+
+    std::vector<int> aggStart(numAgg+1, 0), aggEqn(nF);
+    for (int i=0; i<nF; i++)
+      aggStart[agg[nodeOf[i]]+1]++;
+    for (int a=0; a<numAgg; a++)
+      aggStart[a+1] += aggStart[a];
+    {
+      std::vector<int> next(aggStart.begin(), aggStart.end()-1);
+      for (int i=0; i<nF; i++)
+	aggEqn[next[agg[nodeOf[i]]]++] = i;
+    }
+
+    std::vector<int> coarseBase(numAgg+1, 0);
+    std::vector<int> eqnLocal(nF);
+    std::vector<double> Q(nF*k, 0.0);   // row i of Q at Q[i*k]
+    std::vector<double> Rall;           // R_a rows, k long, by aggregate
+    std::vector<int> coarseNodeOf;
+
+    for (int a=0; a<numAgg; a++) {
+      int m = aggStart[a+1] - aggStart[a];
+      const int *eqns = &aggEqn[aggStart[a]];
+      for (int li=0; li<m; li++)
+	eqnLocal[eqns[li]] = li;
+
+      std::vector<double> V(m*k);       // column c at V[c*m]
+      for (int c=0; c<k; c++)
+	for (int li=0; li<m; li++)
+	  V[c*m+li] = B[c*nF + eqns[li]];
+
+      std::vector<double> R(k*k, 0.0);  // row q at R[q*k]
+      int rank = 0;
+      for (int c=0; c<k && rank<m; c++) {
+	double *v = &V[c*m];
+	double norm0 = 0.0;
+	for (int li=0; li<m; li++)
+	  norm0 += v[li]*v[li];
+	norm0 = sqrt(norm0);
+	for (int q=0; q<rank; q++) {
+	  double *vq = &V[q*m];
+	  double rqc = 0.0;
+	  for (int li=0; li<m; li++)
+	    rqc += vq[li]*v[li];
+	  R[q*k+c] = rqc;
+	  for (int li=0; li<m; li++)
+	    v[li] -= rqc*vq[li];
+	}
+	double norm = 0.0;
+	for (int li=0; li<m; li++)
+	  norm += v[li]*v[li];
+	norm = sqrt(norm);
+	if (norm > 1.0e-10*norm0 && norm > 0.0) {
+	  // keep it as the next column of Q
+	  double *vr = &V[rank*m];
+	  for (int li=0; li<m; li++)
+	    vr[li] = v[li]/norm;
+	  R[rank*k+c] = norm;
+	  rank++;
+	}
+      }
+
+      coarseBase[a+1] = coarseBase[a] + rank;
+      for (int li=0; li<m; li++)
+	for (int q=0; q<rank; q++)
+	  Q[eqns[li]*k+q] = V[q*m+li];
+      for (int q=0; q<rank; q++) {
+	for (int c=0; c<k; c++)
+	  Rall.push_back(R[q*k+c]);
+	coarseNodeOf.push_back(a);
+      }
+    }
+
+    int nC = coarseBase[numAgg];
+    if (nC == 0 || nC >= nF)
+      break;
+
+    std::vector<int> ptRowStart(nF+1, 0), ptCol;
+    std::vector<double> ptVal;
+    for (int i=0; i<nF; i++) {
+      int a = agg[nodeOf[i]];
+      int rank = coarseBase[a+1] - coarseBase[a];
+      for (int q=0; q<rank; q++) {
+	ptCol.push_back(coarseBase[a]+q);
+	ptVal.push_back(Q[i*k+q]);
+      }
+      ptRowStart[i+1] = (int)ptCol.size();
+    }
+
+    //
+    // smoothed prolongator P = (I - omega D^-1 A) Ptent with
+    // omega = 4/3 / rho(D^-1 A), rho estimated by power iterations
+    //
+
+    double rho = 0.0;
+    {
+      std::vector<double> v(nF), w(nF);
+      double norm = 0.0;
+      for (int i=0; i<nF; i++) {
+	v[i] = 1.0 + 0.5*sin(1.0*i);
+	norm += v[i]*v[i];
+      }
+      norm = sqrt(norm);
+      for (int i=0; i<nF; i++)
+	v[i] /= norm;
+      for (int it=0; it<15; it++) {
+	double normW = 0.0;
+	for (int i=0; i<nF; i++) {
+	  double tmp = 0.0;
+	  for (int p=rs[i]; p<rs[i+1]; p++)
+	    tmp += va[p]*v[cl[p]];
+	  w[i] = tmp*F.invDiag[i];
+	  normW += w[i]*w[i];
+	}
+	normW = sqrt(normW);
+	if (normW == 0.0)
+	  break;
+	rho = normW;
+	for (int i=0; i<nF; i++)
+	  v[i] = w[i]/normW;
+      }
+    }
+    double omega = (rho > 0.0) ? 4.0/(3.0*rho) : 0.0;
+
+    {
+      std::vector<int> marker(nC, -1);
+      std::vector<double> acc(nC, 0.0);
+      F.pRowStart.assign(nF+1, 0);
+      F.pCol.clear();
+      F.pVal.clear();
+      for (int i=0; i<nF; i++) {
+	int rowStart = (int)F.pCol.size();
+	double scale = -omega*F.invDiag[i];
+	for (int p=rs[i]; p<rs[i+1]; p++) {
+	  int j = cl[p];
+	  double coef = scale*va[p];
+	  for (int q=ptRowStart[j]; q<ptRowStart[j+1]; q++) {
+	    int c = ptCol[q];
+	    if (marker[c] < rowStart) {
+	      marker[c] = (int)F.pCol.size();
+	      F.pCol.push_back(c);
+	      acc[c] = 0.0;
+	    }
+	    acc[c] += coef*ptVal[q];
+	  }
+	}
+	for (int q=ptRowStart[i]; q<ptRowStart[i+1]; q++) {
+	  int c = ptCol[q];
+	  if (marker[c] < rowStart) {
+	    marker[c] = (int)F.pCol.size();
+	    F.pCol.push_back(c);
+	    acc[c] = 0.0;
+	  }
+	  acc[c] += ptVal[q];
+	}
+	for (int q=rowStart; q<(int)F.pCol.size(); q++)
+	  F.pVal.push_back(acc[F.pCol[q]]);
+	F.pRowStart[i+1] = (int)F.pCol.size();
+      }
+    }
+
+    transpose(nF, nC, &F.pRowStart[0], &F.pCol[0], &F.pVal[0],
+	      F.rRowStart, F.rCol, F.rVal);
+
+    // the coarse matrix R A P
+    std::vector<int> apRowStart, apCol;
+    std::vector<double> apVal;
+    multiply(nF, rs, cl, va, &F.pRowStart[0], &F.pCol[0], &F.pVal[0], nC,
+	     apRowStart, apCol, apVal);
+
+    Level *C = new Level;
+    C->n = nC;
+    multiply(nC, &F.rRowStart[0], &F.rCol[0], &F.rVal[0],
+	     &apRowStart[0], &apCol[0], &apVal[0], nC,
+	     C->ownRowStart, C->ownCol, C->ownVal);
+    C->rowStart = &C->ownRowStart[0];
+    C->col = &C->ownCol[0];
+    C->val = C->ownVal.empty() ? 0 : &C->ownVal[0];
+    levels.push_back(C);
+
+    // the coarse nodes are the aggregates, with R_a as near null space
+    nodeOf = coarseNodeOf;
+    numNodes = numAgg;
+    B.assign(nC*k, 0.0);
+    for (int i=0; i<nC; i++)
+      for (int c=0; c<k; c++)
+	B[c*nC+i] = Rall[i*k+c];
+  }
+
+  // dense LU of the coarsest matrix
+  Level &L = *levels.back();
+  int nL = L.n;
+  if (nL > 0 && nL <= AMG_MAX_DENSE) {
+    coarseLU.assign(nL*nL, 0.0);
+    for (int i=0; i<nL; i++)
+      for (int p=L.rowStart[i]; p<L.rowStart[i+1]; p++)
+	coarseLU[L.col[p]*nL + i] += L.val[p];
+    coarsePiv.assign(nL, 0);
+    int info = 0;
+#ifdef _WIN32
+    DGETRF(&nL, &nL, &coarseLU[0], &nL, &coarsePiv[0], &info);
+#else
+    dgetrf_(&nL, &nL, &coarseLU[0], &nL, &coarsePiv[0], &info);
+#endif
+    if (info != 0) {
+      // singular coarse matrix, smooth instead
+      coarseLU.clear();
+      coarsePiv.clear();
+    }
+  }
+
+  return 0;
+}
+
+
+void
+SparseGenRowAMG::apply(const double *r, double *z)
+{
+  if (levels.empty())
+    return;
+
+  Level &L = *levels[0];
+  for (int i=0; i<L.n; i++)
+    L.b[i] = r[i];
+  this->vcycle(0);
+  for (int i=0; i<L.n; i++)
+    z[i] = L.x[i];
+}
+
+
+void
+SparseGenRowAMG::vcycle(int l)
+{
+  Level &L = *levels[l];
+  int n = L.n;
+  const int *rs = L.rowStart;
+  const int *cl = L.col;
+  const double *va = L.val;
+  double *x = &L.x[0];
+  double *b = &L.b[0];
+
+  if (l == (int)levels.size()-1) {
+    if (coarseLU.empty() == false) {
+      for (int i=0; i<n; i++)
+	x[i] = b[i];
+      char trans[] = "N";
+      int nrhs = 1;
+      int info = 0;
+#ifdef _WIN32
+      DGETRS(trans, 1, &n, &nrhs, &coarseLU[0], &n, &coarsePiv[0], x, &n, &info);
+#else
+      dgetrs_(trans, &n, &nrhs, &coarseLU[0], &n, &coarsePiv[0], x, &n, &info);
+#endif
+      return;
+    }
+
+    // no factorization, symmetric Gauss-Seidel sweeps
+    for (int i=0; i<n; i++)
+      x[i] = 0.0;
+    for (int s=0; s<10; s++) {
+      for (int i=0; i<n; i++) {
+	double tmp = b[i];
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	  tmp -= va[p]*x[cl[p]];
+	x[i] += tmp*L.invDiag[i];
+      }
+      for (int i=n-1; i>=0; i--) {
+	double tmp = b[i];
+	for (int p=rs[i]; p<rs[i+1]; p++)
+	  tmp -= va[p]*x[cl[p]];
+	x[i] += tmp*L.invDiag[i];
+      }
+    }
+    return;
+  }
+
+  // pre-smoothing, forward Gauss-Seidel from x = 0
+  for (int i=0; i<n; i++)
+    x[i] = 0.0;
+  for (int s=0; s<numSweeps; s++)
+    for (int i=0; i<n; i++) {
+      double tmp = b[i];
+      for (int p=rs[i]; p<rs[i+1]; p++)
+	tmp -= va[p]*x[cl[p]];
+      x[i] += tmp*L.invDiag[i];
+    }
+
+  // restrict the residual
+  double *res = &L.r[0];
+  for (int i=0; i<n; i++) {
+    double tmp = b[i];
+    for (int p=rs[i]; p<rs[i+1]; p++)
+      tmp -= va[p]*x[cl[p]];
+    res[i] = tmp;
+  }
+
+  Level &C = *levels[l+1];
+  for (int c=0; c<C.n; c++) {
+    double tmp = 0.0;
+    for (int p=L.rRowStart[c]; p<L.rRowStart[c+1]; p++)
+      tmp += L.rVal[p]*res[L.rCol[p]];
+    C.b[c] = tmp;
+  }
+
+  this->vcycle(l+1);
+
+  // prolongate the correction
+  for (int i=0; i<n; i++) {
+    double tmp = 0.0;
+    for (int p=L.pRowStart[i]; p<L.pRowStart[i+1]; p++)
+      tmp += L.pVal[p]*C.x[L.pCol[p]];
+    x[i] += tmp;
+  }
+
+  // post-smoothing, backward Gauss-Seidel
+  for (int s=0; s<numSweeps; s++)
+    for (int i=n-1; i>=0; i--) {
+      double tmp = b[i];
+      for (int p=rs[i]; p<rs[i+1]; p++)
+	tmp -= va[p]*x[cl[p]];
+      x[i] += tmp*L.invDiag[i];
+    }
+}
@@ -0,0 +1,92 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowAMG.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// SparseGenRowAMG. SparseGenRowAMG is a smoothed aggregation algebraic
+// multigrid hierarchy built from a matrix in row compressed storage, used
+// by SparseGenRowKrylovSolver as a preconditioner. The equations are
+// grouped into nodes; nodes are aggregated over the strong couplings
+// between them and the near null space given for the finest level (the
+// rigid body modes, formed from the nodal coordinates) is restricted to
+// each aggregate and orthonormalized to give the tentative prolongator,
+// which is then smoothed with one damped Jacobi step. The coarse matrices
+// are the Galerkin products R A P. apply() performs one V-cycle with
+// forward Gauss-Seidel before and backward Gauss-Seidel after the coarse
+// correction, which keeps the preconditioner symmetric for CG; the
+// coarsest level is solved with a dense LU factorization.
+
+// What: "@(#) SparseGenRowAMG.h, revA"
+
+#ifndef SparseGenRowAMG_h
+#define SparseGenRowAMG_h
+
+#include <vector>
+
+class SparseGenRowAMG
+{
+  public:
+    SparseGenRowAMG(int maxLevels = 10, int coarseSize = 500,
+		    double theta = 0.08, int numSweeps = 1);
+    ~SparseGenRowAMG();
+
+    // A is n x n in row compressed storage, nodeOf[i] the node of equation
+    // i and nullSpace the numNull near null space vectors, one after the
+    // other; A must stay in place while the hierarchy is used
+    int setup(int n, const int *rowStart, const int *col, const double *A,
+	      const int *nodeOf, int numNodes,
+	      const double *nullSpace, int numNull);
+    void apply(const double *r, double *z);
+
+    int getNumLevels(void) const {return (int)levels.size();}
+
+  private:
+    struct Level {
+      int n;
+      const int *rowStart, *col;   // A; the finest level's is the caller's
+      const double *val;
+      std::vector<int> ownRowStart, ownCol;
+      std::vector<double> ownVal;
+      std::vector<double> invDiag;
+      std::vector<int> pRowStart, pCol;  // prolongator, n x nc
+      std::vector<double> pVal;
+      std::vector<int> rRowStart, rCol;  // restriction, its transpose
+      std::vector<double> rVal;
+      std::vector<double> x, b, r;
+    };
+
+    void clear(void);
+    void vcycle(int level);
+
+    int maxLevels, coarseSize;
+    double theta;
+    int numSweeps;
+
+    std::vector<Level *> levels;
+    std::vector<double> coarseLU;  // dense LU of the coarsest matrix
+    std::vector<int> coarsePiv;
+};
+
+#endif
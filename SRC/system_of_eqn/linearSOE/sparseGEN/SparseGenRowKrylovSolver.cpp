@@ -0,0 +1,1029 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowKrylovSolver.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation for
+// SparseGenRowKrylovSolver.
+
+// What: "@(#) SparseGenRowKrylovSolver.C, revA"
+
+#include <SparseGenRowKrylovSolver.h>
+#include <SparseGenRowLinSOE.h>
+#include <SparseGenRowAMG.h>
+#include <AnalysisModel.h>
+#include <DOF_GrpIter.h>
+#include <DOF_Group.h>
+#include <Domain.h>
+#include <Node.h>
+#include <ID.h>
+#include <Vector.h>
+#include <ThreadPool.h>
+#include <elementAPI.h>
+#include <math.h>
+#include <string.h>
+
+void* OPS_SparseGenRowKrylovSolver()
+{
+    // system Krylov <-cg|-bicgstab|-gmres> <-pc none|jacobi|blockJacobi|ilu|ic|amg>
+    //   <-blockSize n?> <-tol tol?> <-maxIter n?> <-restart m?> <-rebuildTol tol?>
+    int method = KRYLOV_CG;
+    int pcType = -1;
+    double tol = 1.0e-8;
+    int maxIter = 1000;
+    int restart = 50;
+    int blockSize = 3;
+    double rebuildTol = 0.05;
+    int numdata = 1;
+
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *option = OPS_GetString();
+	if (strcmp(option, "-cg") == 0 || strcmp(option, "-pcg") == 0)
+	    method = KRYLOV_CG;
+	else if (strcmp(option, "-bicgstab") == 0)
+	    method = KRYLOV_BICGSTAB;
+	else if (strcmp(option, "-gmres") == 0)
+	    method = KRYLOV_GMRES;
+	else if (strcmp(option, "-pc") == 0 && OPS_GetNumRemainingInputArgs() > 0) {
+	    const char *pc = OPS_GetString();
+	    if (strcmp(pc, "none") == 0)
+		pcType = KRYLOV_PC_NONE;
+	    else if (strcmp(pc, "jacobi") == 0)
+		pcType = KRYLOV_PC_JACOBI;
+	    else if (strcmp(pc, "blockJacobi") == 0)
+		pcType = KRYLOV_PC_BLOCKJACOBI;
+	    else if (strcmp(pc, "ilu") == 0 || strcmp(pc, "ILU0") == 0)
+		pcType = KRYLOV_PC_ILU0;
+	    else if (strcmp(pc, "ic") == 0 || strcmp(pc, "IC0") == 0)
+		pcType = KRYLOV_PC_IC0;
+	    else if (strcmp(pc, "amg") == 0 || strcmp(pc, "AMG") == 0)
+		pcType = KRYLOV_PC_AMG;
+	    else {
+		opserr << "WARNING system Krylov - unknown preconditioner " << pc << endln;
+		return 0;
+	    }
+	} else if (strcmp(option, "-blockSize") == 0) {
+	    if (OPS_GetIntInput(&numdata, &blockSize) < 0) {
+		opserr << "WARNING system Krylov - invalid -blockSize\n";
+		return 0;
+	    }
+	} else if (strcmp(option, "-tol") == 0) {
+	    if (OPS_GetDoubleInput(&numdata, &tol) < 0) {
+		opserr << "WARNING system Krylov - invalid -tol\n";
+		return 0;
+	    }
+	} else if (strcmp(option, "-maxIter") == 0) {
+	    if (OPS_GetIntInput(&numdata, &maxIter) < 0) {
+		opserr << "WARNING system Krylov - invalid -maxIter\n";
+		return 0;
+	    }
+	} else if (strcmp(option, "-restart") == 0) {
+	    if (OPS_GetIntInput(&numdata, &restart) < 0) {
+		opserr << "WARNING system Krylov - invalid -restart\n";
+		return 0;
+	    }
+	} else if (strcmp(option, "-rebuildTol") == 0) {
+	    if (OPS_GetDoubleInput(&numdata, &rebuildTol) < 0) {
+		opserr << "WARNING system Krylov - invalid -rebuildTol\n";
+		return 0;
+	    }
+	}
+    }
+
+    // IC(0) goes with conjugate gradients, ILU(0) with the others
+    if (pcType < 0)
+	pcType = (method == KRYLOV_CG) ? KRYLOV_PC_IC0 : KRYLOV_PC_ILU0;
+
+    SparseGenRowLinSolver *theSolver =
+	new SparseGenRowKrylovSolver(method, pcType, tol, maxIter, restart,
+				     blockSize, rebuildTol);
+    return new SparseGenRowLinSOE(*theSolver);
+}
+
+
+SparseGenRowKrylovSolver::SparseGenRowKrylovSolver(int meth, int pc,
+						   double t, int maxI,
+						   int rstart, int bSize,
+						   double rTol)
+:SparseGenRowLinSolver(SOLVER_TAGS_SparseGenRowKrylovSolver),
+ method(meth), pcType(pc), tol(t), maxIter(maxI), restart(rstart),
+ blockSize(bSize), rebuildTol(rTol),
+ size(0), nnz(0), diagLoc(0), M(0), sizeM(0), A0(0), pcFormed(false),
+ theAMG(0), nodeOf(0), numNodes(0), nullSpace(0), numNull(0),
+ work(0), sizeWork(0), numIter(0)
+{
+  if (restart < 1)
+    restart = 1;
+  if (blockSize < 1)
+    blockSize = 1;
+  if (maxIter < 1)
+    maxIter = 1;
+}
+
+
+SparseGenRowKrylovSolver::~SparseGenRowKrylovSolver()
+{
+  if (diagLoc != 0) delete [] diagLoc;
+  if (M != 0) delete [] M;
+  if (A0 != 0) delete [] A0;
+  if (work != 0) delete [] work;
+  if (theAMG != 0) delete theAMG;
+  if (nodeOf != 0) delete [] nodeOf;
+  if (nullSpace != 0) delete [] nullSpace;
+}
+
+
+int
+SparseGenRowKrylovSolver::setSize(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::setSize() - no SOE set\n";
+    return -1;
+  }
+
+  if (diagLoc != 0) delete [] diagLoc;
+  if (M != 0) delete [] M;
+  if (A0 != 0) delete [] A0;
+  if (work != 0) delete [] work;
+  if (theAMG != 0) delete theAMG;
+  if (nodeOf != 0) delete [] nodeOf;
+  if (nullSpace != 0) delete [] nullSpace;
+  diagLoc = 0;
+  M = 0;
+  A0 = 0;
+  work = 0;
+  theAMG = 0;
+  nodeOf = 0;
+  nullSpace = 0;
+  numNodes = 0;
+  numNull = 0;
+  sizeM = 0;
+  sizeWork = 0;
+  pcFormed = false;
+
+  size = theSOE->size;
+  nnz = theSOE->nnz;
+  if (size == 0)
+    return 0;
+
+  int *rowStartA = theSOE->rowStartA;
+  int *colA = theSOE->colA;
+
+  diagLoc = new int[size];
+  for (int i=0; i<size; i++) {
+    diagLoc[i] = -1;
+    for (int k=rowStartA[i]; k<rowStartA[i+1]; k++)
+      if (colA[k] == i) {
+	diagLoc[i] = k;
+	break;
+      }
+  }
+
+  switch (pcType) {
+  case KRYLOV_PC_JACOBI:
+    sizeM = size;
+    break;
+  case KRYLOV_PC_BLOCKJACOBI:
+    sizeM = ((size + blockSize - 1)/blockSize) * blockSize * blockSize;
+    break;
+  case KRYLOV_PC_ILU0:
+  case KRYLOV_PC_IC0:
+    sizeM = nnz;
+    break;
+  default:
+    sizeM = 0;
+  }
+  if (sizeM != 0)
+    M = new double[sizeM];
+  A0 = new double[nnz];
+
+  if (pcType == KRYLOV_PC_AMG) {
+    theAMG = new SparseGenRowAMG();
+    this->formNearNullSpace();
+  }
+
+  if (method == KRYLOV_CG)
+    sizeWork = 4*size;
+  else if (method == KRYLOV_BICGSTAB)
+    sizeWork = 8*size;
+  else
+    sizeWork = (restart+3)*size + (restart+1)*restart + 3*(restart+1);
+  work = new double[sizeWork];
+
+  return 0;
+}
+
+
+int
+SparseGenRowKrylovSolver::solve(void)
+{
+  if (theSOE == 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::solve() - no SOE set\n";
+    return -1;
+  }
+
+  if (size == 0)
+    return 0;
+
+  // a new A: keep the preconditioner unless A has moved too far from it
+  bool formedNow = false;
+  if (theSOE->factored == false && this->preconditionerIsStale() == true) {
+    if (this->formPreconditioner() < 0)
+      return -1;
+    formedNow = true;
+  }
+
+  int result = 0;
+  if (method == KRYLOV_CG)
+    result = this->solveCG();
+  else if (method == KRYLOV_BICGSTAB)
+    result = this->solveBiCGStab();
+  else
+    result = this->solveGMRES();
+
+  // an old preconditioner may be the reason; try once more with a new one
+  if (result < 0 && formedNow == false && pcType != KRYLOV_PC_NONE) {
+    if (this->formPreconditioner() < 0)
+      return -1;
+    if (method == KRYLOV_CG)
+      result = this->solveCG();
+    else if (method == KRYLOV_BICGSTAB)
+      result = this->solveBiCGStab();
+    else
+      result = this->solveGMRES();
+  }
+
+  if (result < 0) {
+    opserr << "WARNING SparseGenRowKrylovSolver::solve() - failed to converge in ";
+    opserr << numIter << " iterations\n";
+    return -3;
+  }
+
+  theSOE->factored = true;
+  return 0;
+}
+
+
+bool
+SparseGenRowKrylovSolver::preconditionerIsStale(void)
+{
+  if (pcFormed == false)
+    return true;
+
+  if (pcType == KRYLOV_PC_NONE)
+    return false;
+
+  double *A = theSOE->A;
+  double normA0 = 0.0;
+  double normDiff = 0.0;
+  for (int k=0; k<nnz; k++) {
+    double diff = A[k] - A0[k];
+    normDiff += diff*diff;
+    normA0 += A0[k]*A0[k];
+  }
+
+  return (normDiff > rebuildTol*rebuildTol*normA0);
+}
+
+
+int
+SparseGenRowKrylovSolver::formPreconditioner(void)
+{
+  double *A = theSOE->A;
+  int *rowStartA = theSOE->rowStartA;
+  int *colA = theSOE->colA;
+
+  for (int k=0; k<nnz; k++)
+    A0[k] = A[k];
+
+  if (pcType == KRYLOV_PC_JACOBI) {
+
+    for (int i=0; i<size; i++) {
+      double aii = (diagLoc[i] < 0) ? 0.0 : A[diagLoc[i]];
+      M[i] = (aii != 0.0) ? 1.0/aii : 1.0;
+    }
+
+  } else if (pcType == KRYLOV_PC_AMG) {
+
+    // the hierarchy is built from the copy, which stays in place
+    if (theAMG->setup(size, rowStartA, colA, A0, nodeOf, numNodes,
+		      nullSpace, numNull) < 0) {
+      opserr << "WARNING SparseGenRowKrylovSolver::formPreconditioner() - AMG setup failed\n";
+      return -1;
+    }
+
+  } else if (pcType == KRYLOV_PC_BLOCKJACOBI) {
+
+    // each block is inverted in place by Gauss-Jordan with partial
+    // pivoting; a singular block is replaced by its inverted diagonal
+    int bs = blockSize;
+    int *piv = new int[bs];
+    for (int i0=0; i0<size; i0+=bs) {
+      int n = (i0+bs <= size) ? bs : size-i0;
+      double *Mb = M + (i0/bs)*bs*bs;
+
+      for (int i=0; i<n*n; i++)
+	Mb[i] = 0.0;
+      for (int i=0; i<n; i++)
+	for (int k=rowStartA[i0+i]; k<rowStartA[i0+i+1]; k++) {
+	  int j = colA[k] - i0;
+	  if (j >= 0 && j < n)
+	    Mb[i*n+j] = A[k];
+	}
+
+      bool singular = false;
+      for (int c=0; c<n && singular == false; c++) {
+	int p = c;
+	for (int r=c+1; r<n; r++)
+	  if (fabs(Mb[r*n+c]) > fabs(Mb[p*n+c]))
+	    p = r;
+	if (Mb[p*n+c] == 0.0) {
+	  singular = true;
+	  break;
+	}
+	piv[c] = p;
+	if (p != c)
+	  for (int j=0; j<n; j++) {
+	    double tmp = Mb[c*n+j]; Mb[c*n+j] = Mb[p*n+j]; Mb[p*n+j] = tmp;
+	  }
+	double invPivot = 1.0/Mb[c*n+c];
+	Mb[c*n+c] = 1.0;
+	for (int j=0; j<n; j++)
+	  Mb[c*n+j] *= invPivot;
+	for (int r=0; r<n; r++)
+	  if (r != c) {
+	    double f = Mb[r*n+c];
+	    Mb[r*n+c] = 0.0;
+	    for (int j=0; j<n; j++)
+	      Mb[r*n+j] -= f*Mb[c*n+j];
+	  }
+      }
+
+      if (singular == false) {
+	// undo the row interchanges as column interchanges
+	for (int c=n-1; c>=0; c--)
+	  if (piv[c] != c)
+	    for (int r=0; r<n; r++) {
+	      double tmp = Mb[r*n+c]; Mb[r*n+c] = Mb[r*n+piv[c]]; Mb[r*n+piv[c]] = tmp;
+	    }
+      } else {
+	for (int i=0; i<n*n; i++)
+	  Mb[i] = 0.0;
+	for (int i=0; i<n; i++) {
+	  double aii = (diagLoc[i0+i] < 0) ? 0.0 : A[diagLoc[i0+i]];
+	  Mb[i*n+i] = (aii != 0.0) ? 1.0/aii : 1.0;
+	}
+      }
+    }
+    delete [] piv;
+
+  } else if (pcType == KRYLOV_PC_ILU0 || pcType == KRYLOV_PC_IC0) {
+
+    // ILU(0) in the ikj form on the pattern of A; for IC(0) only the upper
+    // triangle is formed, the multipliers coming from the rows above, so
+    // that A ~ U^t D^-1 U with D the diagonal of U
+    for (int k=0; k<nnz; k++)
+      M[k] = A[k];
+
+    int *loc = new int[size];
+    for (int j=0; j<size; j++)
+      loc[j] = -1;
+
+    for (int i=0; i<size; i++) {
+      int rowStart = rowStartA[i];
+      int rowEnd = rowStartA[i+1];
+      for (int p=rowStart; p<rowEnd; p++)
+	loc[colA[p]] = p;
+
+      for (int p=rowStart; p<rowEnd; p++) {
+	int k = colA[p];
+	if (k >= i)
+	  break;
+	if (diagLoc[k] < 0)
+	  continue;
+
+	double lik;
+	if (pcType == KRYLOV_PC_ILU0) {
+	  lik = M[p] / M[diagLoc[k]];
+	  M[p] = lik;
+	} else {
+	  // U(k,i) is in row k, whose columns are in order
+	  int lo = diagLoc[k]+1;
+	  int hi = rowStartA[k+1]-1;
+	  int q = -1;
+	  while (lo <= hi) {
+	    int mid = (lo+hi)/2;
+	    if (colA[mid] == i) {q = mid; break;}
+	    else if (colA[mid] < i) lo = mid+1;
+	    else hi = mid-1;
+	  }
+	  if (q < 0)
+	    continue;
+	  lik = M[q] / M[diagLoc[k]];
+	}
+
+	for (int q=diagLoc[k]+1; q<rowStartA[k+1]; q++) {
+	  int j = colA[q];
+	  if (pcType == KRYLOV_PC_IC0 && j < i)
+	    continue;
+	  int pij = loc[j];
+	  if (pij >= 0)
+	    M[pij] -= lik * M[q];
+	}
+      }
+
+      // guard against a zero or, for IC(0), a negative pivot
+      if (diagLoc[i] >= 0) {
+	double aii = A[diagLoc[i]];
+	double uii = M[diagLoc[i]];
+	if (uii == 0.0 || (pcType == KRYLOV_PC_IC0 && uii <= 1.0e-12*fabs(aii)))
+	  M[diagLoc[i]] = (aii != 0.0) ? fabs(aii) : 1.0;
+      }
+
+      for (int p=rowStart; p<rowEnd; p++)
+	loc[colA[p]] = -1;
+    }
+
+    delete [] loc;
+  }
+
+  pcFormed = true;
+  return 0;
+}
+
+
+void
+SparseGenRowKrylovSolver::applyPreconditioner(const double *r, double *z)
+{
+  int *rowStartA = theSOE->rowStartA;
+  int *colA = theSOE->colA;
+
+  switch (pcType) {
+
+  case KRYLOV_PC_JACOBI:
+    for (int i=0; i<size; i++)
+      z[i] = M[i]*r[i];
+    break;
+
+  case KRYLOV_PC_BLOCKJACOBI:
+    for (int i0=0; i0<size; i0+=blockSize) {
+      int n = (i0+blockSize <= size) ? blockSize : size-i0;
+      const double *Mb = M + (i0/blockSize)*blockSize*blockSize;
+      for (int i=0; i<n; i++) {
+	double tmp = 0.0;
+	for (int j=0; j<n; j++)
+	  tmp += Mb[i*n+j]*r[i0+j];
+	z[i0+i] = tmp;
+      }
+    }
+    break;
+
+  case KRYLOV_PC_ILU0:
+    // L y = r, L unit lower
+    for (int i=0; i<size; i++) {
+      double tmp = r[i];
+      for (int p=rowStartA[i]; p<rowStartA[i+1] && colA[p]<i; p++)
+	tmp -= M[p]*z[colA[p]];
+      z[i] = tmp;
+    }
+    // U z = y
+    for (int i=size-1; i>=0; i--) {
+      double tmp = z[i];
+      for (int p=diagLoc[i]+1; p<rowStartA[i+1]; p++)
+	tmp -= M[p]*z[colA[p]];
+      z[i] = tmp / M[diagLoc[i]];
+    }
+    break;
+
+  case KRYLOV_PC_IC0:
+    // U^t D^-1 y = r, column by column of U^t
+    for (int i=0; i<size; i++)
+      z[i] = r[i];
+    for (int i=0; i<size; i++) {
+      double yi = z[i] / M[diagLoc[i]];
+      for (int p=diagLoc[i]+1; p<rowStartA[i+1]; p++)
+	z[colA[p]] -= M[p]*yi;
+    }
+    // U z = y
+    for (int i=size-1; i>=0; i--) {
+      double tmp = z[i];
+      for (int p=diagLoc[i]+1; p<rowStartA[i+1]; p++)
+	tmp -= M[p]*z[colA[p]];
+      z[i] = tmp / M[diagLoc[i]];
+    }
+    break;
+
+  case KRYLOV_PC_AMG:
+    theAMG->apply(r, z);
+    break;
+
+  default:
+    for (int i=0; i<size; i++)
+      z[i] = r[i];
+  }
+}
+
+
+void
+SparseGenRowKrylovSolver::formNearNullSpace(void)
+{
+  nodeOf = new int[size];
+  for (int i=0; i<size; i++)
+    nodeOf[i] = -1;
+
+  AnalysisModel *theModel = theSOE->theModel;
+  Domain *theDomain = (theModel != 0) ? theModel->getDomainPtr() : 0;
+
+  if (theModel == 0 || theDomain == 0) {
+    // no model to take the nodes from: groups of blockSize equations
+    // with one unit vector per dof of the group
+    numNull = blockSize;
+    numNodes = (size + blockSize - 1)/blockSize;
+    nullSpace = new double[size*numNull];
+    for (int k=0; k<size*numNull; k++)
+      nullSpace[k] = 0.0;
+    for (int i=0; i<size; i++) {
+      nodeOf[i] = i/blockSize;
+      nullSpace[(i%blockSize)*size + i] = 1.0;
+    }
+    return;
+  }
+
+  //
+  // the rigid body modes: 3 translations and 3 rotations in 3d, 2 and 1
+  // in 2d, the rotations formed from the coordinates relative to the
+  // centroid; dofs beyond the translations and rotations (pressures, ...)
+  // each get a vector of their own
+  //
+
+  int ndm = 0;
+  double centroid[3] = {0.0, 0.0, 0.0};
+  int numCrds = 0;
+  DOF_GrpIter &theDOFs1 = theModel->getDOFs();
+  DOF_Group *dofPtr;
+  int maxExtra = 0;
+  while ((dofPtr = theDOFs1()) != 0) {
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+    int ndf = dofPtr->getNumDOF();
+    if (theNode == 0) {
+      if (ndf > maxExtra)
+	maxExtra = ndf;
+      continue;
+    }
+    const Vector &crds = theNode->getCrds();
+    int nc = crds.Size();
+    if (nc > 3)
+      nc = 3;
+    if (nc > ndm)
+      ndm = nc;
+    for (int j=0; j<nc; j++)
+      centroid[j] += crds(j);
+    numCrds++;
+  }
+  if (numCrds != 0)
+    for (int j=0; j<3; j++)
+      centroid[j] /= numCrds;
+
+  if (ndm == 0)
+    ndm = 1;
+  int numRigid = (ndm == 3) ? 6 : (ndm == 2) ? 3 : 1;
+  int numRot = numRigid - ndm;
+
+  DOF_GrpIter &theDOFs2 = theModel->getDOFs();
+  while ((dofPtr = theDOFs2()) != 0) {
+    if (theDomain->getNode(dofPtr->getNodeTag()) == 0)
+      continue;
+    int ndf = dofPtr->getNumDOF();
+    int numMapped = (ndf >= ndm + numRot) ? ndm + numRot : (ndf < ndm) ? ndf : ndm;
+    if (ndf - numMapped > maxExtra)
+      maxExtra = ndf - numMapped;
+  }
+
+  // equations no dof group claims are given a vector too
+  numNull = numRigid + maxExtra;
+  if (numNull == numRigid)
+    numNull++;
+  nullSpace = new double[size*numNull];
+  for (int k=0; k<size*numNull; k++)
+    nullSpace[k] = 0.0;
+
+  numNodes = 0;
+  DOF_GrpIter &theDOFs3 = theModel->getDOFs();
+  while ((dofPtr = theDOFs3()) != 0) {
+    const ID &eqns = dofPtr->getID();
+    int ndf = eqns.Size();
+    Node *theNode = theDomain->getNode(dofPtr->getNodeTag());
+
+    double x[3] = {0.0, 0.0, 0.0};
+    int numMapped = 0;
+    if (theNode != 0) {
+      const Vector &crds = theNode->getCrds();
+      for (int j=0; j<ndm && j<crds.Size(); j++)
+	x[j] = crds(j) - centroid[j];
+      numMapped = (ndf >= ndm + numRot) ? ndm + numRot : (ndf < ndm) ? ndf : ndm;
+    }
+
+    bool used = false;
+    for (int d=0; d<ndf; d++) {
+      int i = eqns(d);
+      if (i < 0 || i >= size)
+	continue;
+      used = true;
+      nodeOf[i] = numNodes;
+
+      if (d >= numMapped) {
+	nullSpace[(numRigid + d - numMapped)*size + i] = 1.0;
+      } else if (d < ndm) {
+	// translation d, and the rotations' displacements at the node
+	nullSpace[d*size + i] = 1.0;
+	if (ndm == 2) {
+	  nullSpace[2*size + i] = (d == 0) ? -x[1] : x[0];
+	} else if (ndm == 3) {
+	  if (d == 0) {
+	    nullSpace[4*size + i] = x[2];
+	    nullSpace[5*size + i] = -x[1];
+	  } else if (d == 1) {
+	    nullSpace[3*size + i] = -x[2];
+	    nullSpace[5*size + i] = x[0];
+	  } else {
+	    nullSpace[3*size + i] = x[1];
+	    nullSpace[4*size + i] = -x[0];
+	  }
+	}
+      } else {
+	// rotational dof
+	nullSpace[d*size + i] = 1.0;
+      }
+    }
+    if (used == true)
+      numNodes++;
+  }
+
+  for (int i=0; i<size; i++)
+    if (nodeOf[i] < 0) {
+      nodeOf[i] = numNodes++;
+      nullSpace[numRigid*size + i] = 1.0;
+    }
+}
+
+
+void
+SparseGenRowKrylovSolver::formAx(const double *x, double *y)
+{
+  double *A = theSOE->A;
+  int *rowStartA = theSOE->rowStartA;
+  int *colA = theSOE->colA;
+  int n = size;
+
+#ifdef _OPENMP
+  int numThreads = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(static) num_threads(numThreads) if (numThreads > 1 && n > 5000)
+#endif
+  for (int i=0; i<n; i++) {
+    double tmp = 0.0;
+    for (int p=rowStartA[i]; p<rowStartA[i+1]; p++)
+      tmp += A[p]*x[colA[p]];
+    y[i] = tmp;
+  }
+}
+
+
+static double
+dotProduct(const double *a, const double *b, int n)
+{
+  double sum = 0.0;
+  for (int i=0; i<n; i++)
+    sum += a[i]*b[i];
+  return sum;
+}
+
+
+int
+SparseGenRowKrylovSolver::solveCG(void)
+{
+  int n = size;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  double *r = work;
+  double *z = work + n;
+  double *p = work + 2*n;
+  double *q = work + 3*n;
+
+  numIter = 0;
+  double normB = sqrt(dotProduct(B, B, n));
+  if (normB == 0.0) {
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+    return 0;
+  }
+  double normStop = tol*normB;
+
+  // start from the last solution unless it is worse than starting from 0
+  this->formAx(X, r);
+  for (int i=0; i<n; i++)
+    r[i] = B[i] - r[i];
+  double normR = sqrt(dotProduct(r, r, n));
+  if (normR > normB) {
+    for (int i=0; i<n; i++) {
+      X[i] = 0.0;
+      r[i] = B[i];
+    }
+    normR = normB;
+  }
+  if (normR <= normStop)
+    return 0;
+
+  this->applyPreconditioner(r, z);
+  for (int i=0; i<n; i++)
+    p[i] = z[i];
+  double rz = dotProduct(r, z, n);
+
+  while (numIter < maxIter) {
+    numIter++;
+    this->formAx(p, q);
+    double pq = dotProduct(p, q, n);
+    if (pq <= 0.0)
+      return -2;
+
+    double alpha = rz/pq;
+    for (int i=0; i<n; i++) {
+      X[i] += alpha*p[i];
+      r[i] -= alpha*q[i];
+    }
+    normR = sqrt(dotProduct(r, r, n));
+    if (normR <= normStop)
+      return 0;
+
+    this->applyPreconditioner(r, z);
+    double rzNew = dotProduct(r, z, n);
+    double beta = rzNew/rz;
+    rz = rzNew;
+    for (int i=0; i<n; i++)
+      p[i] = z[i] + beta*p[i];
+  }
+
+  return -1;
+}
+
+
+int
+SparseGenRowKrylovSolver::solveBiCGStab(void)
+{
+  int n = size;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  double *r = work;
+  double *rHat = work + n;
+  double *p = work + 2*n;
+  double *v = work + 3*n;
+  double *s = work + 4*n;
+  double *t = work + 5*n;
+  double *pHat = work + 6*n;
+  double *sHat = work + 7*n;
+
+  numIter = 0;
+  double normB = sqrt(dotProduct(B, B, n));
+  if (normB == 0.0) {
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+    return 0;
+  }
+  double normStop = tol*normB;
+
+  this->formAx(X, r);
+  for (int i=0; i<n; i++)
+    r[i] = B[i] - r[i];
+  double normR = sqrt(dotProduct(r, r, n));
+  if (normR > normB) {
+    for (int i=0; i<n; i++) {
+      X[i] = 0.0;
+      r[i] = B[i];
+    }
+    normR = normB;
+  }
+  if (normR <= normStop)
+    return 0;
+
+  for (int i=0; i<n; i++) {
+    rHat[i] = r[i];
+    p[i] = 0.0;
+    v[i] = 0.0;
+  }
+  double rho = 1.0, alpha = 1.0, omega = 1.0;
+
+  while (numIter < maxIter) {
+    numIter++;
+    double rhoNew = dotProduct(rHat, r, n);
+    if (rhoNew == 0.0)
+      return -2;
+
+    double beta = (rhoNew/rho)*(alpha/omega);
+    for (int i=0; i<n; i++)
+      p[i] = r[i] + beta*(p[i] - omega*v[i]);
+
+    this->applyPreconditioner(p, pHat);
+    this->formAx(pHat, v);
+    double rHatv = dotProduct(rHat, v, n);
+    if (rHatv == 0.0)
+      return -2;
+    alpha = rhoNew/rHatv;
+
+    for (int i=0; i<n; i++)
+      s[i] = r[i] - alpha*v[i];
+    double normS = sqrt(dotProduct(s, s, n));
+    if (normS <= normStop) {
+      for (int i=0; i<n; i++)
+	X[i] += alpha*pHat[i];
+      return 0;
+    }
+
+    this->applyPreconditioner(s, sHat);
+    this->formAx(sHat, t);
+    double tt = dotProduct(t, t, n);
+    omega = (tt != 0.0) ? dotProduct(t, s, n)/tt : 0.0;
+
+    for (int i=0; i<n; i++) {
+      X[i] += alpha*pHat[i] + omega*sHat[i];
+      r[i] = s[i] - omega*t[i];
+    }
+    normR = sqrt(dotProduct(r, r, n));
+    if (normR <= normStop)
+      return 0;
+    if (omega == 0.0)
+      return -2;
+
+    rho = rhoNew;
+  }
+
+  return -1;
+}
+
+
+int
+SparseGenRowKrylovSolver::solveGMRES(void)
+{
+  int n = size;
+  int m = restart;
+  double *X = theSOE->X;
+  double *B = theSOE->B;
+  double *V = work;                 // m+1 basis vectors
+  double *w = work + (m+1)*n;
+  double *z = work + (m+2)*n;
+  double *H = work + (m+3)*n;       // (m+1) x m, by column
+  double *cs = H + (m+1)*m;
+  double *sn = cs + (m+1);
+  double *g = sn + (m+1);
+
+  numIter = 0;
+  double normB = sqrt(dotProduct(B, B, n));
+  if (normB == 0.0) {
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+    return 0;
+  }
+  double normStop = tol*normB;
+
+  // the first residual decides on the starting point
+  this->formAx(X, w);
+  for (int i=0; i<n; i++)
+    w[i] = B[i] - w[i];
+  if (sqrt(dotProduct(w, w, n)) > normB)
+    for (int i=0; i<n; i++)
+      X[i] = 0.0;
+
+  while (numIter < maxIter) {
+
+    // r = b - A x
+    this->formAx(X, w);
+    for (int i=0; i<n; i++)
+      w[i] = B[i] - w[i];
+    double beta = sqrt(dotProduct(w, w, n));
+    if (beta <= normStop)
+      return 0;
+
+    for (int i=0; i<n; i++)
+      V[i] = w[i]/beta;
+    g[0] = beta;
+    for (int i=1; i<=m; i++)
+      g[i] = 0.0;
+
+    // Arnoldi on A M^-1 with modified Gram-Schmidt, the Hessenberg matrix
+    // kept triangular with Givens rotations
+    int k = 0;
+    bool converged = false;
+    while (k < m && numIter < maxIter) {
+      numIter++;
+      double *vk = V + k*n;
+      double *hk = H + k*(m+1);
+      this->applyPreconditioner(vk, z);
+      this->formAx(z, w);
+
+      for (int i=0; i<=k; i++) {
+	double *vi = V + i*n;
+	double hik = dotProduct(w, vi, n);
+	hk[i] = hik;
+	for (int j=0; j<n; j++)
+	  w[j] -= hik*vi[j];
+      }
+      double hk1 = sqrt(dotProduct(w, w, n));
+      hk[k+1] = hk1;
+      if (hk1 != 0.0 && k+1 <= m) {
+	double *vk1 = V + (k+1)*n;
+	for (int j=0; j<n; j++)
+	  vk1[j] = w[j]/hk1;
+      }
+
+      for (int i=0; i<k; i++) {
+	double tmp = cs[i]*hk[i] + sn[i]*hk[i+1];
+	hk[i+1] = -sn[i]*hk[i] + cs[i]*hk[i+1];
+	hk[i] = tmp;
+      }
+      double denom = sqrt(hk[k]*hk[k] + hk[k+1]*hk[k+1]);
+      if (denom == 0.0) {
+	cs[k] = 1.0;
+	sn[k] = 0.0;
+      } else {
+	cs[k] = hk[k]/denom;
+	sn[k] = hk[k+1]/denom;
+      }
+      hk[k] = cs[k]*hk[k] + sn[k]*hk[k+1];
+      hk[k+1] = 0.0;
+      g[k+1] = -sn[k]*g[k];
+      g[k] = cs[k]*g[k];
+
+      k++;
+      if (fabs(g[k]) <= normStop || hk1 == 0.0) {
+	converged = true;
+	break;
+      }
+    }
+
+    // x += M^-1 V y, with H y = g
+    for (int i=k-1; i>=0; i--) {
+      double tmp = g[i];
+      for (int j=i+1; j<k; j++)
+	tmp -= H[j*(m+1)+i]*g[j];
+      double hii = H[i*(m+1)+i];
+      g[i] = (hii != 0.0) ? tmp/hii : 0.0;
+    }
+    for (int j=0; j<n; j++)
+      w[j] = 0.0;
+    for (int i=0; i<k; i++) {
+      double *vi = V + i*n;
+      for (int j=0; j<n; j++)
+	w[j] += g[i]*vi[j];
+    }
+    this->applyPreconditioner(w, z);
+    for (int j=0; j<n; j++)
+      X[j] += z[j];
+
+    if (converged == true) {
+      // confirm with the true residual
+      this->formAx(X, w);
+      for (int i=0; i<n; i++)
+	w[i] = B[i] - w[i];
+      if (sqrt(dotProduct(w, w, n)) <= normStop*10.0)
+	return 0;
+    }
+  }
+
+  return -1;
+}
+
+
+int
+SparseGenRowKrylovSolver::sendSelf(int commitTag, Channel &theChannel)
+{
+  // nothing to do
+  return 0;
+}
+
+
+int
+SparseGenRowKrylovSolver::recvSelf(int commitTag, Channel &theChannel,
+				   FEM_ObjectBroker &theBroker)
+{
+  // nothing to do
+  return 0;
+}
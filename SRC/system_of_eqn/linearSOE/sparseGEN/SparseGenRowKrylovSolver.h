@@ -0,0 +1,119 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/system_of_eqn/linearSOE/sparseGEN/SparseGenRowKrylovSolver.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// SparseGenRowKrylovSolver. SparseGenRowKrylovSolver is a subclass of
+// SparseGenRowLinSolver. It solves the SparseGenRowLinSOE with a
+// preconditioned Krylov method working directly on the row compressed
+// storage of the SOE: conjugate gradients for symmetric positive definite
+// systems, BiCGStab or restarted GMRES for general ones. The preconditioner
+// is Jacobi, block Jacobi over groups of consecutive equations (the dofs of
+// a node), ILU(0), IC(0) or a smoothed aggregation algebraic multigrid
+// V-cycle whose near null space are the rigid body modes of the nodes of
+// the model (SparseGenRowAMG). Each solve starts from the X of the last solve
+// and the preconditioner is only formed again when A has moved away from
+// the A it was formed from by more than a given relative amount, or when
+// the iteration fails to converge with the old one.
+
+// What: "@(#) SparseGenRowKrylovSolver.h, revA"
+
+#ifndef SparseGenRowKrylovSolver_h
+#define SparseGenRowKrylovSolver_h
+
+#include <SparseGenRowLinSolver.h>
+
+class SparseGenRowAMG;
+
+#define KRYLOV_CG        0
+#define KRYLOV_BICGSTAB  1
+#define KRYLOV_GMRES     2
+
+#define KRYLOV_PC_NONE         0
+#define KRYLOV_PC_JACOBI       1
+#define KRYLOV_PC_BLOCKJACOBI  2
+#define KRYLOV_PC_ILU0         3
+#define KRYLOV_PC_IC0          4
+#define KRYLOV_PC_AMG          5
+#define KRYLOV_PC_UP           6
+
+class SparseGenRowKrylovSolver : public SparseGenRowLinSolver
+{
+  public:
+    SparseGenRowKrylovSolver(int method = KRYLOV_CG,
+			     int preconditioner = KRYLOV_PC_JACOBI,
+			     double tol = 1.0e-8, int maxIter = 1000,
+			     int restart = 50, int blockSize = 3,
+			     double rebuildTol = 0.05);
+    ~SparseGenRowKrylovSolver();
+
+    int solve(void);
+    int setSize(void);
+
+    int setTolerance(double newTol) {tol = newTol; return 0;}
+    double getTolerance(void) {return tol;}
+    int getNumIterations(void) const {return numIter;}
+
+    int sendSelf(int commitTag, Channel &theChannel);
+    int recvSelf(int commitTag, Channel &theChannel,
+		 FEM_ObjectBroker &theBroker);
+
+  protected:
+
+  private:
+    int formPreconditioner(void);
+    bool preconditionerIsStale(void);
+    void applyPreconditioner(const double *r, double *z);
+    void formAx(const double *x, double *y);
+    void formNearNullSpace(void);
+
+    int solveCG(void);
+    int solveBiCGStab(void);
+    int solveGMRES(void);
+
+    int method, pcType;
+    double tol;
+    int maxIter, restart, blockSize;
+    double rebuildTol;
+
+    int size, nnz;
+    int *diagLoc;      // location of the diagonal in each row of the SOE's A
+    double *M;         // Jacobi: 1/aii, block Jacobi: inverted blocks, ILU/IC: factors
+    int sizeM;
+    double *A0;        // A the preconditioner was formed from
+    bool pcFormed;
+
+    SparseGenRowAMG *theAMG;
+    int *nodeOf;       // AMG: node of each equation
+    int numNodes;
+    double *nullSpace; // AMG: near null space vectors, one after the other
+    int numNull;
+
+    double *work;      // work vectors for the methods
+    int sizeWork;
+    int numIter;
+};
+
+#endif
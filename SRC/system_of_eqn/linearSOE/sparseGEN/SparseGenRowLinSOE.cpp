@@ -33,6 +33,7 @@
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
+#include <ThreadPool.h>
 #include <math.h>
 #include <stdlib.h>
 
@@ -124,9 +125,17 @@ SparseGenRowLinSOE::getNumEqn(void) const
     return size;
 }
 
+size_t
+SparseGenRowLinSOE::getNumBytes(void)
+{
+    return Asize*(sizeof(double)+sizeof(int)) + (size+1)*sizeof(int) +
+	this->LinearSOE::getNumBytes();
+}
+
 int 
 SparseGenRowLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
 
     int result = 0;
     int oldSize = size;
@@ -162,10 +171,6 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
 	Asize = newNNZ;
     }
 
-    // zero the matrix
-    for (int i=0; i<Asize; i++)
-	A[i] = 0;
-	
     factored = false;
     
     if (size > Bsize) { // we have to get space for the vectors
@@ -191,11 +196,9 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
 	    Bsize = size;
     }
 
-    // zero the vectors
-    for (int j=0; j<size; j++) {
-	B[j] = 0;
-	X[j] = 0;
-    }
+    // zero the vectors, by the threads that use them if pinned
+    ThreadPool::placeVector(B, size);
+    ThreadPool::placeVector(X, size);
     
     // create new Vectors objects
     if (size != oldSize) {
@@ -255,6 +258,12 @@ SparseGenRowLinSOE::setSize(Graph &theGraph)
       }
     }
 
+    // zero the matrix, row by row by the threads that use them if pinned
+    if (size != 0)
+      ThreadPool::placeRows(A, rowStartA, size);
+    for (int i=nnz; i<Asize; i++)
+	A[i] = 0;
+
     // invoke setSize() on the Solver   
      LinearSOESolver *the_Solver = this->getSolver();
     int solverOK = the_Solver->setSize();
@@ -401,6 +410,19 @@ SparseGenRowLinSOE::zeroA(void)
 
     factored = false;
 }
+
+int
+SparseGenRowLinSOE::saveA(void)
+{
+    return this->copyToBaseA(A, Asize);
+}
+
+int
+SparseGenRowLinSOE::restoreA(void)
+{
+    factored = false;
+    return this->copyFromBaseA(A, Asize);
+}
 	
 void 
 SparseGenRowLinSOE::zeroB(void)
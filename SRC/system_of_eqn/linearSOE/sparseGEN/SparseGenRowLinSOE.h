@@ -56,6 +56,9 @@ class SparseGenRowLinSOE : public LinearSOE
     
     void zeroA(void);
     void zeroB(void);
+    int saveA(void);
+    int restoreA(void);
+    size_t getNumBytes(void);
     
     const Vector &getX(void);
     const Vector &getB(void);    
@@ -71,6 +74,8 @@ class SparseGenRowLinSOE : public LinearSOE
     friend class CulaSparseSolverS4;    
     friend class CulaSparseSolverS5;    
 	friend class CuSPSolver;
+    friend class SparseGenRowKrylovSolver;
+    friend class CuDSSSolver;
 
   protected:
     
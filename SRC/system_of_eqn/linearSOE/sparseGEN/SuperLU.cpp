@@ -87,7 +87,7 @@ SuperLU::SuperLU(int perm,
 		 int relx, 
 		 char symm)
 :SparseGenColLinSolver(SOLVER_TAGS_SuperLU),
- perm_r(0),perm_c(0), etree(0), sizePerm(0),
+ perm_r(0),perm_c(0), etree(0), sizePerm(0), symbolicStamp(-1),
  relax(relx), permSpec(perm), panelSize(panel), 
  drop_tol(drop_tolerance), symmetric(symm)
 {
@@ -269,12 +269,71 @@ SuperLU::solve(void)
 
 
 
+int
+SuperLU::solveMultiple(int numRHS, double *BX)
+{
+    // substitution with the factors of the last solve()
+    if (theSOE == 0 || theSOE->factored == false || B.ncol == 0 ||
+	theSOE->getClassTag() != LinSOE_TAGS_SparseGenColLinSOE)
+	return -1;
+
+    int n = theSOE->size;
+    SuperMatrix theBX;
+    dCreate_Dense_Matrix(&theBX, n, numRHS, BX, n, SLU_DN, SLU_D, SLU_GE);
+
+    trans_t trans = NOTRANS;
+    int info;
+    dgstrs (trans, &L, &U, perm_c, perm_r, &theBX, &stat, &info);    
+
+    SUPERLU_FREE(theBX.Store);
+
+    if (info != 0) {	
+       opserr << "WARNING SuperLU::solveMultiple()- ";
+       opserr << " Error " << info << " returned in substitution dgstrs()\n";
+       return -1;
+    }
+
+    return 0;
+}
+
+
 int
 SuperLU::setSize()
 {
     int n = theSOE->size;
     if (n > 0) {
 
+      // if the structure of A is unchanged the column permutation, the
+      // elimination tree and AC are still valid; only the numeric
+      // factorization, with the same pattern, is redone in solve()
+      if (symbolicStamp == theSOE->patternStamp && sizePerm >= n && AC.ncol == n)
+	return 0;
+
+      // free the structures formed for the previous pattern
+      if (L.ncol != 0) {
+	Destroy_SuperNode_Matrix(&L);
+	Destroy_CompCol_Matrix(&U);
+	L.ncol = 0;
+	U.ncol = 0;
+      }
+      if (AC.ncol != 0) {
+	NCPformat *ACstore = (NCPformat *)AC.Store;
+	SUPERLU_FREE(ACstore->colbeg);
+	SUPERLU_FREE(ACstore->colend);
+	SUPERLU_FREE(ACstore);
+	AC.ncol = 0;
+      }
+      if (A.ncol != 0) {
+	SUPERLU_FREE(A.Store);
+	A.ncol = 0;
+      }
+      if (B.ncol != 0) {
+	SUPERLU_FREE(B.Store);
+	B.ncol = 0;
+      }
+      if (etree != 0)
+	StatFree(&stat);
+
       // create space for the permutation vectors 
       // and the elimination tree
       if (sizePerm < n) {
@@ -323,6 +382,8 @@ SuperLU::setSize()
       if (symmetric == 'Y')
 	options.SymmetricMode=YES;
 
+      symbolicStamp = theSOE->patternStamp;
+
     } else if (n == 0)
 	return 0;
     else {
@@ -334,6 +395,23 @@ SuperLU::setSize()
     return 0;
 }
 
+size_t
+SuperLU::getNumBytes(void)
+{
+    // the permutations, the elimination tree and the factors L and U
+    size_t numBytes = 3*sizePerm*sizeof(int);
+    if (L.ncol != 0) {
+	SCformat *Lstore = (SCformat *)L.Store;
+	numBytes += Lstore->nnz*sizeof(double) +
+	  Lstore->rowind_colptr[L.ncol]*sizeof(int);
+    }
+    if (U.ncol != 0) {
+	NCformat *Ustore = (NCformat *)U.Store;
+	numBytes += Ustore->nnz*(sizeof(double)+sizeof(int));
+    }
+    return numBytes;
+}
+
 int
 SuperLU::sendSelf(int cTag, Channel &theChannel)
 {
@@ -59,7 +59,9 @@ class SuperLU : public SparseGenColLinSolver
     ~SuperLU();
 
     int solve(void);
+    int solveMultiple(int numRHS, double *BX);
     int setSize(void);
+    size_t getNumBytes(void);
 
     int sendSelf(int commitTag, Channel &theChannel);
     int recvSelf(int commitTag, Channel &theChannel, FEM_ObjectBroker &theBroker);    
@@ -72,6 +74,7 @@ class SuperLU : public SparseGenColLinSolver
     int *perm_c;
     int *etree;
     int sizePerm;
+    int symbolicStamp;  // SOE patternStamp perm_c, etree and AC were formed for
     int relax, permSpec, panelSize;
     double drop_tol;
     char symmetric;
@@ -22,6 +22,9 @@
 #include <Graph.h>
 #include <Vertex.h>
 #include <VertexIter.h>
+#include <AnalysisModel.h>
+#include <DOF_Group.h>
+#include <DOF_GrpIter.h>
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
@@ -112,7 +115,7 @@ int SymSparseLinSOE::getNumEqn(void) const
 extern "C" int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE, 
 				int **xblkMY, int **invpMY, int **rowblksMY, 
 				OFFDBLK ***begblkMY, OFFDBLK **firstMY, 
-				double ***penvMY, double **diagMY);
+				double ***penvMY, double **diagMY, int *delayed);
 
 
 /* Based on the graph (the entries in A), set up the pair (rowStartA, colA).
@@ -232,9 +235,36 @@ int SymSparseLinSOE::setSize(Graph &theGraph)
 	}
     }
     
+    // the equations of the DOF_Groups without a node are those of the
+    // Lagrange multipliers added by a LagrangeConstraintHandler; they have
+    // a zero diagonal and are ordered after the dof they constrain, so that
+    // the LDL^T factorization of the saddle point system has no zero pivot
+    int *delayed = 0;
+    if (theModel != 0 && size != 0) {
+        DOF_Group *dofPtr;
+	DOF_GrpIter &theDOFs = theModel->getDOFs();
+	while ((dofPtr = theDOFs()) != 0) {
+	    if (dofPtr->getNodeTag() != -1)
+	        continue;
+	    if (delayed == 0) {
+	        delayed = new int[size];
+		for (int i=0; i<size; i++)
+		    delayed[i] = 0;
+	    }
+	    const ID &theID = dofPtr->getID();
+	    for (int i=0; i<theID.Size(); i++)
+	        if (theID(i) >= 0 && theID(i) < size)
+		    delayed[theID(i)] = 1;
+	}
+    }
+
     // call "C" function to form elimination tree and to do the symbolic factorization.
     nblks = symFactorization(rowStartA, colA, size, this->LSPARSE,
-			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag,
+			     delayed);
+
+    if (delayed != 0)
+        delete [] delayed;
 
     return result;
 }
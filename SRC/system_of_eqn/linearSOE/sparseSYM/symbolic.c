@@ -54,16 +54,21 @@ int nodfac(int *perm, int *invp, int **padj, int *ancstr , int *list, int neqns,
 	   int nblks, int *xblk, int *envlen, OFFDBLK **segfirst, 
 	   OFFDBLK **first, int *rowblks );
 int setenvlpe(int neqns, double **penv, int *envlen);
+void delayvertices(int neqns, int **padj, int *delayed, int *perm, int *invp);
 
 
 
 /* int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE) */
 
 
+/* delayed, if not NULL, flags the equations to be eliminated after all
+ * their neighbours, see delayvertices() below */
+
 int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE, 
 		     int **xblkMY,
 		     int **invpMY, int **rowblksMY, OFFDBLK ***begblkMY,
-		     OFFDBLK **firstMY, double ***penvMY, double **diagMY)
+		     OFFDBLK **firstMY, double ***penvMY, double **diagMY,
+		     int *delayed)
 
 {
     int delta, maxint;
@@ -154,6 +159,9 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
          break ;
    }
 
+   if (delayed != NULL && LSPARSE < 4)
+      delayvertices(neq, padj, delayed, wperm, winvp) ;
+
    /* free up space used just for mygenmmd and the fortran program */
    /*
     free(fxadj);
@@ -239,3 +247,85 @@ int symFactorization(int *fxadj, int *adjncy, int neq, int LSPARSE,
 
 
 
+
+
+/*
+ * delayvertices: moves each flagged vertex of the ordering (perm, invp)
+ * to just after the last of its unflagged neighbours, the others keeping
+ * their relative order. The equation of a Lagrange multiplier has a zero
+ * diagonal; eliminated after the dof it constrains its pivot is the
+ * nonzero Schur complement, and the root free LDL^T factorization of
+ * pfsfct() handles the indefinite saddle point system. The postordering
+ * of pfordr() keeps every vertex after its descendants in the
+ * elimination tree, which the neighbours ordered before it are, so the
+ * order set here survives it.
+ *   neqns   - number of equations
+ *   padj    - the adjacency structure, zero based
+ *   delayed - delayed[i] != 0 for the vertices to move
+ *   perm    - on input the ordering, on output the new one
+ *   invp    - the inverse of perm, updated on output
+ */
+
+void delayvertices(int neqns, int **padj, int *delayed, int *perm, int *invp)
+{
+   int *anchor, *head, *tail, *next, *newperm ;
+   int i, k, v, last, *ptr ;
+
+   anchor  = (int *)calloc(neqns+1, sizeof(int)) ;
+   head    = (int *)calloc(neqns+1, sizeof(int)) ;
+   tail    = (int *)calloc(neqns+1, sizeof(int)) ;
+   next    = (int *)calloc(neqns+1, sizeof(int)) ;
+   newperm = (int *)calloc(neqns+1, sizeof(int)) ;
+   assert(anchor && head && tail && next && newperm != NULL) ;
+
+   for (i=0; i<neqns; i++)
+   {
+      head[i] = -1 ;
+      tail[i] = -1 ;
+      next[i] = -1 ;
+      anchor[i] = -1 ;
+   }
+
+ /* hang each flagged vertex, in the order given, on its last neighbour */
+   for (k=0; k<neqns; k++)
+   {
+      v = perm[k] ;
+      if (delayed[v] == 0) continue ;
+
+      last = -1 ;
+      for (ptr = padj[v]; ptr < padj[v+1]; ptr++)
+      {
+         i = *ptr ;
+         if (i == v || delayed[i] != 0) continue ;
+         if (last < 0 || invp[i] > invp[last]) last = i ;
+      }
+      if (last < 0 || invp[last] < k) continue ;
+
+      anchor[v] = last ;
+      if (tail[last] < 0) head[last] = v ;
+      else next[tail[last]] = v ;
+      tail[last] = v ;
+   }
+
+   i = 0 ;
+   for (k=0; k<neqns; k++)
+   {
+      v = perm[k] ;
+      if (anchor[v] >= 0) continue ;
+      newperm[i++] = v ;
+      for (v = head[v]; v >= 0; v = next[v])
+         newperm[i++] = v ;
+   }
+
+   for (k=0; k<neqns; k++)
+   {
+      perm[k] = newperm[k] ;
+      invp[perm[k]] = k ;
+   }
+
+   free(anchor) ;
+   free(head) ;
+   free(tail) ;
+   free(next) ;
+   free(newperm) ;
+}
@@ -48,14 +48,16 @@
 #include <ID.h>
 
 UmfpackGenLinSOE::UmfpackGenLinSOE(UmfpackGenLinSolver &the_Solver)
-    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(the_Solver, LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(),
+     factored(false), patternStamp(0)
 {
     the_Solver.setLinearSOE(*this);
 }
 
 
 UmfpackGenLinSOE::UmfpackGenLinSOE()
-    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax()
+    :LinearSOE(LinSOE_TAGS_UmfpackGenLinSOE), X(), B(), Ap(), Ai(), Ax(),
+     factored(false), patternStamp(0)
 {
 }
 
@@ -71,9 +73,18 @@ UmfpackGenLinSOE::getNumEqn(void) const
     return X.Size();
 }
 
+size_t
+UmfpackGenLinSOE::getNumBytes(void)
+{
+    return Ax.capacity()*sizeof(double) +
+	(Ai.capacity()+Ap.capacity())*sizeof(int) + this->LinearSOE::getNumBytes();
+}
+
 int
 UmfpackGenLinSOE::setSize(Graph &theGraph)
 {
+    this->clearBaseA();
+
     int size = theGraph.getNumVertex();
     if (size < 0) {
 	opserr<<"size of soe < 0\n";
@@ -90,16 +101,18 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
     }
 
     // resize A, B, X
-    Ap.reserve(size+1);
-    Ai.reserve(nnz);
-    Ax.resize(nnz,0.0);
+    std::vector<int> newAp, newAi;
+    newAp.reserve(size+1);
+    newAi.reserve(nnz);
+    Ax.assign(nnz,0.0);
     B.resize(size);
     B.Zero();
     X.resize(size);
     X.Zero();
+    factored = false;
 
     // fill in Ai and Ap
-    Ap.push_back(0);
+    newAp.push_back(0);
     for (int a=0; a<size; a++) {
 
 	theVertex = theGraph.getVertexPtr(a);
@@ -107,6 +120,7 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 	    opserr << "WARNING:UmfpackGenLinSOE::setSize :";
 	    opserr << " vertex " << a << " not in graph! - size set to 0\n";
 	    size = 0;
+	    patternStamp++;
 	    return -1;
 	}
 
@@ -125,11 +139,18 @@ UmfpackGenLinSOE::setSize(Graph &theGraph)
 
 	// copy to Ai
 	for (int i=0; i<col.Size(); i++) {
-	    Ai.push_back(col(i));
+	    newAi.push_back(col(i));
 	}
 
 	// set Ap
-	Ap.push_back(Ap[a]+col.Size());
+	newAp.push_back(newAp[a]+col.Size());
+    }
+
+    // the solver keeps its symbolic factorization if the structure is unchanged
+    if (newAp != Ap || newAi != Ai) {
+	Ap.swap(newAp);
+	Ai.swap(newAi);
+	patternStamp++;
     }
 
     // invoke setSize() on the Solver
@@ -280,6 +301,24 @@ void
 UmfpackGenLinSOE::zeroA(void)
 {
     Ax.assign(Ax.size(),0.0);
+    factored = false;
+}
+
+int
+UmfpackGenLinSOE::saveA(void)
+{
+    if (Ax.empty())
+	return -1;
+    return this->copyToBaseA(&Ax[0], (int)Ax.size());
+}
+
+int
+UmfpackGenLinSOE::restoreA(void)
+{
+    if (Ax.empty())
+	return -1;
+    factored = false;
+    return this->copyFromBaseA(&Ax[0], (int)Ax.size());
 }
 
 void
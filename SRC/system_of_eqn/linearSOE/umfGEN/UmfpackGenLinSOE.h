@@ -57,6 +57,9 @@ public:
     
     void zeroA(void);
     void zeroB(void);
+    int saveA(void);
+    int restoreA(void);
+    size_t getNumBytes(void);
     
     const Vector &getX(void);
     const Vector &getB(void);    
@@ -78,6 +81,8 @@ private:
     Vector X,B;
     std::vector<int> Ap, Ai;
     std::vector<double> Ax;
+    bool factored;       // Ax unchanged since the last numeric factorization
+    int patternStamp;    // changed by setSize() only if Ap or Ai change
 };
 
 
@@ -37,22 +37,35 @@
 #include <math.h>
 #include <Channel.h>
 #include <FEM_ObjectBroker.h>
+#include <elementAPI.h>
+#include <string.h>
 
 void* OPS_UmfpackGenLinSolver()
 {
-    UmfpackGenLinSolver *theSolver = new UmfpackGenLinSolver();
+    bool natural = false;
+    while (OPS_GetNumRemainingInputArgs() > 0) {
+	const char *opt = OPS_GetString();
+	if (strcmp(opt, "-natural") == 0)
+	    natural = true;
+    }
+
+    UmfpackGenLinSolver *theSolver = new UmfpackGenLinSolver(natural);
     return new UmfpackGenLinSOE(*theSolver);  
 }
 
 UmfpackGenLinSolver::
-UmfpackGenLinSolver()
-    :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), Symbolic(0), theSOE(0)
+UmfpackGenLinSolver(bool nat)
+    :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver), Symbolic(0), Numeric(0),
+     symbolicStamp(-1), natural(nat), theSOE(0)
 {
 }
 
 
 UmfpackGenLinSolver::~UmfpackGenLinSolver()
 {
+    if (Numeric != 0) {
+	umfpack_di_free_numeric(&Numeric);
+    }
     if (Symbolic != 0) {
 	umfpack_di_free_symbolic(&Symbolic);
     }
@@ -77,23 +90,26 @@ UmfpackGenLinSolver::solve(void)
 	return -1;
     }
     
-    // numerical analysis
-    void* Numeric = 0;
-    int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
-
-    // check error
-    if (status!=UMFPACK_OK) {
-	opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
-	return -1;
+    // numerical analysis, only if A has changed since the last one
+    if (theSOE->factored == false || Numeric == 0) {
+	if (Numeric != 0) {
+	    umfpack_di_free_numeric(&Numeric);
+	}
+	int status = umfpack_di_numeric(Ap,Ai,Ax,Symbolic,&Numeric,Control,Info);
+
+	// check error
+	if (status!=UMFPACK_OK) {
+	    opserr<<"WARNING: numeric analysis returns "<<status<<" -- Umfpackgenlinsolver::solve\n";
+	    if (Numeric != 0) {
+		umfpack_di_free_numeric(&Numeric);
+	    }
+	    return -1;
+	}
+	theSOE->factored = true;
     }
 
     // solve
-    status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
-
-    // delete Numeric
-    if (Numeric != 0) {
-	umfpack_di_free_numeric(&Numeric);
-    }
+    int status = umfpack_di_solve(UMFPACK_A,Ap,Ai,Ax,X,B,Numeric,Control,Info);
     
     // check error
     if (status!=UMFPACK_OK) {
@@ -112,10 +128,21 @@ UmfpackGenLinSolver::setSize()
     umfpack_di_defaults(Control);
     Control[UMFPACK_PIVOT_TOLERANCE] = 1.0;
     Control[UMFPACK_STRATEGY] = UMFPACK_STRATEGY_SYMMETRIC;
+    if (natural)
+	Control[UMFPACK_ORDERING] = UMFPACK_ORDERING_NONE;
+
+    // the values of A have been reset
+    if (Numeric != 0) {
+	umfpack_di_free_numeric(&Numeric);
+    }
 
     int n = theSOE->X.Size();
     int nnz = (int)theSOE->Ai.size();
     if (n == 0 || nnz==0) return 0;
+
+    // keep the symbolic analysis if the structure of A is unchanged
+    if (Symbolic != 0 && symbolicStamp == theSOE->patternStamp)
+	return 0;
     
     int* Ap = &(theSOE->Ap[0]);
     int* Ai = &(theSOE->Ai[0]);
@@ -133,9 +160,24 @@ UmfpackGenLinSolver::setSize()
 	Symbolic = 0;
 	return -1;
     }
+    symbolicStamp = theSOE->patternStamp;
     return 0;
 }
 
+size_t
+UmfpackGenLinSolver::getNumBytes(void)
+{
+    // the sizes of the Symbolic and Numeric objects in Info are in units
+    double numUnits = 0.0;
+    if (Symbolic != 0 && Info[UMFPACK_SYMBOLIC_SIZE] > 0.0)
+	numUnits += Info[UMFPACK_SYMBOLIC_SIZE];
+    if (Numeric != 0 && Info[UMFPACK_NUMERIC_SIZE] > 0.0)
+	numUnits += Info[UMFPACK_NUMERIC_SIZE];
+    if (numUnits == 0.0)
+	return 0;
+    return (size_t)(numUnits*Info[UMFPACK_SIZE_OF_UNIT]);
+}
+
 int
 UmfpackGenLinSolver::setLinearSOE(UmfpackGenLinSOE &theLinearSOE)
 {
@@ -43,11 +43,14 @@ class UmfpackGenLinSOE;
 class UmfpackGenLinSolver : public LinearSOESolver
 {
   public:
-    UmfpackGenLinSolver();     
+    // natural keeps the order of the equations, e.g. that of a
+    // fill-reducing numberer, instead of reordering them in UMFPACK
+    UmfpackGenLinSolver(bool natural = false);     
     ~UmfpackGenLinSolver();
 
     int solve(void);
     int setSize(void);
+    size_t getNumBytes(void);
 
     int setLinearSOE(UmfpackGenLinSOE &theSOE);
     
@@ -59,6 +62,9 @@ class UmfpackGenLinSolver : public LinearSOESolver
 
   private:
     void *Symbolic;
+    void *Numeric;
+    int symbolicStamp;  // SOE patternStamp Symbolic was formed for
+    bool natural;
     double Control[UMFPACK_CONTROL], Info[UMFPACK_INFO];
     UmfpackGenLinSOE *theSOE;
 };
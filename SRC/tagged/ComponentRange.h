@@ -0,0 +1,75 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/ComponentRange.h,v $
+
+#ifndef ComponentRange_h
+#define ComponentRange_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for ComponentRange.
+// A ComponentRange is a view of a contiguous array of pointers to the
+// components of a container, e.g. the Elements of a Domain or the 
+// FE_Elements of an AnalysisModel. Unlike the iterators of the containers
+// it holds no position, so any number of loops, nested or on different
+// threads, may go through the same range; it is indexed at random and is
+// split into the chunks of the threads with chunk(). The range does not
+// own the array, which is valid until the container changes.
+//
+// What: "@(#) ComponentRange.h, revA"
+
+template <class T>
+class ComponentRange
+{
+  public:
+    ComponentRange() :theComponents(0), numComponents(0) {}
+    ComponentRange(T *const *components, int num)
+      :theComponents(components), numComponents(num) {}
+
+    T *const *begin(void) const {return theComponents;}
+    T *const *end(void) const {return theComponents + numComponents;}
+    int size(void) const {return numComponents;}
+    bool empty(void) const {return numComponents == 0;}
+    T *operator[](int i) const {return theComponents[i];}
+
+    // the part of the range for worker i of numChunks; the chunks follow
+    // each other in the order of the range and their sizes differ by one
+    // at most
+    ComponentRange chunk(int i, int numChunks) const {
+      if (numChunks < 1)
+	numChunks = 1;
+      int base = numComponents/numChunks;
+      int extra = numComponents%numChunks;
+      int start = i*base + ((i < extra) ? i : extra);
+      int num = base + ((i < extra) ? 1 : 0);
+      if (i < 0 || i >= numChunks)
+	return ComponentRange();
+      return ComponentRange(theComponents + start, num);
+    }
+
+  private:
+    T *const *theComponents;
+    int numComponents;
+};
+
+#endif
@@ -0,0 +1,322 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/HashOfTaggedObjects.cpp,v $
+
+// Created: 10/26
+//
+// Purpose: This file contains the implementation of the HashOfTaggedObjects
+// class.
+//
+// What: "@(#) HashOfTaggedObjects.C, revA"
+
+#include <TaggedObject.h>
+#include <HashOfTaggedObjects.h>
+
+#include <OPS_Globals.h>
+
+// multiplicative hash, the high bits are folded down as the table
+// uses the low bits and tags are often multiples of 10 or 100
+static inline unsigned int
+hashTag(int tag)
+{
+    unsigned int h = (unsigned int)tag * 2654435761u;
+    return h ^ (h >> 16);
+}
+
+
+HashOfTaggedObjects::HashOfTaggedObjects(int size)
+:theComponents(0), numComponents(0), sizeComponents(0), maxComponents(0),
+ theSlots(0), numSlots(0), numUsed(0),
+ myIter(*this)
+{
+    if (size < 1)
+	size = 1;
+
+    if (this->setSize(size) < 0)
+	opserr << "HashOfTaggedObjects::HashOfTaggedObjects - out of memory\n";
+}
+
+
+HashOfTaggedObjects::~HashOfTaggedObjects()
+{
+    this->clearAll();
+
+    if (theComponents != 0)
+	delete [] theComponents;
+    if (theSlots != 0)
+	delete [] theSlots;
+}
+
+
+int
+HashOfTaggedObjects::setSize(int newSize)
+{
+    // make room for newSize objects, keeping the table at most 1/4 full
+    if (newSize > maxComponents)
+	if (this->resizeComponents(newSize) < 0)
+	    return -1;
+
+    int newNumSlots = (numSlots > 0) ? numSlots : 8;
+    while (newNumSlots < 4*newSize)
+	newNumSlots *= 2;
+    if (newNumSlots > numSlots)
+	if (this->resizeTable(newNumSlots) < 0)
+	    return -1;
+
+    return 0;
+}
+
+
+bool
+HashOfTaggedObjects::addComponent(TaggedObject *newComponent)
+{
+    int tag = newComponent->getTag();
+
+    if (this->findSlot(tag) >= 0) {
+	opserr << "HashOfTaggedObjects::addComponent - not adding as one with similar tag exists, tag: " <<
+	  tag << "\n";
+	return false;
+    }
+
+    // make room at the end of the array, squeezing out the holes if
+    // at least half the entries are holes
+    if (sizeComponents == maxComponents) {
+	if (2*numComponents < sizeComponents)
+	    this->compact();
+	else if (this->resizeComponents(2*maxComponents) < 0) {
+	    opserr << "HashOfTaggedObjects::addComponent - out of memory adding tag: " << tag << "\n";
+	    return false;
+	}
+    }
+
+    // keep the table at most half full of objects and removed marks
+    if (2*(numUsed+1) > numSlots) {
+	int newNumSlots = numSlots;
+	while (newNumSlots < 4*(numComponents+1))
+	    newNumSlots *= 2;
+	if (this->resizeTable(newNumSlots) < 0) {
+	    opserr << "HashOfTaggedObjects::addComponent - out of memory adding tag: " << tag << "\n";
+	    return false;
+	}
+    }
+
+    int index = sizeComponents++;
+    theComponents[index] = newComponent;
+    numComponents++;
+
+    // the tag is not there, so the first empty or removed slot is taken
+    unsigned int mask = numSlots-1;
+    unsigned int slot = hashTag(tag) & mask;
+    while (theSlots[2*slot+1] > 0)
+	slot = (slot+1) & mask;
+    if (theSlots[2*slot+1] == 0)
+	numUsed++;
+    theSlots[2*slot] = tag;
+    theSlots[2*slot+1] = index+1;
+
+    return true;  // o.k.
+}
+
+
+TaggedObject *
+HashOfTaggedObjects::removeComponent(int tag)
+{
+    int slot = this->findSlot(tag);
+    if (slot < 0)
+	return 0;
+
+    // the slot is marked removed, not emptied, so that the probe
+    // sequences of other tags going through it are not broken
+    int index = theSlots[2*slot+1]-1;
+    TaggedObject *removed = theComponents[index];
+    theComponents[index] = 0;
+    theSlots[2*slot+1] = -1;
+    numComponents--;
+
+    // holes at the end are simply dropped, any iter going over the
+    // array is not affected as it stops at the last object anyway
+    while (sizeComponents > 0 && theComponents[sizeComponents-1] == 0)
+	sizeComponents--;
+
+    return removed;
+}
+
+
+int
+HashOfTaggedObjects::getNumComponents(void) const
+{
+    return numComponents;
+}
+
+
+TaggedObject *
+HashOfTaggedObjects::getComponentPtr(int tag)
+{
+    int slot = this->findSlot(tag);
+    if (slot < 0)
+	return 0;
+
+    return theComponents[theSlots[2*slot+1]-1];
+}
+
+
+TaggedObjectIter &
+HashOfTaggedObjects::getComponents()
+{
+    myIter.reset();
+    return myIter;
+}
+
+
+TaggedObjectStorage *
+HashOfTaggedObjects::getEmptyCopy(void)
+{
+    HashOfTaggedObjects *theCopy = new HashOfTaggedObjects();
+
+    if (theCopy == 0) {
+      opserr << "HashOfTaggedObjects::getEmptyCopy-out of memory\n";
+    }
+
+    return theCopy;
+}
+
+
+void
+HashOfTaggedObjects::clearAll(bool invokeDestructor)
+{
+    // invoke the destructor on all the tagged objects stored
+    for (int i=0; i<sizeComponents; i++) {
+	if (invokeDestructor == true && theComponents[i] != 0)
+	    delete theComponents[i];
+	theComponents[i] = 0;
+    }
+
+    for (int i=0; i<2*numSlots; i++)
+	theSlots[i] = 0;
+
+    numComponents = 0;
+    sizeComponents = 0;
+    numUsed = 0;
+}
+
+
+void
+HashOfTaggedObjects::Print(OPS_Stream &s, int flag)
+{
+    // go through the array invoking Print on non-zero entries
+    for (int i=0; i<sizeComponents; i++)
+	if (theComponents[i] != 0)
+	    theComponents[i]->Print(s, flag);
+}
+
+
+int
+HashOfTaggedObjects::findSlot(int tag) const
+{
+    if (numSlots == 0)
+	return -1;
+
+    unsigned int mask = numSlots-1;
+    unsigned int slot = hashTag(tag) & mask;
+    for (int i=0; i<numSlots; i++) {
+	int index = theSlots[2*slot+1];
+	if (index == 0)
+	    return -1;
+	if (index > 0 && theSlots[2*slot] == tag)
+	    return slot;
+	slot = (slot+1) & mask;
+    }
+
+    return -1;
+}
+
+
+int
+HashOfTaggedObjects::resizeTable(int newNumSlots)
+{
+    int *newSlots = new int[2*newNumSlots];
+    if (newSlots == 0)
+	return -1;
+
+    for (int i=0; i<2*newNumSlots; i++)
+	newSlots[i] = 0;
+
+    // insert the objects again, this drops the removed marks
+    unsigned int mask = newNumSlots-1;
+    for (int i=0; i<sizeComponents; i++) {
+	if (theComponents[i] != 0) {
+	    int tag = theComponents[i]->getTag();
+	    unsigned int slot = hashTag(tag) & mask;
+	    while (newSlots[2*slot+1] != 0)
+		slot = (slot+1) & mask;
+	    newSlots[2*slot] = tag;
+	    newSlots[2*slot+1] = i+1;
+	}
+    }
+
+    if (theSlots != 0)
+	delete [] theSlots;
+    theSlots = newSlots;
+    numSlots = newNumSlots;
+    numUsed = numComponents;
+
+    return 0;
+}
+
+
+int
+HashOfTaggedObjects::resizeComponents(int newMaxComponents)
+{
+    TaggedObject **newComponents = new TaggedObject *[newMaxComponents];
+    if (newComponents == 0)
+	return -1;
+
+    for (int i=0; i<sizeComponents; i++)
+	newComponents[i] = theComponents[i];
+    for (int i=sizeComponents; i<newMaxComponents; i++)
+	newComponents[i] = 0;
+
+    if (theComponents != 0)
+	delete [] theComponents;
+    theComponents = newComponents;
+    maxComponents = newMaxComponents;
+
+    return 0;
+}
+
+
+void
+HashOfTaggedObjects::compact(void)
+{
+    // move the objects down over the holes, keeping their order, the
+    // indices change so the table is built again
+    int newSize = 0;
+    for (int i=0; i<sizeComponents; i++)
+	if (theComponents[i] != 0)
+	    theComponents[newSize++] = theComponents[i];
+    for (int i=newSize; i<sizeComponents; i++)
+	theComponents[i] = 0;
+    sizeComponents = newSize;
+
+    this->resizeTable(numSlots);
+}
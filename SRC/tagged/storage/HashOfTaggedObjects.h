@@ -0,0 +1,89 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/HashOfTaggedObjects.h,v $
+
+#ifndef HashOfTaggedObjects_h
+#define HashOfTaggedObjects_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// HashOfTaggedObjects. HashOfTaggedObjects is a storage class. The class
+// is responsible for holding and providing access to objects of type
+// TaggedObject. The pointers are kept in one array in the order the
+// objects were added, which is the order the iter returns them in, and
+// an open addressing hash table of (tag, index) pairs with linear probing
+// finds the object for a tag. Unlike ArrayOfTaggedObjects the memory used
+// depends only on the number of objects, not on the range of the tags,
+// and unlike MapOfTaggedObjects there is no tree node per object to
+// allocate and chase, so a lookup touches one or two cache lines and
+// iterating is a walk along the array. The entry of a removed object is
+// left as a hole, the array is compacted on a later addComponent().
+//
+// What: "@(#) HashOfTaggedObjects.h, revA"
+
+#include <TaggedObjectStorage.h>
+#include <HashOfTaggedObjectsIter.h>
+
+class HashOfTaggedObjects : public TaggedObjectStorage
+{
+  public:
+    HashOfTaggedObjects(int size = 32);
+    ~HashOfTaggedObjects();
+
+    // public methods to populate a domain
+    int  setSize(int newSize);
+    bool addComponent(TaggedObject *newComponent);
+    TaggedObject *removeComponent(int tag);
+    int getNumComponents(void) const;
+
+    TaggedObject     *getComponentPtr(int tag);
+    TaggedObjectIter &getComponents();
+
+    TaggedObjectStorage *getEmptyCopy(void);
+    void clearAll(bool invokeDestructor = true);
+
+    void Print(OPS_Stream &s, int flag =0);
+    friend class HashOfTaggedObjectsIter;
+
+  protected:
+
+  private:
+    int findSlot(int tag) const;
+    int resizeTable(int newNumSlots);
+    int resizeComponents(int newMaxComponents);
+    void compact(void);
+
+    TaggedObject **theComponents; // the pointers in the order added, 0 if removed
+    int numComponents;            // number of objects stored
+    int sizeComponents;           // number of entries used, including holes
+    int maxComponents;            // size of theComponents
+
+    int *theSlots;   // pairs of tag and index+1, index 0 is empty and -1 removed
+    int numSlots;    // a power of 2
+    int numUsed;     // number of slots not empty
+
+    HashOfTaggedObjectsIter myIter;  // the iter for this object
+};
+
+#endif
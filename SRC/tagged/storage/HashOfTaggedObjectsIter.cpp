@@ -0,0 +1,67 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/tagged/storage/HashOfTaggedObjectsIter.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of HashOfTaggedObjectsIter.
+//
+// What: "@(#) HashOfTaggedObjectsIter.C, revA"
+
+#include <HashOfTaggedObjectsIter.h>
+#include <HashOfTaggedObjects.h>
+
+HashOfTaggedObjectsIter::HashOfTaggedObjectsIter(HashOfTaggedObjects &theStorage)
+:theComponents(&theStorage), currentIndex(0)
+{
+
+}
+
+
+HashOfTaggedObjectsIter::~HashOfTaggedObjectsIter()
+{
+
+}
+
+
+void
+HashOfTaggedObjectsIter::reset(void)
+{
+    currentIndex = 0;
+}
+
+
+TaggedObject *
+HashOfTaggedObjectsIter::operator()(void)
+{
+    // step over the entries of removed components
+    int sizeComponents = theComponents->sizeComponents;
+    TaggedObject **theArray = theComponents->theComponents;
+    while (currentIndex < sizeComponents) {
+	TaggedObject *result = theArray[currentIndex++];
+	if (result != 0)
+	    return result;
+    }
+
+    return 0;
+}
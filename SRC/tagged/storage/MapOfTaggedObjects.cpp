@@ -61,9 +61,9 @@ int
 MapOfTaggedObjects::setSize(int newSize)
 {
     // no setSize for map template .. can only check enough space available
-    int maxSize = theMap.max_size();
-    if (newSize > maxSize) {
-      opserr << "MapOfTaggedObjects::setSize - failed as map stl has a max size of " << maxSize << "\n";
+    // max_size() may be larger than an int can hold
+    if (newSize > 0 && (size_t)newSize > theMap.max_size()) {
+      opserr << "MapOfTaggedObjects::setSize - failed as map stl has a max size of " << (double)theMap.max_size() << "\n";
       return -1;
     } 
    
@@ -57,6 +57,7 @@
 
 #endif
 
+#include <OffScreenRenderer.h>
 #include <PlainMap.h>
 
 #include "TclFeViewer.h"
@@ -107,6 +108,47 @@ TclFeViewer_saveImage(ClientData clientData, Tcl_Interp *interp, int argc,
 int
 TclFeViewer_clearImage(ClientData clientData, Tcl_Interp *interp, int argc, 
 		  TCL_Char **argv);		 
+
+static void
+addFeViewerCommands(Tcl_Interp *interp)
+{
+  Tcl_CreateCommand(interp, "vrp", TclFeViewer_setVRP,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+
+  Tcl_CreateCommand(interp, "vpn", TclFeViewer_setVPN,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+
+  Tcl_CreateCommand(interp, "vup", TclFeViewer_setVUP,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+
+  Tcl_CreateCommand(interp, "viewWindow", TclFeViewer_setViewWindow,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  
+  Tcl_CreateCommand(interp, "plane", TclFeViewer_setPlaneDist,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+  
+  Tcl_CreateCommand(interp, "projection", TclFeViewer_setProjectionMode,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
+  
+  Tcl_CreateCommand(interp, "fill", TclFeViewer_setFillMode,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
+  
+  Tcl_CreateCommand(interp, "prp", TclFeViewer_setPRP,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+
+  Tcl_CreateCommand(interp, "port", TclFeViewer_setPortWindow,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+
+  Tcl_CreateCommand(interp, "display", TclFeViewer_displayModel,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
+  
+  Tcl_CreateCommand(interp, "clearImage", TclFeViewer_clearImage,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
+
+  Tcl_CreateCommand(interp, "saveImage", TclFeViewer_saveImage,
+		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
+}
+
 //
 // the class constructor, destructor and methods
 
@@ -151,42 +193,8 @@ TclFeViewer::TclFeViewer(const char *title, int xLoc, int yLoc, int width, int h
 
 #endif
   
-  // Call Tcl_CreateCommand for class specific commands
-  Tcl_CreateCommand(interp, "vrp", TclFeViewer_setVRP,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "vpn", TclFeViewer_setVPN,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "vup", TclFeViewer_setVUP,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "viewWindow", TclFeViewer_setViewWindow,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-  
-  Tcl_CreateCommand(interp, "plane", TclFeViewer_setPlaneDist,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
-  
-  Tcl_CreateCommand(interp, "projection", TclFeViewer_setProjectionMode,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
-  
-  Tcl_CreateCommand(interp, "fill", TclFeViewer_setFillMode,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
-  
-  Tcl_CreateCommand(interp, "prp", TclFeViewer_setPRP,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "port", TclFeViewer_setPortWindow,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
-
-  Tcl_CreateCommand(interp, "display", TclFeViewer_displayModel,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
-  
-  Tcl_CreateCommand(interp, "clearImage", TclFeViewer_clearImage,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
-
-  Tcl_CreateCommand(interp, "saveImage", TclFeViewer_saveImage,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
+  // add the class specific commands
+  addFeViewerCommands(interp);
 }
 
 
@@ -219,42 +227,28 @@ TclFeViewer::TclFeViewer(const char *title, int xLoc, int yLoc, int width, int h
 
 #endif
 
-  // call Tcl_CreateCommand for class specific commands
-  Tcl_CreateCommand(interp, "vrp", TclFeViewer_setVRP,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "vpn", TclFeViewer_setVPN,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "vup", TclFeViewer_setVUP,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-
-  Tcl_CreateCommand(interp, "viewWindow", TclFeViewer_setViewWindow,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
-  
-  Tcl_CreateCommand(interp, "plane", TclFeViewer_setPlaneDist,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
-  
-  Tcl_CreateCommand(interp, "projection", TclFeViewer_setProjectionMode,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
-  
-  Tcl_CreateCommand(interp, "fill", TclFeViewer_setFillMode,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
-  
-  Tcl_CreateCommand(interp, "prp", TclFeViewer_setPRP,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+  // add the class specific commands
+  addFeViewerCommands(interp);
+}
 
-  Tcl_CreateCommand(interp, "port", TclFeViewer_setPortWindow,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
+TclFeViewer::TclFeViewer(int width, int height, const char *videoFileName,
+			 Domain &_theDomain, int WipeFlag, Tcl_Interp *interp,
+			 double dT)
+  :Recorder(RECORDER_TAGS_TclFeViewer),
+  theMap(0),theRenderer(0), theDomain(&_theDomain),
+  theEleMode(-1), theNodeMode(-1), theDisplayFact(1),
+  deltaT(dT), nextTimeStampToRecord(0.0), wipeFlag(WipeFlag),
+  vrpSet(0),vpwindowSet(0),clippingPlaneDistancesSet(0)
+{
+  // set the static pointer used in the class
+  theTclFeViewer = this;
+  theMap = new PlainMap();
 
-  Tcl_CreateCommand(interp, "display", TclFeViewer_displayModel,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
-  
-  Tcl_CreateCommand(interp, "clearImage", TclFeViewer_clearImage,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);      
+  // no display needed, so also with _NOGRAPHICS
+  theRenderer = new OffScreenRenderer(width, height, *theMap, videoFileName);
 
-  Tcl_CreateCommand(interp, "saveImage", TclFeViewer_saveImage,
-		    (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL); 
+  // add the class specific commands
+  addFeViewerCommands(interp);
 }
 
 TclFeViewer::~TclFeViewer()
@@ -274,16 +268,9 @@ TclFeViewer::~TclFeViewer()
 int 
 TclFeViewer::record(int cTag, double timeStamp)
 {
-
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
-
   if (theRenderer == 0)
     return 0;
 
-
   //  theRenderer->displayModel(thetheEleMode, theNodeMode, theDisplayFact);
 
   // loop over the elements getting each to display itself
@@ -360,7 +347,6 @@ TclFeViewer::record(int cTag, double timeStamp)
   }
 
   return res;
-#endif
 }
 
 int 
@@ -379,57 +365,41 @@ TclFeViewer::restart(void)
 int
 TclFeViewer::setVRP(float xLoc, float yLoc , float zLoc)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
 
   int ok =  theRenderer->setVRP(xLoc, yLoc, zLoc);
   if (ok == 0)
     vrpSet = 1;
 
   return ok;
-#endif
 }
 
 int
 TclFeViewer::setVPN(float xdirn, float ydirn, float zdirn)
 {
-#ifdef _NOGRAPHICS
-
-  // if no graphics .. just return 0
-  return 0;
-
-#else
+  if (theRenderer == 0)
+    return 0;
 
   // view plane normal
   return theRenderer->setVPN(xdirn, ydirn, zdirn);
 
-#endif
 }
 
 int
 TclFeViewer::setVUP(float xdirn, float ydirn, float zdirn)
 {
-#ifdef _NOGRAPHICS
-
-  // if no graphics .. just return 0
-  return 0;
-
-#else
-
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->setVUP(xdirn, ydirn, zdirn);
 
-#endif
 }    
 
 int
 TclFeViewer::setViewWindow(float uMin, float uMax, float vMin, float vMax)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
 
   int ok = theRenderer->setViewWindow(uMin, uMax, vMin, vMax);
   if (ok == 0)
@@ -437,116 +407,89 @@ TclFeViewer::setViewWindow(float uMin, float uMax, float vMin, float vMax)
 
   return ok;
 
-#endif
 }        
 
 int
 TclFeViewer::setPlaneDist(float anear, float afar)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
 
   int ok = theRenderer->setPlaneDist(anear,afar);
   if (ok == 0)
     clippingPlaneDistancesSet = 1;
   return ok;
 
-#endif
 }            
 
 int
 TclFeViewer::setProjectionMode(const char *mode)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->setProjectionMode(mode);
-#endif
 }                
 
 int
 TclFeViewer::setFillMode(const char *mode)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->setFillMode(mode);
-#endif
 }                
 
 int
 TclFeViewer::setPRP(float uLoc, float vLoc , float nLoc)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->setPRP(uLoc, vLoc, nLoc);
-#endif
 }
     
     
 int
 TclFeViewer::setPortWindow(float left, float right, float bottom, float top)
 {     
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->setPortWindow(left,right,bottom,top);    
-#endif
 }
 
 int
 TclFeViewer::displayModel(int eleFlag, int nodeFlag, float displayFact)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
+
   // methods invoked on the FE_Viewer
   theEleMode = eleFlag;
   theNodeMode = nodeFlag;    
   theDisplayFact = displayFact;    
   return this->record(0, 0.0);
-#endif
 }
 
 int
 TclFeViewer::clearImage(void)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->clearImage();
-#endif
 }
 
 int
 TclFeViewer::saveImage(const char *fileName)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->saveImage(fileName);
-#endif
 }
 
 int
 TclFeViewer::saveImage(const char *imageName, const char *fileName)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return 0;
-#else
+  if (theRenderer == 0)
+    return 0;
   return theRenderer->saveImage(imageName, fileName);
-#endif
 }
     
 
@@ -556,10 +499,6 @@ int
 TclFeViewer_setVRP(ClientData clientData, Tcl_Interp *interp, int argc, 
 		   TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
   // check destructor has not been called
   if (theTclFeViewer == 0)
       return TCL_OK;    
@@ -587,17 +526,12 @@ TclFeViewer_setVRP(ClientData clientData, Tcl_Interp *interp, int argc,
   
   theTclFeViewer->setVRP(xLoc,yLoc,zLoc);
   return TCL_OK;  
-#endif
 }
 
 int
 TclFeViewer_setVPN(ClientData clientData, Tcl_Interp *interp, int argc, 
 		   TCL_Char **argv)
 {  
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
   // check destructor has not been called
   if (theTclFeViewer == 0)
       return TCL_OK;    
@@ -625,17 +559,12 @@ TclFeViewer_setVPN(ClientData clientData, Tcl_Interp *interp, int argc,
   
   theTclFeViewer->setVPN(xDirn,yDirn,zDirn);
   return 0;
-#endif
 }
 
 int
 TclFeViewer_setVUP(ClientData clientData, Tcl_Interp *interp, int argc, 
 		   TCL_Char **argv)
 {  
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
   // check destructor has not been called
   if (theTclFeViewer == 0)
       return TCL_OK;    
@@ -663,17 +592,12 @@ TclFeViewer_setVUP(ClientData clientData, Tcl_Interp *interp, int argc,
   
   theTclFeViewer->setVUP(xDirn,yDirn,zDirn);
   return TCL_OK;  
-#endif
 }
 
 int
 TclFeViewer_setViewWindow(ClientData clientData, Tcl_Interp *interp, int argc, 
 		   TCL_Char **argv)
 {  
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
   // check destructor has not been called
   if (theTclFeViewer == 0)
       return TCL_OK;    
@@ -704,16 +628,11 @@ TclFeViewer_setViewWindow(ClientData clientData, Tcl_Interp *interp, int argc,
   
   theTclFeViewer->setViewWindow(uMin,uMax,vMin,vMax);
   return TCL_OK;    
-#endif
 }
 int
 TclFeViewer_setPlaneDist(ClientData clientData, Tcl_Interp *interp, int argc, 
 			 TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -737,17 +656,12 @@ TclFeViewer_setPlaneDist(ClientData clientData, Tcl_Interp *interp, int argc,
 
   theTclFeViewer->setPlaneDist(anear, afar);    
   return TCL_OK;  
-#endif
 }
 
 int
 TclFeViewer_setProjectionMode(ClientData clientData, Tcl_Interp *interp, int argc, 
 			      TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -762,17 +676,12 @@ TclFeViewer_setProjectionMode(ClientData clientData, Tcl_Interp *interp, int arg
   // set the mode
   theTclFeViewer->setProjectionMode(argv[1]);    
   return TCL_OK;  
-#endif
 }
 
 int
 TclFeViewer_setFillMode(ClientData clientData, Tcl_Interp *interp, int argc, 
 			TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -787,17 +696,12 @@ TclFeViewer_setFillMode(ClientData clientData, Tcl_Interp *interp, int argc,
   // set the mode
   theTclFeViewer->setFillMode(argv[1]);    
   return TCL_OK;  
-#endif
 }
 
 int
 TclFeViewer_setPRP(ClientData clientData, Tcl_Interp *interp, int argc, 
 		   TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -826,17 +730,12 @@ TclFeViewer_setPRP(ClientData clientData, Tcl_Interp *interp, int argc,
   
   theTclFeViewer->setPRP(xLoc,yLoc,zLoc);
   return TCL_OK;  
-#endif
 }
 
 int
 TclFeViewer_setPortWindow(ClientData clientData, Tcl_Interp *interp, int argc, 
 			  TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -868,17 +767,12 @@ TclFeViewer_setPortWindow(ClientData clientData, Tcl_Interp *interp, int argc,
 
   theTclFeViewer->setPortWindow(uMin,uMax,vMin,vMax);    
   return TCL_OK;
-#endif
 }
 
 int
 TclFeViewer_displayModel(ClientData clientData, Tcl_Interp *interp, int argc, 
 			  TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -924,7 +818,6 @@ TclFeViewer_displayModel(ClientData clientData, Tcl_Interp *interp, int argc,
       theTclFeViewer->displayModel(eleFlag, nodeFlag, displayFact);
       return TCL_OK;    
   }
-#endif
 }
 
 
@@ -933,10 +826,6 @@ int
 TclFeViewer_clearImage(ClientData clientData, Tcl_Interp *interp, int argc, 
 		       TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -944,17 +833,12 @@ TclFeViewer_clearImage(ClientData clientData, Tcl_Interp *interp, int argc,
   
   theTclFeViewer->clearImage();
   return TCL_OK;
-#endif
 }
 
 int
 TclFeViewer_saveImage(ClientData clientData, Tcl_Interp *interp, int argc, 
 		      TCL_Char **argv)
 {
-#ifdef _NOGRAPHICS
-  // if no graphics .. just return 0
-  return TCL_OK;
-#else
 
   // check destructor has not been called
   if (theTclFeViewer == 0)
@@ -991,7 +875,6 @@ TclFeViewer_saveImage(ClientData clientData, Tcl_Interp *interp, int argc,
   }
 
   return TCL_OK;
-#endif
 }
 
 
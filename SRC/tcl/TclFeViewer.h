@@ -56,6 +56,11 @@ class TclFeViewer : public Recorder
         const char *fileName, Domain &theDomain, Tcl_Interp *interp,
         double deltaT = 0.0);
 
+    // renders off screen on a thread of its own into a PPM stream file
+    TclFeViewer(int width, int height, const char *videoFileName,
+		Domain &theDomain, int wipeFlag, Tcl_Interp *interp,
+		double deltaT = 0.0);
+
     TclFeViewer();
     ~TclFeViewer();
 
@@ -71,11 +71,31 @@ OPS_Stream *opserrPtr = &sserr;
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef _WIN32
+#include <unistd.h>
+#include <poll.h>
+#include <sys/wait.h>
+#endif
+
 #include <packages.h>
 
 #include <FEM_ObjectBrokerAllClasses.h>
 
 #include <Timer.h>
+#include <Profiler.h>
+#include <MeshRegion.h>
+#include <ContactSearch.h>
+#include <ThreadPool.h>
+#include <MemoryReport.h>
+#include <Benchmark.h>
+#include <ConvergenceLog.h>
+#include <SDOFEnsemble.h>
+#include <UniaxialMaterial.h>
+#include <TimeSeries.h>
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <ModelArena.h>
+#include <GeometryCache.h>
 #include <ModelBuilder.h>
 #include "commands.h"
 
@@ -85,6 +105,9 @@ OPS_Stream *opserrPtr = &sserr;
 #else
 #include <Domain.h>
 #endif
+#include <MapOfTaggedObjects.h>
+#include <HashOfTaggedObjects.h>
+#include <ArrayOfTaggedObjects.h>
 
 #include <Information.h>
 #include <Element.h>
@@ -125,6 +148,8 @@ OPS_Stream *opserrPtr = &sserr;
 #include <NewtonRaphson.h>
 #include <NewtonLineSearch.h>
 #include <ModifiedNewton.h>
+#include <AdaptiveNewton.h>
+#include <InexactNewton.h>
 #include <Broyden.h>
 #include <BFGS.h>
 #include <KrylovNewton.h>
@@ -135,6 +160,7 @@ OPS_Stream *opserrPtr = &sserr;
 #include <RaphsonAccelerator.h>
 #include <PeriodicAccelerator.h>
 #include <KrylovAccelerator.h>
+#include <AndersonAccelerator.h>
 #include <SecantAccelerator1.h>
 #include <SecantAccelerator2.h>
 #include <SecantAccelerator3.h>
@@ -176,6 +202,7 @@ extern void *OPS_AlphaOSGeneralized_TP(void);
 extern void *OPS_CentralDifference(void);
 extern void *OPS_CentralDifferenceAlternative(void);
 extern void *OPS_CentralDifferenceNoDamping(void);
+extern void *OPS_CentralDifferenceSubcycling(void);
 extern void *OPS_Collocation(void);
 extern void *OPS_CollocationHSFixedNumIter(void);
 extern void *OPS_CollocationHSIncrLimit(void);
@@ -203,6 +230,15 @@ extern void *OPS_NewmarkHSIncrLimit(void);
 extern void *OPS_NewmarkHSIncrReduct(void);
 extern void *OPS_WilsonTheta(void);
 
+extern void *OPS_SparseGenRowKrylovSolver(void);
+extern void *OPS_SparseBlockRowKrylovSolver(void);
+#ifdef _CUDSS
+extern void *OPS_CuDSSSolver(void);
+#endif
+#ifdef _PARDISO
+extern void *OPS_PardisoSolver(void);
+#endif
+
 #include <Newmark.h>
 #include <TRBDF2.h>
 #include <TRBDF3.h>
@@ -214,6 +250,7 @@ extern void *OPS_WilsonTheta(void);
 // analysis
 #include <StaticAnalysis.h>
 #include <DirectIntegrationAnalysis.h>
+#include <HarmonicAnalysis.h>
 #include <VariableTimeStepDirectIntegrationAnalysis.h>
 #include <PFEMAnalysis.h>
 
@@ -223,6 +260,7 @@ extern void *OPS_WilsonTheta(void);
 
 #include <BandGenLinSOE.h>
 #include <BandGenLinLapackSolver.h>
+#include <BandGenLinMixedSolver.h>
 
 #include <ConjugateGradientSolver.h>
 
@@ -236,6 +274,7 @@ extern void *OPS_WilsonTheta(void);
 
 #include <ProfileSPDLinSOE.h>
 #include <ProfileSPDLinDirectSolver.h>
+#include <ProfileSPDLinSupernodeSolver.h>
 #include <DiagonalSOE.h>
 #include <DiagonalDirectSolver.h>
 
@@ -243,9 +282,9 @@ extern void *OPS_WilsonTheta(void);
 #include <SProfileSPDLinSOE.h>
 
 // #include <ProfileSPDLinDirectBlockSolver.h>
-// #include <ProfileSPDLinDirectThreadSolver.h>
+#include <ProfileSPDLinDirectThreadSolver.h>
 // #include <ProfileSPDLinDirectSkypackSolver.h>
-// #include <BandSPDLinThreadSolver.h>
+#include <BandSPDLinThreadSolver.h>
 
 #include <SparseGenColLinSOE.h>
 #include <PFEMSolver.h>
@@ -300,6 +339,7 @@ extern void *OPS_WilsonTheta(void);
 #include <SymSparseLinSOE.h>
 #include <SymSparseLinSolver.h>
 #include <UmfpackGenLinSOE.h>
+#include <AutoLinSOE.h>
 #include <UmfpackGenLinSolver.h>
 #include <EigenSOE.h>
 #include <EigenSolver.h>
@@ -313,6 +353,8 @@ extern void *OPS_WilsonTheta(void);
 #include <SymBandEigenSolver.h>
 #include <FullGenEigenSOE.h>
 #include <FullGenEigenSolver.h>
+#include <DampedArpackSOE.h>
+#include <BlockLanczosSOE.h>
 
 #ifdef _CUDA
 #include <BandGenLinSOE_Single.h>
@@ -323,6 +365,7 @@ extern void *OPS_WilsonTheta(void);
 // graph
 #include <RCM.h>
 #include <AMDNumberer.h>
+#include <MetisNumberer.h>
 
 #include <ErrorHandler.h>
 #include <ConsoleErrorHandler.h>
@@ -386,6 +429,8 @@ ModelBuilder *theBuilder =0;
 #include <ShadowSubdomain.h>
 #include <Metis.h>
 #include <ShedHeaviest.h>
+#include <ReleaseHeavierToLighterNeighbours.h>
+#include <SwapHeavierToLighterNeighbours.h>
 #include <DomainPartitioner.h>
 #include <GraphPartitioner.h>
 #include <FEM_ObjectBrokerAllClasses.h>
@@ -417,6 +462,7 @@ PartitionedDomain theDomain;
 int OPS_PARALLEL_PROCESSING =0;
 int OPS_NUM_SUBDOMAINS      =0;
 bool OPS_PARTITIONED        =false;
+bool OPS_PREPARTITIONED     =false;
 bool OPS_USING_MAIN_DOMAIN  = false;
 int OPS_MAIN_DOMAIN_PARTITION_ID =0;
 
@@ -547,6 +593,7 @@ bool builtModel = false;
 static char *resDataPtr = 0;
 static int resDataSize = 0;
 static Timer *theTimer = 0;
+static MapOfTaggedObjects theContactSearches;
 
 #include <FileStream.h>
 #include <SimulationInformation.h>
@@ -621,6 +668,12 @@ opsRecv(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+opsEnsemble(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+opsDomainStorage(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int
 neesUpload(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -655,6 +708,12 @@ convertBinaryToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Cha
 int
 convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int
+convertColumnarToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int
+convertTextToSeries(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int
 maxOpenFiles(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -831,6 +890,12 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "getLoadFactor", &getLoadFactor,
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "damageLimit", &setDamageLimit,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "getDamageIndex", &getDamageIndex,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "criticalTimeStep", &criticalTimeStep,
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
 		
     Tcl_CreateCommand(interp, "build", &buildModel,
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
@@ -873,10 +938,16 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "eigen", &eigenAnalysis, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "harmonic", &harmonicAnalysis, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "video", &videoPlayer, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "remove", &removeObject, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "activate", &activateElements, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "deactivate", &activateElements, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
 
     Tcl_CreateCommand(interp, "eleForce", &eleForce, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);    
@@ -886,6 +957,12 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "eleResponse", &eleResponse, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "eleResponses", &eleResponses, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "nodeResponses", &nodeResponses, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "contactSearch", &contactSearch, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "nodeDisp", &nodeDisp, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
     Tcl_CreateCommand(interp, "setNodeDisp", &setNodeDisp, 
@@ -926,6 +1003,22 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "stop", &stopTimer, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "profile", &profileCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "threads", &threadsCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "memoryReport", &memoryReportCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "benchmark", &benchmarkCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "convergenceLog", &convergenceLogCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "sdofEnsemble", &sdofEnsembleCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "modelArena", &modelArenaCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
+    Tcl_CreateCommand(interp, "geometryCache", &geometryCacheCommand, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "rayleigh", &rayleighDamping, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);       
     Tcl_CreateCommand(interp, "modalDamping", &modalDamping, 
@@ -960,6 +1053,10 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "partition", &opsPartition, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "ensemble", &opsEnsemble, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
+    Tcl_CreateCommand(interp, "domainStorage", &opsDomainStorage, 
+		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
     Tcl_CreateCommand(interp, "searchPeerNGA", &peerNGA, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);
 
@@ -973,6 +1070,8 @@ int OpenSeesAppInit(Tcl_Interp *interp) {
     Tcl_CreateCommand(interp, "stripXML", &stripOpenSeesXML,(ClientData)NULL, NULL);
     Tcl_CreateCommand(interp, "convertBinaryToText", &convertBinaryToText,(ClientData)NULL, NULL);
     Tcl_CreateCommand(interp, "convertTextToBinary", &convertTextToBinary,(ClientData)NULL, NULL);
+    Tcl_CreateCommand(interp, "convertColumnarToText", &convertColumnarToText,(ClientData)NULL, NULL);
+    Tcl_CreateCommand(interp, "convertTextToSeries", &convertTextToSeries,(ClientData)NULL, NULL);
 
     Tcl_CreateCommand(interp, "getEleTags", &getEleTags, 
 		      (ClientData)NULL, (Tcl_CmdDeleteProc *)NULL);  
@@ -1351,12 +1450,16 @@ wipeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     delete theDatabase;
 
   theDomain.clearAll();
+  theContactSearches.clearAll();
 
   ops_Dt = 0.0;
 
 
 #ifdef _PARALLEL_PROCESSING
   OPS_PARTITIONED = false;
+  if (OPS_PREPARTITIONED == true && OPS_DOMAIN_PARTITIONER != 0)
+    OPS_DOMAIN_PARTITIONER->clearPartitions();
+  OPS_PREPARTITIONED = false;
 #endif
 
 #ifdef _NOGRAPHICS
@@ -1460,6 +1563,12 @@ resetModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 	if (theTransientIntegrator != 0) {
 		theTransientIntegrator->revertToStart();
 	}
+
+	// the algorithm drops any tangent kept from before the reset, the
+	// rest of the analysis is kept for the next run
+	if (theAlgorithm != 0) {
+		theAlgorithm->domainChanged();
+	}
 	
 	return TCL_OK;
 }
@@ -1535,6 +1644,52 @@ getTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+// command: damageLimit limit
+// the commit fails, halting the analysis, once a damage recorder reports
+// a damage index of at least limit; 0.0 removes the limit
+int 
+setDamageLimit(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+      opserr << "WARNING illegal command - damageLimit limit? \n";
+      return TCL_ERROR;
+  }
+  double limit;
+  if (Tcl_GetDouble(interp, argv[1], &limit) != TCL_OK) {
+      opserr << "WARNING reading damage limit - damageLimit limit? \n";
+      return TCL_ERROR;
+  }
+  theDomain.setDamageLimit(limit);
+  return TCL_OK;
+}
+
+// command: getDamageIndex
+// the largest damage index reported by the damage recorders at the last commit
+int 
+getDamageIndex(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  double index = theDomain.getDamageIndex();
+  
+  // now we copy the value to the tcl string that is returned
+  sprintf(interp->result,"%35.20f",index);
+  return TCL_OK;
+}
+
+int 
+criticalTimeStep(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  bool initial = false;
+  if (argc > 1 && strcmp(argv[1],"-initial") == 0)
+    initial = true;
+
+  double dt = theDomain.getCriticalTimeStep(initial);
+
+  char buffer[40];
+  sprintf(buffer, "%.16g", dt);
+  Tcl_SetResult(interp, buffer, TCL_VOLATILE);
+  return TCL_OK;
+}
+
 int 
 getLoadFactor(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -1648,11 +1803,9 @@ buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
 #ifdef _PARALLEL_PROCESSING
 
-int 
-partitionModel(int eleTag)
+static void
+createSubdomains(void)
 {
-  int result = 0;
-  
   if (OPS_theChannels != 0)
     delete [] OPS_theChannels;
 
@@ -1667,21 +1820,60 @@ partitionModel(int eleTag)
     }
   }
 
-  // create a partitioner & partition the domain
+  // create a partitioner
   if (OPS_DOMAIN_PARTITIONER == 0) {
-    //      OPS_BALANCER = new ShedHeaviest();
     OPS_GRAPH_PARTITIONER  = new Metis;
-    //OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
-    OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
+    if (OPS_BALANCER != 0)
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER, *OPS_BALANCER);
+    else
+      OPS_DOMAIN_PARTITIONER = new DomainPartitioner(*OPS_GRAPH_PARTITIONER);
     theDomain.setPartitioner(OPS_DOMAIN_PARTITIONER);
   }
- // opserr << "commands.cpp - partition numPartitions: " << OPS_NUM_SUBDOMAINS << endln;
+}
 
-  result = theDomain.partition(OPS_NUM_SUBDOMAINS, OPS_USING_MAIN_DOMAIN, OPS_MAIN_DOMAIN_PARTITION_ID, eleTag);
-  
-  if (result < 0) 
+//
+// the subdomains are created before the model is built and the nodes and
+// elements are then sent to them as they are added, as given in the mesh file
+//
+int 
+prePartitionModel(const char *meshFile)
+{
+  if (OPS_PARTITIONED == true || OPS_PREPARTITIONED == true) {
+    opserr << "WARNING partition -mesh - the model has already been partitioned\n";
+    return -1;
+  }
+
+  if (theDomain.getNumElements() != 0 || theDomain.getNumNodes() != 0) 
+    opserr << "WARNING partition -mesh - nodes and elements already in the model stay in the main domain\n";
+
+  createSubdomains();
+
+  int result = OPS_DOMAIN_PARTITIONER->setPartitions(meshFile, OPS_NUM_SUBDOMAINS,
+						     OPS_USING_MAIN_DOMAIN, OPS_MAIN_DOMAIN_PARTITION_ID);
+  if (result < 0)
     return result;
 
+  OPS_PREPARTITIONED = true;
+  return 0;
+}
+
+int 
+partitionModel(int eleTag)
+{
+  int result = 0;
+  
+  // a pre-partitioned model only needs the subdomain analyses
+  if (OPS_PREPARTITIONED == false) {
+    createSubdomains();
+
+    // opserr << "commands.cpp - partition numPartitions: " << OPS_NUM_SUBDOMAINS << endln;
+
+    result = theDomain.partition(OPS_NUM_SUBDOMAINS, OPS_USING_MAIN_DOMAIN, OPS_MAIN_DOMAIN_PARTITION_ID, eleTag);
+  
+    if (result < 0) 
+      return result;
+  }
+
   OPS_PARTITIONED = true;
   
   DomainDecompositionAnalysis *theSubAnalysis;
@@ -1726,14 +1918,79 @@ int
 opsPartition(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
 #ifdef _PARALLEL_PROCESSING
-  int eleTag;
-  if (argc == 2) {
+  // partition <eleTag?> <-balance maxImbalance? <numCommits?>> <-balancer type?>
+  // partition -mesh fileName, given before the model is built
+  int eleTag = 0;
+  double maxImbalance = 0.0;
+  int numCommits = 1;
+  bool balance = false;
+  const char *balancerType = "ShedHeaviest";
+
+  int loc = 1;
+  if (argc > 1 && argv[1][0] != '-') {
     if (Tcl_GetInt(interp, argv[1], &eleTag) != TCL_OK) {
       ;
     }
+    loc++;
+  }
+
+  if (argc > 1 && strcmp(argv[1],"-mesh") == 0) {
+    if (argc < 3) {
+      opserr << "WARNING partition -mesh fileName - no file given\n";
+      return TCL_ERROR;
+    }
+    if (OPS_NUM_SUBDOMAINS < 2) 
+      return TCL_OK;
+    if (prePartitionModel(argv[2]) < 0) {
+      opserr << "WARNING partition -mesh - failed to read partitions from " << argv[2] << endln;
+      return TCL_ERROR;
+    }
+    return TCL_OK;
+  }
+
+  while (loc < argc) {
+    if (strcmp(argv[loc],"-balance") == 0) {
+      if (loc+1 >= argc || Tcl_GetDouble(interp, argv[loc+1], &maxImbalance) != TCL_OK) {
+	opserr << "WARNING partition -balance maxImbalance? <numCommits?> - invalid maxImbalance\n";
+	return TCL_ERROR;
+      }
+      loc += 2;
+      if (loc < argc && argv[loc][0] != '-') {
+	if (Tcl_GetInt(interp, argv[loc], &numCommits) != TCL_OK || numCommits < 1) {
+	  opserr << "WARNING partition -balance maxImbalance? <numCommits?> - invalid numCommits\n";
+	  return TCL_ERROR;
+	}
+	loc++;
+      }
+      balance = true;
+    } else if (strcmp(argv[loc],"-balancer") == 0 && loc+1 < argc) {
+      balancerType = argv[loc+1];
+      loc += 2;
+    } else {
+      opserr << "WARNING partition - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
   }
+
+  // the balancer is given to the DomainPartitioner when it is created
+  if (balance == true && OPS_DOMAIN_PARTITIONER == 0 && OPS_BALANCER == 0) {
+    if (strcmp(balancerType,"ShedHeaviest") == 0)
+      OPS_BALANCER = new ShedHeaviest();
+    else if (strcmp(balancerType,"ReleaseHeavierToLighterNeighbours") == 0)
+      OPS_BALANCER = new ReleaseHeavierToLighterNeighbours();
+    else if (strcmp(balancerType,"SwapHeavierToLighterNeighbours") == 0)
+      OPS_BALANCER = new SwapHeavierToLighterNeighbours();
+    else {
+      opserr << "WARNING partition - unknown balancer " << balancerType << endln;
+      return TCL_ERROR;
+    }
+  }
+
   partitionModel(eleTag);
 
+  if (balance == true)
+    theDomain.setLoadBalancing(maxImbalance, numCommits);
+
 #endif
   return TCL_OK;
 }
@@ -1767,6 +2024,9 @@ analyzeModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **arg
       return TCL_ERROR;	      
 
     result = theStaticAnalysis->analyze(numIncr);
+
+    // a fallback integrator that took over goes on
+    theStaticIntegrator = theStaticAnalysis->getIntegrator();
 #ifdef _PFEM
   } else if(thePFEMAnalysis != 0) {
       result = thePFEMAnalysis->analyze();
@@ -2196,7 +2456,38 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
     if (argc < 2) {
 	opserr << "WARNING need to specify an analysis type (Static, Transient)\n";
 	return TCL_ERROR;
-    }    
+    }
+
+    // check for the option to have the FE_Elements formed grouped by
+    // element class (class), and within a class in equation order (eqn),
+    // strip it and create the analysis with what is left
+    for (int i=2; i<argc; i++) {
+      if (strcmp(argv[i],"-orderElements") == 0) {
+	bool byEqn = false;
+	if (i+1 < argc && strcmp(argv[i+1],"eqn") == 0)
+	  byEqn = true;
+	else if (i+1 >= argc || strcmp(argv[i+1],"class") != 0) {
+	  opserr << "WARNING analysis " << argv[1] << " ... -orderElements class|eqn\n";
+	  return TCL_ERROR;
+	}
+
+	TCL_Char **newArgv = new TCL_Char *[argc];
+	int newArgc = 0;
+	for (int j=0; j<argc; j++)
+	  if (j != i && j != i+1)
+	    newArgv[newArgc++] = argv[j];
+
+	int res = specifyAnalysis(clientData, interp, newArgc, newArgv);
+	delete [] newArgv;
+	if (res != TCL_OK)
+	  return res;
+
+	if (theAnalysisModel != 0)
+	  theAnalysisModel->setFE_Order(true, byEqn);
+
+	return TCL_OK;
+      }
+    }
 
     // delete the old analysis
     if (theStaticAnalysis != 0) {
@@ -2262,10 +2553,43 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 					       *theStaticIntegrator,
 					       theTest);
 
+	// the options to cut and grow the increment when the steps fail and
+	// succeed, and to predict the displacements of load control steps
+	double cut = 0.0;
+	double grow = 1.0;
+	int numGrow = 1;
+	int maxCuts = 10;
+	for (int i=2; i<argc; i++) {
+	  if (strcmp(argv[i],"-predictor") == 0)
+	    theStaticAnalysis->setPredictor(true);
+	  else if ((strcmp(argv[i],"-cut") == 0 || strcmp(argv[i],"-grow") == 0 ||
+		    strcmp(argv[i],"-numGrow") == 0 || strcmp(argv[i],"-maxCuts") == 0) && i+1 < argc) {
+	    int ok = TCL_OK;
+	    if (strcmp(argv[i],"-cut") == 0)
+	      ok = Tcl_GetDouble(interp, argv[++i], &cut);
+	    else if (strcmp(argv[i],"-grow") == 0)
+	      ok = Tcl_GetDouble(interp, argv[++i], &grow);
+	    else if (strcmp(argv[i],"-numGrow") == 0)
+	      ok = Tcl_GetInt(interp, argv[++i], &numGrow);
+	    else
+	      ok = Tcl_GetInt(interp, argv[++i], &maxCuts);
+	    if (ok != TCL_OK) {
+	      opserr << "WARNING analysis Static -cut $factor <-grow $factor> <-numGrow $numSteps> <-maxCuts $num> <-predictor>\n";
+	      return TCL_ERROR;
+	    }
+	  }
+	}
+	if (cut > 0.0 &&
+	    theStaticAnalysis->setStepCutting(cut, grow, numGrow, maxCuts) < 0)
+	  return TCL_ERROR;
+
 	#ifdef _PARALLEL_INTERPRETERS
 	if (setMPIDSOEFlag) {
 	  ((MPIDiagonalSOE*) theSOE)->setAnalysisModel(*theAnalysisModel);
 	}
+	if (theSOE->getClassTag() == LinSOE_TAGS_DistributedDiagonalSOE) {
+	  ((DistributedDiagonalSOE*) theSOE)->setAnalysisModel(*theAnalysisModel);
+	}
 #endif
 
 // AddingSensitivity:BEGIN ///////////////////////////////
@@ -2393,6 +2717,9 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	if (setMPIDSOEFlag) {
 	  ((MPIDiagonalSOE*) theSOE)->setAnalysisModel(*theAnalysisModel);
 	}
+	if (theSOE->getClassTag() == LinSOE_TAGS_DistributedDiagonalSOE) {
+	  ((DistributedDiagonalSOE*) theSOE)->setAnalysisModel(*theAnalysisModel);
+	}
 #endif
 
 // AddingSensitivity:BEGIN ///////////////////////////////
@@ -2473,6 +2800,49 @@ specifyAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	// set the pointer for variabble time step analysis
 	theTransientAnalysis = theVariableTimeStepTransientAnalysis;
 
+	// the options to set the step from the critical step of the domain,
+	// or to cut and grow it when the step fails and succeeds
+	double courant = 0.0;
+	int interval = 1;
+	bool initial = false;
+	double cut = 0.0;
+	double grow = 1.0;
+	int numGrow = 1;
+	for (int i=2; i<argc; i++) {
+	  if (strcmp(argv[i],"-courant") == 0 && i+1 < argc) {
+	    if (Tcl_GetDouble(interp, argv[++i], &courant) != TCL_OK) {
+	      opserr << "WARNING analysis VariableTransient -courant $fraction <-every $numSteps> <-initial>\n";
+	      return TCL_ERROR;
+	    }
+	  } else if (strcmp(argv[i],"-every") == 0 && i+1 < argc) {
+	    if (Tcl_GetInt(interp, argv[++i], &interval) != TCL_OK) {
+	      opserr << "WARNING analysis VariableTransient -courant $fraction <-every $numSteps> <-initial>\n";
+	      return TCL_ERROR;
+	    }
+	  } else if (strcmp(argv[i],"-initial") == 0)
+	    initial = true;
+	  else if ((strcmp(argv[i],"-cut") == 0 || strcmp(argv[i],"-grow") == 0 ||
+		    strcmp(argv[i],"-numGrow") == 0) && i+1 < argc) {
+	    int ok = TCL_OK;
+	    if (strcmp(argv[i],"-cut") == 0)
+	      ok = Tcl_GetDouble(interp, argv[++i], &cut);
+	    else if (strcmp(argv[i],"-grow") == 0)
+	      ok = Tcl_GetDouble(interp, argv[++i], &grow);
+	    else
+	      ok = Tcl_GetInt(interp, argv[++i], &numGrow);
+	    if (ok != TCL_OK) {
+	      opserr << "WARNING analysis VariableTransient -cut $factor <-grow $factor> <-numGrow $numSteps>\n";
+	      return TCL_ERROR;
+	    }
+	  }
+	}
+	if (courant > 0.0 && 
+	    theVariableTimeStepTransientAnalysis->setCourantFraction(courant, interval, initial) < 0)
+	  return TCL_ERROR;
+	if (cut > 0.0 &&
+	    theVariableTimeStepTransientAnalysis->setStepCutting(cut, grow, numGrow) < 0)
+	  return TCL_ERROR;
+
 	#ifdef _RELIABILITY
 
 	//////////////////////////////////
@@ -2679,7 +3049,28 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   // BAND GENERAL SOE & SOLVER
   if ((strcmp(argv[1],"BandGeneral") == 0) || (strcmp(argv[1],"BandGEN") == 0)
       || (strcmp(argv[1],"BandGen") == 0)){
-    BandGenLinSolver    *theSolver = new BandGenLinLapackSolver();
+    BandGenLinSolver    *theSolver = 0;
+    if (argc > 2 && strcmp(argv[2],"-mixed") == 0) {
+      int maxRefine = 10;
+      double tol = 1.0e-14;
+      int count = 3;
+      while (count < argc-1) {
+	if (strcmp(argv[count],"-maxRefine") == 0) {
+	  if (Tcl_GetInt(interp, argv[count+1], &maxRefine) != TCL_OK) {
+	    opserr << "WARNING system BandGeneral -mixed - invalid -maxRefine\n";
+	    return TCL_ERROR;
+	  }
+	} else if (strcmp(argv[count],"-tol") == 0) {
+	  if (Tcl_GetDouble(interp, argv[count+1], &tol) != TCL_OK) {
+	    opserr << "WARNING system BandGeneral -mixed - invalid -tol\n";
+	    return TCL_ERROR;
+	  }
+	}
+	count += 2;
+      }
+      theSolver = new BandGenLinMixedSolver(maxRefine, tol);
+    } else
+      theSolver = new BandGenLinLapackSolver();
 #ifdef _PARALLEL_PROCESSING
     theSOE = new DistributedBandGenLinSOE(*theSolver);      
 #else
@@ -2697,7 +3088,16 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   // BAND SPD SOE & SOLVER
   else if (strcmp(argv[1],"BandSPD") == 0) {
-      BandSPDLinSolver    *theSolver = new BandSPDLinLapackSolver();   
+      BandSPDLinSolver    *theSolver = 0;
+      if (argc > 2 && strcmp(argv[2],"-thread") == 0) {
+	int blockSize = 32;
+	if (argc > 3 && Tcl_GetInt(interp, argv[3], &blockSize) != TCL_OK) {
+	  opserr << "WARNING system BandSPD -thread <blockSize?> - invalid blockSize\n";
+	  return TCL_ERROR;
+	}
+	theSolver = new BandSPDLinThreadSolver(blockSize);
+      } else
+	theSolver = new BandSPDLinLapackSolver();   
 #ifdef _PARALLEL_PROCESSING
       theSOE = new DistributedBandSPDLinSOE(*theSolver);        
 #else
@@ -2729,6 +3129,16 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       theSOE = new DiagonalSOE(*theSolver);
 #endif
   } 
+  // Diagonal SOE & SOLVER exchanging the shared entries with the neighbouring processes only
+  else if (strcmp(argv[1],"ParallelDiagonal") == 0) {
+#ifdef _PARALLEL_INTERPRETERS
+      DistributedDiagonalSolver    *theSolver = new DistributedDiagonalSolver();   
+      theSOE = new DistributedDiagonalSOE(*theSolver);
+#else
+      DiagonalSolver    *theSolver = new DiagonalDirectSolver();   
+      theSOE = new DiagonalSOE(*theSolver);
+#endif
+  } 
 
 
   // PROFILE SPD SOE * SOLVER
@@ -2740,7 +3150,23 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
   else if (strcmp(argv[1],"ProfileSPD") == 0) {
     // now must determine the type of solver to create from rest of args
-    ProfileSPDLinSolver *theSolver = new ProfileSPDLinDirectSolver(); 	
+    ProfileSPDLinSolver *theSolver = 0;
+    const char *scratchDir = 0;
+    for (int i=2; i<argc-1; i++)
+      if (strcmp(argv[i],"-oocDir") == 0)
+	scratchDir = argv[i+1];
+
+    if (argc > 2 && strcmp(argv[2],"-column") == 0)
+      theSolver = new ProfileSPDLinDirectSolver(); 	
+    else if (argc > 2 && strcmp(argv[2],"-thread") == 0) {
+      int blockSize = 16;
+      if (argc > 3 && argv[3][0] != '-' && Tcl_GetInt(interp, argv[3], &blockSize) != TCL_OK) {
+	opserr << "WARNING system ProfileSPD -thread <blockSize?> - invalid blockSize\n";
+	return TCL_ERROR;
+      }
+      theSolver = new ProfileSPDLinDirectThreadSolver(blockSize); 	
+    } else
+      theSolver = new ProfileSPDLinSupernodeSolver(); 	
 
     /* *********** Some misc solvers i play with ******************
     else if (strcmp(argv[2],"Normal") == 0) {
@@ -2795,7 +3221,12 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 #ifdef _PARALLEL_PROCESSING
     theSOE = new DistributedProfileSPDLinSOE(*theSolver);
 #else
-    theSOE = new ProfileSPDLinSOE(*theSolver);      
+    ProfileSPDLinSOE *theProfileSOE = new ProfileSPDLinSOE(*theSolver);      
+    if (scratchDir != 0 && theProfileSOE->setScratchDirectory(scratchDir) < 0) {
+      delete theProfileSOE;
+      return TCL_ERROR;
+    }
+    theSOE = theProfileSOE;
 #endif
   }
 
@@ -2820,6 +3251,19 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
       } else if(strcmp(argv[2], "-umfpack") == 0) {
 	  PFEMSolver_Umfpack* theSolver = new PFEMSolver_Umfpack();
           theSOE = new PFEMLinSOE(*theSolver);
+      } else if(strcmp(argv[2], "-pcg") == 0) {
+	  double tol = 1e-12;
+	  int maxIter = 50;
+	  if (argc > 3 && Tcl_GetDouble(interp, argv[3], &tol) != TCL_OK) {
+	      opserr<<"WARNING: failed to read tol\n";
+	      return TCL_ERROR;
+	  }
+	  if (argc > 4 && Tcl_GetInt(interp, argv[4], &maxIter) != TCL_OK) {
+	      opserr<<"WARNING: failed to read maxIter\n";
+	      return TCL_ERROR;
+	  }
+	  PFEMSolver* theSolver = new PFEMSolver(true, tol, maxIter);
+          theSOE = new PFEMLinSOE(*theSolver);
       } else if (strcmp(argv[2],"-mumps") ==0) {
 #ifdef _PARALLEL_INTERPRETERS
 	  int relax = 20;
@@ -2848,6 +3292,42 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 #endif
   }
 
+  // PRECONDITIONED KRYLOV SOLVERS ON THE SPARSE ROW SOE
+  else if (strcmp(argv[1],"Krylov") == 0) {
+    OPS_ResetInput(clientData, interp, 2, argc, argv, &theDomain, NULL);
+    theSOE = (LinearSOE *)OPS_SparseGenRowKrylovSolver();
+    if (theSOE == 0)
+      return TCL_ERROR;
+  }
+
+  // KRYLOV SOLVERS ON THE NODE BLOCK SOE
+  else if (strcmp(argv[1],"BlockKrylov") == 0) {
+    OPS_ResetInput(clientData, interp, 2, argc, argv, &theDomain, NULL);
+    theSOE = (LinearSOE *)OPS_SparseBlockRowKrylovSolver();
+    if (theSOE == 0)
+      return TCL_ERROR;
+  }
+
+#ifdef _CUDSS
+  // cuDSS DIRECT SOLVER ON THE GPU
+  else if (strcmp(argv[1],"CuDSS") == 0) {
+    OPS_ResetInput(clientData, interp, 2, argc, argv, &theDomain, NULL);
+    theSOE = (LinearSOE *)OPS_CuDSSSolver();
+    if (theSOE == 0)
+      return TCL_ERROR;
+  }
+#endif
+
+#ifdef _PARDISO
+  // PARDISO SHARED MEMORY PARALLEL SPARSE DIRECT SOLVER
+  else if (strcmp(argv[1],"Pardiso") == 0) {
+    OPS_ResetInput(clientData, interp, 2, argc, argv, &theDomain, NULL);
+    theSOE = (LinearSOE *)OPS_PardisoSolver();
+    if (theSOE == 0)
+      return TCL_ERROR;
+  }
+#endif
+
 #ifdef _WIN32
   else if ((_stricmp(argv[1],"CuSP")==0)) {
 
@@ -3011,9 +3491,9 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     double thresh = 0.0;
     int npRow = 1;
     int npCol = 1;
-    int np = 1;
 
-    // defaults for threaded SuperLU
+    // defaults for threaded SuperLU, -np overrides the threads command
+    int np = ThreadPool::getNumThreads();
 
     while (count < argc) {
 
@@ -3110,6 +3590,7 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
     int factLVALUE = 10;
     int factorOnce=0;
     int printTime = 0;
+    bool natural = false;
     int count = 2;
     while (count < argc) {
       if ((strcmp(argv[count],"-lValueFact") == 0) || (strcmp(argv[count],"-lvalueFact") == 0) || (strcmp(argv[count],"-LVALUE") == 0)) {
@@ -3120,14 +3601,34 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 	factorOnce = 1;
       } else if ((strcmp(argv[count],"-printTime") == 0) || (strcmp(argv[count],"-time") ==0 )) {
 	printTime = 1;
+      } else if (strcmp(argv[count],"-natural") == 0) {
+	natural = true;
       }
       count++;
     }
     
-    UmfpackGenLinSolver *theSolver = new UmfpackGenLinSolver();
+    UmfpackGenLinSolver *theSolver = new UmfpackGenLinSolver(natural);
     // theSOE = new UmfpackGenLinSOE(*theSolver, factLVALUE, factorOnce, printTime);      
     theSOE = new UmfpackGenLinSOE(*theSolver);      
   }	
+
+  // the system picked from the DOF graph when the analysis is sized
+  else if (strcmp(argv[1],"Auto") == 0) {
+    int symmetry = AUTO_SOE_DETECT;
+    bool trial = false;
+    bool verbose = true;
+    for (int count = 2; count < argc; count++) {
+      if (strcmp(argv[count],"-symmetric") == 0)
+	symmetry = AUTO_SOE_SYMMETRIC;
+      else if (strcmp(argv[count],"-unsymmetric") == 0)
+	symmetry = AUTO_SOE_UNSYMMETRIC;
+      else if (strcmp(argv[count],"-trial") == 0)
+	trial = true;
+      else if (strcmp(argv[count],"-quiet") == 0)
+	verbose = false;
+    }
+    theSOE = new AutoLinSOE(symmetry, trial, verbose);
+  }
   
 #ifdef _ITPACK
 //  else if (strcmp(argv[1],"Itpack") == 0) {
@@ -3227,6 +3728,9 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
     int icntl14 = 20;    
     int icntl7 = 7;
+    bool outOfCore = false;
+    const char *oocDir = 0;
+    int oocMemory = 0;
 
     int currentArg = 2;
     while (currentArg < argc) {
@@ -3239,6 +3743,22 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 	  if (Tcl_GetInt(interp, argv[currentArg+1], &icntl7) != TCL_OK)	
 	    ;
 	  currentArg += 2;
+	} else if (strcmp(argv[currentArg],"-ooc") == 0) {
+	  // factors out-of-core, in MUMPS_OOC_TMPDIR unless -oocDir is given
+	  outOfCore = true;
+	  currentArg++;
+	} else if (strcmp(argv[currentArg],"-oocDir") == 0 && currentArg+1 < argc) {
+	  outOfCore = true;
+	  oocDir = argv[currentArg+1];
+	  currentArg += 2;
+	} else if (strcmp(argv[currentArg],"-oocMemory") == 0 && currentArg+1 < argc) {
+	  // working memory of each process in MB
+	  outOfCore = true;
+	  if (Tcl_GetInt(interp, argv[currentArg+1], &oocMemory) != TCL_OK) {
+	    opserr << "WARNING system Mumps -oocMemory MB - invalid MB\n";
+	    return TCL_ERROR;
+	  }
+	  currentArg += 2;
 	} else 
 	  currentArg++;
       }    
@@ -3246,15 +3766,21 @@ specifySOE(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 
 #ifdef _PARALLEL_PROCESSING
     MumpsParallelSolver *theSolver = new MumpsParallelSolver(icntl7, icntl14);
+    if (outOfCore)
+      theSolver->setOutOfCore(oocDir, oocMemory);
     theSOE = new MumpsParallelSOE(*theSolver);
 #elif _PARALLEL_INTERPRETERS
     MumpsParallelSolver *theSolver = new MumpsParallelSolver(icntl7, icntl14);
+    if (outOfCore)
+      theSolver->setOutOfCore(oocDir, oocMemory);
     MumpsParallelSOE *theParallelSOE = new MumpsParallelSOE(*theSolver);
     theParallelSOE->setProcessID(OPS_rank);
     theParallelSOE->setChannels(numChannels, theChannels);
     theSOE = theParallelSOE;
 #else
     MumpsSolver *theSolver = new MumpsSolver(icntl7, icntl14);
+    if (outOfCore)
+      theSolver->setOutOfCore(oocDir, oocMemory);
     theSOE = new MumpsSOE(*theSolver);
 #endif
 
@@ -3386,6 +3912,9 @@ specifyNumberer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
   } else if (strcmp(argv[1],"AMD") == 0) {
     AMD *theAMD = new AMD();	
     theNumberer = new DOF_Numberer(*theAMD);    	
+  } else if (strcmp(argv[1],"Metis") == 0) {
+    MetisNumberer *theMetis = new MetisNumberer();	
+    theNumberer = new DOF_Numberer(*theMetis);    	
   } 
 
 #ifdef _PARALLEL_INTERPRETERS
@@ -3401,6 +3930,12 @@ specifyNumberer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **
     theNumberer = theParallelNumberer;       
     theParallelNumberer->setProcessID(OPS_rank);
     theParallelNumberer->setChannels(numChannels, theChannels);
+  } else if (strcmp(argv[1],"ParallelMetis") == 0) {
+    MetisNumberer *theMetis = new MetisNumberer();	
+    ParallelNumberer *theParallelNumberer = new ParallelNumberer(*theMetis);    	
+    theNumberer = theParallelNumberer;       
+    theParallelNumberer->setProcessID(OPS_rank);
+    theParallelNumberer->setChannels(numChannels, theChannels);
   }   
 
 #endif
@@ -3501,6 +4036,19 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
   }    
   EquiSolnAlgo *theNewAlgo = 0;
 
+  // algorithm -fallback type ... adds the algorithm to those a variable
+  // time step analysis tries when a step fails
+  bool fallback = false;
+  if (strcmp(argv[1],"-fallback") == 0) {
+    if (theVariableTimeStepTransientAnalysis == 0 || argc < 3) {
+      opserr << "WARNING algorithm -fallback type ... - needs a VariableTransient analysis\n";
+      return TCL_ERROR;
+    }
+    fallback = true;
+    argc--;
+    argv++;
+  }
+
   // check argv[1] for type of Algorithm and create the object
   if (strcmp(argv[1],"Linear") == 0) {
     int formTangent = CURRENT_TANGENT;
@@ -3579,6 +4127,56 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
     theNewAlgo = new AcceleratedNewton(*theTest, theAccel, incrementTangent);
   }
 
+  else if (strcmp(argv[1],"AndersonNewton") == 0) {
+    int incrementTangent = CURRENT_TANGENT;
+    int iterateTangent = CURRENT_TANGENT;
+    int maxDim = 3;
+    int restart = 0;
+    double mixing = 1.0;
+    for (int i = 2; i < argc; i++) {
+      if (strcmp(argv[i],"-iterate") == 0 && i+1 < argc) {
+	i++;
+	if (strcmp(argv[i],"current") == 0)
+	  iterateTangent = CURRENT_TANGENT;
+	if (strcmp(argv[i],"initial") == 0)
+	  iterateTangent = INITIAL_TANGENT;
+	if (strcmp(argv[i],"noTangent") == 0)
+	  iterateTangent = NO_TANGENT;
+      } 
+      else if (strcmp(argv[i],"-increment") == 0 && i+1 < argc) {
+	i++;
+	if (strcmp(argv[i],"current") == 0)
+	  incrementTangent = CURRENT_TANGENT;
+	if (strcmp(argv[i],"initial") == 0)
+	  incrementTangent = INITIAL_TANGENT;
+	if (strcmp(argv[i],"noTangent") == 0)
+	  incrementTangent = NO_TANGENT;
+      }
+      else if (strcmp(argv[i],"-maxDim") == 0 && i+1 < argc) {
+	i++;
+	maxDim = atoi(argv[i]);
+      }
+      else if (strcmp(argv[i],"-restart") == 0 && i+1 < argc) {
+	i++;
+	restart = atoi(argv[i]);
+      }
+      else if (strcmp(argv[i],"-mixing") == 0 && i+1 < argc) {
+	if (Tcl_GetDouble(interp, argv[++i], &mixing) != TCL_OK)
+	  return TCL_ERROR;
+      }
+    }
+
+    if (theTest == 0) {
+      opserr << "ERROR: No ConvergenceTest yet specified\n";
+      return TCL_ERROR;	  
+    }
+
+    Accelerator *theAccel;
+    theAccel = new AndersonAccelerator(maxDim, restart, mixing, iterateTangent);
+
+    theNewAlgo = new AcceleratedNewton(*theTest, theAccel, incrementTangent);
+  }
+
   else if (strcmp(argv[1],"RaphsonNewton") == 0) {
     int incrementTangent = CURRENT_TANGENT;
     int iterateTangent = CURRENT_TANGENT;
@@ -3798,10 +4396,73 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
       
     theNewAlgo = new ModifiedNewton(*theTest, formTangent); 
   }  
-  
-  else if (strcmp(argv[1],"NewtonLineSearch") == 0) {
-      if (theTest == 0) {
-	  opserr << "ERROR: No ConvergenceTest yet specified\n";
+
+  else if (strcmp(argv[1],"AdaptiveNewton") == 0) {
+    int formTangent = CURRENT_TANGENT;
+    double maxRatio = 0.25;
+    bool keepAcrossSteps = true;
+    for (int i = 2; i < argc; i++) {
+      if (strcmp(argv[i],"-secant") == 0) {
+	formTangent = CURRENT_SECANT;
+      } else if (strcmp(argv[i],"-initial") == 0) {
+	formTangent = INITIAL_TANGENT;
+      } else if (strcmp(argv[i],"-maxRatio") == 0 && i+1 < argc) {
+	if (Tcl_GetDouble(interp, argv[++i], &maxRatio) != TCL_OK) {
+	  opserr << "WARNING algorithm AdaptiveNewton -maxRatio $ratio - invalid ratio\n";
+	  return TCL_ERROR;
+	}
+      } else if (strcmp(argv[i],"-everyStep") == 0) {
+	keepAcrossSteps = false;
+      }
+    }
+    if (theTest == 0) {
+      opserr << "ERROR: No ConvergenceTest yet specified\n";
+      return TCL_ERROR;	  
+    }
+
+    theNewAlgo = new AdaptiveNewton(*theTest, formTangent, maxRatio, keepAcrossSteps); 
+  }
+
+  else if (strcmp(argv[1],"InexactNewton") == 0) {
+    int formTangent = CURRENT_TANGENT;
+    double eta0 = 0.5;
+    double etaMax = 0.9;
+    double gamma = 0.9;
+    double alpha = 2.0;
+    for (int i = 2; i < argc; i++) {
+      double *value = 0;
+      if (strcmp(argv[i],"-secant") == 0) {
+	formTangent = CURRENT_SECANT;
+      } else if (strcmp(argv[i],"-initial") == 0) {
+	formTangent = INITIAL_TANGENT;
+      } else if (strcmp(argv[i],"-eta0") == 0) {
+	value = &eta0;
+      } else if (strcmp(argv[i],"-etaMax") == 0) {
+	value = &etaMax;
+      } else if (strcmp(argv[i],"-gamma") == 0) {
+	value = &gamma;
+      } else if (strcmp(argv[i],"-alpha") == 0) {
+	value = &alpha;
+      }
+      if (value != 0) {
+	if (i+1 >= argc || Tcl_GetDouble(interp, argv[i+1], value) != TCL_OK) {
+	  opserr << "WARNING algorithm InexactNewton " << argv[i] << " $value - invalid value\n";
+	  return TCL_ERROR;
+	}
+	i++;
+      }
+    }
+    if (theTest == 0) {
+      opserr << "ERROR: No ConvergenceTest yet specified\n";
+      return TCL_ERROR;	  
+    }
+
+    theNewAlgo = new InexactNewton(*theTest, formTangent, eta0, etaMax, gamma, alpha); 
+  }
+  
+  else if (strcmp(argv[1],"NewtonLineSearch") == 0) {
+      if (theTest == 0) {
+	  opserr << "ERROR: No ConvergenceTest yet specified\n";
 	  return TCL_ERROR;	  
       }
 
@@ -3878,6 +4539,9 @@ specifyAlgorithm(ClientData clientData, Tcl_Interp *interp, int argc,
   }    
 
 
+  if (theNewAlgo != 0 && fallback == true)
+    return (theVariableTimeStepTransientAnalysis->addFallback(*theNewAlgo) < 0) ? TCL_ERROR : TCL_OK;
+
   if (theNewAlgo != 0) {
     theAlgorithm = theNewAlgo;
     
@@ -3915,6 +4579,18 @@ specifyCTest(ClientData clientData, Tcl_Interp *interp, int argc,
       return TCL_ERROR;
   }    
 
+  // test -fallback type ... sets the test of the last fallback algorithm
+  bool fallback = false;
+  if (strcmp(argv[1],"-fallback") == 0) {
+    if (theVariableTimeStepTransientAnalysis == 0 || argc < 3) {
+      opserr << "WARNING test -fallback type ... - needs a VariableTransient analysis\n";
+      return TCL_ERROR;
+    }
+    fallback = true;
+    argc--;
+    argv++;
+  }
+
   // get the tolerence first
   double tol = 0.0;
   double tol2 = 0.0;
@@ -4110,6 +4786,14 @@ specifyCTest(ClientData clientData, Tcl_Interp *interp, int argc,
     }    
   }
 
+  if (theNewTest != 0 && fallback == true) {
+    if (theVariableTimeStepTransientAnalysis->setFallbackTest(*theNewTest) < 0) {
+      delete theNewTest;
+      return TCL_ERROR;
+    }
+    return TCL_OK;
+  }
+
   if (theNewTest != 0) {
     theTest = theNewTest;
 
@@ -4144,6 +4828,126 @@ specifyIntegrator(ClientData clientData, Tcl_Interp *interp, int argc,
 		  TCL_Char **argv)
 {
 
+  // integrator -fallback type ... adds the integrator to those a static
+  // analysis tries when a step fails, e.g. DisplacementControl near a
+  // limit point of LoadControl
+  if (argc > 2 && strcmp(argv[1],"-fallback") == 0) {
+    if (theStaticAnalysis == 0) {
+      opserr << "WARNING integrator -fallback type ... - needs a Static analysis\n";
+      return TCL_ERROR;
+    }
+
+    StaticAnalysis *theAnalysis = theStaticAnalysis;
+    StaticIntegrator *oldStaticIntegrator = theStaticIntegrator;
+    TransientIntegrator *oldTransientIntegrator = theTransientIntegrator;
+    theStaticAnalysis = 0;
+    int res = specifyIntegrator(clientData, interp, argc-1, argv+1);
+    StaticIntegrator *theFallback = theStaticIntegrator;
+    theStaticAnalysis = theAnalysis;
+    theStaticIntegrator = oldStaticIntegrator;
+    if (theTransientIntegrator != oldTransientIntegrator) {
+      delete theTransientIntegrator;
+      theTransientIntegrator = oldTransientIntegrator;
+    }
+    if (res != TCL_OK)
+      return res;
+
+    if (theFallback == oldStaticIntegrator) {
+      opserr << "WARNING integrator -fallback " << argv[2] << " - only for static integrators\n";
+      return TCL_ERROR;
+    }
+    return (theStaticAnalysis->addFallback(*theFallback) < 0) ? TCL_ERROR : TCL_OK;
+  }
+
+  // check for the option to have the element contributions formed by
+  // several threads (0 for the number set with the threads command), strip
+  // it and create the integrator with what is left
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-numThreads") == 0) {
+      int numThreads;
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &numThreads) != TCL_OK) {
+	opserr << "WARNING integrator " << argv[1] << " ... -numThreads numThreads\n";
+	return TCL_ERROR;
+      }
+
+      TCL_Char **newArgv = new TCL_Char *[argc];
+      int newArgc = 0;
+      for (int j=0; j<argc; j++)
+	if (j != i && j != i+1)
+	  newArgv[newArgc++] = argv[j];
+
+      StaticIntegrator *oldStaticIntegrator = theStaticIntegrator;
+      TransientIntegrator *oldTransientIntegrator = theTransientIntegrator;
+      int res = specifyIntegrator(clientData, interp, newArgc, newArgv);
+      delete [] newArgv;
+      if (res != TCL_OK)
+	return res;
+
+      if (theStaticIntegrator != oldStaticIntegrator && theStaticIntegrator != 0)
+	theStaticIntegrator->setNumThreads(numThreads);
+      else if (theTransientIntegrator != oldTransientIntegrator && theTransientIntegrator != 0)
+	theTransientIntegrator->setNumThreads(numThreads);
+
+      return TCL_OK;
+    }
+  }
+
+  // check for the option to have an explicit integrator take the step
+  // without the LinearSOE when the mass is lumped
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-lumped") == 0) {
+      TCL_Char **newArgv = new TCL_Char *[argc];
+      int newArgc = 0;
+      for (int j=0; j<argc; j++)
+	if (j != i)
+	  newArgv[newArgc++] = argv[j];
+
+      TransientIntegrator *oldTransientIntegrator = theTransientIntegrator;
+      int res = specifyIntegrator(clientData, interp, newArgc, newArgv);
+      delete [] newArgv;
+      if (res != TCL_OK)
+	return res;
+
+      if (theTransientIntegrator != oldTransientIntegrator && theTransientIntegrator != 0)
+	theTransientIntegrator->setLumped(true);
+      else
+	opserr << "WARNING integrator " << argv[1] << " -lumped - only for transient integrators, ignored\n";
+
+      return TCL_OK;
+    }
+  }
+
+  // check for the option to form the residuals of the elastic elements of
+  // the lumped step on a CUDA device
+  for (int i=2; i<argc; i++) {
+    if (strcmp(argv[i],"-device") == 0) {
+      int device;
+      if (i+1 >= argc || Tcl_GetInt(interp, argv[i+1], &device) != TCL_OK) {
+	opserr << "WARNING integrator " << argv[1] << " ... -device id\n";
+	return TCL_ERROR;
+      }
+
+      TCL_Char **newArgv = new TCL_Char *[argc];
+      int newArgc = 0;
+      for (int j=0; j<argc; j++)
+	if (j != i && j != i+1)
+	  newArgv[newArgc++] = argv[j];
+
+      TransientIntegrator *oldTransientIntegrator = theTransientIntegrator;
+      int res = specifyIntegrator(clientData, interp, newArgc, newArgv);
+      delete [] newArgv;
+      if (res != TCL_OK)
+	return res;
+
+      if (theTransientIntegrator != oldTransientIntegrator && theTransientIntegrator != 0)
+	theTransientIntegrator->setDevice(device);
+      else
+	opserr << "WARNING integrator " << argv[1] << " -device - only for transient integrators, ignored\n";
+
+      return TCL_OK;
+    }
+  }
+
   OPS_ResetInput(clientData, interp, 2, argc, argv, &theDomain, NULL);	  
 
   // make sure at least one other argument to contain integrator
@@ -4930,6 +5734,13 @@ specifyIntegrator(ClientData clientData, Tcl_Interp *interp, int argc,
       theTransientAnalysis->setIntegrator(*theTransientIntegrator);
   }
   
+  else if (strcmp(argv[1],"CentralDifferenceSubcycling") == 0) {
+    theTransientIntegrator = (TransientIntegrator *)OPS_CentralDifferenceSubcycling();
+    
+    if (theTransientAnalysis != 0)
+      theTransientAnalysis->setIntegrator(*theTransientIntegrator);
+  }
+  
   else if (strcmp(argv[1],"Transient") == 0) {
 
     theTransientIntegrator = 0;
@@ -5200,6 +6011,7 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
   int loc = 1;
   double shift = 0.0;
   bool findSmallest = true;
+  int blockSize = 0;
   
   // Check type of eigenvalue analysis
   while (loc < (argc-1)) {
@@ -5233,6 +6045,22 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
          (strcmp(argv[loc],"fullGenLapackEigen") == 0) || 
          (strcmp(argv[loc],"-fullGenLapackEigen") == 0))
       typeSolver = EigenSOE_TAGS_FullGenEigenSOE;
+
+    else if ((strcmp(argv[loc],"dampedArpack") == 0) || 
+	     (strcmp(argv[loc],"-dampedArpack") == 0))
+      typeSolver = EigenSOE_TAGS_DampedArpackSOE;
+
+    else if ((strcmp(argv[loc],"blockLanczos") == 0) || 
+	     (strcmp(argv[loc],"-blockLanczos") == 0))
+      typeSolver = EigenSOE_TAGS_BlockLanczosSOE;
+
+    else if (strcmp(argv[loc],"-blockSize") == 0) {
+      if (loc+2 >= argc || Tcl_GetInt(interp, argv[loc+1], &blockSize) != TCL_OK || blockSize < 0) {
+	opserr << "WARNING eigen -blockSize blockSize? - invalid blockSize\n";
+	return TCL_ERROR;
+      }
+      loc++;
+    }
     
     else {
       opserr << "eigen - unknown option specified " << argv[loc] << endln;
@@ -5316,6 +6144,14 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 	FullGenEigenSolver *theEigenSolver = new FullGenEigenSolver();
 	theEigenSOE = new FullGenEigenSOE(*theEigenSolver, *theAnalysisModel);
 
+      } else if (typeSolver == EigenSOE_TAGS_DampedArpackSOE) {
+
+	theEigenSOE = new DampedArpackSOE(shift);
+
+      } else if (typeSolver == EigenSOE_TAGS_BlockLanczosSOE) {
+
+	theEigenSOE = new BlockLanczosSOE(shift, blockSize);
+
       } else {
 
 	theEigenSOE = new ArpackSOE(shift);    
@@ -5389,6 +6225,134 @@ eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc,
 }
 
 
+int 
+harmonicAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, 
+		 TCL_Char **argv)
+{
+  // harmonic <-omega> f1? f2? ... -node nodeTag? dof? <-node nodeTag? dof? ...>
+  // returns for each frequency a list {re im re im ...} of the steady state
+  // response of the node dofs to the nodal loads at the current time
+  if (argc < 5) {
+    opserr << "WARNING want - harmonic <-omega> f1? f2? ... -node nodeTag? dof? ...\n";
+    return TCL_ERROR;
+  }
+
+  bool circular = false;
+  Vector omegas(argc);
+  int numOmega = 0;
+  ID nodeTags(0, 4);
+  ID dofs(0, 4);
+  int numResponse = 0;
+
+  int loc = 1;
+  while (loc < argc) {
+    double value;
+    if (strcmp(argv[loc],"-omega") == 0) {
+      circular = true;
+      loc++;
+    } else if (strcmp(argv[loc],"-node") == 0 && loc+2 < argc) {
+      int tag, dof;
+      if (Tcl_GetInt(interp, argv[loc+1], &tag) != TCL_OK ||
+	  Tcl_GetInt(interp, argv[loc+2], &dof) != TCL_OK) {
+	opserr << "WARNING harmonic - invalid -node nodeTag? dof? " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      nodeTags[numResponse] = tag;
+      dofs[numResponse] = dof-1;
+      numResponse++;
+      loc += 3;
+    } else if (Tcl_GetDouble(interp, argv[loc], &value) == TCL_OK) {
+      omegas(numOmega++) = value;
+      loc++;
+    } else {
+      opserr << "WARNING harmonic - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  if (numOmega == 0 || numResponse == 0) {
+    opserr << "WARNING harmonic - want at least one frequency and one -node\n";
+    return TCL_ERROR;
+  }
+
+  // the frequencies are in cycles per unit time unless -omega
+  Vector theOmegas(numOmega);
+  for (int i=0; i<numOmega; i++)
+    theOmegas(i) = circular ? omegas(i) : 2.0*3.14159265358979323846*omegas(i);
+
+  //
+  // set up the AnalysisModel with the current analysis, creating a
+  // transient analysis if no analysis exists, as for eigen
+  //
+
+  if (theStaticAnalysis == 0 && theTransientAnalysis == 0) {
+
+    if (theAnalysisModel == 0) 
+      theAnalysisModel = new AnalysisModel();
+    if (theTest == 0) 
+      theTest = new CTestNormUnbalance(1.0e-6,25,0);       
+    if (theAlgorithm == 0)
+      theAlgorithm = new NewtonRaphson(*theTest); 
+    if (theHandler == 0)
+      theHandler = new TransformationConstraintHandler();       
+    if (theNumberer == 0) {
+      RCM *theRCM = new RCM(false);	
+      theNumberer = new DOF_Numberer(*theRCM);    	
+    }
+    if (theTransientIntegrator == 0)
+      theTransientIntegrator = new Newmark(0.5,0.25);       
+    if (theSOE == 0) {
+      ProfileSPDLinSolver *theSolver;
+      theSolver = new ProfileSPDLinDirectSolver(); 	
+      theSOE = new ProfileSPDLinSOE(*theSolver);      
+    }
+	
+    theTransientAnalysis = new DirectIntegrationAnalysis(theDomain,
+							 *theHandler,
+							 *theNumberer,
+							 *theAnalysisModel,
+							 *theAlgorithm,
+							 *theSOE,
+							 *theTransientIntegrator,
+							 theTest);
+  }
+
+  int result = 0;
+  if (theStaticAnalysis != 0)
+    result = theStaticAnalysis->checkDomainChange();
+  else
+    result = theTransientAnalysis->checkDomainChange();
+
+  if (result < 0) {
+    opserr << "WARNING harmonic - failed to set up the analysis\n";
+    return TCL_ERROR;
+  }
+
+  HarmonicAnalysis theHarmonic(theDomain, *theAnalysisModel);
+  if (theHarmonic.analyze(theOmegas) < 0) {
+    opserr << "WARNING harmonic - the analysis failed\n";
+    return TCL_ERROR;
+  }
+
+  char buffer[80];
+  for (int i=0; i<numOmega; i++) {
+    Tcl_AppendResult(interp, "{", NULL);
+    for (int j=0; j<numResponse; j++) {
+      double re, im;
+      if (theHarmonic.getNodeResponse(nodeTags(j), dofs(j), i, re, im) < 0) {
+	opserr << "WARNING harmonic - no response for node " << nodeTags(j);
+	opserr << " dof " << dofs(j)+1 << endln;
+      }
+      sprintf(buffer, "%.10e %.10e ", re, im);
+      Tcl_AppendResult(interp, buffer, NULL);
+    }
+    Tcl_AppendResult(interp, "} ", NULL);
+  }
+
+  return TCL_OK;
+}
+
+
 int 
 videoPlayer(ClientData clientData, Tcl_Interp *interp, int argc, 
 	    TCL_Char **argv)
@@ -5715,6 +6679,42 @@ removeObject(ClientData clientData, Tcl_Interp *interp, int argc,
 }
 
 
+// activate eleTag1 eleTag2 ..., deactivate eleTag1 eleTag2 ...
+// take elements out of the analysis and put them back without changing
+// the Domain, e.g. for staged construction. An element that is activated
+// again starts from its initial state.
+
+int 
+activateElements(ClientData clientData, Tcl_Interp *interp, int argc, 
+		 TCL_Char **argv)
+{
+  bool activate = (strcmp(argv[0],"activate") == 0);
+
+  if (argc < 2) {
+    opserr << "WARNING want - " << argv[0] << " eleTag1 eleTag2 ...\n";
+    return TCL_ERROR;
+  }    
+
+  for (int i = 1; i < argc; i++) {
+    int tag;
+    if (Tcl_GetInt(interp, argv[i], &tag) != TCL_OK) {
+      opserr << "WARNING " << argv[0] << " eleTag? failed to read tag: " << argv[i] << endln;
+      return TCL_ERROR;
+    }      
+    Element *theEle = theDomain.getElement(tag);
+    if (theEle == 0) {
+      opserr << "WARNING " << argv[0] << " - no element with tag " << tag << endln;
+      return TCL_ERROR;
+    }
+    if (activate == true && theEle->isActive() == false)
+      theEle->revertToStart();
+    theEle->setActive(activate);
+  }
+
+  return TCL_OK;
+}
+
+
 int
 getCTestNorms(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -6218,86 +7218,349 @@ eleResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv
 
 
 
-int 
-findID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+// reads the nodes or elements of a batch query starting at argv[loc]:
+//   -node tags... | -nodeRange start? end? | -region regTag?
+// or -ele, -eleRange for the elements; returns the loc after them
+static int
+getQueryTags(Tcl_Interp *interp, int argc, TCL_Char **argv, int loc, bool nodes, ID &tags)
 {
-    // make sure at least one other argument to contain type of system
-    if (argc < 2) {
-	opserr << "WARNING want - findNodesWithID ?id\n";
-	return TCL_ERROR;
-   }    
+  if (loc+1 >= argc)
+    return -1;
 
+  if (strcmp(argv[loc], nodes ? "-node" : "-ele") == 0) {
+    int numTags = 0;
     int tag;
+    loc++;
+    while (loc < argc && Tcl_GetInt(0, argv[loc], &tag) == TCL_OK) {
+      tags[numTags++] = tag;
+      loc++;
+    }
+    return numTags > 0 ? loc : -1;
 
-    if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
-	opserr << "WARNING eleForce eleTag? dof? - could not read nodeTag? \n";
-	return TCL_ERROR;	        
-    }    
-
-    NodeIter &theNodes = theDomain.getNodes();
-    Node *theNode;
-    char buffer[20] ={0};
-    
+  } else if (strcmp(argv[loc], nodes ? "-nodeRange" : "-eleRange") == 0) {
+    int start, end;
+    if (loc+2 >= argc || 
+	Tcl_GetInt(interp, argv[loc+1], &start) != TCL_OK ||
+	Tcl_GetInt(interp, argv[loc+2], &end) != TCL_OK || end < start)
+      return -1;
+    tags.resize(end-start+1);
+    for (int i=start; i<=end; i++)
+      tags(i-start) = i;
+    return loc+3;
 
-    while ((theNode = theNodes()) != 0) {
-      DOF_Group *theGroup = theNode->getDOF_GroupPtr();
-      if (theGroup != 0) {
-	const ID &nodeID =  theGroup->getID();
-	for (int i=0; i<nodeID.Size(); i++) {
-	  if (nodeID(i) == tag) {
-	    sprintf(buffer, "%d ", theNode->getTag());
-	    Tcl_AppendResult(interp, buffer, NULL);
-	    break;
-	  }
-	}
-      }
+  } else if (strcmp(argv[loc], "-region") == 0) {
+    int tag;
+    if (Tcl_GetInt(interp, argv[loc+1], &tag) != TCL_OK)
+      return -1;
+    MeshRegion *theRegion = theDomain.getRegion(tag);
+    if (theRegion == 0) {
+      opserr << "WARNING region " << tag << " not found\n";
+      return -1;
     }
-      
-    return TCL_OK;
+    tags = nodes ? theRegion->getNodes() : theRegion->getElements();
+    return loc+2;
+  }
+
+  return -1;
+}
+
+// sets the values as the list returned by the command
+static void
+setListResult(Tcl_Interp *interp, const Vector &values, int size)
+{
+  Tcl_Obj **theObjs = new Tcl_Obj *[size > 0 ? size : 1];
+  for (int i=0; i<size; i++)
+    theObjs[i] = Tcl_NewDoubleObj(values(i));
+  Tcl_SetObjResult(interp, Tcl_NewListObj(size, theObjs));
+  delete [] theObjs;
 }
 
 int 
-nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+nodeResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
-  // make sure at least one other argument to contain type of system
-  if (argc < 2) {
-    opserr << "WARNING want - nodeCoord nodeTag? <dim?>\n";
+  if (argc < 4) {
+    opserr << "WARNING want - nodeResponses type? <-dof dof?> -node tags... | -nodeRange start? end? | -region regTag?\n";
     return TCL_ERROR;
-  }    
-  
-  int tag;
-  
-  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
-    opserr << "WARNING nodeCoord nodeTag? dim? - could not read nodeTag? \n";
-    return TCL_ERROR;	        
-  }    
-
-  int dim = -1;
-
-  if (argc > 2) {
-    if (strcmp(argv[2],"X") == 0 || strcmp(argv[2],"x") == 0 ||
-	strcmp(argv[2],"1") == 0)
-      dim = 0;
-    else if (strcmp(argv[2],"Y") == 0 || strcmp(argv[2],"y") == 0 ||
-	     strcmp(argv[2],"2") == 0)
-      dim = 1;
-    else if (strcmp(argv[2],"Z") == 0 || strcmp(argv[2],"z") == 0 ||
-	     strcmp(argv[2],"3") == 0)
-      dim = 2;
-    else {
-      opserr << "WARNING nodeCoord nodeTag? dim? - could not read dim? \n";
-      return TCL_ERROR;	        
-    }        
-  }    
+  }
 
+  NodeResponseType responseType;
+  if (strcmp(argv[1],"disp") == 0)
+    responseType = Disp;
+  else if (strcmp(argv[1],"vel") == 0)
+    responseType = Vel;
+  else if (strcmp(argv[1],"accel") == 0)
+    responseType = Accel;
+  else if (strcmp(argv[1],"incrDisp") == 0)
+    responseType = IncrDisp;
+  else if (strcmp(argv[1],"incrDeltaDisp") == 0)
+    responseType = IncrDeltaDisp;
+  else if (strcmp(argv[1],"reaction") == 0)
+    responseType = Reaction;
+  else if (strcmp(argv[1],"unbalance") == 0)
+    responseType = Unbalance;
+  else if (strcmp(argv[1],"rayleighForces") == 0)
+    responseType = RayleighForces;
+  else {
+    opserr << "WARNING nodeResponses - unknown response type " << argv[1] << endln;
+    return TCL_ERROR;
+  }
 
-  Node *theNode = theDomain.getNode(tag);
+  int loc = 2;
+  int dof = -1;
+  if (strcmp(argv[loc],"-dof") == 0) {
+    if (Tcl_GetInt(interp, argv[loc+1], &dof) != TCL_OK) {
+      opserr << "WARNING nodeResponses - could not read dof " << argv[loc+1] << endln;
+      return TCL_ERROR;
+    }
+    loc += 2;
+  }
+  dof--;
 
-  if (theNode == 0) {
+  ID tags(0, 32);
+  loc = getQueryTags(interp, argc, argv, loc, true, tags);
+  if (loc < 0 || loc != argc) {
+    opserr << "WARNING nodeResponses - want -node tags... | -nodeRange start? end? | -region regTag?\n";
     return TCL_ERROR;
   }
 
-  const Vector &coords = theNode->getCrds();
+  static Vector values(0);
+  int size = theDomain.getNodeResponses(tags, responseType, dof, values);
+  if (size < 0)
+    return TCL_ERROR;
+
+  setListResult(interp, values, size);
+  return TCL_OK;
+}
+
+int 
+eleResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 4) {
+    opserr << "WARNING want - eleResponses -ele tags... | -eleRange start? end? | -region regTag? eleArgs...\n";
+    return TCL_ERROR;
+  }
+
+  ID tags(0, 32);
+  int loc = getQueryTags(interp, argc, argv, 1, false, tags);
+  if (loc < 0) {
+    opserr << "WARNING eleResponses - want -ele tags... | -eleRange start? end? | -region regTag?\n";
+    return TCL_ERROR;
+  }
+  if (loc >= argc) {
+    opserr << "WARNING eleResponses - no response given\n";
+    return TCL_ERROR;
+  }
+
+  static Vector values(0);
+  int size = theDomain.getElementResponses(tags, argv+loc, argc-loc, values);
+  if (size < 0)
+    return TCL_ERROR;
+
+  setListResult(interp, values, size);
+  return TCL_OK;
+}
+
+// sets the slave and master tags of the pairs as the list returned
+static void
+setPairsResult(Tcl_Interp *interp, const ID &pairs)
+{
+  int size = pairs.Size();
+  Tcl_Obj **theObjs = new Tcl_Obj *[size > 0 ? size : 1];
+  for (int i=0; i<size; i++)
+    theObjs[i] = Tcl_NewIntObj(pairs(i));
+  Tcl_SetObjResult(interp, Tcl_NewListObj(size, theObjs));
+  delete [] theObjs;
+}
+
+int 
+contactSearch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // contactSearch tag? -master nodes -slave nodes -radius r? <-skin s?> <-nearest>
+  // contactSearch tag? update | pairs | remove
+  // where nodes are -node tags... | -nodeRange start? end? | -region regTag?;
+  // returns the slave and master tags of the new pairs, or of all pairs
+  if (argc < 3) {
+    opserr << "WARNING want - contactSearch tag? -master nodes -slave nodes -radius r? <-skin s?> <-nearest>\n";
+    opserr << "            or contactSearch tag? update | pairs | remove\n";
+    return TCL_ERROR;
+  }
+
+  int tag;
+  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+    opserr << "WARNING contactSearch - invalid tag " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+
+  ContactSearch *theSearch = (ContactSearch *)theContactSearches.getComponentPtr(tag);
+
+  if (strcmp(argv[2],"update") == 0 || strcmp(argv[2],"pairs") == 0 ||
+      strcmp(argv[2],"remove") == 0) {
+    if (theSearch == 0) {
+      opserr << "WARNING contactSearch " << tag << " not found\n";
+      return TCL_ERROR;
+    }
+
+    if (strcmp(argv[2],"remove") == 0) {
+      theContactSearches.removeComponent(tag);
+      delete theSearch;
+      return TCL_OK;
+    }
+
+    if (strcmp(argv[2],"pairs") == 0) {
+      setPairsResult(interp, theSearch->getPairs());
+      return TCL_OK;
+    }
+
+    if (theSearch->update(theDomain) < 0) {
+      opserr << "WARNING contactSearch " << tag << " update failed\n";
+      return TCL_ERROR;
+    }
+    setPairsResult(interp, theSearch->getNewPairs());
+    return TCL_OK;
+  }
+
+  if (theSearch != 0) {
+    opserr << "WARNING contactSearch " << tag << " already exists\n";
+    return TCL_ERROR;
+  }
+
+  ID masterNodes(0, 32);
+  ID slaveNodes(0, 32);
+  double radius = 0.0;
+  double skin = -1.0;
+  bool nearest = false;
+
+  int loc = 2;
+  while (loc < argc) {
+    if (strcmp(argv[loc],"-master") == 0 || strcmp(argv[loc],"-slave") == 0) {
+      ID &theNodes = strcmp(argv[loc],"-master") == 0 ? masterNodes : slaveNodes;
+      loc = getQueryTags(interp, argc, argv, loc+1, true, theNodes);
+      if (loc < 0) {
+	opserr << "WARNING contactSearch - want -master or -slave -node tags... | -nodeRange start? end? | -region regTag?\n";
+	return TCL_ERROR;
+      }
+    } else if (strcmp(argv[loc],"-radius") == 0 && loc+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &radius) != TCL_OK || radius <= 0.0) {
+	opserr << "WARNING contactSearch - invalid radius " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      loc += 2;
+    } else if (strcmp(argv[loc],"-skin") == 0 && loc+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &skin) != TCL_OK || skin < 0.0) {
+	opserr << "WARNING contactSearch - invalid skin " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      loc += 2;
+    } else if (strcmp(argv[loc],"-nearest") == 0) {
+      nearest = true;
+      loc++;
+    } else {
+      opserr << "WARNING contactSearch - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+  }
+
+  if (masterNodes.Size() == 0 || slaveNodes.Size() == 0 || radius <= 0.0) {
+    opserr << "WARNING contactSearch - want -master nodes -slave nodes -radius r?\n";
+    return TCL_ERROR;
+  }
+
+  // by default the nodes are binned again after moving a quarter of the radius
+  if (skin < 0.0)
+    skin = 0.5*radius;
+
+  theSearch = new ContactSearch(tag, masterNodes, slaveNodes, radius, skin, nearest);
+  if (theSearch->search(theDomain) < 0) {
+    delete theSearch;
+    return TCL_ERROR;
+  }
+
+  theContactSearches.addComponent(theSearch);
+  setPairsResult(interp, theSearch->getNewPairs());
+  return TCL_OK;
+}
+
+
+int 
+findID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+    // make sure at least one other argument to contain type of system
+    if (argc < 2) {
+	opserr << "WARNING want - findNodesWithID ?id\n";
+	return TCL_ERROR;
+   }    
+
+    int tag;
+
+    if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+	opserr << "WARNING eleForce eleTag? dof? - could not read nodeTag? \n";
+	return TCL_ERROR;	        
+    }    
+
+    NodeIter &theNodes = theDomain.getNodes();
+    Node *theNode;
+    char buffer[20] ={0};
+    
+
+    while ((theNode = theNodes()) != 0) {
+      DOF_Group *theGroup = theNode->getDOF_GroupPtr();
+      if (theGroup != 0) {
+	const ID &nodeID =  theGroup->getID();
+	for (int i=0; i<nodeID.Size(); i++) {
+	  if (nodeID(i) == tag) {
+	    sprintf(buffer, "%d ", theNode->getTag());
+	    Tcl_AppendResult(interp, buffer, NULL);
+	    break;
+	  }
+	}
+      }
+    }
+      
+    return TCL_OK;
+}
+
+int 
+nodeCoord(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // make sure at least one other argument to contain type of system
+  if (argc < 2) {
+    opserr << "WARNING want - nodeCoord nodeTag? <dim?>\n";
+    return TCL_ERROR;
+  }    
+  
+  int tag;
+  
+  if (Tcl_GetInt(interp, argv[1], &tag) != TCL_OK) {
+    opserr << "WARNING nodeCoord nodeTag? dim? - could not read nodeTag? \n";
+    return TCL_ERROR;	        
+  }    
+
+  int dim = -1;
+
+  if (argc > 2) {
+    if (strcmp(argv[2],"X") == 0 || strcmp(argv[2],"x") == 0 ||
+	strcmp(argv[2],"1") == 0)
+      dim = 0;
+    else if (strcmp(argv[2],"Y") == 0 || strcmp(argv[2],"y") == 0 ||
+	     strcmp(argv[2],"2") == 0)
+      dim = 1;
+    else if (strcmp(argv[2],"Z") == 0 || strcmp(argv[2],"z") == 0 ||
+	     strcmp(argv[2],"3") == 0)
+      dim = 2;
+    else {
+      opserr << "WARNING nodeCoord nodeTag? dim? - could not read dim? \n";
+      return TCL_ERROR;	        
+    }        
+  }    
+
+
+  Node *theNode = theDomain.getNode(tag);
+
+  if (theNode == 0) {
+    return TCL_ERROR;
+  }
+
+  const Vector &coords = theNode->getCrds();
   
   int size = coords.Size();
   if (dim == -1) {
@@ -7790,6 +9053,442 @@ stopTimer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
   return TCL_OK;
 }
 
+int 
+profileCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want - profile start <-counters?>|stop|reset|report <fileName?>|trace start fileName|stop\n";
+    return TCL_ERROR;
+  }
+
+  if (strcmp(argv[1],"start") == 0) {
+    // -counters adds the hardware counters, where there are any
+    if (argc > 2 && strcmp(argv[2],"-counters") == 0)
+      Profiler::setCounters(true);
+    Profiler::start();
+  } else if (strcmp(argv[1],"stop") == 0)
+    Profiler::stop();
+  else if (strcmp(argv[1],"trace") == 0) {
+    // trace start fileName|stop; the timeline of the phases on each rank
+    if (argc > 3 && strcmp(argv[2],"start") == 0) {
+      if (Tracer::start(argv[3]) < 0)
+	return TCL_ERROR;
+    } else if (argc > 2 && strcmp(argv[2],"stop") == 0)
+      Tracer::stop();
+    else {
+      opserr << "WARNING want - profile trace start fileName|stop\n";
+      return TCL_ERROR;
+    }
+  }
+  else if (strcmp(argv[1],"reset") == 0)
+    Profiler::reset();
+  else if (strcmp(argv[1],"report") == 0) {
+    if (argc > 2) {
+      FileStream theFile(argv[2], APPEND);
+      Profiler::report(theFile);
+    } else
+      Profiler::report(opserr);
+  } else {
+    opserr << "WARNING profile " << argv[1] << " - unknown option, want start|stop|reset|report|trace\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
+int 
+threadsCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // threads <numThreads?> <-element threshold?> <-domain flag?>
+  // <-reproducible flag?> <-pin flag?>; with no argument the current number is returned. With
+  // -element the elements that can evaluate their integration points on the
+  // threads do so once a serial evaluation takes longer than threshold
+  // seconds, a negative threshold turns it off. -domain 1 has the domain
+  // commit, revert and update its nodes and elements on the threads, for
+  // models of re-entrant elements only. -reproducible 1 has the
+  // results not depend on the number of threads and -pin 1 pins each thread
+  // to a processor, see ThreadPool
+  int loc = 1;
+  if (argc > 1 && argv[1][0] != '-') {
+    int numThreads;
+    if (Tcl_GetInt(interp, argv[1], &numThreads) != TCL_OK) {
+      opserr << "WARNING want - threads <numThreads?> <-element threshold?> <-domain flag?> <-reproducible flag?> <-pin flag?>\n";
+      return TCL_ERROR;
+    }
+    loc = 2;
+    if (ThreadPool::setNumThreads(numThreads) < 0)
+      return TCL_ERROR;
+
+#ifdef _PARALLEL_PROCESSING
+    // the processes of subdomains already created follow
+    SubdomainIter &theSubdomains = theDomain.getSubdomains();
+    Subdomain *theSub;
+    while ((theSub = theSubdomains()) != 0)
+      ((ShadowSubdomain *)theSub)->setNumThreads(numThreads);
+#endif
+  }
+
+  while (loc < argc) {
+    if (strcmp(argv[loc],"-element") == 0 && loc+1 < argc) {
+      double threshold;
+      if (Tcl_GetDouble(interp, argv[loc+1], &threshold) != TCL_OK) {
+	opserr << "WARNING threads - invalid threshold " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      ThreadPool::setElementThreshold(threshold);
+    } else if (strcmp(argv[loc],"-domain") == 0 && loc+1 < argc) {
+      int flag;
+      if (Tcl_GetInt(interp, argv[loc+1], &flag) != TCL_OK) {
+	opserr << "WARNING threads - invalid flag " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      ThreadPool::setDomainThreaded(flag != 0);
+    } else if (strcmp(argv[loc],"-reproducible") == 0 && loc+1 < argc) {
+      int flag;
+      if (Tcl_GetInt(interp, argv[loc+1], &flag) != TCL_OK) {
+	opserr << "WARNING threads - invalid flag " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      ThreadPool::setReproducible(flag != 0);
+    } else if (strcmp(argv[loc],"-pin") == 0 && loc+1 < argc) {
+      int flag;
+      if (Tcl_GetInt(interp, argv[loc+1], &flag) != TCL_OK) {
+	opserr << "WARNING threads - invalid flag " << argv[loc+1] << endln;
+	return TCL_ERROR;
+      }
+      if (ThreadPool::setPinned(flag != 0) < 0)
+	return TCL_ERROR;
+    } else {
+      opserr << "WARNING want - threads <numThreads?> <-element threshold?> <-domain flag?> <-reproducible flag?> <-pin flag?>\n";
+      return TCL_ERROR;
+    }
+    loc += 2;
+  }
+
+  sprintf(interp->result,"%d",ThreadPool::getNumThreads());
+  return TCL_OK;
+}
+
+int 
+memoryReportCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // memoryReport <fileName?>; prints the bytes of the model and analysis
+  // by subsystem, keeps them for the simulation information and returns
+  // the total
+  double total;
+  if (argc > 1) {
+    FileStream theFile(argv[1], APPEND);
+    total = MemoryReport::report(theFile, theDomain, theAnalysisModel, theSOE,
+				 &simulationInfo);
+  } else
+    total = MemoryReport::report(opserr, theDomain, theAnalysisModel, theSOE,
+				 &simulationInfo);
+
+  sprintf(interp->result,"%.0f",total);
+  return TCL_OK;
+}
+
+int 
+benchmarkCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // benchmark uniaxial|nD|section|element tag <-steps n?> <-amp amp?>
+  //   <-minTime seconds?> <-type code?> <-json fileName?>; times the object
+  // on its own under the standard history of Benchmark, materials and
+  // sections on a copy, and returns the nanoseconds per step
+  if (argc < 3) {
+    opserr << "WARNING want - benchmark uniaxial|nD|section|element tag <-steps n?> <-amp amp?> <-minTime seconds?> <-type code?> <-json fileName?>\n";
+    return TCL_ERROR;
+  }
+
+  int tag;
+  if (Tcl_GetInt(interp, argv[2], &tag) != TCL_OK) {
+    opserr << "WARNING benchmark - invalid tag " << argv[2] << endln;
+    return TCL_ERROR;
+  }
+
+  int numSteps = 1000;
+  double amp = 0.01;
+  double minTime = 0.2;
+  const char *code = 0;
+  const char *fileName = 0;
+  int loc = 3;
+  while (loc < argc) {
+    if (strcmp(argv[loc],"-steps") == 0 && loc+1 < argc) {
+      if (Tcl_GetInt(interp, argv[loc+1], &numSteps) != TCL_OK)
+	return TCL_ERROR;
+    } else if (strcmp(argv[loc],"-amp") == 0 && loc+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &amp) != TCL_OK)
+	return TCL_ERROR;
+    } else if (strcmp(argv[loc],"-minTime") == 0 && loc+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &minTime) != TCL_OK)
+	return TCL_ERROR;
+    } else if (strcmp(argv[loc],"-type") == 0 && loc+1 < argc) {
+      code = argv[loc+1];
+    } else if (strcmp(argv[loc],"-json") == 0 && loc+1 < argc) {
+      fileName = argv[loc+1];
+    } else {
+      opserr << "WARNING benchmark - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+    loc += 2;
+  }
+
+  Benchmark theBenchmark(numSteps, amp, minTime);
+  double perStep = -1.0;
+  const char *className = 0;
+
+  if (strcmp(argv[1],"uniaxial") == 0) {
+    UniaxialMaterial *theMaterial = OPS_getUniaxialMaterial(tag);
+    if (theMaterial != 0) {
+      UniaxialMaterial *theCopy = theMaterial->getCopy();
+      className = theCopy->getClassType();
+      perStep = theBenchmark.run(*theCopy);
+      delete theCopy;
+    }
+  } else if (strcmp(argv[1],"nD") == 0) {
+    NDMaterial *theMaterial = OPS_getNDMaterial(tag);
+    if (theMaterial != 0) {
+      NDMaterial *theCopy = (code != 0) ? theMaterial->getCopy(code) :
+	theMaterial->getCopy();
+      if (theCopy != 0) {
+	className = theCopy->getClassType();
+	perStep = theBenchmark.run(*theCopy);
+	delete theCopy;
+      }
+    }
+  } else if (strcmp(argv[1],"section") == 0) {
+    SectionForceDeformation *theSection = OPS_getSectionForceDeformation(tag);
+    if (theSection != 0) {
+      SectionForceDeformation *theCopy = theSection->getCopy();
+      className = theCopy->getClassType();
+      perStep = theBenchmark.run(*theCopy);
+      delete theCopy;
+    }
+  } else if (strcmp(argv[1],"element") == 0) {
+    Element *theElement = theDomain.getElement(tag);
+    if (theElement != 0) {
+      className = theElement->getClassType();
+      perStep = theBenchmark.run(*theElement);
+    }
+  } else {
+    opserr << "WARNING benchmark - unknown type " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+
+  if (className == 0) {
+    opserr << "WARNING benchmark - no " << argv[1] << " with tag " << tag << endln;
+    return TCL_ERROR;
+  }
+  if (perStep < 0.0)
+    return TCL_ERROR;
+
+  if (fileName != 0) {
+    FileStream theFile(fileName, APPEND);
+    theBenchmark.printJSON(theFile, argv[1], tag, className);
+  }
+
+  sprintf(interp->result,"%.3f",perStep*1.0e9);
+  return TCL_OK;
+}
+
+int 
+convergenceLogCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // convergenceLog start fileName <-text?>|stop; records every step the
+  // analyses solve, binary unless -text, stop returns the number of steps
+  if (argc > 2 && strcmp(argv[1],"start") == 0) {
+    bool binary = !(argc > 3 && strcmp(argv[3],"-text") == 0);
+    if (ConvergenceLog::start(argv[2], binary) < 0)
+      return TCL_ERROR;
+  } else if (argc > 1 && strcmp(argv[1],"stop") == 0) {
+    sprintf(interp->result,"%d",ConvergenceLog::stop());
+  } else {
+    opserr << "WARNING want - convergenceLog start fileName <-text?>|stop\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
+// the values after option argv[i] up to the next option; returns their number
+static int
+sdofEnsembleValues(Tcl_Interp *interp, int argc, TCL_Char **argv, int &i, double *values)
+{
+  int num = 0;
+  while (i+1 < argc && !(argv[i+1][0] == '-' && isalpha(argv[i+1][1]))) {
+    if (Tcl_GetDouble(interp, argv[i+1], &values[num]) != TCL_OK) {
+      opserr << "WARNING sdofEnsemble - invalid value " << argv[i+1] << endln;
+      return -1;
+    }
+    num++;
+    i++;
+  }
+  return num;
+}
+
+int 
+sdofEnsembleCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // sdofEnsemble -mat tags -series tags -dt dt -numSteps n <-periods T?>
+  //   <-mass m?> <-factor f?> <-damping zeta?> <-tol tol?> <-maxIter n?>;
+  // integrates the oscillators of SDOFEnsemble, one for each of the values
+  // given in a list, the lists of one value for all, the mass from the
+  // period and initial stiffness if -periods; returns the lists of the
+  // peak displacements, velocities, absolute accelerations and forces
+  double *matTags = new double[argc];
+  double *seriesTags = new double[argc];
+  double *periods = new double[argc];
+  double *masses = new double[argc];
+  double *factors = new double[argc];
+  int numMat = 0, numSeries = 0, numPeriods = 0, numMass = 0, numFactors = 0;
+  double dt = 0.0, zeta = 0.05, tol = 1.0e-10;
+  int numSteps = 0, maxIter = 20;
+  int ok = TCL_OK;
+
+  for (int i = 1; i < argc && ok == TCL_OK; i++) {
+    if (strcmp(argv[i],"-mat") == 0) {
+      if ((numMat = sdofEnsembleValues(interp, argc, argv, i, matTags)) < 0) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-series") == 0) {
+      if ((numSeries = sdofEnsembleValues(interp, argc, argv, i, seriesTags)) < 0) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-periods") == 0) {
+      if ((numPeriods = sdofEnsembleValues(interp, argc, argv, i, periods)) < 0) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-mass") == 0) {
+      if ((numMass = sdofEnsembleValues(interp, argc, argv, i, masses)) < 0) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-factor") == 0) {
+      if ((numFactors = sdofEnsembleValues(interp, argc, argv, i, factors)) < 0) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-dt") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &dt) != TCL_OK) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-numSteps") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &numSteps) != TCL_OK) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-damping") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &zeta) != TCL_OK) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-tol") == 0 && i+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[++i], &tol) != TCL_OK) ok = TCL_ERROR;
+    } else if (strcmp(argv[i],"-maxIter") == 0 && i+1 < argc) {
+      if (Tcl_GetInt(interp, argv[++i], &maxIter) != TCL_OK) ok = TCL_ERROR;
+    } else {
+      opserr << "WARNING sdofEnsemble - unknown option " << argv[i] << endln;
+      ok = TCL_ERROR;
+    }
+  }
+
+  // the number of oscillators is the length of the longest list, the
+  // others must be as long or of one value
+  int num = numMat;
+  if (numSeries > num) num = numSeries;
+  if (numPeriods > num) num = numPeriods;
+  if (numMass > num) num = numMass;
+  if (numFactors > num) num = numFactors;
+  if (ok == TCL_OK && (numMat < 1 || numSeries < 1 || dt <= 0.0 || numSteps < 1 ||
+		       (numMat != 1 && numMat != num) || (numSeries != 1 && numSeries != num) ||
+		       (numPeriods > 1 && numPeriods != num) || (numMass > 1 && numMass != num) ||
+		       (numFactors > 1 && numFactors != num))) {
+    opserr << "WARNING want - sdofEnsemble -mat tags -series tags -dt dt -numSteps n <-periods T?> <-mass m?> <-factor f?> <-damping zeta?> <-tol tol?> <-maxIter n?>, the lists of one value or as long as the longest\n";
+    ok = TCL_ERROR;
+  }
+
+  SDOFEnsemble *theEnsemble = 0;
+  if (ok == TCL_OK) {
+    theEnsemble = new SDOFEnsemble(num, dt, zeta, tol, maxIter);
+    for (int i = 0; i < num && ok == TCL_OK; i++) {
+      int matTag = (int)matTags[numMat == 1 ? 0 : i];
+      int seriesTag = (int)seriesTags[numSeries == 1 ? 0 : i];
+      UniaxialMaterial *theMaterial = OPS_getUniaxialMaterial(matTag);
+      TimeSeries *theSeries = OPS_getTimeSeries(seriesTag);
+      if (theMaterial == 0 || theSeries == 0) {
+	opserr << "WARNING sdofEnsemble - no uniaxial material " << matTag << " or time series " << seriesTag << endln;
+	ok = TCL_ERROR;
+	break;
+      }
+      double m = (numMass > 0) ? masses[numMass == 1 ? 0 : i] : 1.0;
+      if (numPeriods > 0) {
+	double T = periods[numPeriods == 1 ? 0 : i];
+	double omega = 4.0*asin(1.0)/T;
+	m = theMaterial->getInitialTangent()/(omega*omega);
+      }
+      double f = (numFactors > 0) ? factors[numFactors == 1 ? 0 : i] : 1.0;
+      if (theEnsemble->setOscillator(i, *theMaterial, m, *theSeries, f) < 0)
+	ok = TCL_ERROR;
+    }
+  }
+
+  if (ok == TCL_OK) {
+    int numFailed = theEnsemble->run(numSteps);
+    if (numFailed < 0)
+      ok = TCL_ERROR;
+    else if (numFailed > 0)
+      opserr << "WARNING sdofEnsemble - " << numFailed << " oscillators failed to converge in some step\n";
+  }
+
+  if (ok == TCL_OK) {
+    const double *peaks[4] = {theEnsemble->getPeakDisp(), theEnsemble->getPeakVel(),
+			      theEnsemble->getPeakAccel(), theEnsemble->getPeakForce()};
+    char *buffer = new char[num*24 + 1];
+    Tcl_ResetResult(interp);
+    for (int j = 0; j < 4; j++) {
+      char *pos = buffer;
+      *pos = '\0';
+      for (int i = 0; i < num; i++)
+	pos += sprintf(pos, "%.15g ", peaks[j][i]);
+      Tcl_AppendElement(interp, buffer);
+    }
+    delete [] buffer;
+  }
+
+  if (theEnsemble != 0)
+    delete theEnsemble;
+  delete [] matTags;
+  delete [] seriesTags;
+  delete [] periods;
+  delete [] masses;
+  delete [] factors;
+
+  return ok;
+}
+
+int 
+modelArenaCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // modelArena <on|off>; nodes created while on keep their response in
+  // NodalState and their Vectors in the ModelArena, and the elements and
+  // materials created are placed in it, returns the bytes in it
+  if (argc > 1) {
+    if (strcmp(argv[1],"on") == 0)
+      ModelArena::setActive(true);
+    else if (strcmp(argv[1],"off") == 0)
+      ModelArena::setActive(false);
+    else {
+      opserr << "WARNING want - modelArena <on|off>\n";
+      return TCL_ERROR;
+    }
+  }
+
+  sprintf(interp->result,"%lu",(unsigned long)ModelArena::getNumBytes());
+  return TCL_OK;
+}
+
+int 
+geometryCacheCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  // geometryCache <on|off>; the Brick, FourNodeQuad, Twenty_Node_Brick and
+  // ShellDKGQ elements created while on keep their shape functions and B
+  // matrices, returns the number of caches and the bytes in them
+  if (argc > 1) {
+    if (strcmp(argv[1],"on") == 0)
+      GeometryCache::setActive(true);
+    else if (strcmp(argv[1],"off") == 0)
+      GeometryCache::setActive(false);
+    else {
+      opserr << "WARNING want - geometryCache <on|off>\n";
+      return TCL_ERROR;
+    }
+  }
+
+  sprintf(interp->result,"%d %lu",GeometryCache::getNumCaches(),
+	  (unsigned long)GeometryCache::getNumBytes());
+  return TCL_OK;
+}
+
 int 
 rayleighDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -8296,6 +9995,624 @@ opsRecv(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 }
 
 
+// runs one scenario of an ensemble: the model is reset to its start, the
+// proc is evaluated as "procName task attempt", task the taskID or the
+// element taskID of taskList, and any load pattern it added is removed
+// again. A proc that raises an error is retried with
+// attempt+1, up to maxRetry times, so it can reduce dt on each retry.
+// Returns the attempt that succeeded, -1 if all failed; the result of the
+// proc (or the error message) is left in a new string in theResult.
+static int
+runEnsembleTask(Tcl_Interp *interp, TCL_Char *procName, TCL_Char **taskList,
+		int taskID, int maxRetry, char *&theResult)
+{
+  ID patternTags(0, 8);
+  int numPatterns = 0;
+  LoadPattern *thePattern;
+  LoadPatternIter &thePatterns = theDomain.getLoadPatterns();
+  while ((thePattern = thePatterns()) != 0)
+    patternTags[numPatterns++] = thePattern->getTag();
+
+  char buffer[40];
+  Tcl_DString command;
+  Tcl_DStringInit(&command);
+  int attempt = 0;
+  int ok = TCL_ERROR;
+
+  while (ok != TCL_OK && attempt <= maxRetry) {
+    theDomain.revertToStart();
+    if (theTransientIntegrator != 0)
+      theTransientIntegrator->revertToStart();
+    if (theAlgorithm != 0)
+      theAlgorithm->domainChanged();
+
+    Tcl_DStringSetLength(&command, 0);
+    Tcl_DStringAppendElement(&command, procName);
+    if (taskList != 0)
+      Tcl_DStringAppendElement(&command, taskList[taskID]);
+    else {
+      sprintf(buffer, "%d", taskID);
+      Tcl_DStringAppendElement(&command, buffer);
+    }
+    sprintf(buffer, "%d", attempt);
+    Tcl_DStringAppendElement(&command, buffer);
+    ok = Tcl_Eval(interp, Tcl_DStringValue(&command));
+
+    const char *procResult = Tcl_GetStringResult(interp);
+    if (theResult != 0)
+      delete [] theResult;
+    theResult = new char[strlen(procResult)+1];
+    strcpy(theResult, procResult);
+
+    // remove the patterns of the scenario, keeping those of the model
+    ID addedTags(0, 8);
+    int numAdded = 0;
+    LoadPatternIter &newPatterns = theDomain.getLoadPatterns();
+    while ((thePattern = newPatterns()) != 0)
+      if (patternTags.getLocation(thePattern->getTag()) < 0)
+	addedTags[numAdded++] = thePattern->getTag();
+    for (int i=0; i<numAdded; i++) {
+      thePattern = theDomain.removeLoadPattern(addedTags(i));
+      if (thePattern != 0)
+	delete thePattern;
+    }
+
+    if (ok != TCL_OK) {
+      opserr << "WARNING ensemble - task " << taskID << " attempt " << attempt;
+      opserr << " failed: " << theResult << endln;
+      attempt++;
+    }
+  }
+
+  Tcl_DStringFree(&command);
+  Tcl_ResetResult(interp);
+
+  if (ok != TCL_OK)
+    return -1;
+  return attempt;
+}
+
+static void
+recordEnsembleTask(FILE *theFile, Tcl_DString &theResults, int taskID,
+		   int attempt, const char *theResult)
+{
+  if (theFile != 0) {
+    fprintf(theFile, "%d %d %s\n", taskID, attempt, theResult);
+    return;
+  }
+
+  char buffer[40];
+  Tcl_DStringStartSublist(&theResults);
+  sprintf(buffer, "%d", taskID);
+  Tcl_DStringAppendElement(&theResults, buffer);
+  sprintf(buffer, "%d", attempt);
+  Tcl_DStringAppendElement(&theResults, buffer);
+  Tcl_DStringAppendElement(&theResults, theResult);
+  Tcl_DStringEndSublist(&theResults);
+}
+
+// the wall times of the tasks of an ensemble, kept by the process handing
+// them out. With a timeout a task running longer is reported once as a
+// straggler, with the process running it, and the times are summarized
+// at the end.
+static double *ensembleStart = 0;
+static double *ensembleSeconds = 0;
+static int *ensembleWorker = 0;
+static bool *ensembleReported = 0;
+static int ensembleNumTasks = 0;
+static double ensembleTimeout = 0.0;
+
+static void
+initEnsembleTimes(int numTasks, double timeout)
+{
+  ensembleNumTasks = numTasks;
+  ensembleTimeout = timeout;
+  ensembleStart = new double[numTasks];
+  ensembleSeconds = new double[numTasks];
+  ensembleWorker = new int[numTasks];
+  ensembleReported = new bool[numTasks];
+  for (int i = 0; i < numTasks; i++) {
+    ensembleStart[i] = -1.0;
+    ensembleSeconds[i] = -1.0;
+    ensembleWorker[i] = 0;
+    ensembleReported[i] = false;
+  }
+}
+
+static void
+startEnsembleTask(int taskID, int worker)
+{
+  ensembleStart[taskID] = ThreadPool::getTime();
+  ensembleWorker[taskID] = worker;
+}
+
+static void
+reportEnsembleStraggler(int taskID, double seconds, bool done)
+{
+  if (ensembleTimeout <= 0.0 || ensembleReported[taskID] || seconds <= ensembleTimeout)
+    return;
+
+  ensembleReported[taskID] = true;
+  opserr << "WARNING ensemble - task " << taskID << " on worker " << ensembleWorker[taskID];
+  if (done)
+    opserr << " took " << seconds << " seconds\n";
+  else
+    opserr << " has run for " << seconds << " seconds\n";
+}
+
+static void
+endEnsembleTask(int taskID)
+{
+  if (taskID < 0 || taskID >= ensembleNumTasks || ensembleStart[taskID] < 0.0)
+    return;
+  ensembleSeconds[taskID] = ThreadPool::getTime() - ensembleStart[taskID];
+  reportEnsembleStraggler(taskID, ensembleSeconds[taskID], true);
+}
+
+static void
+checkEnsembleStragglers(void)
+{
+  double now = ThreadPool::getTime();
+  for (int i = 0; i < ensembleNumTasks; i++)
+    if (ensembleStart[i] >= 0.0 && ensembleSeconds[i] < 0.0)
+      reportEnsembleStraggler(i, now - ensembleStart[i], false);
+}
+
+static void
+freeEnsembleTimes(void)
+{
+  if (ensembleTimeout > 0.0) {
+    int numDone = 0;
+    int numStragglers = 0;
+    double minTime = 0.0, maxTime = 0.0, sumTime = 0.0;
+    for (int i = 0; i < ensembleNumTasks; i++) {
+      double seconds = ensembleSeconds[i];
+      if (seconds < 0.0)
+	continue;
+      if (numDone == 0 || seconds < minTime) minTime = seconds;
+      if (numDone == 0 || seconds > maxTime) maxTime = seconds;
+      sumTime += seconds;
+      numDone++;
+      if (ensembleReported[i])
+	numStragglers++;
+    }
+    if (numDone > 0) {
+      opserr << "ensemble - " << numDone << " tasks, seconds min " << minTime;
+      opserr << " mean " << sumTime/numDone << " max " << maxTime;
+      opserr << ", " << numStragglers << " over the timeout\n";
+    }
+  }
+
+  delete [] ensembleStart;
+  delete [] ensembleSeconds;
+  delete [] ensembleWorker;
+  delete [] ensembleReported;
+  ensembleStart = 0;
+  ensembleSeconds = 0;
+  ensembleWorker = 0;
+  ensembleReported = 0;
+  ensembleNumTasks = 0;
+}
+
+#ifndef _WIN32
+
+// the ensemble on numWorkers forked processes: each task runs in a child
+// forked from the process holding the built model, so it starts from
+// that model with its pages shared copy on write and leaves nothing
+// behind. The child writes the attempt and result of runEnsembleTask()
+// to a pipe and exits, the parent starts a new child as each one ends.
+static void
+runForkedEnsemble(Tcl_Interp *interp, TCL_Char *procName, TCL_Char **taskList,
+		  int numTasks, int maxRetry, int numWorkers, FILE *theFile,
+		  Tcl_DString &theResults)
+{
+  pid_t *pids = new pid_t[numWorkers];
+  int *fds = new int[numWorkers];
+  int *taskIDs = new int[numWorkers];
+  Tcl_DString *outputs = new Tcl_DString[numWorkers];
+  struct pollfd *polls = new struct pollfd[numWorkers];
+  int numActive = 0;
+  int nextTask = 0;
+  char buffer[4096];
+
+  if (theFile != 0)
+    fflush(theFile);
+
+  while (nextTask < numTasks || numActive > 0) {
+
+    while (numActive < numWorkers && nextTask < numTasks) {
+      int taskID = nextTask++;
+      int thePipe[2];
+      pid_t pid = -1;
+      if (pipe(thePipe) == 0) {
+	fflush(stdout);
+	fflush(stderr);
+	pid = fork();
+      } else
+	thePipe[0] = thePipe[1] = -1;
+
+      if (pid == 0) {
+	// the worker: one thread, its parallelism is the processes; the
+	// recorders are removed to flush them, _exit skips the destructors
+	// of the model the parent still owns
+	close(thePipe[0]);
+	ThreadPool::setNumThreads(1);
+	char *theResult = 0;
+	int attempt = runEnsembleTask(interp, procName, taskList, taskID, maxRetry, theResult);
+	theDomain.removeRecorders();
+	int length = strlen(theResult);
+	bool written = (write(thePipe[1], &attempt, sizeof(int)) == sizeof(int));
+	for (int done = 0; written && done < length; ) {
+	  ssize_t n = write(thePipe[1], theResult+done, length-done);
+	  if (n <= 0)
+	    written = false;
+	  else
+	    done += n;
+	}
+	close(thePipe[1]);
+	_exit(written ? 0 : 1);
+      }
+
+      if (pid < 0) {
+	opserr << "WARNING ensemble - could not fork a worker for task " << taskID << endln;
+	if (thePipe[0] >= 0) {
+	  close(thePipe[0]);
+	  close(thePipe[1]);
+	}
+	recordEnsembleTask(theFile, theResults, taskID, -1, "fork failed");
+	continue;
+      }
+
+      close(thePipe[1]);
+      startEnsembleTask(taskID, (int)pid);
+      pids[numActive] = pid;
+      fds[numActive] = thePipe[0];
+      taskIDs[numActive] = taskID;
+      Tcl_DStringInit(&outputs[numActive]);
+      numActive++;
+    }
+
+    if (numActive == 0)
+      continue;
+
+    for (int i = 0; i < numActive; i++) {
+      polls[i].fd = fds[i];
+      polls[i].events = POLLIN;
+      polls[i].revents = 0;
+    }
+    // with a timeout the stragglers are checked every second
+    int numReady = poll(polls, numActive, ensembleTimeout > 0.0 ? 1000 : -1);
+    checkEnsembleStragglers();
+    if (numReady <= 0)
+      continue;
+
+    for (int i = numActive-1; i >= 0; i--) {
+      if (polls[i].revents == 0)
+	continue;
+
+      ssize_t n = read(fds[i], buffer, sizeof(buffer));
+      if (n > 0) {
+	Tcl_DStringAppend(&outputs[i], buffer, n);
+	continue;
+      }
+
+      // the end of the output: the worker is done
+      close(fds[i]);
+      int status = 0;
+      waitpid(pids[i], &status, 0);
+      endEnsembleTask(taskIDs[i]);
+
+      int attempt = -1;
+      const char *output = Tcl_DStringValue(&outputs[i]);
+      int length = Tcl_DStringLength(&outputs[i]);
+      if (length >= (int)sizeof(int) && WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+	memcpy(&attempt, output, sizeof(int));
+	recordEnsembleTask(theFile, theResults, taskIDs[i], attempt, output+sizeof(int));
+      } else {
+	opserr << "WARNING ensemble - the worker of task " << taskIDs[i] << " died\n";
+	recordEnsembleTask(theFile, theResults, taskIDs[i], -1, "worker died");
+      }
+      Tcl_DStringFree(&outputs[i]);
+
+      // the last active worker takes its place
+      numActive--;
+      if (i != numActive) {
+	pids[i] = pids[numActive];
+	fds[i] = fds[numActive];
+	taskIDs[i] = taskIDs[numActive];
+	Tcl_DStringInit(&outputs[i]);
+	Tcl_DStringAppend(&outputs[i], Tcl_DStringValue(&outputs[numActive]),
+			  Tcl_DStringLength(&outputs[numActive]));
+	Tcl_DStringFree(&outputs[numActive]);
+      }
+    }
+  }
+
+  delete [] pids;
+  delete [] fds;
+  delete [] taskIDs;
+  delete [] outputs;
+  delete [] polls;
+}
+
+#endif
+
+#define ENSEMBLE_TAG_READY  20
+#define ENSEMBLE_TAG_RESULT 21
+#define ENSEMBLE_TAG_TASK   22
+
+// ensemble numTasks?|-tasks taskList? procName? <-retry maxRetry?> <-file fileName?>
+//   <-fork numWorkers?> <-timeout seconds?>
+//
+// Runs the scenarios 0 to numTasks-1 of a model that has been built once,
+// e.g. the records x scale factors of an IDA; with -tasks the proc gets
+// the elements of the list in place of the numbers. In OpenSeesMP process
+// 0 hands the tasks out to the other processes as they become free and
+// gathers the results; otherwise the tasks are run in turn, or with -fork
+// each in a process forked from the built model, numWorkers at a time.
+// The results, "taskID attempt result" with attempt -1 for a task that
+// failed, are written to the file or returned as a list by process 0.
+// With -timeout the tasks running longer are reported as stragglers with
+// the process running them and the task times summarized at the end.
+int 
+opsEnsemble(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3 || (strcmp(argv[1], "-tasks") == 0 && argc < 4)) {
+    opserr << "WARNING want - ensemble numTasks?|-tasks taskList? procName? <-retry maxRetry?> <-file fileName?> <-fork numWorkers?> <-timeout seconds?>\n";
+    return TCL_ERROR;
+  }
+
+  // every process splits the same list, only the task numbers are sent
+  int numTasks = 0;
+  TCL_Char **taskList = 0;
+  int loc = 2;
+  if (strcmp(argv[1], "-tasks") == 0) {
+    if (Tcl_SplitList(interp, argv[2], &numTasks, &taskList) != TCL_OK) {
+      opserr << "WARNING ensemble - invalid taskList\n";
+      return TCL_ERROR;
+    }
+    loc = 3;
+  } else if (Tcl_GetInt(interp, argv[1], &numTasks) != TCL_OK || numTasks < 0) {
+    opserr << "WARNING ensemble - invalid numTasks " << argv[1] << endln;
+    return TCL_ERROR;
+  }
+  TCL_Char *procName = argv[loc++];
+
+  int maxRetry = 0;
+  int numWorkers = 0;
+  double timeout = 0.0;
+  TCL_Char *fileName = 0;
+  int ok = TCL_OK;
+  while (loc < argc && ok == TCL_OK) {
+    if (strcmp(argv[loc], "-retry") == 0 && loc+1 < argc) {
+      if (Tcl_GetInt(interp, argv[loc+1], &maxRetry) != TCL_OK || maxRetry < 0) {
+	opserr << "WARNING ensemble - invalid maxRetry " << argv[loc+1] << endln;
+	ok = TCL_ERROR;
+      }
+      loc += 2;
+    } else if (strcmp(argv[loc], "-file") == 0 && loc+1 < argc) {
+      fileName = argv[loc+1];
+      loc += 2;
+    } else if (strcmp(argv[loc], "-fork") == 0 && loc+1 < argc) {
+      if (Tcl_GetInt(interp, argv[loc+1], &numWorkers) != TCL_OK || numWorkers < 1) {
+	opserr << "WARNING ensemble - invalid numWorkers " << argv[loc+1] << endln;
+	ok = TCL_ERROR;
+      }
+#ifdef _WIN32
+      opserr << "WARNING ensemble - -fork is not available on Windows, the tasks run in turn\n";
+#endif
+      loc += 2;
+    } else if (strcmp(argv[loc], "-timeout") == 0 && loc+1 < argc) {
+      if (Tcl_GetDouble(interp, argv[loc+1], &timeout) != TCL_OK || timeout < 0.0) {
+	opserr << "WARNING ensemble - invalid timeout " << argv[loc+1] << endln;
+	ok = TCL_ERROR;
+      }
+      loc += 2;
+    } else {
+      opserr << "WARNING ensemble - unknown option " << argv[loc] << endln;
+      ok = TCL_ERROR;
+    }
+  }
+  if (ok != TCL_OK) {
+    if (taskList != 0)
+      Tcl_Free((char *)taskList);
+    return TCL_ERROR;
+  }
+
+  int myPID = 0;
+  int np = 1;
+#ifdef _PARALLEL_INTERPRETERS
+  if (theMachineBroker != 0) {
+    myPID = theMachineBroker->getPID();
+    np = theMachineBroker->getNP();
+  }
+#endif
+
+  FILE *theFile = 0;
+  if (myPID == 0 && fileName != 0) {
+    theFile = fopen(fileName, "w");
+    if (theFile == 0) {
+      opserr << "WARNING ensemble - could not open file " << fileName << endln;
+      if (taskList != 0)
+	Tcl_Free((char *)taskList);
+      return TCL_ERROR;
+    }
+  }
+
+  Tcl_DString theResults;
+  Tcl_DStringInit(&theResults);
+  char *theResult = 0;
+  if (myPID == 0)
+    initEnsembleTimes(numTasks, timeout);
+
+#ifndef _WIN32
+  if (np == 1 && numWorkers > 0)
+    runForkedEnsemble(interp, procName, taskList, numTasks, maxRetry, numWorkers, theFile, theResults);
+  else
+#endif
+  if (np == 1) {
+    for (int taskID=0; taskID<numTasks; taskID++) {
+      startEnsembleTask(taskID, 0);
+      int attempt = runEnsembleTask(interp, procName, taskList, taskID, maxRetry, theResult);
+      endEnsembleTask(taskID);
+      recordEnsembleTask(theFile, theResults, taskID, attempt, theResult);
+    }
+  }
+
+#ifdef _PARALLEL_INTERPRETERS
+  else if (myPID == 0) {
+
+    // process 0 is the work queue: each message from a worker carries
+    // the result of its last task, the reply is its next task or -1
+    int nextTask = 0;
+    int numActive = np-1;
+    int header[3];
+    MPI_Status status;
+
+    while (numActive > 0) {
+      // with a timeout the queue polls, checking the stragglers while
+      // no worker is ready
+      if (timeout > 0.0) {
+	int ready = 0;
+	MPI_Iprobe(MPI_ANY_SOURCE, ENSEMBLE_TAG_READY, MPI_COMM_WORLD, &ready, &status);
+	if (ready == 0) {
+	  checkEnsembleStragglers();
+#ifndef _WIN32
+	  usleep(10000);
+#endif
+	  continue;
+	}
+      }
+
+      MPI_Recv((void *)header, 3, MPI_INT, MPI_ANY_SOURCE, ENSEMBLE_TAG_READY,
+	       MPI_COMM_WORLD, &status);
+      int otherPID = status.MPI_SOURCE;
+
+      if (header[0] >= 0) {
+	endEnsembleTask(header[0]);
+	if (theResult != 0)
+	  delete [] theResult;
+	theResult = new char[header[2]];
+	MPI_Recv((void *)theResult, header[2], MPI_CHAR, otherPID, ENSEMBLE_TAG_RESULT,
+		 MPI_COMM_WORLD, &status);
+	recordEnsembleTask(theFile, theResults, header[0], header[1], theResult);
+      }
+
+      int taskID = -1;
+      if (nextTask < numTasks) {
+	taskID = nextTask++;
+	startEnsembleTask(taskID, otherPID);
+      } else
+	numActive--;
+      MPI_Send((void *)(&taskID), 1, MPI_INT, otherPID, ENSEMBLE_TAG_TASK, MPI_COMM_WORLD);
+    }
+
+  } else {
+
+    int header[3];
+    header[0] = -1;
+    header[1] = 0;
+    header[2] = 0;
+    MPI_Status status;
+
+    while (true) {
+      MPI_Send((void *)header, 3, MPI_INT, 0, ENSEMBLE_TAG_READY, MPI_COMM_WORLD);
+      if (header[0] >= 0)
+	MPI_Send((void *)theResult, header[2], MPI_CHAR, 0, ENSEMBLE_TAG_RESULT, MPI_COMM_WORLD);
+
+      int taskID;
+      MPI_Recv((void *)(&taskID), 1, MPI_INT, 0, ENSEMBLE_TAG_TASK, MPI_COMM_WORLD, &status);
+      if (taskID < 0)
+	break;
+
+      header[0] = taskID;
+      header[1] = runEnsembleTask(interp, procName, taskList, taskID, maxRetry, theResult);
+      header[2] = strlen(theResult)+1;
+    }
+  }
+#endif
+
+  if (theResult != 0)
+    delete [] theResult;
+  if (myPID == 0)
+    freeEnsembleTimes();
+  if (taskList != 0)
+    Tcl_Free((char *)taskList);
+
+  if (theFile != 0)
+    fclose(theFile);
+  else
+    Tcl_DStringResult(interp, &theResults);
+  Tcl_DStringFree(&theResults);
+
+  return TCL_OK;
+}
+
+
+// domainStorage Map|Hash|Array <-nodes> <-elements> <-sps> <-pcs> <-mps> <-patterns> <-parameters>
+//
+// Changes the storage the domain uses for the given components, all if
+// none are given, moving in any objects already added. Hash is for models
+// with millions of nodes and elements or sparse tags; with it and Array
+// the components are returned in the order added, not in tag order.
+int 
+opsDomainStorage(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 2) {
+    opserr << "WARNING want - domainStorage Map|Hash|Array <-nodes> <-elements> <-sps> <-pcs> <-mps> <-patterns> <-parameters>\n";
+    return TCL_ERROR;
+  }
+
+  int components = 0;
+  for (int loc = 2; loc < argc; loc++) {
+    if (strcmp(argv[loc],"-nodes") == 0)
+      components |= Domain::NODES;
+    else if (strcmp(argv[loc],"-elements") == 0)
+      components |= Domain::ELEMENTS;
+    else if (strcmp(argv[loc],"-sps") == 0)
+      components |= Domain::SP_CONSTRAINTS;
+    else if (strcmp(argv[loc],"-pcs") == 0)
+      components |= Domain::PRESSURE_CONSTRAINTS;
+    else if (strcmp(argv[loc],"-mps") == 0)
+      components |= Domain::MP_CONSTRAINTS;
+    else if (strcmp(argv[loc],"-patterns") == 0)
+      components |= Domain::LOAD_PATTERNS;
+    else if (strcmp(argv[loc],"-parameters") == 0)
+      components |= Domain::PARAMETERS;
+    else {
+      opserr << "WARNING domainStorage - unknown option " << argv[loc] << endln;
+      return TCL_ERROR;
+    }
+  }
+  if (components == 0)
+    components = Domain::NODES | Domain::ELEMENTS | Domain::SP_CONSTRAINTS |
+      Domain::PRESSURE_CONSTRAINTS | Domain::MP_CONSTRAINTS |
+      Domain::LOAD_PATTERNS | Domain::PARAMETERS;
+
+  TaggedObjectStorage *theStorageType = 0;
+  if (strcmp(argv[1],"Map") == 0)
+    theStorageType = new MapOfTaggedObjects();
+  else if (strcmp(argv[1],"Hash") == 0)
+    theStorageType = new HashOfTaggedObjects();
+  else if (strcmp(argv[1],"Array") == 0)
+    theStorageType = new ArrayOfTaggedObjects(32);
+  else {
+    opserr << "WARNING domainStorage - unknown storage " << argv[1] << ", want Map, Hash or Array\n";
+    return TCL_ERROR;
+  }
+
+  int res = theDomain.setStorage(components, *theStorageType);
+  delete theStorageType;
+
+  if (res < 0) {
+    opserr << "WARNING domainStorage - failed to change the storage\n";
+    return TCL_ERROR;
+  }
+
+  return TCL_OK;
+}
+
+
 int
 neesMetaData(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
@@ -8753,6 +11070,40 @@ int convertTextToBinary(ClientData clientData, Tcl_Interp *interp, int argc, TCL
   return textToBinary(inputFile, outputFile);
 }
 
+extern int columnarToText(const char *inputFilename, const char *outputFilename);
+
+int convertColumnarToText(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "ERROR incorrect # args - convertColumnarToText inputFile outputFile\n";
+    return -1;
+  }
+
+  const char *inputFile = argv[1];
+  const char *outputFile = argv[2];
+
+  return columnarToText(inputFile, outputFile);
+}
+
+extern int textToSeries(const char *inputFilename, const char *outputFilename,
+			const char *format, double dt);
+
+int convertTextToSeries(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
+{
+  if (argc < 3) {
+    opserr << "ERROR incorrect # args - convertTextToSeries inputFile outputFile <-peer|-time|-values>\n";
+    return -1;
+  }
+
+  const char *inputFile = argv[1];
+  const char *outputFile = argv[2];
+  const char *format = "-values";
+  if (argc > 3)
+    format = argv[3];
+
+  return textToSeries(inputFile, outputFile, format, 0.0);
+}
+
 int domainChange(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 {
   theDomain.domainChange();
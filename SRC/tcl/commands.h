@@ -68,6 +68,15 @@ getTime(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 int 
 getLoadFactor(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+setDamageLimit(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+getDamageIndex(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+criticalTimeStep(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 buildModel(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -117,12 +126,18 @@ groundExcitation(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char *
 int 
 eigenAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+harmonicAnalysis(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 videoPlayer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
 int 
 removeObject(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+activateElements(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 eleForce(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
@@ -135,6 +150,15 @@ eleDynamicalForce(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char
 int 
 eleResponse(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+eleResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+nodeResponses(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+contactSearch(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 
 int
 findID(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
@@ -243,6 +267,30 @@ startTimer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv)
 int 
 stopTimer(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
+int 
+profileCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+threadsCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+memoryReportCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+benchmarkCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+convergenceLogCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+sdofEnsembleCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+modelArenaCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
+int 
+geometryCacheCommand(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
+
 int 
 rayleighDamping(ClientData clientData, Tcl_Interp *interp, int argc, TCL_Char **argv);
 
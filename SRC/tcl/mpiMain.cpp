@@ -184,7 +184,18 @@ extern int OPS_np;
 int
 main(int argc, char **argv)
 {
-  theMachineBroker = new MPI_MachineBroker(0, argc, argv);
+  // -aggregateMPI has the channels send each object as one message
+  bool aggregate = false;
+  for (int i=1; i<argc; i++)
+    if (strcmp(argv[i], "-aggregateMPI") == 0) {
+      aggregate = true;
+      for (int j=i; j<argc-1; j++)
+	argv[j] = argv[j+1];
+      argc--;
+      break;
+    }
+
+  theMachineBroker = new MPI_MachineBroker(0, argc, argv, aggregate);
   FEM_ObjectBrokerAllClasses theBroker;
   theMachineBroker->setObjectBroker(&theBroker);
 
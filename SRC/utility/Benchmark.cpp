@@ -0,0 +1,261 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/Benchmark.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for Benchmark.
+//
+// What: "@(#) Benchmark.cpp, revA"
+
+#include <Benchmark.h>
+#include <ThreadPool.h>
+#include <UniaxialMaterial.h>
+#include <NDMaterial.h>
+#include <SectionForceDeformation.h>
+#include <Element.h>
+#include <Node.h>
+#include <Matrix.h>
+#include <Vector.h>
+#include <math.h>
+#include <stdio.h>
+
+Benchmark::Benchmark(int steps, double amp, double time)
+  :numSteps(steps), amplitude(amp), minTime(time),
+   numRuns(0), seconds(0.0), numErrors(0)
+{
+  if (numSteps < 3)
+    numSteps = 3;
+}
+
+double
+Benchmark::getHistory(int step) const
+{
+  // three cycles, each a third of the steps, growing in amplitude
+  int stepsPerCycle = numSteps/3;
+  int cycle = step/stepsPerCycle;
+  if (cycle > 2)
+    cycle = 2;
+  double x = (double)(step - cycle*stepsPerCycle)/stepsPerCycle;
+
+  return amplitude*(cycle+1)/3.0*sin(2.0*3.14159265358979323846*x);
+}
+
+double
+Benchmark::run(UniaxialMaterial &theMaterial)
+{
+  numRuns = 0;
+  numErrors = 0;
+  double sum = 0.0;
+
+  double start = ThreadPool::getTime();
+  do {
+    for (int i = 0; i < numSteps; i++) {
+      if (theMaterial.setTrialStrain(this->getHistory(i)) < 0)
+	numErrors++;
+      sum += theMaterial.getStress() + theMaterial.getTangent();
+      theMaterial.commitState();
+    }
+    numRuns++;
+    seconds = ThreadPool::getTime() - start;
+  } while (seconds < minTime);
+
+  theMaterial.revertToStart();
+
+  // keep the calls from being optimised away
+  if (sum != sum)
+    numErrors++;
+
+  return seconds/(numRuns*numSteps);
+}
+
+double
+Benchmark::run(NDMaterial &theMaterial)
+{
+  numRuns = 0;
+  numErrors = 0;
+
+  int order = theMaterial.getStrain().Size();
+  if (order <= 0) {
+    opserr << "Benchmark::run() - material " << theMaterial.getTag()
+	   << " has no strain, use a copy for a type of problem\n";
+    return -1.0;
+  }
+
+  // all the strains move together, the shear ones, which follow the
+  // normal ones, at half of them
+  Vector pattern(order);
+  for (int j = 0; j < order; j++)
+    pattern(j) = (j < (order+1)/2) ? 1.0 : 0.5;
+  Vector strain(order);
+  double sum = 0.0;
+
+  double start = ThreadPool::getTime();
+  do {
+    for (int i = 0; i < numSteps; i++) {
+      strain.addVector(0.0, pattern, this->getHistory(i));
+      if (theMaterial.setTrialStrain(strain) < 0)
+	numErrors++;
+      sum += theMaterial.getStress()(0) + theMaterial.getTangent()(0,0);
+      theMaterial.commitState();
+    }
+    numRuns++;
+    seconds = ThreadPool::getTime() - start;
+  } while (seconds < minTime);
+
+  theMaterial.revertToStart();
+
+  if (sum != sum)
+    numErrors++;
+
+  return seconds/(numRuns*numSteps);
+}
+
+double
+Benchmark::run(SectionForceDeformation &theSection)
+{
+  numRuns = 0;
+  numErrors = 0;
+
+  int order = theSection.getOrder();
+  if (order <= 0) {
+    opserr << "Benchmark::run() - section " << theSection.getTag()
+	   << " has no deformations\n";
+    return -1.0;
+  }
+
+  // the axial strain at a tenth of the curvatures, enough to yield a
+  // fiber section on the tension side
+  Vector pattern(order);
+  pattern(0) = 0.1;
+  for (int j = 1; j < order; j++)
+    pattern(j) = 1.0;
+  Vector deformation(order);
+  double sum = 0.0;
+
+  double start = ThreadPool::getTime();
+  do {
+    for (int i = 0; i < numSteps; i++) {
+      deformation.addVector(0.0, pattern, this->getHistory(i));
+      if (theSection.setTrialSectionDeformation(deformation) < 0)
+	numErrors++;
+      sum += theSection.getStressResultant()(0) +
+	theSection.getSectionTangent()(0,0);
+      theSection.commitState();
+    }
+    numRuns++;
+    seconds = ThreadPool::getTime() - start;
+  } while (seconds < minTime);
+
+  theSection.revertToStart();
+
+  if (sum != sum)
+    numErrors++;
+
+  return seconds/(numRuns*numSteps);
+}
+
+double
+Benchmark::run(Element &theElement)
+{
+  numRuns = 0;
+  numErrors = 0;
+
+  int numNodes = theElement.getNumExternalNodes();
+  Node **theNodes = theElement.getNodePtrs();
+  if (numNodes <= 0 || theNodes == 0) {
+    opserr << "Benchmark::run() - element " << theElement.getTag()
+	   << " has no nodes, is it in the domain?\n";
+    return -1.0;
+  }
+
+  // the trial displacements to restore after, and the pattern: the nodes
+  // move apart from the first one along every dof, further with the node
+  Vector **base = new Vector *[numNodes];
+  Vector **pattern = new Vector *[numNodes];
+  for (int n = 0; n < numNodes; n++) {
+    base[n] = new Vector(theNodes[n]->getTrialDisp());
+    int numDOF = base[n]->Size();
+    pattern[n] = new Vector(numDOF);
+    for (int j = 0; j < numDOF; j++)
+      (*pattern[n])(j) = (double)n/numNodes;
+  }
+
+  Vector **disp = new Vector *[numNodes];
+  for (int n = 0; n < numNodes; n++)
+    disp[n] = new Vector(base[n]->Size());
+  double sum = 0.0;
+
+  double start = ThreadPool::getTime();
+  do {
+    for (int i = 0; i < numSteps; i++) {
+      double h = this->getHistory(i);
+      for (int n = 0; n < numNodes; n++) {
+	*disp[n] = *base[n];
+	disp[n]->addVector(1.0, *pattern[n], h);
+	theNodes[n]->setTrialDisp(*disp[n]);
+      }
+      if (theElement.update() < 0)
+	numErrors++;
+      sum += theElement.getTangentStiff()(0,0) +
+	theElement.getResistingForce()(0);
+    }
+    numRuns++;
+    seconds = ThreadPool::getTime() - start;
+  } while (seconds < minTime);
+
+  // leave the element and its nodes as they were
+  for (int n = 0; n < numNodes; n++) {
+    theNodes[n]->setTrialDisp(*base[n]);
+    delete base[n];
+    delete pattern[n];
+    delete disp[n];
+  }
+  delete [] base;
+  delete [] pattern;
+  delete [] disp;
+
+  theElement.revertToLastCommit();
+  theElement.update();
+
+  if (sum != sum)
+    numErrors++;
+
+  return seconds/(numRuns*numSteps);
+}
+
+void
+Benchmark::printJSON(OPS_Stream &s, const char *type, int tag,
+		     const char *className)
+{
+  char buffer[512];
+  double perStep = (numRuns > 0) ? seconds/(numRuns*numSteps) : 0.0;
+
+  sprintf(buffer, "{\"type\": \"%s\", \"tag\": %d, \"class\": \"%s\", "
+	  "\"steps\": %d, \"amplitude\": %g, \"runs\": %d, \"seconds\": %.6e, "
+	  "\"nsPerStep\": %.3f, \"errors\": %d}\n",
+	  type, tag, className, numSteps, amplitude, numRuns, seconds,
+	  perStep*1.0e9, numErrors);
+
+  s << buffer;
+}
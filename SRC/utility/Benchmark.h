@@ -0,0 +1,79 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/Benchmark.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for Benchmark.
+// Benchmark times a material, section or element on its own under a
+// standard history: three cycles of amplitude 1/3, 2/3 and 1 times the
+// given amplitude, numSteps steps in all. A step of a material or
+// section sets the trial strain, gets the stress and tangent and commits,
+// as the element state determination does; a step of an element sets the
+// trial displacements of its nodes, updates it and forms the tangent and
+// resisting force, the element is reverted and its nodes restored after.
+// The history is repeated until minTime seconds have passed, the time per
+// step reported is that of all the repetitions. The results can be written
+// as JSON, one object per line, to compare builds.
+//
+// What: "@(#) Benchmark.h, revA"
+
+#ifndef Benchmark_h
+#define Benchmark_h
+
+#include <OPS_Globals.h>
+
+class UniaxialMaterial;
+class NDMaterial;
+class SectionForceDeformation;
+class Element;
+
+class Benchmark
+{
+  public:
+    Benchmark(int numSteps = 1000, double amplitude = 0.01, 
+	      double minTime = 0.2);
+
+    // each returns the seconds per step, < 0 if the object could not be run
+    double run(UniaxialMaterial &theMaterial);
+    double run(NDMaterial &theMaterial);
+    double run(SectionForceDeformation &theSection);
+    double run(Element &theElement);
+
+    // the last run as a JSON object on a line
+    void printJSON(OPS_Stream &s, const char *type, int tag, 
+		   const char *className);
+
+  private:
+    double getHistory(int step) const;
+
+    int numSteps;
+    double amplitude;
+    double minTime;
+
+    int numRuns;        // repetitions of the history in the last run
+    double seconds;     // their time
+    int numErrors;      // steps the object reported an error for
+};
+
+#endif
@@ -0,0 +1,221 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ConvergenceLog.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for
+// ConvergenceLog.
+//
+// What: "@(#) ConvergenceLog.cpp, revA"
+
+#include <ConvergenceLog.h>
+#include <ThreadPool.h>
+#include <EquiSolnAlgo.h>
+#include <ConvergenceTest.h>
+#include <Vector.h>
+#include <classTags.h>
+#include <stdio.h>
+#include <string.h>
+
+bool ConvergenceLog::active = false;
+
+#define CONVLOG_VERSION    1
+#define CONVLOG_ALGORITHM  1
+#define CONVLOG_STEP       2
+
+// a buffer large enough that the file is written in few large blocks
+#define CONVLOG_BUFFER_SIZE (1<<20)
+
+static FILE *logFile = 0;
+static bool logBinary = true;
+static int numSteps = 0;
+
+// the algorithm class tags named in the file so far
+static int *algoTags = 0;
+static int numAlgoTags = 0;
+static int sizeAlgoTags = 0;
+
+static void
+writeInt(int value)
+{
+  fwrite(&value, sizeof(int), 1, logFile);
+}
+
+static void
+writeDouble(double value)
+{
+  fwrite(&value, sizeof(double), 1, logFile);
+}
+
+static const char *
+getAlgorithmName(int classTag)
+{
+  switch (classTag) {
+  case EquiALGORITHM_TAGS_Linear: return "Linear";
+  case EquiALGORITHM_TAGS_NewtonRaphson: return "Newton";
+  case EquiALGORITHM_TAGS_ModifiedNewton: return "ModifiedNewton";
+  case EquiALGORITHM_TAGS_Broyden: return "Broyden";
+  case EquiALGORITHM_TAGS_BFGS: return "BFGS";
+  case EquiALGORITHM_TAGS_SplitNewton: return "SplitNewton";
+  case EquiALGORITHM_TAGS_KrylovNewton: return "KrylovNewton";
+  case EquiALGORITHM_TAGS_NewtonLineSearch: return "NewtonLineSearch";
+  case EquiALGORITHM_TAGS_PeriodicNewton: return "PeriodicNewton";
+  case EquiALGORITHM_TAGS_SecantNewton: return "SecantNewton";
+  case EquiALGORITHM_TAGS_AcceleratedNewton: return "AcceleratedNewton";
+  case EquiALGORITHM_TAGS_AcceleratedNewtonLineSearch: return "AcceleratedNewtonLineSearch";
+  case EquiALGORITHM_TAGS_InitialNewton: return "InitialNewton";
+  case EquiALGORITHM_TAGS_ElasticAlgorithm: return "ElasticAlgorithm";
+  case EquiALGORITHM_TAGS_AdaptiveNewton: return "AdaptiveNewton";
+  case EquiALGORITHM_TAGS_InexactNewton: return "InexactNewton";
+  default: return "unknown";
+  }
+}
+
+static void
+nameAlgorithm(EquiSolnAlgo &theAlgo)
+{
+  int classTag = theAlgo.getClassTag();
+  for (int i=0; i<numAlgoTags; i++)
+    if (algoTags[i] == classTag)
+      return;
+
+  if (numAlgoTags == sizeAlgoTags) {
+    int newSize = 2*sizeAlgoTags + 8;
+    int *newTags = new int[newSize];
+    for (int i=0; i<numAlgoTags; i++)
+      newTags[i] = algoTags[i];
+    if (algoTags != 0)
+      delete [] algoTags;
+    algoTags = newTags;
+    sizeAlgoTags = newSize;
+  }
+  algoTags[numAlgoTags++] = classTag;
+
+  const char *name = getAlgorithmName(classTag);
+  int length = (int)strlen(name);
+  writeInt(CONVLOG_ALGORITHM);
+  writeInt(classTag);
+  writeInt(length);
+  fwrite(name, 1, length, logFile);
+}
+
+
+int
+ConvergenceLog::start(const char *fileName, bool binary)
+{
+  if (active == true)
+    stop();
+
+  logFile = fopen(fileName, binary ? "wb" : "w");
+  if (logFile == 0) {
+    opserr << "WARNING ConvergenceLog::start() - could not open " << fileName << endln;
+    return -1;
+  }
+  setvbuf(logFile, 0, _IOFBF, CONVLOG_BUFFER_SIZE);
+
+  logBinary = binary;
+  numSteps = 0;
+  numAlgoTags = 0;
+
+  if (binary == true) {
+    char magic[8] = "OPSCONV";
+    fwrite(magic, 1, 8, logFile);
+    writeInt(CONVLOG_VERSION);
+  }
+
+  active = true;
+  return 0;
+}
+
+
+int
+ConvergenceLog::stop(void)
+{
+  if (active == false)
+    return 0;
+
+  active = false;
+  fclose(logFile);
+  logFile = 0;
+
+  if (algoTags != 0)
+    delete [] algoTags;
+  algoTags = 0;
+  numAlgoTags = 0;
+  sizeAlgoTags = 0;
+
+  return numSteps;
+}
+
+
+double
+ConvergenceLog::getTime(void)
+{
+  return ThreadPool::getTime();
+}
+
+
+void
+ConvergenceLog::record(double time, double dT, EquiSolnAlgo &theAlgo,
+		       int result, double startTime)
+{
+  if (active == false)
+    return;
+
+  double seconds = ThreadPool::getTime() - startTime;
+  numSteps++;
+
+  // an algorithm without a test, such as Linear, takes one iteration
+  ConvergenceTest *theTest = theAlgo.getConvergenceTest();
+  int numIter = 1;
+  int numNorms = 0;
+  const Vector *norms = 0;
+  if (theTest != 0) {
+    numIter = theTest->getNumTests();
+    norms = &theTest->getNorms();
+    numNorms = (numIter < norms->Size()) ? numIter : norms->Size();
+  }
+
+  if (logBinary == true) {
+    nameAlgorithm(theAlgo);
+    writeInt(CONVLOG_STEP);
+    writeInt(numSteps);
+    writeInt(result);
+    writeInt(numIter);
+    writeInt(theAlgo.getClassTag());
+    writeDouble(time);
+    writeDouble(dT);
+    writeDouble(seconds);
+    writeInt(numNorms);
+    for (int i=0; i<numNorms; i++)
+      writeDouble((*norms)(i));
+  } else {
+    fprintf(logFile, "{\"step\": %d, \"time\": %.10g, \"dt\": %.10g, \"algorithm\": \"%s\", "
+	    "\"result\": %d, \"iterations\": %d, \"seconds\": %.6e, \"norms\": [",
+	    numSteps, time, dT, getAlgorithmName(theAlgo.getClassTag()), result, numIter, seconds);
+    for (int i=0; i<numNorms; i++)
+      fprintf(logFile, (i == 0) ? "%.6e" : ", %.6e", (*norms)(i));
+    fprintf(logFile, "]}\n");
+  }
+}
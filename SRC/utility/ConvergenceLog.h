@@ -0,0 +1,64 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ConvergenceLog.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// ConvergenceLog. While it runs the analyses record every step they solve,
+// converged or not: the step number, the time, the time step, the
+// algorithm, the result, the number of iterations, the norms of the
+// convergence test for each iteration and the wall time of the step. The
+// records go to a file, binary by default or as JSON, one object per
+// line. The binary file starts with the 8 bytes "OPSCONV" and an int
+// version, then holds records each starting with an int type: 1 names an
+// algorithm, followed by its int class tag, the int length of its name and
+// the name; 2 is a step, followed by the ints step, result, iterations and
+// algorithm class tag, the doubles time, dt and seconds, the int number of
+// norms and the norms. Ints are 4 bytes, doubles 8, in the byte order of
+// the machine.
+//
+// What: "@(#) ConvergenceLog.h, revA"
+
+#ifndef ConvergenceLog_h
+#define ConvergenceLog_h
+
+#include <OPS_Globals.h>
+
+class EquiSolnAlgo;
+
+class ConvergenceLog
+{
+  public:
+    static int start(const char *fileName, bool binary = true);
+    static int stop(void);
+
+    // the wall time at the start of a step, to be passed to record()
+    static double getTime(void);
+    static void record(double time, double dT, EquiSolnAlgo &theAlgo,
+		       int result, double startTime);
+
+    static bool active;
+};
+
+#endif
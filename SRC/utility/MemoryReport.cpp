@@ -0,0 +1,231 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/MemoryReport.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for MemoryReport.
+//
+// What: "@(#) MemoryReport.C, revA"
+
+#include <MemoryReport.h>
+#include <ModelArena.h>
+#include <SimulationInformation.h>
+#include <Domain.h>
+#include <Node.h>
+#include <NodeIter.h>
+#include <Element.h>
+#include <ElementIter.h>
+#include <Material.h>
+#include <Recorder.h>
+#include <AnalysisModel.h>
+#include <LinearSOE.h>
+#include <LinearSOESolver.h>
+#include <GeometryCache.h>
+#include <stdio.h>
+#include <string.h>
+
+// the elements of a class
+struct MemoryElementClass {
+  int classTag;
+  const char *className;
+  int count;
+  double bytes;
+};
+
+static void
+printLine(OPS_Stream &s, const char *name, int count, double bytes,
+	  SimulationInformation *theInfo)
+{
+  char buffer[256];
+  if (count >= 0)
+    sprintf(buffer, "  %-36s %10d %16.0f\n", name, count, bytes);
+  else
+    sprintf(buffer, "  %-36s %10s %16.0f\n", name, "", bytes);
+  s << buffer;
+
+  if (theInfo != 0)
+    theInfo->addMemoryUsage(name, bytes);
+}
+
+
+double
+MemoryReport::report(OPS_Stream &s, Domain &theDomain, AnalysisModel *theModel,
+		     LinearSOE *theSOE, SimulationInformation *theInfo)
+{
+  if (theInfo != 0)
+    theInfo->clearMemoryUsage();
+
+  double total = 0.0;
+
+  s << "Memory - bytes by subsystem\n";
+  s << "  subsystem                                 count            bytes\n";
+
+  // the nodes
+  int numNodes = 0;
+  double nodeBytes = 0.0;
+  Node *theNode;
+  NodeIter &theNodes = theDomain.getNodes();
+  while ((theNode = theNodes()) != 0) {
+    numNodes++;
+    nodeBytes += theNode->getNumBytes();
+  }
+  printLine(s, "nodes", numNodes, nodeBytes, theInfo);
+  total += nodeBytes;
+
+  // the elements, by class
+  MemoryElementClass *eleClasses = 0;
+  int numEleClasses = 0;
+  int sizeEleClasses = 0;
+  int numEles = 0;
+  double eleBytes = 0.0;
+
+  Element *theEle;
+  ElementIter &theEles = theDomain.getElements();
+  while ((theEle = theEles()) != 0) {
+    int classTag = theEle->getClassTag();
+    int loc = 0;
+    while (loc < numEleClasses && eleClasses[loc].classTag != classTag)
+      loc++;
+
+    if (loc == numEleClasses) {
+      if (numEleClasses == sizeEleClasses) {
+	int newSize = 2*sizeEleClasses + 8;
+	MemoryElementClass *newClasses = new MemoryElementClass[newSize];
+	for (int i=0; i<numEleClasses; i++)
+	  newClasses[i] = eleClasses[i];
+	if (eleClasses != 0)
+	  delete [] eleClasses;
+	eleClasses = newClasses;
+	sizeEleClasses = newSize;
+      }
+      eleClasses[loc].classTag = classTag;
+      eleClasses[loc].className = theEle->getClassType();
+      eleClasses[loc].count = 0;
+      eleClasses[loc].bytes = 0.0;
+      numEleClasses++;
+    }
+
+    double bytes = ModelArena::getObjectSize(theEle);
+    eleClasses[loc].count++;
+    eleClasses[loc].bytes += bytes;
+    numEles++;
+    eleBytes += bytes;
+  }
+  printLine(s, "elements", numEles, eleBytes, theInfo);
+  for (int i=0; i<numEleClasses; i++) {
+    char name[64];
+    sprintf(name, "  %.32s", eleClasses[i].className);
+    printLine(s, name, eleClasses[i].count, eleClasses[i].bytes, 0);
+  }
+  if (eleClasses != 0)
+    delete [] eleClasses;
+  total += eleBytes;
+
+  // the material objects, the prototypes and the copies of the elements
+  double matBytes = Material::getNumObjectBytes();
+  printLine(s, "materials", Material::getNumObjects(), matBytes, theInfo);
+  total += matBytes;
+
+  if (theModel != 0) {
+    double modelBytes = theModel->getNumBytes();
+    printLine(s, "analysis model", theModel->getNumFE_Elements() + 
+	      theModel->getNumDOF_Groups(), modelBytes, theInfo);
+    total += modelBytes;
+  }
+
+  if (theSOE != 0) {
+    double soeBytes = theSOE->getNumBytes();
+    printLine(s, "system of equations", theSOE->getNumEqn(), soeBytes, theInfo);
+    total += soeBytes;
+
+    LinearSOESolver *theSolver = theSOE->getSolver();
+    if (theSolver != 0) {
+      double solverBytes = theSolver->getNumBytes();
+      printLine(s, "solver factorization", -1, solverBytes, theInfo);
+      total += solverBytes;
+    }
+  }
+
+  // the recorders and the buffers of their streams
+  int numRecorders = 0;
+  double recorderBytes = 0.0;
+  for (int i=0; i<theDomain.getNumRecorders(); i++) {
+    Recorder *theRecorder = theDomain.getRecorder(i);
+    if (theRecorder != 0) {
+      numRecorders++;
+      recorderBytes += theRecorder->getNumBytes();
+    }
+  }
+  printLine(s, "recorders", numRecorders, recorderBytes, theInfo);
+  total += recorderBytes;
+
+  double cacheBytes = GeometryCache::getNumBytes();
+  printLine(s, "geometry cache", -1, cacheBytes, theInfo);
+  total += cacheBytes;
+
+  printLine(s, "total", -1, total, theInfo);
+
+  // for comparison, the model arena holds part of the above
+  char buffer[256];
+  sprintf(buffer, "  model arena %.0f bytes", (double)ModelArena::getNumBytes());
+  s << buffer;
+  double resident = getResident(false);
+  if (resident > 0.0) {
+    sprintf(buffer, ", process resident %.0f bytes, peak %.0f bytes",
+	    resident, getResident(true));
+    s << buffer;
+  }
+  s << endln;
+
+  return total;
+}
+
+
+double
+MemoryReport::getResident(bool peak)
+{
+#ifdef __linux__
+  FILE *theFile = fopen("/proc/self/status", "r");
+  if (theFile == 0)
+    return 0.0;
+
+  const char *key = (peak == true) ? "VmHWM:" : "VmRSS:";
+  int keyLength = strlen(key);
+  char line[256];
+  double bytes = 0.0;
+  while (fgets(line, 256, theFile) != 0) {
+    if (strncmp(line, key, keyLength) == 0) {
+      double kB = 0.0;
+      if (sscanf(line + keyLength, "%lf", &kB) == 1)
+	bytes = 1024.0*kB;
+      break;
+    }
+  }
+
+  fclose(theFile);
+  return bytes;
+#else
+  return 0.0;
+#endif
+}
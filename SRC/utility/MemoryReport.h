@@ -0,0 +1,63 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/MemoryReport.h,v $
+
+#ifndef MemoryReport_h
+#define MemoryReport_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for MemoryReport.
+// MemoryReport accounts for the memory of a model and its analysis by
+// subsystem: the nodes, the elements by class, the material objects, the
+// FE_Elements, DOF_Groups and graphs of the AnalysisModel, the storage of
+// the LinearSOE and the factors of its solver, the recorders with the
+// buffers of their streams and the GeometryCache. The bytes are those the
+// objects report or, for elements and materials, the size of the objects
+// themselves; storage an element or material allocates on its own is not
+// included. The report is formed when asked for, nothing is tracked while
+// the analysis runs but the material count.
+//
+// What: "@(#) MemoryReport.h, revA"
+
+#include <OPS_Globals.h>
+
+class Domain;
+class AnalysisModel;
+class LinearSOE;
+class SimulationInformation;
+
+class MemoryReport
+{
+  public:
+    // prints the report to s, also storing the totals by subsystem in
+    // theInfo if given; returns the total bytes accounted for
+    static double report(OPS_Stream &s, Domain &theDomain,
+			 AnalysisModel *theModel = 0, LinearSOE *theSOE = 0,
+			 SimulationInformation *theInfo = 0);
+
+    // the resident and peak resident bytes of the process, 0 if unknown
+    static double getResident(bool peak = false);
+};
+
+#endif
@@ -0,0 +1,146 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ModelArena.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for ModelArena.
+//
+// What: "@(#) ModelArena.C, revA"
+
+#include <ModelArena.h>
+#include <stdlib.h>
+#include <new>
+
+// the blocks are aligned for any of the types stored in them
+#define ARENA_ALIGN 16
+// the size of a chunk, larger blocks get a chunk of their own
+#define ARENA_CHUNK_SIZE (1 << 20)
+
+OPS_THREAD_LOCAL bool ModelArena::active = false;
+OPS_THREAD_LOCAL char *ModelArena::theChunks = 0;
+OPS_THREAD_LOCAL char *ModelArena::nextFree = 0;
+OPS_THREAD_LOCAL size_t ModelArena::numFree = 0;
+OPS_THREAD_LOCAL size_t ModelArena::numBytes = 0;
+OPS_THREAD_LOCAL int ModelArena::numBlocks = 0;
+
+void *
+ModelArena::allocate(size_t size)
+{
+  size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+
+  if (size > numFree) {
+    size_t chunkSize = ARENA_ALIGN + ((size > ARENA_CHUNK_SIZE/4) ? size : ARENA_CHUNK_SIZE);
+    char *theChunk = (char *)malloc(chunkSize);
+    if (theChunk == 0)
+      return 0;
+    numBytes += chunkSize;
+
+    // a chunk for a large block is put behind the last chunk, so that the
+    // space left in the last chunk is still used
+    if (size > ARENA_CHUNK_SIZE/4 && theChunks != 0) {
+      *(char **)theChunk = *(char **)theChunks;
+      *(char **)theChunks = theChunk;
+      numBlocks++;
+      return theChunk + ARENA_ALIGN;
+    }
+
+    *(char **)theChunk = theChunks;
+    theChunks = theChunk;
+    nextFree = theChunk + ARENA_ALIGN;
+    numFree = chunkSize - ARENA_ALIGN;
+  }
+
+  void *theBlock = nextFree;
+  nextFree += size;
+  numFree -= size;
+  numBlocks++;
+
+  return theBlock;
+}
+
+void
+ModelArena::deallocate(void *theBlock)
+{
+  if (theBlock == 0)
+    return;
+
+  // the memory goes back only when nothing in the chunks is used
+  if (--numBlocks > 0)
+    return;
+
+  while (theChunks != 0) {
+    char *next = *(char **)theChunks;
+    free(theChunks);
+    theChunks = next;
+  }
+
+  nextFree = 0;
+  numFree = 0;
+  numBytes = 0;
+  numBlocks = 0;
+}
+
+void *
+ModelArena::allocateObject(size_t size)
+{
+  char *theBlock;
+  if (active == true) {
+    theBlock = (char *)allocate(size + ARENA_ALIGN);
+    if (theBlock != 0)
+      *(int *)theBlock = 1;
+  } else {
+    theBlock = (char *)malloc(size + ARENA_ALIGN);
+    if (theBlock != 0)
+      *(int *)theBlock = 0;
+  }
+
+  if (theBlock == 0)
+    throw std::bad_alloc();
+
+  *(size_t *)(theBlock + sizeof(size_t)) = size;
+  return theBlock + ARENA_ALIGN;
+}
+
+size_t
+ModelArena::getObjectSize(const void *theObject)
+{
+  if (theObject == 0)
+    return 0;
+
+  const char *theBlock = (const char *)theObject - ARENA_ALIGN;
+  return *(const size_t *)(theBlock + sizeof(size_t));
+}
+
+void
+ModelArena::deallocateObject(void *theObject)
+{
+  if (theObject == 0)
+    return;
+
+  char *theBlock = (char *)theObject - ARENA_ALIGN;
+  if (*(int *)theBlock == 1)
+    deallocate(theBlock);
+  else
+    free(theBlock);
+}
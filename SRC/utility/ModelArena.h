@@ -0,0 +1,79 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ModelArena.h,v $
+
+#ifndef ModelArena_h
+#define ModelArena_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for ModelArena.
+// ModelArena is an optional bump allocator for the storage created while
+// a model is built. Memory is handed out from large chunks, so that the
+// many small arrays of a big model are not each a separate call to
+// malloc and the arrays created one after the other lie together in
+// memory. A block is never reused once given back; the chunks are all
+// freed at once when the last block has been given back, which is what
+// happens when the model is wiped. The arena is not used until turned on
+// with setActive(true), i.e. with the modelArena command. Each thread has
+// its own arena, turned on separately, so that the models built in
+// different threads do not share it; an object is to be deleted by the
+// thread that created it.
+//
+// allocateObject() and deallocateObject() are used by the operator new and
+// delete of Element and Material, so that the elements and the material
+// copies of a model built with the arena on are also freed by the chunk
+// when the model is wiped. The block of an object starts with a word
+// recording if it came from the arena or from malloc, as an object may be
+// deleted after the arena has been turned off, and the size of the object.
+//
+// What: "@(#) ModelArena.h, revA"
+
+#include <stddef.h>
+#include <OPS_Globals.h>
+
+class ModelArena
+{
+  public:
+    static void setActive(bool onOff) {active = onOff;}
+    static bool isActive(void) {return active;}
+
+    static void *allocate(size_t numBytes);
+    static void deallocate(void *theBlock);
+
+    static void *allocateObject(size_t numBytes);
+    static void deallocateObject(void *theObject);
+    static size_t getObjectSize(const void *theObject);
+
+    static size_t getNumBytes(void) {return numBytes;}
+
+  private:
+    static OPS_THREAD_LOCAL bool active;
+    static OPS_THREAD_LOCAL char *theChunks;    // the chunks, each starts with a pointer to the next
+    static OPS_THREAD_LOCAL char *nextFree;     // the next free byte in the last chunk
+    static OPS_THREAD_LOCAL size_t numFree;     // bytes free in the last chunk
+    static OPS_THREAD_LOCAL size_t numBytes;    // bytes in all the chunks
+    static OPS_THREAD_LOCAL int numBlocks;      // blocks handed out and not given back
+};
+
+#endif
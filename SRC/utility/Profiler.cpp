@@ -0,0 +1,601 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/Profiler.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for Profiler.
+//
+// What: "@(#) Profiler.C, revA"
+
+#include <Profiler.h>
+#include <Element.h>
+#include <FE_Element.h>
+#include <DataPool.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#include <string.h>
+#define _PROFILE_COUNTERS
+#endif
+
+bool Profiler::active = false;
+
+static const char *phaseNames[PROFILE_NUM_PHASES] = {
+  "element state determination",
+  "form tangent",
+  "form unbalance",
+  "solve",
+  "convergence test",
+  "domain commit",
+  "recorders"
+};
+
+// the hardware counters
+#define PROFILE_NUM_COUNTERS 4
+
+static const char *counterNames[PROFILE_NUM_COUNTERS] = {
+  "cycles",
+  "instructions",
+  "LLC misses",
+  "branch misses"
+};
+
+static int numCounters = 0;                   // counters opened
+static int counterFD[PROFILE_NUM_COUNTERS];   // the first leads the group
+static int counterLoc[PROFILE_NUM_COUNTERS];  // in the group, -1 if not there
+
+static double phaseCounts[PROFILE_NUM_PHASES][PROFILE_NUM_COUNTERS];
+static double phaseStartCounts[PROFILE_NUM_PHASES][PROFILE_NUM_COUNTERS];
+
+static double phaseWall[PROFILE_NUM_PHASES];
+static double phaseCPU[PROFILE_NUM_PHASES];
+static double phaseStartWall[PROFILE_NUM_PHASES];
+static double phaseStartCPU[PROFILE_NUM_PHASES];
+static int phaseCalls[PROFILE_NUM_PHASES];
+
+// per element class times for the element state determination, and the
+// calls and times to form the element tangents and residuals
+struct ProfileElementClass {
+  int classTag;
+  const char *className;
+  double wall;
+  double cpu;
+  int calls;
+  double counts[PROFILE_NUM_COUNTERS];
+  double tangentWall;
+  int tangentCalls;
+  double residualWall;
+  int residualCalls;
+};
+
+// the slowest single calls, one for each element, slowest first
+#define PROFILE_NUM_SLOWEST 10
+
+struct ProfileSlowElement {
+  int tag;
+  const char *className;
+  const char *operation;
+  double wall;
+};
+
+static ProfileSlowElement slowest[PROFILE_NUM_SLOWEST];
+static int numSlowest = 0;
+
+static ProfileElementClass *eleClasses = 0;
+static int numEleClasses = 0;
+static int sizeEleClasses = 0;
+
+// wall time accumulated while the profiler was active
+static double totalWall = 0.0;
+static double totalCPU = 0.0;
+static double startWall = 0.0;
+static double startCPU = 0.0;
+
+static double
+wallTime(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER count, frequency;
+  QueryPerformanceCounter(&count);
+  QueryPerformanceFrequency(&frequency);
+  return (double)count.QuadPart/(double)frequency.QuadPart;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + 1.0e-6*tv.tv_usec;
+#endif
+}
+
+static double
+cpuTime(void)
+{
+  return (double)clock()/CLOCKS_PER_SEC;
+}
+
+
+static void
+readCounters(double *counts)
+{
+  for (int i=0; i<PROFILE_NUM_COUNTERS; i++)
+    counts[i] = 0.0;
+  if (numCounters == 0)
+    return;
+
+#ifdef _PROFILE_COUNTERS
+  // PERF_FORMAT_GROUP: the number of counters and their values
+  unsigned long long values[PROFILE_NUM_COUNTERS+1];
+  if (read(counterFD[0], values, sizeof(values)) <= 0)
+    return;
+  for (int i=0; i<PROFILE_NUM_COUNTERS; i++)
+    if (counterLoc[i] >= 0 && counterLoc[i] < (int)values[0])
+      counts[i] = (double)values[1+counterLoc[i]];
+#endif
+}
+
+static void
+closeCounters(void)
+{
+#ifdef _PROFILE_COUNTERS
+  for (int i=0; i<numCounters; i++)
+    close(counterFD[i]);
+#endif
+  numCounters = 0;
+}
+
+static int
+openCounters(void)
+{
+  closeCounters();
+  for (int i=0; i<PROFILE_NUM_COUNTERS; i++)
+    counterLoc[i] = -1;
+
+#ifdef _PROFILE_COUNTERS
+  static const unsigned long long configs[PROFILE_NUM_COUNTERS] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES
+  };
+
+  // one group led by the cycles, so all are read at once; a counter the
+  // processor or the kernel does not offer is left out
+  for (int i=0; i<PROFILE_NUM_COUNTERS; i++) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configs[i];
+    attr.disabled = (numCounters == 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+
+    int groupFD = (numCounters == 0) ? -1 : counterFD[0];
+    int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, groupFD, 0);
+    if (fd < 0) {
+      if (i == 0)
+	break;
+      continue;
+    }
+    counterFD[numCounters] = fd;
+    counterLoc[i] = numCounters;
+    numCounters++;
+  }
+
+  if (numCounters != 0) {
+    ioctl(counterFD[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(counterFD[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+#endif
+
+  if (numCounters == 0)
+    opserr << "WARNING Profiler - no hardware counters, check perf_event_paranoid\n";
+
+  return numCounters;
+}
+
+
+void
+Profiler::beginPhase(int phase)
+{
+  if (phase < 0 || phase >= PROFILE_NUM_PHASES)
+    return;
+
+  Tracer::begin(phaseNames[phase]);
+  if (active == false)
+    return;
+
+  phaseStartWall[phase] = wallTime();
+  phaseStartCPU[phase] = cpuTime();
+  if (numCounters != 0)
+    readCounters(phaseStartCounts[phase]);
+}
+
+
+void
+Profiler::endPhase(int phase)
+{
+  if (phase < 0 || phase >= PROFILE_NUM_PHASES)
+    return;
+
+  Tracer::end(phaseNames[phase]);
+  if (active == false)
+    return;
+
+  // a phase begun before the profiler was started is not counted
+  if (phaseStartWall[phase] == 0.0)
+    return;
+  
+  phaseWall[phase] += wallTime() - phaseStartWall[phase];
+  phaseCPU[phase] += cpuTime() - phaseStartCPU[phase];
+  phaseStartWall[phase] = 0.0;
+  phaseCalls[phase]++;
+
+  if (numCounters != 0) {
+    double counts[PROFILE_NUM_COUNTERS];
+    readCounters(counts);
+    for (int i=0; i<PROFILE_NUM_COUNTERS; i++)
+      phaseCounts[phase][i] += counts[i] - phaseStartCounts[phase][i];
+  }
+}
+
+
+static int
+findElementClass(int classTag, const char *className)
+{
+  int loc = 0;
+  while (loc < numEleClasses && eleClasses[loc].classTag != classTag)
+    loc++;
+
+  if (loc == numEleClasses) {
+    if (numEleClasses == sizeEleClasses) {
+      int newSize = 2*sizeEleClasses + 8;
+      ProfileElementClass *newClasses = new ProfileElementClass[newSize];
+      if (newClasses == 0) 
+	return -1;
+      for (int i=0; i<numEleClasses; i++)
+	newClasses[i] = eleClasses[i];
+      if (eleClasses != 0)
+	delete [] eleClasses;
+      eleClasses = newClasses;
+      sizeEleClasses = newSize;
+    }
+    eleClasses[loc].classTag = classTag;
+    eleClasses[loc].className = className;
+    eleClasses[loc].wall = 0.0;
+    eleClasses[loc].cpu = 0.0;
+    eleClasses[loc].calls = 0;
+    for (int i=0; i<PROFILE_NUM_COUNTERS; i++)
+      eleClasses[loc].counts[i] = 0.0;
+    eleClasses[loc].tangentWall = 0.0;
+    eleClasses[loc].tangentCalls = 0;
+    eleClasses[loc].residualWall = 0.0;
+    eleClasses[loc].residualCalls = 0;
+    numEleClasses++;
+  }
+
+  return loc;
+}
+
+
+static void
+addSlowest(int tag, const char *className, const char *operation, double wall)
+{
+  if (numSlowest == PROFILE_NUM_SLOWEST && wall <= slowest[numSlowest-1].wall)
+    return;
+
+  // an element in the list already keeps its slowest call
+  int loc = 0;
+  while (loc < numSlowest && slowest[loc].tag != tag)
+    loc++;
+  if (loc < numSlowest) {
+    if (wall <= slowest[loc].wall)
+      return;
+  } else if (numSlowest < PROFILE_NUM_SLOWEST)
+    loc = numSlowest++;
+  else
+    loc = numSlowest-1;
+
+  // move it up to keep the list sorted
+  while (loc > 0 && slowest[loc-1].wall < wall) {
+    slowest[loc] = slowest[loc-1];
+    loc--;
+  }
+  slowest[loc].tag = tag;
+  slowest[loc].className = className;
+  slowest[loc].operation = operation;
+  slowest[loc].wall = wall;
+}
+
+
+int
+Profiler::update(Element &theElement)
+{
+  double startCounts[PROFILE_NUM_COUNTERS];
+  double counts[PROFILE_NUM_COUNTERS];
+  if (numCounters != 0)
+    readCounters(startCounts);
+
+  double wall = wallTime();
+  double cpu = cpuTime();
+  
+  int result = theElement.update();
+
+  wall = wallTime() - wall;
+  cpu = cpuTime() - cpu;
+
+  if (numCounters != 0)
+    readCounters(counts);
+
+  int loc = findElementClass(theElement.getClassTag(), theElement.getClassType());
+  if (loc < 0)
+    return result;
+
+  eleClasses[loc].wall += wall;
+  eleClasses[loc].cpu += cpu;
+  eleClasses[loc].calls++;
+  if (numCounters != 0)
+    for (int i=0; i<PROFILE_NUM_COUNTERS; i++)
+      eleClasses[loc].counts[i] += counts[i] - startCounts[i];
+
+  addSlowest(theElement.getTag(), eleClasses[loc].className, "update", wall);
+
+  return result;
+}
+
+
+const Matrix &
+Profiler::getTangent(FE_Element &theFE, Integrator *theIntegrator)
+{
+  double wall = wallTime();
+  const Matrix &theTangent = theFE.getTangent(theIntegrator);
+  wall = wallTime() - wall;
+
+  // the FE_Elements of the constraints have no Element
+  Element *theElement = theFE.getElement();
+  int loc = (theElement != 0) ?
+    findElementClass(theElement->getClassTag(), theElement->getClassType()) :
+    findElementClass(-1, "constraints");
+  if (loc < 0)
+    return theTangent;
+
+  eleClasses[loc].tangentWall += wall;
+  eleClasses[loc].tangentCalls++;
+  if (theElement != 0)
+    addSlowest(theElement->getTag(), eleClasses[loc].className, "tangent", wall);
+
+  return theTangent;
+}
+
+
+const Vector &
+Profiler::getResidual(FE_Element &theFE, Integrator *theIntegrator)
+{
+  double wall = wallTime();
+  const Vector &theResidual = theFE.getResidual(theIntegrator);
+  wall = wallTime() - wall;
+
+  Element *theElement = theFE.getElement();
+  int loc = (theElement != 0) ?
+    findElementClass(theElement->getClassTag(), theElement->getClassType()) :
+    findElementClass(-1, "constraints");
+  if (loc < 0)
+    return theResidual;
+
+  eleClasses[loc].residualWall += wall;
+  eleClasses[loc].residualCalls++;
+  if (theElement != 0)
+    addSlowest(theElement->getTag(), eleClasses[loc].className, "residual", wall);
+
+  return theResidual;
+}
+
+
+int
+Profiler::setCounters(bool on)
+{
+  if (on == false) {
+    closeCounters();
+    return 0;
+  }
+
+  if (numCounters == 0)
+    openCounters();
+
+  return numCounters;
+}
+
+
+void
+Profiler::start(void)
+{
+  if (active == true)
+    return;
+
+#ifdef _PROFILE_COUNTERS
+  if (numCounters != 0)
+    ioctl(counterFD[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  
+  for (int i=0; i<PROFILE_NUM_PHASES; i++)
+    phaseStartWall[i] = 0.0;
+
+  startWall = wallTime();
+  startCPU = cpuTime();
+  active = true;
+}
+
+
+void
+Profiler::stop(void)
+{
+  if (active == false)
+    return;
+
+  totalWall += wallTime() - startWall;
+  totalCPU += cpuTime() - startCPU;
+  active = false;
+
+#ifdef _PROFILE_COUNTERS
+  if (numCounters != 0)
+    ioctl(counterFD[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+
+void
+Profiler::reset(void)
+{
+  for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+    phaseWall[i] = 0.0;
+    phaseCPU[i] = 0.0;
+    phaseStartWall[i] = 0.0;
+    phaseCalls[i] = 0;
+    for (int j=0; j<PROFILE_NUM_COUNTERS; j++)
+      phaseCounts[i][j] = 0.0;
+  }
+  numEleClasses = 0;
+  numSlowest = 0;
+
+  totalWall = 0.0;
+  totalCPU = 0.0;
+  startWall = wallTime();
+  startCPU = cpuTime();
+
+  DataPool::resetCounts();
+}
+
+
+static void
+printCounters(OPS_Stream &s, const char *name, const double *counts)
+{
+  char buffer[256];
+  double cycles = counts[0];
+  double instructions = counts[1];
+  double ipc = (cycles > 0.0) ? instructions/cycles : 0.0;
+  double llc = (instructions > 0.0) ? 1000.0*counts[2]/instructions : 0.0;
+  double branch = (instructions > 0.0) ? 1000.0*counts[3]/instructions : 0.0;
+  sprintf(buffer, "  %-28s %14.0f %14.0f %14.0f %14.0f %6.2f %8.3f %8.3f\n", name,
+	  counts[0], counts[1], counts[2], counts[3], ipc, llc, branch);
+  s << buffer;
+}
+
+
+void
+Profiler::report(OPS_Stream &s)
+{
+  double wall = totalWall;
+  double cpu = totalCPU;
+  if (active == true) {
+    wall += wallTime() - startWall;
+    cpu += cpuTime() - startCPU;
+  }
+
+  // a step is taken to be a domain commit
+  int numSteps = phaseCalls[PROFILE_COMMIT];
+
+  s << "Profile - wall " << wall << " sec, CPU " << cpu << " sec, ";
+  s << numSteps << " steps\n";
+  s << "  phase                          calls        wall(sec)         CPU(sec)   %wall    wall/step\n";
+
+  double sumWall = 0.0;
+  double sumCPU = 0.0;
+  for (int i=0; i<PROFILE_NUM_PHASES; i++) {
+    double percent = (wall > 0.0) ? 100.0*phaseWall[i]/wall : 0.0;
+    double perStep = (numSteps > 0) ? phaseWall[i]/numSteps : 0.0;
+    char buffer[256];
+    sprintf(buffer, "  %-28s %8d %16.6f %16.6f %7.2f %12.6e\n", phaseNames[i],
+	    phaseCalls[i], phaseWall[i], phaseCPU[i], percent, perStep);
+    s << buffer;
+    sumWall += phaseWall[i];
+    sumCPU += phaseCPU[i];
+  }
+
+  char buffer[256];
+  double otherWall = (wall > sumWall) ? wall - sumWall : 0.0;
+  double otherCPU = (cpu > sumCPU) ? cpu - sumCPU : 0.0;
+  sprintf(buffer, "  %-28s %8s %16.6f %16.6f %7.2f\n", "other", "",
+	  otherWall, otherCPU, (wall > 0.0) ? 100.0*otherWall/wall : 0.0);
+  s << buffer;
+
+  // the element classes: state determination, tangent and residual, with
+  // the mean time of a call in microseconds
+  if (numEleClasses != 0) {
+    sprintf(buffer, "  %-28s %8s %8s %8s %8s %8s %8s %12s %7s\n", "element class",
+	    "update", "mean(us)", "tangent", "mean(us)", "residual", "mean(us)",
+	    "wall(sec)", "%wall");
+    s << buffer;
+    for (int i=0; i<numEleClasses; i++) {
+      ProfileElementClass &theClass = eleClasses[i];
+      double classWall = theClass.wall + theClass.tangentWall + theClass.residualWall;
+      double percent = (wall > 0.0) ? 100.0*classWall/wall : 0.0;
+      sprintf(buffer, "  %-28s %8d %8.2f %8d %8.2f %8d %8.2f %12.6f %7.2f\n",
+	      theClass.className,
+	      theClass.calls, (theClass.calls > 0) ? 1.0e6*theClass.wall/theClass.calls : 0.0,
+	      theClass.tangentCalls, (theClass.tangentCalls > 0) ? 1.0e6*theClass.tangentWall/theClass.tangentCalls : 0.0,
+	      theClass.residualCalls, (theClass.residualCalls > 0) ? 1.0e6*theClass.residualWall/theClass.residualCalls : 0.0,
+	      classWall, percent);
+      s << buffer;
+    }
+  }
+
+  if (numSlowest != 0) {
+    sprintf(buffer, "  %-28s %10s  %-8s %12s\n", "slowest elements", "tag",
+	    "call", "wall(us)");
+    s << buffer;
+    for (int i=0; i<numSlowest; i++) {
+      sprintf(buffer, "  %-28s %10d  %-8s %12.2f\n", slowest[i].className,
+	      slowest[i].tag, slowest[i].operation, 1.0e6*slowest[i].wall);
+      s << buffer;
+    }
+  }
+
+  // the allocations of Vector and Matrix data, of all threads
+  DataPool::report(s);
+
+  if (numCounters == 0)
+    return;
+
+  // the counters, with the instructions per cycle and the misses per
+  // thousand instructions: a low IPC with many cache misses is memory bound
+  sprintf(buffer, "  %-28s %14s %14s %14s %14s %6s %8s %8s\n", "phase counters",
+	  counterNames[0], counterNames[1], counterNames[2], counterNames[3],
+	  "IPC", "LLC/ki", "br/ki");
+  s << buffer;
+  for (int i=0; i<PROFILE_NUM_PHASES; i++)
+    printCounters(s, phaseNames[i], phaseCounts[i]);
+  for (int i=0; i<numEleClasses; i++)
+    printCounters(s, eleClasses[i].className, eleClasses[i].counts);
+}
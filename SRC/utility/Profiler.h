@@ -0,0 +1,93 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/Profiler.h,v $
+
+#ifndef Profiler_h
+#define Profiler_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for Profiler.
+// Profiler accumulates the wall clock and CPU time spent in the phases of
+// an analysis: element state determination (broken down by element
+// class), forming the tangent and the unbalance, solving the system of
+// equations, the convergence test, committing the domain and recording.
+// The phases are bracketed in the code by calls to Profiler::begin() and
+// Profiler::end(), which do nothing but test a flag unless the profiler
+// has been started. While it runs the element state determination and
+// the serial loops forming the element tangents and residuals are timed
+// element by element, for the report by element class and the slowest
+// elements. On Linux the profiler can also count hardware events
+// with perf_event for each phase and element class: cycles, instructions,
+// last level cache misses and branch misses, for the thread running the
+// analysis. The phases are also spans of the Tracer while it runs.
+//
+// What: "@(#) Profiler.h, revA"
+
+#include <OPS_Globals.h>
+#include <Tracer.h>
+
+class Element;
+class FE_Element;
+class Integrator;
+class Matrix;
+class Vector;
+
+#define PROFILE_UPDATE     0
+#define PROFILE_TANGENT    1
+#define PROFILE_UNBALANCE  2
+#define PROFILE_SOLVE      3
+#define PROFILE_TEST       4
+#define PROFILE_COMMIT     5
+#define PROFILE_RECORD     6
+#define PROFILE_NUM_PHASES 7
+
+class Profiler
+{
+  public:
+    static inline void begin(int phase) 
+      {if (active == true || Tracer::active == true) beginPhase(phase);}
+    static inline void end(int phase) 
+      {if (active == true || Tracer::active == true) endPhase(phase);}
+    static int update(Element &theElement);
+    static const Matrix &getTangent(FE_Element &theFE, Integrator *theIntegrator);
+    static const Vector &getResidual(FE_Element &theFE, Integrator *theIntegrator);
+
+    // opens or closes the hardware counters, returns the number opened,
+    // 0 where there are none
+    static int setCounters(bool on);
+
+    static void start(void);
+    static void stop(void);
+    static void reset(void);
+    static bool isActive(void) {return active;}
+    static void report(OPS_Stream &s);
+
+    static bool active;
+
+  private:
+    static void beginPhase(int phase);
+    static void endPhase(int phase);
+};
+
+#endif
@@ -0,0 +1,153 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/RealTimeMonitor.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for
+// RealTimeMonitor.
+//
+// What: "@(#) RealTimeMonitor.C, revA"
+
+#include <RealTimeMonitor.h>
+#include <math.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static double
+monotonicTime(void)
+{
+#ifdef _WIN32
+  LARGE_INTEGER count, frequency;
+  QueryPerformanceCounter(&count);
+  QueryPerformanceFrequency(&frequency);
+  return (double)count.QuadPart/(double)frequency.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1.0e-9*ts.tv_nsec;
+#endif
+}
+
+
+RealTimeMonitor::RealTimeMonitor(double p, bool pc)
+  :period(p), pace(pc)
+{
+  this->reset();
+}
+
+
+RealTimeMonitor::~RealTimeMonitor()
+{
+
+}
+
+
+void
+RealTimeMonitor::reset(void)
+{
+  started = false;
+  tRelease = 0.0;
+  deadline = 0.0;
+  numSteps = 0;
+  numOverruns = 0;
+  sumWork = 0.0;
+  maxWork = 0.0;
+  sumDev2 = 0.0;
+  maxDev = 0.0;
+}
+
+
+void
+RealTimeMonitor::startStep(void)
+{
+  // the clock starts with the first step, the later steps are
+  // released by endStep() of the step before
+  if (started == false) {
+    tRelease = monotonicTime();
+    deadline = tRelease + period;
+    started = true;
+  }
+}
+
+
+int
+RealTimeMonitor::endStep(void)
+{
+  if (started == false)
+    return 0;
+
+  double now = monotonicTime();
+  double work = now - tRelease;
+  int overrun = 0;
+
+  if (now > deadline) {
+    // missed the deadline, restart the deadlines from here
+    overrun = 1;
+    numOverruns++;
+    deadline = now;
+  } else if (pace == true) {
+    // busy wait, sleeping is far too coarse for millisecond periods
+    while (now < deadline)
+      now = monotonicTime();
+  }
+
+  double dev = now - tRelease - period;
+  sumDev2 += dev*dev;
+  if (fabs(dev) > maxDev)
+    maxDev = fabs(dev);
+
+  sumWork += work;
+  if (work > maxWork)
+    maxWork = work;
+  numSteps++;
+
+  tRelease = now;
+  deadline += period;
+
+  return overrun;
+}
+
+
+void
+RealTimeMonitor::Print(OPS_Stream &s, int flag)
+{
+  s << "  real time period: " << period;
+  if (pace == true)
+    s << " (paced)\n";
+  else
+    s << " (not paced)\n";
+
+  if (numSteps == 0) {
+    s << "    no steps timed\n";
+    return;
+  }
+
+  s << "    steps: " << numSteps << "  overruns: " << numOverruns << endln;
+  s << "    step time  mean: " << sumWork/numSteps << "  max: " << maxWork << endln;
+  s << "    jitter  rms: " << sqrt(sumDev2/numSteps) << "  max: " << maxDev << endln;
+}
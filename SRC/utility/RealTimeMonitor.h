@@ -0,0 +1,76 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/RealTimeMonitor.h,v $
+
+#ifndef RealTimeMonitor_h
+#define RealTimeMonitor_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for
+// RealTimeMonitor. A RealTimeMonitor is owned by a transient integrator
+// used for real-time hybrid simulation. It is told when each analysis
+// step starts and when it is committed, and measures against a fixed wall
+// clock period: the time spent computing each step, the deviation of the
+// actual step interval from the period (the jitter) and the number of
+// steps that overran their deadline. If pacing is on, a step that
+// finishes early is held until its deadline, the deadlines following
+// each other by exactly one period so that no drift accumulates; after an
+// overrun the deadlines restart from the time of the overrun.
+//
+// What: "@(#) RealTimeMonitor.h, revA"
+
+#include <OPS_Globals.h>
+
+class RealTimeMonitor
+{
+  public:
+    RealTimeMonitor(double period, bool pace = true);
+    ~RealTimeMonitor();
+
+    void startStep(void);
+    int endStep(void);
+    void reset(void);
+
+    double getPeriod(void) const {return period;}
+    int getNumSteps(void) const {return numSteps;}
+    int getNumOverruns(void) const {return numOverruns;}
+    double getMaxStepTime(void) const {return maxWork;}
+    double getMaxJitter(void) const {return maxDev;}
+
+    void Print(OPS_Stream &s, int flag = 0);
+
+  private:
+    double period;      // wall clock time available for each step
+    bool pace;          // hold steps that finish early until their deadline
+
+    bool started;
+    double tRelease;    // time the last step was released
+    double deadline;    // time the current step has to be done by
+
+    int numSteps, numOverruns;
+    double sumWork, maxWork;
+    double sumDev2, maxDev;
+};
+
+#endif
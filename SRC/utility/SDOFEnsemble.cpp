@@ -0,0 +1,332 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/SDOFEnsemble.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the implementation of SDOFEnsemble.
+//
+// What: "@(#) SDOFEnsemble.cpp, revA"
+
+#include <SDOFEnsemble.h>
+#include <ThreadPool.h>
+#include <UniaxialMaterial.h>
+#include <TimeSeries.h>
+#include <math.h>
+
+// the oscillators of a chunk advance together and are set in one batch,
+// their arrays are on the stack of the thread running it
+#define SDOF_ENSEMBLE_CHUNK 64
+
+SDOFEnsemble::SDOFEnsemble(int num, double deltaT, double zeta,
+			   double tolerance, int maxNumIter)
+  :numOsc(num), dt(deltaT), dampingRatio(zeta), tol(tolerance),
+   maxIter(maxNumIter), theMaterials(0), mass(0), damping(0), factor(0),
+   theSeries(0), peakDisp(0), peakVel(0), peakAccel(0), peakForce(0)
+{
+  if (numOsc < 0)
+    numOsc = 0;
+
+  theMaterials = new UniaxialMaterial *[numOsc];
+  theSeries = new TimeSeries *[numOsc];
+  mass = new double[numOsc];
+  damping = new double[numOsc];
+  factor = new double[numOsc];
+  peakDisp = new double[numOsc];
+  peakVel = new double[numOsc];
+  peakAccel = new double[numOsc];
+  peakForce = new double[numOsc];
+
+  for (int i = 0; i < numOsc; i++) {
+    theMaterials[i] = 0;
+    theSeries[i] = 0;
+    mass[i] = 0.0;
+    damping[i] = 0.0;
+    factor[i] = 0.0;
+    peakDisp[i] = 0.0;
+    peakVel[i] = 0.0;
+    peakAccel[i] = 0.0;
+    peakForce[i] = 0.0;
+  }
+}
+
+SDOFEnsemble::~SDOFEnsemble()
+{
+  for (int i = 0; i < numOsc; i++)
+    if (theMaterials[i] != 0)
+      delete theMaterials[i];
+
+  delete [] theMaterials;
+  delete [] theSeries;
+  delete [] mass;
+  delete [] damping;
+  delete [] factor;
+  delete [] peakDisp;
+  delete [] peakVel;
+  delete [] peakAccel;
+  delete [] peakForce;
+}
+
+int
+SDOFEnsemble::setOscillator(int i, UniaxialMaterial &theMaterial, double m,
+			    TimeSeries &series, double fact)
+{
+  if (i < 0 || i >= numOsc) {
+    opserr << "SDOFEnsemble::setOscillator() - oscillator " << i << " out of range\n";
+    return -1;
+  }
+  if (m <= 0.0) {
+    opserr << "SDOFEnsemble::setOscillator() - mass of oscillator " << i << " must be positive\n";
+    return -1;
+  }
+
+  UniaxialMaterial *theCopy = theMaterial.getCopy();
+  if (theCopy == 0) {
+    opserr << "SDOFEnsemble::setOscillator() - failed to copy the material of oscillator " << i << endln;
+    return -1;
+  }
+  if (theMaterials[i] != 0)
+    delete theMaterials[i];
+
+  theMaterials[i] = theCopy;
+  theSeries[i] = &series;
+  mass[i] = m;
+  factor[i] = fact;
+
+  double k0 = theCopy->getInitialTangent();
+  damping[i] = (k0 > 0.0) ? 2.0*dampingRatio*sqrt(k0*m) : 0.0;
+
+  return 0;
+}
+
+int
+SDOFEnsemble::run(int numSteps)
+{
+  if (numSteps < 1 || dt <= 0.0) {
+    opserr << "SDOFEnsemble::run() - need at least one step of positive size\n";
+    return -1;
+  }
+  for (int i = 0; i < numOsc; i++)
+    if (theMaterials[i] == 0) {
+      opserr << "SDOFEnsemble::run() - oscillator " << i << " has not been set\n";
+      return -1;
+    }
+
+  // the ground acceleration of each series at each step, sampled once
+  // for the oscillators sharing it; the series are not used by the threads
+  int numTimes = numSteps + 1;
+  int numSeries = 0;
+  int *seriesIndex = new int[numOsc];
+  for (int i = 0; i < numOsc; i++) {
+    seriesIndex[i] = -1;
+    for (int k = 0; k < i && seriesIndex[i] < 0; k++)
+      if (theSeries[k] == theSeries[i])
+	seriesIndex[i] = seriesIndex[k];
+    if (seriesIndex[i] < 0)
+      seriesIndex[i] = numSeries++;
+  }
+
+  double *ag = new double[numSeries*numTimes];
+  double *times = new double[numTimes];
+  for (int j = 0; j < numTimes; j++)
+    times[j] = j*dt;
+  for (int s = 0, i = 0; s < numSeries; i++)
+    if (seriesIndex[i] == s)
+      theSeries[i]->getFactors(times, ag + numTimes*s++, numTimes);
+  delete [] times;
+
+  int numChunks = (numOsc + SDOF_ENSEMBLE_CHUNK - 1)/SDOF_ENSEMBLE_CHUNK;
+  int numFailed = 0;
+
+#ifdef _OPENMP
+  int numT = ThreadPool::getNumThreads();
+#pragma omp parallel for schedule(dynamic, 1) num_threads(numT) reduction(+:numFailed)
+#endif
+  for (int c = 0; c < numChunks; c++) {
+    int first = c*SDOF_ENSEMBLE_CHUNK;
+    int last = first + SDOF_ENSEMBLE_CHUNK;
+    if (last > numOsc)
+      last = numOsc;
+    numFailed += this->runChunk(first, last, numSteps, ag, seriesIndex);
+  }
+
+  delete [] ag;
+  delete [] seriesIndex;
+
+  return numFailed;
+}
+
+// set the trial strains of or commit n materials; the batch methods of a material
+// class assume all are of that class, a chunk mixing classes gets the
+// default of UniaxialMaterial
+static int
+commitChunk(UniaxialMaterial **theMats, int n, bool sameClass)
+{
+  if (sameClass)
+    return commitChunk(theMats, n, sameClass);
+  else
+    return theMats[0]->UniaxialMaterial::commitBatch(theMats, n);
+}
+
+static int
+setTrialChunk(UniaxialMaterial **theMats, const double *strains, 
+	      double *stresses, double *tangents, int n, bool sameClass)
+{
+  if (sameClass)
+    return theMats[0]->setTrialBatch(theMats, strains, stresses, tangents, n);
+  else
+    return theMats[0]->UniaxialMaterial::setTrialBatch(theMats, strains, stresses, tangents, n);
+}
+
+int
+SDOFEnsemble::runChunk(int first, int last, int numSteps, const double *ag,
+		       const int *seriesIndex)
+{
+  const int n = last - first;
+  const int numTimes = numSteps + 1;
+  UniaxialMaterial **theMats = theMaterials + first;
+  const double *m = mass + first;
+  const double *c = damping + first;
+  const double *fact = factor + first;
+  const double *agK[SDOF_ENSEMBLE_CHUNK];
+  for (int k = 0; k < n; k++)
+    agK[k] = ag + seriesIndex[first+k]*numTimes;
+
+  bool sameClass = true;
+  int classTag = theMats[0]->getClassTag();
+  for (int k = 1; k < n; k++)
+    if (theMats[k]->getClassTag() != classTag)
+      sameClass = false;
+
+  // committed and trial state of the oscillators
+  double u[SDOF_ENSEMBLE_CHUNK], v[SDOF_ENSEMBLE_CHUNK], a[SDOF_ENSEMBLE_CHUNK];
+  double U[SDOF_ENSEMBLE_CHUNK], F[SDOF_ENSEMBLE_CHUNK], kt[SDOF_ENSEMBLE_CHUNK];
+  double p[SDOF_ENSEMBLE_CHUNK], agNow[SDOF_ENSEMBLE_CHUNK];
+  bool failed[SDOF_ENSEMBLE_CHUNK];
+
+  // the oscillators still iterating, gathered for the batch
+  int active[SDOF_ENSEMBLE_CHUNK];
+  UniaxialMaterial *theActive[SDOF_ENSEMBLE_CHUNK];
+  double strainA[SDOF_ENSEMBLE_CHUNK], stressA[SDOF_ENSEMBLE_CHUNK];
+  double tangentA[SDOF_ENSEMBLE_CHUNK];
+
+  // at rest, the acceleration balances the ground acceleration and any
+  // initial force of the material
+  for (int k = 0; k < n; k++) {
+    theMats[k]->revertToStart();
+    u[k] = 0.0;
+    v[k] = 0.0;
+    U[k] = 0.0;
+    failed[k] = false;
+  }
+  setTrialChunk(theMats, U, F, kt, n, sameClass);
+  commitChunk(theMats, n, sameClass);
+
+  double *pDisp = peakDisp + first;
+  double *pVel = peakVel + first;
+  double *pAccel = peakAccel + first;
+  double *pForce = peakForce + first;
+  for (int k = 0; k < n; k++) {
+    double ag0 = fact[k]*agK[k][0];
+    a[k] = -ag0 - F[k]/m[k];
+    pDisp[k] = 0.0;
+    pVel[k] = 0.0;
+    pAccel[k] = fabs(F[k]/m[k]);
+    pForce[k] = fabs(F[k]);
+  }
+
+  // average acceleration
+  const double c1 = 2.0/dt;
+  const double c2 = 4.0/(dt*dt);
+  const double c3 = 4.0/dt;
+
+  for (int j = 1; j < numTimes; j++) {
+    for (int k = 0; k < n; k++) {
+      agNow[k] = fact[k]*agK[k][j];
+      p[k] = -m[k]*agNow[k];
+      U[k] = u[k];
+      active[k] = k;
+    }
+
+    // Newton iterations on the oscillators not yet converged, the
+    // residual checked before each correction
+    int numActive = n;
+    for (int iter = 0; numActive > 0; iter++) {
+      int numNext = 0;
+      for (int q = 0; q < numActive; q++) {
+	int k = active[q];
+	double du = U[k] - u[k];
+	double vT = c1*du - v[k];
+	double aT = c2*du - c3*v[k] - a[k];
+	double r = p[k] - m[k]*aT - c[k]*vT - F[k];
+	double norm = fabs(p[k]) + fabs(m[k]*aT) + fabs(c[k]*vT) + fabs(F[k]);
+	if (fabs(r) <= tol*norm)
+	  continue;
+	U[k] += r/(kt[k] + c1*c[k] + c2*m[k]);
+	active[numNext++] = k;
+      }
+
+      for (int q = 0; q < numNext; q++) {
+	theActive[q] = theMats[active[q]];
+	strainA[q] = U[active[q]];
+      }
+      if (numNext > 0)
+	setTrialChunk(theActive, strainA, stressA, tangentA, numNext, sameClass);
+      for (int q = 0; q < numNext; q++) {
+	F[active[q]] = stressA[q];
+	kt[active[q]] = tangentA[q];
+      }
+
+      // the last correction is kept, the material at it committed
+      if (numNext > 0 && iter == maxIter) {
+	for (int q = 0; q < numNext; q++)
+	  failed[active[q]] = true;
+	break;
+      }
+      numActive = numNext;
+    }
+
+    commitChunk(theMats, n, sameClass);
+
+    for (int k = 0; k < n; k++) {
+      double du = U[k] - u[k];
+      double vNew = c1*du - v[k];
+      a[k] = c2*du - c3*v[k] - a[k];
+      v[k] = vNew;
+      u[k] = U[k];
+
+      double absAccel = fabs(a[k] + agNow[k]);
+      if (fabs(u[k]) > pDisp[k]) pDisp[k] = fabs(u[k]);
+      if (fabs(v[k]) > pVel[k]) pVel[k] = fabs(v[k]);
+      if (absAccel > pAccel[k]) pAccel[k] = absAccel;
+      if (fabs(F[k]) > pForce[k]) pForce[k] = fabs(F[k]);
+    }
+  }
+
+  int numFailed = 0;
+  for (int k = 0; k < n; k++)
+    if (failed[k])
+      numFailed++;
+
+  return numFailed;
+}
@@ -0,0 +1,93 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/SDOFEnsemble.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for SDOFEnsemble.
+// SDOFEnsemble integrates many single degree of freedom oscillators under
+// ground accelerations, as for response spectra, without a Domain: each
+// oscillator is a mass, a viscous damper of a fraction of the critical
+// damping at the initial stiffness and a copy of a uniaxial material
+// giving the force for the displacement. The oscillators advance together
+// with the average acceleration method and Newton iterations, their state
+// held in arrays and their materials set and committed in chunks with the
+// batch methods of UniaxialMaterial, the chunks in parallel. The peak
+// relative displacement, relative velocity, absolute acceleration and
+// material force of each oscillator are kept.
+//
+// What: "@(#) SDOFEnsemble.h, revA"
+
+#ifndef SDOFEnsemble_h
+#define SDOFEnsemble_h
+
+#include <OPS_Globals.h>
+
+class UniaxialMaterial;
+class TimeSeries;
+
+class SDOFEnsemble
+{
+  public:
+    SDOFEnsemble(int numOscillators, double dt, double dampingRatio = 0.05,
+		 double tol = 1.0e-10, int maxIter = 20);
+    ~SDOFEnsemble();
+
+    // oscillator i gets a copy of theMaterial and is excited by factor
+    // times the ground acceleration of theSeries
+    int setOscillator(int i, UniaxialMaterial &theMaterial, double mass,
+		      TimeSeries &theSeries, double factor = 1.0);
+
+    // integrates numSteps steps from rest, returns the number of
+    // oscillators that did not converge in some step, < 0 on error
+    int run(int numSteps);
+
+    int getNumOscillators(void) const {return numOsc;}
+    const double *getPeakDisp(void) const {return peakDisp;}
+    const double *getPeakVel(void) const {return peakVel;}
+    const double *getPeakAccel(void) const {return peakAccel;}
+    const double *getPeakForce(void) const {return peakForce;}
+
+  private:
+    int runChunk(int first, int last, int numSteps, const double *ag,
+		 const int *seriesIndex);
+
+    int numOsc;
+    double dt;
+    double dampingRatio;
+    double tol;
+    int maxIter;
+
+    UniaxialMaterial **theMaterials;  // the copies
+    double *mass;
+    double *damping;
+    double *factor;
+    TimeSeries **theSeries;
+
+    double *peakDisp;
+    double *peakVel;
+    double *peakAccel;
+    double *peakForce;
+};
+
+#endif
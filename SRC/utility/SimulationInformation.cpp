@@ -33,6 +33,7 @@
 #include <FileIter.h>
 #include <OPS_Globals.h>
 #include <string.h>
+#include <stdio.h>
 #include <time.h>
 #include <math.h>
 //#include <tcl.h>
@@ -93,6 +94,7 @@ SimulationInformation::start(void)
   modelTypes.clear();
   elementTypes.clear();
   materialTypes.clear();
+  memoryUsage.clear();
 
   // now set the start time
   time_t timeT;
@@ -325,6 +327,24 @@ SimulationInformation::addMaterialType(const char *theType)
   return materialTypes.addString(theType);
 }
 
+int
+SimulationInformation::clearMemoryUsage(void)
+{
+  memoryUsage.clear();
+  return 0;
+}
+
+int
+SimulationInformation::addMemoryUsage(const char *subsystem, double numBytes)
+{
+  if (subsystem == 0)
+    return -1;
+
+  char buffer[128];
+  sprintf(buffer, "%.64s %.0f", subsystem, numBytes);
+  return memoryUsage.addString(buffer);
+}
+
 
 void 
 PrintFiles(OPS_Stream &s, File *theFile) 
@@ -421,6 +441,9 @@ SimulationInformation::Print(OPS_Stream &s) const
   s.tag("ComputerResource");
   s.tag("OS","Linux");
   s.tag("machine","local");
+  numStrings = memoryUsage.getNumStrings();
+  for (int i=0; i<numStrings; i++) 
+    s.tag("MemoryUsage",memoryUsage.getString(i));    
   s.endTag(); // Computer
 
   s.tag("Files");
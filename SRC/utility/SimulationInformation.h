@@ -68,6 +68,10 @@ class SimulationInformation
   int addElementType(const char *type);
   int addMaterialType(const char *type);
 
+  // the bytes by subsystem of the last memory report
+  int clearMemoryUsage(void);
+  int addMemoryUsage(const char *subsystem, double numBytes);
+
   /*  int addTclInformationCommands(Tcl_Interp *interp); */
 
   void Print(OPS_Stream &s) const;   
@@ -99,6 +103,7 @@ class SimulationInformation
   StringContainer loadingTypes;
   StringContainer elementTypes;
   StringContainer materialTypes;
+  StringContainer memoryUsage;
 };
 
 
@@ -0,0 +1,236 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadPool.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for ThreadPool.
+//
+// What: "@(#) ThreadPool.C, revA"
+
+#include <ThreadPool.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#else
+#include <time.h>
+#endif
+
+#if defined(__linux__) && defined(_OPENMP)
+#include <sched.h>
+#define _PIN_THREADS
+#endif
+
+// the BLAS libraries that run their own threads are told the count too;
+// the symbols are weak so nothing is needed from a BLAS that has neither
+#if defined(__GNUC__) && !defined(_WIN32) && !defined(__APPLE__)
+extern "C" void openblas_set_num_threads(int) __attribute__((weak));
+extern "C" void MKL_Set_Num_Threads(int) __attribute__((weak));
+#define _BLAS_SET_THREADS
+#endif
+
+int ThreadPool::numThreads = 1;
+double ThreadPool::elementThreshold = -1.0;
+bool ThreadPool::domainThreaded = false;
+bool ThreadPool::reproducible = false;
+bool ThreadPool::pinned = false;
+
+#ifdef _OPENMP
+// the runtime schedule of the element loops of the integrators until the
+// threads are pinned, see setPinned()
+static int scheduleSet = (omp_set_schedule(omp_sched_dynamic, 16), 0);
+#endif
+
+#ifdef _PIN_THREADS
+// the processors the process was started on, the threads are pinned to
+// them in order and given all of them back when unpinned
+static cpu_set_t startSet;
+static bool startSetKept = false;
+#endif
+
+int
+ThreadPool::setNumThreads(int numT)
+{
+  if (numT < 1) {
+    opserr << "WARNING ThreadPool::setNumThreads() - ";
+    opserr << "number of threads must be at least 1\n";
+    return -1;
+  }
+
+#ifdef _OPENMP
+  omp_set_dynamic(0);
+  omp_set_max_active_levels(1);
+  omp_set_num_threads(numT);
+#else
+  if (numT > 1) {
+    opserr << "WARNING ThreadPool::setNumThreads() - ";
+    opserr << "not compiled with OpenMP, using 1 thread\n";
+    numT = 1;
+  }
+#endif
+
+  numThreads = numT;
+  setBLASThreads();
+
+  // the threads the runtime adds are pinned too
+  if (pinned == true)
+    return pinThreads();
+
+  return 0;
+}
+
+void
+ThreadPool::setReproducible(bool flag)
+{
+  reproducible = flag;
+  setBLASThreads();
+}
+
+int
+ThreadPool::setPinned(bool flag)
+{
+#ifndef _PIN_THREADS
+  if (flag == true) {
+    opserr << "WARNING ThreadPool::setPinned() - ";
+    opserr << "threads can not be pinned on this platform\n";
+    return -1;
+  }
+#endif
+
+  pinned = flag;
+
+#ifdef _OPENMP
+  // the element loops of the integrators use the runtime schedule; pinned
+  // each thread gets the same chunks of elements every time
+  if (pinned == true)
+    omp_set_schedule(omp_sched_static, 16);
+  else
+    omp_set_schedule(omp_sched_dynamic, 16);
+#endif
+
+  return pinThreads();
+}
+
+int
+ThreadPool::pinThreads(void)
+{
+#ifdef _PIN_THREADS
+  if (startSetKept == false) {
+    CPU_ZERO(&startSet);
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &startSet) != 0) {
+      opserr << "WARNING ThreadPool::pinThreads() - ";
+      opserr << "failed to get the processors of the process\n";
+      return -1;
+    }
+    startSetKept = true;
+  }
+
+  int numCPU = CPU_COUNT(&startSet);
+  int *cpus = new int[numCPU];
+  int count = 0;
+  for (int i=0; i<CPU_SETSIZE && count<numCPU; i++)
+    if (CPU_ISSET(i, &startSet))
+      cpus[count++] = i;
+
+  int result = 0;
+  bool pin = pinned;
+#pragma omp parallel num_threads(numThreads) reduction(+:result)
+  {
+    cpu_set_t theSet;
+    if (pin == true) {
+      CPU_ZERO(&theSet);
+      CPU_SET(cpus[omp_get_thread_num() % count], &theSet);
+    } else
+      theSet = startSet;
+    if (sched_setaffinity(0, sizeof(cpu_set_t), &theSet) != 0)
+      result++;
+  }
+
+  delete [] cpus;
+
+  if (result != 0) {
+    opserr << "WARNING ThreadPool::pinThreads() - ";
+    opserr << "failed to set the processors of " << result << " threads\n";
+    return -1;
+  }
+#endif
+
+  return 0;
+}
+
+void
+ThreadPool::placeRows(double *data, const int *rowStart, int numRows)
+{
+#ifdef _OPENMP
+  int numT = (pinned == true) ? numThreads : 1;
+#pragma omp parallel for schedule(static) num_threads(numT) if (numT > 1)
+#endif
+  for (int i=0; i<numRows; i++)
+    for (int j=rowStart[i]; j<rowStart[i+1]; j++)
+      data[j] = 0.0;
+}
+
+void
+ThreadPool::placeVector(double *data, int size)
+{
+#ifdef _OPENMP
+  int numT = (pinned == true) ? numThreads : 1;
+#pragma omp parallel for schedule(static) num_threads(numT) if (numT > 1)
+#endif
+  for (int i=0; i<size; i++)
+    data[i] = 0.0;
+}
+
+void
+ThreadPool::setBLASThreads(void)
+{
+  // the BLAS splits its sums between the threads, so reproducible
+  // results are only had from it on one thread
+#ifdef _BLAS_SET_THREADS
+  int numT = (reproducible == true) ? 1 : numThreads;
+  if (openblas_set_num_threads != 0)
+    openblas_set_num_threads(numT);
+  if (MKL_Set_Num_Threads != 0)
+    MKL_Set_Num_Threads(numT);
+#endif
+}
+
+int
+ThreadPool::getNumProcessors(void)
+{
+#ifdef _OPENMP
+  return omp_get_num_procs();
+#else
+  return 1;
+#endif
+}
+
+double
+ThreadPool::getTime(void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime();
+#else
+  return (double)clock()/CLOCKS_PER_SEC;
+#endif
+}
@@ -0,0 +1,106 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-14 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/ThreadPool.h,v $
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for ThreadPool.
+// ThreadPool holds the one thread count used by the threaded parts of
+// OpenSees: the threaded solvers, the BLAS they call and, when asked for
+// with -numThreads 0, the formation of the element contributions by the
+// integrators. The threads themselves are
+// those of the OpenMP runtime, whose task scheduler shares one pool of
+// workers between all parallel regions; nested parallel regions are run
+// by the thread that encounters them, so a solver or BLAS call made from
+// inside a threaded loop does not start threads of its own. The count is
+// set with the threads command and defaults to 1.
+//
+// The few elements that are expensive enough may also evaluate their own
+// integration points on the threads. They time their serial evaluation and
+// go parallel once it takes longer than the element threshold, so the cost
+// of starting the threads is only paid where it is small in comparison.
+// This is only done by elements whose materials keep no shared work storage.
+//
+// In the reproducible mode the results do not depend on the thread count:
+// the threaded loops already add their contributions in the serial order,
+// the BLAS, whose reductions are split by thread, is kept to one thread and
+// the norms of the LinearSOE used by the convergence tests are formed with
+// compensated summation.
+//
+// On machines with more than one NUMA node the threads may be pinned, each
+// to its own processor. The pages of an array are placed on the node of the
+// thread that first writes them, so with the threads pinned the systems that
+// split their rows between the threads in static blocks have their rows
+// zeroed, and so placed, by the thread that later works on them, and the
+// element loops of the integrators give each thread the same elements every
+// time, their work matrices allocated by that thread.
+//
+// What: "@(#) ThreadPool.h, revA"
+
+#include <OPS_Globals.h>
+
+class ThreadPool
+{
+  public:
+    static int setNumThreads(int numThreads);
+    static int getNumThreads(void) {return numThreads;}
+    static int getNumProcessors(void);
+
+    // the time in seconds of a serial evaluation of the integration points
+    // above which an element evaluates them on the threads; < 0 for never
+    static void setElementThreshold(double seconds) {elementThreshold = seconds;}
+    static double getElementThreshold(void) {return elementThreshold;}
+    static double getTime(void);
+
+    // if the Domain commits, reverts and updates its nodes and elements on
+    // the threads; off by default as the elements must be re-entrant
+    static void setDomainThreaded(bool flag) {domainThreaded = flag;}
+    static bool isDomainThreaded(void) {return domainThreaded;}
+
+    static void setReproducible(bool flag);
+    static bool isReproducible(void) {return reproducible;}
+
+    static int setPinned(bool flag);
+    static bool isPinned(void) {return pinned;}
+
+    // zero data[rowStart[i]] to data[rowStart[i+1]-1] for the numRows rows,
+    // split between the threads as a loop over the rows with a static
+    // schedule; serial unless the threads are pinned
+    static void placeRows(double *data, const int *rowStart, int numRows);
+    static void placeVector(double *data, int size);
+
+  private:
+    static void setBLASThreads(void);
+    static int pinThreads(void);
+
+    static int numThreads;
+    static double elementThreshold;
+    static bool domainThreaded;
+    static bool reproducible;
+    static bool pinned;
+};
+
+#endif
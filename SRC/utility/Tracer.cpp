@@ -0,0 +1,193 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/Tracer.cpp,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class implementation for Tracer.
+//
+// What: "@(#) Tracer.cpp, revA"
+
+#include <Tracer.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+#include <mpi.h>
+#endif
+
+bool Tracer::active = false;
+
+struct TraceEvent {
+  const char *name;
+  char type;
+  int thread;
+  double time;
+};
+
+// the events are kept until there are enough to write
+#define TRACE_FLUSH_SIZE 65536
+
+static TraceEvent *events = 0;
+static int numEvents = 0;
+static int sizeEvents = 0;
+static FILE *traceFile = 0;
+static int traceRank = 0;
+
+static double
+traceTime(void)
+{
+  // microseconds on the wall clock, the same base on all the ranks
+#ifdef _WIN32
+  FILETIME ft;
+  GetSystemTimeAsFileTime(&ft);
+  unsigned long long t = ((unsigned long long)ft.dwHighDateTime << 32) | ft.dwLowDateTime;
+  return t/10.0;
+#else
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec*1.0e6 + tv.tv_usec;
+#endif
+}
+
+static void
+flushEvents(void)
+{
+  if (traceFile == 0)
+    return;
+
+  for (int i=0; i<numEvents; i++) {
+    TraceEvent &theEvent = events[i];
+    fprintf(traceFile, "{\"name\": \"%s\", \"ph\": \"%c\", \"pid\": %d, \"tid\": %d, \"ts\": %.1f},\n",
+	    theEvent.name, theEvent.type, traceRank, theEvent.thread, theEvent.time);
+  }
+  numEvents = 0;
+}
+
+
+void
+Tracer::addEvent(const char *name, char type)
+{
+  double time = traceTime();
+  int thread = 0;
+#ifdef _OPENMP
+  thread = omp_get_thread_num();
+#endif
+
+#ifdef _OPENMP
+#pragma omp critical (TracerEvents)
+#endif
+  {
+    if (numEvents == sizeEvents) {
+      if (sizeEvents >= TRACE_FLUSH_SIZE)
+	flushEvents();
+      else {
+	int newSize = 2*sizeEvents + 8;
+	TraceEvent *newEvents = new TraceEvent[newSize];
+	for (int i=0; i<numEvents; i++)
+	  newEvents[i] = events[i];
+	if (events != 0)
+	  delete [] events;
+	events = newEvents;
+	sizeEvents = newSize;
+      }
+    }
+    events[numEvents].name = name;
+    events[numEvents].type = type;
+    events[numEvents].thread = thread;
+    events[numEvents].time = time;
+    numEvents++;
+  }
+}
+
+
+int
+Tracer::start(const char *fileName)
+{
+  if (active == true)
+    stop();
+
+  traceRank = 0;
+  int numProcs = 1;
+#if defined(_PARALLEL_PROCESSING) || defined(_PARALLEL_INTERPRETERS)
+  int initialized = 0;
+  MPI_Initialized(&initialized);
+  if (initialized) {
+    MPI_Comm_rank(MPI_COMM_WORLD, &traceRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &numProcs);
+  }
+#endif
+
+  if (numProcs > 1) {
+    char *rankName = new char[strlen(fileName)+16];
+    sprintf(rankName, "%s.%d", fileName, traceRank);
+    traceFile = fopen(rankName, "w");
+    delete [] rankName;
+  } else
+    traceFile = fopen(fileName, "w");
+
+  if (traceFile == 0) {
+    opserr << "WARNING Tracer::start() - could not open " << fileName << endln;
+    return -1;
+  }
+
+  // the first rank opens the array of events, each names its process
+  if (traceRank == 0)
+    fprintf(traceFile, "[\n");
+  fprintf(traceFile, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, \"args\": {\"name\": \"rank %d\"}},\n",
+	  traceRank, traceRank);
+
+  numEvents = 0;
+  active = true;
+  return 0;
+}
+
+
+int
+Tracer::stop(void)
+{
+  if (active == false)
+    return 0;
+
+  active = false;
+  flushEvents();
+  fclose(traceFile);
+  traceFile = 0;
+
+  if (events != 0)
+    delete [] events;
+  events = 0;
+  sizeEvents = 0;
+
+  return 0;
+}
@@ -0,0 +1,65 @@
+/* ****************************************************************** **
+**    OpenSees - Open System for Earthquake Engineering Simulation    **
+**          Pacific Earthquake Engineering Research Center            **
+**                                                                    **
+**                                                                    **
+** (C) Copyright 1999, The Regents of the University of California    **
+** All Rights Reserved.                                               **
+**                                                                    **
+** Commercial use of this program without express permission of the   **
+** University of California, Berkeley, is strictly prohibited.  See   **
+** file 'COPYRIGHT'  in main directory for information on usage and   **
+** redistribution,  and for a DISCLAIMER OF ALL WARRANTIES.           **
+**                                                                    **
+** Developed by:                                                      **
+**   Frank McKenna (fmckenna@ce.berkeley.edu)                         **
+**   Gregory L. Fenves (fenves@ce.berkeley.edu)                       **
+**   Filip C. Filippou (filippou@ce.berkeley.edu)                     **
+**                                                                    **
+** ****************************************************************** */
+
+// $Revision: 1.1 $
+// $Date: 2026-10-15 00:00:00 $
+// $Source: /usr/local/cvs/OpenSees/SRC/utility/Tracer.h,v $
+
+// Created: 10/26
+//
+// Description: This file contains the class definition for Tracer.
+// Tracer records timestamped spans, each opened by Tracer::begin() and
+// closed by Tracer::end() with the same name, on every process and
+// thread, and writes them in the Chrome trace event format, to be read by
+// chrome://tracing or Perfetto. The phases of the Profiler are traced,
+// and the parallel code adds the Schur condensation of the subdomains and
+// the MPI_Channel sends and receives, so the idle time of each rank shows
+// on a timeline. The process id of the events is the MPI rank. With more
+// than one process each writes fileName.rank; the files concatenated in
+// rank order (cat fileName.* > fileName) are one trace, the array of
+// events the format allows to be left open.
+//
+// What: "@(#) Tracer.h, revA"
+
+#ifndef Tracer_h
+#define Tracer_h
+
+#include <OPS_Globals.h>
+
+class Tracer
+{
+  public:
+    // name must outlive the trace, a string literal
+    static inline void begin(const char *name)
+      {if (active == true) addEvent(name, 'B');}
+    static inline void end(const char *name)
+      {if (active == true) addEvent(name, 'E');}
+
+    static int start(const char *fileName);
+    static int stop(void);
+    static bool isActive(void) {return active;}
+
+    static bool active;
+
+  private:
+    static void addEvent(const char *name, char type);
+};
+
+#endif